@@ -27,6 +27,9 @@
 #include "BluePrint.h"
 #include "Carpenter.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace Carpenter {
 
 BluePrint::BluePrint(const std::string & name, Carpenter* carpenter)
@@ -40,7 +43,7 @@ BluePrint::BluePrint(const std::string & name, Carpenter* carpenter)
 // }
 
 BuildingBlock::BuildingBlock()
-: mPosition(0,0,0), mAttached(false), mChildBindings(0)
+: mPosition(0,0,0), mAttached(false), mChildBindings(0), mAttachedIndex(0)
 
 {
 mOrientation.identity();
@@ -66,36 +69,77 @@ void BuildingBlock::removeBoundPoint(const AttachPoint* point )
 
 
 
-void BluePrint::doBindingsForBlock(BuildingBlock *block)
+namespace {
+/**
+ * The bindings always refer to blocks in the blueprint, see BluePrint::addBinding.
+ */
+BuildingBlock* getBlock(const BuildingBlock* block)
 {
+	return const_cast<BuildingBlock*>(block);
+}
+
+/**
+ * A block being walked by BluePrint::doBindingsForBlock.
+ */
+struct BindingWalkFrame
+{
+	BindingWalkFrame(BuildingBlock* _block, const std::vector<BluePrint::BindingStore::iterator>* _bindings)
+	: block(_block), bindings(_bindings), next(0) {}
+
+	BuildingBlock* block;
+	const std::vector<BluePrint::BindingStore::iterator>* bindings;
+	size_t next;
 	std::map<BuildingBlock* , std::vector<BuildingBlockBinding*>> relatedBindings;
+};
+}
 
-	std::list< BuildingBlockBinding>::iterator I = mBindings.begin();
-	std::list< BuildingBlockBinding>::iterator I_end = mBindings.end();
+void BluePrint::doBindingsForBlock(BuildingBlock *block)
+{
+	//The walk uses an explicit stack rather than recursion, so that large blueprints can't overflow the call stack.
+	//Only the bindings of each block are looked at, so the whole walk is linear in the number of bindings.
+	static const std::vector<BindingStore::iterator> noBindings;
+	std::vector<BindingWalkFrame> stack;
+
+	BlockBindingIndex::const_iterator I = mBlockBindings.find(block);
+	stack.push_back(BindingWalkFrame(block, I != mBlockBindings.end() ? &I->second : &noBindings));
+
+	while (!stack.empty()) {
+		BindingWalkFrame& frame = stack.back();
+		if (frame.next == frame.bindings->size()) {
+			stack.pop_back();
+			continue;
+		}
+		BuildingBlockBinding& binding = *(*frame.bindings)[frame.next++];
 
-	for (;I != I_end; ++I) {
 		BuildingBlock* unboundBlock = 0;
-		const AttachPair* pair = 0;
-		BuildingBlock* block1 = &mBuildingBlocks.find((*I).mBlock1->getName())->second;
-		BuildingBlock* block2 = &mBuildingBlocks.find((*I).mBlock2->getName())->second;
-		if (block1 == block && !block2->isAttached()) {
+		BuildingBlock* block1 = getBlock(binding.mBlock1);
+		BuildingBlock* block2 = getBlock(binding.mBlock2);
+		if (block1 == frame.block && !block2->isAttached()) {
 			unboundBlock = block2;
-			pair = (*I).mPoint2->getAttachPair();
-		} else if (block2 == block && !block1->isAttached()) {
+		} else if (block2 == frame.block && !block1->isAttached()) {
 			unboundBlock = block1;
-			pair = (*I).mPoint1->getAttachPair();
 		}
 
 		if (unboundBlock) {
-			relatedBindings[unboundBlock].push_back(&(*I));
-			if (relatedBindings[unboundBlock].size() > 1 && !unboundBlock->isAttached()) {
-				placeBindings(unboundBlock, relatedBindings[unboundBlock]);
-				doBindingsForBlock(unboundBlock);
+			std::vector<BuildingBlockBinding*>& related = frame.relatedBindings[unboundBlock];
+			related.push_back(&binding);
+			if (related.size() > 1 && !unboundBlock->isAttached()) {
+				placeBindings(unboundBlock, related);
+				//Note that this invalidates the frame reference.
+				I = mBlockBindings.find(unboundBlock);
+				stack.push_back(BindingWalkFrame(unboundBlock, I != mBlockBindings.end() ? &I->second : &noBindings));
 			}
 		}
 	}
 }
 
+void BluePrint::attachBlock(BuildingBlock* block)
+{
+	block->mAttached = true;
+	block->mAttachedIndex = mAttachedBlocks.size();
+	mAttachedBlocks.push_back(block);
+}
+
 bool BluePrint::isRemovable(const BuildingBlock* bblock) const
 {
 	//cannot remove the starting block
@@ -122,47 +166,38 @@ bool BluePrint::remove(const BuildingBlock* _bblock)
 	}
 	BuildingBlock* bblock = &mBuildingBlocks.find(_bblock->getName())->second;
 
-	std::list< BuildingBlockBinding>::iterator I = mBindings.begin();
-	std::list< BuildingBlockBinding>::iterator I_end = mBindings.end();
-	std::list< BuildingBlockBinding>::iterator I_remove = mBindings.end();
-
-	for (; I != I_end; ++I) {
-		if (I_remove != mBindings.end()) {
-			mBindings.erase(I_remove);
-			I_remove = mBindings.end();
-		}
-
-		if ((*I).getBlock1() == bblock) {
-			BuildingBlock* boundBlock = &mBuildingBlocks.find((*I).mBlock2->getName())->second;
-			boundBlock->removeBoundPoint((*I).getAttachPoint2());
+	BlockBindingIndex::iterator I = mBlockBindings.find(bblock);
+	if (I != mBlockBindings.end()) {
+		std::vector<BindingStore::iterator>& bindings = I->second;
+		for (std::vector<BindingStore::iterator>::iterator J = bindings.begin(); J != bindings.end(); ++J) {
+			BindingStore::iterator binding = *J;
+			BuildingBlock* boundBlock;
+			if (binding->getBlock1() == bblock) {
+				boundBlock = getBlock(binding->mBlock2);
+				boundBlock->removeBoundPoint(binding->getAttachPoint2());
+			} else {
+				boundBlock = getBlock(binding->mBlock1);
+				boundBlock->removeBoundPoint(binding->getAttachPoint1());
+			}
 			//decrease the number of child bindings for the parent block
 			--(boundBlock->mChildBindings);
-			I_remove = I;
-		} else if ((*I).getBlock2() == bblock) {
-			BuildingBlock* boundBlock = &mBuildingBlocks.find((*I).mBlock1->getName())->second;
-			boundBlock->removeBoundPoint((*I).getAttachPoint1());
-			--(boundBlock->mChildBindings);
-			I_remove = I;
+
+			if (boundBlock != bblock) {
+				std::vector<BindingStore::iterator>& boundBindings = mBlockBindings[boundBlock];
+				boundBindings.erase(std::find(boundBindings.begin(), boundBindings.end(), binding));
+			}
+			mBindings.erase(binding);
 		}
-	}
-	if (I_remove != mBindings.end()) {
-		mBindings.erase(I_remove);
-		I_remove = mBindings.end();
+		mBlockBindings.erase(I);
 	}
 
-	//check if it's in the attached blocks vector and remove it
-	std::vector<BuildingBlock*>::iterator pos = mAttachedBlocks.end();
-	std::vector<BuildingBlock*>::iterator J = mAttachedBlocks.begin();
-	std::vector<BuildingBlock*>::iterator J_end = mAttachedBlocks.end();
-	for (; J!=J_end; ++J) {
-		if ((*J) == bblock) {
-			pos = J;
-			break;
+	//if it's in the attached blocks remove it, keeping the order of the others since serializers depend on it
+	if (bblock->isAttached() && bblock->mAttachedIndex < mAttachedBlocks.size() && mAttachedBlocks[bblock->mAttachedIndex] == bblock) {
+		std::vector<BuildingBlock*>::iterator J = mAttachedBlocks.erase(mAttachedBlocks.begin() + bblock->mAttachedIndex);
+		for (; J != mAttachedBlocks.end(); ++J) {
+			--((*J)->mAttachedIndex);
 		}
 	}
-	if (pos != mAttachedBlocks.end()) {
-		mAttachedBlocks.erase(pos);
-	}
 
 
 	mBuildingBlocks.erase(bblock->getName());
@@ -195,8 +230,7 @@ void BluePrint::compile()
 	mAttachedBlocks.clear();
 
 // 	BuildingBlock* baseBlock = mStartingBlock;
-	mStartingBlock->mAttached = true;
-	mAttachedBlocks.push_back(mStartingBlock);
+	attachBlock(mStartingBlock);
 	doBindingsForBlock(mStartingBlock);
 
 // 	std::vector< BuildingBlockBinding>::iterator I = mBindings.begin();
@@ -302,10 +336,20 @@ BuildingBlockBinding* BluePrint::addBinding(BuildingBlockBindingDefinition defin
 
 BuildingBlockBinding* BluePrint::addBinding(const BuildingBlock* block1, const AttachPoint* point1, const BuildingBlock* block2,	const AttachPoint* point2)
 {
-	BuildingBlockBinding binding(block1, point1, block2, point2);
+	//Always refer to the blocks in the blueprint, so that they can be altered when the blueprint is compiled.
+	BuildingBlockStore::iterator I1 = mBuildingBlocks.find(block1->getName());
+	BuildingBlockStore::iterator I2 = mBuildingBlocks.find(block2->getName());
+	if (I1 == mBuildingBlocks.end() || I2 == mBuildingBlocks.end()) {
+		return 0;
+	}
+	BuildingBlockBinding binding(&I1->second, point1, &I2->second, point2);
 
-	mBindings.push_back(binding);
-	return &mBindings.back();
+	BindingStore::iterator I = mBindings.insert(mBindings.end(), binding);
+	mBlockBindings[&I1->second].push_back(I);
+	if (&I2->second != &I1->second) {
+		mBlockBindings[&I2->second].push_back(I);
+	}
+	return &(*I);
 
 }
 
@@ -399,8 +443,7 @@ void BluePrint::placeBindings(BuildingBlock* unboundBlock, std::vector<BuildingB
 	unboundBlock->setOrientation(unboundBlock->getOrientation() * neededRotation.inverse());
 
 
-	unboundBlock->mAttached = true;
-	mAttachedBlocks.push_back(unboundBlock);
+	attachBlock(unboundBlock);
 
 	//we now have to position the block
 	WFMath::Vector<3> distance = boundBlock->getWorldPositionForPoint(boundPoint1) - unboundBlock->getWorldPositionForPoint(unboundPoint1);
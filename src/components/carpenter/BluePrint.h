@@ -33,6 +33,7 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <unordered_map>
 
 namespace Carpenter
 {
@@ -184,6 +185,11 @@ namespace Carpenter
      */
     int mChildBindings;
 
+    /**
+     the position of the block in the attached blocks of the blueprint, if it's attached
+     */
+    size_t mAttachedIndex;
+
   };
 
   inline bool
@@ -246,9 +252,18 @@ namespace Carpenter
 //    	void deleteBuildingBlock(const std::string & name);
     BuildingBlockBinding*
     addBinding(BuildingBlockBindingDefinition definition);
+
+    /**
+     *    adds a binding between two blocks of the blueprint
+     * @return the new binding, or null if any of the blocks isn't part of the blueprint
+     */
     BuildingBlockBinding*
     addBinding(const BuildingBlock* block1, const AttachPoint* point1,
         const BuildingBlock* block2, const AttachPoint* point2);
+
+    /**
+     *    the attached blocks, in the order they were placed
+     */
     const std::vector<BuildingBlock*>
     getAttachedBlocks() const;
     const std::list<BuildingBlockBinding>*
@@ -291,9 +306,16 @@ namespace Carpenter
     remove(const BuildingBlock* bblock);
 
     typedef std::map<const std::string, BuildingBlock> BuildingBlockStore;
+    typedef std::list<BuildingBlockBinding> BindingStore;
+
+    /**
+     the bindings of each block, in the order they were added
+     */
+    typedef std::unordered_map<const BuildingBlock*, std::vector<BindingStore::iterator>> BlockBindingIndex;
   protected:
     BuildingBlockStore mBuildingBlocks;
-    std::list<BuildingBlockBinding> mBindings;
+    BindingStore mBindings;
+    BlockBindingIndex mBlockBindings;
 
     std::vector<BuildingBlock*> mAttachedBlocks;
     BuildingBlock* mStartingBlock;
@@ -301,9 +323,21 @@ namespace Carpenter
 
     Carpenter* mCarpenter;
 
+    /**
+     *    places all blocks which can be reached from the block, depth first
+     *    each block is placed through the first two bindings which bind it to the same attached block
+     * @param block an attached block
+     */
     void
     doBindingsForBlock(BuildingBlock *block);
 
+    /**
+     *    marks the block as attached and adds it to the attached blocks
+     * @param block
+     */
+    void
+    attachBlock(BuildingBlock* block);
+
   };
 
   inline Carpenter* const
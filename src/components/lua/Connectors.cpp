@@ -19,6 +19,7 @@
 
 #include "Connectors.h"
 #include "LuaHelper.h"
+#include "LuaProfiler.h"
 #include "luaobject.h"
 #include "services/EmberServices.h"
 #include "services/scripting/ScriptingService.h"
@@ -119,6 +120,11 @@ void ConnectorBase::callFunction(lua_State* state, int numberOfArguments)
 
 	luaPop pop(state, 1); // pops error handler on exit
 
+	LuaProfiler::Scope profilerScope;
+	if (LuaProfiler* profiler = LuaProfiler::getActiveInstance()) {
+		profilerScope.enter(*profiler, mLuaMethod.empty() ? LuaProfiler::describeFunction(state, error_index + 1) : mLuaMethod);
+	}
+
 	// call it
 	int error = lua_pcall(state, numberOfArguments, LUA_MULTRET, error_index);
 
@@ -0,0 +1,475 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "LuaProfiler.h"
+
+#include "framework/LoggingInstance.h"
+#include "framework/ConsoleBackend.h"
+#include "framework/MainLoopController.h"
+#include "framework/Tokeniser.h"
+#include "framework/osdir.h"
+#include "services/EmberServices.h"
+#include "services/config/ConfigService.h"
+
+extern "C" {
+#include "lua.h"
+}
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+
+namespace Ember
+{
+namespace Lua
+{
+
+namespace
+{
+/**
+ * @brief The max number of Lua stack levels captured in each sample.
+ */
+const int MAX_STACK_DEPTH = 64;
+
+const int DEFAULT_INSTRUCTION_INTERVAL = 1000;
+
+boost::posix_time::ptime now()
+{
+	return boost::posix_time::microsec_clock::universal_time();
+}
+
+struct FunctionEntry
+{
+	const std::string* name;
+	long long selfMicroseconds;
+	long long totalMicroseconds;
+	long long maxFrameMicroseconds;
+	unsigned int samples;
+
+	bool operator<(const FunctionEntry& rhs) const
+	{
+		return selfMicroseconds > rhs.selfMicroseconds;
+	}
+};
+}
+
+LuaProfiler* LuaProfiler::sActiveInstance = 0;
+
+LuaProfiler::Scope::Scope() :
+		mProfiler(0)
+{
+}
+
+LuaProfiler::Scope::~Scope()
+{
+	if (mProfiler) {
+		mProfiler->leaveScope();
+	}
+}
+
+void LuaProfiler::Scope::enter(LuaProfiler& profiler, const std::string& name)
+{
+	mProfiler = &profiler;
+	mProfiler->enterScope(name);
+}
+
+LuaProfiler::FunctionStats::FunctionStats() :
+		selfMicroseconds(0), totalMicroseconds(0), frameMicroseconds(0), maxFrameMicroseconds(0), samples(0)
+{
+}
+
+LuaProfiler::LuaProfiler(lua_State* state) :
+		Profile("+lua_profile", this, "Starts the Lua profiler. Usage: +lua_profile [number of instructions between each sample]"),
+		ResetProfile("lua_profile_reset", this, "Clears all data collected by the Lua profiler."),
+		DumpProfile("lua_profile_dump", this, "Writes the flat profile and the folded stacks collected by the Lua profiler to the 'luaprofiles' directory in the home directory. Usage: lua_profile_dump [name]"),
+		mState(state), mInstructionInterval(DEFAULT_INSTRUCTION_INTERVAL), mImplicitDepth(0), mTotalMicroseconds(0), mFrameMicroseconds(0), mMaxFrameMicroseconds(0), mFrames(0)
+{
+}
+
+LuaProfiler::~LuaProfiler()
+{
+	stop();
+}
+
+LuaProfiler* LuaProfiler::getActiveInstance()
+{
+	return sActiveInstance;
+}
+
+std::string LuaProfiler::describeFunction(lua_State* state, int index)
+{
+	lua_Debug debug;
+	lua_pushvalue(state, index);
+	lua_getinfo(state, ">S", &debug);
+	debug.name = 0;
+	return describeFunction(debug);
+}
+
+void LuaProfiler::start(int instructionInterval)
+{
+	if (sActiveInstance && sActiveInstance != this) {
+		S_LOG_WARNING("Another Lua profiler is already running.");
+		return;
+	}
+	mInstructionInterval = std::max(1, instructionInterval);
+	sActiveInstance = this;
+	mScopes.clear();
+	mSavedStacks.clear();
+	mLastStack.clear();
+	mImplicitDepth = 0;
+	mLastEventTime = now();
+	if (MainLoopController::hasInstance()) {
+		mFrameProcessedConnection = MainLoopController::getSingleton().EventFrameProcessed.connect(sigc::mem_fun(*this, &LuaProfiler::frameProcessed));
+	}
+	updateHook();
+	S_LOG_INFO("Started Lua profiler, sampling every " << mInstructionInterval << " instructions.");
+}
+
+void LuaProfiler::stop()
+{
+	if (sActiveInstance != this) {
+		return;
+	}
+	lua_sethook(mState, 0, 0, 0);
+	mFrameProcessedConnection.disconnect();
+	sActiveInstance = 0;
+	mScopes.clear();
+	mSavedStacks.clear();
+	mLastStack.clear();
+	mImplicitDepth = 0;
+	S_LOG_INFO("Stopped Lua profiler.");
+}
+
+bool LuaProfiler::isRunning() const
+{
+	return sActiveInstance == this;
+}
+
+void LuaProfiler::reset()
+{
+	mFunctions.clear();
+	mFoldedStacks.clear();
+	mFrameFunctions.clear();
+	mTotalMicroseconds = 0;
+	mFrameMicroseconds = 0;
+	mMaxFrameMicroseconds = 0;
+	mFrames = 0;
+	mLastEventTime = now();
+}
+
+void LuaProfiler::enterScope(const std::string& name)
+{
+	if (!isRunning()) {
+		return;
+	}
+	attributeElapsedTime();
+	mSavedStacks.push_back(mLastStack);
+	mScopes.push_back(name);
+	mLastStack = mScopes;
+	updateHook();
+}
+
+void LuaProfiler::leaveScope()
+{
+	if (!isRunning() || mScopes.empty()) {
+		return;
+	}
+	attributeElapsedTime();
+	mScopes.pop_back();
+	mLastStack = mSavedStacks.back();
+	mSavedStacks.pop_back();
+	updateHook();
+}
+
+void LuaProfiler::updateHook()
+{
+	int mask = LUA_MASKCOUNT;
+	if (mImplicitDepth > 0) {
+		mask |= LUA_MASKCALL | LUA_MASKRET;
+	} else if (mScopes.empty()) {
+		mask |= LUA_MASKCALL;
+	}
+	lua_sethook(mState, &LuaProfiler::hook, mask, mInstructionInterval);
+}
+
+void LuaProfiler::hook(lua_State* state, lua_Debug* debug)
+{
+	LuaProfiler* profiler = sActiveInstance;
+	if (!profiler) {
+		return;
+	}
+	switch (debug->event) {
+	case LUA_HOOKCOUNT:
+		profiler->sample();
+		break;
+	case LUA_HOOKCALL:
+		profiler->functionCalled(debug);
+		break;
+	case LUA_HOOKRET:
+#ifdef LUA_HOOKTAILRET
+	case LUA_HOOKTAILRET:
+#endif
+		profiler->functionReturned();
+		break;
+	default:
+		break;
+	}
+}
+
+void LuaProfiler::sample()
+{
+	if (mScopes.empty()) {
+		mLastEventTime = now();
+		return;
+	}
+	Stack stack;
+	captureStack(stack);
+	mLastStack.swap(stack);
+	attributeElapsedTime();
+}
+
+void LuaProfiler::functionCalled(lua_Debug* debug)
+{
+	if (mImplicitDepth > 0) {
+		mImplicitDepth++;
+		return;
+	}
+	if (!mScopes.empty()) {
+		return;
+	}
+	//Lua was entered from somewhere which doesn't open a scope of its own, so we'll open one for it.
+	lua_getinfo(mState, "Sn", debug);
+	mImplicitDepth = 1;
+	enterScope(describeFunction(*debug));
+}
+
+void LuaProfiler::functionReturned()
+{
+	if (mImplicitDepth == 0) {
+		return;
+	}
+	mImplicitDepth--;
+	if (mImplicitDepth == 0) {
+		leaveScope();
+	}
+}
+
+void LuaProfiler::attributeElapsedTime()
+{
+	boost::posix_time::ptime currentTime = now();
+	if (!mLastStack.empty()) {
+		attribute(mLastStack, (currentTime - mLastEventTime).total_microseconds());
+	}
+	mLastEventTime = currentTime;
+}
+
+void LuaProfiler::attribute(const Stack& stack, long long microseconds)
+{
+	if (microseconds <= 0 || stack.empty()) {
+		return;
+	}
+	std::string folded;
+	for (Stack::const_iterator I = stack.begin(); I != stack.end(); ++I) {
+		if (I != stack.begin()) {
+			folded += ';';
+		}
+		folded += *I;
+	}
+	mFoldedStacks[folded] += microseconds;
+
+	FunctionStats& leaf = mFunctions[stack.back()];
+	leaf.selfMicroseconds += microseconds;
+	leaf.samples++;
+
+	//Recursive functions appear several times in the stack, but should only count once towards the inclusive time.
+	for (Stack::const_iterator I = stack.begin(); I != stack.end(); ++I) {
+		if (std::find(stack.begin(), I, *I) != I) {
+			continue;
+		}
+		FunctionStats& stats = mFunctions[*I];
+		if (stats.frameMicroseconds == 0) {
+			mFrameFunctions.push_back(&stats);
+		}
+		stats.totalMicroseconds += microseconds;
+		stats.frameMicroseconds += microseconds;
+	}
+	mTotalMicroseconds += microseconds;
+	mFrameMicroseconds += microseconds;
+}
+
+void LuaProfiler::captureStack(Stack& stack)
+{
+	stack = mScopes;
+	const size_t scopeSize = stack.size();
+	lua_Debug debug;
+	for (int level = 0; level < MAX_STACK_DEPTH && lua_getstack(mState, level, &debug); ++level) {
+		lua_getinfo(mState, "Sn", &debug);
+		stack.push_back(describeFunction(debug));
+	}
+	//Lua walks the stack from the innermost function, but we want the outermost first.
+	std::reverse(stack.begin() + scopeSize, stack.end());
+}
+
+std::string LuaProfiler::describeFunction(const lua_Debug& debug)
+{
+	std::stringstream ss;
+	if (debug.what && *debug.what == 'C') {
+		ss << (debug.name ? debug.name : "[C]");
+	} else {
+		if (debug.name) {
+			ss << debug.name << " ";
+		}
+		ss << "(" << debug.short_src << ":" << debug.linedefined << ")";
+	}
+	std::string description = ss.str();
+	//Semicolons separate the frames in the folded output.
+	std::replace(description.begin(), description.end(), ';', ':');
+	return description;
+}
+
+void LuaProfiler::frameEnded()
+{
+	//Errors unwind the Lua stack without any return events, so an implicit scope might still be open.
+	if (mImplicitDepth > 0) {
+		mImplicitDepth = 1;
+		functionReturned();
+	}
+	mFrames++;
+	mMaxFrameMicroseconds = std::max(mMaxFrameMicroseconds, mFrameMicroseconds);
+	mFrameMicroseconds = 0;
+	for (std::vector<FunctionStats*>::const_iterator I = mFrameFunctions.begin(); I != mFrameFunctions.end(); ++I) {
+		FunctionStats* stats = *I;
+		stats->maxFrameMicroseconds = std::max(stats->maxFrameMicroseconds, stats->frameMicroseconds);
+		stats->frameMicroseconds = 0;
+	}
+	mFrameFunctions.clear();
+}
+
+void LuaProfiler::frameProcessed(const TimeFrame&, unsigned int)
+{
+	frameEnded();
+}
+
+void LuaProfiler::writeFlatProfile(std::ostream& stream, size_t maxEntries) const
+{
+	std::vector<FunctionEntry> entries;
+	entries.reserve(mFunctions.size());
+	for (FunctionStatsStore::const_iterator I = mFunctions.begin(); I != mFunctions.end(); ++I) {
+		FunctionEntry entry;
+		entry.name = &I->first;
+		entry.selfMicroseconds = I->second.selfMicroseconds;
+		entry.totalMicroseconds = I->second.totalMicroseconds;
+		entry.maxFrameMicroseconds = std::max(I->second.maxFrameMicroseconds, I->second.frameMicroseconds);
+		entry.samples = I->second.samples;
+		entries.push_back(entry);
+	}
+	std::sort(entries.begin(), entries.end());
+	if (maxEntries && entries.size() > maxEntries) {
+		entries.resize(maxEntries);
+	}
+
+	const unsigned int frames = std::max(mFrames, 1u);
+	stream << std::fixed << std::setprecision(2);
+	stream << "Lua profile: " << mTotalMicroseconds / 1000.0 << " ms in Lua over " << mFrames << " frames, " << (mTotalMicroseconds / 1000.0) / frames << " ms per frame on average, " << std::max(mMaxFrameMicroseconds, mFrameMicroseconds) / 1000.0 << " ms max." << std::endl;
+	stream << std::setw(10) << "self ms" << std::setw(7) << "self%" << std::setw(10) << "total ms" << std::setw(12) << "ms/frame" << std::setw(12) << "max ms" << std::setw(9) << "samples" << "  name" << std::endl;
+	for (std::vector<FunctionEntry>::const_iterator I = entries.begin(); I != entries.end(); ++I) {
+		stream << std::setw(10) << I->selfMicroseconds / 1000.0;
+		stream << std::setw(7) << (mTotalMicroseconds ? (I->selfMicroseconds * 100.0) / mTotalMicroseconds : 0.0);
+		stream << std::setw(10) << I->totalMicroseconds / 1000.0;
+		stream << std::setw(12) << (I->totalMicroseconds / 1000.0) / frames;
+		stream << std::setw(12) << I->maxFrameMicroseconds / 1000.0;
+		stream << std::setw(9) << I->samples;
+		stream << "  " << *I->name << std::endl;
+	}
+}
+
+void LuaProfiler::writeFoldedStacks(std::ostream& stream) const
+{
+	for (FoldedStackStore::const_iterator I = mFoldedStacks.begin(); I != mFoldedStacks.end(); ++I) {
+		stream << I->first << " " << I->second << std::endl;
+	}
+}
+
+std::string LuaProfiler::getProfileDirectory() const
+{
+	std::string directory = EmberServices::getSingleton().getConfigService().getHomeDirectory() + "/luaprofiles/";
+	try {
+		oslink::directory osdir(directory);
+		if (!osdir) {
+			oslink::directory::mkdir(directory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for Lua profiles." << ex);
+	}
+	return directory;
+}
+
+void LuaProfiler::runCommand(const std::string &command, const std::string &args)
+{
+	if (Profile == command) {
+		int interval = DEFAULT_INSTRUCTION_INTERVAL;
+		Tokeniser tokeniser;
+		tokeniser.initTokens(args);
+		std::string intervalString = tokeniser.nextToken();
+		if (!intervalString.empty()) {
+			interval = std::atoi(intervalString.c_str());
+		} else if (EmberServices::getSingleton().getConfigService().itemExists("lua", "profileinterval")) {
+			interval = static_cast<int>(EmberServices::getSingleton().getConfigService().getValue("lua", "profileinterval"));
+		}
+		start(interval);
+		std::stringstream ss;
+		ss << "Lua profiler started, sampling every " << mInstructionInterval << " instructions.";
+		ConsoleBackend::getSingleton().pushMessage(ss.str(), "info");
+	} else if (Profile.getInverseCommand() == command) {
+		stop();
+		std::stringstream ss;
+		writeFlatProfile(ss, 20);
+		ConsoleBackend::getSingleton().pushMessage(ss.str(), "info");
+	} else if (ResetProfile == command) {
+		reset();
+		ConsoleBackend::getSingleton().pushMessage("Lua profile cleared.", "info");
+	} else if (DumpProfile == command) {
+		Tokeniser tokeniser;
+		tokeniser.initTokens(args);
+		std::string name = tokeniser.nextToken();
+		if (name.empty()) {
+			name = "profile";
+		}
+		const std::string path = getProfileDirectory() + name;
+		std::ofstream flatStream((path + ".txt").c_str());
+		std::ofstream foldedStream((path + ".folded").c_str());
+		if (!flatStream || !foldedStream) {
+			ConsoleBackend::getSingleton().pushMessage("Could not write Lua profile to '" + path + "'.", "error");
+			return;
+		}
+		writeFlatProfile(flatStream);
+		writeFoldedStacks(foldedStream);
+		ConsoleBackend::getSingleton().pushMessage("Wrote Lua profile to '" + path + ".txt' and folded stacks to '" + path + ".folded'.", "info");
+	}
+}
+
+}
+}
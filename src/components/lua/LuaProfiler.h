@@ -0,0 +1,294 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBER_LUA_LUAPROFILER_H_
+#define EMBER_LUA_LUAPROFILER_H_
+
+#include "framework/ConsoleObject.h"
+
+#include <sigc++/connection.h>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+
+struct lua_State;
+struct lua_Debug;
+
+namespace Ember
+{
+class TimeFrame;
+
+namespace Lua
+{
+
+/**
+ * @brief A sampling profiler for Lua code.
+ *
+ * When running, a Lua count hook takes a sample every n:th executed instruction. Each sample captures the current Lua call stack, and the wall clock time since the previous sample is attributed to it. Since the time spent in any C++ code called from Lua ends up in the following sample, such time is attributed to the Lua function which made the call.
+ *
+ * All calls into Lua are grouped under "scopes", which describe what caused the call. Connectors and the LuaScriptingProvider open scopes explicitly, using the name of the signal handler, script or function called. Any other call into Lua (such as CEGUI event handlers) opens an implicit scope named after the function called. These are detected through a call hook, which is only active while no explicit scope is open.
+ *
+ * Time is aggregated per function (self time, inclusive time and max time in any single frame) and per call stack. The latter are written in the "folded" format used by flame graph tools.
+ *
+ * The profiler is controlled through the "+lua_profile", "lua_profile_reset" and "lua_profile_dump" console commands.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class LuaProfiler: public ConsoleObject
+{
+public:
+
+	/**
+	 * @brief Keeps a profiler scope open for as long as the instance exists.
+	 *
+	 * Use this around calls into Lua, so that the scope is properly closed even if an exception is thrown.
+	 */
+	class Scope
+	{
+	public:
+		Scope();
+		~Scope();
+
+		/**
+		 * @brief Opens a scope.
+		 * @param profiler The profiler.
+		 * @param name The name of the scope.
+		 */
+		void enter(LuaProfiler& profiler, const std::string& name);
+
+	private:
+		LuaProfiler* mProfiler;
+	};
+
+	/**
+	 * @brief Ctor.
+	 * @param state The lua state to profile.
+	 */
+	LuaProfiler(lua_State* state);
+
+	virtual ~LuaProfiler();
+
+	/**
+	 * @brief Gets the running profiler, if any.
+	 * Use this to check if a scope should be opened; building the scope name isn't free.
+	 * @return The running profiler, or null if no profiler is running.
+	 */
+	static LuaProfiler* getActiveInstance();
+
+	/**
+	 * @brief Describes a function on the Lua stack, by the file and line where it's defined.
+	 * @param state The lua state.
+	 * @param index The stack index of the function.
+	 * @return A description of the function.
+	 */
+	static std::string describeFunction(lua_State* state, int index);
+
+	/**
+	 * @brief Starts profiling.
+	 * @param instructionInterval The number of Lua instructions between each sample.
+	 */
+	void start(int instructionInterval);
+
+	/**
+	 * @brief Stops profiling. Any collected data is kept.
+	 */
+	void stop();
+
+	/**
+	 * @brief Returns true if the profiler is running.
+	 */
+	bool isRunning() const;
+
+	/**
+	 * @brief Clears all collected data.
+	 */
+	void reset();
+
+	/**
+	 * @brief Opens a scope. Every call to this must be matched by a call to leaveScope().
+	 * @param name The name of the scope.
+	 */
+	void enterScope(const std::string& name);
+
+	/**
+	 * @brief Closes the innermost scope.
+	 */
+	void leaveScope();
+
+	/**
+	 * @brief Marks the end of a frame, updating the per frame statistics.
+	 */
+	void frameEnded();
+
+	/**
+	 * @brief Writes a flat profile, sorted by self time.
+	 * @param stream The stream to write to.
+	 * @param maxEntries The max number of functions to write, or 0 to write all.
+	 */
+	void writeFlatProfile(std::ostream& stream, size_t maxEntries = 0) const;
+
+	/**
+	 * @brief Writes all call stacks in the "folded" format, with one stack per line and the time in microseconds as value.
+	 * @param stream The stream to write to.
+	 */
+	void writeFoldedStacks(std::ostream& stream) const;
+
+	virtual void runCommand(const std::string &command, const std::string &args);
+
+	/**
+	 * @brief Starts (+lua_profile) and stops (-lua_profile) the profiler.
+	 */
+	const ConsoleCommandWrapper Profile;
+
+	/**
+	 * @brief Clears all collected data.
+	 */
+	const ConsoleCommandWrapper ResetProfile;
+
+	/**
+	 * @brief Writes the flat profile and the folded stacks to files.
+	 */
+	const ConsoleCommandWrapper DumpProfile;
+
+private:
+
+	/**
+	 * @brief Collected data for a single function or scope.
+	 */
+	struct FunctionStats
+	{
+		FunctionStats();
+
+		/**
+		 * @brief Time spent in the function itself.
+		 */
+		long long selfMicroseconds;
+
+		/**
+		 * @brief Time spent in the function and in everything called by it.
+		 */
+		long long totalMicroseconds;
+
+		/**
+		 * @brief Inclusive time spent during the current frame.
+		 */
+		long long frameMicroseconds;
+
+		/**
+		 * @brief The max inclusive time spent during any single frame.
+		 */
+		long long maxFrameMicroseconds;
+
+		/**
+		 * @brief The number of samples where the function was at the top of the stack.
+		 */
+		unsigned int samples;
+	};
+
+	typedef std::map<std::string, FunctionStats> FunctionStatsStore;
+	typedef std::map<std::string, long long> FoldedStackStore;
+	typedef std::vector<std::string> Stack;
+
+	/**
+	 * @brief The running profiler, if any.
+	 * Lua hooks are plain C functions, so this is needed to find our way back from them.
+	 */
+	static LuaProfiler* sActiveInstance;
+
+	lua_State* mState;
+
+	int mInstructionInterval;
+
+	/**
+	 * @brief The names of the currently open scopes, outermost first.
+	 */
+	Stack mScopes;
+
+	/**
+	 * @brief The stack last sampled in each enclosing scope, restored when the inner scope is closed.
+	 */
+	std::vector<Stack> mSavedStacks;
+
+	/**
+	 * @brief The stack which any time since the last event will be attributed to.
+	 */
+	Stack mLastStack;
+
+	/**
+	 * @brief The call depth within the current implicit scope, or 0 if there's no implicit scope open.
+	 */
+	int mImplicitDepth;
+
+	/**
+	 * @brief The time of the last sample, or of the last change of scope.
+	 */
+	boost::posix_time::ptime mLastEventTime;
+
+	FunctionStatsStore mFunctions;
+
+	FoldedStackStore mFoldedStacks;
+
+	/**
+	 * @brief The functions which have had time attributed to them during the current frame.
+	 */
+	std::vector<FunctionStats*> mFrameFunctions;
+
+	long long mTotalMicroseconds;
+	long long mFrameMicroseconds;
+	long long mMaxFrameMicroseconds;
+	unsigned int mFrames;
+
+	sigc::connection mFrameProcessedConnection;
+
+	/**
+	 * @brief The Lua hook function.
+	 */
+	static void hook(lua_State* state, lua_Debug* debug);
+
+	void sample();
+
+	void functionCalled(lua_Debug* debug);
+
+	void functionReturned();
+
+	void attributeElapsedTime();
+
+	void attribute(const Stack& stack, long long microseconds);
+
+	void captureStack(Stack& stack);
+
+	/**
+	 * @brief Sets the Lua hook mask to match the current state.
+	 * Call hooks are expensive, so we only listen for them when needed to detect implicit scopes.
+	 */
+	void updateHook();
+
+	static std::string describeFunction(const lua_Debug& debug);
+
+	void frameProcessed(const TimeFrame& timeFrame, unsigned int frameActionMask);
+
+	std::string getProfileDirectory() const;
+};
+
+}
+}
+
+#endif /* EMBER_LUA_LUAPROFILER_H_ */
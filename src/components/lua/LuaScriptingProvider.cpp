@@ -43,6 +43,7 @@ extern "C" {
 #include <tolua++.h>
 #include "LuaHelper.h"
 #include "LuaScriptingCallContext.h"
+#include "LuaProfiler.h"
 
 
 
@@ -51,7 +52,7 @@ namespace Ember {
 namespace Lua {
 
 LuaScriptingProvider::LuaScriptingProvider()
-: mService(0), mErrorHandlingFunctionName("")
+: mService(0), mLuaState(0), mErrorHandlingFunctionName("")
 {
 	initialize();
 }
@@ -60,11 +61,13 @@ LuaScriptingProvider::LuaScriptingProvider()
 LuaScriptingProvider::~LuaScriptingProvider()
 {
 	S_LOG_INFO("Shutting down lua environment.");
+	mProfiler.reset();
 	lua_close(mLuaState);
 }
 
 void LuaScriptingProvider::stop()
 {
+	mProfiler->stop();
 	try {
 		//we want to clear up the lua environment without destroying it (lua_close destroys it)
 		std::string shutdownScript("for key,value in pairs(_G) do if key ~= \"_G\" and key ~= \"pairs\" then _G[key] = nil end end");
@@ -127,6 +130,8 @@ void LuaScriptingProvider::createState()
 		lua_call(mLuaState, 1, 0);
 	}
 
+	mProfiler.reset(new LuaProfiler(mLuaState));
+
 
 // 	lua_pushcfunction(mLuaState, ::OgreView::Scripting::LuaHelper::luaErrorHandler);
 // 	mErrorHandlingFunctionIndex = luaL_ref(mLuaState, LUA_REGISTRYINDEX);
@@ -149,6 +154,11 @@ lua_State* LuaScriptingProvider::getLuaState()
 	return mLuaState;
 }
 
+LuaProfiler& LuaScriptingProvider::getProfiler()
+{
+	return *mProfiler;
+}
+
 
 
 void LuaScriptingProvider::loadScript(ResourceWrapper& resWrapper)
@@ -195,6 +205,11 @@ void LuaScriptingProvider::executeScriptImpl(const std::string& scriptCode, LuaS
 //         int error_index = lua_gettop(mLuaState);
 
 
+		LuaProfiler::Scope profilerScope;
+		if (LuaProfiler* profiler = LuaProfiler::getActiveInstance()) {
+			profilerScope.enter(*profiler, scriptName.empty() ? "script" : scriptName);
+		}
+
 		// load code into lua and call it
 		int error;
 //		int nresults;
@@ -265,6 +280,11 @@ void LuaScriptingProvider::callFunctionImpl(const std::string& functionName, int
 		lua_insert(mLuaState, top - narg + 1);									// st: func args err_h
 		lua_insert(mLuaState, top - narg + 1);									// st: err_h func args
 		error_index = top - narg + 1;
+		LuaProfiler::Scope profilerScope;
+		if (LuaProfiler* profiler = LuaProfiler::getActiveInstance()) {
+			profilerScope.enter(*profiler, functionName);
+		}
+
 		// load code into lua and call it
 		int error, nresults;
 		int level = lua_gettop(mLuaState); // top of stack position
@@ -25,6 +25,8 @@
 
 #include "framework/IScriptingProvider.h"
 
+#include <memory>
+
 struct lua_State;
 
 namespace Ember
@@ -37,6 +39,7 @@ class ScriptingService;
 namespace Lua {
 
 class LuaScriptingCallContext;
+class LuaProfiler;
 
 /**
 @brief A scripting provider for Lua.
@@ -110,6 +113,12 @@ public:
 	 */
 	lua_State* getLuaState();
 
+	/**
+	 * @brief Gets the profiler for the lua environment.
+	 * @return The profiler.
+	 */
+	LuaProfiler& getProfiler();
+
 
 // 	int getErrorHandlingFunctionIndex() const;
 
@@ -162,6 +171,11 @@ private:
 	 */
 	std::string mErrorHandlingFunctionName;
 
+	/**
+	 * @brief A sampling profiler for the lua environment, controlled from the console.
+	 */
+	std::unique_ptr<LuaProfiler> mProfiler;
+
 };
 
 }
@@ -27,8 +27,7 @@
 
 #include <Ogre.h>
 
-#include <cmath>
-#include <numeric>
+#include <algorithm>
 
 namespace Ember
 {
@@ -36,16 +35,60 @@ namespace Ember
   {
 
     FrameTimeRecorder::FrameTimeRecorder(MainLoopController& mainLoopController) :
-        mRequiredTimeSamples(boost::posix_time::seconds(2)), mTimePerFrameStore(
-            20), mAccumulatedFrameTimes(boost::posix_time::seconds(0)), mAccumulatedFrames(
-            0)
+        mRequiredTimeSamples(boost::posix_time::seconds(2)), mAccumulatedFrameTimes(
+            boost::posix_time::seconds(0)), mPhasesTime(
+            boost::posix_time::seconds(0)), mRenderingQueuedTime(
+            boost::posix_time::not_a_date_time), mGpuWaitTime(
+            boost::posix_time::seconds(0))
     {
+      mainLoopController.EventFramePhasesProcessed.connect(
+          sigc::mem_fun(*this, &FrameTimeRecorder::framePhasesProcessed));
       mainLoopController.EventFrameProcessed.connect(
           sigc::mem_fun(*this, &FrameTimeRecorder::frameCompleted));
+      Ogre::Root::getSingleton().addFrameListener(this);
     }
 
     FrameTimeRecorder::~FrameTimeRecorder()
     {
+      if (Ogre::Root::getSingletonPtr())
+        {
+          Ogre::Root::getSingleton().removeFrameListener(this);
+        }
+    }
+
+    void
+    FrameTimeRecorder::reset()
+    {
+      mAccumulatedFrameTimes = boost::posix_time::seconds(0);
+      mFrameTimes.clear();
+      mCpuTimes.clear();
+      mGpuTimes.clear();
+    }
+
+    bool
+    FrameTimeRecorder::frameRenderingQueued(const Ogre::FrameEvent& event)
+    {
+      mRenderingQueuedTime = boost::posix_time::microsec_clock::local_time();
+      return true;
+    }
+
+    bool
+    FrameTimeRecorder::frameEnded(const Ogre::FrameEvent& event)
+    {
+      if (!mRenderingQueuedTime.is_not_a_date_time())
+        {
+          mGpuWaitTime += boost::posix_time::microsec_clock::local_time()
+              - mRenderingQueuedTime;
+          mRenderingQueuedTime = boost::posix_time::not_a_date_time;
+        }
+      return true;
+    }
+
+    void
+    FrameTimeRecorder::framePhasesProcessed(const FramePhaseTimes& phaseTimes)
+    {
+      mPhasesTime = phaseTimes.erisPolling + phaseTimes.inputProcessing
+          + phaseTimes.rendering + phaseTimes.sound;
     }
 
     void
@@ -54,39 +97,48 @@ namespace Ember
     {
       if (frameActionMask & MainLoopController::FA_GRAPHICS)
         {
+          const boost::posix_time::time_duration frameTime =
+              timeFrame.getElapsedTime();
+          mAccumulatedFrameTimes += frameTime;
 
-          mAccumulatedFrameTimes += timeFrame.getElapsedTime();
-          mAccumulatedFrames++;
+          mFrameTimes.push_back(frameTime.total_microseconds() / 1000.0f);
+          mGpuTimes.push_back(mGpuWaitTime.total_microseconds() / 1000.0f);
+          mCpuTimes.push_back(
+              std::max(0.0f,
+                  (mPhasesTime - mGpuWaitTime).total_microseconds()
+                      / 1000.0f));
 
           if (mAccumulatedFrameTimes >= mRequiredTimeSamples)
             {
-
-              mTimePerFrameStore.push_back(
-                  mAccumulatedFrameTimes / mAccumulatedFrames);
-              mAccumulatedFrameTimes = boost::posix_time::seconds(0);
-              mAccumulatedFrames = 0;
-
-              boost::posix_time::time_duration averageTimePerFrame =
-                  std::accumulate(mTimePerFrameStore.begin(),
-                      mTimePerFrameStore.end(),
-                      boost::posix_time::time_duration())
-                      / mTimePerFrameStore.size();
-              EventAverageTimePerFrameUpdated(averageTimePerFrame);
-
+              FrameTimeStatistics statistics;
+              statistics.frames = mFrameTimes.size();
+              statistics.frameTime =
+                  GraphicsLevelController::calculatePercentile(mFrameTimes,
+                      0.95f);
+              statistics.cpuTime = GraphicsLevelController::calculatePercentile(
+                  mCpuTimes, 0.95f);
+              statistics.gpuTime = GraphicsLevelController::calculatePercentile(
+                  mGpuTimes, 0.95f);
+              reset();
+
+              EventStatisticsUpdated(statistics);
             }
         }
+      mGpuWaitTime = boost::posix_time::seconds(0);
+      mPhasesTime = boost::posix_time::seconds(0);
     }
 
     AutomaticGraphicsLevelManager::AutomaticGraphicsLevelManager(
         MainLoopController& mainLoopController) :
         mDefaultFps(60.0f), mEnabled(false), mFrameTimeRecorder(
-            mainLoopController), mConfigListenerContainer(
+            mainLoopController), mGraphicsLevelController(
+            mGraphicalChangeAdapter), mConfigListenerContainer(
             new ConfigListenerContainer())
     {
-      mFpsUpdatedConnection =
-          mFrameTimeRecorder.EventAverageTimePerFrameUpdated.connect(
+      mStatisticsUpdatedConnection =
+          mFrameTimeRecorder.EventStatisticsUpdated.connect(
               sigc::mem_fun(*this,
-                  &AutomaticGraphicsLevelManager::averageTimePerFrameUpdated));
+                  &AutomaticGraphicsLevelManager::statisticsUpdated));
       mConfigListenerContainer->registerConfigListener("general", "desiredfps",
           sigc::mem_fun(*this,
               &AutomaticGraphicsLevelManager::Config_DefaultFps));
@@ -98,7 +150,7 @@ namespace Ember
 
     AutomaticGraphicsLevelManager::~AutomaticGraphicsLevelManager()
     {
-      mFpsUpdatedConnection.disconnect();
+      mStatisticsUpdatedConnection.disconnect();
       delete mConfigListenerContainer;
     }
 
@@ -106,28 +158,22 @@ namespace Ember
     AutomaticGraphicsLevelManager::setFps(float fps)
     {
       mDefaultFps = fps;
+      mGraphicsLevelController.setTargetFrameTime(1000.0f / fps);
     }
 
     void
-    AutomaticGraphicsLevelManager::checkFps(float currentFps)
+    AutomaticGraphicsLevelManager::statisticsUpdated(
+        const FrameTimeStatistics& statistics)
     {
-      float changeRequired = mDefaultFps - currentFps;
-      //This factor is used to adjust the required fps difference before a change is triggered. Lower required fpses eg. 30 will need to respond to smaller changes.
-      float factor = mDefaultFps / 60.0f;
-      if (std::abs(changeRequired) >= factor * 8.0f)
+      const std::string changedSubsystem = mGraphicsLevelController.update(
+          statistics);
+      if (!changedSubsystem.empty())
         {
-          changeGraphicsLevel(changeRequired);
+          S_LOG_VERBOSE(
+              "Altered graphics subsystem '" << changedSubsystem << "'. 95th percentile frame time: " << statistics.frameTime << " ms (CPU: " << statistics.cpuTime << " ms, GPU: " << statistics.gpuTime << " ms), target: " << mGraphicsLevelController.getTargetFrameTime() << " ms.");
         }
     }
 
-    void
-    AutomaticGraphicsLevelManager::averageTimePerFrameUpdated(
-        const boost::posix_time::time_duration timePerFrame)
-    {
-      //Convert microseconds per frame to fps.
-      checkFps(1000000.0f / timePerFrame.total_microseconds());
-    }
-
     void
     AutomaticGraphicsLevelManager::changeGraphicsLevel(
         float changeInFpsRequired)
@@ -148,11 +194,14 @@ namespace Ember
       mEnabled = newEnabled;
       if (newEnabled == false)
         {
-          mFpsUpdatedConnection.block();
+          mStatisticsUpdatedConnection.block();
         }
       else
         {
-          mFpsUpdatedConnection.unblock();
+          //Anything measured before might not be valid any more.
+          mFrameTimeRecorder.reset();
+          mGraphicsLevelController.reset();
+          mStatisticsUpdatedConnection.unblock();
         }
     }
 
@@ -174,7 +223,7 @@ namespace Ember
             {
               fps = 60.0f;
             }
-          mDefaultFps = fps;
+          setFps(fps);
         }
     }
 
@@ -17,16 +17,18 @@
  */
 
 #include "GraphicalChangeAdapter.h"
+#include "GraphicsLevelController.h"
 
 #include "OgreIncludes.h"
+#include <OgreFrameListener.h>
 
 #include <sigc++/signal.h>
 #include <sigc++/connection.h>
 #include <sigc++/trackable.h>
 
 #include <string>
+#include <vector>
 
-#include <boost/circular_buffer.hpp>
 #include <boost/date_time.hpp>
 
 namespace varconf
@@ -37,6 +39,7 @@ namespace varconf
 namespace Ember
 {
   class TimeFrame;
+  struct FramePhaseTimes;
 
   class MainLoopController;
   class ConfigListenerContainer;
@@ -46,10 +49,16 @@ namespace Ember
     class GraphicalChangeAdapter;
 
     /**
-     * @brief Records the average time per frame.
-     * 
+     * @brief Records the time per frame, and how it's divided between the CPU and the GPU.
+     *
+     * The frame times are gathered over a period of time, after which the 95th percentiles are calculated and sent out.
+     * The 95th percentile is used rather than the average, since it's the slow frames which are noticed as hitches.
+     *
+     * The time spent waiting for the GPU is measured as the time between the render queue being processed and the frame ending, which is when the render system swaps the buffers.
+     * The swapping will block if the GPU is behind, so while it's only an approximation it's a good indication of whether the frames are GPU bound.
+     * All other time spent in the main loop, as reported by MainLoopController::EventFramePhasesProcessed, is counted as CPU time.
      */
-    class FrameTimeRecorder : public virtual sigc::trackable
+    class FrameTimeRecorder : public virtual sigc::trackable, public Ogre::FrameListener
     {
     public:
       /**
@@ -64,21 +73,28 @@ namespace Ember
       ~FrameTimeRecorder();
 
       /**
-       * @brief Signal sent out with the updated average time per frame.
+       * @brief Discards the frame times gathered so far in the current period.
        */
-      sigc::signal<void, const boost::posix_time::time_duration> EventAverageTimePerFrameUpdated;
+      void
+      reset();
 
-    protected:
+      virtual bool
+      frameRenderingQueued(const Ogre::FrameEvent& event);
+
+      virtual bool
+      frameEnded(const Ogre::FrameEvent& event);
 
       /**
-       * The amount of time in microseconds that the fps should be averaged over.
+       * @brief Signal sent out with the statistics each time a period has passed.
        */
-      boost::posix_time::time_duration mRequiredTimeSamples;
+      sigc::signal<void, const FrameTimeStatistics&> EventStatisticsUpdated;
+
+    protected:
 
       /**
-       * Stores averaged time frames.
+       * The amount of time that the frame times should be gathered over.
        */
-      boost::circular_buffer<boost::posix_time::time_duration> mTimePerFrameStore;
+      boost::posix_time::time_duration mRequiredTimeSamples;
 
       /**
        * @brief Accumulates frame times since last calculation.
@@ -86,9 +102,37 @@ namespace Ember
       boost::posix_time::time_duration mAccumulatedFrameTimes;
 
       /**
-       * @brief Accumulates number of frames since last calculation.
+       * @brief The total time of each frame in the current period, in milliseconds.
+       */
+      std::vector<float> mFrameTimes;
+
+      /**
+       * @brief The CPU time of each frame in the current period, in milliseconds.
        */
-      int mAccumulatedFrames;
+      std::vector<float> mCpuTimes;
+
+      /**
+       * @brief The GPU time of each frame in the current period, in milliseconds.
+       */
+      std::vector<float> mGpuTimes;
+
+      /**
+       * @brief The total time spent in the phases of the main loop during the last frame.
+       */
+      boost::posix_time::time_duration mPhasesTime;
+
+      /**
+       * @brief When the render queue was processed in the current frame, or not_a_date_time if it hasn't been.
+       */
+      boost::posix_time::ptime mRenderingQueuedTime;
+
+      /**
+       * @brief The time spent waiting for the GPU in the current frame.
+       */
+      boost::posix_time::time_duration mGpuWaitTime;
+
+      void
+      framePhasesProcessed(const FramePhaseTimes& phaseTimes);
 
       void
       frameCompleted(const TimeFrame& timeFrame, unsigned int frameActionMask);
@@ -98,9 +142,8 @@ namespace Ember
     /**
      *@brief Central class for automatic adjustment of graphics level
      *
-     * This class maintains a current Graphics level. It connects to the fpsUpdated signal and thus 
-     * checks the fps for a significant increase or decrease and then asks for a change in the level
-     * by using the GraphicalChangeAdapter.
+     * This class listens for frame time statistics from the FrameTimeRecorder, and lets the GraphicsLevelController
+     * decide which of the subsystems registered with the GraphicalChangeAdapter, if any, should be altered.
      */
 
     class AutomaticGraphicsLevelManager
@@ -161,7 +204,7 @@ namespace Ember
       bool mEnabled;
 
       /**
-       * Instance of FpsUpdater class owned by this class to get updates on when the fps is updated.
+       * Instance of FrameTimeRecorder class owned by this class to get updates on the frame times.
        */
       FrameTimeRecorder mFrameTimeRecorder;
 
@@ -171,28 +214,26 @@ namespace Ember
       GraphicalChangeAdapter mGraphicalChangeAdapter;
 
       /**
-       * @brief Used to listen for configuration changes.
+       * @brief Decides which subsystem to alter.
        */
-      ConfigListenerContainer* mConfigListenerContainer;
+      GraphicsLevelController mGraphicsLevelController;
 
       /**
-       * @brief The connection through which the automatic graphics manager listens for fps updates.
+       * @brief Used to listen for configuration changes.
        */
-      sigc::connection mFpsUpdatedConnection;
+      ConfigListenerContainer* mConfigListenerContainer;
 
       /**
-       * @brief This function is used to check if the fps is optimum, higher or lower as compared to mDefaultFps.
+       * @brief The connection through which the automatic graphics manager listens for frame time updates.
        */
-      void
-      checkFps(float);
+      sigc::connection mStatisticsUpdatedConnection;
 
       /**
-       * Called from the FrameTimeRecorder when a new average time per frame has been calculated.
-       * @param timePerFrame Time per frame, in microseconds.
+       * Called from the FrameTimeRecorder when new frame time statistics have been calculated.
+       * @param statistics The statistics.
        */
       void
-      averageTimePerFrameUpdated(
-          const boost::posix_time::time_duration timePerFrame);
+      statisticsUpdated(const FrameTimeStatistics& statistics);
 
       /**
        * @brief Connected to the config service to listen for derired fps settings.
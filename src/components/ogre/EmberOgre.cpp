@@ -56,6 +56,7 @@
 #include "framework/IScriptingProvider.h"
 #include "framework/Time.h"
 #include "framework/TimeFrame.h"
+#include "framework/MainLoopController.h"
 
 #include "terrain/TerrainLayerDefinitionManager.h"
 
@@ -64,7 +65,7 @@
 #include "GUIManager.h"
 
 #include "environment/meshtree/TParameters.h"
-#include "environment/Tree.h"
+#include "environment/TreeGenerator.h"
 
 //#include "carpenter/Carpenter.h"
 //#include "carpenter/BluePrint.h"
@@ -76,9 +77,11 @@
 
 #include "lod/LodDefinitionManager.h"
 #include "lod/LodManager.h"
+#include "lod/LodCache.h"
 
-//#include "ogreopcode/include/OgreCollisionManager.h"
-//#include "OpcodeCollisionDetectorVisualizer.h"
+#include "ogreopcode/include/OgreCollisionManager.h"
+#include "OpcodeCollisionDetectorVisualizer.h"
+#include "OpcodeCollisionShapeCache.h"
 
 #include "authoring/EntityRecipeManager.h"
 
@@ -118,6 +121,9 @@
 
 #include <OgreSceneManager.h>
 
+#include <algorithm>
+#include <thread>
+
 template<> Ember::OgreView::EmberOgre* Ember::Singleton<Ember::OgreView::EmberOgre>::ms_Singleton = 0;
 
 using namespace Ember;
@@ -144,9 +150,8 @@ void assureConfigFile(const std::string& filename, const std::string& originalCo
 EmberOgre::EmberOgre() :
 		mInput(0), mOgreSetup(nullptr), mRoot(0), mSceneMgr(0), mWindow(0), mScreen(0), mShaderManager(0), mShaderDetailManager(nullptr), mAutomaticGraphicsLevelManager(nullptr), mGeneralCommandMapper(new InputCommandMapper("general")), mSoundManager(0), mGUIManager(0), mModelDefinitionManager(0), mEntityMappingManager(0), mTerrainLayerManager(0), mEntityRecipeManager(0),
 		//mJesus(0),
-		mLogObserver(nullptr), mMaterialEditor(nullptr), mModelRepresentationManager(nullptr), mSoundResourceProvider(nullptr), mLodDefinitionManager(nullptr), mLodManager(nullptr),
-		//mCollisionManager(0),
-		//mCollisionDetectorVisualizer(0),
+		mLogObserver(nullptr), mMaterialEditor(nullptr), mModelRepresentationManager(nullptr), mSoundResourceProvider(nullptr), mLodDefinitionManager(nullptr), mLodManager(nullptr), mLodCache(nullptr), mTreeGenerator(nullptr),
+		mCollisionManager(0), mCollisionDetectorVisualizer(0), mCollisionShapeCache(0),
 		mResourceLoader(0), mOgreLogManager(0), mIsInPausedMode(false), mOgreMainCamera(0), mWorld(0), mPMWorker(0), mPMInjector(0)
 {
 	Application::getSingleton().EventServicesInitialized.connect(sigc::mem_fun(*this, &EmberOgre::Application_ServicesInitialized));
@@ -156,8 +161,10 @@ EmberOgre::~EmberOgre()
 {
 	delete mWorld;
 	delete mModelRepresentationManager;
-	//	delete mCollisionDetectorVisualizer;
-	//	delete mCollisionManager;
+	//The models, and thereby their collision detectors, are destroyed together with the world, so all shared shapes should have been released by now.
+	delete mCollisionShapeCache;
+	delete mCollisionDetectorVisualizer;
+	delete mCollisionManager;
 	delete mMaterialEditor;
 	//	delete mJesus;
 
@@ -185,6 +192,7 @@ EmberOgre::~EmberOgre()
 	//by deleting the model manager we'll assure that
 	delete mModelDefinitionManager;
 
+	delete mTreeGenerator;
 	delete mLodManager;
 	delete mLodDefinitionManager;
 
@@ -207,6 +215,7 @@ EmberOgre::~EmberOgre()
 	// after the destructor of Ogre::Root to make sure the queue is flushed and we can delete it safely.
 	delete mPMWorker;
 	delete mPMInjector;
+	delete mLodCache;
 
 	//Ogre is destroyed already, so we can't deregister this: we'll just destroy it
 	delete mLogObserver;
@@ -229,7 +238,13 @@ bool EmberOgre::renderOneFrame(const TimeFrame& timeFrame)
 		try {
 			//No need to do this each frame
 			//clearDirtyPassLists();
-			mRoot->renderOneFrame();
+			//When replaying recorded input a fixed time step is used, so that animations and other time based effects advance identically each run.
+			float fixedTimeStep = MainLoopController::getSingleton().getFixedTimeStep();
+			if (fixedTimeStep > 0) {
+				mRoot->renderOneFrame(fixedTimeStep);
+			} else {
+				mRoot->renderOneFrame();
+			}
 		} catch (const std::exception& ex) {
 			S_LOG_FAILURE("Error when rending one frame in the main render loop." << ex);
 		}
@@ -318,6 +333,7 @@ bool EmberOgre::setup(Input& input, MainLoopController& mainLoopController)
 
 	mLodDefinitionManager = new Lod::LodDefinitionManager(exportDir);
 	mLodManager = new Lod::LodManager();
+	mLodCache = new Lod::LodCache(configSrv.getHomeDirectory() + "/lodcache/");
 
 	mEntityMappingManager = new Mapping::EmberEntityMappingManager();
 
@@ -389,8 +405,9 @@ bool EmberOgre::setup(Input& input, MainLoopController& mainLoopController)
 		}
 
 		//create the collision manager
-		//	mCollisionManager = new OgreOpcode::CollisionManager(mSceneMgr);
-		//	mCollisionDetectorVisualizer = new OpcodeCollisionDetectorVisualizer();
+		mCollisionManager = new OgreOpcode::CollisionManager(mSceneMgr);
+		mCollisionDetectorVisualizer = new OpcodeCollisionDetectorVisualizer();
+		mCollisionShapeCache = new OpcodeCollisionShapeCache();
 
 		mResourceLoader->loadGui();
 		mResourceLoader->loadGeneral();
@@ -475,25 +492,19 @@ void EmberOgre::preloadMedia(void)
 
 	ConfigService& configSrv = EmberServices::getSingleton().getConfigService();
 
-	std::vector<std::string> shaderTextures;
-
-	shaderTextures.push_back(std::string(configSrv.getValue("shadertextures", "rock")));
-	shaderTextures.push_back(std::string(configSrv.getValue("shadertextures", "sand")));
-	shaderTextures.push_back(std::string(configSrv.getValue("shadertextures", "grass")));
-
-	for (std::vector<std::string>::iterator I = shaderTextures.begin(); I != shaderTextures.end(); ++I) {
-		try {
-			Ogre::TextureManager::getSingleton().load(*I, "General");
-		} catch (const std::exception& e) {
-			S_LOG_FAILURE( "Error when loading texture " << *I << "." << e);
-		}
-	}
+	//The terrain textures aren't preloaded here, since they are streamed in by the TerrainTextureStreamer when they are needed.
 
 	//only autogenerate trees if we're not using the pregenerated ones
 	if (configSrv.itemExists("tree", "usedynamictrees") && ((bool)configSrv.getValue("tree", "usedynamictrees"))) {
-		Environment::Tree tree;
-		tree.makeMesh("GeneratedTrees/European_Larch", Ogre::TParameters::European_Larch);
-		tree.makeMesh("GeneratedTrees/Fir", Ogre::TParameters::Fir);
+		//The trees are generated in the background, and kept on disk for later sessions.
+		unsigned int variants = 4;
+		if (configSrv.itemExists("tree", "dynamictreevariants")) {
+			variants = std::max(1, static_cast<int>(configSrv.getValue("tree", "dynamictreevariants")));
+		}
+		unsigned int treeThreads = std::min(4u, std::max(1u, std::thread::hardware_concurrency() / 2));
+		mTreeGenerator = new Environment::TreeGenerator(configSrv.getHomeDirectory() + "/treecache/", treeThreads);
+		mTreeGenerator->generateVariants("GeneratedTrees/European_Larch", Ogre::TParameters::European_Larch, 0, variants);
+		mTreeGenerator->generateVariants("GeneratedTrees/Fir", Ogre::TParameters::Fir, 0, variants);
 	}
 
 }
@@ -77,10 +77,16 @@ namespace Ember
     {
       class LodDefinitionManager;
       class LodManager;
+      class LodCache;
       class PMWorker;
       class PMInjector;
     }
 
+    namespace Environment
+    {
+      class TreeGenerator;
+    }
+
     namespace Mapping
     {
       class EmberEntityMappingManager;
@@ -116,6 +122,7 @@ namespace Ember
 
     class OgreResourceProvider;
     class OpcodeCollisionDetectorVisualizer;
+    class OpcodeCollisionShapeCache;
 
     class ShaderManager;
     class ShaderDetailManager;
@@ -366,14 +373,28 @@ namespace Ember
        */
       Lod::LodManager* mLodManager;
 
+      /**
+       * @brief Keeps automatically generated Lods on disk between sessions.
+       */
+      Lod::LodCache* mLodCache;
+
+      /**
+       * @brief Generates the dynamic trees in the background, if they are enabled.
+       */
+      Environment::TreeGenerator* mTreeGenerator;
+
       /**
        * @brief The collision manager, responsible for handling collisions of the geometry in the world.
        */
-      //	OgreOpcode::CollisionManager* mCollisionManager;
+      OgreOpcode::CollisionManager* mCollisionManager;
       /**
        * @brief Responsible for visualizing collisions.
        */
-      //	OpcodeCollisionDetectorVisualizer* mCollisionDetectorVisualizer;
+      OpcodeCollisionDetectorVisualizer* mCollisionDetectorVisualizer;
+      /**
+       * @brief Shares collision shapes between entities using the same static mesh.
+       */
+      OpcodeCollisionShapeCache* mCollisionShapeCache;
       /**
        * @brief Handles loading of resources.
        *
@@ -165,7 +165,7 @@ void EntityWorldPickListener::processPickResult(bool& continuePicking, Ogre::Ray
 		Ogre::MovableObject* pickedMovable = entry.movable;
 		if (pickedMovable->isVisible() && pickedMovable->getUserAny().getType() == typeid(EmberEntityUserObject::SharedPtr)) {
 			EmberEntityUserObject* anUserObject = Ogre::any_cast<EmberEntityUserObject::SharedPtr>(pickedMovable->getUserAny()).get();
-			//refit the opcode mesh to adjust for changes in the mesh (for example animations)
+			//refit the collision mesh to adjust for changes in the mesh (for example animations). Detectors are expected to make this cheap for static meshes.
 			anUserObject->refit();
 
 			ICollisionDetector* collisionDetector = anUserObject->getCollisionDetector();
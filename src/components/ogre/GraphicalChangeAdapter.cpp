@@ -33,7 +33,33 @@ bool GraphicalChangeAdapter::fpsChangeRequired(float changeSize)
 	float translatedChangeRequired = changeSize / 1.0f;
 
 	bool furtherChangePossible = EventChangeRequired.emit(translatedChangeRequired);
+	for (std::map<std::string, ChangeSignal>::iterator I = mSubsystems.begin(); I != mSubsystems.end(); ++I) {
+		furtherChangePossible = I->second.emit(translatedChangeRequired) || furtherChangePossible;
+	}
 	return furtherChangePossible;
 }
+
+bool GraphicalChangeAdapter::subsystemChangeRequired(const std::string& name, float changeSize)
+{
+	std::map<std::string, ChangeSignal>::iterator I = mSubsystems.find(name);
+	if (I != mSubsystems.end()) {
+		return I->second.emit(changeSize);
+	}
+	return false;
+}
+
+sigc::connection GraphicalChangeAdapter::connectSubsystem(const std::string& name, const sigc::slot<bool, float>& slot)
+{
+	return mSubsystems[name].connect(slot);
+}
+
+std::vector<std::string> GraphicalChangeAdapter::getSubsystemNames() const
+{
+	std::vector<std::string> names;
+	for (std::map<std::string, ChangeSignal>::const_iterator I = mSubsystems.begin(); I != mSubsystems.end(); ++I) {
+		names.push_back(I->first);
+	}
+	return names;
+}
 }
 }
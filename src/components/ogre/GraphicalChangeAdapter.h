@@ -20,6 +20,11 @@
 #ifndef GRAPHICALCHANGEADAPTER_H_
 #define GRAPHICALCHANGEADAPTER_H_
 #include <sigc++/signal.h>
+#include <sigc++/connection.h>
+
+#include <map>
+#include <string>
+#include <vector>
 
 namespace Ember
 {
@@ -60,19 +65,58 @@ struct FurtherChangePossibleAccumulater
 /**
  * @brief Adaptor interface class between the central AutomaticGraphicsLevelManager class and the graphics subsystems
  * This class accepts a change in fps required and translates it into a floating change required value that the subsystems understand
+ *
+ * Subsystems register themselves under a name through connectSubsystem(), which allows each to be changed separately.
+ * This is used by the AutomaticGraphicsLevelManager to only alter those subsystems which gives the best improvement for the least loss of quality.
  */
 class GraphicalChangeAdapter
 {
 public:
 
+	typedef sigc::signal<bool, float>::accumulated<FurtherChangePossibleAccumulater<bool> > ChangeSignal;
+
 	/**
-	 * Signals that a change is required.
+	 * Signals that a change is required, to all subsystems.
 	 * @param changeSize The change required in fps. A positive value means that graphical details should be improved. A negative value means that the details should be decreased.
 	 * @return True if further change can be performed.
 	 */
 	bool fpsChangeRequired(float);
 
-	sigc::signal<bool, float>::accumulated<FurtherChangePossibleAccumulater<bool> > EventChangeRequired;
+	/**
+	 * @brief Signals that a change is required to one subsystem only.
+	 * @param name The name of the subsystem.
+	 * @param changeSize The change required in fps, with the same meaning as in fpsChangeRequired().
+	 * @return True if a change was made.
+	 */
+	bool subsystemChangeRequired(const std::string& name, float changeSize);
+
+	/**
+	 * @brief Connects a subsystem which can alter its level of detail.
+	 * Several slots can be connected under the same name; they are then treated as one subsystem.
+	 * The connection can be blocked to temporarily pause the subsystem.
+	 * @param name The name of the subsystem.
+	 * @param slot A slot which will be called with the change required in fps. It should return true if a change was made.
+	 * @return The connection.
+	 */
+	sigc::connection connectSubsystem(const std::string& name, const sigc::slot<bool, float>& slot);
+
+	/**
+	 * @brief Gets the names of all subsystems which have been connected.
+	 */
+	std::vector<std::string> getSubsystemNames() const;
+
+	/**
+	 * @brief Emitted when a change is required to all subsystems.
+	 * Prefer using connectSubsystem(), so that the subsystem can be changed separately.
+	 */
+	ChangeSignal EventChangeRequired;
+
+private:
+
+	/**
+	 * @brief The subsystems, by name.
+	 */
+	std::map<std::string, ChangeSignal> mSubsystems;
 };
 
 }
@@ -0,0 +1,276 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "GraphicsLevelController.h"
+#include "GraphicalChangeAdapter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace
+{
+/**
+ * @brief How much the frame time may go over the target before detail is lowered, as a fraction of the target.
+ */
+const float LOWER_MARGIN = 0.1f;
+
+/**
+ * @brief How much the frame time must be below the target before detail is raised, as a fraction of the target.
+ */
+const float RAISE_MARGIN = 0.2f;
+
+/**
+ * @brief How much the frame time must be expected to be below the target after detail has been raised, as a fraction of the target.
+ */
+const float RAISE_HEADROOM = 0.1f;
+
+/**
+ * @brief The number of consecutive periods the frame time must be below the target before detail is raised.
+ */
+const int RAISE_PERIODS = 3;
+
+/**
+ * @brief The number of periods to ignore after a change.
+ */
+const int SETTLE_PERIODS = 1;
+
+/**
+ * @brief The number of periods to wait before again trying to alter a subsystem which reported that it couldn't be altered.
+ */
+const int BLOCKED_PERIODS = 15;
+
+/**
+ * @brief The improvement per step, in milliseconds, which is assumed for subsystems which haven't been measured yet.
+ */
+const float DEFAULT_GAIN = 1.0f;
+
+/**
+ * @brief The smallest change in fps asked of a subsystem.
+ * The subsystems ignore changes below their own thresholds, which are meant for the case where all of them are asked at once.
+ * Here the controller has already decided that a change is needed.
+ */
+const float MIN_FPS_CHANGE = 4.0f;
+
+}
+
+GraphicsLevelController::SubsystemState::SubsystemState() :
+		cpuGain(0), gpuGain(0), measured(false), stepsDown(0), lowerBlockedPeriods(0), raiseBlockedPeriods(0)
+{
+}
+
+GraphicsLevelController::GraphicsLevelController(GraphicalChangeAdapter& graphicalChangeAdapter) :
+		mGraphicalChangeAdapter(graphicalChangeAdapter), mTargetFrameTime(1000.0f / 60.0f), mSettlePeriods(0), mPeriodsBelowTarget(0), mMeasuredDirection(0), mStatisticsBeforeChange()
+{
+}
+
+void GraphicsLevelController::setTargetFrameTime(float milliseconds)
+{
+	mTargetFrameTime = milliseconds;
+}
+
+float GraphicsLevelController::getTargetFrameTime() const
+{
+	return mTargetFrameTime;
+}
+
+void GraphicsLevelController::reset()
+{
+	mSubsystems.clear();
+	mSettlePeriods = 0;
+	mPeriodsBelowTarget = 0;
+	mMeasuredSubsystem.clear();
+}
+
+bool GraphicsLevelController::getMeasuredGain(const std::string& name, float& cpuGain, float& gpuGain) const
+{
+	SubsystemStore::const_iterator I = mSubsystems.find(name);
+	if (I != mSubsystems.end() && I->second.measured) {
+		cpuGain = I->second.cpuGain;
+		gpuGain = I->second.gpuGain;
+		return true;
+	}
+	return false;
+}
+
+float GraphicsLevelController::calculatePercentile(std::vector<float>& samples, float percentile)
+{
+	if (samples.empty()) {
+		return 0;
+	}
+	//Use the nearest rank.
+	size_t rank = static_cast<size_t>(std::ceil(percentile * samples.size()));
+	size_t index = std::min(std::max<size_t>(rank, 1), samples.size()) - 1;
+	std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+	return samples[index];
+}
+
+std::string GraphicsLevelController::update(const FrameTimeStatistics& statistics)
+{
+	updateSubsystems();
+
+	if (statistics.frames == 0) {
+		return "";
+	}
+
+	if (mSettlePeriods > 0) {
+		mSettlePeriods--;
+		return "";
+	}
+
+	if (!mMeasuredSubsystem.empty()) {
+		measureChange(statistics);
+	}
+
+	if (statistics.frameTime > mTargetFrameTime * (1.0f + LOWER_MARGIN)) {
+		mPeriodsBelowTarget = 0;
+		return lowerDetail(statistics);
+	}
+	return raiseDetail(statistics);
+}
+
+void GraphicsLevelController::updateSubsystems()
+{
+	std::vector<std::string> names = mGraphicalChangeAdapter.getSubsystemNames();
+	for (std::vector<std::string>::const_iterator I = names.begin(); I != names.end(); ++I) {
+		mSubsystems[*I];
+	}
+	for (SubsystemStore::iterator I = mSubsystems.begin(); I != mSubsystems.end(); ++I) {
+		SubsystemState& state = I->second;
+		if (state.lowerBlockedPeriods > 0) {
+			state.lowerBlockedPeriods--;
+		}
+		if (state.raiseBlockedPeriods > 0) {
+			state.raiseBlockedPeriods--;
+		}
+	}
+}
+
+void GraphicsLevelController::measureChange(const FrameTimeStatistics& statistics)
+{
+	SubsystemState& state = mSubsystems[mMeasuredSubsystem];
+	//When detail was raised the frame times are expected to go up, so the sign is flipped to get the gain per step down.
+	float cpuGain = std::max(0.0f, (mStatisticsBeforeChange.cpuTime - statistics.cpuTime) * mMeasuredDirection);
+	float gpuGain = std::max(0.0f, (mStatisticsBeforeChange.gpuTime - statistics.gpuTime) * mMeasuredDirection);
+	if (state.measured) {
+		//Smooth out the noise a bit, but let new measurements have a large impact since the conditions change as the user moves around.
+		state.cpuGain = (state.cpuGain + cpuGain) * 0.5f;
+		state.gpuGain = (state.gpuGain + gpuGain) * 0.5f;
+	} else {
+		state.cpuGain = cpuGain;
+		state.gpuGain = gpuGain;
+		state.measured = true;
+	}
+	mMeasuredSubsystem.clear();
+}
+
+float GraphicsLevelController::getExpectedGain(const SubsystemState& state, bool gpuBound) const
+{
+	if (!state.measured) {
+		return DEFAULT_GAIN;
+	}
+	return gpuBound ? state.gpuGain : state.cpuGain;
+}
+
+std::string GraphicsLevelController::lowerDetail(const FrameTimeStatistics& statistics)
+{
+	//The frames are bound by whichever side they spend the most time on.
+	const bool gpuBound = statistics.gpuTime > statistics.cpuTime;
+
+	std::vector<std::pair<float, std::string>> candidates;
+	for (SubsystemStore::const_iterator I = mSubsystems.begin(); I != mSubsystems.end(); ++I) {
+		if (I->second.lowerBlockedPeriods == 0) {
+			candidates.push_back(std::make_pair(-getExpectedGain(I->second, gpuBound), I->first));
+		}
+	}
+	//Sort so that the subsystem with the biggest gain comes first.
+	std::sort(candidates.begin(), candidates.end());
+
+	const float fpsChange = std::max(MIN_FPS_CHANGE, (1000.0f / mTargetFrameTime) - (1000.0f / statistics.frameTime));
+	for (std::vector<std::pair<float, std::string>>::const_iterator I = candidates.begin(); I != candidates.end(); ++I) {
+		if (mGraphicalChangeAdapter.subsystemChangeRequired(I->second, fpsChange)) {
+			changeMade(I->second, 1, statistics);
+			return I->second;
+		}
+		mSubsystems[I->second].lowerBlockedPeriods = BLOCKED_PERIODS;
+	}
+	return "";
+}
+
+std::string GraphicsLevelController::raiseDetail(const FrameTimeStatistics& statistics)
+{
+	if (statistics.frameTime >= mTargetFrameTime * (1.0f - RAISE_MARGIN)) {
+		mPeriodsBelowTarget = 0;
+		return "";
+	}
+	if (++mPeriodsBelowTarget < RAISE_PERIODS) {
+		return "";
+	}
+
+	//Prefer restoring subsystems which have been lowered, and among those the ones which cost the least.
+	std::vector<std::pair<std::pair<bool, float>, std::string>> candidates;
+	for (SubsystemStore::const_iterator I = mSubsystems.begin(); I != mSubsystems.end(); ++I) {
+		const SubsystemState& state = I->second;
+		if (state.raiseBlockedPeriods == 0) {
+			//Since the cost could end up on either side, assume the worst.
+			float cost = std::max(getExpectedGain(state, true), getExpectedGain(state, false));
+			if (statistics.frameTime + cost < mTargetFrameTime * (1.0f - RAISE_HEADROOM)) {
+				candidates.push_back(std::make_pair(std::make_pair(state.stepsDown <= 0, cost), I->first));
+			}
+		}
+	}
+	std::sort(candidates.begin(), candidates.end());
+
+	const float fpsChange = std::max(MIN_FPS_CHANGE, (1000.0f / statistics.frameTime) - (1000.0f / mTargetFrameTime));
+	for (std::vector<std::pair<std::pair<bool, float>, std::string>>::const_iterator I = candidates.begin(); I != candidates.end(); ++I) {
+		if (mGraphicalChangeAdapter.subsystemChangeRequired(I->second, -fpsChange)) {
+			changeMade(I->second, -1, statistics);
+			mPeriodsBelowTarget = 0;
+			return I->second;
+		}
+		mSubsystems[I->second].raiseBlockedPeriods = BLOCKED_PERIODS;
+	}
+	return "";
+}
+
+void GraphicsLevelController::changeMade(const std::string& name, int direction, const FrameTimeStatistics& statistics)
+{
+	SubsystemState& state = mSubsystems[name];
+	state.stepsDown += direction;
+	//Once a subsystem has been altered in one direction it can be altered back again.
+	if (direction > 0) {
+		state.raiseBlockedPeriods = 0;
+	} else {
+		state.lowerBlockedPeriods = 0;
+	}
+	mMeasuredSubsystem = name;
+	mMeasuredDirection = direction;
+	mStatisticsBeforeChange = statistics;
+	mSettlePeriods = SETTLE_PERIODS;
+}
+
+}
+}
@@ -0,0 +1,249 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBER_OGREVIEW_GRAPHICSLEVELCONTROLLER_H_
+#define EMBER_OGREVIEW_GRAPHICSLEVELCONTROLLER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+class GraphicalChangeAdapter;
+
+/**
+ * @brief Frame time statistics over a number of frames.
+ *
+ * All times are in milliseconds.
+ */
+struct FrameTimeStatistics
+{
+	/**
+	 * @brief The 95th percentile of the total time per frame.
+	 */
+	float frameTime;
+
+	/**
+	 * @brief The 95th percentile of the time per frame spent on work done by the CPU.
+	 */
+	float cpuTime;
+
+	/**
+	 * @brief The 95th percentile of the time per frame spent waiting for the GPU to finish rendering.
+	 */
+	float gpuTime;
+
+	/**
+	 * @brief The number of frames the statistics were calculated from.
+	 */
+	unsigned int frames;
+};
+
+/**
+ * @brief Decides which graphical subsystem should be altered in order to reach a target frame time.
+ *
+ * The controller is fed with frame time statistics for consecutive periods of time.
+ * When the 95th percentile of the frame time is too high, the controller finds out whether the frames are bound by the CPU or by the GPU, and lowers the detail of the subsystem which is expected to give the biggest improvement on that side.
+ * When there's enough room it instead raises the detail of the subsystem which is expected to cost the least.
+ *
+ * What each subsystem costs isn't known beforehand; instead it's measured by comparing the statistics before and after each change.
+ * Subsystems which haven't yet been measured are assumed to cost a default amount, so that each will be tried.
+ *
+ * To avoid oscillating between levels the controller
+ * - lowers detail as soon as the frame time is over the target, but only raises it after the frame time has been well below the target for some time,
+ * - only raises detail if the frame time is expected to still be below the target after the change,
+ * - ignores the period right after a change, since many changes take a while to take full effect, and often cause hitches while doing so.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class GraphicsLevelController
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param graphicalChangeAdapter The adapter through which the subsystems are changed.
+	 */
+	GraphicsLevelController(GraphicalChangeAdapter& graphicalChangeAdapter);
+
+	/**
+	 * @brief Sets the frame time the controller tries to achieve.
+	 * @param milliseconds The target time per frame, in milliseconds.
+	 */
+	void setTargetFrameTime(float milliseconds);
+
+	/**
+	 * @brief Gets the frame time the controller tries to achieve.
+	 * @return The target time per frame, in milliseconds.
+	 */
+	float getTargetFrameTime() const;
+
+	/**
+	 * @brief Processes statistics for a new period of frames, and alters a subsystem if needed.
+	 * @param statistics The statistics for the period.
+	 * @return The name of the subsystem which was altered, or an empty string if none was.
+	 */
+	std::string update(const FrameTimeStatistics& statistics);
+
+	/**
+	 * @brief Gets the measured improvement per step of a subsystem.
+	 * @param name The name of the subsystem.
+	 * @param cpuGain The measured improvement of the CPU time per step, in milliseconds.
+	 * @param gpuGain The measured improvement of the GPU time per step, in milliseconds.
+	 * @return True if the subsystem has been measured.
+	 */
+	bool getMeasuredGain(const std::string& name, float& cpuGain, float& gpuGain) const;
+
+	/**
+	 * @brief Forgets everything which has been measured, and any limits the subsystems have reached.
+	 * This should be called when the controller is enabled, since the conditions might have changed while it was disabled.
+	 */
+	void reset();
+
+	/**
+	 * @brief Calculates a percentile of a series of samples.
+	 * @param samples The samples. These will be reordered.
+	 * @param percentile The percentile, between 0 and 1.
+	 * @return The value of the percentile, or 0 if there are no samples.
+	 */
+	static float calculatePercentile(std::vector<float>& samples, float percentile);
+
+private:
+
+	/**
+	 * @brief What's known about a subsystem.
+	 */
+	struct SubsystemState
+	{
+		SubsystemState();
+
+		/**
+		 * @brief The measured improvement of the CPU time per step down, in milliseconds.
+		 */
+		float cpuGain;
+
+		/**
+		 * @brief The measured improvement of the GPU time per step down, in milliseconds.
+		 */
+		float gpuGain;
+
+		/**
+		 * @brief True if cpuGain and gpuGain have been measured.
+		 */
+		bool measured;
+
+		/**
+		 * @brief How many steps the subsystem has been lowered in total.
+		 * Negative if it has been raised above where it started.
+		 */
+		int stepsDown;
+
+		/**
+		 * @brief The number of periods left during which the subsystem shouldn't be lowered, since it's reported that it couldn't be.
+		 */
+		int lowerBlockedPeriods;
+
+		/**
+		 * @brief The number of periods left during which the subsystem shouldn't be raised, since it's reported that it couldn't be.
+		 */
+		int raiseBlockedPeriods;
+	};
+
+	typedef std::map<std::string, SubsystemState> SubsystemStore;
+
+	GraphicalChangeAdapter& mGraphicalChangeAdapter;
+
+	SubsystemStore mSubsystems;
+
+	/**
+	 * @brief The target time per frame, in milliseconds.
+	 */
+	float mTargetFrameTime;
+
+	/**
+	 * @brief The number of periods which should be ignored, since a change was just made.
+	 */
+	int mSettlePeriods;
+
+	/**
+	 * @brief The number of consecutive periods in which the frame time has been well below the target.
+	 */
+	int mPeriodsBelowTarget;
+
+	/**
+	 * @brief The subsystem which was last changed, and which should be measured once the change has settled.
+	 * Empty if there's nothing to measure.
+	 */
+	std::string mMeasuredSubsystem;
+
+	/**
+	 * @brief The number of steps the measured subsystem was lowered; 1 or -1.
+	 */
+	int mMeasuredDirection;
+
+	/**
+	 * @brief The statistics from before the measured change.
+	 */
+	FrameTimeStatistics mStatisticsBeforeChange;
+
+	/**
+	 * @brief Records how much the last change altered the frame times.
+	 * @param statistics The statistics after the change.
+	 */
+	void measureChange(const FrameTimeStatistics& statistics);
+
+	/**
+	 * @brief Lowers the detail of the subsystem expected to give the biggest improvement.
+	 * @param statistics The current statistics.
+	 * @return The name of the subsystem which was altered, or an empty string if none could be.
+	 */
+	std::string lowerDetail(const FrameTimeStatistics& statistics);
+
+	/**
+	 * @brief Raises the detail of the subsystem expected to cost the least, if it fits within the target.
+	 * @param statistics The current statistics.
+	 * @return The name of the subsystem which was altered, or an empty string if none was.
+	 */
+	std::string raiseDetail(const FrameTimeStatistics& statistics);
+
+	/**
+	 * @brief Gets the expected improvement per step of a subsystem.
+	 * @param state The state of the subsystem.
+	 * @param gpuBound True if the improvement of the GPU time should be returned, else the improvement of the CPU time.
+	 */
+	float getExpectedGain(const SubsystemState& state, bool gpuBound) const;
+
+	/**
+	 * @brief Makes sure that there's a state for each connected subsystem, and counts down any blocked periods.
+	 */
+	void updateSubsystems();
+
+	/**
+	 * @brief Registers that a change was made.
+	 */
+	void changeMade(const std::string& name, int direction, const FrameTimeStatistics& statistics);
+};
+
+}
+}
+
+#endif /* EMBER_OGREVIEW_GRAPHICSLEVELCONTROLLER_H_ */
@@ -81,6 +81,7 @@ public:
 
 	/**
 	 * @brief Refits the collision mesh against the entity. This is called to ensure that the collision mesh fits animated entities.
+	 * This is called for every candidate when picking, so implementations should return quickly for entities which aren't animated.
 	 */
 	virtual void refit() = 0;
 
@@ -99,5 +99,15 @@ namespace Ember
 // 	output.setSize(memBuffSize);
     }
 
+    bool
+    OgreResourceProvider::isThreadSafe() const
+    {
+#if OGRE_THREAD_SUPPORT
+      return true;
+#else
+      return false;
+#endif
+    }
+
   }
 }
@@ -57,6 +57,11 @@ public:
     virtual ~OgreResourceProvider();
 
 	virtual ResourceWrapper getResource(const std::string& name);
+
+	/**
+	 * @brief Returns true if Ogre is built with thread support, since the resource group manager then is thread safe.
+	 */
+	virtual bool isThreadSafe() const;
 private:
 	std::string mGroupName;
 
@@ -27,22 +27,26 @@
 #include "OpcodeCollisionDetector.h"
 #include "ogreopcode/include/OgreCollisionManager.h"
 #include "ogreopcode/include/OgreEntityCollisionShape.h"
-#include "ogreopcode/include/OgreCollisionObject.h"
 
 #include "EmberOgrePrerequisites.h"
 #include "EmberEntityUserObject.h"
 
 #include "OpcodeCollisionDetectorVisualizer.h"
+#include "OpcodeCollisionShapeCache.h"
 
 #include "model/Model.h"
 #include "model/SubModel.h"
+
+#include <OgreRoot.h>
+#include <OgreEntity.h>
+
 namespace Ember
 {
   namespace OgreView
   {
 
     OpcodeCollisionDetector::OpcodeCollisionDetector(Model::Model* model) :
-        mModel(model), mVisualizer(0)
+        mModel(model), mVisualizer(0), mLastRefitFrame(0)
     {
       buildCollisionObjects();
     }
@@ -62,78 +66,90 @@ namespace Ember
     void
     OpcodeCollisionDetector::destroyCollisionObjects()
     {
-      OgreOpcode::CollisionContext* collideContext =
-          OgreOpcode::CollisionManager::getSingletonPtr()->getDefaultContext();
-      for(OpcodeCollisionDetector::CollisionObjectStore::iterator I = mCollisionObjects.begin(); I != mCollisionObjects.end(); ++I){
-      OgreOpcode::ICollisionShape* shape = (*I)->getShape();
-      collideContext->destroyObject(*I);
-      OgreOpcode::CollisionManager::getSingleton().destroyShape(shape);
-    }
-      mCollisionObjects.clear();
-
+      for (CollisionShapeStore::iterator I = mCollisionShapes.begin(); I != mCollisionShapes.end(); ++I)
+        {
+          if (I->isShared)
+            {
+              OpcodeCollisionShapeCache::getSingleton().releaseShape(I->shape);
+            }
+          else
+            {
+              OgreOpcode::CollisionManager::getSingleton().destroyShape(I->shape);
+            }
+        }
+      mCollisionShapes.clear();
     }
 
     void
     OpcodeCollisionDetector::buildCollisionObjects()
     {
-      OgreOpcode::CollisionContext* collideContext =
-          OgreOpcode::CollisionManager::getSingletonPtr()->getDefaultContext();
       const Model::Model::SubModelSet& submodels = mModel->getSubmodels();
-      for(Model::Model::SubModelSet::const_iterator I = submodels.begin(); I != submodels.end(); ++I){
-      Ogre::Entity* entity = (*I)->getEntity();
-// 		if (entity->isVisible()) {
-      std::string collideShapeName(std::string("entity_") + entity->getName());
-      OgreOpcode::EntityCollisionShape *collideShape = OgreOpcode::CollisionManager::getSingletonPtr()->createEntityCollisionShape(collideShapeName.c_str());
-// 		if (!collideShape->isInitialized()) {
-      collideShape->load(entity);
-      // 		}
-      OgreOpcode::CollisionObject* collideObject = collideContext->createObject(collideShapeName);
-
-      collideObject->setShape(collideShape);
-
-      collideContext->addObject(collideObject);
-
-      mCollisionObjects.push_back(collideObject);
-// 		}
-// 			collideObject->setDebug(true, false, false, false);
-      /*		collideShape->setDebug(true);
-       collideShape->visualize();*/
-      /*	
-       EmberEntityUserObject* userObject = new EmberEntityUserObject(this, getModel(), (*I)->getEntity(), 0);
-       (*I)->getEntity()->setUserObject(userObject);*/
+      for (Model::Model::SubModelSet::const_iterator I = submodels.begin(); I != submodels.end(); ++I)
+        {
+          Ogre::Entity* entity = (*I)->getEntity();
+          CollisionShapeEntry entry;
+          entry.entity = entity;
+          //Static meshes share one shape per mesh, so that the OPCODE tree is only built once regardless of how many instances there are.
+          if (OpcodeCollisionShapeCache::isShareable(*entity))
+            {
+              entry.shape = OpcodeCollisionShapeCache::getSingleton().acquireShape(*entity);
+              entry.isShared = true;
+            }
+          else
+            {
+              std::string collideShapeName(std::string("entity_") + entity->getName());
+              OgreOpcode::EntityCollisionShape *collideShape = OgreOpcode::CollisionManager::getSingletonPtr()->createEntityCollisionShape(collideShapeName.c_str());
+              collideShape->load(entity);
+              entry.shape = collideShape;
+              entry.isShared = false;
+            }
+          mCollisionShapes.push_back(entry);
+        }
     }
-}
 
     void
     OpcodeCollisionDetector::refit()
     {
-      for(OpcodeCollisionDetector::CollisionObjectStore::iterator I = mCollisionObjects.begin(); I != mCollisionObjects.end(); ++I){
-      (*I)->refit();
+      //Several picks can happen in the same frame; there's no need to refit more than once.
+      unsigned long frameNumber = Ogre::Root::getSingleton().getNextFrameNumber();
+      if (frameNumber == mLastRefitFrame)
+        {
+          return;
+        }
+      mLastRefitFrame = frameNumber;
+      for (CollisionShapeStore::iterator I = mCollisionShapes.begin(); I != mCollisionShapes.end(); ++I)
+        {
+          //Shared shapes belong to static meshes and never need refitting.
+          if (!I->isShared)
+            {
+              I->shape->refit();
+            }
+        }
     }
-}
 
     void
     OpcodeCollisionDetector::testCollision(Ogre::Ray& ray,
         CollisionResult& result)
     {
 
-      for(OpcodeCollisionDetector::CollisionObjectStore::iterator I = mCollisionObjects.begin(); I != mCollisionObjects.end(); ++I){
-      OgreOpcode::ICollisionShape* collisionShape = (*I)->getShape();
-      OgreOpcode::CollisionPair pick_result;
-
-// 		(*I)->update(1);
-      //collisionShape->setTransform( mModel->_getParentNodeFullTransform());
-      if (collisionShape->rayCheck(OgreOpcode::COLLTYPE_CONTACT, (*I)->getTransform(), ray, 1000.0f, pick_result, false))
+      for (CollisionShapeStore::iterator I = mCollisionShapes.begin(); I != mCollisionShapes.end(); ++I)
         {
+          if (!I->entity->isVisible() || !I->entity->getParentNode())
+            {
+              continue;
+            }
+          OgreOpcode::CollisionPair pick_result;
 
-          /*		if (collisionShape->rayCheck(OgreOpcode::COLLTYPE_CONTACT, mModel->_getParentNodeFullTransform(), ray, 1000.0f, pick_result, false)) {*/
-          result.collided = true;
-          result.distance = pick_result.distance;
-          result.position = pick_result.contact;
-          return;
+          //The shapes are in the local space of the mesh, so the transform of this instance must be supplied.
+          if (I->shape->rayCheck(OgreOpcode::COLLTYPE_CONTACT, I->entity->_getParentNodeFullTransform(), ray, 1000.0f, pick_result, false))
+            {
+              result.collided = true;
+              result.distance = pick_result.distance;
+              result.position = pick_result.contact;
+              return;
+            }
         }
     }
-}
 
     void
     OpcodeCollisionDetector::setVisualize(bool visualize)
@@ -24,10 +24,18 @@
 #define EMBEROGREOPCODECOLLISIONDETECTOR_H
 
 #include "EmberEntityUserObject.h"
+#include "ICollisionDetector.h"
+
+#include <vector>
+
+namespace Ogre
+{
+	class Entity;
+}
 
 namespace OgreOpcode
 {
-	class CollisionObject;
+	class ICollisionShape;
 	namespace Details 
 	{
 		class OgreOpcodeDebugger;
@@ -47,6 +55,8 @@ class Model;
 
 /**
 	@author Erik Hjortsberg <erik.hjortsberg@gmail.com>
+
+	Collision shapes of meshes which aren't animated are shared with all other entities using the same mesh, through OpcodeCollisionShapeCache, and are never refitted. Animated meshes get a shape of their own, which is refitted at most once per frame.
 */
 class OpcodeCollisionDetector
 : public ICollisionDetector
@@ -67,12 +77,38 @@ public:
 	virtual void setVisualize(bool visualize);
 	virtual bool getVisualize() const;
 private:
-	typedef std::vector<OgreOpcode::CollisionObject*> CollisionObjectStore;
+	/**
+	 * @brief A collision shape for one of the entities of the model.
+	 */
+	struct CollisionShapeEntry
+	{
+		/**
+		 * @brief The entity, which provides the world transform.
+		 */
+		Ogre::Entity* entity;
+
+		/**
+		 * @brief The shape, in the local space of the entity.
+		 */
+		OgreOpcode::ICollisionShape* shape;
+
+		/**
+		 * @brief True if the shape is shared through OpcodeCollisionShapeCache.
+		 */
+		bool isShared;
+	};
+	typedef std::vector<CollisionShapeEntry> CollisionShapeStore;
 	void buildCollisionObjects();
 	void destroyCollisionObjects();
-	CollisionObjectStore mCollisionObjects;
+	CollisionShapeStore mCollisionShapes;
 	Model::Model* mModel;
 	OpcodeCollisionDetectorVisualizerInstance* mVisualizer;
+
+	/**
+	 * @brief The frame in which the non shared shapes were last refitted.
+	 * Used for making sure that several picks in the same frame only refit once.
+	 */
+	unsigned long mLastRefitFrame;
 };
 }
 
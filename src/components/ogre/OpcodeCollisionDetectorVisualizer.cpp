@@ -28,7 +28,6 @@
 #include "ogreopcode/include/OgreOpcodeDebugObject.h"
 #include "ogreopcode/include/OgreCollisionManager.h"
 #include "ogreopcode/include/OgreEntityCollisionShape.h"
-#include "ogreopcode/include/OgreCollisionObject.h"
 #include "OpcodeCollisionDetector.h"
 #include <OgreRoot.h>
 
@@ -88,9 +87,11 @@ OpcodeCollisionDetectorVisualizerInstance::OpcodeCollisionDetectorVisualizerInst
 
 OpcodeCollisionDetectorVisualizerInstance::~OpcodeCollisionDetectorVisualizerInstance()
 {
-	for (OpcodeCollisionDetector::CollisionObjectStore::iterator I = mDetector.mCollisionObjects.begin(); I != mDetector.mCollisionObjects.end(); ++I)
+	for (OpcodeCollisionDetector::CollisionShapeStore::iterator I = mDetector.mCollisionShapes.begin(); I != mDetector.mCollisionShapes.end(); ++I)
 	{
-		(*I)->getShape()->clearViz();
+		if (!I->isShared) {
+			I->shape->clearViz();
+		}
 	}
 	OpcodeCollisionDetectorVisualizer::getSingleton().removeInstance(this);
 }
@@ -98,13 +99,13 @@ OpcodeCollisionDetectorVisualizerInstance::~OpcodeCollisionDetectorVisualizerIns
 void OpcodeCollisionDetectorVisualizerInstance::visualize(OgreOpcode::Details::OgreOpcodeDebugger* debugger)
 {
 	debugger->beginAABBs();
-	for (OpcodeCollisionDetector::CollisionObjectStore::iterator I = mDetector.mCollisionObjects.begin(); I != mDetector.mCollisionObjects.end(); ++I)
+	for (OpcodeCollisionDetector::CollisionShapeStore::iterator I = mDetector.mCollisionShapes.begin(); I != mDetector.mCollisionShapes.end(); ++I)
 	{
-
-
-		(*I)->getShape()->clearViz();
-		(*I)->getShape()->visualizeAABBs(debugger);
-		//(*I)->getShape()->visualize(debugger);
+		//Shared shapes have no transform of their own, so they can't be drawn at the position of this instance.
+		if (!I->isShared) {
+			I->shape->clearViz();
+			I->shape->visualizeAABBs(debugger);
+		}
 	}
 	debugger->endAABBs();
 }
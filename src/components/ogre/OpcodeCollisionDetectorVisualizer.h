@@ -30,7 +30,6 @@
 
 namespace OgreOpcode
 {
-	class CollisionObject;
 	namespace Details
 	{
 		class OgreOpcodeDebugger;
@@ -0,0 +1,133 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "OpcodeCollisionShapeCache.h"
+#include "ogreopcode/include/OgreCollisionManager.h"
+#include "ogreopcode/include/OgreEntityCollisionShape.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <OgreEntity.h>
+#include <OgreSubEntity.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+
+#include <sstream>
+
+template<> Ember::OgreView::OpcodeCollisionShapeCache* Ember::Singleton<Ember::OgreView::OpcodeCollisionShapeCache>::ms_Singleton = 0;
+
+namespace Ember
+{
+namespace OgreView
+{
+
+OpcodeCollisionShapeCache::OpcodeCollisionShapeCache() :
+		mSceneManager(*OgreOpcode::CollisionManager::getSingleton().getSceneManager()), mNameCounter(0)
+{
+}
+
+OpcodeCollisionShapeCache::~OpcodeCollisionShapeCache()
+{
+	if (!mShapes.empty()) {
+		S_LOG_WARNING("There were still " << mShapes.size() << " shared collision shapes in use when the cache was destroyed.");
+	}
+	for (ShapeStore::iterator I = mShapes.begin(); I != mShapes.end(); ++I) {
+		destroySharedShape(I->second);
+	}
+}
+
+bool OpcodeCollisionShapeCache::isShareable(Ogre::Entity& entity)
+{
+	return !entity.hasSkeleton() && !entity.hasVertexAnimation();
+}
+
+std::string OpcodeCollisionShapeCache::buildKey(Ogre::Entity& entity)
+{
+	std::string key = entity.getMesh()->getName() + "/";
+	for (unsigned int i = 0; i < entity.getNumSubEntities(); ++i) {
+		key += entity.getSubEntity(i)->isVisible() ? '1' : '0';
+	}
+	return key;
+}
+
+OgreOpcode::ICollisionShape* OpcodeCollisionShapeCache::acquireShape(Ogre::Entity& entity)
+{
+	const std::string key = buildKey(entity);
+	ShapeStore::iterator I = mShapes.find(key);
+	if (I != mShapes.end()) {
+		I->second.referenceCount++;
+		return I->second.shape;
+	}
+
+	std::stringstream ss;
+	ss << "collisionshape_" << mNameCounter++;
+	const std::string name = ss.str();
+
+	//The private entity is attached to a node which isn't part of the scene graph, so it's never rendered. The shape is thus built in the local space of the mesh.
+	SharedShape sharedShape;
+	sharedShape.entity = mSceneManager.createEntity(name, entity.getMesh());
+	for (unsigned int i = 0; i < entity.getNumSubEntities(); ++i) {
+		sharedShape.entity->getSubEntity(i)->setVisible(entity.getSubEntity(i)->isVisible());
+	}
+	sharedShape.node = mSceneManager.createSceneNode(name);
+	sharedShape.node->attachObject(sharedShape.entity);
+	sharedShape.shape = OgreOpcode::CollisionManager::getSingleton().createEntityCollisionShape(name);
+	sharedShape.shape->load(sharedShape.entity);
+	sharedShape.shape->setStatic(true);
+	sharedShape.referenceCount = 1;
+
+	mShapes.insert(ShapeStore::value_type(key, sharedShape));
+	mShapeKeys.insert(ShapeKeyStore::value_type(sharedShape.shape, key));
+	S_LOG_VERBOSE("Created shared collision shape for '" << key << "'.");
+	return sharedShape.shape;
+}
+
+void OpcodeCollisionShapeCache::releaseShape(OgreOpcode::ICollisionShape* shape)
+{
+	ShapeKeyStore::iterator I = mShapeKeys.find(shape);
+	if (I == mShapeKeys.end()) {
+		S_LOG_WARNING("Tried to release a collision shape which isn't shared.");
+		return;
+	}
+	ShapeStore::iterator J = mShapes.find(I->second);
+	if (J != mShapes.end() && --J->second.referenceCount == 0) {
+		destroySharedShape(J->second);
+		mShapes.erase(J);
+		mShapeKeys.erase(I);
+	}
+}
+
+size_t OpcodeCollisionShapeCache::getNumberOfShapes() const
+{
+	return mShapes.size();
+}
+
+void OpcodeCollisionShapeCache::destroySharedShape(SharedShape& sharedShape)
+{
+	OgreOpcode::CollisionManager::getSingleton().destroyShape(sharedShape.shape);
+	sharedShape.node->detachAllObjects();
+	mSceneManager.destroySceneNode(sharedShape.node);
+	mSceneManager.destroyEntity(sharedShape.entity);
+}
+
+}
+}
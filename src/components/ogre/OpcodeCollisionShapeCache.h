@@ -0,0 +1,155 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef OPCODECOLLISIONSHAPECACHE_H_
+#define OPCODECOLLISIONSHAPECACHE_H_
+
+#include "framework/Singleton.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace Ogre
+{
+class Entity;
+class SceneNode;
+class SceneManager;
+}
+
+namespace OgreOpcode
+{
+class ICollisionShape;
+class EntityCollisionShape;
+}
+
+namespace Ember
+{
+namespace OgreView
+{
+
+/**
+ * @brief Shares OPCODE collision shapes between entities which use the same mesh.
+ *
+ * Building the OPCODE tree for a mesh is expensive, both in time and memory, and for static meshes the tree will be identical for every entity using the mesh. This cache keeps one shape per mesh (and combination of visible submeshes), reference counted, so that spawning many instances of the same mesh only builds the tree once.
+ *
+ * Shared shapes are built in the local space of the mesh, from a private entity which is never rendered. Since they aren't tied to any instance, the world transform of the instance must be supplied when querying them.
+ *
+ * Only meshes which aren't animated can be shared, since animated meshes need to be refitted per instance. Use isShareable() to check.
+ *
+ * This requires that an OgreOpcode::CollisionManager exists.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class OpcodeCollisionShapeCache: public Singleton<OpcodeCollisionShapeCache>
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * The scene manager of the OgreOpcode::CollisionManager will be used for the private entities.
+	 */
+	OpcodeCollisionShapeCache();
+
+	/**
+	 * @brief Dtor.
+	 * All shapes should have been released at this point.
+	 */
+	virtual ~OpcodeCollisionShapeCache();
+
+	/**
+	 * @brief Returns true if the collision shape for the entity can be shared with other entities.
+	 * @param entity The entity.
+	 * @return True if the entity isn't animated.
+	 */
+	static bool isShareable(Ogre::Entity& entity);
+
+	/**
+	 * @brief Gets a shared shape matching the mesh and the visible submeshes of the entity, creating it if needed.
+	 * Each call must be matched by a call to releaseShape().
+	 * @param entity The entity. This must be shareable.
+	 * @return A shape, in the local space of the mesh.
+	 */
+	OgreOpcode::ICollisionShape* acquireShape(Ogre::Entity& entity);
+
+	/**
+	 * @brief Releases a shape acquired through acquireShape().
+	 * When no more users remain the shape is destroyed.
+	 * @param shape The shape.
+	 */
+	void releaseShape(OgreOpcode::ICollisionShape* shape);
+
+	/**
+	 * @brief Gets the number of shapes currently held.
+	 * @return The number of shapes.
+	 */
+	size_t getNumberOfShapes() const;
+
+private:
+
+	/**
+	 * @brief A shared shape, and the private entity it was built from.
+	 */
+	struct SharedShape
+	{
+		OgreOpcode::EntityCollisionShape* shape;
+		Ogre::Entity* entity;
+		Ogre::SceneNode* node;
+		unsigned int referenceCount;
+	};
+
+	typedef std::unordered_map<std::string, SharedShape> ShapeStore;
+	typedef std::unordered_map<OgreOpcode::ICollisionShape*, std::string> ShapeKeyStore;
+
+	/**
+	 * @brief The scene manager in which the private entities are created.
+	 */
+	Ogre::SceneManager& mSceneManager;
+
+	/**
+	 * @brief All shared shapes, keyed by mesh name and visible submeshes.
+	 */
+	ShapeStore mShapes;
+
+	/**
+	 * @brief The keys of all shapes, for lookup when they are released.
+	 */
+	ShapeKeyStore mShapeKeys;
+
+	/**
+	 * @brief A counter used for creating unique names.
+	 */
+	unsigned int mNameCounter;
+
+	/**
+	 * @brief Builds the key of an entity, from its mesh and which of its subentities are visible.
+	 * @param entity The entity.
+	 * @return A key.
+	 */
+	static std::string buildKey(Ogre::Entity& entity);
+
+	/**
+	 * @brief Destroys a shape and its private entity.
+	 * @param sharedShape The shape.
+	 */
+	void destroySharedShape(SharedShape& sharedShape);
+};
+
+}
+}
+
+#endif /* OPCODECOLLISIONSHAPECACHE_H_ */
@@ -43,7 +43,7 @@ namespace Ember
       if (!mChangeRequiredConnection)
         {
           mChangeRequiredConnection =
-              mGraphicalChangeAdapter.EventChangeRequired.connect(
+              mGraphicalChangeAdapter.connectSubsystem("renderdistance",
                   sigc::mem_fun(*this, &RenderDistanceManager::changeLevel));
         }
       mConfigListenerContainer->registerConfigListener("graphics",
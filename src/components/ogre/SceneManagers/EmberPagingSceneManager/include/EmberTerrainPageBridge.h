@@ -24,6 +24,7 @@
 #define EMBEROGREEMBERTERRAINPAGEBRIDGE_H
 
 #include "terrain/ITerrainPageBridge.h"
+#include "OgrePagingLandScapeHeightPyramid.h"
 
 #include <OgrePrerequisites.h>
 #include <boost/shared_array.hpp>
@@ -61,6 +62,12 @@ namespace Ember
       void
       terrainPageReady();
 
+      /**
+       * @brief Hands over the height pyramid rebuilt by updateTerrain() to the height field, so that ray queries use the new heights.
+       */
+      void
+      terrainPageUpdated();
+
     protected:
 
       Ogre::PagingLandScapeData2DManager& mData2dManager;
@@ -72,6 +79,16 @@ namespace Ember
        */
       size_t mHeightDataSize;
 
+      /**
+       * @brief The number of height samples along each side of the page.
+       */
+      size_t mPageSize;
+
+      /**
+       * @brief A min/max pyramid of the height data, built in the background thread and handed over to the height field once the page is ready.
+       */
+      Ogre::PagingLandScapeHeightPyramid mHeightPyramid;
+
       UnsignedIndexType mIndex;
 
       float mMaxHeight;
@@ -22,6 +22,7 @@
 
 #include "OgrePagingLandScapeData2DManager.h"
 #include "OgrePagingLandScapeOptions.h"
+#include "OgrePagingLandScapeHeightPyramid.h"
 
 #include <boost/shared_array.hpp>
 
@@ -234,6 +235,29 @@ public:
 
 	inline bool isCoord(unsigned int x, unsigned int z) const { return (mPageX == x && mPageZ == z); };
 
+	/**
+	 * @brief Hands over a height pyramid built from the current height data.
+	 * The supplied pyramid is swapped with the existing one, so this is cheap even for large pages.
+	 * @param pyramid A pyramid built from the height data of this page. After the call it will contain the previous pyramid.
+	 */
+	void setHeightPyramid(PagingLandScapeHeightPyramid& pyramid);
+
+	/**
+	 * @brief Returns true if a height pyramid is available for ray intersection.
+	 */
+	bool hasHeightPyramid() const;
+
+	/**
+	 * @brief Finds the first intersection of a ray with the terrain of this page.
+	 * @param origin The origin of the ray, in world space.
+	 * @param direction The direction of the ray, in world space.
+	 * @param tMin The start of the part of the ray to test, in units of the direction.
+	 * @param tMax The end of the part of the ray to test, in units of the direction.
+	 * @param t Set to the position of the intersection along the ray, in units of the direction.
+	 * @return True if the ray hit the terrain. Always false if there's no height pyramid.
+	 */
+	bool intersectRay(const Vector3& origin, const Vector3& direction, Real tMin, Real tMax, Real& t) const;
+
 
 protected:
 	virtual void _save() = 0;
@@ -285,6 +309,11 @@ protected:
 	Real mShiftZ;
 	PagingLandScapeData2DManager* mParent;
 
+	/**
+	 * @brief Min/max pyramid of the height data, used for fast ray intersection.
+	 */
+	PagingLandScapeHeightPyramid mHeightPyramid;
+
 private:
 	Image::Box mRect;
 };
@@ -0,0 +1,140 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef PAGINGLANDSCAPEHEIGHTPYRAMID_H_
+#define PAGINGLANDSCAPEHEIGHTPYRAMID_H_
+
+#include <OgrePrerequisites.h>
+#include <OgreVector3.h>
+
+#include <vector>
+
+namespace Ogre
+{
+
+/**
+ * @brief A min/max mip pyramid over the height data of one page, used for fast ray intersection.
+ *
+ * The lowest level holds the min and max height of each cell (the quad between four adjacent height samples); each level above it holds the min and max of four cells of the level below, up to a single cell covering the whole page.
+ *
+ * When intersecting a ray the pyramid is descended from the top, skipping any cell which the ray passes entirely above or below, and visiting child cells in the order the ray enters them. Once a cell on the lowest level is reached the ray is tested against the two triangles of the cell, so the hit is exact for the full resolution terrain. This makes a ray query logarithmic in the number of height samples, rather than linear in the length of the ray.
+ *
+ * All coordinates are in page local "grid" space, where the height sample at (x, z) is located at (x, height, z). The caller is responsible for transforming rays into this space.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class PagingLandScapeHeightPyramid
+{
+public:
+
+	PagingLandScapeHeightPyramid();
+
+	/**
+	 * @brief Builds the pyramid from height data.
+	 * @param heightData The height data, row by row. Must contain size * size samples.
+	 * @param size The number of samples along each side of the page.
+	 */
+	void build(const Real* heightData, size_t size);
+
+	/**
+	 * @brief Updates the pyramid after a single height sample has changed.
+	 * Only the cells touching the sample, and their parents, are recalculated.
+	 * @param heightData The height data, which must be the same size as when the pyramid was built.
+	 * @param x The x index of the sample.
+	 * @param z The z index of the sample.
+	 */
+	void update(const Real* heightData, unsigned int x, unsigned int z);
+
+	/**
+	 * @brief Removes all data.
+	 */
+	void clear();
+
+	/**
+	 * @brief Returns true if the pyramid has been built.
+	 * @return True if built.
+	 */
+	bool isBuilt() const;
+
+	/**
+	 * @brief Swaps the contents with another pyramid.
+	 * This allows a pyramid to be built in a background thread and then handed over cheaply.
+	 * @param other The other pyramid.
+	 */
+	void swap(PagingLandScapeHeightPyramid& other);
+
+	/**
+	 * @brief Finds the first intersection of a ray with the terrain.
+	 * The terrain is treated as two sided, so rays starting below the terrain will hit it on their way up.
+	 * @param heightData The height data the pyramid was built from.
+	 * @param origin The origin of the ray, in grid space.
+	 * @param direction The direction of the ray, in grid space. This doesn't need to be normalised.
+	 * @param tMin The start of the part of the ray to test, in units of the direction.
+	 * @param tMax The end of the part of the ray to test, in units of the direction.
+	 * @param t Set to the position of the intersection along the ray, in units of the direction.
+	 * @return True if the ray hit the terrain.
+	 */
+	bool intersect(const Real* heightData, const Vector3& origin, const Vector3& direction, Real tMin, Real tMax, Real& t) const;
+
+private:
+
+	/**
+	 * @brief One level of the pyramid.
+	 */
+	struct Level
+	{
+		/**
+		 * @brief The number of cells along each side.
+		 */
+		size_t size;
+
+		/**
+		 * @brief The number of height samples along each side of a cell.
+		 */
+		size_t cellSize;
+
+		std::vector<Real> minHeights;
+		std::vector<Real> maxHeights;
+	};
+
+	/**
+	 * @brief All levels, starting with the full resolution one.
+	 */
+	std::vector<Level> mLevels;
+
+	/**
+	 * @brief The number of height samples along each side of the page.
+	 */
+	size_t mSize;
+
+	void updateCell(const Real* heightData, size_t level, size_t x, size_t z);
+
+	bool intersectCell(const Real* heightData, size_t level, size_t x, size_t z, const Vector3& origin, const Vector3& direction, const Vector3& inverseDirection, Real tMin, Real tMax, Real& t) const;
+
+	bool intersectTriangles(const Real* heightData, size_t x, size_t z, const Vector3& origin, const Vector3& direction, Real tMin, Real tMax, Real& t) const;
+
+	/**
+	 * @brief Clips a ray against a rectangle in the xz plane.
+	 * @return True if the ray passes through the rectangle within the range. tMin and tMax are narrowed to the range within the rectangle.
+	 */
+	static bool clipToRectangle(const Vector3& origin, const Vector3& inverseDirection, Real x0, Real z0, Real x1, Real z1, Real& tMin, Real& tMax);
+};
+
+}
+
+#endif /* PAGINGLANDSCAPEHEIGHTPYRAMID_H_ */
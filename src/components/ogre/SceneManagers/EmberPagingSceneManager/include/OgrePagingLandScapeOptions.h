@@ -270,6 +270,8 @@ namespace Ogre
     Real TextureStretchFactor;
 
     unsigned int RenderableLoadInterval;
+    unsigned int RenderableLoadThreads;	//Number of threads generating renderable vertex data. If 0, renderables are loaded in the main thread.
+    unsigned int RenderableUploadBudget;	//Max time in milliseconds to spend each frame on uploading vertex data generated in the background.
 
     unsigned int TileInvisibleUnloadFrames;
     unsigned int PageInvisibleUnloadFrames;
@@ -152,6 +152,8 @@ namespace Ogre
     class PagingLandScapeRenderable;
 	class PagingLandScapeRenderableSet;
     class PagingLandScapeRenderableManager;
+    class PagingLandScapeRenderableBuilder;
+    struct PagingLandScapeRenderableStaging;
     typedef std::vector< PagingLandScapeRenderable* > PagingLandScapeRenderableVector;
 
 	// Texture coordinates buffer cache
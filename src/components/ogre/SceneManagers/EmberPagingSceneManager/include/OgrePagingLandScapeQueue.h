@@ -76,6 +76,39 @@ namespace Ogre
 		const Vector3 mCamPos;
 	};
 	//-----------------------------------------------------------------------
+	/** Sorts by distance to the camera, but favours elements in front of the camera over those behind it.
+		An element straight behind the camera is treated as if it was twice as far away.
+	*/
+	template <class T>
+	class  cameraPrioritySort
+	{
+	public:
+		//-----------------------------------------------------------------------
+		cameraPrioritySort(const Vector3 &camPos, const Vector3 &camDirection) : mCamPos(camPos), mCamDirection(camDirection.x, 0, camDirection.z)
+		{
+			mCamDirection.normalise();
+		};
+		//-----------------------------------------------------------------------
+		bool operator()(T* x, T* y)
+		{
+			return getPriorityDistance(x) < getPriorityDistance(y);
+		}
+	private:
+		const Vector3 mCamPos;
+		Vector3 mCamDirection;
+
+		Real getPriorityDistance(T* e) const
+		{
+			Vector3 offset(e->getCenter() - mCamPos);
+			offset.y = 0;
+			const Real squaredDistance = offset.squaredLength();
+			if (squaredDistance == 0)
+				return 0;
+			const Real weight = 1.5f - 0.5f * (offset.dotProduct(mCamDirection) / Math::Sqrt(squaredDistance));
+			return squaredDistance * weight * weight;
+		}
+	};
+	//-----------------------------------------------------------------------
 	/** This class holds classes T given to it by the plugin in a FIFO queue. */
     template<class T>
     class PagingLandScapeQueue
@@ -133,6 +166,11 @@ namespace Ogre
 				mQueue.sort (distanceToBoxSort <T>(pos));
 			};
 			//-----------------------------------------------------------------------
+			void sortByPriority(const Vector3 &pos, const Vector3 &direction)
+			{
+				mQueue.sort (cameraPrioritySort <T>(pos, direction));
+			};
+			//-----------------------------------------------------------------------
 			T *find_nearest(const Vector3 &pos)
 			{
 				T *p = 0;
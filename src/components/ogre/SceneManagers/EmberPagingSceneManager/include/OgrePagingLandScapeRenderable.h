@@ -73,7 +73,19 @@ namespace Ogre
 		void init(PagingLandScapeTileInfo* info);
 		void uninit(void);
 		
+		/** Loads the renderable, generating the vertex data in the calling thread.
+		*/
 		bool load(void);
+
+		/** Creates a builder which can generate the vertex data of this renderable, in any thread.
+			The builder holds a copy of all data it needs.
+			@return A new builder, or null if the page data isn't available.
+		*/
+		PagingLandScapeRenderableBuilder* createBuilder(void);
+
+		/** Uploads vertex data generated by a builder to the hardware buffers, and completes the loading.
+		*/
+		void finishLoad(const PagingLandScapeRenderableStaging& staging);
 		
 		void setNeedUpdate(void)
 		{
@@ -169,6 +181,8 @@ namespace Ogre
 		const unsigned int getVertexCount();
         
         bool mQueued;
+        /// Incremented whenever the renderable is initialized or queued for loading, so that the results of any stale background loads can be detected.
+        unsigned int mLoadGeneration;
         PagingLandScapeTile *mParentTile;
         
 		/**
@@ -234,7 +248,6 @@ namespace Ogre
 		Real mDistanceToCam;
 
 		void fillNextLevelDown();
-		void _calculateMinLevelDist2(const Real C);
 		/// Create a blank delta buffer for use in morphing
 		HardwareVertexBufferSharedPtr createDeltaBuffer(void) const;
 		
@@ -0,0 +1,214 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef PAGINGLANDSCAPERENDERABLEBUILDER_H_
+#define PAGINGLANDSCAPERENDERABLEBUILDER_H_
+
+#include "OgrePagingLandScapePrerequisites.h"
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <memory>
+#include <vector>
+
+namespace Ogre
+{
+
+/**
+ * @brief The vertex data of a renderable, generated on the CPU and waiting to be uploaded to the hardware buffers.
+ */
+struct PagingLandScapeRenderableStaging
+{
+	/**
+	 * @brief The vertices, in the layout of the main vertex buffer.
+	 * Positions and normals are filled in, but any vertex colours are left for the main thread, since they're provided by the data source.
+	 */
+	std::vector<uchar> vertices;
+
+	/**
+	 * @brief The morph deltas for each LOD level except the first. Empty if LOD morphing isn't used.
+	 */
+	std::vector<std::vector<ushort> > deltas;
+
+	/**
+	 * @brief True if minLevelDistSqr has been calculated.
+	 * If not, the values cached in the tile info should be used.
+	 */
+	bool hasMinLevelDistSqr;
+
+	/**
+	 * @brief The squared distances at which LODs change.
+	 */
+	std::vector<Real> minLevelDistSqr;
+
+	Real minHeight;
+	Real maxHeight;
+};
+
+/**
+ * @brief Generates the vertex data, the morph deltas and the LOD distances for a renderable.
+ *
+ * All of the data needed is copied when the builder is created, so that the building can be done in a background thread while the page data is being altered, or even unloaded.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class PagingLandScapeRenderableBuilder
+{
+public:
+
+	/**
+	 * @brief The options which affect the generated data.
+	 */
+	struct Settings
+	{
+		unsigned int tileSize;
+		Vector3 scale;
+		bool vertexCompression;
+		bool normals;
+		bool lodMorph;
+		bool roughnessLod;
+		int maxRenderLevel;
+		Real cFactor;
+		Real lodFactor;
+		Real uninitializedHeight;
+
+		/**
+		 * @brief The size in bytes of each vertex.
+		 */
+		size_t vertexSize;
+
+		/**
+		 * @brief The offset in bytes of the position within each vertex.
+		 */
+		size_t positionOffset;
+
+		/**
+		 * @brief The offset in bytes of the normal within each vertex.
+		 */
+		size_t normalOffset;
+
+		/**
+		 * @brief If true, the LOD distances should be calculated.
+		 */
+		bool calculateMinLevelDistSqr;
+	};
+
+	/**
+	 * @brief Ctor.
+	 * @param settings The settings.
+	 * @param heightData The height data of the page.
+	 * @param pageSize The number of height samples along each side of the page.
+	 * @param tileX The x index of the tile within the page.
+	 * @param tileZ The z index of the tile within the page.
+	 */
+	PagingLandScapeRenderableBuilder(const Settings& settings, const Real* heightData, size_t pageSize, unsigned int tileX, unsigned int tileZ);
+
+	/**
+	 * @brief Generates the data.
+	 * This is safe to call from a background thread.
+	 * @param staging The generated data.
+	 */
+	void build(PagingLandScapeRenderableStaging& staging) const;
+
+private:
+
+	const Settings mSettings;
+
+	const size_t mPageSize;
+
+	/**
+	 * @brief The page coords of the first vertex of the tile.
+	 */
+	int mOffsetX, mOffsetZ;
+
+	/**
+	 * @brief The page coords of the first copied height sample.
+	 * This is one sample outside of the tile where possible, since the neighbours are needed for the normals.
+	 */
+	int mRegionX, mRegionZ;
+
+	int mRegionWidth;
+
+	/**
+	 * @brief A copy of the heights of the tile and its surroundings.
+	 */
+	std::vector<Real> mHeights;
+
+	/**
+	 * @brief Gets the height at the page coords.
+	 */
+	Real getHeight(int x, int z) const;
+
+	/**
+	 * @brief Gets the normal at the page coords, calculated the same way as PagingLandScapeData2D::getNormal.
+	 */
+	Vector3 getNormal(int x, int z) const;
+
+	void buildVertices(PagingLandScapeRenderableStaging& staging) const;
+
+	void buildLevels(PagingLandScapeRenderableStaging& staging) const;
+};
+
+/**
+ * @brief Builds a renderable in a background thread, and hands the result back to the renderable manager in the main thread.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class PagingLandScapeRenderableLoadTask: public Ember::Tasks::TemplateNamedTask<PagingLandScapeRenderableLoadTask>
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param manager The renderable manager.
+	 * @param renderable The renderable being loaded.
+	 * @param builder The builder, ownership of which is transferred to this instance.
+	 */
+	PagingLandScapeRenderableLoadTask(PagingLandScapeRenderableManager& manager, PagingLandScapeRenderable* renderable, PagingLandScapeRenderableBuilder* builder);
+
+	virtual ~PagingLandScapeRenderableLoadTask();
+
+	virtual void executeTaskInBackgroundThread(Ember::Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+private:
+
+	PagingLandScapeRenderableManager& mManager;
+
+	PagingLandScapeRenderable* mRenderable;
+
+	/**
+	 * @brief The load generation of the renderable when the task was created.
+	 * If it has changed when the task is done, the result is discarded.
+	 */
+	const unsigned int mGeneration;
+
+	/**
+	 * @brief The epoch of the manager when the task was created.
+	 * If it has changed when the task is done, the renderable might not exist anymore.
+	 */
+	const unsigned int mEpoch;
+
+	std::unique_ptr<PagingLandScapeRenderableBuilder> mBuilder;
+
+	PagingLandScapeRenderableStaging mStaging;
+};
+
+}
+
+#endif /* PAGINGLANDSCAPERENDERABLEBUILDER_H_ */
@@ -26,6 +26,16 @@
 
 #include "OgrePagingLandScapePoolSet.h"
 
+#include <memory>
+
+namespace Ember
+{
+  namespace Tasks
+  {
+    class TaskQueue;
+  }
+}
+
 namespace Ogre
 {
 
@@ -89,9 +99,30 @@ namespace Ogre
     unqueueRenderable(PagingLandScapeTile* tile);
 
     /** Load a set of renderables
+     @remarks
+     Renderables closest to the camera, and in the direction the camera is looking, are loaded first.
+     If background loading is enabled the vertex data is generated by worker threads, and this only uploads the data which is ready, within the time budget set by the RenderableUploadBudget option.
+     @return True if there are no more renderables to load.
      */
     bool
-    executeRenderableLoading(const Vector3 &Cameraposition);
+    executeRenderableLoading(const Vector3 &Cameraposition,
+        const Vector3 &CameraDirection);
+
+    /** Called when the vertex data of a renderable has been generated in the background.
+     @remarks
+     The result is discarded if the renderable has been unloaded or requeued since the loading started.
+     */
+    void
+    _renderableBuilt(PagingLandScapeRenderable* rend, unsigned int generation,
+        unsigned int epoch, const PagingLandScapeRenderableStaging& staging);
+
+    /** Gets the current load epoch, which changes whenever all renderables are destroyed.
+     */
+    unsigned int
+    getLoadEpoch() const
+    {
+      return mLoadEpoch;
+    }
 
     size_t
     numRenderables(void) const;
@@ -158,6 +189,11 @@ namespace Ogre
     void
     _addBatch(const unsigned int num);
 
+    /** Attaches a loaded renderable to its tile, or unloads the tile if the renderable couldn't be loaded.
+     */
+    void
+    finishRenderableLoading(PagingLandScapeTile* tile, bool loaded);
+
     ///Keep a set of pre-allocated PagingLandscapeRenderables.
     PagingLandScapeRenderableSet mRenderablePool;
 
@@ -175,6 +211,18 @@ namespace Ogre
     unsigned int mRenderableLoadInterval;
     int mLoadInterval;
 
+    /** Worker threads generating vertex data, or null if renderables are loaded in the main thread.
+     */
+    std::unique_ptr<Ember::Tasks::TaskQueue> mTaskQueue;
+
+    /** The number of renderables currently being generated in the background.
+     */
+    size_t mNumLoadsInProgress;
+
+    /** Incremented whenever all renderables are destroyed, so that any background loads still in progress are discarded.
+     */
+    unsigned int mLoadEpoch;
+
   };
 
 }
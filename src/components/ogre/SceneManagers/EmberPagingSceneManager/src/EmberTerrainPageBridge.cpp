@@ -29,6 +29,7 @@
 
 #include "EmberTerrainPageBridge.h"
 #include "OgrePagingLandScapeData2DManager.h"
+#include "OgrePagingLandScapeOptions.h"
 #include "EmberPagingLandScapeData2D_HeightField.h"
 #include "terrain/TerrainPageGeometry.h"
 
@@ -38,7 +39,7 @@ namespace OgreView
 {
 
 EmberTerrainPageBridge::EmberTerrainPageBridge(Ogre::PagingLandScapeData2DManager& data2dManager, const boost::shared_array<Ogre::Real>& heightData, size_t heightDataSize, UnsignedIndexType index) :
-	mData2dManager(data2dManager), mHeightData(heightData), mHeightDataSize(heightDataSize), mIndex(index), mMaxHeight(0)
+	mData2dManager(data2dManager), mHeightData(heightData), mHeightDataSize(heightDataSize), mPageSize(data2dManager.getOptions()->PageSize), mIndex(index), mMaxHeight(0)
 {
 }
 
@@ -62,6 +63,8 @@ void EmberTerrainPageBridge::updateTerrain(Terrain::TerrainPageGeometry& geometr
 	geometry.updateOgreHeightData(mHeightData.get());
 #endif
 	mMaxHeight = geometry.getMaxHeight();
+	//Build the pyramid here, while we're still in the background thread.
+	mHeightPyramid.build(mHeightData.get(), mPageSize);
 }
 
 void EmberTerrainPageBridge::terrainPageReady()
@@ -69,10 +72,20 @@ void EmberTerrainPageBridge::terrainPageReady()
 	EmberPagingLandScapeData2D_HeightField* heightField = getData2D();
 	if (heightField) {
 		heightField->setMaxHeight(mMaxHeight);
+		heightField->setHeightPyramid(mHeightPyramid);
 		heightField->eventTerrainPageLoaded();
 	}
 }
 
+void EmberTerrainPageBridge::terrainPageUpdated()
+{
+	EmberPagingLandScapeData2D_HeightField* heightField = getData2D();
+	if (heightField) {
+		heightField->setMaxHeight(mMaxHeight);
+		heightField->setHeightPyramid(mHeightPyramid);
+	}
+}
+
 EmberPagingLandScapeData2D_HeightField* EmberTerrainPageBridge::getData2D()
 {
 	return static_cast<EmberPagingLandScapeData2D_HeightField*> (mData2dManager.getData2D(mIndex.first, mIndex.second, false));
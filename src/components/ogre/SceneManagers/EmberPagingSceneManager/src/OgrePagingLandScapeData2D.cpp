@@ -117,6 +117,7 @@ namespace Ogre
 //		delete[] mHeightData;
         mHeightDataPtr.reset();
         mHeightData = 0;
+        mHeightPyramid.clear();
         _unload();
         mIsLoaded = false;
 #ifndef _MAPSPLITTER
@@ -125,6 +126,37 @@ namespace Ogre
       }
   }
 
+//-----------------------------------------------------------------------
+  void
+  PagingLandScapeData2D::setHeightPyramid(PagingLandScapeHeightPyramid& pyramid)
+  {
+    mHeightPyramid.swap(pyramid);
+  }
+
+//-----------------------------------------------------------------------
+  bool
+  PagingLandScapeData2D::hasHeightPyramid() const
+  {
+    return mHeightPyramid.isBuilt();
+  }
+
+//-----------------------------------------------------------------------
+  bool
+  PagingLandScapeData2D::intersectRay(const Vector3& origin,
+      const Vector3& direction, Real tMin, Real tMax, Real& t) const
+  {
+    if (!mHeightData)
+      return false;
+    // transform into page local grid space, where heights are kept scaled.
+    const Vector3& invScale = mParent->getOptions()->invScale;
+    const Vector3 gridOrigin(origin.x * invScale.x - mShiftX, origin.y,
+        origin.z * invScale.z - mShiftZ);
+    const Vector3 gridDirection(direction.x * invScale.x, direction.y,
+        direction.z * invScale.z);
+    return mHeightPyramid.intersect(mHeightData, gridOrigin, gridDirection,
+        tMin, tMax, t);
+  }
+
 //-----------------------------------------------------------------------
   void
   PagingLandScapeData2D::computePowerof2PlusOneSize()
@@ -272,6 +304,7 @@ namespace Ogre
     if (mHeightData[Pos] != h)
       {
         mHeightData[Pos] = h;
+        mHeightPyramid.update(mHeightData, x, z);
 
         unsigned int tileposx = x;
         unsigned int tileposz = z;
@@ -0,0 +1,303 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "OgrePagingLandScapePrecompiledHeaders.h"
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "OgrePagingLandScapeHeightPyramid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Ogre
+{
+
+namespace
+{
+/**
+ * @brief Tolerance used when comparing heights and barycentric coordinates, so that rays passing exactly along an edge or a vertex aren't missed.
+ */
+const Real EPSILON = 0.0001f;
+
+/**
+ * @brief A child cell, and the distance along the ray at which the ray enters it.
+ */
+struct ChildEntry
+{
+	size_t x;
+	size_t z;
+	Real tMin;
+	Real tMax;
+
+	bool operator<(const ChildEntry& rhs) const
+	{
+		return tMin < rhs.tMin;
+	}
+};
+
+/**
+ * @brief Two sided ray-triangle intersection (Möller-Trumbore).
+ */
+bool intersectTriangle(const Vector3& origin, const Vector3& direction, const Vector3& a, const Vector3& b, const Vector3& c, Real& t)
+{
+	const Vector3 edge1 = b - a;
+	const Vector3 edge2 = c - a;
+	const Vector3 p = direction.crossProduct(edge2);
+	const Real determinant = edge1.dotProduct(p);
+	if (std::abs(determinant) < std::numeric_limits<Real>::epsilon()) {
+		return false;
+	}
+	const Real inverseDeterminant = 1.0f / determinant;
+	const Vector3 s = origin - a;
+	const Real u = s.dotProduct(p) * inverseDeterminant;
+	if (u < -EPSILON || u > 1.0f + EPSILON) {
+		return false;
+	}
+	const Vector3 q = s.crossProduct(edge1);
+	const Real v = direction.dotProduct(q) * inverseDeterminant;
+	if (v < -EPSILON || u + v > 1.0f + EPSILON) {
+		return false;
+	}
+	t = edge2.dotProduct(q) * inverseDeterminant;
+	return true;
+}
+}
+
+PagingLandScapeHeightPyramid::PagingLandScapeHeightPyramid() :
+		mSize(0)
+{
+}
+
+void PagingLandScapeHeightPyramid::build(const Real* heightData, size_t size)
+{
+	mLevels.clear();
+	mSize = size;
+	if (!heightData || size < 2) {
+		return;
+	}
+
+	Level base;
+	base.size = size - 1;
+	base.cellSize = 1;
+	base.minHeights.resize(base.size * base.size);
+	base.maxHeights.resize(base.size * base.size);
+	mLevels.push_back(base);
+	for (size_t z = 0; z < base.size; ++z) {
+		for (size_t x = 0; x < base.size; ++x) {
+			updateCell(heightData, 0, x, z);
+		}
+	}
+
+	while (mLevels.back().size > 1) {
+		Level level;
+		level.size = (mLevels.back().size + 1) / 2;
+		level.cellSize = mLevels.back().cellSize * 2;
+		level.minHeights.resize(level.size * level.size);
+		level.maxHeights.resize(level.size * level.size);
+		mLevels.push_back(level);
+		const size_t levelIndex = mLevels.size() - 1;
+		for (size_t z = 0; z < level.size; ++z) {
+			for (size_t x = 0; x < level.size; ++x) {
+				updateCell(heightData, levelIndex, x, z);
+			}
+		}
+	}
+}
+
+void PagingLandScapeHeightPyramid::update(const Real* heightData, unsigned int x, unsigned int z)
+{
+	if (mLevels.empty()) {
+		return;
+	}
+	//A sample is shared by up to four cells on the lowest level.
+	const size_t lastCell = mLevels.front().size - 1;
+	const size_t lowX = x > 0 ? x - 1 : 0;
+	const size_t lowZ = z > 0 ? z - 1 : 0;
+	const size_t highX = std::min<size_t>(x, lastCell);
+	const size_t highZ = std::min<size_t>(z, lastCell);
+	for (size_t level = 0; level < mLevels.size(); ++level) {
+		for (size_t cellZ = lowZ >> level; cellZ <= (highZ >> level); ++cellZ) {
+			for (size_t cellX = lowX >> level; cellX <= (highX >> level); ++cellX) {
+				updateCell(heightData, level, cellX, cellZ);
+			}
+		}
+	}
+}
+
+void PagingLandScapeHeightPyramid::updateCell(const Real* heightData, size_t level, size_t x, size_t z)
+{
+	Level& current = mLevels[level];
+	Real minHeight = std::numeric_limits<Real>::max();
+	Real maxHeight = -std::numeric_limits<Real>::max();
+	if (level == 0) {
+		const Real heights[4] = { heightData[z * mSize + x], heightData[z * mSize + x + 1], heightData[(z + 1) * mSize + x], heightData[(z + 1) * mSize + x + 1] };
+		for (int i = 0; i < 4; ++i) {
+			minHeight = std::min(minHeight, heights[i]);
+			maxHeight = std::max(maxHeight, heights[i]);
+		}
+	} else {
+		const Level& child = mLevels[level - 1];
+		for (size_t childZ = z * 2; childZ < std::min(z * 2 + 2, child.size); ++childZ) {
+			for (size_t childX = x * 2; childX < std::min(x * 2 + 2, child.size); ++childX) {
+				minHeight = std::min(minHeight, child.minHeights[childZ * child.size + childX]);
+				maxHeight = std::max(maxHeight, child.maxHeights[childZ * child.size + childX]);
+			}
+		}
+	}
+	current.minHeights[z * current.size + x] = minHeight;
+	current.maxHeights[z * current.size + x] = maxHeight;
+}
+
+void PagingLandScapeHeightPyramid::clear()
+{
+	mLevels.clear();
+	mSize = 0;
+}
+
+bool PagingLandScapeHeightPyramid::isBuilt() const
+{
+	return !mLevels.empty();
+}
+
+void PagingLandScapeHeightPyramid::swap(PagingLandScapeHeightPyramid& other)
+{
+	mLevels.swap(other.mLevels);
+	std::swap(mSize, other.mSize);
+}
+
+bool PagingLandScapeHeightPyramid::clipToRectangle(const Vector3& origin, const Vector3& inverseDirection, Real x0, Real z0, Real x1, Real z1, Real& tMin, Real& tMax)
+{
+	const Real lower[2] = { x0, z0 };
+	const Real upper[2] = { x1, z1 };
+	const Real start[2] = { origin.x, origin.z };
+	const Real inverse[2] = { inverseDirection.x, inverseDirection.z };
+	for (int axis = 0; axis < 2; ++axis) {
+		if (inverse[axis] == std::numeric_limits<Real>::infinity()) {
+			//The ray is parallel to this axis.
+			if (start[axis] < lower[axis] || start[axis] > upper[axis]) {
+				return false;
+			}
+			continue;
+		}
+		Real t1 = (lower[axis] - start[axis]) * inverse[axis];
+		Real t2 = (upper[axis] - start[axis]) * inverse[axis];
+		if (t1 > t2) {
+			std::swap(t1, t2);
+		}
+		tMin = std::max(tMin, t1);
+		tMax = std::min(tMax, t2);
+		if (tMin > tMax) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PagingLandScapeHeightPyramid::intersect(const Real* heightData, const Vector3& origin, const Vector3& direction, Real tMin, Real tMax, Real& t) const
+{
+	if (mLevels.empty() || !heightData) {
+		return false;
+	}
+	const Vector3 inverseDirection(direction.x != 0 ? 1.0f / direction.x : std::numeric_limits<Real>::infinity(), 0, direction.z != 0 ? 1.0f / direction.z : std::numeric_limits<Real>::infinity());
+	return intersectCell(heightData, mLevels.size() - 1, 0, 0, origin, direction, inverseDirection, tMin, tMax, t);
+}
+
+bool PagingLandScapeHeightPyramid::intersectCell(const Real* heightData, size_t level, size_t x, size_t z, const Vector3& origin, const Vector3& direction, const Vector3& inverseDirection, Real tMin, Real tMax, Real& t) const
+{
+	const Level& current = mLevels[level];
+	const size_t lastSample = mSize - 1;
+	const Real x0 = static_cast<Real>(x * current.cellSize);
+	const Real z0 = static_cast<Real>(z * current.cellSize);
+	const Real x1 = static_cast<Real>(std::min((x + 1) * current.cellSize, lastSample));
+	const Real z1 = static_cast<Real>(std::min((z + 1) * current.cellSize, lastSample));
+
+	Real cellMin = tMin;
+	Real cellMax = tMax;
+	if (!clipToRectangle(origin, inverseDirection, x0, z0, x1, z1, cellMin, cellMax)) {
+		return false;
+	}
+
+	//The ray is a straight line, so within the cell its height is bounded by the heights where it enters and exits.
+	const Real enterHeight = origin.y + direction.y * cellMin;
+	const Real exitHeight = origin.y + direction.y * cellMax;
+	const size_t index = z * current.size + x;
+	if (std::min(enterHeight, exitHeight) > current.maxHeights[index] + EPSILON || std::max(enterHeight, exitHeight) < current.minHeights[index] - EPSILON) {
+		return false;
+	}
+
+	if (level == 0) {
+		return intersectTriangles(heightData, x, z, origin, direction, tMin, tMax, t);
+	}
+
+	//Visit the children in the order the ray passes through them; the first hit is then the closest.
+	const Level& child = mLevels[level - 1];
+	ChildEntry entries[4];
+	size_t numberOfEntries = 0;
+	for (size_t childZ = z * 2; childZ < std::min(z * 2 + 2, child.size); ++childZ) {
+		for (size_t childX = x * 2; childX < std::min(x * 2 + 2, child.size); ++childX) {
+			ChildEntry& entry = entries[numberOfEntries];
+			entry.tMin = cellMin;
+			entry.tMax = cellMax;
+			const Real childX0 = static_cast<Real>(childX * child.cellSize);
+			const Real childZ0 = static_cast<Real>(childZ * child.cellSize);
+			const Real childX1 = static_cast<Real>(std::min((childX + 1) * child.cellSize, lastSample));
+			const Real childZ1 = static_cast<Real>(std::min((childZ + 1) * child.cellSize, lastSample));
+			if (clipToRectangle(origin, inverseDirection, childX0, childZ0, childX1, childZ1, entry.tMin, entry.tMax)) {
+				entry.x = childX;
+				entry.z = childZ;
+				numberOfEntries++;
+			}
+		}
+	}
+	std::sort(entries, entries + numberOfEntries);
+	for (size_t i = 0; i < numberOfEntries; ++i) {
+		if (intersectCell(heightData, level - 1, entries[i].x, entries[i].z, origin, direction, inverseDirection, tMin, tMax, t)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool PagingLandScapeHeightPyramid::intersectTriangles(const Real* heightData, size_t x, size_t z, const Vector3& origin, const Vector3& direction, Real tMin, Real tMax, Real& t) const
+{
+	//The cell is split along the diagonal from (x + 1, z) to (x, z + 1), the same way as PagingLandScapeData2DManager::getInterpolatedWorldHeight does it.
+	const Real fx = static_cast<Real>(x);
+	const Real fz = static_cast<Real>(z);
+	const Vector3 v00(fx, heightData[z * mSize + x], fz);
+	const Vector3 v10(fx + 1, heightData[z * mSize + x + 1], fz);
+	const Vector3 v01(fx, heightData[(z + 1) * mSize + x], fz + 1);
+	const Vector3 v11(fx + 1, heightData[(z + 1) * mSize + x + 1], fz + 1);
+
+	bool hit = false;
+	Real triangleT;
+	if (intersectTriangle(origin, direction, v00, v10, v01, triangleT) && triangleT >= tMin && triangleT <= tMax) {
+		t = triangleT;
+		hit = true;
+	}
+	if (intersectTriangle(origin, direction, v10, v11, v01, triangleT) && triangleT >= tMin && triangleT <= tMax && (!hit || triangleT < t)) {
+		t = triangleT;
+		hit = true;
+	}
+	return hit;
+}
+
+}
@@ -122,6 +122,8 @@ namespace Ogre
 
 	    num_renderables_loading = 10;
 		RenderableLoadInterval = 3;
+		RenderableLoadThreads = 2;
+		RenderableUploadBudget = 4;
 
 		normals = false;
 	    lit = false;
@@ -905,6 +907,8 @@ namespace Ogre
 
 	    setUint (num_renderables_loading, "NumRenderablesLoading");
 		setUint (RenderableLoadInterval, "RenderableLoadInterval");
+		setUint (RenderableLoadThreads, "RenderableLoadThreads");
+		setUint (RenderableUploadBudget, "RenderableUploadBudget");
 
 	    setUint (max_adjacent_pages, "MaxAdjacentPages");
 	    setUint (max_preload_pages, "MaxPreloadedPages");
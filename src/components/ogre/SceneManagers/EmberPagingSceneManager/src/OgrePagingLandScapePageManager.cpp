@@ -305,7 +305,8 @@ namespace Ogre
       {
         processLoadQueues();		// fill pages queues
         updateLoadedPages();		// fill tiles queues
-        mTerrainReady = mRenderablesMgr->executeRenderableLoading(pos); // load renderables
+        mTerrainReady = mRenderablesMgr->executeRenderableLoading(pos,
+            cam->getDerivedDirection()); // load renderables
       }
   }
   //-----------------------------------------------------------------------
@@ -445,7 +446,7 @@ namespace Ogre
     if (need_touch)
       queuePageNeighbors();
     updateLoadedPages();
-    mRenderablesMgr->executeRenderableLoading(pos);
+    mRenderablesMgr->executeRenderableLoading(pos, cam->getDerivedDirection());
 
     // This Frame has seen a Camera.
     mOnFrame = true;
@@ -38,6 +38,7 @@
 
 #include "OgrePagingLandScapeRenderable.h"
 #include "OgrePagingLandScapeRenderableManager.h"
+#include "OgrePagingLandScapeRenderableBuilder.h"
 
 //caches
 #include "OgrePagingLandScapeIndexBuffer.h"
@@ -56,6 +57,8 @@
 #include <OgreRoot.h>
 #include <OgreRenderSystem.h>
 
+#include <memory>
+
 namespace Ogre
 {
 
@@ -163,6 +166,7 @@ namespace Ogre
         mParent->getOptions()->ScaledPageSizeZ, mLODMorphFactor);
 
     mQueued = false;
+    mLoadGeneration = 0;
     mParentTile = 0;
   }
   //-----------------------------------------------------------------------
@@ -195,6 +199,7 @@ namespace Ogre
     mMaterial.setNull();
     mLightListDirty = true;
     mQueued = false;
+    mLoadGeneration++;
     mParentTile = 0;
     mMinLevelDistSqr = 0;
   }
@@ -204,6 +209,7 @@ namespace Ogre
   {
     mMinLevelDistSqr = 0;
     mQueued = false;
+    mLoadGeneration++;
     mParentTile = 0;
     mLightListDirty = true;
     mInfo = info;
@@ -243,18 +249,22 @@ namespace Ogre
   //-----------------------------------------------------------------------
   bool
   PagingLandScapeRenderable::load()
+  {
+    std::unique_ptr<PagingLandScapeRenderableBuilder> builder(createBuilder());
+    if (!builder.get())
+      return false;
+    PagingLandScapeRenderableStaging staging;
+    builder->build(staging);
+    finishLoad(staging);
+    return true;
+  }
+  //-----------------------------------------------------------------------
+  PagingLandScapeRenderableBuilder*
+  PagingLandScapeRenderable::createBuilder()
   {
     assert(mQueued || mNeedReload);
     assert(mInfo);
 
-    //if (!mInUse)
-    //{
-    // if not in use, do not load.
-    //if (mIsLoaded)
-    //	return true;
-    //else
-    //	return false;
-    //}
     // case renderable was queued before page was unloaded
     // when loaded, page exists no more.
     PagingLandScapeData2D* data =
@@ -262,138 +272,70 @@ namespace Ogre
             mInfo->mPageZ);
     // Page could be unloaded since renderable queued...
     if (data == 0 || !data->isLoaded())
-      return false;
+      return 0;
     mHeightfield = data->getHeightData();
     if (mHeightfield == 0)
-      return false;
-
-    const bool b_lit = mParent->getOptions()->normals;
-
-    const bool b_coverage = mParent->getOptions()->coverage_vertex_color;
-    const bool b_colored = mParent->getOptions()->colored;
+      return 0;
 
-    const Real scale_x = mParent->getOptions()->scale.x;
-    const Real scale_z = mParent->getOptions()->scale.z;
+    PagingLandScapeOptions * const opt = mParent->getOptions();
+    const VertexDeclaration* decl = mCurrVertexes->vertexDeclaration;
+
+    PagingLandScapeRenderableBuilder::Settings settings;
+    settings.tileSize = opt->TileSize;
+    settings.scale = opt->scale;
+    settings.vertexCompression = opt->VertexCompression;
+    settings.normals = opt->normals;
+    settings.lodMorph = opt->lodMorph;
+    settings.roughnessLod = opt->roughnessLod;
+    settings.maxRenderLevel = static_cast<int>(opt->maxRenderLevel);
+    settings.cFactor = opt->CFactor;
+    settings.lodFactor = opt->LOD_factor;
+    settings.uninitializedHeight = opt->uninitializedHeight;
+    settings.vertexSize = decl->getVertexSize(MAIN_BINDING);
+    settings.positionOffset =
+        decl->findElementBySemantic(VES_POSITION)->getOffset();
+    settings.normalOffset =
+        opt->normals ?
+            decl->findElementBySemantic(VES_NORMAL)->getOffset() : 0;
+    // a deformation invalidates any cached LOD distances
+    settings.calculateMinLevelDistSqr = mIsRectModified
+        || mInfo->mMinLevelDistSqr == 0;
+
+    return new PagingLandScapeRenderableBuilder(settings, mHeightfield,
+        data->getSize(), mInfo->mTileX, mInfo->mTileZ);
+  }
+  //-----------------------------------------------------------------------
+  void
+  PagingLandScapeRenderable::finishLoad(
+      const PagingLandScapeRenderableStaging& staging)
+  {
+    assert(mInfo);
+    PagingLandScapeOptions * const opt = mParent->getOptions();
+    const unsigned int tileSize = opt->TileSize;
 
     VertexDeclaration* decl = mCurrVertexes->vertexDeclaration;
     VertexBufferBinding* bind = mCurrVertexes->vertexBufferBinding;
-
-    const VertexElement* poselem = decl->findElementBySemantic(VES_POSITION);
-    const VertexElement* colorelem;
-    if (b_colored)
-      colorelem = decl->findElementBySemantic(VES_DIFFUSE);
-
-    const VertexElement* normelem;
-    if (b_lit)
-      normelem = decl->findElementBySemantic(VES_NORMAL);
-
-    // Calculate the offset in the data 
-    Real min, max;
-    const unsigned int tileSize = mParent->getOptions()->TileSize;
-
-    Image::Box oldrect = mRect;
-    if (!mIsRectModified)
-      {
-        mRect.left = 0;
-        mRect.right = tileSize;
-        mRect.top = 0;
-        mRect.bottom = tileSize;
-
-        // Make sure we get a new min and max
-        min = std::numeric_limits<Real>::max();
-        max = -std::numeric_limits<Real>::max();
-      }
-    else
-      {
-        mRect.right += 1;
-        mRect.bottom += 1;
-
-//            LogManager::getSingleton().logMessage(LML_CRITICAL,
-//                String("PLSM2 : Deformation on tile ") + StringConverter::toString(mInfo->tileX) + ", " + StringConverter::toString(mInfo->tileZ) 
-//                +  " : " + StringConverter::toString(mRect.left) + " - " + StringConverter::toString(mRect.right) 
-//                +  " | " + StringConverter::toString(mRect.top) + " - " + StringConverter::toString(mRect.bottom));
-
-        // Make sure we get a new min and max
-        // only if modified heights exceed current bounds 
-        min = mBounds.getMinimum().y;
-        max = mBounds.getMaximum().y;
-      }
-
-    const unsigned int offSetX = static_cast<unsigned int>(mInfo->mTileX
-        * (tileSize - 1) + mRect.left);
-    const unsigned int endx = static_cast<unsigned int>(offSetX
-        + (mRect.right - mRect.left));
-
-    const unsigned int offSetZ = static_cast<unsigned int>(mInfo->mTileZ
-        * (tileSize - 1) + mRect.top);
-    const unsigned int endz = static_cast<unsigned int>(offSetZ
-        + (mRect.bottom - mRect.top));
-
-    const double inv_scale = 65535.0 / mParent->getOptions()->scale.y;
-
-    const unsigned int pageSize = mParent->getOptions()->PageSize;
-    const Real * const ogre_restrict mheightField = mHeightfield;
-    const bool vs = mParent->getOptions()->VertexCompression;
-
     HardwareVertexBufferSharedPtr vVertices = bind->getBuffer(MAIN_BINDING);
-    const size_t VertexSize = vVertices->getVertexSize();
-    const size_t VertexTileSize = VertexSize * tileSize;
-    uchar* pMain = static_cast<uchar*>(vVertices->lock(
-        VertexTileSize * mRect.top + mRect.left * VertexSize, // offset
-        VertexTileSize * (mRect.bottom - mRect.top)
-            - (tileSize - mRect.right) * VertexSize, //length
-        HardwareBuffer::HBL_DISCARD)); // buffer mode
-
-    // initial up-down shift and left-right shift
-    const Real * const heightField = mheightField + offSetZ * pageSize;
-    unsigned int K_heightFieldPos = 0;
-    for (unsigned int k = offSetZ; k < endz; k++)
-      {
-        // This allow to reuse the variables in the loop
-        const Real k_pos = k * scale_z;
-        uchar *pMainLocal = pMain;
-        for (unsigned int i = offSetX; i < endx; i++)
+    assert(staging.vertices.size() == vVertices->getSizeInBytes());
+
+    if (opt->colored)
+      {
+        // Colours come from the data source, which isn't safe to access from a background thread, so they're filled in here.
+        PagingLandScapeData2D* data =
+            mParent->getSceneManager()->getData2DManager()->getData2D(
+                mInfo->mPageX, mInfo->mPageZ);
+        const VertexElement* colorelem = decl->findElementBySemantic(
+            VES_DIFFUSE);
+        const size_t VertexSize = vVertices->getVertexSize();
+        const unsigned int offSetX = mInfo->mTileX * (tileSize - 1);
+        const unsigned int offSetZ = mInfo->mTileZ * (tileSize - 1);
+        uchar* pMain = const_cast<uchar*>(&staging.vertices[0]);
+        for (unsigned int k = offSetZ; k < offSetZ + tileSize; k++)
           {
-            const Real height = heightField[i + K_heightFieldPos];
-
-            min = std::min<Real>(height, min);
-            max = std::max<Real>(height, max);
-
-            // vertices are relative to the scene node
-            if (vs)
-              {
-                ushort *pPos;
-                poselem->baseVertexPointerToElement(pMainLocal, &pPos);
-                *pPos = static_cast<short>((height * inv_scale) - 32768);	//Y                  
-              }
-            else
-              {
-                float *pPos;
-
-                poselem->baseVertexPointerToElement(pMainLocal, &pPos);
-
-                *pPos++ = static_cast<float>(i * scale_x);	//X
-                *pPos++ = static_cast<float>(height);		//Y
-                *pPos = static_cast<float>(k_pos);	    //Z
-              }
-
-            // normals
-            if (b_lit)
-              {
-                float *pNorm;
-                normelem->baseVertexPointerToElement(pMainLocal, &pNorm);
-
-                const Vector3 norm = data->getNormal(i, k);
-                *pNorm++ = static_cast<float>(norm.x);
-                *pNorm++ = static_cast<float>(norm.y);
-                *pNorm = static_cast<float>(norm.z);
-
-              }
-            if (b_colored)
+            for (unsigned int i = offSetX; i < offSetX + tileSize; i++)
               {
                 ColourValue RGBA_precalc;
-
-                if (b_coverage)
+                if (data && opt->coverage_vertex_color)
                   {
                     RGBA_precalc = data->getCoverage(i, k);
                     Real a1;
@@ -411,43 +353,55 @@ namespace Ogre
                     RGBA_precalc.a = a2;
                   }
                 RGBA *pColor;
-                colorelem->baseVertexPointerToElement(pMainLocal, &pColor);
+                colorelem->baseVertexPointerToElement(pMain, &pColor);
                 Root::getSingleton().convertColourValue(RGBA_precalc, pColor);
+                pMain += VertexSize;
               }
-            pMainLocal += VertexSize;
           }
-        pMain += VertexTileSize;
-        ;
-        K_heightFieldPos += pageSize;
       }
 
-    // Unlock the buffers
-    vVertices->unlock();
-
-    // Calculate the bounding box for this renderable   
-    if (!mIsRectModified)
-      {
-        mBounds.setExtents(offSetX * scale_x, min, offSetZ * scale_z,
-            endx * scale_x, max, endz * scale_z);
-      } // if (!mIsRectModified) 
-    else
-      {
-        const Vector3& maxbound(mBounds.getMaximum());
-        const Vector3& minbound(mBounds.getMinimum());
-        mBounds.setExtents(minbound.x, min, minbound.z, maxbound.x, max,
-            maxbound.z);
-      }
+    vVertices->writeData(0, staging.vertices.size(), &staging.vertices[0],
+        true);
+
+    // Calculate the bounding box for this renderable
+    const unsigned int offSetX = mInfo->mTileX * (tileSize - 1);
+    const unsigned int offSetZ = mInfo->mTileZ * (tileSize - 1);
+    const unsigned int endx = offSetX + tileSize;
+    const unsigned int endz = offSetZ + tileSize;
+    const Real scale_x = opt->scale.x;
+    const Real scale_z = opt->scale.z;
+    const Real min = staging.minHeight;
+    const Real max = staging.maxHeight;
+    mBounds.setExtents(offSetX * scale_x, min, offSetZ * scale_z,
+        endx * scale_x, max, endz * scale_z);
     mBoundingRadius = Math::Sqrt(
         Math::Sqr(max - min) + Math::Sqr((endx - 1 - offSetX) * scale_x)
             + Math::Sqr((endz - 1 - offSetZ) * scale_z)) / 2;
 
-    if (mParent->getOptions()->VisMap)
+    if (opt->VisMap)
       mParent->getSceneManager()->getHorizon()->registerMinMaxHeightTile(mInfo,
           min, max);
 
-    mMinLevelDistSqr = 0;
-    _calculateMinLevelDist2(mParent->getOptions()->CFactor);
-//         getWorldBoundingBox(true);
+    // LOD distances are cached in the tile info, since they only change when the terrain is deformed.
+    if (mInfo->mMinLevelDistSqr == 0)
+      {
+        mInfo->mMinLevelDistSqr = new std::vector<Real>(opt->maxRenderLevel,
+            0.0f);
+      }
+    mMinLevelDistSqr = mInfo->mMinLevelDistSqr;
+    if (staging.hasMinLevelDistSqr)
+      {
+        *mMinLevelDistSqr = staging.minLevelDistSqr;
+      }
+    fillNextLevelDown();
+
+    for (size_t level = 0; level < staging.deltas.size(); ++level)
+      {
+        const std::vector<ushort>& deltas = staging.deltas[level];
+        mDeltaBuffers[level]->writeData(0, deltas.size() * sizeof(ushort),
+            &deltas[0], true);
+      }
+
     if (!mIsLoaded)
       {
         mParent->getSceneManager()->getListenerManager()->fireTileLoaded(
@@ -478,7 +432,6 @@ namespace Ogre
         mIsFrameListener = true;
       }
     //ember addition end
-    return true;
   }
 
   //-----------------------------------------------------------------------
@@ -776,350 +729,6 @@ namespace Ogre
   }
   //-----------------------------------------------------------------------
   void
-  PagingLandScapeRenderable::_calculateMinLevelDist2(const Real C)
-  {
-    //level 0 has no delta.
-    PagingLandScapeOptions * const opt = mParent->getOptions();
-    const bool lodMorph = opt->lodMorph;
-    const bool roughnessLod = opt->roughnessLod;
-
-    float uninitializedHeight = opt->uninitializedHeight;
-
-    bool doComputeMinLevelDistSqr = mIsRectModified;
-    if (mMinLevelDistSqr == 0)
-      {
-        if (mInfo->mMinLevelDistSqr == 0)
-          {
-            mMinLevelDistSqr = new std::vector<Real>();
-            const size_t numLod = mParent->getOptions()->maxRenderLevel;
-            mMinLevelDistSqr->reserve(numLod);
-            mMinLevelDistSqr->resize(numLod);
-            doComputeMinLevelDistSqr = true;
-
-            mInfo->mMinLevelDistSqr = mMinLevelDistSqr;
-          }
-        else
-          {
-            // already computed and in cache.
-            mMinLevelDistSqr = mInfo->mMinLevelDistSqr;
-            fillNextLevelDown();
-
-            if (!doComputeMinLevelDistSqr)
-              {
-                // no deformation modified
-                // no need to recompute it.
-                if (!lodMorph)
-                  {
-                    // already computed and in cache.
-                    // and no lodMorphing...
-                    // so no need to recompute
-                    return;
-                  }
-              }
-          }
-      }
-    if (doComputeMinLevelDistSqr)
-      (*mMinLevelDistSqr)[0] = 0.0f;
-
-    const double inv_scale = 65535.0 / opt->scale.y;
-    //const double scale =  mParent->getOptions ()->scale.y / 65535; 
-
-    const int maxMip = static_cast<int>(opt->maxRenderLevel);
-    const int tilesize = static_cast<int>(opt->TileSize);
-
-    const unsigned int tileSize = opt->TileSize;
-
-// should change if we're just refilling a part
-    if (mIsRectModified)
-      {
-        // until we find a way to adjust the modification rect 
-        // on step size
-
-        // should also refill the vertex map with deformed point 
-        // (BaseHeight)
-        mRect.left = 0;
-        mRect.right = tileSize;
-        mRect.top = 0;
-        mRect.bottom = tileSize;
-
-      } // if (mIsRectModified) 
-
-    const int offSetX = static_cast<int>(mInfo->mTileX * (tileSize - 1)
-        + mRect.left);
-    const int endx = static_cast<int>(offSetX
-        + static_cast<int>(mRect.right - mRect.left));
-
-    const int offSetZ = static_cast<int>(mInfo->mTileZ * (tileSize - 1)
-        + mRect.top);
-    const int IntervallModifiedZ = static_cast<int>(mRect.bottom - mRect.top);
-    const int endz = offSetZ + IntervallModifiedZ;
-
-    const int pageSize = static_cast<int>(opt->PageSize);
-
-    const size_t blendWeights = 2;
-    //const size_t blendWeights = 1;
-    assert(IntervallModifiedZ * tilesize > 0);
-
-    // until we found a way to upload part of the data.
-    assert(IntervallModifiedZ == tilesize);
-
-    const size_t size = blendWeights * IntervallModifiedZ * tilesize;
-    const size_t buffsize = size * sizeof(ushort); //  sizeof(Real); 
-
-    int K_heightFieldPos;
-    ushort *BaseHeight = 0;
-    //Real *BaseHeight = 0;
-    int i, j;
-
-    const Real * const ogre_restrict heightField = mHeightfield
-        + offSetZ * pageSize;
-    if (lodMorph) // &&  mIsRectModified))
-      {
-        BaseHeight = new ushort[size];
-        //BaseHeight = new Real [size];
-        K_heightFieldPos = 0;
-        int k = 0;
-        for (j = offSetZ; j < endz; j++)
-          {
-// should change if we're just refilling a part to whole tile (only if using discard, tough)
-            for (i = offSetX; i < endx; i++)
-              {
-                // Save height    
-                assert(k < static_cast<int> (size));
-                BaseHeight[k] = static_cast<short>((heightField[i
-                    + K_heightFieldPos] * inv_scale) - 32768);
-
-                //BaseHeight[k] =  static_cast<Real> 
-                //(mheightField[ i + K_heightFieldPos]);
-
-                // should change if we're just refilling a part to whole tile, using a 
-                //k += tilesize - IntervalleZ;
-                k += blendWeights;
-
-              }
-            // should change if we're just refilling a part to whole tile, using a 
-            //k += tilesize - IntervalleX;
-            K_heightFieldPos += pageSize;
-          }
-      }
-    //const ushort * const heightField = BaseHeight;
-    //const Real * const heightField = BaseHeight;
-
-    Plane t1, t2;
-    const Real Csqr = C * C;
-    for (int level = 1; level < maxMip; level++)
-      {
-        ushort *pDeltaInit = 0;
-        //Real *pDeltaInit = 0;
-        if (BaseHeight)
-          {
-            const size_t lvl_minus_one = level - 1;
-
-            // Create a set of delta values (store at index - 1 since 0 has none)
-
-// should change to an interval locking (as in load) ? if we're just refilling a part to whole tile 
-            pDeltaInit =
-                static_cast<ushort*>(mDeltaBuffers[lvl_minus_one]->lock(
-                    HardwareBuffer::HBL_DISCARD));
-
-            memcpy(pDeltaInit, BaseHeight, buffsize);
-            assert(pDeltaInit);
-          } // if (BaseHeight)
-
-        ushort * const pDeltas = pDeltaInit;
-// should keep previous change in case of partial tile refilling ?
-// But how could we lower value ? (if terrain goes smoother)
-        if (doComputeMinLevelDistSqr)
-          (*mMinLevelDistSqr)[level] = 0.0f;
-
-        const int step = 1 << level;
-
-// find a way to take a good step end and start 
-// even with offset that would make us in "middle of a step"
-        const int tilesizeMinusstepZ = endz - step;
-        const int tilesizeMinusstepX = endx - step;
-        const Real invStep = 1.0f / step;
-
-        K_heightFieldPos = 0;
-        const int ZShift = step * pageSize;
-
-        for (j = offSetZ; j < tilesizeMinusstepZ; j += step)
-          {
-            for (i = offSetX; i < tilesizeMinusstepX; i += step)
-              {
-                //added for Ember
-                bool isInValidVertex;
-                  {
-                    const Vector3 v1(i, heightField[i + K_heightFieldPos], j);
-                    const Vector3 v2(i + step,
-                        heightField[i + step + K_heightFieldPos], j);
-                    const Vector3 v3(i,
-                        heightField[i + K_heightFieldPos + ZShift], j + step);
-                    const Vector3 v4(i + step,
-                        heightField[i + step + K_heightFieldPos + ZShift],
-                        j + step);
-
-                    t1.redefine(v1, v3, v2);
-                    t2.redefine(v2, v3, v4);
-                    //only update the distance if none of the heights are -1.0
-                    //this is to allow for invalid Mercator::Segments without messing up the tricount
-                    //the reason is that Ember will set the height for all invalid segments to -1
-                    //if such a segment was to be next to a normal segment, the delta would be way to high, 
-                    //resulting in a tile which was always in LOD 0
-                    isInValidVertex = v1.y == uninitializedHeight
-                        || v2.y == uninitializedHeight
-                        || v3.y == uninitializedHeight
-                        || v4.y == uninitializedHeight;
-                  }
-
-                if (!isInValidVertex)
-                  {
-                    // include the bottommost row of vertices if this is the last row
-                    const int zubound = (
-                        j == (tilesizeMinusstepZ) ? step : step - 1);
-                    for (int z = 0; z <= zubound; z++)
-                      {
-                        const int fulldetailz = j + z;
-                        const Real zpct = z * invStep;
-                        const bool isFullDetailZ = (fulldetailz % step == 0);
-                        const int zPageSize = z * pageSize;
-                          {
-                            // include the rightmost col of vertices if this is the last col
-                            const int xubound = (
-                                i == (tilesizeMinusstepX) ? step : step - 1);
-                            for (int x = 0; x <= xubound; x++)
-                              {
-                                const int fulldetailx = i + x;
-
-                                if (isFullDetailZ && fulldetailx % step == 0)
-                                  {
-                                    // Skip, this one is a vertex at this level
-                                    continue;
-                                  }
-                                const Real xpct = x * invStep;
-
-                                //interpolated height                           
-                                Real interp_h;
-                                // Determine which triangle we're on 
-                                if (xpct + zpct <= 1.0f)
-                                  {
-                                    // Solve for x/z
-                                    interp_h = (-(t1.normal.x * fulldetailx)
-                                        - t1.normal.z * fulldetailz - t1.d)
-                                        / t1.normal.y;
-                                  }
-                                else
-                                  {
-                                    // Second triangle
-                                    interp_h = (-(t2.normal.x * fulldetailx)
-                                        - t2.normal.z * fulldetailz - t2.d)
-                                        / t2.normal.y;
-                                  }
-
-                                assert(
-                                    (fulldetailx + K_heightFieldPos + zPageSize) < (pageSize*pageSize));
-
-                                const Real actual_h = heightField[fulldetailx
-                                    + K_heightFieldPos + zPageSize];
-                                const Real delta = interp_h - actual_h;
-                                if (doComputeMinLevelDistSqr)
-                                  {
-                                    // need to recompute it.
-                                    const Real D2 =
-                                        (roughnessLod) ?
-                                            delta * delta * Csqr : Csqr;
-
-                                    if ((*mMinLevelDistSqr)[level] < D2)
-                                      (*mMinLevelDistSqr)[level] = D2;
-                                  }
-
-                                // Should be save height difference?
-                                // Don't morph along edges
-                                if (lodMorph)
-                                  {
-                                    // Save height difference                    
-                                    if (delta != 0.0f)
-                                      {
-                                        const int tileposx = fulldetailx
-                                            - offSetX;
-                                        const int tileposy = fulldetailz
-                                            - offSetZ;
-
-                                        if (tileposx != 0
-                                            && tileposx != (tilesize - 1)
-                                            && tileposy != 0
-                                            && tileposy != (tilesize - 1))
-                                          {
-
-                                            assert(
-                                                (tileposx + (tileposy * tilesize))*blendWeights < size);
-
-                                            pDeltas[(tileposx
-                                                + (tileposy * tilesize))
-                                                * blendWeights] =
-                                                static_cast<short>((interp_h
-                                                    * inv_scale) - 32768);
-                                            //                                        pDeltas[(tileposx + (tileposy * tilesize))*blendWeights] =  
-                                            //                                            interp_h; 
-                                          }
-                                      }
-                                  }
-                              }
-
-                          }
-                      }
-                  }
-              }
-            K_heightFieldPos += pageSize * step;
-          }
-
-        // Unlock morph deltas if required
-        if (lodMorph)
-          mDeltaBuffers[level - 1]->unlock();
-      }
-    // delete Height Data cache and Buffer initial value.
-    delete[] BaseHeight;
-
-    if (doComputeMinLevelDistSqr)
-      {
-        if (roughnessLod)
-          {
-            // Post validate the whole set
-            for (i = 1; i < maxMip; i++)
-              {
-
-                // Make sure no LOD transition within the tile
-                // This is especially a problem when using large tiles with flat areas
-
-                /* Hmm, this can look bad on some areas, disable for now
-                 Vector3 delta(_vertex(0,0,0), mCenter.y, _vertex(0,0,2));
-                 delta = delta - mCenter;
-                 Real minDist = delta.squaredLength();
-                 mMinLevelDistSqr[ i ] = std::max(mMinLevelDistSqr[ i ], minDist);
-                 */
-
-                //make sure the levels are increasing...
-                if ((*mMinLevelDistSqr)[i] < (*mMinLevelDistSqr)[i - 1])
-                  (*mMinLevelDistSqr)[i] = (*mMinLevelDistSqr)[i - 1];
-              }
-          }
-        else
-          {
-            const int maxMip =
-                static_cast<int>(mParent->getOptions()->maxRenderLevel) - 1;
-            Real distanceLod = mParent->getOptions()->LOD_factor;
-            for (int level = 1; level < maxMip; level++)
-              {
-                (*mMinLevelDistSqr)[level] = distanceLod;
-                distanceLod *= 2;
-
-              }
-          }
-        fillNextLevelDown();
-      }
-  }
-  //-----------------------------------------------------------------------
-  void
   PagingLandScapeRenderable::fillNextLevelDown(void)
   {
     // reverse traverse the mMinLevelDistSqr list in order to set
@@ -0,0 +1,290 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "OgrePagingLandScapePrecompiledHeaders.h"
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "OgrePagingLandScapeRenderableBuilder.h"
+#include "OgrePagingLandScapeRenderable.h"
+#include "OgrePagingLandScapeRenderableManager.h"
+
+#include <OgrePlane.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace Ogre
+{
+
+namespace
+{
+/**
+ * @brief The number of values per vertex in the delta buffers (VET_SHORT2).
+ */
+const size_t BLEND_WEIGHTS = 2;
+}
+
+PagingLandScapeRenderableBuilder::PagingLandScapeRenderableBuilder(const Settings& settings, const Real* heightData, size_t pageSize, unsigned int tileX, unsigned int tileZ) :
+		mSettings(settings), mPageSize(pageSize)
+{
+	const int tileSize = static_cast<int>(mSettings.tileSize);
+	const int lastSample = static_cast<int>(pageSize) - 1;
+	mOffsetX = static_cast<int>(tileX) * (tileSize - 1);
+	mOffsetZ = static_cast<int>(tileZ) * (tileSize - 1);
+
+	mRegionX = std::max(mOffsetX - 1, 0);
+	mRegionZ = std::max(mOffsetZ - 1, 0);
+	const int regionEndX = std::min(mOffsetX + tileSize, lastSample);
+	const int regionEndZ = std::min(mOffsetZ + tileSize, lastSample);
+	mRegionWidth = regionEndX - mRegionX + 1;
+
+	mHeights.resize(mRegionWidth * (regionEndZ - mRegionZ + 1));
+	Real* destination = &mHeights[0];
+	for (int z = mRegionZ; z <= regionEndZ; ++z) {
+		const Real* source = heightData + (z * pageSize) + mRegionX;
+		std::copy(source, source + mRegionWidth, destination);
+		destination += mRegionWidth;
+	}
+}
+
+Real PagingLandScapeRenderableBuilder::getHeight(int x, int z) const
+{
+	return mHeights[(z - mRegionZ) * mRegionWidth + (x - mRegionX)];
+}
+
+Vector3 PagingLandScapeRenderableBuilder::getNormal(int x, int z) const
+{
+	//At the edges of the page the sample itself is used in place of the missing neighbour.
+	const int lastSample = static_cast<int>(mPageSize) - 1;
+	const Real divider = static_cast<Real>(lastSample) / mSettings.scale.y;
+	const int left = x > 0 ? x - 1 : x;
+	const int right = x < lastSample ? x + 1 : x;
+	const int up = z > 0 ? z - 1 : z;
+	const int down = z < lastSample ? z + 1 : z;
+
+	Vector3 result((getHeight(left, z) - getHeight(right, z)) * divider, 2.0f, (getHeight(x, up) - getHeight(x, down)) * divider);
+	result.normalise();
+	return result;
+}
+
+void PagingLandScapeRenderableBuilder::build(PagingLandScapeRenderableStaging& staging) const
+{
+	buildVertices(staging);
+	buildLevels(staging);
+}
+
+void PagingLandScapeRenderableBuilder::buildVertices(PagingLandScapeRenderableStaging& staging) const
+{
+	const int tileSize = static_cast<int>(mSettings.tileSize);
+	const double inv_scale = 65535.0 / mSettings.scale.y;
+
+	staging.vertices.assign(mSettings.vertexSize * tileSize * tileSize, 0);
+	staging.minHeight = std::numeric_limits<Real>::max();
+	staging.maxHeight = -std::numeric_limits<Real>::max();
+
+	uchar* pMain = &staging.vertices[0];
+	for (int k = mOffsetZ; k < mOffsetZ + tileSize; k++) {
+		const Real k_pos = k * mSettings.scale.z;
+		for (int i = mOffsetX; i < mOffsetX + tileSize; i++) {
+			const Real height = getHeight(i, k);
+
+			staging.minHeight = std::min<Real>(height, staging.minHeight);
+			staging.maxHeight = std::max<Real>(height, staging.maxHeight);
+
+			// vertices are relative to the scene node
+			if (mSettings.vertexCompression) {
+				ushort* pPos = reinterpret_cast<ushort*>(pMain + mSettings.positionOffset);
+				*pPos = static_cast<short>((height * inv_scale) - 32768); //Y
+			} else {
+				float* pPos = reinterpret_cast<float*>(pMain + mSettings.positionOffset);
+				*pPos++ = static_cast<float>(i * mSettings.scale.x); //X
+				*pPos++ = static_cast<float>(height); //Y
+				*pPos = static_cast<float>(k_pos); //Z
+			}
+
+			if (mSettings.normals) {
+				float* pNorm = reinterpret_cast<float*>(pMain + mSettings.normalOffset);
+				const Vector3 norm = getNormal(i, k);
+				*pNorm++ = static_cast<float>(norm.x);
+				*pNorm++ = static_cast<float>(norm.y);
+				*pNorm = static_cast<float>(norm.z);
+			}
+			pMain += mSettings.vertexSize;
+		}
+	}
+}
+
+void PagingLandScapeRenderableBuilder::buildLevels(PagingLandScapeRenderableStaging& staging) const
+{
+	const bool lodMorph = mSettings.lodMorph;
+	const bool calculate = mSettings.calculateMinLevelDistSqr;
+	staging.hasMinLevelDistSqr = calculate;
+	if (!lodMorph && !calculate) {
+		// the distances are already cached and there are no deltas to fill, so there's nothing to do
+		return;
+	}
+
+	const double inv_scale = 65535.0 / mSettings.scale.y;
+	const int maxMip = mSettings.maxRenderLevel;
+	const int tilesize = static_cast<int>(mSettings.tileSize);
+	const int endx = mOffsetX + tilesize;
+	const int endz = mOffsetZ + tilesize;
+	const size_t size = BLEND_WEIGHTS * tilesize * tilesize;
+
+	if (calculate) {
+		staging.minLevelDistSqr.assign(maxMip, 0.0f);
+	}
+
+	std::vector<ushort> baseHeight;
+	if (lodMorph) {
+		baseHeight.resize(size, 0);
+		size_t k = 0;
+		for (int j = mOffsetZ; j < endz; j++) {
+			for (int i = mOffsetX; i < endx; i++) {
+				// Save height
+				baseHeight[k] = static_cast<short>((getHeight(i, j) * inv_scale) - 32768);
+				k += BLEND_WEIGHTS;
+			}
+		}
+		staging.deltas.resize(maxMip - 1);
+	}
+
+	Plane t1, t2;
+	const Real Csqr = mSettings.cFactor * mSettings.cFactor;
+	for (int level = 1; level < maxMip; level++) {
+		ushort* pDeltas = 0;
+		if (lodMorph) {
+			// Create a set of delta values (store at index - 1 since 0 has none)
+			staging.deltas[level - 1] = baseHeight;
+			pDeltas = &staging.deltas[level - 1][0];
+		}
+
+		const int step = 1 << level;
+		const int tilesizeMinusstepZ = endz - step;
+		const int tilesizeMinusstepX = endx - step;
+		const Real invStep = 1.0f / step;
+
+		for (int j = mOffsetZ; j < tilesizeMinusstepZ; j += step) {
+			for (int i = mOffsetX; i < tilesizeMinusstepX; i += step) {
+				const Vector3 v1(i, getHeight(i, j), j);
+				const Vector3 v2(i + step, getHeight(i + step, j), j);
+				const Vector3 v3(i, getHeight(i, j + step), j + step);
+				const Vector3 v4(i + step, getHeight(i + step, j + step), j + step);
+
+				t1.redefine(v1, v3, v2);
+				t2.redefine(v2, v3, v4);
+				//Ember sets the height of all invalid segments to the uninitialized height. If such a segment was next to a normal one the delta would be way too high, resulting in a tile which always was in LOD 0, so they're skipped.
+				if (v1.y == mSettings.uninitializedHeight || v2.y == mSettings.uninitializedHeight || v3.y == mSettings.uninitializedHeight || v4.y == mSettings.uninitializedHeight) {
+					continue;
+				}
+
+				// include the bottommost row of vertices if this is the last row
+				const int zubound = (j == tilesizeMinusstepZ ? step : step - 1);
+				for (int z = 0; z <= zubound; z++) {
+					const int fulldetailz = j + z;
+					const Real zpct = z * invStep;
+					const bool isFullDetailZ = (fulldetailz % step == 0);
+					// include the rightmost col of vertices if this is the last col
+					const int xubound = (i == tilesizeMinusstepX ? step : step - 1);
+					for (int x = 0; x <= xubound; x++) {
+						const int fulldetailx = i + x;
+
+						if (isFullDetailZ && fulldetailx % step == 0) {
+							// Skip, this one is a vertex at this level
+							continue;
+						}
+						const Real xpct = x * invStep;
+
+						//interpolated height
+						Real interp_h;
+						// Determine which triangle we're on
+						if (xpct + zpct <= 1.0f) {
+							// Solve for x/z
+							interp_h = (-(t1.normal.x * fulldetailx) - t1.normal.z * fulldetailz - t1.d) / t1.normal.y;
+						} else {
+							// Second triangle
+							interp_h = (-(t2.normal.x * fulldetailx) - t2.normal.z * fulldetailz - t2.d) / t2.normal.y;
+						}
+
+						const Real actual_h = getHeight(fulldetailx, fulldetailz);
+						const Real delta = interp_h - actual_h;
+						if (calculate) {
+							const Real D2 = mSettings.roughnessLod ? delta * delta * Csqr : Csqr;
+							if (staging.minLevelDistSqr[level] < D2) {
+								staging.minLevelDistSqr[level] = D2;
+							}
+						}
+
+						// Don't morph along edges
+						if (lodMorph && delta != 0.0f) {
+							const int tileposx = fulldetailx - mOffsetX;
+							const int tileposy = fulldetailz - mOffsetZ;
+
+							if (tileposx != 0 && tileposx != (tilesize - 1) && tileposy != 0 && tileposy != (tilesize - 1)) {
+								assert((tileposx + (tileposy * tilesize)) * BLEND_WEIGHTS < size);
+								pDeltas[(tileposx + (tileposy * tilesize)) * BLEND_WEIGHTS] = static_cast<short>((interp_h * inv_scale) - 32768);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if (calculate) {
+		if (mSettings.roughnessLod) {
+			//make sure the levels are increasing...
+			for (int i = 1; i < maxMip; i++) {
+				if (staging.minLevelDistSqr[i] < staging.minLevelDistSqr[i - 1]) {
+					staging.minLevelDistSqr[i] = staging.minLevelDistSqr[i - 1];
+				}
+			}
+		} else {
+			Real distanceLod = mSettings.lodFactor;
+			for (int level = 1; level < maxMip - 1; level++) {
+				staging.minLevelDistSqr[level] = distanceLod;
+				distanceLod *= 2;
+			}
+		}
+	}
+}
+
+PagingLandScapeRenderableLoadTask::PagingLandScapeRenderableLoadTask(PagingLandScapeRenderableManager& manager, PagingLandScapeRenderable* renderable, PagingLandScapeRenderableBuilder* builder) :
+		mManager(manager), mRenderable(renderable), mGeneration(renderable->mLoadGeneration), mEpoch(manager.getLoadEpoch()), mBuilder(builder)
+{
+}
+
+PagingLandScapeRenderableLoadTask::~PagingLandScapeRenderableLoadTask()
+{
+}
+
+void PagingLandScapeRenderableLoadTask::executeTaskInBackgroundThread(Ember::Tasks::TaskExecutionContext& context)
+{
+	mBuilder->build(mStaging);
+	mBuilder.reset();
+}
+
+void PagingLandScapeRenderableLoadTask::executeTaskInMainThread()
+{
+	mManager._renderableBuilt(mRenderable, mGeneration, mEpoch, mStaging);
+}
+
+}
@@ -38,6 +38,12 @@
 #include "OgrePagingLandScapeRenderableManager.h"
 
 #include "OgrePagingLandScapeTile.h"
+#include "OgrePagingLandScapeRenderableBuilder.h"
+
+#include "framework/tasks/TaskQueue.h"
+#include "framework/TimeFrame.h"
+
+#include <algorithm>
 
 namespace Ogre
 {
@@ -63,7 +69,8 @@ namespace Ogre
   PagingLandScapeRenderableManager::PagingLandScapeRenderableManager(
       PagingLandScapeSceneManager * scnMgr) :
       mSceneManager(scnMgr), mOptions(scnMgr->getOptions()), mRenderableLoadInterval(
-          0), mLoadInterval(0), mNumRenderableLoading(0)
+          0), mLoadInterval(0), mNumRenderableLoading(0), mNumLoadsInProgress(
+          0), mLoadEpoch(0)
   {
     // auto extend ourself as we rather check 
     //if we can found non Freed Renderables before
@@ -74,6 +81,9 @@ namespace Ogre
   //-----------------------------------------------------------------------
   PagingLandScapeRenderableManager::~PagingLandScapeRenderableManager()
   {
+    // Any loads still in progress will be handed back when the queue is destroyed; make sure they're discarded.
+    mLoadEpoch++;
+    mTaskQueue.reset();
     mRenderablePool.deletePool();
   }
   //-----------------------------------------------------------------------
@@ -90,6 +100,9 @@ namespace Ogre
           }
         assert(mTilesLoadRenderableQueue.empty ());
       }
+    // Discard any loads in progress, since the renderables they refer to are going away.
+    mLoadEpoch++;
+    mNumLoadsInProgress = 0;
     // As Renderables change too much over maps (+- lit, normals, etc...)
     mRenderablePool.deletePool();
   }
@@ -106,6 +119,21 @@ namespace Ogre
     mRenderableLoadInterval = opt->RenderableLoadInterval;
     mRenderablePool.setPoolSize(opt->num_renderables);
     mTilesLoadRenderableQueue.clear();
+
+    if (opt->RenderableLoadThreads > 0)
+      {
+        if (!mTaskQueue.get())
+          {
+            mTaskQueue.reset(
+                new Ember::Tasks::TaskQueue(opt->RenderableLoadThreads));
+          }
+      }
+    else
+      {
+        mLoadEpoch++;
+        mNumLoadsInProgress = 0;
+        mTaskQueue.reset();
+      }
   }
   //-----------------------------------------------------------------------
   PagingLandScapeRenderable *
@@ -152,6 +180,7 @@ namespace Ogre
     //
     tile->setLoading(true);
     tile->getRenderable()->mQueued = true;
+    tile->getRenderable()->mLoadGeneration++;
 
     //
     mTilesLoadRenderableQueue.push(tile);
@@ -172,6 +201,8 @@ namespace Ogre
     //
     tile->setLoading(false);
     tile->getRenderable()->mQueued = false;
+    // discard any background load in progress
+    tile->getRenderable()->mLoadGeneration++;
 
     //
     mTilesLoadRenderableQueue.remove(tile);
@@ -215,21 +246,38 @@ namespace Ogre
   //-----------------------------------------------------------------------
   bool
   PagingLandScapeRenderableManager::executeRenderableLoading(
-      const Vector3 &Cameraposition)
+      const Vector3 &Cameraposition, const Vector3 &CameraDirection)
   {
+    if (mTaskQueue.get())
+      {
+        // upload whatever has been generated since last time
+        mTaskQueue->pollProcessedTasks(
+            Ember::TimeFrame(
+                boost::posix_time::milliseconds(
+                    mOptions->RenderableUploadBudget)));
+      }
     if (mTilesLoadRenderableQueue.empty())
       {
-        return true;
+        return mNumLoadsInProgress == 0;
       }
     else
       {
         if (mLoadInterval-- < 0)
           {
             const size_t queueSize = mTilesLoadRenderableQueue.getSize();
-            mTilesLoadRenderableQueue.sortNearest(Cameraposition);
-            const size_t k =
+            mTilesLoadRenderableQueue.sortByPriority(Cameraposition,
+                CameraDirection);
+            size_t k =
                 mNumRenderableLoading > queueSize ?
                     queueSize : mNumRenderableLoading;
+            if (mTaskQueue.get())
+              {
+                // don't let the workers fall too far behind, or the queue can't be reprioritised as the camera moves
+                const size_t maxLoadsInProgress = mNumRenderableLoading * 2;
+                k = std::min(k,
+                    maxLoadsInProgress > mNumLoadsInProgress ?
+                        maxLoadsInProgress - mNumLoadsInProgress : 0);
+              }
             for (size_t i = 0; i < k; i++)
               {
 
@@ -245,31 +293,86 @@ namespace Ogre
                 assert(rend->mParentTile == tile);
                 assert(rend->mQueued);
                 assert(!rend->isLoaded ());
-                SceneNode * const tileSceneNode = tile->getSceneNode();
-                assert(tileSceneNode != 0);
+                assert(tile->getSceneNode() != 0);
 
-                // if renderable can be loaded 
-                if (rend->load())
+                if (mTaskQueue.get())
                   {
-                    tileSceneNode->attachObject(rend);
-                    tile->_linkRenderableNeighbor();
+                    // the tile stays in the loading state until the task is done
+                    PagingLandScapeRenderableBuilder* builder =
+                        rend->createBuilder();
+                    if (builder)
+                      {
+                        mTaskQueue->enqueueTask(
+                            new PagingLandScapeRenderableLoadTask(*this, rend,
+                                builder));
+                        mNumLoadsInProgress++;
+                      }
+                    else
+                      {
+                        // (no data yet.) empty tile.
+                        finishRenderableLoading(tile, false);
+                      }
                   }
                 else
                   {
-                    // (no data yet.) empty tile.
-                    tile->unload();
+                    finishRenderableLoading(tile, rend->load());
                   }
-
-                tile->setLoading(false);
-                rend->mQueued = false;
-
-                tileSceneNode->needUpdate();
               }
             mLoadInterval = mRenderableLoadInterval;
           }
       }
     return false;
   }
+  //-----------------------------------------------------------------------
+  void
+  PagingLandScapeRenderableManager::_renderableBuilt(
+      PagingLandScapeRenderable* rend, unsigned int generation,
+      unsigned int epoch, const PagingLandScapeRenderableStaging& staging)
+  {
+    if (epoch != mLoadEpoch)
+      {
+        return;
+      }
+    assert(mNumLoadsInProgress > 0);
+    mNumLoadsInProgress--;
+    // if the tile was unloaded or requeued while loading the data is stale
+    if (rend->mLoadGeneration != generation || !rend->mQueued)
+      {
+        return;
+      }
+    PagingLandScapeTile * const tile = rend->mParentTile;
+    assert(tile != 0);
+    assert(tile->isLoading());
+    assert(!rend->isLoaded ());
+
+    rend->finishLoad(staging);
+    finishRenderableLoading(tile, true);
+  }
+  //-----------------------------------------------------------------------
+  void
+  PagingLandScapeRenderableManager::finishRenderableLoading(
+      PagingLandScapeTile* tile, bool loaded)
+  {
+    PagingLandScapeRenderable * const rend = tile->getRenderable();
+    SceneNode * const tileSceneNode = tile->getSceneNode();
+
+    // if renderable could be loaded
+    if (loaded)
+      {
+        tileSceneNode->attachObject(rend);
+        tile->_linkRenderableNeighbor();
+      }
+    else
+      {
+        // (no data yet.) empty tile.
+        tile->unload();
+      }
+
+    tile->setLoading(false);
+    rend->mQueued = false;
+
+    tileSceneNode->needUpdate();
+  }
 
   //-----------------------------------------------------------------------
   size_t
@@ -290,7 +393,7 @@ namespace Ogre
   size_t
   PagingLandScapeRenderableManager::numLoading(void) const
   {
-    return mTilesLoadRenderableQueue.getSize();
+    return mTilesLoadRenderableQueue.getSize() + mNumLoadsInProgress;
   }
   //-----------------------------------------------------------------------
   void
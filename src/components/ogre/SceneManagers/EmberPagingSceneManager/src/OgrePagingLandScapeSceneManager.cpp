@@ -34,6 +34,7 @@
 #include "OgrePagingLandScapeOptions.h"
 #include "OgrePagingLandScapeCamera.h"
 #include "OgrePagingLandScapeData2DManager.h"
+#include "OgrePagingLandScapeData2D.h"
 #include "OgrePagingLandScapeRenderableManager.h"
 #include "OgrePagingLandScapeTextureCoordMan.h"
 #include "OgrePagingLandScapeRenderable.h"
@@ -420,107 +421,121 @@ namespace Ogre
                                                                 const Ogre::Vector3 & raydir, 
                                                                 Ogre::Vector3 * rayresult)
     {
-        Ogre::Vector3 raystart (raybegin);
 		assert (mPageManager && mData2DManager);
 
+		*rayresult = Ogre::Vector3(-1.0f, -1.0f, -1.0f);
+
+		const Ogre::Real W = mOptions->maxScaledX;
+		const Ogre::Real H = mOptions->maxScaledZ;
 		const Ogre::Real maxHeight = mData2DManager->getMaxHeight ();
-		
-		if (raystart.y > maxHeight)
+		if (W == 0 || H == 0 || raydir == Ogre::Vector3::ZERO)
 		{
-			// find an new ray start that is under highest terrain height
-			// so that we do not test intersection between terrain and ray
-			// on ray part where Y > maxHeight
+			return false;
+		}
 
-			// First check if not parallel to terrain
-			if (Math::Abs(raydir.y) < std::numeric_limits<Real>::epsilon())
+		#ifdef _STRICT_LandScape
+			// if you don't want to be able to intersect from a point outside the canvas
+			if (raybegin.x < -W || raybegin.x > W || raybegin.z < -H || raybegin.z > H)
 			{
-				// Parallel ?
-				*rayresult = Ogre::Vector3(-1.0f, -1.0f, -1.0f);
 				return false;
 			}
-			// now ray should begin at a pertinent place.
-			const Ogre::Real t = -(raystart.y-maxHeight)/raydir.y;
-			raystart += raydir*t;
-			if (raystart.y <= mData2DManager->getInterpolatedWorldHeight(raystart.x, raystart.z))
+		#endif //_STRICT_LandScape
+
+		// Clip the ray to the part which is within the bounds of the landscape and 
+		// under the highest terrain height. There's no lower bound, since terrain 
+		// can go below zero.
+		Ogre::Real tMin = 0.0f;
+		Ogre::Real tMax = std::numeric_limits<Ogre::Real>::max();
+		const Ogre::Real lower[3] = {-W, -std::numeric_limits<Ogre::Real>::max(), -H};
+		const Ogre::Real upper[3] = {W, maxHeight, H};
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (Math::Abs(raydir[axis]) < std::numeric_limits<Real>::epsilon())
 			{
-				*rayresult = raystart;
-				return true;
-			}
-		} 
-
-        PagingLandScapeTile * t = mPageManager->getTile (raystart.x, raystart.z, false);
-        if (t == 0)
-        {
-            // we're outside LandScape
-            #ifndef _STRICT_LandScape
-                // if you want to be able to intersect from a point outside the canvas
-                //const int pageSize = mOptions->PageSize - 1;
-                const Ogre::Real W = mOptions->maxScaledX;
-                const Ogre::Real H = mOptions->maxScaledZ;
-                const Ogre::Real maxHeight = mData2DManager->getMaxHeight ();
-                
-                if (W != 0 && H != 0) {
-					// while ray is outside but raydir going inside
-					while ((raystart.y < 0.0f && raydir.y > 0.0f) || 
-							(raystart.y > maxHeight && raydir.y < 0.0f) || 
-	
-							(raystart.x < -W && raydir.x > 0.0f) || 
-							(raystart.x > W  && raydir.x < 0.0f) || 
-	
-							(raystart.z < -H && raydir.z > 0.0f) || 
-							(raystart.z > H  && raydir.z < 0.0f)) 
-						raystart += raydir;
+				// Parallel ?
+				if (raybegin[axis] < lower[axis] || raybegin[axis] > upper[axis])
+				{
+					return false;
 				}
+				continue;
+			}
+			Ogre::Real t1 = (lower[axis] - raybegin[axis]) / raydir[axis];
+			Ogre::Real t2 = (upper[axis] - raybegin[axis]) / raydir[axis];
+			if (t1 > t2)
+			{
+				std::swap(t1, t2);
+			}
+			tMin = std::max(tMin, t1);
+			tMax = std::min(tMax, t2);
+			if (tMin > tMax)
+			{
+				return false;
+			}
+		}
 
-                if (raystart.y < 0.0f || raystart.y >= maxHeight ||
-                    raystart.x < -W || raystart.x > W  || 
-                    raystart.z < -H || raystart.z > H)
-                {
-                    *rayresult = Ogre::Vector3(-1.0f, -1.0f, -1.0f);
-                    return false;
-                }
-                t = mPageManager->getTile (raystart.x, raystart.z, false);
-                if (t == 0)
-                    return false;
-            #else //_STRICT_LandScape
-                // if you don't want to be able to intersect from a point outside the canvas
-                *rayresult = Ogre::Vector3(-1.0f, -1.0f, -1.0f);
-                return false;
-            #endif //_STRICT_LandScape
-        }
-
-        bool impact;
+		// Walk through the pages the ray passes over, in order, and let the height 
+		// pyramid of each page find the exact hit, if any. The walk is done in 
+		// page units, where page (i, j) covers [i, i + 1] x [j, j + 1].
+		const Ogre::Real pageSize = static_cast<Ogre::Real> (mOptions->PageSize - 1);
+		const Ogre::Real u0 = (raybegin.x * mOptions->invScale.x + mOptions->maxUnScaledX) / pageSize;
+		const Ogre::Real w0 = (raybegin.z * mOptions->invScale.z + mOptions->maxUnScaledZ) / pageSize;
+		const Ogre::Real du = (raydir.x * mOptions->invScale.x) / pageSize;
+		const Ogre::Real dw = (raydir.z * mOptions->invScale.z) / pageSize;
+
+		const int lastPageX = static_cast<int> (mOptions->world_width) - 1;
+		const int lastPageZ = static_cast<int> (mOptions->world_height) - 1;
+		int pageX = std::min(std::max(static_cast<int> (Math::Floor(u0 + du * tMin)), 0), lastPageX);
+		int pageZ = std::min(std::max(static_cast<int> (Math::Floor(w0 + dw * tMin)), 0), lastPageZ);
+
+		const int stepX = du > 0 ? 1 : -1;
+		const int stepZ = dw > 0 ? 1 : -1;
+		Ogre::Real tNextX = std::numeric_limits<Ogre::Real>::max();
+		Ogre::Real tNextZ = std::numeric_limits<Ogre::Real>::max();
+		if (du != 0)
+		{
+			tNextX = (static_cast<Ogre::Real> (du > 0 ? pageX + 1 : pageX) - u0) / du;
+		}
+		if (dw != 0)
+		{
+			tNextZ = (static_cast<Ogre::Real> (dw > 0 ? pageZ + 1 : pageZ) - w0) / dw;
+		}
 
+		Ogre::Real pageEnter = tMin;
+		while (true)
+		{
+			const Ogre::Real pageExit = std::min(std::min(tNextX, tNextZ), tMax);
 
-        //special case...
-//         if (raydir.x == 0.0f && raydir.z == 0.0f)
-//         {
-//             if (raystart.y <=  mData2DManager->getInterpolatedWorldHeight(raystart.x, raystart.z))
-//             {
-//                 *rayresult = raystart;
-//                 impact = true;
-//             }
-//             impact = false;
-//         }      
-//         else
-        {
-			// should we scale ?
-// 			const Ogre::Vector3 rayDirScaled ( 
-// 				raydir.x * mOptions->scale.x,
-// 				raydir.y * mOptions->scale.y,
-// 				raydir.z * mOptions->scale.z);
+			PagingLandScapeData2D* data = mData2DManager->getData2D (pageX, pageZ, false);
+			if (data && data->isLoaded () && data->hasHeightPyramid ())
+			{
+				Ogre::Real t;
+				if (data->intersectRay (raybegin, raydir, pageEnter, pageExit, t))
+				{
+					*rayresult = raybegin + raydir * t;
+					return true;
+				}
+			}
 
-			if (raystart.y >= mData2DManager->getInterpolatedWorldHeight(raystart.x, raystart.z))
+			if (pageExit >= tMax)
+			{
+				return false;
+			}
+			pageEnter = pageExit;
+			if (tNextX < tNextZ)
 			{
-				impact = t->intersectSegmentFromAbove(raystart, raydir, rayresult);
+				pageX += stepX;
+				tNextX += Math::Abs(1.0f / du);
 			}
 			else
 			{
-				impact = t->intersectSegmentFromBelow(raystart, raydir, rayresult);
+				pageZ += stepZ;
+				tNextZ += Math::Abs(1.0f / dw);
 			}
-
-        }
-        return impact;
+			if (pageX < 0 || pageX > lastPageX || pageZ < 0 || pageZ > lastPageZ)
+			{
+				return false;
+			}
+		}
     } 
     //-------------------------------------------------------------------------
     void PagingLandScapeSceneManager::resizeCrater ()
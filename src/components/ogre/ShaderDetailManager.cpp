@@ -37,7 +37,7 @@ namespace Ember
         mShaderThresholdLevel(8.0f), mGraphicalChangeAdapter(
             graphicalChangeAdapter), mShaderManager(shaderManager)
     {
-//	mChangeRequiredConnection = mGraphicalChangeAdapter.EventChangeRequired.connect(sigc::mem_fun(*this, &ShaderDetailManager::changeLevel));
+//	mChangeRequiredConnection = mGraphicalChangeAdapter.connectSubsystem("shaders", sigc::mem_fun(*this, &ShaderDetailManager::changeLevel));
     }
 
     ShaderDetailManager::~ShaderDetailManager()
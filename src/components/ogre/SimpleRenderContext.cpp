@@ -25,6 +25,7 @@
 #endif
 
 #include "SimpleRenderContext.h"
+#include "SimpleRenderContextScene.h"
 
 #include "EmberOgre.h"
 #include "GUIManager.h"
@@ -40,11 +41,28 @@
 #include <OgreTextureManager.h>
 #include <OgreTexture.h>
 
+#include <vector>
+
 namespace Ember
 {
 namespace OgreView
 {
 
+namespace
+{
+void collectAttachedObjects(Ogre::SceneNode* node, std::vector<Ogre::MovableObject*>& objects)
+{
+	Ogre::SceneNode::ObjectIterator I = node->getAttachedObjectIterator();
+	while (I.hasMoreElements()) {
+		objects.push_back(I.getNext());
+	}
+	Ogre::Node::ChildNodeIterator J = node->getChildIterator();
+	while (J.hasMoreElements()) {
+		collectAttachedObjects(static_cast<Ogre::SceneNode*>(J.getNext()), objects);
+	}
+}
+}
+
 SimpleRenderContextResourceLoader::SimpleRenderContextResourceLoader(SimpleRenderContext& renderContext) :
 		mRenderContext(renderContext)
 {
@@ -62,7 +80,7 @@ void SimpleRenderContextResourceLoader::loadResource(Ogre::Resource *resource)
 }
 
 SimpleRenderContext::SimpleRenderContext(const std::string& prefix, int width, int height) :
-		mMainLight(0), mSceneManager(0), mWidth(width), mHeight(height), mRenderTexture(0), mCameraNode(0), mCameraPitchNode(0), mEntityNode(0), mRootNode(0), mCamera(0), mViewPort(0), mResourceLoader(*this), mBackgroundColour(Ogre::ColourValue::Black), mCameraPositionMode(CPM_OBJECTCENTER), mTextureOwned(true)
+		mMainLight(0), mSceneManager(0), mSharedScene(0), mVisibilityFlag(0), mAmbientLight(0.5, 0.5, 0.5), mWidth(width), mHeight(height), mRenderTexture(0), mCameraNode(0), mCameraPitchNode(0), mEntityNode(0), mRootNode(0), mCamera(0), mViewPort(0), mResourceLoader(*this), mBackgroundColour(Ogre::ColourValue::Black), mCameraPositionMode(CPM_OBJECTCENTER), mTextureOwned(true)
 {
 
 	setupScene(prefix);
@@ -70,7 +88,7 @@ SimpleRenderContext::SimpleRenderContext(const std::string& prefix, int width, i
 }
 
 SimpleRenderContext::SimpleRenderContext(const std::string& prefix, Ogre::TexturePtr texture) :
-		mMainLight(0), mSceneManager(0), mWidth(texture->getWidth()), mHeight(texture->getHeight()), mRenderTexture(0), mCameraNode(0), mCameraPitchNode(0), mEntityNode(0), mRootNode(0), mCamera(0), mViewPort(0), mResourceLoader(*this), mBackgroundColour(Ogre::ColourValue::Black), mCameraPositionMode(CPM_OBJECTCENTER), mTextureOwned(false)
+		mMainLight(0), mSceneManager(0), mSharedScene(0), mVisibilityFlag(0), mAmbientLight(0.5, 0.5, 0.5), mWidth(texture->getWidth()), mHeight(texture->getHeight()), mRenderTexture(0), mCameraNode(0), mCameraPitchNode(0), mEntityNode(0), mRootNode(0), mCamera(0), mViewPort(0), mResourceLoader(*this), mBackgroundColour(Ogre::ColourValue::Black), mCameraPositionMode(CPM_OBJECTCENTER), mTextureOwned(false)
 {
 
 	setupScene(prefix);
@@ -85,9 +103,28 @@ SimpleRenderContext::SimpleRenderContext(const std::string& prefix, Ogre::Textur
 
 SimpleRenderContext::~SimpleRenderContext()
 {
+	if (mRenderTexture) {
+		mRenderTexture->removeListener(this);
+	}
 	if (mTextureOwned) {
 		Ogre::TextureManager::getSingleton().remove(mTexture->getHandle());
 	}
+	if (mSharedScene) {
+		//the camera must be unregistered before it's destroyed
+		mSharedScene->removeContext(*this);
+		if (mCamera) {
+			mSceneManager->destroyCamera(mCamera);
+		}
+		if (mMainLight) {
+			mSceneManager->destroyLight(mMainLight);
+		}
+		//since the scene manager lives on we need to clean up anything that's still attached to our nodes, like it would have been if the scene manager was destroyed
+		destroyAttachedObjects(mRootNode);
+		mRootNode->removeAndDestroyAllChildren();
+		mSceneManager->destroySceneNode(mRootNode);
+		SimpleRenderContextScene::release(mVisibilityFlag);
+		return;
+	}
 	if (mCamera) {
 		mSceneManager->destroyCamera(mCamera);
 	}
@@ -102,15 +139,36 @@ SimpleRenderContext::~SimpleRenderContext()
 	Ogre::Root::getSingleton().destroySceneManager(mSceneManager);
 }
 
+void SimpleRenderContext::destroyAttachedObjects(Ogre::SceneNode* node)
+{
+	std::vector<Ogre::MovableObject*> objects;
+	collectAttachedObjects(node, objects);
+	for (std::vector<Ogre::MovableObject*>::iterator I = objects.begin(); I != objects.end(); ++I) {
+		if ((*I)->getMovableType() == Model::Model::sMovableType) {
+			mSceneManager->destroyMovableObject(*I);
+			*I = 0;
+		}
+	}
+	for (std::vector<Ogre::MovableObject*>::iterator I = objects.begin(); I != objects.end(); ++I) {
+		if (*I) {
+			mSceneManager->destroyMovableObject(*I);
+		}
+	}
+}
+
 void SimpleRenderContext::setupScene(const std::string& prefix)
 {
 	S_LOG_VERBOSE("Creating new SimpleRenderContext for prefix " << prefix << " with w:" << mWidth << " h:" << mHeight);
-	mSceneManager = Ogre::Root::getSingleton().createSceneManager(Ogre::ST_GENERIC, prefix + "_sceneManager");
-	//One might wonder why we're not setting the fog to FOG_NONE. The reason is that it seems that due to a bug in either Ogre or OpenGL when doing that, none of the other fog values would be set. Since we use shaders and in the shaders look for the alpha value of the fog colour to determine whether fog is enabled or not, we need to make sure that the fog colour indeed is set.
-	mSceneManager->setFog(Ogre::FOG_EXP2, Ogre::ColourValue(0, 0, 0, 0), 0.0f, 0.0f, 0.0f);
-// 	mSceneManager->setFog(Ogre::FOG_NONE, Ogre::ColourValue(1,1,1,1), 0.0f, 10000000.0f, 100000001.0f);
-
-	mRootNode = mSceneManager->getRootSceneNode();
+	mSharedScene = SimpleRenderContextScene::acquire(mVisibilityFlag);
+	if (mSharedScene) {
+		mSceneManager = mSharedScene->getSceneManager();
+		mRootNode = mSceneManager->getRootSceneNode()->createChildSceneNode();
+	} else {
+		mSceneManager = Ogre::Root::getSingleton().createSceneManager(Ogre::ST_GENERIC, prefix + "_sceneManager");
+		//See SimpleRenderContextScene for why we're not setting the fog to FOG_NONE.
+		mSceneManager->setFog(Ogre::FOG_EXP2, Ogre::ColourValue(0, 0, 0, 0), 0.0f, 0.0f, 0.0f);
+		mRootNode = mSceneManager->getRootSceneNode();
+	}
 
 	mEntityNode = mRootNode->createChildSceneNode();
 
@@ -122,7 +180,7 @@ void SimpleRenderContext::setupScene(const std::string& prefix)
 	createCamera(prefix);
 	//setVisible(false);
 	Ogre::ColourValue colour(0.5, 0.5, 0.5);
-	mMainLight = mSceneManager->createLight("MainLight");
+	mMainLight = mSceneManager->createLight(prefix + "_MainLight");
 	mMainLight->setType(Ogre::Light::LT_DIRECTIONAL);
 	mMainLight->setDirection(Ogre::Vector3(-1, 0, 0));
 	mMainLight->setPowerScale(10); // REALLY bright.
@@ -130,10 +188,14 @@ void SimpleRenderContext::setupScene(const std::string& prefix)
 	mMainLight->setSpecularColour(colour);
 	mMainLight->setVisible(true);
 
-	mSceneManager->setAmbientLight(colour);
+	setAmbientLight(colour);
 	mCameraPitchNode->attachObject(mMainLight);
 
 	resetCameraOrientation();
+
+	if (mSharedScene) {
+		mSharedScene->addContext(*this);
+	}
 }
 
 Ogre::SceneNode* SimpleRenderContext::getSceneNode() const
@@ -241,6 +303,11 @@ Ogre::SceneNode* SimpleRenderContext::getCameraRootNode() const
 	return mCameraNode;
 }
 
+Ogre::SceneNode* SimpleRenderContext::getRootNode() const
+{
+	return mRootNode;
+}
+
 Ogre::TexturePtr SimpleRenderContext::getTexture()
 {
 	return mTexture;
@@ -282,11 +349,13 @@ void SimpleRenderContext::setTexture(Ogre::TexturePtr texture)
 {
 	if (texture != mTexture) {
 		if (mRenderTexture) {
+			mRenderTexture->removeListener(this);
 			mRenderTexture->removeAllViewports();
 		}
 		mTexture = texture;
 		mRenderTexture = texture->getBuffer()->getRenderTarget();
 		mRenderTexture->removeAllViewports();
+		mRenderTexture->addListener(this);
 
 		mRenderTexture->setAutoUpdated(false);
 		//initially deactivate it until setActive(true) is called
@@ -296,6 +365,10 @@ void SimpleRenderContext::setTexture(Ogre::TexturePtr texture)
 		mViewPort = mRenderTexture->addViewport(mCamera);
 		mViewPort->setOverlaysEnabled(false);
 		mViewPort->setShadowsEnabled(false);
+		if (mSharedScene) {
+			//only render our own objects in the shared scene
+			mViewPort->setVisibilityMask(mVisibilityFlag);
+		}
 		//make sure the camera renders into this new texture
 		//this should preferrably be a transparent background, so that CEGUI could itself decide what to show behind it, but alas I couldn't get it to work, thus black
 		mViewPort->setBackgroundColour(mBackgroundColour);
@@ -333,6 +406,28 @@ void SimpleRenderContext::setBackgroundColour(float red, float green, float blue
 	}
 }
 
+void SimpleRenderContext::setAmbientLight(const Ogre::ColourValue& colour)
+{
+	mAmbientLight = colour;
+	//when the scene is shared the ambient light is applied before each render
+	if (!mSharedScene) {
+		mSceneManager->setAmbientLight(colour);
+	}
+}
+
+void SimpleRenderContext::requestUpdate()
+{
+	//Ogre updates all auto updated render targets in one go; we turn it off again once the render is done
+	if (mRenderTexture) {
+		mRenderTexture->setAutoUpdated(true);
+	}
+}
+
+void SimpleRenderContext::postRenderTargetUpdate(const Ogre::RenderTargetEvent& evt)
+{
+	evt.source->setAutoUpdated(false);
+}
+
 void SimpleRenderContext::showFull(const Ogre::MovableObject* object)
 {
 	//only do this if there's an active object
@@ -27,11 +27,13 @@
 #include <OgreResource.h>
 #include <OgreColourValue.h>
 #include <OgreTexture.h>
+#include <OgreRenderTargetListener.h>
 
 namespace Ember {
 namespace OgreView {
 
 class SimpleRenderContext;
+class SimpleRenderContextScene;
 
 /**
 Responsible for making sure that the texture is rerendered when the texture resource needs to be reloaded.
@@ -60,9 +62,12 @@ protected:
 
 Useful class for rendering a single scene node.
 
+All instances share one scene manager (see SimpleRenderContextScene), so everything rendered must be attached below the node returned by getRootNode() (or getSceneNode()), and not directly to the root node of the scene manager.
+
 */
-class SimpleRenderContext
+class SimpleRenderContext : public Ogre::RenderTargetListener
 {
+friend class SimpleRenderContextScene;
 public:
 
     /**
@@ -94,7 +99,7 @@ public:
     SimpleRenderContext(const std::string& prefix, int width, int height);
     SimpleRenderContext(const std::string& prefix, Ogre::TexturePtr texturePtr);
 
-    ~SimpleRenderContext();
+    virtual ~SimpleRenderContext();
 
     /**
      * Gets the scene node which is being rendered.
@@ -198,6 +203,12 @@ public:
 
     Ogre::SceneNode* getCameraRootNode() const;
 
+    /**
+     * @brief Gets the root node of this context. Anything attached below this node will be rendered.
+     * @return The root node.
+     */
+    Ogre::SceneNode* getRootNode() const;
+
     Ogre::Viewport* getViewport() const;
 
     /**
@@ -221,6 +232,24 @@ public:
      */
     void setBackgroundColour(float red, float green, float blue, float alpha);
 
+    /**
+     * @brief Sets the ambient light.
+     * Use this rather than setting it on the scene manager, since the scene manager is shared with other contexts.
+     * @param colour The ambient light colour.
+     */
+    void setAmbientLight(const Ogre::ColourValue& colour);
+
+    /**
+     * @brief Requests that the texture is rendered on the next frame.
+     * All requested contexts are rendered together when Ogre updates its render targets, and multiple requests during the same frame only result in one render.
+     */
+    void requestUpdate();
+
+    /**
+     * @brief Turns off automatic updates once a requested render is done.
+     */
+    virtual void postRenderTargetUpdate(const Ogre::RenderTargetEvent& evt);
+
     /**
     Sets the render texture to which the scene will be rendered. By default an instance of this class will create it's own Render Texture instance, but this allows you to use a preexisting one if you want.
     */
@@ -246,10 +275,25 @@ private:
 	Ogre::Light* mMainLight;
 
 	/**
-	Since we don't want this to be shown in the "real" world, we'll use our own scene manager
+	Since we don't want this to be shown in the "real" world, we'll use a separate scene manager. It's normally shared with other contexts.
 	*/
 	Ogre::SceneManager* mSceneManager;
 
+	/**
+	The shared scene, or null if this context has a scene manager of its own.
+	*/
+	SimpleRenderContextScene* mSharedScene;
+
+	/**
+	The visibility flag used to tell our objects apart from those of other contexts in the shared scene.
+	*/
+	Ogre::uint32 mVisibilityFlag;
+
+	/**
+	The ambient light of the scene.
+	*/
+	Ogre::ColourValue mAmbientLight;
+
 	/**
 	The default distance of the camera from the base, most likely somewhere where the whole scene is shown
 	*/
@@ -279,6 +323,12 @@ private:
 
 	void setupScene(const std::string& prefix);
 
+	/**
+	 *    Destroys all objects attached to the node and its children. Models are destroyed before anything else, since they rely on their entities still existing.
+	 * @param node
+	 */
+	void destroyAttachedObjects(Ogre::SceneNode* node);
+
 	/**
 	The node to which the camera is attached.
 	*/
@@ -290,7 +340,7 @@ private:
 	Ogre::SceneNode* mEntityNode;
 
 	/**
-	The root node.
+	The root node of this context. When the scene is shared this is a child of the root node of the scene manager.
 	*/
 	Ogre::SceneNode* mRootNode;
 
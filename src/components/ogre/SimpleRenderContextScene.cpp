@@ -0,0 +1,129 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SimpleRenderContextScene.h"
+#include "SimpleRenderContext.h"
+
+#include "model/Model.h"
+
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreLight.h>
+
+#include <vector>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+SimpleRenderContextScene* SimpleRenderContextScene::sInstance = 0;
+
+SimpleRenderContextScene::SimpleRenderContextScene() :
+		mSceneManager(0), mUsedVisibilityFlags(0)
+{
+	S_LOG_VERBOSE("Creating shared scene for SimpleRenderContext instances.");
+	mSceneManager = Ogre::Root::getSingleton().createSceneManager(Ogre::ST_GENERIC, "SimpleRenderContext_sceneManager");
+	//One might wonder why we're not setting the fog to FOG_NONE. The reason is that it seems that due to a bug in either Ogre or OpenGL when doing that, none of the other fog values would be set. Since we use shaders and in the shaders look for the alpha value of the fog colour to determine whether fog is enabled or not, we need to make sure that the fog colour indeed is set.
+	mSceneManager->setFog(Ogre::FOG_EXP2, Ogre::ColourValue(0, 0, 0, 0), 0.0f, 0.0f, 0.0f);
+}
+
+SimpleRenderContextScene::~SimpleRenderContextScene()
+{
+	S_LOG_VERBOSE("Destroying shared scene for SimpleRenderContext instances.");
+	//Any models which weren't attached to a context (for example because they were still being loaded) need to be destroyed before the entities.
+	mSceneManager->destroyAllMovableObjectsByType(Model::Model::sMovableType);
+	Ogre::Root::getSingleton().destroySceneManager(mSceneManager);
+}
+
+SimpleRenderContextScene* SimpleRenderContextScene::acquire(Ogre::uint32& visibilityFlag)
+{
+	if (!sInstance) {
+		sInstance = new SimpleRenderContextScene();
+	}
+	for (int i = 0; i < 32; ++i) {
+		Ogre::uint32 flag = 1u << i;
+		if (!(sInstance->mUsedVisibilityFlags & flag)) {
+			sInstance->mUsedVisibilityFlags |= flag;
+			visibilityFlag = flag;
+			return sInstance;
+		}
+	}
+	S_LOG_WARNING("All visibility flags of the shared SimpleRenderContext scene are in use; a separate scene will be used.");
+	return 0;
+}
+
+void SimpleRenderContextScene::release(Ogre::uint32 visibilityFlag)
+{
+	if (sInstance) {
+		sInstance->mUsedVisibilityFlags &= ~visibilityFlag;
+		if (!sInstance->mUsedVisibilityFlags) {
+			delete sInstance;
+			sInstance = 0;
+		}
+	}
+}
+
+void SimpleRenderContextScene::addContext(SimpleRenderContext& context)
+{
+	mContexts[context.getCamera()] = &context;
+	context.getCamera()->addListener(this);
+}
+
+void SimpleRenderContextScene::removeContext(SimpleRenderContext& context)
+{
+	context.getCamera()->removeListener(this);
+	mContexts.erase(context.getCamera());
+}
+
+void SimpleRenderContextScene::cameraPreRenderScene(Ogre::Camera* camera)
+{
+	ContextStore::const_iterator I = mContexts.find(camera);
+	if (I == mContexts.end()) {
+		return;
+	}
+	SimpleRenderContext* activeContext = I->second;
+	for (ContextStore::const_iterator J = mContexts.begin(); J != mContexts.end(); ++J) {
+		if (J->second->mMainLight) {
+			J->second->mMainLight->setVisible(J->second == activeContext);
+		}
+		//New objects may have been attached to any context since the last render, and would by default be visible in all viewports, so we need to go through the objects of all contexts each time.
+		applyVisibilityFlags(J->second->mRootNode, J->second->mVisibilityFlag);
+	}
+	mSceneManager->setAmbientLight(activeContext->mAmbientLight);
+}
+
+void SimpleRenderContextScene::applyVisibilityFlags(Ogre::SceneNode* node, Ogre::uint32 visibilityFlags)
+{
+	Ogre::SceneNode::ObjectIterator I = node->getAttachedObjectIterator();
+	while (I.hasMoreElements()) {
+		I.getNext()->setVisibilityFlags(visibilityFlags);
+	}
+	Ogre::Node::ChildNodeIterator J = node->getChildIterator();
+	while (J.hasMoreElements()) {
+		applyVisibilityFlags(static_cast<Ogre::SceneNode*>(J.getNext()), visibilityFlags);
+	}
+}
+
+}
+}
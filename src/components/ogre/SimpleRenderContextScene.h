@@ -0,0 +1,123 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_SIMPLERENDERCONTEXTSCENE_H_
+#define EMBEROGRE_SIMPLERENDERCONTEXTSCENE_H_
+
+#include "EmberOgrePrerequisites.h"
+#include <OgreCamera.h>
+
+#include <map>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+class SimpleRenderContext;
+
+/**
+ * @brief A scene shared by all SimpleRenderContext instances.
+ *
+ * Previously each SimpleRenderContext created its own scene manager, which meant that each preview widget carried the memory and update cost of a full scene. Instead all contexts now place their content under their own node in one shared scene manager.
+ *
+ * Each context is given its own bit in the visibility mask. Before any context's camera renders, the objects attached below the node of each context get the bit of that context as visibility flags, and the viewport only renders objects with its own bit set. The main light of the context is shown, the lights of all other contexts hidden, and the ambient light of the context applied.
+ *
+ * Since there are only 32 bits in a visibility mask, only 32 contexts can share the scene. Any further context will have to use a scene manager of its own.
+ *
+ * The instance is created when the first context acquires it, and destroyed when the last context releases it.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class SimpleRenderContextScene: public Ogre::Camera::Listener
+{
+public:
+
+	/**
+	 * @brief Acquires a visibility flag in the shared scene, creating the scene if needed.
+	 * @param visibilityFlag Set to the visibility flag allocated to the caller.
+	 * @return The shared scene, or null if all visibility flags are already in use.
+	 */
+	static SimpleRenderContextScene* acquire(Ogre::uint32& visibilityFlag);
+
+	/**
+	 * @brief Releases a visibility flag. When the last flag is released the scene is destroyed.
+	 * @param visibilityFlag The flag, as returned by acquire().
+	 */
+	static void release(Ogre::uint32 visibilityFlag);
+
+	/**
+	 * @brief Gets the shared scene manager.
+	 * @return The scene manager.
+	 */
+	Ogre::SceneManager* getSceneManager() const;
+
+	/**
+	 * @brief Registers a context, so that the scene is prepared for it whenever its camera renders.
+	 * @param context The context. Its camera, light and root node must have been created.
+	 */
+	void addContext(SimpleRenderContext& context);
+
+	/**
+	 * @brief Unregisters a context. Call this before the context's camera is destroyed.
+	 * @param context The context.
+	 */
+	void removeContext(SimpleRenderContext& context);
+
+	/**
+	 * @brief Prepares the scene for rendering through the context which owns the camera.
+	 * @param camera The camera about to render.
+	 */
+	virtual void cameraPreRenderScene(Ogre::Camera* camera);
+
+private:
+
+	typedef std::map<Ogre::Camera*, SimpleRenderContext*> ContextStore;
+
+	static SimpleRenderContextScene* sInstance;
+
+	Ogre::SceneManager* mSceneManager;
+
+	/**
+	 * @brief The visibility flags currently in use.
+	 */
+	Ogre::uint32 mUsedVisibilityFlags;
+
+	ContextStore mContexts;
+
+	SimpleRenderContextScene();
+
+	virtual ~SimpleRenderContextScene();
+
+	/**
+	 * @brief Sets the visibility flags of all objects attached to a node and its children.
+	 * @param node The node.
+	 * @param visibilityFlags The flags.
+	 */
+	static void applyVisibilityFlags(Ogre::SceneNode* node, Ogre::uint32 visibilityFlags);
+};
+
+inline Ogre::SceneManager* SimpleRenderContextScene::getSceneManager() const
+{
+	return mSceneManager;
+}
+
+}
+}
+
+#endif /* EMBEROGRE_SIMPLERENDERCONTEXTSCENE_H_ */
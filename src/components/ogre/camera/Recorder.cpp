@@ -17,12 +17,20 @@
  */
 
 #include "Recorder.h"
-#include "components/ogre/EmberOgre.h"
+#include "RecorderFrameTask.h"
 #include "services/EmberServices.h"
 #include "services/config/ConfigService.h"
 #include "framework/osdir.h"
+#include "framework/LoggingInstance.h"
+#include "framework/ConsoleBackend.h"
+#include "framework/tasks/TaskQueue.h"
 #include <OgreRoot.h>
 #include <OgreRenderWindow.h>
+#include <OgrePixelFormat.h>
+
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
 
 namespace Ember
 {
@@ -31,52 +39,153 @@ namespace OgreView
 namespace Camera
 {
 
-Recorder::Recorder(): mSequence(0), mAccruedTime(0.0f), mFramesPerSecond(20.0f)
+Recorder::Recorder(Ogre::RenderWindow& window) :
+		mWindow(window), mSequence(0), mAccruedTime(0.0f), mFramesPerSecond(20.0f), mWriteRaw(false), mRecordedFrames(0), mDroppedFrames(0), mIsRecording(false)
+{
+}
+
+Recorder::~Recorder()
 {
+	stopRecording();
 }
 
 void Recorder::startRecording()
 {
+	if (mIsRecording) {
+		return;
+	}
+	ConfigService& configService = EmberServices::getSingleton().getConfigService();
+	mDirectory = configService.getHomeDirectory() + "/recordings/";
+	try {
+		//make sure the directory exists
+		oslink::directory osdir(mDirectory);
+
+		if (!osdir.isExisting()) {
+			oslink::directory::mkdir(mDirectory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for recordings." << ex);
+		return;
+	}
+
+	unsigned int numberOfBuffers = 4;
+	unsigned int numberOfThreads = 2;
+	mFramesPerSecond = 20.0f;
+	mWriteRaw = false;
+	if (configService.hasItem("recorder", "fps")) {
+		mFramesPerSecond = std::max(1.0, static_cast<double>(configService.getValue("recorder", "fps")));
+	}
+	if (configService.hasItem("recorder", "buffers")) {
+		numberOfBuffers = std::max(1, static_cast<int>(configService.getValue("recorder", "buffers")));
+	}
+	if (configService.hasItem("recorder", "threads")) {
+		numberOfThreads = std::max(1, static_cast<int>(configService.getValue("recorder", "threads")));
+	}
+	if (configService.hasItem("recorder", "format")) {
+		mWriteRaw = static_cast<std::string>(configService.getValue("recorder", "format")) == "raw";
+	}
+
+	mStagingBuffers.clear();
+	mStagingBuffers.resize(numberOfBuffers);
+	mFreeBuffers.clear();
+	for (size_t i = 0; i < numberOfBuffers; ++i) {
+		mFreeBuffers.push_back(i);
+	}
+	mTaskQueue.reset(new Tasks::TaskQueue(numberOfThreads));
+	mRecordedFrames = 0;
+	mDroppedFrames = 0;
+	mAccruedTime = 0.0f;
+	mIsRecording = true;
+
 	Ogre::Root::getSingleton().addFrameListener(this);
 }
+
 void Recorder::stopRecording()
 {
-	Ogre::Root::getSingleton().removeFrameListener(this);
+	if (!mIsRecording) {
+		return;
+	}
+	mIsRecording = false;
+	//This might be called at shutdown, when Ogre could already have been shut down.
+	if (Ogre::Root::getSingletonPtr()) {
+		Ogre::Root::getSingleton().removeFrameListener(this);
+	}
+	//Destroying the queue will wait for all frames to be written.
+	mTaskQueue.reset();
+	mStagingBuffers.clear();
+	mFreeBuffers.clear();
+
+	std::stringstream ss;
+	ss << "Recorded " << mRecordedFrames << " frames to " << mDirectory << ", dropped " << mDroppedFrames << " frames.";
+	S_LOG_INFO(ss.str());
+	//The console backend might already have been destroyed if this is called at shutdown.
+	if (ConsoleBackend::getSingletonPtr()) {
+		ConsoleBackend::getSingletonPtr()->pushMessage(ss.str(), "info");
+	}
+}
+
+unsigned int Recorder::getRecordedFrames() const
+{
+	return mRecordedFrames;
+}
+
+unsigned int Recorder::getDroppedFrames() const
+{
+	return mDroppedFrames;
 }
 
 bool Recorder::frameStarted(const Ogre::FrameEvent& event)
 {
+	//Recycle the buffers of any written frames.
+	mTaskQueue->pollProcessedTasks(TimeFrame(boost::posix_time::milliseconds(1)));
+
 	mAccruedTime += event.timeSinceLastFrame;
 	if (mAccruedTime >= (1.0f / mFramesPerSecond)) {
 		mAccruedTime = 0.0f;
-		std::stringstream filename;
-		filename << "screenshot_" << mSequence++ << ".tga";
-		const std::string dir = EmberServices::getSingleton().getConfigService().getHomeDirectory() + "/recordings/";
-		try {
-			//make sure the directory exists
-
-			oslink::directory osdir(dir);
-
-			if (!osdir.isExisting()) {
-				oslink::directory::mkdir(dir.c_str());
-			}
-		} catch (const std::exception& ex) {
-			S_LOG_FAILURE("Error when creating directory for screenshots." << ex);
-			stopRecording();
-			return true;
-		}
-		try {
-			// take screenshot
-			EmberOgre::getSingleton().getRenderWindow()->writeContentsToFile(dir + filename.str());
-		} catch (const std::exception& ex) {
-			S_LOG_FAILURE("Could not write screenshot to disc." << ex);
-			stopRecording();
-			return true;
-		}
+		captureFrame();
 	}
 	return true;
 }
 
+void Recorder::captureFrame()
+{
+	if (mFreeBuffers.empty()) {
+		//The encoders can't keep up; drop the frame rather than stalling.
+		//The sequence number is still advanced, so that the gap shows in the numbering and the timing of the remaining frames is kept.
+		mDroppedFrames++;
+		mSequence++;
+		return;
+	}
+	size_t bufferIndex = mFreeBuffers.back();
+	std::vector<unsigned char>& buffer = mStagingBuffers[bufferIndex];
+
+	size_t width = mWindow.getWidth();
+	size_t height = mWindow.getHeight();
+	//The buffers are only reallocated if the window size changes.
+	buffer.resize(width * height * 3);
+	try {
+		Ogre::PixelBox pixelBox(width, height, 1, Ogre::PF_BYTE_RGB, &buffer[0]);
+		mWindow.copyContentsToMemory(pixelBox);
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Could not read back window contents when recording." << ex);
+		stopRecording();
+		return;
+	}
+	mFreeBuffers.pop_back();
+
+	std::stringstream path;
+	path << mDirectory << "screenshot_" << std::setw(6) << std::setfill('0') << mSequence++;
+	mTaskQueue->enqueueTask(new RecorderFrameTask(buffer, bufferIndex, width, height, mWriteRaw ? RecorderFrameTask::F_RAW : RecorderFrameTask::F_PNG, path.str(), sigc::mem_fun(*this, &Recorder::frameTask_Completed)));
+}
+
+void Recorder::frameTask_Completed(size_t bufferIndex, bool successful)
+{
+	if (successful) {
+		mRecordedFrames++;
+	}
+	mFreeBuffers.push_back(bufferIndex);
+}
+
 }
 }
 }
@@ -20,30 +20,128 @@
 #define RECORDER_H_
 #include <OgreFrameListener.h>
 
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace Ogre
+{
+  class RenderWindow;
+}
+
 namespace Ember
 {
+  namespace Tasks
+  {
+    class TaskQueue;
+  }
   namespace OgreView
   {
     namespace Camera
     {
 
+      /**
+       * @brief Records the contents of the render window to a sequence of images on disk.
+       *
+       * Each captured frame is read back into one of a ring of preallocated staging buffers, and then handed to a pool of background threads which encode and write it to disk. The main thread thus never has to wait for the encoding or the disk.
+       * If the encoders fall behind so that all staging buffers are in use, frames are dropped instead of stalling the rendering. The number of dropped frames is reported when the recording is stopped.
+       *
+       * Frames are written to the "recordings" directory in the home directory, either as PNG images or as raw PPM images, depending on the "recorder:format" config setting ("png" or "raw").
+       */
       class Recorder : public Ogre::FrameListener
       {
       public:
-        Recorder();
+        /**
+         * @brief Ctor.
+         * @param window The window to record.
+         */
+        Recorder(Ogre::RenderWindow& window);
+
+        /**
+         * @brief Dtor.
+         * Any ongoing recording will be stopped.
+         */
+        virtual
+        ~Recorder();
+
         void
         startRecording();
+
+        /**
+         * @brief Stops the recording.
+         * This will wait for all captured frames to be written to disk.
+         */
         void
         stopRecording();
+
         /**
          * Methods from Ogre::FrameListener
          */
         bool
         frameStarted(const Ogre::FrameEvent& event);
+
+        /**
+         * @brief Gets the number of frames written in the current, or last, recording.
+         */
+        unsigned int
+        getRecordedFrames() const;
+
+        /**
+         * @brief Gets the number of frames dropped in the current, or last, recording because the encoders couldn't keep up.
+         */
+        unsigned int
+        getDroppedFrames() const;
+
       private:
+        Ogre::RenderWindow& mWindow;
         int mSequence;
         float mAccruedTime;
         float mFramesPerSecond;
+
+        /**
+         * @brief The directory to which frames are written.
+         */
+        std::string mDirectory;
+
+        /**
+         * @brief The queue used for encoding frames.
+         * This only exists while recording.
+         */
+        std::unique_ptr<Tasks::TaskQueue> mTaskQueue;
+
+        /**
+         * @brief The ring of staging buffers into which frames are read back.
+         */
+        std::vector<std::vector<unsigned char>> mStagingBuffers;
+
+        /**
+         * @brief Indices of the staging buffers which aren't currently being encoded.
+         */
+        std::vector<size_t> mFreeBuffers;
+
+        /**
+         * @brief True if frames should be written as raw images rather than PNG.
+         */
+        bool mWriteRaw;
+
+        unsigned int mRecordedFrames;
+        unsigned int mDroppedFrames;
+
+        bool mIsRecording;
+
+        /**
+         * @brief Reads back the window contents and hands them to the encoders.
+         */
+        void
+        captureFrame();
+
+        /**
+         * @brief Called in the main thread when a frame has been written.
+         * @param bufferIndex The index of the staging buffer used by the frame.
+         * @param successful True if the frame could be written.
+         */
+        void
+        frameTask_Completed(size_t bufferIndex, bool successful);
       };
     }
   }
@@ -0,0 +1,81 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "RecorderFrameTask.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <OgreImage.h>
+
+#include <fstream>
+
+namespace Ember
+{
+namespace OgreView
+{
+namespace Camera
+{
+
+RecorderFrameTask::RecorderFrameTask(std::vector<unsigned char>& buffer, size_t bufferIndex, size_t width, size_t height, Format format, const std::string& path, sigc::slot<void, size_t, bool> callback) :
+		mBuffer(buffer), mBufferIndex(bufferIndex), mWidth(width), mHeight(height), mFormat(format), mPath(path), mCallback(callback), mSuccessful(false)
+{
+}
+
+RecorderFrameTask::~RecorderFrameTask()
+{
+}
+
+void RecorderFrameTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	if (mFormat == F_PNG) {
+		try {
+			Ogre::Image image;
+			//The image won't take ownership of the data.
+			image.loadDynamicImage(&mBuffer[0], mWidth, mHeight, 1, Ogre::PF_BYTE_RGB);
+			image.save(mPath + ".png");
+			mSuccessful = true;
+		} catch (const std::exception& ex) {
+			S_LOG_FAILURE("Could not write recorded frame to '" << mPath << ".png'." << ex);
+		}
+	} else {
+		std::ofstream stream((mPath + ".ppm").c_str(), std::ios::out | std::ios::binary);
+		if (stream.is_open()) {
+			stream << "P6\n" << mWidth << " " << mHeight << "\n255\n";
+			stream.write(reinterpret_cast<const char*>(&mBuffer[0]), mWidth * mHeight * 3);
+			mSuccessful = stream.good();
+		}
+		if (!mSuccessful) {
+			S_LOG_FAILURE("Could not write recorded frame to '" << mPath << ".ppm'.");
+		}
+	}
+}
+
+void RecorderFrameTask::executeTaskInMainThread()
+{
+	if (mCallback) {
+		mCallback(mBufferIndex, mSuccessful);
+	}
+}
+
+}
+}
+}
@@ -0,0 +1,100 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef RECORDERFRAMETASK_H_
+#define RECORDERFRAMETASK_H_
+
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <sigc++/slot.h>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace Ember
+{
+namespace OgreView
+{
+namespace Camera
+{
+
+/**
+ * @brief Encodes and writes one captured frame to disk in a background thread.
+ *
+ * The pixel data is expected to be tightly packed 8 bit RGB data. It's either encoded as PNG (through Ogre's image codecs), or written as a raw binary PPM image, which is much cheaper.
+ *
+ * The buffer holding the pixel data is owned by the Recorder, and must not be touched until the callback has been called in the main thread.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class RecorderFrameTask : public Tasks::TemplateNamedTask<RecorderFrameTask>
+{
+public:
+
+	/**
+	 * @brief The format to write frames in.
+	 */
+	enum Format
+	{
+		/**
+		 * @brief PNG images.
+		 */
+		F_PNG,
+
+		/**
+		 * @brief Raw binary PPM images.
+		 */
+		F_RAW
+	};
+
+	/**
+	 * @brief Ctor.
+	 * @param buffer The pixel data.
+	 * @param bufferIndex The index of the buffer in the Recorder's ring of staging buffers.
+	 * @param width The width of the frame.
+	 * @param height The height of the frame.
+	 * @param format The format to write the frame in.
+	 * @param path The path to write to, without any file extension.
+	 * @param callback Called in the main thread when the frame has been written, with the buffer index and whether the write was successful.
+	 */
+	RecorderFrameTask(std::vector<unsigned char>& buffer, size_t bufferIndex, size_t width, size_t height, Format format, const std::string& path, sigc::slot<void, size_t, bool> callback);
+
+	virtual ~RecorderFrameTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+private:
+
+	std::vector<unsigned char>& mBuffer;
+	const size_t mBufferIndex;
+	const size_t mWidth;
+	const size_t mHeight;
+	const Format mFormat;
+	const std::string mPath;
+	sigc::slot<void, size_t, bool> mCallback;
+	bool mSuccessful;
+};
+
+}
+}
+}
+
+#endif /* RECORDERFRAMETASK_H_ */
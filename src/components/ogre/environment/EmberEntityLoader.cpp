@@ -25,6 +25,7 @@
 #endif
 
 #include "EmberEntityLoader.h"
+#include "ExclusiveEntityTracker.h"
 
 #include <OgreSceneNode.h>
 #include <OgreColourValue.h>
@@ -38,6 +39,7 @@
 
 #include <sigc++/bind.h>
 
+#include <cmath>
 #include <limits>
 
 namespace Ember
@@ -48,30 +50,18 @@ namespace OgreView
 namespace Environment
 {
 
-EmberEntityLoader::EmberEntityLoader(::Forests::PagedGeometry &geom, unsigned int batchSize) :
-		mGeom(geom), mBatchSize(batchSize)
+EmberEntityLoader::EmberEntityLoader(::Forests::PagedGeometry &geom, unsigned int batchSize, ExclusiveEntityTracker& entityTracker) :
+		mGeom(geom), mBatchSize(batchSize), mEntityTracker(entityTracker), mPageChangeCount(0), mPageReloadCount(0), mPageLoadCount(0)
 {
 }
 
 EmberEntityLoader::~EmberEntityLoader()
 {
 	//When shutting down, make sure to delete all connections.
-#if EMBERENTITYLOADER_USEBATCH
-	for (EntityStore::iterator I = mEntities.begin(); I != mEntities.end(); ++I) {
-		for (EntityColumn::iterator J = I->second.begin(); J != I->second.end(); ++J) {
-			for (EntityMap::iterator K = J->second.begin(); K != J->second.end(); ++K)
-			{
-				K->second.movedConnection.disconnect();
-				K->second.visibilityChangedConnection.disconnect();
-			}
-		}
-	}
-#else
 	for (EntityMap::iterator I = mEntities.begin(); I != mEntities.end(); ++I) {
 		I->second.movedConnection.disconnect();
 		I->second.visibilityChangedConnection.disconnect();
 	}
-#endif
 }
 
 void EmberEntityLoader::addEmberEntity(Model::ModelRepresentation* modelRepresentation)
@@ -81,36 +71,23 @@ void EmberEntityLoader::addEmberEntity(Model::ModelRepresentation* modelRepresen
 		return;
 	}
 	EmberEntity& entity = modelRepresentation->getEntity();
-	ModelRepresentationInstance instance;
+	if (mEntities.count(entity.getId())) {
+		S_LOG_WARNING("Tried to add entity " << entity.getId() << " to the paged geometry more than once.");
+		return;
+	}
+	ModelRepresentationInstance& instance = mEntities[entity.getId()];
 	instance.movedConnection = entity.Moved.connect(sigc::bind(sigc::mem_fun(*this, &EmberEntityLoader::EmberEntity_Moved), &entity));
 	instance.visibilityChangedConnection = entity.VisibilityChanged.connect(sigc::bind(sigc::mem_fun(*this, &EmberEntityLoader::EmberEntity_VisibilityChanged), &entity));
 	instance.modelRepresentation = modelRepresentation;
 
 	WFMath::Point<3> viewPosition = entity.getViewPosition();
-	Ogre::Vector3 position(std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN());
-
-	bool isValidPos = false;
 	if (viewPosition.isValid()) {
-		isValidPos = true;
-		position = Convert::toOgre(viewPosition);
+		instance.lastPosition = Convert::toOgre(viewPosition);
+		addToCell(instance);
+		markPageDirty(instance.lastPosition);
+	} else {
+		instance.lastPosition = Ogre::Vector3(std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN());
 	}
-	instance.lastPosition = position;
-#if EMBERENTITYLOADER_USEBATCH
-	const int batchX = Ogre::Math::Floor(position.x / mBatchSize);
-	const int batchY = Ogre::Math::Floor(position.y / mBatchSize);
-	mEntityLookup[entity] = std::pair<int, int>(batchX, batchY);
-
-	EntityMap& entities(mEntities[batchX][batchY]);
-#else
-	EntityMap& entities(mEntities);
-#endif
-	entities[entity.getId()] = instance;
-
-	if (isValidPos) {
-		//Rebuild geometry if necessary
-		mGeom.reloadGeometryPage(position);
-	}
-
 }
 
 void EmberEntityLoader::removeEmberEntity(EmberEntity* entity)
@@ -119,101 +96,111 @@ void EmberEntityLoader::removeEmberEntity(EmberEntity* entity)
 		S_LOG_WARNING("Tried to remove a null ref entity from the paged geometry.");
 		return;
 	}
-#if EMBERENTITYLOADER_USEBATCH
-	EntityLookup::iterator I = mEntityLookup.find(entity);
-	if (I != mEntityLookup.end()) {
-		EntityStore::iterator J = mEntities.find(I->second.first);
-		if (J != mEntities.end()) {
-			EntityColumn& column(J->second);
-			EntityColumn::iterator K = column.find(I->second.second);
-			if (K != column.end()) {
-				EntityMap& entityMap(K->second);
-				EntityMap::iterator L = entityMap.find(entity->getId());
-				if (L != entityMap.end()) {
-					L->second.movedConnection.disconnect();
-					L->second.beingDeletedConnection.disconnect();
-					entityMap.erase(L);
-					mEntityLookup.erase(I);
-				}
-			}
-		}
-	}
-#else
 	EntityMap::iterator I = mEntities.find(entity->getId());
 	if (I != mEntities.end()) {
 		ModelRepresentationInstance& instance(I->second);
 		Model::ModelRepresentation* modelRepresentation(instance.modelRepresentation);
 		instance.movedConnection.disconnect();
 		instance.visibilityChangedConnection.disconnect();
+		//The pages still refer to the entities until they're reloaded, so make sure that they won't touch them anymore.
+		for (Model::Model::SubModelSet::const_iterator J = modelRepresentation->getModel().getSubmodels().begin(); J != modelRepresentation->getModel().getSubmodels().end(); ++J) {
+			mEntityTracker.forget((*J)->getEntity());
+		}
 		//Reset the rendering distance to the one set by the model def.
 		modelRepresentation->getModel().setRenderingDistance(modelRepresentation->getModel().getDefinition()->getRenderingDistance());
+		if (!instance.lastPosition.isNaN()) {
+			removeFromCell(instance);
+			markPageDirty(instance.lastPosition);
+		}
 		mEntities.erase(I);
 	}
+}
 
-#endif
+EmberEntityLoader::PageKey EmberEntityLoader::getCellKey(const Ogre::Vector3& position) const
+{
+	const ::Forests::TBounds& bounds = mGeom.getBounds();
+	return PageKey(static_cast<int>(std::floor((position.x - bounds.left) / mBatchSize)), static_cast<int>(std::floor((position.z - bounds.top) / mBatchSize)));
+}
 
-	WFMath::Point<3> pos = entity->getViewPosition();
-	if (pos.isValid()) {
-		//Rebuild geometry if necessary.
-		mGeom.reloadGeometryPage(Convert::toOgre(pos));
-	}
+void EmberEntityLoader::addToCell(ModelRepresentationInstance& instance)
+{
+	mCells[getCellKey(instance.lastPosition)].insert(&instance);
 }
 
-EmberEntityLoader::EntityMap* EmberEntityLoader::getStoreForEntity(EmberEntity* entity)
+void EmberEntityLoader::removeFromCell(ModelRepresentationInstance& instance)
 {
-#if EMBERENTITYLOADER_USEBATCH
-	EntityLookup::iterator I = mEntityLookup.find(entity);
-	if (I != mEntityLookup.end()) {
-		EntityStore::iterator J = mEntities.find(I->second.first);
-		if (J != mEntities.end()) {
-			EntityColumn& column(J->second);
-			EntityColumn::iterator K = column.find(I->second.second);
-			if (K != column.end()) {
-				EntityMap& entityMap(K->second);
-				return &entityMap;
-			}
+	CellStore::iterator I = mCells.find(getCellKey(instance.lastPosition));
+	if (I != mCells.end()) {
+		I->second.erase(&instance);
+		if (I->second.empty()) {
+			mCells.erase(I);
 		}
 	}
-	return 0;
-#else
-	return &mEntities;
-#endif
+}
+
+void EmberEntityLoader::markPageDirty(const Ogre::Vector3& position)
+{
+	mPageChangeCount++;
+	//Use the same calculation as GeometryPageManager::reloadGeometryPage(), so that positions which would reload the same page get the same key.
+	const ::Forests::TBounds& bounds = mGeom.getBounds();
+	PageKey key;
+	if (bounds.width() > 0 && bounds.height() > 0) {
+		const Ogre::Real gridSize = std::ceil(bounds.width() / mGeom.getPageSize());
+		key = PageKey(static_cast<int>(std::floor(gridSize * (position.x - bounds.left) / bounds.width())), static_cast<int>(std::floor(gridSize * (position.z - bounds.top) / bounds.height())));
+	} else {
+		key = getCellKey(position);
+	}
+	mDirtyPages.insert(std::make_pair(key, position));
+}
+
+void EmberEntityLoader::reloadDirtyPages()
+{
+	for (std::map<PageKey, Ogre::Vector3>::const_iterator I = mDirtyPages.begin(); I != mDirtyPages.end(); ++I) {
+		mGeom.reloadGeometryPage(I->second);
+		mPageReloadCount++;
+	}
+	mDirtyPages.clear();
+}
+
+unsigned long EmberEntityLoader::getPageChangeCount() const
+{
+	return mPageChangeCount;
+}
+
+unsigned long EmberEntityLoader::getPageReloadCount() const
+{
+	return mPageReloadCount;
+}
+
+unsigned long EmberEntityLoader::getPageLoadCount() const
+{
+	return mPageLoadCount;
 }
 
 void EmberEntityLoader::loadPage(::Forests::PageInfo & page)
 {
 	static Ogre::ColourValue colour(1, 1, 1, 1);
 
-#if EMBERENTITYLOADER_USEBATCH
-	const int batchX = static_cast<int>(Ogre::Math::Floor(page.bounds.left/ mBatchSize));
-	const int batchY = static_cast<int>(Ogre::Math::Floor(page.bounds.top / mBatchSize));
-	EntityMap& entities(mEntities[batchX][batchY]);
-#else
-	EntityMap& entities(mEntities);
-#endif
+	mPageLoadCount++;
 
-	for (EntityMap::iterator I = entities.begin(); I != entities.end(); ++I) {
-		ModelRepresentationInstance& instance(I->second);
+	//The page bounds are aligned with the cells, so only the cell at the centre of the page needs to be looked at.
+	CellStore::const_iterator cellI = mCells.find(getCellKey(page.centerPoint));
+	if (cellI == mCells.end()) {
+		return;
+	}
+
+	for (InstanceSet::const_iterator I = cellI->second.begin(); I != cellI->second.end(); ++I) {
+		ModelRepresentationInstance& instance(**I);
 		Model::ModelRepresentation* modelRepresentation(instance.modelRepresentation);
 		EmberEntity& emberEntity = modelRepresentation->getEntity();
 		if (emberEntity.isVisible()) {
-			WFMath::Point<3> viewPos = emberEntity.getViewPosition();
-			if (viewPos.isValid()) {
-				Ogre::Vector3 pos(Convert::toOgre(viewPos));
-				Model::Model& model(modelRepresentation->getModel());
-				Ogre::Node* node = model.getParentNode();
-				if (node) {
-					const Ogre::Vector3& pos = node->_getDerivedPosition();
-					if (pos.x > page.bounds.left && pos.x < page.bounds.right && pos.z > page.bounds.top && pos.z < page.bounds.bottom) {
-						for (Model::Model::SubModelSet::const_iterator J = model.getSubmodels().begin(); J != model.getSubmodels().end(); ++J) {
-							// 				if (!(*J)->getEntity()->getParentSceneNode()) {
-							// 					model->getParentSceneNode()->attachObject((*J)->getEntity());
-							// 				}
-							//  				if ((*J)->getEntity()->isVisible()) {
-							addEntity((*J)->getEntity(), pos, node->_getDerivedOrientation(), modelRepresentation->getScale(), colour);
-							// 					(*J)->getEntity()->setVisible(false);
-							//  				}
-						}
+			Model::Model& model(modelRepresentation->getModel());
+			Ogre::Node* node = model.getParentNode();
+			if (node) {
+				const Ogre::Vector3& pos = node->_getDerivedPosition();
+				if (pos.x > page.bounds.left && pos.x < page.bounds.right && pos.z > page.bounds.top && pos.z < page.bounds.bottom) {
+					for (Model::Model::SubModelSet::const_iterator J = model.getSubmodels().begin(); J != model.getSubmodels().end(); ++J) {
+						addEntity((*J)->getEntity(), pos, node->_getDerivedOrientation(), modelRepresentation->getScale(), colour);
 					}
 				}
 			}
@@ -223,29 +210,30 @@ void EmberEntityLoader::loadPage(::Forests::PageInfo & page)
 
 void EmberEntityLoader::EmberEntity_Moved(EmberEntity* entity)
 {
-	EntityMap* entityMap(getStoreForEntity(entity));
-	if (entityMap) {
-		EntityMap::iterator I = entityMap->find(entity->getId());
-		if (I != entityMap->end()) {
-			ModelRepresentationInstance& instance(I->second);
-			if (!instance.lastPosition.isNaN()) {
-				mGeom.reloadGeometryPage(instance.lastPosition);
-			}
-			WFMath::Point<3> viewPos = entity->getViewPosition();
-			if (viewPos.isValid()) {
-				mGeom.reloadGeometryPage(Convert::toOgre(viewPos));
-				instance.lastPosition = Convert::toOgre(viewPos);
-			}
+	EntityMap::iterator I = mEntities.find(entity->getId());
+	if (I != mEntities.end()) {
+		ModelRepresentationInstance& instance(I->second);
+		if (!instance.lastPosition.isNaN()) {
+			markPageDirty(instance.lastPosition);
+			removeFromCell(instance);
+		}
+		WFMath::Point<3> viewPos = entity->getViewPosition();
+		if (viewPos.isValid()) {
+			instance.lastPosition = Convert::toOgre(viewPos);
+			addToCell(instance);
+			markPageDirty(instance.lastPosition);
+		} else {
+			instance.lastPosition = Ogre::Vector3(std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN(), std::numeric_limits<Ogre::Real>::quiet_NaN());
 		}
 	}
 }
 
 void EmberEntityLoader::EmberEntity_VisibilityChanged(bool visible, EmberEntity* entity)
 {
-	WFMath::Point<3> viewPos = entity->getViewPosition();
-	if (viewPos.isValid()) {
+	EntityMap::iterator I = mEntities.find(entity->getId());
+	if (I != mEntities.end() && !I->second.lastPosition.isNaN()) {
 		//When the visibility changes, we only need to reload the page the entity is on.
-		mGeom.reloadGeometryPage(Convert::toOgre(viewPos));
+		markPageDirty(I->second.lastPosition);
 	}
 }
 
@@ -253,4 +241,3 @@ void EmberEntityLoader::EmberEntity_VisibilityChanged(bool visible, EmberEntity*
 
 }
 }
-
@@ -26,10 +26,8 @@
 #include "pagedgeometry/include/PagedGeometry.h"
 #include <sigc++/connection.h>
 #include <unordered_map>
-
-//If set to 1 batches will be used.
-//This will speed up the process of getting trees, but will add overhead to adding or removing.
-#define EMBERENTITYLOADER_USEBATCH 0
+#include <map>
+#include <set>
 
 namespace Ember
 {
@@ -44,6 +42,7 @@ namespace Ember
 
     namespace Environment
     {
+      class ExclusiveEntityTracker;
 
       /**
        @author Erik Hjortsber <erik.hjortsberg@gmail.com>
@@ -86,24 +85,29 @@ namespace Ember
 
        Use addEmberEntity to add entities, and removeEmberEntity to remove them.
 
-       The storage of entities can either use a straight up map, or use batches, where each batch corresponds to a page in the paged geometry. The latter is more efficient when generating the pages needed by the paged geometry engine, but requires more memory and is less effective when adding or removing entities. The batching can be turned on and off through the EMBERENTITYLOADER_USEBATCH define.
+       Besides the main store, the entities are kept in cells the size of the pages, so that loading a page only needs to look at the entities on it. When an entity is added, moved or removed only its cell is updated.
+       Changing an entity requires the pages it's on to be rebuilt. Instead of doing that at once the pages are marked as dirty, and reloadDirtyPages() should be called once each frame, so that many changes to the same page only result in one rebuild.
        */
       class EmberEntityLoader : public ::Forests::PageLoader
       {
       public:
         typedef std::unordered_map<std::string, ModelRepresentationInstance> EntityMap;
-        typedef std::map<int, EntityMap> EntityColumn;
-        typedef std::map<int, EntityColumn> EntityStore;
-        typedef std::unordered_map<Model::ModelRepresentation*,
-            std::pair<int, int>> EntityLookup;
+
+        /**
+         * @brief The x and z index of a cell or a page.
+         */
+        typedef std::pair<int, int> PageKey;
+        typedef std::set<ModelRepresentationInstance*> InstanceSet;
+        typedef std::map<PageKey, InstanceSet> CellStore;
 
         /**
          * @brief Ctor.
          * @param geom The geometry for which this class will provide entity loading.
-         * @param batchSize The size of each batch. Only relevant if batching is used.
+         * @param batchSize The size of each cell, which should be the same as the page size of the paged geometry.
+         * @param entityTracker The tracker used by the exclusive pages, which needs to be told when entities are removed.
          */
         EmberEntityLoader(::Forests::PagedGeometry &geom,
-            unsigned int batchSize);
+            unsigned int batchSize, ExclusiveEntityTracker& entityTracker);
 
         /**
          * Dtor.
@@ -133,23 +137,46 @@ namespace Ember
         virtual void
         loadPage(::Forests::PageInfo &page);
 
-      protected:
-#if EMBERENTITYLOADER_USEBATCH
         /**
-         @brief The batched store in which the EntityInstance instances are stored.
+         * @brief Reloads all pages which have been changed since the last call.
+         * This should be called once each frame, before the paged geometry is updated.
          */
-        EntityStore mEntities;
+        void
+        reloadDirtyPages();
 
         /**
-         @brief A lookup map, used for looking up which column and segment any EntityInstance is stored. Use this in combination with mEntities to access the EntityMap where a specific entity can be found.
+         * @brief Gets the number of times a page has been marked as dirty, including pages which already were dirty.
          */
-        EntityLookup mEntityLookup;
-#else
+        unsigned long
+        getPageChangeCount() const;
+
+        /**
+         * @brief Gets the number of times a page has been reloaded.
+         */
+        unsigned long
+        getPageReloadCount() const;
+
+        /**
+         * @brief Gets the number of times a page has been loaded by the paged geometry, at any detail level.
+         */
+        unsigned long
+        getPageLoadCount() const;
+
+      protected:
         /**
          @brief The main store where we keep our EntityInstance instances.
          */
         EntityMap mEntities;
-#endif
+
+        /**
+         @brief The instances with a valid position, stored by the cell they're in.
+         */
+        CellStore mCells;
+
+        /**
+         @brief The pages which need to be reloaded, with a position within each.
+         */
+        std::map<PageKey, Ogre::Vector3> mDirtyPages;
 
         /**
          @brief The main paged geometry instance which will handle all rendering.
@@ -157,10 +184,19 @@ namespace Ember
         ::Forests::PagedGeometry &mGeom;
 
         /**
-         @brief The size, in world units, for each batch. Only relevant if batching is used.
+         @brief The size, in world units, of each cell.
          */
         unsigned int mBatchSize;
 
+        /**
+         @brief The tracker used by the exclusive pages for hiding entities.
+         */
+        ExclusiveEntityTracker& mEntityTracker;
+
+        unsigned long mPageChangeCount;
+        unsigned long mPageReloadCount;
+        unsigned long mPageLoadCount;
+
         /**
          * @brief Listen for movements of the entity and update the paged geometry accordingly.
          * @param entity The entity which was moved.
@@ -177,13 +213,24 @@ namespace Ember
         EmberEntity_VisibilityChanged(bool visible, EmberEntity* entity);
 
         /**
-         * @brief Utility method for getting the EntityMap a certain entity belongs to.
-         * Since we support batching, getting the EntityMap where an entity is located can require some further lookups if batching is enabled. This method should be used by any other method that needs to do such a lookup.
-         * @param entity The which we should lookup.
-         * @return A pointer to the EntityMap where the entity is stored, or null if no entity map can be found.
+         * @brief Gets the cell which contains a position.
+         * The cells are aligned with the bounds of the pages passed to loadPage().
          */
-        EntityMap*
-        getStoreForEntity(EmberEntity * entity);
+        PageKey
+        getCellKey(const Ogre::Vector3& position) const;
+
+        /**
+         * @brief Marks the page containing the position as dirty, so that it's reloaded by the next call to reloadDirtyPages().
+         * @param position A valid position.
+         */
+        void
+        markPageDirty(const Ogre::Vector3& position);
+
+        void
+        addToCell(ModelRepresentationInstance& instance);
+
+        void
+        removeFromCell(ModelRepresentationInstance& instance);
       };
 
     }
@@ -0,0 +1,68 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ExclusiveBatchPage.h"
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+ExclusiveBatchPage::~ExclusiveBatchPage()
+{
+}
+
+void ExclusiveBatchPage::init(Forests::PagedGeometry *geom, const Ogre::Any &data)
+{
+	//The data of the BatchPage is the manual Lod level to use; we always batch the full meshes.
+	BatchPage::init(geom, Ogre::Any());
+	if (!data.isEmpty()) {
+		mEntities.setTracker(Ogre::any_cast<ExclusiveEntityTracker*>(data));
+	}
+}
+
+void ExclusiveBatchPage::addEntity(Ogre::Entity *ent, const Ogre::Vector3 &position, const Ogre::Quaternion &rotation, const Ogre::Vector3 &scale, const Ogre::ColourValue &color)
+{
+	BatchPage::addEntity(ent, position, rotation, scale, color);
+	mEntities.add(ent);
+}
+
+void ExclusiveBatchPage::setVisible(bool visible)
+{
+	BatchPage::setVisible(visible);
+	mEntities.setVisible(visible);
+}
+
+void ExclusiveBatchPage::removeEntities()
+{
+	BatchPage::removeEntities();
+	mEntities.clear();
+}
+
+}
+
+}
+
+}
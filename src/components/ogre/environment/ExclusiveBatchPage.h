@@ -0,0 +1,71 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EXCLUSIVEBATCHPAGE_H_
+#define EXCLUSIVEBATCHPAGE_H_
+
+#include "pagedgeometry/include/BatchPage.h"
+#include "ExclusiveEntityTracker.h"
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+/**
+ * @brief An exclusive batch page, which hides the entities while the batched variant of them is shown.
+ *
+ * The meshes of all entities on the page are merged into batches, so that the whole page is rendered with one draw call per material instead of one per sub entity.
+ * This works in the same way as ExclusiveImposterPage, and is meant to be used between the PassiveEntityPage and the ExclusiveImposterPage.
+ *
+ * The data supplied when adding the detail level must be a pointer to an ExclusiveEntityTracker, shared with any other exclusive pages.
+ *
+ * @note Any entity added to this page can't be transient as a reference to it is stored.
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class ExclusiveBatchPage: public Forests::BatchPage
+{
+public:
+
+	virtual ~ExclusiveBatchPage();
+
+	void init(Forests::PagedGeometry *geom, const Ogre::Any &data);
+
+	void addEntity(Ogre::Entity *ent, const Ogre::Vector3 &position, const Ogre::Quaternion &rotation, const Ogre::Vector3 &scale, const Ogre::ColourValue &color);
+
+	void setVisible(bool visible);
+	void removeEntities();
+
+protected:
+
+	/**
+	 * @brief The entities used on this page.
+	 */
+	ExclusivePageEntities mEntities;
+};
+
+}
+
+}
+
+}
+
+#endif /* EXCLUSIVEBATCHPAGE_H_ */
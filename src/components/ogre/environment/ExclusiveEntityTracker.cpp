@@ -0,0 +1,142 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ExclusiveEntityTracker.h"
+
+#include <OgreEntity.h>
+
+#include <algorithm>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+void ExclusiveEntityTracker::hide(Ogre::Entity* entity)
+{
+	if (++mHideCounts[entity] == 1) {
+		entity->setVisible(false);
+	}
+}
+
+void ExclusiveEntityTracker::show(Ogre::Entity* entity)
+{
+	std::unordered_map<Ogre::Entity*, unsigned int>::iterator I = mHideCounts.find(entity);
+	if (I != mHideCounts.end()) {
+		if (--I->second == 0) {
+			mHideCounts.erase(I);
+			entity->setVisible(true);
+		}
+	}
+}
+
+void ExclusiveEntityTracker::forget(Ogre::Entity* entity)
+{
+	for (std::set<ExclusivePageEntities*>::const_iterator I = mPages.begin(); I != mPages.end(); ++I) {
+		(*I)->remove(entity);
+	}
+	if (mHideCounts.erase(entity)) {
+		entity->setVisible(true);
+	}
+}
+
+void ExclusiveEntityTracker::registerPage(ExclusivePageEntities* page)
+{
+	mPages.insert(page);
+}
+
+void ExclusiveEntityTracker::deregisterPage(ExclusivePageEntities* page)
+{
+	mPages.erase(page);
+}
+
+ExclusivePageEntities::ExclusivePageEntities() :
+		mTracker(0), mVisible(false)
+{
+}
+
+ExclusivePageEntities::~ExclusivePageEntities()
+{
+	if (mTracker) {
+		mTracker->deregisterPage(this);
+	}
+}
+
+void ExclusivePageEntities::setTracker(ExclusiveEntityTracker* tracker)
+{
+	if (mTracker) {
+		mTracker->deregisterPage(this);
+	}
+	mTracker = tracker;
+	if (mTracker) {
+		mTracker->registerPage(this);
+	}
+}
+
+void ExclusivePageEntities::add(Ogre::Entity* entity)
+{
+	mEntities.push_back(entity);
+	if (mVisible && mTracker) {
+		mTracker->hide(entity);
+	}
+}
+
+void ExclusivePageEntities::setVisible(bool visible)
+{
+	if (visible == mVisible) {
+		return;
+	}
+	mVisible = visible;
+	if (mTracker) {
+		for (std::vector<Ogre::Entity*>::const_iterator I = mEntities.begin(); I != mEntities.end(); ++I) {
+			if (visible) {
+				mTracker->hide(*I);
+			} else {
+				mTracker->show(*I);
+			}
+		}
+	}
+}
+
+void ExclusivePageEntities::clear()
+{
+	if (mVisible && mTracker) {
+		for (std::vector<Ogre::Entity*>::const_iterator I = mEntities.begin(); I != mEntities.end(); ++I) {
+			mTracker->show(*I);
+		}
+	}
+	mEntities.clear();
+}
+
+void ExclusivePageEntities::remove(Ogre::Entity* entity)
+{
+	mEntities.erase(std::remove(mEntities.begin(), mEntities.end(), entity), mEntities.end());
+}
+
+}
+
+}
+
+}
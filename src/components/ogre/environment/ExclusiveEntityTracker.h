@@ -0,0 +1,157 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EXCLUSIVEENTITYTRACKER_H_
+#define EXCLUSIVEENTITYTRACKER_H_
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace Ogre
+{
+class Entity;
+}
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+class ExclusivePageEntities;
+
+/**
+ * @brief Keeps track of which entities are currently replaced by an exclusive page, and so should be hidden.
+ *
+ * When fading between two detail levels, pages of both levels are shown at the same time, and they are shown and hidden in no particular order.
+ * Each entity therefore has a count of the pages which currently replace it, and it's only shown again when that count reaches zero.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class ExclusiveEntityTracker
+{
+public:
+
+	/**
+	 * @brief Registers that a page replaces the entity, hiding it if it was shown.
+	 * @param entity The entity.
+	 */
+	void hide(Ogre::Entity* entity);
+
+	/**
+	 * @brief Registers that a page doesn't replace the entity anymore, showing it if there are no other pages replacing it.
+	 * Entities which aren't tracked, for example because they have been forgotten, are ignored.
+	 * @param entity The entity.
+	 */
+	void show(Ogre::Entity* entity);
+
+	/**
+	 * @brief Stops tracking the entity, removes it from all pages and shows it.
+	 * This should be called when the entity isn't handled by the paged geometry anymore, before it's destroyed, since the pages otherwise would keep referring to it until they're reloaded.
+	 * @param entity The entity.
+	 */
+	void forget(Ogre::Entity* entity);
+
+	/**
+	 * @brief Registers a page, so that forgotten entities can be removed from it.
+	 */
+	void registerPage(ExclusivePageEntities* page);
+
+	/**
+	 * @brief Deregisters a page.
+	 */
+	void deregisterPage(ExclusivePageEntities* page);
+
+private:
+
+	/**
+	 * @brief All pages using the tracker.
+	 */
+	std::set<ExclusivePageEntities*> mPages;
+
+	/**
+	 * @brief The number of pages replacing each hidden entity.
+	 */
+	std::unordered_map<Ogre::Entity*, unsigned int> mHideCounts;
+};
+
+/**
+ * @brief The entities added to an exclusive page, which are hidden while the page is visible.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class ExclusivePageEntities
+{
+public:
+
+	ExclusivePageEntities();
+
+	~ExclusivePageEntities();
+
+	/**
+	 * @brief Sets the tracker to use. If none is set the entities are never hidden.
+	 * @param tracker The tracker.
+	 */
+	void setTracker(ExclusiveEntityTracker* tracker);
+
+	/**
+	 * @brief Adds an entity, hiding it if the page is visible.
+	 * @param entity The entity.
+	 */
+	void add(Ogre::Entity* entity);
+
+	/**
+	 * @brief Sets whether the page is visible, hiding or showing all entities.
+	 * @param visible True if the page is visible.
+	 */
+	void setVisible(bool visible);
+
+	/**
+	 * @brief Removes all entities, showing them if the page is visible.
+	 */
+	void clear();
+
+	/**
+	 * @brief Removes an entity without showing it.
+	 * This is used by the tracker when the entity is forgotten.
+	 * @param entity The entity.
+	 */
+	void remove(Ogre::Entity* entity);
+
+private:
+
+	ExclusiveEntityTracker* mTracker;
+
+	std::vector<Ogre::Entity*> mEntities;
+
+	/**
+	 * @brief True if the page is visible, and the entities are hidden.
+	 */
+	bool mVisible;
+};
+
+}
+
+}
+
+}
+
+#endif /* EXCLUSIVEENTITYTRACKER_H_ */
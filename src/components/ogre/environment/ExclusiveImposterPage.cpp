@@ -30,35 +30,31 @@ namespace Ember
       {
       }
 
+      void
+      ExclusiveImposterPage::init(Forests::PagedGeometry *geom,
+          const Ogre::Any &data)
+      {
+        ImpostorPage::init(geom, data);
+        if (!data.isEmpty())
+          {
+            mEntities.setTracker(Ogre::any_cast<ExclusiveEntityTracker*>(data));
+          }
+      }
+
       void
       ExclusiveImposterPage::addEntity(Ogre::Entity *ent,
           const Ogre::Vector3 &position, const Ogre::Quaternion &rotation,
           const Ogre::Vector3 &scale, const Ogre::ColourValue &color)
       {
         ImpostorPage::addEntity(ent, position, rotation, scale, color);
-        mEntities.push_back(ent);
+        mEntities.add(ent);
       }
 
       void
       ExclusiveImposterPage::setVisible(bool visible)
       {
         ImpostorPage::setVisible(visible);
-        if (visible)
-          {
-            for (EntityStore::const_iterator I(mEntities.begin());
-                I != mEntities.end(); ++I)
-              {
-                (*I)->setVisible(false);
-              }
-          }
-        else
-          {
-            for (EntityStore::const_iterator I(mEntities.begin());
-                I != mEntities.end(); ++I)
-              {
-                (*I)->setVisible(true);
-              }
-          }
+        mEntities.setVisible(visible);
       }
 
       void
@@ -20,6 +20,7 @@
 #define EXCLUSIVEIMPOSTERPAGE_H_
 
 #include "pagedgeometry/include/ImpostorPage.h"
+#include "ExclusiveEntityTracker.h"
 
 namespace Ember
 {
@@ -38,19 +39,18 @@ namespace Environment
  * When the imposter isn't shown anymore (often by the user moving the camera closer to the entity) the entity is restored again.
  * This page mainly of use together with the PassiveEntityPage, where you want the entities to be shown normally when up close, and with imposters far away.
  *
+ * The data supplied when adding the detail level must be a pointer to an ExclusiveEntityTracker, shared with any other exclusive pages.
+ *
  * @note Any entity added to this page can't be transient as a reference to it is stored.
  */
 class ExclusiveImposterPage : public Forests::ImpostorPage
 {
 public:
 
-	/**
-	 * @brief A store of entity pointers.
-	 */
-	typedef std::vector<Ogre::Entity*> EntityStore;
-
 	virtual ~ExclusiveImposterPage();
 
+	void init(Forests::PagedGeometry *geom, const Ogre::Any &data);
+
 	void addEntity(Ogre::Entity *ent, const Ogre::Vector3 &position, const Ogre::Quaternion &rotation, const Ogre::Vector3 &scale, const Ogre::ColourValue &color);
 
 	void setVisible(bool visible);
@@ -61,7 +61,7 @@ protected:
 	/**
 	 * @brief The entities used on this page.
 	 */
-	EntityStore mEntities;
+	ExclusivePageEntities mEntities;
 };
 
 }
@@ -46,7 +46,7 @@ FoliageDetailManager::~FoliageDetailManager()
 
 void FoliageDetailManager::initialize()
 {
-	mChangeRequiredConnection = mGraphicalChangeAdapter.EventChangeRequired.connect(sigc::mem_fun(*this, &FoliageDetailManager::changeLevel));
+	mChangeRequiredConnection = mGraphicalChangeAdapter.connectSubsystem("foliage", sigc::mem_fun(*this, &FoliageDetailManager::changeLevel));
 	mConfigListenerContainer->registerConfigListener("graphics", "foliagedensity", sigc::mem_fun(*this, &FoliageDetailManager::Config_FoliageDensity));
 	mConfigListenerContainer->registerConfigListener("graphics", "foliagefardistance", sigc::mem_fun(*this, &FoliageDetailManager::Config_FoliageFarDistance));
 }
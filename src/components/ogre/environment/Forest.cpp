@@ -27,8 +27,11 @@
 #include "Forest.h"
 #include "EmberEntityLoader.h"
 #include "ExclusiveImposterPage.h"
+#include "ExclusiveBatchPage.h"
+#include "ExclusiveEntityTracker.h"
 
 #include "framework/LoggingInstance.h"
+#include "framework/ConsoleBackend.h"
 #include "services/config/ConfigService.h"
 #include "pagedgeometry/include/PagedGeometry.h"
 #include "pagedgeometry/include/TreeLoader3D.h"
@@ -46,6 +49,8 @@
 #include "../terrain/TerrainHandler.h"
 #include "../terrain/ISceneManagerAdapter.h"
 
+#include <sstream>
+
 namespace Ember
 {
 namespace OgreView
@@ -55,7 +60,7 @@ namespace Environment
 {
 
 Forest::Forest(Terrain::TerrainManager& terrainManager) :
-	mTerrainManager(terrainManager), mTrees(0), mTreeLoader(0), mEntityLoader(0), mMaxRange(500)
+	ReportStats("forest_stats", this, "Prints the number of times pages in the forest have been changed, reloaded and loaded."), mTerrainManager(terrainManager), mTrees(0), mTreeLoader(0), mEntityLoader(0), mEntityTracker(new ExclusiveEntityTracker()), mMaxRange(500)
 {
 	Ogre::Root::getSingleton().addFrameListener(this);
 	mTerrainManager.getHandler().EventWorldSizeChanged.connect(sigc::mem_fun(*this, &Forest::worldSizeChanged));
@@ -66,6 +71,8 @@ Forest::~Forest()
 	delete mEntityLoader;
 	delete mTreeLoader;
 	delete mTrees;
+	//The pages of the paged geometry use the tracker, so it must be deleted last.
+	delete mEntityTracker;
 	Ogre::Root::getSingleton().removeFrameListener(this);
 }
 
@@ -90,13 +97,14 @@ void Forest::initialize()
 			}
 		}
 		mTrees->setBounds(ogreBounds);
-		// 	mTrees->addDetailLevel<Forests::BatchPage>(150, 50);		//Use batches up to 150 units away, and fade for 30 more units
-		//  mTrees->addDetailLevel<Forests::DummyPage>(100, 0);		//Use batches up to 150 units away, and fade for 30 more units
-		mTrees->addDetailLevel<Forests::PassiveEntityPage> (150, 0); //Use standard entities up to 150 units away, and don't fade since the PassiveEntityPage doesn't support this (yet)
-		mTrees->addDetailLevel<ExclusiveImposterPage> (mMaxRange, 50); //Use impostors up to 400 units, and for for 50 more units
+		//The batch and impostor pages hide the entities they replace; the tracker makes sure that entities stay hidden while pages of both levels are shown during the fade between them.
+		const Ogre::Any trackerData(mEntityTracker);
+		mTrees->addDetailLevel<Forests::PassiveEntityPage> (75, 0); //Use standard entities up to 75 units away, and don't fade since the entities themselves can't be faded
+		mTrees->addDetailLevel<ExclusiveBatchPage> (250, 50, trackerData); //Use batches up to 250 units away, and fade into impostors for 50 more units
+		mTrees->addDetailLevel<ExclusiveImposterPage> (mMaxRange, 50, trackerData); //Use impostors up to the max range, and fade out for 50 more units
 
 		//Create a new TreeLoader2D object
-		mEntityLoader = new EmberEntityLoader(*mTrees, 64);
+		mEntityLoader = new EmberEntityLoader(*mTrees, 64, *mEntityTracker);
 		// 	mTreeLoader = new Forests::TreeLoader3D(mTrees, Convert::toOgre(worldSize));
 		mTrees->setPageLoader(mEntityLoader); //Assign the "treeLoader" to be used to load geometry for the PagedGeometry instance
 	}
@@ -120,6 +128,8 @@ bool Forest::frameStarted(const Ogre::FrameEvent & evt)
 {
 	if (mTrees) {
 		try {
+			//Reload all pages changed since the last frame in one go, so that pages with many changes are only rebuilt once.
+			mEntityLoader->reloadDirtyPages();
 			mTrees->update();
 		} catch (const std::exception& ex) {
 			S_LOG_FAILURE("Error when updating forest. Will disable forest."<< ex);
@@ -134,6 +144,19 @@ bool Forest::frameStarted(const Ogre::FrameEvent & evt)
 	return true;
 }
 
+void Forest::runCommand(const std::string &command, const std::string &args)
+{
+	if (ReportStats == command) {
+		std::stringstream ss;
+		if (mEntityLoader) {
+			ss << "Forest: " << mEntityLoader->getPageChangeCount() << " page changes, " << mEntityLoader->getPageReloadCount() << " page reloads, " << mEntityLoader->getPageLoadCount() << " page loads.";
+		} else {
+			ss << "The forest hasn't been initialized.";
+		}
+		ConsoleBackend::getSingleton().pushMessage(ss.str(), "info");
+	}
+}
+
 void Forest::addEmberEntity(Model::ModelRepresentation* modelRepresentation)
 {
 	if (mEntityLoader) {
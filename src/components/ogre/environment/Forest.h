@@ -25,6 +25,7 @@
 
 #include <OgreMath.h>
 #include <OgreFrameListener.h>
+#include "framework/ConsoleObject.h"
 #include <sigc++/trackable.h>
 
 namespace Forests {
@@ -53,11 +54,12 @@ class EmberEntity;
 namespace Environment {
 
 class EmberEntityLoader;
+class ExclusiveEntityTracker;
 
 /**
 	@author Erik Hjortsberg <erik.hjortsberg@gmail.com>
 */
-class Forest : public Ogre::FrameListener, public virtual sigc::trackable
+class Forest : public Ogre::FrameListener, public virtual sigc::trackable, public ConsoleObject
 {
 public:
     Forest(Terrain::TerrainManager& terrainManager);
@@ -74,6 +76,16 @@ public:
 
 	bool frameStarted(const Ogre::FrameEvent & evt);
 
+	/**
+	 * @copydoc ConsoleObject::runCommand
+	 */
+	virtual void runCommand(const std::string &command, const std::string &args);
+
+	/**
+	 * @brief Prints the number of page changes, reloads and loads.
+	 */
+	const ConsoleCommandWrapper ReportStats;
+
 protected:
 
 	Terrain::TerrainManager& mTerrainManager;
@@ -81,6 +93,11 @@ protected:
 	Forests::TreeLoader3D *mTreeLoader;
 	EmberEntityLoader* mEntityLoader;
 
+	/**
+	 * @brief Keeps track of the entities hidden by the batch and impostor pages.
+	 */
+	ExclusiveEntityTracker* mEntityTracker;
+
 	/**
 	 * @brief The max range for entities to be rendered in the forest.
 	 */
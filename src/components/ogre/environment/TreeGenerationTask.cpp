@@ -0,0 +1,83 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "TreeGenerationTask.h"
+#include "TreeGenerator.h"
+
+#include <OgreDataStream.h>
+
+#include <fstream>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+TreeGenerationTask::TreeGenerationTask(TreeGenerator& generator, const std::string& meshName, const std::string& cachePath, Ogre::TParameters::TreeType type, unsigned char season, int seed) :
+		mGenerator(generator), mMeshName(meshName), mCachePath(cachePath), mType(type), mSeason(season), mSeed(seed)
+{
+}
+
+TreeGenerationTask::~TreeGenerationTask()
+{
+}
+
+void TreeGenerationTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	std::ifstream file(mCachePath.c_str(), std::ios::in | std::ios::binary);
+	if (file) {
+		Ogre::DataStreamPtr stream(OGRE_NEW Ogre::FileStreamDataStream(&file, false));
+		mCachedStream = Ogre::DataStreamPtr(OGRE_NEW Ogre::MemoryDataStream(mCachePath, stream));
+	} else {
+		grow();
+	}
+}
+
+void TreeGenerationTask::grow()
+{
+	//The number of levels is replaced by the one of the tree type when it's set.
+	Ogre::TParameters parameters(2);
+	parameters.Set(mType);
+
+	Ogre::Tree tree(mMeshName, &parameters, mSeason, mSeed);
+	tree.Grow();
+	tree.CreateGeometry(mGeometry);
+}
+
+void TreeGenerationTask::executeTaskInMainThread()
+{
+	if (!mCachedStream.isNull()) {
+		if (mGenerator.treeLoaded(mMeshName, mCachedStream)) {
+			return;
+		}
+		//The cache file was broken; generate the tree anew and overwrite it.
+		grow();
+	}
+	mGenerator.treeGenerated(mMeshName, mCachePath, mGeometry);
+}
+
+}
+}
+}
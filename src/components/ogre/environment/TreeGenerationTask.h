@@ -0,0 +1,88 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef TREEGENERATIONTASK_H_
+#define TREEGENERATIONTASK_H_
+
+#include "meshtree/MeshTree.h"
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <string>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+class TreeGenerator;
+
+/**
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ * @brief Generates the geometry of a tree, or reads it from the cache, in a background thread.
+ *
+ * The mesh is then created by the TreeGenerator in the main thread.
+ */
+class TreeGenerationTask: public Tasks::TemplateNamedTask<TreeGenerationTask>
+{
+public:
+	/**
+	 * @brief Ctor.
+	 * @param generator The generator, which will receive the result in the main thread.
+	 * @param meshName The name of the mesh to create.
+	 * @param cachePath The path of the cache file.
+	 * @param type The type of tree.
+	 * @param season The season.
+	 * @param seed The seed.
+	 */
+	TreeGenerationTask(TreeGenerator& generator, const std::string& meshName, const std::string& cachePath, Ogre::TParameters::TreeType type, unsigned char season, int seed);
+
+	virtual ~TreeGenerationTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+private:
+	TreeGenerator& mGenerator;
+	const std::string mMeshName;
+	const std::string mCachePath;
+	const Ogre::TParameters::TreeType mType;
+	const unsigned char mSeason;
+	const int mSeed;
+
+	/**
+	 * @brief The contents of the cache file, if there was one.
+	 */
+	Ogre::DataStreamPtr mCachedStream;
+
+	/**
+	 * @brief The generated geometry, if there was no cache file.
+	 */
+	Ogre::TreeGeometry mGeometry;
+
+	void grow();
+};
+
+}
+}
+}
+
+#endif /* TREEGENERATIONTASK_H_ */
@@ -0,0 +1,188 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "TreeGenerator.h"
+#include "TreeGenerationTask.h"
+#include "meshtree/MeshTree.h"
+
+#include "framework/LoggingInstance.h"
+#include "framework/osdir.h"
+#include "framework/TimeFrame.h"
+#include "framework/tasks/TaskQueue.h"
+
+#include <OgreMaterialManager.h>
+#include <OgreMeshManager.h>
+#include <OgreMeshSerializer.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+
+#include <sstream>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Environment
+{
+
+namespace
+{
+/**
+ * @brief The version of the cache; increase this whenever the tree generation changes, to make sure that old meshes aren't used.
+ */
+const unsigned int CACHE_VERSION = 1;
+}
+
+TreeGenerator::TreeGenerator(const std::string& cacheDirectory, unsigned int numberOfThreads) :
+		mCacheDirectory(cacheDirectory), mTaskQueue(new Tasks::TaskQueue(numberOfThreads))
+{
+	try {
+		oslink::directory osdir(mCacheDirectory);
+		if (!osdir) {
+			oslink::directory::mkdir(mCacheDirectory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for tree cache." << ex);
+	}
+	createMaterials();
+	Ogre::Root::getSingleton().addFrameListener(this);
+}
+
+TreeGenerator::~TreeGenerator()
+{
+	Ogre::Root::getSingleton().removeFrameListener(this);
+	//This will process any outstanding tasks, so it must be done while Ogre is still around.
+	delete mTaskQueue;
+}
+
+void TreeGenerator::createMaterials()
+{
+	Ogre::MaterialManager& materialManager = Ogre::MaterialManager::getSingleton();
+	const std::string& group = Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME;
+
+	if (!materialManager.resourceExists("BarkTextMat")) {
+		Ogre::MaterialPtr barkMat = materialManager.create("BarkTextMat", group);
+		barkMat->getTechnique(0)->getPass(0)->createTextureUnitState("tree_bark.jpg");
+	}
+
+	if (!materialManager.resourceExists("LeafTextMat")) {
+		Ogre::MaterialPtr leafMat = materialManager.create("LeafTextMat", group);
+		Ogre::Pass* pass = leafMat->getTechnique(0)->getPass(0);
+		pass->createTextureUnitState("tree_leaves_pack1.tga");
+		pass->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+		pass->setCullingMode(Ogre::CULL_NONE);
+		pass->setManualCullingMode(Ogre::MANUAL_CULL_NONE);
+		pass->setLightingEnabled(true);
+		pass->setDiffuse(0.9f, 1.0f, 0.9f, 1.0f);
+		pass->setAmbient(0.5f, 0.6f, 0.5f);
+	}
+
+	if (!materialManager.resourceExists("CoordFrameMat")) {
+		Ogre::MaterialPtr coordFrameMat = materialManager.create("CoordFrameMat", group);
+		Ogre::Pass* pass = coordFrameMat->getTechnique(0)->getPass(0);
+		pass->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
+		pass->setLightingEnabled(false);
+	}
+}
+
+std::string TreeGenerator::getCacheName(Ogre::TParameters::TreeType type, unsigned char season, int seed)
+{
+	std::stringstream ss;
+	ss << "tree_" << CACHE_VERSION << "_" << static_cast<int>(type) << "_" << static_cast<int>(season) << "_" << seed << ".mesh";
+	return ss.str();
+}
+
+void TreeGenerator::generate(const std::string& meshName, Ogre::TParameters::TreeType type, unsigned char season, int seed)
+{
+	mTaskQueue->enqueueTask(new TreeGenerationTask(*this, meshName, mCacheDirectory + getCacheName(type, season, seed), type, season, seed));
+}
+
+void TreeGenerator::generateVariants(const std::string& meshNamePrefix, Ogre::TParameters::TreeType type, unsigned char season, unsigned int variants)
+{
+	for (unsigned int i = 0; i < variants; ++i) {
+		std::stringstream ss;
+		ss << meshNamePrefix << "/" << i;
+		generate(ss.str(), type, season, static_cast<int>(i));
+	}
+}
+
+void TreeGenerator::treeGenerated(const std::string& meshName, const std::string& cachePath, const Ogre::TreeGeometry& geometry)
+{
+	Ogre::MeshManager& meshManager = Ogre::MeshManager::getSingleton();
+	if (meshManager.resourceExists(meshName)) {
+		S_LOG_WARNING("Tree mesh " << meshName << " already exists; will not generate it again.");
+		return;
+	}
+
+	try {
+		Ogre::MeshPtr mesh = Ogre::Tree::CreateMesh(meshName, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME, geometry);
+		//The sub meshes are the stems, followed by the leaves and the coordinate frames, if there are any.
+		unsigned short subMeshIndex = 0;
+		mesh->getSubMesh(subMeshIndex++)->setMaterialName("BarkTextMat");
+		if (!geometry.leavesIndices.empty()) {
+			mesh->getSubMesh(subMeshIndex++)->setMaterialName("LeafTextMat");
+		}
+		if (!geometry.coordFrameIndices.empty()) {
+			mesh->getSubMesh(subMeshIndex++)->setMaterialName("CoordFrameMat");
+		}
+
+		Ogre::MeshSerializer serializer;
+		serializer.exportMesh(mesh.get(), cachePath);
+		S_LOG_INFO("Generated tree mesh " << meshName << " and stored it in " << cachePath << ".");
+	} catch (const Ogre::Exception& ex) {
+		S_LOG_FAILURE("Error when generating tree mesh " << meshName << "." << ex);
+	}
+}
+
+bool TreeGenerator::treeLoaded(const std::string& meshName, Ogre::DataStreamPtr& stream)
+{
+	Ogre::MeshManager& meshManager = Ogre::MeshManager::getSingleton();
+	if (meshManager.resourceExists(meshName)) {
+		S_LOG_WARNING("Tree mesh " << meshName << " already exists; will not load it again.");
+		return true;
+	}
+
+	Ogre::MeshPtr mesh = meshManager.createManual(meshName, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+	try {
+		Ogre::MeshSerializer serializer;
+		serializer.importMesh(stream, mesh.get());
+		S_LOG_VERBOSE("Loaded tree mesh " << meshName << " from the cache.");
+		return true;
+	} catch (const Ogre::Exception& ex) {
+		S_LOG_WARNING("Error when loading tree mesh " << meshName << " from the cache; it will be generated anew." << ex);
+		meshManager.remove(mesh->getHandle());
+		return false;
+	}
+}
+
+bool TreeGenerator::frameStarted(const Ogre::FrameEvent& evt)
+{
+	mTaskQueue->pollProcessedTasks(TimeFrame(boost::posix_time::milliseconds(2)));
+	return true;
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,135 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef TREEGENERATOR_H_
+#define TREEGENERATOR_H_
+
+#include "meshtree/TParameters.h"
+
+#include <OgreFrameListener.h>
+
+#include <string>
+
+namespace Ogre
+{
+struct TreeGeometry;
+}
+
+namespace Ember
+{
+namespace Tasks
+{
+class TaskQueue;
+}
+namespace OgreView
+{
+
+namespace Environment
+{
+
+/**
+ * @brief Generates procedural tree meshes in background threads, keeping the results on disk between sessions.
+ *
+ * Growing a tree and building its geometry is done by a TreeGenerationTask, in a background thread. Only the creation of the hardware buffers is done in the main thread, when the task is done.
+ * Each generated mesh is then written to the cache directory as a .mesh file, keyed by the tree type, the season and the seed. Since the same seed always results in the same tree, later sessions can just load that file instead.
+ * Loading cached meshes goes through the same task queue, so that the file reading also happens in the background.
+ *
+ * The meshes are created in the default resource group, with materials "BarkTextMat" for the stems, "LeafTextMat" for the leaves and "CoordFrameMat" for the coordinate frames of the "Simple" tree type.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class TreeGenerator: public Ogre::FrameListener
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param cacheDirectory The directory where generated meshes are stored. It will be created if it doesn't exist.
+	 * @param numberOfThreads The number of threads to generate trees in.
+	 */
+	TreeGenerator(const std::string& cacheDirectory, unsigned int numberOfThreads);
+
+	virtual ~TreeGenerator();
+
+	/**
+	 * @brief Queues the generation of a tree mesh.
+	 * The mesh will be available under the supplied name once generated, which happens in a later frame.
+	 * @param meshName The name of the mesh to create.
+	 * @param type The type of tree.
+	 * @param season The season, which affects the leaves.
+	 * @param seed The seed for the random values. The same seed always results in the same tree.
+	 */
+	void generate(const std::string& meshName, Ogre::TParameters::TreeType type, unsigned char season, int seed);
+
+	/**
+	 * @brief Queues the generation of a number of variants of a tree type, which are generated in parallel.
+	 * The meshes will be named "<meshNamePrefix>/<index>", with the index used as the seed.
+	 * @param meshNamePrefix The prefix of the mesh names.
+	 * @param type The type of tree.
+	 * @param season The season, which affects the leaves.
+	 * @param variants The number of variants.
+	 */
+	void generateVariants(const std::string& meshNamePrefix, Ogre::TParameters::TreeType type, unsigned char season, unsigned int variants);
+
+	/**
+	 * @brief Gets the name of the cache file for a tree, without the directory.
+	 * @param type The type of tree.
+	 * @param season The season.
+	 * @param seed The seed.
+	 */
+	static std::string getCacheName(Ogre::TParameters::TreeType type, unsigned char season, int seed);
+
+	/**
+	 * @brief Creates the mesh of a generated tree, and stores it in the cache.
+	 * This is called by TreeGenerationTask in the main thread.
+	 * @param meshName The name of the mesh.
+	 * @param cachePath The path of the cache file.
+	 * @param geometry The geometry of the tree.
+	 */
+	void treeGenerated(const std::string& meshName, const std::string& cachePath, const Ogre::TreeGeometry& geometry);
+
+	/**
+	 * @brief Creates the mesh of a cached tree.
+	 * This is called by TreeGenerationTask in the main thread.
+	 * @param meshName The name of the mesh.
+	 * @param stream The contents of the cache file.
+	 * @return True if the mesh could be loaded.
+	 */
+	bool treeLoaded(const std::string& meshName, Ogre::DataStreamPtr& stream);
+
+	virtual bool frameStarted(const Ogre::FrameEvent& evt);
+
+private:
+
+	std::string mCacheDirectory;
+
+	Tasks::TaskQueue* mTaskQueue;
+
+	/**
+	 * @brief Creates the materials used by the trees, unless they already exist.
+	 */
+	void createMaterials();
+};
+
+}
+
+}
+
+}
+
+#endif /* TREEGENERATOR_H_ */
@@ -30,22 +30,21 @@ namespace Caelum
 {
   /** POD for bright star catalogue entries.
    *  Only J2000 position and magnitude included.
+   *  The position is a unit vector in equatorial coordinates; x points
+   *  towards right ascension 0, and z towards the celestial north pole.
    */
   struct BrightStarCatalogueEntry
   {
-    signed char rasc_hour;
-    signed char rasc_min;
-    float rasc_sec;
-    signed char decl_deg;
-    signed char decl_min;
-    float decl_sec;
+    float x;
+    float y;
+    float z;
     float magn;
   };
 
   /// There are exactly 9110 stars in our version of the BSC.
   const int BrightStarCatalogueSize = 9110;
 
-  /// Hardcoded bright star catalogue (BrightStarCatalogue.cpp)
+  /// Hardcoded bright star catalogue (BrightStarCatalogue.cpp), sorted by magnitude.
   extern const BrightStarCatalogueEntry BrightStarCatalogue[BrightStarCatalogueSize];
 
   /** Point starfield class.
@@ -57,6 +56,9 @@ namespace Caelum
    * 
    *  Loading a bright-star catalogue is supported but star positions are
    *  likely only correct relative to each other. External rotation is probably wrong.
+   *
+   *  The geometry only depends on the stars; the observer position is applied
+   *  as a rotation of the scene node, so changing it doesn't rebuild anything.
    */
   class CAELUM_EXPORT PointStarfield : public CameraBoundElement
   {
@@ -75,8 +77,8 @@ namespace Caelum
     /// Struct representing one star inside PointStarfield.
     struct Star
     {
-      Ogre::Degree RightAscension;
-      Ogre::Degree Declination;
+      /// Unit vector towards the star, in J2000 equatorial coordinates.
+      Ogre::Vector3 Direction;
       Ogre::Real Magnitude;
     };
 
@@ -135,12 +137,22 @@ namespace Caelum
 
     Ogre::Degree mObserverLatitude, mObserverLongitude;
 
+    /// Rotation from the star vertices to the sky of the observer.
+    Ogre::Quaternion mObserverOrientation;
+
     bool mValidGeometry;
     void
     invalidateGeometry();
     void
     ensureGeometry();
 
+    /// Direction of an equatorial position as seen by the observer.
+    Ogre::Vector3
+    getObserverDirection(LongReal rasc, LongReal decl) const;
+
+    void
+    updateObserverOrientation();
+
   public:
     /** Update function; called from CaelumSystem::updateSubcomponents
      @param time Time of the day.
@@ -217,12 +229,12 @@ namespace Caelum
     Ogre::Degree mObserverPositionRebuildDelta;
 
   public:
-    /** Moving the observer position around causes a starfield rebuild.
+    /** Moving the observer position less than this is ignored.
      *  Default value (DEFAULT_OBSERVER_POSITION_REBUILD_DELTA) is 0.1
      *  degrees which is equivalent to around 170 meters on the earth.
      *
-     *  This only matters if you compute the observer position every
-     *  frame. Caelum doesn't contain code for that.
+     *  Moving the observer only changes the orientation of the starfield,
+     *  so this is cheap either way.
      */
     inline Ogre::Degree
     getObserverPositionRebuildDelta() const
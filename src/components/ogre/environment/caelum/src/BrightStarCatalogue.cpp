@@ -22,9119 +22,9119 @@
 #include "PointStarfield.h"
 
 // Data from http://heasarc.gsfc.nasa.gov/W3Browse/star-catalog/bsc5p.html
-// Converted using the following MSVS regexps:
-// ^\|0*{:d+} 0*{:d+} 0*{[0-9.]+}\|{[+\-]}0*{:d+} 0*{:d+} 0*{[0-9.]+}\|{.*}\|$
-// { \(2,1), \(2,2), \(5,3), \4\(2,5), \(2,6), \(4,7),\(5, 8) },
+// Converted from sexagesimal right ascension and declination to unit vectors,
+// with x = cos(rasc) * cos(decl), y = sin(rasc) * cos(decl), z = sin(decl),
+// and sorted by magnitude, brightest first.
+// Entries without a magnitude in the source data have magnitude 0.
 const Caelum::BrightStarCatalogueEntry Caelum::BrightStarCatalogue[BrightStarCatalogueSize] =
   {
-    { 21, 8, 46.20, -88, 57, 23.0, 5.47 },
-    { 22, 45, 28.61, -88, 49, 5.9, 6.57 },
-    { 15, 28, 19.10, -88, 7, 59.2, 6.48 },
-    { 18, 54, 46.90, -87, 36, 20.9, 5.28 },
-    { 17, 15, 59.30, -87, 33, 59.0, 6.57 },
-    { 23, 28, 3.70, -87, 28, 55.9, 5.49 },
-    { 6, 46, 58.70, -87, 1, 30.0, 6.47 },
-    { 17, 0, 58.49, -86, 21, 51.8, 6.04 },
-    { 12, 25, 37.49, -86, 9, 2.2, 6.33 },
-    { 22, 31, 37.39, -85, 58, 1.9, 5.77 },
-    { 13, 40, 55.49, -85, 47, 10.0, 5.58 },
-    { 8, 56, 41.09, -85, 39, 47.2, 5.42 },
-    { 12, 2, 20.11, -85, 37, 54.1, 6.05 },
-    { 3, 42, 32.11, -85, 15, 43.9, 6.41 },
-    { 18, 1, 34.10, -85, 12, 52.9, 6.45 },
-    { 12, 54, 58.61, -85, 7, 23.9, 5.46 },
-    { 0, 13, 19.39, -84, 59, 39.1, 5.77 },
-    { 21, 32, 4.20, -84, 48, 36.0, 6.45 },
-    { 15, 11, 8.30, -84, 47, 15.0, 5.91 },
-    { 5, 30, 13.90, -84, 47, 6.0, 6.20 },
-    { 1, 37, 28.01, -84, 46, 10.9, 5.69 },
-    { 10, 59, 13.80, -84, 35, 38.0, 6.19 },
-    { 15, 43, 16.80, -84, 27, 55.1, 5.57 },
-    { 14, 26, 54.89, -83, 40, 4.1, 4.32 },
-    { 18, 51, 57.89, -83, 18, 59.0, 7.16 },
-    { 20, 24, 54.41, -83, 18, 38.2, 6.17 },
-    { 16, 45, 53.59, -83, 14, 20.0, 6.57 },
-    { 15, 1, 50.81, -83, 13, 40.1, 5.65 },
-    { 11, 41, 1.20, -83, 6, .0, 6.33 },
-    { 15, 4, 46.70, -83, 2, 17.9, 5.65 },
-    { 1, 37, 55.61, -82, 58, 30.0, 5.87 },
-    { 4, 22, 50.90, -82, 53, 57.1, 6.76 },
-    { 14, 24, 23.30, -82, 50, 55.0, 6.42 },
-    { 21, 50, 54.31, -82, 43, 9.1, 5.29 },
-    { 21, 33, 54.41, -82, 40, 59.2, 6.38 },
-    { 13, 55, 38.71, -82, 39, 58.0, 5.95 },
-    { 4, 58, 50.90, -82, 28, 14.2, 5.85 },
-    { 0, 10, 2.09, -82, 13, 26.0, 5.28 },
-    { 10, 0, 43.70, -82, 12, 52.9, 5.52 },
-    { 23, 57, 32.71, -82, 10, 12.0, 5.73 },
-    { 23, 52, 6.41, -82, 1, 8.0, 5.11 },
-    { 10, 31, 51.00, -81, 55, 16.0, 7.07 },
-    { 18, 42, 14.09, -81, 48, 28.1, 6.27 },
-    { 4, 20, 57.89, -81, 34, 48.0, 5.79 },
-    { 10, 4, 7.61, -81, 33, 56.9, 6.60 },
-    { 10, 59, 12.91, -81, 33, 22.0, 6.71 },
-    { 5, 12, 25.70, -81, 32, 30.1, 6.51 },
-    { 18, 5, 26.69, -81, 29, 11.0, 6.35 },
-    { 22, 46, 3.31, -81, 22, 54.1, 4.15 },
-    { 19, 56, 1.51, -81, 20, 58.9, 6.39 },
-    { 20, 38, 18.60, -81, 17, 20.0, 5.91 },
-    { 14, 18, 13.80, -81, 0, 28.1, 4.91 },
-    { 20, 33, 17.50, -80, 57, 54.0, 5.77 },
-    { 9, 33, 53.21, -80, 56, 29.0, 5.11 },
-    { 8, 24, 19.80, -80, 54, 51.1, 5.69 },
-    { 23, 12, 12.00, -80, 54, 46.1, 6.41 },
-    { 17, 31, 27.29, -80, 51, 33.1, 5.88 },
-    { 6, 40, 2.71, -80, 48, 49.0, 5.64 },
-    { 9, 24, 9.10, -80, 47, 12.8, 5.36 },
-    { 10, 45, 46.80, -80, 32, 25.1, 4.45 },
-    { 10, 45, 15.70, -80, 28, 10.9, 5.47 },
-    { 5, 37, 9.79, -80, 28, 9.1, 5.65 },
-    { 22, 20, 1.51, -80, 26, 22.9, 5.10 },
-    { 18, 29, 19.49, -80, 13, 58.1, 5.95 },
-    { 4, 17, 59.09, -80, 12, 50.0, 5.69 },
-    { 1, 47, 46.51, -80, 10, 36.1, 6.06 },
-    { 22, 50, 22.90, -80, 7, 27.1, 5.35 },
-    { 14, 22, 22.70, -80, 6, 32.0, 5.06 },
-    { 21, 33, 20.59, -80, 2, 21.1, 6.47 },
-    { 10, 41, 51.29, -79, 46, 59.9, 5.97 },
-    { 11, 18, 34.30, -79, 40, 7.0, 6.35 },
-    { 10, 52, 27.50, -79, 33, 33.8, 6.33 },
-    { 8, 45, 55.20, -79, 30, 15.8, 5.79 },
-    { 23, 8, 23.71, -79, 28, 50.9, 6.12 },
-    { 23, 19, 8.11, -79, 28, 22.1, 6.33 },
-    { 21, 38, 56.21, -79, 26, 33.0, 6.18 },
-    { 6, 56, 34.39, -79, 25, 13.1, 5.45 },
-    { 5, 50, 16.70, -79, 21, 41.0, 5.47 },
-    { 12, 18, 20.69, -79, 18, 43.9, 4.26 },
-    { 11, 42, 55.39, -79, 18, 23.0, 6.39 },
-    { 1, 41, 21.31, -79, 8, 53.9, 6.33 },
-    { 2, 31, 40.51, -79, 6, 33.8, 5.28 },
-    { 7, 25, 37.99, -79, 5, 39.1, 5.53 },
-    { 8, 43, 12.41, -79, 4, 10.9, 6.05 },
-    { 14, 47, 51.60, -79, 2, 40.9, 3.83 },
-    { 3, 7, 31.99, -78, 59, 21.8, 5.57 },
-    { 8, 41, 19.51, -78, 57, 47.9, 5.47 },
-    { 16, 33, 27.00, -78, 53, 49.9, 3.89 },
-    { 5, 35, 36.31, -78, 49, 14.9, 6.05 },
-    { 23, 44, 40.70, -78, 47, 29.0, 5.75 },
-    { 0, 16, 49.01, -78, 46, 50.2, 6.77 },
-    { 22, 35, 26.40, -78, 46, 18.1, 6.15 },
-    { 16, 20, 20.81, -78, 41, 44.9, 4.68 },
-    { 16, 20, 26.81, -78, 40, 1.9, 5.27 },
-    { 10, 35, 28.10, -78, 36, 28.1, 4.11 },
-    { 14, 0, 32.81, -78, 35, 24.0, 6.09 },
-    { 12, 13, 55.70, -78, 34, 25.0, 6.35 },
-    { 1, 33, 39.19, -78, 30, 16.9, 6.11 },
-    { 13, 14, 17.21, -78, 26, 49.9, 5.85 },
-    { 3, 29, 58.80, -78, 21, 6.8, 5.70 },
-    { 1, 55, 50.50, -78, 20, 53.9, 6.16 },
-    { 3, 36, 30.00, -78, 19, 23.2, 6.29 },
-    { 5, 0, 13.20, -78, 18, 1.1, 6.29 },
-    { 11, 59, 37.30, -78, 13, 18.8, 4.91 },
-    { 15, 39, 18.29, -77, 55, 5.2, 6.18 },
-    { 18, 47, 49.39, -77, 52, 1.9, 6.39 },
-    { 14, 16, 54.89, -77, 39, 50.0, 6.47 },
-    { 22, 1, 52.10, -77, 39, 45.0, 6.41 },
-    { 4, 38, 21.70, -77, 39, 22.0, 6.05 },
-    { 7, 36, 4.20, -77, 38, 3.1, 6.18 },
-    { 11, 21, 57.10, -77, 36, 29.9, 6.43 },
-    { 13, 33, 14.81, -77, 34, 5.9, 6.48 },
-    { 16, 43, 4.61, -77, 31, 3.0, 4.24 },
-    { 22, 17, 50.50, -77, 30, 42.1, 5.51 },
-    { 8, 20, 38.50, -77, 29, 3.8, 4.35 },
-    { 0, 21, 28.61, -77, 25, 36.8, 5.97 },
-    { 21, 41, 28.49, -77, 23, 24.0, 3.76 },
-    { 3, 15, 57.60, -77, 23, 17.9, 5.52 },
-    { 23, 33, 19.49, -77, 23, 7.1, 5.81 },
-    { 0, 25, 45.10, -77, 15, 15.1, 2.80 },
-    { 15, 0, 11.81, -77, 9, 37.1, 5.93 },
-    { 0, 1, 35.71, -77, 3, 56.9, 4.78 },
-    { 22, 49, 40.90, -77, 3, 2.2, 6.73 },
-    { 21, 4, 43.01, -77, 1, 26.0, 5.15 },
-    { 8, 18, 31.61, -76, 55, 10.9, 4.07 },
-    { 23, 38, 24.10, -76, 52, 12.0, 6.00 },
-    { 14, 5, 19.80, -76, 47, 48.1, 5.50 },
-    { 9, 46, 20.59, -76, 46, 34.0, 5.45 },
-    { 14, 29, 36.79, -76, 43, 45.1, 6.07 },
-    { 9, 12, 12.31, -76, 39, 47.2, 6.14 },
-    { 14, 57, 52.90, -76, 39, 46.1, 5.34 },
-    { 12, 4, 46.51, -76, 31, 9.1, 5.04 },
-    { 5, 31, 52.90, -76, 20, 28.0, 5.19 },
-    { 10, 35, 24.79, -76, 18, 33.1, 6.30 },
-    { 21, 8, 47.90, -76, 12, 45.0, 6.58 },
-    { 20, 42, 2.90, -76, 10, 50.2, 6.00 },
-    { 17, 57, 41.81, -76, 10, 39.0, 6.07 },
-    { 22, 3, 3.79, -76, 7, 7.0, 5.95 },
-    { 22, 11, 55.30, -76, 6, 58.0, 6.15 },
-    { 15, 41, 54.60, -76, 4, 54.8, 5.95 },
-    { 0, 15, 55.20, -75, 54, 41.0, 6.49 },
-    { 11, 37, 15.60, -75, 53, 48.1, 5.65 },
-    { 18, 11, 15.70, -75, 53, 29.0, 5.86 },
-    { 22, 10, 42.50, -75, 52, 50.2, 6.55 },
-    { 13, 39, 11.90, -75, 41, 2.0, 6.34 },
-    { 12, 39, 14.50, -75, 22, 9.8, 6.49 },
-    { 12, 7, 49.80, -75, 22, .8, 5.18 },
-    { 20, 41, 43.70, -75, 21, 2.2, 6.55 },
-    { 21, 18, 16.10, -75, 20, 48.1, 6.63 },
-    { 11, 19, 36.29, -75, 8, 33.0, 6.27 },
-    { 10, 57, 15.70, -75, 5, 58.9, 6.13 },
-    { 2, 50, 28.51, -75, 4, .8, 4.75 },
-    { 18, 23, 36.10, -75, 2, 39.1, 5.47 },
-    { 14, 59, 55.99, -75, 1, 57.0, 6.20 },
-    { 22, 25, 51.00, -75, 0, 56.2, 6.04 },
-    { 4, 55, 11.21, -74, 56, 12.8, 5.47 },
-    { 0, 48, 35.40, -74, 55, 23.9, 5.07 },
-    { 9, 17, 25.39, -74, 53, 39.8, 5.29 },
-    { 13, 25, 7.10, -74, 53, 16.1, 5.05 },
-    { 14, 8, 27.10, -74, 51, 1.1, 6.02 },
-    { 6, 10, 14.40, -74, 45, 11.2, 5.09 },
-    { 9, 17, 27.41, -74, 44, 4.9, 5.86 },
-    { 13, 27, 18.29, -74, 41, 30.8, 6.63 },
-    { 17, 16, 35.59, -74, 31, 59.2, 6.25 },
-    { 10, 39, 16.61, -74, 29, 37.0, 6.07 },
-    { 7, 35, 21.79, -74, 16, 32.2, 7.26 },
-    { 7, 35, 21.70, -74, 16, 32.2, 7.16 },
-    { 3, 47, 14.30, -74, 14, 20.0, 3.24 },
-    { 12, 3, 44.30, -74, 12, 50.0, 6.44 },
-    { 10, 24, 23.71, -74, 1, 54.1, 4.00 },
-    { 10, 24, 44.30, -73, 58, 18.1, 6.19 },
-    { 18, 32, 55.30, -73, 57, 56.2, 5.89 },
-    { 5, 34, 44.69, -73, 44, 29.0, 5.78 },
-    { 18, 12, 34.49, -73, 40, 18.1, 5.85 },
-    { 2, 22, 52.30, -73, 38, 44.9, 5.01 },
-    { 23, 8, 35.69, -73, 35, 11.0, 6.15 },
-    { 15, 40, 21.19, -73, 26, 48.1, 5.65 },
-    { 8, 22, 4.39, -73, 24, .0, 5.29 },
-    { 15, 31, 30.79, -73, 23, 21.8, 5.49 },
-    { 8, 32, 42.19, -73, 21, 24.1, 6.12 },
-    { 7, 59, 16.10, -73, 14, 40.9, 6.34 },
-    { 0, 10, 38.59, -73, 13, 27.8, 6.64 },
-    { 10, 31, 1.99, -73, 13, 18.1, 4.93 },
-    { 14, 53, 13.70, -73, 11, 24.0, 5.60 },
-    { 21, 9, 22.30, -73, 10, 23.2, 5.68 },
-    { 0, 38, 40.80, -73, 8, 13.9, 6.85 },
-    { 6, 43, 36.79, -73, 7, 5.2, 6.37 },
-    { 9, 31, 36.29, -73, 4, 50.9, 5.47 },
-    { 5, 6, 9.29, -73, 2, 16.1, 6.27 },
-    { 12, 32, 10.01, -73, 0, 6.1, 5.88 },
-    { 18, 49, 43.49, -72, 59, 40.9, 6.06 },
-    { 20, 0, 35.50, -72, 54, 38.2, 3.96 },
-    { 0, 4, 30.70, -72, 53, 52.1, 7.31 },
-    { 15, 12, 33.79, -72, 46, 13.1, 6.01 },
-    { 5, 47, 48.10, -72, 42, 7.9, 6.53 },
-    { 12, 16, 23.50, -72, 36, 52.9, 6.22 },
-    { 7, 41, 49.20, -72, 36, 22.0, 3.95 },
-    { 9, 5, 8.81, -72, 36, 10.1, 4.48 },
-    { 8, 49, 50.30, -72, 33, 2.9, 6.11 },
-    { 21, 11, 20.69, -72, 32, 39.1, 6.20 },
-    { 19, 49, 25.30, -72, 30, 11.9, 5.41 },
-    { 11, 28, 18.19, -72, 28, 27.8, 6.09 },
-    { 10, 44, 26.50, -72, 26, 38.0, 6.27 },
-    { 4, 53, 5.50, -72, 24, 27.0, 6.28 },
-    { 16, 5, 55.80, -72, 24, 2.9, 5.70 },
-    { 11, 24, 11.09, -72, 15, 24.1, 5.59 },
-    { 22, 24, 36.79, -72, 15, 20.2, 5.29 },
-    { 17, 44, 19.70, -72, 13, 14.9, 6.49 },
-    { 12, 56, 31.51, -72, 11, 7.1, 5.93 },
-    { 13, 22, 52.61, -72, 8, 48.1, 6.05 },
-    { 12, 32, 28.01, -72, 7, 59.2, 3.87 },
-    { 0, 24, 5.80, -72, 4, 52.0, },
-    { 13, 19, 18.91, -72, 2, 8.2, 6.04 },
-    { 11, 20, 3.91, -71, 59, 39.8, 6.41 },
-    { 10, 30, 20.11, -71, 59, 35.2, 4.74 },
-    { 12, 49, 44.90, -71, 59, 11.0, 5.55 },
-    { 15, 7, 8.71, -71, 54, 19.1, 6.52 },
-    { 3, 2, 15.41, -71, 54, 9.0, 5.53 },
-    { 21, 25, 18.10, -71, 47, 57.8, 6.09 },
-    { 6, 40, 57.79, -71, 46, 32.2, 6.51 },
-    { 6, 15, 5.90, -71, 42, 10.1, 6.64 },
-    { 9, 27, 6.41, -71, 36, 7.9, 5.47 },
-    { 13, 2, 16.20, -71, 32, 56.0, 3.62 },
-    { 8, 19, 49.01, -71, 30, 54.0, 5.37 },
-    { 8, 20, .70, -71, 30, 19.1, 5.65 },
-    { 12, 2, 28.61, -71, 29, 20.0, 6.42 },
-    { 13, 3, 5.21, -71, 28, 34.0, 6.03 },
-    { 0, 4, 41.30, -71, 26, 12.8, 5.59 },
-    { 11, 11, 29.50, -71, 26, 11.0, 6.35 },
-    { 18, 43, 2.11, -71, 25, 41.2, 4.01 },
-    { 9, 56, 9.70, -71, 23, 21.8, 6.35 },
-    { 5, 2, 43.01, -71, 18, 51.8, 5.31 },
-    { 0, 33, 23.30, -71, 15, 58.0, 6.13 },
-    { 21, 45, 28.80, -71, 0, 32.0, 6.01 },
-    { 16, 34, 19.30, -70, 59, 17.2, 5.50 },
-    { 6, 51, 27.00, -70, 57, 47.9, 5.40 },
-    { 4, 43, 3.91, -70, 55, 52.0, 5.54 },
-    { 11, 6, 49.90, -70, 52, 41.2, 5.57 },
-    { 10, 44, 19.39, -70, 51, 36.0, 6.26 },
-    { 10, 44, 32.09, -70, 51, 18.0, 6.46 },
-    { 13, 40, .60, -70, 47, 17.9, 6.59 },
-    { 18, 14, 24.10, -70, 45, 5.0, 6.73 },
-    { 17, 12, 19.80, -70, 43, 16.0, 6.22 },
-    { 10, 53, 42.00, -70, 43, 13.1, 5.99 },
-    { 13, 25, 50.11, -70, 37, 39.0, 5.67 },
-    { 9, 5, 38.30, -70, 32, 20.0, 4.71 },
-    { 7, 8, 44.90, -70, 29, 56.0, 3.78 },
-    { 7, 8, 42.19, -70, 29, 49.9, 5.69 },
-    { 23, 44, 25.39, -70, 29, 25.1, 6.07 },
-    { 13, 38, 45.70, -70, 26, 42.0, 6.10 },
-    { 6, 44, 56.09, -70, 26, 2.0, 6.11 },
-    { 22, 25, 10.51, -70, 25, 54.1, 5.78 },
-    { 8, 39, 5.21, -70, 23, 12.8, 5.20 },
-    { 22, 49, 17.40, -70, 20, 52.1, 6.34 },
-    { 14, 10, 30.91, -70, 18, 20.2, 6.05 },
-    { 15, 40, 11.50, -70, 13, 40.1, 6.44 },
-    { 11, 49, 56.59, -70, 13, 32.9, 4.97 },
-    { 12, 12, 46.80, -70, 9, 6.8, 6.17 },
-    { 21, 13, 20.50, -70, 7, 35.0, 5.02 },
-    { 17, 22, 5.90, -70, 7, 23.9, 5.41 },
-    { 8, 27, 16.90, -70, 5, 35.9, 5.53 },
-    { 16, 28, 28.10, -70, 5, 3.8, 4.91 },
-    { 15, 14, 19.10, -70, 4, 45.8, 5.81 },
-    { 22, 54, 39.41, -70, 4, 25.0, 6.05 },
-    { 17, 20, 12.79, -70, 2, 44.2, 6.53 },
-    { 10, 13, 44.21, -70, 2, 17.2, 3.32 },
-    { 6, 22, 38.21, -69, 59, 3.1, 5.56 },
-    { 13, 11, 51.60, -69, 56, 30.8, 5.91 },
-    { 7, 44, 13.01, -69, 49, 17.0, 6.18 },
-    { 21, 24, 16.70, -69, 44, 3.1, 6.41 },
-    { 14, 11, 1.90, -69, 43, 10.9, 6.06 },
-    { 9, 13, 12.00, -69, 43, 1.9, 1.68 },
-    { 6, 25, 28.61, -69, 41, 25.1, 5.38 },
-    { 13, 15, 25.70, -69, 40, 46.9, 6.37 },
-    { 21, 50, 47.11, -69, 37, 45.8, 5.53 },
-    { 13, 28, 46.39, -69, 37, 41.2, 6.20 },
-    { 0, 20, 39.00, -69, 37, 30.0, 5.51 },
-    { 3, 24, 2.50, -69, 37, 28.9, 6.15 },
-    { 20, 35, 51.70, -69, 36, 40.0, 6.11 },
-    { 0, 55, .31, -69, 31, 36.8, 5.45 },
-    { 21, 28, 44.90, -69, 30, 19.1, 5.34 },
-    { 0, 52, 24.29, -69, 30, 15.8, 6.22 },
-    { 12, 42, 5.11, -69, 24, 27.0, 6.33 },
-    { 13, 51, 47.40, -69, 24, 5.0, 5.75 },
-    { 3, 25, 36.19, -69, 20, 11.0, 5.96 },
-    { 16, 59, 33.79, -69, 16, 5.9, 5.79 },
-    { 3, 7, 49.20, -69, 15, 56.2, 6.15 },
-    { 12, 2, 37.70, -69, 11, 31.9, 5.89 },
-    { 19, 16, 28.49, -69, 11, 26.2, 6.27 },
-    { 19, 58, 41.30, -69, 9, 50.0, 5.75 },
-    { 12, 37, 10.99, -69, 8, 8.2, 2.69 },
-    { 9, 56, 59.69, -69, 6, 6.8, 6.20 },
-    { 16, 48, 39.89, -69, 1, 40.1, 1.92 },
-    { 1, 15, 46.10, -68, 52, 34.0, 4.86 },
-    { 6, 8, 44.21, -68, 50, 35.9, 5.06 },
-    { 7, 6, 14.09, -68, 50, 13.9, 6.47 },
-    { 12, 45, 1.70, -68, 49, 52.0, 6.16 },
-    { 23, 4, 52.20, -68, 49, 13.1, 5.52 },
-    { 20, 49, 18.10, -68, 46, 35.0, 5.41 },
-    { 19, 58, 52.99, -68, 45, 43.9, 6.39 },
-    { 19, 3, 29.69, -68, 45, 19.1, 5.88 },
-    { 9, 17, 17.21, -68, 41, 21.8, 5.39 },
-    { 9, 1, 8.50, -68, 41, 2.0, 5.88 },
-    { 10, 9, 30.50, -68, 40, 59.9, 5.81 },
-    { 15, 18, 54.60, -68, 40, 45.8, 2.89 },
-    { 2, 21, 44.90, -68, 39, 33.8, 4.09 },
-    { 12, 6, 19.80, -68, 39, 2.9, 6.23 },
-    { 5, 27, .00, -68, 37, 22.1, 6.03 },
-    { 8, 7, 55.80, -68, 37, 1.9, 4.35 },
-    { 15, 55, 29.59, -68, 36, 11.2, 5.09 },
-    { 19, 31, 10.90, -68, 26, 2.0, 5.96 },
-    { 19, 9, 52.70, -68, 25, 28.9, 5.33 },
-    { 23, 47, 23.30, -68, 23, 39.1, 6.89 },
-    { 19, 24, 5.40, -68, 22, 16.0, 6.34 },
-    { 12, 4, 38.71, -68, 19, 45.1, 5.35 },
-    { 15, 26, 14.69, -68, 18, 33.1, 5.89 },
-    { 12, 22, 11.90, -68, 18, 27.0, 5.74 },
-    { 16, 41, 23.30, -68, 17, 46.0, 5.91 },
-    { 2, 39, 35.40, -68, 16, .8, 4.11 },
-    { 18, 18, .91, -68, 13, 45.1, 6.33 },
-    { 8, 43, 54.31, -68, 12, 42.1, 6.32 },
-    { 21, 1, 28.10, -68, 12, 34.9, 6.37 },
-    { 14, 25, 6.29, -68, 11, 43.1, 5.61 },
-    { 12, 46, 16.90, -68, 6, 29.2, 3.05 },
-    { 12, 17, 34.10, -67, 57, 38.9, 4.11 },
-    { 7, 16, 49.80, -67, 57, 25.9, 3.98 },
-    { 16, 17, 5.50, -67, 56, 29.0, 5.75 },
-    { 14, 37, 46.30, -67, 55, 55.9, 6.04 },
-    { 6, 59, 50.50, -67, 54, 58.0, 5.17 },
-    { 13, 15, 14.90, -67, 53, 39.8, 4.80 },
-    { 2, 14, 14.69, -67, 50, 30.1, 5.55 },
-    { 11, 17, 19.01, -67, 49, 25.0, 6.06 },
-    { 17, 21, 59.40, -67, 46, 14.2, 4.78 },
-    { 2, 15, 28.51, -67, 44, 47.0, 5.69 },
-    { 14, 31, 16.51, -67, 43, 1.9, 5.83 },
-    { 16, 52, 17.40, -67, 40, 54.8, 6.32 },
-    { 13, 54, 48.91, -67, 39, 9.0, 5.71 },
-    { 1, 54, 56.09, -67, 38, 49.9, 4.69 },
-    { 12, 23, 13.80, -67, 37, 54.1, 6.36 },
-    { 11, 37, 48.41, -67, 37, 13.1, 5.96 },
-    { 2, 45, 32.59, -67, 37, .1, 4.84 },
-    { 12, 22, 7.30, -67, 31, 18.8, 5.15 },
-    { 22, 28, 37.70, -67, 29, 21.1, 5.55 },
-    { 15, 20, 40.70, -67, 28, 53.0, 6.28 },
-    { 23, 18, 19.99, -67, 28, 16.0, 6.13 },
-    { 16, 43, 22.10, -67, 25, 57.0, 6.03 },
-    { 20, 5, 32.81, -67, 19, 14.9, 6.07 },
-    { 18, 56, 57.00, -67, 14, 1.0, 4.44 },
-    { 17, 13, 17.50, -67, 11, 48.1, 5.89 },
-    { 12, 38, 52.51, -67, 11, 35.2, 6.25 },
-    { 5, 13, 45.41, -67, 11, 7.1, 4.83 },
-    { 16, 46, 40.01, -67, 6, 34.9, 5.13 },
-    { 15, 9, 29.90, -67, 5, 3.1, 5.76 },
-    { 9, 17, 51.70, -67, 3, 2.9, 6.11 },
-    { 10, 30, 8.71, -66, 59, 6.0, 6.19 },
-    { 11, 32, 19.90, -66, 57, 43.9, 5.90 },
-    { 20, 0, 22.99, -66, 56, 57.8, 5.76 },
-    { 20, 1, 52.39, -66, 56, 39.1, 5.31 },
-    { 3, 17, 58.99, -66, 55, 36.8, 6.05 },
-    { 10, 22, 58.10, -66, 54, 6.1, 4.99 },
-    { 5, 49, 53.59, -66, 54, 4.0, 5.11 },
-    { 23, 10, 11.69, -66, 51, 27.0, 6.47 },
-    { 11, 48, 14.30, -66, 48, 52.9, 4.72 },
-    { 19, 49, 53.30, -66, 48, 46.1, 6.45 },
-    { 8, 50, 34.80, -66, 47, 35.2, 5.35 },
-    { 13, 17, 13.01, -66, 47, 1.0, 4.87 },
-    { 20, 41, 57.10, -66, 45, 38.9, 5.15 },
-    { 11, 45, 36.41, -66, 43, 43.0, 3.64 },
-    { 9, 31, 32.90, -66, 43, 9.8, 6.27 },
-    { 2, 43, 26.59, -66, 42, 51.8, 6.26 },
-    { 9, 28, 30.60, -66, 42, 6.8, 5.91 },
-    { 19, 39, 52.10, -66, 41, 8.2, 6.39 },
-    { 4, 53, 30.50, -66, 40, 32.2, 6.41 },
-    { 19, 17, 12.00, -66, 39, 41.0, 5.53 },
-    { 19, 0, 3.50, -66, 39, 11.9, 6.01 },
-    { 14, 48, 44.40, -66, 35, 38.0, 5.91 },
-    { 14, 16, 38.59, -66, 35, 16.1, 5.75 },
-    { 23, 27, 7.20, -66, 34, 52.0, 6.45 },
-    { 5, 36, 54.70, -66, 33, 37.1, 6.31 },
-    { 12, 39, 55.61, -66, 30, 42.1, 6.26 },
-    { 2, 25, 26.30, -66, 29, 40.9, 6.41 },
-    { 3, 30, 51.60, -66, 29, 22.9, 5.83 },
-    { 1, 17, 3.60, -66, 23, 53.2, 6.24 },
-    { 9, 2, 26.81, -66, 23, 46.0, 4.00 },
-    { 10, 13, 30.60, -66, 22, 23.2, 5.16 },
-    { 20, 8, 20.50, -66, 21, 16.9, 6.45 },
-    { 15, 36, 43.20, -66, 19, .8, 4.11 },
-    { 14, 0, 52.20, -66, 16, 7.0, 5.97 },
-    { 13, 12, 48.91, -66, 13, 36.8, 5.90 },
-    { 20, 44, 57.50, -66, 12, 11.2, 3.42 },
-    { 7, 49, 40.99, -66, 11, 44.9, 5.79 },
-    { 20, 8, 43.61, -66, 10, 54.8, 3.56 },
-    { 14, 25, 39.50, -66, 10, 23.9, 6.36 },
-    { 8, 25, 44.21, -66, 8, 12.8, 3.77 },
-    { 7, 44, 43.90, -66, 4, 18.8, 6.38 },
-    { 1, 59, 41.09, -66, 3, 59.0, 6.10 },
-    { 6, 6, 9.41, -66, 2, 22.9, 5.71 },
-    { 14, 54, 42.41, -65, 59, 29.0, 6.09 },
-    { 19, 41, 37.49, -65, 51, 15.1, 6.09 },
-    { 12, 20, 28.01, -65, 50, 34.1, 6.21 },
-    { 8, 44, 30.00, -65, 49, 32.2, 6.05 },
-    { 14, 27, 7.10, -65, 49, 18.1, 5.85 },
-    { 10, 8, 42.60, -65, 48, 55.1, 5.28 },
-    { 13, 58, 31.20, -65, 48, 2.2, 6.20 },
-    { 12, 25, 17.30, -65, 46, 14.2, 6.30 },
-    { 3, 34, 24.70, -65, 45, 51.8, 6.75 },
-    { 5, 44, 46.39, -65, 44, 8.2, 4.35 },
-    { 12, 6, 23.11, -65, 42, 33.1, 6.06 },
-    { 10, 27, 25.30, -65, 42, 16.9, 6.01 },
-    { 12, 17, 6.00, -65, 41, 34.1, 6.06 },
-    { 13, 33, 35.69, -65, 37, 57.0, 6.37 },
-    { 8, 18, 18.91, -65, 36, 47.9, 5.07 },
-    { 15, 36, 17.40, -65, 36, 47.9, 6.51 },
-    { 19, 51, 1.30, -65, 36, 18.0, 6.05 },
-    { 6, 11, 15.00, -65, 35, 21.8, 5.01 },
-    { 23, 59, 55.01, -65, 34, 37.9, 4.50 },
-    { 6, 30, 3.00, -65, 34, 5.9, 6.29 },
-    { 12, 5, 53.21, -65, 32, 49.9, 6.33 },
-    { 16, 35, 44.81, -65, 29, 43.1, 5.52 },
-    { 17, 53, 18.41, -65, 29, 21.1, 6.49 },
-    { 0, 42, 28.39, -65, 28, 5.2, 5.39 },
-    { 1, 2, 42.91, -65, 27, 22.0, 6.21 },
-    { 15, 47, 53.71, -65, 26, 33.0, 6.39 },
-    { 15, 47, 53.59, -65, 26, 33.0, 6.18 },
-    { 1, 57, 53.59, -65, 25, 28.9, 6.37 },
-    { 11, 39, 29.40, -65, 23, 52.1, 5.17 },
-    { 16, 51, 53.90, -65, 22, 32.2, 6.13 },
-    { 21, 26, 26.59, -65, 21, 58.0, 4.22 },
-    { 13, 8, 7.01, -65, 18, 23.0, 5.51 },
-    { 15, 7, 56.81, -65, 16, 32.2, 6.17 },
-    { 11, 51, 51.19, -65, 12, 22.0, 4.90 },
-    { 15, 52, 56.71, -65, 9, 9.0, 6.54 },
-    { 13, 16, 44.81, -65, 8, 17.9, 6.07 },
-    { 0, 36, 37.39, -65, 7, 28.9, 6.42 },
-    { 10, 40, 11.30, -65, 6, 2.2, 5.52 },
-    { 18, 48, 37.80, -65, 4, 40.1, 5.73 },
-    { 9, 47, 6.70, -65, 4, 21.0, 6.26 },
-    { 9, 47, 6.10, -65, 4, 18.8, 3.01 },
-    { 15, 58, 58.10, -65, 2, 16.1, 5.75 },
-    { 14, 42, 30.41, -64, 58, 31.1, 3.19 },
-    { 22, 27, 19.99, -64, 57, 59.0, 4.48 },
-    { 11, 23, 21.79, -64, 57, 18.0, 5.11 },
-    { 9, 36, 5.11, -64, 57, 2.2, 6.56 },
-    { 9, 26, 44.21, -64, 55, 46.9, 6.05 },
-    { 0, 20, 4.30, -64, 52, 28.9, 4.23 },
-    { 18, 45, 26.90, -64, 52, 17.0, 4.79 },
-    { 11, 6, 24.19, -64, 50, 22.9, 6.41 },
-    { 21, 38, 2.90, -64, 49, 27.1, 6.20 },
-    { 3, 44, 12.00, -64, 48, 24.8, 3.85 },
-    { 17, 45, 43.99, -64, 43, 26.0, 3.62 },
-    { 21, 50, .10, -64, 42, 45.0, 5.62 },
-    { 23, 35, 12.70, -64, 41, 21.8, 7.40 },
-    { 21, 18, .31, -64, 40, 54.1, 6.31 },
-    { 10, 19, 4.80, -64, 40, 35.0, 5.67 },
-    { 13, 29, 7.61, -64, 40, 32.9, 6.11 },
-    { 18, 42, 22.51, -64, 38, 35.2, 6.37 },
-    { 12, 6, 52.90, -64, 36, 49.0, 4.15 },
-    { 8, 25, 51.60, -64, 36, 2.9, 5.97 },
-    { 11, 19, 16.51, -64, 34, 57.0, 5.99 },
-    { 13, 40, 10.90, -64, 34, 36.8, 5.79 },
-    { 18, 43, 37.20, -64, 33, 4.0, 5.78 },
-    { 18, 7, 48.31, -64, 33, .0, 6.41 },
-    { 13, 24, .50, -64, 32, 8.9, 4.53 },
-    { 15, 27, 33.10, -64, 31, 53.0, 5.71 },
-    { 10, 46, 16.51, -64, 30, 54.0, 5.34 },
-    { 7, 28, 51.31, -64, 30, 36.0, 6.39 },
-    { 9, 6, 7.61, -64, 29, 58.9, 6.37 },
-    { 9, 57, 15.19, -64, 29, 21.8, 6.58 },
-    { 13, 25, 13.90, -64, 29, 7.1, 5.31 },
-    { 5, 54, 11.90, -64, 28, 55.9, 6.63 },
-    { 10, 42, 13.99, -64, 27, 59.0, 4.82 },
-    { 2, 54, 20.90, -64, 26, 8.2, 6.56 },
-    { 12, 14, 16.80, -64, 24, 31.0, 6.22 },
-    { 23, 44, 12.00, -64, 24, 15.8, 5.72 },
-    { 10, 42, 57.41, -64, 23, 39.8, 2.76 },
-    { 10, 46, 51.19, -64, 22, 59.9, 4.85 },
-    { 1, 25, 5.30, -64, 22, 9.8, 5.93 },
-    { 12, 28, 18.91, -64, 20, 29.0, 6.04 },
-    { 11, 58, 47.69, -64, 20, 21.1, 5.61 },
-    { 2, 28, 4.39, -64, 17, 58.9, 6.37 },
-    { 23, 57, 35.21, -64, 17, 53.9, 5.00 },
-    { 2, 39, 31.70, -64, 16, 54.8, 6.55 },
-    { 10, 46, 29.69, -64, 15, 47.9, 5.23 },
-    { 10, 43, 51.19, -64, 14, 56.0, 5.77 },
-    { 5, 32, 59.59, -64, 13, 39.0, 5.34 },
-    { 4, 7, 21.60, -64, 13, 21.0, 6.38 },
-    { 10, 28, 52.61, -64, 10, 19.9, 5.29 },
-    { 11, 12, 45.19, -64, 10, 10.9, 5.23 },
-    { 8, 21, 7.70, -64, 6, 22.0, 6.12 },
-    { 2, 58, 47.81, -64, 4, 17.0, 4.99 },
-    { 16, 27, 57.31, -64, 3, 29.2, 5.27 },
-    { 5, 51, 22.99, -64, 2, 1.0, 6.36 },
-    { 15, 4, 48.19, -64, 1, 54.1, 5.17 },
-    { 12, 18, 26.09, -64, 0, 11.2, 4.04 },
-    { 11, 25, 43.20, -63, 58, 22.1, 5.17 },
-    { 10, 44, 6.89, -63, 57, 40.0, 4.82 },
-    { 21, 8, 32.90, -63, 55, 44.0, 5.76 },
-    { 5, 30, 15.91, -63, 55, 40.1, 6.19 },
-    { 18, 19, 40.20, -63, 53, 12.8, 6.18 },
-    { 6, 24, 55.61, -63, 49, 40.1, 6.27 },
-    { 14, 52, 34.99, -63, 48, 36.0, 5.87 },
-    { 8, 8, 24.50, -63, 48, 4.0, 6.28 },
-    { 12, 27, 24.60, -63, 47, 21.1, 6.00 },
-    { 11, 49, 41.09, -63, 47, 17.9, 4.32 },
-    { 16, 1, 10.70, -63, 46, 36.1, 6.41 },
-    { 2, 45, 27.50, -63, 42, 15.8, 5.74 },
-    { 18, 14, 16.20, -63, 41, 21.8, 6.47 },
-    { 13, 57, 38.90, -63, 41, 12.1, 4.71 },
-    { 16, 15, 26.30, -63, 41, 8.2, 3.85 },
-    { 6, 23, 1.30, -63, 40, 59.2, 6.27 },
-    { 18, 8, 34.80, -63, 40, 5.9, 4.35 },
-    { 15, 9, 25.49, -63, 38, 34.1, 6.28 },
-    { 15, 17, 38.90, -63, 36, 38.2, 4.86 },
-    { 8, 0, 19.99, -63, 34, 3.0, 4.82 },
-    { 12, 31, 55.80, -63, 30, 22.0, 5.95 },
-    { 3, 56, 4.01, -63, 27, 49.0, 6.14 },
-    { 15, 55, 8.50, -63, 25, 50.2, 2.85 },
-    { 6, 24, 26.30, -63, 25, 44.0, 6.46 },
-    { 20, 14, 26.90, -63, 24, 56.9, 6.09 },
-    { 5, 7, 34.01, -63, 23, 58.9, 5.20 },
-    { 4, 21, 53.30, -63, 23, 11.0, 5.24 },
-    { 12, 3, 1.51, -63, 18, 46.1, 4.33 },
-    { 13, 11, 53.11, -63, 18, 10.1, 6.33 },
-    { 7, 57, 12.50, -63, 17, 48.8, 6.14 },
-    { 11, 54, 59.81, -63, 16, 44.0, 5.91 },
-    { 16, 55, 24.70, -63, 16, 10.9, 6.02 },
-    { 4, 17, 40.20, -63, 15, 20.2, 5.87 },
-    { 20, 19, 3.00, -63, 13, 52.0, 6.27 },
-    { 4, 44, 57.89, -63, 13, 46.9, 6.46 },
-    { 14, 8, 14.30, -63, 12, 29.2, 6.40 },
-    { 7, 12, 1.99, -63, 11, 24.0, 6.02 },
-    { 22, 52, 9.91, -63, 11, 19.0, 6.12 },
-    { 12, 4, 19.20, -63, 9, 56.2, 4.72 },
-    { 16, 25, 22.01, -63, 7, 28.9, 6.15 },
-    { 12, 26, 30.91, -63, 7, 21.0, 4.86 },
-    { 23, 29, 1.01, -63, 6, 38.9, 5.68 },
-    { 12, 26, 36.50, -63, 5, 57.8, 1.73 },
-    { 12, 26, 35.90, -63, 5, 57.1, 1.33 },
-    { 5, 54, 6.10, -63, 5, 24.0, 4.65 },
-    { 12, 42, 50.30, -63, 3, 31.0, 5.31 },
-    { 18, 15, 40.90, -63, 3, 20.2, 5.60 },
-    { 17, 28, 7.70, -63, 2, 11.0, 6.24 },
-    { 0, 32, 43.80, -63, 1, 52.0, 5.09 },
-    { 18, 25, 31.51, -63, 1, 17.0, 6.14 },
-    { 11, 35, 46.80, -63, 1, 10.9, 3.13 },
-    { 0, 31, 33.60, -62, 57, 56.9, 4.54 },
-    { 0, 31, 32.71, -62, 57, 29.2, 4.37 },
-    { 23, 57, 19.90, -62, 57, 23.0, 5.97 },
-    { 12, 12, 22.01, -62, 57, 2.9, 5.92 },
-    { 3, 29, 22.70, -62, 56, 15.0, 4.72 },
-    { 8, 15, 15.91, -62, 54, 56.9, 5.16 },
-    { 2, 52, 19.20, -62, 54, 34.9, 6.03 },
-    { 20, 39, 51.41, -62, 54, 28.1, 6.22 },
-    { 11, 43, 52.90, -62, 52, 41.9, 6.10 },
-    { 14, 45, 17.30, -62, 52, 32.9, 5.36 },
-    { 0, 53, 37.90, -62, 52, 17.0, 5.70 },
-    { 17, 24, 1.10, -62, 51, 51.1, 5.70 },
-    { 8, 37, 18.79, -62, 51, 13.0, 5.47 },
-    { 23, 49, 44.69, -62, 50, 21.8, 6.59 },
-    { 8, 4, 42.89, -62, 50, 10.0, 6.30 },
-    { 4, 33, 34.01, -62, 49, 25.0, 5.79 },
-    { 2, 49, 1.49, -62, 48, 24.1, 5.26 },
-    { 18, 56, 54.70, -62, 48, 4.0, 6.48 },
-    { 9, 32, 14.59, -62, 47, 20.0, 6.10 },
-    { 14, 56, 43.99, -62, 46, 50.9, 5.11 },
-    { 9, 50, 55.70, -62, 44, 43.1, 5.57 },
-    { 23, 14, 6.60, -62, 42, .0, 6.12 },
-    { 11, 50, 27.19, -62, 38, 57.8, 5.70 },
-    { 15, 53, 22.80, -62, 36, 24.8, 6.19 },
-    { 13, 47, 10.70, -62, 35, 24.0, 6.51 },
-    { 2, 33, 33.60, -62, 35, 12.8, 6.77 },
-    { 3, 17, 46.20, -62, 34, 31.1, 5.54 },
-    { 16, 2, 52.39, -62, 32, 30.1, 6.25 },
-    { 4, 27, 45.91, -62, 31, 14.9, 5.75 },
-    { 9, 45, 14.81, -62, 30, 28.1, 3.69 },
-    { 3, 18, 12.89, -62, 30, 23.0, 5.24 },
-    { 0, 44, 32.30, -62, 29, 52.1, 6.07 },
-    { 5, 33, 37.49, -62, 29, 22.9, 3.76 },
-    { 11, 43, 31.20, -62, 29, 21.8, 5.03 },
-    { 4, 14, 25.51, -62, 28, 26.0, 3.35 },
-    { 11, 57, 40.10, -62, 26, 56.0, 5.57 },
-    { 20, 51, 38.30, -62, 25, 45.1, 6.28 },
-    { 20, 51, 38.81, -62, 25, 45.1, 6.59 },
-    { 11, 6, 32.40, -62, 25, 27.1, 4.61 },
-    { 9, 20, 56.81, -62, 24, 16.9, 4.81 },
-    { 9, 11, 16.61, -62, 19, 1.9, 3.97 },
-    { 5, 29, 17.40, -62, 18, 51.8, 6.59 },
-    { 18, 31, 22.39, -62, 16, 41.9, 4.64 },
-    { 9, 28, 46.99, -62, 16, 23.2, 5.92 },
-    { 4, 14, 48.70, -62, 11, 30.8, 5.45 },
-    { 18, 52, 13.01, -62, 11, 15.0, 4.22 },
-    { 4, 0, 53.81, -62, 9, 33.8, 4.51 },
-    { 10, 2, 49.39, -62, 9, 23.0, 6.42 },
-    { 6, 7, 3.41, -62, 9, 16.9, 5.05 },
-    { 11, 40, 53.59, -62, 5, 24.0, 4.94 },
-    { 4, 36, 45.60, -62, 4, 39.0, 5.40 },
-    { 18, 10, 26.11, -62, 0, 7.9, 5.49 },
-    { 23, 16, 57.70, -62, 0, 4.0, 5.66 },
-    { 22, 33, .10, -61, 58, 55.9, 4.81 },
-    { 9, 25, 27.10, -61, 57, 1.1, 5.77 },
-    { 11, 8, 34.01, -61, 56, 49.9, 5.13 },
-    { 6, 48, 11.40, -61, 56, 29.0, 3.27 },
-    { 21, 55, 11.50, -61, 53, 11.0, 5.90 },
-    { 10, 3, 34.30, -61, 53, 2.0, 6.14 },
-    { 6, 31, 10.61, -61, 52, 46.9, 6.15 },
-    { 12, 35, 28.99, -61, 50, 30.8, 6.22 },
-    { 10, 54, 29.59, -61, 49, 36.1, 5.93 },
-    { 11, 38, 7.30, -61, 49, 35.0, 5.15 },
-    { 12, 28, 25.49, -61, 47, 43.1, 6.22 },
-    { 1, 7, 18.70, -61, 46, 31.1, 5.37 },
-    { 15, 13, 1.01, -61, 44, 38.0, 6.32 },
-    { 13, 37, 12.19, -61, 41, 30.8, 5.63 },
-    { 10, 32, 1.39, -61, 41, 7.1, 3.32 },
-    { 22, 48, 21.41, -61, 41, 3.1, 6.37 },
-    { 17, 10, 6.29, -61, 40, 32.2, 6.39 },
-    { 10, 13, 21.19, -61, 39, 32.0, 6.41 },
-    { 9, 24, 5.69, -61, 38, 56.0, 5.99 },
-    { 16, 30, 49.39, -61, 38, 1.0, 5.20 },
-    { 1, 58, 46.20, -61, 34, 10.9, 2.86 },
-    { 10, 9, 21.89, -61, 32, 57.1, 5.60 },
-    { 6, 38, .60, -61, 31, 59.2, 6.18 },
-    { 20, 37, 35.30, -61, 31, 48.0, 4.88 },
-    { 18, 23, 13.61, -61, 29, 38.0, 4.36 },
-    { 14, 0, 17.30, -61, 28, 53.0, 6.49 },
-    { 15, 10, 44.59, -61, 25, 21.0, 6.30 },
-    { 3, 58, 44.69, -61, 24, 1.1, 4.56 },
-    { 10, 30, 39.19, -61, 21, 22.0, 6.43 },
-    { 10, 17, 4.99, -61, 19, 55.9, 3.40 },
-    { 9, 39, 21.00, -61, 19, 41.2, 4.52 },
-    { 10, 59, 13.99, -61, 19, 13.1, 6.16 },
-    { 8, 9, .70, -61, 18, 9.0, 4.76 },
-    { 11, 37, .60, -61, 16, 59.9, 5.15 },
-    { 11, 31, 15.00, -61, 16, 41.9, 6.38 },
-    { 12, 11, 4.90, -61, 16, 39.0, 6.08 },
-    { 14, 19, 51.50, -61, 16, 23.2, 5.23 },
-    { 4, 25, 5.30, -61, 14, 17.9, 5.94 },
-    { 11, 46, 30.79, -61, 10, 41.9, 4.11 },
-    { 5, 34, 57.60, -61, 10, 32.9, 6.32 },
-    { 19, 54, 40.39, -61, 10, 14.9, 6.24 },
-    { 11, 26, 35.30, -61, 6, 55.1, 5.30 },
-    { 18, 45, 11.50, -61, 5, 42.0, 6.04 },
-    { 4, 1, 18.19, -61, 4, 44.0, 4.97 },
-    { 19, 50, 21.70, -61, 3, 41.0, 6.21 },
-    { 11, 36, 22.30, -61, 3, 7.9, 5.83 },
-    { 3, 32, 51.60, -61, 1, .8, 6.41 },
-    { 16, 38, 52.70, -60, 59, 25.1, 6.18 },
-    { 13, 22, 37.90, -60, 59, 17.9, 4.53 },
-    { 10, 34, 12.91, -60, 59, 16.1, 6.23 },
-    { 12, 45, 37.90, -60, 58, 52.0, 4.69 },
-    { 13, 22, 35.69, -60, 58, 19.9, 6.18 },
-    { 12, 4, 57.10, -60, 58, 9.1, 5.96 },
-    { 9, 0, 45.70, -60, 57, 50.0, 5.79 },
-    { 15, 16, 56.71, -60, 57, 27.0, 5.09 },
-    { 4, 16, 21.10, -60, 56, 55.0, 6.37 },
-    { 15, 16, 36.41, -60, 54, 14.0, 5.73 },
-    { 1, 55, 46.39, -60, 51, 41.0, 6.06 },
-    { 12, 8, 24.60, -60, 50, 49.9, 6.22 },
-    { 14, 39, 36.10, -60, 50, 8.2, 1.33 },
-    { 14, 39, 35.90, -60, 50, 7.1, -0.01 },
-    { 7, 58, 50.50, -60, 49, 27.8, 5.81 },
-    { 1, 41, 48.00, -60, 47, 21.8, 5.71 },
-    { 15, 54, 52.61, -60, 44, 35.9, 6.15 },
-    { 0, 58, 22.39, -60, 41, 47.0, 6.23 },
-    { 17, 31, 5.90, -60, 41, 2.0, 3.62 },
-    { 17, 24, 18.70, -60, 40, 25.0, 5.77 },
-    { 15, 23, 10.39, -60, 39, 24.8, 5.67 },
-    { 8, 55, 2.81, -60, 38, 40.9, 3.84 },
-    { 10, 46, 16.80, -60, 36, 11.9, 6.25 },
-    { 7, 59, 37.61, -60, 35, 12.8, 5.17 },
-    { 20, 35, 34.80, -60, 34, 54.1, 4.76 },
-    { 10, 43, 32.09, -60, 34, .1, 4.57 },
-    { 20, 40, 2.59, -60, 32, 56.0, 5.12 },
-    { 7, 56, 18.60, -60, 31, 35.0, 5.74 },
-    { 10, 55, 17.21, -60, 31, .8, 5.92 },
-    { 22, 44, 16.51, -60, 29, 57.8, 6.30 },
-    { 15, 18, 48.91, -60, 29, 47.0, 5.46 },
-    { 15, 56, 6.00, -60, 28, 58.1, 5.76 },
-    { 16, 40, 50.50, -60, 26, 46.0, 6.18 },
-    { 10, 2, .00, -60, 25, 14.9, 5.94 },
-    { 12, 21, 21.60, -60, 24, 4.0, 3.59 },
-    { 12, 50, 12.00, -60, 24, 2.9, 6.75 },
-    { 12, 53, 49.10, -60, 22, 36.8, 5.90 },
-    { 14, 3, 49.39, -60, 22, 23.2, 0.61 },
-    { 8, 53, 48.70, -60, 21, 15.1, 5.78 },
-    { 12, 51, 17.81, -60, 19, 46.9, 5.72 },
-    { 12, 53, 21.79, -60, 19, 43.0, 5.76 },
-    { 11, 12, 36.00, -60, 19, 3.0, 4.60 },
-    { 8, 39, 13.20, -60, 19, 1.9, 6.36 },
-    { 2, 24, 53.90, -60, 18, 42.8, 5.35 },
-    { 7, 57, 46.90, -60, 18, 11.9, 5.60 },
-    { 9, 23, 27.41, -60, 18, 9.0, 6.30 },
-    { 15, 43, 55.10, -60, 17, 13.9, 6.48 },
-    { 7, 49, 12.89, -60, 17, 1.0, 5.78 },
-    { 6, 24, 13.70, -60, 16, 52.0, 5.80 },
-    { 0, 42, 41.81, -60, 15, 45.0, 5.98 },
-    { 22, 18, 30.10, -60, 15, 34.9, 2.86 },
-    { 6, 50, 1.10, -60, 14, 57.1, 6.11 },
-    { 7, 59, 40.20, -60, 12, 27.0, 6.33 },
-    { 18, 58, 36.41, -60, 12, 2.2, 5.14 },
-    { 10, 2, 59.90, -60, 10, 43.0, 6.19 },
-    { 15, 55, 32.30, -60, 10, 40.1, 5.77 },
-    { 17, 51, 35.50, -60, 9, 51.8, 5.78 },
-    { 14, 55, 34.61, -60, 6, 51.1, 5.20 },
-    { 6, 2, 9.19, -60, 5, 48.8, 6.45 },
-    { 23, 22, 56.90, -60, 3, 20.9, 6.09 },
-    { 7, 49, 54.79, -60, 3, 4.0, 6.72 },
-    { 14, 35, 17.21, -60, 0, 56.9, 6.40 },
-    { 13, 12, 17.40, -59, 55, 14.9, 4.60 },
-    { 10, 48, 5.40, -59, 55, 9.1, 6.00 },
-    { 10, 13, 1.30, -59, 55, 5.2, 6.10 },
-    { 14, 16, 34.20, -59, 54, 50.0, 6.39 },
-    { 15, 39, 56.50, -59, 54, 29.9, 5.95 },
-    { 10, 16, 3.10, -59, 54, 11.9, 6.22 },
-    { 22, 51, 44.90, -59, 52, 53.0, 6.46 },
-    { 13, 7, 24.19, -59, 51, 38.2, 5.99 },
-    { 17, 35, 34.90, -59, 50, 46.0, 6.28 },
-    { 13, 12, 55.99, -59, 49, .1, 6.16 },
-    { 13, 20, 34.90, -59, 46, 23.9, 6.18 },
-    { 8, 40, 37.01, -59, 45, 40.0, 4.33 },
-    { 3, 3, 36.79, -59, 44, 16.1, 5.11 },
-    { 4, 44, 21.10, -59, 43, 58.1, 5.27 },
-    { 10, 57, 48.41, -59, 43, 54.8, 6.11 },
-    { 14, 6, 25.10, -59, 42, 56.2, 6.42 },
-    { 17, 19, 12.41, -59, 41, 39.8, 5.91 },
-    { 12, 47, 43.20, -59, 41, 19.0, 1.25 },
-    { 12, 41, 56.59, -59, 41, 8.9, 4.93 },
-    { 10, 45, 3.60, -59, 41, 3.1, 6.21 },
-    { 10, 41, 17.59, -59, 40, 36.8, 6.42 },
-    { 22, 5, 50.90, -59, 38, 10.0, 5.62 },
-    { 11, 13, 30.79, -59, 37, 9.8, 5.74 },
-    { 10, 36, 20.30, -59, 33, 52.9, 5.08 },
-    { 11, 31, 48.79, -59, 30, 56.9, 5.15 },
-    { 8, 22, 30.79, -59, 30, 34.9, 1.86 },
-    { 0, 40, 26.40, -59, 27, 15.8, 5.89 },
-    { 11, 31, 46.10, -59, 26, 31.9, 5.13 },
-    { 9, 51, 12.10, -59, 25, 32.9, 5.79 },
-    { 12, 31, 40.30, -59, 25, 26.0, 5.48 },
-    { 9, 12, 55.61, -59, 24, 51.8, 5.54 },
-    { 20, 1, 44.69, -59, 22, 34.0, 5.13 },
-    { 6, 52, 45.41, -59, 20, 28.0, 6.41 },
-    { 10, 49, 24.10, -59, 19, 25.0, 5.91 },
-    { 15, 23, 22.70, -59, 19, 14.9, 4.51 },
-    { 4, 16, 28.90, -59, 18, 6.8, 4.44 },
-    { 14, 8, 56.30, -59, 16, 36.1, 6.34 },
-    { 9, 17, 5.40, -59, 16, 31.1, 2.25 },
-    { 9, 34, 26.71, -59, 13, 45.8, 4.08 },
-    { 8, 56, 58.39, -59, 13, 45.8, 4.92 },
-    { 10, 42, 40.61, -59, 12, 56.9, 5.38 },
-    { 6, 16, 18.50, -59, 12, 49.0, 6.43 },
-    { 14, 28, 43.49, -59, 11, 52.1, 6.45 },
-    { 19, 50, 44.81, -59, 11, 35.2, 5.42 },
-    { 10, 38, 45.10, -59, 10, 59.2, 4.66 },
-    { 7, 3, 15.60, -59, 10, 41.2, 5.50 },
-    { 8, 17, 55.80, -59, 10, .8, 6.42 },
-    { 12, 54, 39.19, -59, 8, 48.1, 4.62 },
-    { 7, 56, 50.71, -59, 7, 35.0, 6.25 },
-    { 13, 14, 14.81, -59, 6, 11.9, 4.92 },
-    { 8, 59, 24.10, -59, 5, 1.0, 5.16 },
-    { 16, 49, 47.09, -59, 2, 29.0, 3.76 },
-    { 18, 9, 57.60, -59, 2, 24.0, 6.38 },
-    { 21, 58, 30.10, -59, 0, 43.9, 6.12 },
-    { 12, 27, 28.70, -58, 59, 30.8, 5.50 },
-    { 11, 8, 35.40, -58, 58, 30.0, 3.91 },
-    { 9, 10, 58.01, -58, 58, .8, 3.44 },
-    { 17, 1, 47.40, -58, 57, 29.9, 6.11 },
-    { 4, 40, 18.29, -58, 56, 37.0, 6.53 },
-    { 7, 1, 5.09, -58, 56, 24.0, 6.02 },
-    { 5, 26, 19.30, -58, 54, 45.0, 5.14 },
-    { 12, 43, 28.20, -58, 54, 11.2, 6.40 },
-    { 19, 57, 6.19, -58, 54, 5.0, 5.26 },
-    { 5, 35, 2.40, -58, 52, 16.0, 6.75 },
-    { 10, 53, 29.59, -58, 51, 11.9, 3.78 },
-    { 10, 11, 35.21, -58, 49, 41.2, 6.40 },
-    { 10, 38, 59.40, -58, 49, .8, 5.92 },
-    { 15, 17, 30.79, -58, 48, 4.0, 4.07 },
-    { 9, 45, 55.39, -58, 47, 39.1, 6.22 },
-    { 13, 42, 1.10, -58, 47, 13.9, 5.38 },
-    { 6, 31, 58.39, -58, 45, 15.1, 5.70 },
-    { 12, 15, 8.71, -58, 44, 56.0, 2.80 },
-    { 10, 27, 52.70, -58, 44, 21.8, 3.82 },
-    { 10, 37, 26.81, -58, 43, 59.9, 5.45 },
-    { 8, 45, 5.30, -58, 43, 30.0, 6.21 },
-    { 18, 33, 29.50, -58, 42, 33.1, 6.44 },
-    { 13, 14, 12.10, -58, 41, 2.0, 5.89 },
-    { 11, 6, 29.30, -58, 40, 31.1, 6.02 },
-    { 10, 32, 47.59, -58, 40, .8, 6.00 },
-    { 7, 42, 10.20, -58, 37, 50.9, 6.43 },
-    { 14, 41, 55.70, -58, 36, 58.0, 6.22 },
-    { 16, 28, 15.19, -58, 35, 58.9, 5.69 },
-    { 10, 24, 59.40, -58, 34, 35.0, 5.95 },
-    { 4, 54, 52.99, -58, 32, 49.9, 6.12 },
-    { 6, 23, 46.90, -58, 32, 38.0, 6.48 },
-    { 16, 46, 21.19, -58, 30, 13.0, 5.74 },
-    { 14, 44, 55.49, -58, 28, 40.1, 6.11 },
-    { 23, 27, 15.00, -58, 28, 34.0, 5.63 },
-    { 14, 22, 37.01, -58, 27, 33.8, 4.92 },
-    { 11, 10, 54.70, -58, 27, 19.1, 6.88 },
-    { 20, 54, 48.60, -58, 27, 15.1, 3.65 },
-    { 12, 54, 22.01, -58, 25, 50.2, 6.58 },
-    { 13, 38, 7.61, -58, 24, 54.0, 6.42 },
-    { 9, 15, 17.50, -58, 23, 19.0, 6.02 },
-    { 9, 30, 23.40, -58, 21, 42.1, 5.88 },
-    { 16, 47, 19.51, -58, 20, 29.0, 5.58 },
-    { 1, 36, 44.81, -58, 16, 14.9, 6.18 },
-    { 8, 54, 54.00, -58, 14, 24.0, 6.38 },
-    { 23, 17, 25.80, -58, 14, 8.9, 3.99 },
-    { 7, 42, 53.30, -58, 13, 48.0, 6.21 },
-    { 8, 35, 15.41, -58, 13, 30.0, 5.26 },
-    { 10, 33, 25.30, -58, 11, 25.1, 6.14 },
-    { 1, 35, 15.19, -58, 8, 21.8, 6.01 },
-    { 10, 11, 46.51, -58, 3, 38.2, 5.72 },
-    { 17, 22, 55.01, -58, 0, 37.1, 5.88 },
-    { 8, 35, 19.61, -58, 0, 33.1, 4.86 },
-    { 6, 27, 4.01, -58, 0, 7.9, 5.82 },
-    { 9, 40, 42.50, -57, 59, 1.0, 5.32 },
-    { 19, 38, 25.90, -57, 58, 59.9, 6.18 },
-    { 8, 21, 12.00, -57, 58, 23.2, 5.97 },
-    { 10, 23, 50.90, -57, 57, 14.0, 6.35 },
-    { 16, 9, 18.60, -57, 56, 3.8, 5.57 },
-    { 19, 56, 57.70, -57, 55, 32.2, 6.53 },
-    { 16, 15, 49.70, -57, 54, 43.9, 5.63 },
-    { 16, 54, .50, -57, 54, 33.8, 5.94 },
-    { 16, 18, 51.89, -57, 53, 58.9, 6.49 },
-    { 21, 56, 13.99, -57, 53, 57.8, 6.19 },
-    { 22, 35, 52.90, -57, 53, 1.0, 6.23 },
-    { 9, 4, 48.00, -57, 51, 9.0, 6.44 },
-    { 22, 24, 56.40, -57, 47, 49.9, 5.32 },
-    { 16, 3, 31.90, -57, 46, 31.1, 4.63 },
-    { 16, 29, 45.00, -57, 45, 20.9, 6.06 },
-    { 17, 4, 24.70, -57, 42, 43.9, 5.73 },
-    { 11, 47, 19.10, -57, 41, 47.0, 5.41 },
-    { 1, 10, 7.39, -57, 41, 39.8, 6.41 },
-    { 12, 22, 49.30, -57, 40, 34.0, 5.39 },
-    { 10, 27, 24.41, -57, 38, 20.0, 4.66 },
-    { 8, 51, 36.60, -57, 38, 1.0, 5.59 },
-    { 13, 38, 49.10, -57, 37, 23.2, 6.01 },
-    { 9, 15, 34.99, -57, 34, 41.2, 6.32 },
-    { 10, 35, 35.30, -57, 33, 28.1, 4.45 },
-    { 17, 44, 55.80, -57, 32, 43.1, 6.01 },
-    { 8, 40, 43.61, -57, 32, 43.1, 6.34 },
-    { 9, 16, 12.19, -57, 32, 29.0, 4.34 },
-    { 20, 11, 7.20, -57, 31, 26.0, 6.37 },
-    { 18, 29, 56.69, -57, 31, 23.2, 5.76 },
-    { 22, 20, 36.19, -57, 30, 36.0, 6.34 },
-    { 12, 1, 28.99, -57, 30, 13.0, 6.16 },
-    { 5, 5, 30.60, -57, 28, 22.1, 4.72 },
-    { 10, 47, 38.71, -57, 28, 4.1, 6.36 },
-    { 0, 43, 21.19, -57, 27, 47.2, 4.36 },
-    { 22, 40, 48.89, -57, 25, 19.9, 5.97 },
-    { 11, 54, 11.50, -57, 24, 36.0, 6.06 },
-    { 10, 1, 58.01, -57, 20, 58.9, 6.20 },
-    { 3, 12, 33.19, -57, 19, 18.1, 5.74 },
-    { 7, 54, 53.21, -57, 18, 11.2, 5.63 },
-    { 9, 41, 2.21, -57, 15, 34.9, 5.80 },
-    { 10, 38, 2.50, -57, 15, 23.0, 5.91 },
-    { 10, 52, 30.91, -57, 14, 26.2, 5.25 },
-    { 1, 37, 42.89, -57, 14, 12.1, 0.46 },
-    { 9, 45, 40.49, -57, 11, 8.2, 6.46 },
-    { 12, 54, 35.59, -57, 10, 40.1, 4.03 },
-    { 12, 54, 36.79, -57, 10, 5.9, 5.17 },
-    { 5, 52, 20.30, -57, 9, 22.0, 5.94 },
-    { 12, 31, 9.89, -57, 6, 47.9, 1.63 },
-    { 3, 58, 42.89, -57, 6, 9.0, 6.05 },
-    { 14, 14, 57.00, -57, 5, 8.9, 5.07 },
-    { 12, 31, 16.70, -57, 4, 52.0, 6.42 },
-    { 4, 24, 12.19, -57, 4, 17.0, 6.29 },
-    { 9, 31, 13.30, -57, 2, 3.8, 3.13 },
-    { 1, 2, 1.80, -57, 0, 9.0, 6.11 },
-    { 11, 52, 10.10, -56, 59, 16.1, 5.57 },
-    { 10, 0, 34.39, -56, 56, 48.1, 6.52 },
-    { 17, 31, 22.99, -56, 55, 14.2, 5.95 },
-    { 17, 14, 13.20, -56, 53, 17.9, 6.09 },
-    { 14, 32, 32.90, -56, 53, 16.1, 6.93 },
-    { 18, 45, 23.71, -56, 52, 54.1, 6.22 },
-    { 6, 29, 28.51, -56, 51, 10.1, 5.22 },
-    { 23, 25, 19.39, -56, 50, 57.1, 5.59 },
-    { 12, 55, 57.00, -56, 50, 10.0, 5.32 },
-    { 22, 3, 21.60, -56, 47, 10.0, 4.69 },
-    { 11, 23, 8.11, -56, 46, 45.8, 5.79 },
-    { 8, 46, 42.50, -56, 46, 10.9, 4.49 },
-    { 13, 42, 56.09, -56, 46, 5.2, 6.00 },
-    { 10, 46, 57.50, -56, 45, 25.9, 5.23 },
-    { 7, 4, 18.29, -56, 44, 58.9, 5.17 },
-    { 20, 25, 38.90, -56, 44, 6.0, 1.94 },
-    { 7, 45, 35.59, -56, 43, 21.0, 6.12 },
-    { 14, 49, 6.89, -56, 40, 4.1, 6.23 },
-    { 8, 53, 3.79, -56, 38, 57.8, 6.03 },
-    { 17, 23, 6.89, -56, 31, 31.1, 5.80 },
-    { 12, 29, 53.90, -56, 31, 28.9, 5.80 },
-    { 0, 41, 46.39, -56, 30, 6.1, 5.70 },
-    { 12, 46, 22.70, -56, 29, 20.0, 4.65 },
-    { 7, 48, 19.20, -56, 28, 16.0, 6.33 },
-    { 14, 40, 32.81, -56, 26, 26.9, 6.30 },
-    { 9, 48, 40.01, -56, 24, 42.8, 6.06 },
-    { 7, 49, 6.70, -56, 24, 38.2, 5.59 },
-    { 12, 28, 33.41, -56, 24, 28.1, 6.15 },
-    { 6, 58, 36.19, -56, 23, 40.9, 6.45 },
-    { 14, 20, 19.51, -56, 23, 12.1, 4.33 },
-    { 17, 25, 23.59, -56, 22, 39.0, 3.34 },
-    { 12, 21, 57.50, -56, 22, 28.9, 5.92 },
-    { 6, 22, 55.80, -56, 22, 12.0, 5.61 },
-    { 19, 48, 1.20, -56, 21, 45.0, 5.35 },
-    { 11, 58, 15.19, -56, 19, 1.9, 5.44 },
-    { 14, 3, 26.21, -56, 12, 49.0, 5.92 },
-    { 1, 39, 47.40, -56, 11, 53.2, 5.87 },
-    { 1, 39, 47.81, -56, 11, 40.9, 5.76 },
-    { 16, 7, 24.00, -56, 11, 29.0, 6.16 },
-    { 12, 43, 9.10, -56, 10, 34.0, 6.00 },
-    { 5, 49, 49.70, -56, 10, .1, 4.51 },
-    { 5, 22, 22.10, -56, 8, 3.8, 6.11 },
-    { 10, 18, 37.61, -56, 6, 36.0, 5.81 },
-    { 8, 9, 33.60, -56, 5, 8.2, 5.66 },
-    { 10, 20, 54.79, -56, 2, 35.2, 4.50 },
-    { 18, 17, 7.49, -56, 1, 23.9, 5.33 },
-    { 16, 58, 37.20, -55, 59, 25.1, 3.13 },
-    { 12, 42, 49.61, -55, 56, 49.9, 6.08 },
-    { 2, 19, 54.29, -55, 56, 40.9, 5.81 },
-    { 7, 36, 1.70, -55, 53, 15.0, 6.39 },
-    { 22, 0, 24.10, -55, 52, 58.1, 6.01 },
-    { 9, 6, 34.01, -55, 48, 11.9, 6.11 },
-    { 13, 20, 48.29, -55, 48, 2.2, 6.02 },
-    { 8, 42, 20.90, -55, 46, 27.1, 6.29 },
-    { 21, 40, 33.60, -55, 44, 15.0, 6.33 },
-    { 6, 58, 39.60, -55, 43, 45.8, 6.27 },
-    { 19, 8, 52.10, -55, 43, 13.1, 6.49 },
-    { 10, 39, 18.41, -55, 36, 11.9, 4.28 },
-    { 14, 45, 10.90, -55, 36, 6.8, 6.10 },
-    { 9, 14, 18.00, -55, 34, 10.9, 5.27 },
-    { 16, 13, 22.61, -55, 32, 26.9, 5.81 },
-    { 6, 47, 18.70, -55, 32, 24.0, 5.61 },
-    { 17, 25, 18.00, -55, 31, 48.0, 2.85 },
-    { 9, 21, 49.99, -55, 30, 54.0, 5.63 },
-    { 8, 1, 31.49, -55, 27, 18.0, 6.28 },
-    { 19, 29, 52.61, -55, 26, 29.0, 6.13 },
-    { 17, 48, 38.11, -55, 24, 6.1, 6.11 },
-    { 9, 53, .00, -55, 22, 23.9, 6.48 },
-    { 15, 11, 16.01, -55, 20, 46.0, 5.54 },
-    { 1, 8, 23.11, -55, 14, 44.9, 3.92 },
-    { 9, 41, 47.81, -55, 12, 51.1, 6.00 },
-    { 8, 29, 36.31, -55, 11, 28.0, 6.36 },
-    { 9, 19, 32.59, -55, 11, 12.1, 6.28 },
-    { 17, 28, 38.71, -55, 10, 10.9, 5.94 },
-    { 12, 18, 59.69, -55, 8, 35.2, 5.00 },
-    { 16, 20, 25.20, -55, 8, 24.0, 5.77 },
-    { 19, 30, 34.49, -55, 6, 36.0, 6.30 },
-    { 15, 51, 6.79, -55, 3, 20.9, 5.73 },
-    { 20, 20, 32.30, -55, 3, 2.9, 6.27 },
-    { 4, 33, 59.81, -55, 2, 42.0, 3.27 },
-    { 10, 19, 36.79, -55, 1, 45.8, 4.57 },
-    { 20, 7, 35.09, -55, 0, 59.0, 6.26 },
-    { 8, 27, 27.41, -55, 0, 42.1, 6.53 },
-    { 9, 22, 6.79, -55, 0, 38.9, 2.50 },
-    { 14, 33, 32.40, -54, 59, 53.9, 5.87 },
-    { 21, 57, 55.10, -54, 59, 33.0, 4.40 },
-    { 19, 52, 39.00, -54, 58, 36.1, 6.50 },
-    { 10, 15, 16.61, -54, 58, 27.1, 6.16 },
-    { 19, 52, 37.61, -54, 58, 16.0, 5.74 },
-    { 6, 10, 17.90, -54, 58, 7.0, 4.81 },
-    { 8, 55, 11.90, -54, 57, 56.2, 5.71 },
-    { 12, 53, 3.91, -54, 57, 9.0, 5.93 },
-    { 5, 33, 44.40, -54, 54, 7.9, 6.43 },
-    { 10, 26, 49.01, -54, 52, 39.0, 5.58 },
-    { 0, 35, 33.41, -54, 49, 18.8, 6.06 },
-    { 21, 5, 14.21, -54, 43, 37.9, 5.16 },
-    { 8, 44, 42.19, -54, 42, 29.9, 1.96 },
-    { 13, 56, 33.00, -54, 42, 15.8, 6.00 },
-    { 6, 46, 41.50, -54, 41, 40.9, 6.46 },
-    { 14, 5, 46.51, -54, 40, 9.8, 6.17 },
-    { 21, 26, 15.41, -54, 39, 38.2, 6.12 },
-    { 16, 13, 28.70, -54, 37, 50.2, 4.94 },
-    { 14, 13, 39.89, -54, 37, 32.9, 6.11 },
-    { 17, 0, 6.19, -54, 35, 48.8, 5.65 },
-    { 16, 1, 6.41, -54, 34, 40.1, 6.13 },
-    { 9, 56, 51.79, -54, 34, 4.1, 3.54 },
-    { 13, 41, 44.69, -54, 33, 36.0, 5.01 },
-    { 2, 40, 39.60, -54, 33, .0, 5.21 },
-    { 8, 1, 22.90, -54, 30, 54.0, 6.10 },
-    { 17, 38, 5.59, -54, 30, 1.1, 5.25 },
-    { 9, 17, 42.31, -54, 29, 43.1, 6.33 },
-    { 11, 21, .41, -54, 29, 28.0, 3.89 },
-    { 19, 22, 51.10, -54, 25, 25.0, 5.05 },
-    { 19, 40, 18.31, -54, 25, 3.0, 6.26 },
-    { 5, 5, .60, -54, 24, 27.0, 6.27 },
-    { 7, 30, 30.91, -54, 23, 57.8, 5.96 },
-    { 8, 31, 29.59, -54, 23, 39.1, 6.34 },
-    { 0, 37, 18.10, -54, 23, 39.1, 6.41 },
-    { 7, 52, 29.69, -54, 22, 1.9, 5.70 },
-    { 5, 47, 13.01, -54, 21, 38.9, 6.18 },
-    { 19, 27, 48.10, -54, 19, 31.1, 5.69 },
-    { 3, 44, 33.79, -54, 16, 26.0, 6.30 },
-    { 11, 34, 45.70, -54, 15, 51.1, 4.62 },
-    { 8, 0, 49.90, -54, 9, 5.0, 5.87 },
-    { 13, 56, 19.80, -54, 7, 54.8, 6.14 },
-    { 6, 52, 46.90, -54, 5, 24.0, 6.57 },
-    { 15, 59, 54.00, -54, 1, 16.0, 6.10 },
-    { 0, 9, 2.40, -54, 0, 6.8, 6.33 },
-    { 11, 40, 42.60, -53, 58, 7.0, 5.96 },
-    { 23, 4, 39.60, -53, 57, 54.0, 5.37 },
-    { 9, 43, 42.19, -53, 53, 30.1, 5.56 },
-    { 12, 52, 24.60, -53, 49, 45.8, 6.24 },
-    { 16, 16, 43.10, -53, 48, 40.0, 5.44 },
-    { 23, 23, 54.31, -53, 48, 29.9, 6.15 },
-    { 1, 42, 29.30, -53, 44, 26.2, 5.52 },
-    { 10, 31, 21.79, -53, 42, 56.2, 4.89 },
-    { 0, 45, .00, -53, 42, 54.0, 6.15 },
-    { 21, 29, .31, -53, 42, 20.9, 6.39 },
-    { 16, 13, 16.80, -53, 40, 18.1, 5.83 },
-    { 9, 37, 12.31, -53, 40, 7.0, 5.45 },
-    { 14, 13, 16.39, -53, 39, 56.9, 5.56 },
-    { 22, 18, 15.60, -53, 37, 40.1, 5.37 },
-    { 6, 49, 51.31, -53, 37, 19.9, 4.40 },
-    { 17, 50, 28.20, -53, 36, 43.9, 5.92 },
-    { 9, 3, 5.21, -53, 32, 58.9, 6.40 },
-    { 1, 46, 6.31, -53, 31, 18.8, 5.04 },
-    { 14, 15, 21.19, -53, 30, 34.9, 6.39 },
-    { 22, 45, 37.90, -53, 30, 1.1, 4.85 },
-    { 13, 39, 53.21, -53, 27, 59.0, 2.30 },
-    { 4, 50, 55.20, -53, 27, 41.0, 5.61 },
-    { 13, 7, 38.30, -53, 27, 34.9, 5.71 },
-    { 4, 50, 56.30, -53, 27, 34.9, 6.42 },
-    { 21, 19, 52.01, -53, 26, 58.9, 4.39 },
-    { 8, 39, 23.81, -53, 26, 22.9, 5.48 },
-    { 14, 9, 54.79, -53, 26, 21.1, 4.75 },
-    { 1, 38, 48.19, -53, 26, 20.0, 6.84 },
-    { 5, 57, 14.40, -53, 25, 34.0, 6.45 },
-    { 19, 18, 9.41, -53, 23, 12.1, 6.38 },
-    { 9, 26, 18.10, -53, 22, 45.1, 5.11 },
-    { 13, 53, 43.10, -53, 22, 25.0, 5.89 },
-    { 10, 1, 40.49, -53, 21, 51.8, 6.20 },
-    { 17, 35, 19.99, -53, 21, 10.1, 6.10 },
-    { 7, 39, .41, -53, 16, 23.9, 6.06 },
-    { 21, 15, 45.91, -53, 15, 47.2, 5.75 },
-    { 17, 3, 8.81, -53, 14, 12.8, 5.29 },
-    { 11, 13, 39.31, -53, 13, 54.1, 5.76 },
-    { 8, 32, 4.80, -53, 12, 43.9, 5.69 },
-    { 15, 50, 6.89, -53, 12, 33.8, 5.77 },
-    { 19, 32, 53.81, -53, 11, 8.9, 5.75 },
-    { 14, 23, 48.41, -53, 10, 36.1, 6.00 },
-    { 16, 59, 35.11, -53, 9, 38.2, 4.06 },
-    { 11, 26, 47.30, -53, 9, 36.0, 5.81 },
-    { 16, 44, 39.79, -53, 9, 9.0, 5.96 },
-    { 17, 51, 10.99, -53, 7, 50.2, 6.09 },
-    { 8, 42, 25.49, -53, 6, 50.0, 4.86 },
-    { 8, 5, 4.01, -53, 6, 29.2, 5.53 },
-    { 8, 42, 18.91, -53, 6, .0, 5.52 },
-    { 8, 38, 44.90, -53, 5, 26.2, 6.47 },
-    { 8, 27, 36.50, -53, 5, 19.0, 5.09 },
-    { 16, 17, 20.90, -53, 5, 12.1, 6.33 },
-    { 8, 39, 57.60, -53, 3, 18.0, 5.19 },
-    { 8, 40, 17.40, -53, 0, 55.1, 5.61 },
-    { 7, 56, 46.70, -52, 58, 55.9, 3.47 },
-    { 6, 34, 58.61, -52, 58, 32.2, 4.39 },
-    { 9, 36, 46.30, -52, 56, 39.1, 6.19 },
-    { 18, 58, 27.70, -52, 56, 19.0, 4.87 },
-    { 8, 40, 17.59, -52, 55, 18.8, 3.62 },
-    { 18, 34, 31.20, -52, 53, 30.8, 6.22 },
-    { 19, 48, 55.10, -52, 53, 17.2, 6.25 },
-    { 20, 7, 23.21, -52, 52, 50.9, 4.94 },
-    { 4, 18, 40.01, -52, 51, 36.0, 6.09 },
-    { 8, 48, .19, -52, 51, 2.2, 6.30 },
-    { 13, 52, 4.80, -52, 48, 42.1, 5.25 },
-    { 14, 56, 17.30, -52, 48, 34.9, 5.38 },
-    { 8, 26, 25.20, -52, 48, 27.0, 6.05 },
-    { 6, 24, 48.19, -52, 48, 23.0, 6.51 },
-    { 12, 50, 57.91, -52, 47, 15.0, 5.73 },
-    { 5, 50, 28.61, -52, 46, 4.1, 6.35 },
-    { 23, 0, 52.80, -52, 45, 15.1, 4.12 },
-    { 13, 20, 37.80, -52, 44, 53.2, 5.48 },
-    { 23, 58, 55.80, -52, 44, 44.9, 5.13 },
-    { 21, 33, 17.71, -52, 44, 15.0, 6.41 },
-    { 6, 17, 51.70, -52, 43, 59.2, 6.41 },
-    { 8, 56, 19.39, -52, 43, 25.0, 4.69 },
-    { 23, 26, 36.60, -52, 43, 18.1, 5.52 },
-    { 6, 23, 57.10, -52, 41, 44.9, -0.72 },
-    { 22, 39, 8.40, -52, 41, 31.9, 6.65 },
-    { 3, 54, 34.01, -52, 41, 26.2, 6.46 },
-    { 14, 33, 29.90, -52, 40, 48.0, 5.87 },
-    { 7, 29, 59.59, -52, 39, 4.0, 5.87 },
-    { 9, 57, 10.90, -52, 38, 20.0, 6.12 },
-    { 5, 54, 50.21, -52, 38, 7.1, 5.29 },
-    { 7, 55, .50, -52, 34, 59.2, 6.38 },
-    { 2, 44, 10.70, -52, 34, 14.2, 6.15 },
-    { 13, 10, 58.39, -52, 34, .8, 6.06 },
-    { 2, 37, 24.41, -52, 32, 35.2, 5.31 },
-    { 7, 35, 39.70, -52, 32, 2.0, 4.94 },
-    { 7, 15, 21.00, -52, 29, 58.9, 5.97 },
-    { 20, 14, 19.01, -52, 26, 44.2, 5.65 },
-    { 15, 48, 50.30, -52, 26, 17.2, 6.07 },
-    { 6, 45, 53.69, -52, 24, 36.0, 5.80 },
-    { 14, 47, 1.30, -52, 23, 1.0, 5.21 },
-    { 0, 34, 27.79, -52, 22, 23.2, 5.57 },
-    { 15, 38, 49.51, -52, 22, 22.1, 5.44 },
-    { 12, 11, 39.10, -52, 22, 7.0, 3.96 },
-    { 21, 39, 59.69, -52, 21, 33.1, 6.21 },
-    { 19, 6, 19.90, -52, 20, 26.9, 5.16 },
-    { 6, 33, 26.09, -52, 19, 44.0, 6.19 },
-    { 5, 24, 46.20, -52, 18, 59.0, 6.27 },
-    { 7, 20, 21.41, -52, 18, 42.1, 6.05 },
-    { 7, 20, 21.70, -52, 18, 34.9, 6.60 },
-    { 17, 27, 57.60, -52, 17, 49.9, 5.75 },
-    { 16, 56, 28.70, -52, 17, 2.0, 5.94 },
-    { 14, 47, 12.31, -52, 12, 20.2, 6.07 },
-    { 6, 45, 26.09, -52, 12, 4.0, 6.57 },
-    { 9, 1, 44.59, -52, 11, 17.9, 5.23 },
-    { 10, 6, 7.10, -52, 11, 17.2, 6.52 },
-    { 13, 22, 16.20, -52, 10, 59.2, 5.83 },
-    { 5, 15, 38.90, -52, 10, 54.8, 6.49 },
-    { 6, 23, 37.70, -52, 10, 52.0, 5.98 },
-    { 10, 12, 22.99, -52, 9, 47.9, 6.16 },
-    { 13, 55, 12.19, -52, 9, 40.0, 5.71 },
-    { 8, 52, 40.80, -52, 7, 45.1, 6.39 },
-    { 8, 22, 55.20, -52, 7, 26.0, 5.85 },
-    { 13, 5, 30.79, -52, 6, 54.0, 6.43 },
-    { 5, 50, 53.21, -52, 6, 32.0, 5.17 },
-    { 18, 52, 39.60, -52, 6, 27.0, 5.17 },
-    { 15, 12, 17.09, -52, 5, 57.1, 3.41 },
-    { 7, 20, 38.69, -52, 5, 10.0, 5.39 },
-    { 5, 13, 53.30, -52, 1, 52.0, 6.05 },
-    { 7, 7, 13.30, -51, 58, 4.1, 5.96 },
-    { 17, 26, 56.30, -51, 56, 57.1, 6.19 },
-    { 18, 53, 12.10, -51, 55, 52.0, 6.31 },
-    { 20, 44, 2.30, -51, 55, 16.0, 4.51 },
-    { 23, 24, 13.10, -51, 53, 29.0, 5.75 },
-    { 17, 44, 8.71, -51, 50, 3.1, 5.15 },
-    { 6, 31, 18.29, -51, 49, 34.0, 5.60 },
-    { 11, 0, 8.59, -51, 49, 4.1, 6.15 },
-    { 10, 8, 56.30, -51, 48, 40.0, 4.86 },
-    { 1, 57, .10, -51, 45, 58.0, 6.10 },
-    { 10, 13, 28.01, -51, 45, 22.0, 5.78 },
-    { 9, 23, 59.50, -51, 44, 13.9, 6.08 },
-    { 8, 25, 31.01, -51, 43, 41.2, 5.17 },
-    { 11, 59, 10.90, -51, 41, 48.1, 6.05 },
-    { 4, 39, 4.30, -51, 40, 22.1, 6.44 },
-    { 1, 55, 57.50, -51, 36, 32.0, 3.70 },
-    { 20, 51, 30.10, -51, 36, 29.9, 5.05 },
-    { 15, 28, 27.19, -51, 35, 51.0, 6.10 },
-    { 4, 0, 15.70, -51, 33, 52.9, 6.51 },
-    { 9, 18, 42.19, -51, 33, 38.2, 5.87 },
-    { 9, 30, 5.21, -51, 31, 1.9, 5.45 },
-    { 2, 16, 30.60, -51, 30, 43.9, 3.56 },
-    { 14, 9, 34.99, -51, 30, 16.9, 6.00 },
-    { 4, 16, 1.61, -51, 29, 12.1, 4.25 },
-    { 7, 34, 39.50, -51, 28, 28.9, 6.28 },
-    { 12, 26, 31.61, -51, 27, 2.9, 4.82 },
-    { 7, 58, 21.41, -51, 26, 55.0, 6.44 },
-    { 14, 57, 1.39, -51, 26, 48.8, 6.64 },
-    { 13, 46, 39.31, -51, 25, 58.1, 4.65 },
-    { 7, 0, 51.50, -51, 24, 9.0, 5.14 },
-    { 12, 11, 31.39, -51, 21, 33.8, 6.23 },
-    { 9, 56, 21.89, -51, 20, 10.0, 6.37 },
-    { 22, 48, 33.31, -51, 19, .8, 3.49 },
-    { 13, 18, 34.61, -51, 17, 10.0, 6.19 },
-    { 6, 46, 52.80, -51, 15, 56.9, 5.40 },
-    { 21, 0, 21.50, -51, 15, 55.1, 5.76 },
-    { 9, 34, 8.81, -51, 15, 19.1, 5.01 },
-    { 10, 13, 22.80, -51, 13, 59.9, 5.28 },
-    { 9, 43, 27.50, -51, 13, 41.9, 6.15 },
-    { 6, 0, 49.20, -51, 12, 59.0, 5.67 },
-    { 11, 6, 5.81, -51, 12, 45.0, 6.30 },
-    { 9, 7, 14.69, -51, 12, 42.8, 6.73 },
-    { 10, 16, 40.20, -51, 12, 18.0, 6.30 },
-    { 12, 57, 4.39, -51, 11, 55.0, 5.16 },
-    { 13, 29, 25.20, -51, 9, 55.1, 5.06 },
-    { 9, 53, 50.21, -51, 8, 48.8, 5.93 },
-    { 17, 1, 46.10, -51, 7, 50.9, 6.45 },
-    { 2, 33, 54.60, -51, 5, 37.0, 6.24 },
-    { 2, 22, 54.60, -51, 5, 31.9, 5.92 },
-    { 18, 17, .91, -51, 4, 5.9, 6.06 },
-    { 5, 47, 17.11, -51, 3, 59.0, 3.85 },
-    { 9, 18, 5.81, -51, 3, 4.0, 5.26 },
-    { 19, 3, 57.41, -51, 1, 7.0, 5.93 },
-    { 7, 26, 21.89, -51, 1, 5.9, 5.10 },
-    { 13, 44, 15.91, -51, 0, 47.2, 6.47 },
-    { 0, 50, 41.21, -50, 59, 12.8, 5.22 },
-    { 8, 35, 52.10, -50, 58, 12.0, 5.80 },
-    { 11, 6, 27.41, -50, 57, 24.1, 6.32 },
-    { 23, 1, 7.49, -50, 57, .0, 5.68 },
-    { 2, 54, 6.50, -50, 52, 17.0, 6.21 },
-    { 2, 10, 25.61, -50, 49, 27.8, 6.12 },
-    { 1, 46, 5.81, -50, 48, 59.0, 5.49 },
-    { 2, 42, 33.50, -50, 48, 1.1, 5.41 },
-    { 13, 42, 54.60, -50, 47, 26.2, 6.41 },
-    { 14, 23, 20.30, -50, 46, 19.9, 6.02 },
-    { 10, 57, 7.90, -50, 45, 54.0, 5.91 },
-    { 12, 8, 4.80, -50, 45, 47.9, 6.37 },
-    { 20, 54, 34.99, -50, 43, 40.1, 6.24 },
-    { 12, 8, 21.50, -50, 43, 21.0, 2.60 },
-    { 13, 13, 23.50, -50, 42, .0, 5.89 },
-    { 23, 7, 14.69, -50, 41, 11.0, 5.83 },
-    { 16, 56, 8.90, -50, 40, 30.0, 6.33 },
-    { 12, 8, 5.21, -50, 39, 41.0, 4.47 },
-    { 16, 58, 18.00, -50, 38, 28.0, 5.55 },
-    { 17, 26, .00, -50, 38, 1.0, 5.23 },
-    { 17, 27, 12.41, -50, 37, 49.1, 5.92 },
-    { 15, 52, 51.50, -50, 36, 55.1, 6.60 },
-    { 6, 49, 56.21, -50, 36, 52.9, 2.93 },
-    { 6, 54, 2.30, -50, 36, 42.1, 6.26 },
-    { 5, 19, 22.10, -50, 36, 22.0, 5.45 },
-    { 8, 4, 42.41, -50, 35, 26.2, 5.95 },
-    { 0, 28, 43.10, -50, 31, 58.1, 6.26 },
-    { 17, 42, 3.89, -50, 30, 38.2, 6.24 },
-    { 7, 50, 23.90, -50, 30, 34.9, 5.91 },
-    { 19, 12, 46.10, -50, 29, 11.0, 6.13 },
-    { 4, 42, 46.39, -50, 28, 53.0, 5.31 },
-    { 14, 32, 36.89, -50, 27, 24.8, 4.42 },
-    { 8, 15, 23.30, -50, 26, 57.8, 6.44 },
-    { 3, 32, 34.80, -50, 22, 43.0, 5.68 },
-    { 13, 59, 17.30, -50, 22, 12.0, 5.91 },
-    { 5, 54, 10.70, -50, 21, 42.8, 6.52 },
-    { 7, 5, 16.49, -50, 21, 37.1, 6.46 },
-    { 6, 18, 46.80, -50, 21, 33.1, 7.04 },
-    { 0, 1, 19.99, -50, 20, 13.9, 5.53 },
-    { 13, 47, 38.40, -50, 19, 16.0, 5.45 },
-    { 23, 20, 49.99, -50, 18, 24.1, 6.05 },
-    { 13, 47, 27.60, -50, 14, 57.8, 5.91 },
-    { 9, 54, 51.29, -50, 14, 38.0, 5.72 },
-    { 6, 29, 49.10, -50, 14, 21.1, 5.27 },
-    { 12, 28, 2.40, -50, 13, 50.2, 3.91 },
-    { 23, 47, 16.01, -50, 13, 36.1, 5.18 },
-    { 1, 50, 54.50, -50, 12, 22.0, 5.94 },
-    { 8, 13, 34.10, -50, 11, 46.0, 5.51 },
-    { 23, 27, 9.10, -50, 9, 25.9, 6.20 },
-    { 16, 19, 50.40, -50, 9, 20.2, 4.02 },
-    { 18, 46, 59.09, -50, 5, 39.8, 6.54 },
-    { 18, 6, 37.90, -50, 5, 30.1, 3.66 },
-    { 16, 17, .91, -50, 4, 5.9, 4.99 },
-    { 17, 19, 30.31, -50, 3, 47.9, 6.27 },
-    { 17, 37, 27.19, -50, 3, 36.0, 5.93 },
-    { 16, 50, 35.90, -50, 2, 44.2, 6.47 },
-    { 1, 41, 41.09, -50, 2, 20.0, 6.64 },
-    { 20, 21, 40.99, -49, 59, 57.8, 6.27 },
-    { 7, 43, 6.89, -49, 59, 34.1, 6.57 },
-    { 7, 59, 12.29, -49, 58, 36.1, 6.32 },
-    { 7, 59, 13.39, -49, 58, 25.0, 6.34 },
-    { 13, 39, 59.69, -49, 57, 1.1, 6.00 },
-    { 8, 34, 43.61, -49, 56, 39.1, 5.01 },
-    { 21, 21, 16.39, -49, 56, 16.1, 6.38 },
-    { 12, 33, 59.21, -49, 54, 33.8, 6.38 },
-    { 13, 6, 54.60, -49, 54, 22.0, 4.27 },
-    { 2, 53, 52.90, -49, 53, 25.1, 4.00 },
-    { 18, 54, 32.30, -49, 52, 43.0, 6.60 },
-    { 17, 31, 50.50, -49, 52, 34.0, 2.95 },
-    { 13, 23, 52.30, -49, 49, 23.2, 6.48 },
-    { 8, 43, 40.30, -49, 49, 22.1, 5.16 },
-    { 11, 12, 56.90, -49, 44, 11.0, 6.11 },
-    { 1, 32, 36.31, -49, 43, 40.1, 6.28 },
-    { 22, 46, 28.30, -49, 41, 8.9, 6.48 },
-    { 16, 41, 40.20, -49, 39, 6.1, 5.65 },
-    { 5, 54, 41.09, -49, 37, 36.8, 6.10 },
-    { 23, 13, 15.00, -49, 37, 8.0, 6.80 },
-    { 7, 53, 3.70, -49, 36, 47.2, 4.63 },
-    { 23, 7, 9.50, -49, 36, 24.1, 6.33 },
-    { 7, 3, 53.69, -49, 35, 2.0, 4.93 },
-    { 5, 4, 58.01, -49, 34, 40.1, 5.03 },
-    { 16, 22, 28.01, -49, 34, 19.9, 5.33 },
-    { 6, 9, 23.30, -49, 33, 46.1, 6.49 },
-    { 13, 3, 33.19, -49, 31, 37.9, 4.85 },
-    { 14, 30, 20.90, -49, 31, 9.1, 5.37 },
-    { 21, 45, 19.01, -49, 29, 55.0, 6.45 },
-    { 15, 42, 37.20, -49, 29, 21.8, 6.04 },
-    { 14, 37, 53.21, -49, 25, 32.9, 4.05 },
-    { 9, 9, 45.10, -49, 25, 28.9, 6.48 },
-    { 10, 46, 46.20, -49, 25, 12.0, 2.69 },
-    { 17, 40, 23.59, -49, 24, 56.2, 4.77 },
-    { 10, 28, 1.90, -49, 24, 20.2, 6.10 },
-    { 11, 5, 4.20, -49, 23, 33.0, 6.13 },
-    { 13, 27, 20.81, -49, 22, 50.9, 6.28 },
-    { 9, 36, 49.61, -49, 21, 19.1, 4.35 },
-    { 20, 0, 25.30, -49, 21, 4.0, 6.17 },
-    { 7, 58, 14.40, -49, 14, 42.0, 4.41 },
-    { 16, 3, 12.91, -49, 13, 46.9, 4.65 },
-    { 5, 2, 48.60, -49, 9, 5.0, 5.38 },
-    { 13, 27, 6.29, -49, 8, 38.0, 6.31 },
-    { 11, 34, 56.81, -49, 8, 12.1, 5.50 },
-    { 11, 12, 33.10, -49, 6, 4.0, 5.36 },
-    { 15, 7, 25.90, -49, 5, 17.9, 5.77 },
-    { 0, 6, 19.01, -49, 4, 30.0, 5.70 },
-    { 1, 31, 15.10, -49, 4, 22.1, 3.95 },
-    { 18, 28, 49.90, -49, 4, 14.9, 4.13 },
-    { 11, 45, 12.60, -49, 4, 10.9, 6.26 },
-    { 14, 39, 24.70, -49, 3, 20.2, 6.39 },
-    { 9, 33, 44.50, -49, 0, 18.0, 5.12 },
-    { 8, 0, 14.90, -48, 58, 53.0, 6.02 },
-    { 22, 46, 7.99, -48, 58, 44.0, 6.62 },
-    { 12, 41, 31.01, -48, 57, 34.9, 2.17 },
-    { 13, 14, 43.10, -48, 57, 24.1, 5.89 },
-    { 12, 53, 6.89, -48, 56, 35.9, 4.33 },
-    { 7, 10, 47.50, -48, 55, 55.9, 5.14 },
-    { 8, 41, 5.30, -48, 55, 21.0, 5.90 },
-    { 12, 26, 48.19, -48, 54, 47.9, 6.26 },
-    { 15, 49, 57.50, -48, 54, 42.8, 5.84 },
-    { 17, 11, 38.90, -48, 52, 27.1, 5.84 },
-    { 8, 0, 28.90, -48, 52, 17.0, 6.12 },
-    { 14, 58, 8.81, -48, 51, 47.2, 6.35 },
-    { 7, 36, 43.90, -48, 49, 49.1, 5.72 },
-    { 12, 42, 35.40, -48, 48, 47.2, 4.66 },
-    { 0, 1, 4.51, -48, 48, 36.0, 5.71 },
-    { 0, 31, 25.01, -48, 48, 13.0, 4.77 },
-    { 16, 41, 20.30, -48, 45, 47.2, 5.65 },
-    { 9, 36, 25.30, -48, 45, 5.0, 6.17 },
-    { 15, 11, 57.60, -48, 44, 37.0, 5.69 },
-    { 6, 20, 6.10, -48, 44, 28.0, 6.60 },
-    { 15, 11, 56.09, -48, 44, 16.1, 3.87 },
-    { 3, 10, 27.41, -48, 44, 3.1, 6.12 },
-    { 6, 56, 16.01, -48, 43, 16.0, 4.95 },
-    { 12, 8, 14.69, -48, 41, 34.1, 5.34 },
-    { 8, 9, 9.60, -48, 41, 3.8, 5.70 },
-    { 17, 0, 27.10, -48, 38, 52.1, 6.00 },
-    { 7, 38, 18.19, -48, 36, 4.0, 5.68 },
-    { 22, 53, 37.90, -48, 35, 53.2, 6.04 },
-    { 8, 57, 55.80, -48, 34, 23.9, 5.87 },
-    { 13, 23, 2.59, -48, 33, 46.1, 6.38 },
-    { 12, 37, 42.19, -48, 32, 28.0, 3.86 },
-    { 8, 22, 31.61, -48, 29, 25.1, 4.82 },
-    { 13, 6, 16.70, -48, 27, 49.0, 4.71 },
-    { 8, 11, 11.09, -48, 27, 42.8, 5.82 },
-    { 12, 50, 19.61, -48, 27, 34.9, 6.24 },
-    { 6, 4, 46.90, -48, 27, 31.0, 6.58 },
-    { 9, 57, 42.50, -48, 24, 51.8, 6.05 },
-    { 18, 53, 2.50, -48, 21, 36.0, 6.19 },
-    { 8, 52, 38.59, -48, 21, 33.1, 5.91 },
-    { 14, 22, 38.71, -48, 19, 13.1, 6.09 },
-    { 15, 21, 48.19, -48, 19, 4.1, 5.65 },
-    { 19, 6, 55.61, -48, 17, 57.1, 5.97 },
-    { 6, 51, 32.81, -48, 17, 33.0, 6.42 },
-    { 13, 34, 28.90, -48, 16, 19.9, 6.33 },
-    { 7, 14, 38.21, -48, 16, 18.1, 4.76 },
-    { 10, 37, 18.10, -48, 13, 32.9, 3.84 },
-    { 6, 38, 37.61, -48, 13, 13.1, 4.93 },
-    { 15, 12, 31.30, -48, 13, 7.0, 6.33 },
-    { 0, 30, 26.09, -48, 12, 54.0, 5.69 },
-    { 6, 25, 43.61, -48, 10, 37.9, 5.76 },
-    { 15, 57, 3.79, -48, 9, 43.9, 6.31 },
-    { 18, 26, 53.90, -48, 7, .8, 5.46 },
-    { 22, 9, 58.01, -48, 6, 25.9, 6.43 },
-    { 7, 53, 18.19, -48, 6, 11.2, 4.24 },
-    { 19, 35, 13.01, -48, 5, 57.1, 4.90 },
-    { 8, 42, 16.01, -48, 5, 57.1, 5.51 },
-    { 18, 41, 30.60, -48, 5, 42.0, 6.49 },
-    { 12, 52, 5.30, -48, 5, 39.1, 6.33 },
-    { 15, 15, 53.81, -48, 4, 27.1, 5.95 },
-    { 3, 44, 50.59, -48, 3, 41.0, 6.49 },
-    { 0, 35, 41.11, -48, 0, 2.9, 5.51 },
-    { 22, 56, 47.81, -47, 58, 9.1, 5.70 },
-    { 13, 22, 52.70, -47, 56, 35.2, 6.16 },
-    { 8, 9, 43.20, -47, 56, 15.0, 5.23 },
-    { 8, 29, 4.70, -47, 55, 45.1, 5.33 },
-    { 15, 22, 8.30, -47, 55, 40.1, 5.00 },
-    { 18, 39, 14.30, -47, 54, 34.9, 5.86 },
-    { 7, 57, 19.99, -47, 53, 25.1, 6.22 },
-    { 14, 56, 31.99, -47, 52, 45.1, 5.64 },
-    { 15, 18, 31.99, -47, 52, 30.0, 4.27 },
-    { 8, 31, 10.80, -47, 52, .1, 6.39 },
-    { 1, 50, 20.21, -47, 48, 59.0, 6.14 },
-    { 3, 21, 33.29, -47, 46, 36.8, 6.39 },
-    { 3, 17, 26.59, -47, 45, 6.1, 5.85 },
-    { 11, 37, 33.91, -47, 44, 49.9, 5.44 },
-    { 15, 40, 58.30, -47, 44, 8.2, 6.23 },
-    { 20, 18, 55.99, -47, 42, 38.9, 6.31 },
-    { 2, 26, 59.11, -47, 42, 14.0, 4.25 },
-    { 10, 20, 16.70, -47, 41, 57.1, 5.65 },
-    { 11, 4, 31.20, -47, 40, 45.1, 5.67 },
-    { 6, 40, 49.30, -47, 40, 28.9, 6.65 },
-    { 11, 35, 55.61, -47, 38, 30.1, 5.25 },
-    { 20, 19, 17.90, -47, 34, 49.1, 6.13 },
-    { 19, 50, 13.80, -47, 33, 25.9, 5.94 },
-    { 16, 27, 11.09, -47, 33, 18.0, 4.47 },
-    { 0, 45, 45.60, -47, 33, 6.1, 5.80 },
-    { 8, 53, 50.69, -47, 31, 14.9, 5.33 },
-    { 18, 11, 4.49, -47, 30, 47.2, 6.07 },
-    { 17, 23, 16.10, -47, 28, 5.9, 5.25 },
-    { 14, 46, 29.09, -47, 26, 28.0, 5.74 },
-    { 14, 41, 55.80, -47, 23, 17.9, 2.30 },
-    { 1, 57, 10.01, -47, 23, 6.0, 4.83 },
-    { 3, 30, 37.01, -47, 22, 31.1, 5.99 },
-    { 11, 35, 13.20, -47, 22, 21.0, 5.71 },
-    { 16, 15, 15.31, -47, 22, 19.9, 5.14 },
-    { 10, 6, 11.30, -47, 22, 12.0, 5.08 },
-    { 3, 45, 15.79, -47, 21, 34.9, 5.73 },
-    { 8, 9, 29.30, -47, 20, 44.9, 4.27 },
-    { 9, 13, 34.51, -47, 20, 19.0, 5.92 },
-    { 8, 9, 31.99, -47, 20, 12.1, 1.78 },
-    { 8, 41, 13.10, -47, 19, .8, 4.77 },
-    { 5, 36, 2.71, -47, 18, 50.0, 6.11 },
-    { 21, 48, 15.79, -47, 18, 13.0, 5.58 },
-    { 20, 37, 34.01, -47, 17, 29.0, 3.11 },
-    { 13, 55, 32.40, -47, 17, 17.9, 2.55 },
-    { 8, 58, 52.30, -47, 14, 4.9, 5.18 },
-    { 18, 29, 55.80, -47, 13, 13.1, 5.70 },
-    { 22, 42, 36.89, -47, 12, 38.2, 5.98 },
-    { 17, 3, 41.71, -47, 9, 36.0, 6.06 },
-    { 13, 53, 56.90, -47, 7, 41.2, 6.10 },
-    { 9, 4, 9.31, -47, 5, 52.1, 3.75 },
-    { 7, 48, 20.30, -47, 4, 40.1, 4.71 },
-    { 5, 30, 9.50, -47, 4, 40.1, 5.46 },
-    { 11, 56, 43.90, -47, 4, 21.0, 6.26 },
-    { 15, 51, 31.51, -47, 3, 38.2, 6.01 },
-    { 15, 5, 7.20, -47, 3, 4.0, 4.82 },
-    { 15, 5, 7.20, -47, 3, 4.0, 4.72 },
-    { 10, 32, 56.90, -47, 0, 11.9, 5.02 },
-    { 8, 13, 36.19, -46, 59, 30.8, 5.13 },
-    { 8, 5, 20.40, -46, 58, 44.0, 6.19 },
-    { 3, 2, 55.90, -46, 58, 30.0, 5.82 },
-    { 8, 33, 30.41, -46, 58, 16.0, 6.24 },
-    { 22, 8, 13.99, -46, 57, 40.0, 1.74 },
-    { 4, 27, 6.00, -46, 56, 51.0, 6.10 },
-    { 22, 46, 43.70, -46, 56, 21.8, 6.56 },
-    { 9, 50, 42.00, -46, 56, 3.8, 5.73 },
-    { 17, 41, 16.30, -46, 55, 18.8, 5.79 },
-    { 13, 51, 47.21, -46, 53, 57.1, 5.77 },
-    { 3, 53, 33.29, -46, 53, 37.0, 5.93 },
-    { 22, 42, 40.10, -46, 53, 4.9, 2.10 },
-    { 13, 20, 57.70, -46, 52, 50.2, 5.77 },
-    { 7, 49, 12.89, -46, 51, 28.1, 5.84 },
-    { 7, 14, 45.91, -46, 50, 58.9, 5.72 },
-    { 7, 16, 15.50, -46, 46, 27.8, 5.66 },
-    { 7, 12, 33.60, -46, 45, 33.8, 4.49 },
-    { 1, 29, 30.41, -46, 45, 23.0, 6.31 },
-    { 15, 29, 24.31, -46, 43, 58.1, 5.24 },
-    { 1, 6, 4.99, -46, 43, 7.0, 3.31 },
-    { 0, 48, 56.69, -46, 41, 52.1, 6.27 },
-    { 8, 40, 37.61, -46, 38, 56.0, 3.84 },
-    { 8, 12, .00, -46, 38, 39.1, 5.76 },
-    { 23, 39, 28.01, -46, 38, 16.1, 6.09 },
-    { 10, 3, 20.50, -46, 38, 10.0, 6.12 },
-    { 17, 19, 3.19, -46, 38, 2.0, 5.48 },
-    { 21, 24, 20.81, -46, 36, 54.0, 6.31 },
-    { 6, 49, 54.60, -46, 36, 52.9, 5.14 },
-    { 7, 47, 31.49, -46, 36, 31.0, 5.23 },
-    { 5, 46, 27.41, -46, 35, 49.9, 5.31 },
-    { 18, 52, 27.10, -46, 35, 43.1, 5.54 },
-    { 13, 56, 19.51, -46, 35, 33.0, 5.83 },
-    { 18, 52, 59.59, -46, 35, 8.9, 6.19 },
-    { 14, 39, 10.99, -46, 35, 3.1, 6.07 },
-    { 9, 11, 33.19, -46, 35, 2.0, 5.79 },
-    { 9, 51, 40.80, -46, 32, 52.1, 4.58 },
-    { 22, 45, 40.70, -46, 32, 51.0, 5.51 },
-    { 8, 50, 33.50, -46, 31, 45.1, 5.10 },
-    { 2, 42, 8.50, -46, 31, 27.8, 6.10 },
-    { 4, 29, 19.99, -46, 30, 55.1, 6.16 },
-    { 17, 35, 39.60, -46, 30, 20.2, 4.59 },
-    { 13, 37, 23.71, -46, 25, 41.9, 5.90 },
-    { 1, 2, 49.20, -46, 23, 51.0, 5.36 },
-    { 7, 49, 14.30, -46, 22, 23.9, 4.11 },
-    { 8, 29, 45.60, -46, 19, 54.8, 5.99 },
-    { 1, 53, 38.81, -46, 18, 9.0, 4.41 },
-    { 2, 45, 16.49, -46, 17, 13.9, 6.85 },
-    { 8, 12, 30.91, -46, 15, 51.1, 6.03 },
-    { 14, 36, 19.01, -46, 14, 43.1, 5.55 },
-    { 16, 29, 42.31, -46, 14, 35.9, 5.35 },
-    { 20, 49, 28.99, -46, 13, 36.8, 4.89 },
-    { 9, 51, 19.80, -46, 11, 38.0, 5.62 },
-    { 8, 47, 18.91, -46, 9, 20.2, 5.75 },
-    { 12, 41, 22.99, -46, 8, 44.2, 5.84 },
-    { 14, 27, 12.19, -46, 8, 3.8, 5.83 },
-    { 14, 37, 20.11, -46, 8, 2.0, 5.41 },
-    { 0, 41, 19.61, -46, 5, 6.0, 4.59 },
-    { 16, 43, 3.41, -46, 4, 14.2, 6.23 },
-    { 14, 19, 24.19, -46, 3, 28.1, 3.55 },
-    { 9, 22, 24.00, -46, 2, 51.0, 5.75 },
-    { 8, 46, 1.70, -46, 2, 30.1, 3.91 },
-    { 17, 31, 49.10, -46, 2, 11.0, 6.03 },
-    { 18, 26, 58.39, -45, 58, 5.9, 3.51 },
-    { 18, 11, 13.80, -45, 57, 15.8, 4.53 },
-    { 22, 22, 43.90, -45, 56, 52.1, 6.62 },
-    { 22, 23, 7.99, -45, 55, 43.0, 5.62 },
-    { 5, 31, 36.10, -45, 55, 31.1, 5.86 },
-    { 18, 31, 45.41, -45, 54, 54.0, 4.96 },
-    { 8, 46, 30.60, -45, 54, 46.1, 5.46 },
-    { 11, 16, 27.70, -45, 52, 48.0, 6.31 },
-    { 4, 8, 33.91, -45, 51, 52.9, 6.59 },
-    { 17, 26, 51.50, -45, 50, 37.0, 5.29 },
-    { 8, 14, 23.90, -45, 50, 3.8, 5.83 },
-    { 5, 43, 41.09, -45, 49, 59.2, 6.39 },
-    { 18, 49, 27.41, -45, 48, 37.1, 5.81 },
-    { 6, 58, 41.81, -45, 46, 5.2, 6.22 },
-    { 18, 8, 30.10, -45, 46, 1.9, 6.15 },
-    { 18, 32, 1.99, -45, 45, 25.9, 5.07 },
-    { 0, 9, 24.70, -45, 44, 51.0, 3.88 },
-    { 9, 49, 57.10, -45, 43, 58.1, 5.08 },
-    { 12, 14, 2.59, -45, 43, 26.0, 5.31 },
-    { 11, 45, 43.90, -45, 41, 24.0, 5.29 },
-    { 14, 1, 43.39, -45, 36, 13.0, 4.34 },
-    { 17, 51, 44.50, -45, 36, 2.2, 6.11 },
-    { 7, 57, 51.79, -45, 34, 40.1, 5.17 },
-    { 1, 31, 39.10, -45, 34, 32.2, 6.17 },
-    { 9, 15, 14.59, -45, 33, 20.2, 6.25 },
-    { 1, 15, 11.09, -45, 31, 53.0, 4.96 },
-    { 17, 5, 5.30, -45, 30, 6.1, 6.28 },
-    { 23, 37, 51.00, -45, 29, 33.0, 4.74 },
-    { 19, 16, 21.70, -45, 27, 59.0, 5.40 },
-    { 8, 0, 19.61, -45, 27, 24.8, 6.61 },
-    { 17, 0, 32.30, -45, 27, 6.1, 6.65 },
-    { 6, 49, 57.79, -45, 27, .0, 6.55 },
-    { 12, 11, 2.90, -45, 25, 22.1, 6.61 },
-    { 8, 41, 56.90, -45, 24, 38.9, 5.23 },
-    { 15, 50, 16.30, -45, 24, 6.1, 6.12 },
-    { 14, 26, 10.80, -45, 22, 45.8, 4.35 },
-    { 16, 24, 54.19, -45, 20, 57.1, 6.33 },
-    { 14, 30, 8.59, -45, 19, 18.1, 5.50 },
-    { 8, 49, 47.69, -45, 18, 29.2, 4.93 },
-    { 9, 54, 17.59, -45, 17, 2.0, 5.71 },
-    { 6, 10, 39.91, -45, 16, 54.8, 6.31 },
-    { 15, 8, 50.59, -45, 16, 46.9, 4.05 },
-    { 15, 11, 31.90, -45, 16, 45.8, 7.39 },
-    { 19, 39, 42.00, -45, 16, 41.2, 6.25 },
-    { 15, 11, 34.90, -45, 16, 39.0, 6.44 },
-    { 19, 33, 21.60, -45, 16, 18.8, 5.61 },
-    { 8, 6, 40.39, -45, 15, 59.0, 5.05 },
-    { 23, 10, 21.60, -45, 14, 48.1, 3.90 },
-    { 16, 35, 7.90, -45, 14, 40.9, 6.46 },
-    { 14, 26, 8.21, -45, 13, 17.0, 4.56 },
-    { 7, 59, 1.80, -45, 12, 58.0, 5.99 },
-    { 19, 14, 39.70, -45, 11, 35.9, 5.92 },
-    { 8, 40, 35.30, -45, 11, 29.0, 5.71 },
-    { 14, 20, 42.50, -45, 11, 13.9, 4.77 },
-    { 7, 13, 13.39, -45, 10, 59.2, 4.89 },
-    { 11, 51, 8.71, -45, 10, 25.0, 4.46 },
-    { 7, 42, 57.19, -45, 10, 23.9, 5.06 },
-    { 16, 6, 29.40, -45, 10, 23.9, 4.72 },
-    { 20, 0, 48.31, -45, 6, 47.2, 5.81 },
-    { 6, 7, 1.90, -45, 5, 29.0, 6.51 },
-    { 23, 44, 1.39, -45, 4, 59.9, 6.09 },
-    { 6, 4, 40.20, -45, 4, 44.0, 5.93 },
-    { 10, 31, 56.59, -45, 4, 9.8, 6.09 },
-    { 10, 31, 57.50, -45, 4, .1, 5.74 },
-    { 8, 55, 19.30, -45, 2, 30.1, 6.26 },
-    { 6, 4, 28.39, -45, 2, 12.1, 6.35 },
-    { 21, 20, 9.50, -45, 1, 19.9, 6.00 },
-    { 14, 15, 38.81, -45, 0, 2.9, 6.31 },
-    { 15, 35, 53.21, -44, 57, 31.0, 4.54 },
-    { 4, 30, 50.09, -44, 57, 14.0, 5.07 },
-    { 9, 16, 4.20, -44, 53, 55.0, 6.04 },
-    { 5, 49, 34.10, -44, 52, 31.1, 6.38 },
-    { 9, 11, 4.39, -44, 52, 5.2, 5.00 },
-    { 21, 33, 23.50, -44, 50, 55.0, 5.57 },
-    { 23, 31, 27.00, -44, 50, 37.0, 6.02 },
-    { 13, 58, 40.80, -44, 48, 13.0, 3.87 },
-    { 19, 23, 13.20, -44, 47, 58.9, 4.29 },
-    { 0, 39, 52.01, -44, 47, 48.1, 6.01 },
-    { 9, 46, 30.41, -44, 45, 18.0, 5.55 },
-    { 7, 49, 28.20, -44, 45, 6.8, 6.32 },
-    { 8, 30, 39.19, -44, 44, 13.9, 6.30 },
-    { 8, 29, 27.60, -44, 43, 30.0, 4.99 },
-    { 2, 1, 42.41, -44, 42, 49.0, 5.14 },
-    { 15, 22, 40.90, -44, 41, 21.8, 3.37 },
-    { 12, 34, 42.31, -44, 40, 23.9, 5.77 },
-    { 15, 41, 11.30, -44, 39, 40.0, 4.64 },
-    { 11, 22, 23.11, -44, 38, 44.9, 6.12 },
-    { 7, 13, 32.40, -44, 38, 22.9, 5.10 },
-    { 7, 41, 21.79, -44, 37, 55.9, 6.41 },
-    { 10, 32, 33.60, -44, 37, 8.0, 5.91 },
-    { 7, 50, 42.41, -44, 34, 46.9, 6.45 },
-    { 17, 10, 42.29, -44, 33, 27.0, 5.08 },
-    { 1, 24, 41.90, -44, 31, 41.9, 6.26 },
-    { 20, 33, 55.10, -44, 30, 58.0, 5.11 },
-    { 15, 12, 49.51, -44, 30, 2.2, 4.82 },
-    { 23, 29, .79, -44, 29, 52.1, 6.43 },
-    { 23, 16, 39.70, -44, 29, 21.1, 5.92 },
-    { 19, 22, 38.30, -44, 27, 32.0, 4.01 },
-    { 22, 15, 35.09, -44, 27, 6.8, 6.10 },
-    { 3, 12, 25.80, -44, 25, 10.9, 5.93 },
-    { 15, 36, 12.10, -44, 23, 48.8, 5.43 },
-    { 11, 13, 14.69, -44, 22, 19.9, 5.80 },
-    { 4, 12, 31.61, -44, 22, 5.9, 6.71 },
-    { 6, 8, 34.61, -44, 21, 22.0, 6.27 },
-    { 17, 56, 47.40, -44, 20, 31.9, 4.86 },
-    { 12, 8, 53.81, -44, 19, 34.0, 5.75 },
-    { 0, 0, 19.20, -44, 17, 26.2, 6.29 },
-    { 4, 19, 16.61, -44, 16, 5.2, 5.34 },
-    { 9, 16, 23.11, -44, 15, 56.9, 5.12 },
-    { 22, 42, 43.10, -44, 14, 52.1, 6.07 },
-    { 5, 24, 55.61, -44, 13, 32.9, 6.08 },
-    { 17, 19, 24.50, -44, 13, 23.2, 6.65 },
-    { 18, 15, 52.70, -44, 12, 24.1, 5.46 },
-    { 17, 24, 13.01, -44, 9, 45.0, 5.12 },
-    { 4, 25, 19.10, -44, 9, 38.9, 6.39 },
-    { 8, 29, 7.61, -44, 9, 38.2, 5.79 },
-    { 12, 54, 58.49, -44, 9, 6.8, 5.89 },
-    { 9, 14, 8.21, -44, 8, 44.9, 5.85 },
-    { 13, 37, 6.00, -44, 8, 35.9, 5.98 },
-    { 17, 18, 48.00, -44, 7, 46.9, 5.76 },
-    { 8, 9, 35.90, -44, 7, 22.1, 5.21 },
-    { 18, 24, 18.19, -44, 6, 37.1, 5.25 },
-    { 7, 57, 18.41, -44, 6, 34.9, 5.09 },
-    { 17, 5, 48.60, -44, 6, 18.0, 6.19 },
-    { 16, 34, 4.99, -44, 2, 43.1, 4.94 },
-    { 5, 58, 37.61, -44, 2, 3.8, 5.81 },
-    { 20, 48, 29.21, -43, 59, 19.0, 5.11 },
-    { 7, 18, 4.20, -43, 59, 12.1, 5.85 },
-    { 4, 48, 33.79, -43, 58, 48.0, 6.72 },
-    { 13, 17, 13.90, -43, 58, 45.8, 5.84 },
-    { 6, 52, 47.11, -43, 58, 32.9, 6.46 },
-    { 16, 22, 28.90, -43, 54, 43.9, 5.88 },
-    { 18, 29, 12.89, -43, 50, 44.9, 6.36 },
-    { 7, 55, 46.49, -43, 50, 42.0, 6.02 },
-    { 2, 10, 4.90, -43, 48, 56.2, 6.32 },
-    { 10, 59, 59.40, -43, 48, 25.9, 5.81 },
-    { 7, 45, 18.10, -43, 45, 7.9, 6.03 },
-    { 22, 29, 45.50, -43, 44, 57.8, 4.11 },
-    { 11, 14, 54.00, -43, 44, 3.1, 6.21 },
-    { 19, 24, 21.41, -43, 43, 23.2, 6.17 },
-    { 0, 51, 52.10, -43, 42, 33.1, 6.90 },
-    { 0, 26, 12.19, -43, 40, 48.0, 3.94 },
-    { 18, 48, 50.50, -43, 40, 48.0, 5.49 },
-    { 10, 35, 10.49, -43, 39, 52.9, 6.08 },
-    { 9, 12, 30.60, -43, 36, 49.0, 5.57 },
-    { 7, 3, 58.80, -43, 36, 42.1, 6.79 },
-    { 7, 3, 57.29, -43, 36, 29.2, 5.54 },
-    { 14, 51, 38.40, -43, 34, 32.2, 4.32 },
-    { 14, 47, 32.09, -43, 33, 27.0, 6.30 },
-    { 23, 6, 52.80, -43, 31, 14.2, 4.28 },
-    { 2, 9, 9.29, -43, 31, .1, 5.85 },
-    { 18, 31, 56.21, -43, 30, 28.1, 5.72 },
-    { 7, 56, 57.89, -43, 30, 1.1, 5.35 },
-    { 22, 29, 16.20, -43, 29, 44.2, 3.97 },
-    { 15, 16, 10.49, -43, 29, 4.9, 6.04 },
-    { 14, 8, 51.89, -43, 28, 16.0, 6.17 },
-    { 19, 29, 23.90, -43, 26, 44.9, 5.71 },
-    { 18, 49, 34.99, -43, 26, 2.0, 5.61 },
-    { 9, 7, 59.81, -43, 25, 57.0, 2.21 },
-    { 18, 6, 49.80, -43, 25, 28.9, 5.77 },
-    { 18, 6, 49.80, -43, 25, 28.9, 5.77 },
-    { 7, 2, 15.60, -43, 24, 15.1, 6.43 },
-    { 16, 38, 26.21, -43, 23, 55.0, 5.83 },
-    { 0, 50, 3.70, -43, 23, 40.9, 6.48 },
-    { 13, 11, 23.21, -43, 22, 8.0, 5.25 },
-    { 1, 28, 21.89, -43, 19, 5.9, 3.41 },
-    { 7, 29, 13.80, -43, 18, 5.0, 3.25 },
-    { 17, 12, 9.19, -43, 14, 21.1, 3.33 },
-    { 0, 18, 42.60, -43, 14, 7.1, 6.33 },
-    { 9, 14, 24.50, -43, 13, 39.0, 5.25 },
-    { 2, 22, 11.81, -43, 12, .0, 6.31 },
-    { 6, 37, 45.70, -43, 11, 46.0, 3.17 },
-    { 9, 38, 1.51, -43, 11, 28.0, 5.50 },
-    { 18, 39, 34.99, -43, 11, 10.0, 5.37 },
-    { 9, 0, 22.20, -43, 10, 23.9, 6.07 },
-    { 14, 59, 27.10, -43, 9, 36.0, 6.10 },
-    { 13, 13, 57.50, -43, 8, 20.0, 6.16 },
-    { 14, 58, 31.90, -43, 8, 2.0, 2.68 },
-    { 23, 23, 45.41, -43, 7, 27.8, 6.10 },
-    { 10, 15, 31.51, -43, 6, 45.0, 5.60 },
-    { 11, 41, 19.80, -43, 5, 44.9, 5.55 },
-    { 7, 51, 20.50, -43, 5, 44.2, 6.32 },
-    { 14, 6, 10.90, -43, 5, 30.8, 6.20 },
-    { 7, 33, 13.30, -43, 5, 11.0, 6.52 },
-    { 3, 19, 55.70, -43, 4, 10.9, 4.27 },
-    { 14, 20, 9.70, -43, 3, 32.0, 5.56 },
-    { 16, 53, 42.50, -43, 3, 2.9, 5.96 },
-    { 20, 0, 26.50, -43, 2, 35.9, 6.14 },
-    { 21, 2, 12.60, -43, 0, 6.8, 6.64 },
-    { 17, 37, 19.20, -42, 59, 52.1, 1.87 },
-    { 8, 37, 38.71, -42, 59, 21.1, 4.14 },
-    { 8, 11, 25.90, -42, 59, 13.9, 4.75 },
-    { 8, 3, 29.50, -42, 56, 55.0, 6.29 },
-    { 21, 34, 16.99, -42, 55, 30.0, 6.32 },
-    { 5, 53, 22.90, -42, 55, 17.0, 6.55 },
-    { 4, 7, 25.10, -42, 55, .8, 6.59 },
-    { 12, 55, 19.39, -42, 54, 56.9, 5.47 },
-    { 16, 15, 24.00, -42, 53, 58.9, 6.14 },
-    { 2, 39, 48.00, -42, 53, 30.1, 4.75 },
-    { 7, 51, 40.30, -42, 53, 17.9, 6.04 },
-    { 17, 38, 8.50, -42, 52, 50.2, 6.10 },
-    { 15, 8, 39.10, -42, 52, 4.1, 5.85 },
-    { 23, 9, 57.29, -42, 51, 38.2, 5.81 },
-    { 16, 36, 22.51, -42, 51, 32.0, 5.47 },
-    { 5, 59, 8.81, -42, 48, 55.1, 3.96 },
-    { 20, 12, 23.90, -42, 46, 50.2, 6.22 },
-    { 8, 24, 57.19, -42, 46, 9.8, 5.98 },
-    { 10, 38, 50.30, -42, 45, 13.0, 6.11 },
-    { 10, 26, 9.50, -42, 44, 20.0, 6.13 },
-    { 17, 44, 42.00, -42, 43, 44.0, 5.87 },
-    { 18, 56, 16.90, -42, 42, 38.2, 5.36 },
-    { 13, 12, 50.90, -42, 41, 58.9, 6.22 },
-    { 0, 44, 57.10, -42, 40, 36.1, 5.94 },
-    { 11, 28, 35.11, -42, 40, 27.1, 5.08 },
-    { 16, 19, 17.69, -42, 40, 26.0, 5.45 },
-    { 11, 24, 22.10, -42, 40, 9.1, 6.12 },
-    { 8, 44, 24.00, -42, 38, 57.1, 4.07 },
-    { 8, 9, 47.71, -42, 38, 26.2, 6.26 },
-    { 11, 7, 16.61, -42, 38, 19.0, 5.15 },
-    { 3, 29, 55.01, -42, 38, 3.1, 5.78 },
-    { 23, 35, 4.61, -42, 36, 54.0, 4.71 },
-    { 15, 38, 3.19, -42, 34, 3.0, 4.33 },
-    { 21, 27, 1.61, -42, 32, 52.1, 5.51 },
-    { 12, 25, 8.50, -42, 30, 51.8, 6.11 },
-    { 8, 51, 27.91, -42, 30, 15.8, 6.55 },
-    { 6, 52, 39.70, -42, 30, 15.8, 6.52 },
-    { 1, 54, 22.01, -42, 29, 48.8, 5.11 },
-    { 16, 54, 26.90, -42, 28, 44.0, 5.88 },
-    { 13, 49, 37.01, -42, 28, 26.0, 3.04 },
-    { 10, 25, 17.21, -42, 28, 5.2, 6.18 },
-    { 8, 48, 8.81, -42, 27, 50.0, 6.43 },
-    { 12, 3, 39.60, -42, 26, 3.1, 5.15 },
-    { 20, 23, 53.21, -42, 25, 22.1, 5.64 },
-    { 7, 56, 57.89, -42, 24, 22.0, 6.09 },
-    { 6, 54, 26.71, -42, 21, 56.2, 6.32 },
-    { 16, 53, 59.69, -42, 21, 43.9, 4.73 },
-    { 16, 54, 34.99, -42, 21, 41.0, 3.62 },
-    { 7, 4, 2.81, -42, 20, 13.9, 5.20 },
-    { 14, 26, 13.39, -42, 19, 9.1, 6.32 },
-    { 18, 33, 30.19, -42, 18, 45.0, 4.64 },
-    { 0, 26, 16.99, -42, 18, 22.0, 2.39 },
-    { 6, 6, 40.99, -42, 17, 55.0, 6.12 },
-    { 4, 14, .10, -42, 17, 39.8, 3.86 },
-    { 18, 18, 40.01, -42, 17, 17.9, 6.30 },
-    { 9, 13, 18.60, -42, 16, 25.0, 6.29 },
-    { 10, 55, 1.01, -42, 15, 4.0, 6.11 },
-    { 13, 11, 8.81, -42, 13, 59.2, 5.79 },
-    { 11, 0, 9.31, -42, 13, 32.9, 4.39 },
-    { 9, 21, 50.90, -42, 11, 42.0, 5.58 },
-    { 14, 35, 30.41, -42, 9, 28.1, 2.31 },
-    { 6, 7, 52.90, -42, 9, 14.0, 5.50 },
-    { 8, 25, 51.89, -42, 9, 11.9, 5.47 },
-    { 10, 14, 44.21, -42, 7, 18.8, 3.85 },
-    { 14, 59, 9.70, -42, 6, 15.1, 3.13 },
-    { 13, 58, 16.30, -42, 6, 2.9, 3.83 },
-    { 14, 34, 7.99, -42, 5, 58.9, 6.60 },
-    { 19, 3, 6.89, -42, 5, 43.1, 4.75 },
-    { 8, 50, 21.00, -42, 5, 24.0, 6.00 },
-    { 13, 43, 40.01, -42, 4, 3.0, 5.98 },
-    { 20, 22, 27.50, -42, 2, 58.9, 5.59 },
-    { 1, 59, 38.81, -42, 1, 50.2, 5.57 },
-    { 19, 22, 9.60, -42, 0, 58.0, 6.34 },
-    { 17, 52, 52.70, -41, 59, 48.1, 6.20 },
-    { 16, 53, 58.80, -41, 59, 40.9, 6.32 },
-    { 4, 10, 50.59, -41, 59, 37.0, 4.93 },
-    { 4, 28, 9.41, -41, 57, 36.0, 6.44 },
-    { 10, 23, 40.39, -41, 57, 11.9, 6.27 },
-    { 18, 31, 3.00, -41, 54, 49.0, 6.04 },
-    { 12, 15, 30.50, -41, 54, 47.2, 6.26 },
-    { 19, 2, 8.71, -41, 54, 36.0, 6.23 },
-    { 19, 9, 57.79, -41, 53, 33.0, 5.88 },
-    { 19, 55, 15.70, -41, 52, 5.9, 4.13 },
-    { 9, 1, 20.81, -41, 51, 51.8, 5.55 },
-    { 4, 40, 33.70, -41, 51, 50.0, 4.45 },
-    { 16, 52, 19.10, -41, 51, 15.8, 6.49 },
-    { 16, 54, 11.81, -41, 51, 1.1, 6.45 },
-    { 2, 19, 24.70, -41, 50, 53.9, 6.37 },
-    { 14, 14, 42.60, -41, 50, 15.0, 5.61 },
-    { 16, 54, 19.61, -41, 49, 12.0, 6.59 },
-    { 15, 44, 22.61, -41, 49, 9.8, 5.94 },
-    { 16, 31, 41.71, -41, 49, .8, 5.33 },
-    { 16, 54, 1.80, -41, 48, 23.0, 5.45 },
-    { 1, 47, 16.80, -41, 45, 36.0, 6.18 },
-    { 5, 3, 54.00, -41, 44, 42.0, 6.31 },
-    { 15, 59, 30.31, -41, 44, 39.8, 4.99 },
-    { 8, 47, 40.49, -41, 44, 13.9, 6.36 },
-    { 12, 29, 57.91, -41, 44, 10.0, 6.02 },
-    { 17, 57, 47.71, -41, 42, 58.0, 4.88 },
-    { 10, 10, 37.90, -41, 42, 54.0, 5.98 },
-    { 13, 49, 30.31, -41, 41, 16.1, 3.41 },
-    { 10, 18, 28.20, -41, 40, 5.9, 5.96 },
-    { 10, 22, 19.61, -41, 39, .0, 4.83 },
-    { 3, 26, 11.71, -41, 38, 12.8, 6.32 },
-    { 22, 16, 26.59, -41, 37, 39.0, 5.10 },
-    { 13, 6, 35.11, -41, 35, 19.0, 5.59 },
-    { 6, 36, 51.31, -41, 33, 24.8, 6.34 },
-    { 14, 35, 31.51, -41, 31, 1.9, 5.87 },
-    { 13, 26, 56.09, -41, 29, 53.2, 5.69 },
-    { 1, 24, 40.80, -41, 29, 33.0, 5.42 },
-    { 15, 16, 4.01, -41, 29, 28.0, 5.16 },
-    { 1, 7, 47.90, -41, 29, 12.8, 5.21 },
-    { 23, 3, 59.50, -41, 28, 41.9, 5.79 },
-    { 7, 14, 57.10, -41, 25, 32.9, 5.94 },
-    { 14, 3, 27.50, -41, 25, 23.9, 6.11 },
-    { 22, 43, 30.00, -41, 24, 51.8, 4.85 },
-    { 13, 42, 55.01, -41, 24, 4.0, 5.98 },
-    { 21, 6, 25.51, -41, 23, 10.0, 5.53 },
-    { 12, 24, 44.69, -41, 23, 3.1, 6.25 },
-    { 22, 14, 38.59, -41, 22, 54.1, 6.23 },
-    { 3, 30, 13.61, -41, 22, 12.0, 6.12 },
-    { 18, 11, 5.59, -41, 21, 33.1, 5.86 },
-    { 22, 15, 36.89, -41, 20, 48.1, 4.79 },
-    { 18, 13, 12.60, -41, 20, 10.0, 5.47 },
-    { 4, 50, 16.20, -41, 19, 14.9, 6.07 },
-    { 8, 2, 44.81, -41, 18, 36.0, 5.52 },
-    { 9, 0, 5.40, -41, 15, 14.0, 4.45 },
-    { 12, 8, 54.50, -41, 13, 53.0, 5.48 },
-    { 16, 51, 33.70, -41, 13, 50.2, 5.22 },
-    { 13, 4, 48.10, -41, 11, 48.1, 6.26 },
-    { 23, 16, 49.80, -41, 11, 39.8, 6.47 },
-    { 14, 6, 2.81, -41, 10, 46.9, 4.36 },
-    { 21, 32, 5.90, -41, 10, 45.1, 5.29 },
-    { 17, 33, 7.39, -41, 10, 25.0, 5.84 },
-    { 15, 35, 8.50, -41, 10, .8, 2.78 },
-    { 2, 14, 31.99, -41, 10, .1, 5.91 },
-    { 16, 54, 58.39, -41, 9, 4.0, 5.77 },
-    { 8, 46, 23.81, -41, 7, 32.2, 6.21 },
-    { 16, 11, 17.69, -41, 7, 10.9, 5.86 },
-    { 16, 43, 45.50, -41, 7, 8.0, 6.20 },
-    { 16, 43, 53.90, -41, 6, 47.2, 6.12 },
-    { 23, 14, 58.61, -41, 6, 20.2, 5.77 },
-    { 6, 28, 42.29, -41, 4, 27.8, 6.32 },
-    { 15, 5, 19.10, -41, 4, 1.9, 5.15 },
-    { 4, 43, 44.21, -41, 3, 52.9, 6.25 },
-    { 15, 18, 9.41, -41, 3, 38.9, 6.28 },
-    { 12, 35, 45.50, -41, 1, 18.8, 5.13 },
-    { 21, 24, 24.79, -41, 0, 24.1, 5.77 },
-    { 11, 58, 20.30, -40, 56, 49.9, 6.79 },
-    { 5, 27, 5.30, -40, 56, 37.0, 5.87 },
-    { 0, 30, 27.79, -40, 56, 21.8, 6.19 },
-    { 7, 43, 41.90, -40, 56, 2.0, 5.17 },
-    { 6, 30, 59.81, -40, 54, 59.0, 6.20 },
-    { 7, 7, 7.10, -40, 53, 35.9, 5.79 },
-    { 15, 4, 42.91, -40, 51, 41.0, 6.41 },
-    { 14, 30, 56.50, -40, 50, 42.0, 6.39 },
-    { 2, 24, 33.79, -40, 50, 26.2, 6.18 },
-    { 16, 44, 42.60, -40, 50, 22.9, 5.71 },
-    { 9, 56, 5.40, -40, 49, 28.9, 6.41 },
-    { 23, 18, 9.91, -40, 49, 27.8, 5.53 },
-    { 16, 56, 36.00, -40, 49, 25.0, 6.15 },
-    { 20, 1, 26.40, -40, 48, 51.1, 6.29 },
-    { 21, 20, 45.60, -40, 48, 34.9, 4.82 },
-    { 20, 25, 47.90, -40, 47, 47.0, 6.09 },
-    { 15, 18, 56.40, -40, 47, 17.9, 5.59 },
-    { 17, 51, 32.81, -40, 46, 21.0, 5.96 },
-    { 15, 21, 35.30, -40, 44, 58.9, 6.20 },
-    { 7, 56, 24.29, -40, 44, 11.0, 6.78 },
-    { 5, 38, 43.61, -40, 42, 27.0, 5.82 },
-    { 3, 44, 6.19, -40, 39, 37.1, 6.45 },
-    { 15, 59, 58.01, -40, 39, 10.1, 6.49 },
-    { 5, 47, 58.10, -40, 39, 9.0, 6.61 },
-    { 7, 48, 8.50, -40, 39, 7.9, 6.14 },
-    { 9, 32, 19.30, -40, 38, 57.8, 5.35 },
-    { 15, 21, 22.30, -40, 38, 51.0, 3.22 },
-    { 19, 23, 53.21, -40, 36, 58.0, 3.97 },
-    { 23, 10, 9.79, -40, 35, 30.1, 5.83 },
-    { 22, 36, 58.80, -40, 35, 28.0, 5.86 },
-    { 11, 33, 37.30, -40, 35, 12.8, 5.39 },
-    { 15, 8, 12.10, -40, 35, 2.0, 5.79 },
-    { 22, 36, 29.30, -40, 34, 58.1, 6.28 },
-    { 7, 52, 13.01, -40, 34, 32.9, 3.73 },
-    { 2, 43, 20.30, -40, 31, 39.0, 6.36 },
-    { 21, 15, 14.69, -40, 30, 23.0, 6.21 },
-    { 9, 26, 28.49, -40, 30, 6.8, 6.20 },
-    { 11, 46, 31.10, -40, 30, 2.2, 4.91 },
-    { 7, 12, 15.79, -40, 29, 56.0, 5.31 },
-    { 19, 8, 20.90, -40, 29, 48.1, 4.59 },
-    { 9, 30, 42.00, -40, 28, .1, 3.60 },
-    { 8, 53, 50.69, -40, 26, 51.0, 6.47 },
-    { 11, 32, 48.10, -40, 26, 11.0, 5.64 },
-    { 16, 0, 53.71, -40, 26, 7.1, 6.21 },
-    { 18, 47, 44.59, -40, 24, 22.0, 5.24 },
-    { 4, 13, 35.71, -40, 21, 28.1, 6.37 },
-    { 3, 54, 23.21, -40, 21, 25.9, 5.71 },
-    { 6, 10, 10.30, -40, 21, 13.0, 5.58 },
-    { 6, 41, 14.09, -40, 20, 58.9, 6.12 },
-    { 8, 14, 2.90, -40, 20, 53.2, 4.44 },
-    { 10, 13, 45.91, -40, 20, 44.9, 5.90 },
-    { 8, 49, 39.19, -40, 19, 14.2, 5.48 },
-    { 10, 13, 56.59, -40, 18, 38.2, 6.35 },
-    { 17, 56, 55.80, -40, 18, 20.2, 6.43 },
-    { 2, 58, 15.70, -40, 18, 16.9, 3.24 },
-    { 2, 58, 16.30, -40, 18, 15.8, 4.35 },
-    { 23, 54, 38.59, -40, 18, .0, 6.03 },
-    { 6, 24, 44.50, -40, 17, 3.1, 6.31 },
-    { 3, 37, 5.71, -40, 16, 28.9, 4.58 },
-    { 21, 12, 13.61, -40, 16, 9.8, 5.83 },
-    { 8, 40, 19.30, -40, 15, 51.1, 5.20 },
-    { 14, 1, 19.01, -40, 13, 19.9, 6.13 },
-    { 14, 36, 44.21, -40, 12, 42.1, 5.74 },
-    { 15, 47, 25.39, -40, 11, 39.1, 6.42 },
-    { 23, 46, 1.20, -40, 10, 57.0, 6.31 },
-    { 12, 53, 26.21, -40, 10, 44.0, 4.27 },
-    { 12, 43, 26.30, -40, 10, 40.1, 6.44 },
-    { 13, 27, 14.69, -40, 9, 47.2, 6.40 },
-    { 8, 37, 19.90, -40, 8, 51.0, 6.55 },
-    { 17, 47, 35.09, -40, 7, 36.8, 3.03 },
-    { 17, 50, 11.21, -40, 5, 26.2, 4.81 },
-    { 15, 34, 1.61, -40, 3, 58.0, 5.82 },
-    { 7, 46, 33.41, -40, 3, 34.9, 6.57 },
-    { 7, 33, 13.51, -40, 3, 32.0, 6.26 },
-    { 13, 39, 48.60, -40, 3, 6.8, 5.60 },
-    { 19, 34, 8.50, -40, 2, 4.9, 5.89 },
-    { 8, 3, 35.09, -40, 0, 11.9, 2.25 },
-    { 7, 38, 24.19, -39, 59, 29.0, 6.59 },
-    { 12, 39, 52.51, -39, 59, 15.0, 4.64 },
-    { 10, 4, 23.40, -39, 58, 32.9, 6.43 },
-    { 8, 35, 12.60, -39, 58, 12.0, 6.47 },
-    { 5, 54, 52.51, -39, 57, 29.2, 5.57 },
-    { 2, 50, 47.90, -39, 55, 54.1, 6.36 },
-    { 0, 28, 26.40, -39, 54, 54.0, 5.43 },
-    { 14, 58, 36.79, -39, 54, 24.1, 6.15 },
-    { 7, 33, 58.51, -39, 54, 20.9, 6.76 },
-    { 13, 50, 19.39, -39, 54, 4.0, 6.44 },
-    { 18, 33, .91, -39, 53, 31.9, 6.22 },
-    { 19, 51, 50.59, -39, 52, 27.8, 5.33 },
-    { 14, 26, 49.90, -39, 52, 26.0, 6.35 },
-    { 12, 36, 1.20, -39, 52, 12.0, 5.80 },
-    { 15, 56, 6.50, -39, 51, 51.1, 6.03 },
-    { 2, 40, 40.01, -39, 51, 20.2, 4.11 },
-    { 19, 9, 39.70, -39, 49, 41.2, 6.46 },
-    { 18, 57, 34.70, -39, 49, 23.9, 6.31 },
-    { 20, 53, 40.20, -39, 48, 36.0, 5.35 },
-    { 9, 22, 36.70, -39, 46, 28.9, 6.54 },
-    { 17, 14, 27.70, -39, 46, .8, 6.60 },
-    { 13, 26, 7.80, -39, 45, 19.1, 5.09 },
-    { 13, 39, 40.80, -39, 44, 53.2, 6.27 },
-    { 5, 1, 34.51, -39, 43, 5.2, 6.03 },
-    { 15, 24, 44.90, -39, 42, 37.1, 5.37 },
-    { 18, 32, 21.41, -39, 42, 14.0, 5.16 },
-    { 11, 55, 54.70, -39, 41, 21.1, 6.13 },
-    { 18, 44, 57.19, -39, 41, 11.0, 5.43 },
-    { 12, 51, 56.81, -39, 40, 50.9, 5.98 },
-    { 5, 23, 24.00, -39, 40, 43.0, 5.71 },
-    { 7, 8, 51.10, -39, 39, 20.9, 4.83 },
-    { 4, 54, 54.79, -39, 37, 43.0, 6.10 },
-    { 8, 21, 24.19, -39, 37, 14.9, 6.16 },
-    { 8, 11, 21.50, -39, 37, 7.0, 4.45 },
-    { 9, 38, 40.70, -39, 36, 51.1, 6.70 },
-    { 14, 36, 24.19, -39, 35, 49.9, 6.13 },
-    { 9, 44, 15.79, -39, 34, 16.0, 6.82 },
-    { 10, 35, 12.91, -39, 33, 46.1, 5.38 },
-    { 20, 42, 52.99, -39, 33, 31.0, 6.29 },
-    { 22, 6, 6.89, -39, 32, 35.9, 4.46 },
-    { 6, 46, 3.29, -39, 32, 24.0, 6.62 },
-    { 18, 59, 11.11, -39, 32, 4.9, 6.49 },
-    { 14, 23, 2.21, -39, 30, 43.9, 4.42 },
-    { 17, 12, 16.20, -39, 30, 24.8, 5.67 },
-    { 19, 39, 55.70, -39, 25, 59.9, 6.61 },
-    { 16, 20, 32.59, -39, 25, 50.9, 6.12 },
-    { 9, 24, 16.30, -39, 25, 32.9, 6.06 },
-    { 21, 13, 3.10, -39, 25, 31.1, 5.26 },
-    { 14, 56, 35.81, -39, 24, 58.0, 6.36 },
-    { 13, 31, 2.69, -39, 24, 27.0, 3.88 },
-    { 5, 43, 30.19, -39, 24, 24.8, 6.25 },
-    { 9, 2, 6.41, -39, 24, 9.0, 6.27 },
-    { 9, 16, 57.19, -39, 24, 5.0, 5.33 },
-    { 16, 46, 47.81, -39, 22, 37.9, 5.48 },
-    { 4, 45, 55.39, -39, 21, 24.1, 6.05 },
-    { 15, 34, 20.90, -39, 20, 57.8, 6.36 },
-    { 19, 10, 1.70, -39, 20, 26.9, 4.11 },
-    { 7, 47, 5.81, -39, 19, 53.0, 6.31 },
-    { 12, 23, 36.89, -39, 18, 11.2, 6.40 },
-    { 7, 59, 28.39, -39, 17, 49.9, 5.24 },
-    { 6, 16, 35.59, -39, 15, 51.8, 6.00 },
-    { 9, 11, 40.99, -39, 15, 32.0, 6.00 },
-    { 7, 18, 33.60, -39, 12, 37.1, 5.25 },
-    { 20, 46, 20.09, -39, 11, 57.1, 5.50 },
-    { 6, 43, 23.30, -39, 11, 35.9, 6.30 },
-    { 16, 24, 1.30, -39, 11, 35.2, 5.40 },
-    { 15, 38, 32.69, -39, 9, 38.9, 6.57 },
-    { 22, 51, 2.21, -39, 9, 24.8, 5.42 },
-    { 8, 49, 52.39, -39, 8, 30.1, 6.39 },
-    { 17, 57, 57.79, -39, 8, 12.8, 6.29 },
-    { 22, 28, 39.19, -39, 7, 54.8, 5.47 },
-    { 9, 33, 7.80, -39, 7, 44.0, 6.43 },
-    { 15, 38, 42.31, -39, 7, 41.2, 6.04 },
-    { 16, 8, 34.20, -39, 6, 19.1, 7.05 },
-    { 16, 8, 34.39, -39, 5, 35.2, 6.65 },
-    { 8, 31, 24.60, -39, 3, 51.1, 6.31 },
-    { 8, 26, 18.19, -39, 3, 37.1, 7.25 },
-    { 8, 26, 17.59, -39, 3, 33.8, 6.53 },
-    { 12, 28, 22.51, -39, 2, 29.0, 5.44 },
-    { 17, 42, 29.30, -39, 1, 48.0, 2.41 },
-    { 19, 11, 1.80, -39, 0, 18.0, 6.36 },
-    { 18, 28, 27.10, -38, 59, 44.2, 5.64 },
-    { 12, 13, 25.30, -38, 55, 45.1, 5.76 },
-    { 1, 1, 18.31, -38, 55, .1, 5.59 },
-    { 12, 23, 44.90, -38, 54, 40.0, 5.79 },
-    { 23, 6, 53.59, -38, 53, 31.9, 5.61 },
-    { 14, 31, 10.80, -38, 52, 10.9, 5.97 },
-    { 7, 43, 7.01, -38, 51, 51.1, 6.89 },
-    { 7, 52, 38.69, -38, 51, 47.2, 4.49 },
-    { 18, 29, 16.80, -38, 51, 4.0, 6.63 },
-    { 8, 33, 38.30, -38, 50, 56.0, 5.96 },
-    { 17, 12, 16.51, -38, 49, 19.9, 6.30 },
-    { 7, 29, 5.71, -38, 48, 43.9, 5.43 },
-    { 14, 38, 19.61, -38, 47, 39.1, 6.02 },
-    { 15, 10, 7.49, -38, 47, 33.0, 5.98 },
-    { 7, 38, 32.59, -38, 46, 52.0, 6.19 },
-    { 15, 25, 20.21, -38, 44, 1.0, 4.60 },
-    { 18, 33, 23.11, -38, 43, 34.0, 5.65 },
-    { 8, 52, 48.00, -38, 43, 27.1, 5.82 },
-    { 18, 33, 23.30, -38, 43, 13.1, 6.32 },
-    { 18, 22, 18.60, -38, 39, 24.8, 5.10 },
-    { 17, 36, 32.81, -38, 38, 7.1, 4.29 },
-    { 21, 2, 58.01, -38, 37, 54.1, 5.30 },
-    { 6, 33, 10.30, -38, 37, 31.1, 6.44 },
-    { 15, 32, 4.39, -38, 37, 23.2, 6.25 },
-    { 9, 13, 25.90, -38, 36, 59.0, 6.31 },
-    { 16, 3, 24.19, -38, 36, 9.0, 4.89 },
-    { 1, 53, 23.21, -38, 35, 40.9, 6.10 },
-    { 17, 15, 35.90, -38, 35, 38.0, 5.96 },
-    { 9, 15, 36.70, -38, 34, 12.0, 4.94 },
-    { 21, 44, 29.50, -38, 33, 9.0, 6.30 },
-    { 7, 41, 15.79, -38, 32, 1.0, 5.42 },
-    { 21, 2, 27.19, -38, 31, 50.2, 5.94 },
-    { 7, 41, 58.01, -38, 31, 44.0, 6.54 },
-    { 5, 52, 47.71, -38, 31, 32.9, 6.70 },
-    { 17, 29, 25.70, -38, 31, .1, 6.39 },
-    { 5, 32, 51.31, -38, 30, 47.2, 5.48 },
-    { 7, 47, 25.01, -38, 30, 40.0, 5.08 },
-    { 0, 42, 42.91, -38, 27, 47.9, 6.06 },
-    { 2, 53, 34.39, -38, 26, 12.8, 5.92 },
-    { 0, 44, 12.10, -38, 25, 18.1, 5.90 },
-    { 9, 29, 16.30, -38, 24, 14.0, 6.19 },
-    { 1, 49, 48.79, -38, 24, 14.0, 6.37 },
-    { 13, 32, 5.30, -38, 23, 57.1, 6.16 },
-    { 6, 42, 16.39, -38, 23, 55.0, 6.29 },
-    { 16, 0, 7.30, -38, 23, 48.8, 3.41 },
-    { 21, 59, 17.90, -38, 23, 43.1, 5.50 },
-    { 2, 42, 6.60, -38, 23, 2.0, 6.01 },
-    { 7, 6, 2.30, -38, 22, 58.1, 6.11 },
-    { 8, 33, 19.90, -38, 22, 16.0, 6.49 },
-    { 18, 43, 46.90, -38, 19, 25.0, 5.13 },
-    { 7, 16, 31.80, -38, 19, 8.0, 5.80 },
-    { 7, 39, 27.41, -38, 18, 29.9, 4.84 },
-    { 14, 47, 5.11, -38, 17, 26.9, 5.94 },
-    { 8, 23, 17.21, -38, 17, 8.9, 6.32 },
-    { 7, 39, 47.81, -38, 15, 38.9, 5.76 },
-    { 19, 3, 17.71, -38, 15, 11.9, 5.74 },
-    { 22, 47, 47.11, -38, 13, 18.8, 6.71 },
-    { 15, 21, 30.10, -38, 13, 9.1, 6.48 },
-    { 7, 43, 42.89, -38, 12, 6.8, 6.40 },
-    { 2, 57, 32.69, -38, 11, 28.0, 6.41 },
-    { 15, 25, 6.60, -38, 10, 9.8, 7.03 },
-    { 6, 39, 56.90, -38, 9, 32.0, 6.58 },
-    { 16, 43, 47.59, -38, 9, 24.1, 6.05 },
-    { 17, 3, 50.81, -38, 9, 7.9, 5.91 },
-    { 6, 37, 1.90, -38, 8, 48.1, 6.04 },
-    { 7, 39, 43.80, -38, 8, 21.8, 5.73 },
-    { 1, 41, 27.31, -38, 7, 59.2, 6.17 },
-    { 17, 47, 7.30, -38, 6, 42.1, 6.43 },
-    { 20, 34, 55.51, -38, 5, 22.9, 6.44 },
-    { 17, 37, 26.81, -38, 3, 56.2, 6.26 },
-    { 19, 57, 41.30, -38, 3, 29.9, 6.55 },
-    { 15, 1, 13.01, -38, 3, 29.9, 5.89 },
-    { 16, 51, 52.20, -38, 2, 51.0, 3.08 },
-    { 16, 52, 20.11, -38, 1, 3.0, 3.57 },
-    { 11, 17, 11.81, -38, 0, 51.8, 6.27 },
-    { 7, 37, 45.19, -38, 0, 38.2, 6.38 },
-    { 10, 23, 29.30, -38, 0, 36.0, 5.33 },
-    { 2, 38, 24.79, -37, 59, 26.2, 6.49 },
-    { 7, 45, 15.31, -37, 58, 7.0, 3.61 },
-    { 7, 44, 34.20, -37, 56, 35.2, 5.88 },
-    { 20, 3, 33.50, -37, 56, 26.9, 4.77 },
-    { 7, 46, 10.39, -37, 56, 2.0, 5.88 },
-    { 6, 47, 21.41, -37, 55, 46.9, 5.26 },
-    { 8, 12, 51.50, -37, 55, 27.8, 6.43 },
-    { 15, 47, 28.99, -37, 54, 59.0, 6.01 },
-    { 20, 51, .70, -37, 54, 47.9, 5.52 },
-    { 19, 9, 28.30, -37, 54, 15.8, 4.11 },
-    { 6, 27, 7.49, -37, 53, 44.2, 6.48 },
-    { 7, 45, 4.61, -37, 53, 16.1, 6.54 },
-    { 14, 20, 33.41, -37, 53, 7.1, 4.05 },
-    { 14, 59, 13.90, -37, 52, 53.0, 6.47 },
-    { 12, 10, 33.79, -37, 52, 13.1, 6.06 },
-    { 16, 4, 36.70, -37, 51, 47.2, 5.90 },
-    { 1, 12, 45.41, -37, 51, 23.0, 5.92 },
-    { 21, 26, 22.90, -37, 49, 45.8, 5.63 },
-    { 23, 32, 58.30, -37, 49, 5.9, 4.37 },
-    { 7, 28, 22.80, -37, 48, 37.1, 6.58 },
-    { 19, 6, 52.51, -37, 48, 37.1, 6.16 },
-    { 17, 22, 39.41, -37, 48, 18.0, 6.41 },
-    { 14, 52, 51.10, -37, 48, 11.9, 5.03 },
-    { 13, 12, 3.19, -37, 48, 11.2, 4.85 },
-    { 14, 41, 57.60, -37, 47, 37.0, 4.00 },
-    { 6, 46, 12.10, -37, 46, 32.2, 6.21 },
-    { 9, 23, 44.81, -37, 45, 25.9, 6.48 },
-    { 11, 54, 25.80, -37, 44, 56.0, 6.46 },
-    { 11, 25, 33.10, -37, 44, 52.1, 5.89 },
-    { 21, 57, 2.21, -37, 44, 48.8, 6.18 },
-    { 6, 17, 1.20, -37, 44, 15.0, 5.53 },
-    { 20, 0, 15.91, -37, 42, 7.9, 5.95 },
-    { 6, 32, 21.31, -37, 41, 48.1, 5.24 },
-    { 8, 8, 37.61, -37, 40, 53.0, 6.37 },
-    { 5, 52, 33.19, -37, 37, 52.0, 5.63 },
-    { 3, 48, 35.40, -37, 37, 19.9, 5.40 },
-    { 16, 58, 52.39, -37, 37, 16.0, 6.09 },
-    { 3, 48, 35.90, -37, 37, 14.2, 4.73 },
-    { 8, 34, 29.30, -37, 36, 41.0, 6.30 },
-    { 9, 14, 57.19, -37, 36, 9.0, 5.86 },
-    { 19, 12, 9.79, -37, 34, 58.1, 6.57 },
-    { 9, 20, 29.59, -37, 34, 53.0, 6.05 },
-    { 7, 39, 58.01, -37, 34, 45.8, 6.00 },
-    { 2, 23, 6.50, -37, 34, 35.0, 6.53 },
-    { 16, 24, 31.70, -37, 33, 56.9, 5.42 },
-    { 19, 43, 37.61, -37, 32, 20.0, 6.16 },
-    { 16, 50, 59.81, -37, 30, 51.8, 6.11 },
-    { 15, 58, 30.70, -37, 30, 11.2, 6.31 },
-    { 18, 20, 55.30, -37, 29, 15.0, 6.45 },
-    { 17, 35, 43.01, -37, 26, 24.0, 6.48 },
-    { 15, 42, 38.30, -37, 25, 30.0, 5.24 },
-    { 9, 15, 45.10, -37, 24, 47.9, 4.62 },
-    { 20, 26, 52.99, -37, 24, 11.2, 6.25 },
-    { 5, 11, 35.90, -37, 23, 43.1, 6.57 },
-    { 8, 18, 12.60, -37, 22, 27.1, 6.70 },
-    { 21, 53, 55.70, -37, 21, 54.0, 3.01 },
-    { 18, 56, 40.51, -37, 20, 35.9, 5.38 },
-    { 7, 30, 42.41, -37, 20, 22.9, 6.65 },
-    { 5, 23, 39.00, -37, 20, 12.1, 6.82 },
-    { 10, 8, 1.70, -37, 20, 1.0, 6.36 },
-    { 3, 42, 50.11, -37, 18, 49.0, 4.59 },
-    { 17, 30, 45.79, -37, 17, 44.9, 2.69 },
-    { 8, 11, 1.61, -37, 17, 31.9, 6.44 },
-    { 7, 24, 47.30, -37, 17, 26.9, 6.84 },
-    { 7, 24, 47.21, -37, 17, 24.0, 6.97 },
-    { 8, 1, 37.39, -37, 17, 1.0, 5.95 },
-    { 21, 56, 22.80, -37, 15, 13.0, 5.46 },
-    { 6, 17, 9.50, -37, 15, 11.2, 5.87 },
-    { 6, 7, 31.61, -37, 15, 11.2, 5.02 },
-    { 11, 36, 40.80, -37, 14, 16.1, 6.31 },
-    { 5, 28, 15.31, -37, 13, 50.2, 5.57 },
-    { 17, 6, 20.30, -37, 13, 39.0, 5.98 },
-    { 17, 22, 54.91, -37, 13, 14.2, 5.93 },
-    { 16, 39, 5.21, -37, 13, 3.0, 5.91 },
-    { 11, 43, 27.19, -37, 11, 25.1, 5.98 },
-    { 9, 49, 28.10, -37, 11, 11.0, 5.97 },
-    { 16, 28, 14.69, -37, 10, 45.8, 5.79 },
-    { 1, 47, 47.81, -37, 9, 34.9, 6.32 },
-    { 8, 44, 51.89, -37, 8, 49.9, 5.76 },
-    { 4, 42, 3.50, -37, 8, 39.8, 5.05 },
-    { 10, 56, 43.10, -37, 8, 16.1, 4.60 },
-    { 5, 55, 29.90, -37, 7, 14.9, 4.97 },
-    { 18, 58, 43.39, -37, 6, 27.0, 4.87 },
-    { 17, 33, 36.50, -37, 6, 14.0, 1.63 },
-    { 7, 17, 8.59, -37, 5, 51.0, 2.70 },
-    { 15, 19, 31.61, -37, 5, 48.1, 6.20 },
-    { 19, 6, 25.10, -37, 3, 47.9, 4.93 },
-    { 19, 6, 25.10, -37, 3, 47.9, 4.99 },
-    { 19, 1, 4.30, -37, 3, 42.8, 6.40 },
-    { 19, 1, 3.19, -37, 3, 38.9, 6.69 },
-    { 8, 2, 6.19, -37, 3, 2.2, 6.34 },
-    { 17, 49, 51.50, -37, 2, 35.9, 3.21 },
-    { 14, 19, 23.90, -37, 0, 13.0, 5.94 },
-    { 6, 37, 13.80, -36, 59, 26.2, 5.71 },
-    { 17, 42, 51.00, -36, 56, 44.9, 5.54 },
-    { 6, 31, 34.99, -36, 56, 24.0, 6.34 },
-    { 1, 32, 55.99, -36, 51, 55.1, 5.51 },
-    { 15, 23, 9.41, -36, 51, 31.0, 4.54 },
-    { 17, 58, 55.61, -36, 51, 29.9, 5.74 },
-    { 1, 42, 3.00, -36, 49, 57.0, 5.72 },
-    { 10, 18, 37.80, -36, 48, 16.9, 6.30 },
-    { 16, 6, 35.50, -36, 48, 7.9, 4.23 },
-    { 6, 35, 24.10, -36, 46, 48.0, 5.59 },
-    { 17, 28, 56.11, -36, 46, 41.9, 6.02 },
-    { 15, 27, 18.19, -36, 46, 4.1, 5.45 },
-    { 18, 17, 37.61, -36, 45, 42.1, 3.11 },
-    { 16, 7, 16.39, -36, 45, 20.2, 5.73 },
-    { 7, 18, 38.21, -36, 44, 34.1, 5.11 },
-    { 7, 18, 18.41, -36, 44, 3.1, 4.66 },
-    { 8, 30, 29.59, -36, 43, 16.0, 6.69 },
-    { 18, 44, 7.70, -36, 43, 7.0, 6.32 },
-    { 13, 20, 35.81, -36, 42, 43.9, 2.75 },
-    { 6, 24, 1.01, -36, 42, 28.1, 5.62 },
-    { 18, 9, 22.39, -36, 40, 21.0, 6.58 },
-    { 18, 22, 53.11, -36, 40, 9.8, 5.34 },
-    { 8, 18, 33.29, -36, 39, 33.8, 4.45 },
-    { 14, 48, 38.11, -36, 38, 4.9, 6.04 },
-    { 8, 39, 22.10, -36, 36, 24.8, 6.13 },
-    { 7, 16, 49.51, -36, 35, 34.1, 5.03 },
-    { 8, 52, 38.59, -36, 32, 44.2, 6.42 },
-    { 7, 12, 25.70, -36, 32, 39.8, 5.96 },
-    { 11, 17, 43.01, -36, 32, 3.8, 6.68 },
-    { 1, 38, 27.41, -36, 31, 41.9, 5.94 },
-    { 10, 15, 20.90, -36, 31, 5.2, 6.19 },
-    { 7, 38, 43.90, -36, 29, 48.8, 5.80 },
-    { 8, 21, 21.00, -36, 29, 3.8, 5.20 },
-    { 17, 55, 7.90, -36, 28, 32.9, 6.06 },
-    { 20, 16, 23.71, -36, 27, 15.8, 6.39 },
-    { 13, 51, 36.60, -36, 25, 59.9, 6.35 },
-    { 2, 32, 14.81, -36, 25, 39.0, 6.30 },
-    { 3, 50, 37.61, -36, 25, 31.1, 6.86 },
-    { 21, 13, 18.89, -36, 25, 26.0, 5.96 },
-    { 23, 2, 34.01, -36, 25, 14.9, 6.47 },
-    { 22, 55, 14.90, -36, 23, 19.0, 6.40 },
-    { 10, 5, 15.19, -36, 23, 2.0, 6.27 },
-    { 18, 1, 48.31, -36, 22, 40.1, 6.30 },
-    { 13, 15, 9.70, -36, 22, 16.0, 6.19 },
-    { 14, 6, 40.99, -36, 22, 12.0, 2.06 },
-    { 7, 53, 3.50, -36, 21, 50.0, 5.43 },
-    { 12, 43, 58.70, -36, 20, 57.1, 6.39 },
-    { 8, 13, 58.80, -36, 20, 28.0, 6.11 },
-    { 7, 33, 51.00, -36, 20, 17.9, 5.54 },
-    { 8, 13, 58.39, -36, 19, 21.0, 5.08 },
-    { 9, 49, 51.29, -36, 16, 7.0, 6.37 },
-    { 15, 6, 13.90, -36, 15, 51.1, 6.27 },
-    { 15, 21, 48.41, -36, 15, 41.0, 3.56 },
-    { 13, 46, 56.40, -36, 15, 6.8, 5.15 },
-    { 18, 23, 28.90, -36, 14, 17.9, 5.55 },
-    { 6, 33, 49.51, -36, 13, 55.9, 5.42 },
-    { 6, 51, 42.29, -36, 13, 49.1, 5.96 },
-    { 21, 15, 46.80, -36, 12, 38.9, 6.12 },
-    { 3, 49, 27.31, -36, 12, 1.1, 4.17 },
-    { 15, 57, 21.29, -36, 11, 6.0, 5.80 },
-    { 19, 9, 36.41, -36, 9, 52.9, 6.56 },
-    { 11, 23, 12.70, -36, 9, 52.9, 5.00 },
-    { 7, 31, 25.80, -36, 9, 10.1, 6.68 },
-    { 14, 41, 1.39, -36, 8, 6.0, 5.67 },
-    { 20, 59, 59.69, -36, 7, 46.9, 6.11 },
-    { 20, 46, 18.60, -36, 7, 13.1, 6.49 },
-    { 3, 47, 49.61, -36, 6, 20.9, 6.21 },
-    { 20, 11, 11.90, -36, 6, 4.0, 5.32 },
-    { 9, 37, 28.30, -36, 5, 44.9, 5.98 },
-    { 12, 17, 47.30, -36, 5, 38.0, 6.15 },
-    { 15, 13, 7.39, -36, 5, 29.0, 6.10 },
-    { 6, 35, 54.00, -36, 5, 20.0, 6.35 },
-    { 11, 25, 29.40, -36, 3, 47.2, 5.22 },
-    { 7, 44, 9.60, -36, 3, 46.1, 5.80 },
-    { 7, 43, 12.00, -36, 3, 1.1, 5.60 },
-    { 18, 6, 23.71, -36, 1, 10.9, 5.95 },
-    { 18, 25, 21.70, -35, 59, 30.1, 6.15 },
-    { 5, 14, 28.80, -35, 58, 37.9, 5.76 },
-    { 7, 32, 22.30, -35, 57, 41.0, 6.30 },
-    { 9, 29, 14.69, -35, 57, 5.0, 4.51 },
-    { 3, 13, 1.49, -35, 56, 38.0, 6.27 },
-    { 8, 42, 57.00, -35, 56, 35.9, 6.42 },
-    { 17, 0, 36.89, -35, 56, 3.1, 5.97 },
-    { 3, 25, 55.80, -35, 55, 14.9, 6.39 },
-    { 17, 22, 37.99, -35, 54, 36.0, 6.47 },
-    { 11, 47, 7.01, -35, 54, 24.8, 6.17 },
-    { 8, 15, 58.90, -35, 54, 10.1, 6.16 },
-    { 18, 4, 50.40, -35, 54, 5.0, 6.00 },
-    { 8, 13, 29.59, -35, 53, 58.9, 4.78 },
-    { 9, 58, 52.30, -35, 53, 28.0, 5.23 },
-    { 7, 31, 42.79, -35, 53, 16.1, 6.61 },
-    { 7, 54, 10.99, -35, 52, 39.0, 5.49 },
-    { 13, 6, 54.31, -35, 51, 42.8, 6.54 },
-    { 10, 9, 31.80, -35, 51, 24.1, 6.13 },
-    { 3, 28, 11.50, -35, 51, 11.9, 6.50 },
-    { 2, 50, 14.81, -35, 50, 37.0, 5.92 },
-    { 7, 23, 58.30, -35, 50, 16.1, 6.31 },
-    { 5, 13, 46.49, -35, 49, 32.2, 6.98 },
-    { 9, 35, 11.81, -35, 49, 26.0, 6.49 },
-    { 11, 4, 54.19, -35, 48, 16.9, 5.43 },
-    { 5, 50, 57.60, -35, 46, 5.9, 3.12 },
-    { 17, 16, 21.50, -35, 44, 57.8, 6.12 },
-    { 10, 40, 51.60, -35, 44, 30.1, 6.37 },
-    { 5, 8, 14.81, -35, 43, 5.9, 6.52 },
-    { 9, 31, 32.90, -35, 42, 54.0, 5.87 },
-    { 5, 4, 26.09, -35, 42, 19.1, 6.34 },
-    { 13, 48, 55.10, -35, 42, 14.0, 6.53 },
-    { 12, 5, 56.71, -35, 41, 38.0, 6.23 },
-    { 3, 27, 33.41, -35, 40, 53.0, 5.71 },
-    { 2, 50, 40.39, -35, 40, 34.0, 5.47 },
-    { 5, 47, 18.60, -35, 40, 28.9, 6.32 },
-    { 20, 20, 51.89, -35, 40, 25.0, 6.46 },
-    { 13, 53, 32.81, -35, 39, 51.1, 5.54 },
-    { 1, 6, 26.50, -35, 39, 38.9, 6.61 },
-    { 4, 30, 40.30, -35, 39, 13.0, 5.96 },
-    { 18, 44, 19.39, -35, 38, 30.8, 4.87 },
-    { 17, 52, 57.89, -35, 37, 27.1, 6.03 },
-    { 20, 28, 46.70, -35, 35, 44.9, 6.10 },
-    { 2, 47, 33.70, -35, 33, 2.9, 6.51 },
-    { 4, 23, 7.70, -35, 32, 42.0, 6.39 },
-    { 23, 28, .70, -35, 32, 39.8, 6.32 },
-    { 22, 58, 34.99, -35, 31, 23.2, 6.13 },
-    { 6, 5, 27.10, -35, 30, 49.0, 5.80 },
-    { 6, 57, 17.59, -35, 30, 27.0, 6.23 },
-    { 9, 42, 41.40, -35, 30, 6.1, 6.41 },
-    { 8, 14, 13.20, -35, 29, 26.2, 5.78 },
-    { 5, 4, 24.41, -35, 28, 59.9, 4.55 },
-    { 5, 31, 12.70, -35, 28, 14.2, 3.87 },
-    { 8, 9, 10.20, -35, 27, 18.0, 6.20 },
-    { 8, 18, 17.40, -35, 27, 6.1, 5.58 },
-    { 17, 6, 28.39, -35, 27, 4.0, 6.13 },
-    { 19, 19, 40.01, -35, 25, 17.0, 5.59 },
-    { 12, 23, 35.40, -35, 24, 46.1, 5.32 },
-    { 6, 56, 45.70, -35, 20, 30.1, 6.29 },
-    { 11, 27, 58.49, -35, 19, 43.0, 6.45 },
-    { 13, 53, 52.20, -35, 18, 51.8, 6.19 },
-    { 8, 40, 6.19, -35, 18, 29.9, 3.97 },
-    { 5, 57, 32.21, -35, 16, 59.9, 4.36 },
-    { 7, 37, 44.81, -35, 16, 37.9, 6.60 },
-    { 19, 59, 44.21, -35, 16, 35.0, 4.37 },
-    { 4, 10, 45.79, -35, 16, 26.0, 6.44 },
-    { 6, 31, 13.01, -35, 15, 33.1, 5.84 },
-    { 16, 36, 22.51, -35, 15, 20.2, 4.16 },
-    { 7, 49, 14.69, -35, 14, 35.9, 5.93 },
-    { 20, 16, 26.50, -35, 11, 52.1, 6.53 },
-    { 14, 44, 59.21, -35, 11, 30.8, 4.92 },
-    { 12, 25, 21.79, -35, 11, 11.0, 5.73 },
-    { 14, 43, 39.41, -35, 10, 25.0, 4.05 },
-    { 6, 16, 33.10, -35, 8, 26.2, 4.37 },
-    { 5, 33, 7.39, -35, 8, 22.9, 5.78 },
-    { 0, 11, 43.99, -35, 7, 59.2, 5.25 },
-    { 8, 27, 59.30, -35, 6, 50.0, 5.75 },
-    { 11, 53, 26.81, -35, 4, .1, 6.17 },
-    { 6, 25, 29.90, -35, 3, 50.0, 6.25 },
-    { 17, 52, 55.90, -35, 1, 7.0, 6.45 },
-    { 9, 27, 38.40, -35, 0, 28.1, 6.65 },
-    { 17, 18, 57.19, -34, 59, 22.9, 5.91 },
-    { 19, 21, 29.90, -34, 59, 2.0, 6.48 },
-    { 7, 37, 22.10, -34, 58, 7.0, 4.53 },
-    { 5, 15, 46.99, -34, 55, 36.1, 6.66 },
-    { 4, 51, 28.20, -34, 54, 23.0, 5.86 },
-    { 0, 14, 58.20, -34, 54, 15.8, 6.17 },
-    { 17, 53, 23.30, -34, 53, 43.1, 5.60 },
-    { 5, 17, 29.09, -34, 53, 43.1, 4.83 },
-    { 7, 54, 39.91, -34, 50, 48.8, 6.15 },
-    { 17, 53, 58.10, -34, 49, 54.1, 6.42 },
-    { 17, 52, 13.61, -34, 47, 57.1, 5.90 },
-    { 14, 22, 19.70, -34, 47, 12.8, 5.56 },
-    { 17, 53, 45.50, -34, 47, 8.9, 6.38 },
-    { 7, 5, 31.99, -34, 46, 40.1, 6.14 },
-    { 4, 24, 56.40, -34, 45, 28.1, 6.55 },
-    { 17, 53, 54.91, -34, 45, 9.0, 5.96 },
-    { 23, 3, 29.81, -34, 44, 57.8, 5.11 },
-    { 18, 49, 17.21, -34, 44, 55.0, 6.62 },
-    { 11, 40, 12.79, -34, 44, 40.9, 4.70 },
-    { 11, 17, 39.19, -34, 44, 13.9, 6.45 },
-    { 3, 53, 38.90, -34, 43, 55.9, 5.11 },
-    { 17, 53, 19.61, -34, 43, 50.2, 6.17 },
-    { 15, 42, 40.99, -34, 42, 38.2, 4.75 },
-    { 7, 52, 15.70, -34, 42, 19.1, 5.01 },
-    { 12, 10, 2.50, -34, 42, 18.0, 6.17 },
-    { 16, 31, 22.90, -34, 42, 15.8, 4.23 },
-    { 5, 20, 20.59, -34, 41, 56.0, 6.34 },
-    { 19, 59, 51.29, -34, 41, 52.1, 5.30 },
-    { 17, 25, 2.71, -34, 41, 47.0, 6.16 },
-    { 15, 46, 44.21, -34, 40, 57.0, 5.61 },
-    { 5, 42, 15.10, -34, 40, 4.1, 5.29 },
-    { 2, 33, 7.01, -34, 39, .0, 5.90 },
-    { 8, 32, 58.61, -34, 38, 2.0, 6.36 },
-    { 8, 46, 49.20, -34, 37, 22.1, 6.37 },
-    { 8, 19, 29.40, -34, 35, 25.1, 6.43 },
-    { 2, 36, 58.61, -34, 34, 41.9, 5.79 },
-    { 13, 36, 50.50, -34, 28, 4.1, 6.50 },
-    { 17, 54, 27.19, -34, 27, 59.0, 5.96 },
-    { 13, 49, 26.71, -34, 27, 2.9, 4.19 },
-    { 17, 52, 19.70, -34, 25, .1, 5.84 },
-    { 15, 39, 46.01, -34, 24, 42.8, 4.67 },
-    { 6, 19, 40.99, -34, 23, 48.1, 5.78 },
-    { 18, 24, 10.30, -34, 23, 4.9, 1.85 },
-    { 6, 50, 52.39, -34, 22, 1.9, 4.99 },
-    { 15, 1, 58.10, -34, 21, 32.0, 6.22 },
-    { 5, 21, 16.90, -34, 20, 43.1, 6.09 },
-    { 6, 7, 3.70, -34, 18, 42.8, 5.83 },
-    { 16, 50, 9.79, -34, 17, 35.9, 2.29 },
-    { 17, 32, 24.50, -34, 16, 46.9, 6.17 },
-    { 7, 45, 34.99, -34, 10, 23.2, 5.37 },
-    { 22, 47, 19.10, -34, 9, 40.0, 6.28 },
-    { 6, 20, 36.31, -34, 8, 38.0, 5.53 },
-    { 7, 26, 42.29, -34, 8, 26.9, 5.90 },
-    { 12, 13, 13.01, -34, 7, 32.2, 6.50 },
-    { 17, 4, 49.39, -34, 7, 22.1, 4.87 },
-    { 17, 52, 49.20, -34, 6, 51.1, 6.06 },
-    { 6, 58, 25.10, -34, 6, 42.1, 5.06 },
-    { 18, 17, 36.10, -34, 6, 25.9, 6.16 },
-    { 9, 19, 47.90, -34, 6, 11.9, 6.39 },
-    { 5, 39, 38.90, -34, 4, 27.1, 2.64 },
-    { 10, 49, 57.00, -34, 3, 29.2, 5.61 },
-    { 22, 8, 25.99, -34, 2, 38.0, 4.99 },
-    { 4, 24, 2.21, -34, 1, .8, 3.96 },
-    { 22, 9, 55.70, -34, 0, 52.9, 5.37 },
-    { 4, 45, 49.61, -34, 0, 18.0, 6.86 },
-    { 12, 50, 41.21, -33, 59, 57.8, 4.91 },
-    { 15, 56, 53.50, -33, 57, 59.0, 5.12 },
-    { 15, 56, 54.19, -33, 57, 51.1, 5.62 },
-    { 0, 39, 57.91, -33, 57, 42.1, 6.69 },
-    { 18, 25, 54.60, -33, 56, 43.1, 6.30 },
-    { 21, 32, 14.59, -33, 56, 40.9, 5.97 },
-    { 6, 1, 16.39, -33, 54, 42.1, 5.55 },
-    { 11, 52, 54.60, -33, 54, 29.2, 4.28 },
-    { 4, 19, 3.00, -33, 54, 18.0, 6.37 },
-    { 14, 55, 44.69, -33, 51, 20.9, 5.32 },
-    { 2, 28, 1.70, -33, 48, 40.0, 5.14 },
-    { 5, 53, 6.89, -33, 48, 5.0, 4.87 },
-    { 18, 10, 55.20, -33, 47, 58.9, 6.16 },
-    { 4, 17, 53.69, -33, 47, 53.9, 3.56 },
-    { 12, 13, 36.70, -33, 47, 34.1, 6.33 },
-    { 20, 49, 58.10, -33, 46, 46.9, 4.90 },
-    { 1, 28, 43.30, -33, 45, 49.0, 6.58 },
-    { 8, 37, 29.69, -33, 44, 44.9, 6.48 },
-    { 10, 59, 13.90, -33, 44, 13.9, 5.71 },
-    { 7, 19, 13.70, -33, 43, 37.9, 6.30 },
-    { 23, 19, 43.20, -33, 42, 29.2, 6.37 },
-    { 20, 0, 20.30, -33, 42, 14.0, 5.66 },
-    { 17, 31, 47.40, -33, 42, 10.1, 6.44 },
-    { 21, 39, 6.10, -33, 40, 45.1, 6.28 },
-    { 15, 50, 57.50, -33, 37, 37.9, 3.95 },
-    { 13, 41, 45.70, -33, 35, 48.8, 6.05 },
-    { 11, 36, 34.99, -33, 34, 12.0, 5.74 },
-    { 8, 13, 41.09, -33, 34, 9.1, 6.37 },
-    { 8, 5, 44.90, -33, 34, 9.1, 6.14 },
-    { 17, 15, 19.30, -33, 32, 53.9, 5.53 },
-    { 16, 9, 52.61, -33, 32, 44.9, 5.54 },
-    { 0, 8, 3.50, -33, 31, 45.8, 5.68 },
-    { 19, 16, 32.81, -33, 31, 18.1, 6.25 },
-    { 16, 55, 57.79, -33, 30, 25.9, 6.37 },
-    { 13, 0, 32.59, -33, 30, 19.1, 6.02 },
-    { 7, 0, 49.80, -33, 27, 55.1, 6.40 },
-    { 7, 34, 12.79, -33, 27, 47.9, 6.11 },
-    { 6, 22, 6.79, -33, 26, 11.0, 3.85 },
-    { 20, 40, 19.80, -33, 25, 54.8, 5.47 },
-    { 9, 56, 35.50, -33, 25, 7.0, 5.84 },
-    { 5, 41, 27.00, -33, 24, 2.2, 6.34 },
-    { 12, 46, 46.01, -33, 18, 56.2, 5.86 },
-    { 11, 57, 3.70, -33, 18, 55.1, 6.21 },
-    { 13, 34, 43.61, -33, 18, 38.9, 6.44 },
-    { 14, 54, 37.99, -33, 18, 2.2, 5.82 },
-    { 7, 49, 35.40, -33, 17, 20.0, 5.60 },
-    { 16, 57, 11.09, -33, 15, 33.8, 5.48 },
-    { 14, 16, 18.29, -33, 14, 29.0, 6.55 },
-    { 14, 18, 23.81, -33, 13, 14.2, 6.54 },
-    { 16, 4, 17.81, -33, 12, 51.8, 6.10 },
-    { 16, 23, 56.71, -33, 11, 57.8, 6.47 },
-    { 13, 23, 8.71, -33, 11, 24.0, 6.22 },
-    { 8, 43, 35.50, -33, 11, 11.0, 3.68 },
-    { 20, 51, 58.80, -33, 10, 37.9, 6.04 },
-    { 16, 41, 45.50, -33, 8, 47.0, 5.87 },
-    { 22, 8, 42.70, -33, 7, 32.2, 6.37 },
-    { 15, 36, 11.40, -33, 5, 34.1, 6.24 },
-    { 22, 38, 51.50, -33, 4, 53.0, 5.66 },
-    { 5, 35, 15.41, -33, 4, 48.0, 5.78 },
-    { 1, 58, 26.69, -33, 4, .1, 6.35 },
-    { 8, 21, 22.99, -33, 3, 15.8, 4.83 },
-    { 17, 43, 6.89, -33, 3, 4.0, 6.40 },
-    { 21, 36, 48.89, -33, 2, 53.2, 6.11 },
-    { 19, 55, 5.09, -33, 2, 47.0, 6.46 },
-    { 13, 45, 41.21, -33, 2, 38.0, 4.23 },
-    { 10, 13, 24.79, -33, 1, 54.8, 6.38 },
-    { 21, 44, 56.81, -33, 1, 32.9, 4.34 },
-    { 18, 33, 57.79, -33, 1, .1, 5.28 },
-    { 16, 14, 22.30, -33, 0, 41.0, 5.92 },
-    { 0, 27, 55.70, -33, 0, 25.9, 4.81 },
-    { 20, 5, 32.11, -33, 0, .0, 6.53 },
-    { 13, 51, 50.11, -32, 59, 40.9, 6.06 },
-    { 13, 51, 49.61, -32, 59, 39.8, 4.56 },
-    { 18, 31, 4.80, -32, 59, 21.1, 5.34 },
-    { 22, 8, 22.99, -32, 59, 19.0, 4.50 },
-    { 11, 37, 1.20, -32, 59, 17.2, 6.29 },
-    { 15, 31, 50.30, -32, 52, 52.0, 6.46 },
-    { 22, 52, 31.61, -32, 52, 32.2, 4.46 },
-    { 11, 34, 29.50, -32, 49, 53.0, 5.98 },
-    { 12, 26, 51.70, -32, 49, 48.0, 5.55 },
-    { 22, 49, 59.09, -32, 48, 19.1, 6.33 },
-    { 8, 49, 51.50, -32, 46, 50.2, 5.21 },
-    { 18, 9, 59.90, -32, 43, 10.9, 6.43 },
-    { 6, 34, 35.30, -32, 42, 59.0, 5.62 },
-    { 10, 42, 43.20, -32, 42, 56.9, 5.64 },
-    { 3, 23, 44.59, -32, 42, 25.9, 6.50 },
-    { 8, 4, 16.20, -32, 40, 30.0, 5.31 },
-    { 17, 17, 3.70, -32, 39, 46.1, 5.55 },
-    { 16, 9, 31.70, -32, 38, 58.9, 6.19 },
-    { 15, 2, 59.30, -32, 38, 35.9, 5.44 },
-    { 14, 56, 30.91, -32, 38, 12.1, 6.06 },
-    { 5, 39, 49.80, -32, 37, 45.1, 5.45 },
-    { 8, 34, 31.70, -32, 35, 55.0, 6.43 },
-    { 11, 7, 8.40, -32, 35, 13.9, 6.59 },
-    { 17, 34, 42.50, -32, 34, 54.1, 5.70 },
-    { 6, 28, 10.10, -32, 34, 48.0, 4.48 },
-    { 17, 18, 20.40, -32, 33, 11.9, 6.36 },
-    { 22, 10, 8.81, -32, 32, 53.9, 4.92 },
-    { 1, 26, 58.10, -32, 32, 35.2, 5.79 },
-    { 22, 55, 56.90, -32, 32, 22.9, 4.21 },
-    { 12, 32, 4.51, -32, 32, 1.0, 6.46 },
-    { 23, 18, 49.39, -32, 31, 54.8, 4.41 },
-    { 2, 44, 20.50, -32, 31, 30.0, 6.22 },
-    { 8, 52, 26.09, -32, 30, 33.1, 6.50 },
-    { 6, 49, 50.50, -32, 30, 31.0, 3.96 },
-    { 2, 59, 38.30, -32, 30, 25.9, 6.31 },
-    { 11, 41, 43.99, -32, 29, 58.9, 5.22 },
-    { 8, 3, 4.10, -32, 27, 50.0, 5.82 },
-    { 17, 12, 58.70, -32, 26, 19.0, 6.01 },
-    { 11, 12, 14.81, -32, 26, 2.0, 6.38 },
-    { 2, 49, 5.40, -32, 24, 20.9, 4.46 },
-    { 6, 28, 39.19, -32, 22, 16.0, 5.74 },
-    { 11, 9, 53.40, -32, 22, 3.0, 5.81 },
-    { 22, 31, 30.31, -32, 20, 46.0, 4.29 },
-    { 21, 6, 24.70, -32, 20, 30.1, 5.18 },
-    { 6, 37, 47.59, -32, 20, 22.9, 5.27 },
-    { 1, 42, 8.59, -32, 19, 36.8, 5.25 },
-    { 5, 45, 59.90, -32, 18, 23.0, 5.17 },
-    { 21, 1, 17.50, -32, 15, 28.1, 4.67 },
-    { 7, 23, 31.90, -32, 12, 7.9, 5.39 },
-    { 9, 37, 9.89, -32, 10, 43.0, 5.63 },
-    { 21, 17, 56.30, -32, 10, 21.0, 4.71 },
-    { 6, 4, 20.30, -32, 10, 21.0, 5.65 },
-    { 8, 30, 28.61, -32, 9, 33.8, 5.65 },
-    { 17, 1, 52.70, -32, 8, 37.0, 5.03 },
-    { 8, 14, 10.99, -32, 8, 26.9, 6.06 },
-    { 0, 29, 48.91, -32, 7, .1, 6.57 },
-    { 16, 43, 38.71, -32, 6, 22.0, 6.46 },
-    { 19, 30, 14.69, -32, 5, 31.9, 6.60 },
-    { 23, 40, 38.21, -32, 4, 23.2, 5.31 },
-    { 20, 4, 19.61, -32, 3, 23.0, 4.99 },
-    { 20, 50, 47.11, -32, 3, 15.8, 6.36 },
-    { 6, 32, 39.00, -32, 1, 50.2, 5.69 },
-    { 16, 3, 34.30, -32, 0, 2.2, 6.01 },
-    { 5, 56, 49.01, -31, 58, 34.0, 6.44 },
-    { 11, 3, 16.10, -31, 57, 38.9, 6.46 },
-    { 3, 42, 14.90, -31, 56, 17.9, 5.00 },
-    { 13, 53, 12.50, -31, 55, 40.1, 4.73 },
-    { 7, 23, .60, -31, 55, 26.0, 5.43 },
-    { 23, 55, 16.61, -31, 55, 18.1, 6.10 },
-    { 19, 46, 1.20, -31, 54, 31.0, 5.52 },
-    { 1, 34, 50.71, -31, 53, 31.9, 6.12 },
-    { 9, 30, 45.41, -31, 53, 29.0, 7.00 },
-    { 16, 1, 19.51, -31, 53, 21.8, 6.33 },
-    { 9, 30, 46.10, -31, 53, 21.8, 6.18 },
-    { 23, 55, 16.61, -31, 53, 3.1, 6.83 },
-    { 3, 34, 33.50, -31, 52, 28.9, 6.40 },
-    { 9, 31, 32.21, -31, 52, 18.8, 5.93 },
-    { 23, 37, 5.40, -31, 52, 14.9, 6.52 },
-    { 11, 33, .10, -31, 51, 28.1, 3.54 },
-    { 7, 28, 51.31, -31, 50, 53.9, 6.38 },
-    { 7, 28, 51.50, -31, 50, 48.8, 7.13 },
-    { 11, 0, 40.80, -31, 50, 21.8, 6.07 },
-    { 19, 20, 26.21, -31, 49, 4.1, 6.58 },
-    { 7, 24, 43.80, -31, 48, 32.0, 5.35 },
-    { 6, 45, 22.80, -31, 47, 37.0, 5.92 },
-    { 6, 23, 14.40, -31, 47, 24.0, 6.34 },
-    { 6, 55, 54.79, -31, 47, 24.0, 6.36 },
-    { 15, 56, 13.90, -31, 47, 8.9, 6.29 },
-    { 5, 2, 22.80, -31, 46, 17.0, 5.94 },
-    { 9, 20, 44.21, -31, 45, 38.2, 6.82 },
-    { 7, 25, 43.01, -31, 44, 19.0, 6.31 },
-    { 6, 50, 23.30, -31, 42, 22.0, 5.70 },
-    { 17, 49, 10.51, -31, 42, 11.9, 4.83 },
-    { 10, 48, 14.21, -31, 41, 17.9, 5.88 },
-    { 14, 3, 1.70, -31, 41, 2.0, 6.18 },
-    { 8, 27, 16.39, -31, 40, 23.2, 6.33 },
-    { 22, 36, 35.40, -31, 39, 50.0, 5.82 },
-    { 7, 40, 52.70, -31, 39, 38.9, 6.56 },
-    { 22, 55, 51.41, -31, 37, 59.2, 6.10 },
-    { 13, 52, .91, -31, 37, 9.8, 6.12 },
-    { 20, 41, 23.71, -31, 35, 53.9, 5.76 },
-    { 22, 56, 24.00, -31, 33, 56.2, 6.48 },
-    { 1, 2, 26.40, -31, 33, 6.8, 5.50 },
-    { 15, 14, 37.30, -31, 31, 9.1, 4.91 },
-    { 13, 16, 53.11, -31, 30, 22.0, 5.10 },
-    { 8, 32, 51.50, -31, 30, 2.9, 6.38 },
-    { 7, 29, 4.90, -31, 27, 23.0, 5.77 },
-    { 0, 16, 8.90, -31, 26, 47.0, 5.67 },
-    { 5, 56, 20.90, -31, 22, 57.0, 5.50 },
-    { 13, 55, 44.50, -31, 17, 6.0, 6.51 },
-    { 21, 29, 3.79, -31, 14, 19.0, 6.50 },
-    { 15, 40, 15.41, -31, 12, 49.0, 6.34 },
-    { 15, 18, 41.30, -31, 12, 33.8, 6.18 },
-    { 2, 28, 35.40, -31, 6, 9.0, 6.11 },
-    { 11, 32, 54.10, -31, 5, 13.9, 5.04 },
-    { 7, 13, 47.11, -31, 5, 2.0, 6.60 },
-    { 15, 55, 30.41, -31, 5, 1.0, 6.21 },
-    { 3, 33, 56.81, -31, 4, 49.1, 6.20 },
-    { 1, 49, 19.49, -31, 4, 22.1, 6.34 },
-    { 6, 44, 28.39, -31, 4, 14.2, 5.20 },
-    { 10, 27, 9.10, -31, 4, 4.1, 4.25 },
-    { 19, 4, 25.10, -31, 2, 48.8, 5.50 },
-    { 18, 58, 21.29, -31, 2, 10.0, 6.12 },
-    { 0, 23, 12.60, -31, 2, 10.0, 6.55 },
-    { 6, 58, 43.80, -30, 59, 52.1, 6.42 },
-    { 7, 30, 42.50, -30, 57, 43.9, 4.65 },
-    { 6, 45, 31.30, -30, 56, 56.0, 5.80 },
-    { 1, 23, 31.01, -30, 56, 44.2, 5.84 },
-    { 14, 41, 51.10, -30, 55, 59.9, 6.37 },
-    { 8, 15, 52.51, -30, 55, 32.9, 6.21 },
-    { 15, 6, 33.29, -30, 55, 8.0, 5.96 },
-    { 7, 55, 13.70, -30, 55, 3.0, 6.44 },
-    { 16, 19, 32.69, -30, 54, 24.1, 5.49 },
-    { 21, 47, 44.21, -30, 53, 53.9, 5.01 },
-    { 7, 16, 57.19, -30, 53, 48.1, 6.32 },
-    { 11, 51, 41.59, -30, 50, 6.0, 5.85 },
-    { 3, 16, 11.30, -30, 49, 39.0, 6.65 },
-    { 7, 12, 4.10, -30, 49, 18.1, 6.10 },
-    { 2, 51, 55.30, -30, 48, 51.8, 6.40 },
-    { 1, 12, 23.40, -30, 48, 7.9, 6.52 },
-    { 4, 43, 9.29, -30, 45, 56.2, 5.68 },
-    { 18, 25, 1.51, -30, 45, 24.1, 5.60 },
-    { 18, 52, 41.69, -30, 44, 3.1, 6.63 },
-    { 18, 10, 5.69, -30, 43, 43.0, 5.53 },
-    { 2, 12, 54.50, -30, 43, 26.0, 5.28 },
-    { 20, 53, 25.01, -30, 43, 7.0, 6.35 },
-    { 4, 36, 50.90, -30, 43, .1, 6.30 },
-    { 14, 33, 9.60, -30, 42, 51.1, 6.09 },
-    { 7, 15, 21.00, -30, 41, 11.0, 5.36 },
-    { 22, 40, 22.30, -30, 39, 32.0, 5.87 },
-    { 7, 6, .60, -30, 39, 20.2, 6.34 },
-    { 2, 40, 2.50, -30, 38, 2.0, 6.52 },
-    { 10, 29, 35.40, -30, 36, 25.9, 5.56 },
-    { 21, 55, 55.61, -30, 36, 23.0, 6.41 },
-    { 16, 54, 36.00, -30, 35, 13.9, 6.35 },
-    { 6, 45, 2.40, -30, 35, 10.0, 6.54 },
-    { 10, 2, 49.30, -30, 34, 39.0, 6.54 },
-    { 14, 52, 33.10, -30, 34, 36.8, 6.29 },
-    { 4, 35, 33.00, -30, 33, 43.9, 3.82 },
-    { 17, 51, 12.50, -30, 33, 25.9, 6.66 },
-    { 19, 58, 56.40, -30, 32, 17.2, 6.28 },
-    { 5, 42, 11.59, -30, 32, 8.2, 6.19 },
-    { 4, 0, 40.70, -30, 29, 26.9, 5.93 },
-    { 20, 34, 47.40, -30, 28, 25.0, 6.40 },
-    { 6, 39, 42.70, -30, 28, 13.1, 5.71 },
-    { 18, 5, 48.50, -30, 25, 27.1, 2.99 },
-    { 12, 39, 3.50, -30, 25, 19.9, 5.89 },
-    { 17, 8, 47.50, -30, 24, 13.0, 5.97 },
-    { 9, 9, 56.40, -30, 21, 55.1, 5.59 },
-    { 7, 13, 57.19, -30, 20, 24.0, 6.33 },
-    { 7, 57, 40.10, -30, 20, 4.9, 4.79 },
-    { 8, 9, 6.70, -30, 19, 21.0, 6.65 },
-    { 11, 47, 15.70, -30, 17, 12.8, 6.48 },
-    { 7, 56, 22.80, -30, 17, 7.1, 6.33 },
-    { 1, 31, 43.30, -30, 16, 59.9, 5.82 },
-    { 17, 59, 5.50, -30, 15, 11.9, 7.04 },
-    { 17, 59, 5.21, -30, 15, 11.2, 5.16 },
-    { 7, 23, 54.29, -30, 13, .8, 6.60 },
-    { 17, 15, 51.50, -30, 12, 38.2, 6.21 },
-    { 9, 45, 21.79, -30, 12, 10.1, 6.45 },
-    { 2, 38, 18.70, -30, 11, 39.1, 5.83 },
-    { 11, 7, 54.41, -30, 10, 28.9, 6.54 },
-    { 3, 47, 55.99, -30, 10, 4.1, 5.54 },
-    { 10, 23, 13.10, -30, 9, 43.9, 6.27 },
-    { 15, 17, 49.90, -30, 8, 56.0, 4.34 },
-    { 21, 6, 1.20, -30, 7, 30.0, 5.68 },
-    { 5, 29, 6.70, -30, 7, .1, 6.75 },
-    { 6, 20, 18.79, -30, 3, 47.9, 3.02 },
-    { 2, 36, 9.29, -30, 2, 40.9, 5.75 },
-    { 4, 47, 49.61, -30, 1, 13.1, 6.37 },
-    { 20, 15, 50.59, -30, 0, 19.1, 6.30 },
-    { 8, 17, 58.30, -30, 0, 11.9, 6.45 },
-    { 2, 1, 14.71, -30, 0, 6.1, 5.35 },
-    { 11, 8, 15.79, -29, 58, 22.1, 6.49 },
-    { 22, 4, 23.90, -29, 55, .1, 6.47 },
-    { 8, 12, 46.01, -29, 54, 38.9, 6.52 },
-    { 1, 36, 8.40, -29, 54, 27.0, 5.69 },
-    { 22, 3, 17.21, -29, 54, 15.1, 7.10 },
-    { 3, 47, 20.11, -29, 54, 6.8, 6.55 },
-    { 15, 52, 12.79, -29, 53, 12.1, 6.40 },
-    { 19, 2, 36.70, -29, 52, 49.1, 2.60 },
-    { 17, 27, 21.29, -29, 52, .8, 4.29 },
-    { 2, 57, 13.10, -29, 51, 19.1, 6.29 },
-    { 5, 33, 52.10, -29, 50, 56.0, 6.53 },
-    { 18, 20, 59.69, -29, 49, 41.2, 2.70 },
-    { 18, 27, 49.49, -29, 48, 59.0, 5.92 },
-    { 3, 13, 37.99, -29, 48, 15.1, 6.16 },
-    { 6, 15, 57.19, -29, 47, 17.9, 6.67 },
-    { 15, 38, 39.41, -29, 46, 40.1, 3.66 },
-    { 4, 33, 30.60, -29, 46, .1, 4.51 },
-    { 6, 6, 5.50, -29, 45, 31.0, 5.81 },
-    { 19, 26, 56.50, -29, 44, 35.9, 5.67 },
-    { 17, 27, 37.49, -29, 43, 27.8, 6.00 },
-    { 0, 2, 19.90, -29, 43, 13.1, 5.01 },
-    { 16, 24, 39.70, -29, 42, 16.9, 5.84 },
-    { 16, 24, 39.60, -29, 42, 11.9, 6.63 },
-    { 18, 35, 59.69, -29, 41, 57.1, 6.37 },
-    { 21, 34, 52.99, -29, 41, 46.0, 6.41 },
-    { 2, 2, 28.10, -29, 39, 54.0, 6.42 },
-    { 10, 29, 28.99, -29, 39, 49.0, 5.58 },
-    { 22, 57, 39.10, -29, 37, 19.9, 1.16 },
-    { 18, 5, 1.30, -29, 34, 48.0, 4.69 },
-    { 13, 32, 34.51, -29, 33, 55.1, 6.45 },
-    { 8, 39, 42.50, -29, 33, 40.0, 4.89 },
-    { 13, 38, 42.00, -29, 33, 38.9, 5.83 },
-    { 0, 33, 41.11, -29, 33, 29.9, 5.55 },
-    { 22, 51, 20.90, -29, 32, 10.0, 5.97 },
-    { 1, 3, 17.59, -29, 31, 32.9, 6.29 },
-    { 23, 10, 46.61, -29, 31, 30.0, 6.51 },
-    { 19, 11, 18.89, -29, 30, 7.9, 6.30 },
-    { 14, 28, 10.39, -29, 29, 30.1, 4.97 },
-    { 23, 59, 27.89, -29, 29, 6.0, 5.62 },
-    { 8, 50, 2.21, -29, 27, 47.2, 5.87 },
-    { 22, 59, 35.81, -29, 27, 43.9, 5.51 },
-    { 5, 51, 59.50, -29, 26, 55.0, 6.45 },
-    { 16, 11, 1.99, -29, 24, 59.0, 5.13 },
-    { 6, 13, 33.29, -29, 23, 46.0, 6.54 },
-    { 18, 52, 37.01, -29, 22, 45.8, 6.13 },
-    { 22, 42, 22.10, -29, 21, 38.9, 6.17 },
-    { 0, 58, 36.41, -29, 21, 27.0, 4.31 },
-    { 3, 46, 27.41, -29, 20, 17.2, 5.90 },
-    { 19, 25, 4.10, -29, 18, 33.1, 5.93 },
-    { 7, 24, 5.71, -29, 18, 11.2, 2.45 },
-    { 2, 4, 29.40, -29, 17, 48.8, 4.69 },
-    { 14, 15, 1.30, -29, 16, 54.8, 6.08 },
-    { 0, 4, 20.30, -29, 16, 7.0, 6.40 },
-    { 11, 32, 16.10, -29, 15, 47.9, 5.81 },
-    { 11, 32, 16.30, -29, 15, 40.0, 5.64 },
-    { 8, 26, 50.81, -29, 12, 55.1, 6.73 },
-    { 15, 56, 53.11, -29, 12, 51.1, 3.88 },
-    { 20, 20, 28.10, -29, 11, 49.9, 6.30 },
-    { 11, 41, 8.40, -29, 11, 47.0, 6.44 },
-    { 14, 57, 13.61, -29, 9, 28.1, 6.29 },
-    { 7, 27, 59.21, -29, 9, 20.9, 5.54 },
-    { 5, 54, 14.09, -29, 8, 52.1, 6.36 },
-    { 16, 2, 39.41, -29, 8, 8.9, 6.03 },
-    { 20, 30, 56.81, -29, 6, 45.0, 6.39 },
-    { 13, 50, 6.50, -29, 4, 53.0, 6.18 },
-    { 10, 18, 7.61, -28, 59, 30.8, 5.34 },
-    { 3, 12, 4.30, -28, 59, 12.8, 3.87 },
-    { 0, 21, 31.20, -28, 58, 54.1, 5.18 },
-    { 6, 58, 37.49, -28, 58, 19.9, 1.50 },
-    { 7, 43, 48.50, -28, 57, 16.9, 3.96 },
-    { 2, 59, 6.60, -28, 54, 24.8, 6.14 },
-    { 18, 11, 58.20, -28, 54, 5.0, 6.51 },
-    { 23, 1, 19.39, -28, 51, 13.0, 5.55 },
-    { 9, 23, 12.31, -28, 50, 2.0, 4.69 },
-    { 23, 8, 21.00, -28, 49, 23.9, 5.60 },
-    { 8, 59, 15.70, -28, 48, 22.0, 6.25 },
-    { 3, 18, 2.81, -28, 47, 48.8, 5.91 },
-    { 19, 49, 11.59, -28, 47, 20.0, 6.05 },
-    { 9, 26, 44.81, -28, 47, 15.0, 6.10 },
-    { 6, 24, 43.90, -28, 46, 48.0, 6.39 },
-    { 21, 18, 54.41, -28, 45, 56.2, 6.40 },
-    { 17, 58, 39.10, -28, 45, 33.1, 6.01 },
-    { 22, 38, 44.69, -28, 44, 52.1, 6.47 },
-    { 11, 6, 38.71, -28, 43, 40.1, 6.77 },
-    { 5, 36, 10.30, -28, 42, 28.1, 6.26 },
-    { 13, 32, 35.90, -28, 41, 34.1, 5.69 },
-    { 5, 37, 44.59, -28, 41, 21.8, 5.31 },
-    { 20, 25, 26.81, -28, 39, 47.9, 5.85 },
-    { 18, 17, 24.00, -28, 39, 9.0, 6.19 },
-    { 5, 47, 4.70, -28, 38, 21.1, 6.22 },
-    { 19, 7, 30.91, -28, 38, 12.8, 6.04 },
-    { 9, 32, 18.50, -28, 37, 41.2, 6.46 },
-    { 8, 50, 21.60, -28, 37, 5.2, 6.17 },
-    { 16, 18, 17.90, -28, 36, 50.0, 4.78 },
-    { 10, 12, 2.90, -28, 36, 23.0, 6.28 },
-    { 13, 54, 16.61, -28, 34, 10.9, 6.04 },
-    { 6, 53, 33.91, -28, 32, 22.9, 6.04 },
-    { 16, 45, .19, -28, 30, 34.9, 6.02 },
-    { 7, 0, 42.60, -28, 29, 21.8, 6.27 },
-    { 11, 55, 40.10, -28, 28, 36.8, 5.93 },
-    { 18, 8, 4.99, -28, 27, 25.9, 4.57 },
-    { 22, 0, 50.21, -28, 27, 13.0, 5.42 },
-    { 18, 22, .19, -28, 25, 48.0, 6.16 },
-    { 16, 12, 15.91, -28, 25, 3.0, 5.67 },
-    { 7, 43, 32.40, -28, 24, 40.0, 4.59 },
-    { 7, 35, 22.80, -28, 22, 9.8, 4.64 },
-    { 22, 39, 43.99, -28, 19, 31.1, 6.31 },
-    { 12, 44, .50, -28, 19, 26.0, 5.48 },
-    { 22, 10, .10, -28, 17, 33.0, 6.44 },
-    { 18, 17, 23.71, -28, 17, 21.1, 6.40 },
-    { 10, 31, 48.60, -28, 14, 15.0, 6.05 },
-    { 2, 33, 50.71, -28, 13, 57.0, 4.90 },
-    { 16, 35, 52.99, -28, 12, 58.0, 2.82 },
-    { 15, 38, 15.70, -28, 12, 24.1, 6.32 },
-    { 17, 23, 21.60, -28, 8, 35.2, 5.35 },
-    { 15, 37, 1.51, -28, 8, 6.0, 3.58 },
-    { 23, 48, 55.61, -28, 7, 49.1, 4.57 },
-    { 13, 31, 33.29, -28, 6, 46.1, 6.47 },
-    { 3, 1, 37.70, -28, 5, 30.1, 5.89 },
-    { 23, 9, 44.59, -28, 5, 19.0, 5.87 },
-    { 4, 46, 25.80, -28, 5, 15.0, 6.19 },
-    { 11, 8, 43.90, -28, 4, 50.2, 5.44 },
-    { 17, 56, 41.90, -28, 3, 55.1, 5.80 },
-    { 15, 46, 12.79, -28, 3, 42.1, 6.51 },
-    { 15, 2, 6.41, -28, 3, 38.2, 5.85 },
-    { 15, 34, 37.30, -28, 2, 48.8, 5.15 },
-    { 0, 9, 21.00, -27, 59, 16.1, 5.42 },
-    { 14, 50, 17.30, -27, 57, 37.1, 4.41 },
-    { 7, 40, 43.39, -27, 56, 44.9, 6.76 },
-    { 3, 38, 47.69, -27, 56, 35.2, 6.01 },
-    { 2, 49, 54.19, -27, 56, 30.1, 5.39 },
-    { 7, 1, 43.10, -27, 56, 4.9, 3.47 },
-    { 16, 12, 18.19, -27, 55, 35.0, 4.59 },
-    { 20, 54, 6.79, -27, 55, 32.2, 6.41 },
-    { 17, 43, 17.81, -27, 53, 3.1, 6.36 },
-    { 7, 16, 34.99, -27, 52, 52.0, 4.64 },
-    { 5, 37, 16.49, -27, 52, 17.0, 6.16 },
-    { 19, 24, 30.10, -27, 51, 56.2, 6.04 },
-    { 7, 23, 29.09, -27, 50, 3.1, 5.38 },
-    { 3, 7, 50.90, -27, 49, 52.0, 6.19 },
-    { 17, 47, 33.60, -27, 49, 50.9, 4.54 },
-    { 0, 11, 34.39, -27, 47, 58.9, 5.41 },
-    { 0, 55, 55.49, -27, 46, 32.2, 6.10 },
-    { 6, 30, 46.30, -27, 46, 9.8, 5.93 },
-    { 9, 44, 12.10, -27, 46, 9.8, 4.79 },
-    { 22, 14, 18.79, -27, 46, .8, 5.43 },
-    { 17, 12, 25.01, -27, 45, 42.8, 6.14 },
-    { 14, 23, 5.81, -27, 45, 14.0, 4.77 },
-    { 12, 25, 18.41, -27, 44, 57.1, 6.09 },
-    { 21, 3, 10.20, -27, 43, 54.8, 6.25 },
-    { 8, 50, 31.90, -27, 42, 36.0, 4.01 },
-    { 20, 2, 39.50, -27, 42, 34.9, 4.58 },
-    { 8, 55, 31.51, -27, 40, 54.8, 4.89 },
-    { 19, 6, 56.40, -27, 40, 14.2, 3.32 },
-    { 14, 58, 39.19, -27, 39, 25.9, 5.65 },
-    { 4, 5, 37.39, -27, 39, 6.1, 5.59 },
-    { 21, 13, 17.30, -27, 37, 9.8, 5.42 },
-    { 12, 48, 26.40, -27, 35, 51.0, 5.66 },
-    { 6, 57, 42.41, -27, 32, 15.0, 6.23 },
-    { 7, 10, 19.39, -27, 29, 29.0, 5.46 },
-    { 9, 56, 54.00, -27, 28, 30.0, 6.32 },
-    { 7, 12, 24.10, -27, 28, 27.1, 6.59 },
-    { 16, 44, 17.30, -27, 27, 22.0, 6.58 },
-    { 14, 2, 22.80, -27, 25, 48.0, 5.48 },
-    { 10, 37, 13.70, -27, 24, 45.0, 4.89 },
-    { 5, 19, 23.69, -27, 22, 8.0, 5.99 },
-    { 7, 13, 36.31, -27, 21, 23.0, 6.12 },
-    { 1, 46, 1.01, -27, 20, 57.1, 6.39 },
-    { 6, 44, 51.89, -27, 20, 29.0, 6.45 },
-    { 15, 54, 30.00, -27, 20, 19.0, 6.14 },
-    { 6, 50, 6.00, -27, 20, 2.0, 7.04 },
-    { 8, 29, 27.60, -27, 19, 57.0, 6.70 },
-    { 9, 52, 58.01, -27, 19, 55.9, 6.30 },
-    { 3, 26, 22.51, -27, 19, 3.0, 5.93 },
-    { 11, 5, 19.90, -27, 17, 37.0, 4.94 },
-    { 11, 5, 57.60, -27, 17, 16.1, 5.71 },
-    { 11, 50, 37.10, -27, 16, 40.1, 6.48 },
-    { 14, 12, 46.01, -27, 15, 40.0, 5.08 },
-    { 20, 45, 13.20, -27, 14, 49.9, 6.50 },
-    { 19, 56, 56.81, -27, 10, 12.0, 4.52 },
-    { 6, 58, 7.61, -27, 9, 52.9, 6.37 },
-    { 6, 10, 34.61, -27, 9, 15.1, 5.72 },
-    { 12, 37, 42.19, -27, 8, 20.0, 5.45 },
-    { 22, 29, 46.01, -27, 6, 25.9, 5.95 },
-    { 22, 40, 39.41, -27, 2, 37.0, 4.17 },
-    { 18, 18, 3.19, -27, 2, 33.0, 4.65 },
-    { 23, 54, 21.41, -27, 2, 31.9, 6.35 },
-    { 7, 14, 51.10, -27, 2, 17.2, 5.58 },
-    { 20, 15, 17.40, -27, 1, 58.1, 5.73 },
-    { 10, 13, 19.39, -27, 1, 44.0, 6.25 },
-    { 7, 34, 34.90, -27, 0, 42.8, 5.77 },
-    { 18, 45, 39.41, -26, 59, 26.9, 3.17 },
-    { 23, 21, 15.50, -26, 59, 12.1, 5.64 },
-    { 19, 29, 52.20, -26, 59, 8.2, 5.52 },
-    { 17, 48, 27.79, -26, 58, 30.0, 6.35 },
-    { 7, 20, 55.01, -26, 57, 49.0, 6.01 },
-    { 6, 53, .10, -26, 57, 27.0, 6.40 },
-    { 5, 15, 24.29, -26, 56, 35.9, 5.07 },
-    { 20, 51, 49.30, -26, 55, 9.1, 4.11 },
-    { 21, 1, 45.31, -26, 52, 52.0, 6.05 },
-    { 7, 39, 26.90, -26, 51, 47.2, 6.50 },
-    { 14, 25, 47.69, -26, 51, 9.0, 6.48 },
-    { 8, 35, 28.80, -26, 50, 37.0, 5.96 },
-    { 11, 2, 24.41, -26, 49, 53.0, 6.23 },
-    { 22, 4, 36.79, -26, 49, 21.0, 5.96 },
-    { 7, 38, 49.80, -26, 48, 13.0, 4.62 },
-    { 7, 38, 49.30, -26, 48, 6.1, 4.50 },
-    { 7, 17, 47.90, -26, 47, 51.0, 6.46 },
-    { 7, 14, 48.70, -26, 46, 22.1, 3.85 },
-    { 9, 8, 43.49, -26, 46, 4.1, 6.15 },
-    { 18, 28, 6.19, -26, 45, 25.9, 6.27 },
-    { 11, 48, 45.10, -26, 44, 58.9, 5.11 },
-    { 11, 32, 23.30, -26, 44, 48.1, 6.16 },
-    { 12, 51, 57.91, -26, 44, 17.2, 6.15 },
-    { 5, 23, 12.00, -26, 42, 20.9, 6.49 },
-    { 6, 9, 47.21, -26, 42, 2.9, 6.27 },
-    { 14, 6, 22.30, -26, 40, 57.0, 3.27 },
-    { 10, 36, 4.61, -26, 40, 30.0, 6.29 },
-    { 9, 1, 11.40, -26, 39, 50.0, 6.20 },
-    { 7, 7, .10, -26, 39, 28.1, 6.62 },
-    { 18, 52, 28.49, -26, 39, 1.1, 6.29 },
-    { 14, 47, 57.50, -26, 38, 47.0, 5.77 },
-    { 20, 40, 36.00, -26, 38, 42.0, 6.51 },
-    { 18, 27, 43.80, -26, 38, 4.9, 6.31 },
-    { 23, 57, 8.30, -26, 37, 25.0, 6.26 },
-    { 14, 13, 13.20, -26, 36, 43.9, 6.24 },
-    { 3, 20, 45.19, -26, 36, 23.0, 6.39 },
-    { 17, 15, 21.00, -26, 36, 10.1, 5.11 },
-    { 17, 15, 20.81, -26, 36, 5.0, 5.07 },
-    { 9, 29, 54.50, -26, 35, 22.9, 5.48 },
-    { 7, 18, 51.19, -26, 35, 8.9, 5.28 },
-    { 18, 28, 57.41, -26, 34, 54.1, 6.50 },
-    { 13, 11, 39.19, -26, 33, 6.1, 6.50 },
-    { 9, 56, 46.51, -26, 33, 1.1, 6.28 },
-    { 16, 31, 22.80, -26, 32, 16.1, 6.10 },
-    { 17, 6, 53.21, -26, 30, 47.2, 6.29 },
-    { 13, 36, 48.41, -26, 29, 42.0, 5.78 },
-    { 10, 30, 51.41, -26, 29, 2.0, 6.51 },
-    { 6, 11, 13.51, -26, 28, 55.9, 6.09 },
-    { 12, 56, 30.10, -26, 27, 37.1, 6.62 },
-    { 16, 29, 24.41, -26, 25, 54.8, 0.96 },
-    { 7, 8, 23.50, -26, 23, 35.9, 1.84 },
-    { 21, 19, 45.79, -26, 21, 11.2, 6.56 },
-    { 7, 14, 15.19, -26, 21, 9.0, 4.66 },
-    { 7, 42, 48.10, -26, 21, 4.0, 5.64 },
-    { 8, 22, 49.90, -26, 20, 53.2, 5.90 },
-    { 15, 10, 18.60, -26, 19, 58.1, 5.76 },
-    { 22, 12, 57.50, -26, 19, 40.1, 6.17 },
-    { 16, 8, 7.61, -26, 19, 36.1, 5.38 },
-    { 19, 55, 50.40, -26, 17, 57.8, 4.70 },
-    { 18, 55, 15.91, -26, 17, 48.1, 2.02 },
-    { 20, 56, 47.30, -26, 17, 47.0, 5.70 },
-    { 0, 13, 44.21, -26, 17, 4.9, 6.31 },
-    { 6, 3, 15.50, -26, 17, 3.8, 5.04 },
-    { 15, 37, 28.49, -26, 16, 48.0, 6.19 },
-    { 5, 2, 9.79, -26, 16, 30.0, 5.02 },
-    { 17, 31, 44.40, -26, 16, 10.9, 6.05 },
-    { 15, 55, 30.10, -26, 15, 56.9, 5.62 },
-    { 8, 37, 52.20, -26, 15, 18.0, 5.27 },
-    { 23, 44, 28.90, -26, 14, 47.0, 6.17 },
-    { 1, 30, 22.90, -26, 12, 28.1, 5.93 },
-    { 19, 58, 57.19, -26, 11, 44.2, 4.83 },
-    { 15, 13, 53.30, -26, 11, 37.0, 5.84 },
-    { 21, 36, 10.99, -26, 10, 17.0, 5.73 },
-    { 5, 5, 16.20, -26, 9, 9.0, 5.73 },
-    { 8, 27, 53.50, -26, 7, 57.0, 6.62 },
-    { 7, 34, 28.80, -26, 7, .1, 6.65 },
-    { 13, 45, 36.89, -26, 6, 58.0, 5.81 },
-    { 15, 58, 51.10, -26, 6, 51.1, 2.89 },
-    { 3, 15, .19, -26, 6, 1.1, 6.25 },
-    { 14, 47, 44.81, -26, 5, 15.0, 5.24 },
-    { 22, 30, 53.71, -26, 4, 25.0, 6.43 },
-    { 0, 13, 42.10, -26, 1, 18.8, 5.94 },
-    { 20, 41, 24.10, -26, 0, .0, 6.28 },
-    { 9, 21, 29.59, -25, 57, 56.2, 4.72 },
-    { 2, 18, 58.51, -25, 56, 44.2, 6.34 },
-    { 17, 26, 55.20, -25, 56, 35.9, 6.44 },
-    { 7, 12, 12.19, -25, 56, 33.0, 5.92 },
-    { 7, 48, 5.21, -25, 56, 13.9, 4.50 },
-    { 9, 54, 12.31, -25, 55, 57.0, 4.88 },
-    { 22, 47, 56.21, -25, 54, 42.8, 6.30 },
-    { 5, 10, 44.50, -25, 54, 33.8, 6.41 },
-    { 11, 58, 54.41, -25, 54, 32.0, 6.43 },
-    { 19, 13, 13.70, -25, 54, 24.1, 5.80 },
-    { 22, 16, 37.39, -25, 53, 53.9, 6.15 },
-    { 7, 21, 4.30, -25, 53, 29.0, 5.87 },
-    { 16, 3, 20.59, -25, 51, 55.1, 5.00 },
-    { 9, 8, 2.90, -25, 51, 29.9, 4.58 },
-    { 6, 27, 11.21, -25, 51, 24.1, 6.07 },
-    { 2, 24, 20.11, -25, 50, 51.0, 6.44 },
-    { 14, 19, .79, -25, 48, 56.2, 5.87 },
-    { 15, 5, 47.69, -25, 47, 22.9, 6.67 },
-    { 20, 49, 17.59, -25, 46, 53.0, 5.86 },
-    { 6, 50, 36.89, -25, 46, 41.2, 6.33 },
-    { 15, 50, 58.70, -25, 45, 5.0, 4.64 },
-    { 4, 21, 31.30, -25, 43, 41.9, 6.01 },
-    { 4, 55, 30.19, -25, 43, 40.1, 6.72 },
-    { 11, 54, 42.50, -25, 42, 50.0, 5.30 },
-    { 23, 0, 24.60, -25, 37, 36.1, 6.29 },
-    { 14, 47, 22.51, -25, 37, 27.8, 5.63 },
-    { 3, 31, 53.90, -25, 36, 51.1, 6.38 },
-    { 18, 18, 41.69, -25, 36, 16.9, 6.51 },
-    { 16, 21, 11.30, -25, 35, 34.1, 2.89 },
-    { 3, 22, 16.30, -25, 35, 16.1, 6.35 },
-    { 6, 23, 55.90, -25, 34, 40.1, 5.63 },
-    { 0, 27, 14.71, -25, 32, 49.9, 5.98 },
-    { 16, 46, 51.29, -25, 31, 43.0, 6.71 },
-    { 9, 3, 8.81, -25, 30, 15.8, 6.74 },
-    { 7, 43, 39.10, -25, 30, 14.0, 6.55 },
-    { 13, 44, 45.70, -25, 30, 2.9, 6.21 },
-    { 16, 14, 53.59, -25, 28, 36.8, 6.05 },
-    { 18, 8, 54.10, -25, 28, 21.0, 6.61 },
-    { 14, 46, .10, -25, 26, 35.2, 4.94 },
-    { 18, 27, 58.20, -25, 25, 18.1, 2.81 },
-    { 6, 1, 13.10, -25, 25, 4.1, 6.05 },
-    { 6, 58, 35.90, -25, 24, 50.0, 5.59 },
-    { 8, 45, 49.30, -25, 23, 15.0, 6.10 },
-    { 7, 38, 18.00, -25, 21, 52.9, 4.70 },
-    { 23, 49, 49.61, -25, 19, 53.0, 6.42 },
-    { 15, 53, 36.70, -25, 19, 37.9, 4.59 },
-    { 10, 3, 41.40, -25, 19, .1, 6.70 },
-    { 15, 13, 28.70, -25, 18, 33.1, 6.45 },
-    { 9, 37, .19, -25, 17, 48.1, 5.70 },
-    { 15, 4, 4.20, -25, 16, 54.8, 3.29 },
-    { 2, 59, 36.10, -25, 16, 27.1, 5.71 },
-    { 20, 46, 5.69, -25, 16, 14.9, 4.14 },
-    { 19, 15, 32.40, -25, 15, 24.1, 4.85 },
-    { 18, 29, 22.01, -25, 15, 23.0, 6.59 },
-    { 17, 12, 13.61, -25, 15, 16.9, 6.54 },
-    { 15, 54, 39.50, -25, 14, 37.0, 5.87 },
-    { 7, 9, 42.89, -25, 13, 52.0, 5.69 },
-    { 7, 25, 25.30, -25, 13, 4.1, 5.78 },
-    { 7, 1, 5.90, -25, 12, 55.1, 5.63 },
-    { 2, 30, 13.80, -25, 11, 11.0, 6.51 },
-    { 18, 19, 58.00, -25, 11, 3.0, },
-    { 22, 13, 44.40, -25, 10, 50.9, 5.58 },
-    { 23, 0, 5.81, -25, 9, 51.1, 5.65 },
-    { 16, 30, 12.41, -25, 6, 54.0, 4.79 },
-    { 20, 37, 52.10, -25, 6, 32.0, 6.36 },
-    { 21, 41, 46.10, -25, 6, 6.8, 6.49 },
-    { 16, 59, 57.60, -25, 5, 30.8, 5.86 },
-    { 1, 45, 38.81, -25, 3, 9.0, 5.31 },
-    { 1, 38, 49.99, -25, 1, 18.8, 6.70 },
-    { 18, 44, 49.61, -25, 0, 40.0, 5.83 },
-    { 14, 0, .10, -25, 0, 37.1, 5.77 },
-    { 21, 7, 7.70, -25, 0, 20.9, 4.50 },
-    { 17, 22, .60, -24, 59, 57.8, 3.27 },
-    { 14, 43, 13.61, -24, 59, 51.0, 5.73 },
-    { 17, 0, 9.50, -24, 59, 21.1, 5.75 },
-    { 13, 58, 31.10, -24, 58, 19.9, 5.15 },
-    { 7, 6, 52.30, -24, 57, 38.2, 6.08 },
-    { 7, 18, 42.41, -24, 57, 15.1, 4.40 },
-    { 20, 32, 52.39, -24, 56, 38.0, 6.36 },
-    { 19, 0, 24.79, -24, 56, 31.9, 6.36 },
-    { 18, 21, 31.39, -24, 54, 54.0, 6.25 },
-    { 7, 49, 1.70, -24, 54, 43.9, 5.33 },
-    { 4, 23, 5.71, -24, 53, 31.9, 5.83 },
-    { 17, 54, 54.00, -24, 53, 13.9, 6.20 },
-    { 19, 36, 42.41, -24, 53, 1.0, 4.60 },
-    { 18, 58, 20.50, -24, 52, 36.1, 6.62 },
-    { 7, 49, 17.71, -24, 51, 34.9, 3.34 },
-    { 12, 47, 53.71, -24, 51, 6.1, 6.44 },
-    { 19, 2, 27.70, -24, 50, 48.8, 5.65 },
-    { 12, 23, 21.60, -24, 50, 26.2, 5.68 },
-    { 15, 58, 34.80, -24, 49, 53.0, 5.43 },
-    { 14, 24, 48.60, -24, 48, 23.0, 5.32 },
-    { 0, 53, 12.41, -24, 46, 36.8, 6.46 },
-    { 5, 21, 46.20, -24, 46, 23.2, 5.06 },
-    { 0, 37, 20.71, -24, 46, 1.9, 5.57 },
-    { 22, 23, 30.91, -24, 45, 45.0, 5.53 },
-    { 23, 56, 29.90, -24, 44, 13.9, 6.31 },
-    { 12, 8, 24.79, -24, 43, 44.0, 4.02 },
-    { 16, 3, 54.70, -24, 43, 35.0, 6.21 },
-    { 11, 39, .41, -24, 43, 16.0, 6.42 },
-    { 19, 36, 1.70, -24, 43, 9.1, 5.65 },
-    { 7, 33, 9.70, -24, 42, 38.9, 5.85 },
-    { 9, 36, 33.70, -24, 42, 10.1, 6.53 },
-    { 7, 44, 34.01, -24, 40, 26.0, 5.62 },
-    { 19, 8, 14.59, -24, 39, 24.8, 6.30 },
-    { 14, 54, 20.11, -24, 38, 31.9, 5.30 },
-    { 6, 57, 33.91, -24, 37, 50.2, 5.46 },
-    { 3, 53, 42.60, -24, 36, 45.0, 4.65 },
-    { 8, 33, 4.80, -24, 36, 23.0, 6.19 },
-    { 21, 32, 33.31, -24, 35, 26.2, 6.43 },
-    { 2, 49, 51.00, -24, 33, 37.1, 6.14 },
-    { 7, 18, 40.30, -24, 33, 32.0, 4.98 },
-    { 6, 53, 55.30, -24, 32, 21.1, 6.21 },
-    { 15, 53, 53.81, -24, 31, 59.2, 5.39 },
-    { 7, 51, .00, -24, 31, 41.9, 6.45 },
-    { 19, 25, 16.51, -24, 30, 31.0, 5.03 },
-    { 15, 33, 9.10, -24, 29, 21.8, 7.00 },
-    { 4, 40, 6.79, -24, 28, 57.0, 5.58 },
-    { 16, 41, 36.19, -24, 28, 5.2, 6.09 },
-    { 11, 29, 38.59, -24, 27, 47.9, 5.76 },
-    { 16, 7, 51.89, -24, 27, 42.8, 6.33 },
-    { 16, 13, 45.70, -24, 25, 18.8, 6.41 },
-    { 13, 51, 20.40, -24, 23, 26.9, 6.45 },
-    { 5, 3, 53.30, -24, 23, 16.1, 5.61 },
-    { 14, 12, 24.50, -24, 21, 51.1, 6.34 },
-    { 18, 3, 52.39, -24, 21, 38.2, 5.97 },
-    { 2, 9, 34.80, -24, 20, 44.9, 6.48 },
-    { 8, 7, 32.59, -24, 18, 15.1, 2.81 },
-    { 17, 18, .70, -24, 17, 12.8, 5.20 },
-    { 10, 4, 21.00, -24, 17, 8.2, 5.70 },
-    { 17, 18, .50, -24, 17, 3.1, 6.80 },
-    { 18, 2, 51.10, -24, 16, 55.9, 5.34 },
-    { 14, 49, 18.70, -24, 15, 6.1, 5.68 },
-    { 17, 25, 6.19, -24, 14, 37.0, 6.19 },
-    { 23, 53, 20.81, -24, 13, 45.1, 6.24 },
-    { 18, 34, 32.81, -24, 13, 21.0, 6.51 },
-    { 6, 5, 45.70, -24, 11, 44.2, 6.95 },
-    { 6, 54, 7.90, -24, 11, 2.0, 3.87 },
-    { 19, 15, 33.19, -24, 10, 45.1, 6.25 },
-    { 17, 26, 22.20, -24, 10, 31.1, 4.17 },
-    { 16, 20, 38.21, -24, 10, 9.8, 4.55 },
-    { 23, 41, 7.01, -24, 9, 37.1, 6.60 },
-    { 0, 3, 7.70, -24, 8, 43.1, 6.44 },
-    { 0, 49, 13.90, -24, 8, 11.0, 5.90 },
-    { 3, 19, 34.80, -24, 7, 23.2, 5.61 },
-    { 4, 26, 57.00, -24, 4, 53.0, 6.11 },
-    { 6, 49, 43.99, -24, 4, 32.9, 6.33 },
-    { 8, 25, 3.70, -24, 2, 46.0, 5.28 },
-    { 7, 8, 49.30, -24, 2, 39.1, 6.65 },
-    { 18, 33, 53.50, -24, 1, 57.0, 5.49 },
-    { 3, 59, 55.51, -24, 0, 59.0, 4.66 },
-    { 15, 13, 17.50, -24, 0, 29.9, 6.47 },
-    { 0, 52, 40.61, -24, 0, 20.9, 5.46 },
-    { 1, 7, 13.10, -23, 59, 47.0, 6.37 },
-    { 1, 6, 7.70, -23, 59, 33.0, 6.14 },
-    { 22, 35, 36.50, -23, 59, 28.0, 5.97 },
-    { 15, 53, 55.80, -23, 58, 41.2, 5.42 },
-    { 17, 31, 25.01, -23, 57, 46.1, 4.81 },
-    { 19, 25, 29.69, -23, 57, 43.9, 5.43 },
-    { 9, 59, 6.10, -23, 57, 1.1, 6.21 },
-    { 19, 54, 17.71, -23, 56, 28.0, 6.18 },
-    { 6, 54, 13.01, -23, 55, 41.9, 6.91 },
-    { 9, 42, 14.40, -23, 54, 56.2, 4.94 },
-    { 3, 47, 39.60, -23, 52, 28.9, 5.24 },
-    { 6, 13, 45.10, -23, 51, 42.8, 6.39 },
-    { 2, 57, 23.71, -23, 51, 42.8, 5.45 },
-    { 7, 7, 22.61, -23, 50, 25.1, 5.71 },
-    { 18, 41, 51.60, -23, 49, 59.9, 6.23 },
-    { 7, 3, 1.49, -23, 49, 59.9, 3.02 },
-    { 8, 55, 55.90, -23, 49, 5.9, 6.39 },
-    { 15, 40, 16.90, -23, 49, 5.2, 4.96 },
-    { 2, 22, 32.59, -23, 48, 59.0, 5.20 },
-    { 17, 59, 47.59, -23, 48, 58.0, 4.76 },
-    { 0, 40, 32.90, -23, 48, 15.8, 6.14 },
-    { 0, 30, 22.70, -23, 47, 16.1, 5.19 },
-    { 20, 53, 1.20, -23, 46, 59.2, 6.33 },
-    { 7, 37, 16.80, -23, 46, 30.0, 6.37 },
-    { 20, 40, 11.69, -23, 46, 26.0, 6.37 },
-    { 10, 34, .91, -23, 44, 43.1, 5.08 },
-    { 23, 6, 40.90, -23, 44, 35.2, 4.47 },
-    { 7, 15, 47.50, -23, 44, 26.2, 6.32 },
-    { 3, 10, 35.40, -23, 44, 17.9, 6.38 },
-    { 7, 26, 40.70, -23, 42, 43.9, 6.56 },
-    { 10, 21, 28.70, -23, 42, 38.9, 6.50 },
-    { 18, 11, 43.39, -23, 42, 4.0, 4.98 },
-    { 12, 30, 17.50, -23, 41, 48.1, 5.63 },
-    { 6, 39, 36.31, -23, 41, 44.2, 6.05 },
-    { 16, 8, 43.70, -23, 41, 8.2, 5.88 },
-    { 22, 26, 10.70, -23, 40, 57.0, 6.29 },
-    { 3, 21, 24.00, -23, 38, 7.1, 5.52 },
-    { 3, 2, 23.50, -23, 37, 27.8, 4.09 },
-    { 16, 6, 6.29, -23, 36, 23.0, 5.92 },
-    { 2, 58, 5.71, -23, 36, 22.0, 5.84 },
-    { 12, 11, 3.91, -23, 36, 9.0, 5.46 },
-    { 9, 41, 16.99, -23, 35, 30.1, 4.77 },
-    { 18, 38, 30.70, -23, 30, 18.0, 5.81 },
-    { 7, 34, 19.10, -23, 28, 28.9, 5.87 },
-    { 7, 34, 18.60, -23, 28, 25.0, 5.83 },
-    { 6, 45, 23.30, -23, 27, 42.8, 6.05 },
-    { 21, 35, 15.91, -23, 27, 15.1, 6.40 },
-    { 13, 41, 30.91, -23, 26, 58.9, 6.59 },
-    { 16, 25, 35.21, -23, 26, 49.9, 5.02 },
-    { 16, 25, 35.11, -23, 26, 46.0, 5.92 },
-    { 19, 40, 7.10, -23, 25, 43.0, 5.97 },
-    { 19, 39, 49.39, -23, 25, 40.1, 6.34 },
-    { 6, 31, 51.31, -23, 25, 5.9, 4.33 },
-    { 12, 34, 23.21, -23, 23, 48.1, 2.65 },
-    { 0, 49, 33.41, -23, 21, 42.1, 6.28 },
-    { 12, 15, 46.99, -23, 21, 13.0, 6.54 },
-    { 9, 29, 49.90, -23, 20, 43.1, 6.24 },
-    { 7, 16, 36.79, -23, 18, 56.2, 4.79 },
-    { 7, 59, 5.71, -23, 18, 38.2, 5.11 },
-    { 13, 29, 42.79, -23, 16, 53.0, 4.97 },
-    { 21, 42, .79, -23, 15, 46.1, 5.24 },
-    { 3, 46, 50.90, -23, 14, 58.9, 4.23 },
-    { 5, 56, 34.51, -23, 12, 56.2, 6.36 },
-    { 9, 10, 22.99, -23, 10, 36.1, 6.53 },
-    { 10, 34, 57.70, -23, 10, 34.0, 6.10 },
-    { 18, 56, .60, -23, 10, 25.0, 5.93 },
-    { 13, 18, 55.30, -23, 10, 18.1, 3.00 },
-    { 8, 24, 55.10, -23, 9, 13.0, 5.68 },
-    { 14, 46, 6.79, -23, 9, 11.2, 5.81 },
-    { 15, 39, 21.29, -23, 9, 1.1, 6.34 },
-    { 16, 56, 48.00, -23, 9, .0, 5.58 },
-    { 15, 37, 48.10, -23, 8, 30.1, 5.78 },
-    { 22, 16, 59.81, -23, 8, 24.0, 6.17 },
-    { 13, 9, 3.29, -23, 7, 5.2, 4.95 },
-    { 6, 6, 31.99, -23, 6, 38.2, 5.47 },
-    { 0, 6, 50.11, -23, 6, 27.0, 6.18 },
-    { 7, 26, 59.40, -23, 5, 10.0, 5.61 },
-    { 8, 28, 35.90, -23, 4, 18.1, 6.51 },
-    { 7, 29, 51.41, -23, 1, 27.8, 4.85 },
-    { 13, 57, 27.70, -23, 1, 22.1, 6.14 },
-    { 5, 49, 53.50, -22, 58, 18.1, 5.87 },
-    { 4, 18, 37.39, -22, 58, 13.1, 6.07 },
-    { 6, 35, 3.41, -22, 57, 52.9, 4.54 },
-    { 6, 55, 46.80, -22, 56, 29.0, 5.30 },
-    { 5, 51, 28.61, -22, 55, 34.0, 6.17 },
-    { 8, 20, 27.41, -22, 55, 28.9, 6.13 },
-    { 7, 24, 17.21, -22, 54, 46.1, 6.19 },
-    { 7, 13, 48.29, -22, 54, 23.0, 6.36 },
-    { 7, 56, 51.50, -22, 52, 48.0, 4.20 },
-    { 9, 33, 26.21, -22, 51, 50.0, 5.91 },
-    { 7, 27, 42.89, -22, 51, 34.9, 5.95 },
-    { 7, 20, 53.21, -22, 51, 6.1, 6.61 },
-    { 0, 36, 6.91, -22, 50, 33.0, 6.06 },
-    { 5, 56, 14.30, -22, 50, 25.1, 5.96 },
-    { 11, 11, 39.50, -22, 49, 32.9, 4.48 },
-    { 5, 2, 44.90, -22, 47, 42.0, 5.75 },
-    { 23, 1, 22.99, -22, 47, 26.9, 6.28 },
-    { 18, 1, 54.41, -22, 46, 50.2, 5.77 },
-    { 6, 9, 47.90, -22, 46, 27.1, 5.71 },
-    { 12, 57, 33.19, -22, 45, 14.0, 6.31 },
-    { 21, 24, 7.90, -22, 44, 48.8, 6.38 },
-    { 18, 54, 10.20, -22, 44, 42.0, 4.83 },
-    { 20, 1, 23.90, -22, 44, 13.9, 6.01 },
-    { 18, 3, 1.70, -22, 43, 5.9, 6.74 },
-    { 6, 17, 3.50, -22, 42, 54.0, 6.07 },
-    { 19, 1, 37.80, -22, 41, 44.2, 6.24 },
-    { 2, 29, 55.39, -22, 40, 58.1, 6.77 },
-    { 7, 13, 23.90, -22, 40, 23.9, 6.01 },
-    { 18, 55, 7.10, -22, 40, 17.0, 4.99 },
-    { 21, 23, .50, -22, 40, 8.0, 5.60 },
-    { 8, 39, 7.99, -22, 39, 42.8, 5.05 },
-    { 16, 0, 19.99, -22, 37, 18.1, 2.32 },
-    { 12, 10, 7.49, -22, 37, 10.9, 3.00 },
-    { 6, 36, 40.90, -22, 36, 54.0, 6.35 },
-    { 20, 3, 44.30, -22, 35, 44.2, 6.45 },
-    { 2, 30, 32.81, -22, 32, 44.2, 6.10 },
-    { 18, 58, 24.60, -22, 31, 45.8, 6.14 },
-    { 10, 21, 36.00, -22, 31, 41.9, 6.51 },
-    { 1, 56, 40.20, -22, 31, 36.8, 4.85 },
-    { 0, 46, 11.81, -22, 31, 18.8, 5.50 },
-    { 7, 47, 12.50, -22, 31, 10.9, 5.90 },
-    { 3, 18, 22.10, -22, 30, 41.0, 4.88 },
-    { 0, 7, 46.80, -22, 30, 32.0, 5.94 },
-    { 9, 54, 31.70, -22, 29, 17.9, 6.24 },
-    { 2, 47, 11.21, -22, 29, 8.2, 6.47 },
-    { 17, 47, 45.60, -22, 28, 41.2, 6.18 },
-    { 23, 9, 54.79, -22, 27, 27.0, 4.69 },
-    { 6, 42, 45.79, -22, 26, 57.1, 6.13 },
-    { 5, 44, 27.79, -22, 26, 53.9, 3.60 },
-    { 6, 8, 57.89, -22, 25, 39.0, 5.50 },
-    { 14, 3, 53.11, -22, 25, 18.1, 6.30 },
-    { 5, 44, 26.50, -22, 25, 18.1, 6.15 },
-    { 21, 26, 40.01, -22, 24, 41.0, 3.74 },
-    { 19, 20, 38.11, -22, 24, 9.0, 5.58 },
-    { 15, 16, 22.99, -22, 23, 57.8, 5.50 },
-    { 18, 46, 20.59, -22, 23, 31.9, 5.37 },
-    { 20, 29, 31.30, -22, 23, 30.1, 6.16 },
-    { 2, 53, 35.30, -22, 22, 35.0, 5.95 },
-    { 5, 42, 13.90, -22, 22, 25.0, 5.87 },
-    { 5, 5, 27.70, -22, 22, 16.0, 3.19 },
-    { 9, 27, 18.41, -22, 20, 38.0, 4.69 },
-    { 7, 41, 23.59, -22, 20, 13.9, 6.18 },
-    { 7, 34, 3.19, -22, 17, 46.0, 4.45 },
-    { 12, 20, 33.70, -22, 12, 56.9, 5.21 },
-    { 6, 57, 14.81, -22, 12, 11.9, 6.61 },
-    { 12, 20, 10.70, -22, 10, 32.2, 5.97 },
-    { 18, 50, 50.50, -22, 9, 43.9, 6.61 },
-    { 7, 36, 7.80, -22, 9, 38.2, 6.34 },
-    { 7, 0, 19.30, -22, 7, 9.8, 6.53 },
-    { 17, 35, 18.50, -22, 2, 38.0, 6.57 },
-    { 7, 4, 47.11, -22, 1, 55.9, 6.09 },
-    { 15, 6, 27.10, -22, 1, 54.8, 6.17 },
-    { 0, 44, 44.40, -22, 0, 22.0, 5.24 },
-    { 7, 25, 19.90, -21, 58, 58.1, 6.05 },
-    { 12, 0, 42.50, -21, 50, 13.9, 6.28 },
-    { 6, 6, 57.60, -21, 48, 46.1, 5.78 },
-    { 20, 18, 1.39, -21, 48, 36.0, 5.87 },
-    { 21, 28, 43.39, -21, 48, 25.9, 4.51 },
-    { 19, 26, 19.20, -21, 46, 36.1, 5.59 },
-    { 3, 19, 31.01, -21, 45, 28.1, 3.69 },
-    { 11, 12, 34.61, -21, 44, 57.1, 6.40 },
-    { 19, 4, 40.99, -21, 44, 30.1, 3.77 },
-    { 0, 48, 1.10, -21, 43, 21.0, 5.57 },
-    { 18, 14, 15.91, -21, 42, 47.2, 5.44 },
-    { 17, 43, 25.80, -21, 40, 59.9, 4.87 },
-    { 19, 12, 28.01, -21, 39, 29.2, 6.41 },
-    { 2, 46, 45.19, -21, 38, 22.9, 6.49 },
-    { 3, 33, 47.30, -21, 37, 58.1, 4.27 },
-    { 1, 29, 36.10, -21, 37, 45.8, 5.12 },
-    { 6, 59, 39.29, -21, 36, 11.9, 6.26 },
-    { 22, 21, 35.59, -21, 35, 53.9, 5.13 },
-    { 17, 6, 11.81, -21, 33, 52.9, 6.30 },
-    { 20, 46, 10.01, -21, 30, 51.1, 5.93 },
-    { 17, 30, 41.70, -21, 29, 14.0, },
-    { 16, 32, 8.21, -21, 27, 59.0, 4.45 },
-    { 18, 7, 11.40, -21, 26, 38.0, 6.28 },
-    { 17, 24, 42.00, -21, 26, 30.1, 5.85 },
-    { 14, 57, 28.01, -21, 24, 56.2, 5.74 },
-    { 18, 37, 54.41, -21, 23, 52.1, 5.94 },
-    { 5, 27, 36.50, -21, 22, 32.2, 6.07 },
-    { 23, 31, 42.10, -21, 22, 9.8, 6.29 },
-    { 18, 54, .10, -21, 21, 34.9, 5.69 },
-    { 14, 47, 13.70, -21, 19, 28.9, 6.06 },
-    { 8, 16, 54.19, -21, 19, 13.1, 6.60 },
-    { 19, 30, 54.00, -21, 18, 43.9, 6.13 },
-    { 16, 16, 58.80, -21, 18, 14.0, 6.61 },
-    { 4, 45, 4.20, -21, 17, 1.0, 5.72 },
-    { 1, 38, 51.79, -21, 16, 31.1, 5.58 },
-    { 5, 20, 26.90, -21, 14, 21.8, 4.71 },
-    { 22, 11, 2.40, -21, 13, 57.0, 6.09 },
-    { 21, 27, 14.81, -21, 11, 46.0, 5.78 },
-    { 21, 8, 33.60, -21, 11, 37.0, 5.30 },
-    { 21, 58, 43.80, -21, 10, 58.1, 6.12 },
-    { 14, 46, 10.90, -21, 10, 34.0, 6.40 },
-    { 7, 51, 42.89, -21, 10, 26.0, 5.63 },
-    { 23, 9, 26.81, -21, 10, 21.0, 3.66 },
-    { 8, 44, 55.20, -21, 10, 4.1, 6.11 },
-    { 9, 33, 12.50, -21, 6, 56.9, 5.01 },
-    { 17, 21, .19, -21, 6, 46.1, 4.39 },
-    { 16, 14, 28.80, -21, 6, 27.0, 6.41 },
-    { 18, 57, 43.80, -21, 6, 24.1, 3.51 },
-    { 2, 0, .29, -21, 4, 40.1, 4.00 },
-    { 22, 14, 18.00, -21, 4, 27.1, 5.32 },
-    { 18, 13, 45.79, -21, 3, 32.0, 3.86 },
-    { 18, 38, 53.40, -21, 3, 6.8, 5.86 },
-    { 8, 49, 44.90, -21, 2, 55.0, 6.47 },
-    { 8, 25, 19.10, -21, 2, 44.9, 6.01 },
-    { 19, 9, 45.79, -21, 1, 25.0, 2.89 },
-    { 15, 38, 16.30, -21, 0, 58.0, 5.84 },
-    { 6, 47, 1.49, -21, 0, 56.2, 6.08 },
-    { 2, 51, 2.30, -21, 0, 15.1, 4.75 },
-    { 18, 45, 18.70, -21, 0, 5.0, 6.36 },
-    { 2, 13, .89, -21, 0, 1.1, 5.86 },
-    { 15, 57, 40.39, -20, 58, 59.2, 5.85 },
-    { 8, 28, 53.30, -20, 57, 1.1, 6.67 },
-    { 6, 18, 58.99, -20, 55, 34.0, 5.81 },
-    { 6, 33, 26.59, -20, 55, 26.0, 6.40 },
-    { 23, 33, 16.61, -20, 54, 51.8, 4.71 },
-    { 3, 48, 35.81, -20, 54, 11.2, 5.81 },
-    { 7, 11, 41.59, -20, 52, 59.2, 5.84 },
-    { 5, 51, 19.30, -20, 52, 45.1, 3.81 },
-    { 23, 2, 44.30, -20, 52, 14.2, 5.97 },
-    { 16, 7, 24.31, -20, 52, 7.0, 4.32 },
-    { 5, 31, 7.61, -20, 51, 49.0, 5.55 },
-    { 21, 24, 9.60, -20, 51, 6.8, 5.41 },
-    { 12, 14, 59.59, -20, 50, 39.1, 5.83 },
-    { 8, 27, 33.29, -20, 50, 38.0, 6.56 },
-    { 18, 35, 21.29, -20, 50, 26.9, 6.48 },
-    { 1, 59, 46.10, -20, 49, 27.8, 5.41 },
-    { 11, 31, 47.59, -20, 46, 36.1, 6.24 },
-    { 5, 28, 14.69, -20, 45, 33.8, 2.84 },
-    { 9, 29, 12.60, -20, 44, 55.0, 5.66 },
-    { 15, 30, 36.29, -20, 43, 41.9, 6.22 },
-    { 18, 15, 12.89, -20, 43, 41.9, 5.38 },
-    { 4, 18, 15.91, -20, 42, 56.2, 6.00 },
-    { 22, 34, 41.59, -20, 42, 29.9, 5.20 },
-    { 10, 16, 45.60, -20, 40, 14.2, 6.57 },
-    { 16, 6, 48.41, -20, 40, 9.1, 3.96 },
-    { 10, 55, 11.59, -20, 39, 54.0, 6.44 },
-    { 18, 57, 20.50, -20, 39, 23.0, 5.08 },
-    { 21, 15, 37.90, -20, 39, 6.1, 5.24 },
-    { 23, 26, 2.81, -20, 38, 30.8, 4.39 },
-    { 4, 20, 39.00, -20, 38, 22.9, 5.38 },
-    { 13, 3, 46.10, -20, 34, 59.2, 5.58 },
-    { 21, 9, 33.00, -20, 33, 23.0, 6.25 },
-    { 8, 7, 18.00, -20, 33, 16.9, 5.38 },
-    { 18, 25, 21.00, -20, 32, 30.1, 4.81 },
-    { 12, 35, 58.61, -20, 31, 37.9, 6.20 },
-    { 4, 5, 46.70, -20, 30, 43.9, 6.34 },
-    { 17, 4, 45.31, -20, 29, 40.9, 6.30 },
-    { 14, 34, 50.69, -20, 26, 21.1, 6.50 },
-    { 16, 53, 25.20, -20, 24, 56.2, 5.88 },
-    { 16, 40, 34.51, -20, 24, 31.0, 6.26 },
-    { 6, 55, 2.71, -20, 24, 16.9, 5.74 },
-    { 18, 15, 12.89, -20, 23, 17.2, 5.95 },
-    { 4, 4, 40.99, -20, 22, 54.1, 6.13 },
-    { 8, 8, 43.51, -20, 21, 47.2, 6.36 },
-    { 4, 11, 36.19, -20, 21, 22.0, 5.79 },
-    { 18, 0, .10, -20, 20, 21.1, 6.21 },
-    { 0, 28, 21.10, -20, 20, 6.0, 6.43 },
-    { 18, 49, 40.10, -20, 19, 28.9, 5.24 },
-    { 11, 42, 3.50, -20, 17, 38.0, 6.22 },
-    { 6, 15, 8.40, -20, 16, 19.9, 5.91 },
-    { 6, 53, 32.90, -20, 13, 27.1, 4.83 },
-    { 16, 19, 7.70, -20, 13, 4.1, 6.29 },
-    { 0, 16, 42.50, -20, 12, 38.2, 6.47 },
-    { 7, 49, 45.19, -20, 12, 24.8, 6.56 },
-    { 15, 53, 20.11, -20, 10, 1.9, 5.03 },
-    { 15, 31, 43.39, -20, 9, 52.9, 6.22 },
-    { 7, 0, 8.11, -20, 9, 32.0, 6.31 },
-    { 4, 3, 36.79, -20, 9, 29.9, 7.01 },
-    { 4, 3, 24.70, -20, 8, 39.1, 6.46 },
-    { 10, 53, 29.50, -20, 8, 20.0, 5.24 },
-    { 6, 55, 37.39, -20, 8, 11.0, 4.68 },
-    { 5, 44, 28.39, -20, 7, 35.0, 6.34 },
-    { 23, 22, 58.20, -20, 6, 2.2, 3.97 },
-    { 21, 34, 51.00, -20, 5, 3.8, 5.69 },
-    { 8, 21, 21.19, -20, 4, 45.1, 5.58 },
-    { 0, 21, 46.30, -20, 3, 28.1, 5.12 },
-    { 5, 1, 25.61, -20, 3, 6.8, 4.91 },
-    { 0, 2, 57.60, -20, 2, 46.0, 6.25 },
-    { 2, 26, 35.21, -20, 2, 34.1, 5.88 },
-    { 16, 24, 6.19, -20, 2, 15.0, 4.50 },
-    { 2, 33, 40.20, -20, 0, 6.8, 6.21 },
-    { 14, 25, 29.81, -19, 58, 10.9, 6.61 },
-    { 6, 18, 13.70, -19, 58, .8, 5.52 },
-    { 13, 15, 58.80, -19, 56, 35.2, 5.22 },
-    { 13, 14, 10.90, -19, 55, 50.9, 5.33 },
-    { 16, 41, 53.71, -19, 55, 27.8, 5.57 },
-    { 4, 35, .50, -19, 55, 14.2, 6.13 },
-    { 13, 50, 34.51, -19, 53, 49.9, 6.53 },
-    { 10, 22, 12.91, -19, 52, .8, 6.13 },
-    { 21, 4, 24.31, -19, 51, 18.0, 4.84 },
-    { 18, 11, 14.81, -19, 50, 31.9, 6.36 },
-    { 16, 5, 26.21, -19, 48, 20.2, 2.62 },
-    { 19, 9, 48.10, -19, 48, 13.0, 6.13 },
-    { 16, 5, 26.50, -19, 48, 6.8, 4.92 },
-    { 12, 33, 22.39, -19, 47, 30.8, 6.26 },
-    { 15, 12, 13.30, -19, 47, 30.1, 4.54 },
-    { 6, 23, 47.59, -19, 47, 7.1, 6.60 },
-    { 19, 46, 21.70, -19, 45, 40.0, 4.86 },
-    { 12, 41, 49.20, -19, 45, 31.0, 6.03 },
-    { 9, 11, 58.70, -19, 44, 52.1, 5.73 },
-    { 8, 38, 40.30, -19, 44, 12.8, 6.33 },
-    { 8, 4, 41.50, -19, 43, 41.2, 6.13 },
-    { 7, 36, 40.99, -19, 42, 7.9, 5.74 },
-    { 5, 25, 59.81, -19, 41, 44.2, 5.89 },
-    { 15, 41, 56.81, -19, 40, 44.0, 4.74 },
-    { 4, 40, 26.50, -19, 40, 18.1, 4.32 },
-    { 15, 32, 36.70, -19, 40, 14.2, 5.52 },
-    { 7, 40, 13.61, -19, 39, 38.9, 5.93 },
-    { 12, 0, 51.19, -19, 39, 32.0, 5.26 },
-    { 15, 13, 19.20, -19, 38, 51.0, 6.08 },
-    { 5, 53, 57.41, -19, 38, 17.9, 6.69 },
-    { 21, 43, 13.49, -19, 37, 14.9, 6.22 },
-    { 22, 47, 33.10, -19, 36, 47.9, 5.26 },
-    { 18, 46, 1.20, -19, 36, 23.0, 6.42 },
-    { 3, 41, 22.39, -19, 35, 4.9, 6.59 },
-    { 9, 35, 33.70, -19, 35, 1.0, 6.31 },
-    { 8, 31, 30.91, -19, 34, 39.0, 5.42 },
-    { 16, 57, 4.01, -19, 32, 24.0, 6.27 },
-    { 7, 50, 5.71, -19, 31, 25.0, 6.12 },
-    { 13, 21, 29.90, -19, 29, 20.0, 6.21 },
-    { 21, 37, 4.80, -19, 27, 58.0, 4.68 },
-    { 16, 11, 59.69, -19, 27, 38.2, 4.01 },
-    { 4, 28, 39.00, -19, 27, 29.9, 5.96 },
-    { 16, 11, 58.61, -19, 26, 58.9, 6.30 },
-    { 7, 33, 19.51, -19, 24, 45.0, 5.66 },
-    { 9, 32, 20.40, -19, 24, 1.1, 5.74 },
-    { 15, 55, .31, -19, 22, 59.2, 5.94 },
-    { 17, 20, 34.20, -19, 19, 58.1, 6.52 },
-    { 15, 38, 54.50, -19, 18, 6.8, 5.38 },
-    { 19, 8, 16.70, -19, 17, 24.0, 5.54 },
-    { 18, 42, 55.20, -19, 17, 2.0, 6.35 },
-    { 7, 19, 1.99, -19, 16, 49.1, 6.09 },
-    { 6, 36, 40.99, -19, 15, 20.9, 3.95 },
-    { 19, 3, 3.79, -19, 14, 43.1, 6.05 },
-    { 8, 9, 1.61, -19, 14, 42.0, 4.40 },
-    { 19, 21, 37.10, -19, 14, 3.1, 6.26 },
-    { 8, 59, 39.89, -19, 12, 29.2, 6.18 },
-    { 6, 7, 41.59, -19, 9, 56.9, 5.31 },
-    { 10, 12, 37.80, -19, 9, 13.0, 6.44 },
-    { 21, 29, 59.59, -19, 8, 52.1, 6.57 },
-    { 18, 49, 35.50, -19, 8, 31.9, 6.75 },
-    { 18, 31, 53.30, -19, 7, 30.0, 6.68 },
-    { 20, 19, 23.59, -19, 7, 7.0, 5.28 },
-    { 19, 3, 7.01, -19, 6, 11.9, 6.37 },
-    { 1, 22, 30.50, -19, 4, 53.0, 6.35 },
-    { 0, 17, 32.59, -19, 3, 4.0, 6.45 },
-    { 19, 52, 12.00, -19, 2, 42.0, 5.92 },
-    { 20, 59, 36.10, -19, 2, 7.1, 6.25 },
-    { 6, 53, 18.79, -19, 1, 58.1, 5.64 },
-    { 7, 22, 13.51, -19, 1, .1, 4.96 },
-    { 7, 24, 50.71, -19, 0, 43.9, 6.24 },
-    { 9, 54, 52.20, -19, 0, 33.8, 4.94 },
-    { 19, 17, 38.11, -18, 57, 11.2, 4.96 },
-    { 6, 53, 21.70, -18, 55, 59.9, 6.14 },
-    { 0, 14, 38.40, -18, 55, 58.1, 4.44 },
-    { 23, 51, 21.29, -18, 54, 32.0, 5.18 },
-    { 17, 1, 51.19, -18, 53, 8.2, 6.26 },
-    { 21, 42, 39.50, -18, 51, 59.0, 4.73 },
-    { 18, 21, 23.11, -18, 51, 36.0, 5.75 },
-    { 19, 36, 26.11, -18, 51, 10.1, 6.11 },
-    { 22, 43, 35.30, -18, 49, 49.1, 4.69 },
-    { 13, 13, 26.81, -18, 49, 36.1, 6.28 },
-    { 17, 55, 55.01, -18, 48, 7.9, 6.52 },
-    { 11, 23, 21.89, -18, 46, 48.0, 5.09 },
-    { 19, 7, 8.50, -18, 44, 16.1, 6.29 },
-    { 18, 30, 11.90, -18, 43, 44.0, 5.66 },
-    { 13, 32, 2.81, -18, 43, 44.0, 6.01 },
-    { 14, 18, 38.30, -18, 42, 58.0, 5.90 },
-    { 23, 24, 7.80, -18, 41, 15.0, 6.19 },
-    { 7, 10, 9.29, -18, 41, 7.1, 6.23 },
-    { 7, 39, 7.10, -18, 40, 45.1, 6.72 },
-    { 23, 46, .91, -18, 40, 41.2, 5.29 },
-    { 4, 44, 7.99, -18, 40, .1, 5.53 },
-    { 18, 15, 30.79, -18, 39, 41.0, 6.07 },
-    { 6, 36, 22.80, -18, 39, 36.0, 5.70 },
-    { 21, 51, 41.81, -18, 37, 23.2, 6.16 },
-    { 18, 18, 43.30, -18, 37, 9.8, 6.84 },
-    { 18, 48, 45.31, -18, 36, 5.0, 6.47 },
-    { 20, 29, 52.51, -18, 35, 12.1, 6.74 },
-    { 14, 17, 3.79, -18, 35, 7.1, 6.22 },
-    { 20, 29, 53.90, -18, 34, 59.9, 5.94 },
-    { 2, 45, 6.19, -18, 34, 21.0, 4.47 },
-    { 10, 35, 38.90, -18, 34, 9.1, 6.49 },
-    { 18, 59, 26.81, -18, 34, .8, 6.37 },
-    { 3, 18, 41.21, -18, 33, 34.9, 5.71 },
-    { 5, 43, 21.60, -18, 33, 27.0, 5.73 },
-    { 16, 14, 39.10, -18, 32, 7.1, 6.32 },
-    { 5, 19, 17.50, -18, 31, 12.0, 6.36 },
-    { 22, 8, 58.99, -18, 31, 10.9, 5.81 },
-    { 5, 19, 18.29, -18, 30, 34.9, 6.54 },
-    { 11, 12, 30.41, -18, 30, .0, 6.13 },
-    { 6, 15, 17.50, -18, 28, 36.1, 5.99 },
-    { 18, 17, 28.49, -18, 27, 47.9, 6.54 },
-    { 16, 27, 1.39, -18, 27, 23.0, 4.42 },
-    { 17, 24, 37.10, -18, 26, 44.9, 6.21 },
-    { 3, 53, 13.01, -18, 26, 3.8, 6.22 },
-    { 18, 31, 26.30, -18, 24, 10.1, 5.14 },
-    { 7, 59, 52.01, -18, 23, 57.1, 4.61 },
-    { 2, 22, 57.79, -18, 21, 15.8, 6.22 },
-    { 11, 44, 45.79, -18, 21, 2.9, 4.73 },
-    { 16, 9, 55.20, -18, 20, 26.9, 6.47 },
-    { 9, 9, 4.30, -18, 19, 43.0, 5.73 },
-    { 13, 18, 24.31, -18, 18, 41.0, 4.74 },
-    { 19, 21, 50.90, -18, 18, 29.9, 5.87 },
-    { 10, 59, 46.51, -18, 17, 56.0, 4.08 },
-    { 23, 44, 12.10, -18, 16, 36.8, 5.24 },
-    { 12, 38, 44.59, -18, 15, 1.1, 6.00 },
-    { 8, 55, 12.41, -18, 14, 29.0, 5.75 },
-    { 6, 37, 53.40, -18, 14, 15.0, 4.43 },
-    { 19, 37, 3.31, -18, 13, 52.0, 5.64 },
-    { 20, 27, 19.20, -18, 12, 42.1, 5.25 },
-    { 14, 15, 24.10, -18, 12, 2.9, 5.43 },
-    { 15, 20, 53.71, -18, 9, 31.0, 6.17 },
-    { 20, 40, 3.00, -18, 8, 19.0, 5.10 },
-    { 13, 49, 52.30, -18, 8, 3.1, 4.97 },
-    { 5, 18, 50.40, -18, 7, 48.0, 5.96 },
-    { 6, 9, 20.30, -18, 7, 34.0, 6.35 },
-    { 10, 4, 2.90, -18, 6, 6.1, 5.86 },
-    { 23, 19, 24.10, -18, 4, 31.1, 5.93 },
-    { 0, 47, 43.30, -18, 3, 41.0, 5.70 },
-    { 20, 49, 20.50, -18, 2, 8.9, 6.21 },
-    { 23, 41, 34.49, -18, 1, 37.9, 5.34 },
-    { 0, 43, 35.40, -17, 59, 12.1, 2.04 },
-    { 21, 17, 57.29, -17, 59, 7.1, 5.43 },
-    { 10, 21, 7.80, -17, 59, 6.0, 6.51 },
-    { 6, 22, 42.00, -17, 57, 20.9, 1.98 },
-    { 0, 12, 10.01, -17, 56, 17.9, 5.25 },
-    { 20, 54, 47.90, -17, 55, 23.2, 5.78 },
-    { 22, 2, 11.90, -17, 54, 13.0, 6.28 },
-    { 7, 27, 7.99, -17, 51, 51.8, 5.63 },
-    { 13, 47, 25.39, -17, 51, 36.0, 5.43 },
-    { 5, 39, 16.30, -17, 50, 57.8, 6.38 },
-    { 19, 21, 40.39, -17, 50, 49.9, 3.93 },
-    { 5, 32, 43.80, -17, 49, 19.9, 2.58 },
-    { 23, 41, 45.79, -17, 48, 59.0, 4.82 },
-    { 20, 28, 51.60, -17, 48, 49.0, 4.78 },
-    { 18, 27, 56.50, -17, 48, .0, 6.20 },
-    { 2, 8, 45.70, -17, 46, 45.8, 6.10 },
-    { 15, 14, 33.70, -17, 46, 7.0, 6.17 },
-    { 6, 12, 46.30, -17, 45, 47.2, 6.52 },
-    { 17, 19, 53.30, -17, 45, 23.0, 6.02 },
-    { 16, 41, 34.39, -17, 44, 31.9, 4.96 },
-    { 13, 23, 1.10, -17, 44, 7.1, 5.37 },
-    { 11, 24, 52.90, -17, 41, 2.0, 4.08 },
-    { 2, 22, 4.99, -17, 39, 43.9, 5.87 },
-    { 17, 8, 14.90, -17, 36, 33.1, 5.99 },
-    { 8, 21, 54.60, -17, 35, 11.0, 5.75 },
-    { 0, 8, 33.41, -17, 34, 39.0, 6.06 },
-    { 12, 15, 48.41, -17, 32, 30.8, 2.59 },
-    { 5, 42, 14.30, -17, 31, 49.1, 6.15 },
-    { 3, 36, 17.40, -17, 28, .8, 5.23 },
-    { 6, 28, 37.30, -17, 27, 58.0, 5.77 },
-    { 21, 18, 15.70, -17, 27, 43.9, 7.05 },
-    { 21, 7, 44.59, -17, 27, 19.1, 6.17 },
-    { 8, 25, 39.41, -17, 26, 21.8, 6.44 },
-    { 0, 7, 18.19, -17, 23, 11.0, 6.19 },
-    { 18, 17, 11.59, -17, 22, 26.0, 5.75 },
-    { 21, 15, 6.60, -17, 20, 42.0, 6.04 },
-    { 0, 3, 44.40, -17, 20, 10.0, 4.55 },
-    { 10, 46, 52.01, -17, 17, 48.1, 5.42 },
-    { 21, 5, 56.81, -17, 13, 58.1, 4.07 },
-    { 7, 49, 41.21, -17, 13, 41.9, 5.18 },
-    { 18, 1, 23.11, -17, 9, 24.8, 6.28 },
-    { 18, 7, 48.41, -17, 9, 15.1, 5.52 },
-    { 11, 56, .91, -17, 9, 2.9, 5.18 },
-    { 5, 16, 48.10, -17, 8, 30.1, 6.56 },
-    { 10, 7, 9.50, -17, 8, 30.1, 5.60 },
-    { 6, 50, 21.89, -17, 5, 2.0, 5.79 },
-    { 23, 5, 12.79, -17, 4, 45.1, 6.14 },
-    { 6, 56, 8.21, -17, 3, 15.1, 4.37 },
-    { 5, 24, 28.39, -16, 58, 34.0, 5.65 },
-    { 22, 2, 26.59, -16, 57, 51.1, 6.37 },
-    { 4, 47, 36.31, -16, 56, 3.8, 5.51 },
-    { 1, 52, 52.10, -16, 55, 45.1, 5.80 },
-    { 10, 38, 34.99, -16, 52, 36.1, 4.91 },
-    { 6, 38, 35.40, -16, 52, 25.0, 6.03 },
-    { 15, 32, 55.20, -16, 51, 10.1, 5.50 },
-    { 21, 50, 13.10, -16, 50, 40.9, 6.38 },
-    { 10, 26, 5.40, -16, 50, 11.0, 3.81 },
-    { 21, 22, 14.81, -16, 50, 3.8, 4.28 },
-    { 6, 17, 41.71, -16, 48, 56.9, 5.14 },
-    { 16, 56, 1.80, -16, 48, 22.0, 6.37 },
-    { 22, 26, 34.39, -16, 44, 33.0, 6.35 },
-    { 22, 26, 34.20, -16, 44, 29.0, 6.57 },
-    { 4, 55, 6.79, -16, 44, 26.2, 5.70 },
-    { 15, 53, 49.51, -16, 43, 45.8, 4.15 },
-    { 5, 41, 41.50, -16, 43, 32.2, 6.21 },
-    { 15, 28, 15.41, -16, 42, 59.0, 5.64 },
-    { 6, 45, 8.90, -16, 42, 58.0, -1.46 },
-    { 8, 56, 34.10, -16, 42, 33.8, 5.96 },
-    { 12, 17, 3.29, -16, 41, 37.0, 6.05 },
-    { 21, 40, 5.50, -16, 39, 43.9, 3.68 },
-    { 12, 27, 49.39, -16, 37, 54.8, 6.35 },
-    { 11, 39, 50.40, -16, 37, 13.1, 6.19 },
-    { 6, 16, 7.70, -16, 37, 4.1, 5.92 },
-    { 16, 31, 8.30, -16, 36, 46.1, 4.28 },
-    { 15, 30, 40.39, -16, 36, 33.8, 5.82 },
-    { 4, 4, 8.71, -16, 35, 20.0, 6.39 },
-    { 9, 51, 59.59, -16, 32, 4.9, 6.08 },
-    { 16, 0, 19.61, -16, 31, 59.9, 5.47 },
-    { 0, 4, 19.70, -16, 31, 44.0, 5.78 },
-    { 20, 35, 32.21, -16, 31, 32.9, 6.19 },
-    { 0, 40, 28.61, -16, 31, .8, 6.49 },
-    { 12, 29, 51.89, -16, 30, 56.2, 2.95 },
-    { 6, 4, 59.09, -16, 29, 3.8, 4.93 },
-    { 0, 45, 41.69, -16, 25, 27.1, 6.47 },
-    { 4, 55, 18.60, -16, 25, 4.1, 5.72 },
-    { 7, 19, 28.10, -16, 23, 42.0, 5.70 },
-    { 4, 9, 17.81, -16, 23, 8.9, 5.37 },
-    { 18, 55, 31.01, -16, 22, 36.1, 5.79 },
-    { 4, 59, 1.30, -16, 22, 32.9, 5.66 },
-    { 10, 59, 30.91, -16, 21, 14.0, 5.89 },
-    { 10, 36, 16.70, -16, 20, 39.8, 6.03 },
-    { 14, 5, 13.99, -16, 20, 8.9, 6.56 },
-    { 4, 48, 32.50, -16, 19, 45.8, 5.77 },
-    { 17, 18, 19.20, -16, 18, 42.8, 6.43 },
-    { 14, 10, 50.50, -16, 18, 6.8, 4.91 },
-    { 19, 40, 43.39, -16, 17, 35.9, 6.20 },
-    { 8, 17, 23.11, -16, 17, 6.0, 6.16 },
-    { 11, 33, 14.59, -16, 16, 50.2, 6.05 },
-    { 22, 54, 45.50, -16, 16, 18.8, 5.56 },
-    { 15, 6, 37.61, -16, 15, 24.8, 5.20 },
-    { 8, 9, 28.51, -16, 14, 56.0, 5.68 },
-    { 5, 47, 7.61, -16, 14, 16.1, 6.17 },
-    { 7, 9, 33.19, -16, 14, 4.9, 6.03 },
-    { 19, 6, 52.30, -16, 13, 44.0, 6.03 },
-    { 4, 50, 11.59, -16, 13, 1.9, 5.03 },
-    { 5, 12, 55.90, -16, 12, 20.2, 3.31 },
-    { 7, 24, 40.10, -16, 12, 4.0, 5.33 },
-    { 13, 12, 3.50, -16, 11, 55.0, 5.04 },
-    { 12, 32, 4.20, -16, 11, 46.0, 4.31 },
-    { 10, 49, 37.49, -16, 11, 37.0, 3.11 },
-    { 13, 44, 29.81, -16, 10, 45.1, 5.60 },
-    { 8, 58, 43.90, -16, 7, 58.1, 5.86 },
-    { 21, 47, 2.40, -16, 7, 37.9, 2.87 },
-    { 20, 40, 32.50, -16, 7, 27.1, 5.80 },
-    { 19, 42, 31.10, -16, 7, 26.0, 5.06 },
-    { 14, 50, 52.70, -16, 2, 30.1, 2.75 },
-    { 20, 57, 40.61, -16, 1, 54.1, 5.87 },
-    { 3, 11, 16.80, -16, 1, 31.1, 6.26 },
-    { 7, 47, 45.19, -16, 0, 51.8, 6.43 },
-    { 14, 50, 41.21, -15, 59, 49.9, 5.15 },
-    { 7, 47, 38.50, -15, 59, 26.9, 6.34 },
-    { 13, 27, 27.19, -15, 58, 25.0, 4.76 },
-    { 19, 21, 43.61, -15, 57, 18.0, 4.61 },
-    { 8, 41, 43.30, -15, 56, 35.9, 4.88 },
-    { 1, 44, 4.10, -15, 56, 15.0, 3.50 },
-    { 11, 50, 19.51, -15, 51, 50.0, 6.13 },
-    { 23, 49, 31.61, -15, 51, 40.0, 6.24 },
-    { 23, 58, 21.19, -15, 50, 51.0, 6.26 },
-    { 9, 19, 33.19, -15, 50, 3.8, 5.78 },
-    { 18, 20, 8.81, -15, 49, 54.1, 5.39 },
-    { 22, 54, 39.00, -15, 49, 14.9, 3.27 },
-    { 17, 56, 19.01, -15, 48, 45.0, 5.89 },
-    { 11, 0, 57.19, -15, 47, 34.1, 6.34 },
-    { 8, 13, 19.99, -15, 47, 17.9, 4.99 },
-    { 13, 45, 35.11, -15, 46, 3.0, 6.19 },
-    { 20, 28, 43.61, -15, 44, 30.1, 6.41 },
-    { 17, 10, 22.70, -15, 43, 28.9, 2.43 },
-    { 1, 34, 37.80, -15, 40, 34.0, 5.63 },
-    { 15, 44, 4.39, -15, 40, 22.1, 5.41 },
-    { 16, 49, 27.79, -15, 40, 3.0, 6.10 },
-    { 1, 24, 39.79, -15, 39, 37.1, 6.14 },
-    { 19, 5, 41.21, -15, 39, 37.1, 5.97 },
-    { 7, 3, 45.50, -15, 37, 59.9, 4.12 },
-    { 9, 20, 55.49, -15, 37, 4.1, 6.33 },
-    { 10, 8, 35.50, -15, 36, 42.1, 6.27 },
-    { 18, 54, 43.10, -15, 36, 11.2, 5.10 },
-    { 7, 16, 14.50, -15, 35, 8.9, 5.46 },
-    { 9, 30, 22.61, -15, 34, 37.9, 5.85 },
-    { 17, 37, 36.19, -15, 34, 16.0, 5.94 },
-    { 15, 21, 1.39, -15, 32, 53.9, 6.30 },
-    { 19, 19, .10, -15, 32, 11.0, 6.06 },
-    { 19, 57, 57.00, -15, 29, 29.0, 5.02 },
-    { 19, 43, 33.50, -15, 28, 12.0, 5.49 },
-    { 0, 11, 15.91, -15, 28, 5.2, 4.89 },
-    { 14, 45, 57.79, -15, 27, 34.9, 6.33 },
-    { 23, 42, 27.89, -15, 26, 52.1, 5.28 },
-    { 10, 53, 32.90, -15, 26, 44.2, 6.38 },
-    { 1, 35, 58.99, -15, 24, 1.1, 5.42 },
-    { 17, 37, 35.21, -15, 23, 55.0, 3.54 },
-    { 13, 32, 51.70, -15, 21, 47.2, 5.55 },
-    { 2, 26, .31, -15, 20, 28.0, 5.83 },
-    { 12, 55, 53.30, -15, 19, 36.8, 6.17 },
-    { 2, 2, 58.61, -15, 18, 20.9, 5.86 },
-    { 23, 43, 49.49, -15, 17, 3.8, 6.36 },
-    { 19, 1, 33.50, -15, 16, 57.0, 6.32 },
-    { 7, 40, 23.21, -15, 15, 49.0, 4.94 },
-    { 10, 47, 37.99, -15, 15, 42.8, 6.67 },
-    { 23, 34, 49.39, -15, 14, 44.9, 5.96 },
-    { 2, 32, 5.21, -15, 14, 40.9, 4.75 },
-    { 3, 40, 11.40, -15, 13, 36.1, 6.33 },
-    { 21, 15, 44.90, -15, 10, 17.0, 5.28 },
-    { 6, 48, 57.79, -15, 8, 40.9, 5.39 },
-    { 6, 23, 46.01, -15, 4, 18.1, 6.24 },
-    { 20, 31, 4.30, -15, 3, 23.0, 6.12 },
-    { 19, 26, 11.11, -15, 3, 11.2, 5.72 },
-    { 15, 43, 24.89, -15, 2, 35.9, 6.31 },
-    { 23, 22, 39.19, -15, 2, 21.1, 5.20 },
-    { 8, 32, 33.29, -15, 1, 45.8, 6.38 },
-    { 9, 15, 24.89, -15, 1, 28.9, 6.35 },
-    { 6, 18, 48.79, -15, 1, 28.9, 6.06 },
-    { 7, 29, 21.89, -14, 59, 57.1, 6.05 },
-    { 0, 36, 3.00, -14, 58, 25.0, 6.45 },
-    { 14, 4, 27.00, -14, 58, 18.1, 6.28 },
-    { 20, 39, 16.39, -14, 57, 16.9, 5.22 },
-    { 6, 6, 9.29, -14, 56, 7.1, 4.67 },
-    { 8, 25, 55.61, -14, 55, 46.9, 5.98 },
-    { 16, 48, 27.00, -14, 54, 33.8, 6.03 },
-    { 16, 19, .41, -14, 52, 21.0, 5.94 },
-    { 16, 58, 41.59, -14, 52, 10.9, 6.59 },
-    { 18, 32, 43.30, -14, 51, 56.2, 5.50 },
-    { 0, 29, 51.89, -14, 51, 51.1, 6.14 },
-    { 18, 33, 39.00, -14, 51, 13.0, 5.76 },
-    { 16, 15, 51.50, -14, 50, 57.1, 6.09 },
-    { 9, 51, 28.70, -14, 50, 48.1, 4.12 },
-    { 7, 52, 18.91, -14, 50, 47.0, 5.69 },
-    { 15, 56, 33.41, -14, 49, 45.1, 6.13 },
-    { 5, 46, 57.29, -14, 49, 18.8, 3.55 },
-    { 4, 59, 36.50, -14, 48, 20.9, 7.71 },
-    { 6, 45, 59.30, -14, 47, 46.0, 5.32 },
-    { 15, 35, 31.61, -14, 47, 21.8, 3.91 },
-    { 20, 20, 46.61, -14, 47, 6.0, 6.10 },
-    { 20, 21, .70, -14, 46, 53.0, 3.08 },
-    { 11, 19, 20.50, -14, 46, 43.0, 3.56 },
-    { 21, 44, 1.01, -14, 44, 57.8, 5.99 },
-    { 17, 47, 36.79, -14, 43, 32.9, 5.94 },
-    { 7, 45, 29.09, -14, 41, 26.9, 6.07 },
-    { 7, 45, 28.70, -14, 41, 10.0, 6.89 },
-    { 0, 2, 7.30, -14, 40, 34.0, 7.10 },
-    { 18, 32, 20.81, -14, 38, 39.1, 6.37 },
-    { 5, 13, 59.90, -14, 36, 24.1, 6.21 },
-    { 19, 53, 6.41, -14, 36, 11.2, 6.48 },
-    { 1, 25, 37.20, -14, 35, 56.0, 4.90 },
-    { 22, 30, 17.40, -14, 35, 8.9, 6.37 },
-    { 6, 9, 34.30, -14, 35, 3.1, 5.56 },
-    { 17, 15, 20.30, -14, 35, 2.0, 5.99 },
-    { 18, 29, 46.80, -14, 34, 54.1, 5.96 },
-    { 9, 17, 7.49, -14, 34, 25.0, 5.84 },
-    { 18, 29, 11.90, -14, 33, 56.9, 4.70 },
-    { 18, 41, 42.50, -14, 33, 51.1, 6.42 },
-    { 7, 45, 56.90, -14, 33, 50.0, 5.04 },
-    { 19, 26, 24.60, -14, 33, 4.0, 6.70 },
-    { 16, 29, 46.90, -14, 33, 2.9, 5.68 },
-    { 2, 41, 34.01, -14, 32, 57.8, 5.98 },
-    { 23, 42, 43.30, -14, 32, 42.0, 4.49 },
-    { 7, 33, 47.90, -14, 31, 26.0, 4.97 },
-    { 23, 9, 49.61, -14, 30, 38.2, 6.42 },
-    { 6, 2, 33.79, -14, 29, 49.9, 6.20 },
-    { 7, 36, 3.91, -14, 29, 34.1, 5.70 },
-    { 5, 49, 36.50, -14, 29, 1.0, 5.49 },
-    { 20, 58, 41.90, -14, 28, 58.1, 6.01 },
-    { 21, 11, 41.30, -14, 28, 19.9, 6.48 },
-    { 11, 39, 51.10, -14, 28, 7.0, 6.21 },
-    { 7, 37, 38.90, -14, 26, 28.0, 6.53 },
-    { 6, 46, 51.10, -14, 25, 32.9, 5.29 },
-    { 23, 50, 33.31, -14, 24, 6.8, 5.72 },
-    { 21, 43, 4.39, -14, 23, 58.9, 5.88 },
-    { 15, 56, 14.40, -14, 23, 57.8, 6.37 },
-    { 5, 3, 52.01, -14, 22, 9.8, 6.41 },
-    { 7, 20, 58.20, -14, 21, 36.0, 5.45 },
-    { 4, 39, 19.70, -14, 21, 33.1, 5.45 },
-    { 7, 33, 22.10, -14, 20, 17.9, 6.21 },
-    { 9, 40, 18.41, -14, 19, 55.9, 5.06 },
-    { 4, 38, 10.80, -14, 18, 14.0, 3.87 },
-    { 19, 37, 34.39, -14, 18, 6.1, 5.47 },
-    { 15, 58, 11.40, -14, 16, 45.8, 4.88 },
-    { 23, 52, 30.00, -14, 15, 4.0, 5.87 },
-    { 4, 57, 44.81, -14, 13, 53.0, 6.15 },
-    { 23, 39, 47.11, -14, 13, 18.1, 5.00 },
-    { 22, 12, 25.80, -14, 11, 38.0, 6.03 },
-    { 5, 56, 24.29, -14, 10, 4.1, 3.71 },
-    { 14, 49, 19.10, -14, 8, 56.0, 5.31 },
-    { 6, 39, 16.70, -14, 8, 44.9, 4.82 },
-    { 15, 51, 38.40, -14, 8, 1.0, 6.19 },
-    { 11, 0, 11.59, -14, 4, 59.9, 5.88 },
-    { 16, 7, 3.41, -14, 4, 14.9, 6.32 },
-    { 22, 47, 42.79, -14, 3, 23.0, 5.66 },
-    { 21, 41, 32.90, -14, 2, 51.0, 5.18 },
-    { 6, 56, 6.60, -14, 2, 37.0, 5.00 },
-    { 18, 38, 4.61, -14, 0, 16.9, 6.47 },
-    { 10, 42, 31.30, -13, 58, 30.0, 6.24 },
-    { 18, 9, 43.39, -13, 56, 3.8, 6.39 },
-    { 5, 23, 30.19, -13, 55, 37.9, 5.25 },
-    { 7, 51, 46.30, -13, 53, 53.2, 5.17 },
-    { 19, 25, 21.60, -13, 53, 48.8, 5.69 },
-    { 22, 6, 26.21, -13, 52, 10.9, 4.27 },
-    { 12, 32, 36.00, -13, 51, 33.1, 5.74 },
-    { 2, 44, 7.39, -13, 51, 31.0, 4.25 },
-    { 8, 10, 39.79, -13, 47, 57.1, 5.54 },
-    { 4, 49, 42.19, -13, 46, 10.9, 6.26 },
-    { 10, 54, 17.81, -13, 45, 29.2, 5.66 },
-    { 5, 21, 51.00, -13, 45, 22.0, 6.56 },
-    { 7, 25, 8.30, -13, 45, 6.8, 5.78 },
-    { 20, 34, 11.69, -13, 43, 16.0, 6.13 },
-    { 6, 15, 44.90, -13, 43, 5.9, 5.01 },
-    { 19, 48, 3.00, -13, 42, 11.9, 6.11 },
-    { 4, 31, 25.90, -13, 38, 42.0, 6.21 },
-    { 20, 1, 58.61, -13, 38, 12.8, 5.71 },
-    { 22, 49, 35.50, -13, 35, 33.0, 4.01 },
-    { 4, 30, 9.70, -13, 35, 31.9, 6.24 },
-    { 10, 30, 59.81, -13, 35, 17.9, 5.58 },
-    { 12, 20, 55.70, -13, 33, 56.2, 5.14 },
-    { 0, 49, 25.61, -13, 33, 41.0, 5.59 },
-    { 21, 53, 17.81, -13, 33, 6.1, 5.08 },
-    { 8, 46, 22.51, -13, 32, 52.1, 4.32 },
-    { 22, 24, 27.10, -13, 31, 45.8, 5.76 },
-    { 5, 17, 40.20, -13, 31, 10.9, 5.50 },
-    { 9, 32, 55.80, -13, 31, .8, 5.94 },
-    { 17, 43, 48.60, -13, 30, 31.0, 6.39 },
-    { 3, 58, 1.80, -13, 30, 31.0, 2.95 },
-    { 23, 19, 6.70, -13, 27, 32.0, 5.08 },
-    { 11, 3, 36.50, -13, 26, 3.8, 6.34 },
-    { 12, 30, 4.80, -13, 23, 35.2, 6.35 },
-    { 10, 37, 33.19, -13, 23, 3.8, 4.82 },
-    { 14, 19, 6.60, -13, 22, 16.0, 4.52 },
-    { 7, 49, 28.61, -13, 21, 11.9, 6.23 },
-    { 6, 36, 46.70, -13, 19, 14.9, 5.97 },
-    { 22, 19, .79, -13, 18, 18.0, 5.95 },
-    { 21, 17, 13.49, -13, 16, 44.0, 6.40 },
-    { 8, 52, 30.70, -13, 14, 1.0, 6.13 },
-    { 13, 34, 40.49, -13, 12, 51.8, 5.91 },
-    { 11, 38, 40.10, -13, 12, 6.8, 5.48 },
-    { 5, 19, 34.51, -13, 10, 36.1, 4.29 },
-    { 6, 30, 34.70, -13, 8, 53.2, 6.16 },
-    { 5, 6, 36.70, -13, 7, 18.8, 6.05 },
-    { 22, 59, 35.69, -13, 4, 14.9, 6.07 },
-    { 10, 5, 7.49, -13, 3, 52.9, 4.60 },
-    { 23, 37, 39.60, -13, 3, 37.1, 5.65 },
-    { 1, 26, 51.60, -13, 3, 24.1, 5.66 },
-    { 8, 22, 46.80, -13, 3, 16.9, 6.11 },
-    { 4, 29, 6.89, -13, 2, 53.9, 5.60 },
-    { 12, 41, 16.20, -13, 0, 54.0, 5.98 },
-    { 12, 41, 16.01, -13, 0, 49.0, 6.08 },
-    { 6, 37, 40.90, -12, 59, 6.0, 6.12 },
-    { 6, 24, 20.50, -12, 57, 45.0, 6.12 },
-    { 5, 13, 13.90, -12, 56, 29.0, 4.36 },
-    { 8, 11, 16.30, -12, 55, 36.8, 4.72 },
-    { 22, 30, 1.51, -12, 54, 54.0, 6.40 },
-    { 6, 0, 17.71, -12, 53, 58.9, 6.22 },
-    { 16, 59, 30.20, -12, 53, 27.0, },
-    { 0, 45, 28.70, -12, 52, 50.9, 6.15 },
-    { 21, 24, 11.50, -12, 52, 41.2, 5.49 },
-    { 17, 41, 24.91, -12, 52, 31.1, 4.26 },
-    { 17, 20, 49.70, -12, 50, 48.8, 4.33 },
-    { 18, 59, 23.81, -12, 50, 26.2, 5.53 },
-    { 14, 47, 54.89, -12, 50, 22.9, 6.35 },
-    { 22, 16, 48.10, -12, 49, 53.0, 5.34 },
-    { 12, 33, 34.30, -12, 49, 49.1, 5.58 },
-    { 7, 51, 40.90, -12, 49, 9.8, 6.36 },
-    { 10, 10, 5.90, -12, 48, 58.0, 5.31 },
-    { 4, 4, 22.70, -12, 47, 33.0, 5.61 },
-    { 2, 52, 32.11, -12, 46, 9.8, 6.04 },
-    { 20, 20, 39.79, -12, 45, 33.1, 4.76 },
-    { 16, 7, 36.41, -12, 44, 44.2, 5.78 },
-    { 21, 49, 41.11, -12, 43, 23.2, 6.31 },
-    { 13, 26, 43.20, -12, 42, 28.1, 5.25 },
-    { 7, 46, 44.90, -12, 40, 31.1, 6.39 },
-    { 3, 29, 36.00, -12, 40, 28.9, 5.59 },
-    { 20, 5, 26.40, -12, 39, 55.1, 6.55 },
-    { 8, 18, 23.90, -12, 37, 54.8, 5.98 },
-    { 20, 12, 25.90, -12, 37, 3.0, 5.85 },
-    { 0, 10, 42.79, -12, 34, 48.0, 5.85 },
-    { 3, 59, 30.10, -12, 34, 27.1, 5.60 },
-    { 20, 50, 41.81, -12, 32, 42.0, 5.88 },
-    { 20, 18, 3.31, -12, 32, 40.9, 3.57 },
-    { 4, 59, 55.80, -12, 32, 15.0, 4.79 },
-    { 8, 26, 41.90, -12, 32, 3.8, 5.54 },
-    { 10, 19, 16.80, -12, 31, 41.2, 6.00 },
-    { 17, 27, 2.11, -12, 30, 45.0, 6.21 },
-    { 20, 17, 38.90, -12, 30, 29.9, 4.24 },
-    { 5, 7, 25.01, -12, 29, 26.2, 5.97 },
-    { 8, 40, 1.51, -12, 28, 31.1, 4.98 },
-    { 2, 47, 55.99, -12, 27, 38.2, 6.90 },
-    { 10, 38, 50.40, -12, 26, 37.0, 6.04 },
-    { 13, 45, 56.30, -12, 25, 36.1, 5.51 },
-    { 7, 6, 35.90, -12, 23, 38.0, 6.48 },
-    { 20, 11, 57.89, -12, 23, 33.0, 6.34 },
-    { 6, 31, 22.99, -12, 23, 30.1, 5.15 },
-    { 15, 23, 52.20, -12, 22, 9.8, 5.72 },
-    { 9, 9, 11.50, -12, 21, 28.1, 5.77 },
-    { 11, 27, 9.50, -12, 21, 24.1, 5.94 },
-    { 10, 10, 35.30, -12, 21, 15.1, 3.61 },
-    { 20, 16, 22.80, -12, 20, 12.8, 6.32 },
-    { 5, 19, 59.09, -12, 18, 56.2, 5.30 },
-    { 14, 36, 59.81, -12, 18, 19.1, 6.20 },
-    { 2, 25, 57.00, -12, 17, 26.2, 4.89 },
-    { 19, 13, 15.50, -12, 16, 57.0, 5.51 },
-    { 19, 35, 33.60, -12, 15, 10.1, 6.27 },
-    { 10, 36, 32.40, -12, 13, 49.1, 5.70 },
-    { 0, 22, 51.79, -12, 12, 33.8, 6.39 },
-    { 7, 47, 56.71, -12, 11, 35.2, 5.48 },
-    { 11, 51, 21.89, -12, 11, 16.1, 6.35 },
-    { 4, 38, 53.59, -12, 7, 23.2, 5.01 },
-    { 3, 46, 8.50, -12, 6, 6.1, 4.42 },
-    { 3, 55, 16.30, -12, 5, 57.1, 6.00 },
-    { 10, 9, 56.50, -12, 5, 44.9, 6.24 },
-    { 6, 54, 11.40, -12, 2, 19.0, 4.07 },
-    { 18, 23, 12.19, -12, 0, 52.9, 5.73 },
-    { 0, 43, 50.21, -12, 0, 42.1, 6.02 },
-    { 9, 19, 46.39, -11, 58, 30.0, 4.79 },
-    { 8, 42, 9.79, -11, 57, 58.0, 6.45 },
-    { 23, 47, 15.91, -11, 54, 38.9, 5.73 },
-    { 5, 27, 4.80, -11, 54, 2.9, 6.35 },
-    { 14, 54, 22.90, -11, 53, 53.9, 5.80 },
-    { 2, 39, 33.79, -11, 52, 19.9, 4.84 },
-    { 5, 12, 17.90, -11, 52, 9.1, 4.45 },
-    { 5, 11, 22.80, -11, 50, 57.1, 5.68 },
-    { 16, 13, 50.90, -11, 50, 15.0, 5.22 },
-    { 3, 41, 13.80, -11, 48, 11.2, 6.49 },
-    { 16, 54, 40.30, -11, 47, 33.0, 6.57 },
-    { 5, 37, 8.81, -11, 46, 32.2, 6.11 },
-    { 5, 54, 43.61, -11, 46, 26.0, 5.66 },
-    { 6, 21, 24.70, -11, 46, 23.9, 5.64 },
-    { 10, 37, 11.59, -11, 44, 55.0, 6.52 },
-    { 14, 23, 25.61, -11, 42, 51.1, 6.21 },
-    { 23, 17, 40.01, -11, 42, 47.2, 6.34 },
-    { 23, 41, 8.90, -11, 40, 50.2, 5.89 },
-    { 14, 24, 40.90, -11, 40, 10.9, 6.49 },
-    { 12, 54, 18.70, -11, 38, 55.0, 6.00 },
-    { 22, 53, 28.70, -11, 37, .1, 5.80 },
-    { 12, 25, 11.71, -11, 36, 37.1, 5.95 },
-    { 20, 5, 5.40, -11, 35, 57.8, 6.34 },
-    { 20, 53, 5.59, -11, 34, 25.0, 6.38 },
-    { 21, 28, 13.90, -11, 34, 5.9, 6.61 },
-    { 22, 10, 37.49, -11, 33, 54.0, 5.46 },
-    { 7, 27, 51.70, -11, 33, 24.8, 5.79 },
-    { 6, 24, 10.30, -11, 31, 49.1, 5.22 },
-    { 23, 28, 5.21, -11, 26, 58.9, 6.37 },
-    { 14, 56, 46.10, -11, 24, 34.9, 5.46 },
-    { 0, 58, 43.90, -11, 22, 48.0, 5.61 },
-    { 16, 4, 22.10, -11, 22, 23.2, 5.07 },
-    { 16, 4, 22.10, -11, 22, 23.2, 4.77 },
-    { 21, 9, 35.69, -11, 22, 18.1, 4.51 },
-    { 21, 46, 32.11, -11, 21, 56.9, 5.58 },
-    { 8, 8, 56.90, -11, 20, 22.9, 6.32 },
-    { 1, 41, 44.71, -11, 19, 28.9, 5.75 },
-    { 9, 19, 33.70, -11, 18, 51.1, 6.62 },
-    { 11, 3, 14.90, -11, 18, 13.0, 5.50 },
-    { 7, 6, 40.70, -11, 17, 39.1, 5.39 },
-    { 3, 28, 1.01, -11, 17, 12.1, 5.73 },
-    { 0, 56, 1.51, -11, 16, .1, 5.31 },
-    { 7, 13, 7.20, -11, 15, 5.0, 5.78 },
-    { 17, 34, 46.39, -11, 14, 30.8, 5.55 },
-    { 1, 20, 27.79, -11, 14, 20.0, 6.15 },
-    { 10, 16, 9.10, -11, 12, 11.9, 6.08 },
-    { 3, 35, 57.70, -11, 11, 37.0, 5.57 },
-    { 6, 6, 51.89, -11, 10, 25.0, 6.66 },
-    { 6, 32, 46.90, -11, 9, 59.0, 6.24 },
-    { 13, 25, 11.59, -11, 9, 41.0, 0.98 },
-    { 14, 58, 13.39, -11, 9, 18.0, 6.60 },
-    { 14, 58, 53.59, -11, 8, 39.1, 5.87 },
-    { 7, 50, 55.20, -11, 7, 43.0, 6.16 },
-    { 11, 5, 34.01, -11, 5, 20.0, 6.09 },
-    { 8, 46, 6.89, -11, 0, 23.0, 6.25 },
-    { 18, 35, 2.40, -10, 58, 37.9, 5.14 },
-    { 16, 57, 26.09, -10, 57, 47.9, 6.19 },
-    { 17, 38, 9.50, -10, 55, 35.0, 5.75 },
-    { 22, 31, 41.30, -10, 54, 20.2, 6.38 },
-    { 1, 27, 46.61, -10, 54, 6.1, 6.13 },
-    { 17, 53, 3.60, -10, 53, 58.9, 6.18 },
-    { 10, 8, 45.70, -10, 53, 4.9, 6.53 },
-    { 19, 49, 2.21, -10, 52, 14.9, 6.04 },
-    { 11, 24, 36.60, -10, 51, 33.8, 4.83 },
-    { 18, 31, 25.70, -10, 47, 44.9, 5.72 },
-    { 4, 33, 22.01, -10, 47, 8.9, 6.06 },
-    { 16, 49, 49.99, -10, 46, 59.2, 4.65 },
-    { 2, 22, 1.39, -10, 46, 40.1, 5.46 },
-    { 9, 40, 20.11, -10, 46, 9.1, 6.37 },
-    { 19, 50, 46.80, -10, 45, 49.0, 5.39 },
-    { 13, 7, 53.81, -10, 44, 25.1, 5.19 },
-    { 6, 17, 35.21, -10, 43, 31.1, 6.75 },
-    { 17, 20, 52.70, -10, 41, 46.0, 6.46 },
-    { 23, 14, 40.20, -10, 41, 19.0, 6.12 },
-    { 1, 49, 35.09, -10, 41, 11.0, 4.67 },
-    { 22, 30, 38.81, -10, 40, 41.2, 4.82 },
-    { 7, 5, 49.70, -10, 39, 40.0, 6.49 },
-    { 0, 50, 7.61, -10, 38, 39.8, 5.19 },
-    { 0, 44, 11.40, -10, 36, 33.8, 4.76 },
-    { 21, 14, 16.70, -10, 36, 19.1, 6.77 },
-    { 6, 1, 50.40, -10, 35, 53.2, 4.95 },
-    { 7, 15, 43.10, -10, 35, 2.0, 5.95 },
-    { 10, 36, 17.40, -10, 34, 59.9, 6.57 },
-    { 21, 39, 28.10, -10, 34, 36.8, 6.08 },
-    { 9, 39, 47.40, -10, 34, 13.1, 6.31 },
-    { 16, 37, 9.50, -10, 34, 1.9, 2.56 },
-    { 19, 35, 7.30, -10, 33, 37.1, 5.12 },
-    { 22, 48, 30.19, -10, 33, 20.2, 6.19 },
-    { 9, 31, 38.90, -10, 33, 7.9, 6.14 },
-    { 5, 47, 26.71, -10, 31, 59.2, 6.03 },
-    { 17, 9, 48.00, -10, 31, 23.9, 5.56 },
-    { 0, 4, 30.10, -10, 30, 33.8, 4.94 },
-    { 3, 43, 33.79, -10, 29, 8.2, 5.60 },
-    { 12, 0, 44.50, -10, 26, 46.0, 5.55 },
-    { 3, 39, 25.39, -10, 26, 13.9, 6.19 },
-    { 5, 40, 46.01, -10, 24, 33.8, 6.52 },
-    { 9, 31, 55.80, -10, 22, 14.2, 6.13 },
-    { 7, 9, 20.30, -10, 20, 49.9, 6.21 },
-    { 12, 51, 22.90, -10, 20, 17.9, 6.41 },
-    { 1, 51, 27.60, -10, 20, 6.0, 3.73 },
-    { 14, 9, .60, -10, 20, 3.8, 6.47 },
-    { 13, 9, 45.31, -10, 19, 45.8, 5.94 },
-    { 5, 25, 1.61, -10, 19, 45.1, 5.61 },
-    { 7, 29, 22.10, -10, 19, 36.1, 5.75 },
-    { 15, 24, 11.90, -10, 19, 19.9, 4.94 },
-    { 7, 14, 28.20, -10, 19, .1, 6.03 },
-    { 11, 48, 23.50, -10, 18, 47.9, 6.26 },
-    { 12, 15, 10.61, -10, 18, 45.0, 6.11 },
-    { 21, 53, 36.00, -10, 18, 42.1, 6.59 },
-    { 14, 12, 53.81, -10, 16, 25.0, 4.19 },
-    { 4, 59, 50.40, -10, 15, 47.9, 5.38 },
-    { 4, 14, 23.71, -10, 15, 23.0, 4.87 },
-    { 6, 5, 27.00, -10, 14, 34.1, 5.87 },
-    { 18, 23, 2.21, -10, 13, 7.0, 6.33 },
-    { 1, 8, 35.40, -10, 10, 55.9, 3.45 },
-    { 8, 19, 15.10, -10, 9, 56.9, 6.32 },
-    { 13, 32, 58.10, -10, 9, 54.0, 5.21 },
-    { 18, 46, 43.30, -10, 7, 30.0, 5.71 },
-    { 7, 3, 57.29, -10, 7, 27.1, 6.45 },
-    { 6, 46, 39.00, -10, 6, 25.9, 5.66 },
-    { 6, 30, 11.30, -10, 4, 53.0, 5.93 },
-    { 15, 34, 10.70, -10, 3, 51.8, 4.62 },
-    { 16, 12, .00, -10, 3, 51.1, 4.94 },
-    { 20, 8, 31.30, -10, 3, 46.1, 6.18 },
-    { 2, 11, 22.20, -10, 3, 7.9, 6.01 },
-    { 1, 5, 36.79, -9, 58, 45.1, 6.12 },
-    { 23, 50, 14.69, -9, 58, 27.1, 5.94 },
-    { 3, 1, 56.09, -9, 57, 41.0, 5.83 },
-    { 19, 59, 47.40, -9, 57, 29.9, 5.88 },
-    { 7, 14, 15.50, -9, 56, 51.0, 5.90 },
-    { 6, 23, 36.00, -9, 52, 27.8, 6.19 },
-    { 3, 34, 37.39, -9, 52, 7.0, 6.25 },
-    { 20, 32, 23.71, -9, 51, 11.9, 5.65 },
-    { 10, 49, 43.49, -9, 51, 10.1, 5.86 },
-    { 1, 6, 5.09, -9, 50, 21.8, 5.58 },
-    { 9, 22, 50.90, -9, 50, 20.0, 6.53 },
-    { 11, 36, 40.90, -9, 48, 7.9, 4.70 },
-    { 1, 7, 46.20, -9, 47, 8.2, 5.82 },
-    { 2, 58, 47.40, -9, 46, 35.0, 6.14 },
-    { 18, 50, 58.49, -9, 46, 27.1, 5.83 },
-    { 17, 59, 1.61, -9, 46, 25.0, 3.34 },
-    { 3, 43, 14.90, -9, 45, 47.9, 3.54 },
-    { 18, 17, 24.19, -9, 45, 31.0, 6.31 },
-    { 3, 56, 37.90, -9, 45, 2.9, 6.19 },
-    { 21, 25, 13.10, -9, 44, 55.0, 5.70 },
-    { 8, 28, 50.90, -9, 44, 53.9, 6.00 },
-    { 4, 35, 13.99, -9, 44, 12.1, 6.37 },
-    { 13, 47, 13.49, -9, 42, 33.1, 6.05 },
-    { 5, 39, 30.79, -9, 42, 24.1, 6.50 },
-    { 20, 56, 54.00, -9, 41, 51.0, 5.51 },
-    { 5, 47, 45.41, -9, 40, 10.9, 2.06 },
-    { 20, 23, .79, -9, 39, 16.9, 6.30 },
-    { 23, 18, 57.70, -9, 36, 38.9, 4.98 },
-    { 18, 53, 1.90, -9, 34, 34.0, 6.34 },
-    { 10, 3, 40.99, -9, 34, 26.0, 6.12 },
-    { 0, 14, 54.50, -9, 34, 10.9, 5.75 },
-    { 5, 59, 4.30, -9, 33, 29.9, 5.03 },
-    { 9, 20, 28.99, -9, 33, 20.9, 4.80 },
-    { 16, 39, 39.10, -9, 33, 15.8, 6.35 },
-    { 7, 41, 14.81, -9, 33, 4.0, 3.93 },
-    { 12, 54, 21.19, -9, 32, 20.0, 4.79 },
-    { 13, 9, 14.40, -9, 32, 17.9, 6.32 },
-    { 20, 47, 40.61, -9, 29, 44.9, 3.77 },
-    { 2, 15, 28.30, -9, 27, 56.2, 6.55 },
-    { 3, 32, 55.80, -9, 27, 29.9, 3.73 },
-    { 2, 40, 12.31, -9, 27, 11.2, 5.78 },
-    { 12, 33, 46.80, -9, 27, 6.8, 5.48 },
-    { 2, 52, 50.50, -9, 26, 28.0, 6.32 },
-    { 9, 37, 51.50, -9, 25, 27.8, 6.40 },
-    { 1, 37, 37.70, -9, 24, 14.0, 6.24 },
-    { 6, 18, 50.59, -9, 23, 25.1, 5.36 },
-    { 15, 17, .41, -9, 22, 59.2, 2.61 },
-    { 5, 59, 1.01, -9, 22, 55.9, 6.12 },
-    { 21, 10, 46.90, -9, 21, 14.0, 6.27 },
-    { 21, 22, 56.30, -9, 19, 9.8, 5.99 },
-    { 14, 6, 42.79, -9, 18, 47.9, 5.46 },
-    { 21, 46, 16.30, -9, 16, 32.9, 6.00 },
-    { 23, 29, .60, -9, 15, 58.0, 6.18 },
-    { 8, 6, 27.50, -9, 14, 42.0, 6.23 },
-    { 9, 27, 14.59, -9, 13, 25.0, 6.54 },
-    { 7, 0, 39.29, -9, 12, 11.2, 6.49 },
-    { 7, 50, 10.61, -9, 10, 59.9, 5.61 },
-    { 15, 34, 26.59, -9, 10, 59.9, 5.17 },
-    { 23, 17, 54.19, -9, 10, 57.0, 4.39 },
-    { 6, 41, 56.40, -9, 10, 1.9, 5.19 },
-    { 3, 16, 35.71, -9, 9, 15.8, 6.14 },
-    { 23, 15, 53.50, -9, 5, 16.1, 4.21 },
-    { 21, 45, .31, -9, 4, 57.0, 5.09 },
-    { 10, 19, 59.40, -9, 3, 32.0, 6.32 },
-    { 18, 42, 16.39, -9, 3, 9.0, 4.72 },
-    { 8, 41, 1.61, -9, 3, 6.8, 6.63 },
-    { 5, 52, 7.61, -9, 2, 29.0, 5.97 },
-    { 22, 16, 52.61, -9, 2, 24.0, 5.79 },
-    { 6, 15, 25.99, -9, 2, 7.1, 6.10 },
-    { 1, 33, 3.50, -9, 0, 52.9, 6.59 },
-    { 6, 47, 37.10, -8, 59, 53.9, 5.07 },
-    { 23, 52, 50.50, -8, 59, 48.1, 5.75 },
-    { 13, 8, 32.50, -8, 59, 3.8, 5.55 },
-    { 20, 52, 39.19, -8, 58, 59.9, 4.73 },
-    { 7, 22, 1.99, -8, 58, 45.1, 6.43 },
-    { 4, 34, 11.71, -8, 58, 13.1, 5.26 },
-    { 18, 23, 39.50, -8, 56, 3.1, 4.68 },
-    { 1, 10, 12.00, -8, 54, 22.0, 6.40 },
-    { 2, 56, 25.70, -8, 53, 53.2, 3.89 },
-    { 10, 50, 18.10, -8, 53, 52.1, 5.79 },
-    { 7, 32, 5.81, -8, 52, 50.9, 5.90 },
-    { 7, 21, 16.90, -8, 52, 41.9, 6.55 },
-    { 4, 5, 56.50, -8, 51, 22.0, 6.26 },
-    { 20, 11, 10.10, -8, 50, 31.9, 6.49 },
-    { 0, 8, 17.40, -8, 49, 26.0, 5.99 },
-    { 0, 19, 25.70, -8, 49, 26.0, 3.56 },
-    { 4, 10, 47.69, -8, 49, 10.9, 5.70 },
-    { 3, 15, 49.99, -8, 49, 10.9, 4.80 },
-    { 8, 28, 19.70, -8, 48, 58.0, 6.43 },
-    { 4, 43, 35.09, -8, 47, 46.0, 6.70 },
-    { 15, 38, 40.01, -8, 47, 39.8, 6.50 },
-    { 4, 43, 34.61, -8, 47, 37.0, 6.82 },
-    { 15, 38, 40.10, -8, 47, 28.0, 6.48 },
-    { 9, 9, 35.50, -8, 47, 16.1, 5.46 },
-    { 5, 9, 8.81, -8, 45, 15.1, 4.27 },
-    { 9, 16, 41.30, -8, 44, 40.9, 5.47 },
-    { 0, 54, 17.59, -8, 44, 26.9, 6.16 },
-    { 13, 41, 36.79, -8, 42, 11.2, 5.01 },
-    { 5, 8, 20.21, -8, 39, 54.0, 5.78 },
-    { 9, 27, 35.21, -8, 39, 31.0, 1.98 },
-    { 9, 8, 42.19, -8, 35, 21.8, 5.60 },
-    { 6, 19, 7.90, -8, 35, 11.0, 6.22 },
-    { 19, 54, 8.21, -8, 34, 27.1, 5.79 },
-    { 16, 12, 7.30, -8, 32, 51.0, 5.43 },
-    { 2, 0, 26.90, -8, 31, 25.0, 5.51 },
-    { 15, 0, 58.39, -8, 31, 8.0, 4.92 },
-    { 9, 33, 2.09, -8, 30, 19.1, 6.12 },
-    { 4, 44, 5.30, -8, 30, 13.0, 5.90 },
-    { 10, 10, 55.80, -8, 25, 5.9, 5.65 },
-    { 5, 23, 18.50, -8, 24, 56.9, 5.90 },
-    { 16, 0, 47.59, -8, 24, 41.0, 5.55 },
-    { 10, 10, 7.49, -8, 24, 29.9, 5.91 },
-    { 7, 0, 23.69, -8, 24, 24.8, 5.96 },
-    { 16, 27, 48.10, -8, 22, 18.1, 4.63 },
-    { 16, 15, 37.30, -8, 22, 9.8, 5.50 },
-    { 18, 6, 7.39, -8, 19, 26.0, 5.85 },
-    { 22, 43, 3.50, -8, 18, 42.1, 6.45 },
-    { 7, 36, 16.61, -8, 18, 41.0, 6.27 },
-    { 18, 43, 31.30, -8, 16, 31.1, 4.90 },
-    { 18, 35, 12.41, -8, 14, 39.1, 3.85 },
-    { 19, 54, 38.11, -8, 14, 13.9, 6.49 },
-    { 4, 34, 11.59, -8, 13, 53.0, 5.11 },
-    { 19, 54, 37.61, -8, 13, 37.9, 5.71 },
-    { 17, 28, 2.30, -8, 12, 29.9, 6.37 },
-    { 5, 14, 32.30, -8, 12, 6.1, 0.12 },
-    { 19, 22, 20.69, -8, 12, 4.0, 6.31 },
-    { 7, 40, 35.50, -8, 11, 8.9, 6.01 },
-    { 1, 24, 1.39, -8, 10, 59.9, 3.60 },
-    { 18, 3, 4.90, -8, 10, 50.2, 5.24 },
-    { 18, 3, 4.99, -8, 10, 49.1, 5.94 },
-    { 6, 57, .10, -8, 10, 44.0, 6.34 },
-    { 6, 31, 50.09, -8, 9, 29.2, 5.43 },
-    { 5, 13, 33.29, -8, 8, 52.1, 6.37 },
-    { 16, 28, 48.91, -8, 7, 44.0, 6.48 },
-    { 17, 37, 50.69, -8, 7, 8.0, 4.62 },
-    { 9, 52, 30.41, -8, 6, 18.0, 5.05 },
-    { 10, 17, 37.80, -8, 4, 8.0, 5.24 },
-    { 13, 54, 58.20, -8, 3, 32.0, 6.19 },
-    { 0, 18, 41.81, -8, 3, 10.1, 6.46 },
-    { 6, 50, 42.29, -8, 2, 28.0, 6.29 },
-    { 1, 24, 2.50, -8, 0, 27.0, 6.21 },
-    { 12, 39, 14.81, -7, 59, 44.2, 4.66 },
-    { 8, 35, 28.20, -7, 58, 55.9, 5.72 },
-    { 8, 55, 29.59, -7, 58, 16.0, 6.67 },
-    { 8, 55, 29.50, -7, 58, 13.1, 6.91 },
-    { 19, 12, 40.70, -7, 56, 21.8, 5.34 },
-    { 1, 14, 24.00, -7, 55, 23.2, 5.13 },
-    { 18, 50, 19.99, -7, 54, 27.0, 6.80 },
-    { 22, 38, 22.20, -7, 53, 52.1, 6.23 },
-    { 6, 25, 58.80, -7, 53, 39.1, 6.40 },
-    { 2, 34, 42.70, -7, 51, 33.8, 5.75 },
-    { 21, 37, 45.10, -7, 51, 15.1, 4.69 },
-    { 2, 36, .00, -7, 49, 54.1, 5.53 },
-    { 11, 32, 47.50, -7, 49, 39.0, 5.95 },
-    { 6, 19, 42.79, -7, 49, 23.2, 5.27 },
-    { 22, 20, 11.90, -7, 49, 16.0, 5.37 },
-    { 5, 23, 56.81, -7, 48, 29.2, 4.14 },
-    { 3, 23, 17.81, -7, 47, 39.1, 6.20 },
-    { 18, 40, .50, -7, 47, 26.2, 5.84 },
-    { 22, 16, 49.99, -7, 46, 59.9, 4.16 },
-    { 0, 14, 27.60, -7, 46, 50.2, 5.12 },
-    { 8, 11, 33.00, -7, 46, 21.0, 5.36 },
-    { 23, 16, 50.90, -7, 43, 36.1, 5.06 },
-    { 23, 5, 9.79, -7, 41, 37.0, 5.43 },
-    { 3, 2, 42.31, -7, 41, 7.1, 5.32 },
-    { 12, 2, 51.60, -7, 41, 1.0, 6.22 },
-    { 3, 1, 10.01, -7, 39, 46.1, 5.75 },
-    { 4, 15, 16.30, -7, 39, 10.1, 4.43 },
-    { 10, 30, 58.70, -7, 38, 15.0, 6.20 },
-    { 3, 4, 16.39, -7, 36, 2.9, 5.26 },
-    { 16, 27, 43.49, -7, 35, 53.2, 5.23 },
-    { 4, 20, 42.79, -7, 35, 33.0, 5.85 },
-    { 22, 52, 36.89, -7, 34, 46.9, 3.74 },
-    { 7, 29, 25.70, -7, 33, 4.0, 5.86 },
-    { 8, 22, 54.00, -7, 32, 35.9, 5.96 },
-    { 14, 18, .60, -7, 32, 33.0, 6.47 },
-    { 5, 51, 22.01, -7, 31, 5.2, 5.35 },
-    { 16, 30, 29.90, -7, 30, 54.0, 6.50 },
-    { 6, 26, 44.90, -7, 30, 41.0, 6.27 },
-    { 20, 4, 1.20, -7, 28, 10.9, 6.72 },
-    { 23, 35, 32.11, -7, 27, 51.8, 6.39 },
-    { 19, 35, 29.81, -7, 27, 37.1, 6.34 },
-    { 5, 30, 20.71, -7, 26, 4.9, 6.33 },
-    { 19, 23, 4.61, -7, 24, 1.1, 6.32 },
-    { 3, 38, 29.21, -7, 23, 30.1, 5.85 },
-    { 0, 55, 42.41, -7, 20, 49.9, 5.85 },
-    { 10, 11, 17.81, -7, 19, .1, 6.25 },
-    { 5, 31, 55.80, -7, 18, 5.0, 4.62 },
-    { 8, 43, 40.39, -7, 14, 1.0, 4.62 },
-    { 5, 38, 53.11, -7, 12, 47.2, 4.80 },
-    { 22, 54, 34.10, -7, 12, 16.9, 6.19 },
-    { 13, 33, .70, -7, 11, 42.0, 6.68 },
-    { 22, 23, 32.11, -7, 11, 39.8, 5.93 },
-    { 9, 33, 20.11, -7, 11, 24.0, 6.24 },
-    { 8, 51, 34.51, -7, 10, 37.9, 5.54 },
-    { 5, 1, 26.30, -7, 10, 26.0, 4.81 },
-    { 11, 16, 58.20, -7, 8, 4.9, 6.14 },
-    { 9, 12, 25.99, -7, 6, 34.9, 6.11 },
-    { 17, 43, 46.99, -7, 4, 45.8, 6.30 },
-    { 18, 24, 42.10, -7, 4, 31.1, 6.31 },
-    { 18, 42, 36.10, -7, 4, 23.9, 6.15 },
-    { 23, 1, 23.59, -7, 3, 40.0, 6.21 },
-    { 10, 25, 44.30, -7, 3, 34.9, 5.57 },
-    { 19, 29, 21.50, -7, 2, 38.0, 6.61 },
-    { 6, 28, 49.51, -7, 2, 3.8, 5.40 },
-    { 6, 28, 49.51, -7, 2, 3.8, 5.60 },
-    { 6, 28, 49.01, -7, 1, 58.1, 4.60 },
-    { 19, 36, 53.50, -7, 1, 39.0, 4.95 },
-    { 1, 33, 42.89, -7, 1, 31.1, 5.76 },
-    { 22, 43, 14.30, -6, 57, 46.1, 6.41 },
-    { 4, 10, 22.51, -6, 55, 26.0, 5.44 },
-    { 1, 24, 20.59, -6, 54, 52.9, 5.91 },
-    { 14, 28, 41.71, -6, 54, 2.2, 5.42 },
-    { 20, 53, 58.39, -6, 53, 22.9, 6.44 },
-    { 5, 17, 36.41, -6, 50, 39.8, 3.60 },
-    { 4, 34, 14.21, -6, 50, 16.1, 6.09 },
-    { 4, 11, 51.91, -6, 50, 15.0, 4.04 },
-    { 18, 43, 51.41, -6, 49, 7.0, 6.31 },
-    { 3, 29, 39.10, -6, 48, 18.0, 5.99 },
-    { 5, 42, 53.81, -6, 47, 46.0, 6.02 },
-    { 7, 46, 2.21, -6, 46, 21.0, 5.49 },
-    { 6, 11, 1.30, -6, 45, 15.1, 6.15 },
-    { 4, 33, 54.79, -6, 44, 20.0, 5.72 },
-    { 19, 55, 19.61, -6, 44, 3.1, 6.51 },
-    { 6, 4, 13.51, -6, 42, 33.1, 5.21 },
-    { 5, 31, 20.90, -6, 42, 29.9, 6.22 },
-    { 7, 17, 31.70, -6, 40, 48.0, 6.29 },
-    { 11, 43, 55.10, -6, 40, 37.9, 6.07 },
-    { 8, 38, 20.30, -6, 39, 45.0, 6.51 },
-    { 14, 16, 21.50, -6, 37, 18.8, 6.44 },
-    { 23, 2, 32.59, -6, 34, 27.1, 6.15 },
-    { 5, 38, 37.80, -6, 34, 26.0, 5.96 },
-    { 8, 48, 4.90, -6, 33, 31.0, 6.09 },
-    { 22, 31, 18.41, -6, 33, 18.0, 6.14 },
-    { 6, 11, 51.79, -6, 33, 1.1, 5.05 },
-    { 16, 38, 1.61, -6, 32, 17.2, 6.09 },
-    { 22, 3, 16.39, -6, 31, 21.0, 5.54 },
-    { 3, 2, 9.29, -6, 29, 40.9, 6.19 },
-    { 4, 17, 19.20, -6, 28, 18.8, 5.94 },
-    { 13, 30, 25.70, -6, 28, 13.1, 6.09 },
-    { 2, 16, 58.99, -6, 25, 19.9, 5.51 },
-    { 8, 27, 17.21, -6, 24, 34.9, 6.59 },
-    { 23, 48, 32.50, -6, 22, 50.2, 6.07 },
-    { 20, 20, 26.11, -6, 21, 42.1, 6.63 },
-    { 9, 16, 41.71, -6, 21, 11.2, 5.24 },
-    { 8, 2, 25.99, -6, 20, 13.9, 6.33 },
-    { 12, 47, 33.41, -6, 18, 6.8, 6.26 },
-    { 16, 5, 44.50, -6, 17, 30.1, 6.53 },
-    { 23, 31, 1.10, -6, 17, 17.9, 6.39 },
-    { 6, 14, 51.31, -6, 16, 28.9, 3.98 },
-    { 13, 31, 57.91, -6, 15, 20.9, 4.69 },
-    { 4, 20, 38.69, -6, 14, 44.2, 6.27 },
-    { 17, 16, 42.79, -6, 14, 42.0, 6.09 },
-    { 9, 51, 21.60, -6, 10, 54.1, 6.42 },
-    { 8, 22, 30.19, -6, 10, 45.1, 6.15 },
-    { 16, 54, 35.69, -6, 9, 14.0, 5.25 },
-    { 17, 52, 38.81, -6, 8, 37.0, 6.21 },
-    { 16, 5, 59.81, -6, 8, 21.8, 6.41 },
-    { 15, 46, 45.41, -6, 7, 13.1, 6.24 },
-    { 14, 27, 24.41, -6, 7, 13.1, 6.17 },
-    { 3, 6, 33.50, -6, 5, 19.0, 5.27 },
-    { 9, 27, 46.80, -6, 4, 16.0, 5.38 },
-    { 5, 36, 35.71, -6, 3, 54.0, 5.72 },
-    { 5, 12, 48.19, -6, 3, 25.9, 5.91 },
-    { 23, 14, 19.39, -6, 2, 56.0, 4.22 },
-    { 0, 1, 57.60, -6, 0, 51.1, 4.41 },
-    { 5, 35, .91, -6, 0, 33.1, 5.67 },
-    { 5, 35, 2.71, -6, 0, 6.8, 4.78 },
-    { 14, 16, .91, -6, 0, 2.2, 4.08 },
-    { 7, 22, 25.39, -5, 58, 58.1, 5.82 },
-    { 14, 14, 21.29, -5, 56, 51.0, 6.36 },
-    { 5, 37, 27.41, -5, 56, 17.9, 6.05 },
-    { 17, 29, 47.40, -5, 55, 10.9, 6.37 },
-    { 3, 16, .89, -5, 55, 7.0, 6.17 },
-    { 21, 47, 38.11, -5, 55, 1.9, 6.17 },
-    { 17, 19, 59.50, -5, 55, 1.9, 6.32 },
-    { 9, 34, 32.69, -5, 54, 54.0, 5.56 },
-    { 18, 49, 40.99, -5, 54, 46.1, 5.99 },
-    { 18, 33, 22.90, -5, 54, 41.0, 6.36 },
-    { 5, 35, 25.99, -5, 54, 36.0, 2.77 },
-    { 23, 20, 40.90, -5, 54, 29.2, 6.17 },
-    { 6, 32, 23.11, -5, 52, 8.0, 5.60 },
-    { 6, 54, 8.50, -5, 51, 9.0, 6.41 },
-    { 18, 57, 3.70, -5, 50, 46.0, 4.83 },
-    { 12, 36, 47.40, -5, 49, 54.8, 5.87 },
-    { 15, 21, 7.61, -5, 49, 28.9, 5.54 },
-    { 21, 4, 4.61, -5, 49, 23.9, 7.31 },
-    { 21, 4, 4.70, -5, 49, 23.2, 5.89 },
-    { 7, 25, 51.00, -5, 46, 30.0, 5.97 },
-    { 5, 0, 49.01, -5, 45, 11.9, 6.22 },
-    { 17, 33, 29.90, -5, 44, 40.9, 5.62 },
-    { 19, 1, 40.80, -5, 44, 20.0, 4.02 },
-    { 1, 45, 59.30, -5, 43, 59.9, 5.34 },
-    { 18, 30, 14.30, -5, 43, 27.1, 6.28 },
-    { 7, 1, 56.40, -5, 43, 19.9, 5.20 },
-    { 6, 9, 36.19, -5, 42, 40.0, 6.17 },
-    { 0, 5, 20.11, -5, 42, 27.0, 4.61 },
-    { 18, 47, 28.99, -5, 42, 18.0, 5.20 },
-    { 15, 34, 20.81, -5, 41, 42.0, 6.51 },
-    { 19, 4, 24.19, -5, 41, 6.0, 6.90 },
-    { 4, 48, 36.31, -5, 40, 26.0, 5.78 },
-    { 14, 43, 3.60, -5, 39, 29.9, 3.88 },
-    { 5, 36, 15.00, -5, 38, 53.2, 6.54 },
-    { 20, 51, 25.70, -5, 37, 35.0, 5.99 },
-    { 3, 39, 1.10, -5, 37, 34.0, 5.96 },
-    { 21, 31, 33.50, -5, 34, 16.0, 2.91 },
-    { 13, 9, 57.00, -5, 32, 20.0, 4.38 },
-    { 5, 26, 2.40, -5, 31, 5.9, 6.23 },
-    { 20, 52, 8.71, -5, 30, 24.8, 5.55 },
-    { 15, 14, 50.69, -5, 30, 10.1, 6.28 },
-    { 13, 43, 54.31, -5, 29, 56.0, 6.51 },
-    { 3, 58, 52.30, -5, 28, 12.0, 5.83 },
-    { 4, 52, 53.69, -5, 27, 10.1, 4.39 },
-    { 8, 54, 17.90, -5, 26, 3.8, 6.00 },
-    { 7, 52, 47.90, -5, 25, 41.2, 5.76 },
-    { 21, 58, 13.30, -5, 25, 28.9, 6.33 },
-    { 5, 35, 22.90, -5, 24, 58.0, 5.08 },
-    { 19, 20, 32.90, -5, 24, 56.9, 5.01 },
-    { 13, 35, 31.30, -5, 23, 46.0, 5.73 },
-    { 5, 35, 16.49, -5, 23, 22.9, 5.13 },
-    { 5, 35, 17.30, -5, 23, 16.1, 6.70 },
-    { 22, 17, 6.50, -5, 23, 13.9, 5.75 },
-    { 5, 35, 15.91, -5, 23, 13.9, 6.73 },
-    { 5, 35, 16.10, -5, 23, 7.1, 7.96 },
-    { 14, 4, 14.59, -5, 22, 53.0, 6.39 },
-    { 7, 0, 18.00, -5, 22, .8, 6.30 },
-    { 5, 20, 26.40, -5, 22, .1, 6.39 },
-    { 3, 52, 41.59, -5, 21, 41.0, 5.48 },
-    { 18, 2, 46.30, -5, 21, 31.0, 6.76 },
-    { 11, 51, 2.21, -5, 19, 59.9, 5.64 },
-    { 8, 20, 17.11, -5, 19, 45.1, 6.13 },
-    { 7, 4, 5.21, -5, 19, 25.0, 5.62 },
-    { 6, 52, 22.90, -5, 18, 58.0, 6.30 },
-    { 0, 10, 18.79, -5, 14, 55.0, 5.84 },
-    { 7, 30, 51.10, -5, 13, 35.0, 6.24 },
-    { 6, 36, 35.30, -5, 12, 40.0, 5.52 },
-    { 3, 40, 38.30, -5, 12, 38.2, 5.53 },
-    { 4, 56, 24.19, -5, 10, 17.0, 5.51 },
-    { 13, 24, 33.19, -5, 9, 50.0, 5.75 },
-    { 23, 19, 24.00, -5, 7, 27.8, 5.55 },
-    { 9, 25, 24.00, -5, 7, 3.0, 5.59 },
-    { 10, 19, 32.21, -5, 6, 20.9, 6.37 },
-    { 17, 26, 37.90, -5, 5, 12.1, 4.54 },
-    { 5, 7, 51.00, -5, 5, 11.0, 2.79 },
-    { 3, 30, 37.10, -5, 4, 31.1, 4.73 },
-    { 12, 31, 38.71, -5, 3, 9.0, 6.19 },
-    { 20, 47, 44.21, -5, 1, 40.1, 4.42 },
-    { 14, 58, 52.80, -4, 59, 21.1, 6.09 },
-    { 22, 55, 10.99, -4, 59, 16.1, 5.72 },
-    { 8, 37, 27.10, -4, 56, 1.0, 6.19 },
-    { 13, 23, 18.91, -4, 55, 27.8, 5.89 },
-    { 6, 15, 29.69, -4, 54, 55.1, 5.99 },
-    { 19, 25, 1.61, -4, 53, 3.1, 6.52 },
-    { 19, 6, 14.90, -4, 52, 57.0, 3.44 },
-    { 5, 35, 39.50, -4, 51, 20.9, 5.26 },
-    { 5, 35, 23.21, -4, 50, 17.9, 4.59 },
-    { 22, 24, 6.89, -4, 50, 12.8, 5.78 },
-    { 1, 3, 2.59, -4, 50, 12.1, 5.43 },
-    { 17, 59, 36.70, -4, 49, 17.0, 5.87 },
-    { 5, 37, 53.40, -4, 48, 49.0, 6.19 },
-    { 22, 57, 17.21, -4, 48, 36.0, 6.31 },
-    { 23, 3, 57.29, -4, 47, 43.1, 6.68 },
-    { 5, 55, 35.40, -4, 47, 17.9, 6.28 },
-    { 1, 43, 54.79, -4, 45, 56.2, 6.19 },
-    { 6, 27, 57.60, -4, 45, 43.9, 5.06 },
-    { 18, 6, 15.19, -4, 45, 5.0, 5.77 },
-    { 18, 47, 10.51, -4, 44, 52.1, 4.22 },
-    { 21, 0, 33.79, -4, 43, 49.1, 6.21 },
-    { 22, 12, 43.80, -4, 43, 14.9, 6.39 },
-    { 8, 24, 36.41, -4, 43, .8, 6.01 },
-    { 23, 1, 31.70, -4, 42, 41.0, 5.94 },
-    { 16, 18, 19.30, -4, 41, 33.0, 3.24 },
-    { 6, 23, 22.70, -4, 41, 13.9, 6.67 },
-    { 6, 11, 43.70, -4, 39, 56.2, 6.18 },
-    { 5, 6, 45.70, -4, 39, 18.0, 5.12 },
-    { 19, 37, 47.30, -4, 38, 51.0, 5.46 },
-    { 0, 45, 24.10, -4, 37, 45.1, 6.15 },
-    { 5, 55, 30.31, -4, 36, 59.0, 5.87 },
-    { 12, 27, 51.60, -4, 36, 55.1, 6.22 },
-    { 6, 26, 34.51, -4, 35, 49.9, 6.15 },
-    { 6, 14, 36.70, -4, 34, 5.9, 5.83 },
-    { 21, 21, 4.30, -4, 33, 36.0, 5.87 },
-    { 7, 26, 3.50, -4, 32, 15.0, 6.76 },
-    { 23, 29, 32.11, -4, 31, 58.1, 6.25 },
-    { 21, 18, 11.11, -4, 31, 9.8, 5.82 },
-    { 5, 35, 21.79, -4, 29, 35.9, 6.56 },
-    { 5, 8, 43.61, -4, 27, 22.0, 5.12 },
-    { 5, 35, 22.51, -4, 25, 31.1, 6.24 },
-    { 21, 58, 55.01, -4, 22, 23.2, 6.22 },
-    { 5, 35, 31.10, -4, 21, 52.9, 6.38 },
-    { 0, 40, 42.41, -4, 21, 6.8, 5.91 },
-    { 14, 57, 10.99, -4, 20, 47.0, 4.49 },
-    { 2, 19, 40.80, -4, 20, 44.2, 6.50 },
-    { 21, 54, 10.39, -4, 16, 34.0, 5.71 },
-    { 5, 46, 2.81, -4, 16, 5.9, 6.34 },
-    { 22, 10, 33.79, -4, 16, 1.9, 6.01 },
-    { 9, 29, 32.40, -4, 14, 49.9, 6.26 },
-    { 9, 51, 13.99, -4, 14, 35.9, 6.01 },
-    { 7, 2, 54.79, -4, 14, 21.1, 4.99 },
-    { 7, 10, 13.70, -4, 14, 13.9, 4.92 },
-    { 22, 37, 45.41, -4, 13, 41.2, 5.03 },
-    { 12, 53, 38.11, -4, 13, 26.0, 6.44 },
-    { 17, 1, 3.60, -4, 13, 21.0, 4.82 },
-    { 16, 12, 56.50, -4, 13, 14.9, 6.25 },
-    { 5, 2, 45.50, -4, 12, 34.9, 5.85 },
-    { 6, 6, 38.69, -4, 11, 38.0, 5.38 },
-    { 7, 37, 16.70, -4, 6, 40.0, 5.13 },
-    { 2, 3, 40.51, -4, 6, 13.0, 5.62 },
-    { 5, 48, 34.90, -4, 5, 40.9, 5.97 },
-    { 23, 31, 31.51, -4, 5, 13.9, 6.49 },
-    { 17, 56, 47.71, -4, 4, 54.8, 5.47 },
-    { 20, 6, 12.19, -4, 4, 41.9, 6.47 },
-    { 10, 23, 26.50, -4, 4, 27.1, 5.97 },
-    { 5, 54, 34.70, -4, 3, 50.0, 6.57 },
-    { 19, 4, 57.60, -4, 1, 53.0, 5.42 },
-    { 10, 49, 17.30, -4, 1, 27.1, 6.61 },
-    { 18, 13, 10.01, -4, 0, 42.1, 6.59 },
-    { 8, 26, 27.19, -3, 59, 15.0, 5.59 },
-    { 21, 35, 17.59, -3, 58, 59.2, 5.77 },
-    { 0, 30, 2.40, -3, 57, 25.9, 5.72 },
-    { 12, 18, 9.10, -3, 57, 15.8, 6.99 },
-    { 16, 16, 55.30, -3, 57, 11.9, 6.18 },
-    { 12, 18, 9.60, -3, 56, 55.0, 6.54 },
-    { 8, 25, 39.60, -3, 54, 23.0, 3.90 },
-    { 7, 14, 10.99, -3, 54, 5.0, 5.75 },
-    { 22, 10, 21.10, -3, 53, 39.1, 6.27 },
-    { 6, 25, 47.11, -3, 53, 21.1, 6.35 },
-    { 17, 8, 54.50, -3, 52, 58.1, 6.36 },
-    { 15, 48, 56.81, -3, 49, 7.0, 5.53 },
-    { 12, 59, 39.50, -3, 48, 42.8, 5.79 },
-    { 3, 11, 18.79, -3, 48, 42.1, 6.05 },
-    { 8, 24, 34.99, -3, 45, 4.0, 5.61 },
-    { 4, 23, 40.80, -3, 44, 44.2, 5.17 },
-    { 10, 28, 43.99, -3, 44, 33.0, 6.05 },
-    { 6, 13, 54.29, -3, 44, 29.0, 5.83 },
-    { 2, 56, 37.39, -3, 42, 43.9, 5.17 },
-    { 19, 2, 54.50, -3, 41, 56.0, 5.42 },
-    { 16, 14, 20.69, -3, 41, 39.8, 2.74 },
-    { 1, 42, 43.49, -3, 41, 25.1, 4.99 },
-    { 18, 0, 28.99, -3, 41, 25.1, 4.62 },
-    { 7, 59, 44.09, -3, 40, 46.9, 4.93 },
-    { 13, 3, 54.41, -3, 39, 47.9, 6.59 },
-    { 11, 16, 39.70, -3, 39, 6.1, 4.47 },
-    { 18, 15, 58.01, -3, 37, 3.0, 6.36 },
-    { 4, 36, 1.61, -3, 36, 42.8, 6.33 },
-    { 0, 35, 14.90, -3, 35, 34.1, 5.20 },
-    { 18, 24, 3.50, -3, 34, 59.9, 6.38 },
-    { 5, 39, 31.20, -3, 33, 52.9, 6.00 },
-    { 20, 56, 18.31, -3, 33, 41.0, 6.57 },
-    { 21, 25, 16.99, -3, 33, 24.1, 5.49 },
-    { 23, 58, 40.39, -3, 33, 22.0, 4.86 },
-    { 22, 40, 48.00, -3, 33, 15.1, 6.31 },
-    { 12, 53, 11.21, -3, 33, 11.2, 6.11 },
-    { 13, 59, 49.30, -3, 32, 58.9, 6.40 },
-    { 23, 15, 34.30, -3, 29, 47.0, 5.55 },
-    { 16, 9, 50.50, -3, 28, .8, 5.37 },
-    { 5, 29, 23.59, -3, 26, 47.0, 5.79 },
-    { 8, 49, 21.70, -3, 26, 35.2, 5.31 },
-    { 15, 49, 37.20, -3, 25, 49.1, 3.53 },
-    { 21, 24, 51.70, -3, 23, 53.9, 6.36 },
-    { 2, 37, 41.81, -3, 23, 46.0, 5.65 },
-    { 3, 39, 38.30, -3, 23, 35.2, 6.23 },
-    { 13, 0, 35.90, -3, 22, 7.0, 5.99 },
-    { 20, 28, 24.91, -3, 21, 28.1, 6.13 },
-    { 4, 36, 19.10, -3, 21, 9.0, 3.93 },
-    { 18, 51, 22.10, -3, 19, 4.1, 6.10 },
-    { 5, 28, 56.71, -3, 18, 27.0, 6.39 },
-    { 21, 54, 35.90, -3, 18, 4.0, 6.20 },
-    { 4, 45, 30.10, -3, 15, 16.9, 4.02 },
-    { 5, 35, 35.81, -3, 15, 10.1, 6.40 },
-    { 1, 20, 34.49, -3, 14, 48.8, 6.23 },
-    { 2, 41, 48.29, -3, 12, 47.9, 6.05 },
-    { 4, 32, 37.39, -3, 12, 33.1, 5.81 },
-    { 14, 16, 30.10, -3, 11, 47.0, 6.15 },
-    { 18, 38, 23.71, -3, 11, 37.0, 6.49 },
-    { 23, 52, 55.61, -3, 9, 20.2, 5.93 },
-    { 12, 5, 59.81, -3, 7, 54.1, 6.37 },
-    { 19, 53, 18.70, -3, 6, 51.8, 5.65 },
-    { 10, 51, 5.40, -3, 5, 33.0, 5.95 },
-    { 15, 51, 15.60, -3, 5, 26.2, 5.11 },
-    { 6, 0, 3.41, -3, 4, 27.1, 4.53 },
-    { 5, 4, 54.50, -3, 2, 22.9, 6.05 },
-    { 15, 2, 44.90, -3, 1, 53.0, 6.61 },
-    { 0, 1, 49.39, -3, 1, 39.0, 5.10 },
-    { 18, 16, 53.11, -3, 0, 25.9, 6.00 },
-    { 11, 30, 18.91, -3, 0, 13.0, 4.77 },
-    { 8, 8, 35.59, -2, 59, 2.0, 4.34 },
-    { 7, 22, 18.50, -2, 58, 44.0, 6.23 },
-    { 2, 19, 20.71, -2, 58, 39.0, 3.04 },
-    { 3, 54, 17.50, -2, 57, 16.9, 4.79 },
-    { 4, 46, 24.10, -2, 57, 15.8, 6.33 },
-    { 3, 54, 17.40, -2, 57, 10.1, 6.14 },
-    { 6, 19, 59.59, -2, 56, 39.8, 4.90 },
-    { 22, 31, 18.41, -2, 54, 40.0, 6.16 },
-    { 18, 21, 18.60, -2, 53, 56.0, 3.26 },
-    { 5, 41, 40.30, -2, 53, 46.0, 6.42 },
-    { 20, 29, 39.00, -2, 53, 8.2, 4.91 },
-    { 19, 45, 52.20, -2, 52, 59.9, 6.48 },
-    { 8, 0, 44.09, -2, 52, 54.1, 6.51 },
-    { 3, 0, 51.00, -2, 52, 43.0, 6.11 },
-    { 1, 24, 48.70, -2, 50, 55.0, 6.15 },
-    { 5, 40, 37.30, -2, 49, 30.0, 6.22 },
-    { 6, 54, 58.80, -2, 48, 13.0, 6.04 },
-    { 20, 25, 42.50, -2, 48, 1.1, 6.11 },
-    { 19, 30, 39.79, -2, 47, 20.0, 5.03 },
-    { 2, 58, 42.00, -2, 46, 57.0, 5.23 },
-    { 2, 24, 58.39, -2, 46, 48.0, 6.33 },
-    { 9, 29, 8.90, -2, 46, 8.0, 4.60 },
-    { 23, 47, 56.50, -2, 45, 42.1, 5.49 },
-    { 15, 1, 19.80, -2, 45, 18.0, 5.52 },
-    { 10, 29, 28.70, -2, 44, 21.1, 5.21 },
-    { 16, 50, 22.30, -2, 39, 14.0, 6.32 },
-    { 8, 45, 20.81, -2, 36, 2.9, 6.41 },
-    { 5, 38, 44.81, -2, 36, .0, 3.81 },
-    { 5, 38, 47.11, -2, 35, 39.1, 6.65 },
-    { 20, 36, 43.61, -2, 33, .0, 4.89 },
-    { 0, 7, 44.11, -2, 32, 56.0, 6.43 },
-    { 6, 38, 20.50, -2, 32, 37.0, 6.14 },
-    { 8, 28, 29.21, -2, 31, 1.9, 6.39 },
-    { 6, 12, 44.40, -2, 30, 15.8, 6.62 },
-    { 1, 16, 36.31, -2, 30, 1.1, 5.41 },
-    { 5, 11, 19.20, -2, 29, 26.9, 5.90 },
-    { 20, 47, 3.60, -2, 29, 12.1, 6.27 },
-    { 11, 1, 49.70, -2, 29, 4.9, 4.74 },
-    { 4, 37, 36.10, -2, 28, 23.9, 5.23 },
-    { 2, 59, 41.21, -2, 27, 54.0, 5.56 },
-    { 19, 51, 11.11, -2, 27, 38.9, 6.13 },
-    { 0, 8, 12.10, -2, 26, 52.1, 6.07 },
-    { 11, 38, 24.10, -2, 26, 10.0, 6.22 },
-    { 15, 20, 47.09, -2, 24, 47.9, 6.35 },
-    { 20, 39, 13.20, -2, 24, 46.1, 6.22 },
-    { 5, 24, 28.61, -2, 23, 48.8, 3.36 },
-    { 22, 58, 15.50, -2, 23, 43.1, 6.16 },
-    { 2, 12, 47.50, -2, 23, 37.0, 5.54 },
-    { 17, 22, 51.29, -2, 23, 17.9, 6.29 },
-    { 16, 36, 21.50, -2, 19, 28.9, 5.75 },
-    { 14, 51, 1.01, -2, 17, 57.1, 4.94 },
-    { 6, 49, 16.39, -2, 16, 18.8, 5.74 },
-    { 14, 19, 32.50, -2, 15, 56.2, 5.14 },
-    { 10, 53, 24.89, -2, 15, 19.1, 6.12 },
-    { 5, 10, 58.01, -2, 15, 14.0, 6.25 },
-    { 1, 11, 43.49, -2, 15, 4.0, 5.94 },
-    { 14, 28, 12.10, -2, 13, 41.2, 4.81 },
-    { 0, 24, 29.71, -2, 13, 9.1, 6.07 },
-    { 4, 58, 10.80, -2, 12, 45.0, 6.35 },
-    { 9, 29, 24.50, -2, 12, 19.1, 6.14 },
-    { 22, 3, 18.89, -2, 9, 19.1, 4.69 },
-    { 17, 40, 11.81, -2, 9, 9.0, 6.19 },
-    { 8, 34, 1.61, -2, 9, 6.1, 5.81 },
-    { 10, 53, 43.70, -2, 7, 45.1, 5.45 },
-    { 16, 22, 38.90, -2, 4, 46.9, 6.23 },
-    { 5, 0, 39.79, -2, 3, 56.2, 6.32 },
-    { 8, 46, 2.50, -2, 2, 56.0, 5.70 },
-    { 18, 29, 40.99, -1, 59, 7.1, 5.39 },
-    { 10, 48, 40.61, -1, 57, 32.0, 5.93 },
-    { 5, 40, 45.60, -1, 56, 34.1, 4.21 },
-    { 5, 40, 45.50, -1, 56, 34.1, 2.05 },
-    { 7, 29, 18.70, -1, 54, 19.1, 5.59 },
-    { 8, 47, 15.00, -1, 53, 49.9, 5.29 },
-    { 2, 11, 35.81, -1, 49, 31.1, 5.93 },
-    { 15, 46, 5.59, -1, 48, 15.8, 5.40 },
-    { 18, 56, 22.70, -1, 48, .0, 6.22 },
-    { 12, 1, 1.80, -1, 46, 5.2, 6.31 },
-    { 6, 54, 42.10, -1, 45, 23.0, 6.21 },
-    { 10, 41, 24.19, -1, 44, 30.1, 6.26 },
-    { 5, 33, 7.20, -1, 43, 5.9, 6.46 },
-    { 11, 27, 53.71, -1, 42, .0, 6.25 },
-    { 17, 6, 52.90, -1, 39, 23.0, 6.38 },
-    { 17, 25, 57.89, -1, 39, 6.1, 6.44 },
-    { 5, 43, 9.29, -1, 36, 47.2, 6.31 },
-    { 16, 54, 10.61, -1, 36, 43.9, 6.25 },
-    { 21, 16, 39.60, -1, 36, 28.1, 6.48 },
-    { 8, 21, 20.21, -1, 36, 7.9, 6.50 },
-    { 22, 16, 33.60, -1, 35, 47.0, 6.15 },
-    { 5, 32, 41.30, -1, 35, 30.8, 5.35 },
-    { 18, 24, 57.00, -1, 34, 45.8, 6.15 },
-    { 12, 43, 38.11, -1, 34, 36.8, 5.93 },
-    { 22, 34, 2.90, -1, 34, 27.1, 5.89 },
-    { 4, 1, 31.99, -1, 32, 58.9, 5.28 },
-    { 19, 5, 18.60, -1, 30, 46.1, 6.53 },
-    { 6, 26, 39.60, -1, 30, 25.9, 5.87 },
-    { 13, 54, 42.10, -1, 30, 11.2, 5.15 },
-    { 5, 34, 4.01, -1, 28, 14.2, 5.93 },
-    { 9, 26, 22.30, -1, 27, 50.0, 6.01 },
-    { 12, 41, 39.60, -1, 26, 57.8, 3.68 },
-    { 12, 41, 39.60, -1, 26, 57.8, 3.65 },
-    { 5, 59, 37.70, -1, 26, 39.8, 6.63 },
-    { 14, 45, 11.71, -1, 25, 4.1, 6.07 },
-    { 5, 19, 35.21, -1, 24, 43.9, 6.34 },
-    { 22, 58, 23.71, -1, 24, 37.1, 6.37 },
-    { 5, 15, 18.41, -1, 24, 33.1, 6.15 },
-    { 8, 1, 13.30, -1, 23, 33.0, 4.68 },
-    { 13, 16, 25.49, -1, 23, 26.2, 6.68 },
-    { 22, 21, 39.41, -1, 23, 13.9, 3.84 },
-    { 20, 55, 8.11, -1, 22, 23.9, 6.55 },
-    { 13, 29, 14.90, -1, 21, 51.8, 6.43 },
-    { 7, 1, 52.90, -1, 20, 44.2, 6.17 },
-    { 6, 48, 19.01, -1, 19, 9.1, 5.75 },
-    { 19, 36, 43.30, -1, 17, 11.0, 4.36 },
-    { 9, 29, 2.21, -1, 15, 24.8, 6.27 },
-    { 23, 34, 9.00, -1, 14, 51.0, 5.87 },
-    { 17, 51, 59.50, -1, 14, 12.1, 6.35 },
-    { 6, 33, 37.90, -1, 13, 13.1, 5.10 },
-    { 5, 36, 12.79, -1, 12, 6.8, 1.70 },
-    { 3, 12, 46.39, -1, 11, 46.0, 5.06 },
-    { 13, 26, 11.40, -1, 11, 33.0, 5.97 },
-    { 15, 32, 57.91, -1, 11, 11.0, 5.51 },
-    { 9, 31, 58.90, -1, 11, 6.0, 4.57 },
-    { 3, 44, 30.50, -1, 9, 47.2, 5.25 },
-    { 5, 33, 31.39, -1, 9, 22.0, 5.34 },
-    { 4, 13, 38.21, -1, 8, 58.9, 6.44 },
-    { 0, 53, .50, -1, 8, 39.1, 4.77 },
-    { 9, 39, 51.41, -1, 8, 34.1, 3.91 },
-    { 5, 40, 50.59, -1, 7, 44.0, 4.95 },
-    { 6, 54, 24.60, -1, 7, 36.8, 5.45 },
-    { 3, 39, 59.50, -1, 7, 14.2, 6.12 },
-    { 18, 38, 19.10, -1, 6, 47.9, 6.66 },
-    { 20, 38, 20.30, -1, 6, 19.1, 4.32 },
-    { 5, 29, 43.99, -1, 5, 31.9, 4.71 },
-    { 23, 31, 57.60, -1, 5, 8.9, 6.38 },
-    { 17, 8, 13.61, -1, 4, 45.8, 6.06 },
-    { 20, 19, 43.30, -1, 4, 43.0, 6.06 },
-    { 4, 57, 17.21, -1, 4, 1.9, 6.23 },
-    { 17, 30, 23.81, -1, 3, 45.0, 5.31 },
-    { 4, 39, 47.21, -1, 3, 10.1, 6.10 },
-    { 5, 34, 3.91, -1, 2, 8.2, 6.22 },
-    { 2, 32, 9.41, -1, 2, 6.0, 5.35 },
-    { 15, 23, 43.70, -1, 1, 21.0, 6.12 },
-    { 20, 13, 13.90, -1, 0, 33.8, 5.47 },
-    { 18, 31, 57.00, -1, 0, 11.2, 5.94 },
-    { 16, 41, 11.50, -1, 0, 2.2, 6.24 },
-    { 5, 58, 11.71, -0, 59, 39.1, 6.22 },
-    { 1, 14, 49.20, -0, 58, 26.0, 5.70 },
-    { 18, 46, 28.49, -0, 57, 42.1, 5.90 },
-    { 6, 25, 16.39, -0, 56, 46.0, 5.87 },
-    { 3, 18, 22.39, -0, 55, 49.1, 5.38 },
-    { 21, 2, 59.59, -0, 55, 28.9, 6.50 },
-    { 8, 20, 13.10, -0, 54, 33.8, 6.18 },
-    { 22, 4, 47.40, -0, 54, 24.1, 5.30 },
-    { 19, 20, 35.69, -0, 53, 31.9, 5.49 },
-    { 17, 5, 32.30, -0, 53, 30.8, 5.64 },
-    { 5, 24, 28.90, -0, 53, 29.0, 5.08 },
-    { 2, 22, 12.41, -0, 53, 6.0, 5.42 },
-    { 5, 23, 51.41, -0, 52, 1.9, 6.11 },
-    { 14, 48, 54.10, -0, 50, 52.1, 6.14 },
-    { 14, 13, 40.80, -0, 50, 44.2, 5.91 },
-    { 11, 36, 56.90, -0, 49, 26.0, 4.30 },
-    { 20, 11, 18.31, -0, 49, 17.0, 3.23 },
-    { 12, 18, 40.30, -0, 47, 13.9, 5.90 },
-    { 11, 3, 14.59, -0, 45, 9.0, 6.14 },
-    { 20, 4, 23.21, -0, 42, 33.8, 5.68 },
-    { 2, 41, 13.90, -0, 41, 44.9, 5.71 },
-    { 20, 8, 1.80, -0, 40, 41.9, 5.99 },
-    { 13, 17, 29.90, -0, 40, 36.1, 6.37 },
-    { 12, 19, 54.41, -0, 40, .8, 3.89 },
-    { 10, 30, 17.50, -0, 38, 12.8, 5.09 },
-    { 19, 40, 43.30, -0, 37, 16.0, 5.67 },
-    { 13, 34, 41.59, -0, 35, 44.9, 3.37 },
-    { 8, 5, 49.61, -0, 34, 25.0, 6.41 },
-    { 5, 10, 3.19, -0, 33, 55.1, 6.10 },
-    { 15, 36, 33.70, -0, 33, 42.1, 6.51 },
-    { 5, 25, 31.20, -0, 32, 39.1, 6.57 },
-    { 6, 50, 49.90, -0, 32, 26.9, 5.77 },
-    { 6, 15, 34.30, -0, 30, 43.9, 5.65 },
-    { 1, 19, 48.31, -0, 30, 32.0, 5.87 },
-    { 0, 35, 32.81, -0, 30, 20.2, 5.93 },
-    { 0, 5, 3.79, -0, 30, 11.2, 6.29 },
-    { 7, 11, 51.89, -0, 29, 34.1, 4.15 },
-    { 9, 1, 58.01, -0, 28, 58.1, 5.67 },
-    { 15, 18, 26.21, -0, 27, 41.0, 5.89 },
-    { 1, 22, 34.80, -0, 26, 58.9, 6.49 },
-    { 18, 6, 7.39, -0, 26, 48.1, 6.34 },
-    { 17, 16, 36.70, -0, 26, 43.1, 4.73 },
-    { 19, 9, 51.60, -0, 25, 41.2, 6.34 },
-    { 5, 21, 31.80, -0, 24, 59.0, 5.68 },
-    { 1, 26, 27.31, -0, 23, 55.0, 6.41 },
-    { 21, 37, 33.79, -0, 23, 25.1, 6.25 },
-    { 5, 21, 45.70, -0, 22, 57.0, 4.73 },
-    { 10, 7, 56.30, -0, 22, 18.1, 4.49 },
-    { 2, 3, 48.19, -0, 20, 25.1, 5.93 },
-    { 22, 5, 46.99, -0, 19, 10.9, 2.96 },
-    { 11, 49, 1.20, -0, 19, 7.0, 6.15 },
-    { 18, 37, 36.00, -0, 18, 33.8, 5.75 },
-    { 7, 11, 23.59, -0, 18, 6.8, 5.45 },
-    { 5, 32, .41, -0, 17, 57.1, 2.23 },
-    { 3, 44, 56.50, -0, 17, 48.1, 5.55 },
-    { 5, 32, .50, -0, 17, 3.8, 6.85 },
-    { 6, 27, 15.60, -0, 16, 34.0, 5.55 },
-    { 4, 2, 36.70, -0, 16, 8.0, 5.38 },
-    { 14, 51, .10, -0, 15, 25.9, 6.18 },
-    { 19, 22, 21.50, -0, 15, 9.0, 5.83 },
-    { 22, 18, 4.30, -0, 14, 16.1, 6.39 },
-    { 10, 52, 36.10, -0, 12, 5.0, 6.31 },
-    { 14, 57, 33.29, -0, 10, 3.0, 5.53 },
-    { 7, 15, 19.30, -0, 9, 41.0, 6.41 },
-    { 5, 23, 42.29, -0, 9, 34.9, 5.70 },
-    { 15, 1, 48.91, -0, 8, 26.2, 5.71 },
-    { 22, 35, 21.41, -0, 7, 3.0, 4.02 },
-    { 4, 21, 27.10, -0, 5, 53.2, 5.86 },
-    { 11, 13, 45.60, -0, 4, 10.9, 5.42 },
-    { 0, 26, 37.39, -0, 2, 58.9, 6.19 },
-    { 4, 31, 52.70, -0, 2, 38.0, 4.91 },
-    { 22, 28, 49.70, -0, 1, 13.1, 4.59 },
-    { 22, 28, 50.09, -0, 1, 12.0, 4.42 },
-    { 11, 3, 36.60, -0, 0, 2.9, 5.95 },
-    { 2, 6, 29.30, +0, 2, 6.0, 6.28 },
-    { 17, 57, 4.30, +0, 3, 59.0, 5.97 },
-    { 9, 52, 12.00, +0, 4, 32.2, 6.35 },
-    { 21, 14, 37.01, +0, 5, 31.9, 6.38 },
-    { 20, 37, 18.31, +0, 5, 48.8, 6.22 },
-    { 23, 54, 46.61, +0, 6, 33.1, 5.61 },
-    { 2, 3, 11.69, +0, 7, 41.9, 5.43 },
-    { 11, 23, 18.00, +0, 7, 54.1, 6.05 },
-    { 7, 22, 3.50, +0, 10, 37.9, 5.99 },
-    { 23, 0, 37.90, +0, 11, 8.9, 6.21 },
-    { 7, 43, 5.40, +0, 11, 21.8, 6.19 },
-    { 18, 27, 12.50, +0, 11, 46.0, 5.21 },
-    { 3, 48, 38.90, +0, 13, 40.1, 5.91 },
-    { 19, 29, 18.00, +0, 14, 46.0, 6.25 },
-    { 2, 30, 45.19, +0, 15, 19.1, 6.00 },
-    { 19, 54, 44.81, +0, 16, 25.0, 5.61 },
-    { 23, 23, 31.90, +0, 17, 29.0, 6.31 },
-    { 6, 27, 13.80, +0, 17, 57.1, 5.20 },
-    { 2, 39, 28.99, +0, 19, 43.0, 4.07 },
-    { 17, 28, 49.70, +0, 19, 50.2, 5.44 },
-    { 5, 41, 5.59, +0, 20, 16.1, 5.93 },
-    { 19, 26, 31.10, +0, 20, 19.0, 4.66 },
-    { 19, 18, 50.90, +0, 20, 21.1, 6.41 },
-    { 17, 12, 54.41, +0, 21, 6.8, 6.65 },
-    { 15, 15, 49.10, +0, 22, 19.9, 5.63 },
-    { 14, 19, 40.90, +0, 23, 3.1, 6.19 },
-    { 2, 21, 56.59, +0, 23, 44.9, 5.28 },
-    { 3, 36, 52.39, +0, 24, 6.1, 4.28 },
-    { 20, 57, 10.61, +0, 27, 49.0, 6.05 },
-    { 4, 54, 50.71, +0, 28, 3.0, 5.99 },
-    { 20, 39, 24.91, +0, 29, 11.0, 5.16 },
-    { 6, 41, 5.40, +0, 29, 43.1, 5.79 },
-    { 5, 11, 41.40, +0, 30, 52.9, 6.67 },
-    { 5, 25, 46.99, +0, 31, 14.9, 6.16 },
-    { 11, 59, 3.41, +0, 31, 50.2, 6.17 },
-    { 21, 25, 51.50, +0, 32, 3.8, 6.46 },
-    { 11, 53, 50.30, +0, 33, 6.8, 6.30 },
-    { 5, 58, 49.61, +0, 33, 11.2, 5.22 },
-    { 5, 13, 47.21, +0, 33, 37.1, 6.32 },
-    { 3, 36, 47.30, +0, 35, 16.1, 5.71 },
-    { 22, 1, 4.99, +0, 36, 18.0, 5.58 },
-    { 18, 0, 15.50, +0, 37, 45.8, 6.37 },
-    { 19, 7, 9.10, +0, 38, 30.1, 6.56 },
-    { 16, 28, 34.01, +0, 39, 54.0, 5.39 },
-    { 17, 56, 18.41, +0, 40, 13.1, 5.82 },
-    { 17, 5, 16.90, +0, 42, 9.0, 6.01 },
-    { 15, 21, 1.99, +0, 42, 55.1, 5.35 },
-    { 14, 45, 30.19, +0, 43, 1.9, 5.69 },
-    { 5, 1, 50.30, +0, 43, 19.9, 5.92 },
-    { 10, 55, 42.41, +0, 44, 12.8, 5.91 },
-    { 14, 29, 50.50, +0, 49, 44.0, 5.94 },
-    { 18, 49, 37.10, +0, 50, 8.9, 6.25 },
-    { 6, 26, 58.70, +0, 50, 26.9, 6.71 },
-    { 20, 12, 35.21, +0, 52, 3.0, 6.27 },
-    { 6, 35, 15.79, +0, 53, 24.0, 5.80 },
-    { 15, 45, 39.70, +0, 53, 29.0, 6.33 },
-    { 22, 59, 27.41, +0, 57, 46.1, 5.43 },
-    { 5, 54, 44.09, +0, 58, 5.9, 6.00 },
-    { 4, 37, 13.70, +0, 59, 53.9, 5.31 },
-    { 6, 49, 3.70, +1, 0, 6.8, 6.15 },
-    { 19, 52, 28.39, +1, 0, 20.2, 3.90 },
-    { 18, 17, 4.80, +1, 0, 20.9, 6.63 },
-    { 16, 45, 29.69, +1, 1, 13.1, 6.03 },
-    { 10, 52, 13.70, +1, 1, 31.1, 6.38 },
-    { 16, 22, 4.39, +1, 1, 45.1, 4.82 },
-    { 5, 11, 45.31, +1, 2, 12.8, 5.89 },
-    { 13, 56, 27.91, +1, 3, 2.2, 5.91 },
-    { 22, 54, 59.50, +1, 3, 52.9, 6.11 },
-    { 20, 24, 37.49, +1, 4, 7.0, 6.15 },
-    { 23, 49, 27.50, +1, 4, 34.0, 5.77 },
-    { 6, 16, 21.19, +1, 4, 49.1, 6.63 },
-    { 19, 18, 32.50, +1, 5, 7.1, 5.10 },
-    { 21, 26, 28.10, +1, 6, 11.9, 6.13 },
-    { 23, 27, 14.81, +1, 7, 21.0, 6.25 },
-    { 7, 57, 16.20, +1, 7, 36.8, 6.35 },
-    { 5, 46, 34.99, +1, 10, 5.2, 5.95 },
-    { 6, 15, 54.00, +1, 10, 9.1, 6.37 },
-    { 5, 5, 23.69, +1, 10, 39.0, 6.17 },
-    { 16, 41, 42.50, +1, 10, 52.0, 5.74 },
-    { 17, 16, 31.70, +1, 12, 38.2, 5.88 },
-    { 16, 51, 24.89, +1, 12, 58.0, 5.51 },
-    { 5, 57, 54.19, +1, 13, 27.8, 6.22 },
-    { 14, 23, 15.31, +1, 14, 30.1, 6.27 },
-    { 23, 26, 55.99, +1, 15, 20.2, 4.94 },
-    { 21, 42, 10.10, +1, 17, 7.1, 5.67 },
-    { 5, 28, 1.61, +1, 17, 53.9, 6.41 },
-    { 17, 52, 35.40, +1, 18, 18.0, 5.95 },
-    { 18, 1, 45.19, +1, 18, 19.1, 4.45 },
-    { 23, 5, 17.59, +1, 18, 24.8, 6.39 },
-    { 14, 11, 31.20, +1, 21, 43.9, 6.43 },
-    { 1, 3, 49.01, +1, 22, .1, 6.04 },
-    { 22, 25, 16.61, +1, 22, 39.0, 4.66 },
-    { 19, 59, 22.70, +1, 22, 40.1, 6.17 },
-    { 4, 28, 32.11, +1, 22, 50.9, 5.55 },
-    { 5, 33, 57.60, +1, 24, 28.1, 6.59 },
-    { 11, 24, 2.30, +1, 24, 28.1, 5.39 },
-    { 9, 6, 59.90, +1, 27, 46.1, 6.17 },
-    { 5, 42, 28.61, +1, 28, 28.9, 4.91 },
-    { 7, 4, 20.21, +1, 29, 17.9, 6.57 },
-    { 6, 25, 18.41, +1, 30, 4.0, 6.66 },
-    { 21, 3, 3.00, +1, 31, 54.8, 6.25 },
-    { 8, 58, 8.21, +1, 32, 30.1, 6.59 },
-    { 14, 1, 38.81, +1, 32, 39.8, 4.26 },
-    { 4, 53, 55.80, +1, 34, 9.8, 6.61 },
-    { 5, 2, .00, +1, 36, 32.0, 6.24 },
-    { 6, 38, 38.11, +1, 36, 49.0, 6.21 },
-    { 11, 18, 55.01, +1, 39, 2.2, 5.91 },
-    { 15, 35, 4.61, +1, 40, 8.0, 6.56 },
-    { 0, 17, 47.71, +1, 41, 20.0, 6.17 },
-    { 6, 2, 17.11, +1, 41, 39.8, 6.59 },
-    { 4, 58, 32.90, +1, 42, 51.1, 4.47 },
-    { 1, 22, 37.01, +1, 43, 35.0, 6.20 },
-    { 2, 18, 1.39, +1, 45, 28.1, 5.58 },
-    { 11, 50, 41.71, +1, 45, 52.9, 3.61 },
-    { 15, 19, 18.79, +1, 45, 55.1, 5.06 },
-    { 7, 51, 42.00, +1, 46, .8, 5.14 },
-    { 23, 42, 2.81, +1, 46, 48.0, 4.50 },
-    { 9, 46, 23.59, +1, 47, 8.2, 5.65 },
-    { 5, 29, 54.79, +1, 47, 21.1, 5.78 },
-    { 19, 3, 32.21, +1, 49, 8.0, 5.83 },
-    { 5, 58, 24.41, +1, 50, 12.8, 5.90 },
-    { 15, 28, 38.21, +1, 50, 31.9, 5.17 },
-    { 5, 24, 44.81, +1, 50, 47.0, 4.95 },
-    { 1, 55, 53.81, +1, 50, 58.9, 6.01 },
-    { 12, 38, 22.39, +1, 51, 16.9, 5.71 },
-    { 5, 52, 26.40, +1, 51, 18.0, 4.78 },
-    { 4, 28, 3.60, +1, 51, 31.0, 6.15 },
-    { 3, 4, 38.09, +1, 51, 49.0, 6.05 },
-    { 9, 32, 41.40, +1, 51, 51.1, 6.11 },
-    { 14, 46, 14.90, +1, 53, 34.1, 3.72 },
-    { 12, 9, 41.30, +1, 53, 52.1, 5.95 },
-    { 6, 28, 16.80, +1, 54, 43.9, 6.48 },
-    { 7, 32, 5.90, +1, 54, 51.8, 5.25 },
-    { 18, 4, 37.30, +1, 55, 9.1, 6.14 },
-    { 0, 25, 24.19, +1, 56, 22.9, 5.77 },
-    { 5, 16, 41.09, +1, 56, 49.9, 6.42 },
-    { 19, 29, 1.01, +1, 57, 1.1, 5.80 },
-    { 11, 6, 54.19, +1, 57, 20.2, 5.52 },
-    { 2, 28, .00, +1, 57, 38.9, 6.45 },
-    { 17, 49, 18.89, +1, 57, 40.0, 6.47 },
-    { 5, 13, 31.61, +1, 58, 5.2, 6.09 },
-    { 16, 30, 54.79, +1, 59, 2.0, 3.82 },
-    { 11, 17, 17.40, +2, 0, 38.2, 5.18 },
-    { 5, 50, 30.00, +2, 1, 27.8, 5.98 },
-    { 17, 39, 8.50, +2, 1, 41.2, 6.26 },
-    { 19, 17, 48.19, +2, 1, 54.1, 6.19 },
-    { 18, 44, 49.90, +2, 3, 36.0, 5.02 },
-    { 16, 47, 9.79, +2, 3, 51.8, 6.10 },
-    { 4, 27, .70, +2, 4, 45.8, 6.23 },
-    { 13, 21, 41.59, +2, 5, 13.9, 5.69 },
-    { 23, 53, 4.80, +2, 5, 26.2, 6.28 },
-    { 15, 2, 54.00, +2, 5, 29.0, 4.40 },
-    { 8, 25, 35.50, +2, 6, 7.9, 5.73 },
-    { 23, 36, 23.30, +2, 6, 7.9, 5.68 },
-    { 23, 8, 40.90, +2, 7, 40.1, 5.40 },
-    { 17, 16, 14.21, +2, 11, 10.0, 6.17 },
-    { 15, 50, 17.50, +2, 11, 47.0, 5.23 },
-    { 23, 48, 49.30, +2, 12, 51.1, 6.46 },
-    { 7, 58, 20.59, +2, 13, 28.9, 5.29 },
-    { 21, 39, 33.31, +2, 14, 37.0, 5.10 },
-    { 2, 31, 30.10, +2, 16, 1.9, 5.25 },
-    { 6, 21, 25.80, +2, 16, 7.0, 6.31 },
-    { 21, 4, 45.41, +2, 16, 10.9, 6.33 },
-    { 6, 25, 46.61, +2, 16, 19.9, 6.51 },
-    { 10, 21, 1.99, +2, 17, 22.9, 6.66 },
-    { 19, 13, 42.70, +2, 17, 37.0, 5.15 },
-    { 14, 4, 37.49, +2, 17, 51.0, 6.28 },
-    { 9, 14, 21.89, +2, 18, 51.1, 3.88 },
-    { 8, 2, 15.91, +2, 20, 3.8, 4.39 },
-    { 16, 26, 50.11, +2, 20, 51.0, 6.07 },
-    { 5, 24, 36.19, +2, 21, 10.1, 6.32 },
-    { 10, 24, 13.10, +2, 22, 5.2, 6.32 },
-    { 18, 16, 5.59, +2, 22, 40.1, 6.01 },
-    { 7, 44, 7.39, +2, 24, 18.0, 6.47 },
-    { 14, 12, 15.79, +2, 24, 33.8, 5.01 },
-    { 6, 47, 51.60, +2, 24, 43.9, 4.47 },
-    { 4, 54, 15.10, +2, 26, 26.2, 3.72 },
-    { 1, 10, 33.60, +2, 26, 44.2, 5.95 },
-    { 9, 52, 12.19, +2, 27, 15.1, 6.02 },
-    { 18, 56, 25.61, +2, 28, 16.0, 6.15 },
-    { 10, 45, 9.41, +2, 29, 17.2, 6.28 },
-    { 6, 8, 57.89, +2, 29, 57.8, 5.73 },
-    { 18, 5, 27.29, +2, 29, 57.8, 4.03 },
-    { 4, 53, 22.80, +2, 30, 29.2, 5.33 },
-    { 15, 44, 1.80, +2, 30, 54.0, 5.88 },
-    { 18, 57, 16.61, +2, 32, 7.1, 5.57 },
-    { 17, 44, 35.40, +2, 34, 44.0, 6.56 },
-    { 17, 44, 34.01, +2, 34, 45.8, 6.17 },
-    { 5, 19, 11.21, +2, 35, 44.9, 5.34 },
-    { 6, 29, 14.90, +2, 38, 46.0, 6.16 },
-    { 21, 47, 13.99, +2, 41, 10.0, 5.64 },
-    { 6, 37, 40.30, +2, 42, 15.1, 6.17 },
-    { 17, 47, 53.59, +2, 42, 25.9, 3.75 },
-    { 17, 31, 21.29, +2, 43, 27.8, 5.59 },
-    { 7, 34, 46.01, +2, 43, 30.0, 6.55 },
-    { 7, 19, 22.39, +2, 44, 26.2, 5.89 },
-    { 8, 35, 24.89, +2, 44, 37.0, 6.33 },
-    { 2, 2, 2.81, +2, 45, 49.0, 5.23 },
-    { 2, 2, 2.81, +2, 45, 49.0, 4.33 },
-    { 4, 4, 9.89, +2, 49, 36.8, 5.36 },
-    { 11, 27, 56.21, +2, 51, 22.0, 4.95 },
-    { 5, 13, 17.50, +2, 51, 40.0, 4.46 },
-    { 19, 30, 10.51, +2, 54, 15.1, 6.09 },
-    { 6, 27, 20.40, +2, 54, 29.2, 5.55 },
-    { 19, 35, 25.20, +2, 54, 47.9, 6.38 },
-    { 19, 28, 20.81, +2, 55, 49.1, 5.85 },
-    { 23, 51, 57.89, +2, 55, 49.1, 5.55 },
-    { 18, 0, 38.71, +2, 55, 54.1, 3.97 },
-    { 20, 28, 16.80, +2, 56, 12.8, 6.21 },
-    { 13, 20, 41.59, +2, 56, 30.1, 6.26 },
-    { 21, 4, 41.69, +2, 56, 30.8, 6.42 },
-    { 21, 9, 58.30, +2, 56, 35.9, 6.45 },
-    { 23, 0, 42.89, +3, 0, 42.1, 5.83 },
-    { 11, 26, 45.31, +3, 0, 47.2, 6.50 },
-    { 6, 43, 6.50, +3, 1, 59.9, 6.19 },
-    { 6, 51, 39.29, +3, 2, 30.1, 6.38 },
-    { 12, 51, 36.89, +3, 3, 24.1, 6.02 },
-    { 3, 39, 51.10, +3, 3, 24.8, 5.57 },
-    { 11, 34, 22.01, +3, 3, 36.0, 5.77 },
-    { 5, 26, 50.21, +3, 5, 44.2, 4.59 },
-    { 2, 0, 9.19, +3, 5, 49.9, 5.88 },
-    { 7, 14, 19.99, +3, 6, 41.0, 5.35 },
-    { 19, 25, 29.90, +3, 6, 52.9, 3.36 },
-    { 18, 9, 54.00, +3, 7, 10.9, 5.69 },
-    { 0, 37, 30.50, +3, 8, 7.1, 6.39 },
-    { 1, 53, 33.31, +3, 11, 15.0, 4.62 },
-    { 10, 4, 8.40, +3, 12, 4.0, 6.45 },
-    { 5, 54, 15.70, +3, 13, 31.1, 6.31 },
-    { 2, 43, 18.00, +3, 14, 8.9, 3.47 },
-    { 7, 52, 7.20, +3, 16, 37.9, 6.31 },
-    { 7, 50, 47.40, +3, 16, 37.9, 6.18 },
-    { 23, 17, 9.91, +3, 16, 55.9, 3.69 },
-    { 12, 38, 4.39, +3, 16, 57.0, 6.33 },
-    { 7, 33, 11.59, +3, 17, 25.1, 5.59 },
-    { 5, 31, 14.50, +3, 17, 31.9, 5.46 },
-    { 20, 47, 47.81, +3, 18, 24.1, 6.40 },
-    { 12, 20, 21.00, +3, 18, 45.0, 4.96 },
-    { 18, 10, 40.30, +3, 19, 27.1, 5.51 },
-    { 19, 4, 10.70, +3, 19, 50.2, 6.73 },
-    { 14, 14, 52.99, +3, 20, 10.0, 6.45 },
-    { 8, 38, 45.41, +3, 20, 29.0, 4.44 },
-    { 3, 19, 21.70, +3, 22, 13.1, 4.83 },
-    { 7, 34, 15.79, +3, 22, 17.0, 5.81 },
-    { 18, 20, 52.10, +3, 22, 37.9, 4.86 },
-    { 19, 38, 49.01, +3, 22, 54.1, 6.35 },
-    { 9, 59, 43.10, +3, 23, 4.9, 6.70 },
-    { 0, 51, 18.31, +3, 23, 6.0, 6.37 },
-    { 12, 55, 36.19, +3, 23, 51.0, 3.38 },
-    { 8, 43, 13.49, +3, 23, 55.0, 4.30 },
-    { 2, 38, 36.91, +3, 26, 35.2, 6.21 },
-    { 19, 30, 33.10, +3, 26, 39.8, 6.05 },
-    { 16, 8, 58.90, +3, 27, 15.8, 5.91 },
-    { 23, 46, 23.50, +3, 29, 12.1, 5.04 },
-    { 1, 26, 53.50, +3, 32, 7.1, 6.58 },
-    { 13, 43, 3.70, +3, 32, 17.2, 5.36 },
-    { 5, 22, 49.99, +3, 32, 39.8, 5.00 },
-    { 12, 47, 51.41, +3, 34, 22.1, 6.41 },
-    { 4, 48, 44.59, +3, 35, 17.9, 6.03 },
-    { 6, 58, 57.00, +3, 36, 7.9, 5.97 },
-    { 1, 17, 48.00, +3, 36, 51.8, 5.16 },
-    { 5, 0, 32.59, +3, 36, 55.1, 7.03 },
-    { 5, 0, 33.91, +3, 36, 58.0, 6.66 },
-    { 11, 0, 33.60, +3, 37, 3.0, 4.84 },
-    { 7, 41, 35.21, +3, 37, 28.9, 5.94 },
-    { 11, 59, 56.90, +3, 39, 19.1, 5.37 },
-    { 13, 34, 7.90, +3, 39, 32.0, 4.94 },
-    { 18, 32, 7.01, +3, 39, 34.9, 6.43 },
-    { 3, 21, 6.79, +3, 40, 32.2, 5.69 },
-    { 1, 48, 25.99, +3, 41, 8.2, 5.91 },
-    { 13, 18, 51.10, +3, 41, 16.1, 6.62 },
-    { 18, 27, 50.30, +3, 44, 55.0, 6.07 },
-    { 6, 23, 18.50, +3, 45, 51.8, 6.40 },
-    { 5, 34, 16.70, +3, 46, .8, 5.36 },
-    { 17, 48, 20.21, +3, 48, 15.1, 6.22 },
-    { 22, 57, 32.81, +3, 48, 37.1, 6.28 },
-    { 23, 3, 52.61, +3, 49, 12.0, 4.53 },
-    { 11, 25, 49.99, +3, 51, 36.0, 6.37 },
-    { 9, 12, 12.91, +3, 52, 1.9, 6.14 },
-    { 6, 43, 38.69, +3, 55, 55.9, 5.90 },
-    { 8, 19, 49.90, +3, 56, 52.1, 6.05 },
-    { 18, 9, 33.79, +3, 59, 35.9, 5.73 },
-    { 5, 45, 1.90, +4, 0, 29.2, 6.09 },
-    { 5, 21, 19.30, +4, 0, 42.8, 6.57 },
-    { 18, 30, 5.09, +4, 3, 55.1, 6.69 },
-    { 3, 2, 16.80, +4, 5, 22.9, 2.53 },
-    { 5, 39, 11.09, +4, 7, 17.0, 4.57 },
-    { 17, 26, 30.91, +4, 8, 25.1, 4.34 },
-    { 6, 4, 58.39, +4, 9, 31.0, 5.63 },
-    { 18, 56, 14.59, +4, 12, 6.8, 4.98 },
-    { 18, 56, 13.20, +4, 12, 13.0, 4.62 },
-    { 5, 30, 19.80, +4, 12, 15.1, 6.21 },
-    { 16, 40, 35.11, +4, 12, 25.9, 6.93 },
-    { 16, 40, 38.71, +4, 13, 10.9, 5.77 },
-    { 8, 56, 36.89, +4, 14, 12.1, 6.14 },
-    { 18, 48, 2.71, +4, 14, 29.0, 6.21 },
-    { 6, 15, 46.99, +4, 17, 1.0, 6.64 },
-    { 20, 59, 4.39, +4, 17, 37.0, 5.23 },
-    { 7, 48, 58.90, +4, 19, 58.1, 6.53 },
-    { 8, 43, 59.69, +4, 20, 4.9, 6.37 },
-    { 9, 50, 30.10, +4, 20, 37.0, 6.24 },
-    { 3, 2, 22.51, +4, 21, 10.1, 5.61 },
-    { 18, 0, 15.79, +4, 22, 7.0, 4.64 },
-    { 22, 26, 37.39, +4, 23, 37.0, 5.75 },
-    { 19, 53, 22.61, +4, 24, 2.2, 6.53 },
-    { 5, 50, 13.10, +4, 25, 23.9, 5.97 },
-    { 16, 0, 51.10, +4, 25, 39.0, 5.83 },
-    { 22, 29, 58.01, +4, 25, 54.1, 5.48 },
-    { 15, 50, 49.01, +4, 28, 40.1, 3.71 },
-    { 7, 56, 23.90, +4, 29, 8.9, 6.17 },
-    { 6, 36, .00, +4, 29, 51.0, 6.55 },
-    { 2, 57, 4.61, +4, 30, 4.0, 6.11 },
-    { 20, 55, 40.70, +4, 31, 58.1, 6.05 },
-    { 17, 43, 28.39, +4, 34, 1.9, 2.77 },
-    { 14, 59, 23.11, +4, 34, 4.1, 5.93 },
-    { 6, 23, 46.10, +4, 35, 34.1, 4.44 },
-    { 6, 23, 46.49, +4, 35, 44.2, 6.72 },
-    { 10, 12, 48.29, +4, 36, 52.9, 5.77 },
-    { 9, 38, 27.31, +4, 38, 57.1, 4.68 },
-    { 22, 27, 51.50, +4, 41, 44.2, 4.79 },
-    { 6, 38, 49.51, +4, 42, 2.2, 6.57 },
-    { 2, 45, 20.90, +4, 42, 42.1, 6.03 },
-    { 10, 43, 20.90, +4, 44, 52.1, 5.79 },
-    { 8, 33, 43.49, +4, 45, 24.1, 5.87 },
-    { 14, 30, 45.41, +4, 46, 19.9, 6.02 },
-    { 7, 1, 41.40, +4, 49, 5.2, 6.63 },
-    { 19, 16, 31.01, +4, 50, 4.9, 5.59 },
-    { 6, 32, 19.20, +4, 51, 20.9, 5.84 },
-    { 8, 1, 13.80, +4, 52, 46.9, 5.65 },
-    { 3, 23, 39.10, +4, 52, 54.8, 6.38 },
-    { 14, 3, 55.80, +4, 54, 2.9, 6.24 },
-    { 1, 5, 49.20, +4, 54, 29.9, 6.35 },
-    { 1, 5, 51.41, +4, 54, 33.8, 7.25 },
-    { 7, 7, 6.41, +4, 54, 37.1, 6.11 },
-    { 15, 15, 11.40, +4, 56, 21.8, 5.33 },
-    { 6, 37, 52.70, +4, 57, 25.9, 6.15 },
-    { 16, 3, 45.70, +4, 59, 12.1, 6.08 },
-    { 16, 13, 15.41, +5, 1, 16.0, 5.48 },
-    { 22, 5, 40.80, +5, 3, 31.0, 4.84 },
-    { 18, 25, 8.81, +5, 5, 4.9, 6.74 },
-    { 9, 5, 58.39, +5, 5, 31.9, 4.97 },
-    { 6, 17, 16.10, +5, 6, 1.1, 5.71 },
-    { 13, 22, 9.70, +5, 9, 16.9, 5.87 },
-    { 5, 14, 44.09, +5, 9, 22.0, 5.50 },
-    { 7, 39, 18.10, +5, 13, 30.0, 0.38 },
-    { 7, 40, 7.01, +5, 13, 50.9, 6.02 },
-    { 16, 47, 46.39, +5, 14, 48.1, 5.24 },
-    { 21, 15, 49.39, +5, 14, 52.1, 3.92 },
-    { 18, 39, 36.89, +5, 15, 51.1, 6.38 },
-    { 0, 48, 22.99, +5, 16, 50.2, 5.75 },
-    { 12, 22, 31.99, +5, 18, 20.2, 6.40 },
-    { 5, 23, 31.10, +5, 19, 21.0, 6.35 },
-    { 3, 1, 52.30, +5, 20, 10.0, 6.25 },
-    { 8, 52, 24.19, +5, 20, 24.0, 6.33 },
-    { 20, 23, 10.70, +5, 20, 35.2, 5.31 },
-    { 23, 20, 20.59, +5, 22, 53.0, 5.05 },
-    { 19, 39, 11.59, +5, 23, 52.1, 5.17 },
-    { 4, 55, 58.39, +5, 23, 57.1, 6.50 },
-    { 4, 32, 4.80, +5, 24, 36.0, 6.39 },
-    { 6, 4, 58.20, +5, 25, 12.0, 5.67 },
-    { 4, 3, 44.59, +5, 26, 8.2, 5.33 },
-    { 18, 21, 28.49, +5, 26, 8.9, 6.13 },
-    { 15, 45, 23.50, +5, 26, 48.8, 5.58 },
-    { 9, 11, 55.61, +5, 28, 5.9, 6.35 },
-    { 13, 17, 36.29, +5, 28, 10.9, 4.80 },
-    { 7, 12, 7.39, +5, 28, 28.9, 6.16 },
-    { 1, 41, 25.90, +5, 29, 15.0, 4.44 },
-    { 15, 4, 6.41, +5, 29, 33.0, 6.50 },
-    { 13, 50, 24.70, +5, 29, 49.9, 6.01 },
-    { 15, 7, 40.30, +5, 29, 53.2, 6.16 },
-    { 18, 45, 28.39, +5, 29, 58.9, 5.83 },
-    { 21, 4, 34.70, +5, 30, 10.1, 5.61 },
-    { 19, 13, 44.09, +5, 30, 56.9, 6.49 },
-    { 16, 32, 35.69, +5, 31, 16.0, 5.63 },
-    { 4, 11, 20.30, +5, 31, 23.2, 5.72 },
-    { 20, 49, 59.09, +5, 32, 40.9, 6.21 },
-    { 7, 1, 55.01, +5, 33, 27.0, 6.59 },
-    { 4, 34, 8.30, +5, 34, 7.0, 5.68 },
-    { 2, 35, 52.51, +5, 35, 35.9, 4.86 },
-    { 4, 51, 12.41, +5, 36, 18.0, 3.69 },
-    { 10, 6, 47.40, +5, 36, 41.0, 6.21 },
-    { 23, 39, 57.00, +5, 37, 35.0, 4.13 },
-    { 9, 1, 31.39, +5, 38, 26.9, 6.07 },
-    { 1, 8, 22.20, +5, 38, 58.9, 5.52 },
-    { 7, 11, 51.31, +5, 39, 16.9, 6.09 },
-    { 1, 4, 52.61, +5, 39, 23.0, 6.00 },
-    { 21, 42, 15.50, +5, 40, 48.0, 5.30 },
-    { 8, 45, 1.30, +5, 40, 50.2, 6.13 },
-    { 10, 23, 14.59, +5, 41, 39.1, 6.54 },
-    { 8, 37, 39.41, +5, 42, 13.0, 4.16 },
-    { 21, 38, 31.90, +5, 46, 18.1, 5.67 },
-    { 22, 20, 27.60, +5, 47, 21.8, 5.37 },
-    { 12, 10, 3.41, +5, 48, 24.8, 5.72 },
-    { 14, 24, 11.30, +5, 49, 12.0, 5.10 },
-    { 8, 48, 25.99, +5, 50, 16.1, 4.36 },
-    { 7, 36, 34.70, +5, 51, 42.1, 5.91 },
-    { 16, 14, 13.49, +5, 54, 6.8, 6.31 },
-    { 8, 55, 23.59, +5, 56, 44.2, 3.11 },
-    { 5, 30, 47.11, +5, 56, 53.2, 4.20 },
-    { 12, 47, 2.30, +5, 57, 2.9, 6.34 },
-    { 9, 53, 42.91, +5, 57, 29.9, 5.95 },
-    { 21, 5, 26.69, +5, 57, 29.9, 5.94 },
-    { 4, 3, 9.41, +5, 59, 21.1, 3.91 },
-    { 20, 47, 48.31, +6, 0, 29.9, 5.58 },
-    { 13, 29, 57.60, +6, 0, 47.9, 6.51 },
-    { 11, 21, 8.21, +6, 1, 45.8, 4.05 },
-    { 3, 57, 1.70, +6, 2, 24.0, 6.09 },
-    { 3, 45, 40.39, +6, 3, .0, 5.35 },
-    { 6, 15, 40.10, +6, 3, 58.0, 6.07 },
-    { 19, 8, 59.90, +6, 4, 23.9, 5.22 },
-    { 17, 18, 52.80, +6, 5, 7.1, 6.51 },
-    { 17, 53, 14.21, +6, 6, 5.0, 5.77 },
-    { 11, 0, 44.81, +6, 6, 5.0, 4.99 },
-    { 2, 40, 15.70, +6, 6, 42.8, 6.25 },
-    { 4, 20, 41.21, +6, 7, 50.9, 5.77 },
-    { 6, 37, 24.10, +6, 8, 7.1, 6.06 },
-    { 1, 30, 11.09, +6, 8, 38.0, 4.84 },
-    { 10, 56, 1.51, +6, 11, 7.1, 5.81 },
-    { 4, 15, 29.21, +6, 11, 12.1, 6.31 },
-    { 3, 30, 45.41, +6, 11, 19.0, 5.94 },
-    { 18, 27, 58.80, +6, 11, 39.1, 5.73 },
-    { 22, 10, 12.00, +6, 11, 52.1, 3.53 },
-    { 4, 15, 25.80, +6, 11, 58.9, 6.93 },
-    { 18, 58, 23.81, +6, 14, 25.1, 6.21 },
-    { 18, 0, 52.90, +6, 16, 5.9, 6.34 },
-    { 17, 41, 32.30, +6, 18, 46.1, 5.95 },
-    { 6, 41, 59.30, +6, 20, 42.0, 6.37 },
-    { 5, 25, 7.90, +6, 20, 58.9, 1.64 },
-    { 13, 46, 57.10, +6, 21, 2.2, 6.33 },
-    { 6, 40, 31.80, +6, 22, 18.1, 6.51 },
-    { 10, 46, 5.69, +6, 22, 23.2, 6.37 },
-    { 16, 9, 11.21, +6, 22, 44.0, 5.97 },
-    { 23, 27, 58.10, +6, 22, 44.0, 4.28 },
-    { 19, 55, 18.79, +6, 24, 24.1, 3.71 },
-    { 3, 34, 49.20, +6, 25, 4.1, 6.49 },
-    { 8, 46, 46.61, +6, 25, 8.0, 3.38 },
-    { 15, 44, 16.10, +6, 25, 32.2, 2.65 },
-    { 5, 48, .19, +6, 27, 15.1, 5.27 },
-    { 0, 59, 49.70, +6, 28, 59.2, 6.11 },
-    { 17, 56, 55.99, +6, 29, 16.1, 6.29 },
-    { 11, 45, 51.60, +6, 31, 45.8, 4.03 },
-    { 3, 52, .19, +6, 32, 4.9, 5.67 },
-    { 10, 23, .41, +6, 32, 33.0, 6.07 },
-    { 17, 0, 29.40, +6, 35, 1.0, 6.59 },
-    { 12, 0, 52.39, +6, 36, 51.1, 4.66 },
-    { 18, 55, 27.50, +6, 36, 55.1, 5.57 },
-    { 23, 4, 1.01, +6, 37, .1, 6.41 },
-    { 21, 37, 43.70, +6, 37, 5.9, 6.18 },
-    { 8, 35, 51.00, +6, 37, 12.0, 5.99 },
-    { 8, 35, 51.29, +6, 37, 21.0, 7.25 },
-    { 3, 12, 26.40, +6, 39, 38.9, 5.56 },
-    { 18, 36, 39.10, +6, 40, 18.8, 5.45 },
-    { 7, 17, 17.81, +6, 40, 50.2, 6.65 },
-    { 9, 46, 10.01, +6, 42, 31.0, 5.79 },
-    { 22, 0, 7.90, +6, 43, 3.0, 6.00 },
-    { 0, 47, 23.59, +6, 44, 26.9, 5.99 },
-    { 3, 46, 9.50, +6, 48, 11.2, 5.91 },
-    { 12, 41, 57.10, +6, 48, 24.1, 5.59 },
-    { 21, 22, 53.59, +6, 48, 40.0, 5.16 },
-    { 9, 37, 12.70, +6, 50, 8.9, 5.00 },
-    { 23, 59, 18.70, +6, 51, 47.9, 4.01 },
-    { 21, 53, 57.79, +6, 51, 51.8, 6.15 },
-    { 5, 26, 38.81, +6, 52, 9.1, 6.42 },
-    { 2, 36, 4.90, +6, 53, 12.8, 5.82 },
-    { 7, 28, 2.11, +6, 56, 30.8, 5.25 },
-    { 16, 24, 10.80, +6, 56, 53.2, 5.85 },
-    { 10, 34, 48.00, +6, 57, 13.0, 5.08 },
-    { 0, 32, 23.81, +6, 57, 20.2, 5.67 },
-    { 4, 49, 50.40, +6, 57, 41.0, 3.19 },
-    { 12, 38, 30.00, +6, 59, 17.9, 7.08 },
-    { 21, 8, 28.20, +6, 59, 21.8, 6.15 },
-    { 1, 14, 42.41, +6, 59, 43.1, 6.03 },
-    { 6, 16, 58.39, +7, 3, 11.2, 6.57 },
-    { 23, 55, 7.80, +7, 4, 16.0, 6.21 },
-    { 6, 25, 13.10, +7, 5, 8.9, 5.98 },
-    { 19, 54, 40.30, +7, 8, 25.1, 6.15 },
-    { 7, 19, 47.59, +7, 8, 34.1, 5.91 },
-    { 13, 30, .10, +7, 10, 44.0, 6.17 },
-    { 7, 58, 5.81, +7, 12, 49.0, 6.41 },
-    { 16, 50, 19.39, +7, 14, 52.1, 5.49 },
-    { 23, 41, 56.69, +7, 15, 2.2, 5.89 },
-    { 18, 19, 9.50, +7, 15, 34.9, 5.39 },
-    { 20, 4, 8.30, +7, 16, 41.2, 5.52 },
-    { 9, 2, 44.81, +7, 17, 53.2, 5.85 },
-    { 0, 48, 17.40, +7, 18, .0, 5.93 },
-    { 6, 59, 20.09, +7, 19, .8, 6.35 },
-    { 6, 32, 54.19, +7, 19, 59.2, 4.50 },
-    { 11, 5, 1.01, +7, 20, 10.0, 4.63 },
-    { 22, 58, 42.60, +7, 20, 22.9, 6.33 },
-    { 15, 46, 26.59, +7, 21, 11.2, 4.43 },
-    { 21, 21, 4.80, +7, 21, 15.8, 5.82 },
-    { 18, 39, 51.60, +7, 21, 29.9, 6.28 },
-    { 19, 34, 5.40, +7, 22, 44.0, 4.45 },
-    { 5, 55, 10.30, +7, 24, 24.8, 0.50 },
-    { 7, 7, 49.51, +7, 28, 16.0, 5.75 },
-    { 2, 35, 4.10, +7, 28, 17.0, 6.18 },
-    { 21, 0, 3.89, +7, 30, 59.0, 5.99 },
-    { 5, 38, 1.10, +7, 32, 29.0, 5.88 },
-    { 14, 3, 36.79, +7, 32, 47.0, 6.26 },
-    { 8, 25, 54.79, +7, 33, 51.8, 5.13 },
-    { 6, 34, 46.39, +7, 34, 21.0, 6.45 },
-    { 1, 13, 43.90, +7, 34, 31.1, 5.24 },
-    { 1, 13, 45.29, +7, 34, 41.9, 6.30 },
-    { 0, 48, 40.99, +7, 35, 6.0, 4.43 },
-    { 17, 26, 19.01, +7, 35, 44.2, 6.06 },
-    { 12, 31, 21.41, +7, 36, 15.1, 6.05 },
-    { 19, 45, 39.91, +7, 36, 47.9, 5.91 },
-    { 6, 58, 39.00, +7, 37, 18.8, 6.27 },
-    { 12, 45, 37.10, +7, 40, 23.9, 5.22 },
-    { 2, 38, .79, +7, 41, 43.1, 6.39 },
-    { 4, 13, 33.10, +7, 42, 58.0, 5.29 },
-    { 2, 36, 35.11, +7, 43, 46.9, 5.81 },
-    { 4, 54, 47.81, +7, 46, 45.1, 5.33 },
-    { 20, 49, 48.31, +7, 51, 51.1, 6.33 },
-    { 4, 39, 6.19, +7, 52, 14.9, 5.39 },
-    { 1, 2, 56.59, +7, 53, 24.0, 4.28 },
-    { 17, 11, 45.19, +7, 53, 40.9, 6.33 },
-    { 19, 50, 17.50, +7, 54, 9.0, 6.51 },
-    { 1, 28, 22.90, +7, 57, 41.0, 6.20 },
-    { 7, 15, 39.41, +7, 58, 40.1, 5.82 },
-    { 8, 39, 24.60, +8, 1, 1.9, 6.45 },
-    { 18, 25, 38.81, +8, 1, 54.8, 5.65 },
-    { 6, 47, 19.80, +8, 2, 13.9, 4.77 },
-    { 10, 0, 12.79, +8, 2, 39.1, 4.70 },
-    { 11, 14, 1.80, +8, 3, 38.2, 5.79 },
-    { 14, 24, 18.29, +8, 5, 6.0, 6.19 },
-    { 16, 5, 37.80, +8, 5, 46.0, 6.29 },
-    { 11, 38, 27.60, +8, 8, 3.1, 5.36 },
-    { 14, 41, 38.81, +8, 9, 42.1, 4.86 },
-    { 22, 20, 55.80, +8, 11, 12.1, 6.17 },
-    { 9, 28, 29.21, +8, 11, 17.9, 5.71 },
-    { 0, 20, 35.90, +8, 11, 25.1, 5.37 },
-    { 21, 28, 24.79, +8, 11, 44.2, 6.40 },
-    { 4, 3, 56.59, +8, 11, 49.9, 5.46 },
-    { 19, 6, 22.20, +8, 13, 48.0, 6.09 },
-    { 0, 16, 34.10, +8, 14, 24.0, 6.11 },
-    { 14, 24, .91, +8, 14, 37.0, 5.95 },
-    { 11, 47, 54.89, +8, 14, 44.9, 5.32 },
-    { 2, 6, 12.31, +8, 14, 51.0, 6.31 },
-    { 22, 1, 9.19, +8, 15, 25.9, 5.65 },
-    { 11, 45, 17.09, +8, 15, 29.9, 4.85 },
-    { 18, 33, 23.30, +8, 16, 5.9, 6.42 },
-    { 7, 27, 9.00, +8, 17, 21.8, 2.90 },
-    { 9, 58, 7.61, +8, 18, 51.1, 6.04 },
-    { 6, 55, 34.61, +8, 19, 28.9, 6.29 },
-    { 19, 2, 21.60, +8, 22, 27.1, 6.30 },
-    { 6, 52, 49.39, +8, 22, 49.1, 5.77 },
-    { 2, 56, 13.80, +8, 22, 54.1, 5.97 },
-    { 13, 42, 12.70, +8, 23, 17.9, 6.16 },
-    { 5, 21, 43.61, +8, 25, 43.0, 5.80 },
-    { 20, 28, 7.49, +8, 26, 15.0, 6.25 },
-    { 11, 55, 3.10, +8, 26, 38.0, 5.58 },
-    { 14, 23, 22.61, +8, 26, 42.0, 6.86 },
-    { 14, 23, 22.70, +8, 26, 48.1, 5.12 },
-    { 17, 1, 59.09, +8, 27, 2.2, 6.33 },
-    { 8, 34, 13.30, +8, 27, 6.8, 6.03 },
-    { 2, 28, 9.50, +8, 27, 36.0, 4.28 },
-    { 19, 54, 14.90, +8, 27, 41.0, 4.71 },
-    { 3, 8, 38.71, +8, 28, 14.9, 6.28 },
-    { 0, 2, 29.69, +8, 29, 8.2, 5.63 },
-    { 5, 7, 52.90, +8, 29, 53.9, 5.34 },
-    { 16, 8, 28.01, +8, 32, 3.1, 5.73 },
-    { 22, 15, 59.81, +8, 32, 57.8, 6.21 },
-    { 20, 0, 58.90, +8, 33, 29.2, 5.91 },
-    { 2, 11, 21.10, +8, 34, 10.9, 5.63 },
-    { 15, 30, 55.39, +8, 34, 45.1, 6.57 },
-    { 15, 54, 40.30, +8, 34, 49.1, 6.29 },
-    { 16, 45, 49.90, +8, 34, 57.0, 5.15 },
-    { 6, 46, 32.40, +8, 35, 13.9, 5.93 },
-    { 4, 26, 21.10, +8, 35, 25.1, 6.06 },
-    { 12, 27, 42.10, +8, 36, 37.1, 6.37 },
-    { 7, 57, 15.91, +8, 38, 29.0, 6.05 },
-    { 10, 35, 2.21, +8, 39, 1.1, 5.67 },
-    { 6, 8, 47.21, +8, 40, 12.0, 6.55 },
-    { 23, 9, 31.51, +8, 40, 37.9, 5.12 },
-    { 23, 11, 44.21, +8, 43, 12.0, 5.16 },
-    { 12, 5, 12.50, +8, 43, 59.2, 4.12 },
-    { 18, 7, 18.41, +8, 44, 2.0, 4.64 },
-    { 10, 25, 15.19, +8, 47, 4.9, 5.61 },
-    { 22, 55, 13.70, +8, 48, 56.9, 4.90 },
-    { 0, 14, 58.80, +8, 49, 14.9, 5.79 },
-    { 18, 38, 21.00, +8, 50, 2.0, 6.40 },
-    { 2, 13, .00, +8, 50, 48.1, 4.37 },
-    { 17, 23, 57.60, +8, 51, 10.1, 5.77 },
-    { 7, 55, 31.39, +8, 51, 46.1, 5.86 },
-    { 8, 17, 31.70, +8, 51, 58.0, 6.29 },
-    { 19, 50, 46.99, +8, 52, 5.9, 0.77 },
-    { 11, 38, 9.79, +8, 53, 3.1, 6.17 },
-    { 6, 24, 2.30, +8, 53, 4.9, 6.26 },
-    { 4, 13, 31.30, +8, 53, 26.2, 6.51 },
-    { 4, 15, 32.11, +8, 53, 31.9, 4.29 },
-    { 14, 1, 20.40, +8, 53, 40.9, 5.99 },
-    { 4, 50, 36.70, +8, 54, 1.1, 4.36 },
-    { 2, 59, 42.89, +8, 54, 27.0, 4.70 },
-    { 8, 1, 50.71, +8, 54, 50.0, 6.22 },
-    { 7, 28, 9.79, +8, 55, 32.2, 4.32 },
-    { 9, 56, 25.99, +8, 55, 59.2, 5.85 },
-    { 5, 37, 19.30, +8, 57, 6.8, 6.12 },
-    { 0, 2, 24.19, +8, 57, 24.8, 6.32 },
-    { 3, 24, 48.79, +9, 1, 44.0, 3.60 },
-    { 6, 30, 5.50, +9, 1, 45.1, 6.57 },
-    { 6, 18, 40.49, +9, 2, 49.9, 6.24 },
-    { 9, 28, 27.50, +9, 3, 24.1, 5.41 },
-    { 18, 36, 27.79, +9, 7, 21.0, 5.39 },
-    { 22, 29, 7.99, +9, 7, 44.0, 5.58 },
-    { 7, 3, 17.90, +9, 8, 17.9, 5.97 },
-    { 1, 45, 23.59, +9, 9, 28.1, 4.26 },
-    { 8, 16, 30.91, +9, 11, 8.2, 3.52 },
-    { 7, 5, 39.10, +9, 11, 8.9, 5.78 },
-    { 4, 20, 49.01, +9, 13, 32.2, 6.53 },
-    { 4, 13, 56.40, +9, 15, 49.0, 4.84 },
-    { 7, 25, 38.90, +9, 16, 34.0, 4.99 },
-    { 5, 36, 54.29, +9, 17, 26.2, 4.09 },
-    { 10, 32, 48.70, +9, 18, 24.1, 3.85 },
-    { 23, 51, 21.19, +9, 18, 47.9, 5.79 },
-    { 22, 58, 35.09, +9, 21, 24.8, 6.43 },
-    { 3, 32, 36.00, +9, 22, 25.0, 5.77 },
-    { 16, 57, 40.10, +9, 22, 30.0, 3.20 },
-    { 8, 57, 42.00, +9, 23, 16.1, 6.19 },
-    { 20, 7, 50.30, +9, 23, 58.9, 6.43 },
-    { 23, 7, .31, +9, 24, 33.8, 4.52 },
-    { 4, 33, 48.10, +9, 24, 47.2, 6.01 },
-    { 13, 16, 46.51, +9, 25, 27.1, 5.22 },
-    { 4, 23, 51.89, +9, 27, 38.9, 5.12 },
-    { 5, 7, 38.30, +9, 28, 18.8, 6.17 },
-    { 4, 18, 24.50, +9, 29, 12.1, 6.54 },
-    { 5, 34, 49.20, +9, 29, 21.8, 4.41 },
-    { 5, 56, 28.01, +9, 30, 34.9, 5.99 },
-    { 5, 46, 52.10, +9, 31, 19.9, 5.79 },
-    { 12, 46, 22.51, +9, 32, 24.0, 5.67 },
-    { 18, 7, 21.00, +9, 33, 50.0, 3.73 },
-    { 2, 29, 35.30, +9, 33, 56.9, 6.07 },
-    { 8, 38, 5.21, +9, 34, 28.9, 6.53 },
-    { 17, 34, 36.70, +9, 35, 12.1, 5.81 },
-    { 19, 18, 52.70, +9, 37, 5.2, 6.32 },
-    { 19, 51, 17.71, +9, 37, 49.1, 6.25 },
-    { 6, 2, 22.99, +9, 38, 51.0, 4.12 },
-    { 8, 37, 5.81, +9, 39, 20.2, 5.88 },
-    { 23, 39, 55.10, +9, 40, 37.9, 5.97 },
-    { 14, 2, 31.80, +9, 41, 11.0, 6.20 },
-    { 16, 11, 29.69, +9, 42, 45.0, 6.53 },
-    { 9, 31, 57.60, +9, 42, 56.9, 5.07 },
-    { 3, 27, 10.20, +9, 43, 58.1, 3.74 },
-    { 17, 6, 9.70, +9, 43, 59.9, 6.37 },
-    { 10, 27, 39.00, +9, 45, 45.0, 6.04 },
-    { 8, 31, 54.60, +9, 48, 51.8, 6.83 },
-    { 8, 11, 16.61, +9, 49, 16.0, 6.07 },
-    { 23, 10, 1.51, +9, 49, 18.8, 5.39 },
-    { 5, 9, 19.61, +9, 49, 45.8, 5.43 },
-    { 22, 52, 24.10, +9, 50, 8.2, 5.16 },
-    { 5, 50, 2.59, +9, 52, 16.0, 5.80 },
-    { 21, 44, 11.21, +9, 52, 30.0, 2.39 },
-    { 16, 7, 37.49, +9, 53, 30.1, 5.63 },
-    { 9, 41, 9.00, +9, 53, 31.9, 3.52 },
-    { 6, 40, 58.70, +9, 53, 44.2, 4.66 },
-    { 19, 22, 48.41, +9, 54, 47.2, 6.35 },
-    { 5, 35, 8.30, +9, 56, 3.1, 3.54 },
-    { 5, 35, 8.50, +9, 56, 6.0, 5.61 },
-    { 6, 17, 6.60, +9, 56, 33.0, 5.39 },
-    { 6, 56, 25.80, +9, 57, 23.0, 5.92 },
-    { 4, 51, 43.39, +9, 58, 30.0, 6.11 },
-    { 6, 35, 17.59, +9, 59, 17.9, 5.88 },
-    { 10, 7, 54.31, +9, 59, 51.0, 4.37 },
-    { 4, 1, 46.10, +9, 59, 52.1, 5.67 },
-    { 21, 14, 28.90, +10, 0, 24.8, 4.49 },
-    { 15, 36, 29.59, +10, 0, 36.0, 5.26 },
-    { 4, 14, 36.29, +10, 0, 40.0, 5.22 },
-    { 13, 9, 12.41, +10, 1, 19.9, 5.78 },
-    { 21, 10, 31.20, +10, 2, 56.0, 6.07 },
-    { 20, 25, 43.99, +10, 3, 23.0, 6.33 },
-    { 20, 33, 53.59, +10, 3, 34.9, 6.56 },
-    { 8, 32, 39.89, +10, 3, 58.0, 6.46 },
-    { 8, 44, 45.00, +10, 4, 54.1, 5.66 },
-    { 20, 39, 7.80, +10, 5, 10.0, 5.05 },
-    { 14, 14, 50.81, +10, 6, 2.2, 5.29 },
-    { 2, 44, 56.50, +10, 6, 51.1, 4.27 },
-    { 4, 19, 37.49, +10, 7, 17.0, 6.31 },
-    { 21, 10, 20.50, +10, 7, 54.1, 4.69 },
-    { 18, 59, 17.50, +10, 8, 26.9, 6.75 },
-    { 4, 54, 53.81, +10, 9, 2.9, 4.65 },
-    { 4, 35, 39.29, +10, 9, 38.9, 4.25 },
-    { 16, 54, .50, +10, 9, 55.1, 4.38 },
-    { 21, 24, 24.60, +10, 10, 27.1, 6.35 },
-    { 0, 28, 20.09, +10, 11, 22.9, 6.04 },
-    { 13, 35, 33.29, +10, 12, 16.9, 6.49 },
-    { 4, 13, 34.80, +10, 12, 43.9, 6.23 },
-    { 12, 41, 53.11, +10, 14, 8.2, 4.88 },
-    { 5, 35, 13.39, +10, 14, 24.0, 5.60 },
-    { 12, 13, 25.90, +10, 15, 43.9, 5.85 },
-    { 4, 30, 2.40, +10, 15, 45.0, 6.48 },
-    { 12, 33, 2.90, +10, 17, 44.2, 6.26 },
-    { 6, 28, 18.79, +10, 18, 14.0, 6.15 },
-    { 3, 59, 40.70, +10, 19, 50.9, 6.37 },
-    { 23, 43, 22.39, +10, 19, 53.0, 5.06 },
-    { 19, 52, 15.60, +10, 21, 5.0, 6.54 },
-    { 19, 51, 1.61, +10, 24, 56.2, 5.11 },
-    { 12, 41, 34.39, +10, 25, 35.0, 6.19 },
-    { 17, 6, 13.10, +10, 27, 15.1, 6.37 },
-    { 22, 49, 32.30, +10, 28, 44.0, 6.54 },
-    { 4, 29, 42.89, +10, 31, 18.1, 6.79 },
-    { 11, 23, 55.49, +10, 31, 45.1, 3.94 },
-    { 15, 34, 48.10, +10, 32, 15.0, 3.80 },
-    { 15, 34, 48.10, +10, 32, 21.1, 3.80 },
-    { 10, 49, 15.41, +10, 32, 43.1, 5.34 },
-    { 7, 34, 5.09, +10, 34, 5.9, 6.28 },
-    { 17, 12, 27.79, +10, 35, 7.1, 5.33 },
-    { 5, 54, 13.39, +10, 35, 12.8, 6.12 },
-    { 7, 26, 27.89, +10, 36, 29.9, 6.37 },
-    { 2, 24, 49.01, +10, 36, 38.2, 5.47 },
-    { 19, 46, 15.60, +10, 36, 47.9, 2.72 },
-    { 6, 13, 12.60, +10, 37, 39.0, 6.45 },
-    { 8, 23, 55.20, +10, 37, 54.8, 6.08 },
-    { 9, 7, 44.81, +10, 40, 5.2, 5.24 },
-    { 19, 48, 30.41, +10, 41, 39.1, 6.44 },
-    { 20, 8, 38.30, +10, 43, 32.9, 6.31 },
-    { 2, 42, 28.90, +10, 44, 30.1, 6.30 },
-    { 13, 39, 34.61, +10, 44, 46.0, 5.57 },
-    { 7, 46, 16.20, +10, 46, 5.9, 5.30 },
-    { 14, 3, 32.30, +10, 47, 12.1, 6.30 },
-    { 13, 29, 13.01, +10, 49, 5.9, 5.65 },
-    { 21, 42, 33.00, +10, 49, 28.9, 6.09 },
-    { 22, 41, 27.70, +10, 49, 53.0, 3.40 },
-    { 20, 58, 25.90, +10, 50, 21.1, 5.48 },
-    { 6, 37, 36.89, +10, 51, 11.2, 6.38 },
-    { 17, 18, 37.01, +10, 51, 51.8, 5.03 },
-    { 3, 0, 44.11, +10, 52, 13.1, 5.95 },
-    { 18, 34, 47.50, +10, 53, 30.1, 6.40 },
-    { 20, 30, 18.00, +10, 53, 44.9, 6.08 },
-    { 11, 35, 43.39, +10, 54, 40.0, 6.56 },
-    { 22, 43, 42.70, +10, 56, 21.1, 6.51 },
-    { 23, 52, 37.10, +10, 56, 51.0, 5.30 },
-    { 7, 3, 37.99, +10, 57, 6.1, 5.13 },
-    { 13, 2, 10.61, +10, 57, 33.1, 2.83 },
-    { 22, 2, 1.39, +10, 58, 26.0, 6.37 },
-    { 18, 50, 45.60, +10, 58, 35.0, 6.55 },
-    { 0, 20, 54.50, +10, 58, 36.8, 6.56 },
-    { 6, 53, 22.51, +10, 59, 47.0, 6.24 },
-    { 6, 41, 17.21, +11, 0, 11.9, 6.11 },
-    { 7, 26, 41.30, +11, 0, 33.1, 6.41 },
-    { 6, 29, .00, +11, 1, 9.8, 6.59 },
-    { 11, 34, 10.01, +11, 1, 25.0, 6.55 },
-    { 5, 37, 4.39, +11, 2, 6.0, 5.94 },
-    { 1, 50, 52.01, +11, 2, 35.9, 5.94 },
-    { 17, 57, 26.90, +11, 2, 39.1, 6.36 },
-    { 23, 13, 26.50, +11, 3, 54.0, 5.82 },
-    { 19, 6, 58.61, +11, 4, 17.0, 5.09 },
-    { 17, 54, 14.21, +11, 7, 50.2, 6.38 },
-    { 3, 48, 16.30, +11, 8, 35.9, 5.07 },
-    { 0, 10, 2.30, +11, 8, 44.2, 5.51 },
-    { 4, 44, 25.80, +11, 8, 46.0, 5.40 },
-    { 19, 36, 7.99, +11, 9, .0, 6.68 },
-    { 21, 18, 52.01, +11, 12, 11.9, 5.96 },
-    { 0, 18, 17.21, +11, 12, 20.9, 6.05 },
-    { 4, 27, 28.80, +11, 12, 45.0, 5.88 },
-    { 20, 39, 51.79, +11, 14, 58.9, 6.42 },
-    { 6, 31, 9.50, +11, 15, 2.9, 6.14 },
-    { 20, 31, 13.01, +11, 15, 38.2, 7.11 },
-    { 15, 35, 53.40, +11, 15, 56.2, 6.07 },
-    { 19, 36, 52.51, +11, 16, 23.9, 5.98 },
-    { 9, 31, 56.71, +11, 17, 58.9, 4.97 },
-    { 20, 33, 12.79, +11, 18, 11.9, 4.03 },
-    { 13, 14, 31.30, +11, 19, 54.1, 5.67 },
-    { 3, 30, 24.50, +11, 20, 11.0, 5.14 },
-    { 5, 16, 4.10, +11, 20, 29.0, 5.56 },
-    { 20, 37, 49.10, +11, 22, 40.1, 5.43 },
-    { 22, 3, 19.01, +11, 23, 11.0, 5.80 },
-    { 16, 26, 11.50, +11, 24, 27.0, 6.11 },
-    { 18, 37, 12.60, +11, 25, 18.1, 6.42 },
-    { 19, 56, 14.30, +11, 25, 26.0, 5.28 },
-    { 4, 54, 46.90, +11, 25, 34.0, 5.19 },
-    { 9, 47, 33.50, +11, 25, 44.0, 6.02 },
-    { 11, 24, 58.90, +11, 25, 49.1, 5.80 },
-    { 16, 32, 36.29, +11, 29, 17.2, 4.84 },
-    { 9, 17, 51.41, +11, 30, 4.0, 6.41 },
-    { 5, 56, 49.51, +11, 31, 16.0, 5.87 },
-    { 19, 19, 52.99, +11, 32, 6.0, 6.02 },
-    { 6, 31, 48.29, +11, 32, 39.8, 5.23 },
-    { 13, 12, 32.90, +11, 33, 22.0, 5.77 },
-    { 9, 9, 46.39, +11, 33, 51.8, 6.48 },
-    { 9, 47, 25.90, +11, 34, 5.9, 6.45 },
-    { 19, 17, 49.01, +11, 35, 43.1, 5.28 },
-    { 22, 10, 37.39, +11, 37, 27.8, 5.78 },
-    { 8, 55, 55.61, +11, 37, 34.0, 5.41 },
-    { 19, 52, 3.50, +11, 37, 44.0, 6.13 },
-    { 14, 41, 43.49, +11, 39, 38.2, 5.56 },
-    { 7, 24, 58.20, +11, 40, 10.9, 5.30 },
-    { 6, 32, 23.30, +11, 40, 25.0, 6.03 },
-    { 6, 3, 24.70, +11, 40, 50.9, 6.08 },
-    { 22, 36, 36.41, +11, 41, 48.8, 6.40 },
-    { 4, 46, 1.70, +11, 42, 20.2, 5.37 },
-    { 10, 59, 41.09, +11, 42, 20.9, 6.55 },
-    { 8, 16, 33.91, +11, 43, 35.0, 7.13 },
-    { 22, 59, 11.81, +11, 43, 44.0, 5.75 },
-    { 6, 20, 52.30, +11, 45, 23.0, 6.54 },
-    { 5, 54, 32.21, +11, 45, 45.0, 6.59 },
-    { 6, 31, 39.19, +11, 47, 31.9, 6.65 },
-    { 9, 46, 23.30, +11, 48, 36.0, 5.63 },
-    { 8, 50, 26.10, +11, 48, 45.0, },
-    { 19, 48, 42.10, +11, 48, 56.9, 5.72 },
-    { 19, 42, 34.01, +11, 49, 36.1, 5.27 },
-    { 22, 56, 51.50, +11, 50, 53.9, 6.51 },
-    { 8, 58, 29.21, +11, 51, 28.1, 4.25 },
-    { 3, 10, 38.90, +11, 52, 21.0, 5.98 },
-    { 6, 57, 25.70, +11, 54, 27.0, 6.27 },
-    { 17, 30, 22.39, +11, 55, 30.0, 6.39 },
-    { 17, 32, 15.00, +11, 55, 49.1, 6.42 },
-    { 19, 24, 58.20, +11, 56, 39.8, 5.16 },
-    { 17, 50, 43.49, +11, 56, 48.1, 6.17 },
-    { 12, 47, 13.61, +11, 57, 29.2, 6.07 },
-    { 10, 8, 22.30, +11, 58, 1.9, 1.35 },
-    { 0, 47, 1.51, +11, 58, 26.0, 5.50 },
-    { 11, 18, 21.00, +11, 59, 4.9, 6.66 },
-    { 18, 5, 43.30, +12, 0, 14.0, 7.04 },
-    { 7, 29, 47.81, +12, 0, 24.1, 4.54 },
-    { 18, 22, 35.30, +12, 1, 44.0, 5.89 },
-    { 15, 40, 10.39, +12, 3, 11.2, 6.25 },
-    { 21, 56, 56.40, +12, 4, 35.0, 5.54 },
-    { 8, 46, 55.99, +12, 6, 36.0, 5.87 },
-    { 7, 14, 32.59, +12, 6, 56.9, 5.62 },
-    { 21, 31, 9.60, +12, 8, 15.0, 6.08 },
-    { 1, 37, 5.90, +12, 8, 30.1, 5.57 },
-    { 13, 52, 18.41, +12, 9, 55.1, 6.04 },
-    { 22, 46, 41.59, +12, 10, 22.1, 4.19 },
-    { 19, 42, 12.79, +12, 11, 35.9, 6.34 },
-    { 4, 40, 3.41, +12, 11, 52.1, 5.46 },
-    { 22, 21, 31.10, +12, 12, 19.1, 5.01 },
-    { 6, 16, 26.59, +12, 16, 19.9, 5.04 },
-    { 11, 50, 55.30, +12, 16, 44.0, 6.35 },
-    { 1, 59, 25.90, +12, 17, 40.9, 6.09 },
-    { 23, 23, 4.61, +12, 18, 50.0, 5.08 },
-    { 19, 19, 39.31, +12, 22, 28.9, 5.53 },
-    { 16, 40, 51.41, +12, 23, 42.0, 6.08 },
-    { 12, 53, 49.70, +12, 25, 7.0, 6.25 },
-    { 13, 24, 30.50, +12, 25, 54.8, 6.44 },
-    { 9, 58, 13.39, +12, 26, 40.9, 5.26 },
-    { 2, 44, 57.60, +12, 26, 44.9, 5.18 },
-    { 2, 36, 37.90, +12, 26, 51.0, 5.68 },
-    { 17, 10, 45.79, +12, 28, 1.9, 6.57 },
-    { 4, 0, 40.80, +12, 29, 25.1, 3.47 },
-    { 4, 38, 9.50, +12, 30, 38.9, 4.27 },
-    { 20, 49, 37.80, +12, 32, 43.1, 5.98 },
-    { 6, 15, 45.00, +12, 33, 4.0, 5.33 },
-    { 17, 34, 56.11, +12, 33, 36.0, 2.08 },
-    { 15, 22, 23.21, +12, 34, 3.0, 6.28 },
-    { 20, 55, 38.59, +12, 34, 7.0, 5.58 },
-    { 6, 22, 36.50, +12, 34, 12.0, 6.00 },
-    { 22, 37, 4.70, +12, 34, 37.9, 6.30 },
-    { 7, 3, 51.60, +12, 35, 39.8, 5.98 },
-    { 3, 24, 10.10, +12, 37, 45.8, 6.04 },
-    { 5, 49, 32.90, +12, 39, 4.0, 4.91 },
-    { 8, 26, 43.90, +12, 39, 15.8, 5.50 },
-    { 8, 43, 12.31, +12, 40, 50.9, 5.64 },
-    { 6, 45, 54.19, +12, 41, 37.0, 6.46 },
-    { 3, 27, 18.70, +12, 44, 6.0, 6.28 },
-    { 17, 5, 22.70, +12, 44, 26.9, 4.91 },
-    { 4, 13, 49.90, +12, 45, 11.9, 6.25 },
-    { 23, 29, 9.31, +12, 45, 38.2, 4.55 },
-    { 5, 58, 53.21, +12, 48, 31.0, 5.70 },
-    { 11, 15, 57.79, +12, 50, 40.9, 6.67 },
-    { 15, 41, 47.40, +12, 50, 51.0, 5.33 },
-    { 7, 44, 13.99, +12, 51, 33.8, 6.43 },
-    { 6, 45, 17.40, +12, 53, 44.2, 3.36 },
-    { 3, 30, 52.39, +12, 56, 12.1, 4.11 },
-    { 1, 6, 33.60, +12, 57, 22.0, 6.12 },
-    { 14, 14, 5.21, +12, 57, 33.8, 5.54 },
-    { 6, 39, 47.59, +12, 58, 59.2, 5.97 },
-    { 14, 19, 16.30, +13, 0, 15.1, 5.41 },
-    { 19, 26, 24.10, +13, 1, 26.0, 5.74 },
-    { 20, 33, 57.00, +13, 1, 37.9, 5.38 },
-    { 3, 51, 15.79, +13, 2, 44.9, 6.30 },
-    { 4, 28, 50.21, +13, 2, 51.0, 5.03 },
-    { 3, 11, 21.91, +13, 2, 52.1, 6.12 },
-    { 8, 14, 21.00, +13, 2, 53.9, 6.38 },
-    { 9, 51, 1.99, +13, 3, 58.0, 6.46 },
-    { 18, 7, 48.41, +13, 4, 16.0, 6.63 },
-    { 8, 5, 4.51, +13, 7, 5.2, 5.12 },
-    { 22, 1, 5.40, +13, 7, 10.9, 5.60 },
-    { 6, 54, 38.69, +13, 10, 40.1, 4.65 },
-    { 3, 6, 23.71, +13, 11, 13.9, 5.62 },
-    { 15, 53, 12.10, +13, 11, 48.1, 6.10 },
-    { 0, 35, 54.70, +13, 12, 24.1, 6.41 },
-    { 20, 19, 29.21, +13, 13, .8, 6.21 },
-    { 6, 43, 59.30, +13, 13, 40.1, 4.49 },
-    { 15, 8, 53.40, +13, 14, 6.0, 6.10 },
-    { 7, 59, 35.09, +13, 14, 31.9, 6.02 },
-    { 8, 33, 45.10, +13, 15, 25.9, 6.28 },
-    { 16, 49, 34.61, +13, 15, 41.0, 5.91 },
-    { 19, 44, 34.10, +13, 18, 10.1, 6.26 },
-    { 11, 15, 51.89, +13, 18, 27.0, 5.32 },
-    { 20, 38, 43.90, +13, 18, 54.0, 5.72 },
-    { 17, 38, 57.79, +13, 19, 45.1, 6.12 },
-    { 10, 11, 38.21, +13, 21, 18.0, 6.44 },
-    { 7, 49, 1.99, +13, 22, 14.9, 6.04 },
-    { 0, 34, 55.30, +13, 22, 16.0, 6.40 },
-    { 0, 5, 42.00, +13, 23, 46.0, 5.51 },
-    { 4, 9, 1.61, +13, 23, 53.9, 5.95 },
-    { 6, 50, 25.49, +13, 24, 47.9, 5.65 },
-    { 2, 2, 35.21, +13, 28, 36.1, 5.94 },
-    { 7, 41, 51.79, +13, 28, 50.2, 5.77 },
-    { 0, 22, 25.49, +13, 28, 57.0, 6.23 },
-    { 4, 56, 22.30, +13, 30, 51.8, 4.07 },
-    { 14, 40, 42.41, +13, 32, 3.1, 5.91 },
-    { 20, 20, .19, +13, 32, 53.2, 5.95 },
-    { 12, 48, 14.30, +13, 33, 11.2, 6.56 },
-    { 17, 3, 58.01, +13, 34, 3.0, 6.08 },
-    { 16, 48, 8.90, +13, 35, 26.2, 6.35 },
-    { 17, 3, 39.31, +13, 36, 19.1, 5.93 },
-    { 16, 55, 16.01, +13, 37, 10.9, 6.34 },
-    { 18, 59, 5.69, +13, 37, 21.0, 5.23 },
-    { 6, 11, 27.89, +13, 38, 19.0, 6.04 },
-    { 8, 8, 42.41, +13, 38, 26.9, 6.27 },
-    { 15, 43, 10.61, +13, 40, 4.1, 6.48 },
-    { 13, 17, 15.60, +13, 40, 32.2, 5.33 },
-    { 5, 28, 34.80, +13, 40, 44.0, 6.35 },
-    { 16, 37, 48.00, +13, 41, 12.8, 6.31 },
-    { 0, 57, 54.50, +13, 41, 44.9, 6.32 },
-    { 20, 55, 36.70, +13, 43, 17.0, 5.17 },
-    { 4, 30, 37.30, +13, 43, 27.8, 5.40 },
-    { 10, 16, 40.70, +13, 43, 41.9, 5.41 },
-    { 14, 41, 8.90, +13, 43, 41.9, 4.83 },
-    { 14, 41, 8.90, +13, 43, 41.9, 4.43 },
-    { 7, 40, 47.30, +13, 46, 14.9, 6.24 },
-    { 18, 18, 2.90, +13, 46, 36.8, 6.30 },
-    { 13, 28, 25.80, +13, 46, 44.0, 4.98 },
-    { 15, 48, 13.30, +13, 47, 19.0, 6.00 },
-    { 19, 41, 5.50, +13, 48, 56.2, 6.01 },
-    { 6, 15, 8.50, +13, 51, 4.0, 5.91 },
-    { 19, 5, 24.60, +13, 51, 47.9, 2.99 },
-    { 4, 20, 52.80, +13, 51, 51.1, 6.17 },
-    { 16, 57, 31.99, +13, 53, 3.1, 6.37 },
-    { 5, 47, 42.89, +13, 53, 58.9, 5.29 },
-    { 18, 58, 46.90, +13, 54, 24.1, 5.89 },
-    { 5, 56, 3.50, +13, 55, 31.1, 6.60 },
-    { 18, 52, 1.90, +13, 57, 56.2, 6.14 },
-    { 8, 12, 22.10, +14, 0, 14.0, 6.54 },
-    { 9, 43, 43.90, +14, 1, 18.1, 5.35 },
-    { 16, 25, 25.01, +14, 1, 59.9, 4.57 },
-    { 4, 19, 57.70, +14, 2, 7.1, 5.59 },
-    { 13, 55, 49.99, +14, 3, 23.0, 6.16 },
-    { 6, 17, 33.29, +14, 3, 29.9, 6.59 },
-    { 4, 22, 3.50, +14, 4, 37.9, 5.72 },
-    { 17, 3, 7.80, +14, 5, 30.8, 4.98 },
-    { 15, 47, 17.30, +14, 6, 55.1, 5.71 },
-    { 12, 48, 54.19, +14, 7, 21.0, 5.70 },
-    { 10, 32, 11.81, +14, 8, 13.9, 5.46 },
-    { 6, 33, 36.10, +14, 9, 19.1, 5.53 },
-    { 5, 52, 22.30, +14, 10, 18.1, 5.59 },
-    { 10, 46, 25.30, +14, 11, 40.9, 5.48 },
-    { 7, 42, 3.19, +14, 12, 29.9, 5.56 },
-    { 6, 11, 56.40, +14, 12, 32.0, 4.48 },
-    { 8, 28, 37.30, +14, 12, 38.9, 5.95 },
-    { 4, 52, 31.99, +14, 15, 2.2, 4.74 },
-    { 19, 27, 33.89, +14, 16, 57.0, 6.32 },
-    { 11, 48, 38.71, +14, 17, 3.1, 5.88 },
-    { 18, 8, 33.70, +14, 17, 4.9, 6.37 },
-    { 17, 43, 22.01, +14, 17, 42.0, 6.24 },
-    { 13, 38, 7.90, +14, 18, 6.1, 6.52 },
-    { 5, 33, 54.29, +14, 18, 20.2, 5.64 },
-    { 5, 50, 28.90, +14, 18, 20.2, 5.52 },
-    { 11, 31, 44.90, +14, 21, 51.8, 6.20 },
-    { 9, 35, 52.90, +14, 22, 46.9, 6.36 },
-    { 6, 18, 5.59, +14, 22, 58.1, 6.16 },
-    { 17, 14, 39.19, +14, 23, 24.0, 5.39 },
-    { 17, 14, 38.90, +14, 23, 25.1, 3.48 },
-    { 19, 36, 15.79, +14, 23, 30.1, 6.38 },
-    { 11, 11, 43.70, +14, 24, 1.1, 6.30 },
-    { 17, 44, 17.30, +14, 24, 37.1, 6.19 },
-    { 15, 57, 14.59, +14, 24, 51.8, 5.54 },
-    { 14, 56, 13.20, +14, 26, 47.0, 5.77 },
-    { 5, 47, 13.20, +14, 29, 17.9, 5.72 },
-    { 17, 3, 10.39, +14, 30, 40.0, 6.52 },
-    { 22, 41, 57.41, +14, 30, 59.0, 5.90 },
-    { 4, 58, 59.40, +14, 32, 34.1, 6.09 },
-    { 19, 16, 26.81, +14, 32, 40.9, 5.63 },
-    { 22, 40, 52.70, +14, 32, 57.8, 5.71 },
-    { 20, 22, 52.30, +14, 33, 5.0, 6.17 },
-    { 20, 20, 20.50, +14, 34, 9.1, 6.13 },
-    { 11, 49, 3.60, +14, 34, 18.8, 2.14 },
-    { 20, 41, 16.20, +14, 34, 59.2, 5.99 },
-    { 20, 37, 33.00, +14, 35, 43.1, 3.63 },
-    { 19, 29, 22.10, +14, 35, 44.9, 5.56 },
-    { 8, 10, 58.80, +14, 37, 45.8, 6.23 },
-    { 22, 10, 22.20, +14, 37, 48.0, 6.33 },
-    { 13, 58, 39.89, +14, 38, 57.8, 6.00 },
-    { 6, 20, 4.20, +14, 39, 4.0, 5.69 },
-    { 1, 35, 46.39, +14, 39, 41.0, 6.22 },
-    { 20, 35, 18.50, +14, 40, 27.1, 4.68 },
-    { 4, 26, 36.41, +14, 42, 49.0, 4.69 },
-    { 6, 25, 28.10, +14, 43, 18.8, 6.24 },
-    { 21, 3, 1.80, +14, 43, 48.0, 6.31 },
-    { 4, 28, 23.40, +14, 44, 26.9, 5.90 },
-    { 6, 7, 34.30, +14, 46, 5.9, 4.42 },
-    { 21, 44, 31.30, +14, 46, 18.8, 5.94 },
-    { 17, 33, 42.79, +14, 50, 30.1, 6.48 },
-    { 4, 33, 50.90, +14, 50, 39.8, 4.65 },
-    { 12, 16, .19, +14, 53, 56.0, 5.10 },
-    { 19, 23, 8.21, +14, 55, 16.0, 6.64 },
-    { 9, 15, 13.80, +14, 56, 29.0, 5.34 },
-    { 1, 5, 5.40, +14, 56, 46.0, 5.68 },
-    { 17, 1, 33.00, +14, 56, 57.8, 6.31 },
-    { 18, 25, 55.39, +14, 58, .1, 6.37 },
-    { 16, 52, 4.90, +14, 58, 27.1, 6.52 },
-    { 10, 21, 50.30, +14, 58, 32.2, 6.12 },
-    { 9, 12, 17.59, +14, 59, 46.0, 6.51 },
-    { 2, 32, 54.10, +15, 2, 4.9, 6.04 },
-    { 4, 55, 50.30, +15, 2, 24.0, 5.81 },
-    { 18, 59, 37.39, +15, 4, 5.9, 4.02 },
-    { 20, 43, 27.50, +15, 4, 27.8, 4.43 },
-    { 2, 51, 29.59, +15, 4, 54.8, 5.49 },
-    { 19, 15, 20.09, +15, 5, 1.0, 5.57 },
-    { 18, 0, 57.19, +15, 5, 35.9, 6.26 },
-    { 4, 20, 36.31, +15, 5, 43.1, 5.26 },
-    { 7, 28, 47.30, +15, 6, 33.8, 6.22 },
-    { 14, 46, 6.00, +15, 7, 54.8, 5.63 },
-    { 15, 50, 41.71, +15, 8, 1.0, 5.20 },
-    { 7, 20, 6.89, +15, 8, 34.1, 6.45 },
-    { 12, 17, 44.30, +15, 8, 39.1, 6.34 },
-    { 4, 7, 42.00, +15, 9, 46.1, 6.01 },
-    { 17, 41, 10.99, +15, 10, 41.2, 6.34 },
-    { 0, 13, 14.21, +15, 11, 1.0, 2.83 },
-    { 20, 14, 16.61, +15, 11, 51.0, 4.95 },
-    { 23, 4, 45.70, +15, 12, 19.1, 2.49 },
-    { 0, 36, 47.30, +15, 13, 54.1, 5.89 },
-    { 5, 27, 13.80, +15, 15, 28.1, 6.16 },
-    { 14, 17, 28.39, +15, 15, 47.9, 5.80 },
-    { 2, 13, 3.29, +15, 16, 46.9, 5.71 },
-    { 2, 44, 32.90, +15, 18, 42.1, 5.77 },
-    { 8, 36, 7.70, +15, 18, 49.0, 6.32 },
-    { 8, 57, 14.90, +15, 19, 22.1, 5.20 },
-    { 17, 51, 58.49, +15, 19, 32.9, 6.46 },
-    { 7, 2, 17.40, +15, 20, 10.0, 5.74 },
-    { 1, 31, 28.99, +15, 20, 44.9, 3.62 },
-    { 8, 51, 1.51, +15, 21, 2.2, 6.38 },
-    { 5, 30, 26.09, +15, 21, 37.1, 5.94 },
-    { 9, 21, 15.41, +15, 22, 16.0, 6.53 },
-    { 4, 15, 46.30, +15, 24, 2.2, 6.32 },
-    { 5, 4, 34.10, +15, 24, 15.1, 4.68 },
-    { 11, 29, 41.90, +15, 24, 47.9, 5.74 },
-    { 15, 46, 11.30, +15, 25, 18.8, 3.67 },
-    { 15, 25, 47.40, +15, 25, 41.2, 5.17 },
-    { 11, 14, 14.40, +15, 25, 45.8, 3.34 },
-    { 3, 37, 47.81, +15, 25, 50.9, 6.39 },
-    { 0, 46, 33.00, +15, 28, 32.2, 5.38 },
-    { 16, 36, 43.01, +15, 29, 53.2, 6.30 },
-    { 20, 5, 26.50, +15, 30, 1.1, 6.34 },
-    { 7, 24, 27.70, +15, 31, 1.9, 6.41 },
-    { 8, 57, 35.21, +15, 34, 53.0, 5.67 },
-    { 5, 9, 42.00, +15, 35, 49.9, 4.82 },
-    { 17, 24, 33.79, +15, 36, 22.0, 6.35 },
-    { 4, 26, 20.81, +15, 37, 5.9, 4.49 },
-    { 4, 19, 47.59, +15, 37, 39.0, 3.65 },
-    { 4, 30, 8.59, +15, 38, 17.2, 5.58 },
-    { 11, 55, 40.49, +15, 38, 48.1, 5.53 },
-    { 21, 7, 33.60, +15, 39, 31.0, 6.34 },
-    { 15, 56, 27.19, +15, 39, 42.1, 3.85 },
-    { 1, 10, 11.50, +15, 40, 27.1, 6.06 },
-    { 4, 30, 38.90, +15, 41, 30.8, 5.48 },
-    { 14, 53, 23.30, +15, 42, 15.8, 6.40 },
-    { 16, 45, 22.51, +15, 44, 43.1, 5.56 },
-    { 10, 5, 40.90, +15, 45, 27.0, 6.37 },
-    { 7, 56, 59.40, +15, 47, 25.1, 5.78 },
-    { 13, 49, 28.61, +15, 47, 52.1, 4.07 },
-    { 4, 39, 9.19, +15, 47, 58.9, 5.07 },
-    { 5, 46, 45.50, +15, 49, 21.0, 6.00 },
-    { 7, 33, 36.50, +15, 49, 36.1, 5.25 },
-    { 20, 39, 4.99, +15, 50, 17.2, 5.97 },
-    { 4, 31, 51.79, +15, 51, 6.1, 6.02 },
-    { 3, 4, 40.70, +15, 51, 22.0, 6.49 },
-    { 22, 32, 46.90, +15, 51, 47.9, 6.32 },
-    { 4, 28, 39.70, +15, 52, 14.9, 3.40 },
-    { 5, 27, 45.60, +15, 52, 27.1, 5.50 },
-    { 6, 31, 37.39, +15, 54, 11.9, 6.40 },
-    { 4, 49, 44.09, +15, 54, 15.1, 6.08 },
-    { 20, 39, 38.30, +15, 54, 42.8, 3.77 },
-    { 4, 39, 16.49, +15, 55, 5.2, 4.69 },
-    { 7, 8, 22.01, +15, 55, 50.9, 5.44 },
-    { 4, 25, 37.30, +15, 56, 26.9, 6.46 },
-    { 17, 41, 58.70, +15, 57, 6.8, 5.52 },
-    { 4, 28, 34.51, +15, 57, 43.9, 3.84 },
-    { 21, 13, 28.80, +15, 58, 57.0, 6.27 },
-    { 15, 40, 59.21, +16, 1, 28.9, 6.01 },
-    { 20, 3, 30.00, +16, 1, 53.0, 5.67 },
-    { 4, 38, 9.41, +16, 1, 59.9, 5.79 },
-    { 22, 11, 51.29, +16, 2, 26.2, 5.95 },
-    { 5, 11, 41.59, +16, 2, 44.2, 5.18 },
-    { 15, 32, 9.70, +16, 3, 22.0, 6.22 },
-    { 6, 24, 52.90, +16, 3, 24.8, 6.33 },
-    { 15, 53, 34.90, +16, 4, 30.0, 6.09 },
-    { 7, 0, 15.79, +16, 4, 44.0, 5.68 },
-    { 15, 36, 29.30, +16, 7, 8.0, 5.93 },
-    { 12, 52, 27.60, +16, 7, 21.0, 6.30 },
-    { 20, 46, 39.50, +16, 7, 27.1, 4.27 },
-    { 20, 46, 38.71, +16, 7, 27.8, 5.14 },
-    { 6, 12, 3.29, +16, 7, 50.2, 4.95 },
-    { 1, 14, 7.61, +16, 8, 1.0, 5.98 },
-    { 6, 15, 25.10, +16, 8, 35.2, 5.30 },
-    { 7, 13, 22.30, +16, 9, 32.0, 5.00 },
-    { 4, 30, 33.70, +16, 11, 38.0, 4.78 },
-    { 18, 37, 9.00, +16, 11, 53.9, 6.29 },
-    { 6, 49, 49.80, +16, 12, 10.1, 5.85 },
-    { 6, 28, 28.01, +16, 14, 17.9, 6.23 },
-    { 11, 49, 14.90, +16, 14, 34.1, 6.04 },
-    { 17, 24, 31.51, +16, 18, 4.0, 5.71 },
-    { 14, 19, 45.19, +16, 18, 24.8, 4.86 },
-    { 17, 33, 39.41, +16, 19, 3.0, 5.69 },
-    { 4, 28, 26.40, +16, 21, 34.9, 4.97 },
-    { 14, 57, 11.71, +16, 23, 17.9, 5.71 },
-    { 6, 41, 21.79, +16, 23, 51.0, 6.28 },
-    { 6, 37, 42.70, +16, 23, 57.1, 1.93 },
-    { 1, 39, 40.80, +16, 24, 20.9, 5.97 },
-    { 14, 40, 43.90, +16, 25, 4.1, 5.88 },
-    { 14, 40, 43.61, +16, 25, 5.9, 4.94 },
-    { 9, 37, 2.59, +16, 26, 16.1, 5.69 },
-    { 0, 28, 12.70, +16, 26, 42.0, 6.06 },
-    { 8, 1, 30.31, +16, 27, 19.1, 5.99 },
-    { 11, 25, 36.41, +16, 27, 23.0, 5.57 },
-    { 19, 37, 17.40, +16, 27, 46.1, 5.66 },
-    { 18, 10, 8.71, +16, 28, 36.1, 6.09 },
-    { 2, 53, 11.71, +16, 28, 59.9, 6.31 },
-    { 17, 34, 27.19, +16, 30, 14.0, 6.40 },
-    { 4, 35, 55.20, +16, 30, 33.1, 0.85 },
-    { 8, 12, 59.81, +16, 30, 51.1, 6.01 },
-    { 7, 58, 31.49, +16, 31, 7.0, 5.99 },
-    { 5, 41, 17.71, +16, 32, 2.0, 4.86 },
-    { 3, 39, 25.70, +16, 32, 12.1, 6.16 },
-    { 7, 18, 5.59, +16, 32, 25.1, 3.58 },
-    { 23, 5, 6.29, +16, 33, 47.2, 6.44 },
-    { 19, 39, 25.39, +16, 34, 17.0, 6.38 },
-    { 12, 46, 38.71, +16, 34, 39.0, 5.12 },
-    { 9, 25, 32.50, +16, 35, 8.2, 6.29 },
-    { 19, 56, 1.30, +16, 38, 4.9, 5.36 },
-    { 20, 8, 6.50, +16, 39, 51.1, 6.42 },
-    { 16, 11, 28.70, +16, 39, 56.2, 6.08 },
-    { 7, 2, 33.50, +16, 40, 27.1, 5.82 },
-    { 18, 23, 2.90, +16, 41, 17.2, 6.22 },
-    { 5, 23, 37.70, +16, 41, 57.8, 6.08 },
-    { 5, 26, 5.71, +16, 42, 1.1, 6.25 },
-    { 17, 21, 33.41, +16, 43, 50.9, 6.35 },
-    { 18, 0, 3.41, +16, 45, 2.9, 4.67 },
-    { 10, 7, 19.99, +16, 45, 46.1, 3.52 },
-    { 4, 23, 25.01, +16, 46, 37.9, 5.64 },
-    { 19, 57, 45.41, +16, 47, 21.1, 5.53 },
-    { 11, 34, 42.50, +16, 47, 48.8, 5.95 },
-    { 12, 10, 31.61, +16, 48, 33.1, 6.39 },
-    { 20, 59, 50.81, +16, 49, 27.1, 6.66 },
-    { 23, 37, 39.79, +16, 49, 32.2, 6.26 },
-    { 22, 53, 2.30, +16, 50, 28.0, 5.64 },
-    { 19, 12, 34.39, +16, 50, 47.0, 6.73 },
-    { 13, 9, 47.81, +16, 50, 55.0, 5.91 },
-    { 19, 8, 40.20, +16, 51, 5.0, 6.48 },
-    { 19, 7, 57.29, +16, 51, 11.9, 6.07 },
-    { 17, 25, 54.41, +16, 55, 3.0, 5.98 },
-    { 18, 31, 4.39, +16, 55, 43.0, 5.77 },
-    { 19, 24, 22.10, +16, 56, 16.1, 6.25 },
-    { 6, 31, 10.10, +16, 56, 19.0, 6.20 },
-    { 0, 48, 58.70, +16, 56, 26.2, 5.07 },
-    { 22, 54, 35.69, +16, 56, 30.1, 6.12 },
-    { 1, 48, 10.90, +16, 57, 20.2, 5.84 },
-    { 14, 45, 14.50, +16, 57, 51.8, 4.60 },
-    { 18, 35, 53.21, +16, 58, 32.2, 6.21 },
-    { 5, 37, 3.79, +17, 2, 25.1, 5.54 },
-    { 8, 25, 49.90, +17, 2, 46.0, 6.14 },
-    { 16, 8, 4.51, +17, 2, 48.8, 5.00 },
-    { 16, 8, 4.90, +17, 3, 15.8, 6.25 },
-    { 16, 35, 26.30, +17, 3, 25.9, 6.41 },
-    { 5, 32, 14.21, +17, 3, 29.2, 5.46 },
-    { 20, 4, 6.19, +17, 4, 12.0, 5.80 },
-    { 12, 52, 12.31, +17, 4, 26.0, 6.32 },
-    { 7, 31, 48.41, +17, 5, 10.0, 5.42 },
-    { 12, 36, 58.30, +17, 5, 21.8, 5.68 },
-    { 13, 1, 9.60, +17, 7, 23.2, 5.96 },
-    { 15, 33, 52.80, +17, 8, 16.1, 6.45 },
-    { 8, 57, 8.21, +17, 8, 38.0, 6.17 },
-    { 4, 57, 22.30, +17, 9, 13.0, 5.48 },
-    { 6, 16, 23.81, +17, 10, 53.0, 6.39 },
-    { 21, 47, 4.70, +17, 11, 39.1, 6.21 },
-    { 16, 8, 46.61, +17, 12, 20.9, 6.14 },
-    { 2, 9, 23.09, +17, 13, 27.8, 6.43 },
-    { 8, 55, 22.90, +17, 13, 53.0, 6.64 },
-    { 5, 28, 1.61, +17, 14, 20.0, 5.77 },
-    { 15, 44, 42.10, +17, 15, 51.1, 6.14 },
-    { 4, 12, 31.39, +17, 16, 39.0, 6.09 },
-    { 21, 50, 8.71, +17, 17, 8.2, 5.29 },
-    { 4, 0, 36.91, +17, 17, 48.1, 6.32 },
-    { 8, 0, 47.30, +17, 18, 31.0, 5.55 },
-    { 20, 26, 23.21, +17, 18, 56.2, 6.22 },
-    { 17, 18, 4.99, +17, 19, 5.2, 6.00 },
-    { 6, 19, 1.80, +17, 19, 30.0, 6.32 },
-    { 3, 53, 10.01, +17, 19, 36.8, 5.97 },
-    { 4, 7, 59.40, +17, 20, 22.9, 5.89 },
-    { 21, 44, 30.70, +17, 21, .0, 4.34 },
-    { 18, 58, 14.69, +17, 21, 38.9, 5.38 },
-    { 5, 24, 25.39, +17, 22, 59.9, 4.99 },
-    { 15, 52, 56.21, +17, 24, 13.0, 6.36 },
-    { 12, 58, 55.39, +17, 24, 33.8, 4.78 },
-    { 1, 46, 35.30, +17, 24, 47.2, 6.55 },
-    { 1, 35, 54.79, +17, 26, 1.0, 5.80 },
-    { 4, 24, 5.81, +17, 26, 38.0, 4.80 },
-    { 13, 47, 15.70, +17, 27, 24.1, 4.50 },
-    { 2, 49, 17.50, +17, 27, 51.1, 5.22 },
-    { 19, 41, 2.90, +17, 28, 34.0, 4.37 },
-    { 20, 0, 3.31, +17, 31, .1, 5.37 },
-    { 20, 41, 58.20, +17, 31, 17.0, 6.22 },
-    { 13, 9, 59.30, +17, 31, 45.8, 5.22 },
-    { 13, 9, 59.30, +17, 31, 45.8, 5.22 },
-    { 4, 22, 56.09, +17, 32, 33.0, 3.76 },
-    { 23, 10, 42.60, +17, 35, 39.8, 5.71 },
-    { 6, 42, 24.29, +17, 38, 43.1, 5.21 },
-    { 8, 12, 12.70, +17, 38, 52.1, 6.02 },
-    { 8, 12, 12.70, +17, 38, 52.1, 5.63 },
-    { 8, 12, 13.30, +17, 38, 52.1, 6.20 },
-    { 15, 35, 33.19, +17, 39, 20.2, 6.12 },
-    { 7, 39, 28.61, +17, 40, 28.9, 5.05 },
-    { 8, 14, 11.09, +17, 40, 32.9, 6.47 },
-    { 17, 47, 7.99, +17, 41, 49.9, 5.72 },
-    { 2, 30, 54.41, +17, 42, 14.0, 6.23 },
-    { 5, 47, 26.21, +17, 43, 45.1, 5.49 },
-    { 10, 16, 16.10, +17, 44, 25.1, 6.55 },
-    { 7, 2, 25.49, +17, 45, 20.2, 5.94 },
-    { 6, 21, 25.90, +17, 45, 49.0, 6.35 },
-    { 2, 44, 19.10, +17, 45, 50.0, 6.46 },
-    { 12, 20, 43.01, +17, 47, 34.1, 4.74 },
-    { 20, 20, 21.41, +17, 47, 35.2, 5.80 },
-    { 1, 57, 21.10, +17, 49, 3.0, 5.10 },
-    { 16, 1, 14.30, +17, 49, 5.9, 5.12 },
-    { 18, 22, 49.01, +17, 49, 36.1, 5.25 },
-    { 3, 34, 8.30, +17, 49, 58.1, 6.17 },
-    { 3, 7, 25.70, +17, 52, 48.0, 6.11 },
-    { 0, 28, 2.90, +17, 53, 35.2, 5.06 },
-    { 21, 28, 59.90, +17, 54, 20.9, 6.44 },
-    { 6, 14, 28.61, +17, 54, 23.0, 5.88 },
-    { 4, 25, 29.40, +17, 55, 41.2, 4.29 },
-    { 13, 53, 12.91, +17, 55, 58.1, 5.70 },
-    { 5, 27, 10.10, +17, 57, 43.9, 5.42 },
-    { 18, 56, 3.89, +17, 59, 42.0, 6.63 },
-    { 22, 7, 30.00, +18, 0, 2.2, 6.35 },
-    { 19, 40, 5.81, +18, 0, 50.0, 4.37 },
-    { 4, 33, 32.90, +18, 1, .1, 6.25 },
-    { 2, 56, 26.09, +18, 1, 23.2, 5.63 },
-    { 20, 50, 37.01, +18, 3, 5.0, 6.52 },
-    { 17, 20, 18.89, +18, 3, 25.9, 5.00 },
-    { 20, 45, 28.20, +18, 5, 25.1, 6.38 },
-    { 8, 31, 35.71, +18, 5, 39.8, 5.35 },
-    { 18, 56, 6.19, +18, 6, 19.1, 5.69 },
-    { 6, 11, 1.80, +18, 7, 45.8, 6.33 },
-    { 18, 18, 7.70, +18, 7, 53.0, 5.99 },
-    { 8, 59, 10.80, +18, 8, 4.9, 6.38 },
-    { 15, 48, 44.40, +18, 8, 30.1, 4.09 },
-    { 8, 44, 41.09, +18, 9, 15.1, 3.94 },
-    { 18, 47, 1.30, +18, 10, 53.0, 4.36 },
-    { 6, 47, 23.50, +18, 11, 35.9, 6.20 },
-    { 4, 0, 48.79, +18, 11, 38.0, 5.89 },
-    { 18, 35, 12.60, +18, 12, 11.9, 5.78 },
-    { 0, 9, 2.40, +18, 12, 42.8, 5.53 },
-    { 2, 3, 42.60, +18, 15, 11.9, 6.21 },
-    { 13, 39, 2.30, +18, 15, 55.1, 6.48 },
-    { 20, 37, 54.60, +18, 16, 9.1, 6.25 },
-    { 2, 48, 32.11, +18, 17, 1.0, 5.82 },
-    { 14, 38, 13.99, +18, 17, 53.9, 5.91 },
-    { 2, 55, 48.50, +18, 19, 54.1, 5.91 },
-    { 8, 23, 21.79, +18, 19, 55.9, 5.95 },
-    { 1, 29, 52.90, +18, 21, 20.2, 6.02 },
-    { 13, 0, 38.81, +18, 22, 23.2, 6.20 },
-    { 12, 35, 7.80, +18, 22, 36.8, 5.02 },
-    { 12, 35, 6.29, +18, 22, 37.9, 6.56 },
-    { 13, 54, 41.09, +18, 23, 52.1, 2.68 },
-    { 23, 37, 56.81, +18, 24, 2.2, 5.53 },
-    { 11, 30, 28.99, +18, 24, 34.9, 5.52 },
-    { 16, 55, 22.20, +18, 25, 59.9, 5.35 },
-    { 15, 7, 20.40, +18, 26, 30.1, 6.02 },
-    { 22, 25, 40.70, +18, 26, 39.8, 6.26 },
-    { 1, 34, 49.10, +18, 27, 38.2, 5.89 },
-    { 15, 41, 54.70, +18, 27, 50.0, 5.81 },
-    { 20, 3, 16.39, +18, 30, 2.2, 5.96 },
-    { 7, 46, 7.39, +18, 30, 36.0, 4.88 },
-    { 23, 6, 18.19, +18, 31, 3.0, 6.13 },
-    { 19, 47, 23.30, +18, 32, 3.1, 3.82 },
-    { 5, 33, 31.61, +18, 32, 25.1, 5.69 },
-    { 5, 32, 12.79, +18, 35, 39.8, 4.38 },
-    { 15, 55, 39.79, +18, 37, 14.2, 6.26 },
-    { 5, 7, 27.00, +18, 38, 42.0, 5.00 },
-    { 19, 52, 21.79, +18, 40, 18.8, 6.23 },
-    { 6, 13, 33.41, +18, 40, 49.1, 6.58 },
-    { 18, 46, 41.40, +18, 42, 20.9, 6.17 },
-    { 13, 13, 12.41, +18, 43, 36.8, 6.11 },
-    { 4, 46, 16.80, +18, 44, 6.0, 6.01 },
-    { 4, 20, 25.10, +18, 44, 33.0, 6.12 },
-    { 13, 12, 35.90, +18, 45, 6.1, 6.53 },
-    { 3, 27, 3.19, +18, 45, 23.0, 6.57 },
-    { 3, 8, 21.19, +18, 47, 42.0, 6.27 },
-    { 16, 15, 28.70, +18, 48, 29.9, 5.69 },
-    { 8, 50, 45.10, +18, 49, 55.9, 6.16 },
-    { 4, 51, 22.51, +18, 50, 22.9, 5.10 },
-    { 8, 4, 45.19, +18, 50, 31.9, 6.15 },
-    { 9, 44, 30.00, +18, 51, 49.0, 6.50 },
-    { 14, 45, 20.69, +18, 53, 4.9, 6.13 },
-    { 10, 46, 24.50, +18, 53, 29.0, 5.49 },
-    { 16, 25, 47.69, +18, 53, 33.0, 6.70 },
-    { 14, 16, 4.20, +18, 54, 42.8, 5.98 },
-    { 15, 12, 4.30, +18, 58, 32.9, 5.89 },
-    { 4, 24, 57.10, +19, 2, 30.1, 5.98 },
-    { 13, 16, 14.30, +19, 3, 6.1, 6.45 },
-    { 14, 51, 23.30, +19, 6, 4.0, 4.55 },
-    { 23, 52, 29.30, +19, 7, 13.1, 5.08 },
-    { 22, 50, 39.10, +19, 8, 26.9, 6.40 },
-    { 19, 48, 58.70, +19, 8, 31.9, 5.00 },
-    { 14, 53, 23.71, +19, 9, 10.1, 6.01 },
-    { 16, 21, 55.20, +19, 9, 11.2, 3.75 },
-    { 6, 14, 50.90, +19, 9, 23.0, 5.20 },
-    { 1, 26, 15.29, +19, 10, 19.9, 5.38 },
-    { 4, 28, 37.01, +19, 10, 49.1, 3.53 },
-    { 14, 15, 39.70, +19, 10, 57.0, -0.04 },
-    { 0, 54, 35.21, +19, 11, 17.9, 5.74 },
-    { 14, 26, 27.41, +19, 13, 36.8, 5.39 },
-    { 1, 26, 41.69, +19, 14, 25.1, 5.50 },
-    { 17, 48, 47.90, +19, 15, 19.1, 6.12 },
-    { 17, 33, 22.80, +19, 15, 24.1, 5.64 },
-    { 15, 12, 43.49, +19, 17, 8.9, 6.68 },
-    { 1, 53, 31.80, +19, 17, 37.0, 4.75 },
-    { 1, 53, 31.80, +19, 17, 44.9, 4.83 },
-    { 19, 1, 5.50, +19, 18, 34.9, 6.39 },
-    { 21, 37, 45.41, +19, 19, 7.0, 5.45 },
-    { 7, 51, 56.71, +19, 19, 31.1, 5.99 },
-    { 18, 48, 53.40, +19, 19, 43.0, 5.88 },
-    { 21, 0, 27.70, +19, 19, 45.8, 5.65 },
-    { 10, 27, .50, +19, 21, 51.8, 6.15 },
-    { 22, 45, 28.20, +19, 22, .1, 6.25 },
-    { 21, 26, 26.69, +19, 22, 32.2, 6.07 },
-    { 10, 19, 44.09, +19, 28, 14.9, 4.79 },
-    { 22, 7, 28.61, +19, 28, 32.2, 5.75 },
-    { 15, 25, 53.30, +19, 28, 50.9, 6.27 },
-    { 4, 54, 58.30, +19, 29, 7.1, 6.37 },
-    { 19, 58, 45.41, +19, 29, 31.9, 3.47 },
-    { 2, 10, 37.61, +19, 30, 1.1, 5.70 },
-    { 18, 0, 27.70, +19, 30, 20.9, 6.50 },
-    { 22, 38, 52.61, +19, 31, 19.9, 5.82 },
-    { 8, 40, 27.00, +19, 32, 42.0, 6.30 },
-    { 0, 47, 13.61, +19, 34, 44.0, 6.13 },
-    { 8, 35, 19.39, +19, 35, 24.0, 6.58 },
-    { 17, 4, 41.30, +19, 35, 57.1, 6.17 },
-    { 4, 9, 10.01, +19, 36, 33.1, 5.50 },
-    { 19, 18, 48.50, +19, 36, 38.2, 6.58 },
-    { 18, 3, 14.69, +19, 36, 47.2, 6.50 },
-    { 22, 10, 19.01, +19, 37, .8, 6.18 },
-    { 1, 9, 49.20, +19, 39, 31.0, 5.55 },
-    { 19, 2, 52.61, +19, 39, 40.0, 6.09 },
-    { 3, 43, 47.21, +19, 39, 54.0, 6.14 },
-    { 21, 53, 37.39, +19, 40, 5.9, 5.68 },
-    { 8, 40, 22.10, +19, 40, 12.0, 6.44 },
-    { 15, 41, 33.10, +19, 40, 13.1, 4.52 },
-    { 22, 39, 46.99, +19, 40, 52.0, 6.21 },
-    { 17, 3, 52.70, +19, 41, 26.2, 6.35 },
-    { 6, 3, 27.29, +19, 41, 26.2, 5.14 },
-    { 3, 42, 18.91, +19, 42, 1.1, 5.69 },
-    { 21, 54, 17.40, +19, 43, 5.9, 6.39 },
-    { 3, 11, 37.80, +19, 43, 36.1, 4.35 },
-    { 5, 54, 56.71, +19, 44, 58.9, 5.92 },
-    { 10, 44, 14.50, +19, 45, 31.0, 6.27 },
-    { 19, 34, 34.90, +19, 46, 23.9, 5.00 },
-    { 13, 16, 32.30, +19, 47, 7.1, 6.45 },
-    { 6, 12, 1.30, +19, 47, 26.2, 5.75 },
-    { 18, 58, 45.10, +19, 47, 39.1, 6.50 },
-    { 19, 25, 28.61, +19, 47, 55.0, 5.16 },
-    { 21, 22, 5.21, +19, 48, 15.8, 4.08 },
-    { 5, 5, 32.11, +19, 48, 23.0, 6.44 },
-    { 5, 20, 56.59, +19, 48, 51.1, 6.18 },
-    { 8, 0, 48.00, +19, 48, 58.0, 6.25 },
-    { 21, 51, 34.20, +19, 49, 36.1, 5.77 },
-    { 10, 19, 58.61, +19, 50, 26.2, 3.80 },
-    { 10, 19, 58.30, +19, 50, 30.1, 2.61 },
-    { 2, 30, 38.40, +19, 51, 19.1, 6.15 },
-    { 20, 26, 1.20, +19, 51, 54.0, 6.41 },
-    { 5, 52, 23.40, +19, 52, 5.2, 6.06 },
-    { 4, 35, 42.70, +19, 52, 54.1, 6.36 },
-    { 7, 55, 39.91, +19, 53, 2.0, 5.35 },
-    { 19, 26, 28.70, +19, 53, 29.0, 5.81 },
-    { 2, 18, 7.49, +19, 54, 4.0, 5.62 },
-    { 23, 6, 31.90, +19, 54, 38.9, 6.30 },
-    { 20, 40, 45.19, +19, 56, 7.1, 6.45 },
-    { 13, 40, 40.49, +19, 57, 20.2, 5.75 },
-    { 20, 5, 9.50, +19, 59, 28.0, 5.10 },
-    { 8, 40, 6.41, +20, 0, 28.1, 6.39 },
-    { 2, 42, 22.01, +20, 0, 42.1, 5.69 },
-    { 18, 8, 52.90, +20, 2, 43.1, 5.10 },
-    { 17, 26, 49.10, +20, 4, 50.9, 5.54 },
-    { 1, 44, 55.80, +20, 4, 59.2, 6.27 },
-    { 20, 29, 21.10, +20, 5, 16.1, 6.55 },
-    { 19, 26, 13.20, +20, 5, 52.1, 5.63 },
-    { 14, 16, 32.81, +20, 7, 17.0, 6.25 },
-    { 5, 19, 14.69, +20, 8, 4.9, 6.08 },
-    { 6, 3, 55.20, +20, 8, 17.9, 4.63 },
-    { 5, 55, 49.30, +20, 10, 30.0, 5.40 },
-    { 11, 2, 19.80, +20, 10, 46.9, 4.42 },
-    { 19, 15, 2.59, +20, 12, 11.9, 6.00 },
-    { 0, 14, 36.19, +20, 12, 24.1, 4.80 },
-    { 6, 28, 57.79, +20, 12, 43.9, 4.15 },
-    { 11, 47, 59.09, +20, 13, 8.0, 4.53 },
-    { 22, 32, 35.50, +20, 13, 48.0, 6.42 },
-    { 7, 26, 56.30, +20, 15, 25.9, 5.93 },
-    { 19, 23, 46.90, +20, 15, 51.8, 6.40 },
-    { 21, 39, 1.10, +20, 15, 55.1, 5.85 },
-    { 1, 42, 29.81, +20, 16, 7.0, 5.24 },
-    { 19, 25, 22.39, +20, 16, 17.0, 6.31 },
-    { 5, 54, 22.90, +20, 16, 34.0, 4.41 },
-    { 19, 29, 20.90, +20, 16, 46.9, 6.33 },
-    { 0, 32, 35.50, +20, 17, 39.8, 5.38 },
-    { 5, 53, 19.10, +20, 17, 57.1, 6.71 },
-    { 15, 54, 34.61, +20, 18, 38.9, 5.44 },
-    { 7, 45, 9.29, +20, 18, 59.0, 6.33 },
-    { 19, 36, 37.70, +20, 19, 58.1, 7.14 },
-    { 5, 7, 48.41, +20, 25, 5.9, 5.30 },
-    { 8, 32, 42.50, +20, 26, 28.0, 5.33 },
-    { 11, 35, 3.79, +20, 26, 29.0, 6.45 },
-    { 7, 21, 56.81, +20, 26, 37.0, 5.10 },
-    { 21, 49, 26.90, +20, 27, 45.0, 6.29 },
-    { 18, 34, 19.61, +20, 27, 59.0, 6.57 },
-    { 1, 23, 24.91, +20, 28, 8.0, 5.97 },
-    { 5, 33, 38.81, +20, 28, 27.1, 6.18 },
-    { 19, 40, 28.30, +20, 28, 36.1, 6.50 },
-    { 16, 30, 33.60, +20, 28, 45.1, 5.25 },
-    { 6, 27, 56.59, +20, 29, 46.0, 6.22 },
-    { 11, 14, 6.50, +20, 31, 25.0, 2.56 },
-    { 12, 12, 9.31, +20, 32, 30.8, 5.57 },
-    { 18, 45, 39.70, +20, 32, 47.0, 4.19 },
-    { 17, 48, 24.79, +20, 33, 56.2, 5.69 },
-    { 7, 4, 6.50, +20, 34, 13.1, 3.79 },
-    { 15, 18, 24.50, +20, 34, 22.1, 5.70 },
-    { 4, 17, 15.60, +20, 34, 43.0, 4.94 },
-    { 20, 30, 58.10, +20, 36, 20.9, 6.18 },
-    { 2, 58, 5.21, +20, 40, 7.0, 5.80 },
-    { 4, 38, 15.79, +20, 41, 4.9, 5.92 },
-    { 5, 45, 39.41, +20, 41, 42.0, 6.95 },
-    { 1, 7, 57.19, +20, 44, 21.1, 5.55 },
-    { 3, 22, 45.19, +20, 44, 30.8, 5.09 },
-    { 8, 20, 21.00, +20, 44, 52.1, 5.83 },
-    { 22, 57, 27.89, +20, 46, 8.0, 5.49 },
-    { 19, 38, 17.50, +20, 46, 58.1, 6.48 },
-    { 3, 24, 26.09, +20, 48, 13.0, 6.08 },
-    { 1, 54, 38.40, +20, 48, 29.2, 2.64 },
-    { 18, 8, 45.50, +20, 48, 51.8, 4.36 },
-    { 18, 30, 41.59, +20, 48, 55.1, 6.50 },
-    { 4, 22, 22.80, +20, 49, 17.0, 5.91 },
-    { 23, 22, 40.51, +20, 49, 43.0, 6.29 },
-    { 19, 1, 22.61, +20, 50, 1.0, 6.69 },
-    { 18, 2, 23.11, +20, 50, 1.0, 5.28 },
-    { 23, 33, 55.51, +20, 50, 26.9, 6.06 },
-    { 22, 23, 39.60, +20, 50, 53.9, 6.04 },
-    { 5, 48, 22.39, +20, 52, 9.8, 6.07 },
-    { 12, 29, 43.20, +20, 53, 46.0, 5.69 },
-    { 20, 9, 56.59, +20, 54, 55.1, 6.48 },
-    { 3, 39, .10, +20, 54, 56.9, 6.50 },
-    { 0, 47, 54.79, +20, 55, 31.1, 6.54 },
-    { 3, 44, 28.10, +20, 55, 43.0, 6.10 },
-    { 16, 54, 55.20, +20, 57, 31.0, 5.41 },
-    { 15, 51, 15.91, +20, 58, 40.1, 4.76 },
-    { 22, 10, 30.19, +20, 58, 41.2, 6.46 },
-    { 4, 23, 32.40, +20, 58, 55.9, 5.99 },
-    { 20, 34, 10.01, +20, 59, 7.1, 6.48 },
-    { 17, 35, 59.59, +20, 59, 46.0, 6.10 },
-    { 19, 57, .19, +20, 59, 53.2, 6.48 },
-    { 1, 11, 27.19, +21, 2, 4.9, 4.66 },
-    { 3, 14, 54.10, +21, 2, 39.8, 4.89 },
-    { 1, 59, 35.71, +21, 3, 29.9, 5.87 },
-    { 12, 39, 7.30, +21, 3, 45.0, 5.46 },
-    { 14, 41, 54.19, +21, 7, 25.0, 6.38 },
-    { 16, 20, 4.30, +21, 7, 57.0, 6.05 },
-    { 23, 7, 28.70, +21, 8, 3.1, 5.99 },
-    { 20, 11, 3.50, +21, 8, 4.9, 6.22 },
-    { 4, 19, 26.09, +21, 8, 31.9, 5.35 },
-    { 5, 37, 38.69, +21, 8, 33.0, 3.00 },
-    { 3, 21, 13.61, +21, 8, 48.8, 5.28 },
-    { 13, 6, 21.19, +21, 9, 11.9, 5.99 },
-    { 10, 14, 29.69, +21, 10, 4.1, 6.02 },
-    { 9, 49, 50.11, +21, 10, 45.8, 6.09 },
-    { 20, 38, 31.30, +21, 12, 4.0, 4.82 },
-    { 2, 12, 48.10, +21, 12, 38.9, 5.27 },
-    { 19, 15, 17.40, +21, 13, 55.9, 5.64 },
-    { 21, 56, 24.00, +21, 14, 22.9, 6.40 },
-    { 12, 53, 17.81, +21, 14, 42.0, 4.90 },
-    { 7, 10, 6.70, +21, 14, 48.8, 6.43 },
-    { 0, 39, 21.79, +21, 15, 2.2, 5.87 },
-    { 13, 49, 42.79, +21, 15, 51.1, 4.91 },
-    { 19, 3, 42.50, +21, 16, 4.1, 6.52 },
-    { 21, 52, 18.19, +21, 16, 23.2, 6.89 },
-    { 5, 4, 21.60, +21, 16, 41.2, 6.19 },
-    { 9, 13, 37.30, +21, 16, 59.9, 6.48 },
-    { 2, 59, 12.70, +21, 20, 25.1, 4.63 },
-    { 2, 59, 12.70, +21, 20, 25.1, 4.63 },
-    { 11, 40, 47.09, +21, 21, 10.1, 5.26 },
-    { 19, 16, 13.01, +21, 23, 25.1, 4.77 },
-    { 0, 58, 18.89, +21, 24, 15.8, 6.37 },
-    { 20, 25, 40.51, +21, 24, 34.9, 5.66 },
-    { 18, 52, 16.39, +21, 25, 31.1, 5.48 },
-    { 0, 39, 55.61, +21, 26, 17.9, 5.36 },
-    { 7, 27, 44.40, +21, 26, 42.0, 5.22 },
-    { 12, 4, 16.61, +21, 27, 33.1, 5.87 },
-    { 1, 5, 41.69, +21, 27, 55.1, 5.56 },
-    { 8, 43, 17.09, +21, 28, 7.0, 4.66 },
-    { 1, 5, 40.90, +21, 28, 23.9, 5.34 },
-    { 16, 30, 13.20, +21, 29, 22.9, 2.77 },
-    { 7, 26, 50.21, +21, 32, 8.9, 6.54 },
-    { 19, 12, 36.70, +21, 33, 15.8, 5.93 },
-    { 14, 57, 3.60, +21, 33, 19.1, 6.49 },
-    { 4, 18, 23.21, +21, 34, 45.1, 5.65 },
-    { 8, 7, 45.79, +21, 34, 54.1, 5.30 },
-    { 5, 3, 5.71, +21, 35, 24.0, 4.64 },
-    { 18, 1, 29.90, +21, 35, 43.1, 5.18 },
-    { 18, 1, 30.41, +21, 35, 44.2, 4.96 },
-    { 20, 16, 19.70, +21, 35, 55.0, 6.13 },
-    { 4, 28, .79, +21, 37, 12.0, 5.72 },
-    { 18, 5, 30.19, +21, 38, 48.8, 6.15 },
-    { 23, 52, 23.40, +21, 40, 14.9, 6.11 },
-    { 13, 58, 38.90, +21, 41, 46.0, 5.76 },
-    { 19, 8, 3.60, +21, 41, 56.0, 6.23 },
-    { 22, 7, 50.30, +21, 42, 10.1, 5.78 },
-    { 5, 7, 55.49, +21, 42, 16.9, 5.89 },
-    { 6, 51, 33.00, +21, 45, 40.0, 5.27 },
-    { 5, 39, 27.00, +21, 45, 46.1, 6.34 },
-    { 18, 23, 41.90, +21, 46, 10.9, 3.84 },
-    { 4, 19, 36.70, +21, 46, 25.0, 5.38 },
-    { 20, 39, 10.61, +21, 49, 1.9, 6.08 },
-    { 16, 7, 22.20, +21, 49, 21.0, 6.14 },
-    { 6, 11, 51.41, +21, 52, 7.0, 6.56 },
-    { 14, 14, 40.99, +21, 52, 23.9, 6.39 },
-    { 20, 11, 21.10, +21, 52, 32.2, 6.26 },
-    { 18, 13, 16.51, +21, 52, 49.1, 6.12 },
-    { 12, 35, 8.11, +21, 52, 53.0, 5.85 },
-    { 5, 27, 38.11, +21, 56, 12.8, 4.88 },
-    { 10, 2, 48.91, +21, 56, 57.1, 5.66 },
-    { 2, 38, 49.01, +21, 57, 41.0, 5.43 },
-    { 18, 20, 17.90, +21, 57, 41.0, 4.95 },
-    { 14, 40, 21.89, +21, 58, 32.2, 6.10 },
-    { 7, 20, 7.39, +21, 58, 55.9, 3.53 },
-    { 18, 45, 35.69, +21, 59, 6.0, 6.51 },
-    { 9, 10, 20.90, +21, 59, 47.0, 6.01 },
-    { 4, 5, 20.21, +22, 0, 32.0, 5.90 },
-    { 21, 20, 13.99, +22, 1, 35.0, 6.29 },
-    { 6, 39, 5.30, +22, 1, 50.9, 6.04 },
-    { 3, 51, 36.60, +22, 1, 54.1, 6.83 },
-    { 9, 9, 21.50, +22, 2, 44.2, 5.14 },
-    { 15, 0, 52.39, +22, 2, 44.2, 6.38 },
-    { 4, 4, 41.71, +22, 4, 54.8, 4.36 },
-    { 17, 6, 18.10, +22, 5, 3.1, 5.56 },
-    { 5, 19, 16.61, +22, 5, 47.0, 4.94 },
-    { 21, 28, 59.90, +22, 10, 45.8, 5.93 },
-    { 6, 9, 32.40, +22, 11, 24.0, 5.93 },
-    { 16, 31, 13.39, +22, 11, 43.1, 5.76 },
-    { 4, 25, 25.01, +22, 11, 58.9, 5.28 },
-    { 11, 42, 5.21, +22, 12, 38.9, 6.59 },
-    { 18, 6, 1.90, +22, 13, 8.0, 5.06 },
-    { 3, 49, 55.01, +22, 14, 39.8, 6.07 },
-    { 14, 32, 32.50, +22, 15, 36.0, 5.92 },
-    { 19, 1, 49.49, +22, 15, 50.0, 6.40 },
-    { 1, 50, 8.50, +22, 16, 31.1, 5.86 },
-    { 0, 14, 56.11, +22, 17, 3.1, 6.24 },
-    { 5, 15, 27.70, +22, 17, 4.9, 6.27 },
-    { 4, 25, 22.10, +22, 17, 38.0, 4.22 },
-    { 17, 50, 48.41, +22, 18, 59.0, 5.98 },
-    { 20, 58, 16.39, +22, 19, 32.9, 5.31 },
-    { 10, 56, 16.90, +22, 21, 6.1, 6.14 },
-    { 7, 43, 22.20, +22, 23, 57.8, 6.21 },
-    { 6, 1, 41.59, +22, 24, 2.9, 6.37 },
-    { 4, 12, 51.19, +22, 24, 49.0, 6.12 },
-    { 19, 41, 14.90, +22, 27, 10.1, 6.36 },
-    { 21, 10, 31.99, +22, 27, 16.9, 6.68 },
-    { 5, 30, 43.39, +22, 27, 45.0, 6.29 },
-    { 17, 55, 50.81, +22, 27, 51.1, 5.58 },
-    { 3, 56, 52.10, +22, 28, 41.2, 5.63 },
-    { 13, 41, 2.30, +22, 29, 44.9, 5.62 },
-    { 23, 33, 28.10, +22, 29, 56.0, 5.32 },
-    { 6, 14, 52.61, +22, 30, 24.1, 3.28 },
-    { 6, 22, 57.60, +22, 30, 49.0, 2.88 },
-    { 19, 36, 8.30, +22, 35, 8.9, 6.32 },
-    { 19, 51, 4.10, +22, 36, 36.0, 4.95 },
-    { 13, 6, 22.61, +22, 36, 58.0, 5.60 },
-    { 12, 34, 51.10, +22, 37, 45.1, 4.81 },
-    { 17, 0, 58.10, +22, 37, 55.9, 5.65 },
-    { 8, 6, 18.41, +22, 38, 8.2, 5.99 },
-    { 7, 5, 18.41, +22, 38, 13.9, 6.02 },
-    { 18, 54, 44.90, +22, 38, 42.0, 4.59 },
-    { 23, 56, 41.50, +22, 38, 53.2, 6.15 },
-    { 2, 6, 33.91, +22, 38, 53.9, 5.03 },
-    { 12, 39, 2.09, +22, 39, 33.8, 6.38 },
-    { 5, 42, 3.91, +22, 39, 37.1, 6.36 },
-    { 13, 43, 45.19, +22, 42, 1.1, 6.13 },
-    { 7, 7, 21.41, +22, 42, 13.0, 7.68 },
-    { 21, 34, 34.01, +22, 45, 16.9, 6.47 },
-    { 3, 28, 26.59, +22, 48, 15.1, 6.03 },
-    { 16, 2, 17.69, +22, 48, 15.8, 4.83 },
-    { 4, 26, 18.50, +22, 48, 49.0, 4.28 },
-    { 18, 59, 58.10, +22, 48, 52.9, 6.29 },
-    { 12, 50, 17.40, +22, 51, 47.9, 6.43 },
-    { 7, 32, 50.59, +22, 53, 16.1, 6.54 },
-    { 6, 12, 19.10, +22, 54, 29.9, 6.39 },
-    { 18, 2, 30.10, +22, 55, 23.2, 6.21 },
-    { 7, 23, 28.20, +22, 56, 43.1, 6.02 },
-    { 21, 46, 4.39, +22, 56, 56.0, 5.29 },
-    { 4, 42, 14.69, +22, 57, 24.8, 4.28 },
-    { 17, 24, 6.60, +22, 57, 37.1, 5.74 },
-    { 9, 31, 43.20, +22, 58, 5.2, 4.31 },
-    { 9, 7, 26.90, +22, 58, 52.0, 6.40 },
-    { 15, 13, 31.90, +22, 58, 59.9, 6.30 },
-    { 4, 27, 17.50, +22, 59, 47.0, 5.53 },
-    { 7, 40, 58.51, +23, 1, 7.0, 5.89 },
-    { 19, 17, 43.61, +23, 1, 32.2, 5.43 },
-    { 12, 19, 19.10, +23, 2, 4.9, 6.27 },
-    { 23, 29, 5.59, +23, 2, 52.1, 6.35 },
-    { 17, 17, 35.90, +23, 5, 26.9, 6.45 },
-    { 11, 15, 12.19, +23, 5, 44.2, 4.63 },
-    { 19, 59, 10.51, +23, 6, 5.0, 5.67 },
-    { 10, 17, 14.59, +23, 6, 22.0, 5.82 },
-    { 6, 9, 43.99, +23, 6, 47.9, 5.75 },
-    { 8, 13, 41.71, +23, 8, 16.1, 6.56 },
-    { 7, 48, 33.60, +23, 8, 28.0, 6.18 },
-    { 2, 18, 58.01, +23, 10, 4.1, 6.46 },
-    { 3, 57, 3.79, +23, 10, 32.2, 6.06 },
-    { 10, 43, 25.01, +23, 11, 17.9, 5.08 },
-    { 5, 43, 19.51, +23, 12, 15.1, 6.21 },
-    { 20, 4, 58.61, +23, 12, 37.1, 6.45 },
-    { 14, 36, 6.89, +23, 15, 1.1, 6.38 },
-    { 6, 4, 7.20, +23, 15, 47.9, 4.16 },
-    { 18, 22, 8.71, +23, 17, 7.1, 5.41 },
-    { 18, 18, 7.70, +23, 17, 48.1, 6.63 },
-    { 11, 7, 39.70, +23, 19, 25.0, 6.46 },
-    { 5, 41, 54.60, +23, 19, 35.0, 6.59 },
-    { 6, 25, 32.90, +23, 19, 36.8, 6.06 },
-    { 4, 36, 29.21, +23, 20, 26.9, 6.02 },
-    { 21, 32, 27.10, +23, 23, 39.8, 6.70 },
-    { 23, 25, 22.80, +23, 24, 15.1, 4.40 },
-    { 10, 16, 41.40, +23, 25, 1.9, 3.44 },
-    { 0, 57, 12.41, +23, 25, 3.0, 4.42 },
-    { 3, 48, 20.90, +23, 25, 16.0, 5.45 },
-    { 9, 33, 59.09, +23, 27, 14.0, 6.25 },
-    { 2, 7, 10.39, +23, 27, 45.0, 2.00 },
-    { 2, 29, 13.61, +23, 28, 8.0, 6.19 },
-    { 16, 11, 37.99, +23, 29, 40.9, 5.70 },
-    { 10, 16, 32.30, +23, 30, 11.2, 5.97 },
-    { 20, 15, 30.19, +23, 30, 31.0, 5.15 },
-    { 1, 25, 35.71, +23, 30, 42.1, 6.18 },
-    { 18, 48, 16.39, +23, 30, 51.1, 6.15 },
-    { 22, 46, 31.90, +23, 33, 56.2, 3.95 },
-    { 1, 55, 51.00, +23, 34, 37.9, 5.74 },
-    { 8, 1, .70, +23, 34, 59.2, 6.34 },
-    { 18, 44, 40.20, +23, 35, 22.9, 6.31 },
-    { 1, 57, 55.70, +23, 35, 46.0, 4.79 },
-    { 6, 52, .00, +23, 36, 6.1, 5.65 },
-    { 18, 35, 30.41, +23, 36, 20.2, 5.61 },
-    { 20, 6, 53.40, +23, 36, 51.8, 5.07 },
-    { 18, 32, 46.20, +23, 37, .8, 5.84 },
-    { 4, 45, 42.50, +23, 37, 41.2, 6.35 },
-    { 0, 54, 58.01, +23, 37, 41.9, 5.47 },
-    { 21, 29, 56.90, +23, 38, 20.0, 4.57 },
-    { 20, 38, 35.09, +23, 40, 50.2, 5.91 },
-    { 3, 49, 43.51, +23, 42, 42.1, 6.17 },
-    { 19, 40, 39.70, +23, 43, 3.0, 6.64 },
-    { 23, 20, 38.21, +23, 44, 25.1, 4.60 },
-    { 6, 16, 58.70, +23, 44, 26.9, 6.25 },
-    { 17, 15, 41.59, +23, 44, 34.1, 5.96 },
-    { 2, 17, 10.39, +23, 46, 4.1, 6.55 },
-    { 9, 45, 51.10, +23, 46, 27.1, 2.98 },
-    { 13, 25, 6.70, +23, 51, 15.8, 5.78 },
-    { 21, 21, 4.39, +23, 51, 20.9, 5.57 },
-    { 18, 29, 35.69, +23, 51, 58.0, 5.90 },
-    { 14, 50, 15.79, +23, 54, 42.8, 5.85 },
-    { 12, 25, 15.10, +23, 55, 34.0, 6.03 },
-    { 18, 4, 40.20, +23, 56, 33.0, 6.34 },
-    { 12, 16, 20.50, +23, 56, 43.1, 4.95 },
-    { 3, 46, 19.61, +23, 56, 53.9, 4.18 },
-    { 4, 57, 48.70, +23, 56, 55.0, 5.79 },
-    { 6, 16, 19.01, +23, 58, 12.0, 6.08 },
-    { 17, 57, 14.30, +23, 59, 44.9, 6.30 },
-    { 0, 37, 7.20, +24, 0, 51.1, 6.47 },
-    { 8, 20, 32.11, +24, 1, 19.9, 5.98 },
-    { 5, 35, 27.10, +24, 2, 21.8, 5.38 },
-    { 3, 49, 9.70, +24, 3, 11.9, 3.63 },
-    { 19, 53, 27.70, +24, 4, 46.9, 4.58 },
-    { 8, 31, 30.50, +24, 4, 52.0, 5.75 },
-    { 8, 33, .10, +24, 5, 4.9, 6.36 },
-    { 4, 43, 13.80, +24, 5, 20.0, 6.13 },
-    { 23, 14, 36.50, +24, 6, 11.2, 6.36 },
-    { 3, 47, 29.11, +24, 6, 18.0, 2.87 },
-    { 4, 4, 21.70, +24, 6, 20.9, 5.47 },
-    { 12, 29, 26.90, +24, 6, 32.0, 5.48 },
-    { 3, 44, 52.51, +24, 6, 47.9, 3.70 },
-    { 20, 38, 31.90, +24, 6, 58.0, 5.04 },
-    { 7, 12, 26.40, +24, 7, 41.9, 5.85 },
-    { 3, 49, 11.21, +24, 8, 12.1, 5.09 },
-    { 8, 28, 36.79, +24, 8, 40.9, 6.10 },
-    { 2, 12, 37.49, +24, 10, 4.1, 5.96 },
-    { 7, 2, 24.79, +24, 12, 55.1, 5.18 },
-    { 7, 39, 11.90, +24, 13, 21.0, 6.17 },
-    { 17, 11, 3.19, +24, 14, 16.1, 6.19 },
-    { 20, 13, 40.61, +24, 14, 20.0, 6.56 },
-    { 5, 56, 56.09, +24, 14, 58.9, 6.02 },
-    { 19, 6, 38.40, +24, 15, 2.9, 5.77 },
-    { 13, 12, 8.40, +24, 15, 29.2, 6.33 },
-    { 5, 8, 6.60, +24, 15, 55.1, 5.50 },
-    { 0, 47, 20.30, +24, 16, 1.9, 4.06 },
-    { 21, 23, 58.80, +24, 16, 27.1, 5.71 },
-    { 12, 33, 34.20, +24, 16, 59.2, 6.29 },
-    { 3, 44, 48.19, +24, 17, 21.8, 5.46 },
-    { 4, 23, 59.81, +24, 18, 4.0, 6.36 },
-    { 17, 37, 31.10, +24, 18, 36.0, 5.77 },
-    { 19, 54, 31.10, +24, 19, 9.8, 5.52 },
-    { 17, 43, 21.60, +24, 19, 40.1, 5.71 },
-    { 13, 32, 48.10, +24, 20, 47.0, 6.11 },
-    { 7, 38, 14.50, +24, 21, 37.1, 6.27 },
-    { 14, 48, 23.30, +24, 22, .1, 6.14 },
-    { 3, 45, 49.61, +24, 22, 4.1, 3.87 },
-    { 16, 57, 42.31, +24, 22, 53.0, 6.32 },
-    { 9, 51, 52.99, +24, 23, 43.1, 5.32 },
-    { 7, 44, 26.81, +24, 23, 53.2, 3.57 },
-    { 6, 11, 32.30, +24, 25, 13.1, 5.80 },
-    { 20, 22, 3.41, +24, 26, 46.0, 5.54 },
-    { 18, 19, 10.70, +24, 26, 46.0, 5.27 },
-    { 21, 35, 27.00, +24, 27, 7.9, 6.11 },
-    { 9, 2, 44.30, +24, 27, 10.1, 5.45 },
-    { 3, 57, 26.40, +24, 27, 42.8, 6.16 },
-    { 3, 34, 26.59, +24, 27, 51.8, 5.92 },
-    { 3, 45, 12.50, +24, 28, 1.9, 4.30 },
-    { 17, 20, 54.19, +24, 29, 57.8, 5.12 },
-    { 17, 41, 5.50, +24, 30, 47.9, 6.36 },
-    { 3, 46, 2.90, +24, 31, 41.2, 6.43 },
-    { 21, 24, 23.11, +24, 31, 44.0, 6.32 },
-    { 8, 26, 39.79, +24, 32, 3.1, 7.02 },
-    { 8, 26, 40.10, +24, 32, 7.1, 7.81 },
-    { 3, 45, 54.41, +24, 33, 16.9, 5.76 },
-    { 0, 55, 14.69, +24, 33, 24.8, 6.20 },
-    { 23, 35, 55.90, +24, 33, 40.0, 6.45 },
-    { 17, 42, 28.39, +24, 33, 51.1, 5.52 },
-    { 12, 31, .60, +24, 34, 1.9, 5.46 },
-    { 5, 49, 1.01, +24, 34, 3.0, 4.86 },
-    { 1, 13, 44.90, +24, 35, 1.0, 4.65 },
-    { 6, 37, 27.19, +24, 35, 26.9, 6.44 },
-    { 4, 56, 15.60, +24, 35, 31.9, 6.37 },
-    { 6, 39, 31.39, +24, 36, .0, 6.38 },
-    { 22, 50, .19, +24, 36, 6.1, 3.48 },
-    { 13, 36, 59.09, +24, 36, 47.9, 5.74 },
-    { 0, 41, 36.00, +24, 37, 45.1, 6.04 },
-    { 2, 37, .50, +24, 38, 51.0, 6.50 },
-    { 2, 36, 57.70, +24, 38, 53.9, 7.09 },
-    { 16, 51, 45.31, +24, 39, 23.0, 5.04 },
-    { 11, 8, 49.10, +24, 39, 29.9, 5.68 },
-    { 19, 28, 42.29, +24, 39, 54.0, 4.44 },
-    { 20, 16, 47.11, +24, 40, 16.0, 5.32 },
-    { 7, 14, 26.59, +24, 42, 38.9, 6.89 },
-    { 10, 19, .70, +24, 42, 42.1, 6.40 },
-    { 3, 24, 18.50, +24, 43, 27.1, 5.50 },
-    { 10, 55, 37.30, +24, 44, 56.0, 6.30 },
-    { 10, 55, 36.79, +24, 44, 58.9, 4.50 },
-    { 19, 28, 57.00, +24, 46, 7.0, 5.81 },
-    { 23, 15, 57.89, +24, 46, 16.0, 6.60 },
-    { 12, 22, 10.80, +24, 46, 26.0, 6.19 },
-    { 20, 1, 44.69, +24, 48, 1.1, 5.88 },
-    { 17, 15, 1.90, +24, 50, 21.1, 3.14 },
-    { 3, 45, 9.70, +24, 50, 21.1, 5.64 },
-    { 12, 48, 46.99, +24, 50, 25.1, 6.31 },
-    { 16, 41, .60, +24, 51, 31.0, 6.06 },
-    { 15, 7, 18.10, +24, 52, 9.1, 4.93 },
-    { 7, 14, 41.90, +24, 53, 6.0, 5.82 },
-    { 19, 25, 25.80, +24, 54, 46.1, 6.19 },
-    { 20, 2, 1.39, +24, 56, 17.2, 5.22 },
-    { 22, 12, 7.99, +24, 57, .0, 5.92 },
-    { 15, 21, 6.89, +24, 57, 28.1, 6.39 },
-    { 19, 52, 1.61, +24, 59, 31.9, 5.57 },
-    { 15, 2, 6.50, +25, 0, 29.2, 4.81 },
-    { 19, 1, 34.90, +25, 1, 32.9, 6.72 },
-    { 2, 15, 42.79, +25, 2, 35.2, 5.58 },
-    { 18, 49, 14.40, +25, 2, 47.0, 6.59 },
-    { 4, 58, 9.41, +25, 3, 1.1, 5.81 },
-    { 7, 23, 28.51, +25, 3, 2.2, 5.03 },
-    { 8, 1, 43.80, +25, 5, 22.9, 6.31 },
-    { 14, 10, 23.90, +25, 5, 30.1, 4.83 },
-    { 15, 27, 38.90, +25, 6, 6.1, 6.02 },
-    { 15, 8, 35.50, +25, 6, 31.0, 5.81 },
-    { 6, 43, 55.90, +25, 7, 52.0, 2.98 },
-    { 19, 46, 39.50, +25, 8, 2.0, 6.62 },
-    { 23, 57, 45.50, +25, 8, 29.0, 4.66 },
-    { 5, 29, 16.49, +25, 9, 2.2, 5.47 },
-    { 23, 27, 40.39, +25, 10, 1.9, 5.98 },
-    { 9, 23, 31.80, +25, 10, 59.2, 6.41 },
-    { 2, 48, 45.89, +25, 11, 17.2, 5.86 },
-    { 4, 39, 23.11, +25, 13, 5.9, 6.22 },
-    { 11, 44, 13.20, +25, 13, 5.9, 6.02 },
-    { 2, 30, 32.40, +25, 14, 6.0, 5.92 },
-    { 3, 5, 26.71, +25, 15, 19.1, 7.00 },
-    { 3, 5, 26.71, +25, 15, 19.1, 6.80 },
-    { 20, 44, 52.51, +25, 16, 14.2, 4.91 },
-    { 21, 24, 7.39, +25, 18, 43.9, 6.15 },
-    { 3, 40, 46.30, +25, 19, 45.8, 6.11 },
-    { 14, 23, 6.79, +25, 20, 17.2, 6.22 },
-    { 22, 7, .70, +25, 20, 42.0, 3.76 },
-    { 16, 57, 31.01, +25, 21, 10.1, 6.28 },
-    { 10, 16, 41.90, +25, 22, 17.0, 5.84 },
-    { 6, 55, 18.60, +25, 22, 32.2, 5.73 },
-    { 19, 47, 48.60, +25, 23, 2.0, 5.95 },
-    { 8, 0, 55.90, +25, 23, 34.1, 5.83 },
-    { 1, 10, 19.39, +25, 27, 28.1, 5.80 },
-    { 0, 8, 52.20, +25, 27, 46.1, 6.23 },
-    { 23, 7, 6.79, +25, 28, 5.9, 4.76 },
-    { 10, 54, 42.19, +25, 29, 26.9, 6.20 },
-    { 21, 38, 45.00, +25, 29, 56.0, 6.16 },
-    { 10, 56, 34.39, +25, 30, .0, 6.35 },
-    { 17, 2, 18.70, +25, 30, 20.2, 5.75 },
-    { 8, 10, 27.19, +25, 30, 25.9, 5.73 },
-    { 17, 20, 9.79, +25, 32, 15.0, 5.38 },
-    { 22, 8, 17.21, +25, 32, 37.0, 6.11 },
-    { 21, 46, 24.00, +25, 33, 47.9, 6.28 },
-    { 3, 50, 18.91, +25, 34, 45.8, 5.26 },
-    { 12, 24, 26.71, +25, 34, 58.1, 6.42 },
-    { 20, 15, 15.91, +25, 35, 30.8, 4.78 },
-    { 17, 48, 49.20, +25, 37, 22.1, 5.12 },
-    { 4, 22, 34.90, +25, 37, 45.1, 5.37 },
-    { 2, 43, 51.19, +25, 38, 17.2, 6.35 },
-    { 21, 44, 38.71, +25, 38, 42.0, 4.13 },
-    { 3, 20, 25.61, +25, 39, 46.1, 6.12 },
-    { 13, 46, 43.30, +25, 42, 7.9, 5.95 },
-    { 2, 6, 49.20, +25, 42, 16.9, 6.15 },
-    { 16, 55, 2.09, +25, 43, 50.2, 6.08 },
-    { 1, 41, 18.41, +25, 44, 44.9, 6.17 },
-    { 19, 43, 42.89, +25, 46, 18.8, 5.49 },
-    { 2, 15, 46.01, +25, 46, 59.2, 5.79 },
-    { 7, 44, 6.89, +25, 47, 3.1, 5.31 },
-    { 20, 31, 58.20, +25, 48, 15.8, 6.34 },
-    { 12, 22, 30.31, +25, 50, 46.0, 4.81 },
-    { 12, 11, 51.19, +25, 52, 13.1, 5.66 },
-    { 20, 36, 8.30, +25, 52, 57.0, 6.41 },
-    { 5, 39, 44.21, +25, 53, 48.8, 5.18 },
-    { 12, 28, 44.59, +25, 53, 57.1, 6.65 },
-    { 9, 41, 38.50, +25, 54, 46.1, 6.24 },
-    { 12, 28, 54.70, +25, 54, 46.1, 5.29 },
-    { 6, 59, 27.89, +25, 54, 51.1, 6.40 },
-    { 15, 59, 30.19, +25, 55, 13.1, 2.00 },
-    { 21, 53, 3.79, +25, 55, 30.0, 5.08 },
-    { 2, 3, 39.29, +25, 56, 8.2, 5.63 },
-    { 2, 11, 12.00, +25, 56, 12.8, 6.02 },
-    { 5, 36, 30.19, +25, 56, 21.8, 6.49 },
-    { 2, 9, 25.30, +25, 56, 22.9, 4.98 },
-    { 5, 57, 59.69, +25, 57, 14.0, 4.82 },
-    { 23, 55, 22.99, +25, 57, 18.0, 6.54 },
-    { 12, 20, 17.69, +26, 0, 6.8, 6.15 },
-    { 9, 52, 45.79, +26, 0, 24.8, 3.88 },
-    { 12, 19, 2.09, +26, 0, 28.1, 6.48 },
-    { 17, 55, 25.20, +26, 3, .0, 5.46 },
-    { 15, 49, 35.69, +26, 4, 5.9, 4.63 },
-    { 6, 58, 47.40, +26, 4, 52.0, 6.10 },
-    { 18, 7, 49.49, +26, 5, 51.0, 5.90 },
-    { 12, 24, 18.50, +26, 5, 55.0, 5.18 },
-    { 18, 7, 49.49, +26, 6, 5.0, 5.86 },
-    { 17, 30, 44.30, +26, 6, 38.2, 4.41 },
-    { 21, 24, 34.01, +26, 10, 27.8, 5.68 },
-    { 9, 24, 39.31, +26, 10, 55.9, 4.46 },
-    { 12, 28, 38.11, +26, 13, 36.1, 6.54 },
-    { 18, 59, 45.50, +26, 13, 50.2, 5.27 },
-    { 19, 22, 50.90, +26, 15, 45.0, 5.18 },
-    { 19, 1, 17.40, +26, 17, 29.0, 5.69 },
-    { 15, 42, 44.59, +26, 17, 44.2, 3.84 },
-    { 15, 8, 23.81, +26, 18, 4.0, 5.67 },
-    { 10, 43, 1.80, +26, 19, 32.2, 5.51 },
-    { 18, 26, 40.90, +26, 26, 57.8, 6.53 },
-    { 20, 37, 4.70, +26, 27, 42.8, 5.59 },
-    { 3, 1, 54.10, +26, 27, 43.9, 5.90 },
-    { 20, 12, .70, +26, 28, 44.0, 5.92 },
-    { 4, 10, 49.90, +26, 28, 50.9, 5.41 },
-    { 14, 43, 25.39, +26, 31, 40.1, 4.81 },
-    { 23, 21, 58.20, +26, 36, 32.0, 6.62 },
-    { 19, 31, 21.79, +26, 37, 1.9, 5.87 },
-    { 5, 38, 57.41, +26, 37, 4.1, 6.37 },
-    { 12, 20, 19.70, +26, 37, 9.8, 5.54 },
-    { 9, 8, 47.30, +26, 37, 45.1, 5.98 },
-    { 0, 4, 55.99, +26, 38, 56.0, 6.25 },
-    { 18, 46, 4.49, +26, 39, 43.9, 4.83 },
-    { 16, 12, 45.31, +26, 40, 14.9, 6.50 },
-    { 22, 5, 11.40, +26, 40, 26.0, 5.78 },
-    { 14, 32, 20.21, +26, 40, 37.9, 6.01 },
-    { 15, 34, 41.30, +26, 42, 52.9, 2.23 },
-    { 19, 11, 30.91, +26, 44, 8.9, 6.36 },
-    { 22, 29, 10.20, +26, 45, 47.2, 5.79 },
-    { 7, 53, 29.81, +26, 45, 56.9, 4.97 },
-    { 20, 11, 48.00, +26, 48, 32.0, 5.49 },
-    { 12, 26, 59.30, +26, 49, 32.2, 5.00 },
-    { 23, 11, 49.20, +26, 50, 49.9, 6.17 },
-    { 7, 11, 23.11, +26, 51, 24.1, 5.78 },
-    { 15, 57, 35.30, +26, 52, 40.1, 4.15 },
-    { 17, 26, .91, +26, 52, 44.0, 6.41 },
-    { 7, 35, 55.30, +26, 53, 44.9, 4.06 },
-    { 3, 10, 27.00, +26, 53, 47.0, 6.02 },
-    { 20, 10, 33.50, +26, 54, 15.1, 5.52 },
-    { 16, 41, 36.70, +26, 55, .8, 5.92 },
-    { 0, 0, 23.90, +26, 55, 5.9, 6.46 },
-    { 5, 37, 8.81, +26, 55, 27.1, 5.83 },
-    { 21, 6, 23.50, +26, 55, 27.8, 6.12 },
-    { 8, 26, 46.80, +26, 56, 3.8, 6.32 },
-    { 22, 21, .10, +26, 56, 7.1, 6.47 },
-    { 8, 26, 46.99, +26, 56, 7.1, 6.30 },
-    { 4, 38, 29.59, +26, 56, 24.0, 6.47 },
-    { 15, 4, 26.71, +26, 56, 51.0, 4.54 },
-    { 6, 28, 56.59, +26, 58, 4.1, 6.47 },
-    { 0, 13, 24.00, +26, 59, 13.9, 6.30 },
-    { 2, 27, 7.01, +27, 0, 47.9, 6.18 },
-    { 12, 20, 41.30, +27, 3, 16.9, 7.13 },
-    { 2, 40, 41.09, +27, 3, 38.9, 5.30 },
-    { 3, 19, 55.80, +27, 4, 16.0, 5.90 },
-    { 14, 44, 59.21, +27, 4, 27.1, 2.70 },
-    { 14, 44, 59.21, +27, 4, 30.0, 5.12 },
-    { 0, 2, 10.20, +27, 4, 54.8, 5.75 },
-    { 20, 52, 7.70, +27, 5, 48.8, 4.59 },
-    { 19, 43, 55.90, +27, 8, 8.2, 6.28 },
-    { 10, 13, 49.80, +27, 8, 8.9, 6.04 },
-    { 17, 1, 9.60, +27, 11, 47.0, 6.55 },
-    { 0, 55, 58.49, +27, 12, 33.8, 6.09 },
-    { 8, 20, 3.91, +27, 13, 4.1, 5.14 },
-    { 7, 12, 49.01, +27, 13, 28.9, 6.43 },
-    { 0, 36, 19.99, +27, 15, 16.9, 6.50 },
-    { 3, 12, 14.21, +27, 15, 24.8, 5.79 },
-    { 2, 49, 58.99, +27, 15, 38.2, 3.63 },
-    { 1, 19, 28.01, +27, 15, 51.1, 4.76 },
-    { 12, 26, 24.10, +27, 16, 5.9, 4.95 },
-    { 12, 10, 46.10, +27, 16, 53.0, 6.01 },
-    { 0, 15, 10.61, +27, 16, 59.2, 6.35 },
-    { 19, 47, 37.90, +27, 18, 40.0, },
-    { 4, 20, 21.31, +27, 21, 2.9, 4.95 },
-    { 14, 1, 10.49, +27, 23, 12.1, 6.23 },
-    { 18, 24, 58.49, +27, 23, 43.1, 6.27 },
-    { 10, 18, 10.30, +27, 24, 55.1, 6.52 },
-    { 16, 15, 47.40, +27, 25, 19.9, 6.14 },
-    { 19, 15, 57.00, +27, 27, 20.2, 6.54 },
-    { 13, 56, 34.20, +27, 29, 30.8, 5.01 },
-    { 8, 5, 37.01, +27, 31, 46.9, 6.21 },
-    { 12, 51, 41.90, +27, 32, 26.2, 4.94 },
-    { 12, 49, 17.40, +27, 33, 7.9, 5.78 },
-    { 13, 7, 53.59, +27, 33, 20.9, 6.19 },
-    { 3, 31, 20.81, +27, 34, 18.8, 5.96 },
-    { 6, 1, .41, +27, 34, 19.9, 6.05 },
-    { 0, 32, 34.51, +27, 34, 50.2, 6.67 },
-    { 4, 6, 36.41, +27, 36, .0, 5.20 },
-    { 3, 22, 11.90, +27, 36, 27.0, 5.52 },
-    { 21, 27, 40.10, +27, 36, 31.0, 5.41 },
-    { 5, 53, 19.61, +27, 36, 43.9, 4.58 },
-    { 13, 7, 10.70, +27, 37, 28.9, 4.80 },
-    { 7, 24, 33.41, +27, 38, 17.2, 5.76 },
-    { 5, 35, 55.49, +27, 39, 43.9, 6.27 },
-    { 5, 4, 37.90, +27, 41, 46.0, 6.60 },
-    { 2, 43, 27.10, +27, 42, 25.9, 4.66 },
-    { 0, 49, 53.21, +27, 42, 37.1, 7.10 },
-    { 0, 49, 52.80, +27, 42, 38.9, 7.00 },
-    { 17, 46, 27.50, +27, 43, 14.2, 3.42 },
-    { 20, 1, 6.10, +27, 45, 13.0, 4.64 },
-    { 9, 58, 26.09, +27, 45, 32.0, 6.30 },
-    { 11, 36, 17.90, +27, 46, 52.0, 5.80 },
-    { 8, 3, 31.10, +27, 47, 39.1, 4.94 },
-    { 7, 25, 43.61, +27, 47, 53.2, 3.79 },
-    { 22, 16, 29.69, +27, 48, 15.1, 6.37 },
-    { 1, 57, 43.80, +27, 48, 15.8, 5.82 },
-    { 20, 15, 46.10, +27, 48, 51.1, 4.52 },
-    { 3, 10, 8.81, +27, 49, 12.0, 6.42 },
-    { 13, 11, 52.39, +27, 52, 41.2, 4.26 },
-    { 8, 26, 27.70, +27, 53, 37.0, 5.57 },
-    { 4, 52, 47.11, +27, 53, 51.0, 5.97 },
-    { 7, 15, 57.10, +27, 53, 51.0, 5.71 },
-    { 9, 4, 9.89, +27, 53, 53.9, 6.38 },
-    { 9, 1, 48.91, +27, 54, 10.1, 6.07 },
-    { 18, 54, 13.20, +27, 54, 33.8, 5.62 },
-    { 7, 29, 48.70, +27, 54, 58.0, 5.01 },
-    { 19, 15, 59.40, +27, 55, 36.8, 6.16 },
-    { 8, 55, 39.70, +27, 55, 39.0, 5.22 },
-    { 5, 20, 59.30, +27, 57, 25.9, 6.33 },
-    { 19, 30, 43.30, +27, 57, 34.9, 3.08 },
-    { 19, 30, 45.31, +27, 57, 55.1, 5.11 },
-    { 5, 50, 58.10, +27, 58, 4.1, 5.56 },
-    { 10, 49, 53.71, +27, 58, 26.0, 6.04 },
-    { 6, 35, 12.10, +28, 1, 19.9, 5.27 },
-    { 7, 45, 18.91, +28, 1, 34.0, 1.14 },
-    { 5, 9, 45.10, +28, 1, 50.2, 6.01 },
-    { 20, 54, 33.60, +28, 3, 27.0, 5.01 },
-    { 13, 40, 39.10, +28, 3, 55.1, 6.23 },
-    { 23, 3, 46.51, +28, 4, 58.1, 2.42 },
-    { 19, 24, 22.39, +28, 5, 16.1, 6.53 },
-    { 7, 29, 20.40, +28, 7, 5.2, 5.05 },
-    { 15, 48, 34.39, +28, 9, 24.1, 5.85 },
-    { 12, 19, 29.59, +28, 9, 24.8, 6.33 },
-    { 7, 7, 25.01, +28, 10, 37.9, 6.48 },
-    { 17, 36, 7.90, +28, 11, 4.9, 6.38 },
-    { 6, 41, 21.00, +28, 11, 47.0, 6.42 },
-    { 21, 35, 19.01, +28, 11, 49.9, 6.31 },
-    { 23, 15, 46.30, +28, 14, 52.1, 6.49 },
-    { 20, 51, 28.20, +28, 15, 2.2, 5.77 },
-    { 8, 52, 28.61, +28, 15, 33.1, 6.23 },
-    { 6, 39, 33.10, +28, 15, 47.2, 6.03 },
-    { 12, 26, 56.30, +28, 16, 5.9, 4.36 },
-    { 3, 3, 30.31, +28, 16, 10.9, 6.36 },
-    { 0, 32, 49.10, +28, 16, 49.1, 6.30 },
-    { 14, 28, 31.51, +28, 17, 21.1, 7.62 },
-    { 14, 28, 33.29, +28, 17, 26.9, 7.12 },
-    { 22, 21, 19.30, +28, 19, 50.2, 4.81 },
-    { 8, 52, 35.81, +28, 19, 50.9, 5.95 },
-    { 9, 33, 18.29, +28, 22, 5.2, 6.53 },
-    { 23, 31, 43.10, +28, 24, 13.0, 6.41 },
-    { 17, 31, 49.61, +28, 24, 27.0, 5.62 },
-    { 19, 49, 54.60, +28, 26, 26.2, 6.38 },
-    { 20, 54, 22.39, +28, 31, 18.8, 6.56 },
-    { 1, 14, 4.99, +28, 31, 46.9, 6.43 },
-    { 12, 12, 1.20, +28, 32, 10.0, 6.49 },
-    { 5, 26, 17.50, +28, 36, 27.0, 1.65 },
-    { 22, 13, 38.59, +28, 36, 29.9, 5.89 },
-    { 4, 41, 19.80, +28, 36, 54.0, 5.78 },
-    { 14, 49, 58.39, +28, 36, 56.9, 5.80 },
-    { 19, 6, 37.70, +28, 37, 43.0, 5.55 },
-    { 2, 18, 57.00, +28, 38, 33.0, 5.03 },
-    { 13, 53, 10.30, +28, 38, 53.2, 5.90 },
-    { 10, 16, 28.10, +28, 40, 57.0, 6.49 },
-    { 20, 14, 14.50, +28, 41, 40.9, 5.18 },
-    { 1, 21, 7.39, +28, 44, 17.2, 5.23 },
-    { 21, 44, 8.59, +28, 44, 34.1, 4.73 },
-    { 21, 44, 8.30, +28, 44, 35.2, 6.08 },
-    { 17, 21, 31.20, +28, 45, 29.2, 6.35 },
-    { 8, 46, 41.81, +28, 45, 36.0, 4.02 },
-    { 18, 7, 32.59, +28, 45, 45.0, 3.83 },
-    { 8, 46, 40.01, +28, 45, 55.1, 6.57 },
-    { 18, 51, 35.90, +28, 47, 1.0, 6.18 },
-    { 21, 52, 29.90, +28, 47, 35.9, 5.53 },
-    { 17, 18, 48.50, +28, 49, 23.2, 5.65 },
-    { 23, 49, 39.41, +28, 50, 33.0, 5.97 },
-    { 18, 21, 1.01, +28, 52, 12.0, 5.12 },
-    { 7, 43, 18.70, +28, 53, 1.0, 4.28 },
-    { 5, 23, 22.90, +28, 56, 12.1, 6.46 },
-    { 12, 17, 30.50, +28, 56, 13.9, 5.70 },
-    { 5, 56, 33.79, +28, 56, 31.9, 6.32 },
-    { 4, 34, 37.99, +28, 57, 40.0, 5.88 },
-    { 22, 5, 34.70, +28, 57, 50.0, 5.70 },
-    { 6, 44, 45.50, +28, 58, 14.9, 5.44 },
-    { 6, 38, 22.99, +28, 59, 3.1, 5.79 },
-    { 0, 57, 50.21, +28, 59, 31.9, 5.42 },
-    { 4, 7, .50, +29, 0, 5.0, 5.23 },
-    { 0, 6, 36.79, +29, 1, 17.0, 6.13 },
-    { 13, 6, 10.20, +29, 1, 45.8, 6.54 },
-    { 3, 20, 20.40, +29, 2, 53.9, 4.47 },
-    { 3, 9, 36.70, +29, 4, 36.8, 5.72 },
-    { 0, 8, 23.30, +29, 5, 26.2, 2.06 },
-    { 15, 27, 49.70, +29, 6, 20.9, 3.68 },
-    { 20, 17, 31.51, +29, 8, 53.2, 6.22 },
-    { 16, 16, 44.81, +29, 9, 1.1, 5.78 },
-    { 15, 14, 29.21, +29, 9, 51.1, 5.26 },
-    { 5, 29, 40.61, +29, 11, 11.0, 6.24 },
-    { 18, 14, 43.99, +29, 12, 25.9, 6.56 },
-    { 5, 39, 18.41, +29, 12, 55.1, 5.96 },
-    { 2, 47, 54.50, +29, 14, 49.9, 4.51 },
-    { 17, 57, 45.91, +29, 14, 52.1, 3.70 },
-    { 19, 44, 48.70, +29, 15, 52.9, 6.82 },
-    { 22, 41, 45.41, +29, 18, 27.0, 4.79 },
-    { 10, 16, 14.40, +29, 18, 38.2, 5.35 },
-    { 0, 38, 33.31, +29, 18, 42.1, 4.37 },
-    { 17, 50, 22.90, +29, 19, 19.9, 5.50 },
-    { 19, 42, 49.10, +29, 19, 54.1, 6.49 },
-    { 19, 37, 9.41, +29, 20, 1.0, 6.43 },
-    { 7, 3, 30.41, +29, 20, 13.9, 5.93 },
-    { 23, 43, 59.50, +29, 21, 42.1, 4.93 },
-    { 10, 48, 57.19, +29, 24, 56.9, 6.15 },
-    { 23, 13, 4.01, +29, 26, 30.1, 6.35 },
-    { 19, 34, 50.90, +29, 27, 47.2, 5.38 },
-    { 5, 41, 21.00, +29, 29, 15.0, 6.43 },
-    { 6, 15, 22.70, +29, 29, 53.2, 4.35 },
-    { 6, 6, 22.51, +29, 30, 45.0, 6.08 },
-    { 6, 21, 12.10, +29, 32, 28.0, 6.43 },
-    { 22, 31, 34.20, +29, 32, 34.1, 6.35 },
-    { 5, 21, 12.70, +29, 34, 12.0, 5.76 },
-    { 1, 53, 4.90, +29, 34, 44.0, 3.41 },
-    { 10, 23, 41.81, +29, 36, 56.9, 6.39 },
-    { 15, 20, 8.50, +29, 36, 58.0, 5.51 },
-    { 19, 24, 7.61, +29, 37, 17.0, 4.97 },
-    { 9, 59, 36.19, +29, 38, 43.1, 5.73 },
-    { 20, 53, 7.39, +29, 38, 57.8, 6.34 },
-    { 9, 8, .10, +29, 39, 15.1, 5.43 },
-    { 8, 13, 8.90, +29, 39, 24.1, 5.64 },
-    { 1, 4, 27.60, +29, 39, 31.0, 6.19 },
-    { 18, 19, 52.10, +29, 39, 58.0, 5.99 },
-    { 2, 28, 10.01, +29, 40, 9.8, 5.29 },
-    { 6, 24, 52.61, +29, 42, 25.9, 6.71 },
-    { 14, 34, 40.80, +29, 44, 42.0, 4.46 },
-    { 0, 30, 7.30, +29, 45, 6.1, 5.23 },
-    { 23, 14, 21.70, +29, 46, 18.1, 6.41 },
-    { 20, 40, 36.19, +29, 48, 19.1, 6.08 },
-    { 16, 50, 39.00, +29, 48, 24.1, 5.72 },
-    { 18, 25, 58.80, +29, 49, 44.0, 5.83 },
-    { 16, 1, 26.59, +29, 51, 4.0, 4.99 },
-    { 18, 20, 57.10, +29, 51, 32.0, 5.63 },
-    { 20, 3, 37.39, +29, 53, 48.1, 5.71 },
-    { 21, 14, 10.30, +29, 54, 4.0, 6.17 },
-    { 19, 5, 47.11, +29, 55, 18.1, 6.31 },
-    { 2, 28, 48.50, +29, 55, 54.8, 5.89 },
-    { 6, 44, 12.10, +29, 56, 42.0, },
-    { 9, 43, 33.29, +29, 58, 27.8, 5.64 },
-    { 15, 36, 53.40, +29, 59, 28.0, 6.52 },
-    { 1, 41, 39.19, +30, 2, 49.9, 5.99 },
-    { 21, 36, 13.90, +30, 3, 20.2, 6.36 },
-    { 1, 12, 59.50, +30, 3, 51.1, 6.19 },
-    { 1, 11, 39.60, +30, 5, 22.9, 4.51 },
-    { 19, 39, 22.61, +30, 9, 11.9, 4.69 },
-    { 21, 49, 50.69, +30, 10, 27.1, 5.04 },
-    { 2, 20, 4.39, +30, 11, 17.9, 6.47 },
-    { 17, 58, 30.19, +30, 11, 21.8, 4.41 },
-    { 19, 55, 6.50, +30, 11, 43.1, 6.57 },
-    { 21, 8, 38.90, +30, 12, 20.9, 5.59 },
-    { 5, 27, 8.30, +30, 12, 31.0, 5.74 },
-    { 22, 43, .10, +30, 13, 17.0, 2.94 },
-    { 21, 12, 56.21, +30, 13, 36.8, 3.20 },
-    { 8, 57, 58.70, +30, 14, 1.0, 6.29 },
-    { 7, 11, 8.40, +30, 14, 43.1, 4.41 },
-    { 12, 18, 31.61, +30, 14, 57.1, 6.23 },
-    { 15, 23, 12.31, +30, 17, 16.1, 6.08 },
-    { 15, 23, 12.31, +30, 17, 16.1, 5.58 },
-    { 2, 12, 22.30, +30, 18, 11.2, 4.94 },
-    { 21, 22, 41.90, +30, 18, 34.9, 6.05 },
-    { 20, 38, 59.50, +30, 20, 3.8, 5.68 },
-    { 4, 28, 51.89, +30, 21, 41.0, 6.40 },
-    { 20, 29, 23.71, +30, 22, 7.0, 4.01 },
-    { 14, 31, 49.80, +30, 22, 17.0, 3.58 },
-    { 23, 20, 49.61, +30, 24, 54.0, 5.59 },
-    { 14, 20, 8.71, +30, 25, 45.1, 6.44 },
-    { 5, 31, 59.10, +30, 26, 45.0, },
-    { 18, 9, 10.20, +30, 28, 9.8, 6.38 },
-    { 5, 38, 38.11, +30, 29, 33.0, 5.40 },
-    { 6, 28, 34.10, +30, 29, 35.2, 5.55 },
-    { 5, 4, 14.50, +30, 29, 40.9, 6.14 },
-    { 19, 15, 24.79, +30, 31, 35.0, 5.85 },
-    { 22, 10, 51.60, +30, 33, 11.2, 6.32 },
-    { 18, 32, 49.90, +30, 33, 15.1, 5.48 },
-    { 3, 15, 20.50, +30, 33, 24.1, 5.52 },
-    { 18, 7, 1.51, +30, 33, 42.8, 5.04 },
-    { 8, 54, 14.69, +30, 34, 45.8, 5.39 },
-    { 19, 43, 9.50, +30, 40, 43.0, 6.05 },
-    { 10, 45, 51.89, +30, 40, 55.9, 5.24 },
-    { 8, 45, 21.41, +30, 41, 52.1, 6.13 },
-    { 20, 45, 39.70, +30, 43, 10.9, 4.22 },
-    { 19, 4, 58.30, +30, 43, 59.9, 6.06 },
-    { 13, 0, 16.51, +30, 47, 6.0, 4.90 },
-    { 17, 36, 36.70, +30, 47, 7.1, 6.02 },
-    { 18, 40, 1.99, +30, 50, 57.8, 6.36 },
-    { 0, 39, 19.70, +30, 51, 38.9, 3.27 },
-    { 16, 22, 5.81, +30, 53, 30.8, 4.85 },
-    { 18, 33, 23.11, +30, 53, 33.0, 6.59 },
-    { 17, 0, 17.40, +30, 55, 35.0, 3.92 },
-    { 0, 20, 24.41, +30, 56, 8.9, 5.90 },
-    { 7, 18, 4.10, +30, 57, 20.9, 6.24 },
-    { 7, 35, 8.69, +30, 57, 40.0, 5.33 },
-    { 9, 10, 38.71, +30, 57, 47.2, 5.95 },
-    { 22, 41, 31.39, +30, 57, 56.9, 6.34 },
-    { 19, 58, 37.99, +30, 59, 1.0, 5.49 },
-    { 13, 40, 15.60, +31, 0, 42.8, 6.21 },
-    { 19, 18, .79, +31, 1, 19.9, 6.68 },
-    { 6, 1, 10.20, +31, 2, 4.9, 5.98 },
-    { 3, 55, 22.99, +31, 2, 44.9, 6.10 },
-    { 23, 0, 42.50, +31, 4, 59.2, 6.60 },
-    { 5, 24, 38.50, +31, 8, 35.2, 5.94 },
-    { 17, 30, 55.39, +31, 9, 29.9, 5.61 },
-    { 9, 36, 42.91, +31, 9, 42.1, 5.56 },
-    { 3, 52, 4.30, +31, 10, 5.9, 6.25 },
-    { 21, 6, 30.31, +31, 11, 4.9, 5.82 },
-    { 13, 48, 38.71, +31, 11, 25.1, 5.62 },
-    { 17, 39, 57.50, +31, 12, 9.0, 6.03 },
-    { 5, 24, 38.30, +31, 13, 26.0, 6.28 },
-    { 20, 22, 37.39, +31, 15, 54.0, 6.09 },
-    { 9, 41, 35.21, +31, 16, 41.2, 5.89 },
-    { 19, 11, 46.01, +31, 16, 59.9, 5.98 },
-    { 15, 30, 22.70, +31, 17, 10.0, 6.46 },
-    { 17, 40, 41.21, +31, 17, 15.0, 6.28 },
-    { 23, 33, 57.19, +31, 19, 31.1, 4.98 },
-    { 5, 40, 35.90, +31, 21, 29.2, 6.04 },
-    { 15, 32, 55.80, +31, 21, 33.1, 4.14 },
-    { 18, 11, 54.19, +31, 24, 19.1, 4.97 },
-    { 1, 11, 6.79, +31, 25, 28.9, 5.16 },
-    { 4, 49, 12.79, +31, 26, 13.9, 5.58 },
-    { 4, 26, 6.31, +31, 26, 20.0, 5.28 },
-    { 10, 15, 6.29, +31, 28, 5.2, 6.46 },
-    { 17, 45, 40.30, +31, 30, 16.9, 6.23 },
-    { 0, 18, 38.30, +31, 31, 1.9, 5.87 },
-    { 20, 37, 32.59, +31, 31, 18.8, 6.49 },
-    { 2, 11, 25.01, +31, 31, 35.0, 6.23 },
-    { 11, 18, 10.90, +31, 31, 45.1, 4.87 },
-    { 11, 18, 10.99, +31, 31, 45.1, 4.41 },
-    { 0, 15, 7.01, +31, 32, 8.9, 6.45 },
-    { 20, 37, 31.80, +31, 34, 21.0, 6.32 },
-    { 16, 41, 17.21, +31, 36, 11.2, 2.81 },
-    { 10, 8, 15.91, +31, 36, 15.1, 6.24 },
-    { 2, 36, 42.89, +31, 36, 27.0, 6.10 },
-    { 18, 41, 41.30, +31, 37, 4.1, 6.41 },
-    { 18, 49, 43.99, +31, 37, 45.1, 6.64 },
-    { 10, 42, 11.30, +31, 41, 48.8, 6.02 },
-    { 5, 54, 58.99, +31, 42, 6.1, 5.90 },
-    { 16, 52, 58.10, +31, 42, 6.1, 5.32 },
-    { 15, 48, 1.99, +31, 44, 8.9, 6.44 },
-    { 19, 4, 57.89, +31, 44, 39.8, 5.56 },
-    { 1, 17, 24.10, +31, 44, 40.9, 6.73 },
-    { 11, 41, 34.30, +31, 44, 46.0, 5.73 },
-    { 18, 47, 57.50, +31, 45, 24.8, 6.06 },
-    { 23, 2, 33.10, +31, 46, 50.2, 6.57 },
-    { 7, 29, 6.70, +31, 47, 3.8, 4.18 },
-    { 15, 14, 6.10, +31, 47, 17.2, 5.99 },
-    { 14, 29, 49.70, +31, 47, 28.0, 6.06 },
-    { 2, 27, 27.70, +31, 48, 5.0, 5.54 },
-    { 1, 2, 49.10, +31, 48, 15.8, 5.50 },
-    { 23, 21, 54.91, +31, 48, 45.0, 5.32 },
-    { 22, 27, 46.20, +31, 50, 25.1, 5.98 },
-    { 3, 54, 7.90, +31, 53, 1.0, 2.85 },
-    { 17, 2, 17.21, +31, 53, 4.9, 6.36 },
-    { 7, 34, 36.00, +31, 53, 17.9, 1.98 },
-    { 7, 34, 36.00, +31, 53, 19.0, 2.88 },
-    { 5, 40, 42.10, +31, 55, 14.9, 6.11 },
-    { 10, 1, .70, +31, 55, 25.0, 5.36 },
-    { 18, 43, 51.60, +31, 55, 36.1, 5.70 },
-    { 2, 57, 17.30, +31, 56, 3.1, 5.11 },
-    { 8, 40, 18.29, +31, 56, 30.8, 6.10 },
-    { 4, 20, 10.01, +31, 57, 11.9, 6.16 },
-    { 10, 38, 43.20, +31, 58, 34.0, 4.71 },
-    { 7, 39, 54.10, +32, 0, 34.9, 6.17 },
-    { 1, 8, 1.30, +32, 0, 43.9, 6.25 },
-    { 13, 56, 10.49, +32, 1, 57.0, 6.32 },
-    { 5, 51, 25.70, +32, 7, 30.0, 6.25 },
-    { 19, 0, .91, +32, 8, 44.2, 4.93 },
-    { 3, 16, 35.11, +32, 11, 1.0, 6.06 },
-    { 20, 23, 51.70, +32, 11, 24.0, 4.43 },
-    { 1, 43, 49.99, +32, 11, 30.1, 6.34 },
-    { 5, 32, 43.70, +32, 11, 30.8, 4.76 },
-    { 3, 47, 48.91, +32, 11, 42.0, 6.25 },
-    { 20, 4, 36.10, +32, 13, 7.0, 5.64 },
-    { 21, 28, 8.30, +32, 13, 31.1, 5.80 },
-    { 18, 5, 49.61, +32, 13, 50.2, 5.71 },
-    { 9, 1, 24.10, +32, 15, 9.0, 5.82 },
-    { 11, 58, 7.20, +32, 16, 26.0, 6.42 },
-    { 3, 44, 19.10, +32, 17, 17.9, 3.83 },
-    { 14, 11, 15.10, +32, 17, 44.2, 6.11 },
-    { 14, 55, 58.70, +32, 18, 1.1, 6.12 },
-    { 20, 41, 2.59, +32, 18, 25.9, 5.51 },
-    { 5, 4, 36.89, +32, 19, 13.1, 6.62 },
-    { 16, 22, 56.50, +32, 19, 59.2, 6.40 },
-    { 9, 4, 55.20, +32, 22, 36.8, 6.46 },
-    { 10, 31, 51.41, +32, 22, 45.8, 5.90 },
-    { 23, 58, 49.20, +32, 22, 54.1, 6.52 },
-    { 23, 24, 50.81, +32, 23, 6.0, 5.57 },
-    { 7, 1, 17.21, +32, 24, 51.8, 6.59 },
-    { 8, 59, 32.59, +32, 25, 7.0, 5.20 },
-    { 19, 42, 44.59, +32, 25, 36.1, 5.94 },
-    { 21, 20, 50.09, +32, 27, 10.1, 5.68 },
-    { 6, 32, 27.19, +32, 27, 16.9, 5.87 },
-    { 4, 30, 38.30, +32, 27, 29.2, 6.21 },
-    { 17, 20, 39.60, +32, 28, 4.1, 5.39 },
-    { 8, 52, 34.61, +32, 28, 27.1, 5.66 },
-    { 19, 7, 25.61, +32, 30, 6.1, 5.23 },
-    { 15, 19, 30.19, +32, 30, 55.1, 6.32 },
-    { 15, 43, 59.30, +32, 30, 56.9, 5.56 },
-    { 23, 23, 47.50, +32, 31, 53.0, 6.69 },
-    { 14, 34, 11.71, +32, 32, 3.8, 6.33 },
-    { 9, 8, 4.10, +32, 32, 26.2, 6.50 },
-    { 18, 49, 52.90, +32, 33, 2.9, 5.25 },
-    { 16, 50, 43.10, +32, 33, 13.0, 6.13 },
-    { 6, 27, 35.50, +32, 33, 47.2, 6.43 },
-    { 22, 30, 1.80, +32, 34, 21.0, 5.65 },
-    { 4, 49, 19.01, +32, 35, 17.9, 5.86 },
-    { 6, 49, 41.30, +32, 36, 24.1, 5.71 },
-    { 21, 21, 22.01, +32, 36, 46.1, 6.04 },
-    { 6, 2, 55.10, +32, 38, 8.9, 6.24 },
-    { 5, 15, 24.41, +32, 41, 16.1, 5.02 },
-    { 18, 58, 56.59, +32, 41, 21.8, 3.24 },
-    { 1, 48, 41.59, +32, 41, 25.1, 5.79 },
-    { 6, 12, 20.09, +32, 41, 35.9, 5.78 },
-    { 17, 38, 49.70, +32, 44, 21.8, 6.37 },
-    { 14, 45, 13.70, +32, 47, 17.9, 6.28 },
-    { 5, 33, 27.50, +32, 48, 4.0, 6.48 },
-    { 8, 38, 19.01, +32, 48, 6.8, 5.94 },
-    { 18, 49, 45.91, +32, 48, 46.1, 5.91 },
-    { 23, 7, 27.70, +32, 49, 32.9, 6.02 },
-    { 20, 52, .31, +32, 50, 57.1, 6.44 },
-    { 3, 15, 46.99, +32, 51, 23.0, 6.31 },
-    { 4, 43, 48.29, +32, 51, 55.1, 6.45 },
-    { 19, 46, 34.99, +32, 53, 19.0, 6.18 },
-    { 2, 37, 6.41, +32, 53, 30.8, 6.25 },
-    { 18, 57, 1.61, +32, 54, 5.0, 5.22 },
-    { 9, 21, 27.19, +32, 54, 6.8, 6.16 },
-    { 23, 36, 30.50, +32, 54, 15.1, 6.35 },
-    { 8, 56, 56.59, +32, 54, 37.1, 5.45 },
-    { 0, 20, 45.50, +32, 54, 41.0, 5.79 },
-    { 19, 50, 33.89, +32, 54, 51.1, 4.23 },
-    { 15, 21, 48.60, +32, 56, 2.0, 5.37 },
-    { 22, 4, 34.39, +32, 56, 30.8, 6.38 },
-    { 22, 0, 26.81, +33, 0, 22.0, 6.46 },
-    { 6, 33, 42.70, +33, 1, 27.1, 6.42 },
-    { 12, 16, 30.10, +33, 3, 41.0, 5.00 },
-    { 3, 49, 32.59, +33, 5, 29.0, 5.11 },
-    { 11, 18, 28.70, +33, 5, 39.1, 3.48 },
-    { 17, 17, 19.49, +33, 6, .0, 4.82 },
-    { 1, 16, 18.79, +33, 6, 52.9, 6.02 },
-    { 4, 56, 59.59, +33, 9, 58.0, 2.69 },
-    { 11, 59, 17.59, +33, 10, 3.0, 5.96 },
-    { 22, 9, 13.61, +33, 10, 19.9, 5.58 },
-    { 22, 9, 59.21, +33, 10, 41.9, 4.29 },
-    { 0, 14, 2.30, +33, 12, 22.0, 6.25 },
-    { 18, 0, 36.41, +33, 12, 50.0, 5.99 },
-    { 19, 23, 34.01, +33, 13, 19.9, 6.37 },
-    { 7, 51, 2.30, +33, 14, 1.0, 6.03 },
-    { 12, 33, 38.90, +33, 14, 51.0, 5.42 },
-    { 5, 26, 51.31, +33, 15, 46.1, 6.15 },
-    { 2, 2, 58.01, +33, 17, 2.0, 5.50 },
-    { 8, 50, 32.21, +33, 17, 7.1, 6.25 },
-    { 16, 1, 2.69, +33, 18, 13.0, 5.41 },
-    { 18, 1, 35.90, +33, 18, 41.0, 6.15 },
-    { 15, 15, 30.19, +33, 18, 52.9, 3.47 },
-    { 16, 11, 39.70, +33, 20, 33.0, 6.29 },
-    { 2, 15, 56.21, +33, 21, 32.0, 5.28 },
-    { 18, 50, 4.80, +33, 21, 46.1, 3.45 },
-    { 5, 18, 10.70, +33, 22, 18.1, 4.54 },
-    { 11, 51, 9.41, +33, 22, 30.0, 6.27 },
-    { 12, 33, 47.40, +33, 23, 4.9, 6.24 },
-    { 19, 19, 3.79, +33, 23, 20.0, 6.60 },
-    { 7, 47, 30.31, +33, 24, 56.2, 5.14 },
-    { 19, 48, 50.59, +33, 26, 13.9, 6.44 },
-    { 20, 53, 53.90, +33, 26, 16.1, 5.47 },
-    { 18, 11, 45.10, +33, 26, 48.8, 5.88 },
-    { 11, 26, 25.49, +33, 27, 2.2, 6.32 },
-    { 18, 36, 37.20, +33, 28, 8.0, 5.42 },
-    { 23, 34, 38.21, +33, 29, 49.9, 5.63 },
-    { 10, 55, 44.40, +33, 30, 24.8, 5.03 },
-    { 19, 22, 33.41, +33, 31, 5.2, 6.06 },
-    { 12, 54, 13.10, +33, 32, 3.8, 6.26 },
-    { 3, 24, 29.69, +33, 32, 8.9, 5.61 },
-    { 5, 37, 45.70, +33, 33, 33.1, 6.33 },
-    { 17, 1, 36.41, +33, 34, 5.9, 5.25 },
-    { 0, 31, 25.61, +33, 34, 54.1, 5.87 },
-    { 4, 10, 58.99, +33, 35, 12.1, 5.72 },
-    { 6, 5, 34.01, +33, 35, 57.1, 6.23 },
-    { 3, 47, 52.61, +33, 36, .0, 6.57 },
-    { 19, 1, 48.31, +33, 37, 17.0, 6.39 },
-    { 11, 38, 32.21, +33, 37, 32.2, 6.27 },
-    { 9, 30, 43.20, +33, 39, 20.2, 5.85 },
-    { 6, 57, .50, +33, 40, 52.0, 5.89 },
-    { 16, 22, 29.21, +33, 42, 13.0, 5.39 },
-    { 10, 24, 8.59, +33, 43, 7.0, 5.50 },
-    { 0, 36, 52.90, +33, 43, 9.8, 4.36 },
-    { 23, 59, 29.21, +33, 43, 27.8, 6.58 },
-    { 23, 59, 29.21, +33, 43, 27.8, 6.58 },
-    { 19, 46, 25.61, +33, 43, 40.1, 4.99 },
-    { 20, 15, 23.71, +33, 43, 45.8, 5.66 },
-    { 5, 19, .00, +33, 44, 53.9, 5.41 },
-    { 5, 18, 18.91, +33, 46, 1.9, 6.14 },
-    { 10, 25, 54.89, +33, 47, 46.0, 4.74 },
-    { 16, 22, 21.41, +33, 47, 57.1, 5.20 },
-    { 19, 0, 55.20, +33, 48, 7.9, 6.01 },
-    { 3, 28, 20.81, +33, 48, 27.0, 5.61 },
-    { 7, 8, 13.30, +33, 49, 55.9, 6.28 },
-    { 2, 30, 16.61, +33, 50, 2.0, 6.25 },
-    { 2, 17, 18.91, +33, 50, 49.9, 4.01 },
-    { 16, 14, 40.80, +33, 51, 29.9, 6.66 },
-    { 16, 14, 40.80, +33, 51, 31.0, 5.64 },
-    { 9, 8, 51.10, +33, 52, 55.9, 5.93 },
-    { 10, 23, 6.29, +33, 54, 29.2, 5.90 },
-    { 5, 52, 40.10, +33, 55, 3.0, 5.98 },
-    { 0, 58, 14.21, +33, 57, 2.9, 5.98 },
-    { 5, 20, .91, +33, 57, 29.2, 5.03 },
-    { 4, 24, 37.39, +33, 57, 34.9, 5.76 },
-    { 6, 52, 47.30, +33, 57, 40.0, 3.60 },
-    { 3, 42, 22.51, +33, 57, 54.0, 4.97 },
-    { 18, 54, 52.51, +33, 58, 7.0, 6.02 },
-    { 20, 46, 12.70, +33, 58, 13.1, 2.46 },
-    { 19, 39, 45.00, +33, 58, 45.1, 6.10 },
-    { 5, 19, 23.59, +33, 59, 8.2, 6.49 },
-    { 7, 42, 43.51, +34, 0, 1.1, 6.02 },
-    { 7, 7, 22.30, +34, 0, 33.8, 5.91 },
-    { 10, 54, 58.20, +34, 2, 4.9, 5.72 },
-    { 11, 59, 57.19, +34, 2, 6.0, 6.50 },
-    { 16, 43, 51.70, +34, 2, 20.0, 5.99 },
-    { 13, 18, 27.79, +34, 5, 53.2, 5.82 },
-    { 4, 24, 29.21, +34, 7, 50.2, 5.73 },
-    { 19, 43, 51.41, +34, 9, 45.0, 6.05 },
-    { 11, 41, 3.00, +34, 12, 6.1, 5.33 },
-    { 10, 53, 18.70, +34, 12, 54.0, 3.83 },
-    { 3, 18, 43.80, +34, 13, 22.1, 4.82 },
-    { 2, 17, 3.19, +34, 13, 27.1, 4.87 },
-    { 1, 23, 37.49, +34, 14, 44.9, 6.29 },
-    { 2, 37, 2.50, +34, 15, 50.0, 5.30 },
-    { 17, 32, 1.10, +34, 16, 14.9, 6.56 },
-    { 5, 16, 18.19, +34, 18, 42.8, 5.96 },
-    { 20, 27, 7.70, +34, 19, 44.0, 6.39 },
-    { 15, 26, 17.40, +34, 20, 8.9, 5.46 },
-    { 3, 51, 53.71, +34, 21, 33.1, 5.77 },
-    { 20, 47, 10.80, +34, 22, 27.1, 4.92 },
-    { 1, 27, 6.19, +34, 22, 39.0, 6.27 },
-    { 5, 26, 48.91, +34, 23, 30.1, 5.94 },
-    { 9, 21, 3.29, +34, 23, 33.0, 3.13 },
-    { 19, 44, 38.21, +34, 24, 50.0, 6.57 },
-    { 20, 7, 41.40, +34, 25, 23.2, 6.11 },
-    { 13, 51, 47.50, +34, 26, 39.1, 4.74 },
-    { 19, 31, 46.30, +34, 27, 11.2, 4.74 },
-    { 18, 35, 13.49, +34, 27, 28.1, 6.10 },
-    { 7, 6, 11.59, +34, 28, 26.0, 5.55 },
-    { 5, 27, 38.90, +34, 28, 32.9, 5.07 },
-    { 2, 32, 52.51, +34, 32, 33.0, 5.83 },
-    { 15, 3, 36.50, +34, 33, 58.0, 6.59 },
-    { 4, 20, 24.60, +34, 34, .1, 4.93 },
-    { 1, 26, 8.69, +34, 34, 46.9, 6.31 },
-    { 7, 39, 9.91, +34, 35, 3.1, 4.90 },
-    { 19, 9, 4.39, +34, 36, 2.2, 6.74 },
-    { 22, 12, 47.81, +34, 36, 16.9, 5.33 },
-    { 9, 15, 14.30, +34, 38, 1.0, 5.97 },
-    { 0, 4, 53.81, +34, 39, 34.9, 6.12 },
-    { 13, 51, 9.19, +34, 39, 51.8, 5.87 },
-    { 15, 38, 48.91, +34, 40, 30.0, 6.11 },
-    { 2, 35, 46.80, +34, 41, 15.0, 5.35 },
-    { 3, 16, 1.90, +34, 41, 19.0, 6.25 },
-    { 17, 26, 46.20, +34, 41, 44.9, 5.94 },
-    { 5, 33, 37.99, +34, 43, 32.9, 6.27 },
-    { 18, 42, 8.11, +34, 44, 48.1, 6.47 },
-    { 13, 51, 4.51, +34, 46, 21.0, 6.65 },
-    { 17, 3, 53.50, +34, 47, 25.1, 6.04 },
-    { 23, 19, 27.41, +34, 47, 35.9, 6.32 },
-    { 1, 32, 7.61, +34, 48, .0, 6.39 },
-    { 3, 58, 3.10, +34, 48, 51.8, 6.53 },
-    { 5, 25, 13.01, +34, 51, 19.1, 6.55 },
-    { 21, 17, 55.10, +34, 53, 48.8, 4.43 },
-    { 11, 49, 41.71, +34, 55, 54.1, 5.70 },
-    { 23, 32, 24.60, +34, 57, 9.0, 6.65 },
-    { 20, 18, 39.10, +34, 58, 58.1, 5.17 },
-    { 2, 9, 32.59, +34, 59, 13.9, 3.00 },
-    { 10, 33, 30.91, +34, 59, 19.0, 5.58 },
-    { 13, 42, 43.39, +34, 59, 20.0, 5.98 },
-    { 8, 25, 4.90, +35, 0, 41.0, 6.06 },
-    { 19, 45, 51.41, +35, 0, 46.1, 6.09 },
-    { 7, 38, 32.81, +35, 2, 55.0, 5.56 },
-    { 2, 51, 30.79, +35, 3, 34.9, 4.53 },
-    { 3, 56, 28.70, +35, 4, 52.0, 5.49 },
-    { 19, 56, 18.41, +35, 4, 59.9, 3.89 },
-    { 9, 42, 42.70, +35, 5, 35.9, 6.14 },
-    { 9, 31, 32.40, +35, 6, 11.2, 5.37 },
-    { 13, 19, 4.20, +35, 7, 41.2, 6.02 },
-    { 2, 59, 3.70, +35, 10, 59.2, 4.93 },
-    { 19, 20, 33.10, +35, 11, 10.0, 6.31 },
-    { 15, 3, 6.10, +35, 12, 20.9, 5.51 },
-    { 16, 31, 2.81, +35, 13, 30.0, 6.25 },
-    { 10, 7, 25.80, +35, 14, 40.9, 4.48 },
-    { 1, 42, 3.50, +35, 14, 44.2, 5.64 },
-    { 20, 33, 54.19, +35, 15, 2.9, 4.61 },
-    { 19, 48, 43.90, +35, 18, 41.0, 6.53 },
-    { 9, 18, 25.99, +35, 21, 51.1, 5.75 },
-    { 6, 6, 8.50, +35, 23, 15.0, 6.12 },
-    { 0, 37, 21.10, +35, 23, 57.8, 5.48 },
-    { 7, 55, 40.80, +35, 24, 46.1, 6.23 },
-    { 8, 1, 55.10, +35, 24, 47.2, 6.34 },
-    { 17, 3, 30.19, +35, 24, 51.1, 6.69 },
-    { 20, 42, 22.20, +35, 27, 22.0, 6.66 },
-    { 5, 26, 54.29, +35, 27, 25.9, 6.15 },
-    { 3, 32, 40.01, +35, 27, 42.1, 5.90 },
-    { 14, 17, 59.81, +35, 30, 33.8, 4.81 },
-    { 21, 42, 1.10, +35, 30, 37.1, 6.07 },
-    { 8, 53, 55.70, +35, 32, 17.9, 6.14 },
-    { 2, 47, 3.50, +35, 33, 18.0, 6.30 },
-    { 22, 36, 7.90, +35, 34, 37.9, 6.10 },
-    { 20, 43, 24.19, +35, 35, 16.1, 6.47 },
-    { 1, 9, 43.90, +35, 37, 14.2, 2.06 },
-    { 22, 36, 48.70, +35, 39, 9.0, 6.30 },
-    { 15, 51, 13.90, +35, 39, 27.0, 4.82 },
-    { 22, 29, 43.90, +35, 43, 32.2, 6.56 },
-    { 6, 53, 3.41, +35, 47, 19.0, 6.01 },
-    { 3, 58, 57.89, +35, 47, 28.0, 4.04 },
-    { 13, 5, 44.50, +35, 47, 56.0, 5.25 },
-    { 8, 58, 27.50, +35, 48, 9.0, 6.51 },
-    { 9, 35, 39.60, +35, 48, 37.1, 5.41 },
-    { 11, 12, 32.21, +35, 48, 49.0, 6.41 },
-    { 21, 45, 44.50, +35, 51, 25.9, 6.40 },
-    { 6, 41, 37.70, +35, 55, 54.8, 6.46 },
-    { 17, 8, 1.99, +35, 56, 7.1, 5.39 },
-    { 5, 6, .91, +35, 56, 11.0, 6.52 },
-    { 12, 39, 16.90, +35, 57, 6.8, 6.45 },
-    { 20, 6, 21.79, +35, 58, 21.0, 5.36 },
-    { 2, 46, 58.30, +35, 59, 1.0, 6.25 },
-    { 21, 1, 12.89, +36, 1, 34.0, 5.97 },
-    { 12, 1, 39.50, +36, 2, 30.8, 5.59 },
-    { 18, 19, 51.70, +36, 3, 51.8, 4.33 },
-    { 19, 45, 39.60, +36, 5, 28.0, 6.43 },
-    { 10, 59, 32.81, +36, 5, 35.2, 6.00 },
-    { 19, 7, 18.10, +36, 6, 1.1, 5.28 },
-    { 6, 44, 12.60, +36, 6, 34.9, 6.31 },
-    { 2, 32, 6.19, +36, 8, 49.9, 5.15 },
-    { 6, 15, 39.00, +36, 8, 55.0, 6.92 },
-    { 4, 56, 19.90, +36, 10, 8.0, 6.07 },
-    { 14, 28, 16.39, +36, 11, 48.8, 6.10 },
-    { 19, 30, 46.90, +36, 13, 43.0, 6.25 },
-    { 19, 56, 44.21, +36, 15, 2.9, 6.02 },
-    { 17, 58, 42.29, +36, 17, 16.1, 6.00 },
-    { 13, 37, 27.60, +36, 17, 42.0, 4.82 },
-    { 21, 11, 3.89, +36, 17, 57.1, 6.54 },
-    { 11, 9, 19.10, +36, 18, 33.8, 5.74 },
-    { 19, 26, 9.10, +36, 19, 4.1, 5.15 },
-    { 10, 36, 21.41, +36, 19, 36.8, 6.28 },
-    { 22, 55, 44.50, +36, 21, 6.1, 5.74 },
-    { 9, 34, 13.39, +36, 23, 51.0, 4.55 },
-    { 18, 8, 2.21, +36, 24, 5.0, 5.48 },
-    { 8, 34, 43.80, +36, 25, 9.8, 5.78 },
-    { 16, 11, 48.00, +36, 25, 30.0, 5.63 },
-    { 23, 49, 40.99, +36, 25, 31.1, 5.90 },
-    { 19, 52, 16.30, +36, 25, 55.9, 6.10 },
-    { 8, 33, 21.79, +36, 26, 11.0, 6.24 },
-    { 19, 24, 6.10, +36, 27, 6.8, 6.36 },
-    { 20, 29, 20.40, +36, 27, 16.9, 5.88 },
-    { 15, 6, 35.11, +36, 27, 20.2, 6.35 },
-    { 3, 44, 31.39, +36, 27, 36.0, 5.59 },
-    { 18, 9, 58.99, +36, 27, 59.0, 5.58 },
-    { 9, 33, 30.31, +36, 29, 12.8, 6.18 },
-    { 20, 47, 24.50, +36, 29, 26.9, 4.53 },
-    { 16, 8, 58.30, +36, 29, 26.9, 4.76 },
-    { 18, 51, 36.50, +36, 32, 19.0, 6.09 },
-    { 18, 43, 36.10, +36, 33, 24.1, 6.01 },
-    { 21, 48, 8.30, +36, 34, 50.2, 6.47 },
-    { 9, 24, 22.51, +36, 35, 12.8, 6.67 },
-    { 20, 14, 4.99, +36, 36, 19.1, 6.45 },
-    { 15, 31, 22.39, +36, 36, 59.0, 6.38 },
-    { 14, 34, 38.50, +36, 37, 32.9, 6.03 },
-    { 0, 8, 40.99, +36, 37, 36.1, 6.19 },
-    { 16, 3, 19.39, +36, 37, 54.1, 5.83 },
-    { 13, 49, 45.00, +36, 37, 58.1, 6.38 },
-    { 21, 13, 26.30, +36, 38, 1.0, 6.05 },
-    { 15, 39, 22.70, +36, 38, 8.9, 5.07 },
-    { 15, 39, 22.20, +36, 38, 12.1, 6.00 },
-    { 15, 58, 57.70, +36, 38, 38.0, 5.62 },
-    { 21, 25, 46.99, +36, 40, 3.0, 5.94 },
-    { 4, 52, 37.99, +36, 42, 11.2, 4.78 },
-    { 10, 27, 52.99, +36, 42, 25.9, 4.21 },
-    { 23, 40, 40.61, +36, 43, 14.9, 6.23 },
-    { 11, 55, 14.09, +36, 45, 23.0, 6.49 },
-    { 7, 22, 2.59, +36, 45, 38.2, 5.13 },
-    { 0, 18, 19.70, +36, 47, 7.1, 4.52 },
-    { 9, 18, 50.69, +36, 48, 9.0, 3.82 },
-    { 15, 30, 27.91, +36, 48, 15.1, 6.37 },
-    { 20, 14, 31.99, +36, 48, 23.0, 4.97 },
-    { 17, 15, 2.81, +36, 48, 33.1, 3.16 },
-    { 11, 33, 56.30, +36, 48, 56.2, 6.40 },
-    { 20, 9, 25.61, +36, 50, 22.9, 4.93 },
-    { 18, 54, 30.19, +36, 53, 56.0, 4.30 },
-    { 0, 28, 56.59, +36, 54, .0, 6.26 },
-    { 8, 44, 10.10, +36, 55, 5.2, 6.33 },
-    { 20, 30, 59.21, +36, 56, 8.9, 6.19 },
-    { 19, 35, 48.31, +36, 56, 39.8, 6.05 },
-    { 17, 24, 27.10, +36, 57, 6.8, 6.28 },
-    { 14, 33, 20.30, +36, 57, 33.8, 6.43 },
-    { 18, 53, 43.61, +36, 58, 18.1, 5.58 },
-    { 4, 1, 14.69, +36, 59, 24.0, 6.41 },
-    { 19, 54, 48.31, +36, 59, 46.0, 5.76 },
-    { 20, 18, 28.61, +37, 0, .0, 5.58 },
-    { 13, 23, 54.00, +37, 2, 2.0, 6.07 },
-    { 19, 59, 55.20, +37, 2, 34.1, 5.19 },
-    { 20, 16, 28.20, +37, 3, 23.0, 6.48 },
-    { 22, 55, 2.59, +37, 4, 36.8, 5.91 },
-    { 20, 1, 15.31, +37, 5, 56.0, 6.20 },
-    { 21, 27, 21.41, +37, 7, .1, 5.31 },
-    { 1, 54, 57.50, +37, 7, 41.9, 6.26 },
-    { 20, 19, 48.31, +37, 7, 57.0, 6.57 },
-    { 17, 23, 40.99, +37, 8, 44.9, 4.52 },
-    { 17, 23, 40.70, +37, 8, 48.1, 5.47 },
-    { 6, 43, 13.80, +37, 8, 48.8, 6.19 },
-    { 13, 34, 47.81, +37, 10, 57.0, 4.98 },
-    { 5, 59, 43.30, +37, 12, 45.0, 2.62 },
-    { 1, 34, 16.61, +37, 14, 13.9, 5.88 },
-    { 17, 56, 15.19, +37, 15, 2.2, 3.86 },
-    { 1, 56, 9.29, +37, 15, 6.1, 5.67 },
-    { 8, 31, 19.90, +37, 15, 56.9, 6.18 },
-    { 14, 50, 29.59, +37, 16, 18.8, 5.48 },
-    { 1, 55, 54.41, +37, 16, 40.1, 5.89 },
-    { 17, 17, 40.30, +37, 17, 30.1, 4.65 },
-    { 17, 35, 42.41, +37, 18, 6.1, 6.10 },
-    { 5, 10, 18.91, +37, 18, 6.8, 6.02 },
-    { 5, 51, 2.40, +37, 18, 20.2, 4.74 },
-    { 2, 35, 38.81, +37, 18, 43.9, 5.71 },
-    { 2, 49, 27.10, +37, 19, 34.0, 6.45 },
-    { 19, 19, 38.90, +37, 19, 50.2, 6.31 },
-    { 15, 24, 30.91, +37, 20, 52.1, 6.50 },
-    { 21, 23, 48.31, +37, 21, 5.0, 6.47 },
-    { 19, 44, 16.61, +37, 21, 15.8, 4.89 },
-    { 15, 24, 29.40, +37, 22, 37.9, 4.31 },
-    { 5, 24, 39.19, +37, 23, 8.2, 4.99 },
-    { 1, 18, 46.99, +37, 23, 10.0, 6.46 },
-    { 16, 25, 24.19, +37, 23, 38.0, 5.54 },
-    { 10, 11, 12.79, +37, 24, 6.8, 5.85 },
-    { 21, 23, 22.99, +37, 24, 24.1, 6.58 },
-    { 22, 48, 10.90, +37, 25, .1, 5.90 },
-    { 0, 53, 28.20, +37, 25, 5.2, 6.06 },
-    { 13, 9, 38.71, +37, 25, 23.2, 6.02 },
-    { 22, 26, 45.70, +37, 26, 38.0, 6.46 },
-    { 7, 8, 36.31, +37, 26, 42.0, 6.16 },
-    { 19, 19, 1.20, +37, 26, 43.1, 6.22 },
-    { 20, 23, 44.40, +37, 28, 35.0, 5.90 },
-    { 4, 49, 54.60, +37, 29, 17.9, 4.88 },
-    { 12, 50, 10.70, +37, 31, .8, 5.89 },
-    { 7, 46, 39.29, +37, 31, 3.0, 5.18 },
-    { 3, 41, 7.90, +37, 34, 48.0, 5.57 },
-    { 22, 39, 34.30, +37, 35, 34.1, 6.03 },
-    { 18, 44, 48.19, +37, 35, 39.8, 5.73 },
-    { 9, 0, 30.79, +37, 36, 15.8, 6.44 },
-    { 18, 44, 46.39, +37, 36, 18.0, 4.36 },
-    { 23, 40, 2.81, +37, 39, 9.0, 6.53 },
-    { 0, 12, 50.40, +37, 41, 35.9, 6.73 },
-    { 1, 23, 40.61, +37, 42, 54.0, 5.58 },
-    { 11, 52, 58.80, +37, 43, 7.0, 6.45 },
-    { 1, 11, 10.30, +37, 43, 27.1, 5.81 },
-    { 2, 38, 17.81, +37, 43, 36.1, 6.18 },
-    { 4, 8, 15.31, +37, 43, 40.1, 6.09 },
-    { 22, 15, 58.20, +37, 44, 56.0, 4.13 },
-    { 22, 18, 56.21, +37, 46, 9.8, 6.17 },
-    { 22, 42, 55.51, +37, 48, 10.1, 6.43 },
-    { 14, 49, 6.70, +37, 48, 40.0, 6.16 },
-    { 19, 50, 46.99, +37, 49, 35.0, 6.06 },
-    { 2, 8, 29.30, +37, 51, 33.1, 4.82 },
-    { 4, 59, 15.41, +37, 53, 25.1, 4.94 },
-    { 10, 39, 7.61, +37, 54, 36.0, 5.85 },
-    { 19, 27, 36.50, +37, 56, 28.0, 6.34 },
-    { 15, 55, 47.59, +37, 56, 48.8, 5.45 },
-    { 1, 48, 38.90, +37, 57, 10.1, 5.94 },
-    { 6, 5, 2.59, +37, 57, 51.1, 6.34 },
-    { 4, 13, 59.59, +37, 58, .8, 6.45 },
-    { 0, 21, 7.30, +37, 58, 7.0, 5.18 },
-    { 8, 32, 55.01, +38, 0, 59.0, 5.90 },
-    { 23, 34, 46.70, +38, 1, 26.0, 6.18 },
-    { 20, 17, 47.21, +38, 1, 59.2, 4.81 },
-    { 4, 8, 36.60, +38, 2, 22.9, 5.51 },
-    { 21, 14, 47.50, +38, 2, 44.2, 3.72 },
-    { 6, 59, 2.81, +38, 3, 7.9, 6.00 },
-    { 2, 38, 27.79, +38, 5, 21.8, 6.30 },
-    { 19, 58, 34.39, +38, 6, 20.2, 6.32 },
-    { 3, 0, 11.81, +38, 7, 54.1, 6.11 },
-    { 19, 16, 22.10, +38, 8, 1.0, 4.36 },
-    { 23, 20, 53.30, +38, 10, 55.9, 5.77 },
-    { 11, 19, 7.90, +38, 11, 8.2, 4.78 },
-    { 9, 20, 59.30, +38, 11, 17.9, 6.12 },
-    { 21, 19, 22.20, +38, 14, 15.0, 5.83 },
-    { 11, 4, 31.20, +38, 14, 29.0, 6.00 },
-    { 15, 13, 35.59, +38, 15, 52.9, 6.20 },
-    { 18, 58, 1.90, +38, 15, 58.0, 5.89 },
-    { 4, 41, 50.30, +38, 16, 49.1, 5.99 },
-    { 21, 43, 25.70, +38, 17, 2.0, 5.65 },
-    { 14, 32, 4.70, +38, 18, 29.9, 3.03 },
-    { 12, 56, .41, +38, 18, 52.9, 5.60 },
-    { 12, 56, 1.70, +38, 19, 5.9, 2.90 },
-    { 2, 50, 35.11, +38, 19, 7.0, 4.23 },
-    { 20, 37, 23.59, +38, 19, 43.0, 6.20 },
-    { 2, 53, 42.60, +38, 20, 15.0, 5.33 },
-    { 7, 40, 14.59, +38, 20, 39.8, 5.73 },
-    { 18, 40, 12.19, +38, 22, 1.9, 6.45 },
-    { 15, 35, 49.30, +38, 22, 26.0, 6.42 },
-    { 19, 36, 56.59, +38, 23, 2.0, 6.50 },
-    { 14, 25, 29.21, +38, 23, 35.2, 6.27 },
-    { 19, 47, 27.79, +38, 24, 27.0, 5.77 },
-    { 6, 53, 13.39, +38, 26, 17.2, 6.30 },
-    { 20, 27, 34.30, +38, 26, 25.1, 5.62 },
-    { 6, 36, 32.90, +38, 26, 43.1, 5.29 },
-    { 9, 6, 31.80, +38, 27, 7.9, 4.56 },
-    { 18, 9, 37.49, +38, 27, 27.0, 6.40 },
-    { 20, 5, 9.79, +38, 28, 41.9, 6.19 },
-    { 6, 6, 35.09, +38, 28, 58.1, 5.36 },
-    { 5, 13, 25.70, +38, 29, 3.8, 4.86 },
-    { 19, 55, 51.70, +38, 29, 12.1, 4.94 },
-    { 13, 10, 3.19, +38, 29, 56.0, 5.91 },
-    { 0, 56, 45.19, +38, 29, 57.8, 3.87 },
-    { 13, 46, 19.01, +38, 30, 14.0, 5.94 },
-    { 6, 53, 57.00, +38, 30, 18.0, 6.48 },
-    { 13, 9, 42.00, +38, 32, 2.0, 6.28 },
-    { 21, 34, 46.61, +38, 32, 3.1, 4.90 },
-    { 13, 46, 59.81, +38, 32, 34.1, 5.50 },
-    { 0, 52, 53.40, +38, 32, 55.0, 6.69 },
-    { 22, 23, 54.19, +38, 34, 25.0, 6.22 },
-    { 0, 24, 1.99, +38, 34, 37.9, 7.39 },
-    { 17, 24, 2.21, +38, 34, 58.1, 6.49 },
-    { 2, 58, 2.30, +38, 36, 54.0, 6.04 },
-    { 21, 22, 46.90, +38, 38, 3.1, 6.63 },
-    { 21, 48, 29.40, +38, 38, 55.0, 6.12 },
-    { 21, 3, 4.80, +38, 39, 27.0, 6.07 },
-    { 23, 30, 39.70, +38, 39, 42.8, 6.05 },
-    { 0, 17, 5.50, +38, 40, 54.1, 4.61 },
-    { 23, 0, 54.70, +38, 42, 29.2, 6.54 },
-    { 19, 49, 27.50, +38, 42, 36.0, 6.11 },
-    { 19, 50, 34.01, +38, 43, 21.0, 5.12 },
-    { 8, 11, 21.60, +38, 43, 53.0, 6.58 },
-    { 2, 36, 57.19, +38, 43, 58.1, 5.90 },
-    { 18, 23, 57.41, +38, 44, 21.1, 6.36 },
-    { 21, 6, 55.30, +38, 44, 35.9, 6.03 },
-    { 21, 6, 54.60, +38, 44, 44.9, 5.21 },
-    { 19, 33, 36.41, +38, 45, 43.9, 6.61 },
-    { 14, 18, 55.70, +38, 46, 3.0, 6.86 },
-    { 18, 13, 4.80, +38, 46, 25.0, 6.04 },
-    { 18, 36, 56.30, +38, 47, 1.0, 0.03 },
-    { 13, 34, 21.79, +38, 47, 21.1, 6.37 },
-    { 14, 19, 47.69, +38, 47, 38.0, 6.33 },
-    { 17, 18, 23.30, +38, 48, 41.0, 5.94 },
-    { 3, 59, 40.01, +38, 49, 14.2, 6.38 },
-    { 3, 58, 29.11, +38, 50, 25.1, 6.30 },
-    { 3, 5, 10.61, +38, 50, 25.1, 3.39 },
-    { 6, 53, 1.49, +38, 52, 9.1, 6.12 },
-    { 17, 45, 53.71, +38, 52, 53.0, 6.52 },
-    { 17, 30, 40.30, +38, 52, 55.9, 6.43 },
-    { 7, 31, 55.70, +38, 53, 47.0, 6.54 },
-    { 20, 16, 3.41, +38, 53, 52.1, 6.27 },
-    { 16, 42, 53.81, +38, 55, 19.9, 3.53 },
-    { 10, 30, 6.41, +38, 55, 31.1, 5.77 },
-    { 7, 22, 13.39, +38, 59, 46.0, 6.40 },
-    { 15, 35, 15.00, +39, 0, 36.0, 5.11 },
-    { 12, 25, 50.90, +39, 1, 7.0, 5.02 },
-    { 2, 10, 52.80, +39, 2, 21.8, 5.63 },
-    { 2, 10, 53.71, +39, 2, 35.2, 6.10 },
-    { 22, 39, 15.70, +39, 3, 1.1, 4.88 },
-    { 20, 41, .41, +39, 4, 55.9, 6.51 },
-    { 19, 13, 45.50, +39, 8, 46.0, 4.39 },
-    { 5, 51, 29.40, +39, 8, 55.0, 3.97 },
-    { 5, 49, 10.49, +39, 10, 52.0, 4.52 },
-    { 11, 0, 50.40, +39, 12, 43.9, 5.08 },
-    { 18, 59, 12.29, +39, 13, 4.1, 6.41 },
-    { 23, 31, 17.40, +39, 14, 11.0, 5.22 },
-    { 14, 59, 36.89, +39, 15, 55.1, 5.64 },
-    { 12, 44, 59.50, +39, 16, 44.0, 5.95 },
-    { 3, 17, 45.79, +39, 16, 59.9, 5.96 },
-    { 18, 43, 16.70, +39, 18, 1.1, 6.45 },
-    { 22, 57, 40.70, +39, 18, 32.0, 6.18 },
-    { 7, 11, 39.29, +39, 19, 14.2, 4.90 },
-    { 17, 45, 58.49, +39, 19, 21.0, 6.68 },
-    { 11, 29, 4.20, +39, 20, 12.8, 5.31 },
-    { 6, 38, 39.50, +39, 23, 26.9, 5.69 },
-    { 5, 0, 18.29, +39, 23, 40.9, 5.95 },
-    { 21, 17, 25.01, +39, 23, 40.9, 4.23 },
-    { 20, 20, 15.19, +39, 24, 11.9, 6.23 },
-    { 0, 41, 7.20, +39, 27, 31.0, 5.33 },
-    { 22, 44, 5.21, +39, 27, 56.2, 5.95 },
-    { 18, 24, 13.80, +39, 30, 25.9, 5.12 },
-    { 21, 51, 4.90, +39, 32, 12.1, 6.17 },
-    { 13, 48, 57.19, +39, 32, 34.1, 7.40 },
-    { 5, 52, 39.50, +39, 34, 27.8, 6.45 },
-    { 15, 22, 37.39, +39, 34, 53.0, 5.50 },
-    { 3, 11, 17.40, +39, 36, 42.1, 4.63 },
-    { 18, 44, 22.90, +39, 36, 46.1, 5.37 },
-    { 18, 44, 22.90, +39, 36, 47.2, 5.14 },
-    { 9, 35, 3.79, +39, 37, 17.0, 4.81 },
-    { 22, 35, 52.30, +39, 38, 3.1, 5.73 },
-    { 5, 0, 23.21, +39, 39, 18.0, 6.58 },
-    { 2, 58, 45.70, +39, 39, 46.1, 4.70 },
-    { 2, 35, 27.89, +39, 39, 51.8, 6.36 },
-    { 18, 38, 6.50, +39, 40, 5.2, 6.04 },
-    { 18, 44, 20.40, +39, 40, 12.0, 5.06 },
-    { 18, 44, 20.30, +39, 40, 16.0, 6.02 },
-    { 15, 57, 29.90, +39, 41, 43.1, 6.31 },
-    { 16, 19, 55.10, +39, 42, 31.0, 5.46 },
-    { 9, 1, 40.61, +39, 42, 47.9, 6.36 },
-    { 22, 13, 52.70, +39, 42, 54.0, 4.49 },
-    { 14, 16, 24.19, +39, 44, 40.9, 6.38 },
-    { 9, 42, .31, +39, 45, 28.1, 5.62 },
-    { 22, 32, 26.40, +39, 46, 46.9, 5.88 },
-    { 22, 27, 26.50, +39, 48, 34.9, 6.14 },
-    { 5, 30, 45.10, +39, 49, 32.9, 6.37 },
-    { 2, 19, 37.30, +39, 50, 6.0, 6.63 },
-    { 2, 37, 20.81, +39, 53, 44.9, 6.54 },
-    { 3, 33, 35.11, +39, 53, 57.8, 5.81 },
-    { 6, 38, 49.20, +39, 54, 9.0, 5.20 },
-    { 9, 35, 22.39, +39, 57, 47.9, 6.76 },
-    { 17, 21, 43.61, +39, 58, 27.8, 5.51 },
-    { 17, 52, 4.70, +39, 58, 55.9, 6.04 },
-    { 1, 4, 36.41, +39, 59, 28.0, 6.72 },
-    { 17, 53, 18.10, +40, 0, 29.2, 5.16 },
-    { 4, 31, 24.00, +40, 0, 37.1, 6.26 },
-    { 3, 57, 51.19, +40, 0, 37.1, 2.89 },
-    { 7, 37, 17.81, +40, 1, 31.1, 6.38 },
-    { 17, 51, 13.99, +40, 4, 21.0, 6.46 },
-    { 18, 4, 43.20, +40, 5, 3.1, 6.52 },
-    { 5, 19, 8.50, +40, 5, 57.1, 4.71 },
-    { 13, 20, 19.01, +40, 9, 2.2, 5.60 },
-    { 13, 13, 43.01, +40, 9, 10.1, 4.92 },
-    { 22, 53, 11.30, +40, 10, 1.9, 6.34 },
-    { 5, 36, 52.39, +40, 10, 55.9, 6.09 },
-    { 2, 42, 14.90, +40, 11, 38.0, 4.91 },
-    { 8, 56, 30.50, +40, 12, 6.1, 5.89 },
-    { 22, 41, 28.61, +40, 13, 32.2, 5.25 },
-    { 23, 34, 37.49, +40, 14, 11.0, 5.59 },
-    { 9, 38, 21.70, +40, 14, 22.9, 5.25 },
-    { 19, 41, 57.50, +40, 15, 14.0, 6.23 },
-    { 20, 22, 13.70, +40, 15, 24.1, 2.20 },
-    { 4, 46, 44.40, +40, 18, 46.1, 5.97 },
-    { 1, 27, 46.99, +40, 20, 8.2, 6.60 },
-    { 11, 57, 14.59, +40, 20, 37.0, 6.62 },
-    { 21, 21, 1.39, +40, 20, 44.2, 6.40 },
-    { 15, 37, 49.61, +40, 21, 11.9, 5.24 },
-    { 20, 16, 55.30, +40, 21, 54.0, 5.24 },
-    { 19, 57, 13.90, +40, 22, 5.2, 5.45 },
-    { 22, 54, 7.01, +40, 22, 36.8, 5.81 },
-    { 15, 1, 56.81, +40, 23, 26.2, 3.50 },
-    { 21, 36, 57.00, +40, 24, 49.0, 5.01 },
-    { 10, 33, 13.90, +40, 25, 32.2, 4.75 },
-    { 19, 11, 23.11, +40, 25, 45.1, 6.18 },
-    { 10, 59, 28.01, +40, 25, 49.1, 5.05 },
-    { 14, 43, 44.40, +40, 27, 33.1, 5.73 },
-    { 5, 18, 40.39, +40, 27, 54.0, 6.18 },
-    { 3, 17, 11.40, +40, 28, 59.9, 6.45 },
-    { 4, 14, 53.30, +40, 29, 1.0, 4.71 },
-    { 5, 45, 49.51, +40, 30, 25.9, 6.58 },
-    { 17, 7, 46.70, +40, 30, 58.0, 6.34 },
-    { 13, 17, 32.50, +40, 34, 21.0, 4.73 },
-    { 1, 40, 34.80, +40, 34, 36.8, 4.94 },
-    { 20, 39, 33.31, +40, 34, 45.8, 6.06 },
-    { 3, 5, 20.81, +40, 34, 57.0, 6.05 },
-    { 19, 50, 37.30, +40, 35, 58.9, 5.69 },
-    { 12, 16, 7.61, +40, 39, 37.1, 5.66 },
-    { 10, 10, 58.90, +40, 39, 41.0, 6.32 },
-    { 7, 24, 8.50, +40, 40, 19.9, 5.19 },
-    { 18, 58, 46.61, +40, 40, 45.1, 6.22 },
-    { 19, 0, 19.01, +40, 41, 3.1, 6.65 },
-    { 1, 54, 53.81, +40, 42, 6.8, 6.24 },
-    { 20, 54, 22.30, +40, 42, 11.2, 6.70 },
-    { 19, 44, 49.01, +40, 43, .1, 6.34 },
-    { 13, 28, 26.21, +40, 43, 46.9, 6.47 },
-    { 0, 19, 41.59, +40, 43, 46.9, 6.33 },
-    { 1, 53, 17.30, +40, 43, 46.9, 5.40 },
-    { 20, 18, 7.01, +40, 43, 55.9, 5.84 },
-    { 17, 9, 33.31, +40, 46, 37.9, 5.08 },
-    { 4, 44, 12.89, +40, 47, 12.8, 6.08 },
-    { 21, 41, 34.30, +40, 48, 19.1, 6.11 },
-    { 15, 30, 55.80, +40, 49, 59.2, 5.02 },
-    { 13, 15, 31.99, +40, 51, 19.1, 5.79 },
-    { 12, 38, 46.30, +40, 52, 27.8, 6.37 },
-    { 7, 18, 2.21, +40, 52, 59.9, 5.78 },
-    { 15, 31, 46.99, +40, 53, 57.8, 5.02 },
-    { 18, 39, 33.10, +40, 56, 6.0, 6.25 },
-    { 18, 17, 6.79, +40, 56, 12.1, 6.11 },
-    { 3, 8, 10.10, +40, 57, 20.2, 2.12 },
-    { 14, 27, 27.31, +41, 1, 30.0, 6.63 },
-    { 20, 22, 45.31, +41, 1, 34.0, 5.93 },
-    { 5, 22, 50.30, +41, 1, 45.8, 5.54 },
-    { 2, 59, 39.89, +41, 1, 59.2, 5.89 },
-    { 0, 13, 30.79, +41, 2, 7.1, 5.72 },
-    { 21, 18, 55.30, +41, 2, 26.9, 6.15 },
-    { 6, 8, 22.99, +41, 3, 20.2, 6.36 },
-    { 9, 57, 41.09, +41, 3, 20.2, 5.14 },
-    { 6, 49, 19.01, +41, 3, 33.0, },
-    { 5, 2, 28.70, +41, 4, 32.9, 3.75 },
-    { 1, 35, 52.51, +41, 4, 35.0, 6.38 },
-    { 21, 42, 22.90, +41, 4, 37.9, 5.69 },
-    { 0, 49, 48.79, +41, 4, 44.0, 4.53 },
-    { 5, 20, 14.81, +41, 5, 10.0, 5.52 },
-    { 13, 46, 13.49, +41, 5, 19.0, 5.87 },
-    { 11, 13, 40.20, +41, 5, 19.0, 6.33 },
-    { 1, 27, 26.59, +41, 6, 2.2, 6.46 },
-    { 23, 24, 34.99, +41, 6, 46.1, 6.72 },
-    { 20, 22, 3.00, +41, 7, 53.0, 6.39 },
-    { 18, 12, 42.60, +41, 8, 48.8, 6.36 },
-    { 21, 49, 40.10, +41, 8, 56.0, 6.48 },
-    { 21, 43, 6.41, +41, 9, 18.0, 5.49 },
-    { 20, 57, 10.39, +41, 10, 1.9, 3.94 },
-    { 18, 54, 14.30, +41, 13, 32.2, 7.30 },
-    { 10, 22, 10.49, +41, 13, 45.8, 5.76 },
-    { 5, 6, 30.91, +41, 14, 3.8, 3.17 },
-    { 17, 33, 7.30, +41, 14, 37.0, 5.74 },
-    { 3, 25, 9.41, +41, 15, 25.9, 6.51 },
-    { 0, 42, 41.70, +41, 15, 50.0, },
-    { 4, 36, 41.40, +41, 15, 52.9, 4.25 },
-    { 1, 2, 54.29, +41, 20, 42.0, 5.98 },
-    { 12, 33, 44.50, +41, 21, 27.0, 4.26 },
-    { 18, 52, 7.10, +41, 22, 59.9, 6.28 },
-    { 2, 22, 50.30, +41, 23, 47.0, 5.82 },
-    { 1, 36, 47.81, +41, 24, 20.2, 4.09 },
-    { 19, 6, 16.99, +41, 24, 50.0, 6.49 },
-    { 18, 46, 13.01, +41, 26, 30.1, 6.07 },
-    { 5, 3, 18.60, +41, 26, 30.1, 6.14 },
-    { 5, 30, 48.60, +41, 27, 42.8, 6.00 },
-    { 10, 22, 19.70, +41, 29, 57.8, 3.05 },
-    { 14, 14, 23.50, +41, 31, 8.0, 6.24 },
-    { 22, 41, 36.10, +41, 32, 57.8, 5.94 },
-    { 10, 27, 28.01, +41, 36, 2.9, 6.02 },
-    { 18, 54, 52.20, +41, 36, 10.1, 5.44 },
-    { 22, 56, 23.59, +41, 36, 14.0, 5.59 },
-    { 21, 3, 52.10, +41, 37, 41.2, 6.33 },
-    { 13, 42, 28.80, +41, 40, 27.1, 6.30 },
-    { 1, 57, 56.40, +41, 41, 39.8, 6.78 },
-    { 20, 41, 56.50, +41, 43, .8, 5.67 },
-    { 20, 33, 48.41, +41, 46, 19.9, 6.49 },
-    { 19, 43, 45.00, +41, 46, 23.2, 5.84 },
-    { 23, 18, 23.40, +41, 46, 25.0, 6.02 },
-    { 6, 50, 45.91, +41, 46, 53.0, 5.02 },
-    { 9, 0, 38.40, +41, 46, 58.1, 3.97 },
-    { 14, 29, 36.79, +41, 47, 44.9, 6.35 },
-    { 5, 21, 48.41, +41, 48, 15.8, 5.23 },
-    { 4, 20, 14.40, +41, 48, 29.2, 5.92 },
-    { 22, 44, 5.50, +41, 49, 9.1, 5.08 },
-    { 6, 7, 26.90, +41, 51, 15.1, 6.12 },
-    { 16, 28, 38.50, +41, 52, 54.1, 5.04 },
-    { 16, 50, 36.10, +41, 53, 48.1, 6.29 },
-    { 20, 58, 30.79, +41, 56, 25.1, 6.16 },
-    { 18, 5, .79, +41, 56, 48.1, 6.34 },
-    { 22, 50, 21.79, +41, 57, 13.0, 5.92 },
-    { 8, 52, 10.01, +42, 0, 9.0, 5.99 },
-    { 8, 24, 42.79, +42, 0, 18.0, 6.02 },
-    { 10, 56, 14.50, +42, 0, 29.9, 6.03 },
-    { 23, 19, 52.39, +42, 4, 41.2, 5.79 },
-    { 22, 21, 50.90, +42, 4, 41.9, 6.41 },
-    { 1, 10, 18.79, +42, 4, 53.0, 5.65 },
-    { 0, 4, 36.70, +42, 5, 31.9, 6.01 },
-    { 20, 14, 21.60, +42, 6, 13.0, 6.71 },
-    { 13, 31, 15.79, +42, 6, 22.0, 6.08 },
-    { 5, 33, 28.70, +42, 6, 32.0, 6.55 },
-    { 4, 18, 8.21, +42, 8, 28.0, 6.22 },
-    { 18, 15, 38.81, +42, 9, 33.8, 5.59 },
-    { 15, 14, 10.30, +42, 10, 17.0, 6.13 },
-    { 16, 47, 19.80, +42, 14, 20.0, 5.87 },
-    { 21, 16, 29.59, +42, 15, 5.0, 6.43 },
-    { 19, 57, 56.21, +42, 15, 38.9, 6.43 },
-    { 23, 1, 55.30, +42, 19, 34.0, 3.62 },
-    { 2, 3, 54.00, +42, 19, 46.9, 2.26 },
-    { 2, 3, 54.70, +42, 19, 50.9, 4.84 },
-    { 0, 1, 43.80, +42, 22, 1.9, 6.25 },
-    { 16, 11, 47.59, +42, 22, 27.8, 5.87 },
-    { 3, 12, 9.60, +42, 22, 34.0, 6.15 },
-    { 20, 53, 26.40, +42, 24, 37.1, 6.66 },
-    { 19, 34, 41.21, +42, 24, 46.1, 5.35 },
-    { 4, 23, 35.90, +42, 25, 41.2, 6.23 },
-    { 8, 9, 23.11, +42, 25, 50.2, 6.27 },
-    { 16, 34, 6.19, +42, 26, 12.8, 4.20 },
-    { 15, 52, 40.49, +42, 27, 6.1, 4.62 },
-    { 6, 39, 19.90, +42, 29, 20.0, 4.79 },
-    { 3, 14, 56.71, +42, 30, 14.0, 6.07 },
-    { 16, 57, 50.21, +42, 30, 45.0, 6.34 },
-    { 5, 47, 14.69, +42, 31, 36.1, 6.29 },
-    { 12, 23, 46.99, +42, 32, 34.1, 6.06 },
-    { 15, 55, 30.60, +42, 33, 58.0, 5.75 },
-    { 3, 45, 11.59, +42, 34, 43.0, 3.77 },
-    { 3, 38, .19, +42, 34, 59.2, 6.42 },
-    { 4, 52, 47.81, +42, 35, 12.1, 5.71 },
-    { 1, 41, 47.21, +42, 36, 49.0, 4.95 },
-    { 7, 21, 3.10, +42, 39, 20.2, 6.35 },
-    { 23, 57, 3.60, +42, 39, 29.9, 5.97 },
-    { 21, 17, 23.21, +42, 40, 59.9, 6.19 },
-    { 20, 17, 29.09, +42, 43, 18.8, 6.29 },
-    { 23, 2, 36.29, +42, 45, 28.1, 5.10 },
-    { 5, 18, 15.91, +42, 47, 31.9, 5.48 },
-    { 19, 39, 26.50, +42, 49, 5.9, 5.40 },
-    { 21, 41, 43.80, +42, 50, 28.0, },
-    { 11, 0, 20.59, +42, 54, 41.0, 6.02 },
-    { 6, 3, 18.00, +42, 54, 42.1, 6.10 },
-    { 23, 27, 7.39, +42, 54, 42.8, 5.75 },
-    { 10, 17, 5.81, +42, 54, 51.8, 3.45 },
-    { 22, 14, 44.40, +42, 57, 14.0, 5.71 },
-    { 6, 5, 3.41, +42, 58, 54.1, 5.87 },
-    { 20, 22, 55.51, +42, 58, 59.9, 6.20 },
-    { 7, 35, 55.99, +43, 1, 52.0, 6.30 },
-    { 12, 2, 6.79, +43, 2, 44.2, 5.21 },
-    { 21, 46, 16.61, +43, 3, 38.9, 6.54 },
-    { 4, 33, 24.91, +43, 3, 50.0, 6.09 },
-    { 19, 40, 41.21, +43, 4, 40.1, 6.16 },
-    { 22, 30, 29.30, +43, 7, 23.9, 4.51 },
-    { 15, 54, 37.90, +43, 8, 19.0, 5.37 },
-    { 11, 30, 31.10, +43, 10, 23.9, 5.94 },
-    { 5, 6, 49.61, +43, 10, 28.9, 6.20 },
-    { 8, 22, 50.09, +43, 11, 17.2, 4.25 },
-    { 10, 53, 58.70, +43, 11, 24.0, 4.71 },
-    { 20, 32, 52.30, +43, 11, 30.1, 6.60 },
-    { 11, 9, 38.50, +43, 12, 27.0, 5.89 },
-    { 16, 45, 11.71, +43, 13, 1.9, 6.05 },
-    { 9, 13, 48.19, +43, 13, 4.1, 5.32 },
-    { 18, 36, 45.60, +43, 13, 18.8, 6.20 },
-    { 8, 7, 9.91, +43, 15, 37.1, 6.26 },
-    { 23, 38, 8.21, +43, 16, 5.2, 4.29 },
-    { 21, 40, 11.11, +43, 16, 26.0, 5.11 },
-    { 1, 40, 39.79, +43, 17, 52.1, 5.61 },
-    { 22, 52, 1.99, +43, 18, 45.0, 4.94 },
-    { 3, 21, 26.50, +43, 19, 45.8, 4.95 },
-    { 4, 42, 54.29, +43, 21, 54.0, 5.29 },
-    { 6, 2, 53.59, +43, 22, 43.0, 6.42 },
-    { 20, 13, 42.79, +43, 22, 45.1, 6.14 },
-    { 19, 23, 56.50, +43, 23, 17.2, 5.84 },
-    { 16, 49, 40.49, +43, 25, 50.2, 6.13 },
-    { 1, 26, 18.60, +43, 27, 28.1, 5.96 },
-    { 20, 40, 3.10, +43, 27, 31.0, 5.95 },
-    { 18, 7, 28.80, +43, 27, 42.1, 5.00 },
-    { 17, 40, 37.61, +43, 28, 14.9, 6.59 },
-    { 11, 22, 49.61, +43, 28, 58.1, 4.99 },
-    { 0, 32, 26.81, +43, 29, 40.9, 6.70 },
-    { 23, 10, 27.19, +43, 32, 39.1, 5.94 },
-    { 6, 46, 44.30, +43, 34, 39.0, 5.25 },
-    { 0, 16, 21.60, +43, 35, 40.9, 6.15 },
-    { 11, 38, 20.59, +43, 37, 32.2, 5.59 },
-    { 14, 38, 12.50, +43, 38, 30.8, 5.70 },
-    { 8, 51, 56.81, +43, 43, 36.1, 5.15 },
-    { 0, 18, 42.10, +43, 47, 28.0, 6.11 },
-    { 17, 5, 4.99, +43, 48, 43.9, 6.43 },
-    { 5, 1, 58.10, +43, 49, 23.9, 2.99 },
-    { 14, 7, 55.80, +43, 51, 15.8, 5.27 },
-    { 13, 22, 3.79, +43, 54, 11.2, 6.35 },
-    { 3, 31, 11.80, +43, 54, 17.0, },
-    { 6, 55, 14.69, +43, 54, 36.0, 6.13 },
-    { 21, 4, 55.90, +43, 55, 40.1, 3.72 },
-    { 1, 8, .89, +43, 56, 30.8, 5.03 },
-    { 21, 18, 27.19, +43, 56, 44.9, 5.00 },
-    { 18, 55, 20.09, +43, 56, 46.0, 4.04 },
-    { 3, 49, 8.21, +43, 57, 47.2, 6.02 },
-    { 7, 58, 16.61, +43, 58, 39.0, 6.34 },
-    { 6, 39, 58.01, +44, 0, 50.0, 6.41 },
-    { 3, 17, 47.40, +44, 1, 30.0, 5.47 },
-    { 23, 2, 45.19, +44, 3, 32.0, 6.39 },
-    { 20, 50, 4.90, +44, 3, 33.8, 5.04 },
-    { 4, 54, 51.31, +44, 3, 38.9, 6.08 },
-    { 17, 43, 5.59, +44, 5, 3.8, 6.34 },
-    { 12, 44, 27.10, +44, 6, 11.2, 6.33 },
-    { 23, 20, 43.99, +44, 6, 59.0, 6.13 },
-    { 13, 35, 14.09, +44, 11, 48.8, 6.84 },
-    { 2, 13, 13.30, +44, 13, 54.1, 4.83 },
-    { 22, 40, 30.91, +44, 16, 35.0, 4.46 },
-    { 2, 44, 5.21, +44, 17, 48.8, 5.43 },
-    { 2, 17, 33.41, +44, 18, 24.8, 6.70 },
-    { 23, 40, 24.50, +44, 20, 2.0, 4.14 },
-    { 1, 39, 21.00, +44, 23, 10.0, 4.98 },
-    { 20, 53, 14.81, +44, 23, 13.9, 4.78 },
-    { 0, 28, 13.70, +44, 23, 39.8, 5.17 },
-    { 14, 38, 50.21, +44, 24, 15.8, 5.39 },
-    { 5, 20, 2.30, +44, 25, 32.2, 6.62 },
-    { 23, 37, 31.99, +44, 25, 45.1, 5.80 },
-    { 15, 20, 41.59, +44, 26, 3.1, 6.19 },
-    { 2, 8, 33.60, +44, 27, 33.8, 6.42 },
-    { 20, 58, 19.49, +44, 28, 18.1, 5.55 },
-    { 0, 36, 46.61, +44, 29, 19.0, 5.13 },
-    { 11, 9, 39.79, +44, 29, 55.0, 3.01 },
-    { 6, 43, 4.99, +44, 31, 27.8, 5.02 },
-    { 22, 46, 10.20, +44, 32, 46.0, 5.76 },
-    { 23, 8, 12.29, +44, 33, 42.1, 6.56 },
-    { 6, 0, 19.01, +44, 35, 30.8, 6.22 },
-    { 15, 3, 6.60, +44, 38, 39.8, 6.65 },
-    { 22, 2, 56.69, +44, 39, .0, 5.60 },
-    { 19, 36, 37.90, +44, 41, 42.0, 5.17 },
-    { 21, 37, 27.89, +44, 41, 48.1, 6.20 },
-    { 1, 0, 3.41, +44, 42, 40.0, 6.84 },
-    { 1, 0, 3.60, +44, 42, 47.9, 6.04 },
-    { 22, 53, 40.10, +44, 44, 57.1, 5.81 },
-    { 21, 2, 24.10, +44, 47, 28.0, 6.19 },
-    { 6, 53, 7.61, +44, 50, 21.8, 6.26 },
-    { 3, 32, 39.10, +44, 51, 20.2, 6.41 },
-    { 3, 9, 29.81, +44, 51, 25.9, 3.80 },
-    { 0, 46, 10.90, +44, 51, 41.0, 6.05 },
-    { 1, 17, 5.09, +44, 54, 6.8, 6.34 },
-    { 20, 56, 34.70, +44, 55, 30.0, 5.96 },
-    { 16, 8, 46.20, +44, 56, 6.0, 4.26 },
-    { 5, 59, 31.70, +44, 56, 51.0, 1.90 },
-    { 3, 50, 4.49, +44, 58, 4.1, 5.66 },
-    { 23, 42, 14.81, +44, 59, 30.8, 6.57 },
-    { 0, 50, 18.31, +45, 0, 7.9, 6.15 },
-    { 22, 6, 1.99, +45, 0, 51.8, 5.14 },
-    { 23, 33, 42.70, +45, 3, 29.2, 6.24 },
-    { 6, 57, 37.10, +45, 5, 39.1, 4.90 },
-    { 11, 38, 44.90, +45, 6, 31.0, 6.44 },
-    { 22, 5, 50.59, +45, 6, 43.9, 6.44 },
-    { 19, 44, 58.49, +45, 7, 50.9, 2.87 },
-    { 23, 19, 2.40, +45, 8, 13.9, 6.50 },
-    { 23, 17, 16.61, +45, 9, 51.1, 6.43 },
-    { 20, 53, 18.60, +45, 10, 54.8, 5.45 },
-    { 22, 38, 17.50, +45, 10, 59.2, 6.40 },
-    { 18, 15, 32.59, +45, 12, 33.8, 6.29 },
-    { 10, 28, 36.50, +45, 12, 43.9, 6.35 },
-    { 7, 21, 17.50, +45, 13, 41.2, 5.77 },
-    { 0, 5, 9.89, +45, 13, 45.1, 6.70 },
-    { 22, 6, 12.41, +45, 14, 55.0, 6.19 },
-    { 0, 0, 43.70, +45, 15, 11.9, 6.38 },
-    { 13, 5, 52.30, +45, 16, 7.0, 5.63 },
-    { 15, 24, 5.11, +45, 16, 16.0, 6.01 },
-    { 20, 41, 25.90, +45, 16, 49.1, 1.25 },
-    { 8, 52, 11.59, +45, 18, 45.0, 5.99 },
-    { 1, 43, 16.51, +45, 19, 19.9, 6.34 },
-    { 1, 12, 34.01, +45, 20, 16.1, 6.11 },
-    { 3, 16, 4.70, +45, 20, 44.9, 6.16 },
-    { 17, 56, 48.41, +45, 21, 2.9, 6.02 },
-    { 21, 36, 2.40, +45, 22, 28.9, 5.53 },
-    { 23, 0, 34.39, +45, 22, 30.0, 6.50 },
-    { 1, 38, 31.70, +45, 24, .0, 6.36 },
-    { 1, 27, 39.41, +45, 24, 24.1, 4.83 },
-    { 9, 57, 56.90, +45, 24, 51.8, 6.30 },
-    { 12, 45, 7.80, +45, 26, 25.1, 4.99 },
-    { 22, 13, 49.30, +45, 26, 26.9, 5.53 },
-    { 17, 58, 52.30, +45, 28, 34.0, 6.48 },
-    { 23, 17, 56.11, +45, 29, 20.0, 6.48 },
-    { 17, 59, 56.21, +45, 30, 5.0, 5.67 },
-    { 21, 9, 58.61, +45, 30, 9.0, 6.63 },
-    { 19, 40, 50.21, +45, 31, 30.0, 5.06 },
-    { 11, 0, 14.69, +45, 31, 34.0, 5.47 },
-    { 1, 22, 20.40, +45, 31, 44.0, 4.88 },
-    { 20, 16, .60, +45, 34, 45.8, 5.91 },
-    { 20, 47, 20.81, +45, 34, 46.9, 6.40 },
-    { 21, 33, 58.90, +45, 35, 30.8, 4.02 },
-    { 16, 31, 47.30, +45, 35, 53.9, 5.65 },
-    { 9, 28, 40.01, +45, 36, 5.0, 5.41 },
-    { 8, 56, 49.99, +45, 37, 54.8, 5.74 },
-    { 8, 27, 36.79, +45, 39, 11.2, 6.32 },
-    { 20, 39, 23.11, +45, 40, .8, 6.58 },
-    { 3, 45, 59.30, +45, 40, 54.8, 5.66 },
-    { 22, 8, 40.99, +45, 44, 30.8, 6.11 },
-    { 14, 2, 12.19, +45, 45, 13.0, 6.27 },
-    { 21, 42, 8.40, +45, 45, 56.9, 6.17 },
-    { 19, 59, 20.50, +45, 46, 19.9, 5.92 },
-    { 20, 22, 5.40, +45, 47, 42.0, 5.58 },
-    { 6, 55, 15.19, +45, 49, 35.0, 6.34 },
-    { 8, 41, 1.10, +45, 50, 2.0, 5.37 },
-    { 0, 57, 39.70, +45, 50, 22.9, 6.12 },
-    { 21, 2, 48.50, +45, 50, 56.0, 6.48 },
-    { 21, 33, 17.90, +45, 51, 15.1, 6.25 },
-    { 20, 29, 59.90, +45, 55, 43.0, 6.41 },
-    { 5, 59, 56.09, +45, 56, 12.8, 4.26 },
-    { 19, 39, 34.39, +45, 57, 29.2, 6.20 },
-    { 16, 49, 14.21, +45, 58, 59.9, 4.82 },
-    { 5, 16, 41.40, +45, 59, 53.2, 0.08 },
-    { 17, 39, 27.89, +46, 0, 23.0, 3.80 },
-    { 9, 48, 35.40, +46, 1, 16.0, 5.09 },
-    { 13, 26, 16.61, +46, 1, 41.2, 5.88 },
-    { 16, 2, 47.90, +46, 2, 12.1, 4.76 },
-    { 3, 32, 26.30, +46, 3, 24.8, 5.31 },
-    { 23, 7, 18.10, +46, 4, 5.2, 6.66 },
-    { 0, 10, 19.30, +46, 4, 19.9, 5.03 },
-    { 14, 16, 22.99, +46, 5, 17.9, 4.18 },
-    { 3, 44, 40.90, +46, 5, 58.9, 6.11 },
-    { 20, 48, 56.30, +46, 6, 51.1, 4.84 },
-    { 14, 49, 18.70, +46, 6, 58.0, 5.74 },
-    { 1, 44, 26.50, +46, 8, 22.9, 6.35 },
-    { 21, 1, 10.90, +46, 9, 20.9, 5.37 },
-    { 12, 57, 7.70, +46, 10, 36.8, 6.12 },
-    { 7, 36, 31.61, +46, 10, 49.1, 5.65 },
-    { 23, 37, 58.61, +46, 11, 58.9, 6.58 },
-    { 10, 43, 32.90, +46, 12, 14.0, 5.18 },
-    { 1, 47, 48.00, +46, 13, 46.9, 6.32 },
-    { 17, 20, 21.10, +46, 14, 26.9, 5.59 },
-    { 6, 56, 32.30, +46, 16, 27.1, 5.87 },
-    { 16, 19, 44.40, +46, 18, 47.9, 3.89 },
-    { 18, 46, 58.99, +46, 18, 54.0, 6.52 },
-    { 20, 18, 49.61, +46, 19, 22.1, 6.45 },
-    { 6, 18, 16.90, +46, 21, 38.2, 6.38 },
-    { 23, 7, 39.31, +46, 23, 13.9, 5.33 },
-    { 23, 58, 46.51, +46, 24, 47.2, 6.54 },
-    { 23, 46, 2.11, +46, 25, 13.1, 4.95 },
-    { 6, 17, 34.70, +46, 25, 27.1, 6.52 },
-    { 23, 37, 33.89, +46, 27, 29.2, 3.82 },
-    { 11, 55, 11.21, +46, 28, 10.9, 7.03 },
-    { 2, 19, 10.90, +46, 28, 21.0, 6.21 },
-    { 11, 55, 5.69, +46, 28, 36.8, 6.54 },
-    { 4, 21, 33.19, +46, 29, 56.0, 4.85 },
-    { 20, 46, 38.50, +46, 31, 54.1, 6.30 },
-    { 22, 21, 1.61, +46, 32, 12.1, 4.57 },
-    { 21, 29, 27.00, +46, 32, 26.2, 5.24 },
-    { 16, 36, 11.21, +46, 36, 47.9, 5.79 },
-    { 17, 52, 1.01, +46, 38, 35.9, 6.38 },
-    { 11, 30, 25.01, +46, 39, 27.0, 6.35 },
-    { 20, 49, 54.70, +46, 39, 40.0, 6.33 },
-    { 6, 30, 3.00, +46, 41, 8.2, 5.90 },
-    { 20, 33, 54.91, +46, 41, 38.0, 5.78 },
-    { 6, 56, 55.99, +46, 42, 18.0, 5.86 },
-    { 21, 25, 19.61, +46, 42, 51.8, 5.60 },
-    { 20, 13, 37.90, +46, 44, 29.0, 3.79 },
-    { 22, 5, 16.39, +46, 44, 40.9, 6.13 },
-    { 10, 18, 58.99, +46, 45, 38.9, 6.43 },
-    { 15, 38, 16.20, +46, 47, 52.1, 5.75 },
-    { 20, 13, 18.00, +46, 48, 56.9, 4.83 },
-    { 9, 17, 31.20, +46, 49, 1.9, 5.97 },
-    { 23, 47, 33.19, +46, 49, 57.0, 6.07 },
-    { 11, 38, 33.50, +46, 50, 3.1, 6.10 },
-    { 20, 19, 56.11, +46, 50, 15.0, 6.50 },
-    { 2, 51, 41.71, +46, 50, 30.8, 5.88 },
-    { 21, 3, 43.30, +46, 51, 42.8, 6.32 },
-    { 8, 43, .19, +46, 54, 4.0, 6.22 },
-    { 9, 34, 19.61, +46, 54, 7.9, 6.52 },
-    { 19, 1, 26.40, +46, 56, 4.9, 5.01 },
-    { 3, 29, 26.21, +46, 56, 16.1, 6.24 },
-    { 5, 10, 42.89, +46, 57, 43.9, 5.68 },
-    { 5, 20, 39.29, +46, 57, 50.0, 6.54 },
-    { 19, 16, 51.41, +46, 59, 57.1, 6.00 },
-    { 1, 30, 6.19, +47, 0, 25.9, 5.27 },
-    { 0, 43, 28.10, +47, 1, 28.9, 4.94 },
-    { 19, 51, 59.09, +47, 1, 39.0, 5.62 },
-    { 9, 3, 37.49, +47, 9, 24.1, 3.60 },
-    { 2, 56, 33.41, +47, 9, 50.0, 6.02 },
-    { 22, 43, 4.49, +47, 10, 7.0, 6.39 },
-    { 12, 54, 56.50, +47, 11, 48.1, 5.84 },
-    { 15, 28, 44.50, +47, 12, 5.0, 6.15 },
-    { 2, 59, 49.90, +47, 13, 14.9, 5.47 },
-    { 7, 15, 50.09, +47, 14, 24.0, 5.58 },
-    { 1, 9, 30.19, +47, 14, 30.8, 4.25 },
-    { 15, 0, 38.71, +47, 16, 40.1, 6.37 },
-    { 3, 7, 47.40, +47, 18, 29.9, 6.41 },
-    { 2, 20, 41.40, +47, 18, 38.9, 6.11 },
-    { 23, 55, 33.60, +47, 21, 20.9, 6.00 },
-    { 1, 3, 1.51, +47, 22, 34.0, 6.45 },
-    { 19, 51, 19.39, +47, 22, 37.9, 6.20 },
-    { 2, 19, 16.80, +47, 22, 48.0, 5.30 },
-    { 7, 54, 29.30, +47, 23, 10.0, 6.25 },
-    { 6, 27, 51.10, +47, 24, 19.1, 6.56 },
-    { 16, 53, 17.59, +47, 25, .8, 6.00 },
-    { 20, 55, 49.80, +47, 25, 4.1, 5.67 },
-    { 1, 18, 10.20, +47, 25, 10.9, 6.25 },
-    { 2, 14, 2.59, +47, 29, 3.1, 6.06 },
-    { 20, 59, 49.61, +47, 31, 16.0, 4.74 },
-    { 7, 54, 42.70, +47, 33, 52.9, 5.45 },
-    { 17, 47, 8.11, +47, 36, 43.9, 6.43 },
-    { 21, 6, 36.10, +47, 38, 53.9, 4.55 },
-    { 15, 3, 47.40, +47, 39, 15.8, 4.76 },
-    { 21, 10, 31.01, +47, 41, 30.8, 6.46 },
-    { 22, 29, 31.80, +47, 42, 24.8, 4.36 },
-    { 4, 8, 39.70, +47, 42, 45.0, 4.04 },
-    { 20, 15, 28.30, +47, 42, 51.8, 3.98 },
-    { 5, 36, 15.91, +47, 42, 55.1, 6.11 },
-    { 3, 12, 26.40, +47, 43, 32.9, 6.33 },
-    { 20, 12, 3.79, +47, 44, 12.8, 6.92 },
-    { 7, 5, 9.00, +47, 46, 30.0, 6.38 },
-    { 11, 46, 3.00, +47, 46, 45.8, 3.71 },
-    { 3, 42, 55.51, +47, 47, 15.0, 3.01 },
-    { 19, 53, 1.20, +47, 48, 27.0, 6.29 },
-    { 2, 15, 57.89, +47, 48, 41.0, 6.33 },
-    { 20, 47, 49.30, +47, 49, 54.8, 5.57 },
-    { 0, 44, 26.40, +47, 51, 51.1, 5.67 },
-    { 3, 55, 58.20, +47, 52, 17.0, 5.37 },
-    { 1, 49, 15.70, +47, 53, 48.8, 5.82 },
-    { 6, 0, 58.61, +47, 54, 6.8, 5.73 },
-    { 19, 47, 26.81, +47, 54, 28.1, 6.12 },
-    { 11, 30, 52.90, +47, 55, 45.1, 6.42 },
-    { 19, 52, 7.20, +47, 55, 54.8, 5.91 },
-    { 0, 17, 9.10, +47, 56, 51.0, 5.89 },
-    { 21, 15, 36.79, +47, 58, 25.0, 6.46 },
-    { 3, 30, 34.49, +47, 59, 43.1, 4.36 },
-    { 14, 17, 49.20, +48, 0, 6.1, 6.32 },
-    { 3, 32, 8.59, +48, 1, 25.0, 5.47 },
-    { 8, 59, 12.41, +48, 2, 30.1, 3.14 },
-    { 1, 16, 24.50, +48, 4, 55.9, 6.61 },
-    { 3, 30, 37.01, +48, 6, 13.0, 5.82 },
-    { 7, 41, 12.41, +48, 7, 54.1, 5.56 },
-    { 15, 5, 25.80, +48, 9, 4.0, 5.57 },
-    { 0, 11, 59.09, +48, 9, 9.0, 6.16 },
-    { 19, 34, 39.91, +48, 9, 52.9, 6.67 },
-    { 3, 13, 24.00, +48, 10, 36.8, 5.90 },
-    { 7, 28, 51.60, +48, 11, 2.0, 5.72 },
-    { 17, 20, 33.60, +48, 11, 17.9, 6.43 },
-    { 3, 36, 29.40, +48, 11, 34.1, 4.23 },
-    { 20, 4, 28.80, +48, 13, 46.9, 6.16 },
-    { 22, 5, 51.19, +48, 13, 54.1, 6.27 },
-    { 17, 26, 44.21, +48, 15, 36.0, 5.85 },
-    { 2, 43, 1.90, +48, 15, 56.2, 6.48 },
-    { 0, 44, 43.49, +48, 17, 3.8, 4.54 },
-    { 4, 41, 24.10, +48, 18, 2.9, 5.67 },
-    { 23, 19, 41.59, +48, 22, 50.9, 6.32 },
-    { 17, 50, 3.31, +48, 23, 39.1, 6.68 },
-    { 10, 19, 26.81, +48, 23, 48.8, 6.00 },
-    { 4, 14, 53.90, +48, 24, 33.8, 4.14 },
-    { 9, 42, 43.10, +48, 25, 52.0, 6.39 },
-    { 18, 3, 9.00, +48, 27, 51.8, 6.21 },
-    { 12, 48, 41.81, +48, 28, .8, 6.27 },
-    { 3, 44, 6.41, +48, 31, 25.0, 6.06 },
-    { 9, 5, 24.10, +48, 31, 49.1, 5.95 },
-    { 2, 53, 21.19, +48, 34, 9.8, 6.26 },
-    { 17, 36, 37.61, +48, 35, 8.2, 5.37 },
-    { 23, 19, 29.81, +48, 37, 31.1, 5.44 },
-    { 1, 37, 59.59, +48, 37, 41.9, 3.57 },
-    { 3, 53, 38.71, +48, 39, 2.2, 5.76 },
-    { 21, 57, 2.21, +48, 40, 7.0, 6.42 },
-    { 0, 55, 5.21, +48, 40, 43.0, 6.27 },
-    { 22, 57, 4.49, +48, 41, 3.1, 5.43 },
-    { 6, 11, 36.60, +48, 42, 40.0, 6.09 },
-    { 6, 11, 36.50, +48, 42, 47.2, 6.82 },
-    { 14, 49, 41.30, +48, 43, 14.2, 5.69 },
-    { 1, 36, 27.19, +48, 43, 22.1, 5.92 },
-    { 4, 51, 9.29, +48, 44, 26.9, 5.66 },
-    { 18, 48, 16.10, +48, 46, 3.0, 6.12 },
-    { 7, 37, 53.90, +48, 46, 25.0, 5.92 },
-    { 10, 28, 3.79, +48, 47, 4.9, 6.44 },
-    { 11, 31, 10.20, +48, 47, 21.1, 6.56 },
-    { 6, 47, 39.60, +48, 47, 21.8, 5.22 },
-    { 17, 4, 49.80, +48, 48, 15.1, 6.09 },
-    { 21, 26, 51.60, +48, 50, 6.0, 5.31 },
-    { 18, 54, 47.11, +48, 51, 34.9, 5.77 },
-    { 0, 20, 5.21, +48, 51, 55.1, 6.52 },
-    { 16, 38, 44.90, +48, 55, 41.9, 4.90 },
-    { 20, 30, 3.50, +48, 57, 6.1, 4.95 },
-    { 2, 19, 22.70, +48, 57, 19.1, 6.37 },
-    { 6, 1, 43.10, +48, 57, 33.8, 5.96 },
-    { 16, 30, 6.00, +48, 57, 38.9, 6.45 },
-    { 12, 19, 48.70, +48, 59, 3.1, 5.29 },
-    { 23, 17, 44.69, +49, 0, 55.1, 4.85 },
-    { 13, 34, 27.31, +49, 0, 58.0, 4.70 },
-    { 5, 57, 4.90, +49, 1, 45.8, 6.47 },
-    { 16, 19, 11.21, +49, 2, 17.2, 5.91 },
-    { 3, 28, 3.10, +49, 3, 46.1, 4.98 },
-    { 3, 21, 52.61, +49, 4, 14.9, 5.93 },
-    { 18, 47, 40.01, +49, 4, 30.0, 6.40 },
-    { 3, 25, 57.41, +49, 7, 14.9, 6.09 },
-    { 18, 21, 32.71, +49, 7, 18.1, 5.05 },
-    { 23, 30, 7.39, +49, 7, 59.2, 6.17 },
-    { 20, 56, 25.90, +49, 11, 44.9, 5.90 },
-    { 1, 58, 33.60, +49, 12, 15.1, 5.69 },
-    { 3, 31, 29.40, +49, 12, 34.9, 6.29 },
-    { 7, 26, 42.79, +49, 12, 41.0, 4.64 },
-    { 3, 23, 13.20, +49, 12, 47.9, 5.29 },
-    { 20, 31, 18.79, +49, 13, 13.1, 5.44 },
-    { 2, 44, 12.00, +49, 13, 41.9, 4.12 },
-    { 19, 33, 41.59, +49, 15, 45.0, 5.96 },
-    { 19, 37, 56.69, +49, 17, 3.8, 6.47 },
-    { 6, 24, 53.90, +49, 17, 17.2, 4.91 },
-    { 23, 7, 45.41, +49, 17, 44.9, 5.70 },
-    { 21, 46, 47.59, +49, 18, 33.8, 4.23 },
-    { 13, 47, 32.40, +49, 18, 47.9, 1.86 },
-    { 21, 24, 55.51, +49, 19, 23.9, 6.58 },
-    { 0, 39, 9.91, +49, 21, 15.8, 5.43 },
-    { 22, 30, 6.50, +49, 21, 22.0, 6.40 },
-    { 14, 34, 39.60, +49, 22, 5.9, 5.74 },
-    { 20, 27, 2.30, +49, 22, 59.9, 5.69 },
-    { 21, 22, .41, +49, 23, 20.0, 5.69 },
-    { 3, 31, 49.10, +49, 24, 2.9, 6.39 },
-    { 23, 12, 33.00, +49, 24, 23.0, 4.52 },
-    { 9, 33, 7.20, +49, 26, 19.0, 6.76 },
-    { 14, 8, 17.30, +49, 27, 29.2, 5.25 },
-    { 7, 18, 31.90, +49, 27, 54.0, 5.05 },
-    { 11, 16, 41.90, +49, 28, 35.0, 5.88 },
-    { 22, 24, 31.01, +49, 28, 35.0, 4.57 },
-    { 13, 36, 39.79, +49, 29, 12.1, 6.49 },
-    { 3, 29, 22.10, +49, 30, 32.0, 4.67 },
-    { 21, 19, 28.80, +49, 30, 37.1, 5.76 },
-    { 23, 41, 26.90, +49, 30, 43.9, 6.26 },
-    { 19, 18, 37.70, +49, 34, 10.9, 6.31 },
-    { 21, 42, 38.90, +49, 36, 1.1, 6.09 },
-    { 3, 9, 4.01, +49, 36, 47.9, 4.05 },
-    { 14, 56, 22.99, +49, 37, 43.0, 5.63 },
-    { 7, 29, 55.99, +49, 40, 21.0, 5.36 },
-    { 13, 18, 14.50, +49, 40, 54.8, 5.15 },
-    { 17, 16, 48.60, +49, 41, 28.0, 7.48 },
-    { 18, 7, 6.29, +49, 42, 38.2, 6.32 },
-    { 18, 21, 7.10, +49, 43, 32.2, 6.40 },
-    { 22, 56, 25.99, +49, 44, 1.0, 4.95 },
-    { 17, 11, 40.20, +49, 44, 48.1, 6.04 },
-    { 22, 8, 16.51, +49, 47, 47.0, 6.42 },
-    { 9, 55, 43.01, +49, 49, 12.0, 5.27 },
-    { 5, 45, 54.00, +49, 49, 35.0, 5.47 },
-    { 14, 28, 37.80, +49, 50, 40.9, 5.59 },
-    { 3, 28, 52.39, +49, 50, 53.9, 5.58 },
-    { 19, 12, 4.61, +49, 51, 15.1, 6.75 },
-    { 19, 12, 4.99, +49, 51, 22.0, 6.57 },
-    { 3, 24, 19.39, +49, 51, 40.0, 1.79 },
-    { 15, 59, 4.39, +49, 52, 52.0, 6.05 },
-    { 6, 2, 48.70, +49, 54, 20.2, 6.05 },
-    { 19, 5, 9.91, +49, 55, 23.9, 6.43 },
-    { 5, 59, 21.79, +49, 55, 27.8, 5.89 },
-    { 4, 43, 21.60, +49, 58, 26.0, 5.87 },
-    { 21, 32, 56.59, +49, 58, 40.1, 5.75 },
-    { 0, 1, 19.30, +49, 58, 54.1, 6.22 },
-    { 2, 24, 24.89, +50, 0, 24.1, 5.19 },
-    { 16, 56, 6.41, +50, 2, 20.0, 6.56 },
-    { 4, 19, 13.30, +50, 2, 56.0, 5.45 },
-    { 23, 4, 10.99, +50, 3, 7.9, 4.65 },
-    { 15, 8, 19.51, +50, 3, 18.0, 6.39 },
-    { 19, 15, 19.30, +50, 4, 14.9, 6.27 },
-    { 22, 35, 53.40, +50, 4, 16.0, 6.29 },
-    { 3, 19, 7.61, +50, 5, 42.0, 5.03 },
-    { 20, 1, 21.60, +50, 6, 16.9, 5.05 },
-    { 2, 20, 58.20, +50, 9, 5.0, 5.59 },
-    { 19, 36, 26.50, +50, 13, 16.0, 4.48 },
-    { 3, 18, 37.80, +50, 13, 19.9, 5.15 },
-    { 20, 7, 11.50, +50, 13, 45.1, 6.54 },
-    { 20, 15, 43.39, +50, 13, 58.1, 6.31 },
-    { 19, 35, 55.90, +50, 14, 19.0, 6.52 },
-    { 19, 23, 23.81, +50, 16, 17.0, 6.51 },
-    { 2, 25, 37.39, +50, 16, 43.0, 4.71 },
-    { 22, 31, 17.50, +50, 16, 57.0, 3.77 },
-    { 4, 18, 14.59, +50, 17, 44.2, 4.61 },
-    { 19, 31, 19.30, +50, 18, 24.1, 5.53 },
-    { 20, 42, 12.60, +50, 20, 24.0, 5.39 },
-    { 4, 6, 34.99, +50, 21, 5.0, 4.29 },
-    { 21, 3, 25.99, +50, 21, 6.8, 6.37 },
-    { 22, 52, 52.30, +50, 24, 42.8, 6.46 },
-    { 15, 38, 34.30, +50, 25, 23.9, 5.84 },
-    { 7, 44, 4.20, +50, 26, 2.0, 5.27 },
-    { 20, 58, 30.10, +50, 27, 43.9, 5.61 },
-    { 23, 39, 8.30, +50, 28, 18.1, 5.30 },
-    { 0, 42, 3.89, +50, 30, 45.0, 4.80 },
-    { 19, 41, 52.01, +50, 31, 3.0, 6.20 },
-    { 13, 40, 23.21, +50, 31, 9.8, 6.32 },
-    { 19, 41, 48.89, +50, 31, 31.1, 5.96 },
-    { 19, 0, 13.70, +50, 32, 1.0, 5.38 },
-    { 2, 27, 51.79, +50, 34, 10.9, 6.12 },
-    { 13, 28, 11.71, +50, 35, 13.9, 6.80 },
-    { 23, 14, 14.30, +50, 37, 4.1, 6.31 },
-    { 11, 37, 52.99, +50, 37, 5.9, 6.14 },
-    { 22, 50, 10.20, +50, 40, 36.8, 6.21 },
-    { 1, 43, 39.60, +50, 41, 19.0, 4.07 },
-    { 3, 56, 36.50, +50, 41, 43.1, 5.28 },
-    { 18, 53, 13.61, +50, 42, 29.9, 4.92 },
-    { 13, 37, 43.01, +50, 42, 52.9, 6.48 },
-    { 13, 28, 45.70, +50, 43, 5.9, 6.43 },
-    { 20, 56, 25.51, +50, 43, 43.0, 5.81 },
-    { 3, 48, 18.29, +50, 44, 12.1, 6.14 },
-    { 17, 49, 4.30, +50, 46, 52.0, 5.02 },
-    { 1, 52, 9.41, +50, 47, 34.1, 5.79 },
-    { 18, 58, 59.59, +50, 48, 33.8, 6.30 },
-    { 18, 6, 53.50, +50, 49, 22.1, 6.29 },
-    { 22, 11, 9.91, +50, 49, 23.9, 5.40 },
-    { 17, 8, 17.11, +50, 50, 31.9, 6.46 },
-    { 19, 56, 45.10, +50, 54, 9.0, 6.43 },
-    { 4, 20, 11.50, +50, 55, 14.9, 5.55 },
-    { 3, 16, 12.19, +50, 56, 16.1, 5.03 },
-    { 0, 48, 50.09, +50, 58, 5.9, 4.89 },
-    { 14, 2, 59.69, +50, 58, 18.8, 6.15 },
-    { 22, 20, 39.60, +50, 58, 50.9, 6.42 },
-    { 1, 4, 46.80, +51, 0, 36.0, 6.54 },
-    { 1, 2, 18.41, +51, 2, 6.0, 6.47 },
-    { 2, 13, 36.29, +51, 3, 56.9, 5.31 },
-    { 20, 56, 12.89, +51, 4, 30.0, 6.63 },
-    { 6, 13, 45.31, +51, 10, 21.0, 6.04 },
-    { 21, 42, 5.69, +51, 11, 22.9, 4.67 },
-    { 19, 34, 19.80, +51, 14, 12.1, 5.73 },
-    { 2, 56, 50.59, +51, 15, 38.9, 6.22 },
-    { 9, 20, 43.80, +51, 15, 58.0, 6.13 },
-    { 14, 17, 21.10, +51, 18, 25.9, 6.20 },
-    { 18, 19, 56.11, +51, 20, 52.1, 6.30 },
-    { 14, 16, 9.89, +51, 22, 1.9, 4.75 },
-    { 14, 49, 32.30, +51, 22, 28.9, 6.51 },
-    { 23, 58, 24.79, +51, 23, 19.0, 4.80 },
-    { 16, 28, 43.39, +51, 24, 28.1, 6.29 },
-    { 7, 13, 23.40, +51, 25, 44.0, 5.47 },
-    { 0, 17, 43.01, +51, 25, 59.2, 6.14 },
-    { 20, 12, 31.80, +51, 27, 49.0, 6.01 },
-    { 1, 52, 50.81, +51, 28, 28.9, 6.26 },
-    { 17, 56, 36.41, +51, 29, 20.0, 2.23 },
-    { 11, 0, 25.61, +51, 30, 6.8, 6.43 },
-    { 8, 8, 27.41, +51, 30, 24.1, 4.84 },
-    { 0, 50, 57.41, +51, 30, 29.2, 6.39 },
-    { 5, 50, 56.40, +51, 30, 52.9, 6.29 },
-    { 12, 30, 2.90, +51, 32, 8.2, 6.21 },
-    { 22, 37, 22.39, +51, 32, 43.1, 4.63 },
-    { 12, 24, 1.51, +51, 33, 43.9, 4.80 },
-    { 0, 51, 33.70, +51, 34, 16.0, 6.21 },
-    { 6, 4, 29.09, +51, 34, 23.9, 6.45 },
-    { 9, 24, 55.70, +51, 34, 26.0, 6.31 },
-    { 5, 6, 40.61, +51, 35, 52.1, 5.00 },
-    { 9, 8, 52.30, +51, 36, 16.9, 4.48 },
-    { 23, 50, 22.30, +51, 37, 18.1, 6.44 },
-    { 9, 32, 51.41, +51, 40, 37.9, 3.17 },
-    { 21, 34, 27.50, +51, 41, 53.9, 6.15 },
-    { 19, 29, 42.29, +51, 43, 46.9, 3.79 },
-    { 14, 13, 27.70, +51, 47, 16.1, 6.69 },
-    { 14, 13, 28.99, +51, 47, 25.1, 4.54 },
-    { 5, 56, 14.40, +51, 48, 14.0, 6.49 },
-    { 17, 41, 21.79, +51, 49, 5.2, 5.99 },
-    { 20, 5, 6.70, +51, 50, 21.8, 6.14 },
-    { 14, 25, 11.81, +51, 51, 2.9, 4.05 },
-    { 20, 34, 50.40, +51, 51, 15.1, 6.11 },
-    { 10, 59, 17.90, +51, 52, 55.9, 6.17 },
-    { 7, 24, 57.19, +51, 53, 13.9, 5.80 },
-    { 20, 48, 42.70, +51, 54, 38.2, 6.29 },
-    { 1, 50, 57.10, +51, 55, 59.9, 5.90 },
-    { 15, 20, 5.21, +51, 57, 31.0, 5.66 },
-    { 0, 24, 15.60, +52, 1, 12.0, 5.57 },
-    { 9, 34, 49.51, +52, 3, 5.0, 4.50 },
-    { 19, 59, 15.41, +52, 3, 20.9, 6.15 },
-    { 13, 43, 54.70, +52, 3, 51.8, 6.02 },
-    { 15, 36, 4.10, +52, 4, 10.9, 6.74 },
-    { 18, 32, 11.40, +52, 6, 56.2, 6.56 },
-    { 7, 17, 33.70, +52, 7, 50.9, 5.92 },
-    { 18, 39, 52.80, +52, 11, 46.0, 6.00 },
-    { 3, 8, 3.91, +52, 12, 47.9, 6.31 },
-    { 22, 23, 33.60, +52, 13, 45.1, 4.43 },
-    { 19, 2, 7.01, +52, 15, 40.0, 6.31 },
-    { 17, 30, 25.99, +52, 18, 5.0, 2.79 },
-    { 20, 31, 21.10, +52, 18, 34.9, 6.18 },
-    { 19, 27, 25.90, +52, 19, 14.2, 5.75 },
-    { 3, 0, 52.20, +52, 21, 6.1, 5.28 },
-    { 3, 0, 53.40, +52, 21, 7.9, 6.74 },
-    { 18, 33, 56.69, +52, 21, 13.0, 5.36 },
-    { 15, 42, 50.69, +52, 21, 38.9, 5.51 },
-    { 10, 5, 10.49, +52, 22, 14.9, 6.14 },
-    { 20, 47, 52.80, +52, 24, 25.9, 6.27 },
-    { 17, 10, 30.60, +52, 24, 32.0, 6.29 },
-    { 19, 8, 25.80, +52, 25, 32.2, 5.81 },
-    { 19, 55, 37.80, +52, 26, 20.0, 4.92 },
-    { 1, 4, 2.40, +52, 30, 7.9, 5.99 },
-    { 10, 52, 31.90, +52, 30, 13.0, 6.44 },
-    { 22, 44, 49.20, +52, 31, 1.9, 6.55 },
-    { 14, 15, 16.90, +52, 32, 8.9, 6.58 },
-    { 10, 52, 30.79, +52, 33, 55.1, 6.65 },
-    { 21, 31, 27.50, +52, 37, 12.0, 6.16 },
-    { 6, 11, 46.01, +52, 38, 49.9, 6.30 },
-    { 22, 59, 10.30, +52, 39, 15.8, 6.29 },
-    { 0, 53, 47.59, +52, 41, 21.1, 6.27 },
-    { 8, 39, 17.59, +52, 42, 42.1, 5.91 },
-    { 13, 27, 59.50, +52, 44, 44.9, 6.34 },
-    { 7, 5, 39.79, +52, 45, 29.2, 6.12 },
-    { 2, 54, 15.50, +52, 45, 45.0, 3.95 },
-    { 11, 16, 4.01, +52, 46, 23.2, 6.50 },
-    { 23, 7, 10.10, +52, 48, 59.0, 6.11 },
-    { 0, 31, 41.21, +52, 50, 21.8, 5.60 },
-    { 4, 53, 9.79, +52, 50, 26.9, 6.41 },
-    { 4, 56, 7.10, +52, 52, 9.8, 5.75 },
-    { 22, 1, 50.59, +52, 52, 55.9, 5.78 },
-    { 21, 26, 45.00, +52, 53, 55.0, 6.03 },
-    { 16, 36, 11.50, +52, 54, 1.1, 5.53 },
-    { 16, 2, 5.50, +52, 54, 56.9, 5.93 },
-    { 13, 39, 30.41, +52, 55, 17.0, 5.46 },
-    { 16, 36, 14.09, +52, 55, 27.1, 6.53 },
-    { 16, 36, 13.70, +52, 55, 27.8, 5.08 },
-    { 8, 39, .00, +52, 55, 30.0, 6.42 },
-    { 21, 30, 20.40, +52, 57, 29.2, 6.02 },
-    { 18, 51, 34.99, +52, 58, 30.0, 5.51 },
-    { 18, 46, 43.10, +52, 59, 17.2, 5.88 },
-    { 19, 50, 37.70, +52, 59, 17.2, 5.03 },
-    { 20, 46, 21.19, +52, 59, 43.1, 6.33 },
-    { 2, 52, 52.01, +52, 59, 52.1, 6.36 },
-    { 0, 25, 6.41, +53, 2, 48.8, 5.74 },
-    { 12, 30, 50.11, +53, 4, 36.1, 6.21 },
-    { 4, 39, 54.70, +53, 4, 46.9, 5.05 },
-    { 8, 32, 33.50, +53, 6, 52.9, 6.24 },
-    { 4, 59, 46.30, +53, 9, 20.2, 6.08 },
-    { 20, 6, 13.80, +53, 9, 56.9, 5.85 },
-    { 12, 17, 29.50, +53, 11, 28.0, 5.81 },
-    { 23, 16, 42.29, +53, 12, 49.0, 5.54 },
-    { 5, 14, 44.30, +53, 12, 50.0, 6.20 },
-    { 8, 23, 48.50, +53, 13, 10.9, 5.51 },
-    { 21, 3, 47.59, +53, 17, 10.0, 5.90 },
-    { 6, 44, 11.59, +53, 17, 47.0, 6.27 },
-    { 18, 23, 47.81, +53, 18, 2.9, 6.32 },
-    { 22, 7, 25.51, +53, 18, 25.9, 6.14 },
-    { 19, 17, 6.19, +53, 22, 7.0, 3.77 },
-    { 19, 4, 55.20, +53, 23, 48.1, 5.38 },
-    { 8, 38, 22.20, +53, 24, 5.0, 5.66 },
-    { 17, 21, 45.41, +53, 25, 14.2, 5.67 },
-    { 12, 14, 43.39, +53, 26, 4.9, 6.16 },
-    { 6, 21, 46.10, +53, 27, 7.9, 5.36 },
-    { 4, 39, 58.10, +53, 28, 23.2, 5.35 },
-    { 5, 41, 20.30, +53, 28, 52.0, 6.23 },
-    { 10, 33, 43.61, +53, 29, 51.0, 6.45 },
-    { 1, 7, 9.50, +53, 29, 53.9, 6.38 },
-    { 3, 4, 47.81, +53, 30, 23.0, 2.93 },
-    { 2, 42, 59.69, +53, 31, 34.0, 5.84 },
-    { 20, 24, 32.40, +53, 33, 6.8, 6.51 },
-    { 21, 10, 15.60, +53, 33, 47.9, 5.73 },
-    { 8, 20, 29.09, +53, 34, 27.8, 6.49 },
-    { 5, 17, 17.81, +53, 35, 10.0, 6.50 },
-    { 20, 20, 30.41, +53, 35, 46.0, 6.18 },
-    { 4, 16, 43.10, +53, 36, 42.8, 5.19 },
-    { 10, 39, 5.69, +53, 40, 5.9, 5.52 },
-    { 11, 53, 49.80, +53, 41, 40.9, 2.44 },
-    { 13, 53, 51.00, +53, 43, 43.0, 5.70 },
-    { 4, 57, 17.21, +53, 45, 7.9, 4.47 },
-    { 10, 20, 14.81, +53, 46, 45.1, 6.45 },
-    { 17, 43, 59.30, +53, 48, 6.1, 5.75 },
-    { 2, 10, 7.80, +53, 50, 35.2, 6.31 },
-    { 22, 40, 18.41, +53, 50, 46.0, 5.93 },
-    { 1, 40, 13.10, +53, 52, 5.9, 6.39 },
-    { 18, 43, 28.99, +53, 52, 18.8, 6.11 },
-    { 10, 4, 36.29, +53, 53, 30.1, 5.74 },
-    { 0, 36, 58.30, +53, 53, 48.8, 3.66 },
-    { 22, 42, 20.81, +53, 54, 32.0, 6.12 },
-    { 4, 32, 1.80, +53, 54, 38.9, 5.77 },
-    { 3, 25, 48.41, +53, 55, 18.1, 6.51 },
-    { 15, 35, 16.30, +53, 55, 18.8, 5.97 },
-    { 21, 17, 1.99, +53, 59, 51.0, 6.13 },
-    { 4, 6, 36.60, +54, 0, 31.0, 6.31 },
-    { 15, 26, 32.50, +54, 1, 12.0, 6.45 },
-    { 9, 16, 11.30, +54, 1, 18.8, 4.83 },
-    { 14, 38, 15.19, +54, 1, 23.9, 5.85 },
-    { 22, 32, 18.79, +54, 2, 15.0, 6.35 },
-    { 21, 37, 38.71, +54, 2, 31.9, 6.15 },
-    { 9, 52, 6.41, +54, 3, 51.8, 4.59 },
-    { 12, 56, 17.59, +54, 5, 57.8, 5.82 },
-    { 7, 51, 5.71, +54, 7, 45.1, 6.02 },
-    { 8, 18, 15.79, +54, 8, 37.0, 6.27 },
-    { 0, 36, 8.30, +54, 10, 7.0, 5.08 },
-    { 10, 20, 31.20, +54, 13, .8, 6.00 },
-    { 9, 4, .41, +54, 17, 2.0, 5.75 },
-    { 5, 59, 31.61, +54, 17, 4.9, 3.72 },
-    { 18, 10, 31.61, +54, 17, 12.1, 5.95 },
-    { 11, 30, 12.91, +54, 21, 42.1, 6.41 },
-    { 9, 43, 7.01, +54, 21, 49.0, 6.47 },
-    { 19, 19, 36.50, +54, 22, 34.0, 6.26 },
-    { 5, 6, 22.01, +54, 24, 20.9, 7.24 },
-    { 22, 48, 47.81, +54, 24, 54.0, 6.12 },
-    { 5, 36, 35.21, +54, 25, 44.0, 5.73 },
-    { 13, 46, 35.69, +54, 25, 58.1, 5.70 },
-    { 17, 5, 19.80, +54, 28, 13.1, 5.83 },
-    { 17, 5, 19.70, +54, 28, 13.1, 5.80 },
-    { 2, 2, 18.10, +54, 29, 15.0, 5.04 },
-    { 15, 37, 31.99, +54, 30, 32.0, 5.87 },
-    { 0, 31, 46.39, +54, 31, 19.9, 4.73 },
-    { 5, 59, 48.10, +54, 32, 49.9, 6.14 },
-    { 15, 6, 16.70, +54, 33, 23.0, 5.25 },
-    { 10, 53, 34.51, +54, 35, 6.0, 5.10 },
-    { 15, 35, 57.10, +54, 37, 50.2, 5.74 },
-    { 13, 40, 44.30, +54, 40, 54.1, 4.66 },
-    { 15, 57, 47.40, +54, 44, 58.9, 4.95 },
-    { 11, 35, 4.90, +54, 47, 7.1, 5.63 },
-    { 4, 9, 22.39, +54, 49, 44.0, 6.18 },
-    { 14, 18, 55.80, +54, 51, 51.1, 6.53 },
-    { 21, 40, 43.30, +54, 52, 19.9, 6.20 },
-    { 11, 12, 44.50, +54, 53, 39.1, 6.63 },
-    { 0, 33, 10.39, +54, 53, 42.0, 5.93 },
-    { 18, 44, 55.39, +54, 53, 48.1, 6.23 },
-    { 1, 8, 16.39, +54, 55, 13.1, 5.17 },
-    { 13, 23, 56.40, +54, 55, 18.1, 3.95 },
-    { 13, 23, 55.49, +54, 55, 31.1, 2.27 },
-    { 19, 38, 41.21, +54, 58, 26.0, 5.82 },
-    { 3, 33, 39.00, +54, 58, 28.9, 5.98 },
-    { 13, 25, 13.49, +54, 59, 17.2, 4.01 },
-    { 2, 43, 2.81, +55, 6, 20.9, 5.77 },
-    { 1, 51, 59.30, +55, 8, 51.0, 5.52 },
-    { 1, 11, 6.19, +55, 8, 58.9, 4.33 },
-    { 11, 41, 43.61, +55, 10, 21.0, 6.27 },
-    { 17, 32, 16.01, +55, 10, 23.2, 4.87 },
-    { 17, 32, 10.61, +55, 11, 3.1, 4.88 },
-    { 15, 28, 56.81, +55, 11, 42.0, 6.43 },
-    { 16, 24, 25.30, +55, 12, 18.0, 5.74 },
-    { 7, 52, 36.60, +55, 12, 33.8, 6.38 },
-    { 0, 45, 17.21, +55, 13, 18.1, 5.42 },
-    { 23, 2, 43.80, +55, 14, 11.0, 6.50 },
-    { 4, 55, 3.10, +55, 15, 33.1, 5.52 },
-    { 7, 22, 52.10, +55, 16, 53.0, 5.45 },
-    { 7, 22, 50.90, +55, 17, 3.8, 6.53 },
-    { 0, 46, 15.10, +55, 18, 19.1, 6.52 },
-    { 5, 59, 45.70, +55, 19, 14.9, 6.44 },
-    { 13, 34, 7.30, +55, 20, 55.0, 5.60 },
-    { 6, 34, 32.81, +55, 21, 11.2, 6.45 },
-    { 2, 23, 51.79, +55, 21, 51.8, 6.28 },
-    { 15, 47, 37.99, +55, 22, 36.1, 5.86 },
-    { 20, 18, 24.79, +55, 23, 49.9, 5.76 },
-    { 14, 32, 30.91, +55, 23, 52.1, 5.76 },
-    { 21, 28, 52.70, +55, 25, 7.0, 6.12 },
-    { 3, 30, .19, +55, 27, 6.8, 5.09 },
-    { 19, 42, 4.10, +55, 27, 47.9, 6.48 },
-    { 15, 46, 34.80, +55, 28, 28.9, 5.92 },
-    { 2, 29, 25.01, +55, 32, 11.0, 6.51 },
-    { 18, 42, 37.90, +55, 32, 21.8, 5.04 },
-    { 1, 53, 48.50, +55, 35, 53.2, 6.45 },
-    { 4, 48, 7.01, +55, 36, 9.0, 6.26 },
-    { 11, 46, 55.61, +55, 37, 41.9, 5.27 },
-    { 19, 0, 43.39, +55, 39, 29.9, 5.48 },
-    { 16, 42, 58.39, +55, 41, 25.1, 6.16 },
-    { 6, 48, 12.89, +55, 42, 15.8, 6.33 },
-    { 6, 48, 12.29, +55, 42, 15.8, 6.28 },
-    { 23, 57, 8.50, +55, 42, 20.9, 5.55 },
-    { 5, 54, 50.81, +55, 42, 24.8, 4.99 },
-    { 12, 27, 35.11, +55, 42, 46.1, 5.70 },
-    { 19, 31, 13.61, +55, 43, 54.8, 6.37 },
-    { 9, 29, 47.59, +55, 44, 44.2, 6.45 },
-    { 23, 59, .50, +55, 45, 18.0, 4.88 },
-    { 7, 36, 46.99, +55, 45, 19.1, 5.92 },
-    { 21, 52, 1.01, +55, 47, 48.8, 5.71 },
-    { 21, 17, 14.30, +55, 47, 53.2, 5.98 },
-    { 23, 44, 48.31, +55, 47, 58.9, 6.51 },
-    { 15, 52, 16.61, +55, 49, 36.1, 5.81 },
-    { 16, 9, 25.99, +55, 49, 44.0, 6.49 },
-    { 2, 22, 21.41, +55, 50, 44.2, 5.17 },
-    { 11, 25, 57.10, +55, 51, 2.2, 5.75 },
-    { 13, 45, 13.20, +55, 52, 45.8, 6.50 },
-    { 2, 50, 41.81, +55, 53, 44.2, 3.76 },
-    { 22, 49, 46.20, +55, 54, 10.1, 5.43 },
-    { 3, 47, 32.21, +55, 55, 21.0, 6.10 },
-    { 12, 54, 1.70, +55, 57, 34.9, 1.77 },
-    { 17, 55, 23.71, +55, 58, 17.0, 6.10 },
-    { 10, 30, 37.61, +55, 58, 50.2, 4.84 },
-    { 20, 39, .19, +56, 0, 18.0, 6.48 },
-    { 16, 38, .41, +56, 0, 56.2, 5.29 },
-    { 20, 29, 27.10, +56, 4, 5.2, 5.91 },
-    { 3, 5, 39.89, +56, 4, 7.0, 6.11 },
-    { 22, 35, 51.79, +56, 4, 12.0, 6.38 },
-    { 5, 46, 30.41, +56, 6, 56.2, 5.94 },
-    { 6, 26, 25.80, +56, 17, 6.0, 5.64 },
-    { 20, 5, 21.50, +56, 20, 29.0, 6.21 },
-    { 22, 6, 13.49, +56, 20, 35.2, 6.39 },
-    { 13, 0, 43.80, +56, 21, 59.0, 4.93 },
-    { 11, 1, 50.50, +56, 22, 57.0, 2.37 },
-    { 22, 26, 59.21, +56, 25, 59.9, 6.57 },
-    { 8, 13, 50.21, +56, 27, 7.9, 5.85 },
-    { 20, 44, 22.01, +56, 29, 17.2, 5.78 },
-    { 7, 56, 26.81, +56, 30, 15.8, 6.72 },
-    { 4, 21, 51.79, +56, 30, 24.1, 5.88 },
-    { 0, 40, 30.50, +56, 32, 13.9, 2.23 },
-    { 20, 13, 23.90, +56, 34, 4.1, 4.30 },
-    { 5, 43, 1.61, +56, 34, 54.1, 6.05 },
-    { 10, 51, 11.09, +56, 34, 55.9, 5.67 },
-    { 18, 14, 41.11, +56, 35, 17.9, 6.37 },
-    { 11, 55, 58.39, +56, 35, 55.0, 5.84 },
-    { 2, 25, 16.01, +56, 36, 36.0, 6.25 },
-    { 21, 54, 53.21, +56, 36, 41.0, 5.80 },
-    { 22, 33, 40.61, +56, 37, 30.0, 5.71 },
-    { 20, 26, 23.50, +56, 38, 20.0, 6.36 },
-    { 21, 2, 9.10, +56, 40, 10.9, 5.83 },
-    { 19, 56, 19.01, +56, 41, 12.8, 6.12 },
-    { 16, 59, 21.50, +56, 41, 19.0, 6.03 },
-    { 9, 21, 43.30, +56, 41, 57.1, 5.47 },
-    { 3, 5, 32.40, +56, 42, 20.9, 4.76 },
-    { 11, 29, 43.49, +56, 44, 15.0, 6.28 },
-    { 9, 15, 49.90, +56, 44, 29.0, 5.27 },
-    { 4, 48, .31, +56, 45, 25.9, 5.30 },
-    { 12, 25, 3.19, +56, 46, 39.0, 5.81 },
-    { 20, 31, 46.51, +56, 46, 48.0, 6.14 },
-    { 16, 45, 17.81, +56, 46, 54.8, 4.85 },
-    { 22, 38, 37.90, +56, 47, 44.9, 5.21 },
-    { 9, 59, 51.70, +56, 48, 42.8, 5.48 },
-    { 22, 11, 48.79, +56, 50, 21.8, 5.24 },
-    { 6, 37, 38.50, +56, 51, 27.0, 5.85 },
-    { 19, 11, 40.51, +56, 51, 33.1, 5.12 },
-    { 17, 53, 31.70, +56, 52, 22.1, 3.75 },
-    { 20, 56, 16.99, +56, 53, 15.0, 6.23 },
-    { 5, 50, 34.01, +56, 55, 8.0, 6.54 },
-    { 3, 38, 19.70, +56, 55, 58.1, 6.30 },
-    { 1, 7, .19, +56, 56, 6.0, 6.43 },
-    { 23, 0, 5.09, +56, 56, 43.1, 5.00 },
-    { 12, 15, 25.61, +57, 1, 57.0, 3.31 },
-    { 19, 43, 39.60, +57, 2, 33.0, 6.27 },
-    { 22, 15, 1.99, +57, 2, 37.0, 4.19 },
-    { 18, 32, 34.49, +57, 2, 44.2, 4.77 },
-    { 12, 11, 44.90, +57, 3, 15.8, 6.43 },
-    { 2, 16, 51.70, +57, 3, 19.1, 6.48 },
-    { 14, 34, 15.91, +57, 3, 55.1, 6.48 },
-    { 11, 21, 49.30, +57, 4, 30.0, 6.43 },
-    { 7, 40, 49.51, +57, 4, 58.1, 6.06 },
-    { 10, 35, 9.70, +57, 4, 58.1, 5.16 },
-    { 2, 49, 30.79, +57, 5, 3.1, 6.25 },
-    { 1, 44, 46.10, +57, 5, 21.1, 6.25 },
-    { 23, 1, 30.70, +57, 6, 20.2, 6.20 },
-    { 20, 43, 13.49, +57, 6, 51.1, 6.32 },
-    { 3, 49, 19.61, +57, 7, 5.2, 6.46 },
-    { 9, 46, 31.70, +57, 7, 41.2, 5.20 },
-    { 3, 15, 48.00, +57, 8, 26.9, 5.79 },
-    { 0, 10, 29.69, +57, 9, 56.2, 6.74 },
-    { 23, 13, 16.99, +57, 10, 5.9, 5.56 },
-    { 6, 46, 49.51, +57, 10, 9.1, 5.35 },
-    { 10, 43, 43.30, +57, 11, 57.1, 5.80 },
-    { 13, 40, 21.29, +57, 12, 27.0, 6.29 },
-    { 22, 16, 26.50, +57, 13, 13.1, 5.88 },
-    { 5, 32, 33.79, +57, 13, 16.0, 6.48 },
-    { 23, 41, 54.50, +57, 15, 36.0, 6.24 },
-    { 8, 2, 35.81, +57, 16, 25.0, 6.49 },
-    { 22, 23, .19, +57, 17, 3.8, 6.16 },
-    { 17, 40, 36.19, +57, 18, 37.1, 6.77 },
-    { 10, 46, 22.51, +57, 21, 56.9, 6.34 },
-    { 23, 55, 33.70, +57, 24, 43.9, 6.00 },
-    { 9, 57, 13.61, +57, 25, 5.9, 5.93 },
-    { 23, 47, 1.90, +57, 27, 5.0, 5.51 },
-    { 4, 15, 1.80, +57, 27, 37.1, 6.08 },
-    { 18, 53, 46.30, +57, 29, 12.8, 6.22 },
-    { 21, 38, 57.60, +57, 29, 21.1, 5.62 },
-    { 23, 54, 22.99, +57, 29, 57.8, 4.54 },
-    { 2, 18, 4.49, +57, 31, .1, 5.98 },
-    { 19, 53, 17.40, +57, 31, 25.0, 5.14 },
-    { 1, 44, 17.90, +57, 32, 11.0, 6.21 },
-    { 5, 23, 27.79, +57, 32, 39.8, 5.28 },
-    { 17, 33, 31.70, +57, 33, 32.0, 6.17 },
-    { 6, 57, 13.20, +57, 33, 47.9, 6.05 },
-    { 20, 45, 21.10, +57, 34, 46.9, 4.51 },
-    { 4, 27, .91, +57, 35, 7.1, 6.32 },
-    { 19, 20, 16.10, +57, 38, 43.1, 5.91 },
-    { 2, 11, 28.99, +57, 38, 44.9, 6.36 },
-    { 21, 59, 22.99, +57, 39, 29.9, 6.59 },
-    { 19, 13, 55.20, +57, 42, 18.0, 4.99 },
-    { 8, 20, 26.09, +57, 44, 35.9, 5.89 },
-    { 19, 21, 25.39, +57, 46, .8, 6.43 },
-    { 18, 56, 45.00, +57, 48, 54.0, 5.66 },
-    { 0, 49, 6.00, +57, 48, 56.9, 3.44 },
-    { 4, 17, 8.21, +57, 51, 38.2, 5.71 },
-    { 12, 20, 50.81, +57, 51, 50.0, 5.55 },
-    { 3, 33, 41.21, +57, 52, 8.0, 6.37 },
-    { 17, 30, 43.80, +57, 52, 35.0, 6.40 },
-    { 2, 17, 59.90, +57, 53, 58.9, 5.75 },
-    { 15, 39, 9.50, +57, 55, 27.8, 6.45 },
-    { 16, 9, 2.90, +57, 56, 16.1, 6.33 },
-    { 11, 40, 27.41, +57, 58, 14.2, 6.37 },
-    { 3, 53, 43.30, +57, 58, 30.0, 5.80 },
-    { 1, 38, 7.61, +57, 58, 39.0, 5.56 },
-    { 0, 56, 12.91, +57, 59, 48.1, 6.21 },
-    { 22, 2, 4.61, +58, 0, 2.2, 5.56 },
-    { 19, 43, 14.59, +58, 0, 59.0, 6.22 },
-    { 19, 25, 46.70, +58, 1, 37.9, 6.60 },
-    { 5, 19, 27.79, +58, 7, 1.9, 6.13 },
-    { 1, 23, 21.60, +58, 8, 35.2, 6.45 },
-    { 6, 30, 47.21, +58, 9, 46.1, 5.88 },
-    { 22, 10, 51.29, +58, 12, 4.0, 3.35 },
-    { 18, 57, 28.39, +58, 13, 31.1, 6.46 },
-    { 1, 20, 4.90, +58, 13, 54.1, 4.98 },
-    { 8, 10, 3.79, +58, 14, 53.2, 5.93 },
-    { 19, 55, 22.10, +58, 15, 1.1, 6.09 },
-    { 1, 8, 33.31, +58, 15, 49.0, 5.79 },
-    { 2, 51, 45.50, +58, 18, 52.9, 6.45 },
-    { 1, 33, 25.80, +58, 19, 39.0, 5.70 },
-    { 12, 29, 57.31, +58, 24, 20.9, 5.35 },
-    { 22, 29, 10.30, +58, 24, 55.1, 3.75 },
-    { 6, 26, 48.91, +58, 25, 1.9, 5.21 },
-    { 6, 57, 16.49, +58, 25, 21.0, 4.35 },
-    { 2, 8, 40.51, +58, 25, 25.0, 5.67 },
-    { 0, 6, 16.01, +58, 26, 12.1, 5.96 },
-    { 22, 47, 23.21, +58, 28, 58.1, 6.36 },
-    { 13, 50, 27.70, +58, 32, 21.8, 6.46 },
-    { 23, 30, 1.99, +58, 32, 56.0, 4.91 },
-    { 2, 13, 41.50, +58, 33, 40.0, 6.44 },
-    { 23, 3, 21.60, +58, 33, 52.9, 6.43 },
-    { 16, 1, 53.30, +58, 33, 55.1, 4.01 },
-    { 21, 17, 18.79, +58, 36, 42.1, 6.42 },
-    { 21, 19, 15.79, +58, 37, 25.0, 5.66 },
-    { 1, 42, 17.81, +58, 37, 40.1, 6.37 },
-    { 17, 26, 4.90, +58, 39, 6.8, 6.51 },
-    { 23, 47, 3.50, +58, 39, 6.8, 4.87 },
-    { 7, 43, .41, +58, 42, 37.1, 4.99 },
-    { 0, 42, 31.10, +58, 45, 11.9, 6.17 },
-    { 3, 33, 32.11, +58, 45, 54.0, 6.40 },
-    { 12, 30, 4.30, +58, 46, 3.0, 6.08 },
-    { 21, 43, 30.41, +58, 46, 48.0, 4.08 },
-    { 18, 23, 54.50, +58, 48, 2.2, 4.98 },
-    { 22, 7, 9.60, +58, 50, 26.9, 6.32 },
-    { 19, 55, 55.39, +58, 50, 46.0, 4.96 },
-    { 3, 29, 54.89, +58, 52, 43.0, 4.54 },
-    { 15, 55, 49.70, +58, 54, 42.1, 6.31 },
-    { 6, 9, 59.09, +58, 56, 8.9, 5.36 },
-    { 23, 49, 12.00, +58, 57, 47.2, 6.33 },
-    { 5, 52, 17.40, +58, 57, 51.1, 6.14 },
-    { 15, 24, 55.80, +58, 57, 58.0, 3.29 },
-    { 5, 6, 8.50, +58, 58, 21.0, 5.08 },
-    { 0, 55, .10, +58, 58, 22.1, 4.83 },
-    { 6, 19, 37.39, +59, 0, 38.9, 4.48 },
-    { 5, 6, 12.19, +59, 1, 16.0, 6.08 },
-    { 9, 50, 59.40, +59, 2, 19.0, 3.80 },
-    { 8, 1, 20.71, +59, 2, 51.0, 5.77 },
-    { 8, 53, 5.90, +59, 3, 22.0, 6.25 },
-    { 22, 11, 56.90, +59, 5, 4.9, 6.30 },
-    { 0, 9, 10.70, +59, 8, 58.9, 2.27 },
-    { 4, 4, 27.19, +59, 9, 20.2, 5.06 },
-    { 0, 56, 39.79, +59, 10, 52.0, 4.63 },
-    { 1, 33, 55.90, +59, 13, 54.8, 4.71 },
-    { 21, 42, 45.41, +59, 16, 16.0, 6.08 },
-    { 14, 51, 26.40, +59, 17, 38.0, 5.46 },
-    { 10, 51, 23.71, +59, 19, 12.0, 5.58 },
-    { 23, 9, 44.09, +59, 19, 59.2, 5.70 },
-    { 14, 8, 46.01, +59, 20, 16.1, 6.46 },
-    { 9, 6, 43.10, +59, 20, 39.8, 6.45 },
-    { 3, 30, 11.30, +59, 21, 58.0, 6.13 },
-    { 6, 22, 3.60, +59, 22, 19.9, 5.94 },
-    { 18, 51, 12.10, +59, 23, 17.9, 4.66 },
-    { 6, 5, 8.30, +59, 23, 35.2, 6.34 },
-    { 5, 15, 11.30, +59, 24, 20.2, 6.15 },
-    { 16, 3, 9.31, +59, 24, 38.9, 6.19 },
-    { 22, 11, 30.70, +59, 24, 51.8, 5.04 },
-    { 23, 6, 36.89, +59, 25, 10.9, 4.85 },
-    { 20, 59, 25.39, +59, 26, 19.0, 5.51 },
-    { 6, 46, 14.09, +59, 26, 30.1, 4.87 },
-    { 6, 53, 5.09, +59, 26, 55.0, 5.33 },
-    { 12, 36, 23.30, +59, 29, 12.8, 5.50 },
-    { 4, 43, 18.10, +59, 31, 14.9, 6.50 },
-    { 18, 27, 42.29, +59, 32, 57.1, 6.43 },
-    { 0, 0, 30.89, +59, 33, 34.9, 6.19 },
-    { 8, 17, 50.40, +59, 34, 16.0, 5.64 },
-    { 0, 46, 42.41, +59, 34, 27.8, 6.39 },
-    { 20, 25, 5.09, +59, 36, .0, 6.44 },
-    { 4, 22, 57.89, +59, 36, 59.0, 6.19 },
-    { 7, 15, 54.91, +59, 38, 15.0, 5.20 },
-    { 19, 53, 35.40, +59, 42, 32.0, 6.06 },
-    { 13, 2, 40.39, +59, 42, 58.0, 6.53 },
-    { 23, 7, 10.39, +59, 43, 39.0, 6.40 },
-    { 21, 27, 25.30, +59, 45, .0, 6.10 },
-    { 16, 17, 15.31, +59, 45, 18.0, 5.40 },
-    { 7, 6, 1.30, +59, 48, 6.8, 6.44 },
-    { 22, 59, 9.00, +59, 48, 52.9, 6.43 },
-    { 5, 54, 57.79, +59, 53, 17.9, 5.20 },
-    { 7, 22, 17.21, +59, 54, 6.8, 6.35 },
-    { 4, 9, 27.60, +59, 54, 29.2, 6.28 },
-    { 8, 39, 10.20, +59, 56, 21.8, 6.48 },
-    { 3, 29, 4.10, +59, 56, 25.1, 4.21 },
-    { 13, 28, 27.10, +59, 56, 44.9, 5.40 },
-    { 3, 42, 42.70, +59, 58, 9.8, 5.76 },
-    { 0, 30, 19.90, +59, 58, 37.9, 5.94 },
-    { 23, 48, 53.90, +59, 58, 44.0, 6.34 },
-    { 10, 15, 7.70, +59, 59, 8.2, 6.25 },
-    { 21, 11, 48.19, +59, 59, 11.0, 5.64 },
-    { 6, 15, 40.61, +59, 59, 57.1, 5.35 },
-    { 23, 57, 33.50, +60, 1, 25.0, 6.47 },
-    { 3, 35, .79, +60, 2, 28.0, 6.46 },
-    { 17, 25, 41.30, +60, 2, 53.9, 5.65 },
-    { 22, 53, 3.79, +60, 6, 4.0, 6.01 },
-    { 23, 22, 32.50, +60, 8, 1.0, 5.56 },
-    { 19, 33, 10.10, +60, 9, 31.0, 6.29 },
-    { 15, 1, 27.10, +60, 12, 15.8, 5.93 },
-    { 14, 31, 42.79, +60, 13, 32.2, 6.27 },
-    { 1, 25, 49.01, +60, 14, 7.1, 2.68 },
-    { 3, 28, 23.59, +60, 15, 20.2, 6.49 },
-    { 12, 48, 39.41, +60, 19, 12.0, 5.85 },
-    { 8, 1, 42.41, +60, 19, 27.8, 6.01 },
-    { 0, 36, 27.31, +60, 19, 34.0, 5.79 },
-    { 0, 56, 47.09, +60, 21, 46.1, 5.55 },
-    { 8, 15, 50.50, +60, 22, 50.2, 6.45 },
-    { 18, 11, 7.10, +60, 24, 33.8, 6.49 },
-    { 5, 3, 25.10, +60, 26, 31.9, 4.03 },
-    { 23, 3, 23.71, +60, 26, 43.1, 6.74 },
-    { 21, 30, 59.30, +60, 27, 33.8, 5.53 },
-    { 20, 40, 17.90, +60, 30, 19.1, 6.01 },
-    { 19, 40, 13.01, +60, 30, 25.9, 6.51 },
-    { 1, 43, 19.70, +60, 33, 4.0, 5.78 },
-    { 20, 42, 39.70, +60, 36, 5.0, 6.15 },
-    { 8, 22, 44.09, +60, 37, 52.0, 6.41 },
-    { 20, 13, 27.70, +60, 38, 26.2, 5.79 },
-    { 17, 1, 16.70, +60, 38, 57.1, 6.13 },
-    { 15, 27, 51.41, +60, 40, 13.1, 5.90 },
-    { 17, 16, 29.40, +60, 40, 14.2, 6.32 },
-    { 21, 47, 25.30, +60, 41, 34.1, 5.52 },
-    { 0, 56, 42.50, +60, 43, .1, 2.47 },
-    { 8, 30, 15.91, +60, 43, 5.2, 3.36 },
-    { 4, 21, 47.59, +60, 44, 8.2, 5.39 },
-    { 21, 20, 33.50, +60, 45, 24.8, 6.11 },
-    { 22, 12, 1.90, +60, 45, 33.8, 5.35 },
-    { 16, 32, 25.70, +60, 49, 23.9, 5.94 },
-    { 1, 42, 3.00, +61, 2, 17.9, 6.71 },
-    { 18, 44, 18.19, +61, 2, 53.2, 5.99 },
-    { 1, 3, 37.01, +61, 4, 30.0, 5.92 },
-    { 5, 1, 35.90, +61, 4, 41.2, 6.03 },
-    { 11, 32, 20.81, +61, 4, 57.0, 5.48 },
-    { 3, 57, 8.30, +61, 6, 32.0, 5.00 },
-    { 9, 55, 3.41, +61, 6, 58.0, 6.27 },
-    { 21, 45, 26.90, +61, 7, 14.9, 4.29 },
-    { 0, 53, 4.10, +61, 7, 27.1, 4.82 },
-    { 12, 43, 4.20, +61, 9, 20.2, 6.38 },
-    { 5, 6, 29.69, +61, 10, 12.0, 6.04 },
-    { 0, 1, 36.91, +61, 13, 23.2, 5.55 },
-    { 14, 42, 3.19, +61, 15, 42.8, 6.25 },
-    { 21, 49, 19.01, +61, 16, 22.1, 6.17 },
-    { 0, 5, 6.19, +61, 18, 51.1, 5.80 },
-    { 1, 42, 58.39, +61, 25, 18.1, 6.34 },
-    { 9, 14, 20.59, +61, 25, 23.9, 5.13 },
-    { 11, 58, 20.59, +61, 27, 52.9, 6.76 },
-    { 5, 44, 8.59, +61, 28, 36.1, 6.15 },
-    { 6, 37, 41.40, +61, 28, 52.0, 5.94 },
-    { 13, 49, 45.50, +61, 29, 21.1, 5.96 },
-    { 13, 57, 32.09, +61, 29, 34.1, 6.37 },
-    { 16, 23, 59.50, +61, 30, 51.1, 2.74 },
-    { 6, 17, 54.79, +61, 30, 55.1, 4.98 },
-    { 2, 55, 56.90, +61, 31, 16.0, 5.59 },
-    { 0, 16, 57.10, +61, 31, 59.9, 5.74 },
-    { 21, 55, 20.69, +61, 32, 30.8, 6.13 },
-    { 11, 56, 53.21, +61, 32, 57.1, 6.22 },
-    { 1, 4, 19.61, +61, 34, 49.1, 5.84 },
-    { 23, 42, 31.51, +61, 40, 45.8, 6.40 },
-    { 16, 23, 46.99, +61, 41, 48.1, 5.67 },
-    { 22, 51, 22.80, +61, 41, 48.8, 5.60 },
-    { 1, 58, 33.31, +61, 41, 53.2, 6.02 },
-    { 1, 13, 9.91, +61, 42, 20.9, 6.41 },
-    { 11, 3, 43.70, +61, 45, 2.9, 1.79 },
-    { 11, 29, 4.61, +61, 46, 41.9, 5.83 },
-    { 0, 51, 16.39, +61, 48, 20.9, 6.07 },
-    { 0, 24, 47.50, +61, 49, 52.0, 5.40 },
-    { 20, 45, 17.40, +61, 50, 20.0, 3.43 },
-    { 5, 13, 3.19, +61, 51, .0, 6.17 },
-    { 4, 16, 53.59, +61, 51, 1.1, 5.70 },
-    { 17, 34, 59.50, +61, 52, 30.0, 5.23 },
-    { 8, 53, 22.61, +61, 57, 43.9, 5.73 },
-    { 23, 16, 26.81, +61, 57, 47.2, 6.53 },
-    { 23, 20, 14.30, +61, 58, 12.0, 6.45 },
-    { 20, 5, 32.81, +61, 59, 44.2, 5.39 },
-    { 13, 6, 22.70, +62, 2, 30.8, 6.14 },
-    { 15, 22, 37.30, +62, 2, 49.9, 5.98 },
-    { 20, 11, 34.90, +62, 4, 43.0, 5.75 },
-    { 21, 37, 55.20, +62, 4, 54.8, 4.73 },
-    { 15, 29, 21.19, +62, 5, 58.9, 6.38 },
-    { 23, 20, 34.61, +62, 12, 47.2, 6.39 },
-    { 23, 48, 50.21, +62, 12, 51.8, 5.43 },
-    { 13, 9, 50.21, +62, 13, 45.1, 6.54 },
-    { 20, 19, 36.70, +62, 15, 27.0, 5.72 },
-    { 15, 27, 40.80, +62, 16, 32.2, 6.50 },
-    { 22, 5, 8.90, +62, 16, 48.0, 5.11 },
-    { 23, 24, 50.30, +62, 16, 58.1, 4.98 },
-    { 0, 4, 13.61, +62, 17, 16.1, 5.88 },
-    { 4, 7, 51.10, +62, 19, 48.0, 6.99 },
-    { 18, 57, 17.40, +62, 23, 48.1, 6.45 },
-    { 22, 23, .19, +62, 25, 12.0, 6.04 },
-    { 21, 44, 53.30, +62, 27, 38.2, 5.95 },
-    { 22, 0, 39.31, +62, 29, 17.2, 6.66 },
-    { 8, 19, 17.30, +62, 30, 25.9, 5.71 },
-    { 18, 37, 33.50, +62, 31, 36.1, 5.74 },
-    { 19, 26, 26.50, +62, 33, 25.9, 6.38 },
-    { 21, 18, 34.80, +62, 35, 8.2, 2.44 },
-    { 15, 46, 40.01, +62, 35, 57.8, 5.19 },
-    { 5, 20, 22.61, +62, 39, 13.0, 5.61 },
-    { 5, 13, 31.30, +62, 41, 29.0, 6.50 },
-    { 21, 58, 53.40, +62, 41, 53.9, 5.93 },
-    { 12, 41, 33.91, +62, 42, 47.2, 6.07 },
-    { 18, 40, 56.30, +62, 44, 58.9, 6.09 },
-    { 1, 6, 22.80, +62, 45, 42.1, 6.54 },
-    { 12, 47, 18.91, +62, 46, 50.9, 5.89 },
-    { 22, 5, .50, +62, 47, 8.2, 5.27 },
-    { 22, 18, 12.70, +62, 48, 15.8, 5.75 },
-    { 5, 49, 4.90, +62, 48, 29.2, 6.13 },
-    { 7, 46, 27.41, +62, 49, 50.2, 6.49 },
-    { 17, 12, 32.59, +62, 52, 27.8, 5.56 },
-    { 0, 33, .00, +62, 55, 54.1, 4.16 },
-    { 12, 5, 39.70, +62, 55, 59.2, 6.13 },
-    { 22, 48, 44.21, +62, 56, 17.9, 6.06 },
-    { 20, 29, 34.90, +62, 59, 39.1, 4.22 },
-    { 9, 31, 31.70, +63, 3, 42.8, 3.67 },
-    { 5, 30, 10.20, +63, 4, 1.9, 5.42 },
-    { 3, 57, 25.51, +63, 4, 19.9, 5.03 },
-    { 16, 36, 55.01, +63, 4, 22.1, 6.16 },
-    { 8, 2, 30.79, +63, 5, 25.1, 6.40 },
-    { 22, 3, 52.90, +63, 7, 10.9, 5.29 },
-    { 22, 13, 49.49, +63, 9, 45.0, 6.11 },
-    { 14, 30, 46.10, +63, 11, 8.2, 6.09 },
-    { 3, 42, 9.29, +63, 13, .1, 5.10 },
-    { 13, 25, 59.90, +63, 15, 40.0, 6.50 },
-    { 22, 12, 22.30, +63, 17, 29.0, 5.79 },
-    { 21, 9, 28.90, +63, 17, 44.2, 6.54 },
-    { 3, 49, 36.70, +63, 17, 49.9, 5.85 },
-    { 15, 22, 38.40, +63, 20, 29.0, 5.79 },
-    { 3, 46, 2.30, +63, 20, 42.0, 4.80 },
-    { 11, 1, 5.81, +63, 25, 16.0, 6.39 },
-    { 6, 6, 39.19, +63, 27, 13.0, 6.39 },
-    { 4, 52, 5.21, +63, 30, 19.1, 5.44 },
-    { 9, 10, 55.10, +63, 30, 49.0, 4.67 },
-    { 19, 58, 28.70, +63, 32, 3.1, 5.96 },
-    { 22, 38, 39.00, +63, 35, 3.8, 5.19 },
-    { 13, 1, 46.80, +63, 36, 37.1, 6.00 },
-    { 21, 56, 39.10, +63, 37, 32.2, 4.91 },
-    { 23, 7, 47.71, +63, 37, 59.9, 6.26 },
-    { 0, 3, 25.70, +63, 38, 30.8, 6.24 },
-    { 9, 45, 55.39, +63, 39, 11.9, 6.34 },
-    { 1, 54, 23.69, +63, 40, 12.0, 3.38 },
-    { 12, 25, 6.41, +63, 48, 10.1, 6.32 },
-    { 1, 47, 44.81, +63, 51, 7.9, 5.63 },
-    { 20, 4, 44.59, +63, 53, 26.2, 6.26 },
-    { 9, 25, 44.21, +63, 56, 26.9, 6.28 },
-    { 20, 21, 11.40, +63, 58, 49.1, 5.69 },
-    { 20, 49, 17.40, +64, 2, 31.9, 6.45 },
-    { 3, 7, 19.01, +64, 3, 28.1, 5.89 },
-    { 22, 28, 19.70, +64, 5, 8.2, 6.29 },
-    { 0, 25, 17.90, +64, 8, 36.0, },
-    { 5, 37, 15.10, +64, 9, 16.9, 6.15 },
-    { 0, 6, 26.50, +64, 11, 46.0, 5.59 },
-    { 1, 11, 25.61, +64, 12, 10.1, 5.55 },
-    { 15, 30, 55.70, +64, 12, 31.0, 5.79 },
-    { 23, 7, 57.19, +64, 13, 21.0, 6.21 },
-    { 0, 50, 43.61, +64, 14, 51.0, 5.39 },
-    { 10, 30, 26.59, +64, 15, 27.0, 6.12 },
-    { 4, 36, 24.19, +64, 15, 42.1, 5.94 },
-    { 8, 40, 12.79, +64, 19, 40.1, 4.60 },
-    { 11, 22, 51.29, +64, 19, 50.2, 6.02 },
-    { 2, 56, 24.79, +64, 19, 57.0, 6.24 },
-    { 2, 20, 12.89, +64, 20, 13.9, 6.60 },
-    { 11, 38, 49.20, +64, 20, 48.8, 6.46 },
-    { 14, 4, 23.30, +64, 22, 32.9, 3.65 },
-    { 2, 3, .29, +64, 23, 24.0, 5.58 },
-    { 19, 19, 46.10, +64, 23, 26.9, 6.52 },
-    { 18, 13, 53.81, +64, 23, 49.9, 5.03 },
-    { 21, 13, 42.60, +64, 24, 14.0, 6.39 },
-    { 23, 42, 20.81, +64, 30, 56.2, 6.56 },
-    { 3, 24, 40.51, +64, 35, 10.0, 5.23 },
-    { 16, 40, 55.10, +64, 35, 21.1, 4.83 },
-    { 17, 2, 15.31, +64, 36, 2.2, 6.10 },
-    { 8, 56, 37.49, +64, 36, 14.0, 5.58 },
-    { 1, 59, 37.99, +64, 37, 17.0, 5.26 },
-    { 22, 3, 47.40, +64, 37, 40.1, 4.29 },
-    { 20, 2, 20.30, +64, 38, 3.8, 6.57 },
-    { 1, 21, 5.21, +64, 39, 29.9, 6.34 },
-    { 13, 27, 10.70, +64, 43, 9.8, 7.04 },
-    { 13, 51, 25.90, +64, 43, 23.9, 4.65 },
-    { 13, 27, 4.61, +64, 44, 8.2, 6.66 },
-    { 20, 1, 28.49, +64, 49, 16.0, 5.27 },
-    { 13, 41, 29.90, +64, 49, 21.0, 5.85 },
-    { 9, 12, 2.60, +64, 51, 47.0, },
-    { 21, 19, 22.20, +64, 52, 18.8, 5.18 },
-    { 23, 48, 39.00, +64, 52, 35.0, 6.41 },
-    { 2, 2, 52.70, +64, 54, 5.0, 6.00 },
-    { 5, 9, 44.50, +64, 55, 9.8, 6.41 },
-    { 9, 44, 36.70, +64, 59, 2.0, 6.17 },
-    { 1, 11, 41.40, +65, 1, 8.0, 5.57 },
-    { 8, 39, 11.71, +65, 1, 14.9, 5.64 },
-    { 16, 56, 25.20, +65, 2, 21.1, 6.41 },
-    { 2, 4, 40.10, +65, 6, 11.9, 6.52 },
-    { 10, 18, 1.99, +65, 6, 29.9, 5.82 },
-    { 10, 48, 49.99, +65, 7, 55.9, 6.39 },
-    { 22, 27, 5.30, +65, 7, 55.9, 5.46 },
-    { 16, 56, 1.70, +65, 8, 4.9, 4.89 },
-    { 4, 20, 40.30, +65, 8, 26.2, 5.27 },
-    { 8, 34, 36.19, +65, 8, 42.0, 5.47 },
-    { 18, 56, 25.61, +65, 15, 29.2, 5.63 },
-    { 21, 55, 31.10, +65, 19, 14.9, 5.86 },
-    { 18, 31, 14.81, +65, 26, 10.0, 6.59 },
-    { 12, 55, 28.49, +65, 26, 19.0, 5.24 },
-    { 7, 46, 40.10, +65, 27, 20.9, 5.92 },
-    { 18, 36, 13.30, +65, 29, 19.0, 6.06 },
-    { 4, 6, 39.00, +65, 31, 14.9, 6.17 },
-    { 3, 49, 31.20, +65, 31, 34.0, 4.47 },
-    { 18, 25, 59.09, +65, 33, 49.0, 4.82 },
-    { 10, 24, 7.90, +65, 33, 59.0, 4.97 },
-    { 9, 50, 23.71, +65, 35, 35.9, 6.31 },
-    { 10, 29, 54.31, +65, 37, 34.0, 6.32 },
-    { 3, 19, 59.40, +65, 39, 7.9, 4.84 },
-    { 3, 17, 31.61, +65, 39, 31.0, 6.36 },
-    { 5, 42, 26.40, +65, 41, 52.1, 5.60 },
-    { 19, 20, 40.10, +65, 42, 52.9, 4.59 },
-    { 17, 8, 47.21, +65, 42, 52.9, 3.17 },
-    { 10, 41, 56.59, +65, 42, 59.0, 5.12 },
-    { 6, 12, 51.10, +65, 43, 5.9, 5.32 },
-    { 2, 37, 36.10, +65, 44, 44.2, 5.78 },
-    { 21, 51, 37.30, +65, 45, 10.1, 6.37 },
-    { 15, 3, 57.79, +65, 55, 10.9, 6.13 },
-    { 14, 57, 34.99, +65, 55, 57.0, 4.60 },
-    { 19, 9, 45.79, +65, 58, 43.0, 6.25 },
-    { 5, 57, 34.99, +66, 5, 46.0, 6.25 },
-    { 1, 30, 52.30, +66, 5, 53.2, 6.14 },
-    { 0, 2, 36.10, +66, 5, 56.0, 5.86 },
-    { 0, 42, 3.41, +66, 8, 51.0, 5.83 },
-    { 21, 57, 11.11, +66, 9, 22.0, 6.43 },
-    { 22, 49, 40.80, +66, 12, 2.2, 3.52 },
-    { 7, 27, 25.80, +66, 19, 54.1, 6.47 },
-    { 4, 54, 3.00, +66, 20, 34.1, 4.29 },
-    { 0, 58, 31.10, +66, 21, 7.9, 5.97 },
-    { 0, 31, 25.30, +66, 31, 9.8, 6.18 },
-    { 2, 14, 29.11, +66, 31, 27.8, 6.07 },
-    { 12, 59, 55.10, +66, 35, 49.9, 5.32 },
-    { 20, 43, 10.99, +66, 39, 27.0, 5.58 },
-    { 5, 37, 16.20, +66, 41, 46.0, 6.26 },
-    { 8, 48, 49.39, +66, 42, 29.2, 6.20 },
-    { 0, 3, 51.91, +66, 42, 43.9, 6.29 },
-    { 11, 42, 28.39, +66, 44, 42.0, 5.30 },
-    { 0, 34, 24.91, +66, 45, 1.1, 6.48 },
-    { 23, 46, 36.70, +66, 46, 55.9, 5.95 },
-    { 12, 47, 34.39, +66, 47, 25.1, 5.43 },
-    { 21, 27, 46.10, +66, 48, 33.1, 5.44 },
-    { 5, 2, 50.40, +66, 49, 22.1, 6.19 },
-    { 20, 17, 31.30, +66, 51, 14.0, 5.93 },
-    { 9, 8, 23.59, +66, 52, 23.9, 5.14 },
-    { 11, 20, 53.81, +67, 6, 2.2, 6.21 },
-    { 9, 10, 23.21, +67, 8, 4.9, 4.80 },
-    { 16, 12, 25.10, +67, 8, 39.1, 6.21 },
-    { 0, 4, 42.00, +67, 10, .1, 5.67 },
-    { 3, 46, .89, +67, 12, 6.1, 5.80 },
-    { 23, 3, 32.90, +67, 12, 33.1, 5.24 },
-    { 11, 9, 39.89, +67, 12, 37.1, 6.06 },
-    { 9, 39, 27.91, +67, 16, 19.9, 5.94 },
-    { 8, 29, 46.20, +67, 17, 51.0, 5.88 },
-    { 17, 25, .19, +67, 18, 23.0, 6.43 },
-    { 15, 14, 38.30, +67, 20, 48.1, 5.13 },
-    { 2, 29, 4.01, +67, 24, 9.0, 4.52 },
-    { 10, 45, 4.01, +67, 24, 41.0, 6.00 },
-    { 6, 50, 57.10, +67, 34, 18.8, 5.14 },
-    { 9, 2, 32.69, +67, 37, 46.9, 4.76 },
-    { 19, 12, 33.31, +67, 39, 42.1, 3.07 },
-    { 15, 10, 44.09, +67, 46, 53.0, 6.17 },
-    { 23, 47, 54.79, +67, 48, 24.8, 5.04 },
-    { 16, 6, 19.70, +67, 48, 37.1, 5.44 },
-    { 2, 44, 49.70, +67, 49, 28.9, 5.95 },
-    { 20, 2, 49.10, +67, 52, 25.0, 4.51 },
-    { 20, 4, 53.30, +68, 1, 37.9, 6.28 },
-    { 1, 42, 20.50, +68, 2, 35.2, 5.59 },
-    { 23, 18, 37.49, +68, 6, 42.1, 4.75 },
-    { 1, 25, 55.99, +68, 7, 48.0, 4.74 },
-    { 17, 31, 57.89, +68, 8, 6.0, 5.05 },
-    { 11, 12, 10.99, +68, 16, 18.8, 6.40 },
-    { 13, 50, 59.21, +68, 18, 55.1, 6.40 },
-    { 13, 16, 28.61, +68, 24, 29.2, 6.20 },
-    { 19, 46, 44.69, +68, 26, 17.9, 6.34 },
-    { 10, 41, 48.29, +68, 26, 35.9, 5.75 },
-    { 7, 30, 52.70, +68, 27, 56.2, 5.64 },
-    { 5, 52, 55.49, +68, 28, 17.0, 6.20 },
-    { 8, 12, 48.79, +68, 28, 27.1, 5.32 },
-    { 21, 9, 31.99, +68, 29, 25.1, 7.33 },
-    { 4, 12, 51.60, +68, 30, 6.1, 6.32 },
-    { 3, 51, 41.81, +68, 30, 27.0, 6.32 },
-    { 16, 18, 9.41, +68, 33, 15.8, 6.41 },
-    { 22, 49, .70, +68, 34, 13.1, 6.19 },
-    { 14, 1, 50.59, +68, 40, 43.0, 6.34 },
-    { 4, 6, 3.10, +68, 40, 48.0, 5.87 },
-    { 1, 56, .00, +68, 41, 7.1, 4.99 },
-    { 10, 21, 3.41, +68, 44, 51.0, 5.96 },
-    { 18, 15, 16.99, +68, 45, 20.9, 5.95 },
-    { 17, 36, 57.10, +68, 45, 29.2, 4.80 },
-    { 16, 27, 58.99, +68, 46, 5.2, 5.00 },
-    { 0, 56, 55.61, +68, 46, 34.0, 6.37 },
-    { 1, 10, 39.29, +68, 46, 43.0, 5.29 },
-    { 20, 20, 6.00, +68, 52, 49.1, 5.55 },
-    { 6, 53, 42.19, +68, 53, 17.9, 5.12 },
-    { 2, 51, 58.70, +68, 53, 19.0, 5.80 },
-    { 15, 14, 51.89, +68, 56, 43.1, 6.51 },
-    { 10, 43, 4.10, +69, 4, 34.0, 5.00 },
-    { 16, 21, 48.70, +69, 6, 33.8, 5.25 },
-    { 16, 59, 2.59, +69, 11, 11.0, 6.40 },
-    { 12, 30, 6.70, +69, 12, 4.0, 4.95 },
-    { 9, 42, 14.81, +69, 14, 15.0, 5.69 },
-    { 15, 37, 39.10, +69, 16, 59.9, 5.62 },
-    { 6, 18, 50.81, +69, 19, 10.9, 4.80 },
-    { 8, 32, 53.40, +69, 19, 12.0, 6.31 },
-    { 11, 36, 2.81, +69, 19, 22.1, 5.20 },
-    { 0, 46, 39.00, +69, 19, 30.0, 6.33 },
-    { 11, 31, 24.19, +69, 19, 52.0, 3.84 },
-    { 19, 44, 18.50, +69, 20, 12.8, 5.92 },
-    { 14, 12, 4.01, +69, 25, 57.0, 5.24 },
-    { 18, 58, 52.61, +69, 31, 52.0, 6.52 },
-    { 17, 36, 39.70, +69, 34, 14.9, 6.42 },
-    { 2, 48, 55.51, +69, 38, 3.1, 6.18 },
-    { 5, 9, 36.70, +69, 38, 21.8, 6.41 },
-    { 19, 32, 21.60, +69, 39, 40.0, 4.68 },
-    { 20, 44, 33.10, +69, 45, 6.8, 6.41 },
-    { 12, 33, 28.99, +69, 47, 17.9, 3.87 },
-    { 9, 34, 28.90, +69, 49, 49.1, 4.56 },
-    { 10, 53, 30.70, +69, 51, 14.0, 5.93 },
-    { 22, 33, 2.90, +69, 54, 49.0, 6.60 },
-    { 12, 34, 43.99, +70, 1, 18.8, 4.94 },
-    { 22, 10, 38.90, +70, 7, 58.1, 5.50 },
-    { 21, 47, 1.01, +70, 9, 2.9, 6.29 },
-    { 12, 15, 8.50, +70, 12, .0, 5.71 },
-    { 1, 31, 13.80, +70, 15, 52.9, 5.81 },
-    { 19, 48, 10.39, +70, 16, 4.1, 3.83 },
-    { 23, 27, 16.61, +70, 21, 34.9, 5.60 },
-    { 19, 58, 41.90, +70, 22, .8, 6.33 },
-    { 22, 33, 16.99, +70, 22, 26.0, 6.34 },
-    { 6, 28, 14.59, +70, 32, 8.2, 5.97 },
-    { 21, 28, 39.60, +70, 33, 38.9, 3.23 },
-    { 1, 42, 55.90, +70, 37, 21.0, 5.18 },
-    { 7, 5, 51.79, +70, 43, 54.8, 6.50 },
-    { 22, 26, .79, +70, 46, 14.9, 5.47 },
-    { 18, 43, 10.20, +70, 47, 34.1, 6.44 },
-    { 7, 1, 21.50, +70, 48, 29.2, 5.68 },
-    { 3, 49, 13.80, +70, 52, 16.0, 5.44 },
-    { 23, 15, 37.80, +70, 53, 17.2, 5.56 },
-    { 2, 1, 57.41, +70, 54, 24.8, 4.54 },
-    { 4, 50, 36.41, +70, 56, 30.1, 6.37 },
-    { 1, 25, 46.51, +70, 58, 48.0, 6.49 },
-    { 0, 33, 19.30, +70, 58, 54.1, 6.42 },
-    { 1, 0, 31.01, +70, 58, 59.2, 6.39 },
-    { 19, 31, .19, +70, 59, 21.8, 6.07 },
-    { 10, 17, 50.59, +71, 3, 38.2, 6.66 },
-    { 13, 37, 10.99, +71, 14, 31.9, 5.50 },
-    { 18, 54, 23.90, +71, 17, 49.9, 4.82 },
-    { 21, 41, 55.30, +71, 18, 41.0, 4.56 },
-    { 3, 50, 21.50, +71, 19, 55.9, 4.63 },
-    { 18, 20, 45.50, +71, 20, 16.1, 4.22 },
-    { 21, 6, 23.30, +71, 25, 54.8, 5.87 },
-    { 23, 34, 58.99, +71, 38, 31.9, 5.84 },
-    { 9, 14, 3.19, +71, 39, 20.9, 6.55 },
-    { 1, 16, 12.10, +71, 44, 38.0, 7.83 },
-    { 6, 40, 32.21, +71, 44, 56.0, 5.92 },
-    { 7, 13, 58.10, +71, 49, .1, 6.35 },
-    { 3, 56, 30.19, +71, 49, 18.1, 6.34 },
-    { 15, 17, 5.90, +71, 49, 26.0, 5.02 },
-    { 15, 20, 43.70, +71, 50, 2.0, 3.05 },
-    { 3, 30, 19.49, +71, 51, 50.0, 6.32 },
-    { 12, 26, 24.19, +71, 55, 46.9, 6.24 },
-    { 17, 55, 11.21, +72, 0, 18.0, 5.45 },
-    { 22, 10, 15.31, +72, 6, 40.0, 6.37 },
-    { 4, 13, 44.90, +72, 7, 35.0, 6.03 },
-    { 17, 41, 56.30, +72, 8, 56.0, 4.58 },
-    { 17, 41, 58.01, +72, 9, 24.8, 5.79 },
-    { 9, 34, 53.59, +72, 12, 20.2, 5.72 },
-    { 9, 42, 57.19, +72, 15, 9.0, 5.17 },
-    { 21, 43, 4.01, +72, 19, 13.1, 5.17 },
-    { 22, 9, 48.41, +72, 20, 28.0, 4.79 },
-    { 13, 26, 8.11, +72, 23, 29.0, 5.79 },
-    { 8, 20, 40.30, +72, 24, 25.9, 5.98 },
-    { 2, 3, 26.09, +72, 25, 17.0, 3.98 },
-    { 17, 37, 8.81, +72, 27, 20.9, 5.86 },
-    { 4, 33, 30.70, +72, 31, 43.0, 5.94 },
-    { 20, 30, .70, +72, 31, 54.1, 6.27 },
-    { 12, 15, 41.40, +72, 33, 2.9, 6.29 },
-    { 16, 31, 28.10, +72, 36, 42.8, 6.30 },
-    { 0, 48, 9.10, +72, 40, 30.0, 5.87 },
-    { 18, 21, 3.41, +72, 43, 58.1, 3.57 },
-    { 13, 13, 31.99, +72, 47, 56.0, 6.59 },
-    { 2, 38, 1.99, +72, 49, 5.9, 5.16 },
-    { 9, 58, 22.80, +72, 52, 45.8, 5.83 },
-    { 9, 15, 52.61, +72, 56, 46.0, 5.96 },
-    { 13, 4, 49.70, +73, 1, 31.1, 6.31 },
-    { 1, 38, 30.89, +73, 2, 24.0, 5.28 },
-    { 10, 18, 1.10, +73, 4, 23.9, 6.40 },
-    { 9, 37, 56.21, +73, 4, 50.2, 6.42 },
-    { 16, 56, 16.80, +73, 7, 40.1, 6.30 },
-    { 21, 59, 15.00, +73, 10, 48.0, 5.03 },
-    { 5, 18, 13.30, +73, 16, 5.2, 5.74 },
-    { 22, 12, 52.90, +73, 18, 25.9, 6.08 },
-    { 3, 35, 12.41, +73, 20, 48.8, 6.57 },
-    { 19, 15, 33.00, +73, 21, 20.2, 4.45 },
-    { 16, 14, 33.50, +73, 23, 42.0, 5.98 },
-    { 8, 39, 42.60, +73, 37, 46.9, 6.15 },
-    { 22, 35, 46.10, +73, 38, 35.2, 5.08 },
-    { 6, 37, 54.91, +73, 41, 44.2, 6.24 },
-    { 5, 4, 13.01, +73, 45, 50.0, 6.66 },
-    { 2, 3, 10.51, +73, 51, 2.2, 6.23 },
-    { 8, 0, 11.71, +73, 55, 5.2, 5.41 },
-    { 5, 12, 22.39, +73, 56, 48.1, 5.43 },
-    { 23, 39, 21.10, +74, 0, 10.1, 5.98 },
-    { 9, 19, 55.80, +74, 0, 59.0, 6.50 },
-    { 2, 13, 21.19, +74, 1, 40.1, 6.29 },
-    { 5, 4, 39.79, +74, 4, .8, 5.96 },
-    { 18, 45, 46.70, +74, 5, 8.2, 5.27 },
-    { 14, 50, 42.31, +74, 9, 20.2, 2.08 },
-    { 23, 14, 37.30, +74, 13, 52.0, 5.84 },
-    { 5, 2, 20.09, +74, 16, 9.1, 6.06 },
-    { 1, 37, 22.51, +74, 18, 2.9, 6.58 },
-    { 9, 36, 6.79, +74, 19, 4.1, 6.46 },
-    { 3, 11, 56.30, +74, 23, 37.0, 4.87 },
-    { 14, 6, 56.40, +74, 35, 37.0, 6.45 },
-    { 12, 9, 47.30, +74, 39, 41.0, 6.35 },
-    { 8, 36, 48.70, +74, 43, 25.0, 6.31 },
-    { 0, 47, 46.10, +74, 50, 51.0, 5.41 },
-    { 20, 31, 30.41, +74, 57, 16.9, 5.20 },
-    { 0, 45, 39.00, +74, 59, 17.2, 5.66 },
-    { 21, 57, 51.00, +74, 59, 48.1, 6.35 },
-    { 5, 39, 43.70, +75, 2, 38.0, 6.17 },
-    { 9, 27, 51.60, +75, 5, 53.9, 6.29 },
-    { 12, 18, 49.90, +75, 9, 38.2, 5.38 },
-    { 17, 54, 26.59, +75, 10, 14.9, 6.36 },
-    { 16, 12, 32.21, +75, 12, 38.2, 6.39 },
-    { 23, 39, 10.39, +75, 17, 34.1, 5.95 },
-    { 17, 1, 40.20, +75, 17, 49.9, 6.21 },
-    { 23, 17, 18.89, +75, 17, 57.1, 6.38 },
-    { 22, 37, 13.01, +75, 22, 18.1, 5.79 },
-    { 23, 7, 53.90, +75, 23, 15.0, 4.41 },
-    { 18, 46, 22.20, +75, 26, 2.0, 5.35 },
-    { 12, 58, 47.30, +75, 28, 21.0, 6.01 },
-    { 23, 52, 25.10, +75, 32, 40.9, 6.39 },
-    { 6, 5, 9.29, +75, 35, 8.9, 6.40 },
-    { 14, 27, 31.51, +75, 41, 46.0, 4.25 },
-    { 10, 35, 5.50, +75, 42, 47.2, 4.84 },
-    { 3, 39, 24.79, +75, 44, 22.9, 6.27 },
-    { 16, 17, 30.31, +75, 45, 19.1, 4.95 },
-    { 8, 19, 32.21, +75, 45, 24.8, 5.54 },
-    { 18, 53, 33.19, +75, 47, 15.0, 6.22 },
-    { 16, 10, 49.51, +75, 52, 39.0, 5.48 },
-    { 20, 54, 44.30, +75, 55, 32.2, 6.05 },
-    { 4, 48, 50.30, +75, 56, 28.0, 6.06 },
-    { 2, 5, 31.20, +76, 6, 54.0, 5.22 },
-    { 22, 32, 16.20, +76, 13, 35.0, 5.68 },
-    { 1, 21, 59.11, +76, 14, 20.0, 6.38 },
-    { 5, 14, 35.59, +76, 28, 22.1, 6.37 },
-    { 19, 59, 36.60, +76, 28, 53.0, 6.20 },
-    { 22, 18, 20.40, +76, 29, 17.2, 6.66 },
-    { 13, 34, 42.79, +76, 32, 48.1, 6.57 },
-    { 19, 9, 9.79, +76, 33, 38.2, 5.13 },
-    { 4, 46, .31, +76, 36, 40.0, 6.49 },
-    { 16, 3, 31.30, +76, 47, 37.0, 5.56 },
-    { 12, 5, 15.10, +76, 54, 20.9, 5.80 },
-    { 0, 16, 13.99, +76, 57, 2.9, 6.35 },
-    { 17, 49, 27.00, +76, 57, 46.1, 5.04 },
-    { 7, 0, 4.01, +76, 58, 39.0, 4.55 },
-    { 21, 15, 42.19, +77, 0, 43.9, 5.95 },
-    { 0, 30, 55.01, +77, 1, 9.8, 6.21 },
-    { 18, 57, 57.19, +77, 3, 2.9, 6.54 },
-    { 2, 5, 7.39, +77, 16, 53.0, 5.38 },
-    { 15, 31, 24.89, +77, 20, 57.8, 4.96 },
-    { 16, 30, 38.81, +77, 26, 48.1, 6.34 },
-    { 16, 43, 6.00, +77, 30, 51.1, 5.98 },
-    { 18, 29, 44.90, +77, 32, 48.8, 5.64 },
-    { 14, 8, 50.90, +77, 32, 51.0, 4.82 },
-    { 1, 20, 19.49, +77, 34, 14.2, 6.31 },
-    { 23, 51, 57.60, +77, 35, 57.8, 6.55 },
-    { 12, 12, 11.90, +77, 36, 59.0, 5.14 },
-    { 23, 39, 20.81, +77, 37, 57.0, 3.21 },
-    { 20, 8, 53.30, +77, 42, 41.0, 4.39 },
-    { 3, 20, 19.70, +77, 44, 4.9, 5.45 },
-    { 10, 59, 56.81, +77, 46, 12.0, 6.20 },
-    { 15, 44, 3.50, +77, 47, 39.8, 4.32 },
-    { 2, 2, 57.19, +77, 54, 59.0, 6.04 },
-    { 5, 29, 25.70, +77, 58, 39.0, 6.56 },
-    { 6, 40, 28.80, +77, 59, 44.9, 5.73 },
-    { 13, 42, 39.31, +78, 3, 51.8, 5.91 },
-    { 21, 5, 29.30, +78, 7, 35.0, 5.91 },
-    { 9, 45, 30.79, +78, 8, 4.9, 6.23 },
-    { 22, 23, 41.30, +78, 14, 35.9, 6.76 },
-    { 17, 50, 10.51, +78, 18, 24.1, 6.24 },
-    { 13, 26, 56.71, +78, 38, 38.0, 5.77 },
-    { 1, 23, 46.80, +78, 43, 32.9, 6.07 },
-    { 22, 26, 42.50, +78, 47, 8.9, 5.83 },
-    { 22, 29, 52.90, +78, 49, 27.1, 5.50 },
-    { 16, 37, 52.90, +78, 55, 5.9, 6.32 },
-    { 16, 25, 43.10, +78, 57, 50.0, 5.56 },
-    { 9, 47, 18.00, +79, 8, 12.1, 6.17 },
-    { 5, 22, 33.50, +79, 13, 52.0, 5.05 },
-    { 3, 6, 7.80, +79, 25, 7.0, 5.49 },
-    { 8, 4, 47.11, +79, 28, 46.9, 5.42 },
-    { 6, 46, 14.09, +79, 33, 52.9, 5.45 },
-    { 6, 40, 16.80, +79, 35, 57.8, 6.54 },
-    { 19, 21, 40.20, +79, 36, 10.1, 6.05 },
-    { 14, 33, 38.30, +79, 39, 37.1, 6.26 },
-    { 1, 12, 16.70, +79, 40, 26.0, 5.64 },
-    { 0, 9, 20.21, +79, 42, 52.9, 6.01 },
-    { 1, 16, 30.70, +79, 54, 36.0, 6.26 },
-    { 18, 45, 38.11, +79, 56, 33.0, 6.39 },
-    { 18, 0, 3.41, +80, 0, 2.9, 6.04 },
-    { 18, 0, 9.19, +80, 0, 15.1, 5.68 },
-    { 1, 9, 12.31, +80, 0, 42.1, 6.29 },
-    { 17, 19, 37.01, +80, 8, 11.0, 5.72 },
-    { 7, 56, 17.30, +80, 15, 56.2, 6.56 },
-    { 15, 29, 10.99, +80, 26, 55.0, 6.58 },
-    { 13, 12, 25.39, +80, 28, 17.0, 6.25 },
-    { 10, 36, 1.70, +80, 29, 39.8, 6.52 },
-    { 21, 24, 49.70, +80, 31, 28.9, 5.97 },
-    { 20, 47, 33.41, +80, 33, 7.9, 5.39 },
-    { 12, 44, 25.99, +80, 37, 16.0, 6.40 },
-    { 4, 10, 2.81, +80, 41, 55.0, 5.10 },
-    { 4, 27, 2.81, +80, 49, 27.1, 5.43 },
-    { 12, 0, 18.60, +80, 51, 11.2, 6.17 },
-    { 7, 34, 39.70, +80, 53, 48.1, 6.41 },
-    { 20, 29, 27.50, +81, 5, 29.0, 5.96 },
-    { 11, 31, 50.40, +81, 7, 37.9, 6.15 },
-    { 5, 0, 20.71, +81, 11, 38.0, 5.07 },
-    { 21, 13, 21.50, +81, 13, 50.9, 6.15 },
-    { 7, 25, 21.89, +81, 15, 27.0, 6.31 },
-    { 2, 9, 25.30, +81, 17, 44.9, 6.05 },
-    { 9, 37, 5.21, +81, 19, 35.0, 4.29 },
-    { 20, 28, 14.59, +81, 25, 22.1, 5.46 },
-    { 2, 47, 47.59, +81, 26, 53.9, 5.78 },
-    { 3, 11, 42.79, +81, 28, 14.2, 5.95 },
-    { 12, 11, .00, +81, 42, 36.0, 6.00 },
-    { 16, 45, 58.10, +82, 2, 13.9, 4.23 },
-    { 6, 44, 30.19, +82, 6, 55.1, 6.65 },
-    { 7, 31, 4.39, +82, 24, 41.0, 4.96 },
-    { 8, 24, 32.90, +82, 25, 50.9, 6.32 },
-    { 0, 39, 47.30, +82, 29, 38.0, 6.40 },
-    { 14, 50, 20.40, +82, 30, 42.8, 5.64 },
-    { 20, 42, 35.21, +82, 31, 52.0, 5.75 },
-    { 10, 31, 4.61, +82, 33, 31.0, 5.26 },
-    { 13, 42, 23.11, +82, 45, 9.0, 5.98 },
-    { 21, 58, 12.70, +82, 52, 10.9, 6.98 },
-    { 22, 47, 28.99, +83, 9, 14.0, 4.74 },
-    { 18, 24, 9.19, +83, 10, 31.1, 6.17 },
-    { 23, 56, 27.70, +83, 11, 28.0, 6.59 },
-    { 4, 30, .10, +83, 20, 26.2, 5.46 },
-    { 12, 49, 13.61, +83, 24, 46.1, 5.28 },
-    { 12, 49, 6.60, +83, 25, 5.2, 5.85 },
-    { 19, 15, 7.80, +83, 27, 46.1, 6.53 },
-    { 20, 29, 3.10, +83, 37, 32.2, 6.19 },
-    { 0, 54, 53.09, +83, 42, 25.9, 5.62 },
-    { 4, 28, 13.01, +83, 48, 28.1, 5.57 },
-    { 10, 8, 34.30, +83, 55, 5.9, 6.37 },
-    { 8, 16, 53.81, +84, 3, 28.1, 6.49 },
-    { 9, 15, 21.19, +84, 10, 52.0, 6.33 },
-    { 10, 29, 41.50, +84, 15, 7.9, 5.50 },
-    { 22, 54, 24.79, +84, 20, 46.0, 4.71 },
-    { 3, 32, 20.11, +84, 54, 40.0, 5.61 },
-    { 6, 1, 20.21, +85, 10, 55.9, 6.11 },
-    { 22, 51, 2.21, +85, 22, 25.0, 5.90 },
-    { 12, 4, 28.10, +85, 35, 13.9, 6.27 },
-    { 5, 43, 48.70, +85, 40, 5.2, 6.60 },
-    { 5, 31, 48.00, +85, 56, 19.0, 6.51 },
-    { 22, 13, 10.61, +86, 6, 29.2, 5.27 },
-    { 1, 8, 44.71, +86, 15, 24.8, 4.25 },
-    { 12, 16, 51.41, +86, 26, 10.0, 6.33 },
-    { 17, 32, 12.89, +86, 35, 11.0, 4.36 },
-    { 4, 10, 1.49, +86, 37, 34.0, 5.86 },
-    { 17, 30, 48.00, +86, 58, 5.2, 5.79 },
-    { 7, 40, 30.50, +87, 1, 12.0, 5.07 },
-    { 1, 16, 13.49, +87, 8, 43.1, 6.25 },
-    { 23, 27, .79, +87, 18, 27.0, 5.58 },
-    { 12, 15, 20.30, +87, 42, .0, 6.28 },
-    { 1, 33, 50.40, +89, 0, 56.2, 6.46 },
-    { 17, 16, 56.81, +89, 2, 16.1, 6.38 },
-    { 2, 31, 48.70, +89, 15, 51.1, 2.02 }, };
-
+    { -0.1874541, 0.9392178, -0.2876298, -1.46 },
+    { -0.0632220, 0.6027400, -0.7954291, -0.72 },
+    { -0.7837856, -0.5269882, 0.3285782, -0.04 },
+    { -0.3738585, -0.3125896, -0.8732225, -0.01 },
+    { 0.3059713, 0.0322894, -0.9514930, 0.00 },
+    { 0.0787400, -0.9015126, -0.4255292, 0.00 },
+    { -0.1186564, -0.9229028, -0.3662937, 0.00 },
+    { -0.2543359, -0.9410325, -0.2230942, 0.00 },
+    { -0.6626516, 0.7204074, 0.2047096, 0.00 },
+    { 0.4021105, -0.7923318, 0.4588219, 0.00 },
+    { -0.1660853, 0.8504390, 0.4991684, 0.00 },
+    { 0.1051206, 0.8556757, 0.5067236, 0.00 },
+    { -0.1610072, 0.7366413, 0.6568380, 0.00 },
+    { 0.7386742, 0.1392235, 0.6595280, 0.00 },
+    { 0.6037944, -0.4160245, 0.6799676, 0.00 },
+    { 0.4356184, 0.5738887, 0.6934612, 0.00 },
+    { 0.4334670, 0.0480435, 0.8998879, 0.00 },
+    { -0.3157292, 0.2841758, 0.9052951, 0.00 },
+    { 0.1250946, -0.7694143, 0.6263809, 0.03 },
+    { 0.1304979, 0.6823148, 0.7193169, 0.08 },
+    { 0.1950500, 0.9703629, -0.1426582, 0.12 },
+    { -0.4181101, 0.9038201, 0.0910671, 0.38 },
+    { 0.4927224, 0.2238065, -0.8409134, 0.46 },
+    { 0.0208902, 0.9914356, 0.1289148, 0.50 },
+    { -0.4239369, -0.2542820, -0.8692630, 0.61 },
+    { 0.4592207, -0.8748427, 0.1541639, 0.77 },
+    { 0.3439064, 0.8949728, 0.2841692, 0.85 },
+    { -0.3448193, -0.8264113, -0.4451336, 0.96 },
+    { -0.9140797, -0.3563534, -0.1935733, 0.98 },
+    { -0.3915114, 0.7911620, 0.4698739, 1.14 },
+    { 0.8373333, -0.2335842, -0.4942786, 1.16 },
+    { -0.4937982, -0.1043297, -0.8632952, 1.25 },
+    { 0.4556487, -0.5361829, 0.7105577, 1.25 },
+    { -0.4494036, -0.0523919, -0.8917912, 1.33 },
+    { -0.3738504, -0.3125920, -0.8732251, 1.33 },
+    { -0.8645017, 0.4578669, 0.2073516, 1.35 },
+    { -0.2213545, 0.8463883, -0.4843851, 1.50 },
+    { -0.5379670, -0.0736082, -0.8397460, 1.63 },
+    { -0.0916385, -0.7922608, -0.6032621, 1.63 },
+    { 0.1506258, 0.9823850, 0.1105964, 1.64 },
+    { 0.1286598, 0.8684416, 0.4788068, 1.65 },
+    { -0.2588252, 0.2306049, -0.9379930, 1.68 },
+    { 0.1035806, 0.9943999, -0.0209754, 1.70 },
+    { -0.4493983, -0.0524112, -0.8917927, 1.73 },
+    { 0.6029326, -0.3197986, -0.7308906, 1.74 },
+    { -0.5442931, -0.1307444, 0.8286440, 1.77 },
+    { -0.3629570, 0.5722975, -0.7353488, 1.78 },
+    { 0.4049799, 0.5015530, 0.7644840, 1.79 },
+    { -0.4591120, 0.1150477, 0.8808974, 1.79 },
+    { -0.2633595, 0.8561743, -0.4445305, 1.84 },
+    { 0.0868784, -0.8206787, -0.5647466, 1.85 },
+    { -0.2955685, 0.4124154, -0.8617150, 1.86 },
+    { -0.5814599, -0.2948001, 0.7582857, 1.86 },
+    { -0.0722594, -0.7278015, -0.6819703, 1.87 },
+    { 0.0014566, 0.7077529, 0.7064586, 1.90 },
+    { -0.1096139, -0.3407167, -0.9337542, 1.92 },
+    { -0.1571426, 0.9463599, 0.2823280, 1.93 },
+    { 0.3255906, -0.4414254, -0.8361426, 1.94 },
+    { -0.3803671, 0.4348604, -0.8162213, 1.96 },
+    { -0.0940693, 0.9466321, -0.3082833, 1.98 },
+    { -0.7779312, 0.6100481, -0.1505467, 1.98 },
+    { -0.3406070, 0.7777679, 0.5282650, 1.98 },
+    { 0.7796809, 0.4832963, 0.3981488, 2.00 },
+    { -0.4513889, -0.7779291, 0.4371206, 2.00 },
+    { 0.2140957, -0.8705727, -0.4430195, 2.02 },
+    { 0.0101260, 0.0078979, 0.9999175, 2.02 },
+    { 0.9339765, 0.1798133, -0.3087961, 2.04 },
+    { 0.0838108, 0.9959048, -0.0339019, 2.05 },
+    { -0.6852925, -0.4227628, -0.5929974, 2.06 },
+    { 0.0526369, 0.9843862, -0.1679680, 2.06 },
+    { 0.8732667, 0.0319767, 0.4861922, 2.06 },
+    { 0.7755539, 0.2435333, 0.5824154, 2.06 },
+    { -0.1065360, -0.9702373, 0.2174619, 2.08 },
+    { -0.2007271, -0.1850719, 0.9620068, 2.08 },
+    { 0.6449286, -0.2262668, -0.7299797, 2.10 },
+    { 0.5146514, 0.5527094, 0.6554741, 2.12 },
+    { -0.9667303, 0.0461817, 0.2515945, 2.14 },
+    { -0.6458459, -0.1182927, -0.7542479, 2.17 },
+    { 0.4437863, -0.6208561, 0.6462132, 2.20 },
+    { -0.5310911, 0.4952642, -0.6874995, 2.21 },
+    { 0.1218381, 0.9925363, -0.0052219, 2.23 },
+    { -0.5291701, -0.7196426, 0.4495481, 2.23 },
+    { -0.0092185, -0.6225981, 0.7824874, 2.23 },
+    { 0.5428049, 0.0969530, 0.8342439, 2.23 },
+    { -0.3871811, 0.3333517, -0.8596321, 2.25 },
+    { -0.3933329, 0.6573101, -0.6428318, 2.25 },
+    { 0.6338546, 0.3804819, 0.6733957, 2.26 },
+    { -0.5365438, -0.2057580, 0.8184036, 2.27 },
+    { 0.5123857, 0.0205310, 0.8585100, 2.27 },
+    { -0.2478713, -0.7881034, -0.5634295, 2.29 },
+    { -0.5396440, -0.2513158, -0.8035078, 2.30 },
+    { -0.5149490, -0.4395361, -0.7359589, 2.30 },
+    { -0.5771001, -0.4652739, -0.6711749, 2.31 },
+    { -0.4603697, -0.8000675, -0.3846449, 2.32 },
+    { -0.5359151, 0.1389921, 0.8327522, 2.37 },
+    { 0.7347013, 0.0846283, -0.6730914, 2.39 },
+    { 0.8172036, -0.5502420, 0.1714992, 2.39 },
+    { -0.0592981, -0.7745498, -0.6297272, 2.41 },
+    { 0.8558512, -0.2142797, 0.4707471, 2.42 },
+    { -0.2067877, -0.9401008, -0.2710153, 2.43 },
+    { -0.5918733, 0.0159381, 0.8058735, 2.44 },
+    { 0.3508638, -0.2981337, 0.8876998, 2.44 },
+    { -0.3128502, 0.8139922, -0.4894298, 2.45 },
+    { 0.5501023, -0.6206216, 0.5587632, 2.46 },
+    { 0.4742311, 0.1197971, 0.8722118, 2.47 },
+    { 0.9370985, -0.2303397, 0.2622785, 2.49 },
+    { -0.4426465, 0.3645227, -0.8192602, 2.50 },
+    { 0.6982548, 0.7122879, 0.0713180, 2.53 },
+    { -0.5939218, -0.3276596, -0.7347762, 2.55 },
+    { -0.3476473, -0.9195162, -0.1833885, 2.56 },
+    { -0.9178149, 0.1862798, 0.3505933, 2.56 },
+    { 0.1130106, 0.9452795, -0.3060641, 2.58 },
+    { -0.9512299, -0.0657109, -0.3014030, 2.59 },
+    { -0.6326560, -0.0230833, -0.7740889, 2.60 },
+    { 0.2339430, -0.8349118, -0.4981897, 2.60 },
+    { -0.6440037, -0.7474482, -0.1630351, 2.61 },
+    { -0.8524548, 0.3976345, 0.3394225, 2.61 },
+    { -0.4509641, -0.8257273, -0.3388301, 2.62 },
+    { 0.0009672, 0.7963974, 0.6047729, 2.62 },
+    { 0.0734583, 0.8250490, -0.5602660, 2.64 },
+    { 0.8202478, 0.4483286, 0.3552393, 2.64 },
+    { -0.9074663, -0.1371880, -0.3970949, 2.65 },
+    { -0.5547151, -0.8244796, 0.1119131, 2.65 },
+    { -0.5193122, -0.5127002, -0.6837055, 2.68 },
+    { -0.8325424, -0.4552601, 0.3156127, 2.68 },
+    { 0.4620410, 0.1815763, 0.8680715, 2.68 },
+    { -0.3514801, -0.0575306, -0.9344260, 2.69 },
+    { -0.6175832, 0.2043358, -0.7594984, 2.69 },
+    { -0.1012090, -0.7890535, -0.6059302, 2.69 },
+    { 0.2272436, 0.8056530, 0.5470682, 2.69 },
+    { -0.2634350, 0.7528507, -0.6031732, 2.70 },
+    { 0.0793601, -0.8638840, -0.4973997, 2.70 },
+    { -0.6694853, -0.5870548, 0.4551439, 2.70 },
+    { 0.4395622, -0.8791263, 0.1841796, 2.72 },
+    { -0.4439263, -0.8937436, -0.0644346, 2.74 },
+    { -0.1940052, -0.4357003, 0.8789353, 2.74 },
+    { -0.7525865, -0.2761407, -0.5977958, 2.75 },
+    { -0.7060748, -0.6519941, -0.2763368, 2.75 },
+    { -0.4079839, 0.1425606, -0.9017902, 2.76 },
+    { 0.1064192, 0.9889757, -0.1029661, 2.77 },
+    { -0.0718206, -0.9942339, 0.0796282, 2.77 },
+    { -0.3552552, -0.8599961, 0.3663339, 2.77 },
+    { -0.4447599, -0.6073629, -0.6582545, 2.78 },
+    { 0.2247004, 0.9703863, -0.0886577, 2.79 },
+    { -0.0786718, -0.6064261, 0.7912384, 2.79 },
+    { 0.2192348, 0.0247380, -0.9753585, 2.80 },
+    { -0.5176575, -0.0342584, -0.8549018, 2.80 },
+    { 0.1099517, -0.8964551, -0.4292771, 2.81 },
+    { -0.4814126, 0.7738494, -0.4115811, 2.81 },
+    { -0.2867997, -0.8019578, 0.5240322, 2.81 },
+    { -0.3162026, -0.8224825, -0.4727986, 2.82 },
+    { -0.9458538, -0.2630946, 0.1901098, 2.83 },
+    { 0.9634822, 0.0557094, 0.2619131, 2.83 },
+    { 0.1291483, 0.9261155, -0.3544443, 2.84 },
+    { -0.2318012, -0.3825295, -0.8943933, 2.85 },
+    { -0.0853657, -0.5594998, -0.8244226, 2.85 },
+    { 0.4432494, 0.7242510, 0.5281955, 2.85 },
+    { 0.4135771, 0.2358285, -0.8793969, 2.86 },
+    { 0.4482115, -0.2125829, -0.8682828, 2.86 },
+    { 0.8034681, -0.5265763, -0.2777706, 2.87 },
+    { 0.4988642, 0.7644186, 0.4084101, 2.87 },
+    { 0.3119610, -0.6327696, 0.7087193, 2.87 },
+    { -0.0923922, 0.9191567, 0.3829029, 2.88 },
+    { -0.3406059, 0.7777653, 0.5282696, 2.88 },
+    { -0.2350308, -0.2774086, -0.9315605, 2.89 },
+    { -0.4528499, -0.7753610, -0.4401616, 2.89 },
+    { -0.3769105, -0.8193523, -0.4319725, 2.89 },
+    { 0.2797685, -0.8905201, -0.3587526, 2.89 },
+    { 0.3891610, 0.6596974, 0.6429254, 2.89 },
+    { -0.3672875, 0.9188656, 0.1441729, 2.90 },
+    { -0.7612495, -0.1899008, 0.6200297, 2.90 },
+    { 0.7937074, -0.6005030, -0.0970811, 2.91 },
+    { -0.1371672, 0.6195292, -0.7728963, 2.93 },
+    { 0.4116464, 0.4292490, 0.8039232, 2.93 },
+    { 0.8157771, -0.2848755, 0.5033426, 2.94 },
+    { -0.0789797, -0.6395845, -0.7646528, 2.95 },
+    { -0.9506138, -0.1245804, -0.2842766, 2.95 },
+    { 0.4933876, 0.8378566, -0.2335915, 2.95 },
+    { 0.8783516, -0.4779826, -0.0055797, 2.96 },
+    { -0.7627963, 0.5055942, 0.4031332, 2.98 },
+    { -0.1724817, 0.8887562, 0.4246911, 2.98 },
+    { 0.0218515, -0.8620230, -0.5063979, 2.99 },
+    { 0.2733447, -0.9315962, 0.2396063, 2.99 },
+    { 0.1807403, 0.6984729, 0.6924367, 2.99 },
+    { -0.8653573, -0.3103612, -0.3934878, 3.00 },
+    { -0.9221774, -0.0407664, -0.3846126, 3.00 },
+    { 0.0908326, 0.9282527, 0.3606887, 3.00 },
+    { 0.6918500, 0.4388207, 0.5733933, 3.00 },
+    { -0.3525810, 0.2309387, -0.9068373, 3.01 },
+    { 0.6775361, -0.4154862, -0.6068904, 3.01 },
+    { -0.6961325, 0.1554026, 0.7008920, 3.01 },
+    { 0.3783199, 0.5552474, 0.7406580, 3.01 },
+    { -0.0766089, 0.8620752, -0.5009566, 3.02 },
+    { -0.2483887, 0.8803549, -0.4040771, 3.02 },
+    { -0.0414002, -0.7634974, -0.6444825, 3.03 },
+    { -0.6181763, -0.4833126, 0.6198928, 3.03 },
+    { -0.6548145, -0.3394846, -0.6752541, 3.04 },
+    { 0.8196795, 0.5704624, -0.0519438, 3.04 },
+    { -0.3652796, -0.0747846, -0.9278890, 3.05 },
+    { -0.6819714, 0.3096131, 0.6626121, 3.05 },
+    { -0.1996438, -0.2394676, 0.9501566, 3.05 },
+    { 0.1183248, -0.3611869, 0.9249558, 3.07 },
+    { -0.2306699, -0.7529593, -0.6163145, 3.08 },
+    { 0.5580855, -0.7895875, -0.2551317, 3.08 },
+    { 0.3405836, -0.8149737, 0.4688503, 3.08 },
+    { 0.4304429, -0.5241844, -0.7348127, 3.11 },
+    { 0.0615556, -0.7987633, -0.5984881, 3.11 },
+    { -0.9154041, 0.2902741, -0.2788840, 3.11 },
+    { -0.6890247, 0.7172972, 0.1035844, 3.11 },
+    { 0.0319964, 0.8107562, -0.5845089, 3.12 },
+    { -0.4511531, 0.0478560, -0.8911625, 3.13 },
+    { -0.4334514, 0.3289429, -0.8389973, 3.13 },
+    { -0.1480166, -0.5393929, -0.8289429, 3.13 },
+    { -0.5265370, -0.5226989, -0.6704809, 3.13 },
+    { -0.6345649, 0.5275052, 0.5648590, 3.13 },
+    { -0.1769196, -0.8900776, 0.4200730, 3.14 },
+    { -0.4711253, 0.4743976, 0.7436316, 3.14 },
+    { -0.1560357, -0.7852832, 0.5991521, 3.16 },
+    { -0.1195744, 0.7191418, -0.6844976, 3.17 },
+    { 0.1763450, -0.8734557, -0.4538475, 3.17 },
+    { 0.1739113, 0.7316338, 0.6591409, 3.17 },
+    { -0.4966187, 0.3713262, 0.7845296, 3.17 },
+    { -0.0911416, -0.4010548, 0.9115088, 3.17 },
+    { -0.3210501, -0.2754329, -0.9061256, 3.19 },
+    { 0.2179873, 0.8986779, -0.3806042, 3.19 },
+    { 0.2991499, 0.9464776, 0.1212004, 3.19 },
+    { -0.2650446, -0.9503770, 0.1628955, 3.20 },
+    { 0.6444638, -0.5755251, 0.5034255, 3.20 },
+    { -0.0353090, -0.7973991, -0.6024185, 3.21 },
+    { 0.2133122, -0.0192751, 0.9767939, 3.21 },
+    { -0.4842159, -0.5841306, -0.6514035, 3.22 },
+    { 0.5420382, -0.8402316, -0.0143354, 3.23 },
+    { 0.2628439, -0.2041399, 0.9429952, 3.23 },
+    { 0.1486950, 0.2273127, -0.9624026, 3.24 },
+    { 0.5433251, 0.5351448, -0.6468523, 3.24 },
+    { -0.4278051, -0.9001612, -0.0818080, 3.24 },
+    { 0.2140739, -0.8139294, 0.5400845, 3.24 },
+    { -0.2762397, 0.6732909, -0.6858360, 3.25 },
+    { 0.0927297, -0.9944061, -0.0505736, 3.26 },
+    { -0.0981778, 0.4600145, -0.8824669, 3.27 },
+    { 0.2099880, 0.5330639, -0.8196023, 3.27 },
+    { -0.7610832, -0.4680918, -0.4490461, 3.27 },
+    { -0.1495457, -0.8938893, -0.4226086, 3.27 },
+    { 0.9232700, -0.2706391, -0.2726296, 3.27 },
+    { 0.8458080, 0.1465842, 0.5129542, 3.27 },
+    { -0.0599263, 0.9218892, 0.3827914, 3.28 },
+    { -0.6279236, -0.6506315, -0.4270721, 3.29 },
+    { -0.3228145, -0.4019669, 0.8568625, 3.29 },
+    { 0.6572788, 0.1949543, -0.7279955, 3.31 },
+    { 0.1958306, 0.9400861, -0.2790851, 3.31 },
+    { -0.5429309, -0.0366012, 0.8389794, 3.31 },
+    { -0.3053510, 0.1526804, -0.9399199, 3.32 },
+    { -0.4397942, 0.1776367, -0.8803557, 3.32 },
+    { 0.2550138, -0.8481226, -0.4643878, 3.32 },
+    { -0.1509874, -0.7126818, -0.6850456, 3.33 },
+    { -0.0832946, -0.5474178, -0.8327039, 3.34 },
+    { -0.4164858, 0.8061051, -0.4203976, 3.34 },
+    { -0.0041846, -0.9854773, -0.1697556, 3.34 },
+    { -0.9448080, 0.1911932, 0.2660506, 3.34 },
+    { 0.2054439, 0.4139783, -0.8868003, 3.35 },
+    { 0.4683052, -0.2415684, 0.8499029, 3.35 },
+    { 0.1542441, 0.9871473, -0.0418214, 3.36 },
+    { 0.3639253, -0.9298420, 0.0543349, 3.36 },
+    { -0.1913794, 0.9558068, 0.2231754, 3.36 },
+    { -0.2981981, 0.3876897, 0.8722239, 3.36 },
+    { -0.4505733, -0.5499134, -0.7032631, 3.37 },
+    { -0.9158003, -0.4014992, -0.0103986, 3.37 },
+    { -0.9690071, -0.2398192, 0.0592628, 3.38 },
+    { -0.6609851, 0.7420244, 0.1117965, 3.38 },
+    { 0.3894258, 0.2123105, 0.8962543, 3.38 },
+    { 0.5381831, 0.5630625, 0.6271519, 3.39 },
+    { -0.4321681, 0.2082599, -0.8774159, 3.40 },
+    { 0.9250751, -0.3300337, 0.1879194, 3.40 },
+    { 0.3732789, 0.8864973, 0.2734691, 3.40 },
+    { -0.4104768, -0.4570216, -0.7890754, 3.41 },
+    { 0.6741412, 0.2736199, -0.6860508, 3.41 },
+    { -0.6631447, -0.3433935, -0.6650714, 3.41 },
+    { -0.3915032, -0.6789356, -0.6211052, 3.41 },
+    { 0.7659436, 0.4119081, 0.4936215, 3.41 },
+    { 0.2659880, -0.3034124, -0.9149816, 3.42 },
+    { -0.0522746, -0.8836815, 0.4651605, 3.42 },
+    { 0.3116286, -0.3544386, 0.8816240, 3.43 },
+    { -0.3815570, 0.3466827, -0.8568695, 3.44 },
+    { 0.2840198, -0.9550333, -0.0851126, 3.44 },
+    { -0.8259726, 0.3997799, 0.3974233, 3.44 },
+    { 0.5204658, 0.1132420, 0.8463401, 3.44 },
+    { 0.9404996, 0.2901892, -0.1767789, 3.45 },
+    { 0.1810561, -0.8153442, 0.5499387, 3.45 },
+    { -0.6597805, 0.3178968, 0.6809048, 3.45 },
+    { -0.2936727, 0.5255820, -0.7984484, 3.47 },
+    { -0.2350538, 0.8516398, -0.4684649, 3.47 },
+    { 0.7555034, 0.6527086, 0.0564454, 3.47 },
+    { 0.4856554, 0.8469735, 0.2162744, 3.47 },
+    { 0.4669082, -0.8189356, 0.3336784, 3.47 },
+    { -0.5496125, -0.6294955, 0.5492372, 3.47 },
+    { -0.1904269, -0.9497223, 0.2485260, 3.48 },
+    { 0.8671459, -0.2733969, 0.4163077, 3.48 },
+    { -0.8240623, 0.1509526, 0.5460171, 3.48 },
+    { 0.5948884, -0.1916990, -0.7806147, 3.49 },
+    { 0.8641203, 0.4217786, -0.2745886, 3.50 },
+    { -0.5339697, -0.5431194, 0.6479951, 3.50 },
+    { 0.0816143, -0.6902479, -0.7189554, 3.51 },
+    { 0.2325182, -0.9034706, -0.3601058, 3.51 },
+    { -0.5538603, 0.8171634, 0.1596333, 3.52 },
+    { -0.8097986, 0.5609926, 0.1717949, 3.52 },
+    { -0.8441169, 0.4519802, 0.2884103, 3.52 },
+    { 0.3846889, -0.1218827, 0.9149640, 3.52 },
+    { -0.5377321, -0.8409899, -0.0598344, 3.53 },
+    { 0.8822266, -0.4582800, 0.1079613, 3.53 },
+    { 0.3667001, 0.8703971, 0.3285420, 3.53 },
+    { -0.3176236, 0.8712066, 0.3743184, 3.53 },
+    { -0.2568299, -0.7343856, 0.6282645, 3.53 },
+    { -0.4980544, 0.2967140, -0.8148022, 3.54 },
+    { -0.8434740, 0.0998255, -0.5278130, 3.54 },
+    { -0.0941350, -0.9594952, -0.2655327, 3.54 },
+    { 0.5537706, 0.8152185, -0.1695784, 3.54 },
+    { 0.1066436, 0.9792165, 0.1725170, 3.54 },
+    { -0.5694706, -0.3965415, -0.7200403, 3.55 },
+    { 0.0549966, 0.9651601, -0.2558151, 3.55 },
+    { 0.2150847, -0.3417907, -0.9148321, 3.56 },
+    { 0.5151742, 0.3491599, -0.7827406, 3.56 },
+    { -0.5134113, -0.6217493, -0.5914699, 3.56 },
+    { 0.3580993, 0.7498850, -0.5562710, 3.56 },
+    { -0.9517428, 0.1706383, -0.2550848, 3.56 },
+    { 0.9846160, 0.0836685, -0.1533979, 3.56 },
+    { -0.2292350, -0.7537346, -0.6159021, 3.57 },
+    { 0.5530780, -0.8043186, -0.2172011, 3.57 },
+    { -0.4008185, 0.8177494, 0.4130744, 3.57 },
+    { 0.6014391, 0.2740699, 0.7504377, 3.57 },
+    { 0.0272336, -0.2955762, 0.9549309, 3.57 },
+    { -0.5151355, -0.7157341, -0.4715507, 3.58 },
+    { -0.3203611, 0.9035045, 0.2846898, 3.58 },
+    { -0.6802629, -0.5306675, 0.5056030, 3.58 },
+    { -0.4917814, -0.0459675, -0.8695045, 3.59 },
+    { -0.6049818, 0.4612899, -0.6490059, 3.60 },
+    { 0.0626072, 0.9221015, -0.3818497, 3.60 },
+    { 0.9240386, 0.3548124, -0.1423405, 3.60 },
+    { 0.1826113, 0.9759359, -0.1191732, 3.60 },
+    { 0.6187956, 0.7697170, 0.1569324, 3.60 },
+    { -0.1893570, 0.8075125, 0.5586301, 3.60 },
+    { -0.4883741, 0.4731648, 0.7332161, 3.60 },
+    { -0.3494644, 0.7066591, -0.6152297, 3.61 },
+    { -0.8676259, 0.4488304, -0.2139545, 3.61 },
+    { -0.9987021, 0.0405696, 0.0307949, 3.61 },
+    { -0.3048847, -0.0849389, -0.9485941, 3.62 },
+    { -0.0265627, -0.4261538, -0.9042607, 3.62 },
+    { -0.0615821, -0.4857395, -0.8719316, 3.62 },
+    { -0.3881292, 0.4613546, -0.7978143, 3.62 },
+    { -0.2080582, -0.7090128, -0.6738046, 3.62 },
+    { 0.8885328, 0.3747973, 0.2646441, 3.62 },
+    { 0.7157118, -0.1853567, 0.6733495, 3.62 },
+    { 0.6140845, -0.7479313, 0.2519901, 3.63 },
+    { 0.4934580, 0.7683571, 0.4075864, 3.63 },
+    { 0.6554338, 0.6005058, 0.4580386, 3.63 },
+    { -0.3943079, 0.0247959, -0.9186438, 3.64 },
+    { 0.3614724, -0.3782262, -0.8522222, 3.65 },
+    { -0.9832095, -0.1807188, -0.0252939, 3.65 },
+    { 0.4077830, 0.8724370, 0.2693821, 3.65 },
+    { -0.3703182, -0.2233645, 0.9016500, 3.65 },
+    { 0.0185617, -0.6412923, -0.7670722, 3.66 },
+    { -0.5019985, -0.7080596, -0.4966378, 3.66 },
+    { 0.9099036, -0.2040261, -0.3611770, 3.66 },
+    { 0.5815897, 0.0946441, 0.8079579, 3.66 },
+    { -0.5314031, -0.8042978, 0.2659244, 3.67 },
+    { -0.3612422, 0.2733830, 0.8914964, 3.67 },
+    { -0.5479259, 0.6325894, -0.5473644, 3.68 },
+    { 0.7849771, -0.5491791, -0.2867285, 3.68 },
+    { -0.9832095, -0.1807188, -0.0252939, 3.68 },
+    { -0.5384331, -0.6881000, 0.4864239, 3.68 },
+    { -0.3841055, 0.2560531, -0.8870737, 3.69 },
+    { 0.5984934, 0.7102105, -0.3706840, 3.69 },
+    { 0.9809728, -0.1855112, 0.0572538, 3.69 },
+    { 0.2942659, 0.9507198, 0.0976697, 3.69 },
+    { 0.5432165, 0.3009807, -0.7837898, 3.70 },
+    { 0.5075041, 0.7586387, 0.4085424, 3.70 },
+    { -0.0085080, -0.8724732, 0.4885878, 3.70 },
+    { 0.0152091, 0.9694637, -0.2447626, 3.71 },
+    { -0.5326594, -0.8427209, 0.0780729, 3.71 },
+    { 0.4791750, -0.8705975, 0.1115850, 3.71 },
+    { -0.6707426, 0.0408775, 0.7405629, 3.71 },
+    { -0.7478290, -0.6630692, 0.0330297, 3.72 },
+    { 0.2827056, 0.9582610, 0.0425838, 3.72 },
+    { 0.5916169, -0.5197863, 0.6162886, 3.72 },
+    { 0.5201085, -0.4981928, 0.6937514, 3.72 },
+    { 0.0012052, 0.5837569, 0.8119276, 3.72 },
+    { -0.3572196, 0.6703017, -0.6504535, 3.73 },
+    { 0.8697081, 0.4598068, -0.1794032, 3.73 },
+    { 0.5904320, 0.7901808, -0.1643298, 3.73 },
+    { 0.0316193, -0.9855939, 0.1661473, 3.73 },
+    { 0.7251694, -0.5733887, -0.3812541, 3.74 },
+    { 0.9487230, -0.2872729, -0.1319051, 3.74 },
+    { 0.6096089, 0.7744661, 0.1690537, 3.74 },
+    { -0.4900098, 0.4725563, -0.7325168, 3.75 },
+    { -0.0527425, -0.9974905, 0.0472319, 3.75 },
+    { -0.3920380, -0.8594537, 0.3280937, 3.75 },
+    { 0.1872230, 0.7302217, 0.6570570, 3.75 },
+    { -0.0154300, -0.5462816, 0.8374594, 3.75 },
+    { 0.4831620, -0.2021813, 0.8518669, 3.75 },
+    { 0.1796341, -0.1240661, -0.9758787, 3.76 },
+    { 0.0530407, 0.4588527, -0.8869278, 3.76 },
+    { -0.1551492, -0.4904644, -0.8575391, 3.76 },
+    { 0.3918650, 0.8692479, 0.3014132, 3.76 },
+    { 0.7961238, -0.4277205, 0.4280678, 3.76 },
+    { 0.4122395, 0.3800602, 0.8280174, 3.76 },
+    { -0.2402637, 0.3254787, -0.9145146, 3.77 },
+    { 0.2586898, -0.8921135, -0.3704228, 3.77 },
+    { 0.6589278, -0.7338919, -0.1649754, 3.77 },
+    { 0.6169955, -0.7376676, 0.2741588, 3.77 },
+    { 0.4085778, 0.6125970, 0.6766011, 3.77 },
+    { 0.5917304, -0.2412047, 0.7692044, 3.77 },
+    { 0.1969683, -0.5632159, 0.8024907, 3.77 },
+    { -0.0986429, 0.3189182, -0.9426350, 3.78 },
+    { -0.4956052, 0.1479979, -0.8558458, 3.78 },
+    { -0.2584886, 0.8998513, 0.3513565, 3.79 },
+    { -0.3232244, 0.8234298, 0.4663575, 3.79 },
+    { 0.3773193, -0.5720628, 0.7282680, 3.79 },
+    { 0.2362863, -0.5725301, 0.7850975, 3.79 },
+    { -0.5820234, -0.7923409, 0.1828790, 3.80 },
+    { -0.5820202, -0.7923365, 0.1829081, 3.80 },
+    { -0.8524696, 0.3976180, 0.3394047, 3.80 },
+    { 0.4800499, 0.5215789, 0.7053422, 3.80 },
+    { -0.0621520, -0.6917918, 0.7194173, 3.80 },
+    { -0.4350814, 0.2745425, 0.8575142, 3.80 },
+    { 0.0353714, 0.9336642, -0.3563987, 3.81 },
+    { -0.8779008, 0.3813123, -0.2896397, 3.81 },
+    { 0.0925062, 0.9946782, -0.0453630, 3.81 },
+    { -0.4775713, 0.2030163, -0.8548158, 3.82 },
+    { 0.3101605, 0.8032779, -0.5084734, 3.82 },
+    { -0.3787721, -0.9248423, 0.0346185, 3.82 },
+    { 0.4281877, -0.8459395, 0.3178706, 3.82 },
+    { -0.6107738, 0.5177685, 0.5990585, 3.82 },
+    { 0.6855866, -0.0673286, 0.7248709, 3.82 },
+    { -0.1413073, -0.1270774, -0.9817757, 3.83 },
+    { -0.6453412, -0.3661270, -0.6704371, 3.83 },
+    { 0.0288473, -0.8761470, 0.4811800, 3.83 },
+    { 0.4717515, 0.7015002, 0.5341798, 3.83 },
+    { -0.7921711, 0.2372421, 0.5622999, 3.83 },
+    { 0.1535054, -0.3007095, 0.9412810, 3.83 },
+    { -0.3390687, 0.3540509, -0.8715965, 3.84 },
+    { -0.6232941, 0.2352073, -0.7457761, 3.84 },
+    { -0.4426893, 0.5246556, -0.7271607, 3.84 },
+    { 0.9090728, -0.4159334, -0.0242087, 3.84 },
+    { 0.3734436, 0.8859533, 0.2750030, 3.84 },
+    { 0.0958579, -0.9237217, 0.3708767, 3.84 },
+    { -0.5053962, -0.7404886, 0.4430025, 3.84 },
+    { -0.3502227, 0.0439280, 0.9356358, 3.84 },
+    { 0.2377239, 0.3531044, -0.9048782, 3.85 },
+    { -0.1953042, -0.3979546, -0.8963751, 3.85 },
+    { 0.0348462, 0.6274526, -0.7778746, 3.85 },
+    { -0.6648510, 0.3288179, -0.6707100, 3.85 },
+    { -0.0803933, 0.8306166, -0.5510108, 3.85 },
+    { -0.2862862, 0.8456545, -0.4504538, 3.85 },
+    { 0.1514340, -0.9780114, -0.1433923, 3.85 },
+    { -0.9162827, 0.3664328, 0.1617191, 3.85 },
+    { -0.4942830, -0.8263217, 0.2699568, 3.85 },
+    { -0.6531434, -0.1084293, -0.7494310, 3.86 },
+    { 0.3300464, 0.6619827, -0.6729401, 3.86 },
+    { 0.0560086, -0.9315293, -0.3593273, 3.86 },
+    { -0.0130129, -0.7958892, 0.6053025, 3.86 },
+    { -0.3037332, -0.0433180, -0.9517719, 3.87 },
+    { -0.4414349, -0.4899828, -0.7516995, 3.87 },
+    { -0.6165009, -0.3512182, -0.7046789, 3.87 },
+    { 0.1020319, 0.8079966, -0.5802853, 3.87 },
+    { 0.5851057, 0.6502345, -0.4846095, 3.87 },
+    { -0.2134667, 0.8869077, -0.4096665, 3.87 },
+    { 0.3386376, 0.9079006, -0.2470648, 3.87 },
+    { 0.5033418, 0.7592195, 0.4125927, 3.87 },
+    { 0.7587415, 0.1918261, 0.6225063, 3.87 },
+    { -0.3418091, -0.0502959, 0.9384225, 3.87 },
+    { 0.6972334, 0.0286488, -0.7162715, 3.88 },
+    { -0.7124806, -0.2989318, -0.6348317, 3.88 },
+    { -0.4466330, -0.7498672, -0.4880759, 3.88 },
+    { -0.7537037, -0.6497766, -0.0985956, 3.88 },
+    { -0.7493979, 0.6608875, 0.0403793, 3.88 },
+    { -0.7637576, 0.4737197, 0.4384792, 3.88 },
+    { -0.0710069, -0.1790006, -0.9812832, 3.89 },
+    { -0.5724427, 0.0983461, -0.8140254, 3.89 },
+    { 0.7093986, 0.6876252, -0.1546778, 3.89 },
+    { -0.9961626, -0.0867449, -0.0116391, 3.89 },
+    { 0.3976859, -0.7151846, 0.5747668, 3.89 },
+    { -0.2926185, -0.6256684, 0.7231276, 3.89 },
+    { 0.6876053, -0.1513056, -0.7101448, 3.90 },
+    { -0.5922504, 0.8028688, -0.0681265, 3.90 },
+    { 0.4712209, -0.8818406, 0.0175503, 3.90 },
+    { -0.5024989, 0.1146492, -0.8569425, 3.91 },
+    { -0.6349173, -0.0780705, -0.7686254, 3.91 },
+    { -0.4600118, 0.5198193, -0.7198451, 3.91 },
+    { -0.5699261, -0.7810398, -0.2552667, 3.91 },
+    { -0.8186307, 0.5739738, -0.0199444, 3.91 },
+    { 0.4853602, 0.8680659, 0.1043409, 3.91 },
+    { 0.5448673, 0.1675845, -0.8216052, 3.92 },
+    { 0.7510419, -0.6538888, 0.0914635, 3.92 },
+    { -0.2209736, -0.8288788, 0.5139364, 3.92 },
+    { 0.3320826, -0.8920714, -0.3064795, 3.93 },
+    { -0.4216160, 0.8914640, -0.1659274, 3.93 },
+    { 0.3564598, 0.9324788, -0.0584788, 3.93 },
+    { 0.7184865, 0.0825065, -0.6906300, 3.94 },
+    { -0.9710071, 0.1541189, 0.1827365, 3.94 },
+    { -0.6255415, 0.7152752, 0.3115754, 3.94 },
+    { 0.5256983, -0.5388293, 0.6582585, 3.94 },
+    { -0.1284846, 0.2699189, -0.9542722, 3.95 },
+    { 0.6038548, 0.2539974, -0.7555426, 3.95 },
+    { -0.4444467, -0.7041217, -0.5537868, 3.95 },
+    { -0.1504616, 0.9319884, -0.3297863, 3.95 },
+    { 0.8699085, -0.2888251, 0.3997990, 3.95 },
+    { 0.4384690, 0.4170318, 0.7961340, 3.95 },
+    { -0.5365783, -0.2058120, 0.8183674, 3.95 },
+    { 0.1475882, -0.2541129, -0.9558475, 3.96 },
+    { -0.6097902, -0.0310285, -0.7919553, 3.96 },
+    { 0.0027307, 0.7335433, -0.6796373, 3.96 },
+    { 0.3370112, 0.7572671, -0.5594373, 3.96 },
+    { -0.1819570, 0.8234468, -0.5374264, 3.96 },
+    { -0.3829181, 0.7867678, -0.4841179, 3.96 },
+    { -0.4435485, -0.8238177, -0.3529718, 3.96 },
+    { -0.3442649, 0.3119501, -0.8855331, 3.97 },
+    { 0.6693196, -0.2797423, -0.6882990, 3.97 },
+    { 0.2716830, -0.7088042, -0.6509877, 3.97 },
+    { -0.5248306, 0.6248973, -0.5779759, 3.97 },
+    { 0.9268592, -0.1510732, -0.3436697, 3.97 },
+    { 0.0028114, -0.9986873, 0.0511454, 3.97 },
+    { 0.0287896, 0.7749765, 0.6313340, 3.97 },
+    { -0.5287429, 0.5257981, 0.6663087, 3.97 },
+    { -0.1234698, 0.3544075, -0.9269037, 3.98 },
+    { -0.0643845, 0.9919220, -0.1092953, 3.98 },
+    { 0.3749531, -0.5586645, 0.7398001, 3.98 },
+    { 0.2592594, 0.1549099, 0.9533035, 3.98 },
+    { 0.5173693, -0.0972203, -0.8502218, 3.99 },
+    { -0.2515140, 0.1114620, -0.9614140, 4.00 },
+    { -0.2861401, 0.2800946, -0.9163356, 4.00 },
+    { 0.4675536, 0.4432332, -0.7648124, 4.00 },
+    { -0.6009801, -0.5131041, -0.6128189, 4.00 },
+    { 0.8080723, 0.4665635, -0.3596354, 4.00 },
+    { 0.0594548, -0.3128957, -0.9479248, 4.01 },
+    { 0.2518228, -0.6678540, -0.7003973, 4.01 },
+    { -0.5996210, 0.6513316, -0.4649966, 4.01 },
+    { -0.4280733, -0.8400943, -0.3331587, 4.01 },
+    { 0.9264828, -0.2939347, -0.2350149, 4.01 },
+    { 0.9928296, -0.0029819, 0.1195010, 4.01 },
+    { 0.5234255, -0.6858817, 0.5055612, 4.01 },
+    { 0.6858608, 0.4683677, 0.5569799, 4.01 },
+    { -0.5345319, -0.2084720, 0.8190330, 4.01 },
+    { -0.2570330, -0.4537883, 0.8532352, 4.01 },
+    { -0.2711788, -0.5804865, -0.7677874, 4.02 },
+    { -0.9076854, -0.0333355, -0.4183251, 4.02 },
+    { 0.2645600, -0.9591710, -0.0999951, 4.02 },
+    { 0.3188508, 0.9461030, -0.0567746, 4.02 },
+    { 0.9325691, -0.3609857, -0.0020508, 4.02 },
+    { 0.2483860, -0.9331237, 0.2599704, 4.02 },
+    { -0.5828747, 0.6547974, 0.4811418, 4.02 },
+    { 0.5624772, -0.4162809, 0.7143736, 4.02 },
+    { -0.5267281, -0.1278990, -0.8403567, 4.03 },
+    { 0.0237763, -0.9987657, 0.0436087, 4.03 },
+    { -0.9916233, 0.0612583, 0.1137128, 4.03 },
+    { 0.6078016, -0.7695194, 0.1960027, 4.03 },
+    { 0.1205548, 0.4783438, 0.8698584, 4.03 },
+    { -0.4369051, -0.0352194, -0.8988178, 4.04 },
+    { 0.4512820, 0.8844042, -0.1190538, 4.04 },
+    { 0.4087461, 0.7006414, 0.5848318, 4.04 },
+    { 0.1721537, -0.6991086, 0.6939815, 4.04 },
+    { 0.3141680, 0.5950018, 0.7397779, 4.04 },
+    { -0.5020937, -0.4134779, -0.7595643, 4.05 },
+    { -0.4779893, -0.5163765, -0.7105501, 4.05 },
+    { -0.6454071, -0.4542598, -0.6140828, 4.05 },
+    { -0.6177097, -0.5353451, -0.5760559, 4.05 },
+    { -0.9802045, 0.1678275, 0.1050386, 4.05 },
+    { 0.4396854, 0.4759274, 0.7616888, 4.05 },
+    { -0.4978361, -0.3656864, 0.7864049, 4.05 },
+    { -0.1562292, -0.5788621, -0.8003194, 4.06 },
+    { 0.8922608, 0.1869651, 0.4109925, 4.06 },
+    { -0.3624617, 0.8148518, 0.4523694, 4.06 },
+    { -0.1286155, 0.1862182, -0.9740538, 4.07 },
+    { -0.3372568, -0.3931827, -0.8553743, 4.07 },
+    { -0.4835098, 0.5542577, -0.6775077, 4.07 },
+    { 0.6926590, -0.6576143, -0.2962550, 4.07 },
+    { -0.2290996, 0.9507952, -0.2085708, 4.07 },
+    { 0.7674794, 0.6410479, 0.0057353, 4.07 },
+    { 0.2664892, 0.9350790, 0.2336896, 4.07 },
+    { -0.8545191, -0.4423581, 0.2722434, 4.07 },
+    { 0.5698286, 0.2768783, 0.7737143, 4.07 },
+    { -0.4118453, 0.3035133, -0.8592224, 4.08 },
+    { -0.9168390, 0.2466305, -0.3139740, 4.08 },
+    { -0.9415834, 0.1454213, -0.3037652, 4.08 },
+    { -0.8244583, -0.5561835, -0.1045391, 4.08 },
+    { 0.7262134, -0.5981822, 0.3388100, 4.08 },
+    { 0.4290867, -0.2907680, 0.8551834, 4.08 },
+    { 0.2964979, 0.2109990, -0.9314335, 4.09 },
+    { 0.6410499, 0.6545710, -0.4007391, 4.09 },
+    { 0.0992815, 0.9818756, 0.1614421, 4.09 },
+    { -0.5149887, -0.7986467, 0.3113680, 4.09 },
+    { 0.6841366, 0.3074518, 0.6613853, 4.09 },
+    { -0.1842396, 0.0712138, -0.9802981, 4.11 },
+    { 0.2840791, 0.2375059, -0.9289187, 4.11 },
+    { -0.3741388, -0.0287364, -0.9269274, 4.11 },
+    { -0.2350782, -0.3257043, -0.9157810, 4.11 },
+    { -0.4812509, 0.0283531, -0.8761242, 4.11 },
+    { -0.3165510, 0.6130546, -0.7238505, 4.11 },
+    { 0.6670922, -0.2771431, -0.6915054, 4.11 },
+    { 0.5866249, 0.4951525, -0.6408551, 4.11 },
+    { 0.2326537, -0.7375654, -0.6339318, 4.11 },
+    { 0.2355326, -0.7530630, -0.6143456, 4.11 },
+    { 0.6075934, -0.6525815, -0.4527334, 4.11 },
+    { 0.5903597, 0.7754713, 0.2238743, 4.11 },
+    { 0.5852100, -0.1544006, -0.7960463, 4.12 },
+    { -0.2644642, 0.9259802, -0.2694797, 4.12 },
+    { -0.8185679, 0.5140924, -0.2562336, 4.12 },
+    { -0.9881511, -0.0224602, 0.1518320, 4.12 },
+    { -0.0102513, 0.9858041, 0.1675861, 4.12 },
+    { 0.4924864, 0.4288670, 0.7573178, 4.12 },
+    { 0.0821988, -0.6499487, -0.7555198, 4.13 },
+    { 0.3589283, -0.6524723, -0.6674207, 4.13 },
+    { 0.9913764, -0.0869521, 0.0980413, 4.13 },
+    { 0.7487876, -0.5020025, 0.4327939, 4.13 },
+    { 0.7106324, -0.3467137, 0.6122019, 4.13 },
+    { -0.4644055, 0.5651494, -0.6818604, 4.14 },
+    { 0.5994876, -0.6770328, -0.4268971, 4.14 },
+    { 0.1552111, 0.9784951, -0.1358558, 4.14 },
+    { -0.5111313, -0.6840519, 0.5204016, 4.14 },
+    { 0.7126676, -0.0610711, 0.6988385, 4.14 },
+    { 0.2938569, 0.5952171, 0.7479069, 4.14 },
+    { 0.1421189, -0.0475143, -0.9887086, 4.15 },
+    { -0.4285273, -0.0128712, -0.9034372, 4.15 },
+    { -0.5010066, -0.8161702, -0.2878518, 4.15 },
+    { -0.3084446, 0.9512034, -0.0086010, 4.15 },
+    { -0.1182780, 0.9309358, 0.3454979, 4.15 },
+    { -0.4540901, -0.7677353, 0.4520892, 4.15 },
+    { -0.2913896, -0.7628258, -0.5772252, 4.16 },
+    { 0.8920868, -0.4310924, -0.1354269, 4.16 },
+    { -0.6317788, 0.7687514, 0.0993825, 4.16 },
+    { -0.0165145, 0.9185511, 0.3949572, 4.16 },
+    { 0.4503432, 0.0652967, 0.8904647, 4.16 },
+    { 0.4351945, 0.6795481, -0.5906100, 4.17 },
+    { 0.8378169, -0.3022240, -0.4546686, 4.17 },
+    { -0.1333892, -0.9024924, -0.4095299, 4.17 },
+    { 0.5033345, 0.7628169, 0.4059122, 4.18 },
+    { -0.3222483, 0.7865861, 0.5267242, 4.18 },
+    { -0.5743289, -0.3887884, 0.7204096, 4.18 },
+    { -0.7323596, -0.3789917, -0.5656984, 4.19 },
+    { -0.8231210, -0.5391321, -0.1783490, 4.19 },
+    { 0.9279355, -0.3073653, 0.2108609, 4.19 },
+    { 0.1853310, -0.9178647, 0.3509656, 4.19 },
+    { 0.4879340, -0.2405347, 0.8390849, 4.19 },
+    { -0.4496801, 0.8041272, -0.3888024, 4.20 },
+    { 0.1264444, 0.9865461, 0.1036277, 4.20 },
+    { -0.2701765, -0.6867894, 0.6747777, 4.20 },
+    { 0.8103095, -0.2325502, -0.5378838, 4.21 },
+    { 0.9692161, -0.1888720, -0.1579479, 4.21 },
+    { 0.0838036, 0.9959054, -0.0339019, 4.21 },
+    { -0.7378095, 0.3136255, 0.5977258, 4.21 },
+    { 0.3065428, 0.3961494, 0.8655040, 4.21 },
+    { 0.3267067, -0.2588444, -0.9089897, 4.22 },
+    { 0.1053877, -0.4545217, -0.8844792, 4.22 },
+    { 0.9747474, -0.1968836, -0.1053770, 4.22 },
+    { 0.2036887, -0.9755307, -0.0827700, 4.22 },
+    { 0.3712799, 0.8474899, 0.3793575, 4.22 },
+    { 0.5686879, -0.6447000, 0.5108384, 4.22 },
+    { 0.2757688, -0.3607505, 0.8909605, 4.22 },
+    { 0.0289434, -0.3186762, 0.9474216, 4.22 },
+    { 0.4229720, 0.0371385, -0.9053814, 4.23 },
+    { -0.3802471, -0.7046603, -0.5990543, 4.23 },
+    { -0.3100196, -0.7614046, -0.5693425, 4.23 },
+    { -0.7506919, -0.3730013, -0.5452813, 4.23 },
+    { 0.5042765, 0.7680406, -0.3947390, 4.23 },
+    { 0.3894652, -0.7436749, 0.5433824, 4.23 },
+    { 0.5770941, 0.5315264, 0.6200339, 4.23 },
+    { 0.5863569, -0.5033821, 0.6346590, 4.23 },
+    { 0.3906790, 0.5401483, 0.7453923, 4.23 },
+    { 0.5449141, -0.3579649, 0.7582412, 4.23 },
+    { -0.0439744, -0.1313654, 0.9903582, 4.23 },
+    { -0.0711914, -0.2040806, -0.9763621, 4.24 },
+    { -0.3168570, 0.5878333, -0.7443478, 4.24 },
+    { 0.5517272, -0.8054128, -0.2165811, 4.24 },
+    { 0.2729066, 0.5597077, -0.7824636, 4.25 },
+    { 0.5392397, 0.4026150, -0.7396768, 4.25 },
+    { -0.7872208, 0.3375998, -0.5160521, 4.25 },
+    { 0.7323974, 0.6373547, -0.2395268, 4.25 },
+    { 0.3541311, 0.9184063, 0.1764114, 4.25 },
+    { -0.6874335, 0.6965714, 0.2054835, 4.25 },
+    { 0.2672607, 0.7025529, 0.6595386, 4.25 },
+    { -0.4255561, 0.5920341, 0.6843958, 4.25 },
+    { 0.6479240, 0.2027465, 0.7342264, 4.25 },
+    { -0.1976223, -0.1482782, 0.9689990, 4.25 },
+    { 0.0623682, 0.0192898, 0.9978668, 4.25 },
+    { -0.1848637, -0.0148290, -0.9826523, 4.26 },
+    { -0.0789662, -0.9716538, -0.2228300, 4.26 },
+    { -0.8620970, -0.5060261, 0.0269514, 4.26 },
+    { 0.8846906, 0.4381695, 0.1591542, 4.26 },
+    { -0.8408321, -0.2726885, 0.4675922, 4.26 },
+    { -0.7424813, -0.1101091, 0.6607553, 4.26 },
+    { -0.3302410, -0.6261592, 0.7063041, 4.26 },
+    { 0.0001977, 0.6954503, 0.7185742, 4.26 },
+    { -0.6167891, -0.1853683, -0.7649901, 4.27 },
+    { -0.4344297, -0.5110546, -0.7416832, 4.27 },
+    { -0.3627824, 0.5722697, -0.7354565, 4.27 },
+    { 0.4697465, 0.5594667, -0.6828875, 4.27 },
+    { -0.7433595, -0.1765340, -0.6451762, 4.27 },
+    { 0.5536167, 0.7467267, -0.3686568, 4.27 },
+    { 0.8540752, -0.4616194, -0.2397146, 4.27 },
+    { 0.2175087, 0.9641195, -0.1521957, 4.27 },
+    { 0.7403212, 0.6489110, 0.1756106, 4.27 },
+    { 0.3412599, 0.9146670, 0.2166237, 4.27 },
+    { 0.6386180, -0.7176618, 0.2777203, 4.27 },
+    { -0.5302638, 0.1948185, -0.8251461, 4.28 },
+    { 0.7057362, -0.1665689, -0.6886155, 4.28 },
+    { -0.8295362, 0.0256707, -0.5578626, 4.28 },
+    { 0.7392125, -0.6080238, -0.2896063, 4.28 },
+    { -0.3623079, -0.8871261, -0.2859025, 4.28 },
+    { 0.5846843, 0.8112306, 0.0070108, 4.28 },
+    { 0.9841181, -0.1384474, 0.1111028, 4.28 },
+    { 0.9534107, 0.2686344, 0.1372717, 4.28 },
+    { 0.7895340, 0.5958122, 0.1471189, 4.28 },
+    { 0.3664178, 0.8458132, 0.3877346, 4.28 },
+    { 0.3064415, 0.8683108, 0.3900384, 4.28 },
+    { -0.3814736, 0.7881358, 0.4830319, 4.28 },
+    { 0.2520327, -0.6633065, -0.7046304, 4.29 },
+    { -0.0797971, -0.7770494, -0.6243610, 4.29 },
+    { 0.7826290, -0.3181700, -0.5350324, 4.29 },
+    { -0.1231057, -0.8584021, -0.4979867, 4.29 },
+    { 0.1708535, 0.9585644, -0.2279548, 4.29 },
+    { 0.4349025, 0.8871111, 0.1545758, 4.29 },
+    { 0.3813279, 0.8716844, 0.3078235, 4.29 },
+    { 0.7423807, -0.3865131, 0.5472464, 4.29 },
+    { 0.7248436, -0.0693577, 0.6854132, 4.29 },
+    { 0.3030364, 0.5615263, 0.7699722, 4.29 },
+    { 0.4020944, -0.2675346, 0.8756400, 4.29 },
+    { 0.3745811, -0.2080826, 0.9035433, 4.29 },
+    { 0.1138811, 0.3847643, 0.9159626, 4.29 },
+    { -0.1224232, 0.0880617, 0.9885634, 4.29 },
+    { -0.9948430, 0.1004020, -0.0143791, 4.30 },
+    { -0.6523533, 0.7555930, 0.0592822, 4.30 },
+    { 0.5049911, 0.7572618, 0.4141722, 4.30 },
+    { 0.1883921, -0.7771889, 0.6004047, 4.30 },
+    { 0.3028824, -0.4602259, 0.8345384, 4.30 },
+    { 0.8432351, 0.2204591, -0.4902574, 4.31 },
+    { -0.9509261, -0.1339401, -0.2789259, 4.31 },
+    { -0.7346439, 0.5550024, 0.3902187, 4.31 },
+    { -0.4987719, -0.6186317, 0.6070596, 4.31 },
+    { -0.0883970, -0.0659581, -0.9938991, 4.32 },
+    { -0.4412417, 0.0198730, -0.8971682, 4.32 },
+    { -0.5306159, -0.4932513, -0.6893112, 4.32 },
+    { -0.4408140, -0.8238847, -0.3562262, 4.32 },
+    { 0.3203530, 0.8854683, -0.3366301, 4.32 },
+    { -0.6453736, 0.7270604, -0.2342566, 4.32 },
+    { 0.6370981, -0.7705413, -0.0192900, 4.32 },
+    { -0.3707224, 0.9156925, 0.1551520, 4.32 },
+    { -0.1181802, -0.1753056, 0.9773952, 4.32 },
+    { -0.4490802, -0.0059281, -0.8934718, 4.33 },
+    { -0.3247491, 0.3849123, -0.8639332, 4.33 },
+    { -0.4530193, -0.3181664, -0.8327927, 4.33 },
+    { -0.6392453, -0.1508604, -0.7540600, 4.33 },
+    { -0.4275375, -0.5996797, -0.6764583, 4.33 },
+    { -0.1271348, 0.9087779, -0.3974411, 4.33 },
+    { -0.1658300, -0.9607614, -0.2223465, 4.33 },
+    { 0.8605234, 0.5071239, 0.0482154, 4.33 },
+    { 0.0699668, -0.8053223, 0.5886941, 4.33 },
+    { 0.5441532, 0.1744549, 0.8206478, 4.33 },
+    { -0.4053572, 0.3517413, -0.8437794, 4.34 },
+    { -0.6032400, -0.3543547, -0.7145168, 4.34 },
+    { 0.6970170, -0.4659658, -0.5450167, 4.34 },
+    { -0.5620756, -0.6571280, -0.5022488, 4.34 },
+    { -0.5313910, 0.8455258, -0.0520551, 4.34 },
+    { -0.1452059, -0.9867637, 0.0721991, 4.34 },
+    { 0.7925068, -0.5319821, 0.2982079, 4.34 },
+    { -0.1247938, 0.1771661, -0.9762370, 4.35 },
+    { -0.1931127, 0.3092551, -0.9311653, 4.35 },
+    { 0.0272831, 0.4100411, -0.9116589, 4.35 },
+    { 0.0166021, -0.4432562, -0.8962412, 4.35 },
+    { -0.5283442, 0.3809599, -0.7587634, 4.35 },
+    { -0.5643081, -0.4182523, -0.7117734, 4.35 },
+    { 0.5433042, 0.5351710, -0.6468482, 4.35 },
+    { 0.6309901, 0.6985144, 0.3375339, 4.35 },
+    { -0.0583587, 0.8684132, 0.4923949, 4.35 },
+    { -0.1295071, 0.5073842, 0.8519326, 4.35 },
+    { 0.0482850, -0.4748036, -0.8787662, 4.36 },
+    { 0.5282484, 0.1011347, -0.8430453, 4.36 },
+    { -0.6416578, -0.3933888, -0.6584228, 4.36 },
+    { 0.0087732, 0.8162588, -0.5776198, 4.36 },
+    { 0.1975046, 0.9543775, -0.2239542, 4.36 },
+    { 0.4095080, -0.9120303, -0.0224498, 4.36 },
+    { -0.6670565, 0.7380313, 0.1017127, 4.36 },
+    { 0.2945692, 0.9430228, 0.1547157, 4.36 },
+    { 0.1935626, -0.9301468, 0.3120263, 4.36 },
+    { 0.0357127, -0.9340540, 0.3553417, 4.36 },
+    { 0.4467872, 0.8118231, 0.3759314, 4.36 },
+    { -0.8746624, -0.1032845, 0.4736011, 4.36 },
+    { 0.8210193, 0.1332764, 0.5551259, 4.36 },
+    { 0.1537885, -0.7771664, 0.6102143, 4.36 },
+    { 0.2572780, -0.7433068, 0.6174974, 4.36 },
+    { 0.6211709, -0.2587911, 0.7397120, 4.36 },
+    { 0.4060451, 0.5319254, 0.7430900, 4.36 },
+    { -0.0072011, -0.0591065, 0.9982257, 4.36 },
+    { 0.4503419, 0.0623803, -0.8906744, 4.37 },
+    { 0.7844720, -0.0929467, -0.6131595, 4.37 },
+    { 0.4073757, -0.7074703, -0.5775213, 4.37 },
+    { -0.0590062, 0.8156103, -0.5755850, 4.37 },
+    { -0.2318379, 0.9274914, -0.2932761, 4.37 },
+    { 0.8263372, 0.5417704, 0.1537912, 4.37 },
+    { -0.8693489, 0.4627026, 0.1736052, 4.37 },
+    { 0.4070612, -0.8626217, 0.3003081, 4.37 },
+    { 0.4022663, -0.8617121, 0.3092475, 4.37 },
+    { 0.8596597, 0.1459993, 0.4895604, 4.37 },
+    { -0.9493292, -0.2990947, -0.0965213, 4.38 },
+    { -0.2795227, -0.9437790, 0.1764887, 4.38 },
+    { 0.1146327, 0.9408419, 0.3188665, 4.38 },
+    { 0.4559787, -0.3830632, -0.8033343, 4.39 },
+    { -0.0915417, 0.5951560, -0.7983793, 4.39 },
+    { -0.7153996, 0.1911717, -0.6720542, 4.39 },
+    { -0.1579689, -0.9194009, -0.3602053, 4.39 },
+    { 0.9255513, -0.1381312, -0.3525259, 4.39 },
+    { 0.9705784, -0.1803103, -0.1595797, 4.39 },
+    { 0.2873295, 0.9531064, -0.0950258, 4.39 },
+    { -0.5081129, 0.8603268, 0.0407315, 4.39 },
+    { 0.2453063, -0.7357207, 0.6313002, 4.39 },
+    { 0.1134848, -0.1800568, 0.9770879, 4.39 },
+    { 0.4941988, -0.2913426, -0.8190770, 4.40 },
+    { -0.1280059, 0.5791291, -0.8051236, 4.40 },
+    { -0.3052788, 0.8537041, -0.4218936, 4.40 },
+    { -0.5038884, 0.7984077, -0.3296083, 4.40 },
+    { -0.6976379, -0.7155205, 0.0364935, 4.40 },
+    { 0.9072748, -0.1381034, 0.3972151, 4.40 },
+    { -0.3220617, 0.5678538, -0.7575080, 4.41 },
+    { 0.6076388, 0.3287096, -0.7229973, 4.41 },
+    { 0.8295211, -0.1506629, -0.5377689, 4.41 },
+    { -0.6504656, -0.5975492, -0.4688597, 4.41 },
+    { 0.9944596, 0.0085049, -0.1047748, 4.41 },
+    { 0.1081472, 0.9803692, 0.1648649, 4.41 },
+    { 0.0229932, 0.9377517, 0.3465446, 4.41 },
+    { -0.1143368, -0.8906370, 0.4401055, 4.41 },
+    { -0.0056453, -0.8643495, 0.5028599, 4.41 },
+    { -0.2638677, 0.8225916, 0.5037032, 4.41 },
+    { -0.8382246, 0.1546629, 0.5229330, 4.41 },
+    { 0.2457893, -0.0568598, 0.9676542, 4.41 },
+    { -0.5006405, -0.3933107, -0.7711458, 4.42 },
+    { -0.6260481, -0.4508429, -0.6362424, 4.42 },
+    { -0.3743521, -0.8715709, -0.3165827, 4.42 },
+    { 0.5391672, 0.8156878, -0.2096475, 4.42 },
+    { 0.6657055, -0.7410503, -0.0876392, 4.42 },
+    { 0.9219220, -0.3873754, -0.0003491, 4.42 },
+    { -0.0319404, 0.9664369, 0.2549109, 4.42 },
+    { -0.9090557, 0.2337018, 0.3449656, 4.42 },
+    { 0.8891943, 0.2266810, 0.3974282, 4.42 },
+    { -0.1563072, 0.9368171, -0.3129566, 4.43 },
+    { 0.4372954, 0.8894035, -0.1331699, 4.43 },
+    { -0.5457978, -0.8280851, 0.1279840, 4.43 },
+    { 0.9689703, 0.2089818, 0.1319969, 4.43 },
+    { -0.7410220, -0.6281452, 0.2373181, 4.43 },
+    { 0.6317592, -0.7302344, 0.2600729, 4.43 },
+    { 0.4970212, -0.6849600, 0.5327286, 4.43 },
+    { 0.6234822, -0.5328884, 0.5721013, 4.43 },
+    { 0.5590713, -0.2502018, 0.7904672, 4.43 },
+    { 0.0951733, -0.3750886, -0.9220903, 4.44 },
+    { 0.2228300, 0.4593168, -0.8598691, 4.44 },
+    { -0.4207790, 0.6354365, -0.6474300, 4.44 },
+    { 0.9439705, 0.0603821, -0.3244591, 4.44 },
+    { -0.6375372, 0.7682116, 0.0582852, 4.44 },
+    { -0.1031907, 0.9914332, 0.0800738, 4.44 },
+    { 0.8995087, 0.4263088, 0.0956286, 4.44 },
+    { 0.3430184, -0.8415397, 0.4173120, 4.44 },
+    { -0.1558104, 0.0522998, -0.9864015, 4.45 },
+    { -0.5004716, 0.1931452, -0.8439331, 4.45 },
+    { 0.2529976, 0.7004416, -0.6673633, 4.45 },
+    { -0.5318081, 0.5313906, -0.6593968, 4.45 },
+    { -0.4177284, 0.6472052, -0.6376742, 4.45 },
+    { -0.4559697, 0.6600113, -0.5970567, 4.45 },
+    { -0.3691336, 0.8484109, -0.3793934, 4.45 },
+    { -0.3481058, -0.8630753, -0.3659554, 4.45 },
+    { 0.2022203, 0.9574986, -0.2056781, 4.45 },
+    { 0.0076476, -0.9997113, 0.0227799, 4.45 },
+    { 0.3958040, -0.9093101, 0.1284302, 4.45 },
+    { 0.0927208, -0.2710082, 0.9581010, 4.45 },
+    { -0.7044348, 0.0272304, -0.7092461, 4.46 },
+    { 0.6778785, -0.3676183, -0.6366613, 4.46 },
+    { 0.8037158, -0.2437018, -0.5428170, 4.46 },
+    { 0.6247237, 0.5679069, -0.5359123, 4.46 },
+    { 0.2021433, 0.9780831, 0.0499151, 4.46 },
+    { -0.6990189, 0.5627533, 0.4412270, 4.46 },
+    { -0.6778867, -0.5425071, 0.4961407, 4.46 },
+    { 0.6733503, -0.2433668, 0.6981203, 4.46 },
+    { -0.6335076, -0.0223629, -0.7734132, 4.47 },
+    { -0.2659054, -0.6202904, -0.7379255, 4.47 },
+    { 0.8907001, -0.2110382, -0.4026366, 4.47 },
+    { 0.7124036, 0.6253288, -0.3185044, 4.47 },
+    { -0.9801798, 0.1875925, -0.0636910, 4.47 },
+    { 0.2648135, 0.9638355, 0.0299139, 4.47 },
+    { -0.2071304, 0.9774076, 0.0420883, 4.47 },
+    { 0.5609377, 0.6705171, 0.4855468, 4.47 },
+    { 0.1597846, 0.5692798, 0.8064673, 4.47 },
+    { 0.2233230, 0.3489320, 0.9101502, 4.47 },
+    { -0.2161150, 0.2066199, -0.9542550, 4.48 },
+    { 0.3890288, -0.1664704, -0.9060597, 4.48 },
+    { -0.1033063, 0.8362838, -0.5384767, 4.48 },
+    { -0.9012607, 0.1929736, -0.3879307, 4.48 },
+    { -0.0504814, 0.9680920, 0.2454578, 4.48 },
+    { -0.7201431, 0.3852073, 0.5770696, 4.48 },
+    { 0.2613669, -0.5840081, 0.7685193, 4.48 },
+    { -0.4558395, 0.4218473, 0.7837443, 4.48 },
+    { -0.0440310, 0.5129902, 0.8572644, 4.48 },
+    { -0.3643864, 0.4093078, -0.8364746, 4.49 },
+    { -0.2132877, 0.6510150, -0.7284832, 4.49 },
+    { -0.3674857, 0.6864735, -0.6274619, 4.49 },
+    { 0.9652012, -0.0729056, -0.2511403, 4.49 },
+    { -0.7136856, -0.6963543, -0.0757861, 4.49 },
+    { -0.8828027, 0.4696992, -0.0064872, 4.49 },
+    { 0.7389315, -0.6509880, 0.1737666, 4.49 },
+    { -0.1856978, 0.9555921, 0.2288233, 4.49 },
+    { 0.3826889, 0.8837793, 0.2692275, 4.49 },
+    { 0.6882301, -0.3435952, 0.6389692, 4.49 },
+    { 0.4134669, -0.0001500, -0.9105192, 4.50 },
+    { -0.5071719, 0.2340425, -0.8294581, 4.50 },
+    { 0.7412551, -0.3925441, -0.5444723, 4.50 },
+    { -0.3730533, 0.8108741, -0.4509039, 4.50 },
+    { -0.4085654, 0.8011043, -0.4373857, 4.50 },
+    { 0.6604447, -0.6205876, -0.4227101, 4.50 },
+    { -0.3817299, -0.8584192, -0.3426351, 4.50 },
+    { 0.9964523, -0.0782176, 0.0310619, 4.50 },
+    { -0.1419042, 0.9816169, 0.1276378, 4.50 },
+    { -0.8513611, -0.4303410, 0.2999849, 4.50 },
+    { -0.8725416, 0.2517919, 0.4186549, 4.50 },
+    { -0.4956492, 0.3640067, 0.7885626, 4.50 },
+    { 0.2319223, 0.4053562, -0.8842502, 4.51 },
+    { -0.3221730, -0.3956512, -0.8600376, 4.51 },
+    { 0.0247030, 0.5562303, -0.8306610, 4.51 },
+    { 0.4046996, -0.4653963, -0.7871623, 4.51 },
+    { -0.6406045, 0.4949152, -0.5870987, 4.51 },
+    { 0.3198690, 0.8069708, -0.4964695, 4.51 },
+    { 0.7334201, -0.5692928, -0.3714844, 4.51 },
+    { 0.7216316, -0.6636043, -0.1971730, 4.51 },
+    { 0.6486421, 0.5835704, 0.4885785, 4.51 },
+    { 0.8232894, 0.2661533, 0.5013551, 4.51 },
+    { 0.6749188, -0.2778772, 0.6835707, 4.51 },
+    { 0.3541105, -0.4025380, 0.8441380, 4.51 },
+    { 0.1923224, -0.3238488, 0.9263553, 4.51 },
+    { -0.3922414, 0.2763116, -0.8773817, 4.52 },
+    { 0.4345245, -0.7763218, -0.4566322, 4.52 },
+    { -0.7991080, -0.5549292, -0.2312574, 4.52 },
+    { 0.9602879, -0.2260949, 0.1634876, 4.52 },
+    { -0.5348707, -0.7749896, 0.3366073, 4.52 },
+    { 0.4938453, -0.7337546, 0.4666058, 4.52 },
+    { 0.7983253, 0.0639805, 0.5988182, 4.52 },
+    { -0.1257824, -0.7871147, 0.6038454, 4.52 },
+    { 0.0365997, 0.7742883, 0.6317738, 4.52 },
+    { 0.6367933, -0.1337582, 0.7593439, 4.52 },
+    { 0.3057999, 0.2326765, 0.9232270, 4.52 },
+    { -0.4013845, -0.1540938, -0.9028541, 4.53 },
+    { -0.4538050, -0.1710978, -0.8745207, 4.53 },
+    { 0.0340528, -0.6943963, -0.7187866, 4.53 },
+    { -0.3377706, 0.7466162, -0.5731276, 4.53 },
+    { -0.0002476, 0.9985609, -0.0536291, 4.53 },
+    { 0.9680101, -0.2419047, 0.0666222, 4.53 },
+    { -0.9370899, 0.0491730, 0.3456076, 4.53 },
+    { 0.5998370, 0.5569796, 0.5744296, 4.53 },
+    { 0.5364049, -0.5988398, 0.5946938, 4.53 },
+    { 0.7360701, 0.1625534, 0.6570975, 4.53 },
+    { 0.4502194, 0.0623930, -0.8907354, 4.54 },
+    { -0.4162097, -0.5722690, -0.7065958, 4.54 },
+    { -0.5058149, -0.6199519, -0.5998424, 4.54 },
+    { -0.0479776, -0.8830277, -0.4668622, 4.54 },
+    { -0.1402926, 0.9099946, -0.3901638, 4.54 },
+    { -0.6289284, -0.6998558, -0.3386015, 4.54 },
+    { -0.1445116, -0.9855228, -0.0886630, 4.54 },
+    { -0.3735104, 0.9039996, 0.2080260, 4.54 },
+    { -0.6179871, -0.6424370, 0.4531739, 4.54 },
+    { 0.1515495, 0.8212537, 0.5500682, 4.54 },
+    { 0.6528030, 0.1290360, 0.7464569, 4.54 },
+    { -0.5165614, -0.3402318, 0.7857522, 4.54 },
+    { 0.5371472, -0.0131671, 0.8433857, 4.54 },
+    { 0.3147925, 0.4099301, 0.8560742, 4.54 },
+    { 0.2818739, 0.1659649, 0.9449882, 4.54 },
+    { 0.1955904, 0.7904454, -0.5804657, 4.55 },
+    { -0.3832720, -0.8279281, -0.4094357, 4.55 },
+    { 0.9544461, 0.0155768, -0.2979766, 4.55 },
+    { 0.9664818, -0.1308660, 0.2208781, 4.55 },
+    { -0.6928048, -0.6426025, 0.3272362, 4.55 },
+    { -0.6475061, 0.4781543, 0.5933838, 4.55 },
+    { 0.4898856, -0.4624459, 0.7390236, 4.55 },
+    { -0.0583841, 0.2176386, 0.9742817, 4.55 },
+    { 0.2416104, 0.4132382, -0.8779855, 4.56 },
+    { -0.5659618, -0.4193129, -0.7098337, 4.56 },
+    { -0.7408466, -0.3931974, -0.5445569, 4.56 },
+    { -0.5693056, 0.5377541, 0.6218614, 4.56 },
+    { -0.2776017, 0.2045130, 0.9386755, 4.56 },
+    { 0.2640083, -0.1815808, 0.9472740, 4.56 },
+    { -0.4643117, 0.1609302, -0.8709283, 4.57 },
+    { -0.5190463, 0.2431027, -0.8194461, 4.57 },
+    { 0.0310015, -0.8786266, -0.4765021, 4.57 },
+    { 0.8808485, -0.0425921, -0.4714784, 4.57 },
+    { -0.7984166, 0.6017502, -0.0206807, 4.57 },
+    { 0.0904639, 0.9933031, 0.0718698, 4.57 },
+    { -0.3891110, -0.8887031, 0.2424859, 4.57 },
+    { 0.7266579, -0.5578446, 0.4009709, 4.57 },
+    { 0.6247362, -0.2879187, 0.7258151, 4.57 },
+    { 0.5941810, -0.2629425, 0.7601383, 4.57 },
+    { -0.5827349, 0.3652655, -0.7259485, 4.58 },
+    { 0.4454984, 0.6193786, -0.6464529, 4.58 },
+    { 0.4515206, -0.7615193, -0.4649918, 4.58 },
+    { -0.6582566, 0.6135747, -0.4361471, 4.58 },
+    { 0.4337500, -0.8033625, 0.4080069, 4.58 },
+    { 0.0257972, 0.8857294, 0.4634846, 4.58 },
+    { -0.0241334, -0.3055931, 0.9518563, 4.58 },
+    { -0.0729606, -0.6844056, -0.7254418, 4.59 },
+    { 0.6823445, 0.1243931, -0.7203696, 4.59 },
+    { 0.2234372, -0.7268769, -0.6494042, 4.59 },
+    { 0.4480881, 0.6570891, -0.6061774, 4.59 },
+    { -0.3839846, 0.7913123, -0.4757948, 4.59 },
+    { -0.4000816, -0.7877788, -0.4683368, 4.59 },
+    { -0.4735810, -0.7698827, -0.4277869, 4.59 },
+    { 0.1068069, 0.9906959, -0.0843440, 4.59 },
+    { 0.9219110, -0.3874016, -0.0003544, 4.59 },
+    { 0.1439868, 0.9881050, 0.0540023, 4.59 },
+    { 0.2183777, -0.8966998, 0.3850203, 4.59 },
+    { 0.6075050, -0.6507384, 0.4554966, 4.59 },
+    { -0.4978437, 0.3107647, 0.8096770, 4.59 },
+    { 0.1417927, -0.3860655, 0.9115088, 4.59 },
+    { -0.4846401, 0.1016880, -0.8687828, 4.60 },
+    { -0.4764699, -0.1554813, -0.8653335, 4.60 },
+    { -0.4873654, -0.6090764, -0.6257004, 4.60 },
+    { -0.7669891, 0.2173313, -0.6037341, 4.60 },
+    { 0.3715312, -0.8275940, -0.4207763, 4.60 },
+    { -0.8542882, 0.4680733, -0.2260511, 4.60 },
+    { -0.1244626, 0.9846411, -0.1224376, 4.60 },
+    { -0.7901621, 0.6109912, -0.0483074, 4.60 },
+    { -0.7184591, -0.6314132, 0.2917773, 4.60 },
+    { 0.9019111, -0.1564485, 0.4025918, 4.60 },
+    { -0.2787781, 0.3316080, 0.9012874, 4.60 },
+    { -0.2913919, -0.2853101, 0.9130656, 4.60 },
+    { -0.4503846, 0.1070060, -0.8863991, 4.61 },
+    { -0.4739627, 0.8220301, -0.3156357, 4.61 },
+    { 0.3356430, -0.9009903, -0.2748823, 4.61 },
+    { 0.9947730, 0.0231616, -0.0994500, 4.61 },
+    { 0.5080962, -0.6393187, 0.5771567, 4.61 },
+    { 0.7784603, 0.0581627, 0.6249933, 4.61 },
+    { 0.2744101, 0.5768871, 0.7693506, 4.61 },
+    { -0.4983287, -0.1211413, -0.8584831, 4.62 },
+    { -0.5805108, 0.0641873, -0.8117187, 4.62 },
+    { -0.5988809, 0.5217396, -0.6075603, 4.62 },
+    { -0.3730765, 0.8108469, -0.4509338, 4.62 },
+    { -0.5850536, -0.7919426, -0.1747548, 4.62 },
+    { -0.0955523, -0.9853550, -0.1412276, 4.62 },
+    { 0.1211818, 0.9844610, -0.1270887, 4.62 },
+    { -0.6497691, 0.7496302, -0.1259152, 4.62 },
+    { 0.0021038, -0.9979243, -0.0643635, 4.62 },
+    { 0.8783806, 0.4747166, 0.0556037, 4.62 },
+    { 0.2421999, -0.9674534, 0.0733011, 4.62 },
+    { -0.3891550, -0.6268780, 0.6749684, 4.62 },
+    { -0.2594728, -0.4658538, -0.8459634, 4.63 },
+    { -0.3068390, 0.5706868, -0.7616866, 4.63 },
+    { -0.3873556, -0.9103614, -0.1455943, 4.63 },
+    { -0.9634081, 0.2356695, 0.1276897, 4.63 },
+    { -0.0160578, 0.9387270, 0.3442875, 4.63 },
+    { 0.6608859, 0.6563549, 0.3639066, 4.63 },
+    { 0.6608859, 0.6563549, 0.3639066, 4.63 },
+    { -0.9023356, 0.1786543, 0.3922667, 4.63 },
+    { -0.4839791, -0.7567395, 0.4394423, 4.63 },
+    { 0.5172581, 0.5709065, 0.6375812, 4.63 },
+    { 0.5819145, -0.2193848, 0.7831002, 4.63 },
+    { 0.4967470, 0.1253808, 0.8587910, 4.63 },
+    { 0.1715569, 0.2702219, 0.9473903, 4.63 },
+    { 0.0634800, -0.4608255, -0.8852176, 4.64 },
+    { -0.4049450, -0.5847513, -0.7029121, 4.64 },
+    { 0.1077170, -0.7315969, -0.6731739, 4.64 },
+    { -0.7546169, -0.1326356, -0.6426205, 4.64 },
+    { -0.3557127, 0.8047962, -0.4751542, 4.64 },
+    { -0.2899019, 0.8350277, -0.4676384, 4.64 },
+    { -0.4806920, -0.7616912, -0.4344671, 4.64 },
+    { 0.0011449, -0.9970940, 0.0761728, 4.64 },
+    { 0.0315070, -0.9879019, 0.1518455, 4.64 },
+    { 0.2285091, 0.9013253, 0.3679623, 4.64 },
+    { 0.4461580, -0.7642605, 0.4656703, 4.64 },
+    { -0.2413145, 0.6070660, 0.7571249, 4.64 },
+    { 0.0116467, 0.4524405, -0.8917186, 4.65 },
+    { -0.5408327, -0.1109637, -0.8337788, 4.65 },
+    { -0.5571332, -0.2797678, -0.7818776, 4.65 },
+    { -0.3185484, -0.5700638, -0.7573336, 4.65 },
+    { -0.3306007, 0.7912151, -0.5144724, 4.65 },
+    { 0.0700871, -0.8879077, -0.4546513, 4.65 },
+    { 0.4760076, 0.7745721, -0.4164791, 4.65 },
+    { -0.2960780, -0.9366614, -0.1870918, 4.65 },
+    { 0.2758743, 0.9448984, 0.1762396, 4.65 },
+    { -0.2299610, 0.9461215, 0.2279737, 4.65 },
+    { 0.3548644, 0.8991304, 0.2561947, 4.65 },
+    { 0.8626793, 0.2875955, 0.4160207, 4.65 },
+    { -0.1461000, -0.7820311, 0.6058731, 4.65 },
+    { 0.6231406, -0.1548375, 0.7666297, 4.65 },
+    { -0.3775058, -0.1995242, 0.9042563, 4.65 },
+    { -0.4804393, 0.1778351, -0.8588089, 4.66 },
+    { -0.4921606, 0.2104147, -0.8446914, 4.66 },
+    { -0.6471793, -0.1216717, -0.7525656, 4.66 },
+    { -0.2685303, 0.7550918, -0.5981035, 4.66 },
+    { -0.2852689, 0.8494593, -0.4438925, 4.66 },
+    { 0.4569728, 0.7909036, -0.4069979, 4.66 },
+    { -0.9757940, -0.1687543, -0.1390972, 4.66 },
+    { 0.3685981, -0.9295701, 0.0059098, 4.66 },
+    { 0.9155326, -0.4015247, 0.0240396, 4.66 },
+    { -0.9933371, -0.0037845, 0.1151832, 4.66 },
+    { -0.1752045, 0.9694172, 0.1718536, 4.66 },
+    { 0.8883669, 0.2863063, 0.3589332, 4.66 },
+    { -0.6083458, 0.7042483, 0.3659915, 4.66 },
+    { 0.9052188, -0.0088543, 0.4248535, 4.66 },
+    { 0.6695588, 0.5792319, 0.4649532, 4.66 },
+    { -0.5231633, -0.2460101, 0.8159529, 4.66 },
+    { 0.1128199, -0.4965619, 0.8606381, 4.66 },
+    { -0.4738857, -0.6753156, -0.5651382, 4.67 },
+    { 0.6013291, -0.5945889, -0.5337297, 4.67 },
+    { -0.0259452, 0.9658690, -0.2577282, 4.67 },
+    { 0.8724478, 0.4521607, -0.1854332, 4.67 },
+    { 0.0002375, -0.9575673, 0.2882097, 4.67 },
+    { 0.3967054, 0.5140567, 0.7605067, 4.67 },
+    { 0.5166630, -0.3547779, 0.7792252, 4.67 },
+    { -0.3300195, 0.2999833, 0.8950403, 4.67 },
+    { -0.0825718, -0.1777777, -0.9806003, 4.68 },
+    { -0.2256364, 0.9113594, -0.3442560, 4.68 },
+    { 0.7653756, -0.5505861, -0.3332493, 4.68 },
+    { 0.1017955, -0.9826086, -0.1553000, 4.68 },
+    { -0.5044602, 0.8630929, -0.0243013, 4.68 },
+    { -0.8125847, 0.5771796, 0.0810547, 4.68 },
+    { 0.6065215, -0.7536309, 0.2533223, 4.68 },
+    { 0.2309106, 0.9360143, 0.2656267, 4.68 },
+    { 0.1363097, -0.3197281, 0.9376532, 4.68 },
+    { 0.3334788, 0.1828294, -0.9248596, 4.69 },
+    { -0.4755143, -0.0959489, -0.8744598, 4.69 },
+    { 0.4783435, -0.2668991, -0.8366316, 4.69 },
+    { -0.4213411, 0.4350820, -0.7957231, 4.69 },
+    { 0.0190539, -0.8694585, -0.4936383, 4.69 },
+    { 0.7465700, 0.4507598, -0.4893351, 4.69 },
+    { -0.6788806, 0.5536560, -0.4822719, 4.69 },
+    { 0.9021809, -0.2003673, -0.3819980, 4.69 },
+    { -0.7271203, 0.5716387, -0.3801648, 4.69 },
+    { 0.8943582, -0.3097503, -0.3227664, 4.69 },
+    { 0.8058545, -0.5761289, -0.1366526, 4.69 },
+    { -0.9150825, -0.3882654, -0.1089676, 4.69 },
+    { 0.8725487, -0.4870774, -0.0376083, 4.69 },
+    { 0.7267709, -0.6639723, 0.1759113, 4.69 },
+    { 0.3833231, 0.8880054, 0.2539877, 4.69 },
+    { 0.3317629, 0.9026146, 0.2742632, 4.69 },
+    { 0.3632992, -0.7846610, 0.5023154, 4.69 },
+    { -0.8186392, 0.0708545, -0.5699207, 4.70 },
+    { 0.4340800, -0.7843921, -0.4430616, 4.70 },
+    { -0.3757926, 0.8217493, -0.4283784, 4.70 },
+    { 0.1229737, -0.9600153, -0.2514918, 4.70 },
+    { -0.9803053, 0.1000872, -0.1702472, 4.70 },
+    { -0.8579642, 0.4942824, 0.1399369, 4.70 },
+    { 0.6994475, 0.6977090, 0.1548397, 4.70 },
+    { 0.5472740, 0.5413916, 0.6382682, 4.70 },
+    { -0.6009303, -0.2627123, 0.7548940, 4.70 },
+    { -0.2413086, 0.2297181, -0.9428678, 4.71 },
+    { -0.3861452, -0.2176889, -0.8963835, 4.71 },
+    { -0.6355599, -0.1891013, -0.7485347, 4.71 },
+    { -0.3100650, 0.6063224, -0.7322792, 4.71 },
+    { 0.7315726, -0.0798720, -0.6770687, 4.71 },
+    { 0.6434968, -0.5498977, -0.5324701, 4.71 },
+    { 0.1600572, 0.9182295, -0.3622654, 4.71 },
+    { 0.9277719, -0.1086728, -0.3569726, 4.71 },
+    { 0.1316565, 0.9911121, -0.0190612, 4.71 },
+    { 0.4729066, -0.8687395, 0.1471429, 4.71 },
+    { -0.7954793, 0.2945724, 0.5295656, 4.71 },
+    { 0.1356491, 0.7528067, 0.6441129, 4.71 },
+    { 0.3367334, 0.6819900, 0.6492305, 4.71 },
+    { -0.6990445, 0.2071383, 0.6844199, 4.71 },
+    { 0.5143331, 0.3792793, 0.7691610, 4.71 },
+    { 0.4691964, 0.2038461, 0.8592447, 4.71 },
+    { 0.0945122, -0.0278105, 0.9951352, 4.71 },
+    { -0.3931878, 0.0201961, -0.9192363, 4.72 },
+    { -0.4513330, -0.0085084, -0.8923150, 4.72 },
+    { 0.2779415, 0.3601932, -0.8905108, 4.72 },
+    { 0.1266411, 0.5225736, -0.8431363, 4.72 },
+    { -0.4709017, -0.4924262, -0.7319618, 4.72 },
+    { -0.3350547, -0.6202528, -0.7092424, 4.72 },
+    { -0.6924681, 0.5734034, -0.4378316, 4.72 },
+    { -0.5282355, 0.8190984, -0.2237075, 4.72 },
+    { 0.1811229, -0.9707929, -0.1573394, 4.72 },
+    { -0.2098749, -0.7084673, -0.6738150, 4.73 },
+    { 0.4296566, 0.6654099, -0.6104301, 4.73 },
+    { -0.7472598, -0.4023930, -0.5288503, 4.73 },
+    { 0.7813866, -0.5337338, -0.3233624, 4.73 },
+    { -0.9470498, 0.0630559, -0.3148342, 4.73 },
+    { 0.6756889, -0.7204601, -0.1561467, 4.73 },
+    { 0.6042404, 0.7918759, -0.0884650, 4.73 },
+    { -0.1881828, -0.9821033, -0.0077720, 4.73 },
+    { 0.1660695, 0.9860915, -0.0066758, 4.73 },
+    { 0.7271956, -0.4898390, 0.4808787, 4.73 },
+    { -0.7165206, -0.2521218, 0.6504097, 4.73 },
+    { 0.5748189, 0.0802054, 0.8143404, 4.73 },
+    { 0.3810814, -0.2720235, 0.8836177, 4.73 },
+    { -0.2857728, 0.1178816, -0.9510194, 4.74 },
+    { 0.6977312, -0.0676448, -0.7131587, 4.74 },
+    { -0.5335051, -0.7758691, -0.3367483, 4.74 },
+    { -0.8943474, -0.3184855, -0.3141812, 4.74 },
+    { -0.9670498, 0.2508690, -0.0433525, 4.74 },
+    { 0.2812179, 0.9275343, 0.2461636, 4.74 },
+    { -0.9482803, -0.0859533, 0.3055757, 4.74 },
+    { -0.7619741, 0.3316525, 0.5562392, 4.74 },
+    { -0.7284986, -0.3865006, 0.5656033, 4.74 },
+    { 0.3214364, -0.7593592, 0.5657316, 4.74 },
+    { 0.0310891, 0.7948063, 0.6060663, 4.74 },
+    { 0.4771614, -0.4778830, 0.7375262, 4.74 },
+    { 0.3466221, 0.1364213, 0.9280314, 4.74 },
+    { 0.1132855, -0.0370913, 0.9928699, 4.74 },
+    { 0.1896285, 0.1744872, -0.9662273, 4.75 },
+    { -0.5025089, -0.3198659, -0.8032251, 4.75 },
+    { -0.3968842, 0.6144787, -0.6818349, 4.75 },
+    { 0.5616468, 0.4704430, -0.6806147, 4.75 },
+    { 0.2017750, -0.7140704, -0.6703658, 4.75 },
+    { -0.4635863, -0.6788484, -0.5694318, 4.75 },
+    { 0.6854239, 0.6338119, -0.3584363, 4.75 },
+    { 0.7600569, 0.5942854, -0.2629419, 4.75 },
+    { 0.8303826, 0.4486585, 0.3304092, 4.75 },
+    { -0.7073397, 0.2813714, 0.6484602, 4.75 },
+    { -0.5173393, -0.3494914, 0.7811631, 4.75 },
+    { 0.3667397, -0.0669375, 0.9279124, 4.75 },
+    { -0.2562545, 0.4060930, -0.8771671, 4.76 },
+    { 0.3084108, -0.3822860, -0.8710569, 4.76 },
+    { -0.2129508, 0.6306141, -0.7463095, 4.76 },
+    { -0.0008256, -0.9148458, -0.4038026, 4.76 },
+    { -0.8922407, -0.3580146, -0.2751946, 4.76 },
+    { 0.5617225, -0.7973026, -0.2208539, 4.76 },
+    { 0.9646906, 0.1883470, -0.1841124, 4.76 },
+    { -0.4973321, -0.7902482, 0.3580063, 4.76 },
+    { 0.8788915, -0.2064935, 0.4300117, 4.76 },
+    { 0.8360012, 0.3020789, 0.4580941, 4.76 },
+    { 0.1004643, 0.8402842, 0.5327565, 4.76 },
+    { -0.3744198, -0.7114416, 0.5946938, 4.76 },
+    { -0.3397325, -0.6053859, 0.7197845, 4.76 },
+    { -0.4683664, -0.4841191, 0.7390951, 4.76 },
+    { 0.3786625, 0.3974264, 0.8358630, 4.76 },
+    { -0.2720902, 0.2661138, 0.9247434, 4.76 },
+    { -0.0555888, -0.6481880, -0.7594486, 4.77 },
+    { 0.6524633, 0.0900053, -0.7524564, 4.77 },
+    { -0.4385280, 0.5170106, -0.7351145, 4.77 },
+    { -0.5760803, -0.4060350, -0.7094132, 4.77 },
+    { 0.4048794, -0.6767834, -0.6148470, 4.77 },
+    { -0.7179888, -0.5173387, -0.4656746, 4.77 },
+    { -0.7536191, 0.5214261, -0.4002162, 4.77 },
+    { -0.4739112, -0.8582083, -0.1971973, 4.77 },
+    { -0.9902612, 0.1289852, -0.0523989, 4.77 },
+    { 0.9731768, 0.2291901, -0.0199686, 4.77 },
+    { -0.2030372, 0.9691375, 0.1398159, 4.77 },
+    { 0.3039750, -0.8801017, 0.3647192, 4.77 },
+    { 0.0770570, -0.5384858, 0.8391039, 4.77 },
+    { 0.2238264, 0.0015579, -0.9746278, 4.78 },
+    { -0.0624564, -0.3731246, -0.9256767, 4.78 },
+    { -0.4455988, 0.6764719, -0.5863680, 4.78 },
+    { -0.3768997, -0.7928410, -0.4789047, 4.78 },
+    { 0.5758112, -0.7581910, -0.3059215, 4.78 },
+    { 0.1080753, 0.9886287, -0.1045612, 4.78 },
+    { 0.0329635, 0.9989322, 0.0323702, 4.78 },
+    { 0.3653244, 0.8881211, 0.2788887, 4.78 },
+    { -0.9228282, -0.2426296, 0.2991972, 4.78 },
+    { 0.5019326, -0.7493170, 0.4319581, 4.78 },
+    { 0.2322879, 0.7673555, 0.5976687, 4.78 },
+    { -0.7735482, 0.1394214, 0.6182110, 4.78 },
+    { 0.4902120, -0.5199874, 0.6995036, 4.78 },
+    { 0.0836600, -0.4163292, -0.9053569, 4.79 },
+    { 0.6741940, -0.3302301, -0.6606137, 4.79 },
+    { -0.4239182, 0.7518095, -0.5050503, 4.79 },
+    { -0.7339924, 0.4941450, -0.4659140, 4.79 },
+    { -0.3457486, -0.8368462, -0.4244365, 4.79 },
+    { -0.3013038, 0.8675032, -0.3957957, 4.79 },
+    { 0.2529353, 0.9428153, -0.2170786, 4.79 },
+    { -0.7487512, 0.6295408, -0.2074849, 4.79 },
+    { -0.9585694, -0.2316950, -0.1657170, 4.79 },
+    { 0.5207199, 0.8521700, -0.0515463, 4.79 },
+    { 0.9171744, -0.3899867, 0.0818622, 4.79 },
+    { -0.8540158, 0.3994377, 0.3333265, 4.79 },
+    { 0.7977262, 0.4510025, 0.4002868, 4.79 },
+    { 0.8216790, -0.2919533, 0.4894966, 4.79 },
+    { -0.1259313, 0.7265758, 0.6754472, 4.79 },
+    { 0.2689561, -0.1402979, 0.9528794, 4.79 },
+    { -0.3562127, -0.1213485, -0.9264918, 4.80 },
+    { -0.7567498, 0.6322745, -0.1660082, 4.80 },
+    { 0.6488443, 0.7453136, -0.1533255, 4.80 },
+    { 0.0912725, 0.9878785, -0.1255603, 4.80 },
+    { -0.9389210, -0.3306685, 0.0953192, 4.80 },
+    { 0.3876630, 0.8716963, 0.2997717, 4.80 },
+    { 0.9365482, 0.0597562, 0.3454079, 4.80 },
+    { -0.8482129, -0.2560031, 0.4636779, 4.80 },
+    { 0.6252287, 0.1160622, 0.7717633, 4.80 },
+    { 0.6240200, -0.0043207, 0.7813964, 4.80 },
+    { -0.6182521, -0.0650496, 0.7832834, 4.80 },
+    { 0.2475459, 0.3741369, 0.8937240, 4.80 },
+    { -0.2869236, 0.2620275, 0.9214209, 4.80 },
+    { -0.0363748, -0.3604755, 0.9320592, 4.80 },
+    { -0.0290088, 0.3519598, 0.9355655, 4.80 },
+    { -0.3560768, 0.2962857, -0.8862415, 4.81 },
+    { 0.4363058, -0.1740647, -0.8828017, 4.81 },
+    { -0.0257851, 0.5734457, -0.8188377, 4.81 },
+    { -0.0327469, -0.7643258, -0.6439983, 4.81 },
+    { 0.8323833, 0.1019396, -0.5447443, 4.81 },
+    { -0.1136729, -0.9067116, -0.4061435, 4.81 },
+    { 0.1033662, -0.9306946, -0.3508889, 4.81 },
+    { 0.2507733, 0.9599570, -0.1248811, 4.81 },
+    { -0.7975022, -0.6020620, -0.0388781, 4.81 },
+    { -0.9123625, -0.1398216, 0.3847657, 4.81 },
+    { -0.6348920, -0.6466819, 0.4227466, 4.81 },
+    { -0.8956326, -0.0882325, 0.4359555, 4.81 },
+    { -0.6767273, -0.5852862, 0.4466321, 4.81 },
+    { 0.7998858, -0.3673920, 0.4745585, 4.81 },
+    { -0.6708619, -0.4610569, 0.5808364, 4.81 },
+    { 0.4455287, -0.6495416, 0.6161168, 4.81 },
+    { -0.6213098, 0.4553000, 0.6377116, 4.81 },
+    { -0.4064628, 0.1434708, -0.9023326, 4.82 },
+    { -0.4151363, 0.1427103, -0.8984963, 4.82 },
+    { -0.2231318, 0.3851813, -0.8954594, 4.82 },
+    { -0.6190166, -0.0719698, -0.7820734, 4.82 },
+    { -0.3860983, 0.5386663, -0.7488436, 4.82 },
+    { -0.4709017, -0.4924262, -0.7319618, 4.82 },
+    { -0.4753412, -0.5317577, -0.7009169, 4.82 },
+    { 0.5814173, -0.4845906, -0.6535487, 4.82 },
+    { 0.9490294, -0.0756771, -0.3059676, 4.82 },
+    { -0.1653748, 0.9554709, -0.2443903, 4.82 },
+    { -0.9105652, 0.3424714, -0.2314828, 4.82 },
+    { 0.9089391, -0.3734929, -0.1852912, 4.82 },
+    { -0.2536584, -0.9644875, -0.0736298, 4.82 },
+    { -0.4143359, -0.9099468, 0.0179619, 4.82 },
+    { 0.2097001, 0.9400709, 0.2688727, 4.82 },
+    { 0.5946624, -0.7180468, 0.3616427, 4.82 },
+    { 0.0078667, 0.8991121, 0.4376477, 4.82 },
+    { -0.1550880, -0.8232377, 0.5461020, 4.82 },
+    { 0.5349951, 0.6304541, 0.5624125, 4.82 },
+    { -0.4328756, -0.6876054, 0.5829387, 4.82 },
+    { -0.7341960, -0.3325055, 0.5919428, 4.82 },
+    { 0.6686591, 0.4198083, 0.6137231, 4.82 },
+    { -0.2111564, -0.6620079, 0.7191374, 4.82 },
+    { 0.4700241, 0.1108239, 0.8756685, 4.82 },
+    { 0.0468030, -0.4110266, 0.9104211, 4.82 },
+    { 0.0753983, -0.3116690, 0.9471946, 4.82 },
+    { -0.1824405, -0.1149427, 0.9764751, 4.82 },
+    { 0.0777084, 0.3798855, -0.9217637, 4.83 },
+    { 0.5904987, 0.3312601, -0.7359199, 4.83 },
+    { -0.6803810, 0.3088965, -0.6645785, 4.83 },
+    { -0.2278291, 0.7354099, -0.6381742, 4.83 },
+    { 0.1512818, 0.8061264, -0.5720787, 4.83 },
+    { -0.4848798, 0.6836610, -0.5454349, 4.83 },
+    { -0.0401693, -0.8498320, -0.5255207, 4.83 },
+    { 0.4450920, -0.7791190, -0.4414371, 4.83 },
+    { 0.2159565, -0.8965934, -0.3866305, 4.83 },
+    { -0.2172542, 0.9128505, -0.3456945, 4.83 },
+    { -0.9704068, 0.1510508, -0.1883994, 4.83 },
+    { 0.2451325, -0.9641241, -0.1018569, 4.83 },
+    { 0.6438033, 0.7629293, 0.0587890, 4.83 },
+    { -0.7410220, -0.6281452, 0.2373181, 4.83 },
+    { 0.8303715, 0.4486525, 0.3304453, 4.83 },
+    { -0.4529000, -0.8029063, 0.3875862, 4.83 },
+    { -0.7629539, -0.4879216, 0.4240681, 4.83 },
+    { 0.1784546, -0.8756688, 0.4487294, 4.83 },
+    { 0.5988395, 0.3934451, 0.6975616, 4.83 },
+    { 0.6513409, 0.2620250, 0.7121081, 4.83 },
+    { 0.3759711, -0.5718174, 0.7291574, 4.83 },
+    { -0.4436904, 0.3850545, 0.8092415, 4.83 },
+    { 0.5006724, 0.1225176, 0.8569228, 4.83 },
+    { -0.1451458, -0.4038121, 0.9032544, 4.83 },
+    { 0.2857055, 0.2517574, -0.9246570, 4.84 },
+    { -0.3299364, 0.7119515, -0.6198928, 4.84 },
+    { 0.6777328, -0.6521674, -0.3396409, 4.84 },
+    { 0.7508556, 0.6276077, -0.2057293, 4.84 },
+    { -0.9646295, 0.2559471, 0.0630953, 4.84 },
+    { 0.8747296, -0.4765221, 0.0881748, 4.84 },
+    { 0.9182658, 0.3812261, 0.1070257, 4.84 },
+    { 0.4406098, 0.8831474, 0.1609770, 4.84 },
+    { -0.3647026, -0.9095743, 0.1991646, 4.84 },
+    { 0.6338240, 0.3805075, 0.6734101, 4.84 },
+    { 0.4659622, -0.5132618, 0.7207229, 4.84 },
+    { -0.3308855, 0.5271863, 0.7826809, 4.84 },
+    { -0.5174697, 0.2126867, 0.8288483, 4.84 },
+    { 0.2650188, 0.3158091, 0.9110596, 4.84 },
+    { -0.2300341, 0.0893495, 0.9690722, 4.84 },
+    { -0.4105142, 0.1356589, -0.9017066, 4.85 },
+    { 0.5637764, -0.1896450, -0.8038600, 4.85 },
+    { -0.6242902, -0.1776958, -0.7607141, 4.85 },
+    { 0.7085525, -0.2457046, -0.6615002, 4.85 },
+    { -0.7513938, -0.2443354, -0.6129500, 4.85 },
+    { 0.2927286, -0.8557213, -0.4266744, 4.85 },
+    { -0.3516671, 0.8505017, -0.3911229, 4.85 },
+    { 0.8065735, 0.4501784, -0.3831170, 4.85 },
+    { -0.9875914, 0.0634976, 0.1436361, 4.85 },
+    { -0.3555339, -0.7810223, 0.5134198, 4.85 },
+    { 0.2866825, 0.6258311, 0.7253610, 4.85 },
+    { 0.6447415, -0.1202384, 0.7548848, 4.85 },
+    { -0.1754214, -0.5189822, 0.8365912, 4.85 },
+    { 0.4950057, -0.1174367, 0.8609170, 4.85 },
+    { 0.3408699, 0.1169856, -0.9328034, 4.86 },
+    { -0.2891780, -0.3375338, -0.8957941, 4.86 },
+    { -0.4490622, -0.0521870, -0.8919751, 4.86 },
+    { -0.3321926, 0.4126964, -0.8481331, 4.86 },
+    { -0.3906612, 0.4556923, -0.7998302, 4.86 },
+    { -0.5470714, 0.2880162, -0.7859768, 4.86 },
+    { -0.0100166, -0.7151081, -0.6989422, 4.86 },
+    { 0.4212500, -0.8415684, -0.3380992, 4.86 },
+    { 0.9980578, -0.0057782, -0.0620260, 4.86 },
+    { 0.0907716, -0.9941279, 0.0589090, 4.86 },
+    { 0.7737868, 0.6259027, 0.0974666, 4.86 },
+    { -0.7536938, -0.6417094, 0.1419672, 4.86 },
+    { -0.7867913, -0.5496553, 0.2807821, 4.86 },
+    { 0.0781537, 0.9554605, 0.2845824, 4.86 },
+    { 0.0435680, 0.9084279, 0.4157650, 4.86 },
+    { 0.1579736, 0.7666716, 0.6223014, 4.86 },
+    { -0.3720413, -0.1303177, -0.9190226, 4.87 },
+    { 0.1520717, -0.5831687, -0.7979902, 4.87 },
+    { 0.2021146, -0.7714686, -0.6033124, 4.87 },
+    { 0.1561904, -0.7975244, -0.5827173, 4.87 },
+    { -0.1973856, -0.8039610, -0.5609685, 4.87 },
+    { 0.0249604, 0.8305960, -0.5563158, 4.87 },
+    { -0.0671258, -0.9268126, -0.3694760, 4.87 },
+    { 0.4375489, 0.8813898, -0.1780533, 4.87 },
+    { -0.8382236, 0.1546684, 0.5229330, 4.87 },
+    { 0.6833521, 0.4655099, 0.5624326, 4.87 },
+    { -0.0689394, -0.5669226, 0.8208813, 4.87 },
+    { 0.5194072, -0.0293615, 0.8540223, 4.87 },
+    { -0.1018721, 0.4981042, 0.8611122, 4.87 },
+    { 0.1800681, 0.1998777, 0.9631326, 4.87 },
+    { 0.3025564, -0.3683764, -0.8790668, 4.88 },
+    { -0.0071810, -0.7464166, -0.6654403, 4.88 },
+    { -0.7672081, 0.4692015, -0.4373120, 4.88 },
+    { 0.5988326, 0.7034290, -0.3828671, 4.88 },
+    { -0.6235779, 0.7319140, -0.2746860, 4.88 },
+    { -0.4911653, -0.8354162, -0.2466504, 4.88 },
+    { -0.9676965, -0.1788505, 0.1776964, 4.88 },
+    { -0.4235712, 0.8484103, 0.3174702, 4.88 },
+    { 0.1305585, 0.9183619, 0.3735851, 4.88 },
+    { 0.2389005, 0.7566593, 0.6085995, 4.88 },
+    { 0.7288994, -0.2679601, 0.6300025, 4.88 },
+    { 0.6558206, 0.2463108, 0.7136038, 4.88 },
+    { -0.0691428, -0.5667379, 0.8209917, 4.88 },
+    { 0.5627275, -0.0024349, 0.8266389, 4.88 },
+    { -0.5480833, 0.2232136, -0.8060896, 4.89 },
+    { 0.4662249, -0.5111044, -0.7220850, 4.89 },
+    { -0.2213831, 0.6691738, -0.7093630, 4.89 },
+    { -0.3806541, -0.6825204, -0.6239137, 4.89 },
+    { -0.5582675, 0.6670394, -0.4933516, 4.89 },
+    { -0.6138270, 0.6382777, -0.4645622, 4.89 },
+    { -0.8304465, 0.3136822, -0.4603935, 4.89 },
+    { 0.9626150, 0.0473541, -0.2667020, 4.89 },
+    { 0.7855596, 0.5810184, -0.2128703, 4.89 },
+    { 0.6311563, -0.7743787, -0.0444912, 4.89 },
+    { 0.6156701, 0.7014299, 0.3590911, 4.89 },
+    { 0.3493230, -0.7140280, 0.6067432, 4.89 },
+    { 0.6155076, 0.1331754, 0.7767977, 4.89 },
+    { -0.1158518, -0.4042119, 0.9072988, 4.89 },
+    { -0.4190903, 0.0149038, -0.9078222, 4.90 },
+    { 0.2695498, -0.6110296, -0.7443022, 4.90 },
+    { 0.5614534, -0.6128889, -0.5560011, 4.90 },
+    { 0.6898758, 0.5479914, -0.4730506, 4.90 },
+    { 0.9009650, 0.3531750, -0.2520506, 4.90 },
+    { 0.1867944, -0.9717984, -0.1439297, 4.90 },
+    { -0.0870110, 0.9948822, -0.0513667, 4.90 },
+    { 0.9489830, -0.2755778, 0.1532584, 4.90 },
+    { -0.9069505, -0.2147987, 0.3623567, 4.90 },
+    { -0.8295534, -0.2233460, 0.5118180, 4.90 },
+    { -0.3452184, 0.7474193, 0.5676167, 4.90 },
+    { 0.6303797, -0.4631580, 0.6229816, 4.90 },
+    { -0.2379510, 0.7361082, 0.6336592, 4.90 },
+    { -0.1756157, 0.6837508, 0.7082683, 4.90 },
+    { -0.2280766, -0.6161443, 0.7538881, 4.90 },
+    { -0.1287219, -0.0886585, -0.9877096, 4.91 },
+    { -0.2041218, 0.0003370, -0.9789454, 4.91 },
+    { -0.1324560, -0.3138282, -0.9401954, 4.91 },
+    { -0.7590838, 0.0447046, -0.6494562, 4.91 },
+    { -0.8088505, -0.1818627, -0.5591841, 4.91 },
+    { -0.5631265, -0.6399884, -0.5227842, 4.91 },
+    { 0.2374763, 0.9088699, -0.3428710, 4.91 },
+    { -0.8971812, 0.3328427, -0.2903130, 4.91 },
+    { -0.8075844, -0.5186674, -0.2806984, 4.91 },
+    { 0.6067788, -0.7932750, -0.0503421, 4.91 },
+    { 0.3750986, 0.9269846, -0.0007660, 4.91 },
+    { 0.0763595, 0.9967482, 0.0257354, 4.91 },
+    { 0.0444814, 0.9747073, 0.2190137, 4.91 },
+    { -0.2302692, -0.9478068, 0.2205409, 4.91 },
+    { -0.8271593, -0.4292770, 0.3626689, 4.91 },
+    { 0.5958771, -0.6802146, 0.4268941, 4.91 },
+    { 0.5803095, 0.4967196, 0.6453762, 4.91 },
+    { -0.0707214, 0.6484104, 0.7579990, 4.91 },
+    { 0.5173169, -0.0680299, 0.8530857, 4.91 },
+    { 0.3814325, -0.2277142, 0.8959104, 4.91 },
+    { -0.3569482, 0.3665035, -0.8592224, 4.92 },
+    { -0.4867806, -0.1634577, -0.8580945, 4.92 },
+    { -0.4250470, -0.3049124, -0.8522696, 4.92 },
+    { -0.6144544, -0.5387996, -0.5763166, 4.92 },
+    { 0.7479445, -0.3887464, -0.5380105, 4.92 },
+    { -0.4509572, -0.8257561, -0.3387689, 4.92 },
+    { -0.6963296, -0.7022684, -0.1481355, 4.92 },
+    { -0.3008313, 0.9508109, -0.0738856, 4.92 },
+    { 0.5500808, -0.6153399, 0.5645953, 4.92 },
+    { -0.7251289, -0.2416289, 0.6448283, 4.92 },
+    { 0.1457555, -0.6162666, 0.7739320, 4.92 },
+    { 0.2946823, -0.5336510, 0.7927036, 4.92 },
+    { -0.2671909, 0.1092656, -0.9574289, 4.93 },
+    { -0.4963124, -0.0918588, -0.8632705, 4.93 },
+    { -0.1784191, 0.6233006, -0.7613560, 4.93 },
+    { -0.1117629, 0.6568275, -0.7457122, 4.93 },
+    { -0.4746742, 0.5189479, -0.7108990, 4.93 },
+    { 0.3407529, 0.6605018, -0.6690477, 4.93 },
+    { 0.2280319, -0.7646945, -0.6026971, 4.93 },
+    { -0.0208548, 0.9586703, -0.2837541, 4.93 },
+    { -0.4979689, 0.8648168, -0.0641786, 4.93 },
+    { -0.6207758, -0.6616470, 0.4205481, 4.93 },
+    { 0.8694166, -0.0608273, 0.4903212, 4.93 },
+    { 0.2191959, -0.8178336, 0.5320728, 4.93 },
+    { 0.3466762, 0.7469353, 0.5673652, 4.93 },
+    { 0.5802902, 0.5755578, 0.5761914, 4.93 },
+    { 0.4283202, -0.6760531, 0.5995782, 4.93 },
+    { -0.5345477, -0.1450581, 0.8325965, 4.93 },
+    { -0.4664583, 0.0389786, -0.8836839, 4.94 },
+    { -0.2594581, -0.5174396, -0.8154372, 4.94 },
+    { 0.3184227, -0.5126297, -0.7973818, 4.94 },
+    { -0.2465940, 0.5560671, -0.7937133, 4.94 },
+    { -0.2631948, -0.6688707, -0.6952270, 4.94 },
+    { -0.5891975, 0.5139369, -0.6234703, 4.94 },
+    { -0.8635057, 0.2099745, -0.4585505, 4.94 },
+    { -0.6763119, -0.5983590, -0.4296147, 4.94 },
+    { -0.7539114, 0.5169874, -0.4053907, 4.94 },
+    { -0.8080111, 0.4909405, -0.3257231, 4.94 },
+    { -0.4091855, 0.8736482, -0.2632604, 4.94 },
+    { 0.9830354, 0.0193115, -0.1823966, 4.94 },
+    { -0.6184734, -0.7651039, -0.1791833, 4.94 },
+    { -0.4470048, -0.8772962, -0.1747515, 4.94 },
+    { -0.7336815, -0.6783082, -0.0401177, 4.94 },
+    { 0.9893719, -0.1437467, 0.0219128, 4.94 },
+    { -0.9149620, -0.3984620, 0.0638163, 4.94 },
+    { -0.7328489, -0.6189044, 0.2826479, 4.94 },
+    { 0.4057668, 0.8436863, 0.3514922, 4.94 },
+    { 0.1637726, 0.9119637, 0.3761659, 4.94 },
+    { -0.8642195, -0.1983230, 0.4623772, 4.94 },
+    { -0.4540226, 0.7592303, 0.4662970, 4.94 },
+    { 0.7233179, 0.4713976, 0.5045745, 4.94 },
+    { 0.2067277, 0.7616307, 0.6141517, 4.94 },
+    { 0.3790727, -0.6848399, 0.6223329, 4.94 },
+    { 0.6875568, 0.3227339, 0.6504679, 4.94 },
+    { 0.6958602, -0.2126357, 0.6859771, 4.94 },
+    { 0.6694586, 0.1285186, 0.7316476, 4.94 },
+    { -0.3377450, -0.0515815, 0.9398232, 4.94 },
+    { -0.1603471, 0.6399419, -0.7515073, 4.95 },
+    { -0.8782641, -0.2729387, -0.3926279, 4.95 },
+    { -0.0078915, 0.9829097, -0.1839189, 4.95 },
+    { 0.4072056, -0.9051051, -0.1223457, 4.95 },
+    { 0.0834739, 0.9963152, -0.0197016, 4.95 },
+    { 0.1531355, 0.9876798, 0.0322200, 4.95 },
+    { -0.9889996, 0.1392728, 0.0498279, 4.95 },
+    { 0.5336063, -0.8040791, 0.2621471, 4.95 },
+    { -0.0505051, 0.9593023, 0.2778279, 4.95 },
+    { 0.0820340, -0.9238009, 0.3739817, 4.95 },
+    { 0.4300724, -0.8168421, 0.3844564, 4.95 },
+    { -0.9116110, -0.0651119, 0.4058644, 4.95 },
+    { -0.8829793, -0.1021707, 0.4581579, 4.95 },
+    { 0.3741259, 0.8055726, 0.4594373, 4.95 },
+    { 0.6645396, 0.3162108, 0.6770508, 4.95 },
+    { 0.4640626, 0.5601670, 0.6861916, 4.95 },
+    { 0.6880835, -0.0419790, 0.7244162, 4.95 },
+    { 0.3999032, -0.5208895, 0.7541562, 4.95 },
+    { 0.6216397, -0.1769815, 0.7630476, 4.95 },
+    { -0.2933811, -0.4970203, 0.8166385, 4.95 },
+    { -0.3520284, -0.0465199, 0.9348326, 4.95 },
+    { -0.1064124, -0.2218641, 0.9692537, 4.95 },
+    { 0.0960951, -0.6890564, -0.7183085, 4.96 },
+    { 0.6631602, 0.2257092, -0.7136343, 4.96 },
+    { -0.5238047, -0.7500309, -0.4038345, 4.96 },
+    { -0.3319642, 0.8852263, -0.3258436, 4.96 },
+    { 0.3142898, -0.8920373, -0.3247943, 4.96 },
+    { -0.3196016, -0.8972133, -0.3047345, 4.96 },
+    { -0.9943963, -0.0885288, 0.0577818, 4.96 },
+    { 0.0061132, -0.9297846, 0.3680533, 4.96 },
+    { 0.2506590, -0.4525585, 0.8557809, 4.96 },
+    { -0.1322468, -0.1745682, 0.9757237, 4.96 },
+    { -0.0511077, 0.1217690, 0.9912418, 4.96 },
+    { -0.3379885, 0.0148409, -0.9410332, 4.97 },
+    { 0.2394171, 0.4201823, -0.8752864, 4.97 },
+    { 0.0156610, 0.7972110, -0.6034976, 4.97 },
+    { -0.6947580, -0.5243612, -0.4922974, 4.97 },
+    { -0.8490918, -0.3504610, -0.3952471, 4.97 },
+    { -0.8431987, -0.4383415, -0.3112436, 4.97 },
+    { -0.3852250, 0.8880931, -0.2507836, 4.97 },
+    { -0.7224312, 0.6857223, 0.0887586, 4.97 },
+    { -0.7830133, 0.5903366, 0.1959409, 4.97 },
+    { 0.3732150, 0.8839539, 0.2816665, 4.97 },
+    { -0.4243097, 0.7855895, 0.4503448, 4.97 },
+    { 0.3119821, -0.8113987, 0.4942664, 4.97 },
+    { 0.0443087, -0.8523517, 0.5210887, 4.97 },
+    { 0.4686459, 0.6842810, 0.5586864, 4.97 },
+    { 0.4434684, -0.6666330, 0.5991129, 4.97 },
+    { -0.3779742, 0.1680249, 0.9104412, 4.97 },
+    { -0.3061202, 0.8564716, -0.4156283, 4.98 },
+    { 0.0468171, -0.9144571, -0.4019655, 4.98 },
+    { -0.6276930, 0.7478886, -0.2160188, 4.98 },
+    { 0.9701999, -0.1756083, -0.1669547, 4.98 },
+    { 0.2422982, -0.9674311, 0.0732711, 4.98 },
+    { -0.8998172, -0.3655151, 0.2381756, 4.98 },
+    { -0.2382124, -0.9401986, 0.2434777, 4.98 },
+    { 0.7596408, 0.4812539, 0.4374249, 4.98 },
+    { 0.8487184, -0.0968749, 0.5198964, 4.98 },
+    { -0.7295261, -0.3202276, 0.6043558, 4.98 },
+    { 0.6485398, 0.3001827, 0.6994901, 4.98 },
+    { 0.4032843, 0.5164203, 0.7554283, 4.98 },
+    { 0.4946704, 0.1802450, 0.8501841, 4.98 },
+    { 0.0539416, -0.5152017, 0.8553698, 4.98 },
+    { -0.0372389, 0.4754679, 0.8789445, 4.98 },
+    { 0.4596446, -0.0710780, 0.8852541, 4.98 },
+    { -0.3576710, 0.1611785, -0.9198331, 4.99 },
+    { 0.3108020, 0.3075557, -0.8993395, 4.99 },
+    { -0.2788208, -0.5781532, -0.7668102, 4.99 },
+    { -0.4311911, 0.5646891, -0.7037048, 4.99 },
+    { -0.3744556, -0.6453541, -0.6658086, 4.99 },
+    { 0.2280319, -0.7646945, -0.6026971, 4.99 },
+    { -0.1817262, 0.8051842, -0.5644945, 4.99 },
+    { 0.7323522, -0.3876249, -0.5598278, 4.99 },
+    { 0.4375438, -0.7258485, -0.5307536, 4.99 },
+    { 0.2197828, -0.8961738, -0.3854453, 4.99 },
+    { -0.5287774, 0.8039682, -0.2720838, 4.99 },
+    { -0.2703341, 0.9599246, -0.0739204, 4.99 },
+    { 0.8993505, 0.4324650, -0.0643635, 4.99 },
+    { -0.9612877, 0.2542218, 0.1062882, 4.99 },
+    { -0.3602991, 0.9188044, 0.1611923, 4.99 },
+    { 0.1475491, 0.9428521, 0.2987627, 4.99 },
+    { -0.4289225, -0.7538385, 0.4977479, 4.99 },
+    { 0.3724815, -0.7436108, 0.5552481, 4.99 },
+    { 0.1220606, 0.7851357, 0.6071763, 4.99 },
+    { -0.7160574, 0.1171728, 0.6881369, 4.99 },
+    { -0.6880922, -0.1372758, 0.7125198, 4.99 },
+    { 0.0126675, 0.5632843, 0.8261660, 4.99 },
+    { 0.1693522, -0.5067282, 0.8453085, 4.99 },
+    { -0.2256498, 0.4677848, 0.8545523, 4.99 },
+    { 0.3179157, 0.1762235, 0.9315980, 4.99 },
+    { 0.4336617, -0.0045664, -0.9010642, 5.00 },
+    { -0.5695668, -0.0473144, -0.8205821, 5.00 },
+    { -0.4259025, -0.5172969, -0.7423011, 5.00 },
+    { -0.5247688, 0.4763608, -0.7054772, 5.00 },
+    { -0.7969455, 0.1290354, -0.5901083, 5.00 },
+    { 0.4799046, 0.6998889, -0.5290058, 5.00 },
+    { -0.4384962, -0.7857487, -0.4362570, 5.00 },
+    { 0.9655841, -0.0853898, -0.2456744, 5.00 },
+    { -0.2351429, 0.9411821, -0.2426604, 5.00 },
+    { 0.1611522, 0.9849914, 0.0618218, 5.00 },
+    { -0.8063402, 0.5793520, 0.1190245, 5.00 },
+    { -0.3022707, 0.9116910, 0.2783020, 5.00 },
+    { -0.4485685, -0.8443026, 0.2931542, 5.00 },
+    { -0.1638092, -0.9365295, 0.3099662, 5.00 },
+    { 0.2153601, 0.9227186, 0.3197036, 5.00 },
+    { 0.4324776, -0.8399022, 0.3279137, 5.00 },
+    { 0.3774273, -0.8620337, 0.3382995, 5.00 },
+    { -0.8862039, -0.1048434, 0.4512765, 5.00 },
+    { -0.8359150, -0.0602919, 0.5455373, 5.00 },
+    { 0.0236853, -0.7254479, 0.6878695, 5.00 },
+    { 0.5484132, -0.4665169, 0.6939777, 5.00 },
+    { 0.1432266, 0.6044402, 0.7836697, 5.00 },
+    { 0.5269062, -0.1409751, 0.8381503, 5.00 },
+    { 0.2467788, 0.4153683, 0.8755395, 5.00 },
+    { -0.1415252, -0.3333444, 0.9321224, 5.00 },
+    { -0.3371952, 0.1176411, 0.9340557, 5.00 },
+    { 0.2286106, 0.1643818, -0.9595394, 5.01 },
+    { -0.0202783, 0.4127753, -0.9106071, 5.01 },
+    { -0.5236418, -0.2490490, -0.8147232, 5.01 },
+    { -0.5033332, 0.3719482, -0.7799424, 5.01 },
+    { -0.4022042, 0.5023615, -0.7654180, 5.01 },
+    { -0.3867770, 0.7254224, -0.5693557, 5.01 },
+    { 0.7191094, -0.4681700, -0.5135159, 5.01 },
+    { 0.8684109, 0.0088354, -0.4957665, 5.01 },
+    { -0.7479600, 0.5574699, -0.3602542, 5.01 },
+    { -0.0667023, 0.9691808, -0.2371485, 5.01 },
+    { 0.3388257, 0.9171105, -0.2100129, 5.01 },
+    { -0.8929096, -0.4240475, -0.1513145, 5.01 },
+    { 0.3427306, -0.9346805, -0.0943829, 5.01 },
+    { -0.8373037, -0.5451194, 0.0420394, 5.01 },
+    { 0.8885390, -0.4071880, 0.2114153, 5.01 },
+    { -0.7747823, -0.4319914, 0.4616230, 5.01 },
+    { -0.3374811, 0.8166490, 0.4681783, 5.01 },
+    { 0.6090187, -0.6386393, 0.4703574, 5.01 },
+    { 0.6178226, -0.4449733, 0.6483008, 5.01 },
+    { 0.1808705, -0.6584412, 0.7305759, 5.01 },
+    { 0.2539567, -0.2259858, -0.9404448, 5.02 },
+    { -0.6333504, 0.2528467, -0.7313930, 5.02 },
+    { -0.0261365, 0.7955399, -0.6053372, 5.02 },
+    { 0.2238925, 0.8682779, -0.4426800, 5.02 },
+    { -0.3673394, -0.8406750, -0.3979037, 5.02 },
+    { 0.4743511, -0.8388397, -0.2670935, 5.02 },
+    { 0.1942443, -0.9802944, 0.0359460, 5.02 },
+    { -0.9378763, -0.1448976, 0.3152663, 5.02 },
+    { 0.1627275, 0.8257443, 0.5400612, 5.02 },
+    { -0.7720052, -0.0874414, 0.6295728, 5.02 },
+    { -0.4581598, -0.6021290, 0.6538580, 5.02 },
+    { -0.4554591, -0.6032264, 0.6547328, 5.02 },
+    { -0.1638271, 0.7274737, 0.6662903, 5.02 },
+    { -0.1332369, 0.7003917, 0.7012128, 5.02 },
+    { -0.0301383, -0.6315661, 0.7747361, 5.02 },
+    { -0.2035197, -0.2364013, 0.9501022, 5.02 },
+    { -0.4607192, 0.0331864, -0.8869253, 5.03 },
+    { 0.1542102, 0.6298103, -0.7612872, 5.03 },
+    { -0.5758505, -0.5410040, -0.6129526, 5.03 },
+    { -0.2641278, 0.7582035, -0.5961241, 5.03 },
+    { -0.2124362, -0.8196346, -0.5320432, 5.03 },
+    { 0.3307999, -0.8476364, -0.4148300, 5.03 },
+    { -0.4927842, -0.7989391, -0.3447608, 5.03 },
+    { 0.2879687, 0.9160115, -0.2792793, 5.03 },
+    { 0.0039944, 0.9861090, -0.1660512, 5.03 },
+    { 0.9337519, -0.3502452, -0.0737275, 5.03 },
+    { 0.3848988, -0.9216754, -0.0486561, 5.03 },
+    { -0.1763696, -0.9661093, 0.1884851, 5.03 },
+    { 0.3773669, 0.8981243, 0.2257588, 5.03 },
+    { 0.7856981, 0.4841456, 0.3850735, 5.03 },
+    { -0.3227201, 0.8465036, 0.4234187, 5.03 },
+    { 0.7212092, 0.5000876, 0.4793430, 5.03 },
+    { -0.8012575, 0.2307409, 0.5520372, 5.03 },
+    { 0.1439778, 0.8168546, 0.5585866, 5.03 },
+    { 0.6885678, 0.2105651, 0.6939284, 5.03 },
+    { 0.6930480, 0.0312338, 0.7202145, 5.03 },
+    { 0.4142282, 0.4898556, 0.7671092, 5.03 },
+    { 0.4130028, 0.4759568, 0.7764624, 5.03 },
+    { 0.2794266, -0.5331993, 0.7985106, 5.03 },
+    { 0.2308256, 0.3896261, 0.8915779, 5.03 },
+    { 0.0261867, -0.4313357, 0.9018114, 5.03 },
+    { 0.2501234, -0.1455023, 0.9572185, 5.03 },
+    { -0.2330690, -0.0048568, -0.9724481, 5.04 },
+    { 0.5319307, 0.2655157, -0.8040840, 5.04 },
+    { -0.8504032, 0.1010219, -0.5163419, 5.04 },
+    { -0.0127468, 0.8965165, -0.4428269, 5.04 },
+    { -0.9132244, -0.2969816, -0.2789678, 5.04 },
+    { -0.4316652, 0.8662755, -0.2514594, 5.04 },
+    { 0.9963899, -0.0592328, 0.0608167, 5.04 },
+    { -0.0700472, 0.9746349, 0.2125562, 5.04 },
+    { 0.5821931, -0.7029280, 0.4085871, 5.04 },
+    { -0.2666433, -0.8688302, 0.4171754, 5.04 },
+    { 0.7287983, -0.4649897, 0.5026306, 5.04 },
+    { 0.0263906, -0.8606759, 0.5084688, 5.04 },
+    { -0.2889891, -0.6861506, 0.6675947, 5.04 },
+    { 0.4856810, -0.5296487, 0.6954036, 5.04 },
+    { 0.5001151, 0.2954777, 0.8139888, 5.04 },
+    { 0.1046491, -0.5560782, 0.8245154, 5.04 },
+    { 0.4528734, -0.2319673, 0.8608698, 5.04 },
+    { 0.3772043, -0.0199117, 0.9259160, 5.04 },
+    { -0.0103806, -0.2253446, 0.9742238, 5.04 },
+    { -0.2429349, -0.0946167, -0.9654172, 5.05 },
+    { -0.0143799, 0.4668646, -0.8842119, 5.05 },
+    { 0.2057701, -0.5441836, -0.8133406, 5.05 },
+    { 0.4225557, -0.4551155, -0.7837835, 5.05 },
+    { -0.3695016, 0.5990153, -0.7103867, 5.05 },
+    { 0.2658917, 0.7514627, -0.6038257, 5.05 },
+    { -0.5904830, 0.7091401, -0.3852923, 5.05 },
+    { -0.8407354, 0.5227681, -0.1409876, 5.05 },
+    { -0.0514020, 0.9921414, -0.1140755, 5.05 },
+    { 0.9807250, -0.1714145, 0.0937849, 5.05 },
+    { 0.6299862, -0.7566027, 0.1751281, 5.05 },
+    { -0.4006966, 0.8644431, 0.3036123, 5.05 },
+    { -0.3351704, 0.8158100, 0.4712907, 5.05 },
+    { -0.7347980, 0.1987218, 0.6485226, 5.05 },
+    { 0.0614337, -0.6515648, 0.7561013, 5.05 },
+    { -0.2183659, 0.6121295, 0.7600091, 5.05 },
+    { 0.3239839, -0.5535444, 0.7672177, 5.05 },
+    { 0.2056703, 0.5643975, 0.7994718, 5.05 },
+    { -0.0454434, -0.3696380, 0.9280639, 5.05 },
+    { 0.0303898, 0.1843600, 0.9823889, 5.05 },
+    { -0.1396809, -0.0999817, -0.9851360, 5.06 },
+    { -0.0137555, 0.3606576, -0.9325969, 5.06 },
+    { -0.5799478, -0.2385045, -0.7789584, 5.06 },
+    { -0.3061388, 0.6350231, -0.7092424, 5.06 },
+    { -0.2087639, 0.8011941, -0.5608080, 5.06 },
+    { 0.1507576, 0.8953711, -0.4190260, 5.06 },
+    { 0.4155363, -0.8661431, -0.2777152, 5.06 },
+    { -0.7944007, 0.5546618, -0.2475435, 5.06 },
+    { 0.9734079, -0.1854747, -0.1344479, 5.06 },
+    { -0.1212760, 0.9891409, -0.0830203, 5.06 },
+    { 0.6664745, 0.7452355, -0.0208746, 5.06 },
+    { -0.6447743, -0.7637520, 0.0308055, 5.06 },
+    { 0.9811991, -0.0713094, 0.1793412, 5.06 },
+    { 0.9445136, 0.1161739, 0.3072422, 5.06 },
+    { 0.0243611, -0.9254254, 0.3781460, 5.06 },
+    { 0.1479929, -0.7553730, 0.6383649, 5.06 },
+    { 0.2984020, -0.6338721, 0.7135562, 5.06 },
+    { 0.2476787, 0.4489153, 0.8585629, 5.06 },
+    { 0.2542876, 0.0547351, -0.9655785, 5.07 },
+    { -0.2343329, 0.3399540, -0.9107796, 5.07 },
+    { -0.4518718, -0.3017885, -0.8394853, 5.07 },
+    { 0.0972011, -0.6908965, -0.7163896, 5.07 },
+    { 0.2684324, 0.6547892, -0.7065375, 5.07 },
+    { 0.1723696, 0.8746321, -0.4531086, 5.07 },
+    { -0.1731114, -0.8772257, -0.4477808, 5.07 },
+    { -0.4739112, -0.8582083, -0.1971973, 5.07 },
+    { -0.2037437, 0.9664501, -0.1564053, 5.07 },
+    { -0.7870771, 0.5933205, 0.1687613, 5.07 },
+    { 0.5333951, 0.8234919, 0.1932636, 5.07 },
+    { 0.3324372, 0.9029683, 0.2722751, 5.07 },
+    { 0.9348456, 0.2028823, 0.2913803, 5.07 },
+    { 0.4817759, -0.7793769, 0.4005791, 5.07 },
+    { 0.1159820, 0.8161656, 0.5660582, 5.07 },
+    { -0.4620447, -0.6560733, 0.5967265, 5.07 },
+    { 0.0394002, 0.1479343, 0.9882121, 5.07 },
+    { -0.0220753, 0.0470677, 0.9986477, 5.07 },
+    { -0.4731868, 0.1808384, -0.8622017, 5.08 },
+    { -0.5954542, 0.3226719, -0.7357426, 5.08 },
+    { -0.5886127, 0.3751622, -0.7160925, 5.08 },
+    { -0.1520832, -0.6961275, -0.7016247, 5.08 },
+    { -0.7283237, 0.1004636, -0.6778286, 5.08 },
+    { -0.3534666, 0.6981031, -0.6226664, 5.08 },
+    { -0.4446146, 0.6719103, -0.5923296, 5.08 },
+    { -0.7438939, -0.4866368, -0.4580463, 5.08 },
+    { -0.8516748, 0.3354185, -0.4026717, 5.08 },
+    { 0.2316806, -0.9065774, -0.3527627, 5.08 },
+    { 0.8273394, -0.5104924, -0.2343226, 5.08 },
+    { 0.9571004, -0.1725904, -0.2327476, 5.08 },
+    { 0.1067326, 0.9897975, -0.0943883, 5.08 },
+    { 0.1543396, 0.9878954, -0.0155570, 5.08 },
+    { -0.9248382, 0.3605793, 0.1210657, 5.08 },
+    { 0.9643420, -0.1567212, 0.2132672, 5.08 },
+    { 0.9443254, -0.0309621, 0.3275528, 5.08 },
+    { -0.8683712, 0.3014780, 0.3937543, 5.08 },
+    { 0.7649092, -0.4730487, 0.4371943, 5.08 },
+    { -0.7491389, 0.1977912, 0.6321942, 5.08 },
+    { -0.1653346, -0.7389856, 0.6531192, 5.08 },
+    { 0.7047472, -0.2423487, 0.6667822, 5.08 },
+    { -0.2154879, -0.5630411, 0.7978406, 5.08 },
+    { 0.5781393, 0.0919260, 0.8107432, 5.08 },
+    { 0.1200194, 0.5012818, 0.8569200, 5.08 },
+    { 0.2628124, -0.1011891, 0.9595261, 5.08 },
+    { -0.0117461, 0.2627164, -0.9648016, 5.09 },
+    { -0.1885905, -0.3123008, -0.9310756, 5.09 },
+    { 0.4488898, 0.0645461, -0.8912529, 5.09 },
+    { -0.3169756, -0.3676903, -0.8742599, 5.09 },
+    { -0.3606173, 0.4802608, -0.7995653, 5.09 },
+    { -0.3516726, 0.6259893, -0.6960343, 5.09 },
+    { -0.7151289, -0.2821655, -0.6395102, 5.09 },
+    { -0.9346914, 0.1506972, -0.3219352, 5.09 },
+    { 0.8210571, -0.5485860, -0.1578565, 5.09 },
+    { -0.9243087, 0.3814838, -0.0111156, 5.09 },
+    { 0.2827376, -0.9397783, 0.1920319, 5.09 },
+    { 0.5924764, 0.7235630, 0.3541587, 5.09 },
+    { 0.4930526, 0.7679113, 0.4089150, 5.09 },
+    { -0.5833389, 0.3766932, 0.7195957, 5.09 },
+    { 0.3452212, 0.4499139, 0.8236503, 5.09 },
+    { 0.1505324, -0.0701743, -0.9861113, 5.10 },
+    { -0.2314871, 0.5849319, -0.7773470, 5.10 },
+    { -0.4660302, 0.5061018, -0.7257250, 5.10 },
+    { -0.2244200, 0.6752215, -0.7026462, 5.10 },
+    { 0.6724623, -0.3263737, -0.6642851, 5.10 },
+    { 0.0758973, -0.7772036, -0.6246553, 5.10 },
+    { -0.8050563, -0.2806858, -0.5225895, 5.10 },
+    { 0.6110038, -0.7278435, -0.3113169, 5.10 },
+    { 0.2277767, -0.9358268, -0.2689721, 5.10 },
+    { 0.9985727, 0.0079439, -0.0528153, 5.10 },
+    { -0.1461866, 0.9890278, -0.0212967, 5.10 },
+    { 0.3359735, -0.9416810, 0.0189410, 5.10 },
+    { 0.8174101, -0.5747244, 0.0391484, 5.10 },
+    { -0.8043660, -0.5854166, 0.1014036, 5.10 },
+    { -0.9640261, -0.0674247, 0.2571141, 5.10 },
+    { 0.8299328, 0.4664590, 0.3059861, 5.10 },
+    { 0.2791746, 0.9043137, 0.3229215, 5.10 },
+    { 0.4880698, -0.8030627, 0.3418744, 5.10 },
+    { 0.0363969, -0.9387165, 0.3427631, 5.10 },
+    { -0.3279464, 0.8777533, 0.3492854, 5.10 },
+    { 0.7113258, -0.1819599, 0.6789008, 5.10 },
+    { -0.5553248, 0.1656150, 0.8149761, 5.10 },
+    { 0.2549816, 0.3715380, 0.8927172, 5.10 },
+    { 0.0746021, 0.1433808, 0.9868518, 5.10 },
+    { 0.1387643, -0.0047810, -0.9903139, 5.11 },
+    { -0.1265168, 0.0937142, -0.9875278, 5.11 },
+    { 0.0172954, 0.3919379, -0.9198291, 5.11 },
+    { -0.4179324, 0.0673850, -0.9059756, 5.11 },
+    { -0.3280049, -0.3187848, -0.8892632, 5.11 },
+    { 0.3506899, 0.3619255, -0.8637283, 5.11 },
+    { -0.4673269, 0.3707254, -0.8026009, 5.11 },
+    { 0.4436873, -0.5581995, -0.7011098, 5.11 },
+    { 0.4825593, -0.5336524, -0.6945154, 5.11 },
+    { 0.6474002, 0.3528525, -0.6755502, 5.11 },
+    { -0.2695870, 0.7546197, -0.5982240, 5.11 },
+    { 0.7968081, -0.2005257, -0.5699880, 5.11 },
+    { 0.4304766, 0.7000605, -0.5697414, 5.11 },
+    { -0.8919060, 0.0438100, -0.4500937, 5.11 },
+    { -0.1730971, -0.8772172, -0.4478029, 5.11 },
+    { -0.4560429, 0.7971411, -0.3957156, 5.11 },
+    { 0.3619493, 0.9211378, -0.1431712, 5.11 },
+    { -0.5318800, -0.8451017, -0.0539152, 5.11 },
+    { 0.4580441, -0.8703514, 0.1807871, 5.11 },
+    { 0.3406851, -0.8148816, 0.4689368, 5.11 },
+    { 0.6071486, 0.5929485, 0.5289449, 5.11 },
+    { 0.4515576, 0.7056953, 0.5459761, 5.11 },
+    { -0.4587851, -0.6271374, 0.6294560, 5.11 },
+    { 0.5967497, -0.4171305, 0.6854866, 5.11 },
+    { 0.4079551, -0.2234685, 0.8852313, 5.11 },
+    { 0.3161172, -0.3765898, -0.8707756, 5.12 },
+    { -0.5268844, 0.3907938, -0.7547668, 5.12 },
+    { -0.5412434, 0.4689011, -0.6979880, 5.12 },
+    { -0.1115505, -0.7086406, -0.6966957, 5.12 },
+    { -0.4243857, -0.7125615, -0.5587065, 5.12 },
+    { 0.8594439, 0.3542445, -0.3686014, 5.12 },
+    { 0.9351117, 0.0891008, -0.3429680, 5.12 },
+    { 0.3964028, -0.8995981, -0.1832703, 5.12 },
+    { 0.9888223, 0.0624713, -0.1353803, 5.12 },
+    { 0.2294531, 0.9699304, -0.0811557, 5.12 },
+    { 0.2211892, 0.9721311, -0.0776954, 5.12 },
+    { -0.8018157, -0.5792367, 0.1468892, 5.12 },
+    { 0.9646760, -0.2159614, 0.1508674, 5.12 },
+    { 0.4017357, 0.9008829, 0.1643729, 5.12 },
+    { -0.5055085, 0.8324366, 0.2269592, 5.12 },
+    { -0.9386522, -0.1937243, 0.2853120, 5.12 },
+    { -0.4715540, -0.8270436, 0.3059995, 5.12 },
+    { -0.1544811, -0.8967570, 0.4146835, 5.12 },
+    { -0.0439673, -0.9005879, 0.4324447, 5.12 },
+    { -0.6694805, -0.5870506, 0.4551564, 5.12 },
+    { 0.0801936, -0.8720379, 0.4828239, 5.12 },
+    { 0.3619597, -0.6911393, 0.6255491, 5.12 },
+    { 0.0814184, -0.7672368, 0.6361751, 5.12 },
+    { 0.1682020, -0.5201800, 0.8373296, 5.12 },
+    { -0.3876307, 0.1373754, 0.9115209, 5.12 },
+    { -0.0836303, 0.3503438, 0.9328800, 5.12 },
+    { -0.1223476, -0.3692252, -0.9212512, 5.13 },
+    { -0.4584920, 0.1046575, -0.8825145, 5.13 },
+    { -0.5045549, 0.0624693, -0.8611167, 5.13 },
+    { 0.2580513, -0.4392017, -0.8605297, 5.13 },
+    { 0.6053457, -0.0028262, -0.7959577, 5.13 },
+    { -0.3754918, 0.5694461, -0.7312571, 5.13 },
+    { -0.7452943, -0.1172375, -0.6563473, 5.13 },
+    { 0.1489599, -0.7702493, -0.6201024, 5.13 },
+    { -0.3987297, -0.7744569, -0.4911529, 5.13 },
+    { 0.8453847, -0.3870778, -0.3680971, 5.13 },
+    { 0.9387210, 0.3159145, -0.1378441, 5.13 },
+    { 0.1071987, 0.9897908, -0.0939292, 5.13 },
+    { -0.4107662, 0.9089178, -0.0716909, 5.13 },
+    { -0.5893444, 0.7970847, 0.1316403, 5.13 },
+    { -0.2691064, 0.9441869, 0.1899813, 5.13 },
+    { -0.2807075, 0.7503555, 0.5984730, 5.13 },
+    { 0.7042244, 0.1139864, 0.7007675, 5.13 },
+    { -0.3587257, 0.3164174, 0.8781776, 5.13 },
+    { -0.2544064, -0.2891731, 0.9228523, 5.13 },
+    { 0.0690792, -0.2219134, 0.9726163, 5.13 },
+    { 0.1257035, -0.4808041, -0.8677708, 5.14 },
+    { 0.0756040, 0.5107815, -0.8563798, 5.14 },
+    { -0.1637188, 0.6019795, -0.7815477, 5.14 },
+    { -0.1997123, 0.6258599, -0.7539327, 5.14 },
+    { -0.2988561, -0.6077250, -0.7357685, 5.14 },
+    { -0.1484093, 0.6706772, -0.7267509, 5.14 },
+    { 0.6127624, 0.3598896, -0.7035635, 5.14 },
+    { 0.6635057, 0.5001160, -0.5564568, 5.14 },
+    { 0.1297527, -0.9399471, -0.3156955, 5.14 },
+    { -0.0738348, 0.9543879, -0.2892959, 5.14 },
+    { -0.9680517, -0.0886462, -0.2345587, 5.14 },
+    { 0.1495093, -0.9702514, -0.1904183, 5.14 },
+    { -0.8196563, -0.5714900, -0.0395321, 5.14 },
+    { -0.4680927, 0.8831413, 0.0308331, 5.14 },
+    { 0.5954976, 0.7789373, 0.1965689, 5.14 },
+    { 0.6385762, -0.7176978, 0.2777236, 5.14 },
+    { -0.0141925, 0.9414188, 0.3369410, 5.14 },
+    { -0.6816157, 0.6281055, 0.3753446, 5.14 },
+    { -0.5102739, 0.7283058, 0.4573743, 5.14 },
+    { -0.3773382, 0.7445377, 0.5507082, 5.14 },
+    { 0.1482522, -0.7559677, 0.6376003, 5.14 },
+    { -0.6492039, 0.3836138, 0.6567912, 5.14 },
+    { 0.6213103, -0.3372275, 0.7072843, 5.14 },
+    { 0.2547483, -0.4726741, 0.8436128, 5.14 },
+    { -0.2877097, 0.2673723, 0.9196386, 5.14 },
+    { -0.0841229, 0.3721342, 0.9243590, 5.14 },
+    { -0.2141523, -0.0114091, 0.9767337, 5.14 },
+    { 0.1620111, -0.1554759, -0.9744638, 5.15 },
+    { -0.3805508, -0.0368468, -0.9240257, 5.15 },
+    { 0.2561898, -0.3000879, -0.9188656, 5.15 },
+    { -0.4699951, 0.0450036, -0.8815210, 5.15 },
+    { -0.4780636, 0.0481174, -0.8770062, 5.15 },
+    { -0.5034687, 0.0622349, -0.8617691, 5.15 },
+    { -0.0427148, -0.6164612, -0.7862258, 5.15 },
+    { -0.7162606, 0.1677441, -0.6773719, 5.15 },
+    { -0.7379587, -0.0117860, -0.6747430, 5.15 },
+    { -0.5206021, -0.5453425, -0.6569437, 5.15 },
+    { -0.7202156, -0.3627821, -0.5913362, 5.15 },
+    { -0.5230423, -0.7108758, -0.4701940, 5.15 },
+    { -0.7879770, -0.4481715, -0.4221784, 5.15 },
+    { -0.7067770, -0.6515492, -0.2755903, 5.15 },
+    { -0.1333272, 0.9675605, -0.2145937, 5.15 },
+    { -0.8770502, -0.4796820, -0.0262312, 5.15 },
+    { 0.3158581, -0.9479620, 0.0400204, 5.15 },
+    { -0.3144401, -0.9374736, 0.1492333, 5.15 },
+    { 0.5111307, -0.7613374, 0.3988869, 5.15 },
+    { 0.6360982, 0.4974357, 0.5898617, 5.15 },
+    { 0.2958023, -0.7494830, 0.5922636, 5.15 },
+    { -0.4927202, 0.5286235, 0.6912192, 5.15 },
+    { -0.6096900, -0.2166263, 0.7624638, 5.15 },
+    { 0.4141857, 0.4876573, 0.7685314, 5.15 },
+    { -0.3582878, 0.1795932, -0.9161747, 5.16 },
+    { -0.2533886, 0.3782746, -0.8903384, 5.16 },
+    { -0.3623523, 0.3642493, -0.8579180, 5.16 },
+    { 0.4175561, -0.3988969, -0.8164118, 5.16 },
+    { 0.1743706, -0.5855520, -0.7916589, 5.16 },
+    { -0.6072928, -0.1544391, -0.7793228, 5.16 },
+    { -0.4225609, 0.4875095, -0.7640529, 5.16 },
+    { -0.4912617, -0.5654649, -0.6625038, 5.16 },
+    { 0.1082598, -0.7617012, -0.6388200, 5.16 },
+    { -0.0034418, -0.8638013, -0.5038209, 5.16 },
+    { 0.6408076, -0.7676546, 0.0084890, 5.16 },
+    { 0.9410569, 0.3323218, 0.0630412, 5.16 },
+    { 0.7686345, -0.6285984, 0.1185965, 5.16 },
+    { 0.9666046, -0.2066185, 0.1516059, 5.16 },
+    { 0.9427523, -0.2864226, 0.1708219, 5.16 },
+    { 0.3544715, -0.9118753, 0.2069622, 5.16 },
+    { 0.3428377, -0.8762045, 0.3387151, 5.16 },
+    { 0.8125757, 0.2605500, 0.5213775, 5.16 },
+    { -0.0223833, -0.7656263, 0.6428960, 5.16 },
+    { -0.5066165, 0.1966011, 0.8394568, 5.16 },
+    { 0.2279129, 0.1879323, 0.9553728, 5.16 },
+    { -0.0970557, 0.3632202, -0.9266344, 5.17 },
+    { -0.4146496, 0.0372071, -0.9092202, 5.17 },
+    { -0.3030671, -0.3160441, -0.8990364, 5.17 },
+    { -0.4338983, 0.0653886, -0.8985859, 5.17 },
+    { -0.2448587, 0.4257070, -0.8711015, 5.17 },
+    { -0.5268523, -0.1279778, -0.8402668, 5.17 },
+    { -0.1518322, 0.5268561, -0.8362832, 5.17 },
+    { 0.0244149, 0.6136773, -0.7891794, 5.17 },
+    { 0.1398837, -0.5980401, -0.7891645, 5.17 },
+    { -0.3673791, 0.4986797, -0.7850804, 5.17 },
+    { -0.3443032, 0.6094025, -0.7142016, 5.17 },
+    { -0.3302805, 0.6794437, -0.6551878, 5.17 },
+    { 0.0516045, 0.8436254, -0.5344466, 5.17 },
+    { -0.4548734, 0.8575524, -0.2401960, 5.17 },
+    { -0.5856633, -0.7946876, -0.1595936, 5.17 },
+    { 0.4071403, 0.9110265, -0.0653267, 5.17 },
+    { 0.7159430, 0.6951502, -0.0647447, 5.17 },
+    { -0.6131524, -0.7893103, 0.0321468, 5.17 },
+    { 0.4175651, -0.9037645, 0.0940702, 5.17 },
+    { 0.6736482, -0.6999528, 0.2372008, 5.17 },
+    { -0.6007733, -0.7538567, 0.2660291, 5.17 },
+    { 0.4659884, -0.6739042, 0.5733306, 5.17 },
+    { 0.7091280, 0.0877872, 0.6995934, 5.17 },
+    { 0.2909219, -0.6486043, 0.7033327, 5.17 },
+    { 0.5494023, 0.1686854, 0.8183534, 5.17 },
+    { 0.4565565, 0.3267323, 0.8275278, 5.17 },
+    { -0.2519283, 0.1716072, 0.9524091, 5.17 },
+    { 0.2510814, -0.1708481, 0.9527692, 5.17 },
+    { -0.2524811, -0.0086293, -0.9675633, 5.18 },
+    { 0.6387645, -0.0355256, -0.7685817, 5.18 },
+    { -0.4777537, 0.4824813, -0.7341412, 5.18 },
+    { 0.6138927, -0.5804703, -0.5349673, 5.18 },
+    { 0.8709210, 0.0820196, -0.4845302, 5.18 },
+    { 0.9453621, -0.0356775, -0.3240642, 5.18 },
+    { -0.4398729, 0.8478144, -0.2961799, 5.18 },
+    { -0.9553875, 0.0166131, -0.2948877, 5.18 },
+    { 0.7983961, -0.5510423, -0.2427262, 5.18 },
+    { -0.9820806, 0.1851667, 0.0350846, 5.18 },
+    { 0.7342842, 0.6437232, 0.2155161, 5.18 },
+    { 0.2010702, 0.9397725, 0.2764025, 5.18 },
+    { 0.0060788, -0.9297868, 0.3680484, 5.18 },
+    { -0.2453082, 0.8784004, 0.4101667, 5.18 },
+    { 0.0794327, 0.8960677, 0.4367529, 5.18 },
+    { -0.8929916, -0.0950720, 0.4399174, 5.18 },
+    { 0.3171647, -0.8388171, 0.4424843, 5.18 },
+    { 0.4849250, -0.7309659, 0.4801423, 5.18 },
+    { -0.3559363, 0.7088186, 0.6090037, 5.18 },
+    { 0.7850023, 0.0725519, 0.6152297, 5.18 },
+    { -0.6539426, 0.2266130, 0.7218072, 5.18 },
+    { 0.3245444, -0.2738489, 0.9053606, 5.18 },
+    { 0.2988863, 0.1440558, 0.9433530, 5.18 },
+    { 0.0288994, 0.2343659, -0.9717188, 5.19 },
+    { -0.3862659, 0.4604970, -0.7992128, 5.19 },
+    { 0.9070188, 0.1209349, -0.4033506, 5.19 },
+    { -0.9396814, -0.2868270, -0.1863578, 5.19 },
+    { 0.9593786, 0.2132462, -0.1847128, 5.19 },
+    { -0.1796538, 0.9707435, -0.1593160, 5.19 },
+    { 0.2751794, 0.9407609, 0.1981041, 5.19 },
+    { 0.3988515, -0.6913883, 0.6024115, 5.19 },
+    { -0.2722421, 0.7079066, 0.6517304, 5.19 },
+    { 0.5192691, 0.3787090, 0.7661195, 5.19 },
+    { 0.2583920, 0.5340237, 0.8050169, 5.19 },
+    { -0.2528888, -0.3844994, 0.8878105, 5.19 },
+    { 0.4171462, -0.1546175, 0.8955906, 5.19 },
+    { -0.2147364, 0.2579936, -0.9419807, 5.20 },
+    { 0.1015494, 0.4360965, -0.8941518, 5.20 },
+    { -0.1802383, -0.4395929, -0.8799274, 5.20 },
+    { -0.3590661, -0.3454671, -0.8670202, 5.20 },
+    { -0.2038947, 0.7105173, -0.6734925, 5.20 },
+    { -0.4913134, 0.5838584, -0.6463130, 5.20 },
+    { -0.4650378, 0.6558858, -0.5946037, 5.20 },
+    { -0.1651695, 0.8404558, -0.5160941, 5.20 },
+    { -0.1660616, -0.8962428, -0.4113058, 5.20 },
+    { 0.7435277, 0.5330164, -0.4038070, 5.20 },
+    { 0.8713388, -0.3401888, -0.3536104, 5.20 },
+    { -0.6589244, -0.6981760, -0.2799444, 5.20 },
+    { 0.9529543, -0.1566792, -0.2594797, 5.20 },
+    { -0.2656557, 0.9588983, -0.0997052, 5.20 },
+    { 0.2046865, -0.9737668, -0.0994066, 5.20 },
+    { 0.9862539, 0.1528932, -0.0626652, 5.20 },
+    { -0.1185323, 0.9929365, 0.0052219, 5.20 },
+    { -0.5161940, -0.8157118, 0.2610708, 5.20 },
+    { -0.6737338, 0.6901094, 0.2642570, 5.20 },
+    { -0.0611577, 0.9426446, 0.3281477, 5.20 },
+    { 0.4207962, 0.7799278, 0.4632960, 5.20 },
+    { -0.5957159, 0.5980955, 0.5361010, 5.20 },
+    { -0.3434291, -0.7567064, 0.5562839, 5.20 },
+    { -0.1293205, 0.7561585, 0.6414831, 5.20 },
+    { -0.4532913, 0.2985265, 0.8398863, 5.20 },
+    { -0.1643877, 0.4779913, 0.8628447, 5.20 },
+    { 0.0110249, 0.5015662, 0.8650490, 5.20 },
+    { -0.3511757, 0.0368375, 0.9355847, 5.20 },
+    { 0.1593746, -0.2048974, 0.9657209, 5.20 },
+    { 0.4432244, 0.3740898, -0.8146220, 5.21 },
+    { -0.4553339, -0.4064784, -0.7921151, 5.21 },
+    { -0.3846385, 0.6061030, -0.6961986, 5.21 },
+    { 0.7165673, 0.2183873, -0.6624486, 5.21 },
+    { -0.5676191, 0.6202168, -0.5414237, 5.21 },
+    { -0.9220430, -0.0829458, -0.3780962, 5.21 },
+    { -0.9044232, -0.3884228, -0.1764835, 5.21 },
+    { -0.0183085, 0.9929831, -0.1168301, 5.21 },
+    { -0.9219515, 0.3843457, -0.0477898, 5.21 },
+    { 0.1184394, -0.9929554, 0.0034228, 5.21 },
+    { -0.1753164, 0.9366858, 0.3031235, 5.21 },
+    { 0.5678687, -0.5346180, 0.6258664, 5.21 },
+    { -0.7307795, -0.0067383, 0.6825803, 5.21 },
+    { 0.5134713, -0.1903676, 0.8367242, 5.21 },
+    { -0.0611384, 0.5201495, 0.8518841, 5.21 },
+    { -0.0701290, 0.5422759, -0.8372686, 5.22 },
+    { 0.6141655, 0.1380895, -0.7770019, 5.22 },
+    { -0.2212570, -0.7187795, -0.6590914, 5.22 },
+    { -0.7992220, 0.1212634, -0.5886760, 5.22 },
+    { -0.8407168, 0.0671508, -0.5372951, 5.22 },
+    { -0.8888442, -0.3059668, -0.3410870, 5.22 },
+    { 0.6186662, -0.7420644, -0.2580552, 5.22 },
+    { -0.4372882, -0.8756129, -0.2051367, 5.22 },
+    { -0.1031489, 0.9743746, -0.1998862, 5.22 },
+    { 0.0051186, 0.9999403, 0.0096535, 5.22 },
+    { 0.2948703, -0.9496619, 0.1058008, 5.22 },
+    { -0.9714777, -0.1959651, 0.1335245, 5.22 },
+    { -0.9316654, -0.3243270, 0.1637426, 5.22 },
+    { 0.4370767, 0.8824647, 0.1738392, 5.22 },
+    { 0.7052807, 0.6422719, 0.3001097, 5.22 },
+    { -0.9094434, -0.2866955, 0.3011950, 5.22 },
+    { -0.9094434, -0.2866955, 0.3011950, 5.22 },
+    { -0.3476929, 0.8633889, 0.3656079, 5.22 },
+    { 0.4602964, -0.7812476, 0.4216391, 5.22 },
+    { -0.6128202, 0.6364715, 0.4683539, 5.22 },
+    { 0.2067672, -0.8137486, 0.5431948, 5.22 },
+    { 0.7684735, -0.0967742, 0.6325213, 5.22 },
+    { -0.1360220, 0.6446343, 0.7522929, 5.22 },
+    { 0.2048735, 0.1249572, 0.9707793, 5.22 },
+    { -0.4120929, 0.1368957, -0.9007991, 5.23 },
+    { -0.4264814, 0.0891876, -0.9000884, 5.23 },
+    { -0.3938835, -0.2754375, -0.8769207, 5.23 },
+    { -0.5205826, 0.1717674, -0.8363550, 5.23 },
+    { -0.4367894, 0.4301950, -0.7900299, 5.23 },
+    { -0.0937521, -0.6273101, -0.7731058, 5.23 },
+    { -0.3592684, 0.5654617, -0.7424145, 5.23 },
+    { -0.3106119, 0.6127475, -0.7266779, 5.23 },
+    { -0.4558044, 0.5339220, -0.7121585, 5.23 },
+    { -0.6995927, 0.4085155, -0.5862467, 5.23 },
+    { 0.5597059, 0.7724225, -0.3001546, 5.23 },
+    { -0.3883957, -0.9119571, -0.1322237, 5.23 },
+    { 0.7102679, 0.7022556, -0.0485447, 5.23 },
+    { 0.3515071, 0.9351901, -0.0431539, 5.23 },
+    { -0.5358319, -0.8434544, 0.0383248, 5.23 },
+    { 0.8605234, 0.5071239, 0.0482154, 5.23 },
+    { 0.7022650, -0.7079681, 0.0748675, 5.23 },
+    { -0.1355313, 0.9703507, 0.2001271, 5.23 },
+    { 0.2478285, -0.9397391, 0.2355238, 5.23 },
+    { 0.8224678, 0.3039267, 0.4808068, 5.23 },
+    { 0.4139411, 0.7704491, 0.4848308, 5.23 },
+    { 0.8606964, 0.1137777, 0.4962422, 5.23 },
+    { 0.2445613, -0.8071382, 0.5373246, 5.23 },
+    { 0.1236502, 0.7350979, 0.6665896, 5.23 },
+    { -0.0513365, -0.4685930, 0.8819213, 5.23 },
+    { 0.2690917, 0.3343096, 0.9032313, 5.23 },
+    { 0.1859693, 0.4075461, -0.8940478, 5.24 },
+    { 0.2994883, 0.3513221, -0.8870623, 5.24 },
+    { -0.4186559, -0.5426808, -0.7281653, 5.24 },
+    { 0.1574836, -0.7450062, -0.6482011, 5.24 },
+    { -0.3853940, 0.6710798, -0.6333430, 5.24 },
+    { -0.1113361, 0.7833867, -0.6114814, 5.24 },
+    { -0.4479866, -0.6557297, -0.6077224, 5.24 },
+    { -0.6680993, -0.6002243, -0.4397432, 5.24 },
+    { 0.4991730, 0.7661682, -0.4047378, 5.24 },
+    { 0.7571571, -0.5203156, -0.3949492, 5.24 },
+    { 0.9095337, 0.1798451, -0.3747055, 5.24 },
+    { 0.7052257, -0.6150360, -0.3526861, 5.24 },
+    { 0.2016388, -0.9158039, -0.3473398, 5.24 },
+    { -0.8996046, 0.2686469, -0.3442970, 5.24 },
+    { 0.9472969, -0.0654039, -0.3136095, 5.24 },
+    { 0.0133091, -0.9897350, -0.1422940, 5.24 },
+    { -0.8929604, 0.4276912, -0.1403636, 5.24 },
+    { -0.7520491, 0.6497519, -0.1106556, 5.24 },
+    { -0.3086595, -0.9467668, 0.0914442, 5.24 },
+    { 0.9404147, 0.3134345, 0.1318292, 5.24 },
+    { -0.7179722, 0.6710042, 0.1851197, 5.24 },
+    { 0.8458187, 0.4056879, 0.3464218, 5.24 },
+    { -0.8154076, 0.2733664, 0.5102757, 5.24 },
+    { -0.4430028, -0.6200754, 0.6474991, 5.24 },
+    { 0.4286050, -0.6299534, 0.6476546, 5.24 },
+    { 0.5446939, -0.4200390, 0.7258621, 5.24 },
+    { 0.4871671, -0.2487245, 0.8371405, 5.24 },
+    { -0.4035502, -0.0996347, 0.9095164, 5.24 },
+    { 0.3756758, -0.0944533, 0.9219253, 5.24 },
+    { -0.2945781, -0.1914234, 0.9362590, 5.24 },
+    { -0.5178226, 0.1570423, -0.8409504, 5.25 },
+    { -0.0554225, -0.5780478, -0.8141186, 5.25 },
+    { -0.5335867, -0.2839520, -0.7966533, 5.25 },
+    { -0.6700514, 0.0706415, -0.7389458, 5.25 },
+    { -0.1078804, -0.6673343, -0.7369035, 5.25 },
+    { 0.0759961, -0.7139679, -0.6960420, 5.25 },
+    { -0.6919668, -0.2227887, -0.6866929, 5.25 },
+    { -0.5465784, 0.4818384, -0.6848969, 5.25 },
+    { -0.2604277, 0.7297535, -0.6321687, 5.25 },
+    { 0.8167458, 0.0418504, -0.5754780, 5.25 },
+    { 0.7624671, 0.3642630, -0.5347490, 5.25 },
+    { 0.5694157, -0.7603233, -0.3125288, 5.25 },
+    { 0.9500484, 0.0504834, -0.3079927, 5.25 },
+    { 0.1539135, 0.9583212, -0.2406887, 5.25 },
+    { -0.9064989, -0.3603733, -0.2199791, 5.25 },
+    { -0.2799035, -0.9540243, -0.1071992, 5.25 },
+    { 0.5572379, 0.8301048, -0.0202987, 5.25 },
+    { -0.3909077, 0.9198234, 0.0334062, 5.25 },
+    { 0.7887297, 0.6134660, 0.0395597, 5.25 },
+    { -0.3720017, 0.9203298, 0.1208626, 5.25 },
+    { -0.3821245, 0.8829496, 0.2727285, 5.25 },
+    { 0.0946207, -0.9472729, 0.3061389, 5.25 },
+    { -0.3563817, -0.8663631, 0.3498672, 5.25 },
+    { 0.1820152, -0.8230283, 0.5380473, 5.25 },
+    { -0.2100070, -0.8063279, 0.5529307, 5.25 },
+    { -0.7779340, -0.2294811, 0.5849419, 5.25 },
+    { 0.7191301, -0.2565063, 0.6457990, 5.25 },
+    { -0.6221528, 0.4422976, 0.6459867, 5.25 },
+    { -0.1467169, 0.7094302, 0.6893351, 5.25 },
+    { -0.5508007, -0.3451428, 0.7599310, 5.25 },
+    { -0.3986667, -0.4211301, 0.8146866, 5.25 },
+    { -0.1481399, -0.3243568, 0.9342629, 5.25 },
+    { 0.3382420, 0.3073043, -0.8894698, 5.26 },
+    { 0.2525819, -0.4505415, -0.8562796, 5.26 },
+    { -0.3300619, 0.4103058, -0.8501225, 5.26 },
+    { -0.4781841, 0.4080585, -0.7777070, 5.26 },
+    { 0.5764103, -0.5142325, -0.6350717, 5.26 },
+    { -0.1618278, 0.7719864, -0.6146941, 5.26 },
+    { -0.9417057, -0.0035056, -0.3364196, 5.26 },
+    { 0.8953046, -0.2928397, -0.3356703, 5.26 },
+    { 0.3612359, 0.9193458, -0.1559226, 5.26 },
+    { 0.6877045, 0.7138396, -0.1322703, 5.26 },
+    { 0.1056305, 0.9907961, -0.0846484, 5.26 },
+    { -0.5771219, -0.7979454, 0.1738201, 5.26 },
+    { -0.8418669, 0.4947940, 0.2154971, 5.26 },
+    { 0.4057234, 0.8761091, 0.2604254, 5.26 },
+    { -0.9280845, 0.0779953, 0.3641098, 5.26 },
+    { 0.4835912, 0.7613946, 0.4317613, 5.26 },
+    { -0.5772270, -0.6552358, 0.4873141, 5.26 },
+    { 0.3715192, 0.2137046, 0.9034954, 5.26 },
+    { -0.1198850, 0.0489993, 0.9915779, 5.26 },
+    { -0.0827003, -0.1782579, -0.9805023, 5.27 },
+    { -0.1710078, -0.4026500, -0.8992382, 5.27 },
+    { 0.1633657, 0.4768240, -0.8636843, 5.27 },
+    { -0.4239521, 0.3740930, -0.8248146, 5.27 },
+    { -0.0829798, 0.6341782, -0.7687212, 5.27 },
+    { -0.1386952, 0.8334298, -0.5349378, 5.27 },
+    { -0.5700640, 0.6923427, -0.4423670, 5.27 },
+    { -0.0851093, 0.9870304, -0.1361152, 5.27 },
+    { 0.6827124, 0.7229479, -0.1060664, 5.27 },
+    { 0.0519905, 0.9923010, 0.1124089, 5.27 },
+    { 0.4235559, -0.8823803, 0.2049521, 5.27 },
+    { 0.7800745, 0.5104745, 0.3618004, 5.27 },
+    { -0.2071433, 0.9053427, 0.3707376, 5.27 },
+    { 0.0760904, -0.9071654, 0.4138372, 5.27 },
+    { 0.2312527, -0.8667014, 0.4419852, 5.27 },
+    { -0.1350570, 0.8723731, 0.4698136, 5.27 },
+    { -0.6116466, -0.3819395, 0.6928280, 5.27 },
+    { 0.6298819, 0.2612379, 0.7314393, 5.27 },
+    { -0.5526257, 0.3329810, 0.7640213, 5.27 },
+    { -0.2794033, 0.5724179, 0.7708901, 5.27 },
+    { -0.5636411, 0.0321864, 0.8253925, 5.27 },
+    { -0.4136326, 0.3600991, 0.8362037, 5.27 },
+    { 0.4009538, -0.2199518, 0.8893016, 5.27 },
+    { 0.2150895, -0.3670704, 0.9049839, 5.27 },
+    { 0.1765483, 0.3815243, 0.9073422, 5.27 },
+    { 0.0544069, -0.2687488, 0.9616725, 5.27 },
+    { 0.0606337, -0.0305032, 0.9976939, 5.27 },
+    { 0.0098905, -0.0405867, -0.9991271, 5.28 },
+    { 0.1351728, 0.0059224, -0.9908043, 5.28 },
+    { 0.1490472, 0.1161086, -0.9819897, 5.28 },
+    { -0.3623195, 0.1912113, -0.9122296, 5.28 },
+    { -0.5596059, 0.2809020, -0.7797021, 5.28 },
+    { 0.1238067, -0.8293214, -0.5448834, 5.28 },
+    { 0.7190929, 0.4710468, -0.5109014, 5.28 },
+    { -0.3016478, 0.8418543, -0.4475376, 5.28 },
+    { -0.5401927, 0.7363143, -0.4074717, 5.28 },
+    { 0.5398882, -0.7754020, -0.3275248, 5.28 },
+    { 0.9610536, -0.0736756, -0.2663604, 5.28 },
+    { 0.7277102, -0.6339931, -0.2617073, 5.28 },
+    { 0.4940146, 0.8690329, -0.0270440, 5.28 },
+    { 0.8142401, 0.5804872, 0.0069081, 5.28 },
+    { 0.4760962, -0.8567977, 0.1980660, 5.28 },
+    { 0.3262563, -0.9236648, 0.2009977, 5.28 },
+    { 0.0097266, -0.9345666, 0.3556553, 5.28 },
+    { 0.5956683, 0.7176569, 0.3607602, 5.28 },
+    { 0.3713502, 0.8481386, 0.3778358, 5.28 },
+    { 0.3398524, 0.7825889, 0.5215889, 5.28 },
+    { 0.6925762, 0.4668709, 0.5498816, 5.28 },
+    { 0.2338770, -0.7733978, 0.5892007, 5.28 },
+    { 0.3248055, 0.5438318, 0.7737883, 5.28 },
+    { 0.4302673, 0.4335464, 0.7917750, 5.28 },
+    { 0.0851913, 0.5298409, 0.8438075, 5.28 },
+    { 0.2651669, 0.1215637, 0.9565086, 5.28 },
+    { -0.1120790, -0.0244509, 0.9933984, 5.28 },
+    { 0.1071530, -0.0676705, -0.9919370, 5.29 },
+    { -0.1977345, 0.1697438, -0.9654471, 5.29 },
+    { -0.1659743, 0.2325304, -0.9583226, 5.29 },
+    { 0.2787528, -0.1232162, -0.9524257, 5.29 },
+    { -0.4016828, 0.1686935, -0.9001074, 5.29 },
+    { -0.1469530, -0.5801867, -0.8011169, 5.29 },
+    { 0.0136711, 0.6067322, -0.7947887, 5.29 },
+    { -0.1003858, -0.6893483, -0.7174411, 5.29 },
+    { -0.6971869, 0.0434612, -0.7155708, 5.29 },
+    { 0.6012905, -0.4527006, -0.6584162, 5.29 },
+    { 0.0636294, 0.8199988, -0.5688175, 5.29 },
+    { 0.9455696, -0.0577707, -0.3202511, 5.29 },
+    { -0.1966074, 0.9483046, -0.2491261, 5.29 },
+    { -0.6663296, 0.7449220, -0.0331062, 5.29 },
+    { -0.4933541, 0.8689619, 0.0388185, 5.29 },
+    { 0.4438917, 0.8859645, 0.1342648, 5.29 },
+    { -0.8189483, -0.5464124, 0.1753772, 5.29 },
+    { 0.0520096, 0.9693235, 0.2402229, 5.29 },
+    { 0.8056248, -0.5125225, 0.2971351, 5.29 },
+    { 0.7680485, -0.5080077, 0.3899098, 5.29 },
+    { -0.8923126, -0.1131670, 0.4370028, 5.29 },
+    { 0.6935504, 0.5234197, 0.4949945, 5.29 },
+    { -0.1243702, 0.7732642, 0.6217673, 5.29 },
+    { 0.2399682, 0.6862477, 0.6866435, 5.29 },
+    { -0.6538167, -0.0566602, 0.7545286, 5.29 },
+    { 0.4128257, 0.5062645, 0.7571468, 5.29 },
+    { -0.1957388, -0.5235747, 0.8291899, 5.29 },
+    { 0.3953270, -0.2194002, 0.8919530, 5.29 },
+    { 0.3449070, 0.1098332, 0.9321887, 5.29 },
+    { -0.4779243, 0.0701725, -0.8755936, 5.30 },
+    { 0.5594785, -0.5451776, -0.6243118, 5.30 },
+    { 0.4106318, -0.7122767, -0.5692480, 5.30 },
+    { -0.9007317, 0.0208009, -0.4338775, 5.30 },
+    { -0.6583983, -0.6266292, -0.4169503, 5.30 },
+    { -0.2219290, 0.8937627, -0.3897893, 5.30 },
+    { 0.6834396, -0.6342027, -0.3615206, 5.30 },
+    { 0.1697158, 0.9621336, -0.2132966, 5.30 },
+    { 0.8761759, -0.4817316, -0.0158241, 5.30 },
+    { 0.8207147, -0.5627005, 0.0989724, 5.30 },
+    { -0.4393761, 0.8786582, 0.1868379, 5.30 },
+    { 0.9812924, -0.0316170, 0.1899095, 5.30 },
+    { -0.3548269, 0.9127897, 0.2022693, 5.30 },
+    { -0.0645738, 0.9583973, 0.2780375, 5.30 },
+    { 0.2115871, 0.9129729, 0.3488715, 5.30 },
+    { -0.4919536, 0.7891037, 0.3678275, 5.30 },
+    { 0.6804676, 0.5744538, 0.4549358, 5.30 },
+    { 0.6399043, 0.5230178, 0.5630053, 5.30 },
+    { 0.5558922, 0.3866430, 0.7358608, 5.30 },
+    { 0.6338244, -0.0578545, 0.7713103, 5.30 },
+    { 0.1693877, 0.5213618, 0.8363550, 5.30 },
+    { -0.3936700, 0.0301648, 0.9187568, 5.30 },
+    { 0.0792450, 0.3104198, -0.9472908, 5.31 },
+    { 0.1985792, -0.3375476, -0.9201238, 5.31 },
+    { -0.4012974, -0.1565232, -0.9024748, 5.31 },
+    { -0.4451870, -0.0841961, -0.8914705, 5.31 },
+    { 0.4702742, 0.3856242, -0.7938112, 5.31 },
+    { 0.2103862, 0.6005431, -0.7714179, 5.31 },
+    { 0.0405807, 0.6859237, -0.7265410, 5.31 },
+    { -0.6968067, -0.0427503, -0.7159839, 5.31 },
+    { -0.2358125, 0.7229307, -0.6494333, 5.31 },
+    { -0.4343812, 0.7210063, -0.5398731, 5.31 },
+    { 0.8443487, -0.0715073, -0.5310010, 5.31 },
+    { 0.0850577, 0.8731017, -0.4800610, 5.31 },
+    { 0.8113610, 0.4029698, -0.4234485, 5.31 },
+    { -0.0317012, 0.9440404, -0.3283030, 5.31 },
+    { -0.7168564, -0.6529661, -0.2444425, 5.31 },
+    { -0.8651059, 0.4498739, -0.2218227, 5.31 },
+    { 0.9515705, 0.2373642, -0.1953761, 5.31 },
+    { -0.6723183, 0.7378219, -0.0600575, 5.31 },
+    { -0.1287872, -0.9914989, -0.0185431, 5.31 },
+    { 0.3533056, 0.9353457, 0.0174228, 5.31 },
+    { 0.5823396, -0.8075947, 0.0931198, 5.31 },
+    { 0.6491542, -0.6590110, 0.3798728, 5.31 },
+    { -0.3951318, 0.8091112, 0.4349827, 5.31 },
+    { 0.6269860, -0.4926949, 0.6034404, 5.31 },
+    { -0.7663995, 0.1040640, 0.6338790, 5.31 },
+    { 0.4165651, 0.5550059, 0.7200292, 5.31 },
+    { 0.5166699, -0.4078217, 0.7528171, 5.31 },
+    { 0.5246340, 0.3459482, 0.7778682, 5.31 },
+    { -0.4352209, 0.3027446, -0.8478965, 5.32 },
+    { 0.4877295, -0.2147585, -0.8461671, 5.32 },
+    { -0.5308153, -0.1322241, -0.8371093, 5.32 },
+    { 0.4376836, -0.6791629, -0.5892120, 5.32 },
+    { -0.8106848, -0.0837404, -0.5794633, 5.32 },
+    { -0.5980121, -0.5762082, -0.5571047, 5.32 },
+    { -0.7324793, -0.5361429, -0.4195533, 5.32 },
+    { 0.8356215, -0.4152607, -0.3595766, 5.32 },
+    { -0.1927088, 0.9474409, -0.2553801, 5.32 },
+    { 0.6924352, 0.7089776, -0.1337320, 5.32 },
+    { -0.9882863, 0.0521622, 0.1434202, 5.32 },
+    { -0.9551596, 0.1862489, 0.2301771, 5.32 },
+    { 0.9177030, -0.1067162, 0.3826655, 5.32 },
+    { -0.7720861, 0.4830004, 0.4130298, 5.32 },
+    { 0.5107271, -0.7516167, 0.4174089, 5.32 },
+    { -0.2453087, -0.8146636, 0.5254968, 5.32 },
+    { 0.8380715, -0.1405640, 0.5271412, 5.32 },
+    { -0.5453909, 0.4833568, 0.6847736, 5.32 },
+    { -0.0230477, 0.4105768, 0.9115347, 5.32 },
+    { -0.3836954, -0.1026643, 0.9177352, 5.32 },
+    { -0.2009297, 0.3070142, 0.9302524, 5.32 },
+    { 0.1103905, -0.3507631, -0.9299351, 5.33 },
+    { 0.0417195, -0.5572962, -0.8292650, 5.33 },
+    { -0.2677216, -0.5906468, -0.7612237, 5.33 },
+    { -0.4057586, 0.5332213, -0.7423174, 5.33 },
+    { -0.4645295, 0.4901762, -0.7375226, 5.33 },
+    { -0.2801055, -0.6906392, -0.6667522, 5.33 },
+    { 0.3598330, -0.6778661, -0.6411066, 5.33 },
+    { -0.5852812, 0.5045189, -0.6347492, 5.33 },
+    { -0.7190682, 0.3220753, -0.6157990, 5.33 },
+    { -0.4153704, 0.8062466, -0.4212289, 5.33 },
+    { -0.8912871, -0.2990063, -0.3408851, 5.33 },
+    { -0.3467494, 0.8954990, -0.2790097, 5.33 },
+    { 0.2863336, 0.9571301, 0.0437608, 5.33 },
+    { -0.6562760, -0.7495921, 0.0861019, 5.33 },
+    { 0.4836050, 0.8701454, 0.0947271, 5.33 },
+    { 0.2780969, 0.9509684, 0.1353558, 5.33 },
+    { -0.2024300, -0.9619130, 0.1836993, 5.33 },
+    { -0.0670273, 0.9737985, 0.2173104, 5.33 },
+    { -0.5529625, -0.8029881, 0.2223569, 5.33 },
+    { -0.9169599, -0.3213843, 0.2364246, 5.33 },
+    { -0.5791737, 0.7366045, 0.3492445, 5.33 },
+    { -0.3458580, 0.7846765, 0.5144562, 5.33 },
+    { -0.8242383, 0.0683079, 0.5621078, 5.33 },
+    { 0.7346732, -0.3711229, 0.5679112, 5.33 },
+    { 0.5696450, 0.5392047, 0.6202925, 5.33 },
+    { 0.7596899, 0.1377851, 0.6355207, 5.33 },
+    { 0.6718681, -0.1561781, 0.7240177, 5.33 },
+    { -0.1166882, 0.4947362, 0.8611736, 5.33 },
+    { -0.1646171, -0.1616018, -0.9730293, 5.34 },
+    { 0.2766012, -0.2146538, -0.9367046, 5.34 },
+    { -0.4082034, 0.1360382, -0.9026980, 5.34 },
+    { 0.0511180, 0.4317836, -0.9005276, 5.34 },
+    { -0.6596689, -0.0237417, -0.7511813, 5.34 },
+    { 0.3046754, 0.6480319, -0.6980168, 5.34 },
+    { 0.0799604, -0.7980993, -0.5971967, 5.34 },
+    { 0.1133995, -0.8310723, -0.5444809, 5.34 },
+    { -0.7896891, 0.3761261, -0.4846858, 5.34 },
+    { 0.0113417, -0.9114606, -0.4112311, 5.34 },
+    { 0.9478384, -0.0763660, -0.3094684, 5.34 },
+    { 0.8778389, -0.4243561, -0.2220827, 5.34 },
+    { 0.3088416, -0.9410304, -0.1381255, 5.34 },
+    { 0.8904802, 0.4439205, -0.0998982, 5.34 },
+    { 0.1152467, 0.9931320, -0.0201766, 5.34 },
+    { 0.1769595, 0.9831755, 0.0452899, 5.34 },
+    { 0.2229787, 0.9635567, 0.1477802, 5.34 },
+    { -0.9366456, 0.2986658, 0.1830130, 5.34 },
+    { -0.7270591, 0.6363241, 0.2578308, 5.34 },
+    { 0.8926326, 0.2630617, 0.3660677, 5.34 },
+    { 0.1636606, -0.0513025, -0.9851818, 5.35 },
+    { -0.3691974, -0.0074841, -0.9293209, 5.35 },
+    { -0.2669523, 0.2898513, -0.9190880, 5.35 },
+    { 0.3995445, 0.2926857, -0.8687343, 5.35 },
+    { 0.2515250, -0.4935392, -0.8325589, 5.35 },
+    { -0.2654847, -0.6386117, -0.7222832, 5.35 },
+    { -0.3543344, 0.6329374, -0.6883584, 5.35 },
+    { -0.6065731, 0.4557522, -0.6514285, 5.35 },
+    { 0.5279717, -0.5579729, -0.6402438, 5.35 },
+    { -0.3070705, 0.7923928, -0.5270876, 5.35 },
+    { 0.7476236, 0.4370736, -0.5000256, 5.35 },
+    { -0.1403711, -0.8705275, -0.4716755, 5.35 },
+    { 0.0373366, 0.9907002, -0.1308396, 5.35 },
+    { 0.1188419, 0.9925245, -0.0277801, 5.35 },
+    { 0.7874608, 0.6161000, -0.0180632, 5.35 },
+    { -0.6392779, -0.7688744, 0.0124841, 5.35 },
+    { -0.3182131, 0.9464641, 0.0542773, 5.35 },
+    { 0.5500449, 0.8284578, 0.1053963, 5.35 },
+    { -0.8036999, 0.5434726, 0.2422893, 5.35 },
+    { -0.5838906, 0.7500732, 0.3105833, 5.35 },
+    { -0.2640009, -0.9112194, 0.3162006, 5.35 },
+    { -0.4547050, 0.8231434, 0.3401151, 5.35 },
+    { 0.3962544, 0.8443280, 0.3606838, 5.35 },
+    { -0.7841291, 0.3814293, 0.4895439, 5.35 },
+    { 0.6395189, 0.5168565, 0.5691001, 5.35 },
+    { 0.2964260, -0.6761844, 0.6744674, 5.35 },
+    { 0.2036477, 0.5592769, 0.8035776, 5.35 },
+    { -0.1100015, 0.5308834, 0.8402752, 5.35 },
+    { -0.5194309, -0.0682810, 0.8517800, 5.35 },
+    { -0.0341757, 0.4988429, 0.8660184, 5.35 },
+    { 0.4352680, -0.2217044, 0.8725761, 5.35 },
+    { 0.0505382, -0.2463668, 0.9678581, 5.35 },
+    { -0.1244932, 0.1006763, -0.9870997, 5.36 },
+    { -0.3424009, -0.3010405, -0.8900204, 5.36 },
+    { -0.6407446, 0.1345833, -0.7558662, 5.36 },
+    { 0.6639052, 0.1866778, -0.7241418, 5.36 },
+    { 0.1786376, -0.7127436, -0.6782958, 5.36 },
+    { -0.2776727, 0.8139117, -0.5103386, 5.36 },
+    { -0.0810257, 0.9832670, -0.1631590, 5.36 },
+    { -0.5380027, 0.8320236, -0.1352400, 5.36 },
+    { 0.4835913, 0.8739034, 0.0493185, 5.36 },
+    { -0.8988648, -0.4338591, 0.0617124, 5.36 },
+    { 0.1117545, 0.9915618, 0.0656973, 5.36 },
+    { -0.9855704, 0.0929035, 0.1414921, 5.36 },
+    { 0.4645993, -0.8379724, 0.2862686, 5.36 },
+    { 0.9167221, 0.1613411, 0.3654992, 5.36 },
+    { -0.7369085, 0.4211282, 0.5287881, 5.36 },
+    { 0.4239505, -0.6893699, 0.5873969, 5.36 },
+    { -0.0224880, 0.7824719, 0.6222797, 5.36 },
+    { -0.2474814, 0.5979662, 0.7623578, 5.36 },
+    { 0.0901346, -0.6040992, 0.7917954, 5.36 },
+    { -0.0564763, 0.5928091, 0.8033603, 5.36 },
+    { -0.0224734, 0.5155085, 0.8565897, 5.36 },
+    { -0.1816484, 0.2598626, -0.9484067, 5.37 },
+    { 0.4526790, 0.1369125, -0.8810997, 5.37 },
+    { 0.5712124, -0.1406733, -0.8086578, 5.37 },
+    { 0.5355478, -0.2546978, -0.8051817, 5.37 },
+    { -0.5144384, -0.3959862, -0.7606235, 5.37 },
+    { 0.1253067, -0.7182864, -0.6843704, 5.37 },
+    { -0.4821718, -0.5994240, -0.6389062, 5.37 },
+    { -0.3678119, 0.7410890, -0.5616952, 5.37 },
+    { 0.7351184, -0.3829706, -0.5594055, 5.37 },
+    { 0.1856916, -0.9057593, -0.3809444, 5.37 },
+    { -0.8906649, -0.3375242, -0.3046200, 5.37 },
+    { 0.4456030, 0.8496207, -0.2821038, 5.37 },
+    { 0.8982391, -0.4179098, -0.1360806, 5.37 },
+    { -0.4615151, -0.8850689, -0.0604717, 5.37 },
+    { -0.9979656, 0.0002250, 0.0637538, 5.37 },
+    { 0.9025272, -0.4186520, 0.1008720, 5.37 },
+    { 0.9858053, 0.0888407, 0.1424615, 5.37 },
+    { 0.3105909, 0.9286397, 0.2028832, 5.37 },
+    { 0.4770134, -0.8257524, 0.3009837, 5.37 },
+    { 0.3718090, 0.8213785, 0.4325452, 5.37 },
+    { -0.5343962, -0.6471805, 0.5436710, 5.37 },
+    { -0.6523889, 0.4936664, 0.5750497, 5.37 },
+    { 0.1482528, -0.7559710, 0.6375962, 5.37 },
+    { -0.3795518, -0.6232214, 0.6837657, 5.37 },
+    { -0.4502236, 0.5317393, 0.7173228, 5.37 },
+    { 0.4923316, -0.4872807, 0.7212261, 5.37 },
+    { 0.3455613, 0.5749401, 0.7416410, 5.37 },
+    { -0.0673460, -0.6580631, 0.7499450, 5.37 },
+    { -0.0385049, 0.3449520, -0.9378302, 5.38 },
+    { -0.4829519, 0.1694188, -0.8591011, 5.38 },
+    { -0.4677182, -0.2231361, -0.8552485, 5.38 },
+    { -0.4342866, -0.4204429, -0.7966322, 5.38 },
+    { 0.1615252, 0.6338040, -0.7564404, 5.38 },
+    { -0.7187719, 0.2787385, -0.6369237, 5.38 },
+    { 0.1946033, -0.7708299, -0.6065895, 5.38 },
+    { -0.3150491, 0.8262777, -0.4669145, 5.38 },
+    { -0.4203399, -0.7916009, -0.4434888, 5.38 },
+    { 0.0620443, -0.9332091, -0.3539369, 5.38 },
+    { 0.3930857, 0.8492552, -0.3524901, 5.38 },
+    { -0.4937556, 0.7955710, -0.3511014, 5.38 },
+    { -0.5450121, -0.7705203, -0.3305455, 5.38 },
+    { 0.2553413, 0.9502924, -0.1781721, 5.38 },
+    { -0.7830031, 0.6129604, -0.1057627, 5.38 },
+    { -0.0289119, 0.9969031, -0.0731318, 5.38 },
+    { 0.6481236, 0.7613620, -0.0162362, 5.38 },
+    { 0.4900935, 0.8716572, -0.0046930, 5.38 },
+    { 0.6063267, -0.7625986, 0.2254135, 5.38 },
+    { 0.9439329, 0.1944055, 0.2668282, 5.38 },
+    { 0.2399609, -0.9237875, 0.2983880, 5.38 },
+    { 0.8784273, 0.3471505, 0.3284083, 5.38 },
+    { 0.9284550, 0.1329310, 0.3468438, 5.38 },
+    { 0.3938929, 0.8409826, 0.3709402, 5.38 },
+    { 0.0976350, 0.9080317, 0.4073646, 5.38 },
+    { -0.1560507, -0.8887066, 0.4311017, 5.38 },
+    { 0.3501330, -0.7971685, 0.4918631, 5.38 },
+    { 0.1651236, -0.6138028, 0.7719976, 5.38 },
+    { 0.1666541, -0.5725083, 0.8027831, 5.38 },
+    { -0.2552463, -0.0210206, 0.9666475, 5.38 },
+    { 0.1881586, 0.1143158, 0.9754631, 5.38 },
+    { -0.2756138, 0.2368837, -0.9316239, 5.39 },
+    { 0.4080900, 0.0765068, -0.9097303, 5.39 },
+    { -0.5320559, -0.0531570, -0.8450390, 5.39 },
+    { -0.2117871, 0.5768254, -0.7889352, 5.39 },
+    { -0.7543956, 0.0872143, -0.6506005, 5.39 },
+    { -0.3016263, 0.7905883, -0.5329087, 5.39 },
+    { 0.6515813, 0.5965579, -0.4685728, 5.39 },
+    { -0.4756773, -0.7754510, -0.4152190, 5.39 },
+    { 0.0844637, -0.9583524, -0.2728125, 5.39 },
+    { -0.2046570, 0.9433239, -0.2612576, 5.39 },
+    { -0.2812970, 0.9394233, -0.1958468, 5.39 },
+    { 0.4565877, -0.8698559, -0.1867574, 5.39 },
+    { 0.1290779, -0.9910291, -0.0346432, 5.39 },
+    { -0.3884271, -0.9214064, 0.0116062, 5.39 },
+    { -0.9874164, 0.1562221, 0.0245684, 5.39 },
+    { 0.0828273, -0.9885196, 0.1263668, 5.39 },
+    { 0.3424380, 0.9295072, 0.1369398, 5.39 },
+    { 0.1564263, -0.9748815, 0.1585458, 5.39 },
+    { 0.9620097, -0.2131616, 0.1705859, 5.39 },
+    { -0.0734669, 0.9822379, 0.1726598, 5.39 },
+    { -0.1904071, -0.9497276, 0.2485208, 5.39 },
+    { -0.7578982, -0.5631566, 0.3293098, 5.39 },
+    { -0.5932885, 0.6238595, 0.5087317, 5.39 },
+    { -0.1441124, -0.8312941, 0.5368256, 5.39 },
+    { -0.3433824, -0.7577453, 0.5548969, 5.39 },
+    { -0.1820242, -0.7889545, 0.5868714, 5.39 },
+    { -0.5496004, -0.4564363, 0.6997181, 5.39 },
+    { 0.4149421, -0.4849343, 0.7698453, 5.39 },
+    { 0.2031201, 0.4446426, 0.8723733, 5.39 },
+    { 0.2445415, -0.4008323, 0.8829116, 5.39 },
+    { 0.4238852, 0.0953845, 0.9006793, 5.39 },
+    { 0.1096011, -0.1221987, 0.9864355, 5.39 },
+    { -0.0726102, 0.3179890, -0.9453099, 5.40 },
+    { 0.1663648, 0.4377282, -0.8835818, 5.40 },
+    { -0.1270996, 0.6126635, -0.7800571, 5.40 },
+    { 0.2293761, -0.6627571, -0.7128392, 5.40 },
+    { -0.3151623, -0.7080462, -0.6319361, 5.40 },
+    { 0.4296716, 0.6653801, -0.6104520, 5.40 },
+    { -0.1244980, 0.9846332, -0.1224650, 5.40 },
+    { -0.5513244, -0.8336965, -0.0314873, 5.40 },
+    { 0.9743625, -0.2218989, 0.0371287, 5.40 },
+    { 0.3176860, 0.9282813, 0.1933116, 5.40 },
+    { 0.3693213, 0.8985062, 0.2372517, 5.40 },
+    { 0.0171119, 0.9384876, 0.3448887, 5.40 },
+    { 0.0802124, 0.8579541, 0.5074256, 5.40 },
+    { 0.6670839, 0.3595194, 0.6524912, 5.40 },
+    { 0.3083754, -0.6655416, 0.6796757, 5.40 },
+    { 0.5618129, -0.2888406, 0.7752015, 5.40 },
+    { -0.2183242, -0.4539238, 0.8638795, 5.40 },
+    { -0.4639806, -0.1885248, 0.8655521, 5.40 },
+    { 0.4693128, 0.0509664, 0.8815599, 5.40 },
+    { 0.1381517, -0.2670300, -0.9537343, 5.41 },
+    { -0.0559718, -0.3353582, -0.9404265, 5.41 },
+    { 0.2437552, -0.2676448, -0.9321747, 5.41 },
+    { -0.5335877, 0.0295558, -0.8452282, 5.41 },
+    { 0.4795943, 0.4116371, -0.7749479, 5.41 },
+    { -0.5359934, -0.4392336, -0.7209611, 5.41 },
+    { 0.8834559, 0.0446502, -0.4663819, 5.41 },
+    { 0.7266562, -0.5875951, -0.3559534, 5.41 },
+    { 0.8099238, 0.4665188, -0.3555049, 5.41 },
+    { -0.5381473, -0.7983859, -0.2701435, 5.41 },
+    { 0.9437563, 0.3277514, -0.0436247, 5.41 },
+    { -0.7794010, 0.6064286, 0.1574117, 5.41 },
+    { -0.6801814, 0.7047987, 0.2015243, 5.41 },
+    { -0.7999158, -0.5563270, 0.2250224, 5.41 },
+    { -0.8743739, 0.4232617, 0.2373181, 5.41 },
+    { -0.2616282, -0.8964408, 0.3576935, 5.41 },
+    { 0.0886180, -0.9142630, 0.3953099, 5.41 },
+    { 0.4104199, 0.7954436, 0.4458980, 5.41 },
+    { 0.6974928, -0.5465685, 0.4634292, 5.41 },
+    { -0.4145823, -0.7256980, 0.5490755, 5.41 },
+    { 0.1479576, 0.8182161, 0.5555456, 5.41 },
+    { -0.6553714, 0.4776423, 0.5851035, 5.41 },
+    { -0.5525796, 0.4291391, 0.7144896, 5.41 },
+    { -0.1387097, 0.2397805, 0.9608668, 5.41 },
+    { 0.2557319, 0.0540874, 0.9652335, 5.41 },
+    { -0.0526929, 0.0542398, -0.9971367, 5.42 },
+    { 0.2379619, -0.4535061, -0.8588983, 5.42 },
+    { 0.6984918, 0.2705065, -0.6625220, 5.42 },
+    { 0.7405783, -0.2298252, -0.6314460, 5.42 },
+    { -0.3344925, 0.7071199, -0.6229736, 5.42 },
+    { -0.3207311, -0.7248664, -0.6096722, 5.42 },
+    { -0.1186186, 0.7978589, -0.5910590, 5.42 },
+    { 0.7630123, -0.4368184, -0.4764471, 5.42 },
+    { 0.8823127, 0.0360158, -0.4692836, 5.42 },
+    { 0.6617835, -0.5891702, -0.4635959, 5.42 },
+    { -0.4776453, -0.7789121, -0.4063876, 5.42 },
+    { -0.5784976, 0.7436806, -0.3350816, 5.42 },
+    { -0.9065779, 0.2995287, -0.2973198, 5.42 },
+    { 0.8807725, 0.3920677, -0.2655613, 5.42 },
+    { -0.7910344, -0.5998577, -0.1201474, 5.42 },
+    { 0.2789695, -0.9577231, -0.0703030, 5.42 },
+    { 0.2704908, -0.9605586, -0.0645130, 5.42 },
+    { 0.8134941, 0.5813681, -0.0154455, 5.42 },
+    { -0.9797147, 0.2003939, -0.0012164, 5.42 },
+    { -0.3727442, 0.8801922, 0.2938086, 5.42 },
+    { 0.1358073, 0.9415160, 0.3083894, 5.42 },
+    { 0.8469806, 0.2184009, 0.4846905, 5.42 },
+    { -0.8273126, -0.1223452, 0.5482567, 5.42 },
+    { 0.1327238, -0.8235592, 0.5514841, 5.42 },
+    { 0.5593028, 0.1119801, 0.8213652, 5.42 },
+    { 0.0587881, 0.4491140, 0.8915383, 5.42 },
+    { -0.0945733, 0.1561819, 0.9831903, 5.42 },
+    { -0.4194700, -0.5784206, -0.6996245, 5.43 },
+    { 0.7610993, 0.0949348, -0.6416505, 5.43 },
+    { 0.1499778, -0.7547952, -0.6385850, 5.43 },
+    { -0.2953442, 0.7210628, -0.6267697, 5.43 },
+    { -0.3813296, 0.7092558, -0.5929115, 5.43 },
+    { -0.7876923, 0.1930999, -0.5850241, 5.43 },
+    { -0.3007396, 0.7936841, -0.5287923, 5.43 },
+    { 0.7924217, -0.3937359, -0.4658754, 5.43 },
+    { -0.4586348, -0.7831326, -0.4199493, 5.43 },
+    { 0.3330389, -0.8509644, -0.4061338, 5.43 },
+    { -0.7889431, -0.5291573, -0.3123483, 5.43 },
+    { 0.7231275, -0.6178558, -0.3087731, 5.43 },
+    { -0.8491527, -0.4299763, -0.3066922, 5.43 },
+    { -0.4484802, -0.8813483, -0.1486293, 5.43 },
+    { -0.1370582, 0.9803458, -0.1419053, 5.43 },
+    { 0.9627656, -0.2348609, -0.1338757, 5.43 },
+    { 0.9589770, 0.2706545, -0.0843160, 5.43 },
+    { 0.8589693, 0.5120222, 0.0022394, 5.43 },
+    { 0.9651734, -0.2610707, 0.0168033, 5.43 },
+    { 0.2160870, 0.9613339, 0.1707149, 5.43 },
+    { 0.6229780, -0.7569544, 0.1972776, 5.43 },
+    { 0.7135254, 0.5924687, 0.3739817, 5.43 },
+    { 0.3061782, -0.8679069, 0.3911426, 5.43 },
+    { -0.6355707, 0.5926706, 0.4947641, 5.43 },
+    { 0.5399908, 0.4697662, 0.6983764, 5.43 },
+    { 0.6354800, -0.1789999, 0.7510820, 5.43 },
+    { 0.6418903, 0.1107732, 0.7587530, 5.43 },
+    { 0.5344828, -0.1691117, 0.8280878, 5.43 },
+    { 0.4656116, -0.0226972, 0.8846981, 5.43 },
+    { -0.3856374, -0.0812194, 0.9190687, 5.43 },
+    { 0.0570536, 0.2705819, 0.9610048, 5.43 },
+    { 0.0629176, 0.1465273, 0.9872037, 5.43 },
+    { -0.5545786, 0.0042271, -0.8321206, 5.44 },
+    { -0.2571713, -0.5315009, -0.8070748, 5.44 },
+    { -0.3527396, -0.4983080, -0.7920000, 5.44 },
+    { -0.6691840, 0.0657167, -0.7401852, 5.44 },
+    { -0.7707458, -0.0959167, -0.6298816, 5.44 },
+    { -0.5876016, -0.6031285, -0.5394074, 5.44 },
+    { -0.8603025, 0.1957257, -0.4707133, 5.44 },
+    { 0.0577899, -0.9272488, -0.3699594, 5.44 },
+    { 0.4569391, 0.8812912, -0.1205507, 5.44 },
+    { -0.1355908, -0.9907481, 0.0057702, 5.44 },
+    { -0.2826144, 0.9191256, 0.2744763, 5.44 },
+    { -0.4879973, -0.8008568, 0.3471125, 5.44 },
+    { -0.1697731, 0.8582358, 0.4843639, 5.44 },
+    { 0.1773213, -0.7264369, 0.6639628, 5.44 },
+    { 0.6506852, -0.1162069, 0.7504031, 5.44 },
+    { 0.4005764, -0.5158938, 0.7572266, 5.44 },
+    { 0.1302697, 0.4266712, 0.8949757, 5.44 },
+    { 0.3100690, -0.2427576, 0.9191985, 5.44 },
+    { -0.1797349, -0.3321644, 0.9259385, 5.44 },
+    { 0.1769976, 0.2757815, 0.9447838, 5.44 },
+    { -0.0448630, 0.1780376, -0.9830005, 5.45 },
+    { -0.1909459, 0.1259736, -0.9734836, 5.45 },
+    { 0.3397423, 0.0831425, -0.9368364, 5.45 },
+    { 0.2066767, 0.4182321, -0.8845149, 5.45 },
+    { -0.4857137, 0.1829383, -0.8547607, 5.45 },
+    { -0.4811304, 0.3457108, -0.8056038, 5.45 },
+    { -0.4938312, 0.3786328, -0.7827949, 5.45 },
+    { 0.1119277, 0.6247002, -0.7728013, 5.45 },
+    { -0.5693483, -0.2889718, -0.7696349, 5.45 },
+    { -0.3127677, -0.6653797, -0.6778247, 5.45 },
+    { -0.2116120, -0.7147335, -0.6666156, 5.45 },
+    { -0.4951036, -0.6297476, -0.5985736, 5.45 },
+    { 0.0740229, 0.8389183, -0.5392000, 5.45 },
+    { -0.8778884, -0.1457395, -0.4561490, 5.45 },
+    { 0.6539735, 0.6392741, -0.4045334, 5.45 },
+    { -0.3351842, 0.9089229, -0.2480136, 5.45 },
+    { 0.3340019, 0.9093617, -0.2480000, 5.45 },
+    { -0.9578207, 0.2849548, -0.0371529, 5.45 },
+    { -0.2351390, 0.9717628, -0.0196667, 5.45 },
+    { -0.3064934, 0.9518582, -0.0052689, 5.45 },
+    { 0.1581638, -0.9805537, 0.1161834, 5.45 },
+    { 0.7676937, -0.5488205, 0.3308209, 5.45 },
+    { 0.4985950, 0.7703297, 0.3974860, 5.45 },
+    { -0.6513258, 0.6359445, 0.4139436, 5.45 },
+    { -0.5856614, 0.6014966, 0.5433255, 5.45 },
+    { -0.4067592, -0.6755791, 0.6149308, 5.45 },
+    { 0.3729518, -0.6643771, 0.6476960, 5.45 },
+    { 0.4836510, -0.5127447, 0.7093480, 5.45 },
+    { -0.3238062, 0.5919856, 0.7380397, 5.45 },
+    { 0.2733523, 0.5810458, 0.7665926, 5.45 },
+    { -0.2014792, 0.5327189, 0.8219591, 5.45 },
+    { -0.0064876, -0.3088659, 0.9510835, 5.45 },
+    { 0.1363197, 0.1629330, 0.9771744, 5.45 },
+    { -0.0362924, 0.1774520, 0.9834600, 5.45 },
+    { -0.0825774, -0.0201977, -0.9963800, 5.46 },
+    { -0.3185051, -0.3756188, -0.8703247, 5.46 },
+    { 0.0781754, -0.6630203, -0.7445084, 5.46 },
+    { 0.0884225, 0.6752397, -0.7322792, 5.46 },
+    { -0.4621778, 0.5200605, -0.7182818, 5.46 },
+    { 0.0496238, -0.7151094, -0.6972489, 5.46 },
+    { 0.6829530, -0.4088199, -0.6053442, 5.46 },
+    { -0.2679429, 0.8456465, -0.4616153, 5.46 },
+    { -0.2259287, 0.8804896, -0.4167665, 5.46 },
+    { 0.8894804, 0.2081215, -0.4068292, 5.46 },
+    { -0.9152774, -0.0442248, -0.4003890, 5.46 },
+    { -0.3145569, 0.9104199, -0.2686812, 5.46 },
+    { 0.8702327, -0.4500033, -0.2004795, 5.46 },
+    { -0.7028372, -0.6832904, -0.1978232, 5.46 },
+    { 0.7996967, 0.5705401, -0.1870008, 5.46 },
+    { -0.8397923, -0.5182268, -0.1618330, 5.46 },
+    { -0.7274317, 0.6689565, -0.1527755, 5.46 },
+    { 0.4124919, -0.9073507, -0.0810253, 5.46 },
+    { 0.1249463, 0.9905001, 0.0574280, 5.46 },
+    { 0.4800711, 0.8655649, 0.1425805, 5.46 },
+    { 0.3340709, 0.9185610, 0.2112874, 5.46 },
+    { -0.8994145, 0.3624888, 0.2442446, 5.46 },
+    { 0.1155274, 0.9490017, 0.2933415, 5.46 },
+    { -0.9196260, -0.1585233, 0.3593861, 5.46 },
+    { 0.5070416, 0.7574323, 0.4113456, 5.46 },
+    { -0.9011617, -0.1226828, 0.4157601, 5.46 },
+    { -0.0179527, -0.8982318, 0.4391553, 5.46 },
+    { -0.5132208, -0.6468855, 0.5640422, 5.46 },
+    { -0.3253702, -0.6971099, 0.6388834, 5.46 },
+    { -0.5469692, -0.2536245, 0.7978091, 5.46 },
+    { -0.3743043, -0.3473384, 0.8597978, 5.46 },
+    { 0.3864396, -0.1658512, 0.9072805, 5.46 },
+    { 0.0898821, -0.1190146, 0.9888158, 5.46 },
+    { 0.0443778, 0.1071396, 0.9932531, 5.46 },
+    { 0.0133621, -0.0123767, -0.9998341, 5.47 },
+    { -0.1568432, 0.0530415, -0.9861982, 5.47 },
+    { 0.0078287, 0.1844476, -0.9828112, 5.47 },
+    { -0.1238996, 0.1459358, -0.9815048, 5.47 },
+    { 0.0265299, -0.2567067, -0.9661252, 5.47 },
+    { 0.0725193, 0.2495597, -0.9656402, 5.47 },
+    { -0.2321187, 0.1755423, -0.9567161, 5.47 },
+    { -0.2479470, 0.1952784, -0.9488881, 5.47 },
+    { -0.2891642, 0.3529339, -0.8898437, 5.47 },
+    { -0.7111211, -0.1750734, -0.6809229, 5.47 },
+    { -0.2615743, -0.6847726, -0.6801951, 5.47 },
+    { -0.4406214, 0.5962007, -0.6711166, 5.47 },
+    { 0.0432545, -0.7496011, -0.6604750, 5.47 },
+    { 0.7148922, -0.3010521, -0.6311076, 5.47 },
+    { 0.5972956, 0.5505568, -0.5832026, 5.47 },
+    { 0.5373528, -0.6385227, -0.5509453, 5.47 },
+    { -0.0262151, 0.9193751, -0.3925075, 5.47 },
+    { -0.4781428, -0.8309018, -0.2845727, 5.47 },
+    { 0.4001984, -0.8825070, -0.2470277, 5.47 },
+    { -0.7478807, 0.6461894, -0.1520319, 5.47 },
+    { -0.0139478, -0.9973658, -0.0711822, 5.47 },
+    { 0.5490531, -0.8356018, -0.0176162, 5.47 },
+    { 0.7931197, 0.5805653, 0.1841334, 5.47 },
+    { 0.8899410, 0.2176307, 0.4008017, 5.47 },
+    { 0.4412703, 0.7990439, 0.4084230, 5.47 },
+    { 0.1209905, 0.8970713, 0.4249992, 5.47 },
+    { 0.5741526, -0.6055684, 0.5510315, 5.47 },
+    { -0.1257975, -0.7871028, 0.6038578, 5.47 },
+    { 0.4674777, 0.5463316, 0.6949722, 5.47 },
+    { -0.6769056, 0.1806015, 0.7135698, 5.47 },
+    { 0.4806017, 0.4798963, 0.7339765, 5.47 },
+    { 0.4021748, 0.5343982, 0.7434205, 5.47 },
+    { 0.0396637, 0.6438853, 0.7640932, 5.47 },
+    { -0.1962604, 0.5917905, 0.7818349, 5.47 },
+    { -0.4232241, 0.3497432, 0.8357996, 5.47 },
+    { -0.2625222, 0.3282587, 0.9073744, 5.47 },
+    { 0.3020393, -0.1313098, 0.9442087, 5.47 },
+    { -0.5038329, -0.0700732, -0.8609542, 5.48 },
+    { -0.3816861, 0.4573147, -0.8032303, 5.48 },
+    { -0.5682437, -0.2085945, -0.7959820, 5.48 },
+    { -0.1220295, -0.6757274, -0.7269809, 5.48 },
+    { -0.7514859, -0.0292249, -0.6591016, 5.48 },
+    { -0.5142428, 0.5629054, -0.6470641, 5.48 },
+    { -0.2427220, -0.7338894, -0.6344229, 5.48 },
+    { 0.0924600, 0.7769837, -0.6226937, 5.48 },
+    { -0.2263284, -0.8049843, -0.5484303, 5.48 },
+    { -0.8641003, -0.1679967, -0.4744553, 5.48 },
+    { -0.7640119, -0.4517454, -0.4606646, 5.48 },
+    { -0.7092263, 0.5446593, -0.4475983, 5.48 },
+    { -0.9693572, 0.0904863, -0.2283830, 5.48 },
+    { -0.4435407, 0.8710127, -0.2112073, 5.48 },
+    { -0.9757283, -0.1448662, -0.1642194, 5.48 },
+    { 0.5250448, 0.8459299, -0.0934374, 5.48 },
+    { 0.9210621, -0.3816726, 0.0772706, 5.48 },
+    { -0.4473740, -0.8900541, 0.0875228, 5.48 },
+    { 0.6897224, -0.6992274, 0.1880532, 5.48 },
+    { -0.9199339, 0.3059247, 0.2452176, 5.48 },
+    { 0.3659032, 0.8904852, 0.2704642, 5.48 },
+    { 0.2578744, 0.9200622, 0.2949345, 5.48 },
+    { 0.2104867, -0.9067856, 0.3652880, 5.48 },
+    { -0.9052461, -0.1169618, 0.4084721, 5.48 },
+    { 0.1229425, -0.8523275, 0.5083531, 5.48 },
+    { 0.8043323, 0.1322611, 0.5792725, 5.48 },
+    { 0.0282192, -0.8043846, 0.5934384, 5.48 },
+    { -0.5855455, -0.5388761, 0.6055980, 5.48 },
+    { 0.1328936, 0.7216887, 0.6793413, 5.48 },
+    { 0.1477255, -0.5444415, 0.8256880, 5.48 },
+    { -0.4738880, 0.2739809, 0.8368779, 5.48 },
+    { -0.4800341, 0.0582035, 0.8753169, 5.48 },
+    { -0.1118848, -0.2168312, 0.9697763, 5.48 },
+    { 0.0435040, -0.0061021, -0.9990346, 5.49 },
+    { -0.1725229, -0.2279367, -0.9582696, 5.49 },
+    { 0.0213671, -0.4689512, -0.8829656, 5.49 },
+    { 0.5653072, 0.2821501, -0.7751252, 5.49 },
+    { 0.1529604, -0.7068475, -0.6906300, 5.49 },
+    { -0.3871973, 0.7117715, -0.5860542, 5.49 },
+    { -0.3641522, -0.7768948, -0.5136415, 5.49 },
+    { 0.1345695, -0.9033463, -0.4072548, 5.49 },
+    { 0.4208189, -0.8670435, -0.2667338, 5.49 },
+    { 0.0438861, 0.9672241, -0.2501031, 5.49 },
+    { 0.7581108, -0.6128569, -0.2228777, 5.49 },
+    { -0.4432272, 0.8886185, -0.1179274, 5.49 },
+    { 0.7791536, -0.6237557, -0.0620362, 5.49 },
+    { 0.9974564, -0.0525291, -0.0481820, 5.49 },
+    { 0.3444162, -0.9386879, -0.0155711, 5.49 },
+    { -0.2969687, -0.9465162, 0.1261610, 5.49 },
+    { 0.7076167, 0.6569436, 0.2601993, 5.49 },
+    { 0.0521875, 0.9510757, 0.3045184, 5.49 },
+    { -0.8977747, 0.2986137, 0.3237752, 5.49 },
+    { 0.9004262, -0.2519761, 0.3545993, 5.49 },
+    { 0.3937599, -0.8098836, 0.4347893, 5.49 },
+    { 0.4854456, -0.7489507, 0.4510160, 5.49 },
+    { 0.4242217, -0.7449995, 0.5147929, 5.49 },
+    { 0.4200109, 0.7023318, 0.5747355, 5.49 },
+    { 0.6225633, -0.4234637, 0.6580983, 5.49 },
+    { 0.1263284, 0.1332737, 0.9829950, 5.49 },
+    { -0.1950971, -0.1187725, -0.9735657, 5.50 },
+    { -0.1189675, -0.3032641, -0.9454510, 5.50 },
+    { -0.1396376, 0.4929760, -0.8587642, 5.50 },
+    { -0.5114611, -0.0616181, -0.8570944, 5.50 },
+    { -0.6503514, 0.0713777, -0.7562726, 5.50 },
+    { -0.5575595, -0.4283841, -0.7110658, 5.50 },
+    { -0.5935976, 0.4233107, -0.6844340, 5.50 },
+    { -0.0254900, 0.7409066, -0.6711242, 5.50 },
+    { 0.5143471, -0.5796549, -0.6320184, 5.50 },
+    { 0.6775396, -0.3939484, -0.6210836, 5.50 },
+    { 0.8207350, 0.2293077, -0.5232705, 5.50 },
+    { 0.0136019, 0.8536015, -0.5207489, 5.50 },
+    { 0.2376539, -0.8231242, -0.5157394, 5.50 },
+    { 0.9050305, 0.1849401, -0.3830364, 5.50 },
+    { -0.0361486, 0.9236559, -0.3815141, 5.50 },
+    { -0.6053920, -0.6987799, -0.3810605, 5.50 },
+    { -0.5728958, -0.7666422, -0.2899140, 5.50 },
+    { 0.1375282, -0.9566957, -0.2565527, 5.50 },
+    { 0.1785621, 0.9557524, -0.2337796, 5.50 },
+    { -0.9506911, 0.2403485, -0.1960079, 5.50 },
+    { -0.4351699, -0.8885049, -0.1455545, 5.50 },
+    { 0.1954309, 0.9765911, 0.0898697, 5.50 },
+    { 0.9577218, 0.1993161, 0.2074659, 5.50 },
+    { -0.5828751, 0.7824737, 0.2190695, 5.50 },
+    { 0.1348631, 0.9523631, 0.2735260, 5.50 },
+    { 0.8773958, 0.3486919, 0.3295309, 5.50 },
+    { 0.4380036, 0.8339806, 0.3356027, 5.50 },
+    { 0.2046508, 0.8883850, 0.4109624, 5.50 },
+    { 0.5706814, 0.7066747, 0.4182507, 5.50 },
+    { -0.0365802, -0.8711119, 0.4897202, 5.50 },
+    { 0.8181274, 0.2300359, 0.5270209, 5.50 },
+    { 0.7184927, 0.4273175, 0.5487878, 5.50 },
+    { -0.7600744, 0.3378382, 0.5551146, 5.50 },
+    { -0.6984420, -0.3520316, 0.6230991, 5.50 },
+    { -0.4886195, -0.5960375, 0.6371737, 5.50 },
+    { -0.5013491, -0.0802769, 0.8615130, 5.50 },
+    { 0.3018855, -0.1560678, 0.9404829, 5.50 },
+    { -0.2930883, -0.1323085, 0.9468863, 5.50 },
+    { 0.1790281, -0.0742642, 0.9810371, 5.50 },
+    { -0.0924748, 0.0384502, 0.9949724, 5.50 },
+    { 0.1951110, -0.0932287, -0.9763402, 5.51 },
+    { 0.3467507, 0.0313280, -0.9374340, 5.51 },
+    { -0.3994491, -0.1223465, -0.9085548, 5.51 },
+    { -0.3523229, 0.5344864, -0.7682401, 5.51 },
+    { -0.4343203, 0.5073265, -0.7443022, 5.51 },
+    { 0.6610253, 0.1037655, -0.7431542, 5.51 },
+    { 0.6519055, -0.2191424, -0.7259448, 5.51 },
+    { 0.5786069, -0.4560271, -0.6762051, 5.51 },
+    { 0.7351692, 0.3155997, -0.5999359, 5.51 },
+    { 0.8406150, -0.2268278, -0.4918492, 5.51 },
+    { 0.2971847, 0.9093071, -0.2912764, 5.51 },
+    { -0.8740852, -0.4355092, -0.2151903, 5.51 },
+    { 0.3070415, -0.9276156, -0.2127320, 5.51 },
+    { 0.6875115, -0.7063666, -0.1684464, 5.51 },
+    { 0.8554911, 0.4961519, -0.1482170, 5.51 },
+    { 0.8214437, 0.5592128, -0.1118539, 5.51 },
+    { 0.2728308, 0.9578303, -0.0901353, 5.51 },
+    { -0.5983181, -0.8009911, -0.0207049, 5.51 },
+    { -0.2947460, -0.9553399, 0.0212235, 5.51 },
+    { 0.0464688, -0.9972353, 0.0579856, 5.51 },
+    { 0.9801981, 0.0429606, 0.1933031, 5.51 },
+    { 0.9724908, 0.0241917, 0.2316819, 5.51 },
+    { -0.8462146, 0.2953871, 0.4434719, 5.51 },
+    { -0.5583995, -0.6663106, 0.4941863, 5.51 },
+    { 0.5462221, -0.6449772, 0.5344585, 5.51 },
+    { -0.5698955, -0.5855335, 0.5765151, 5.51 },
+    { 0.3678961, 0.6963771, 0.6162073, 5.51 },
+    { -0.1273820, -0.7556706, 0.6424451, 5.51 },
+    { -0.3440393, -0.5045548, 0.7918721, 5.51 },
+    { 0.1343899, -0.5869754, 0.7983728, 5.51 },
+    { -0.3515302, 0.4846917, 0.8009372, 5.51 },
+    { 0.5371539, -0.0304273, 0.8429353, 5.51 },
+    { 0.3586303, -0.3604402, 0.8610849, 5.51 },
+    { -0.1175277, 0.0673576, -0.9907826, 5.52 },
+    { 0.1432743, 0.1647601, -0.9758722, 5.52 },
+    { 0.3508914, -0.0860736, -0.9324519, 5.52 },
+    { -0.1490671, -0.3870547, -0.9099273, 5.52 },
+    { -0.3957534, 0.1436743, -0.9070485, 5.52 },
+    { 0.5332829, 0.2557591, -0.8063477, 5.52 },
+    { -0.3905692, 0.4560265, -0.7996847, 5.52 },
+    { 0.5992704, -0.0879315, -0.7957029, 5.52 },
+    { -0.3833439, 0.6459661, -0.6601328, 5.52 },
+    { 0.5355635, -0.5793102, -0.6144684, 5.52 },
+    { 0.3788402, -0.7596698, -0.5285659, 5.52 },
+    { 0.3405500, -0.8234813, -0.4537667, 5.52 },
+    { 0.5845700, 0.7053695, -0.4009136, 5.52 },
+    { -0.0746764, 0.9369188, -0.3414770, 5.52 },
+    { -0.5646860, -0.7535396, -0.3366123, 5.52 },
+    { 0.0325421, -0.9549602, -0.2949443, 5.52 },
+    { -0.1583124, 0.9832029, -0.0908257, 5.52 },
+    { -0.7021789, -0.7103763, -0.0480653, 5.52 },
+    { -0.9727155, 0.2294779, 0.0341252, 5.52 },
+    { 0.9511884, 0.2924875, 0.0984461, 5.52 },
+    { 0.5114015, -0.8499525, 0.1266857, 5.52 },
+    { 0.0402322, 0.9681560, 0.2470939, 5.52 },
+    { -0.0755285, -0.9585217, 0.2748301, 5.52 },
+    { -0.9409643, 0.1218627, 0.3158096, 5.52 },
+    { 0.4366277, -0.7998489, 0.4118228, 5.52 },
+    { -0.0694862, -0.9068378, 0.4157125, 5.52 },
+    { 0.4809755, -0.7509370, 0.4525000, 5.52 },
+    { 0.5630643, 0.6842572, 0.4634120, 5.52 },
+    { 0.5668144, 0.6482749, 0.5083907, 5.52 },
+    { 0.1300831, 0.7424125, 0.6571926, 5.52 },
+    { -0.5559246, 0.2048301, 0.8056007, 5.52 },
+    { 0.5045880, 0.2682612, 0.8206259, 5.52 },
+    { 0.1593414, 0.5471347, 0.8217384, 5.52 },
+    { 0.4098484, -0.2676315, 0.8720078, 5.52 },
+    { -0.0690583, 0.1761411, -0.9819395, 5.53 },
+    { 0.2174785, 0.2218044, -0.9505293, 5.53 },
+    { -0.2040583, 0.2725679, -0.9402484, 5.53 },
+    { 0.2942162, -0.1860224, -0.9374607, 5.53 },
+    { 0.1309380, -0.3739003, -0.9181796, 5.53 },
+    { -0.3115729, 0.5131188, -0.7997696, 5.53 },
+    { 0.6382574, 0.0037128, -0.7698141, 5.53 },
+    { 0.5451848, -0.5154422, -0.6611300, 5.53 },
+    { 0.7441447, -0.1373644, -0.6537428, 5.53 },
+    { -0.0586755, 0.7886434, -0.6120448, 5.53 },
+    { -0.0743096, 0.8242879, -0.5612731, 5.53 },
+    { -0.1614448, -0.8176337, -0.5526398, 5.53 },
+    { 0.0378505, -0.8587635, -0.5109722, 5.53 },
+    { 0.8287634, -0.3710920, -0.4188579, 5.53 },
+    { 0.3079216, 0.8959600, -0.3200623, 5.53 },
+    { 0.2498671, -0.9424309, -0.2222396, 5.53 },
+    { 0.7698972, 0.6234505, -0.1362636, 5.53 },
+    { 0.5689319, 0.8173548, -0.0908170, 5.53 },
+    { -0.5399681, -0.8390466, -0.0665980, 5.53 },
+    { -0.7146075, -0.6995195, -0.0029234, 5.53 },
+    { 0.3326926, -0.9183624, 0.2143039, 5.53 },
+    { -0.1416544, 0.9592334, 0.2445511, 5.53 },
+    { -0.9627716, 0.0181717, 0.2697047, 5.53 },
+    { 0.4705491, -0.8337556, 0.2888512, 5.53 },
+    { 0.9491684, 0.0374588, 0.3125320, 5.53 },
+    { 0.9444831, -0.0911645, 0.3156592, 5.53 },
+    { 0.3622967, 0.8462361, 0.3906731, 5.53 },
+    { 0.7442060, -0.4627845, 0.4816513, 5.53 },
+    { 0.5683802, -0.4128008, 0.7117159, 5.53 },
+    { 0.6276831, -0.3135613, 0.7125259, 5.53 },
+    { 0.2478102, -0.5886422, 0.7694742, 5.53 },
+    { -0.2156979, -0.5633198, 0.7975871, 5.53 },
+    { 0.3924459, -0.2984543, 0.8700064, 5.53 },
+    { 0.1076238, 0.3084690, -0.9451264, 5.54 },
+    { 0.2994757, 0.3499292, -0.8876170, 5.54 },
+    { -0.3795046, 0.3389386, -0.8608698, 5.54 },
+    { -0.3818294, -0.4213460, -0.8226019, 5.54 },
+    { 0.1558936, -0.6692296, -0.7265184, 5.54 },
+    { -0.1994447, 0.6960641, -0.6897221, 5.54 },
+    { -0.0597495, -0.7969678, -0.6010593, 5.54 },
+    { -0.3207217, 0.7389316, -0.5925519, 5.54 },
+    { -0.7147584, -0.3862542, -0.5830336, 5.54 },
+    { -0.3852390, -0.7390672, -0.5526035, 5.54 },
+    { 0.4710831, 0.7249414, -0.5025342, 5.54 },
+    { -0.3270967, 0.8097267, -0.4871862, 5.54 },
+    { 0.2770535, -0.9022807, -0.3303497, 5.54 },
+    { -0.5241597, 0.8175359, -0.2385198, 5.54 },
+    { -0.5830341, 0.7829248, -0.2170255, 5.54 },
+    { -0.6753083, 0.7268762, -0.1249383, 5.54 },
+    { 0.8674266, -0.4844250, -0.1135934, 5.54 },
+    { -0.6357142, -0.7652243, -0.1014851, 5.54 },
+    { 0.8360541, 0.5470551, -0.0417642, 5.54 },
+    { 0.8402564, -0.5001979, 0.2092156, 5.54 },
+    { -0.8124423, -0.5381866, 0.2242604, 5.54 },
+    { -0.4943145, -0.8328778, 0.2489331, 5.54 },
+    { 0.0955275, 0.9513146, 0.2930444, 5.54 },
+    { -0.1355063, -0.9293827, 0.3433451, 5.54 },
+    { 0.5288272, -0.7409997, 0.4138372, 5.54 },
+    { -0.8904882, -0.0791933, 0.4480616, 5.54 },
+    { 0.6799438, 0.5098748, 0.5269764, 5.54 },
+    { -0.3186942, -0.7277579, 0.6072911, 5.54 },
+    { 0.1217850, 0.7444777, 0.6564461, 5.54 },
+    { 0.5881797, -0.1124544, 0.8008737, 5.54 },
+    { -0.1407133, 0.2018263, 0.9692605, 5.54 },
+    { -0.3019859, -0.0666008, -0.9509831, 5.55 },
+    { 0.3142916, 0.2085082, -0.9261453, 5.55 },
+    { 0.3528311, -0.1486276, -0.9238073, 5.55 },
+    { -0.1686760, -0.6113325, -0.7731888, 5.55 },
+    { -0.5368504, -0.4359631, -0.7223073, 5.55 },
+    { -0.5930276, 0.3906332, -0.7040767, 5.55 },
+    { -0.7277907, 0.0594197, -0.6832203, 5.55 },
+    { -0.5296867, 0.5234974, -0.6673698, 5.55 },
+    { 0.0824946, -0.8023355, -0.5911450, 5.55 },
+    { -0.0046103, 0.8298856, -0.5579145, 5.55 },
+    { -0.8345179, -0.0982610, -0.5421483, 5.55 },
+    { -0.1568048, -0.8271292, -0.5396939, 5.55 },
+    { 0.8604754, 0.1273907, -0.4933090, 5.55 },
+    { 0.8473061, -0.2218000, -0.4825734, 5.55 },
+    { 0.1174112, 0.9270251, -0.3561446, 5.55 },
+    { -0.8861889, -0.3801033, -0.2649353, 5.55 },
+    { -0.1077430, -0.9748771, -0.1949515, 5.55 },
+    { -0.9834207, -0.0031825, -0.1813107, 5.55 },
+    { -0.9438866, -0.2910162, -0.1561653, 5.55 },
+    { -0.4916537, -0.8584165, -0.1462797, 5.55 },
+    { 0.6793117, -0.7275481, -0.0959654, 5.55 },
+    { 0.9804155, -0.1755214, -0.0893183, 5.55 },
+    { 0.9794424, -0.1922847, -0.0609856, 5.55 },
+    { 0.5557744, 0.8313170, -0.0051783, 5.55 },
+    { -0.1186625, 0.9929229, -0.0048190, 5.55 },
+    { 0.3884678, 0.9211472, 0.0240973, 5.55 },
+    { -0.1188573, 0.9916143, 0.0507343, 5.55 },
+    { 0.9980787, -0.0350070, 0.0511212, 5.55 },
+    { -0.4801992, 0.8251615, 0.2975184, 5.55 },
+    { 0.8983506, 0.2824733, 0.3364151, 5.55 },
+    { 0.8943940, 0.2732438, 0.3541147, 5.55 },
+    { 0.2515991, -0.8409115, 0.4791302, 5.55 },
+    { -0.1071342, 0.8550042, 0.5074348, 5.55 },
+    { -0.2348039, 0.7902382, 0.5660306, 5.55 },
+    { 0.5008874, -0.5082637, 0.7005568, 5.55 },
+    { 0.2659381, 0.5715536, 0.7762754, 5.55 },
+    { 0.5633985, -0.0070270, 0.8261554, 5.55 },
+    { -0.5297333, -0.0483187, 0.8467868, 5.55 },
+    { 0.4794048, 0.1212743, 0.8691741, 5.55 },
+    { 0.4813882, 0.0033926, 0.8765009, 5.55 },
+    { 0.4142225, 0.1334447, 0.9003401, 5.55 },
+    { 0.2067984, -0.2950646, 0.9328297, 5.55 },
+    { -0.0337526, 0.3406111, -0.9395982, 5.56 },
+    { -0.4881358, 0.3301724, -0.8079045, 5.56 },
+    { -0.4951070, -0.3254508, -0.8055748, 5.56 },
+    { -0.5982196, -0.4195071, -0.6827497, 5.56 },
+    { -0.6679327, -0.4778770, -0.5705256, 5.56 },
+    { -0.7945724, 0.3307892, -0.5091495, 5.56 },
+    { 0.9213093, -0.2695915, -0.2801958, 5.56 },
+    { -0.0404068, 0.9669348, -0.2518024, 5.56 },
+    { -0.2136368, -0.9596893, -0.1826355, 5.56 },
+    { -0.8009813, 0.5897534, -0.1030529, 5.56 },
+    { 0.7074172, 0.7054865, -0.0430091, 5.56 },
+    { 0.6631958, 0.7394034, 0.1159913, 5.56 },
+    { 0.1867961, 0.9625145, 0.1966545, 5.56 },
+    { -0.7454758, -0.6351501, 0.2021141, 5.56 },
+    { -0.4175446, 0.8748782, 0.2454479, 5.56 },
+    { 0.3678677, -0.8950810, 0.2519985, 5.56 },
+    { -0.3078859, -0.9119041, 0.2713616, 5.56 },
+    { 0.8926665, 0.2631275, 0.3659378, 5.56 },
+    { -0.2151318, -0.9013134, 0.3759687, 5.56 },
+    { 0.0347967, 0.8825255, 0.4689754, 5.56 },
+    { -0.6938504, 0.5008112, 0.5174550, 5.56 },
+    { 0.2378424, -0.8164665, 0.5261306, 5.56 },
+    { -0.4715712, -0.6990563, 0.5375322, 5.56 },
+    { -0.3412714, 0.7441414, 0.5742712, 5.56 },
+    { -0.2852455, 0.6033949, 0.7446809, 5.56 },
+    { 0.5309481, -0.1097532, 0.8402668, 5.56 },
+    { 0.4823872, 0.2201590, 0.8478399, 5.56 },
+    { 0.4612978, -0.2607856, 0.8480537, 5.56 },
+    { 0.4913425, -0.0810292, 0.8671890, 5.56 },
+    { -0.0937386, -0.4462028, 0.8900091, 5.56 },
+    { 0.3212972, -0.0629923, 0.9448810, 5.56 },
+    { -0.1111761, -0.1995835, 0.9735534, 5.56 },
+    { -0.0765473, -0.1754567, 0.9815067, 5.56 },
+    { -0.0541842, -0.0797896, -0.9953380, 5.57 },
+    { 0.1305397, 0.1394162, -0.9815918, 5.57 },
+    { -0.3188033, 0.0753154, -0.9448238, 5.57 },
+    { -0.3872219, 0.2444881, -0.8889796, 5.57 },
+    { -0.4625158, 0.0047057, -0.8865986, 5.57 },
+    { -0.2465544, -0.4701651, -0.8474407, 5.57 },
+    { -0.5444995, 0.0186139, -0.8385546, 5.57 },
+    { 0.6036273, 0.0914602, -0.7920032, 5.57 },
+    { 0.5687911, -0.4232244, -0.7052360, 5.57 },
+    { -0.5391195, 0.4832574, -0.6897916, 5.57 },
+    { 0.6438442, 0.3704019, -0.6695275, 5.57 },
+    { 0.0171388, 0.7663225, -0.6422274, 5.57 },
+    { 0.1099326, 0.7885810, -0.6050246, 5.57 },
+    { 0.8959891, 0.1473067, -0.4189323, 5.57 },
+    { 0.9086712, 0.1932200, -0.3701116, 5.57 },
+    { -0.3142316, -0.8860743, -0.3407798, 5.57 },
+    { 0.5767364, 0.7935305, -0.1941250, 5.57 },
+    { -0.9096551, 0.3967649, -0.1229034, 5.57 },
+    { 0.2470818, -0.9679844, 0.0442350, 5.57 },
+    { 0.5732896, 0.8176156, 0.0533275, 5.57 },
+    { 0.2380325, -0.9644008, 0.1152025, 5.57 },
+    { -0.8911790, -0.4135621, 0.1864574, 5.57 },
+    { 0.8911940, 0.4019137, 0.2103300, 5.57 },
+    { 0.3117004, -0.9138512, 0.2602283, 5.57 },
+    { -0.9482569, 0.1433815, 0.2832854, 5.57 },
+    { -0.9350992, -0.0496413, 0.3508921, 5.57 },
+    { 0.7033434, -0.5845848, 0.4044363, 5.57 },
+    { 0.4256065, -0.8002233, 0.4224948, 5.57 },
+    { -0.5271451, 0.7094026, 0.4678313, 5.57 },
+    { 0.8345538, -0.1290211, 0.5356057, 5.57 },
+    { 0.4513497, 0.6514167, 0.6098686, 5.57 },
+    { 0.4488045, -0.4992286, 0.7411783, 5.57 },
+    { -0.4604506, -0.4828031, 0.7449070, 5.57 },
+    { 0.6119419, 0.0650197, 0.7882256, 5.57 },
+    { 0.4018258, 0.1299605, 0.9064471, 5.57 },
+    { 0.0420518, 0.0993291, 0.9941657, 5.57 },
+    { -0.0664696, -0.0313225, -0.9972967, 5.58 },
+    { -0.1636588, -0.4986889, -0.8511905, 5.58 },
+    { -0.5284233, 0.2275290, -0.8179239, 5.58 },
+    { 0.5691374, -0.3686737, -0.7349573, 5.58 },
+    { -0.5713563, 0.4716252, -0.6716559, 5.58 },
+    { -0.0338110, 0.7613124, -0.6475031, 5.58 },
+    { -0.4622464, 0.6707528, -0.5800164, 5.58 },
+    { -0.8020495, 0.3343408, -0.4949069, 5.58 },
+    { -0.2857616, 0.8436199, -0.4545831, 5.58 },
+    { 0.8094298, -0.4047140, -0.4254761, 5.58 },
+    { 0.3108461, 0.8553565, -0.4144153, 5.58 },
+    { -0.2503559, -0.8847390, -0.3931397, 5.58 },
+    { 0.3186142, -0.8678938, -0.3811107, 5.58 },
+    { 0.8464839, 0.3896218, -0.3628496, 5.58 },
+    { -0.9001582, -0.2571318, -0.3515657, 5.58 },
+    { -0.5432470, 0.7661690, -0.3433187, 5.58 },
+    { -0.8996286, 0.3680623, -0.2349437, 5.58 },
+    { -0.9645898, -0.1423164, -0.2220643, 5.58 },
+    { 0.8187938, -0.5392024, -0.1970723, 5.58 },
+    { 0.9446125, 0.2801873, -0.1708869, 5.58 },
+    { 0.8683304, -0.4958738, 0.0105590, 5.58 },
+    { 0.8236811, 0.5662230, 0.0306747, 5.58 },
+    { -0.5516463, -0.8286592, 0.0949230, 5.58 },
+    { 0.6648264, -0.7396280, 0.1046726, 5.58 },
+    { -0.9889296, 0.0213555, 0.1468408, 5.58 },
+    { 0.9107420, -0.3812837, 0.1586559, 5.58 },
+    { 0.6769177, -0.7031564, 0.2176086, 5.58 },
+    { 0.3679620, 0.8899108, 0.2695604, 5.58 },
+    { -0.0167456, -0.9239668, 0.3821060, 5.58 },
+    { 0.7517328, 0.5056825, 0.4233001, 5.58 },
+    { -0.5457441, -0.6691791, 0.5043439, 5.58 },
+    { 0.2593581, 0.8128375, 0.5215636, 5.58 },
+    { 0.7411465, -0.3889999, 0.5471571, 5.58 },
+    { -0.7616226, 0.3018739, 0.5734136, 5.58 },
+    { 0.0350199, -0.8034428, 0.5943511, 5.58 },
+    { 0.1855811, -0.7770799, 0.6014204, 5.58 },
+    { 0.4537205, -0.6572339, 0.6018150, 5.58 },
+    { 0.7389203, 0.2824501, 0.6117342, 5.58 },
+    { 0.4051050, -0.5674648, 0.7168498, 5.58 },
+    { -0.2205749, 0.6420990, 0.7342040, 5.58 },
+    { 0.3950481, 0.5096288, 0.7643399, 5.58 },
+    { -0.4875522, 0.1504678, 0.8600304, 5.58 },
+    { 0.3714679, 0.2210108, 0.9017571, 5.58 },
+    { -0.2987608, 0.3076926, 0.9033644, 5.58 },
+    { 0.2588806, -0.2999606, 0.9181527, 5.58 },
+    { 0.0464899, -0.0067380, 0.9988960, 5.58 },
+    { -0.3010394, 0.0474311, -0.9524314, 5.59 },
+    { 0.3182824, 0.0065119, -0.9479736, 5.59 },
+    { -0.3644284, 0.3921373, -0.8446421, 5.59 },
+    { 0.5405969, -0.0824256, -0.8372341, 5.59 },
+    { -0.2535525, 0.4917139, -0.8330237, 5.59 },
+    { 0.4324173, -0.6036695, -0.6697749, 5.59 },
+    { -0.7165854, -0.2142539, -0.6637776, 5.59 },
+    { -0.4893501, -0.5777369, -0.6532661, 5.59 },
+    { 0.7503894, 0.2056535, -0.6281898, 5.59 },
+    { -0.1232290, 0.7914039, -0.5987441, 5.59 },
+    { 0.2776026, -0.7661707, -0.5795854, 5.59 },
+    { -0.6359850, 0.5830792, -0.5055114, 5.59 },
+    { 0.4239396, 0.7777472, -0.4640954, 5.59 },
+    { -0.2284333, 0.8738678, -0.4291541, 5.59 },
+    { 0.3415526, -0.8635439, -0.3709901, 5.59 },
+    { 0.9495994, 0.2080309, -0.2344871, 5.59 },
+    { 0.5952769, 0.7729828, -0.2194153, 5.59 },
+    { -0.7778627, 0.6220718, -0.0891985, 5.59 },
+    { -0.5949673, 0.8007360, -0.0695388, 5.59 },
+    { -0.3796969, 0.9245133, -0.0332477, 5.59 },
+    { -0.1245220, -0.9910777, 0.0475316, 5.59 },
+    { -0.3948661, 0.9169441, 0.0573951, 5.59 },
+    { 0.3265336, -0.9414205, 0.0842812, 5.59 },
+    { -0.9763627, -0.1807452, 0.1185200, 5.59 },
+    { 0.4101487, 0.8791827, 0.2425197, 5.59 },
+    { 0.0322659, 0.9690294, 0.2448284, 5.59 },
+    { 0.5666543, -0.6930666, 0.4456024, 5.59 },
+    { 0.6337181, -0.5876089, 0.5031075, 5.59 },
+    { 0.8498144, -0.1466860, 0.5062596, 5.59 },
+    { -0.8085659, -0.0058508, 0.5883766, 5.59 },
+    { 0.4482199, 0.6677966, 0.5942614, 5.59 },
+    { 0.7587116, -0.0843495, 0.6459426, 5.59 },
+    { 0.7191389, -0.2048753, 0.6639770, 5.59 },
+    { 0.0505695, -0.7395536, 0.6711953, 5.59 },
+    { -0.7206341, 0.0683003, 0.6899432, 5.59 },
+    { -0.1190548, -0.6813051, 0.7222530, 5.59 },
+    { -0.5139407, -0.3895017, 0.7642993, 5.59 },
+    { 0.5233207, 0.3697438, 0.7677402, 5.59 },
+    { 0.3430810, 0.3311600, 0.8789929, 5.59 },
+    { 0.4351203, 0.0122332, 0.9002892, 5.59 },
+    { 0.3372443, 0.1614749, 0.9274655, 5.59 },
+    { -0.2104465, -0.1983639, -0.9572690, 5.60 },
+    { 0.0309806, -0.4520652, -0.8914467, 5.60 },
+    { -0.4219643, 0.2211492, -0.8792265, 5.60 },
+    { -0.2435400, 0.4314139, -0.8686601, 5.60 },
+    { -0.0841591, 0.6122935, -0.7861386, 5.60 },
+    { -0.6554671, 0.3213754, -0.6834331, 5.60 },
+    { -0.6940121, -0.3229230, -0.6434811, 5.60 },
+    { -0.3518846, 0.7279083, -0.5884953, 5.60 },
+    { -0.0236585, -0.8198575, -0.5720787, 5.60 },
+    { -0.3846550, 0.7421539, -0.5488607, 5.60 },
+    { 0.0936482, -0.8542287, -0.5113935, 5.60 },
+    { 0.8539560, -0.1957781, -0.4821101, 5.60 },
+    { 0.7145901, -0.5838013, -0.3854051, 5.60 },
+    { -0.8420728, 0.4517126, -0.2947358, 5.60 },
+    { -0.8622825, -0.4228797, -0.2786424, 5.60 },
+    { 0.3762759, 0.8985784, -0.2257725, 5.60 },
+    { 0.4898442, 0.8441906, -0.2177037, 5.60 },
+    { 0.5514075, 0.8141436, -0.1819886, 5.60 },
+    { -0.7252165, 0.6721272, -0.1493522, 5.60 },
+    { -0.1244980, 0.9846332, -0.1224650, 5.60 },
+    { -0.1400990, 0.9848435, -0.1022524, 5.60 },
+    { 0.1061802, 0.9783266, 0.1777718, 5.60 },
+    { 0.8457268, -0.4829322, 0.2269861, 5.60 },
+    { -0.8846563, -0.2636301, 0.3845549, 5.60 },
+    { -0.7613052, -0.1898388, 0.6199803, 5.60 },
+    { -0.7178940, -0.2624165, 0.6447991, 5.60 },
+    { 0.6206213, -0.3477609, 0.7027741, 5.60 },
+    { 0.5353280, -0.4283924, 0.7279450, 5.60 },
+    { 0.5982871, 0.0832503, 0.7969454, 5.60 },
+    { -0.5213032, -0.2269982, 0.8226267, 5.60 },
+    { 0.4530419, -0.1398501, 0.8804516, 5.60 },
+    { 0.0315020, 0.4103418, 0.9113875, 5.60 },
+    { 0.3326939, -0.0478281, 0.9418212, 5.60 },
+    { -0.2994484, -0.2197754, -0.9284554, 5.61 },
+    { -0.4330366, 0.0022772, -0.9013735, 5.61 },
+    { -0.0553186, 0.5510579, -0.8326314, 5.61 },
+    { -0.1159800, 0.5538168, -0.8245214, 5.61 },
+    { 0.1767487, 0.5685232, -0.8034558, 5.61 },
+    { -0.3872849, 0.4603639, -0.7987962, 5.61 },
+    { 0.2788137, -0.6461561, -0.7104543, 5.61 },
+    { 0.1558819, -0.7092398, -0.6875171, 5.61 },
+    { -0.6200010, -0.4131376, -0.6670202, 5.61 },
+    { 0.7575258, -0.1787464, -0.6278570, 5.61 },
+    { -0.4516607, -0.6871749, -0.5690284, 5.61 },
+    { -0.7900715, 0.2492981, -0.5600335, 5.61 },
+    { 0.2207661, 0.8836103, -0.4129106, 5.61 },
+    { 0.5879328, 0.6980690, -0.4086986, 5.61 },
+    { -0.3408446, 0.8544422, -0.3921141, 5.61 },
+    { 0.4713672, 0.8536895, -0.2214208, 5.61 },
+    { 0.9483255, 0.2484863, -0.1973151, 5.61 },
+    { 0.1495442, 0.9723614, -0.1793035, 5.61 },
+    { -0.4565058, 0.8752899, -0.1595936, 5.61 },
+    { -0.5885783, 0.8057887, -0.0654225, 5.61 },
+    { 0.9997385, -0.0227883, 0.0019058, 5.61 },
+    { 0.4800145, -0.8772475, 0.0047754, 5.61 },
+    { 0.6977224, 0.7123363, 0.0758977, 5.61 },
+    { 0.7177673, -0.6896480, 0.0958945, 5.61 },
+    { -0.9050133, 0.3970227, 0.1527218, 5.61 },
+    { 0.1066291, 0.9792157, 0.1725308, 5.61 },
+    { 0.1413967, -0.9053484, 0.4004388, 5.61 },
+    { -0.1082782, -0.8488631, 0.5174044, 5.61 },
+    { 0.5231643, 0.6489139, 0.5524580, 5.61 },
+    { 0.5105688, 0.6555407, 0.5564044, 5.61 },
+    { 0.6587171, 0.3094885, 0.6857905, 5.61 },
+    { 0.4471827, -0.4530684, 0.7712047, 5.61 },
+    { 0.0790246, 0.4525206, 0.8882456, 5.61 },
+    { 0.0532780, 0.0709179, 0.9960583, 5.61 },
+    { 0.3602653, -0.2295106, -0.9041758, 5.62 },
+    { 0.4440736, -0.2414929, -0.8628324, 5.62 },
+    { -0.5859611, 0.3685354, -0.7216864, 5.62 },
+    { 0.6343457, -0.2853086, -0.7184737, 5.62 },
+    { -0.0838584, 0.7972963, -0.5977344, 5.62 },
+    { -0.4243609, -0.7126012, -0.5586747, 5.62 },
+    { -0.1264961, 0.8317927, -0.5404810, 5.62 },
+    { 0.8704822, -0.0020327, -0.4921957, 5.62 },
+    { -0.4635310, -0.7676593, -0.4425361, 5.62 },
+    { -0.4003660, 0.8157451, -0.4174530, 5.62 },
+    { -0.1147984, -0.9883330, -0.1000959, 5.62 },
+    { -0.2748110, 0.9570113, -0.0927809, 5.62 },
+    { 0.8556970, 0.5125053, -0.0715603, 5.62 },
+    { -0.3124334, 0.9264622, 0.2098883, 5.62 },
+    { 0.6689839, 0.7074007, 0.2281333, 5.62 },
+    { 0.7746204, 0.5330033, 0.3403978, 5.62 },
+    { -0.8355670, -0.3942498, 0.3826158, 5.62 },
+    { 0.2071178, -0.8590741, 0.4680746, 5.62 },
+    { -0.1078542, -0.8729488, 0.4757394, 5.62 },
+    { -0.7611169, -0.3905112, 0.5178823, 5.62 },
+    { -0.4043243, -0.6930399, 0.5968397, 5.62 },
+    { 0.4702055, -0.6264162, 0.6216989, 5.62 },
+    { -0.6335607, 0.4354132, 0.6395437, 5.62 },
+    { 0.3199742, -0.6018800, 0.7316810, 5.62 },
+    { 0.4388569, -0.3102683, 0.8432901, 5.62 },
+    { -0.2058596, -0.2876787, 0.9353410, 5.62 },
+    { 0.1064814, 0.0259991, 0.9939747, 5.62 },
+    { -0.4321964, -0.1951514, -0.8804102, 5.63 },
+    { 0.5175247, -0.0744612, -0.8524222, 5.63 },
+    { -0.2332283, -0.4772813, -0.8472350, 5.63 },
+    { -0.2595937, 0.4737313, -0.8415401, 5.63 },
+    { -0.4366242, 0.3604594, -0.8242744, 5.63 },
+    { 0.6189536, -0.4906572, -0.6133123, 5.63 },
+    { 0.0257285, 0.7915402, -0.6105753, 5.63 },
+    { -0.6872652, 0.4940101, -0.5325603, 5.63 },
+    { -0.6716978, -0.6014916, -0.4324696, 5.63 },
+    { -0.0940172, 0.8970867, -0.4317364, 5.63 },
+    { -0.2383423, 0.8727537, -0.4260210, 5.63 },
+    { -0.9076991, -0.1206762, -0.4018949, 5.63 },
+    { -0.4367520, 0.8238826, -0.3611996, 5.63 },
+    { -0.3532047, 0.8838222, -0.3067651, 5.63 },
+    { 0.8818909, 0.3863431, -0.2701990, 5.63 },
+    { -0.6566432, -0.7541734, 0.0064960, 5.63 },
+    { -0.0216407, 0.9971323, 0.0725177, 5.63 },
+    { -0.3704722, -0.9238471, 0.0962125, 5.63 },
+    { 0.9889944, 0.0107664, 0.1475610, 5.63 },
+    { 0.8308273, 0.5362102, 0.1490123, 5.63 },
+    { -0.4639158, -0.8690637, 0.1717863, 5.63 },
+    { -0.8171481, 0.5388696, 0.2046669, 5.63 },
+    { 0.3169181, -0.9146005, 0.2511351, 5.63 },
+    { -0.7227084, -0.6399608, 0.2610418, 5.63 },
+    { -0.5197452, 0.7987214, 0.3031651, 5.63 },
+    { 0.6827885, 0.6618694, 0.3094006, 5.63 },
+    { 0.3450226, -0.8734312, 0.3436237, 5.63 },
+    { 0.4729041, 0.7938420, 0.3823305, 5.63 },
+    { 0.7715353, 0.4620051, 0.4373608, 5.63 },
+    { 0.0791730, -0.8636327, 0.4978656, 5.63 },
+    { 0.8288115, -0.0920989, 0.5518962, 5.63 },
+    { -0.3659221, -0.7166158, 0.5937700, 5.63 },
+    { 0.6534660, 0.4198399, 0.6298545, 5.63 },
+    { -0.6749138, -0.1995076, 0.7104140, 5.63 },
+    { -0.4651919, -0.4507361, 0.7618619, 5.63 },
+    { -0.5732368, 0.0625729, 0.8169970, 5.63 },
+    { 0.3928769, 0.1996344, 0.8976602, 5.63 },
+    { 0.1020080, -0.4059097, 0.9082024, 5.63 },
+    { -0.0277533, 0.1572158, -0.9871742, 5.64 },
+    { -0.4813732, -0.4670257, -0.7417323, 5.64 },
+    { 0.4336004, -0.5974199, -0.6745963, 5.64 },
+    { -0.7557730, 0.0901149, -0.6486034, 5.64 },
+    { 0.0962362, -0.7712129, -0.6292609, 5.64 },
+    { -0.7939809, 0.2783593, -0.5404724, 5.64 },
+    { -0.8660239, 0.1052925, -0.4887904, 5.64 },
+    { 0.8784103, -0.1499193, -0.4537836, 5.64 },
+    { -0.3886038, 0.8074440, -0.4438707, 5.64 },
+    { -0.2179276, 0.9198696, -0.3261095, 5.64 },
+    { 0.3903102, -0.8658998, -0.3128507, 5.64 },
+    { -0.5887976, -0.7553699, -0.2876345, 5.64 },
+    { -0.0913276, 0.9746933, -0.2040400, 5.64 },
+    { -0.9949095, 0.0389300, -0.0929494, 5.64 },
+    { -0.2353751, -0.9717799, -0.0155658, 5.64 },
+    { 0.8359241, -0.5468406, 0.0468643, 5.64 },
+    { -0.6374991, 0.7385162, 0.2195194, 5.64 },
+    { 0.1100927, 0.9627171, 0.2470939, 5.64 },
+    { 0.3916480, 0.8736662, 0.2886507, 5.64 },
+    { 0.9165490, -0.2756828, 0.2897186, 5.64 },
+    { -0.1094066, -0.9376895, 0.3298010, 5.64 },
+    { 0.3007369, -0.8822731, 0.3621484, 5.64 },
+    { 0.5036422, 0.7549061, 0.4200730, 5.64 },
+    { -0.4769402, 0.7264289, 0.4948020, 5.64 },
+    { -0.7172106, 0.4857942, 0.4996128, 5.64 },
+    { 0.4376348, -0.7240343, 0.5331511, 5.64 },
+    { -0.3683227, -0.7442630, 0.5571454, 5.64 },
+    { 0.7370390, 0.3517799, 0.5770826, 5.64 },
+    { -0.5483780, -0.5465379, 0.6329122, 5.64 },
+    { -0.0638694, 0.5513753, 0.8318088, 5.64 },
+    { -0.2865755, 0.4175942, 0.8622584, 5.64 },
+    { 0.3714377, -0.3350221, 0.8659066, 5.64 },
+    { -0.2703045, 0.3244435, 0.9064612, 5.64 },
+    { -0.1417662, 0.3385780, 0.9301974, 5.64 },
+    { 0.0279120, -0.2138265, 0.9764728, 5.64 },
+    { 0.1704100, 0.0555985, 0.9838035, 5.64 },
+    { -0.0959516, -0.0881857, 0.9914719, 5.64 },
+    { -0.0827089, -0.0840527, -0.9930229, 5.65 },
+    { -0.0839000, -0.0874736, -0.9926274, 5.65 },
+    { 0.0164716, 0.1647565, -0.9861967, 5.65 },
+    { -0.2424725, 0.0241379, -0.9698580, 5.65 },
+    { -0.1630563, -0.2336339, -0.9585551, 5.65 },
+    { -0.1819613, 0.2598396, -0.9483530, 5.65 },
+    { -0.1496885, -0.5596528, -0.8150963, 5.65 },
+    { 0.3371158, -0.5077997, -0.7927751, 5.65 },
+    { -0.2169960, -0.6099850, -0.7621228, 5.65 },
+    { -0.2218297, -0.6207267, -0.7519907, 5.65 },
+    { -0.4234315, -0.5127656, -0.7468449, 5.65 },
+    { -0.6103109, 0.2836908, -0.7396216, 5.65 },
+    { 0.1132425, -0.7718827, -0.6255983, 5.65 },
+    { -0.0160219, 0.8462972, -0.5324701, 5.65 },
+    { -0.5167558, 0.6705560, -0.5322764, 5.65 },
+    { -0.6299830, -0.6226218, -0.4641804, 5.65 },
+    { 0.8743516, -0.2338859, -0.4252138, 5.65 },
+    { 0.2442621, -0.8739407, -0.4201948, 5.65 },
+    { 0.3695692, -0.8297899, -0.4181714, 5.65 },
+    { 0.1476675, 0.9449583, -0.2919730, 5.65 },
+    { 0.9695085, -0.0948049, -0.2259765, 5.65 },
+    { 0.6079177, -0.7753399, -0.1711262, 5.65 },
+    { -0.8793001, 0.4532092, -0.1463991, 5.65 },
+    { 0.7711088, 0.6339417, -0.0592386, 5.65 },
+    { 0.4738163, -0.8789462, -0.0543296, 5.65 },
+    { -0.0678892, 0.9976528, -0.0089394, 5.65 },
+    { -0.8344261, 0.5502383, 0.0311597, 5.65 },
+    { -0.5028116, 0.8602004, 0.0850638, 5.65 },
+    { 0.1105766, -0.9839969, 0.1397242, 5.65 },
+    { 0.8595265, -0.4904981, 0.1436169, 5.65 },
+    { -0.9087389, -0.3727790, 0.1876951, 5.65 },
+    { -0.2122956, 0.9492727, 0.2319738, 5.65 },
+    { 0.6685908, -0.6659026, 0.3309985, 5.65 },
+    { 0.3989194, 0.8399977, 0.3677869, 5.65 },
+    { -0.2351194, -0.8925453, 0.3848140, 5.65 },
+    { -0.2061341, 0.8928649, 0.4003761, 5.65 },
+    { -0.1566195, -0.8619995, 0.4821071, 5.65 },
+    { 0.7786056, -0.3223896, 0.5383664, 5.65 },
+    { 0.6496567, -0.4405607, 0.6195583, 5.65 },
+    { 0.7075370, 0.2241489, 0.6701856, 5.65 },
+    { -0.2627055, -0.6484938, 0.7144520, 5.65 },
+    { -0.2830742, 0.6318818, 0.7215223, 5.65 },
+    { -0.0744682, -0.4936848, 0.8664466, 5.65 },
+    { 0.4612010, -0.0876417, -0.8829567, 5.66 },
+    { -0.2988842, 0.4711479, -0.8298722, 5.66 },
+    { -0.2237026, 0.6473083, -0.7286626, 5.66 },
+    { 0.4170214, -0.7198459, -0.5549009, 5.66 },
+    { 0.7859274, -0.2904960, -0.5458298, 5.66 },
+    { -0.8665023, -0.1859202, -0.4632574, 5.66 },
+    { -0.7399327, 0.5718334, -0.3542684, 5.66 },
+    { -0.3735318, 0.8660290, -0.3323669, 5.66 },
+    { 0.1244271, -0.9388390, -0.3210905, 5.66 },
+    { 0.2522733, 0.9256728, -0.2819363, 5.66 },
+    { 0.9222033, -0.3009186, -0.2428767, 5.66 },
+    { -0.9316662, 0.2746600, -0.2378234, 5.66 },
+    { 0.9050174, 0.3604246, -0.2259151, 5.66 },
+    { 0.0225225, 0.9787014, -0.2040499, 5.66 },
+    { -0.1990093, 0.9641569, -0.1754903, 5.66 },
+    { -0.6483571, 0.7409385, 0.1750522, 5.66 },
+    { 0.3949871, -0.8738843, 0.2833929, 5.66 },
+    { 0.5527152, -0.7491701, 0.3650343, 5.66 },
+    { -0.8088879, 0.4538564, 0.3737843, 5.66 },
+    { -0.8985809, -0.0465154, 0.4363355, 5.66 },
+    { -0.5769077, 0.6155443, 0.5369197, 5.66 },
+    { 0.4632424, -0.6907101, 0.5552711, 5.66 },
+    { -0.7567086, -0.0533351, 0.6515730, 5.66 },
+    { 0.3799468, 0.5968269, 0.7067093, 5.66 },
+    { 0.3856357, 0.5825676, 0.7154719, 5.66 },
+    { 0.1951337, 0.6299356, 0.7517340, 5.66 },
+    { -0.3959265, -0.4722100, 0.7875658, 5.66 },
+    { -0.3799755, 0.4594339, 0.8028319, 5.66 },
+    { 0.1305515, -0.5164081, 0.8463326, 5.66 },
+    { 0.3977690, -0.3359530, 0.8537654, 5.66 },
+    { 0.2538981, 0.0512525, 0.9658721, 5.66 },
+    { -0.3087147, -0.1213495, -0.9433820, 5.67 },
+    { -0.3869266, 0.1823214, -0.9039064, 5.67 },
+    { -0.3097631, -0.3797164, -0.8717008, 5.67 },
+    { -0.0022411, 0.6263769, -0.7795172, 5.67 },
+    { -0.6536496, 0.1613988, -0.7393867, 5.67 },
+    { -0.1595247, -0.7548764, -0.6361710, 5.67 },
+    { -0.6163565, -0.5218913, -0.5896898, 5.67 },
+    { 0.8510118, 0.0600621, -0.5217005, 5.67 },
+    { 0.3215337, -0.8065271, -0.4961151, 5.67 },
+    { -0.3983792, -0.7841046, -0.4758929, 5.67 },
+    { 0.1082032, 0.9886013, -0.1046881, 5.67 },
+    { 0.4254450, -0.9049194, -0.0108402, 5.67 },
+    { -0.7131237, 0.7009876, -0.0084264, 5.67 },
+    { 0.8243345, -0.5656584, 0.0224309, 5.67 },
+    { -0.0215871, 0.9952950, 0.0944558, 5.67 },
+    { 0.8113265, -0.5758785, 0.1005648, 5.67 },
+    { 0.5264648, 0.8425457, 0.1138048, 5.67 },
+    { 0.9827393, 0.1398507, 0.1211003, 5.67 },
+    { -0.9214636, 0.3581671, 0.1504034, 5.67 },
+    { -0.9660493, -0.1981924, 0.1657361, 5.67 },
+    { 0.4858120, 0.8566482, 0.1736105, 5.67 },
+    { -0.9291266, -0.3132348, 0.1964886, 5.67 },
+    { -0.6739111, 0.6882544, 0.2686069, 5.67 },
+    { 0.4932100, -0.8249105, 0.2761639, 5.67 },
+    { 0.4570361, -0.7982306, 0.3923594, 5.67 },
+    { -0.6102602, -0.6567000, 0.4430886, 5.67 },
+    { 0.6959225, 0.3863710, 0.6053175, 5.67 },
+    { 0.4846309, -0.5677224, 0.6654504, 5.67 },
+    { -0.0001932, -0.7008919, 0.7132674, 5.67 },
+    { 0.4696775, -0.4870878, 0.7363074, 5.67 },
+    { 0.6583170, 0.1292760, 0.7415567, 5.67 },
+    { 0.2236913, 0.6264820, 0.7466475, 5.67 },
+    { -0.0989814, -0.5876584, 0.8030319, 5.67 },
+    { -0.5260994, 0.1628931, 0.8346768, 5.67 },
+    { 0.4432482, 0.2787912, 0.8519428, 5.67 },
+    { -0.1932594, -0.4329649, 0.8804500, 5.67 },
+    { 0.3879698, 0.0079575, 0.9216377, 5.67 },
+    { 0.2128908, -0.1961550, -0.9571837, 5.68 },
+    { 0.4481399, -0.0609556, -0.8918828, 5.68 },
+    { 0.6093246, -0.1600669, -0.7765965, 5.68 },
+    { 0.3824943, 0.5102687, -0.7702752, 5.68 },
+    { -0.2750313, 0.6013917, -0.7501239, 5.68 },
+    { 0.8330874, 0.0293044, -0.5523646, 5.68 },
+    { 0.2827442, 0.8114158, -0.5115272, 5.68 },
+    { 0.6274518, -0.5953255, -0.5018882, 5.68 },
+    { -0.9027700, -0.0923368, -0.4200954, 5.68 },
+    { -0.6740595, -0.6139476, -0.4107458, 5.68 },
+    { -0.5434178, 0.7416824, -0.3931976, 5.68 },
+    { -0.5139817, 0.8108816, -0.2798104, 5.68 },
+    { -0.3712607, -0.8938930, -0.2512384, 5.68 },
+    { 0.2060704, 0.9567507, -0.2053364, 5.68 },
+    { 0.5164445, -0.8562311, -0.0123809, 5.68 },
+    { 0.1670655, 0.9859190, -0.0072673, 5.68 },
+    { 0.9940281, -0.1027740, 0.0366820, 5.68 },
+    { 0.3642126, 0.9262467, 0.0970377, 5.68 },
+    { 0.7571817, 0.6166168, 0.2155449, 5.68 },
+    { 0.9274640, 0.2707263, 0.2579104, 5.68 },
+    { -0.2497600, 0.9278538, 0.2769606, 5.68 },
+    { -0.9434370, -0.1535287, 0.2938633, 5.68 },
+    { 0.8020844, -0.4933339, 0.3365744, 5.68 },
+    { -0.8862436, 0.2012750, 0.4172058, 5.68 },
+    { 0.6988488, -0.5630604, 0.4411047, 5.68 },
+    { 0.5518709, -0.6636017, 0.5050457, 5.68 },
+    { 0.6483856, -0.5400476, 0.5366047, 5.68 },
+    { 0.1456369, 0.6667608, 0.7309035, 5.68 },
+    { -0.0869628, 0.3170218, 0.9444229, 5.68 },
+    { 0.2208546, -0.0889285, 0.9712440, 5.68 },
+    { 0.0001160, -0.1735760, 0.9848205, 5.68 },
+    { 0.0830392, 0.0376101, -0.9958363, 5.69 },
+    { -0.0930030, 0.1276209, -0.9874530, 5.69 },
+    { 0.0731844, 0.1534081, -0.9854491, 5.69 },
+    { -0.0985883, 0.3189642, -0.9426251, 5.69 },
+    { 0.3144464, 0.2110507, -0.9255166, 5.69 },
+    { -0.2030466, -0.4798207, -0.8535480, 5.69 },
+    { 0.2179960, -0.5409062, -0.8123412, 5.69 },
+    { -0.3688555, 0.4717740, -0.8008588, 5.69 },
+    { -0.4413301, -0.4899747, -0.7517663, 5.69 },
+    { 0.6604705, 0.0882277, -0.7456505, 5.69 },
+    { -0.6957364, -0.2773414, -0.6625954, 5.69 },
+    { -0.1203666, 0.8391765, -0.5303723, 5.69 },
+    { 0.7916744, 0.3530558, -0.4986012, 5.69 },
+    { -0.8065752, -0.3448588, -0.4801134, 5.69 },
+    { -0.2709435, 0.8630661, -0.4262705, 5.69 },
+    { 0.2174171, -0.9055785, -0.3642217, 5.69 },
+    { 0.7570393, -0.5558464, -0.3434038, 5.69 },
+    { -0.4549721, 0.8528466, -0.2562285, 5.69 },
+    { 0.3532500, -0.9041738, -0.2401753, 5.69 },
+    { -0.7503316, -0.6609431, 0.0125171, 5.69 },
+    { -0.9365185, -0.3487215, 0.0364204, 5.69 },
+    { 0.0431195, -0.9975866, 0.0544220, 5.69 },
+    { 0.6377447, 0.7675753, 0.0641075, 5.69 },
+    { -0.0846162, 0.9637766, 0.2529325, 5.69 },
+    { -0.1100710, -0.9533866, 0.2809599, 5.69 },
+    { -0.7785084, 0.5602233, 0.2829744, 5.69 },
+    { 0.2303587, -0.9221498, 0.3107644, 5.69 },
+    { 0.1092726, 0.9417821, 0.3179717, 5.69 },
+    { -0.4168988, -0.8498540, 0.3224029, 5.69 },
+    { 0.5321863, 0.7766216, 0.3371003, 5.69 },
+    { 0.7135171, 0.6113790, 0.3422119, 5.69 },
+    { -0.0473150, -0.9350742, 0.3512798, 5.69 },
+    { -0.9263845, -0.1208096, 0.3566746, 5.69 },
+    { 0.2369158, -0.8646839, 0.4429365, 5.69 },
+    { -0.1297436, 0.7618669, 0.6346065, 5.69 },
+    { 0.3524196, -0.6725315, 0.6507702, 5.69 },
+    { 0.6219571, -0.4259360, 0.6570753, 5.69 },
+    { -0.4870107, -0.4450462, 0.7515015, 5.69 },
+    { 0.5678723, 0.3231209, 0.7570429, 5.69 },
+    { 0.3895938, -0.5215474, 0.7590817, 5.69 },
+    { 0.5022793, -0.4140220, 0.7591451, 5.69 },
+    { 0.2534790, -0.3580344, 0.8986433, 5.69 },
+    { -0.2923647, 0.2004734, 0.9350579, 5.69 },
+    { 0.1229232, 0.1601676, -0.9794061, 5.70 },
+    { -0.1443532, -0.2656720, -0.9531949, 5.70 },
+    { 0.4435609, 0.1057359, -0.8899852, 5.70 },
+    { -0.0713139, -0.4504915, -0.8899279, 5.70 },
+    { -0.4590358, 0.0191326, -0.8882117, 5.70 },
+    { -0.0721304, 0.5136711, -0.8549498, 5.70 },
+    { 0.5427698, 0.1000409, -0.8339021, 5.70 },
+    { -0.2746187, 0.5138033, -0.8127673, 5.70 },
+    { 0.6548217, 0.0180530, -0.7555677, 5.70 },
+    { -0.3526854, 0.5581088, -0.7510843, 5.70 },
+    { 0.6442314, -0.1823087, -0.7427850, 5.70 },
+    { 0.0884453, -0.6733978, -0.7339706, 5.70 },
+    { -0.0927998, -0.8374988, -0.5385016, 5.70 },
+    { -0.1855442, 0.8302756, -0.5255624, 5.70 },
+    { 0.6249858, -0.6427525, -0.4430147, 5.70 },
+    { -0.7337572, 0.5282142, -0.4273057, 5.70 },
+    { -0.7978956, 0.4406892, -0.4112855, 5.70 },
+    { -0.1497627, 0.9355224, -0.3199516, 5.70 },
+    { 0.9301886, 0.1965373, -0.3100358, 5.70 },
+    { 0.2675155, 0.9194938, -0.2880393, 5.70 },
+    { -0.3260210, 0.9022422, -0.2822577, 5.70 },
+    { -0.3940454, 0.8843636, -0.2502584, 5.70 },
+    { -0.9132146, 0.3480837, -0.2118418, 5.70 },
+    { 0.7692104, -0.6161527, -0.1693256, 5.70 },
+    { 0.4532462, 0.8780998, -0.1533255, 5.70 },
+    { -0.6623325, 0.7483565, -0.0357522, 5.70 },
+    { 0.9470455, 0.3206493, -0.0169967, 5.70 },
+    { 0.1577058, 0.9874822, -0.0027872, 5.70 },
+    { 0.0047362, 0.9751045, 0.2216951, 5.70 },
+    { -0.9477824, -0.2053644, 0.2439959, 5.70 },
+    { -0.8376724, -0.4511116, 0.3079014, 5.70 },
+    { 0.7936260, 0.5086525, 0.3338119, 5.70 },
+    { -0.6067611, -0.7129944, 0.3513973, 5.70 },
+    { -0.4176607, -0.8164719, 0.3986641, 5.70 },
+    { -0.8725981, -0.0667917, 0.4838506, 5.70 },
+    { 0.7681297, -0.4188921, 0.4842583, 5.70 },
+    { 0.1614355, -0.8332307, 0.5288338, 5.70 },
+    { -0.8190067, 0.0368501, 0.5725995, 5.70 },
+    { -0.5579810, -0.4608165, 0.6901488, 5.70 },
+    { 0.6352832, -0.1473768, 0.7580866, 5.70 },
+    { -0.5201022, -0.2819519, 0.8062238, 5.70 },
+    { -0.5198698, -0.2608844, 0.8134339, 5.70 },
+    { -0.5592657, -0.0676419, 0.8262242, 5.70 },
+    { 0.4820338, 0.2081703, 0.8510632, 5.70 },
+    { 0.4978277, -0.1109702, 0.8601472, 5.70 },
+    { 0.2051593, 0.4248329, 0.8817180, 5.70 },
+    { -0.3334991, -0.1826141, -0.9248948, 5.71 },
+    { -0.0109084, 0.4059571, -0.9138270, 5.71 },
+    { -0.2654070, -0.3383391, -0.9028210, 5.71 },
+    { 0.4406640, 0.2097141, -0.8728317, 5.71 },
+    { -0.3973342, 0.4143423, -0.8188076, 5.71 },
+    { -0.5696465, -0.1731759, -0.8034382, 5.71 },
+    { -0.5375603, -0.2955360, -0.7897388, 5.71 },
+    { 0.6585509, 0.0030895, -0.7525299, 5.71 },
+    { -0.6732744, 0.0730816, -0.7357721, 5.71 },
+    { -0.6003827, 0.3668594, -0.7106017, 5.71 },
+    { -0.4543831, 0.5386981, -0.7094648, 5.71 },
+    { 0.2760759, -0.6714869, -0.6876682, 5.71 },
+    { -0.2440888, -0.7160843, -0.6539449, 5.71 },
+    { 0.3970583, 0.6504019, -0.6475508, 5.71 },
+    { 0.1223876, 0.7598446, -0.6384806, 5.71 },
+    { -0.1291817, 0.7882184, -0.6016841, 5.71 },
+    { 0.5013220, 0.6391117, -0.5832774, 5.71 },
+    { -0.8025318, 0.2179240, -0.5553844, 5.71 },
+    { -0.1485980, 0.8489856, -0.5070917, 5.71 },
+    { -0.8641233, 0.2076172, -0.4584604, 5.71 },
+    { 0.6405293, 0.6383066, -0.4269506, 5.71 },
+    { -0.2650459, 0.8754325, -0.4041888, 5.71 },
+    { -0.0394081, 0.9211950, -0.3871003, 5.71 },
+    { 0.6135088, 0.7227010, -0.3182925, 5.71 },
+    { 0.4931459, -0.8373892, -0.2357678, 5.71 },
+    { 0.1992997, -0.9640411, -0.1757963, 5.71 },
+    { 0.4746252, -0.8684778, -0.1430987, 5.71 },
+    { 0.8506601, -0.5204015, -0.0745630, 5.71 },
+    { 0.7625227, 0.6468475, -0.0121438, 5.71 },
+    { -0.7014822, -0.7126828, -0.0024541, 5.71 },
+    { 0.5849682, 0.8109914, 0.0102590, 5.71 },
+    { -0.9854990, -0.1665660, 0.0323649, 5.71 },
+    { -0.0749780, 0.9932146, 0.0888996, 5.71 },
+    { -0.7812699, 0.6077268, 0.1424269, 5.71 },
+    { -0.5307178, -0.8117044, 0.2438741, 5.71 },
+    { 0.9108201, -0.3275638, 0.2512145, 5.71 },
+    { 0.8065976, 0.5291045, 0.2635312, 5.71 },
+    { -0.1479731, -0.9483247, 0.2806853, 5.71 },
+    { -0.6866294, -0.6700253, 0.2821456, 5.71 },
+    { 0.9312598, -0.2034306, 0.3022765, 5.71 },
+    { 0.7083873, -0.5737431, 0.4111038, 5.71 },
+    { -0.0661005, -0.9088028, 0.4119566, 5.71 },
+    { -0.2875564, 0.8356968, 0.4678913, 5.71 },
+    { 0.4452772, -0.7438333, 0.4984377, 5.71 },
+    { 0.0215044, -0.8456350, 0.5333283, 5.71 },
+    { -0.1812079, 0.8226686, 0.5388692, 5.71 },
+    { 0.6188693, 0.4995734, 0.6061577, 5.71 },
+    { 0.2128106, 0.7048276, 0.6767050, 5.71 },
+    { 0.6560556, -0.3244566, 0.6814096, 5.71 },
+    { 0.4767337, -0.2978476, 0.8270501, 5.71 },
+    { 0.5115532, -0.2023399, 0.8350880, 5.71 },
+    { 0.2308304, 0.4792921, 0.8467564, 5.71 },
+    { -0.2636087, 0.3789715, 0.8870688, 5.71 },
+    { -0.3379989, -0.0223635, 0.9408808, 5.71 },
+    { 0.4309904, -0.0297599, -0.9018656, 5.72 },
+    { -0.4826608, -0.1098723, -0.8688882, 5.72 },
+    { -0.4711261, 0.2406332, -0.8486082, 5.72 },
+    { -0.5465238, 0.3321126, -0.7687736, 5.72 },
+    { -0.2696698, 0.6005213, -0.7527632, 5.72 },
+    { -0.2191734, 0.6478442, -0.7295621, 5.72 },
+    { 0.1007416, -0.7182500, -0.6884534, 5.72 },
+    { 0.7223464, 0.3447350, -0.5994777, 5.72 },
+    { -0.0410490, 0.8888341, -0.4563867, 5.72 },
+    { 0.2992462, 0.8824363, -0.3629847, 5.72 },
+    { 0.2671734, 0.9212672, -0.2826396, 5.72 },
+    { 0.3546507, -0.8982045, -0.2597143, 5.72 },
+    { 0.9677526, -0.0399045, -0.2487218, 5.72 },
+    { -0.6151424, -0.7587572, -0.2142135, 5.72 },
+    { 0.1342831, -0.9730793, -0.1873094, 5.72 },
+    { -0.6214416, 0.7710556, -0.1388654, 5.72 },
+    { 0.3643192, 0.9238516, -0.1173448, 5.72 },
+    { 0.1013748, 0.9892218, -0.1056566, 5.72 },
+    { 0.9566369, -0.2780049, -0.0869437, 5.72 },
+    { 0.9890584, 0.1303876, -0.0690112, 5.72 },
+    { 0.4544414, 0.8855617, 0.0962473, 5.72 },
+    { -0.9939109, -0.0436420, 0.1011759, 5.72 },
+    { 0.4470389, -0.8707624, 0.2047661, 5.72 },
+    { 0.6213736, -0.7489023, 0.2303045, 5.72 },
+    { 0.4020149, 0.8827365, 0.2432290, 5.72 },
+    { 0.0539620, 0.9666938, 0.2501824, 5.72 },
+    { -0.0534572, -0.9511754, 0.3039864, 5.72 },
+    { 0.3631932, 0.8557663, 0.3684491, 5.72 },
+    { 0.5915354, 0.6433556, 0.4859829, 5.72 },
+    { -0.2585765, -0.8282839, 0.4970753, 5.72 },
+    { 0.3814861, 0.7405675, 0.5531981, 5.72 },
+    { -0.7955618, 0.2319981, 0.5596948, 5.72 },
+    { 0.7529944, 0.0444498, 0.6565240, 5.72 },
+    { -0.2520840, 0.6172509, 0.7452885, 5.72 },
+    { 0.2663526, -0.3817661, 0.8850486, 5.72 },
+    { -0.2463669, 0.1808203, 0.9521593, 5.72 },
+    { -0.0300285, -0.1686510, 0.9852183, 5.72 },
+    { 0.1362265, -0.0014592, -0.9906766, 5.73 },
+    { 0.0887440, -0.4119364, -0.9068809, 5.73 },
+    { -0.3180530, -0.3678406, -0.8738052, 5.73 },
+    { -0.1282968, -0.5185365, -0.8453755, 5.73 },
+    { -0.3054036, -0.4845654, -0.8197103, 5.73 },
+    { -0.5898809, -0.1333822, -0.7963980, 5.73 },
+    { 0.3756927, 0.5636640, -0.7356207, 5.73 },
+    { -0.5770154, 0.3651265, -0.7305722, 5.73 },
+    { -0.3315538, 0.7132118, -0.6175767, 5.73 },
+    { -0.3783800, -0.7062169, -0.5984031, 5.73 },
+    { -0.8122822, -0.0902622, -0.5762382, 5.73 },
+    { 0.4958090, -0.7400018, -0.4545006, 5.73 },
+    { 0.7264969, -0.5269443, -0.4410577, 5.73 },
+    { 0.2123253, 0.8721508, -0.4407618, 5.73 },
+    { -0.6860151, -0.5922926, -0.4225787, 5.73 },
+    { -0.6993802, 0.6298445, -0.3378807, 5.73 },
+    { 0.0687701, 0.9455071, -0.3182562, 5.73 },
+    { -0.6972707, 0.6441462, -0.3144665, 5.73 },
+    { 0.0988560, -0.9730857, -0.2081625, 5.73 },
+    { 0.9769599, -0.0543419, -0.2063887, 5.73 },
+    { 0.6036979, 0.7728151, -0.1957184, 5.73 },
+    { -0.9103401, -0.4030350, -0.0940407, 5.73 },
+    { -0.5929903, 0.8043737, 0.0366820, 5.73 },
+    { -0.0390693, 0.9982845, 0.0436087, 5.73 },
+    { 0.0416138, -0.9967039, 0.0696399, 5.73 },
+    { 0.1210717, -0.9867621, 0.1078986, 5.73 },
+    { -0.4624938, -0.8741150, 0.1483996, 5.73 },
+    { -0.2159403, 0.8773336, 0.4285506, 5.73 },
+    { -0.4864338, 0.7602268, 0.4306244, 5.73 },
+    { -0.7519127, 0.4358546, 0.4946292, 5.73 },
+    { -0.8476403, 0.0683050, 0.5261562, 5.73 },
+    { 0.3350735, 0.7569105, 0.5610813, 5.73 },
+    { 0.1539122, -0.7772571, 0.6100676, 5.73 },
+    { -0.3322118, 0.7104615, 0.6203868, 5.73 },
+    { 0.7188261, -0.2763934, 0.6378837, 5.73 },
+    { -0.5748005, -0.4985228, 0.6489063, 5.73 },
+    { -0.0028574, 0.6703961, 0.7419979, 5.73 },
+    { 0.2504851, -0.5738154, 0.7797391, 5.73 },
+    { 0.4383492, -0.4007591, 0.8045136, 5.73 },
+    { 0.0593240, 0.5786800, 0.8133942, 5.73 },
+    { -0.3226356, 0.3418437, 0.8826376, 5.73 },
+    { -0.0365448, 0.2047475, 0.9781324, 5.73 },
+    { -0.3678927, -0.0357454, -0.9291810, 5.74 },
+    { 0.3324821, 0.2927574, -0.8965204, 5.74 },
+    { -0.2391192, 0.4300097, -0.8705824, 5.74 },
+    { -0.4953736, 0.1018812, -0.8626849, 5.74 },
+    { -0.1650105, -0.4957017, -0.8526731, 5.74 },
+    { 0.3603086, 0.4021108, -0.8417153, 5.74 },
+    { 0.2708568, -0.5060636, -0.8188627, 5.74 },
+    { -0.5056052, -0.4492321, -0.7365826, 5.74 },
+    { -0.6548063, 0.2646974, -0.7079294, 5.74 },
+    { -0.5919304, -0.4824951, -0.6456136, 5.74 },
+    { 0.2141303, -0.7555229, -0.6191393, 5.74 },
+    { -0.0037466, -0.8001126, -0.5998381, 5.74 },
+    { -0.8288654, 0.0849854, -0.5529554, 5.74 },
+    { -0.1053193, 0.8380057, -0.5354010, 5.74 },
+    { -0.6655212, -0.6509694, -0.3651305, 5.74 },
+    { -0.2229513, 0.9103498, -0.3486488, 5.74 },
+    { -0.3854874, 0.8589191, -0.3371313, 5.74 },
+    { -0.7541310, 0.5665263, -0.3321662, 5.74 },
+    { -0.9610817, -0.1376380, -0.2395366, 5.74 },
+    { -0.2131746, 0.9762096, -0.0396416, 5.74 },
+    { -0.3349351, -0.9420157, 0.0206128, 5.74 },
+    { 0.3586616, -0.9058565, 0.2253573, 5.74 },
+    { -0.2588980, 0.9289896, 0.2644809, 5.74 },
+    { -0.9556198, 0.1270896, 0.2657800, 5.74 },
+    { 0.9177809, 0.2228267, 0.3286739, 5.74 },
+    { -0.1436045, -0.9095081, 0.3900933, 5.74 },
+    { 0.8018989, 0.4438139, 0.3999843, 5.74 },
+    { -0.8289435, -0.3733458, 0.4164919, 5.74 },
+    { 0.1234900, 0.8553306, 0.5031498, 5.74 },
+    { -0.7862076, 0.1767530, 0.5921452, 5.74 },
+    { 0.7739435, -0.2228691, 0.5927401, 5.74 },
+    { -0.0879815, -0.7467482, 0.6592620, 5.74 },
+    { -0.4875761, 0.5012404, 0.7148620, 5.74 },
+    { -0.5124843, -0.4667815, 0.7207461, 5.74 },
+    { -0.5084603, -0.4068438, 0.7589112, 5.74 },
+    { 0.5975576, 0.0657251, 0.7991277, 5.74 },
+    { -0.5161774, 0.2843436, 0.8079045, 5.74 },
+    { -0.3403357, -0.4682242, 0.8154372, 5.74 },
+    { -0.2311414, -0.5217335, 0.8211990, 5.74 },
+    { 0.4753446, 0.0352234, 0.8790943, 5.74 },
+    { 0.0752653, -0.4551543, 0.8872259, 5.74 },
+    { 0.0521906, 0.2831234, 0.9576624, 5.74 },
+    { 0.1939476, -0.0129854, -0.9809260, 5.75 },
+    { -0.3107889, -0.1648843, -0.9360681, 5.75 },
+    { 0.1760821, -0.3090546, -0.9346017, 5.75 },
+    { -0.1630227, -0.3383268, -0.9268002, 5.75 },
+    { -0.3287876, -0.2231151, -0.9176701, 5.75 },
+    { -0.2126531, -0.3645266, -0.9065864, 5.75 },
+    { 0.1807288, 0.4245604, -0.8871784, 5.75 },
+    { 0.4510206, -0.3928783, -0.8013907, 5.75 },
+    { 0.2362913, -0.5506663, -0.8005829, 5.75 },
+    { -0.0852192, -0.6055992, -0.7911936, 5.75 },
+    { 0.6096476, -0.0959634, -0.7868423, 5.75 },
+    { -0.4619679, 0.5161607, -0.7212238, 5.75 },
+    { -0.5363248, 0.4405422, -0.7199154, 5.75 },
+    { -0.7148354, -0.0277637, -0.6987414, 5.75 },
+    { -0.4922576, 0.6533171, -0.5752036, 5.75 },
+    { 0.6723566, 0.5452162, -0.5006754, 5.75 },
+    { -0.2339854, -0.8756649, -0.4224473, 5.75 },
+    { 0.2279090, 0.8932813, -0.3874351, 5.75 },
+    { 0.0881726, -0.9421946, -0.3232568, 5.75 },
+    { -0.6573808, 0.6854694, -0.3130211, 5.75 },
+    { -0.5532575, 0.7762831, -0.3021434, 5.75 },
+    { 0.0715296, -0.9516922, -0.2986059, 5.75 },
+    { 0.8854809, 0.4211448, -0.1963688, 5.75 },
+    { -0.0934330, -0.9774160, -0.1895477, 5.75 },
+    { -0.3739780, 0.9099484, -0.1792606, 5.75 },
+    { 0.9839985, 0.0640994, -0.1662472, 5.75 },
+    { 0.9872156, -0.0308448, -0.1563775, 5.75 },
+    { 0.7733382, 0.6190715, -0.1367424, 5.75 },
+    { 0.6972153, 0.7043511, -0.1333428, 5.75 },
+    { 0.8969242, -0.4321024, -0.0938858, 5.75 },
+    { -0.9289272, -0.3591566, -0.0900049, 5.75 },
+    { -0.3173254, 0.9458727, -0.0680395, 5.75 },
+    { -0.3566141, -0.9333708, -0.0405624, 5.75 },
+    { -0.2092083, 0.9776001, -0.0230223, 5.75 },
+    { 0.1633236, -0.9865578, -0.0053998, 5.75 },
+    { 0.9154428, -0.3950896, 0.0766078, 5.75 },
+    { 0.9736488, 0.2086574, 0.0920336, 5.75 },
+    { -0.2891662, 0.9484071, 0.1300263, 5.75 },
+    { 0.9448638, -0.2567278, 0.2032810, 5.75 },
+    { 0.8314159, -0.4445091, 0.3334056, 5.75 },
+    { -0.0493336, 0.9396421, 0.3385837, 5.75 },
+    { -0.8507173, -0.3997498, 0.3412920, 5.75 },
+    { -0.0390482, 0.9189011, 0.3925507, 5.75 },
+    { -0.5605350, 0.7206334, 0.4080295, 5.75 },
+    { -0.2247903, -0.8741015, 0.4305995, 5.75 },
+    { 0.8903168, 0.0084301, 0.4552635, 5.75 },
+    { -0.6211031, 0.5284452, 0.5787717, 5.75 },
+    { -0.3806730, -0.6304890, 0.6764405, 5.75 },
+    { 0.7248787, -0.1047047, 0.6808729, 5.75 },
+    { -0.3968779, -0.5577911, 0.7289424, 5.75 },
+    { 0.5151783, -0.3849009, 0.7657954, 5.75 },
+    { 0.2275693, -0.5673001, 0.7914435, 5.75 },
+    { 0.1660845, 0.5803361, 0.7972615, 5.75 },
+    { -0.0412269, -0.5891411, 0.8069778, 5.75 },
+    { -0.4199408, 0.4055079, 0.8119194, 5.75 },
+    { -0.5551691, 0.0830903, 0.8275768, 5.75 },
+    { 0.4379454, 0.3009868, 0.8471191, 5.75 },
+    { 0.2543153, -0.3931805, 0.8835909, 5.75 },
+    { 0.4126899, -0.1963753, 0.8894514, 5.75 },
+    { -0.3462424, 0.1229428, 0.9300545, 5.75 },
+    { 0.0846732, -0.0986270, 0.9915156, 5.75 },
+    { -0.2636878, -0.2865031, -0.9210780, 5.76 },
+    { 0.1963387, -0.3387593, -0.9201593, 5.76 },
+    { 0.3221361, -0.2989591, -0.8982493, 5.76 },
+    { -0.2535671, -0.4224239, -0.8702079, 5.76 },
+    { -0.4816665, -0.1142233, -0.8688788, 5.76 },
+    { 0.0699591, -0.5323825, -0.8436081, 5.76 },
+    { 0.5044530, 0.2346861, -0.8309330, 5.76 },
+    { -0.5863837, 0.1202202, -0.8010626, 5.76 },
+    { 0.4431386, -0.4417551, -0.7800517, 5.76 },
+    { -0.0746975, 0.6626322, -0.7452106, 5.76 },
+    { -0.3739093, 0.5757699, -0.7271044, 5.76 },
+    { -0.1283381, -0.7061988, -0.6962849, 5.76 },
+    { -0.7765895, -0.0455315, -0.6283595, 5.76 },
+    { -0.3312089, 0.7119269, -0.6192420, 5.76 },
+    { -0.5252023, 0.5995914, -0.6038648, 5.76 },
+    { 0.1596775, 0.7933411, -0.5874632, 5.76 },
+    { 0.5514513, -0.6491276, -0.5239607, 5.76 },
+    { -0.6045916, -0.6615904, -0.4435844, 5.76 },
+    { -0.9022535, 0.1202134, -0.4141104, 5.76 },
+    { 0.1414101, -0.9561839, -0.2563503, 5.76 },
+    { 0.8889722, -0.3936985, -0.2339441, 5.76 },
+    { 0.9106667, 0.3946225, -0.1223077, 5.76 },
+    { -0.4704253, 0.8773548, -0.0945968, 5.76 },
+    { -0.8074001, -0.4598250, 0.3696837, 5.76 },
+    { -0.3497567, -0.8573004, 0.3777649, 5.76 },
+    { 0.5023308, 0.7582692, 0.4155617, 5.76 },
+    { -0.3194850, 0.8262806, 0.4638854, 5.76 },
+    { 0.1465006, 0.8573264, 0.4934865, 5.76 },
+    { 0.3352983, 0.7586372, 0.5586096, 5.76 },
+    { 0.3835589, -0.7005473, 0.6017608, 5.76 },
+    { -0.6845986, 0.3113591, 0.6590753, 5.76 },
+    { 0.6760247, -0.2256372, 0.7014831, 5.76 },
+    { 0.3460599, 0.5627608, 0.7506949, 5.76 },
+    { 0.4964530, -0.4184967, 0.7605228, 5.76 },
+    { 0.3224963, -0.4674275, 0.8231086, 5.76 },
+    { -0.4467048, -0.3506239, 0.8231146, 5.76 },
+    { 0.2821830, 0.4133226, 0.8657581, 5.76 },
+    { 0.0651632, -0.0264524, -0.9975239, 5.77 },
+    { 0.0871093, 0.0050697, -0.9961859, 5.77 },
+    { 0.0973780, -0.1232006, -0.9875926, 5.77 },
+    { -0.4107019, 0.1417104, -0.9006898, 5.77 },
+    { -0.3673100, 0.2936092, -0.8825401, 5.77 },
+    { -0.0759612, -0.4838577, -0.8718438, 5.77 },
+    { -0.2569918, -0.4257611, -0.8675729, 5.77 },
+    { -0.2406075, -0.5184630, -0.8205511, 5.77 },
+    { -0.3215315, -0.5052619, -0.8008295, 5.77 },
+    { -0.4478237, -0.4778509, -0.7557198, 5.77 },
+    { -0.6036021, -0.3202211, -0.7301527, 5.77 },
+    { -0.6413129, -0.2364710, -0.7299310, 5.77 },
+    { -0.7029893, -0.1072748, -0.7030635, 5.77 },
+    { 0.0216410, -0.7259560, -0.6874006, 5.77 },
+    { 0.0216410, -0.7259560, -0.6874006, 5.77 },
+    { -0.2107894, -0.7228705, -0.6580472, 5.77 },
+    { 0.7390059, -0.1470751, -0.6574490, 5.77 },
+    { 0.5873151, -0.4738479, -0.6561472, 5.77 },
+    { -0.3232828, 0.7894057, -0.5218494, 5.77 },
+    { -0.3573229, 0.8161158, -0.4541754, 5.77 },
+    { -0.6643252, -0.5979424, -0.4484829, 5.77 },
+    { -0.7848164, -0.4531216, -0.4227813, 5.77 },
+    { 0.0076710, -0.9219623, -0.3872036, 5.77 },
+    { -0.1188183, 0.9464656, -0.3001416, 5.77 },
+    { 0.2943937, 0.9133904, -0.2811590, 5.77 },
+    { -0.7178626, 0.6624729, -0.2140160, 5.77 },
+    { 0.0271874, -0.9961926, -0.0828324, 5.77 },
+    { 0.8052506, -0.5888518, -0.0694624, 5.77 },
+    { -0.2199712, 0.9754607, -0.0094387, 5.77 },
+    { 0.9987662, -0.0459724, 0.0187806, 5.77 },
+    { 0.9932938, 0.1105520, 0.0338476, 5.77 },
+    { -0.9923349, 0.1114536, 0.0533817, 5.77 },
+    { -0.3384535, -0.9381018, 0.0735810, 5.77 },
+    { -0.8897018, 0.4493972, 0.0804546, 5.77 },
+    { -0.0293385, -0.9939024, 0.1062882, 5.77 },
+    { 0.4174987, 0.9023796, 0.1067987, 5.77 },
+    { -0.2260100, 0.9631607, 0.1457430, 5.77 },
+    { -0.1547412, -0.9758950, 0.1538966, 5.77 },
+    { 0.5917142, 0.7895234, 0.1628716, 5.77 },
+    { -0.9310506, -0.3049814, 0.2003275, 5.77 },
+    { -0.4181259, 0.8779678, 0.2331163, 5.77 },
+    { -0.6959493, -0.6733627, 0.2494740, 5.77 },
+    { 0.7264040, 0.6345110, 0.2640699, 5.77 },
+    { 0.1293102, -0.9478888, 0.2911799, 5.77 },
+    { 0.1328104, 0.9457982, 0.2963564, 5.77 },
+    { 0.7968415, -0.5000031, 0.3391762, 5.77 },
+    { 0.2613930, -0.8734834, 0.4107317, 5.77 },
+    { -0.0892536, -0.9069503, 0.4116734, 5.77 },
+    { 0.5992711, -0.6456266, 0.4733291, 5.77 },
+    { 0.4377768, 0.6998768, 0.5643792, 5.77 },
+    { 0.7746304, -0.1334945, 0.6181641, 5.77 },
+    { 0.3541160, -0.6990349, 0.6212504, 5.77 },
+    { -0.7188853, 0.2973795, 0.6283067, 5.77 },
+    { -0.2446061, 0.6604443, 0.7099164, 5.77 },
+    { 0.1557757, -0.6391973, 0.7531008, 5.77 },
+    { 0.2205883, 0.5461809, 0.8081010, 5.77 },
+    { 0.4332984, 0.3735081, 0.8202098, 5.77 },
+    { -0.2597735, 0.4439034, 0.8575940, 5.77 },
+    { -0.1829060, -0.0729214, 0.9804223, 5.77 },
+    { 0.0307897, 0.2782751, -0.9600078, 5.78 },
+    { 0.3066686, -0.1346578, -0.9422429, 5.78 },
+    { 0.0812922, -0.4219462, -0.9029690, 5.78 },
+    { -0.3401906, 0.3590766, -0.8690998, 5.78 },
+    { -0.2273844, 0.4404792, -0.8684898, 5.78 },
+    { -0.0182488, -0.4971784, -0.8674564, 5.78 },
+    { -0.5533294, 0.2774890, -0.7853830, 5.78 },
+    { 0.4480733, 0.5835019, -0.6773152, 5.78 },
+    { -0.4500445, 0.6785270, -0.5805695, 5.78 },
+    { 0.0956799, 0.8121344, -0.5755719, 5.78 },
+    { -0.0707798, 0.8221048, -0.5649194, 5.78 },
+    { 0.0902871, 0.8330307, -0.5458095, 5.78 },
+    { -0.8163122, -0.3668945, -0.4461197, 5.78 },
+    { -0.3294466, 0.8425779, -0.4260605, 5.78 },
+    { -0.5346248, -0.7481459, -0.3930064, 5.78 },
+    { -0.0281901, 0.9279747, -0.3715753, 5.78 },
+    { 0.7328102, -0.5764223, -0.3615613, 5.78 },
+    { 0.6573491, -0.6878866, -0.3077404, 5.78 },
+    { 0.9585054, 0.0181044, -0.2844988, 5.78 },
+    { -0.7357694, 0.6198323, -0.2728577, 5.78 },
+    { -0.3525948, 0.9050785, -0.2377179, 5.78 },
+    { -0.4593801, -0.8604043, -0.2206227, 5.78 },
+    { -0.3076326, 0.9312855, -0.1951141, 5.78 },
+    { 0.7550739, 0.6347350, -0.1642404, 5.78 },
+    { 0.2209675, 0.9635745, -0.1506570, 5.78 },
+    { 0.3050030, 0.9472057, -0.0988663, 5.78 },
+    { 0.9104951, -0.4048320, -0.0843194, 5.78 },
+    { 0.1308380, 0.9909120, 0.0312223, 5.78 },
+    { -0.2789342, 0.9469487, 0.1596366, 5.78 },
+    { -0.9401828, -0.2928651, 0.1740296, 5.78 },
+    { 0.8700444, -0.4499139, 0.2014949, 5.78 },
+    { -0.4701460, 0.8395921, 0.2721174, 5.78 },
+    { 0.1453705, -0.9387652, 0.3123897, 5.78 },
+    { 0.8200515, -0.4367714, 0.3697923, 5.78 },
+    { -0.8522306, -0.3318925, 0.4044137, 5.78 },
+    { 0.7837781, -0.4291504, 0.4489118, 5.78 },
+    { -0.2734090, 0.8492114, 0.4517605, 5.78 },
+    { -0.8661644, -0.1892107, 0.4625565, 5.78 },
+    { 0.2954528, 0.8266448, 0.4789217, 5.78 },
+    { -0.3802893, -0.7862006, 0.4871024, 5.78 },
+    { -0.0452724, 0.8403553, 0.5401420, 5.78 },
+    { -0.5029365, 0.6281605, 0.5936912, 5.78 },
+    { -0.2524873, 0.7126381, 0.6545206, 5.78 },
+    { 0.4267816, -0.5369458, 0.7276996, 5.78 },
+    { 0.5250177, -0.2975152, 0.7973964, 5.78 },
+    { 0.3628832, -0.4161024, 0.8337713, 5.78 },
+    { 0.4425191, 0.2142279, 0.8707946, 5.78 },
+    { 0.3174283, 0.2607424, 0.9117306, 5.78 },
+    { 0.1105966, 0.0994011, 0.9888821, 5.78 },
+    { 0.0613241, 0.1329685, -0.9892213, 5.79 },
+    { -0.1206554, 0.1364721, -0.9832689, 5.79 },
+    { -0.0922715, -0.3417550, -0.9352484, 5.79 },
+    { -0.1858723, 0.3582658, -0.9149301, 5.79 },
+    { -0.3889335, -0.1817381, -0.9031622, 5.79 },
+    { 0.1681955, 0.4246337, -0.8896047, 5.79 },
+    { -0.3443406, 0.3420594, -0.8743140, 5.79 },
+    { -0.4304212, 0.2710464, -0.8609712, 5.79 },
+    { -0.5407918, 0.0877462, -0.8365673, 5.79 },
+    { -0.0557507, -0.6807156, -0.7304233, 5.79 },
+    { -0.5098597, 0.4608829, -0.7263814, 5.79 },
+    { -0.4345476, 0.5708033, -0.6966721, 5.79 },
+    { -0.7050246, -0.2261782, -0.6721486, 5.79 },
+    { 0.7269453, -0.1812759, -0.6623364, 5.79 },
+    { -0.2182299, 0.7237443, -0.6546525, 5.79 },
+    { -0.5174576, -0.5558852, -0.6505607, 5.79 },
+    { -0.7739476, -0.0804860, -0.6281140, 5.79 },
+    { -0.3105303, -0.7337420, -0.6043125, 5.79 },
+    { 0.6376499, 0.5208743, -0.5675320, 5.79 },
+    { 0.7830175, 0.3122669, -0.5379340, 5.79 },
+    { 0.4270840, 0.8346238, -0.3478540, 5.79 },
+    { -0.2083747, 0.9328871, -0.2937716, 5.79 },
+    { 0.2301437, -0.9314169, -0.2819512, 5.79 },
+    { -0.3664636, 0.9086077, -0.2003408, 5.79 },
+    { 0.8892799, -0.4295269, -0.1571240, 5.79 },
+    { -0.9426300, 0.2958465, -0.1546725, 5.79 },
+    { 0.4723446, -0.8687133, -0.1490900, 5.79 },
+    { -0.9641728, -0.2568094, -0.0664809, 5.79 },
+    { 0.1329101, 0.9893034, -0.0601146, 5.79 },
+    { -0.1783233, 0.9839340, 0.0086446, 5.79 },
+    { -0.9413478, 0.3271290, 0.0827700, 5.79 },
+    { -0.8285751, 0.5475549, 0.1168200, 5.79 },
+    { -0.9702692, 0.1972712, 0.1402206, 5.79 },
+    { 0.9860626, 0.0645435, 0.1533447, 5.79 },
+    { 0.9861159, -0.0372228, 0.1618330, 5.79 },
+    { 0.0564773, 0.9846031, 0.1654296, 5.79 },
+    { 0.3359686, 0.9004670, 0.2761961, 5.79 },
+    { 0.2449554, 0.8804704, 0.4059171, 5.79 },
+    { 0.7470163, 0.5027638, 0.4349657, 5.79 },
+    { 0.8236669, -0.3446740, 0.4503028, 5.79 },
+    { 0.5941487, 0.6612419, 0.4579808, 5.79 },
+    { -0.1458182, 0.8625141, 0.4845683, 5.79 },
+    { 0.7487140, 0.3843456, 0.5400979, 5.79 },
+    { 0.8360706, 0.0759351, 0.5433413, 5.79 },
+    { -0.7156563, -0.2447908, 0.6541510, 5.79 },
+    { 0.7308843, -0.1292917, 0.6701431, 5.79 },
+    { -0.2456468, -0.6414944, 0.7267342, 5.79 },
+    { 0.5579315, 0.2971473, 0.7748651, 5.79 },
+    { 0.3563193, 0.4091768, 0.8400065, 5.79 },
+    { 0.5026537, 0.1550091, 0.8504772, 5.79 },
+    { 0.4888129, 0.0784158, 0.8688572, 5.79 },
+    { 0.2696460, -0.4094771, 0.8715615, 5.79 },
+    { 0.4007962, -0.2033978, 0.8933038, 5.79 },
+    { -0.2844236, -0.3470031, 0.8936957, 5.79 },
+    { -0.2634692, -0.3462547, 0.9003842, 5.79 },
+    { -0.0240850, -0.3054636, 0.9518991, 5.79 },
+    { -0.2813981, -0.1110374, 0.9531452, 5.79 },
+    { 0.2362505, -0.0892518, 0.9675845, 5.79 },
+    { -0.0067207, -0.0524630, 0.9986003, 5.79 },
+    { -0.0523106, 0.4929774, -0.8684681, 5.80 },
+    { -0.4444226, 0.3082012, -0.8411305, 5.80 },
+    { -0.0883878, -0.5444406, -0.8341295, 5.80 },
+    { -0.5468906, -0.0717527, -0.8341236, 5.80 },
+    { -0.1213415, 0.5978165, -0.7923961, 5.80 },
+    { -0.3960190, 0.4896176, -0.7768163, 5.80 },
+    { 0.6615160, 0.1338657, -0.7378866, 5.80 },
+    { -0.6999887, 0.1448179, -0.6993165, 5.80 },
+    { -0.7580412, -0.1201297, -0.6410479, 5.80 },
+    { -0.2571465, 0.7412347, -0.6200377, 5.80 },
+    { -0.3357010, 0.7304400, -0.5947791, 5.80 },
+    { -0.4115978, -0.6942778, -0.5903944, 5.80 },
+    { -0.3548742, 0.7263125, -0.5886717, 5.80 },
+    { -0.0193606, 0.8137473, -0.5808963, 5.80 },
+    { -0.1692288, 0.8407643, -0.5142732, 5.80 },
+    { -0.0127118, -0.8823204, -0.4704776, 5.80 },
+    { 0.2825439, -0.8539797, -0.4369069, 5.80 },
+    { 0.8429776, 0.4523243, -0.2911897, 5.80 },
+    { 0.6192392, -0.7344483, -0.2777203, 5.80 },
+    { -0.7086671, -0.6747464, -0.2061752, 5.80 },
+    { 0.9385442, -0.2803348, -0.2013633, 5.80 },
+    { -0.1532397, 0.9880670, 0.0155328, 5.80 },
+    { 0.3784972, -0.9249766, 0.0340327, 5.80 },
+    { 0.1644277, 0.9754377, 0.1465770, 5.80 },
+    { 0.0427883, 0.9842663, 0.1714324, 5.80 },
+    { 0.8559850, -0.4778214, 0.1974245, 5.80 },
+    { -0.9687469, 0.1491837, 0.1981758, 5.80 },
+    { -0.7963101, -0.5445979, 0.2632553, 5.80 },
+    { 0.4927178, -0.8191847, 0.2935398, 5.80 },
+    { 0.8717285, 0.3877228, 0.2996005, 5.80 },
+    { 0.5473538, -0.7791176, 0.3055808, 5.80 },
+    { 0.6670954, 0.6560498, 0.3529623, 5.80 },
+    { -0.0458221, 0.9093835, 0.4134271, 5.80 },
+    { 0.8607293, 0.2727219, 0.4298463, 5.80 },
+    { -0.8800077, 0.0913345, 0.4660950, 5.80 },
+    { -0.6472890, -0.5929917, 0.4789340, 5.80 },
+    { 0.6669380, -0.5204211, 0.5332500, 5.80 },
+    { 0.7106875, -0.0698928, 0.7000273, 5.80 },
+    { -0.2235835, 0.5752919, 0.7867971, 5.80 },
+    { -0.1373164, -0.5646683, 0.8138145, 5.80 },
+    { 0.4703296, -0.2857209, 0.8349573, 5.80 },
+    { -0.5119918, 0.1769887, 0.8405590, 5.80 },
+    { 0.2776243, 0.4518091, 0.8478168, 5.80 },
+    { 0.4798872, 0.0106873, 0.8772651, 5.80 },
+    { 0.2138482, 0.3231349, 0.9218746, 5.80 },
+    { 0.2634438, 0.2456188, 0.9328820, 5.80 },
+    { -0.2264931, -0.0051909, 0.9739989, 5.80 },
+    { 0.2169159, -0.0253620, -0.9758608, 5.81 },
+    { -0.2254118, -0.2554959, -0.9401656, 5.81 },
+    { -0.3220877, 0.1685475, -0.9315853, 5.81 },
+    { -0.2416072, 0.4234036, -0.8731297, 5.81 },
+    { -0.5039364, 0.2386757, -0.8301096, 5.81 },
+    { 0.4588527, 0.3210082, -0.8284974, 5.81 },
+    { -0.2538432, -0.5056827, -0.8245294, 5.81 },
+    { -0.5932979, 0.0865836, -0.8003130, 5.81 },
+    { 0.1492530, -0.6808692, -0.7170360, 5.81 },
+    { 0.3549997, -0.6099189, -0.7085013, 5.81 },
+    { 0.0043075, 0.7189098, -0.6950900, 5.81 },
+    { -0.6970747, 0.1868132, -0.6922338, 5.81 },
+    { 0.7156041, -0.1587936, -0.6802171, 5.81 },
+    { -0.8245227, 0.1832075, -0.5353478, 5.81 },
+    { -0.0230719, 0.8678176, -0.4963470, 5.81 },
+    { -0.8660038, 0.1053028, -0.4888238, 5.81 },
+    { -0.8042372, -0.3992917, -0.4401917, 5.81 },
+    { 0.1533717, -0.9041087, -0.3988291, 5.81 },
+    { -0.6883320, -0.6095909, -0.3931896, 5.81 },
+    { -0.0772780, 0.9308395, -0.3571637, 5.81 },
+    { 0.5067516, 0.7847959, -0.3567887, 5.81 },
+    { 0.8391257, -0.4415641, -0.3176306, 5.81 },
+    { 0.3715006, 0.9267434, -0.0559817, 5.81 },
+    { -0.6221673, 0.7819835, -0.0375453, 5.81 },
+    { -0.3991099, 0.9150152, 0.0588079, 5.81 },
+    { -0.9556959, 0.2739278, 0.1077444, 5.81 },
+    { 0.7684898, 0.6255664, 0.1344998, 5.81 },
+    { -0.1090072, -0.9799908, 0.1665398, 5.81 },
+    { 0.2668502, 0.9281456, 0.2594933, 5.81 },
+    { -0.5375508, -0.7814959, 0.3167069, 5.81 },
+    { 0.3464608, -0.8741870, 0.3402382, 5.81 },
+    { 0.3436323, -0.8404724, 0.4189547, 5.81 },
+    { 0.2415035, 0.8731534, 0.4234138, 5.81 },
+    { -0.6158412, -0.6638365, 0.4243355, 5.81 },
+    { 0.7531311, 0.2417013, 0.6118611, 5.81 },
+    { 0.4574469, 0.6158695, 0.6414414, 5.81 },
+    { 0.7305388, -0.2159904, 0.6478127, 5.81 },
+    { 0.6806566, -0.2026916, 0.7040047, 5.81 },
+    { 0.4405588, -0.4545215, 0.7741564, 5.81 },
+    { 0.1793794, -0.5828105, 0.7925623, 5.81 },
+    { -0.5974036, -0.0456837, 0.8006384, 5.81 },
+    { -0.2970790, -0.4767061, 0.8273424, 5.81 },
+    { -0.5446214, -0.0597736, 0.8365492, 5.81 },
+    { 0.3112733, 0.1308952, 0.9412626, 5.81 },
+    { -0.0624350, 0.5261957, -0.8480684, 5.82 },
+    { -0.3591796, 0.5574187, -0.7485148, 5.82 },
+    { 0.4762603, 0.4886033, -0.7310561, 5.82 },
+    { 0.0702624, 0.7547857, -0.6521976, 5.82 },
+    { -0.4551472, -0.6152468, -0.6436711, 5.82 },
+    { -0.5340606, 0.5687168, -0.6255722, 5.82 },
+    { -0.6046772, -0.5770005, -0.5490317, 5.82 },
+    { -0.4316095, 0.7249782, -0.5367679, 5.82 },
+    { 0.7953922, -0.3029754, -0.5249353, 5.82 },
+    { 0.7953043, 0.3364473, -0.5042760, 5.82 },
+    { -0.5811258, -0.7619615, -0.2858454, 5.82 },
+    { 0.9426798, 0.2871720, -0.1699620, 5.82 },
+    { -0.3500193, 0.9309256, -0.1042300, 5.82 },
+    { 0.7585645, -0.6468161, -0.0787964, 5.82 },
+    { -0.0161127, -0.9998017, 0.0116988, 5.82 },
+    { 0.7713160, 0.6250546, 0.1199097, 5.82 },
+    { 0.7627382, -0.6339124, 0.1280061, 5.82 },
+    { -0.3210148, 0.9368495, 0.1387895, 5.82 },
+    { 0.9612285, -0.1980040, 0.1919225, 5.82 },
+    { -0.2582496, 0.9224851, 0.2869291, 5.82 },
+    { 0.7041418, 0.6369957, 0.3137209, 5.82 },
+    { 0.8840813, -0.3266947, 0.3341720, 5.82 },
+    { -0.8288674, 0.3987147, 0.3924352, 5.82 },
+    { -0.2904642, 0.8593947, 0.4207983, 5.82 },
+    { 0.7703816, 0.4346636, 0.4664544, 5.82 },
+    { 0.6218562, -0.5875199, 0.5177985, 5.82 },
+    { -0.6016496, 0.5943349, 0.5336514, 5.82 },
+    { -0.7800212, -0.2779953, 0.5606117, 5.82 },
+    { 0.6091135, 0.4378469, 0.6612646, 5.82 },
+    { 0.5957057, 0.3076696, 0.7419394, 5.82 },
+    { 0.4050948, 0.5308822, 0.7443536, 5.82 },
+    { -0.5687810, -0.1425861, 0.8100354, 5.82 },
+    { 0.2395772, -0.5215563, 0.8188906, 5.82 },
+    { -0.3799283, 0.1811490, 0.9071050, 5.82 },
+    { -0.2995335, -0.2324994, -0.9253236, 5.83 },
+    { 0.2416542, 0.3173888, -0.9169883, 5.83 },
+    { -0.4814426, 0.0498124, -0.8750610, 5.83 },
+    { -0.2659969, -0.5293361, -0.8056357, 5.83 },
+    { -0.5740578, -0.2154026, -0.7899743, 5.83 },
+    { 0.6168535, -0.1445544, -0.7736897, 5.83 },
+    { -0.6005502, -0.3340051, -0.7264847, 5.83 },
+    { -0.5548765, -0.4151126, -0.7209672, 5.83 },
+    { -0.3855629, 0.5803279, -0.7173289, 5.83 },
+    { -0.2531600, -0.6810617, -0.6870699, 5.83 },
+    { 0.7414825, -0.1638289, -0.6506641, 5.83 },
+    { 0.5675348, -0.5099944, -0.6463822, 5.83 },
+    { -0.0254464, 0.8255893, -0.5636975, 5.83 },
+    { 0.6661867, 0.5506853, -0.5029324, 5.83 },
+    { -0.7904086, -0.3631296, -0.4933470, 5.83 },
+    { 0.1761243, -0.8889463, -0.4227940, 5.83 },
+    { 0.3722202, 0.8272152, -0.4209122, 5.83 },
+    { -0.3668875, 0.8406720, -0.3983267, 5.83 },
+    { -0.9325524, -0.0610948, -0.3558279, 5.83 },
+    { 0.7752008, 0.5736454, -0.2645651, 5.83 },
+    { 0.6905425, 0.7023016, -0.1729845, 5.83 },
+    { 0.2173883, -0.9612086, -0.1697657, 5.83 },
+    { 0.5019613, 0.8596209, -0.0953246, 5.83 },
+    { -0.0635098, 0.9947979, -0.0796475, 5.83 },
+    { -0.0605048, 0.9960327, -0.0652532, 5.83 },
+    { 0.3516680, -0.9361144, -0.0044069, 5.83 },
+    { 0.2735562, -0.9613322, 0.0317403, 5.83 },
+    { 0.9653932, -0.2554517, 0.0525398, 5.83 },
+    { -0.4952958, -0.8652876, 0.0771976, 5.83 },
+    { 0.1962074, -0.9758674, 0.0958404, 5.83 },
+    { -0.5375485, 0.7652090, 0.3542552, 5.83 },
+    { -0.4548712, 0.7805153, 0.4288217, 5.83 },
+    { 0.0887599, 0.8871773, 0.4528113, 5.83 },
+    { 0.0981302, -0.8619468, 0.4974114, 5.83 },
+    { 0.6471478, 0.5095989, 0.5670174, 5.83 },
+    { -0.3911248, -0.7007194, 0.5966689, 5.83 },
+    { 0.6003010, -0.5065309, 0.6189226, 5.83 },
+    { -0.1373122, -0.5646693, 0.8138145, 5.83 },
+    { 0.3921608, -0.3848656, 0.8355168, 5.83 },
+    { -0.4685864, 0.0636118, 0.8811245, 5.83 },
+    { 0.3975938, 0.0737916, 0.9145895, 5.83 },
+    { -0.2538973, 0.1489905, 0.9556872, 5.83 },
+    { 0.1785863, -0.0769961, 0.9809070, 5.83 },
+    { -0.3532242, -0.5542286, -0.7536998, 5.84 },
+    { -0.1377336, -0.6431314, -0.7532672, 5.84 },
+    { -0.3136691, 0.6076262, -0.7296589, 5.84 },
+    { -0.6815639, -0.1244239, -0.7211029, 5.84 },
+    { -0.6791165, -0.2379286, -0.6943996, 5.84 },
+    { -0.0880708, -0.7475481, -0.6583428, 5.84 },
+    { -0.1108778, 0.8089859, -0.5772762, 5.84 },
+    { -0.0276091, -0.8244867, -0.5652074, 5.84 },
+    { -0.7165584, 0.4280379, -0.5507519, 5.84 },
+    { 0.8013369, 0.3056677, -0.5142242, 5.84 },
+    { -0.3509954, -0.7945139, -0.4955298, 5.84 },
+    { -0.5949014, -0.6717539, -0.4414058, 5.84 },
+    { 0.6532989, 0.6425285, -0.4004468, 5.84 },
+    { -0.5411732, -0.7606023, -0.3586305, 5.84 },
+    { -0.2875276, 0.8889670, -0.3564626, 5.84 },
+    { -0.7335345, 0.6313579, -0.2516236, 5.84 },
+    { 0.1720809, -0.9757118, -0.1355532, 5.84 },
+    { 0.9947991, 0.0447959, -0.0914775, 5.84 },
+    { -0.1400512, 0.9865193, 0.0846484, 5.84 },
+    { 0.8519309, 0.4349314, 0.2916307, 5.84 },
+    { 0.1305643, -0.9068943, 0.4006191, 5.84 },
+    { -0.8133079, 0.3936136, 0.4284840, 5.84 },
+    { 0.4295227, -0.6242774, 0.6525243, 5.84 },
+    { 0.3262009, -0.6706667, 0.6661825, 5.84 },
+    { 0.2602595, -0.6785152, 0.6869367, 5.84 },
+    { -0.6600521, -0.1613357, 0.7336907, 5.84 },
+    { -0.3686770, -0.5196028, 0.7707725, 5.84 },
+    { 0.4503481, 0.3880271, 0.8041279, 5.84 },
+    { -0.5504160, 0.0096720, 0.8348345, 5.84 },
+    { 0.4573024, 0.1318354, 0.8794850, 5.84 },
+    { 0.3130757, -0.0343106, 0.9491082, 5.84 },
+    { 0.2664481, -0.0534572, 0.9623657, 5.84 },
+    { 0.0345499, 0.1263978, -0.9913778, 5.85 },
+    { -0.1898420, -0.0637846, -0.9797405, 5.85 },
+    { 0.0154179, -0.2807178, -0.9596665, 5.85 },
+    { -0.3280491, -0.2452298, -0.9122753, 5.85 },
+    { -0.3585297, 0.4983960, -0.7893401, 5.85 },
+    { 0.4378940, 0.5101927, -0.7402380, 5.85 },
+    { -0.5377117, 0.4751551, -0.6964867, 5.85 },
+    { -0.2403815, 0.6781582, -0.6944913, 5.85 },
+    { 0.6130381, 0.3873775, -0.6885659, 5.85 },
+    { -0.4983277, -0.5374467, -0.6803091, 5.85 },
+    { -0.8580830, 0.0311152, -0.5125675, 5.85 },
+    { 0.5202254, -0.7066047, -0.4796616, 5.85 },
+    { -0.6182242, -0.6296964, -0.4704053, 5.85 },
+    { -0.3591856, 0.8344037, -0.4180384, 5.85 },
+    { -0.1427990, -0.9197709, -0.3655542, 5.85 },
+    { -0.4750283, -0.8038145, -0.3580927, 5.85 },
+    { -0.7651763, 0.5851440, -0.2685364, 5.85 },
+    { 0.5330266, -0.8174142, -0.2184413, 5.85 },
+    { 0.9749267, 0.0456062, -0.2178026, 5.85 },
+    { 0.0264328, -0.9891124, -0.1447688, 5.85 },
+    { 0.4161156, 0.8996613, -0.1321266, 5.85 },
+    { 0.5741609, 0.8085715, -0.1286518, 5.85 },
+    { 0.9626352, 0.2387044, -0.1278816, 5.85 },
+    { 0.2465083, 0.9663566, -0.0734069, 5.85 },
+    { 0.3755177, -0.9254043, 0.0511212, 5.85 },
+    { -0.4030373, -0.9071533, 0.1209704, 5.85 },
+    { -0.7097339, 0.6929218, 0.1270319, 5.85 },
+    { -0.8477302, 0.5071895, 0.1552813, 5.85 },
+    { -0.9823134, -0.0576362, 0.1781530, 5.85 },
+    { -0.2071472, 0.9376715, 0.2790381, 5.85 },
+    { 0.7661338, -0.5413580, 0.3463677, 5.85 },
+    { -0.9170739, -0.1417049, 0.3726864, 5.85 },
+    { -0.6732871, -0.6183777, 0.4053313, 5.85 },
+    { -0.2836848, 0.8674219, 0.4087814, 5.85 },
+    { -0.4783359, -0.7406212, 0.4718845, 5.85 },
+    { 0.2783565, -0.8151807, 0.5079352, 5.85 },
+    { -0.6619631, 0.5046460, 0.5541997, 5.85 },
+    { -0.7065684, 0.3630755, 0.6074020, 5.85 },
+    { -0.7403623, 0.2726687, 0.6144229, 5.85 },
+    { -0.0962869, -0.6587517, 0.7461736, 5.85 },
+    { 0.3137514, -0.5108443, 0.8003737, 5.85 },
+    { -0.4528825, -0.3741686, 0.8092560, 5.85 },
+    { -0.3046902, 0.4610495, 0.8334250, 5.85 },
+    { -0.0893922, 0.5393656, 0.8373134, 5.85 },
+    { -0.4840381, -0.1043363, 0.8688044, 5.85 },
+    { 0.2420842, 0.3785790, 0.8933494, 5.85 },
+    { -0.3843814, -0.1823088, 0.9049942, 5.85 },
+    { -0.1120016, -0.0243742, 0.9934090, 5.85 },
+    { 0.0119732, -0.2434665, -0.9698354, 5.86 },
+    { -0.1998007, 0.1714665, -0.9647170, 5.86 },
+    { 0.1142021, -0.6605009, -0.7420893, 5.86 },
+    { 0.0859716, 0.6902623, -0.7184336, 5.86 },
+    { 0.0363163, -0.7497028, -0.6607775, 5.86 },
+    { -0.3440717, -0.6701730, -0.6576342, 5.86 },
+    { 0.7100923, -0.2691008, -0.6506564, 5.86 },
+    { -0.5955481, 0.5224970, -0.6101797, 5.86 },
+    { 0.2415835, 0.7836975, -0.5722373, 5.86 },
+    { -0.8183196, -0.1693424, -0.5492505, 5.86 },
+    { 0.6062916, -0.6657619, -0.4349386, 5.86 },
+    { -0.2345467, -0.8747294, -0.4240712, 5.86 },
+    { 0.1576049, -0.9198514, -0.3592133, 5.86 },
+    { 0.7807057, 0.5119253, -0.3583729, 5.86 },
+    { -0.8314289, 0.4606394, -0.3107045, 5.86 },
+    { -0.6754916, 0.6830098, -0.2778647, 5.86 },
+    { 0.8289737, 0.4930741, -0.2639708, 5.86 },
+    { -0.9392938, 0.2973985, -0.1711176, 5.86 },
+    { -0.3770791, 0.9168111, -0.1314106, 5.86 },
+    { 0.4168686, 0.9089652, -0.0017124, 5.86 },
+    { -0.4772220, 0.8651716, 0.1540690, 5.86 },
+    { 0.8205518, 0.4277971, 0.3790574, 5.86 },
+    { 0.6704587, 0.6077474, 0.4255915, 5.86 },
+    { 0.0306544, -0.8974936, 0.4399609, 5.86 },
+    { 0.2557576, 0.8028072, 0.5385988, 5.86 },
+    { -0.1686070, 0.6647040, 0.7278326, 5.86 },
+    { -0.3102145, -0.4760187, 0.8229053, 5.86 },
+    { 0.3574464, -0.2157992, 0.9086599, 5.86 },
+    { 0.4051332, 0.0045992, 0.9142461, 5.86 },
+    { -0.0300087, -0.2999439, 0.9534847, 5.86 },
+    { 0.0271689, 0.0522048, 0.9982668, 5.86 },
+    { 0.1113066, 0.0506825, -0.9924929, 5.87 },
+    { -0.3220155, -0.3018198, -0.8973354, 5.87 },
+    { 0.1943194, 0.4058939, -0.8930230, 5.87 },
+    { 0.5044151, 0.2346502, -0.8309661, 5.87 },
+    { -0.4496203, -0.3561731, -0.8191351, 5.87 },
+    { -0.2946613, 0.5061180, -0.8105672, 5.87 },
+    { -0.4752937, -0.3763700, -0.7952619, 5.87 },
+    { -0.2321447, 0.5604941, -0.7949561, 5.87 },
+    { -0.4739706, 0.4023007, -0.7832663, 5.87 },
+    { -0.4636204, 0.4720718, -0.7498029, 5.87 },
+    { -0.0490028, -0.7329363, -0.6785301, 5.87 },
+    { -0.5828684, -0.4700013, -0.6628448, 5.87 },
+    { 0.1080997, 0.7475797, -0.6553159, 5.87 },
+    { -0.0595364, 0.7937394, -0.6053372, 5.87 },
+    { -0.6474725, 0.4899091, -0.5837538, 5.87 },
+    { -0.2803207, -0.7889562, -0.5467800, 5.87 },
+    { 0.8088169, -0.2929007, -0.5099258, 5.87 },
+    { -0.5883210, 0.6418326, -0.4918631, 5.87 },
+    { 0.8610938, -0.1919126, -0.4708365, 5.87 },
+    { -0.3116389, 0.8439215, -0.4366666, 5.87 },
+    { -0.7396172, -0.5131537, -0.4354764, 5.87 },
+    { -0.4703841, -0.7725697, -0.4264679, 5.87 },
+    { -0.3669151, 0.8406518, -0.3983440, 5.87 },
+    { 0.0405951, 0.9198024, -0.3902763, 5.87 },
+    { 0.0716209, 0.9219437, -0.3806445, 5.87 },
+    { 0.5259408, -0.7650829, -0.3715299, 5.87 },
+    { 0.3318913, -0.8894776, -0.3141301, 5.87 },
+    { 0.7755388, 0.5536112, -0.3034044, 5.87 },
+    { 0.6726830, -0.6864607, -0.2761691, 5.87 },
+    { 0.9687072, -0.0317122, -0.2461721, 5.87 },
+    { -0.6971159, -0.6904148, -0.1932788, 5.87 },
+    { -0.0233989, 0.9837848, -0.1778200, 5.87 },
+    { -0.9820341, -0.1590108, -0.1016100, 5.87 },
+    { -0.0016884, -0.9964601, -0.0840498, 5.87 },
+    { 0.0195475, 0.9965642, -0.0804840, 5.87 },
+    { 0.7666074, -0.6371752, -0.0795030, 5.87 },
+    { -0.1160239, 0.9928981, -0.0263025, 5.87 },
+    { 0.9934102, -0.1125262, -0.0217713, 5.87 },
+    { -0.1100366, 0.9937904, -0.0165120, 5.87 },
+    { 0.9399460, 0.3412077, -0.0088817, 5.87 },
+    { -0.6194337, 0.7806570, 0.0829246, 5.87 },
+    { -0.9326378, -0.3494490, 0.0898451, 5.87 },
+    { 0.0135733, 0.9797572, 0.1997290, 5.87 },
+    { -0.6508508, 0.7296449, 0.2097892, 5.87 },
+    { 0.8090111, 0.4651793, 0.3593178, 5.87 },
+    { 0.9182909, 0.1592898, 0.3624480, 5.87 },
+    { -0.9305163, -0.0173666, 0.3658385, 5.87 },
+    { 0.3470333, -0.8239171, 0.4480274, 5.87 },
+    { 0.8496658, 0.0692519, 0.5227544, 5.87 },
+    { -0.1190885, 0.8353702, 0.5366325, 5.87 },
+    { 0.8252777, 0.1138812, 0.5531254, 5.87 },
+    { -0.7276442, -0.3834533, 0.5687684, 5.87 },
+    { -0.6741765, -0.3369582, 0.6572254, 5.87 },
+    { -0.2308377, -0.7034414, 0.6722232, 5.87 },
+    { -0.3359824, -0.6579341, 0.6739722, 5.87 },
+    { -0.0161405, 0.7313935, 0.6817647, 5.87 },
+    { -0.1687932, 0.6702815, 0.7226559, 5.87 },
+    { 0.2110821, 0.6075106, 0.7657514, 5.87 },
+    { -0.3381046, -0.4719687, 0.8142056, 5.87 },
+    { 0.1734116, 0.3195563, 0.9315644, 5.87 },
+    { 0.2313533, -0.2188023, 0.9479458, 5.87 },
+    { 0.2912429, 0.0621071, 0.9546310, 5.87 },
+    { -0.0197353, -0.1576306, -0.9873009, 5.88 },
+    { -0.2894687, -0.0408971, -0.9563134, 5.88 },
+    { 0.0991097, -0.3485341, -0.9320414, 5.88 },
+    { -0.2583199, 0.2557590, -0.9315890, 5.88 },
+    { -0.4167004, 0.3186203, -0.8513764, 5.88 },
+    { -0.0853458, -0.5228469, -0.8481434, 5.88 },
+    { -0.2973681, -0.6561657, -0.6935552, 5.88 },
+    { -0.2080850, -0.7075631, -0.6753185, 5.88 },
+    { 0.2237310, -0.7099819, -0.6677351, 5.88 },
+    { -0.3474708, 0.7079464, -0.6148788, 5.88 },
+    { -0.3524586, 0.7055871, -0.6147518, 5.88 },
+    { -0.8095427, 0.2621118, -0.5252980, 5.88 },
+    { -0.4273532, -0.8099334, -0.4017178, 5.88 },
+    { -0.2684487, -0.8979169, -0.3488274, 5.88 },
+    { 0.7537394, 0.5607303, -0.3427221, 5.88 },
+    { 0.8007960, -0.5448685, -0.2486847, 5.88 },
+    { -0.9371042, 0.2502500, -0.2433324, 5.88 },
+    { 0.6616461, -0.7176669, -0.2172063, 5.88 },
+    { 0.4916851, -0.8534286, -0.1729315, 5.88 },
+    { -0.1885035, -0.9818452, 0.0211276, 5.88 },
+    { -0.5585458, -0.8283121, 0.0438809, 5.88 },
+    { 0.8644266, 0.4998475, 0.0540299, 5.88 },
+    { 0.0949378, 0.9867939, 0.1312424, 5.88 },
+    { -0.6240647, 0.7631588, 0.1677257, 5.88 },
+    { -0.1510627, 0.9731886, 0.1734472, 5.88 },
+    { 0.3853209, 0.9020630, 0.1944484, 5.88 },
+    { -0.9678947, 0.0479934, 0.2467317, 5.88 },
+    { -0.7328377, -0.6189214, 0.2826396, 5.88 },
+    { -0.0600673, 0.9496624, 0.3074627, 5.88 },
+    { 0.1997758, -0.9222462, 0.3309856, 5.88 },
+    { 0.4598596, -0.7826781, 0.4194569, 5.88 },
+    { 0.3184195, 0.8149503, 0.4842159, 5.88 },
+    { 0.0427661, -0.8333004, 0.5511638, 5.88 },
+    { 0.4878036, -0.6395229, 0.5941870, 5.88 },
+    { 0.7297217, 0.3183407, 0.6051161, 5.88 },
+    { 0.7131018, -0.2865205, 0.6398374, 5.88 },
+    { -0.6456861, -0.2552439, 0.7196805, 5.88 },
+    { 0.5008762, 0.4658306, 0.7294689, 5.88 },
+    { -0.6381982, 0.1220363, 0.7601383, 5.88 },
+    { 0.1218640, -0.5895167, 0.7985106, 5.88 },
+    { 0.2291439, 0.5020159, 0.8339503, 5.88 },
+    { 0.4870728, -0.2364004, 0.8407585, 5.88 },
+    { -0.0706487, 0.5227550, 0.8495504, 5.88 },
+    { 0.4649514, 0.0085761, 0.8852947, 5.88 },
+    { -0.2346418, 0.3064274, 0.9225213, 5.88 },
+    { 0.0395413, -0.2733694, -0.9610961, 5.89 },
+    { -0.3552110, -0.0040738, -0.9347773, 5.89 },
+    { -0.2297708, -0.2894958, -0.9291919, 5.89 },
+    { -0.0784422, -0.3795476, -0.9218408, 5.89 },
+    { 0.5003327, 0.0892129, -0.8612249, 5.89 },
+    { -0.4927548, -0.1653557, -0.8543127, 5.89 },
+    { -0.5246470, -0.2840257, -0.8025428, 5.89 },
+    { -0.6011814, -0.1993797, -0.7738402, 5.89 },
+    { -0.6220410, -0.2103022, -0.7542135, 5.89 },
+    { -0.6969525, -0.1704621, -0.6965629, 5.89 },
+    { 0.3057382, -0.7019628, -0.6432514, 5.89 },
+    { -0.5538005, -0.5597127, -0.6164631, 5.89 },
+    { -0.7817976, 0.1184044, -0.6121870, 5.89 },
+    { -0.8498251, -0.1462494, -0.5063678, 5.89 },
+    { 0.6193583, 0.6282225, -0.4708840, 5.89 },
+    { 0.1391749, 0.9311529, -0.3370231, 5.89 },
+    { -0.9263179, 0.2503076, -0.2815693, 5.89 },
+    { -0.0154620, -0.9620343, -0.2724902, 5.89 },
+    { 0.9759803, -0.0804617, -0.2024559, 5.89 },
+    { 0.7158641, -0.6908292, -0.1014576, 5.89 },
+    { -0.9311972, -0.3542642, -0.0858410, 5.89 },
+    { 0.9301437, -0.3661668, -0.0274714, 5.89 },
+    { -0.6479765, -0.7616178, -0.0080527, 5.89 },
+    { 0.2089223, 0.9777648, 0.0180961, 5.89 },
+    { -0.3390605, 0.9395487, 0.0478144, 5.89 },
+    { 0.9889268, -0.0780698, 0.1262095, 5.89 },
+    { 0.0962401, -0.9732961, 0.2084049, 5.89 },
+    { 0.2462448, -0.9389353, 0.2403415, 5.89 },
+    { 0.9524673, 0.1542163, 0.2627230, 5.89 },
+    { 0.4481730, 0.8428021, 0.2980363, 5.89 },
+    { 0.4720806, 0.8244090, 0.3122336, 5.89 },
+    { 0.8685135, 0.3813337, 0.3166526, 5.89 },
+    { -0.6325476, -0.7029572, 0.3251689, 5.89 },
+    { 0.2092994, 0.9052208, 0.3698229, 5.89 },
+    { -0.3925142, 0.8324831, 0.3910301, 5.89 },
+    { 0.7850642, -0.3929459, 0.4788191, 5.89 },
+    { 0.6902690, 0.5239823, 0.4989701, 5.89 },
+    { -0.7034716, 0.4853522, 0.5191926, 5.89 },
+    { -0.2048626, 0.8065254, 0.5545701, 5.89 },
+    { 0.6960988, 0.3854840, 0.6056802, 5.89 },
+    { -0.7742387, -0.1722768, 0.6089953, 5.89 },
+    { 0.1966891, -0.7601070, 0.6193147, 5.89 },
+    { -0.5317814, 0.5482370, 0.6454803, 5.89 },
+    { 0.5341716, 0.5326115, 0.6564951, 5.89 },
+    { -0.7113541, 0.1588707, 0.6846425, 5.89 },
+    { 0.6679364, 0.0500807, 0.7425314, 5.89 },
+    { 0.0017889, 0.6437955, 0.7651955, 5.89 },
+    { -0.3069543, 0.4366108, 0.8456655, 5.89 },
+    { -0.4476828, -0.0937606, 0.8892632, 5.89 },
+    { 0.2993022, 0.3190502, 0.8992359, 5.89 },
+    { -0.3884901, 0.0471300, -0.9202468, 5.90 },
+    { -0.3829405, -0.1259325, -0.9151490, 5.90 },
+    { 0.4030571, -0.2441201, -0.8820149, 5.90 },
+    { -0.4807265, -0.1150093, -0.8692956, 5.90 },
+    { -0.4247479, 0.5013406, -0.7538215, 5.90 },
+    { -0.6279536, -0.2841759, -0.7245125, 5.90 },
+    { -0.6817263, 0.3407688, -0.6473993, 5.90 },
+    { 0.7689320, 0.1501675, -0.6214445, 5.90 },
+    { -0.3809030, -0.6915133, -0.6137770, 5.90 },
+    { -0.0278457, -0.8206850, -0.5707020, 5.90 },
+    { 0.6457738, 0.5096210, -0.5685619, 5.90 },
+    { -0.3057056, 0.7691337, -0.5612286, 5.90 },
+    { 0.4796976, 0.7278922, -0.4899624, 5.90 },
+    { -0.5230200, 0.7276472, -0.4438238, 5.90 },
+    { 0.8916002, 0.1945293, -0.4089101, 5.90 },
+    { -0.4165272, 0.8245092, -0.3830010, 5.90 },
+    { -0.7790493, -0.5386267, -0.3208793, 5.90 },
+    { -0.3135871, 0.9337141, -0.1727457, 5.90 },
+    { -0.3864311, 0.9093063, -0.1543794, 5.90 },
+    { 0.3216286, 0.9352481, -0.1478717, 5.90 },
+    { 0.1576980, 0.9765814, -0.1463559, 5.90 },
+    { 0.2106138, 0.9766029, -0.0434591, 5.90 },
+    { 0.2013694, -0.9793716, -0.0167839, 5.90 },
+    { -0.9965890, -0.0813727, -0.0137387, 5.90 },
+    { 0.0069479, 0.9994620, 0.0320543, 5.90 },
+    { -0.1888419, 0.9796102, 0.0685759, 5.90 },
+    { 0.9124877, -0.3233223, 0.2506569, 5.90 },
+    { 0.3763555, 0.8908498, 0.2544468, 5.90 },
+    { 0.4447419, 0.8134905, 0.3747504, 5.90 },
+    { 0.1177623, -0.9068794, 0.4046008, 5.90 },
+    { 0.0306554, -0.8975234, 0.4399000, 5.90 },
+    { 0.6277479, 0.6382529, 0.4456072, 5.90 },
+    { 0.5725736, 0.6819436, 0.4550960, 5.90 },
+    { -0.7727414, -0.4159551, 0.4794289, 5.90 },
+    { 0.8543458, 0.0762740, 0.5140774, 5.90 },
+    { 0.0186225, 0.8505917, 0.5254968, 5.90 },
+    { -0.7828281, 0.3168521, 0.5355230, 5.90 },
+    { -0.7568575, 0.3405231, 0.5578626, 5.90 },
+    { 0.4882857, 0.6519150, 0.5801585, 5.90 },
+    { 0.8038165, -0.0362088, 0.5937743, 5.90 },
+    { 0.7555592, -0.2448341, 0.6076073, 5.90 },
+    { 0.4657401, -0.6425680, 0.6084344, 5.90 },
+    { -0.4875191, 0.6188768, 0.6158869, 5.90 },
+    { 0.6041831, 0.4934324, 0.6256894, 5.90 },
+    { -0.0896895, 0.6801127, 0.7276005, 5.90 },
+    { 0.4431630, 0.4982700, 0.7452071, 5.90 },
+    { 0.4548272, -0.4692155, 0.7569472, 5.90 },
+    { 0.5457247, 0.2869727, 0.7872936, 5.90 },
+    { 0.4296604, -0.4156682, 0.8016308, 5.90 },
+    { -0.3018132, -0.3858063, 0.8718155, 5.90 },
+    { 0.0770338, -0.0239061, 0.9967418, 5.90 },
+    { -0.0610438, -0.0672856, -0.9958646, 5.91 },
+    { 0.0964936, -0.1167341, -0.9884645, 5.91 },
+    { -0.3262514, -0.1057852, -0.9393453, 5.91 },
+    { -0.1243750, -0.3482674, -0.9291075, 5.91 },
+    { -0.3122113, 0.2428093, -0.9184594, 5.91 },
+    { -0.2943513, -0.2667611, -0.9177123, 5.91 },
+    { -0.4495410, 0.0098152, -0.8932058, 5.91 },
+    { -0.0893443, -0.4966398, -0.8633461, 5.91 },
+    { -0.4861733, 0.1546864, -0.8600626, 5.91 },
+    { -0.5066623, 0.1893283, -0.8410993, 5.91 },
+    { -0.6088539, 0.1713370, -0.7745583, 5.91 },
+    { -0.2946279, 0.5635812, -0.7717322, 5.91 },
+    { -0.5533623, -0.3171969, -0.7701794, 5.91 },
+    { -0.5704341, -0.2889597, -0.7688350, 5.91 },
+    { -0.4545217, 0.4846806, -0.7473251, 5.91 },
+    { -0.6606140, 0.2650295, -0.7023878, 5.91 },
+    { 0.6267790, 0.4169561, -0.6582520, 5.91 },
+    { -0.1907506, -0.7628867, -0.6177525, 5.91 },
+    { -0.2753456, -0.7472286, -0.6048424, 5.91 },
+    { -0.1459459, -0.8061506, -0.5734291, 5.91 },
+    { 0.5689965, 0.6664850, -0.4817061, 5.91 },
+    { -0.7393492, 0.5499063, -0.3885433, 5.91 },
+    { -0.0619237, 0.9360111, -0.3464805, 5.91 },
+    { -0.8916308, -0.3908179, -0.2285954, 5.91 },
+    { -0.8777252, 0.4563073, -0.1462264, 5.91 },
+    { 0.9262563, 0.3571487, -0.1203914, 5.91 },
+    { 0.2033409, 0.9734052, -0.1055212, 5.91 },
+    { 0.9814297, 0.1761752, -0.0758818, 5.91 },
+    { -0.8345648, -0.5507121, -0.0147582, 5.91 },
+    { 0.5422601, 0.8402013, 0.0039759, 5.91 },
+    { -0.9608288, 0.2768439, 0.0128608, 5.91 },
+    { -0.8734870, -0.4865020, 0.0183356, 5.91 },
+    { -0.9835678, 0.1782266, 0.0288046, 5.91 },
+    { -0.4648392, -0.8833425, 0.0602539, 5.91 },
+    { 0.8883059, 0.4547313, 0.0642817, 5.91 },
+    { -0.4069019, 0.9077449, 0.1021275, 5.91 },
+    { 0.5474787, 0.8283929, 0.1184579, 5.91 },
+    { -0.3385242, 0.9327059, 0.1243428, 5.91 },
+    { 0.4409681, -0.8876905, 0.1324866, 5.91 },
+    { 0.4980963, -0.8542569, 0.1488124, 5.91 },
+    { -0.2944006, -0.9277428, 0.2293939, 5.91 },
+    { -0.7428408, -0.6272317, 0.2340256, 5.91 },
+    { -0.0641001, 0.9688029, 0.2393997, 5.91 },
+    { -0.9130324, -0.2869884, 0.2898439, 5.91 },
+    { -0.7319924, -0.6046598, 0.3139644, 5.91 },
+    { 0.6833857, 0.6588343, 0.3145176, 5.91 },
+    { 0.3862001, 0.8511760, 0.3554559, 5.91 },
+    { 0.5843209, -0.7051639, 0.4016379, 5.91 },
+    { 0.1810649, -0.8207096, 0.5418961, 5.91 },
+    { -0.2401861, 0.7933864, 0.5593287, 5.91 },
+    { 0.7659959, -0.2231109, 0.6028862, 5.91 },
+    { -0.7463436, -0.2355116, 0.6224995, 5.91 },
+    { 0.3914158, -0.5802432, 0.7142209, 5.91 },
+    { 0.3148620, -0.5914221, 0.7423489, 5.91 },
+    { -0.2791566, -0.5931496, 0.7551458, 5.91 },
+    { -0.3879843, 0.4652885, 0.7955972, 5.91 },
+    { 0.3387544, -0.4436671, 0.8297017, 5.91 },
+    { 0.1836238, -0.5026703, 0.8447514, 5.91 },
+    { -0.1864105, -0.0895683, 0.9783806, 5.91 },
+    { 0.1489317, -0.1419642, 0.9786039, 5.91 },
+    { -0.4540935, -0.0245269, -0.8906164, 5.92 },
+    { -0.3676046, 0.2851866, -0.8851754, 5.92 },
+    { -0.4726768, 0.1371311, -0.8705008, 5.92 },
+    { -0.4857641, 0.1792319, -0.8555169, 5.92 },
+    { -0.5512196, -0.0529753, -0.8326767, 5.92 },
+    { -0.4773715, -0.2852396, -0.8311166, 5.92 },
+    { -0.0246616, -0.5927347, -0.8050201, 5.92 },
+    { 0.5098686, 0.3667489, -0.7781576, 5.92 },
+    { -0.0904539, -0.6278392, -0.7730692, 5.92 },
+    { -0.5067073, 0.4499740, -0.7353714, 5.92 },
+    { 0.2255385, -0.6676515, -0.7094884, 5.92 },
+    { 0.7006658, -0.1340975, -0.7007747, 5.92 },
+    { 0.5691841, 0.5381245, -0.6216522, 5.92 },
+    { 0.7500982, 0.2464632, -0.6136844, 5.92 },
+    { 0.5970604, 0.5482892, -0.5855749, 5.92 },
+    { -0.3729471, -0.7510640, -0.5448057, 5.92 },
+    { -0.1671993, 0.8333438, -0.5268610, 5.92 },
+    { 0.1050785, -0.8612367, -0.4972222, 5.92 },
+    { -0.2786365, 0.8549752, -0.4374689, 5.92 },
+    { -0.4368608, -0.8054759, -0.4004512, 5.92 },
+    { -0.3673485, -0.8406792, -0.3978864, 5.92 },
+    { 0.4445021, -0.8342297, -0.3263107, 5.92 },
+    { -0.0673783, 0.9558620, -0.2859862, 5.92 },
+    { 0.2510429, 0.9678939, 0.0126043, 5.92 },
+    { -0.2400711, 0.9552340, 0.1728985, 5.92 },
+    { 0.0207568, 0.9409489, 0.3379117, 5.92 },
+    { 0.3266260, 0.8766685, 0.3532249, 5.92 },
+    { -0.7279351, -0.5715010, 0.3788101, 5.92 },
+    { 0.5400031, 0.7327312, 0.4141276, 5.92 },
+    { 0.8080935, -0.4111529, 0.4218272, 5.92 },
+    { 0.7163416, 0.5523547, 0.4263319, 5.92 },
+    { 0.4875439, -0.7506681, 0.4458680, 5.92 },
+    { -0.2990674, -0.8400141, 0.4526976, 5.92 },
+    { 0.3143043, 0.6758747, 0.6666380, 5.92 },
+    { 0.7096197, -0.2225066, 0.6685287, 5.92 },
+    { 0.3470198, -0.6050632, 0.7165722, 5.92 },
+    { 0.6021366, 0.2695164, 0.7515268, 5.92 },
+    { -0.2730317, 0.5998184, 0.7521115, 5.92 },
+    { -0.2038039, 0.5790416, 0.7894142, 5.92 },
+    { -0.3116243, -0.4734118, 0.8238759, 5.92 },
+    { -0.2306376, 0.5132928, 0.8266419, 5.92 },
+    { 0.4651502, 0.1325385, 0.8752536, 5.92 },
+    { -0.1864316, 0.3712092, 0.9096411, 5.92 },
+    { 0.1551157, -0.3169513, 0.9356714, 5.92 },
+    { -0.0551058, 0.3082960, 0.9496931, 5.92 },
+    { -0.1570011, -0.1572710, -0.9749956, 5.93 },
+    { -0.2966814, -0.0746935, -0.9520510, 5.93 },
+    { 0.4030959, 0.1569343, -0.9016015, 5.93 },
+    { -0.4529848, 0.1331206, -0.8815235, 5.93 },
+    { -0.5589308, -0.1317785, -0.8186762, 5.93 },
+    { -0.5346498, 0.3281576, -0.7787568, 5.93 },
+    { 0.1732807, -0.6047315, -0.7773503, 5.93 },
+    { -0.0630561, -0.6388809, -0.7667171, 5.93 },
+    { 0.3581832, 0.5819614, -0.7300861, 5.93 },
+    { -0.0143877, 0.7059859, -0.7080797, 5.93 },
+    { 0.4769179, 0.5316737, -0.6999089, 5.93 },
+    { -0.1282922, -0.7859100, -0.6048856, 5.93 },
+    { -0.3747252, 0.7256684, -0.5770498, 5.93 },
+    { -0.6771917, 0.5124495, -0.5280217, 5.93 },
+    { 0.4286446, 0.7475352, -0.5074001, 5.93 },
+    { 0.3162849, -0.8126080, -0.4895224, 5.93 },
+    { -0.8788525, 0.0166127, -0.4768042, 5.93 },
+    { -0.1184466, 0.8768663, -0.4659140, 5.93 },
+    { 0.5519510, 0.6962339, -0.4589209, 5.93 },
+    { 0.8283301, 0.3447228, -0.4416281, 5.93 },
+    { 0.2224418, -0.8919993, -0.3935185, 5.93 },
+    { 0.6169602, -0.6963246, -0.3667317, 5.93 },
+    { -0.3988245, 0.8530766, -0.3364511, 5.93 },
+    { 0.9357729, -0.1675222, -0.3102667, 5.93 },
+    { -0.1293130, 0.9760311, -0.1750469, 5.93 },
+    { 0.9055328, -0.4053718, -0.1252361, 5.93 },
+    { 0.9980082, -0.0308108, -0.0550480, 5.93 },
+    { -0.9514087, 0.3060280, -0.0341824, 5.93 },
+    { 0.8392013, 0.5428872, -0.0318522, 5.93 },
+    { -0.9815578, -0.1891744, -0.0275184, 5.93 },
+    { 0.1128763, 0.9932776, -0.0256642, 5.93 },
+    { 0.9879573, 0.1544752, -0.0088245, 5.93 },
+    { 0.8575942, 0.5142926, -0.0059394, 5.93 },
+    { 0.0824016, 0.9965818, 0.0058958, 5.93 },
+    { -0.7067493, -0.7029674, 0.0796388, 5.93 },
+    { 0.9699574, 0.2074540, 0.1270646, 5.93 },
+    { -0.1994154, 0.9684724, 0.1493144, 5.93 },
+    { -0.2365521, -0.9427136, 0.2352321, 5.93 },
+    { -0.5630207, -0.7784141, 0.2776314, 5.93 },
+    { -0.3474032, 0.8714542, 0.3462349, 5.93 },
+    { 0.2897669, -0.8837782, 0.3673843, 5.93 },
+    { 0.7321795, -0.5669225, 0.3775077, 5.93 },
+    { -0.0385320, 0.9251344, 0.3776792, 5.93 },
+    { -0.2384835, 0.8384963, 0.4899485, 5.93 },
+    { -0.6092591, 0.5639250, 0.5574871, 5.93 },
+    { 0.4401098, -0.6127305, 0.6564029, 5.93 },
+    { 0.4169829, 0.5052872, 0.7555198, 5.93 },
+    { -0.2967155, -0.5249327, 0.7977503, 5.93 },
+    { 0.5546470, -0.2010345, 0.8074354, 5.93 },
+    { 0.5690629, 0.0829493, 0.8180995, 5.93 },
+    { -0.4630640, 0.2748740, 0.8426245, 5.93 },
+    { -0.2828719, 0.4437500, 0.8503349, 5.93 },
+    { -0.3491340, -0.3535852, 0.8678035, 5.93 },
+    { 0.3961095, -0.2312591, 0.8886037, 5.93 },
+    { 0.2219648, -0.3244092, 0.9195055, 5.93 },
+    { -0.3300231, 0.0985227, 0.9388174, 5.93 },
+    { 0.1936189, 0.4404930, -0.8766286, 5.94 },
+    { -0.4296303, 0.2430731, -0.8696742, 5.94 },
+    { -0.1508674, -0.5093878, -0.8472090, 5.94 },
+    { 0.0181276, 0.5420489, -0.8401514, 5.94 },
+    { -0.0778959, -0.5658110, -0.8208472, 5.94 },
+    { -0.1673933, -0.5884020, -0.7910515, 5.94 },
+    { 0.5665358, 0.2977796, -0.7683518, 5.94 },
+    { 0.3122134, -0.5982897, -0.7379514, 5.94 },
+    { 0.7210941, 0.1432765, -0.6778607, 5.94 },
+    { -0.4157223, -0.6185250, -0.6667847, 5.94 },
+    { -0.2408698, 0.7100715, -0.6616496, 5.94 },
+    { 0.5590414, -0.5471998, -0.6229327, 5.94 },
+    { -0.5853681, -0.5228520, -0.6196531, 5.94 },
+    { -0.6553731, -0.4563378, -0.6018654, 5.94 },
+    { 0.7305454, 0.3346890, -0.5952198, 5.94 },
+    { 0.2114970, 0.8234281, -0.5265313, 5.94 },
+    { 0.8970210, 0.0536922, -0.4387145, 5.94 },
+    { 0.9232879, 0.0313546, -0.3828268, 5.94 },
+    { 0.1532975, -0.9183631, -0.3648411, 5.94 },
+    { -0.4893513, -0.8064669, -0.3318831, 5.94 },
+    { 0.5766878, -0.7522448, -0.3186831, 5.94 },
+    { -0.0939882, -0.9587019, -0.2684342, 5.94 },
+    { -0.4122524, -0.8741676, -0.2566689, 5.94 },
+    { -0.0522470, -0.9657411, -0.2541936, 5.94 },
+    { -0.7788822, 0.5819896, -0.2337320, 5.94 },
+    { -0.9668220, 0.1395006, -0.2139971, 5.94 },
+    { -0.9385757, -0.2948298, -0.1793069, 5.94 },
+    { 0.9839938, -0.0419090, -0.1732046, 5.94 },
+    { 0.0133156, -0.9897356, -0.1422887, 5.94 },
+    { 0.4304266, 0.8955602, -0.1127157, 5.94 },
+    { 0.9643608, -0.2515192, -0.0821366, 5.94 },
+    { 0.9506926, 0.3076373, -0.0392792, 5.94 },
+    { 0.1389358, -0.9901466, -0.0175067, 5.94 },
+    { -0.7936907, -0.6081495, 0.0144663, 5.94 },
+    { -0.4280253, 0.9015528, 0.0632207, 5.94 },
+    { 0.7197951, -0.6863815, 0.1038047, 5.94 },
+    { 0.6026059, 0.7907243, 0.1078017, 5.94 },
+    { 0.0980239, 0.9766033, 0.1914086, 5.94 },
+    { 0.8688654, 0.4564878, 0.1915509, 5.94 },
+    { 0.8366375, 0.4957071, 0.2330498, 5.94 },
+    { 0.8028654, -0.5388847, 0.2549714, 5.94 },
+    { 0.1240496, 0.9562667, 0.2648881, 5.94 },
+    { -0.2562095, 0.9172555, 0.3049576, 5.94 },
+    { 0.1315215, 0.8457125, 0.5171775, 5.94 },
+    { 0.3658536, -0.7606702, 0.5362201, 5.94 },
+    { -0.5355509, 0.6478483, 0.5417359, 5.94 },
+    { 0.1190680, 0.8165600, 0.5648474, 5.94 },
+    { -0.1187941, -0.8135584, 0.5692193, 5.94 },
+    { 0.6272687, -0.4999217, 0.5971703, 5.94 },
+    { 0.7015588, 0.3599656, 0.6150122, 5.94 },
+    { -0.6998617, -0.3501470, 0.6225678, 5.94 },
+    { -0.1407020, -0.7664049, 0.6267587, 5.94 },
+    { 0.7050228, -0.2510415, 0.6632654, 5.94 },
+    { -0.7232618, 0.0935556, 0.6842074, 5.94 },
+    { 0.7079703, -0.1554852, 0.6889139, 5.94 },
+    { 0.0328050, 0.5565530, 0.8301642, 5.94 },
+    { -0.0489622, 0.5071008, 0.8604949, 5.94 },
+    { 0.4959691, 0.0660259, 0.8658263, 5.94 },
+    { -0.1817773, -0.4523469, 0.8731204, 5.94 },
+    { -0.0781647, 0.4710067, 0.8786598, 5.94 },
+    { 0.1549119, 0.4056911, 0.9007869, 5.94 },
+    { -0.3159644, 0.2223413, 0.9223507, 5.94 },
+    { 0.1106294, 0.2791037, 0.9538670, 5.94 },
+    { -0.1117420, -0.0617136, -0.9918191, 5.95 },
+    { 0.0216476, -0.1682584, -0.9855052, 5.95 },
+    { 0.2093552, -0.1171688, -0.9707945, 5.95 },
+    { -0.1363183, -0.1981776, -0.9706405, 5.95 },
+    { -0.4417799, -0.0619505, -0.8949819, 5.95 },
+    { -0.2876873, -0.4106376, -0.8652241, 5.95 },
+    { -0.4771988, 0.2099974, -0.8533360, 5.95 },
+    { -0.0679742, -0.5415513, -0.8379151, 5.95 },
+    { -0.3286524, 0.5431677, -0.7726296, 5.95 },
+    { -0.4385844, -0.5040752, -0.7440107, 5.95 },
+    { 0.3963926, -0.6847412, -0.6115573, 5.95 },
+    { -0.4026935, 0.6862155, -0.6057608, 5.95 },
+    { 0.0225664, -0.8085000, -0.5880633, 5.95 },
+    { 0.8220495, -0.3414843, -0.4556567, 5.95 },
+    { -0.3441213, 0.8547907, -0.3884758, 5.95 },
+    { 0.6718981, 0.6353177, -0.3806893, 5.95 },
+    { 0.0621827, -0.9352895, -0.3483776, 5.95 },
+    { 0.8802023, -0.4150686, -0.2301347, 5.95 },
+    { -0.9736259, -0.1074685, -0.2012541, 5.95 },
+    { -0.3188868, 0.9298251, -0.1836749, 5.95 },
+    { -0.9837094, 0.1173365, -0.1361911, 5.95 },
+    { -0.9537454, 0.2957352, -0.0539481, 5.95 },
+    { -0.9698826, 0.2435727, -0.0000141, 5.95 },
+    { 0.0584964, 0.9980794, 0.0203860, 5.95 },
+    { -0.0323182, -0.9992181, 0.0227746, 5.95 },
+    { -0.9985586, -0.0422376, 0.0331169, 5.95 },
+    { 0.9521113, 0.3027593, 0.0426710, 5.95 },
+    { -0.8473874, 0.5207294, 0.1038047, 5.95 },
+    { -0.0799792, -0.9907133, 0.1099565, 5.95 },
+    { -0.8006192, -0.5817649, 0.1433823, 5.95 },
+    { 0.6921878, 0.6966428, 0.1885865, 5.95 },
+    { 0.4528410, 0.8609537, 0.2317191, 5.95 },
+    { 0.5576268, -0.7963502, 0.2342618, 5.95 },
+    { -0.5854968, 0.7726112, 0.2454902, 5.95 },
+    { 0.8560396, -0.4368572, 0.2763186, 5.95 },
+    { -0.9515117, 0.1054331, 0.2889798, 5.95 },
+    { -0.5558184, 0.7695059, 0.3145259, 5.95 },
+    { 0.4094929, -0.8053248, 0.4286811, 5.95 },
+    { -0.8051199, -0.4045884, 0.4336936, 5.95 },
+    { -0.6019846, 0.6421884, 0.4745615, 5.95 },
+    { -0.6338427, 0.5775357, 0.5144861, 5.95 },
+    { -0.7592054, -0.1509866, 0.6330957, 5.95 },
+    { 0.1990203, 0.7467255, 0.6346590, 5.95 },
+    { 0.7300414, -0.2510641, 0.6356150, 5.95 },
+    { 0.4667065, -0.5559446, 0.6878304, 5.95 },
+    { -0.4791685, 0.4570973, 0.7493061, 5.95 },
+    { 0.0268024, -0.5831141, 0.8119480, 5.95 },
+    { 0.3843117, -0.2570598, 0.8866932, 5.95 },
+    { 0.3935550, -0.0230167, 0.9190129, 5.95 },
+    { 0.2839620, 0.2486520, 0.9260333, 5.95 },
+    { 0.0241451, -0.3615382, 0.9320446, 5.95 },
+    { 0.2528318, -0.0230393, 0.9672359, 5.95 },
+    { 0.1694251, -0.1476647, 0.9744179, 5.95 },
+    { 0.0993811, 0.1100965, 0.9889399, 5.95 },
+    { 0.2201512, 0.2757865, -0.9356683, 5.96 },
+    { 0.1424138, -0.3388648, -0.9299941, 5.96 },
+    { -0.3789589, 0.0368120, -0.9246810, 5.96 },
+    { -0.4851665, -0.0104840, -0.8743589, 5.96 },
+    { -0.2239805, 0.5373174, -0.8130946, 5.96 },
+    { -0.5861460, 0.0494519, -0.8086949, 5.96 },
+    { -0.1935975, -0.5675780, -0.8002345, 5.96 },
+    { -0.1781295, 0.5897917, -0.7876647, 5.96 },
+    { -0.2084353, -0.7003916, -0.6826466, 5.96 },
+    { -0.6748948, 0.3202110, -0.6648172, 5.96 },
+    { -0.0279262, -0.7567935, -0.6530572, 5.96 },
+    { -0.4838538, 0.6102619, -0.6272686, 5.96 },
+    { -0.1504782, -0.7669645, -0.6237962, 5.96 },
+    { -0.2496905, 0.7636095, -0.5954454, 5.96 },
+    { 0.6010478, -0.5349741, -0.5937544, 5.96 },
+    { -0.1804439, 0.7862065, -0.5910324, 5.96 },
+    { 0.3087502, 0.7516117, -0.5828835, 5.96 },
+    { -0.0218116, -0.8213325, -0.5700326, 5.96 },
+    { -0.0199521, -0.8242169, -0.5659227, 5.96 },
+    { -0.5890281, -0.6237233, -0.5138241, 5.96 },
+    { -0.5599316, 0.6946748, -0.4515568, 5.96 },
+    { 0.7816730, -0.4305585, -0.4512280, 5.96 },
+    { 0.0151257, 0.9214662, -0.3881640, 5.96 },
+    { 0.3659511, 0.8689708, -0.3331208, 5.96 },
+    { 0.1697620, 0.9350677, -0.3111741, 5.96 },
+    { -0.6670332, 0.6873140, -0.2875175, 5.96 },
+    { 0.9589908, -0.1057754, -0.2629606, 5.96 },
+    { 0.1254008, -0.9596309, -0.2517602, 5.96 },
+    { -0.2576838, 0.9551042, -0.1462020, 5.96 },
+    { -0.5788424, 0.8048032, -0.1312755, 5.96 },
+    { 0.0924970, 0.9891095, -0.1144844, 5.96 },
+    { 0.5743000, 0.8127536, -0.0980364, 5.96 },
+    { 0.7483199, -0.6342463, 0.1942909, 5.96 },
+    { -0.9218468, -0.2520158, 0.2944258, 5.96 },
+    { 0.4858407, -0.8144140, 0.3173148, 5.96 },
+    { -0.1758621, -0.8983096, 0.4026318, 5.96 },
+    { 0.7638038, 0.4989858, 0.4094104, 5.96 },
+    { 0.5354828, 0.7064119, 0.4628612, 5.96 },
+    { 0.0786982, 0.8692364, 0.4880928, 5.96 },
+    { -0.8370708, 0.0025817, 0.5470885, 5.96 },
+    { 0.1565320, 0.8110135, 0.5636975, 5.96 },
+    { 0.5032968, 0.5880532, 0.6331554, 5.96 },
+    { 0.6750121, 0.2669496, 0.6878202, 5.96 },
+    { 0.4931239, -0.5080727, 0.7061806, 5.96 },
+    { -0.0049229, 0.6565753, 0.7542444, 5.96 },
+    { 0.2594200, -0.5988162, 0.7577074, 5.96 },
+    { 0.2732283, -0.5740281, 0.7719054, 5.96 },
+    { 0.5232446, 0.0143113, 0.8520623, 5.96 },
+    { -0.4236242, -0.2199573, 0.8787271, 5.96 },
+    { 0.2202644, -0.3874270, 0.8952005, 5.96 },
+    { -0.3292202, 0.1516736, 0.9319921, 5.96 },
+    { -0.2212310, 0.1925220, 0.9560293, 5.96 },
+    { 0.0656402, 0.2665517, 0.9615828, 5.96 },
+    { 0.0939815, -0.1230803, 0.9879366, 5.96 },
+    { -0.1671602, 0.0593137, -0.9841440, 5.97 },
+    { 0.2167301, 0.0203695, -0.9760190, 5.97 },
+    { -0.3477650, -0.2025463, -0.9154423, 5.97 },
+    { -0.2549222, 0.3449480, -0.9033413, 5.97 },
+    { 0.4546377, -0.0052935, -0.8906607, 5.97 },
+    { -0.3064478, 0.4328118, -0.8477993, 5.97 },
+    { 0.5066238, -0.1823587, -0.8426610, 5.97 },
+    { -0.1965614, 0.5761590, -0.7933501, 5.97 },
+    { 0.1915166, -0.6370768, -0.7466288, 5.97 },
+    { -0.6152367, -0.4771405, -0.6275513, 5.97 },
+    { -0.6709128, 0.4296099, -0.6044099, 5.97 },
+    { -0.2074647, -0.7826614, -0.5868557, 5.97 },
+    { 0.6630590, -0.4985486, -0.5583924, 5.97 },
+    { -0.1911121, -0.8410416, -0.5060881, 5.97 },
+    { 0.8313017, -0.2567414, -0.4929720, 5.97 },
+    { 0.0153945, -0.9108374, -0.4124783, 5.97 },
+    { 0.8523663, -0.3288652, -0.4065949, 5.97 },
+    { 0.3882053, -0.8313880, -0.3976061, 5.97 },
+    { -0.9224444, -0.0814268, -0.3774466, 5.97 },
+    { 0.9053739, -0.2310364, -0.3562588, 5.97 },
+    { 0.2722106, -0.9236002, -0.2699334, 5.97 },
+    { -0.1554888, 0.9605923, -0.2304031, 5.97 },
+    { 0.2220467, 0.9507462, -0.2162796, 5.97 },
+    { 0.0339197, 0.9869924, -0.1571479, 5.97 },
+    { -0.3640352, 0.9259339, -0.1006222, 5.97 },
+    { 0.0496741, 0.9962097, -0.0714051, 5.97 },
+    { -0.9102457, 0.4079275, -0.0710482, 5.97 },
+    { -0.9299120, -0.3671929, -0.0208115, 5.97 },
+    { -0.0127769, -0.9999177, 0.0011587, 5.97 },
+    { -0.2538884, 0.9651908, 0.0628287, 5.97 },
+    { 0.0425405, 0.9961135, 0.0771246, 5.97 },
+    { -0.4620147, -0.8798855, 0.1111028, 5.97 },
+    { 0.7109665, 0.6879525, 0.1457670, 5.97 },
+    { -0.2692320, 0.9498899, 0.1588182, 5.97 },
+    { 0.9819886, -0.0862655, 0.1680970, 5.97 },
+    { -0.1683430, 0.9597848, 0.2246638, 5.97 },
+    { 0.6154321, -0.7394308, 0.2729202, 5.97 },
+    { 0.8699730, 0.4041972, 0.2824387, 5.97 },
+    { 0.5017439, 0.8121297, 0.2978229, 5.97 },
+    { 0.8754901, 0.3335084, 0.3496987, 5.97 },
+    { -0.8251707, 0.4000660, 0.3987989, 5.97 },
+    { 0.2554970, 0.8460491, 0.4678913, 5.97 },
+    { 0.8750572, -0.0395187, 0.4824036, 5.97 },
+    { -0.6191800, 0.5418682, 0.5683265, 5.97 },
+    { 0.5748952, -0.5688326, 0.5881539, 5.97 },
+    { 0.2396162, 0.7238968, 0.6469602, 5.97 },
+    { 0.7353474, -0.0094337, 0.6776247, 5.97 },
+    { -0.5194354, 0.4455246, 0.7291740, 5.97 },
+    { -0.3476518, -0.4753177, 0.8082149, 5.97 },
+    { 0.3881089, 0.1013088, 0.9160284, 5.97 },
+    { -0.0409603, 0.3306939, 0.9428488, 5.97 },
+    { 0.1283093, -0.1031372, 0.9863566, 5.97 },
+    { 0.4874440, 0.0918763, -0.8683071, 5.98 },
+    { -0.0631044, 0.6099117, -0.7899529, 5.98 },
+    { 0.6409475, -0.2250381, -0.7338557, 5.98 },
+    { -0.6541519, -0.2950173, -0.6964554, 5.98 },
+    { -0.4339551, 0.5920938, -0.6790492, 5.98 },
+    { -0.6676975, -0.3244572, -0.6700056, 5.98 },
+    { -0.6630691, 0.3428525, -0.6654258, 5.98 },
+    { -0.6757304, -0.3256314, -0.6613264, 5.98 },
+    { -0.7499285, -0.1729514, -0.6385100, 5.98 },
+    { -0.5262554, -0.5749354, -0.6265018, 5.98 },
+    { -0.1847353, -0.7745130, -0.6049814, 5.98 },
+    { -0.7945568, 0.0574662, -0.6044643, 5.98 },
+    { -0.6567488, 0.4707424, -0.5891372, 5.98 },
+    { -0.8350705, 0.0933300, -0.5421686, 5.98 },
+    { 0.8958626, 0.1070042, -0.4312544, 5.98 },
+    { -0.5744952, 0.7769043, -0.2576336, 5.98 },
+    { 0.7372077, 0.6272290, -0.2512145, 5.98 },
+    { -0.9585569, -0.1745018, -0.2252061, 5.98 },
+    { -0.5540934, 0.8032165, -0.2186864, 5.98 },
+    { 0.0414138, 0.9985174, 0.0353249, 5.98 },
+    { -0.1089751, 0.9863609, 0.1233556, 5.98 },
+    { 0.4023073, -0.8943896, 0.1954892, 5.98 },
+    { 0.6590942, 0.7233728, 0.2057345, 5.98 },
+    { 0.6582975, -0.7207382, 0.2172115, 5.98 },
+    { -0.2684319, 0.9382961, 0.2180477, 5.98 },
+    { 0.9108063, 0.3053121, 0.2778782, 5.98 },
+    { -0.1417976, -0.9461584, 0.2909944, 5.98 },
+    { -0.7841230, -0.5292461, 0.3241137, 5.98 },
+    { 0.3808914, 0.8651466, 0.3262561, 5.98 },
+    { -0.0370984, -0.9243570, 0.3797208, 5.98 },
+    { -0.5256434, 0.7469781, 0.4070905, 5.98 },
+    { 0.8960821, -0.1272395, 0.4252611, 5.98 },
+    { -0.6558693, 0.6074036, 0.4482146, 5.98 },
+    { -0.0043743, 0.8568441, 0.5155570, 5.98 },
+    { 0.2632620, -0.8130508, 0.5192701, 5.98 },
+    { 0.7816554, -0.3327192, 0.5275535, 5.98 },
+    { 0.0265425, 0.8294173, 0.5579986, 5.98 },
+    { 0.8028803, 0.2085244, 0.5584809, 5.98 },
+    { -0.7383384, -0.3550334, 0.5734176, 5.98 },
+    { 0.7226435, 0.2034827, 0.6605915, 5.98 },
+    { 0.3420957, 0.4608422, 0.8188986, 5.98 },
+    { 0.4262167, -0.3664802, 0.8270620, 5.98 },
+    { 0.4425008, 0.3043351, 0.8435480, 5.98 },
+    { -0.2971757, -0.3625019, 0.8833340, 5.98 },
+    { -0.1740885, 0.2470797, 0.9532286, 5.98 },
+    { -0.1268874, -0.2560571, 0.9582976, 5.98 },
+    { 0.2744725, -0.0247958, 0.9612752, 5.98 },
+    { -0.0711893, -0.2041410, 0.9763496, 5.98 },
+    { -0.1137748, -0.0545027, 0.9920105, 5.98 },
+    { -0.3164600, 0.0941905, -0.9439180, 5.99 },
+    { -0.4224525, 0.0758682, -0.9032042, 5.99 },
+    { -0.3691696, 0.2986948, -0.8800541, 5.99 },
+    { -0.4805464, -0.1455505, -0.8648064, 5.99 },
+    { 0.4108016, 0.5383611, -0.7358053, 5.99 },
+    { -0.4197637, 0.5482344, -0.7233516, 5.99 },
+    { -0.3496322, 0.6115436, -0.7097688, 5.99 },
+    { 0.1565197, 0.8741632, -0.4597176, 5.99 },
+    { -0.0632362, 0.9463422, -0.3169189, 5.99 },
+    { -0.2134039, -0.9289449, -0.3025228, 5.99 },
+    { 0.8017594, -0.5407079, -0.2545916, 5.99 },
+    { -0.1874031, -0.9494621, -0.2517972, 5.99 },
+    { 0.7640034, -0.6245598, -0.1619378, 5.99 },
+    { 0.9875181, 0.0357360, -0.1533979, 5.99 },
+    { 0.6056694, 0.7868447, -0.1184906, 5.99 },
+    { 0.2139454, -0.9713986, -0.1030148, 5.99 },
+    { 0.6768951, -0.7295210, -0.0980413, 5.99 },
+    { -0.0673090, 0.9940462, -0.0856831, 5.99 },
+    { -0.9635790, -0.2608884, -0.0587595, 5.99 },
+    { 0.5299931, -0.8479193, -0.0118384, 5.99 },
+    { -0.3504441, 0.9365785, 0.0030926, 5.99 },
+    { 0.2804682, 0.9598286, 0.0081593, 5.99 },
+    { -0.6246191, 0.7723734, 0.1152839, 5.99 },
+    { 0.9719293, 0.2039017, 0.1173780, 5.99 },
+    { 0.7012292, -0.7008326, 0.1308098, 5.99 },
+    { -0.8527079, -0.4989813, 0.1546189, 5.99 },
+    { 0.0152039, 0.9861405, 0.1652145, 5.99 },
+    { 0.6261778, -0.7379066, 0.2517841, 5.99 },
+    { -0.4849648, 0.8273867, 0.2832673, 5.99 },
+    { -0.4740096, 0.8333506, 0.2843268, 5.99 },
+    { 0.0750937, -0.9473739, 0.3111971, 5.99 },
+    { -0.4428198, 0.8333038, 0.3309312, 5.99 },
+    { 0.3814779, 0.8522059, 0.3580778, 5.99 },
+    { 0.9083525, -0.2118887, 0.3605535, 5.99 },
+    { -0.8938035, -0.2662555, 0.3608646, 5.99 },
+    { -0.4833043, 0.7863160, 0.3848691, 5.99 },
+    { 0.0752344, -0.8656613, 0.4949448, 5.99 },
+    { 0.7818529, 0.3714733, 0.5007132, 5.99 },
+    { -0.5629459, -0.6368637, 0.5267794, 5.99 },
+    { 0.0022152, -0.8366286, 0.5477660, 5.99 },
+    { -0.2702575, -0.7833484, 0.5597555, 5.99 },
+    { 0.2625567, 0.7397785, 0.6195092, 5.99 },
+    { -0.5071991, 0.5431113, 0.6691630, 5.99 },
+    { -0.4800416, 0.5139125, 0.7109529, 5.99 },
+    { -0.0502125, -0.6161172, 0.7860523, 5.99 },
+    { 0.5851205, 0.1678911, 0.7933767, 5.99 },
+    { 0.0929944, -0.4750586, 0.8750265, 5.99 },
+    { 0.2261533, -0.0213761, -0.9738572, 6.00 },
+    { 0.1551668, -0.1815994, -0.9710535, 6.00 },
+    { -0.4385200, -0.0526979, -0.8971751, 6.00 },
+    { -0.4767502, 0.1546986, -0.8653194, 6.00 },
+    { -0.4828188, 0.1931304, -0.8541585, 6.00 },
+    { -0.4936763, -0.2379482, -0.8364594, 6.00 },
+    { -0.5468044, -0.1041890, -0.8307525, 6.00 },
+    { -0.4698857, 0.3235572, -0.8212906, 6.00 },
+    { -0.5046773, -0.2813326, -0.8161819, 6.00 },
+    { -0.4851805, -0.3518798, -0.8004876, 6.00 },
+    { -0.5255768, -0.3334871, -0.7826592, 6.00 },
+    { -0.5831715, -0.2719213, -0.7654866, 6.00 },
+    { -0.1697400, -0.6385092, -0.7506626, 6.00 },
+    { 0.5417791, -0.4539692, -0.7073806, 6.00 },
+    { -0.5021856, 0.5463620, -0.6702971, 6.00 },
+    { -0.0560066, 0.7722054, -0.6328998, 6.00 },
+    { -0.5746961, 0.5188991, -0.6328255, 6.00 },
+    { -0.3348249, 0.7183056, -0.6098601, 6.00 },
+    { 0.0171053, -0.8098468, -0.5863920, 6.00 },
+    { -0.1222684, -0.8597701, -0.4958284, 6.00 },
+    { 0.4017005, 0.8446964, -0.3537297, 6.00 },
+    { -0.9361597, -0.1597818, -0.3131689, 6.00 },
+    { -0.8834279, 0.4153330, -0.2169186, 6.00 },
+    { 0.5062581, 0.8365217, -0.2096048, 6.00 },
+    { -0.9520315, -0.2299323, -0.2019089, 6.00 },
+    { -0.5960349, 0.7849032, -0.1693204, 6.00 },
+    { 0.8236269, -0.5437439, -0.1611871, 6.00 },
+    { -0.6862000, 0.7212214, -0.0947058, 6.00 },
+    { 0.0890693, 0.9940829, -0.0621755, 6.00 },
+    { 0.0735074, -0.9959139, -0.0524614, 6.00 },
+    { 0.7913406, 0.6113593, 0.0044559, 6.00 },
+    { 0.0229683, 0.9995934, 0.0168993, 6.00 },
+    { 0.9555248, 0.2779530, 0.0985623, 6.00 },
+    { 0.8603652, -0.4960733, 0.1169741, 6.00 },
+    { -0.0961269, 0.9712857, 0.2176322, 6.00 },
+    { -0.5281554, -0.8150127, 0.2383404, 6.00 },
+    { -0.8406762, -0.4788563, 0.2529034, 6.00 },
+    { 0.0555576, 0.9605056, 0.2726581, 6.00 },
+    { -0.1736336, -0.9387438, 0.2976767, 6.00 },
+    { 0.3018297, -0.8886116, 0.3453523, 6.00 },
+    { -0.7801117, 0.2106844, 0.5890992, 6.00 },
+    { -0.0045552, -0.8060414, 0.5918416, 6.00 },
+    { -0.4620632, -0.6560490, 0.5967389, 6.00 },
+    { -0.2006418, 0.7614589, 0.6163791, 6.00 },
+    { -0.7625091, 0.1882783, 0.6189759, 6.00 },
+    { 0.0951893, 0.7433262, 0.6621217, 6.00 },
+    { 0.2244496, -0.6440172, 0.7313441, 6.00 },
+    { 0.6773164, -0.0131234, 0.7355748, 6.00 },
+    { -0.1941816, -0.6481982, 0.7362966, 6.00 },
+    { -0.6010793, 0.2820561, 0.7477620, 6.00 },
+    { 0.1061234, -0.6037041, 0.7901134, 6.00 },
+    { -0.5304943, 0.2459097, 0.8112362, 6.00 },
+    { 0.5384905, -0.0104296, 0.8425670, 6.00 },
+    { -0.4284226, -0.1183693, 0.8957917, 6.00 },
+    { 0.3646559, 0.2166855, 0.9055791, 6.00 },
+    { -0.3637630, 0.1233626, 0.9232866, 6.00 },
+    { -0.1440175, -0.0069177, 0.9895510, 6.00 },
+    { -0.1976571, -0.2206082, -0.9551250, 6.01 },
+    { 0.2709561, -0.1802274, -0.9455691, 6.01 },
+    { 0.1026658, -0.3827644, -0.9181237, 6.01 },
+    { -0.3783253, 0.1617175, -0.9114370, 6.01 },
+    { 0.4829162, 0.2131253, -0.8493348, 6.01 },
+    { -0.4864757, -0.2238010, -0.8445440, 6.01 },
+    { -0.0352610, -0.5354728, -0.8438160, 6.01 },
+    { 0.4862336, -0.2795920, -0.8278920, 6.01 },
+    { -0.3621900, -0.5769618, -0.7320748, 6.01 },
+    { 0.6989023, 0.1228166, -0.7045933, 6.01 },
+    { 0.5958136, 0.5093676, -0.6209274, 6.01 },
+    { -0.4311612, -0.6606636, -0.6145109, 6.01 },
+    { -0.1719450, -0.8262655, -0.5363957, 6.01 },
+    { -0.4125246, -0.7409449, -0.5299283, 6.01 },
+    { -0.0051575, -0.8766344, -0.4811295, 6.01 },
+    { 0.5105034, 0.7209753, -0.4685947, 6.01 },
+    { -0.3081888, 0.8363168, -0.4534245, 6.01 },
+    { 0.3752918, 0.8189686, -0.4341042, 6.01 },
+    { 0.4660084, -0.7958958, -0.3865048, 6.01 },
+    { -0.2904844, 0.8758007, -0.3854762, 6.01 },
+    { -0.5529104, 0.7518823, -0.3591142, 6.01 },
+    { -0.8716871, -0.3702195, -0.3210905, 6.01 },
+    { 0.6807374, -0.6885143, -0.2500895, 6.01 },
+    { 0.8272673, 0.5340063, -0.1745452, 6.01 },
+    { -0.4206269, 0.8959910, -0.1423837, 6.01 },
+    { -0.5879273, 0.8047231, -0.0822323, 6.01 },
+    { 0.8856808, -0.4582936, -0.0744078, 6.01 },
+    { -0.8439505, 0.5312934, -0.0739920, 6.01 },
+    { -0.7833609, 0.6210419, -0.0255469, 6.01 },
+    { -0.2364742, -0.9715604, 0.0122606, 6.01 },
+    { 0.8743820, 0.4841635, 0.0322777, 6.01 },
+    { 0.0701016, -0.9966767, 0.0414886, 6.01 },
+    { -0.8821044, -0.4612102, 0.0957970, 6.01 },
+    { 0.3623604, 0.9175760, 0.1635517, 6.01 },
+    { 0.4145790, -0.8781228, 0.2387980, 6.01 },
+    { 0.4542428, 0.8516152, 0.2615627, 6.01 },
+    { -0.5478937, -0.7896886, 0.2760516, 6.01 },
+    { -0.5256647, 0.8017961, 0.2842529, 6.01 },
+    { 0.2993946, 0.8984425, 0.3211915, 6.01 },
+    { -0.6869364, -0.6484414, 0.3280887, 6.01 },
+    { -0.6845603, 0.6253725, 0.3745482, 6.01 },
+    { -0.7033179, -0.5511587, 0.4489634, 6.01 },
+    { -0.8877853, -0.0417440, 0.4583609, 6.01 },
+    { 0.1919842, 0.8615657, 0.4699432, 6.01 },
+    { 0.2182894, -0.8017790, 0.5563274, 6.01 },
+    { -0.1861186, 0.7895397, 0.5847964, 6.01 },
+    { 0.1519000, -0.7887748, 0.5956179, 6.01 },
+    { 0.7419169, 0.0149310, 0.6703255, 6.01 },
+    { -0.4426828, -0.5470833, 0.7104447, 6.01 },
+    { 0.3405238, -0.5217154, 0.7822126, 6.01 },
+    { 0.4773611, -0.1435259, 0.8669064, 6.01 },
+    { -0.2507307, 0.4269041, 0.8688423, 6.01 },
+    { 0.3169626, -0.3767443, 0.8704013, 6.01 },
+    { -0.2426372, -0.0636415, 0.9680274, 6.01 },
+    { 0.1784017, 0.0072720, 0.9839309, 6.01 },
+    { -0.2213571, -0.1389266, -0.9652463, 6.02 },
+    { -0.1250888, -0.4320476, -0.8931336, 6.02 },
+    { -0.1394390, 0.4289380, -0.8925071, 6.02 },
+    { -0.1358914, 0.4977177, -0.8566275, 6.02 },
+    { -0.5057803, 0.1202879, -0.8542348, 6.02 },
+    { -0.3945202, 0.3450977, -0.8516228, 6.02 },
+    { -0.5274990, -0.1940945, -0.8270866, 6.02 },
+    { -0.5126977, -0.3702399, -0.7746377, 6.02 },
+    { -0.3287677, 0.5680202, -0.7544964, 6.02 },
+    { 0.7035398, -0.0880982, -0.7051741, 6.02 },
+    { -0.3490327, 0.6311333, -0.6927098, 6.02 },
+    { -0.7398496, -0.0972886, -0.6657008, 6.02 },
+    { -0.6006977, -0.4966174, -0.6265248, 6.02 },
+    { -0.1082345, -0.7936115, -0.5987204, 6.02 },
+    { -0.8049087, -0.2177206, -0.5520142, 6.02 },
+    { -0.2824490, -0.8321058, -0.4773074, 6.02 },
+    { -0.1658328, -0.9378126, -0.3049705, 6.02 },
+    { 0.9602672, 0.1859476, -0.2081113, 6.02 },
+    { 0.0740335, 0.9902098, -0.1183366, 6.02 },
+    { -0.8477392, 0.5286819, 0.0428207, 6.02 },
+    { -0.9733599, -0.2229955, 0.0533241, 6.02 },
+    { -0.7885954, -0.6092586, 0.0831942, 6.02 },
+    { -0.4213183, 0.9023188, 0.0911680, 6.02 },
+    { -0.8210106, 0.5354228, 0.1981516, 6.02 },
+    { 0.3346429, -0.9208841, 0.1999665, 6.02 },
+    { -0.4851773, 0.8438785, 0.2290678, 6.02 },
+    { 0.3608935, 0.8917095, 0.2731483, 6.02 },
+    { -0.5197452, 0.7987214, 0.3031651, 6.02 },
+    { 0.8770602, 0.3627598, 0.3149138, 6.02 },
+    { -0.6489704, -0.6919298, 0.3163395, 6.02 },
+    { -0.8354468, 0.4142886, 0.3611006, 6.02 },
+    { -0.2594572, 0.8857416, 0.3848946, 6.02 },
+    { -0.3280239, 0.8604740, 0.3898522, 6.02 },
+    { 0.3272191, 0.8578774, 0.3961995, 6.02 },
+    { 0.0121939, 0.9116827, 0.4107140, 6.02 },
+    { -0.5586104, -0.7127318, 0.4242262, 6.02 },
+    { -0.9025474, 0.0622417, 0.4260684, 6.02 },
+    { 0.7559017, 0.4871454, 0.4373809, 6.02 },
+    { 0.6012167, 0.6587049, 0.4523785, 6.02 },
+    { -0.0875189, -0.8546216, 0.5118226, 6.02 },
+    { -0.8022699, 0.2833569, 0.5254255, 6.02 },
+    { 0.8183388, -0.1909542, 0.5420867, 6.02 },
+    { 0.7915728, 0.2737708, 0.5463168, 6.02 },
+    { 0.1966845, -0.8056838, 0.5587386, 6.02 },
+    { -0.3592744, 0.7471414, 0.5591973, 6.02 },
+    { -0.7696728, -0.2766062, 0.5754066, 6.02 },
+    { 0.3932337, -0.7040645, 0.5913210, 6.02 },
+    { 0.1710995, 0.7768341, 0.6060146, 6.02 },
+    { -0.7577818, -0.2376384, 0.6076962, 6.02 },
+    { 0.1479851, -0.7553619, 0.6383798, 6.02 },
+    { -0.6876616, 0.2937849, 0.6639367, 6.02 },
+    { 0.7335249, -0.1346601, 0.6661891, 6.02 },
+    { -0.4386438, 0.5998075, 0.6691955, 6.02 },
+    { -0.7077344, 0.1885015, 0.6808665, 6.02 },
+    { 0.3890248, 0.6056012, 0.6941951, 6.02 },
+    { -0.0097912, -0.7026959, 0.7114229, 6.02 },
+    { 0.4879328, 0.4734876, 0.7333015, 6.02 },
+    { -0.5526604, -0.2692869, 0.7887021, 6.02 },
+    { 0.4784586, -0.3660077, 0.7981953, 6.02 },
+    { -0.2730466, 0.5184536, 0.8103403, 6.02 },
+    { 0.4120839, 0.2344654, 0.8804617, 6.02 },
+    { -0.4275005, 0.0699009, 0.9013086, 6.02 },
+    { -0.3057394, -0.0863525, -0.9481913, 6.03 },
+    { 0.0523039, 0.3607340, -0.9312010, 6.03 },
+    { -0.1259434, -0.3625174, -0.9234281, 6.03 },
+    { 0.3326203, 0.3110429, -0.8902899, 6.03 },
+    { -0.3767972, 0.4003260, -0.8353221, 6.03 },
+    { -0.3778299, 0.5789537, -0.7225353, 6.03 },
+    { -0.0851480, -0.6889596, -0.7197808, 6.03 },
+    { -0.3203342, 0.6474237, -0.6915407, 6.03 },
+    { 0.7624600, -0.0178247, -0.6467898, 6.03 },
+    { -0.3950146, -0.6581192, -0.6409701, 6.03 },
+    { 0.1939718, 0.7443386, -0.6390110, 6.03 },
+    { -0.0249480, -0.8124719, -0.5824663, 6.03 },
+    { -0.4279357, -0.7614575, -0.4868813, 6.03 },
+    { -0.9255004, -0.1707796, -0.3380582, 6.03 },
+    { -0.1603711, 0.9434137, -0.2902615, 6.03 },
+    { -0.8962691, 0.3427972, -0.2814102, 6.03 },
+    { -0.2869292, 0.9162482, -0.2795725, 6.03 },
+    { 0.2761976, -0.9195697, -0.2794753, 6.03 },
+    { -0.2968085, -0.9196227, -0.2572911, 6.03 },
+    { 0.8646297, -0.4385094, -0.2452040, 6.03 },
+    { 0.0538308, 0.9816746, -0.1828037, 6.03 },
+    { -0.3140874, 0.9323499, -0.1790889, 6.03 },
+    { -0.3193435, -0.9474717, 0.0178068, 6.03 },
+    { 0.3053316, 0.9501871, 0.0625868, 6.03 },
+    { 0.7482995, 0.6582557, 0.0821419, 6.03 },
+    { 0.9402887, 0.3178442, 0.1217880, 6.03 },
+    { -0.6165023, 0.7735128, 0.1469789, 6.03 },
+    { -0.1379375, 0.9695531, 0.2023363, 6.03 },
+    { 0.5661324, 0.7275118, 0.3875831, 6.03 },
+    { -0.9085265, -0.1005096, 0.4055582, 6.03 },
+    { -0.1512491, 0.8676989, 0.4735212, 6.03 },
+    { -0.0747028, -0.8520733, 0.5180643, 6.03 },
+    { -0.3895838, 0.7401765, 0.5480540, 6.03 },
+    { -0.6266800, -0.5013550, 0.5965864, 6.03 },
+    { 0.7440729, -0.2723963, 0.6100457, 6.03 },
+    { 0.5679158, -0.5346078, 0.6258323, 6.03 },
+    { -0.7144790, 0.2040585, 0.6692383, 6.03 },
+    { 0.4733170, -0.3739709, 0.7975693, 6.03 },
+    { -0.1436252, -0.5300757, 0.8356982, 6.03 },
+    { 0.1219084, 0.4679995, 0.8752798, 6.03 },
+    { 0.1372478, 0.2745212, 0.9517359, 6.03 },
+    { -0.0161512, -0.0613194, -0.9979875, 6.04 },
+    { 0.2370437, -0.1032541, -0.9659963, 6.04 },
+    { -0.2901394, -0.1046213, -0.9512484, 6.04 },
+    { -0.2901401, -0.2386879, -0.9267399, 6.04 },
+    { -0.4297075, -0.0533614, -0.9013900, 6.04 },
+    { 0.0946951, -0.4739921, -0.8754223, 6.04 },
+    { -0.3664816, -0.5363366, -0.7602857, 6.04 },
+    { 0.6337999, -0.1888486, -0.7500893, 6.04 },
+    { -0.5347457, 0.4645607, -0.7058544, 6.04 },
+    { -0.4755912, -0.5479487, -0.6881608, 6.04 },
+    { -0.3430461, 0.6474118, -0.6805713, 6.04 },
+    { 0.1005106, -0.7373338, -0.6680094, 6.04 },
+    { -0.4485274, -0.6329225, -0.6310565, 6.04 },
+    { -0.1265203, 0.7761879, -0.6176770, 6.04 },
+    { -0.5948508, -0.5385987, -0.5967109, 6.04 },
+    { 0.5707671, -0.6121798, -0.5472301, 6.04 },
+    { 0.2548311, -0.8398654, -0.4792570, 6.04 },
+    { -0.7713021, -0.4199900, -0.4782274, 6.04 },
+    { -0.2034575, 0.8546012, -0.4777675, 6.04 },
+    { 0.3186197, -0.8246329, -0.4673993, 6.04 },
+    { 0.7179533, -0.6290188, -0.2981246, 6.04 },
+    { 0.7117105, 0.6667946, -0.2210275, 6.04 },
+    { -0.9159157, 0.3386258, -0.2154787, 6.04 },
+    { 0.4497976, -0.8729914, -0.1885951, 6.04 },
+    { -0.2373167, 0.9702001, -0.0489127, 6.04 },
+    { 0.9612082, 0.2747908, 0.0238511, 6.04 },
+    { -0.8528512, 0.5017322, 0.1446013, 6.04 },
+    { -0.9065860, 0.3864579, 0.1695645, 6.04 },
+    { 0.9767149, 0.1213742, 0.1769077, 6.04 },
+    { -0.8625046, -0.4600841, 0.2107329, 6.04 },
+    { 0.6135367, 0.7587936, 0.2186438, 6.04 },
+    { -0.4455879, 0.8648548, 0.2312522, 6.04 },
+    { -0.0485939, 0.9705866, 0.2357971, 6.04 },
+    { 0.7586912, 0.5975762, 0.2594039, 6.04 },
+    { -0.9590287, 0.0450239, 0.2797085, 6.04 },
+    { 0.8531671, -0.3813721, 0.3558950, 6.04 },
+    { -0.1573361, 0.9135325, 0.3751050, 6.04 },
+    { 0.8940900, 0.1640962, 0.4167440, 6.04 },
+    { -0.7961323, 0.3976746, 0.4561011, 6.04 },
+    { -0.8421645, 0.2659570, 0.4690691, 6.04 },
+    { 0.0722039, 0.8508734, 0.5203855, 6.04 },
+    { 0.6484813, -0.5375826, 0.5389591, 6.04 },
+    { -0.1990540, -0.7967573, 0.5705746, 6.04 },
+    { 0.5572117, 0.5477536, 0.6240842, 6.04 },
+    { 0.0444709, -0.7783571, 0.6262448, 6.04 },
+    { 0.1274051, -0.7591381, 0.6383395, 6.04 },
+    { -0.0264798, -0.7657865, 0.6425495, 6.04 },
+    { 0.6863736, 0.1841059, 0.7035597, 6.04 },
+    { -0.1352558, -0.6318536, 0.7631952, 6.04 },
+    { -0.0376075, 0.6258489, 0.7790371, 6.04 },
+    { 0.1115576, 0.4691308, 0.8760543, 6.04 },
+    { 0.4221363, -0.1901515, 0.8863652, 6.04 },
+    { 0.1799290, 0.1069968, 0.9778432, 6.04 },
+    { 0.0000431, -0.1736343, 0.9848102, 6.04 },
+    { -0.0761635, -0.0007761, -0.9970950, 6.05 },
+    { -0.1239025, 0.1435338, -0.9818586, 6.05 },
+    { 0.0205979, 0.1927808, -0.9810256, 6.05 },
+    { 0.0745508, 0.2003585, -0.9768821, 6.05 },
+    { -0.2867530, -0.1084648, -0.9518446, 6.05 },
+    { -0.2838178, -0.1817100, -0.9415036, 6.05 },
+    { 0.3270539, -0.0958591, -0.9401313, 6.05 },
+    { 0.2545441, 0.2979885, -0.9200055, 6.05 },
+    { -0.2693398, 0.3084782, -0.9123033, 6.05 },
+    { 0.1923450, -0.3655038, -0.9107197, 6.05 },
+    { -0.3324609, 0.2627106, -0.9057885, 6.05 },
+    { 0.2742023, 0.4688409, -0.8396436, 6.05 },
+    { -0.3604572, 0.4852676, -0.7966091, 6.05 },
+    { -0.2099936, 0.5741694, -0.7913483, 6.05 },
+    { 0.1229516, 0.6028227, -0.7883449, 6.05 },
+    { -0.6198204, 0.0022132, -0.7847406, 6.05 },
+    { 0.6293740, -0.1086180, -0.7694742, 6.05 },
+    { -0.5714672, 0.3376002, -0.7479648, 6.05 },
+    { 0.2455899, 0.7331740, -0.6341463, 6.05 },
+    { -0.2566730, -0.7432527, -0.6178142, 6.05 },
+    { -0.6081756, 0.5080938, -0.6098878, 6.05 },
+    { -0.7521821, -0.3578128, -0.5533463, 6.05 },
+    { 0.4019373, -0.7787962, -0.4815837, 6.05 },
+    { -0.8165695, 0.3307032, -0.4731275, 6.05 },
+    { 0.6355131, -0.6258529, -0.4521407, 6.05 },
+    { -0.1102924, -0.8899121, -0.4425969, 6.05 },
+    { -0.3996574, -0.8094736, -0.4301470, 6.05 },
+    { -0.0048014, 0.9031892, -0.4292158, 6.05 },
+    { -0.1574547, 0.9020545, -0.4018776, 6.05 },
+    { -0.1804855, 0.8993944, -0.3981390, 6.05 },
+    { -0.3373378, 0.8637601, -0.3743283, 6.05 },
+    { 0.2565217, -0.9085987, -0.3296133, 6.05 },
+    { -0.9552036, -0.0712137, -0.2872537, 6.05 },
+    { -0.9533658, 0.1118127, -0.2803419, 6.05 },
+    { -0.3671705, 0.8934235, -0.2588055, 6.05 },
+    { 0.2248217, 0.9475841, -0.2270234, 6.05 },
+    { -0.8797526, -0.4445147, -0.1686476, 6.05 },
+    { 0.0976776, 0.9898261, -0.1034575, 6.05 },
+    { 0.6698696, 0.7394967, -0.0664776, 6.05 },
+    { -0.9197845, 0.3869574, -0.0652725, 6.05 },
+    { 0.7597623, 0.6477802, -0.0560534, 6.05 },
+    { 0.2377394, 0.9698804, -0.0530278, 6.05 },
+    { -0.9872033, 0.1594500, 0.0022985, 6.05 },
+    { 0.6983201, -0.7157399, 0.0080915, 6.05 },
+    { 0.6922968, 0.7208797, 0.0325204, 6.05 },
+    { 0.3842109, -0.9212885, 0.0600797, 6.05 },
+    { -0.5716151, 0.8176284, 0.0688477, 6.05 },
+    { 0.6914785, -0.7180611, 0.0790299, 6.05 },
+    { -0.9819428, -0.1351941, 0.1323290, 6.05 },
+    { -0.4840722, 0.8620320, 0.1502496, 6.05 },
+    { 0.9778145, 0.0781872, 0.1943337, 6.05 },
+    { -0.3939325, -0.8454811, 0.3605260, 6.05 },
+    { -0.0038942, 0.8864198, 0.4628659, 6.05 },
+    { 0.6678215, -0.5471005, 0.5046737, 6.05 },
+    { 0.3741766, -0.7743807, 0.5102219, 6.05 },
+    { 0.3622648, -0.7439320, 0.5615419, 6.05 },
+    { 0.5997077, -0.5332024, 0.5966957, 6.05 },
+    { 0.3244509, -0.7303992, 0.6010396, 6.05 },
+    { 0.7744569, -0.0996854, 0.6247234, 6.05 },
+    { 0.5243526, 0.5494079, 0.6505423, 6.05 },
+    { -0.2336655, -0.6902870, 0.6847658, 6.05 },
+    { 0.6944734, 0.1418656, 0.7053941, 6.05 },
+    { -0.3244420, -0.5567383, 0.7647090, 6.05 },
+    { -0.0079011, 0.6440002, 0.7649845, 6.05 },
+    { 0.0407508, 0.5492378, 0.8346719, 6.05 },
+    { -0.1325276, 0.5197369, 0.8439846, 6.05 },
+    { 0.1679625, -0.1758574, 0.9699808, 6.05 },
+    { 0.0629588, -0.1691330, 0.9835803, 6.05 },
+    { 0.1278379, 0.0809889, 0.9884828, 6.05 },
+    { 0.1520908, 0.0773063, -0.9853386, 6.06 },
+    { 0.0629571, -0.2856036, -0.9562777, 6.06 },
+    { -0.2914894, -0.1875492, -0.9380081, 6.06 },
+    { -0.3709319, 0.0698925, -0.9260262, 6.06 },
+    { -0.4112085, -0.0114595, -0.9114693, 6.06 },
+    { -0.4104835, -0.0306843, -0.9113516, 6.06 },
+    { 0.4261068, 0.2356439, -0.8734443, 6.06 },
+    { -0.2047102, -0.4926933, -0.8457819, 6.06 },
+    { -0.5384508, 0.0136492, -0.8425464, 6.06 },
+    { -0.4648430, 0.2999533, -0.8330361, 6.06 },
+    { 0.5692003, 0.0890246, -0.8173651, 6.06 },
+    { -0.2503741, 0.5430609, -0.8014971, 6.06 },
+    { -0.5789210, -0.1852394, -0.7940635, 6.06 },
+    { 0.0466108, -0.6266624, -0.7778957, 6.06 },
+    { -0.1653730, -0.6595365, -0.7332553, 6.06 },
+    { -0.6008804, 0.4854051, -0.6350785, 6.06 },
+    { 0.7694461, 0.1450934, -0.6220133, 6.06 },
+    { -0.7885640, -0.0363711, -0.6138762, 6.06 },
+    { -0.0170797, -0.8039266, -0.5944833, 6.06 },
+    { -0.0259334, -0.8275152, -0.5608441, 6.06 },
+    { -0.7408297, -0.3932229, -0.5445614, 6.06 },
+    { -0.6044447, -0.5863370, -0.5393102, 6.06 },
+    { -0.4679131, 0.7057135, -0.5320018, 6.06 },
+    { 0.9101568, 0.1446235, -0.3881993, 6.06 },
+    { -0.6943599, -0.6209839, -0.3636528, 6.06 },
+    { 0.9526450, 0.0355847, -0.3019956, 6.06 },
+    { 0.3255760, -0.9067836, -0.2678503, 6.06 },
+    { -0.0791927, 0.9625620, -0.2592353, 6.06 },
+    { 0.3625502, 0.9129823, -0.1871380, 6.06 },
+    { -0.2239468, -0.9744193, -0.0188378, 6.06 },
+    { 0.5724797, -0.8197028, -0.0188242, 6.06 },
+    { -0.1615415, 0.9810615, 0.1068768, 6.06 },
+    { -0.1451571, -0.9805395, 0.1321805, 6.06 },
+    { 0.3928839, 0.9073761, 0.1493680, 6.06 },
+    { 0.9180091, 0.2902914, 0.2701668, 6.06 },
+    { 0.9518346, 0.1177630, 0.2830948, 6.06 },
+    { 0.0312227, 0.9399590, 0.3398562, 6.06 },
+    { 0.9285304, -0.1060998, 0.3557726, 6.06 },
+    { 0.4698155, 0.7901844, 0.3935506, 6.06 },
+    { -0.1021518, 0.9125610, 0.3959765, 6.06 },
+    { -0.3065708, -0.8539875, 0.4203805, 6.06 },
+    { 0.2404265, -0.8252457, 0.5110427, 6.06 },
+    { 0.1766338, -0.8317402, 0.5263162, 6.06 },
+    { -0.6747174, -0.5169264, 0.5268239, 6.06 },
+    { 0.5536199, 0.6401607, 0.5326342, 6.06 },
+    { 0.2938683, -0.7802025, 0.5522005, 6.06 },
+    { -0.4845404, 0.6603362, 0.5737393, 6.06 },
+    { 0.7727049, 0.1836211, 0.6076269, 6.06 },
+    { 0.3671146, -0.6993752, 0.6132709, 6.06 },
+    { 0.4870704, -0.5827613, 0.6505010, 6.06 },
+    { -0.7328088, -0.0763204, 0.6761408, 6.06 },
+    { 0.5634644, 0.3731016, 0.7370909, 6.06 },
+    { 0.3701038, 0.5492536, 0.7492287, 6.06 },
+    { -0.2314337, 0.4916815, 0.8394568, 6.06 },
+    { 0.2398825, -0.4436996, 0.8634738, 6.06 },
+    { 0.4331326, -0.1391954, 0.8905172, 6.06 },
+    { 0.0652969, -0.4097034, 0.9098788, 6.06 },
+    { -0.3780450, 0.0843908, 0.9219328, 6.06 },
+    { 0.0674990, 0.2625812, 0.9625461, 6.06 },
+    { 0.0742205, 0.2313028, 0.9700466, 6.06 },
+    { -0.1823529, -0.1394359, -0.9732960, 6.07 },
+    { -0.0024009, -0.2389027, -0.9710405, 6.07 },
+    { -0.2509331, 0.0922299, -0.9636006, 6.07 },
+    { 0.3331953, -0.0226811, -0.9425850, 6.07 },
+    { 0.2008099, -0.3291510, -0.9226782, 6.07 },
+    { -0.3970756, -0.1381731, -0.9073253, 6.07 },
+    { 0.4530901, 0.0891768, -0.8869931, 6.07 },
+    { -0.3301494, -0.5124798, -0.7926953, 6.07 },
+    { -0.4568406, -0.4084812, -0.7902150, 6.07 },
+    { 0.0326257, -0.6746330, -0.7374319, 6.07 },
+    { -0.5280643, -0.4399009, -0.7263851, 6.07 },
+    { 0.6759873, -0.2369978, -0.6977630, 6.07 },
+    { -0.5165160, 0.5148509, -0.6842074, 6.07 },
+    { 0.2249934, 0.7165303, -0.6602744, 6.07 },
+    { -0.8212320, 0.2174389, -0.5275399, 6.07 },
+    { -0.1064989, 0.8935635, -0.4361218, 6.07 },
+    { 0.3941136, 0.8320915, -0.3902540, 6.07 },
+    { -0.0685946, 0.9198831, -0.3861475, 6.07 },
+    { 0.1311753, 0.9219257, -0.3644804, 6.07 },
+    { 0.0640813, -0.9452565, -0.3199746, 6.07 },
+    { -0.4296639, 0.8666456, -0.2536027, 6.07 },
+    { 0.9404528, -0.2537764, -0.2261550, 6.07 },
+    { -0.9907728, 0.0696364, -0.1162754, 6.07 },
+    { 0.9925638, -0.0496660, -0.1111326, 6.07 },
+    { 0.9984479, 0.0357462, -0.0427093, 6.07 },
+    { 0.9935480, 0.1065969, -0.0387226, 6.07 },
+    { -0.7510480, -0.6597838, -0.0247428, 6.07 },
+    { -0.3950727, -0.9177362, 0.0409601, 6.07 },
+    { 0.1209099, -0.9905081, 0.0653789, 6.07 },
+    { -0.7083439, 0.6989905, 0.0982917, 6.07 },
+    { -0.0679302, 0.9920777, 0.1056759, 6.07 },
+    { -0.9058365, 0.4080171, 0.1139402, 6.07 },
+    { 0.7833991, 0.5988906, 0.1661803, 6.07 },
+    { -0.5340472, 0.8280692, 0.1705726, 6.07 },
+    { 0.7274744, -0.6635773, 0.1744884, 6.07 },
+    { -0.5768406, -0.7931522, 0.1953575, 6.07 },
+    { -0.9576019, -0.2001705, 0.2071965, 6.07 },
+    { 0.2796340, -0.9152868, 0.2899223, 6.07 },
+    { 0.7394228, -0.5858238, 0.3317596, 6.07 },
+    { 0.0473830, 0.9331928, 0.3562388, 6.07 },
+    { 0.4975957, 0.7804437, 0.3785580, 6.07 },
+    { -0.6298301, 0.6199316, 0.4679731, 6.07 },
+    { 0.6708847, -0.4610073, 0.5808494, 6.07 },
+    { 0.2213935, 0.7763294, 0.5901674, 6.07 },
+    { -0.7453828, -0.2857525, 0.6022873, 6.07 },
+    { 0.5595460, -0.5447051, 0.6246636, 6.07 },
+    { 0.1501470, -0.7344389, 0.6618576, 6.07 },
+    { 0.4862231, 0.5541637, 0.6756402, 6.07 },
+    { 0.6831248, -0.0371367, 0.7293568, 6.07 },
+    { 0.4606871, 0.1048202, 0.8813513, 6.07 },
+    { -0.4509272, -0.0826898, 0.8887222, 6.07 },
+    { 0.3317195, 0.2205716, 0.9172297, 6.07 },
+    { 0.1259726, -0.3003990, 0.9454583, 6.07 },
+    { 0.1825863, 0.0698873, 0.9807028, 6.07 },
+    { -0.4800062, -0.0232278, -0.8769575, 6.08 },
+    { -0.5502085, -0.1040297, -0.8285219, 6.08 },
+    { -0.4812486, 0.3897364, -0.7851785, 6.08 },
+    { 0.1092372, 0.7082216, -0.6974879, 6.08 },
+    { -0.6744075, 0.2616706, -0.6904368, 6.08 },
+    { -0.7251819, -0.4846502, -0.4891068, 6.08 },
+    { -0.2607920, 0.8682786, -0.4219951, 6.08 },
+    { -0.1901951, 0.9139015, -0.3586223, 6.08 },
+    { -0.6261317, -0.7034961, -0.3362324, 6.08 },
+    { -0.8129641, 0.5080301, -0.2845959, 6.08 },
+    { -0.9585647, -0.1744895, -0.2251825, 6.08 },
+    { -0.8819510, 0.4294340, -0.1942909, 6.08 },
+    { 0.8039241, -0.5656976, -0.1835549, 6.08 },
+    { -0.4838804, -0.8708065, 0.0869244, 6.08 },
+    { -0.5774170, 0.7953301, 0.1844984, 6.08 },
+    { 0.5988063, -0.7782680, 0.1890236, 6.08 },
+    { -0.0145774, 0.9791822, 0.2024592, 6.08 },
+    { 0.7786210, -0.5912197, 0.2102585, 6.08 },
+    { -0.3306144, -0.9190318, 0.2146501, 6.08 },
+    { -0.2353074, -0.9431848, 0.2345907, 6.08 },
+    { 0.2902562, 0.9168746, 0.2740296, 6.08 },
+    { -0.4368623, -0.8525874, 0.2867856, 6.08 },
+    { 0.1513709, 0.9457889, 0.2873503, 6.08 },
+    { 0.1660816, 0.9240800, 0.3442283, 6.08 },
+    { 0.5869114, 0.7275935, 0.3551659, 6.08 },
+    { 0.5941893, -0.7133148, 0.3716465, 6.08 },
+    { -0.0650006, 0.9114434, 0.4062583, 6.08 },
+    { -0.2519512, -0.8648946, 0.4341404, 6.08 },
+    { 0.7271832, -0.4898529, 0.4808834, 6.08 },
+    { -0.0242045, 0.8699116, 0.4926134, 6.08 },
+    { 0.5595068, -0.6632414, 0.4970543, 6.08 },
+    { -0.5457441, -0.6691791, 0.5043439, 6.08 },
+    { 0.2458310, 0.7161250, 0.6532474, 6.08 },
+    { -0.6838550, -0.2876880, 0.6705058, 6.08 },
+    { 0.2015217, 0.6897667, 0.6954214, 6.08 },
+    { 0.1557762, 0.5790565, 0.8002670, 6.08 },
+    { 0.2378368, 0.4824444, 0.8430190, 6.08 },
+    { -0.5140550, -0.0678402, 0.8550703, 6.08 },
+    { 0.1197158, 0.5006067, 0.8573570, 6.08 },
+    { 0.4220625, -0.2880280, 0.8595947, 6.08 },
+    { 0.2564327, -0.1294188, 0.9578586, 6.08 },
+    { -0.1710879, -0.0993227, -0.9802367, 6.09 },
+    { -0.2982567, 0.0415150, -0.9535824, 6.09 },
+    { 0.2438502, -0.1951833, -0.9499687, 6.09 },
+    { -0.2942707, -0.2809824, -0.9134843, 6.09 },
+    { 0.1755003, -0.3694994, -0.9125074, 6.09 },
+    { 0.2477282, -0.3726904, -0.8942777, 6.09 },
+    { 0.4926473, -0.0803467, -0.8665120, 6.09 },
+    { -0.1083954, -0.5354106, -0.8376072, 6.09 },
+    { -0.0230764, -0.5995490, -0.8000053, 6.09 },
+    { 0.2583407, 0.5457031, -0.7971626, 6.09 },
+    { -0.5402697, -0.3876700, -0.7468739, 6.09 },
+    { 0.6838541, -0.0614329, -0.7270279, 6.09 },
+    { 0.7043629, -0.0491823, -0.7081341, 6.09 },
+    { -0.6547579, 0.2647282, -0.7079626, 6.09 },
+    { -0.3606910, 0.6442919, -0.6743811, 6.09 },
+    { 0.4497667, -0.6089448, -0.6533729, 6.09 },
+    { -0.2087606, -0.7640586, -0.6104370, 6.09 },
+    { 0.1388237, 0.8138980, -0.5641791, 6.09 },
+    { -0.6747855, -0.5327222, -0.5107559, 6.09 },
+    { -0.8796043, -0.0975243, -0.4656021, 6.09 },
+    { -0.0438223, 0.8939996, -0.4459197, 6.09 },
+    { -0.3053135, -0.8574573, -0.4141867, 6.09 },
+    { -0.2585597, 0.8901833, -0.3751275, 6.09 },
+    { 0.8287438, -0.4266481, -0.3621534, 6.09 },
+    { -0.3190931, 0.8883435, -0.3301900, 6.09 },
+    { -0.4242681, -0.8685156, -0.2562758, 6.09 },
+    { -0.9537811, 0.2308900, -0.1923317, 6.09 },
+    { 0.3629395, 0.9241752, -0.1190591, 6.09 },
+    { -0.6650145, 0.7380444, -0.1142195, 6.09 },
+    { -0.3478208, -0.9306211, -0.1138641, 6.09 },
+    { -0.9172825, -0.3819609, -0.1126883, 6.09 },
+    { -0.1866393, -0.9763876, -0.1087801, 6.09 },
+    { -0.7078617, -0.7009768, -0.0869679, 6.09 },
+    { 0.2012718, 0.9789332, 0.0343433, 6.09 },
+    { 0.3828970, -0.9224006, 0.0506661, 6.09 },
+    { 0.0651056, 0.9954273, 0.0698977, 6.09 },
+    { -0.3069151, 0.9466226, 0.0985329, 6.09 },
+    { 0.5083491, 0.8546984, 0.1052227, 6.09 },
+    { 0.2826220, -0.9484902, 0.1431472, 6.09 },
+    { 0.8107948, -0.5543837, 0.1878047, 6.09 },
+    { 0.8473722, 0.4864328, 0.2129399, 6.09 },
+    { 0.2546445, 0.9338647, 0.2511032, 6.09 },
+    { -0.5035636, -0.8183842, 0.2768954, 6.09 },
+    { 0.0424350, -0.9579958, 0.2836253, 6.09 },
+    { 0.4315620, 0.8517895, 0.2969999, 6.09 },
+    { 0.2551281, -0.9064805, 0.3364562, 6.09 },
+    { -0.7860630, 0.5015726, 0.3612892, 6.09 },
+    { 0.8629478, 0.2150564, 0.4572437, 6.09 },
+    { 0.4982613, -0.6945342, 0.5189971, 6.09 },
+    { 0.3649887, -0.7332007, 0.5737595, 6.09 },
+    { 0.1794001, -0.7831710, 0.5953644, 6.09 },
+    { 0.3705398, 0.6987598, 0.6119109, 6.09 },
+    { 0.0769640, 0.7601101, 0.6452203, 6.09 },
+    { 0.2694969, 0.6790709, 0.6828134, 6.09 },
+    { -0.0334128, 0.6590095, 0.7513921, 6.09 },
+    { -0.1570226, -0.6396430, 0.7524631, 6.09 },
+    { 0.4075113, 0.5121139, 0.7560912, 6.09 },
+    { 0.5351656, -0.3655844, 0.7615418, 6.09 },
+    { 0.2538419, -0.4609345, 0.8503550, 6.09 },
+    { 0.0813553, -0.4505931, 0.8890147, 6.09 },
+    { -0.3569604, -0.2758116, 0.8924726, 6.09 },
+    { -0.3041116, -0.1398141, -0.9423206, 6.10 },
+    { 0.3516059, 0.2023556, -0.9140161, 6.10 },
+    { -0.4547550, 0.0320355, -0.8900403, 6.10 },
+    { -0.3654842, 0.2748046, -0.8893277, 6.10 },
+    { -0.4476156, 0.2255638, -0.8653099, 6.10 },
+    { -0.4244488, -0.3728273, -0.8251321, 6.10 },
+    { -0.2932703, 0.5009600, -0.8142675, 6.10 },
+    { -0.2939655, -0.5086506, -0.8092335, 6.10 },
+    { -0.0641185, -0.5934321, -0.8023261, 6.10 },
+    { 0.5399621, 0.3023985, -0.7854910, 6.10 },
+    { -0.3814692, -0.4902533, -0.7836664, 6.10 },
+    { 0.0150214, 0.6475882, -0.7618424, 6.10 },
+    { -0.5990075, 0.2541659, -0.7593350, 6.10 },
+    { -0.5979864, -0.3245056, -0.7328768, 6.10 },
+    { 0.2692054, 0.6273471, -0.7307285, 6.10 },
+    { 0.5229178, 0.4471733, -0.7256673, 6.10 },
+    { 0.6410261, -0.3140880, -0.7003101, 6.10 },
+    { -0.5170291, -0.5145609, -0.6840380, 6.10 },
+    { 0.7207639, -0.1149418, -0.6835845, 6.10 },
+    { -0.0697823, -0.7294429, -0.6804729, 6.10 },
+    { 0.2158030, 0.7393437, -0.6378087, 6.10 },
+    { 0.6878596, 0.3710979, -0.6238072, 6.10 },
+    { -0.5377605, -0.6031620, -0.5890749, 6.10 },
+    { 0.4915645, -0.6477395, -0.5820634, 6.10 },
+    { -0.4046566, -0.7322550, -0.5477733, 6.10 },
+    { 0.8485913, -0.0174908, -0.5287598, 6.10 },
+    { 0.8182945, -0.2351955, -0.5244780, 6.10 },
+    { -0.2656168, 0.8166558, -0.5123681, 6.10 },
+    { -0.6876612, 0.5433412, -0.4815625, 6.10 },
+    { 0.8585678, 0.2137659, -0.4660101, 6.10 },
+    { -0.3373807, -0.8285859, -0.4467882, 6.10 },
+    { -0.5981034, 0.6770938, -0.4287380, 6.10 },
+    { -0.8567386, 0.3333324, -0.3935587, 6.10 },
+    { 0.7313774, 0.5639833, -0.3834188, 6.10 },
+    { 0.8058632, 0.5072909, -0.3053528, 6.10 },
+    { -0.2916833, -0.9176010, -0.2700543, 6.10 },
+    { 0.5572669, -0.7901458, -0.2551926, 6.10 },
+    { -0.0664541, 0.9853534, -0.1570430, 6.10 },
+    { 0.2218921, -0.9733522, -0.0578743, 6.10 },
+    { 0.3428361, 0.9392155, -0.0183739, 6.10 },
+    { 0.2162026, 0.9762987, -0.0098663, 6.10 },
+    { -0.3122848, -0.9493053, 0.0360226, 6.10 },
+    { -0.5115890, -0.8283467, 0.2282947, 6.10 },
+    { -0.6611143, -0.7145011, 0.2289456, 6.10 },
+    { 0.5207174, 0.7754085, 0.3572045, 6.10 },
+    { -0.0976160, -0.9284875, 0.3583046, 6.10 },
+    { -0.7094363, -0.5972148, 0.3742119, 6.10 },
+    { -0.5511133, 0.7272953, 0.4090424, 6.10 },
+    { -0.2278805, 0.8687833, 0.4396431, 6.10 },
+    { 0.4432365, 0.7331923, 0.5157232, 6.10 },
+    { 0.6601879, 0.5380277, 0.5240974, 6.10 },
+    { -0.5463241, 0.6493278, 0.5290589, 6.10 },
+    { 0.3496322, -0.7519290, 0.5588918, 6.10 },
+    { 0.1262317, -0.8148232, 0.5657992, 6.10 },
+    { 0.7594785, -0.2910360, 0.5817993, 6.10 },
+    { -0.6439134, -0.4864280, 0.5905618, 6.10 },
+    { 0.3785600, -0.7099363, 0.5938711, 6.10 },
+    { -0.0841596, -0.7909910, 0.6060119, 6.10 },
+    { 0.6534038, 0.4198610, 0.6299050, 6.10 },
+    { -0.0105455, 0.7323280, 0.6808704, 6.10 },
+    { -0.6811201, 0.0639101, 0.7293770, 6.10 },
+    { 0.3061178, 0.4693010, 0.8282804, 6.10 },
+    { -0.0112431, -0.5594939, 0.8287582, 6.10 },
+    { 0.3961954, -0.3111550, 0.8638355, 6.10 },
+    { -0.1069320, -0.4153825, 0.9033399, 6.10 },
+    { 0.1828788, 0.0791891, -0.9799410, 6.11 },
+    { -0.2024265, 0.2212228, -0.9539832, 6.11 },
+    { -0.0652412, 0.3284780, -0.9422557, 6.11 },
+    { 0.2190856, -0.2708824, -0.9373496, 6.11 },
+    { -0.2963406, 0.2534083, -0.9208510, 6.11 },
+    { -0.3958006, -0.1621821, -0.9039020, 6.11 },
+    { -0.1074423, 0.4844575, -0.8681918, 6.11 },
+    { -0.4856013, 0.1351100, -0.8636762, 6.11 },
+    { -0.1295688, -0.4991181, -0.8567923, 6.11 },
+    { -0.3931966, -0.3445960, -0.8524377, 6.11 },
+    { 0.5247764, 0.1456074, -0.8386943, 6.11 },
+    { 0.0910888, 0.5497516, -0.8303469, 6.11 },
+    { -0.4086419, 0.3858703, -0.8271130, 6.11 },
+    { -0.0281457, -0.5671214, -0.8231532, 6.11 },
+    { -0.4832149, -0.3188177, -0.8153886, 6.11 },
+    { -0.6327326, 0.1317574, -0.7630790, 6.11 },
+    { 0.0707355, 0.6742814, -0.7350790, 6.11 },
+    { -0.0252058, -0.6992015, -0.7144801, 6.11 },
+    { -0.6887154, 0.2546326, -0.6788470, 6.11 },
+    { -0.7326768, -0.0806995, -0.6757753, 6.11 },
+    { -0.7106490, 0.2070787, -0.6723812, 6.11 },
+    { -0.6436510, -0.3846770, -0.6616169, 6.11 },
+    { -0.2227596, 0.7515622, -0.6209126, 6.11 },
+    { -0.2352274, -0.7575190, -0.6089606, 6.11 },
+    { -0.4445284, 0.6717366, -0.5925913, 6.11 },
+    { 0.5711063, -0.5711320, -0.5896150, 6.11 },
+    { -0.3333635, 0.7647377, -0.5514028, 6.11 },
+    { 0.6798759, -0.4902751, -0.5453431, 6.11 },
+    { 0.6824985, 0.5170595, -0.5165707, 6.11 },
+    { 0.3605710, 0.8387472, -0.4080339, 6.11 },
+    { -0.6146129, 0.7013254, -0.3611006, 6.11 },
+    { 0.3865568, -0.8638030, -0.3231380, 6.11 },
+    { 0.4412567, -0.8655482, -0.2368942, 6.11 },
+    { -0.5683905, 0.7911447, -0.2258811, 6.11 },
+    { 0.0974555, 0.9740914, -0.2040794, 6.11 },
+    { -0.9816896, -0.0651041, -0.1790169, 6.11 },
+    { -0.7386844, 0.6625907, -0.1237694, 6.11 },
+    { -0.9713214, -0.2295517, -0.0619737, 6.11 },
+    { 0.7035905, 0.7088289, -0.0502201, 6.11 },
+    { 0.5930902, -0.8036524, -0.0488551, 6.11 },
+    { 0.1570334, 0.9874773, -0.0151348, 6.11 },
+    { 0.9598739, -0.2798156, 0.0185814, 6.11 },
+    { -0.8000201, 0.5990906, 0.0325306, 6.11 },
+    { 0.7138595, 0.6958777, 0.0784784, 6.11 },
+    { -0.2875833, 0.9539230, 0.0855961, 6.11 },
+    { 0.9599413, 0.2564450, 0.1129103, 6.11 },
+    { 0.9870914, 0.0714844, 0.1433199, 6.11 },
+    { 0.2890895, 0.9415002, 0.1732185, 6.11 },
+    { -0.1758811, 0.9657309, 0.1908656, 6.11 },
+    { -0.3901200, -0.8992704, 0.1977857, 6.11 },
+    { 0.6507931, 0.6944094, 0.3070244, 6.11 },
+    { -0.8991538, -0.2973964, 0.3210575, 6.11 },
+    { 0.9288086, -0.0308523, 0.3692733, 6.11 },
+    { -0.8373938, -0.3589147, 0.4122521, 6.11 },
+    { 0.7351676, -0.5368308, 0.4139339, 6.11 },
+    { 0.5159388, 0.7421428, 0.4278215, 6.11 },
+    { 0.7971755, -0.4225868, 0.4311980, 6.11 },
+    { 0.0713870, 0.8457724, 0.5287466, 6.11 },
+    { -0.7104300, -0.4580676, 0.5342876, 6.11 },
+    { 0.4361761, -0.7001332, 0.5652998, 6.11 },
+    { -0.4751813, -0.6712168, 0.5689207, 6.11 },
+    { 0.5557277, 0.5566831, 0.6174711, 6.11 },
+    { 0.3586754, -0.6930031, 0.6253789, 6.11 },
+    { 0.6230072, -0.4298976, 0.6534907, 6.11 },
+    { 0.0563561, -0.7533290, 0.6552248, 6.11 },
+    { 0.7194655, 0.0588401, 0.6920312, 6.11 },
+    { 0.6679826, 0.2188687, 0.7112634, 6.11 },
+    { 0.6171759, -0.3258021, 0.7162032, 6.11 },
+    { 0.3860360, 0.5760101, 0.7205474, 6.11 },
+    { 0.5542290, 0.3905673, 0.7350425, 6.11 },
+    { 0.0695541, 0.6692101, 0.7398109, 6.11 },
+    { 0.3862745, -0.4819770, 0.7864415, 6.11 },
+    { 0.5883840, -0.1380900, 0.7967028, 6.11 },
+    { 0.1111941, -0.5790125, 0.8077007, 6.11 },
+    { 0.3848311, 0.4043414, 0.8297066, 6.11 },
+    { 0.3749891, -0.3130996, 0.8725547, 6.11 },
+    { 0.4038745, -0.2017499, 0.8922905, 6.11 },
+    { -0.0004899, 0.0839861, 0.9964668, 6.11 },
+    { 0.1779563, -0.0407614, -0.9831938, 6.12 },
+    { -0.1770248, 0.2251541, -0.9581064, 6.12 },
+    { -0.2522423, 0.3564909, -0.8996044, 6.12 },
+    { 0.4314409, -0.1315648, -0.8924962, 6.12 },
+    { 0.4494859, -0.0912243, -0.8886172, 6.12 },
+    { 0.4441855, -0.2603373, -0.8572769, 6.12 },
+    { 0.1462690, 0.5008757, -0.8530703, 6.12 },
+    { -0.2439542, 0.4914794, -0.8360229, 6.12 },
+    { 0.4530783, -0.3595665, -0.8157401, 6.12 },
+    { -0.5217650, 0.3098578, -0.7948267, 6.12 },
+    { 0.5321368, 0.3404035, -0.7752135, 6.12 },
+    { -0.3300722, 0.5689370, -0.7532350, 6.12 },
+    { 0.4446175, 0.4871608, -0.7516579, 6.12 },
+    { -0.5995809, 0.3346082, -0.7270076, 6.12 },
+    { -0.3765530, -0.5926189, -0.7120468, 6.12 },
+    { -0.7019035, 0.1162460, -0.7027221, 6.12 },
+    { -0.7264105, 0.1138557, -0.6777644, 6.12 },
+    { -0.0215657, 0.7393330, -0.6729946, 6.12 },
+    { 0.4562599, 0.5958296, -0.6609190, 6.12 },
+    { -0.2456032, -0.7122571, -0.6575477, 6.12 },
+    { -0.1363804, 0.7498050, -0.6474510, 6.12 },
+    { -0.3247671, -0.7007967, -0.6351459, 6.12 },
+    { 0.6084282, -0.5299248, -0.5907578, 6.12 },
+    { -0.1536110, -0.7969103, -0.5842410, 6.12 },
+    { 0.7773703, 0.3414244, -0.5283227, 6.12 },
+    { -0.7518472, -0.3998281, -0.5242741, 6.12 },
+    { 0.2158203, -0.8292169, -0.5155782, 6.12 },
+    { -0.2803676, 0.8427525, -0.4595239, 6.12 },
+    { 0.8049142, -0.4706837, -0.3613448, 6.12 },
+    { -0.4355470, 0.8358303, -0.3341953, 6.12 },
+    { 0.5914390, -0.7633608, -0.2597696, 6.12 },
+    { -0.1594921, 0.9612877, -0.2246960, 6.12 },
+    { -0.1033095, 0.9690256, -0.2243133, 6.12 },
+    { 0.9634913, -0.1930930, -0.1854713, 6.12 },
+    { 0.9447843, 0.2781241, -0.1732906, 6.12 },
+    { -0.8617762, 0.4792490, -0.1663194, 6.12 },
+    { 0.0042325, 0.9866138, -0.1630194, 6.12 },
+    { -0.7925317, 0.5916239, -0.1479010, 6.12 },
+    { -0.9573493, 0.2862406, -0.0393523, 6.12 },
+    { 0.5734965, 0.8189745, -0.0195571, 6.12 },
+    { -0.6301408, -0.7762758, -0.0178450, 6.12 },
+    { 0.0975881, 0.9829871, 0.1556051, 6.12 },
+    { 0.0247745, 0.9826652, 0.1837264, 6.12 },
+    { 0.9337311, 0.2790673, 0.2242046, 6.12 },
+    { 0.6538579, 0.7221499, 0.2257640, 6.12 },
+    { -0.0891924, -0.9689651, 0.2305456, 6.12 },
+    { -0.8787725, 0.4012286, 0.2584079, 6.12 },
+    { 0.9179107, -0.2693081, 0.2913984, 6.12 },
+    { -0.5616006, -0.7698162, 0.3032949, 6.12 },
+    { 0.3986405, 0.8589774, 0.3213155, 6.12 },
+    { -0.0461239, -0.9429311, 0.3297781, 6.12 },
+    { 0.0537212, -0.9264081, 0.3726688, 6.12 },
+    { 0.4166248, 0.8252525, 0.3812900, 6.12 },
+    { 0.5780950, 0.6915584, 0.4330740, 6.12 },
+    { 0.6477952, -0.6126341, 0.4528143, 6.12 },
+    { -0.6080839, -0.5871087, 0.5343569, 6.12 },
+    { 0.8223566, 0.0175735, 0.5687010, 6.12 },
+    { -0.0218446, 0.8149614, 0.5791033, 6.12 },
+    { -0.6042711, 0.5026190, 0.6182480, 6.12 },
+    { 0.6559020, -0.4239568, 0.6245424, 6.12 },
+    { -0.1785331, 0.7578349, 0.6275445, 6.12 },
+    { -0.0242028, 0.7444519, 0.6672373, 6.12 },
+    { 0.6747345, 0.1734359, 0.7173934, 6.12 },
+    { -0.6710331, -0.1708207, 0.7214810, 6.12 },
+    { 0.3028790, -0.5979972, 0.7420672, 6.12 },
+    { 0.1377927, -0.6445520, 0.7520412, 6.12 },
+    { 0.5074728, 0.3819334, 0.7723977, 6.12 },
+    { -0.1710278, 0.5805118, 0.7960877, 6.12 },
+    { 0.5555797, -0.1957954, 0.8080813, 6.12 },
+    { 0.5540512, -0.1778948, 0.8132531, 6.12 },
+    { 0.4485922, -0.3477182, 0.8233208, 6.12 },
+    { 0.2669281, -0.4799849, 0.8356817, 6.12 },
+    { -0.4015868, 0.1654337, 0.9007551, 6.12 },
+    { -0.2475633, 0.0695150, -0.9663747, 6.13 },
+    { 0.3177709, 0.0466245, -0.9470205, 6.13 },
+    { 0.3768344, -0.0692757, -0.9236865, 6.13 },
+    { -0.1219986, -0.3984073, -0.9090588, 6.13 },
+    { 0.2167951, -0.5241863, -0.8235463, 6.13 },
+    { -0.2873709, -0.5033393, -0.8149033, 6.13 },
+    { 0.1986432, -0.6044581, -0.7714735, 6.13 },
+    { -0.6322681, 0.1545104, -0.7591861, 6.13 },
+    { 0.3852160, -0.5537460, -0.7382235, 6.13 },
+    { -0.6737407, 0.2923975, -0.6786583, 6.13 },
+    { -0.6590457, -0.3855660, -0.6457535, 6.13 },
+    { -0.7693976, 0.0137265, -0.6386227, 6.13 },
+    { -0.5979715, -0.4859720, -0.6373863, 6.13 },
+    { -0.5142982, 0.6163588, -0.5963214, 6.13 },
+    { -0.7181396, 0.3757137, -0.5857599, 6.13 },
+    { 0.7848316, -0.2155040, -0.5810313, 6.13 },
+    { -0.1885313, -0.7924939, -0.5800081, 6.13 },
+    { 0.1983047, -0.8485260, -0.4905903, 6.13 },
+    { -0.5297768, 0.7533989, -0.3895209, 6.13 },
+    { -0.1714506, 0.9081765, -0.3818641, 6.13 },
+    { 0.3598904, -0.8592924, -0.3634495, 6.13 },
+    { 0.4520114, 0.8212137, -0.3482726, 6.13 },
+    { 0.3407199, 0.8762541, -0.3407178, 6.13 },
+    { -0.8561704, 0.3892090, -0.3398361, 6.13 },
+    { 0.2821452, -0.8975581, -0.3387972, 6.13 },
+    { -0.4872408, 0.8053891, -0.3375571, 6.13 },
+    { -0.9280343, 0.1951157, -0.3173047, 6.13 },
+    { -0.9610568, 0.0405946, -0.2733530, 6.13 },
+    { -0.4958690, -0.8298250, -0.2559384, 6.13 },
+    { 0.6053953, -0.7597595, -0.2371961, 6.13 },
+    { -0.6654755, 0.7104485, -0.2289220, 6.13 },
+    { 0.9108088, 0.3669594, -0.1891245, 6.13 },
+    { -0.7854081, 0.5922237, -0.1800146, 6.13 },
+    { -0.5721116, 0.8149000, -0.0928779, 6.13 },
+    { 0.6022251, -0.7961748, -0.0585712, 6.13 },
+    { 0.4658994, -0.8837954, -0.0429360, 6.13 },
+    { 0.7837333, -0.6207990, 0.0192551, 6.13 },
+    { 0.0931438, -0.9911359, 0.0947304, 6.13 },
+    { -0.6561786, 0.7480856, 0.0989830, 6.13 },
+    { 0.4600552, -0.8647069, 0.2015718, 6.13 },
+    { 0.5563141, -0.7919834, 0.2515490, 6.13 },
+    { 0.9223191, -0.2201393, 0.3175943, 6.13 },
+    { -0.7104302, -0.6249241, 0.3236647, 6.13 },
+    { 0.9222477, 0.1927803, 0.3351044, 6.13 },
+    { 0.5210332, -0.7700814, 0.3681020, 6.13 },
+    { -0.8296050, -0.4035199, 0.3859110, 6.13 },
+    { 0.3001139, 0.8621731, 0.4081534, 6.13 },
+    { 0.8740746, 0.0252288, 0.4851361, 6.13 },
+    { -0.5679588, 0.6456024, 0.5105100, 6.13 },
+    { -0.2509406, -0.8046674, 0.5380885, 6.13 },
+    { -0.4906783, -0.5554487, 0.6713506, 6.13 },
+    { -0.2193572, -0.6922859, 0.6874756, 6.13 },
+    { -0.1719835, 0.6996007, 0.6935276, 6.13 },
+    { 0.7074155, -0.1224043, 0.6961182, 6.13 },
+    { 0.6011698, -0.3288815, 0.7283075, 6.13 },
+    { -0.4805958, 0.4006661, 0.7800605, 6.13 },
+    { 0.4453678, -0.3836411, 0.8089913, 6.13 },
+    { 0.0929363, 0.5199430, 0.8491302, 6.13 },
+    { 0.3098623, 0.4045083, 0.8604408, 6.13 },
+    { -0.1242188, -0.4741541, 0.8716350, 6.13 },
+    { 0.4077508, -0.2465906, 0.8791657, 6.13 },
+    { 0.0217620, 0.4564535, 0.8894811, 6.13 },
+    { -0.4548915, -0.0112398, 0.8904759, 6.13 },
+    { -0.2834794, -0.2934571, 0.9129745, 6.13 },
+    { -0.1715640, 0.1541990, -0.9730306, 6.14 },
+    { 0.2299899, 0.3830204, -0.8946508, 6.14 },
+    { -0.2199268, 0.3918716, -0.8933470, 6.14 },
+    { 0.0504215, -0.4508471, -0.8911759, 6.14 },
+    { -0.4117455, 0.2292413, -0.8819944, 6.14 },
+    { -0.4899337, 0.1944196, -0.8498035, 6.14 },
+    { -0.5120489, -0.2847979, -0.8103679, 6.14 },
+    { 0.5951791, 0.3109433, -0.7409967, 6.14 },
+    { 0.3666381, -0.6322189, -0.6825509, 6.14 },
+    { -0.3228499, -0.6575655, -0.6807170, 6.14 },
+    { -0.3448505, 0.6757742, -0.6514656, 6.14 },
+    { -0.2316771, 0.7880195, -0.5703954, 6.14 },
+    { -0.4345752, 0.7109133, -0.5529436, 6.14 },
+    { 0.6214050, 0.6165973, -0.4833876, 6.14 },
+    { -0.1824046, -0.8658872, -0.4657981, 6.14 },
+    { -0.4624861, -0.7584178, -0.4592483, 6.14 },
+    { 0.6709737, 0.6140267, -0.4156508, 6.14 },
+    { 0.8758310, 0.2599665, -0.4066171, 6.14 },
+    { 0.9006462, 0.1610310, -0.4036154, 6.14 },
+    { -0.8020935, -0.4513188, -0.3910975, 6.14 },
+    { 0.2328712, -0.8938465, -0.3831573, 6.14 },
+    { -0.2182526, 0.9203732, -0.3244673, 6.14 },
+    { 0.9287165, -0.2263402, -0.2936932, 6.14 },
+    { 0.8979227, 0.3476647, -0.2699334, 6.14 },
+    { 0.9583420, 0.1255932, -0.2565288, 6.14 },
+    { -0.7842206, 0.5928415, -0.1831312, 6.14 },
+    { 0.7005075, 0.6931494, -0.1698034, 6.14 },
+    { 0.6457658, 0.7467765, -0.1590953, 6.14 },
+    { -0.9748190, 0.1852074, -0.1242023, 6.14 },
+    { 0.9199928, -0.3749419, -0.1141569, 6.14 },
+    { 0.5207270, 0.8521677, -0.0515134, 6.14 },
+    { -0.1663537, 0.9850669, -0.0443798, 6.14 },
+    { -0.7911927, 0.6103552, -0.0384803, 6.14 },
+    { -0.7404255, -0.6719756, -0.0147965, 6.14 },
+    { -0.9694079, 0.2451036, -0.0131332, 6.14 },
+    { 0.0201531, -0.9992358, 0.0334900, 6.14 },
+    { -0.7420792, 0.6669106, 0.0674440, 6.14 },
+    { -0.6946821, 0.7155131, 0.0738769, 6.14 },
+    { -0.1329308, 0.9717324, 0.1951041, 6.14 },
+    { 0.2184323, -0.9455382, 0.2413395, 6.14 },
+    { -0.5681271, 0.7689602, 0.2931412, 6.14 },
+    { -0.4456005, -0.8449495, 0.2958048, 6.14 },
+    { -0.5315730, -0.7933177, 0.2967782, 6.14 },
+    { 0.5273046, 0.7801949, 0.3365201, 6.14 },
+    { -0.4380807, -0.8184744, 0.3717324, 6.14 },
+    { -0.8893518, 0.2538351, 0.3802908, 6.14 },
+    { -0.6759144, -0.6106730, 0.4125750, 6.14 },
+    { -0.3898453, -0.7974460, 0.4605437, 6.14 },
+    { 0.2075766, 0.8363000, 0.5074586, 6.14 },
+    { 0.1503687, 0.8175902, 0.5558197, 6.14 },
+    { -0.6757498, 0.4613470, 0.5749097, 6.14 },
+    { -0.5599482, 0.5904319, 0.5812471, 6.14 },
+    { 0.7063757, -0.3018717, 0.6402397, 6.14 },
+    { 0.1835409, 0.7268131, 0.6618576, 6.14 },
+    { 0.4004023, -0.6065899, 0.6868236, 6.14 },
+    { -0.6315315, 0.0611345, 0.7729363, 6.14 },
+    { 0.3439877, 0.5312401, 0.7742457, 6.14 },
+    { 0.6215660, 0.0481456, 0.7818809, 6.14 },
+    { 0.3207907, -0.5280664, 0.7862818, 6.14 },
+    { -0.5355083, 0.2932587, 0.7919786, 6.14 },
+    { 0.5268775, -0.2818431, 0.8018507, 6.14 },
+    { 0.0005020, 0.5800320, 0.8145936, 6.14 },
+    { 0.3368697, -0.4320465, 0.8365731, 6.14 },
+    { 0.0173413, 0.5152819, 0.8568453, 6.14 },
+    { -0.4492991, -0.1338956, 0.8832906, 6.14 },
+    { 0.3737374, 0.1564751, 0.9142406, 6.14 },
+    { 0.1816147, -0.0702250, -0.9808591, 6.15 },
+    { 0.2137643, -0.1090104, -0.9707840, 6.15 },
+    { 0.2754912, -0.0628495, -0.9592469, 6.15 },
+    { 0.2190601, 0.2706172, -0.9374321, 6.15 },
+    { 0.2416554, 0.2587360, -0.9352317, 6.15 },
+    { -0.1813992, -0.4140577, -0.8919924, 6.15 },
+    { -0.0639189, 0.4669702, -0.8819599, 6.15 },
+    { -0.2537610, -0.4176789, -0.8724389, 6.15 },
+    { -0.5489886, -0.0687617, -0.8329966, 6.15 },
+    { 0.5831805, -0.0926141, -0.8070459, 6.15 },
+    { 0.5804309, 0.1154549, -0.8060832, 6.15 },
+    { 0.4583894, 0.3990985, -0.7941030, 6.15 },
+    { -0.5972005, 0.1596196, -0.7860490, 6.15 },
+    { -0.5183298, 0.3514031, -0.7796474, 6.15 },
+    { 0.0258710, -0.6970956, -0.7165113, 6.15 },
+    { -0.2066768, -0.7279550, -0.6537325, 6.15 },
+    { -0.5456870, -0.5391225, -0.6415393, 6.15 },
+    { -0.8056200, -0.0626551, -0.5891102, 6.15 },
+    { 0.0893535, -0.8041532, -0.5876680, 6.15 },
+    { -0.3936871, 0.7200897, -0.5713854, 6.15 },
+    { -0.6549037, 0.6068465, -0.4503759, 6.15 },
+    { -0.8702135, -0.2007653, -0.4499131, 6.15 },
+    { 0.8095981, -0.3921459, -0.4367752, 6.15 },
+    { 0.0627058, 0.9222724, -0.3814204, 6.15 },
+    { 0.0738267, 0.9506956, -0.3012102, 6.15 },
+    { 0.2600687, 0.9337707, -0.2458384, 6.15 },
+    { 0.9557057, 0.1921761, -0.2229236, 6.15 },
+    { 0.9209924, 0.3373232, -0.1949001, 6.15 },
+    { 0.1834096, -0.9752936, -0.1231391, 6.15 },
+    { -0.0477389, 0.9919117, -0.1176101, 6.15 },
+    { 0.9623683, -0.2464535, -0.1144897, 6.15 },
+    { -0.5791047, 0.8081161, -0.1076383, 6.15 },
+    { 0.9772435, 0.1961669, -0.0807068, 6.15 },
+    { -0.1153241, 0.9900890, -0.0801501, 6.15 },
+    { -0.8265237, -0.5601335, -0.0557586, 6.15 },
+    { 0.9311534, 0.3612251, -0.0496972, 6.15 },
+    { 0.8995132, -0.4360044, -0.0278586, 6.15 },
+    { 0.1086087, -0.9937024, -0.0275620, 6.15 },
+    { 0.1937185, 0.9807489, -0.0245926, 6.15 },
+    { -0.9988371, 0.0478902, -0.0055608, 6.15 },
+    { -0.2124081, 0.9770246, 0.0174854, 6.15 },
+    { 0.5898861, -0.8072711, 0.0186497, 6.15 },
+    { 0.3902847, 0.9201228, 0.0324332, 6.15 },
+    { 0.2435019, -0.9689416, 0.0431157, 6.15 },
+    { -0.1639086, 0.9826836, 0.0864115, 6.15 },
+    { 0.8464449, -0.5188892, 0.1195198, 6.15 },
+    { 0.7273055, -0.6754401, 0.1216855, 6.15 },
+    { 0.4760118, -0.8706104, 0.1242995, 6.15 },
+    { -0.1212382, 0.9763745, 0.1788690, 6.15 },
+    { -0.4901014, 0.8096269, 0.3229628, 6.15 },
+    { -0.8668277, 0.3723813, 0.3315748, 6.15 },
+    { 0.7445893, 0.5746541, 0.3396460, 6.15 },
+    { 0.0223165, -0.9292070, 0.3688853, 6.15 },
+    { 0.9227910, -0.0133217, 0.3850704, 6.15 },
+    { 0.1917159, -0.8966956, 0.3989762, 6.15 },
+    { 0.7028390, -0.5685227, 0.4275503, 6.15 },
+    { 0.7665748, 0.4735387, 0.4337329, 6.15 },
+    { -0.8952580, -0.0794856, 0.4384008, 6.15 },
+    { -0.8295571, 0.2657302, 0.4911441, 6.15 },
+    { 0.1205062, 0.8274345, 0.5484801, 6.15 },
+    { 0.0058281, -0.8356779, 0.5491889, 6.15 },
+    { 0.1172165, 0.8060711, 0.5800946, 6.15 },
+    { 0.5754955, -0.4875307, 0.6565964, 6.15 },
+    { 0.4939278, 0.5493331, 0.6739944, 6.15 },
+    { 0.7223913, 0.0516549, 0.6895525, 6.15 },
+    { 0.6901147, 0.1539591, 0.7071339, 6.15 },
+    { -0.4165601, -0.5367439, 0.7337463, 6.15 },
+    { -0.5411769, -0.3219499, 0.7768371, 6.15 },
+    { 0.4989686, -0.3676754, 0.7847580, 6.15 },
+    { 0.3057185, -0.5335077, 0.7886100, 6.15 },
+    { 0.4775114, -0.3417223, 0.8094496, 6.15 },
+    { 0.0988824, 0.4992591, 0.8607919, 6.15 },
+    { 0.3198791, -0.3723481, 0.8712257, 6.15 },
+    { 0.0330123, 0.4763737, 0.8786230, 6.15 },
+    { 0.0431999, 0.4337971, 0.8999743, 6.15 },
+    { -0.1808926, 0.2161343, 0.9594602, 6.15 },
+    { -0.1530786, 0.0189042, 0.9880332, 6.15 },
+    { 0.1138984, -0.1013387, 0.9883105, 6.15 },
+    { 0.1767072, 0.0977909, -0.9793934, 6.16 },
+    { -0.3541708, -0.0704945, -0.9325200, 6.16 },
+    { -0.4631418, 0.1257609, -0.8773163, 6.16 },
+    { -0.4775243, -0.1573095, -0.8644213, 6.16 },
+    { -0.5372352, -0.0034768, -0.8434253, 6.16 },
+    { -0.2625089, -0.4906046, -0.8309009, 6.16 },
+    { -0.5150622, 0.2532276, -0.8188936, 6.16 },
+    { -0.5470198, 0.2775695, -0.7897623, 6.16 },
+    { -0.6265432, -0.2369957, -0.7424801, 6.16 },
+    { 0.2651965, 0.6350087, -0.7255582, 6.16 },
+    { -0.6920323, -0.2314109, -0.6837692, 6.16 },
+    { -0.4456703, 0.6282610, -0.6377037, 6.16 },
+    { -0.7212836, -0.3064949, -0.6211368, 6.16 },
+    { 0.2272758, -0.7566481, -0.6130492, 6.16 },
+    { 0.3464411, -0.7132548, -0.6092998, 6.16 },
+    { -0.4528998, 0.6715674, -0.5864120, 6.16 },
+    { -0.1249126, -0.8126356, -0.5692277, 6.16 },
+    { 0.0635286, -0.8255492, -0.5607430, 6.16 },
+    { 0.0395795, -0.8300443, -0.5562912, 6.16 },
+    { 0.5760142, 0.6489695, -0.4970375, 6.16 },
+    { 0.0842988, -0.8753497, -0.4760847, 6.16 },
+    { 0.0875114, 0.8796569, -0.4674884, 6.16 },
+    { -0.8865317, 0.1073279, -0.4500469, 6.16 },
+    { 0.5613294, -0.7347087, -0.3809364, 6.16 },
+    { 0.8029790, -0.5032352, -0.3193416, 6.16 },
+    { -0.5415572, 0.7925169, -0.2804154, 6.16 },
+    { -0.1295404, 0.9651306, -0.2274691, 6.16 },
+    { -0.4565562, 0.8685061, -0.1930120, 6.16 },
+    { 0.9607808, 0.2319633, -0.1519648, 6.16 },
+    { 0.9248516, -0.3769221, -0.0507866, 6.16 },
+    { 0.9630888, -0.2659195, -0.0417938, 6.16 },
+    { 0.1487389, 0.9888347, 0.0090896, 6.16 },
+    { -0.1271381, 0.9908100, 0.0461669, 6.16 },
+    { -0.3081161, 0.9465528, 0.0954061, 6.16 },
+    { -0.6799030, -0.7270157, 0.0958129, 6.16 },
+    { -0.8925358, -0.4267300, 0.1458811, 6.16 },
+    { -0.8487732, -0.4696753, 0.2428767, 6.16 },
+    { -0.0763926, 0.9656407, 0.2483992, 6.16 },
+    { 0.1374765, 0.9549061, 0.2631626, 6.16 },
+    { 0.5518090, 0.7838960, 0.2846294, 6.16 },
+    { -0.6417097, 0.6957085, 0.3227976, 6.16 },
+    { 0.4638951, 0.7831555, 0.4140879, 6.16 },
+    { 0.7365268, -0.5217313, 0.4304936, 6.16 },
+    { 0.2876180, -0.8354216, 0.4683445, 6.16 },
+    { 0.3580231, 0.7692446, 0.5292280, 6.16 },
+    { -0.6465814, 0.5355968, 0.5432021, 6.16 },
+    { -0.2341288, 0.7586305, 0.6079996, 6.16 },
+    { -0.5845402, -0.5314789, 0.6130603, 6.16 },
+    { 0.5225521, -0.5293766, 0.6683560, 6.16 },
+    { 0.3106743, -0.6610635, 0.6829909, 6.16 },
+    { 0.4609142, 0.5305873, 0.7113616, 6.16 },
+    { 0.6662383, 0.0348719, 0.7449232, 6.16 },
+    { 0.3442857, -0.5702788, 0.7458213, 6.16 },
+    { 0.4839855, -0.3665059, 0.7946266, 6.16 },
+    { -0.5945097, -0.0382451, 0.8031784, 6.16 },
+    { -0.1858977, -0.5321289, 0.8260029, 6.16 },
+    { 0.4927827, -0.2219742, 0.8413636, 6.16 },
+    { -0.1605972, -0.4234251, 0.8915827, 6.16 },
+    { 0.0688416, -0.0939681, -0.9931922, 6.17 },
+    { -0.3390001, -0.0189234, -0.9405960, 6.17 },
+    { -0.2853193, -0.3058253, -0.9083302, 6.17 },
+    { -0.4933725, -0.3016737, -0.8158287, 6.17 },
+    { 0.3267483, -0.5635476, -0.7587157, 6.17 },
+    { -0.5341193, 0.3865610, -0.7518558, 6.17 },
+    { 0.6447383, 0.2725194, -0.7141748, 6.17 },
+    { 0.2600385, -0.6742837, -0.6911740, 6.17 },
+    { -0.6139910, -0.3868934, -0.6879887, 6.17 },
+    { 0.7107570, 0.3369420, -0.6174905, 6.17 },
+    { -0.8086917, 0.0455073, -0.5864697, 6.17 },
+    { -0.8181493, 0.0234002, -0.5745296, 6.17 },
+    { 0.8183591, 0.0535305, -0.5722087, 6.17 },
+    { -0.0239263, -0.8214914, -0.5697187, 6.17 },
+    { -0.8213054, -0.0360086, -0.5693513, 6.17 },
+    { -0.0992390, -0.8203170, -0.5632332, 6.17 },
+    { 0.8220252, -0.2896084, -0.4903077, 6.17 },
+    { -0.5940703, 0.6462730, -0.4789694, 6.17 },
+    { 0.8002780, -0.4035558, -0.4435062, 6.17 },
+    { 0.8948453, -0.0606841, -0.4422322, 6.17 },
+    { 0.8282292, -0.3995044, -0.3929792, 6.17 },
+    { 0.0342438, 0.9203712, -0.3895437, 6.17 },
+    { -0.6367612, -0.6736603, -0.3751226, 6.17 },
+    { -0.6079274, -0.7302735, -0.3116486, 6.17 },
+    { -0.6292611, -0.7147724, -0.3051736, 6.17 },
+    { 0.6969462, -0.6513746, -0.2999617, 6.17 },
+    { 0.0539008, 0.9585952, -0.2796247, 6.17 },
+    { -0.9358993, -0.2328616, -0.2643257, 6.17 },
+    { -0.7956295, -0.5963276, -0.1066165, 6.17 },
+    { 0.6525132, 0.7507287, -0.1031156, 6.17 },
+    { 0.8333386, -0.5430644, -0.1030910, 6.17 },
+    { 0.9800861, -0.1698115, -0.1029334, 6.17 },
+    { -0.0416815, 0.9941629, -0.0995127, 6.17 },
+    { -0.2666672, 0.9635025, -0.0234832, 6.17 },
+    { -0.9999487, 0.0041152, 0.0092608, 6.17 },
+    { 0.2359623, 0.9715449, 0.0205498, 6.17 },
+    { 0.4975052, -0.8671277, 0.0240449, 6.17 },
+    { -0.7281286, 0.6849650, 0.0255280, 6.17 },
+    { 0.9965540, 0.0775344, 0.0294724, 6.17 },
+    { -0.1896564, -0.9811093, 0.0381456, 6.17 },
+    { -0.0672208, -0.9967226, 0.0450036, 6.17 },
+    { -0.1634522, 0.9854225, 0.0471796, 6.17 },
+    { -0.4848393, 0.8710992, 0.0782121, 6.17 },
+    { -0.9166343, -0.3796902, 0.1249677, 6.17 },
+    { 0.8987620, -0.4146678, 0.1423991, 6.17 },
+    { -0.9835211, 0.0939957, 0.1544378, 6.17 },
+    { 0.2234006, 0.9607346, 0.1645637, 6.17 },
+    { -0.0395832, -0.9775395, 0.2070016, 6.17 },
+    { 0.4069243, 0.8814728, 0.2396214, 6.17 },
+    { 0.5650685, -0.7858574, 0.2512482, 6.17 },
+    { -0.6671944, 0.6840766, 0.2947724, 6.17 },
+    { 0.5657821, 0.7655766, 0.3062404, 6.17 },
+    { 0.1916304, -0.9275902, 0.3207090, 6.17 },
+    { -0.2251591, -0.9147593, 0.3354383, 6.17 },
+    { 0.4928667, 0.7716023, 0.4021347, 6.17 },
+    { -0.3825171, 0.8278587, 0.4102812, 6.17 },
+    { 0.8141548, 0.3853136, 0.4343793, 6.17 },
+    { 0.8725711, -0.1861871, 0.4516126, 6.17 },
+    { 0.6496901, -0.5739303, 0.4985046, 6.17 },
+    { -0.3580329, 0.7686650, 0.5300627, 6.17 },
+    { 0.7148629, -0.3373921, 0.6124848, 6.17 },
+    { 0.6523863, -0.4113002, 0.6365723, 6.17 },
+    { 0.5751458, -0.3947697, 0.7164944, 6.17 },
+    { 0.6487520, -0.0850552, 0.7562317, 6.17 },
+    { -0.5957552, 0.1615886, 0.7867432, 6.17 },
+    { -0.0618227, -0.5328581, 0.8439432, 6.17 },
+    { 0.5098228, 0.0956832, 0.8549418, 6.17 },
+    { 0.4045959, -0.2594548, 0.8769181, 6.17 },
+    { 0.0959673, 0.4619178, 0.8817155, 6.17 },
+    { -0.3512075, 0.2355311, 0.9061889, 6.17 },
+    { 0.1966833, 0.3647084, 0.9101118, 6.17 },
+    { -0.2545735, -0.2796128, 0.9257478, 6.17 },
+    { 0.0227978, 0.2570702, 0.9661238, 6.17 },
+    { -0.1577471, 0.1031285, 0.9820796, 6.17 },
+    { -0.1589659, -0.0002150, 0.9872840, 6.17 },
+    { 0.0125003, -0.1181726, 0.9929144, 6.17 },
+    { 0.1495977, -0.1057870, -0.9830715, 6.18 },
+    { -0.1205745, -0.1710913, -0.9778494, 6.18 },
+    { -0.0871634, 0.1956113, -0.9768003, 6.18 },
+    { -0.1515084, 0.3098938, -0.9386219, 6.18 },
+    { -0.2265178, -0.3484512, -0.9095446, 6.18 },
+    { 0.0377297, -0.4385246, -0.8979269, 6.18 },
+    { -0.0786906, 0.4701104, -0.8790927, 6.18 },
+    { -0.1680936, -0.4548938, -0.8745377, 6.18 },
+    { -0.4540626, -0.1711116, -0.8743843, 6.18 },
+    { -0.1669954, -0.4641122, -0.8698922, 6.18 },
+    { -0.4726239, -0.1733807, -0.8640403, 6.18 },
+    { 0.4797386, 0.2154693, -0.8505433, 6.18 },
+    { 0.2207647, -0.4820159, -0.8478937, 6.18 },
+    { 0.0324833, 0.5817729, -0.8127024, 6.18 },
+    { -0.6755538, 0.2962421, -0.6751798, 6.18 },
+    { 0.6656990, 0.3365605, -0.6660119, 6.18 },
+    { 0.6109525, 0.4461808, -0.6539570, 6.18 },
+    { 0.6796172, -0.4041819, -0.6121743, 6.18 },
+    { -0.6753412, 0.5146196, -0.5282811, 6.18 },
+    { -0.7312657, -0.4351798, -0.5252324, 6.18 },
+    { -0.5535037, -0.6520249, -0.5181672, 6.18 },
+    { -0.7749947, -0.4039024, -0.4860515, 6.18 },
+    { 0.4371396, -0.8026440, -0.4057975, 6.18 },
+    { 0.9193611, 0.0274272, -0.3924575, 6.18 },
+    { -0.0493261, -0.9227082, -0.3823305, 6.18 },
+    { -0.3959950, 0.8359096, -0.3800567, 6.18 },
+    { -0.6667648, 0.6687178, -0.3290003, 6.18 },
+    { -0.0297306, -0.9815095, -0.1890902, 6.18 },
+    { 0.5236667, -0.8338126, -0.1747276, 6.18 },
+    { 0.9779420, -0.1330486, -0.1610201, 6.18 },
+    { -0.0509827, 0.9953816, -0.0813403, 6.18 },
+    { -0.4337186, -0.8984069, -0.0689435, 6.18 },
+    { -0.5742842, 0.8185021, -0.0158712, 6.18 },
+    { -0.7343102, -0.6787992, -0.0044889, 6.18 },
+    { -0.4640433, 0.8839659, 0.0571667, 6.18 },
+    { 0.8080059, -0.5777913, 0.1152545, 6.18 },
+    { 0.7730781, 0.6208399, 0.1300311, 6.18 },
+    { 0.8361279, -0.4337926, 0.3357292, 6.18 },
+    { 0.1595534, 0.9271685, 0.3389710, 6.18 },
+    { 0.1074864, 0.9306432, 0.3497855, 6.18 },
+    { 0.5729477, -0.7401835, 0.3519365, 6.18 },
+    { -0.4194630, 0.8182934, 0.3929970, 6.18 },
+    { 0.8537654, 0.3345662, 0.3989362, 6.18 },
+    { 0.7135660, 0.5334119, 0.4541974, 6.18 },
+    { 0.1956601, -0.8543255, 0.4815030, 6.18 },
+    { 0.3765957, -0.7505454, 0.5430075, 6.18 },
+    { -0.6452612, 0.4796276, 0.5946388, 6.18 },
+    { -0.4881341, 0.6285527, 0.6055135, 6.18 },
+    { 0.6096555, 0.5038888, 0.6118956, 6.18 },
+    { 0.7829885, -0.0865177, 0.6159900, 6.18 },
+    { 0.7453103, -0.2078198, 0.6335009, 6.18 },
+    { 0.2332832, -0.7245802, 0.6485079, 6.18 },
+    { 0.1364474, 0.7484668, 0.6489834, 6.18 },
+    { 0.3750468, -0.4828473, 0.7913270, 6.18 },
+    { 0.3414767, -0.4853911, 0.8048535, 6.18 },
+    { 0.2673730, 0.5102068, 0.8174354, 6.18 },
+    { 0.3946998, 0.0544561, 0.9171950, 6.18 },
+    { 0.2576816, 0.2339080, 0.9374899, 6.18 },
+    { -0.0909218, 0.0246901, -0.9955519, 6.19 },
+    { -0.2526015, 0.1114918, -0.9611254, 6.19 },
+    { -0.3613058, 0.1493897, -0.9204025, 6.19 },
+    { 0.0568625, 0.4358094, -0.8982410, 6.19 },
+    { -0.2414583, -0.3916420, -0.8878707, 6.19 },
+    { -0.4338886, 0.2429935, -0.8675799, 6.19 },
+    { 0.4557834, -0.2732316, -0.8471163, 6.19 },
+    { -0.4886975, 0.3525516, -0.7980490, 6.19 },
+    { -0.0888397, 0.6046362, -0.7915318, 6.19 },
+    { -0.0886072, -0.6099577, -0.7874645, 6.19 },
+    { -0.5890307, -0.2102566, -0.7802788, 6.19 },
+    { 0.1524093, -0.6467323, -0.7473344, 6.19 },
+    { -0.3548072, 0.5827531, -0.7311024, 6.19 },
+    { 0.1575020, -0.6689766, -0.7264044, 6.19 },
+    { -0.1682079, -0.6980861, -0.6959755, 6.19 },
+    { 0.7487398, 0.1001133, -0.6552603, 6.19 },
+    { -0.3249521, 0.7085872, -0.6263469, 6.19 },
+    { -0.6201932, 0.4790300, -0.6212010, 6.19 },
+    { -0.7213281, 0.3543577, -0.5950769, 6.19 },
+    { -0.7622787, -0.2593586, -0.5930130, 6.19 },
+    { -0.7173289, -0.3889511, -0.5780626, 6.19 },
+    { -0.3903215, -0.7460479, -0.5395013, 6.19 },
+    { 0.0668541, 0.8587151, -0.5080738, 6.19 },
+    { 0.0665608, -0.8750161, -0.4794962, 6.19 },
+    { 0.2783653, 0.8371630, -0.4708194, 6.19 },
+    { 0.6035378, 0.6463570, -0.4668669, 6.19 },
+    { -0.5223534, -0.7287743, -0.4427582, 6.19 },
+    { -0.5631230, 0.7138055, -0.4163822, 6.19 },
+    { -0.1383016, -0.9012581, -0.4106172, 6.19 },
+    { -0.3311681, 0.8595057, -0.3893298, 6.19 },
+    { 0.9357015, -0.1476565, -0.3204063, 6.19 },
+    { 0.9538269, 0.0304050, -0.2988141, 6.19 },
+    { -0.9545164, 0.0841809, -0.2860280, 6.19 },
+    { 0.6018173, -0.7462612, -0.2844472, 6.19 },
+    { -0.8620359, -0.4278488, -0.2717344, 6.19 },
+    { -0.5151692, -0.8215686, -0.2441839, 6.19 },
+    { -0.2646932, -0.9453936, -0.1901803, 6.19 },
+    { 0.9356270, -0.3017343, -0.1831898, 6.19 },
+    { 0.5661119, 0.8041761, -0.1811576, 6.19 },
+    { -0.1012698, 0.9799674, -0.1714887, 6.19 },
+    { 0.5052674, 0.8461802, -0.1693634, 6.19 },
+    { -0.8681310, -0.4761251, -0.1401908, 6.19 },
+    { 0.9519451, -0.2794131, -0.1254145, 6.19 },
+    { 0.6959321, 0.7091434, -0.1131112, 6.19 },
+    { -0.9866338, -0.1371049, -0.0880685, 6.19 },
+    { -0.6318804, 0.7702797, -0.0860014, 6.19 },
+    { 0.0959838, 0.9918394, -0.0839146, 6.19 },
+    { 0.8958523, 0.4365163, -0.0830797, 6.19 },
+    { -0.0862392, -0.9955662, -0.0375594, 6.19 },
+    { 0.9932600, 0.1159043, -0.0008673, 6.19 },
+    { -0.4347966, 0.9005226, 0.0033055, 6.19 },
+    { -0.8199295, -0.5724252, 0.0067054, 6.19 },
+    { 0.3327878, -0.9423351, 0.0354523, 6.19 },
+    { -0.1867264, 0.9809858, 0.0529164, 6.19 },
+    { -0.8002010, -0.5830078, 0.1406420, 6.19 },
+    { -0.6906002, 0.7046024, 0.1631160, 6.19 },
+    { -0.9673517, -0.1774252, 0.1809721, 6.19 },
+    { -0.0663462, -0.9662633, 0.2488641, 6.19 },
+    { 0.2240095, 0.9045036, 0.3628953, 6.19 },
+    { 0.7296040, 0.5559443, 0.3982511, 6.19 },
+    { -0.1932674, -0.8911325, 0.4105248, 6.19 },
+    { -0.9037198, -0.0877347, 0.4190383, 6.19 },
+    { 0.3302985, -0.8446662, 0.4212385, 6.19 },
+    { -0.8479429, -0.2588100, 0.4626123, 6.19 },
+    { 0.8348436, 0.2412020, 0.4948311, 6.19 },
+    { 0.8219409, 0.2710023, 0.5009700, 6.19 },
+    { 0.8019637, 0.0303989, 0.5965988, 6.19 },
+    { 0.4893146, -0.6320336, 0.6009199, 6.19 },
+    { -0.1494623, 0.7829518, 0.6038605, 6.19 },
+    { 0.4065948, -0.6689732, 0.6222183, 6.19 },
+    { 0.5577044, -0.4789110, 0.6779455, 6.19 },
+    { -0.4573292, -0.5483836, 0.7000896, 6.19 },
+    { 0.5070506, -0.4965334, 0.7045241, 6.19 },
+    { 0.6190182, -0.3353765, 0.7101683, 6.19 },
+    { -0.2483485, -0.4441632, 0.8608380, 6.19 },
+    { 0.5066391, 0.0011381, 0.8621575, 6.19 },
+    { 0.2078070, 0.4611255, 0.8626584, 6.19 },
+    { 0.0971463, 0.3813983, 0.9192921, 6.19 },
+    { 0.3479723, -0.1113673, 0.9308666, 6.19 },
+    { 0.0672225, -0.0883607, 0.9938176, 6.19 },
+    { 0.0117729, 0.0901276, -0.9958606, 6.20 },
+    { -0.1826785, -0.1825720, -0.9660725, 6.20 },
+    { 0.2223465, -0.2013556, -0.9539486, 6.20 },
+    { -0.3223222, -0.1314932, -0.9374529, 6.20 },
+    { -0.3065523, 0.1823888, -0.9342162, 6.20 },
+    { -0.3563115, -0.2026599, -0.9121245, 6.20 },
+    { 0.3463745, -0.2469564, -0.9050068, 6.20 },
+    { -0.4695274, 0.2657355, -0.8419790, 6.20 },
+    { -0.5189445, 0.2945774, -0.8024467, 6.20 },
+    { 0.6341140, -0.0915137, -0.7678051, 6.20 },
+    { -0.6223455, -0.3820527, -0.6831704, 6.20 },
+    { -0.0230901, -0.7428246, -0.6690877, 6.20 },
+    { -0.2460166, -0.7120442, -0.6576236, 6.20 },
+    { -0.1018919, 0.7487652, -0.6549570, 6.20 },
+    { -0.4829220, -0.5836920, -0.6527557, 6.20 },
+    { -0.5960626, 0.4721166, -0.6494731, 6.20 },
+    { -0.5139598, -0.6099516, -0.6031620, 6.20 },
+    { -0.4351780, 0.6885830, -0.5800634, 6.20 },
+    { 0.5095925, 0.6883407, -0.5162390, 6.20 },
+    { -0.6351816, 0.6286195, -0.4487559, 6.20 },
+    { -0.0201848, -0.9069135, -0.4208331, 6.20 },
+    { -0.9249907, -0.1464083, -0.3506519, 6.20 },
+    { 0.1157948, -0.9450619, -0.3056953, 6.20 },
+    { 0.4083880, -0.8686244, -0.2805546, 6.20 },
+    { -0.0108276, 0.9680994, -0.2503326, 6.20 },
+    { -0.7566102, -0.6181590, -0.2131209, 6.20 },
+    { 0.6258659, 0.7680497, -0.1356152, 6.20 },
+    { -0.9172943, 0.3753763, -0.1329051, 6.20 },
+    { 0.8525843, -0.5194075, -0.0575834, 6.20 },
+    { 0.9353015, 0.3525670, 0.0301266, 6.20 },
+    { 0.9176282, 0.3725247, 0.1385057, 6.20 },
+    { -0.8481861, -0.5022654, 0.1682552, 6.20 },
+    { -0.9613865, 0.1191152, 0.2480878, 6.20 },
+    { -0.1296969, 0.9477846, 0.2913469, 6.20 },
+    { -0.5197800, 0.7986987, 0.3031651, 6.20 },
+    { -0.1950506, 0.9297696, 0.3122239, 6.20 },
+    { -0.9159899, -0.2482117, 0.3152037, 6.20 },
+    { 0.8832518, 0.2171307, 0.4155965, 6.20 },
+    { -0.8662653, 0.2537111, 0.4303663, 6.20 },
+    { 0.4025748, -0.6885436, 0.6031925, 6.20 },
+    { -0.5213046, -0.5871242, 0.6192953, 6.20 },
+    { 0.4973777, -0.6066329, 0.6201708, 6.20 },
+    { 0.4272154, -0.5938484, 0.6817852, 6.20 },
+    { 0.1676855, 0.7097307, 0.6842251, 6.20 },
+    { 0.1163810, -0.7193535, 0.6848255, 6.20 },
+    { 0.5777404, -0.4141371, 0.7033537, 6.20 },
+    { 0.2926236, -0.6305968, 0.7188317, 6.20 },
+    { 0.3161444, -0.5988409, 0.7358276, 6.20 },
+    { 0.2734037, -0.5740611, 0.7718188, 6.20 },
+    { -0.5161977, -0.3526270, 0.7805089, 6.20 },
+    { 0.1174963, 0.5871894, 0.8008766, 6.20 },
+    { 0.4723788, -0.3285513, 0.8178706, 6.20 },
+    { 0.5255025, -0.1370995, 0.8396731, 6.20 },
+    { -0.2656383, 0.2928988, 0.9185024, 6.20 },
+    { -0.3476941, -0.1205304, 0.9298286, 6.20 },
+    { 0.0113269, 0.3667909, 0.9302344, 6.20 },
+    { 0.1165359, -0.2026417, 0.9722940, 6.20 },
+    { -0.2046057, 0.0548748, 0.9773051, 6.20 },
+    { -0.4076107, -0.0364981, -0.9124261, 6.21 },
+    { 0.3999343, 0.1122567, -0.9096433, 6.21 },
+    { 0.2241044, -0.4288468, -0.8751386, 6.21 },
+    { -0.4780204, 0.1621265, -0.8632563, 6.21 },
+    { -0.3424473, 0.3901828, -0.8546854, 6.21 },
+    { -0.2285090, 0.4743387, -0.8501685, 6.21 },
+    { 0.5002559, -0.3502997, -0.7918549, 6.21 },
+    { 0.4575517, 0.4346116, -0.7757314, 6.21 },
+    { -0.7086094, 0.1412726, -0.6913138, 6.21 },
+    { -0.5001076, 0.5633004, -0.6577120, 6.21 },
+    { 0.5721843, -0.5007118, -0.6495328, 6.21 },
+    { -0.3779919, -0.6606470, -0.6485890, 6.21 },
+    { -0.1582651, 0.7744090, -0.6125707, 6.21 },
+    { 0.4405422, 0.6772546, -0.5892782, 6.21 },
+    { -0.8355920, 0.0107136, -0.5492461, 6.21 },
+    { -0.4426649, -0.7331399, -0.5162884, 6.21 },
+    { -0.4793070, 0.7114374, -0.5139277, 6.21 },
+    { -0.1654180, -0.8482021, -0.5031800, 6.21 },
+    { -0.8099134, -0.3983586, -0.4305238, 6.21 },
+    { -0.4406663, -0.7942610, -0.4182855, 6.21 },
+    { -0.2120576, 0.8846155, -0.4153156, 6.21 },
+    { -0.7896616, 0.4600477, -0.4059441, 6.21 },
+    { 0.0000068, -0.9376514, -0.3475772, 6.21 },
+    { 0.7362438, 0.5839059, -0.3420511, 6.21 },
+    { -0.8837272, -0.3282090, -0.3336241, 6.21 },
+    { -0.1458690, -0.9373412, -0.3164075, 6.21 },
+    { 0.6403775, -0.7028923, -0.3096113, 6.21 },
+    { 0.0764242, 0.9546397, -0.2877886, 6.21 },
+    { 0.1929312, 0.9482519, -0.2521824, 6.21 },
+    { -0.9645452, 0.0850159, -0.2498496, 6.21 },
+    { -0.3838779, 0.8895554, -0.2476468, 6.21 },
+    { 0.3662669, 0.9001095, -0.2359054, 6.21 },
+    { -0.1399362, -0.9661674, -0.2166526, 6.21 },
+    { -0.7936041, -0.5735602, -0.2030299, 6.21 },
+    { -0.2931057, 0.9390572, -0.1796126, 6.21 },
+    { 0.9244133, 0.3550419, -0.1393027, 6.21 },
+    { 0.9601435, -0.2510242, -0.1229279, 6.21 },
+    { -0.0318945, -0.9937451, -0.1070209, 6.21 },
+    { 0.7064278, -0.7029645, -0.0824657, 6.21 },
+    { -0.2363102, 0.9711941, -0.0306500, 6.21 },
+    { 0.9666304, -0.2561545, 0.0032429, 6.21 },
+    { -0.1677139, 0.9854335, 0.0281591, 6.21 },
+    { 0.6019986, -0.7968517, 0.0512359, 6.21 },
+    { 0.7685247, 0.6369952, 0.0600575, 6.21 },
+    { 0.1287511, 0.9889634, 0.0733112, 6.21 },
+    { 0.2075345, -0.9754279, 0.0739586, 6.21 },
+    { 0.6723806, -0.7338722, 0.0966222, 6.21 },
+    { -0.8762375, 0.4718546, 0.0977807, 6.21 },
+    { 0.2505625, -0.9619787, 0.1086987, 6.21 },
+    { 0.9921701, -0.0210862, 0.1231011, 6.21 },
+    { 0.8888007, -0.4335123, 0.1486619, 6.21 },
+    { 0.5565963, -0.7987023, 0.2286378, 6.21 },
+    { 0.1491520, -0.9447277, 0.2919646, 6.21 },
+    { 0.7990901, -0.5235160, 0.2956113, 6.21 },
+    { 0.8146538, 0.4880915, 0.3132186, 6.21 },
+    { 0.8844922, -0.3228769, 0.3367849, 6.21 },
+    { -0.4030103, 0.8320911, 0.3810605, 6.21 },
+    { 0.0100534, -0.9209735, 0.3894955, 6.21 },
+    { 0.0668131, 0.9166748, 0.3940092, 6.21 },
+    { -0.4620720, 0.7568705, 0.4622083, 6.21 },
+    { -0.7763491, -0.3630904, 0.5152159, 6.21 },
+    { 0.3207297, 0.7804511, 0.5366829, 6.21 },
+    { 0.5655591, 0.3930067, 0.7250439, 6.21 },
+    { 0.0091135, -0.6630228, 0.7485437, 6.21 },
+    { 0.6045049, -0.1901068, 0.7735847, 6.21 },
+    { -0.6166894, -0.0813210, 0.7829949, 6.21 },
+    { 0.6058790, 0.1386582, 0.7833802, 6.21 },
+    { -0.5953163, -0.0805829, 0.7994404, 6.21 },
+    { 0.2882671, -0.4733790, 0.8323547, 6.21 },
+    { 0.4821335, 0.2359296, 0.8437325, 6.21 },
+    { 0.5141053, 0.1286936, 0.8480175, 6.21 },
+    { 0.4237116, -0.0979127, 0.9004896, 6.21 },
+    { -0.3834641, 0.0660689, 0.9211896, 6.21 },
+    { -0.1757039, -0.3464001, 0.9214853, 6.21 },
+    { -0.0639015, -0.2456293, 0.9672553, 6.21 },
+    { 0.2225806, 0.0302096, 0.9744461, 6.21 },
+    { -0.2980321, -0.0213523, -0.9543170, 6.22 },
+    { -0.0681804, -0.3230502, -0.9439227, 6.22 },
+    { 0.3410220, 0.0793659, -0.9366990, 6.22 },
+    { -0.4311120, -0.0268967, -0.9018975, 6.22 },
+    { 0.2925227, -0.3490575, -0.8902749, 6.22 },
+    { -0.4662617, -0.0727711, -0.8816487, 6.22 },
+    { -0.4689925, -0.0584677, -0.8812647, 6.22 },
+    { -0.4868125, -0.0178719, -0.8733236, 6.22 },
+    { -0.4507595, 0.2197243, -0.8651804, 6.22 },
+    { -0.4319518, 0.2861109, -0.8553118, 6.22 },
+    { -0.3961021, -0.3380890, -0.8536973, 6.22 },
+    { 0.1075152, -0.5356867, -0.8375442, 6.22 },
+    { 0.0905301, -0.5964901, -0.7974985, 6.22 },
+    { -0.3284962, 0.5845772, -0.7418624, 6.22 },
+    { -0.1767087, 0.6748108, -0.7165225, 6.22 },
+    { 0.4008124, -0.6148547, -0.6791930, 6.22 },
+    { -0.6981033, -0.2296879, -0.6781558, 6.22 },
+    { 0.1101453, -0.7593052, -0.6413451, 6.22 },
+    { -0.5786950, -0.5887216, -0.5643748, 6.22 },
+    { -0.7823892, -0.2969876, -0.5474172, 6.22 },
+    { 0.6355132, 0.5541088, -0.5376676, 6.22 },
+    { 0.0494572, 0.8762607, -0.4792923, 6.22 },
+    { -0.5673957, -0.7434990, -0.3539369, 6.22 },
+    { -0.9350533, 0.0733508, -0.3468356, 6.22 },
+    { -0.5658323, -0.7490007, -0.3447198, 6.22 },
+    { 0.7791140, -0.5293619, -0.3357936, 6.22 },
+    { -0.7833362, -0.5336707, -0.3187162, 6.22 },
+    { 0.4984485, 0.8071895, -0.3162185, 6.22 },
+    { 0.7703759, 0.5544033, -0.3148936, 6.22 },
+    { -0.0012554, 0.9747616, -0.2232449, 6.22 },
+    { -0.0824462, 0.9853487, -0.1493005, 6.22 },
+    { -0.9909443, -0.0123667, -0.1337027, 6.22 },
+    { 0.1238374, 0.9854028, -0.1168147, 6.22 },
+    { 0.2540884, 0.9619719, -0.1002455, 6.22 },
+    { -0.9894018, -0.1208698, -0.0804652, 6.22 },
+    { 0.8611382, -0.5026198, -0.0762511, 6.22 },
+    { 0.0843506, 0.9952165, -0.0492856, 6.22 },
+    { -0.9946629, 0.0940160, -0.0425054, 6.22 },
+    { 0.6396092, -0.7675466, -0.0420990, 6.22 },
+    { 0.2434032, -0.9694165, -0.0314108, 6.22 },
+    { 0.1129022, 0.9934417, -0.0180738, 6.22 },
+    { 0.0078738, 0.9998185, -0.0173511, 6.22 },
+    { 0.6337350, -0.7735484, 0.0016910, 6.22 },
+    { 0.0091469, 0.9997298, 0.0213680, 6.22 },
+    { -0.0507561, -0.9965048, 0.0663469, 6.22 },
+    { -0.5008333, 0.8515612, 0.1549499, 6.22 },
+    { 0.8841881, 0.3926178, 0.2531061, 6.22 },
+    { -0.3647333, 0.8938817, 0.2606627, 6.22 },
+    { -0.5777975, -0.7678895, 0.2765786, 6.22 },
+    { 0.0961693, -0.9530423, 0.2871618, 6.22 },
+    { 0.5691598, -0.7664663, 0.2976350, 6.22 },
+    { 0.6192217, -0.7252077, 0.3010618, 6.22 },
+    { -0.1139240, 0.9297422, 0.3501438, 6.22 },
+    { 0.5047857, -0.7843384, 0.3605617, 6.22 },
+    { 0.3117021, 0.8492983, 0.4260684, 6.22 },
+    { -0.7332382, -0.5284059, 0.4279591, 6.22 },
+    { 0.4931863, -0.7207851, 0.4870689, 6.22 },
+    { 0.2683488, -0.7472083, 0.6080038, 6.22 },
+    { 0.7140825, -0.3182916, 0.6235196, 6.22 },
+    { 0.1923685, -0.7335673, 0.6518231, 6.22 },
+    { 0.3188220, 0.6694526, 0.6709588, 6.22 },
+    { -0.0009845, 0.7121248, 0.7020522, 6.22 },
+    { -0.4460115, 0.5176074, 0.7301755, 6.22 },
+    { 0.6430216, 0.0037083, 0.7658390, 6.22 },
+    { 0.4485435, 0.4363539, 0.7800025, 6.22 },
+    { 0.1249544, -0.5227664, 0.8432685, 6.22 },
+    { 0.2306216, -0.4768344, 0.8481996, 6.22 },
+    { -0.4763601, 0.0064712, 0.8792265, 6.22 },
+    { 0.0568497, -0.2388465, 0.9693918, 6.22 },
+    { -0.3639122, -0.0100538, -0.9313790, 6.23 },
+    { -0.4514153, 0.1773278, -0.8745165, 6.23 },
+    { 0.4736475, 0.1233167, -0.8720384, 6.23 },
+    { 0.4962311, -0.1907793, -0.8469699, 6.23 },
+    { -0.4065590, -0.3696642, -0.8354987, 6.23 },
+    { -0.6236443, -0.0313828, -0.7810781, 6.23 },
+    { -0.3834212, -0.5525535, -0.7400493, 6.23 },
+    { -0.2285675, -0.6550386, -0.7201953, 6.23 },
+    { 0.1993317, -0.7170028, -0.6679625, 6.23 },
+    { 0.6724261, -0.3329064, -0.6610722, 6.23 },
+    { -0.8118725, -0.0210653, -0.5834546, 6.23 },
+    { -0.2013876, 0.7887353, -0.5808095, 6.23 },
+    { -0.2209157, 0.8587480, -0.4623291, 6.23 },
+    { -0.8643108, 0.2218898, -0.4513665, 6.23 },
+    { 0.1661459, -0.8995094, -0.4040771, 6.23 },
+    { -0.2854666, 0.9032562, -0.3203701, 6.23 },
+    { -0.4472937, 0.8640533, -0.2309550, 6.23 },
+    { -0.5173935, 0.8405317, -0.1606564, 6.23 },
+    { 0.9283464, -0.3453873, -0.1374066, 6.23 },
+    { 0.1469526, 0.9844580, -0.0961638, 6.23 },
+    { 0.5738606, 0.8168115, -0.0591864, 6.23 },
+    { 0.9373248, 0.3438232, -0.0566386, 6.23 },
+    { -0.3509923, 0.9349351, -0.0519680, 6.23 },
+    { -0.4118460, -0.9105306, -0.0362895, 6.23 },
+    { 0.2701888, 0.9626272, -0.0186250, 6.23 },
+    { 0.3944372, 0.9182063, 0.0362842, 6.23 },
+    { 0.4407424, 0.8799505, 0.1772942, 6.23 },
+    { 0.9677898, 0.0949985, 0.2331484, 6.23 },
+    { -0.5233649, 0.8138180, 0.2525657, 6.23 },
+    { -0.1189485, 0.9527101, 0.2796331, 6.23 },
+    { 0.7534802, 0.5829169, 0.3040977, 6.23 },
+    { 0.4460870, -0.8357700, 0.3201482, 6.23 },
+    { 0.2718868, -0.8884696, 0.3697287, 6.23 },
+    { 0.9021885, 0.0349346, 0.4299251, 6.23 },
+    { -0.7666773, -0.4478971, 0.4599936, 6.23 },
+    { -0.7986732, -0.3751959, 0.4704776, 6.23 },
+    { -0.6020532, 0.6429359, 0.4734610, 6.23 },
+    { -0.8610216, -0.0697558, 0.5037618, 6.23 },
+    { -0.0532689, -0.8509316, 0.5225684, 6.23 },
+    { 0.7160613, 0.4624294, 0.5228912, 6.23 },
+    { -0.0202298, 0.8326833, 0.5533798, 6.23 },
+    { -0.3941234, 0.7133646, 0.5794633, 6.23 },
+    { 0.7987112, -0.0675019, 0.5979163, 6.23 },
+    { 0.4438997, -0.6324663, 0.6347751, 6.23 },
+    { 0.3284359, -0.6889025, 0.6461758, 6.23 },
+    { 0.3014036, 0.6737830, 0.6746646, 6.23 },
+    { 0.0484026, 0.5931160, 0.8036607, 6.23 },
+    { 0.1119981, -0.5640406, 0.8181165, 6.23 },
+    { 0.3799665, -0.3924952, 0.8375996, 6.23 },
+    { 0.2389289, 0.1423951, 0.9605398, 6.23 },
+    { -0.1712152, 0.1138486, 0.9786337, 6.23 },
+    { 0.3779591, 0.1321002, -0.9163495, 6.24 },
+    { -0.0628531, -0.4490471, -0.8912947, 6.24 },
+    { 0.2313297, -0.4230881, -0.8760611, 6.24 },
+    { -0.5748267, -0.1337928, -0.8072631, 6.24 },
+    { 0.4916704, 0.3907772, -0.7781731, 6.24 },
+    { 0.4368990, -0.4580556, -0.7741475, 6.24 },
+    { -0.0497156, -0.6339890, -0.7717424, 6.24 },
+    { -0.6472222, -0.1444544, -0.7484894, 6.24 },
+    { -0.4236333, 0.5349388, -0.7310097, 6.24 },
+    { -0.4918769, -0.6781922, -0.5459968, 6.24 },
+    { -0.7472182, -0.4909240, -0.4479494, 6.24 },
+    { 0.9115269, -0.0264690, -0.4103877, 6.24 },
+    { -0.7279934, 0.5594590, -0.3962716, 6.24 },
+    { 0.2451099, -0.8894112, -0.3858354, 6.24 },
+    { -0.7889142, 0.4809491, -0.3824949, 6.24 },
+    { -0.9278977, 0.1147816, -0.3547267, 6.24 },
+    { -0.3420714, 0.8813975, -0.3257694, 6.24 },
+    { 0.9609228, -0.0439427, -0.2733064, 6.24 },
+    { -0.0999558, 0.9604137, -0.2600275, 6.24 },
+    { -0.9154754, 0.3218436, -0.2414985, 6.24 },
+    { 0.3713321, 0.8982666, -0.2350097, 6.24 },
+    { -0.8672030, 0.4517179, -0.2095470, 6.24 },
+    { -0.1398511, 0.9710499, -0.1936589, 6.24 },
+    { 0.8983947, 0.4076638, -0.1633929, 6.24 },
+    { -0.7958205, 0.5924565, -0.1251601, 6.24 },
+    { -0.5460500, -0.8309406, -0.1066165, 6.24 },
+    { -0.3845088, 0.9186160, -0.0910912, 6.24 },
+    { 0.1069198, 0.9912692, -0.0771594, 6.24 },
+    { -0.3370781, -0.9413147, -0.0174631, 6.24 },
+    { 0.2502813, 0.9677660, 0.0280767, 6.24 },
+    { -0.8421398, 0.5339143, 0.0757377, 6.24 },
+    { -0.8541903, -0.5128943, 0.0854309, 6.24 },
+    { -0.0803816, 0.9842824, 0.1572480, 6.24 },
+    { -0.2265559, 0.9551377, 0.1907471, 6.24 },
+    { -0.4134958, 0.8788395, 0.2380386, 6.24 },
+    { -0.0702670, -0.9664863, 0.2469144, 6.24 },
+    { -0.1072573, 0.9612050, 0.2541275, 6.24 },
+    { 0.9233503, 0.0602573, 0.3792009, 6.24 },
+    { -0.7404712, 0.5106182, 0.4370028, 6.24 },
+    { 0.1151747, 0.8654074, 0.4876523, 6.24 },
+    { -0.2865019, 0.8082903, 0.5143768, 6.24 },
+    { -0.7524585, 0.3989732, 0.5240483, 6.24 },
+    { -0.0107229, 0.8420473, 0.5392971, 6.24 },
+    { -0.8259359, -0.1226634, 0.5502577, 6.24 },
+    { -0.4990720, 0.6310106, 0.5939300, 6.24 },
+    { 0.6648219, 0.3643445, 0.6521234, 6.24 },
+    { -0.6236542, -0.4143222, 0.6628669, 6.24 },
+    { 0.7017473, -0.0808485, 0.7078236, 6.24 },
+    { 0.4169872, 0.5406722, 0.7306130, 6.24 },
+    { -0.3706805, 0.4720743, 0.7998386, 6.24 },
+    { 0.5391435, -0.0426485, 0.8411334, 6.24 },
+    { 0.4439305, 0.0066412, 0.8960366, 6.24 },
+    { 0.3110376, 0.3014510, 0.9013229, 6.24 },
+    { -0.3081276, -0.0356559, 0.9506766, 6.24 },
+    { -0.0462330, 0.2769072, 0.9597838, 6.24 },
+    { -0.0086857, -0.2024867, 0.9792465, 6.24 },
+    { -0.0502075, -0.2619126, -0.9637847, 6.25 },
+    { -0.3820633, -0.0654362, -0.9218166, 6.25 },
+    { -0.2255273, -0.4021858, -0.8873466, 6.25 },
+    { -0.4656779, 0.1551813, -0.8712421, 6.25 },
+    { -0.2504315, 0.4478871, -0.8583013, 6.25 },
+    { 0.2760778, -0.5365078, -0.7974587, 6.25 },
+    { -0.5269403, 0.4611261, -0.7139304, 6.25 },
+    { 0.2965471, -0.6381269, -0.7105307, 6.25 },
+    { -0.7459245, -0.0808517, -0.6611049, 6.25 },
+    { 0.2462865, 0.7126087, -0.6569108, 6.25 },
+    { 0.0555686, 0.7706564, -0.6348234, 6.25 },
+    { -0.4699801, -0.6240990, -0.6241948, 6.25 },
+    { 0.4749735, -0.6367435, -0.6074190, 6.25 },
+    { -0.0908778, 0.8134513, -0.5744895, 6.25 },
+    { 0.2732986, -0.7876070, -0.5522527, 6.25 },
+    { -0.6176067, 0.6215990, -0.4818471, 6.25 },
+    { 0.6344817, -0.6171681, -0.4653348, 6.25 },
+    { -0.7960101, 0.3998155, -0.4544397, 6.25 },
+    { 0.5920998, 0.6751793, -0.4399440, 6.25 },
+    { 0.0850473, -0.9029373, -0.4212733, 6.25 },
+    { 0.2953234, -0.8631446, -0.4095918, 6.25 },
+    { 0.6890893, -0.6339276, -0.3511291, 6.25 },
+    { 0.9393387, 0.0121326, -0.3427763, 6.25 },
+    { 0.6672778, -0.6696014, -0.3261507, 6.25 },
+    { -0.6508000, 0.7348534, -0.1909185, 6.25 },
+    { 0.5838658, 0.7935530, -0.1713894, 6.25 },
+    { -0.8823657, 0.4530032, -0.1273536, 6.25 },
+    { 0.9880779, -0.1321222, -0.0790299, 6.25 },
+    { -0.4491043, -0.8904427, -0.0736003, 6.25 },
+    { 0.2121548, 0.9764444, -0.0393276, 6.25 },
+    { -0.9897685, 0.1395646, -0.0296662, 6.25 },
+    { -0.2831633, -0.9586590, -0.0281344, 6.25 },
+    { 0.8129883, -0.5822401, -0.0068121, 6.25 },
+    { 0.3798563, -0.9250355, 0.0042954, 6.25 },
+    { 0.2147906, -0.9765512, 0.0145870, 6.25 },
+    { 0.9896154, -0.1423993, 0.0195901, 6.25 },
+    { 0.7161981, -0.6973848, 0.0267333, 6.25 },
+    { 0.6982693, 0.7097685, 0.0929981, 6.25 },
+    { 0.7609599, 0.6400032, 0.1064704, 6.25 },
+    { 0.5957315, -0.7896671, 0.1467305, 6.25 },
+    { 0.4601763, -0.8719242, 0.1672902, 6.25 },
+    { -0.5603262, -0.8015170, 0.2088183, 6.25 },
+    { -0.9497894, -0.2272720, 0.2150526, 6.25 },
+    { 0.4358309, 0.8725361, 0.2207537, 6.25 },
+    { 0.1411816, 0.9473588, 0.2873656, 6.25 },
+    { 0.3442574, -0.8925310, 0.2913335, 6.25 },
+    { -0.4485266, -0.8442814, 0.2932794, 6.25 },
+    { 0.3502734, 0.8841073, 0.3092941, 6.25 },
+    { 0.6037284, -0.7329673, 0.3134819, 6.25 },
+    { 0.8939687, -0.3014183, 0.3316128, 6.25 },
+    { -0.4732339, 0.8130972, 0.3390025, 6.25 },
+    { -0.7771830, -0.5269189, 0.3440102, 6.25 },
+    { -0.7374066, 0.5457277, 0.3980109, 6.25 },
+    { -0.0677508, 0.9128654, 0.4025998, 6.25 },
+    { 0.8935648, 0.0192370, 0.4485219, 6.25 },
+    { 0.4531989, 0.7257747, 0.5175538, 6.25 },
+    { 0.8108611, 0.2479889, 0.5300997, 6.25 },
+    { 0.0316671, 0.8462977, 0.5317682, 6.25 },
+    { 0.4614674, 0.7093444, 0.5328024, 6.25 },
+    { 0.6500073, 0.5315837, 0.5430556, 6.25 },
+    { 0.8351367, 0.0512194, 0.5476525, 6.25 },
+    { -0.5662005, 0.6150011, 0.5488084, 6.25 },
+    { 0.6583919, 0.5064666, 0.5567870, 6.25 },
+    { 0.5393635, 0.6206399, 0.5691161, 6.25 },
+    { -0.3091610, -0.7561310, 0.5767888, 6.25 },
+    { 0.6037651, 0.5387469, 0.5875538, 6.25 },
+    { 0.3112375, -0.7442044, 0.5910086, 6.25 },
+    { 0.1297275, -0.7442315, 0.6552024, 6.25 },
+    { 0.7388203, 0.0055771, 0.6738795, 6.25 },
+    { 0.5586046, -0.4159983, 0.7175697, 6.25 },
+    { -0.3243295, 0.5943173, 0.7359330, 6.25 },
+    { 0.6376451, 0.2263344, 0.7363297, 6.25 },
+    { 0.4434355, 0.3259349, 0.8349439, 6.25 },
+    { 0.4014199, 0.3662679, 0.8394700, 6.25 },
+    { 0.4875430, 0.2398172, 0.8395174, 6.25 },
+    { -0.3524806, 0.3743760, 0.8576713, 6.25 },
+    { -0.4487552, 0.2209893, 0.8658998, 6.25 },
+    { -0.3655359, -0.3123439, 0.8768265, 6.25 },
+    { 0.1220093, -0.3883631, 0.9133936, 6.25 },
+    { 0.0042730, 0.4051811, 0.9142265, 6.25 },
+    { -0.1573433, -0.0514453, 0.9862031, 6.25 },
+    { 0.0470739, 0.0162605, 0.9987591, 6.25 },
+    { -0.3101645, 0.1063092, -0.9447202, 6.26 },
+    { 0.2989771, 0.2586242, -0.9185457, 6.26 },
+    { -0.3925289, -0.0690842, -0.9171414, 6.26 },
+    { -0.3525830, 0.2309180, -0.9068418, 6.26 },
+    { 0.3029437, -0.4867713, -0.8193161, 6.26 },
+    { 0.2466128, -0.5270296, -0.8132785, 6.26 },
+    { -0.1482413, 0.6170147, -0.7728631, 6.26 },
+    { 0.6306525, 0.0794416, -0.7719887, 6.26 },
+    { -0.6537768, 0.0422492, -0.7555071, 6.26 },
+    { -0.6527109, -0.0766851, -0.7537160, 6.26 },
+    { -0.6810031, 0.0097123, -0.7322161, 6.26 },
+    { -0.4893335, 0.5097303, -0.7076212, 6.26 },
+    { 0.6647718, 0.2575088, -0.7012615, 6.26 },
+    { -0.3946921, 0.6207662, -0.6773975, 6.26 },
+    { -0.7424556, -0.0503172, -0.6680029, 6.26 },
+    { -0.7225743, -0.2099329, -0.6586461, 6.26 },
+    { -0.3028211, 0.7029303, -0.6435746, 6.26 },
+    { -0.0773512, -0.7834962, -0.6165634, 6.26 },
+    { 0.0910265, 0.8723444, -0.4803430, 6.26 },
+    { 0.8939000, -0.0111622, -0.4481275, 6.26 },
+    { -0.2392855, 0.8984360, -0.3681782, 6.26 },
+    { -0.3183401, -0.8815094, -0.3487129, 6.26 },
+    { -0.9309703, -0.1365324, -0.3386047, 6.26 },
+    { 0.3291855, -0.8849365, -0.3294302, 6.26 },
+    { -0.2374881, -0.9158771, -0.3236798, 6.26 },
+    { 0.6453689, 0.7122421, -0.2760619, 6.26 },
+    { 0.9619671, -0.0069125, -0.2730779, 6.26 },
+    { 0.2932631, 0.9259284, -0.2380198, 6.26 },
+    { -0.9825817, 0.0498113, -0.1790307, 6.26 },
+    { 0.4716911, 0.8682199, -0.1539536, 6.26 },
+    { -0.9726348, -0.2047750, -0.1097671, 6.26 },
+    { -0.7899545, 0.6086764, -0.0740597, 6.26 },
+    { -0.9413339, 0.3361052, -0.0303936, 6.26 },
+    { -0.0908291, -0.9952375, 0.0353898, 6.26 },
+    { -0.9374170, -0.3444063, 0.0513197, 6.26 },
+    { -0.8506038, -0.5091423, 0.1313289, 6.26 },
+    { -0.1034386, 0.9825715, 0.1544465, 6.26 },
+    { -0.9736869, -0.1413876, 0.1787268, 6.26 },
+    { 0.4287763, -0.8736166, 0.2300974, 6.26 },
+    { 0.0040155, -0.9654947, 0.2603917, 6.26 },
+    { 0.9526476, -0.0931428, 0.2894597, 6.26 },
+    { 0.8694200, -0.3794864, 0.3163841, 6.26 },
+    { -0.4892710, -0.8115795, 0.3193002, 6.26 },
+    { 0.5032186, -0.7797087, 0.3725928, 6.26 },
+    { -0.8103375, -0.1953615, 0.5524374, 6.26 },
+    { 0.7933161, 0.1007227, 0.6004202, 6.26 },
+    { 0.6990715, 0.3833584, 0.6036019, 6.26 },
+    { 0.2887802, 0.7094032, 0.6429254, 6.26 },
+    { -0.3836603, 0.6189907, 0.6853140, 6.26 },
+    { -0.1629048, 0.6901197, 0.7051218, 6.26 },
+    { 0.4812730, 0.4541363, 0.7497576, 6.26 },
+    { 0.6471602, -0.0525003, 0.7605442, 6.26 },
+    { 0.5488687, 0.2944452, 0.7823331, 6.26 },
+    { 0.1982780, -0.5476748, 0.8128580, 6.26 },
+    { 0.1742994, 0.5373702, 0.8251381, 6.26 },
+    { 0.4326423, -0.1002907, 0.8959701, 6.26 },
+    { 0.2278832, -0.3764906, 0.8979555, 6.26 },
+    { 0.0391714, 0.3936638, 0.9184195, 6.26 },
+    { -0.1406416, -0.1115095, 0.9837609, 6.26 },
+    { 0.1655223, 0.0574076, 0.9845338, 6.26 },
+    { 0.0261110, -0.1400813, -0.9897957, 6.27 },
+    { -0.2524432, 0.0449615, -0.9665665, 6.27 },
+    { 0.0679138, 0.2837258, -0.9564975, 6.27 },
+    { -0.2853946, 0.0976545, -0.9534220, 6.27 },
+    { 0.1163571, -0.3356647, -0.9347675, 6.27 },
+    { -0.3151791, 0.2384798, -0.9185802, 6.27 },
+    { -0.0478780, 0.4384641, -0.8974725, 6.27 },
+    { -0.0444586, 0.4411006, -0.8963558, 6.27 },
+    { 0.2568032, -0.3700079, -0.8928305, 6.27 },
+    { -0.1425589, 0.5447578, -0.8263872, 6.27 },
+    { 0.3296745, -0.4684780, -0.8196603, 6.27 },
+    { 0.1383125, 0.5653432, -0.8131770, 6.27 },
+    { 0.0935994, 0.6040924, -0.7913984, 6.27 },
+    { -0.1128366, -0.6319461, -0.7667542, 6.27 },
+    { 0.3725496, -0.5238255, -0.7660376, 6.27 },
+    { 0.6702653, 0.1453599, -0.7277465, 6.27 },
+    { -0.0267519, 0.7145078, -0.6991158, 6.27 },
+    { -0.6789625, 0.3034545, -0.6685247, 6.27 },
+    { -0.6972795, -0.3239622, -0.6394137, 6.27 },
+    { -0.5513852, 0.5413397, -0.6347642, 6.27 },
+    { -0.7741555, 0.1462893, -0.6158594, 6.27 },
+    { -0.7062455, 0.3864452, -0.5931925, 6.27 },
+    { -0.5544275, -0.5854287, -0.5915094, 6.27 },
+    { 0.5390272, 0.6040607, -0.5869927, 6.27 },
+    { -0.7886534, 0.3543590, -0.5024496, 6.27 },
+    { -0.2301064, 0.8482487, -0.4769960, 6.27 },
+    { 0.1092188, -0.8862176, -0.4502106, 6.27 },
+    { -0.0381379, 0.8925506, -0.4493316, 6.27 },
+    { -0.2555432, -0.9071003, -0.3344649, 6.27 },
+    { -0.8515380, 0.4499548, -0.2691164, 6.27 },
+    { 0.3957568, -0.8934970, -0.2122255, 6.27 },
+    { 0.7297433, -0.6641220, -0.1625319, 6.27 },
+    { -0.4035563, 0.9034638, -0.1445529, 6.27 },
+    { -0.1154476, 0.9846742, -0.1307233, 6.27 },
+    { 0.4175734, 0.9021070, -0.1087907, 6.27 },
+    { 0.8856687, -0.4593241, -0.0679142, 6.27 },
+    { 0.6654497, -0.7451806, -0.0433874, 6.27 },
+    { -0.7905977, 0.6119429, -0.0219351, 6.27 },
+    { 0.5467220, -0.8371773, 0.0151402, 6.27 },
+    { -0.8107326, -0.5850155, 0.0216700, 6.27 },
+    { -0.2508884, 0.9588863, 0.1326351, 6.27 },
+    { -0.2426286, 0.9479232, 0.2063323, 6.27 },
+    { -0.5175113, 0.8225353, 0.2358343, 6.27 },
+    { 0.7185583, -0.6386390, 0.2753437, 6.27 },
+    { 0.6445647, 0.6933501, 0.3221831, 6.27 },
+    { -0.5872371, -0.7375204, 0.3334910, 6.27 },
+    { -0.8901740, 0.3054619, 0.3380582, 6.27 },
+    { 0.8424657, 0.4151383, 0.3433829, 6.27 },
+    { 0.1786907, 0.9078933, 0.3792090, 6.27 },
+    { -0.9170007, -0.0774795, 0.3912885, 6.27 },
+    { -0.3786468, 0.8285483, 0.4124734, 6.27 },
+    { 0.0965609, -0.8825866, 0.4601270, 6.27 },
+    { 0.0928698, 0.8808178, 0.4642577, 6.27 },
+    { -0.8344664, 0.0322144, 0.5501164, 6.27 },
+    { -0.8290250, 0.0778666, 0.5537638, 6.27 },
+    { 0.7664416, 0.3061792, 0.5646429, 6.27 },
+    { 0.0943473, 0.8164544, 0.5696498, 6.27 },
+    { -0.6310797, -0.4647913, 0.6210535, 6.27 },
+    { 0.4353615, -0.6451048, 0.6279333, 6.27 },
+    { -0.3949067, 0.6235647, 0.6746968, 6.27 },
+    { -0.6008835, -0.3546653, 0.7163459, 6.27 },
+    { 0.5851939, -0.3182200, 0.7458446, 6.27 },
+    { -0.6481413, -0.1398277, 0.7485727, 6.27 },
+    { 0.6413002, 0.1571827, 0.7510177, 6.27 },
+    { 0.2071657, -0.6074879, 0.7668382, 6.27 },
+    { 0.4079628, -0.4535660, 0.7923663, 6.27 },
+    { 0.5895182, 0.1409682, 0.7953592, 6.27 },
+    { -0.1145363, 0.5865984, 0.8017380, 6.27 },
+    { -0.3323297, 0.4823553, 0.8104877, 6.27 },
+    { -0.5692933, 0.0454872, 0.8208752, 6.27 },
+    { 0.2377556, -0.4893123, 0.8390743, 6.27 },
+    { -0.3916975, -0.3052389, 0.8679875, 6.27 },
+    { -0.4130155, 0.2504838, 0.8756004, 6.27 },
+    { 0.1827490, -0.2381381, 0.9538831, 6.27 },
+    { 0.1418039, 0.2014173, 0.9691866, 6.27 },
+    { -0.0769272, -0.0015000, 0.9970356, 6.27 },
+    { 0.0869901, 0.2894561, -0.9532302, 6.28 },
+    { -0.2453076, -0.2941097, -0.9237552, 6.28 },
+    { -0.2346199, 0.3739860, -0.8972669, 6.28 },
+    { -0.3007595, -0.3265722, -0.8960437, 6.28 },
+    { 0.3151246, -0.3390007, -0.8864395, 6.28 },
+    { -0.0534190, -0.4994758, -0.8646793, 6.28 },
+    { -0.2867877, 0.4891853, -0.8236811, 6.28 },
+    { -0.4366057, 0.3678412, -0.8210167, 6.28 },
+    { -0.2500047, 0.5704845, -0.7823331, 6.28 },
+    { 0.5943634, 0.2541466, -0.7629821, 6.28 },
+    { -0.6043158, -0.2421583, -0.7590533, 6.28 },
+    { -0.1663288, -0.6808663, -0.7132712, 6.28 },
+    { -0.4892997, -0.5736909, -0.6568596, 6.28 },
+    { 0.7096014, -0.2706571, -0.6505463, 6.28 },
+    { 0.7861990, -0.2580393, -0.5615219, 6.28 },
+    { 0.6797858, -0.4799731, -0.5545423, 6.28 },
+    { 0.4271912, -0.7478840, -0.5081114, 6.28 },
+    { -0.7823250, 0.3984067, -0.4787898, 6.28 },
+    { -0.7683263, 0.4581272, -0.4469834, 6.28 },
+    { 0.5819338, -0.6849700, -0.4383711, 6.28 },
+    { 0.8966417, 0.1969624, -0.3965342, 6.28 },
+    { 0.8919353, -0.2332331, -0.3873676, 6.28 },
+    { -0.9282401, -0.0028689, -0.3719705, 6.28 },
+    { 0.0291958, -0.9303180, -0.3655899, 6.28 },
+    { -0.8983097, -0.2981612, -0.3227067, 6.28 },
+    { 0.8286139, -0.4678611, -0.3074166, 6.28 },
+    { 0.0057749, -0.9554831, -0.2949892, 6.28 },
+    { -0.8270910, -0.4991793, -0.2583418, 6.28 },
+    { 0.1309011, -0.9863655, -0.0997399, 6.28 },
+    { -0.6568138, -0.7479304, -0.0958945, 6.28 },
+    { 0.0191739, 0.9963254, -0.0834745, 6.28 },
+    { 0.8515248, 0.5243140, 0.0006109, 6.28 },
+    { 0.9988789, -0.0301695, 0.0364800, 6.28 },
+    { -0.8550720, -0.5169572, 0.0400882, 6.28 },
+    { -0.9462569, 0.3204890, 0.0434121, 6.28 },
+    { 0.9609713, -0.2685483, 0.0664534, 6.28 },
+    { 0.1716215, -0.9768025, 0.1280739, 6.28 },
+    { 0.6725195, 0.7252715, 0.1473054, 6.28 },
+    { -0.3923187, 0.9013588, 0.1834076, 6.28 },
+    { -0.6195659, -0.7541835, 0.2175896, 6.28 },
+    { 0.6028220, 0.7668187, 0.2204421, 6.28 },
+    { -0.6050992, 0.7624081, 0.2293226, 6.28 },
+    { -0.1722016, 0.9437444, 0.2822996, 6.28 },
+    { -0.2433355, -0.8703105, 0.4281909, 6.28 },
+    { 0.7531238, -0.4965937, 0.4315081, 6.28 },
+    { 0.3898809, -0.7999796, 0.4560981, 6.28 },
+    { 0.1314217, 0.8449892, 0.5183836, 6.28 },
+    { -0.0719292, -0.8515396, 0.5193327, 6.28 },
+    { -0.6315020, -0.5549264, 0.5415366, 6.28 },
+    { -0.2436331, 0.7941401, 0.5567625, 6.28 },
+    { -0.7525880, 0.2875479, 0.5923913, 6.28 },
+    { -0.1234574, -0.7895467, 0.6011442, 6.28 },
+    { -0.7463426, -0.2342473, 0.6229774, 6.28 },
+    { 0.1691591, -0.7309862, 0.6610933, 6.28 },
+    { 0.4600084, 0.3337962, 0.8227833, 6.28 },
+    { -0.1176430, 0.5510448, 0.8261415, 6.28 },
+    { -0.5436970, 0.0722433, 0.8361665, 6.28 },
+    { 0.2325626, 0.4441901, 0.8652224, 6.28 },
+    { -0.3434851, 0.2738650, 0.8983407, 6.28 },
+    { 0.1939517, -0.3199739, 0.9273616, 6.28 },
+    { -0.0400419, -0.0026839, 0.9991944, 6.28 },
+    { 0.1186057, 0.1639980, -0.9793045, 6.29 },
+    { 0.0522958, 0.1959227, -0.9792239, 6.29 },
+    { -0.0540762, 0.4100579, -0.9104550, 6.29 },
+    { 0.2206591, 0.4967933, -0.8393485, 6.29 },
+    { -0.3659355, 0.4271391, -0.8268273, 6.29 },
+    { 0.7158065, 0.0009995, -0.6982980, 6.29 },
+    { -0.3755973, 0.6282512, -0.6813421, 6.29 },
+    { -0.5527044, 0.4919660, -0.6726718, 6.29 },
+    { 0.3825273, -0.6530462, -0.6536081, 6.29 },
+    { 0.5029627, -0.5843190, -0.6368672, 6.29 },
+    { -0.0068933, -0.7756096, -0.6311753, 6.29 },
+    { -0.1437379, 0.7704145, -0.6211288, 6.29 },
+    { -0.1999691, 0.7908264, -0.5784514, 6.29 },
+    { -0.8345706, 0.0839633, -0.5444650, 6.29 },
+    { -0.4370576, -0.7290543, -0.5267452, 6.29 },
+    { -0.6282418, -0.5886786, -0.5086942, 6.29 },
+    { 0.6206614, 0.6057750, -0.4978114, 6.29 },
+    { 0.8371620, 0.2372606, -0.4928155, 6.29 },
+    { -0.6249295, -0.6099861, -0.4872167, 6.29 },
+    { -0.8343243, 0.3199462, -0.4489291, 6.29 },
+    { 0.2028563, -0.8704353, -0.4485440, 6.29 },
+    { -0.2055260, -0.8709098, -0.4464026, 6.29 },
+    { 0.8713249, -0.2318009, -0.4325059, 6.29 },
+    { 0.8401140, -0.3645149, -0.4016681, 6.29 },
+    { 0.9241607, -0.1146940, -0.3643793, 6.29 },
+    { -0.3998107, -0.8489518, -0.3455898, 6.29 },
+    { 0.2734819, -0.9066498, -0.3212379, 6.29 },
+    { -0.2172835, 0.9660334, -0.1398836, 6.29 },
+    { -0.3296132, 0.9369225, -0.1163240, 6.29 },
+    { -0.1612275, -0.9860371, -0.0416717, 6.29 },
+    { 0.9997174, 0.0220896, -0.0087808, 6.29 },
+    { -0.0132955, -0.9935070, 0.1129917, 6.29 },
+    { -0.4738071, -0.8692943, 0.1408340, 6.29 },
+    { -0.2375998, 0.9605125, 0.1447827, 6.29 },
+    { -0.5141775, -0.8446077, 0.1491955, 6.29 },
+    { -0.5579614, 0.8154289, 0.1541260, 6.29 },
+    { 0.1549817, -0.9477133, 0.2789627, 6.29 },
+    { -0.7488525, 0.5981133, 0.2854477, 6.29 },
+    { 0.7889604, -0.5052972, 0.3495943, 6.29 },
+    { 0.9222805, -0.1515451, 0.3555737, 6.29 },
+    { 0.7107377, -0.5951485, 0.3750336, 6.29 },
+    { 0.1177315, 0.9165998, 0.3820787, 6.29 },
+    { 0.2384470, -0.8903884, 0.3877520, 6.29 },
+    { -0.9017634, -0.1330402, 0.4112457, 6.29 },
+    { -0.6055130, 0.6162911, 0.5035269, 6.29 },
+    { -0.3803620, -0.7437860, 0.5496426, 6.29 },
+    { 0.7722104, 0.2949743, 0.5627444, 6.29 },
+    { -0.2219659, -0.7104845, 0.6677896, 6.29 },
+    { 0.0409944, 0.7358214, 0.6759336, 6.29 },
+    { 0.4147514, -0.6063826, 0.6784404, 6.29 },
+    { 0.0477437, -0.7028983, 0.7096862, 6.29 },
+    { 0.3179443, -0.5915993, 0.7408925, 6.29 },
+    { 0.3943213, 0.5208664, 0.7571056, 6.29 },
+    { 0.5990954, -0.2303012, 0.7668416, 6.29 },
+    { 0.0189933, -0.6314352, 0.7751960, 6.29 },
+    { -0.2419146, -0.5749524, 0.7816055, 6.29 },
+    { 0.0245947, 0.6218277, 0.7827678, 6.29 },
+    { 0.4142016, -0.4571547, 0.7870493, 6.29 },
+    { -0.1307074, -0.5958546, 0.7923843, 6.29 },
+    { 0.5853800, -0.1591220, 0.7949908, 6.29 },
+    { -0.4904997, -0.2296490, 0.8406375, 6.29 },
+    { 0.1967606, -0.4570467, 0.8674062, 6.29 },
+    { 0.4025303, -0.1701838, 0.8994481, 6.29 },
+    { 0.3952938, 0.0066673, 0.9185305, 6.29 },
+    { 0.2839710, -0.1861497, 0.9405896, 6.29 },
+    { -0.2991576, -0.0205125, 0.9539832, 6.29 },
+    { 0.2298888, 0.1512287, 0.9613953, 6.29 },
+    { -0.2025492, 0.1584481, 0.9663685, 6.29 },
+    { 0.1655994, 0.0515826, 0.9848432, 6.29 },
+    { -0.2207440, 0.0853848, -0.9715871, 6.30 },
+    { -0.4078951, -0.0451912, -0.9119097, 6.30 },
+    { -0.2363535, 0.3905935, -0.8897043, 6.30 },
+    { -0.3220213, -0.3537205, -0.8781709, 6.30 },
+    { 0.4657966, -0.1597613, -0.8703504, 6.30 },
+    { -0.3842742, 0.3126900, -0.8686531, 6.30 },
+    { -0.4226190, -0.3563412, -0.8333152, 6.30 },
+    { 0.2202208, -0.5279109, -0.8202517, 6.30 },
+    { 0.3253285, 0.4848852, -0.8118175, 6.30 },
+    { -0.4040910, 0.4487761, -0.7970637, 6.30 },
+    { -0.6091871, 0.1459807, -0.7794747, 6.30 },
+    { -0.5639272, 0.2730078, -0.7793926, 6.30 },
+    { -0.4340336, 0.5623181, -0.7038560, 6.30 },
+    { -0.5395277, -0.4838136, -0.6890822, 6.30 },
+    { 0.0601871, -0.7373160, -0.6728615, 6.30 },
+    { -0.1458495, 0.7611710, -0.6319388, 6.30 },
+    { -0.1610679, -0.7622640, -0.6269057, 6.30 },
+    { 0.6492751, -0.4359179, -0.6232315, 6.30 },
+    { -0.4944562, 0.6189052, -0.6103026, 6.30 },
+    { -0.7236289, 0.3427147, -0.5990892, 6.30 },
+    { 0.6335066, 0.4960493, -0.5938051, 6.30 },
+    { 0.0063415, -0.8050986, -0.5931071, 6.30 },
+    { -0.3174707, 0.7445547, -0.5872399, 6.30 },
+    { 0.0935864, -0.8242752, -0.5584013, 6.30 },
+    { -0.2818219, 0.7824869, -0.5552392, 6.30 },
+    { 0.3051172, 0.8037372, -0.5107934, 6.30 },
+    { 0.4837580, -0.7182604, -0.5000802, 6.30 },
+    { 0.2664731, -0.8285399, -0.4924569, 6.30 },
+    { 0.5021614, -0.7140508, -0.4878169, 6.30 },
+    { -0.7553507, 0.4675764, -0.4591488, 6.30 },
+    { 0.8553674, -0.2781864, -0.4369884, 6.30 },
+    { 0.2666359, -0.8688287, -0.4171834, 6.30 },
+    { -0.7926053, -0.4757050, -0.3814204, 6.30 },
+    { -0.2163282, -0.9044932, -0.3675516, 6.30 },
+    { -0.2236133, -0.9096222, -0.3501206, 6.30 },
+    { -0.4281681, -0.8401173, -0.3329791, 6.30 },
+    { -0.6159637, -0.7407682, -0.2680507, 6.30 },
+    { 0.5760205, -0.8000461, -0.1677099, 6.30 },
+    { -0.0701613, -0.9898930, -0.1232445, 6.30 },
+    { -0.2589431, 0.9613533, -0.0935330, 6.30 },
+    { -0.2255988, 0.9698046, -0.0926506, 6.30 },
+    { -0.9995922, 0.0268809, 0.0096321, 6.30 },
+    { 0.9403765, 0.3135274, 0.1318811, 6.30 },
+    { 0.2658863, -0.9529398, 0.1456375, 6.30 },
+    { 0.7457390, 0.6396368, 0.1863816, 6.30 },
+    { -0.8430392, -0.5042405, 0.1871532, 6.30 },
+    { 0.9128134, -0.3454773, 0.2177548, 6.30 },
+    { 0.5188955, 0.8244959, 0.2257300, 6.30 },
+    { 0.0764061, -0.9682203, 0.2381417, 6.30 },
+    { -0.9471766, 0.2025024, 0.2486951, 6.30 },
+    { -0.3425219, -0.9007105, 0.2672066, 6.30 },
+    { -0.9356126, -0.2179821, 0.2776919, 6.30 },
+    { -0.6071659, 0.7207134, 0.3345471, 6.30 },
+    { 0.9147522, -0.2173694, 0.3405569, 6.30 },
+    { -0.6114281, -0.6882546, 0.3904629, 6.30 },
+    { -0.0110084, -0.9135089, 0.4066698, 6.30 },
+    { -0.8725566, 0.2517612, 0.4186421, 6.30 },
+    { -0.5327414, 0.7148370, 0.4529841, 6.30 },
+    { 0.8895852, 0.0520721, 0.4537913, 6.30 },
+    { -0.7633197, 0.4476811, 0.4657518, 6.30 },
+    { 0.8716267, 0.1256745, 0.4737855, 6.30 },
+    { 0.6068228, 0.5418876, 0.5814842, 6.30 },
+    { 0.7596232, -0.2885095, 0.5828678, 6.30 },
+    { 0.6062936, 0.5018512, 0.6168901, 6.30 },
+    { -0.1802704, 0.7622534, 0.6216689, 6.30 },
+    { 0.3938985, 0.6719557, 0.6271519, 6.30 },
+    { -0.6735000, -0.3229763, 0.6648940, 6.30 },
+    { -0.2971229, 0.6678731, 0.6823954, 6.30 },
+    { -0.6047611, 0.3564152, 0.7122024, 6.30 },
+    { 0.4572924, -0.5139682, 0.7257550, 6.30 },
+    { 0.1608653, -0.6110834, 0.7750480, 6.30 },
+    { 0.0542607, -0.6222299, 0.7809518, 6.30 },
+    { -0.0311369, 0.6059218, 0.7949146, 6.30 },
+    { 0.3162077, 0.4446530, 0.8380313, 6.30 },
+    { 0.4577202, -0.2333501, 0.8579277, 6.30 },
+    { -0.1125910, -0.2768218, 0.9543024, 6.30 },
+    { -0.0796595, -0.2790920, 0.9569545, 6.30 },
+    { 0.0400057, 0.3957668, -0.9174793, 6.31 },
+    { 0.3251914, -0.2777270, -0.9039460, 6.31 },
+    { 0.1418550, -0.6000693, -0.7872700, 6.31 },
+    { -0.6074806, -0.2426824, -0.7563548, 6.31 },
+    { -0.3408869, -0.5733389, -0.7450360, 6.31 },
+    { 0.3833742, -0.5529759, -0.7397580, 6.31 },
+    { 0.6335142, 0.2608145, -0.7284474, 6.31 },
+    { 0.5344730, -0.4314701, -0.7267545, 6.31 },
+    { -0.6836391, 0.1314574, -0.7178833, 6.31 },
+    { -0.0327315, 0.7028576, -0.7105771, 6.31 },
+    { -0.5868185, -0.3944997, -0.7071167, 6.31 },
+    { 0.5931009, 0.4238238, -0.6845471, 6.31 },
+    { 0.1808175, 0.7238738, -0.6658166, 6.31 },
+    { -0.0821939, 0.7584058, -0.6465794, 6.31 },
+    { 0.7625722, -0.0465741, -0.6452244, 6.31 },
+    { 0.1909292, -0.7439123, -0.6404222, 6.31 },
+    { -0.3484398, 0.6905659, -0.6338047, 6.31 },
+    { -0.4764477, 0.6130719, -0.6301907, 6.31 },
+    { -0.5839049, 0.5191824, -0.6241031, 6.31 },
+    { -0.4011134, -0.6844451, -0.6088045, 6.31 },
+    { -0.7920130, 0.0808687, -0.6051246, 6.31 },
+    { -0.2904273, 0.7568687, -0.5854927, 6.31 },
+    { 0.5972604, 0.5953783, -0.5374055, 6.31 },
+    { -0.3107156, 0.7916645, -0.5260449, 6.31 },
+    { 0.8268301, -0.3020322, -0.4744770, 6.31 },
+    { 0.1078916, -0.8873478, -0.4483004, 6.31 },
+    { 0.8949947, 0.0537087, -0.4428317, 6.31 },
+    { 0.9081307, -0.0138763, -0.4184568, 6.31 },
+    { -0.8932498, -0.2291530, -0.3867736, 6.31 },
+    { -0.2434987, 0.9066103, -0.3446247, 6.31 },
+    { -0.7611575, 0.5552407, -0.3351821, 6.31 },
+    { -0.5420718, -0.7992449, -0.2595490, 6.31 },
+    { 0.8219619, -0.5252363, -0.2202397, 6.31 },
+    { -0.8047345, 0.5645808, -0.1834419, 6.31 },
+    { 0.0747650, -0.9826906, -0.1694976, 6.31 },
+    { 0.3480205, -0.9265707, -0.1426481, 6.31 },
+    { 0.1067536, -0.9866265, -0.1231738, 6.31 },
+    { 0.1888505, -0.9748023, -0.1187265, 6.31 },
+    { 0.9594035, -0.2692840, -0.0838518, 6.31 },
+    { 0.9390711, -0.3380864, -0.0619926, 6.31 },
+    { -0.9995138, -0.0044921, -0.0308545, 6.31 },
+    { 0.0734056, 0.9969048, -0.0281504, 6.31 },
+    { -0.9570631, 0.2898584, -0.0035149, 6.31 },
+    { 0.9873538, -0.1584504, 0.0050857, 6.31 },
+    { -0.0932966, 0.9948512, 0.0395844, 6.31 },
+    { 0.0249959, 0.9981031, 0.0562625, 6.31 },
+    { -0.4691653, 0.8812581, 0.0571667, 6.31 },
+    { -0.4429592, -0.8906257, 0.1028253, 6.31 },
+    { 0.4378178, 0.8925814, 0.1077685, 6.31 },
+    { 0.8433586, 0.5178499, 0.1434494, 6.31 },
+    { 0.4175013, 0.8915213, 0.1757342, 6.31 },
+    { 0.5229798, -0.8317785, 0.1861092, 6.31 },
+    { -0.3410567, -0.9097765, 0.2366158, 6.31 },
+    { 0.6928488, -0.6747667, 0.2542644, 6.31 },
+    { -0.2437418, -0.9349030, 0.2579657, 6.31 },
+    { 0.6978769, 0.6576182, 0.2837360, 6.31 },
+    { 0.3414125, -0.8737265, 0.3464673, 6.31 },
+    { 0.1774931, -0.8990822, 0.4001842, 6.31 },
+    { -0.8870016, -0.1917083, 0.4200906, 6.31 },
+    { -0.4587300, 0.7808712, 0.4240365, 6.31 },
+    { 0.7114608, -0.5201539, 0.4725076, 6.31 },
+    { 0.2453793, -0.8312471, 0.4988159, 6.31 },
+    { 0.5517108, 0.6334593, 0.5425352, 6.31 },
+    { 0.7658569, 0.3022383, 0.5675520, 6.31 },
+    { 0.2813756, -0.7673212, 0.5762342, 6.31 },
+    { -0.1548793, 0.7929054, 0.5893331, 6.31 },
+    { 0.2708103, -0.7476126, 0.6064133, 6.31 },
+    { -0.3919766, -0.6621258, 0.6387048, 6.31 },
+    { 0.2181565, -0.6107285, 0.7611954, 6.31 },
+    { 0.3570579, -0.5307419, 0.7686499, 6.31 },
+    { 0.6218840, -0.1258504, 0.7729308, 6.31 },
+    { -0.4845803, 0.3891660, 0.7834103, 6.31 },
+    { 0.4177490, 0.4482364, 0.7902973, 6.31 },
+    { 0.1638676, -0.5897200, 0.7908083, 6.31 },
+    { 0.4974196, 0.3172881, 0.8074045, 6.31 },
+    { 0.2790333, 0.5171934, 0.8091053, 6.31 },
+    { -0.2662758, -0.4424063, 0.8563725, 6.31 },
+    { -0.3488808, 0.2214168, 0.9106354, 6.31 },
+    { -0.2184988, 0.2774382, 0.9355674, 6.31 },
+    { -0.2803470, -0.0814859, 0.9564338, 6.31 },
+    { -0.1665347, 0.2041704, 0.9646661, 6.31 },
+    { 0.2021514, 0.0739017, 0.9765620, 6.31 },
+    { -0.0553138, 0.1415717, 0.9883814, 6.31 },
+    { -0.2433990, 0.2802326, -0.9285616, 6.32 },
+    { -0.1105681, -0.3632956, -0.9250897, 6.32 },
+    { -0.3152115, -0.3532169, -0.8808402, 6.32 },
+    { 0.0525709, 0.4792489, -0.8761032, 6.32 },
+    { -0.4039966, 0.3524810, -0.8441232, 6.32 },
+    { -0.6127951, 0.1458278, -0.7766701, 6.32 },
+    { -0.3196153, 0.5580525, -0.7657829, 6.32 },
+    { -0.3264588, 0.6306782, -0.7040381, 6.32 },
+    { 0.6084291, 0.3879170, -0.6923398, 6.32 },
+    { -0.3409616, 0.6457233, -0.6832178, 6.32 },
+    { 0.5891585, -0.4348289, -0.6810404, 6.32 },
+    { -0.1738786, 0.7181088, -0.6738590, 6.32 },
+    { -0.5939477, -0.4403939, -0.6732603, 6.32 },
+    { -0.2111443, -0.7125829, -0.6690618, 6.32 },
+    { 0.4647508, 0.5852942, -0.6644075, 6.32 },
+    { -0.0941728, 0.7479519, -0.6570383, 6.32 },
+    { 0.1132624, -0.7719439, -0.6255192, 6.32 },
+    { -0.4593919, 0.6364542, -0.6195846, 6.32 },
+    { 0.7104126, 0.3611804, -0.6040386, 6.32 },
+    { 0.1533895, -0.7867684, -0.5978856, 6.32 },
+    { 0.0449568, 0.8110962, -0.5831825, 6.32 },
+    { 0.8057526, -0.1131993, -0.5813335, 6.32 },
+    { -0.2827402, 0.8101754, -0.5134917, 6.32 },
+    { -0.5109240, -0.7180217, -0.4726537, 6.32 },
+    { -0.7622779, 0.4539581, -0.4613615, 6.32 },
+    { -0.2972309, 0.8657769, -0.4025967, 6.32 },
+    { -0.4206382, -0.8497118, -0.3178890, 6.32 },
+    { 0.2559964, -0.9300496, -0.2635784, 6.32 },
+    { -0.4589063, -0.8545743, -0.2431208, 6.32 },
+    { 0.5476222, -0.8089867, -0.2136594, 6.32 },
+    { -0.5230107, 0.8293360, -0.1966255, 6.32 },
+    { -0.5619362, 0.8081314, -0.1764973, 6.32 },
+    { -0.9415101, -0.2934280, -0.1657070, 6.32 },
+    { 0.7189718, 0.6754054, -0.1640338, 6.32 },
+    { -0.8949852, 0.4173860, -0.1574495, 6.32 },
+    { 0.3516508, -0.9272281, -0.1288009, 6.32 },
+    { -0.1727586, -0.9795543, -0.1030910, 6.32 },
+    { -0.2988379, -0.9531799, -0.0463025, 6.32 },
+    { 0.2558566, 0.9660426, -0.0360439, 6.32 },
+    { 0.2002697, 0.9796920, 0.0097790, 6.32 },
+    { 0.1537048, 0.9872636, 0.0410527, 6.32 },
+    { -0.9131520, 0.4055195, 0.0413196, 6.32 },
+    { 0.9877515, 0.0103577, 0.1556913, 6.32 },
+    { 0.3326740, -0.9281229, 0.1670804, 6.32 },
+    { 0.9407170, 0.2428846, 0.2367670, 6.32 },
+    { 0.3613212, -0.8992133, 0.2467030, 6.32 },
+    { -0.6073958, 0.7492132, 0.2641022, 6.32 },
+    { 0.4234935, 0.8660992, 0.2655664, 6.32 },
+    { 0.8930973, -0.3572963, 0.2733432, 6.32 },
+    { -0.9312337, -0.2158705, 0.2936047, 6.32 },
+    { 0.4751678, 0.8281404, 0.2973198, 6.32 },
+    { -0.0791758, 0.9513419, 0.2977914, 6.32 },
+    { 0.3760512, -0.8432546, 0.3840666, 6.32 },
+    { -0.2445344, -0.8773779, 0.4128086, 6.32 },
+    { 0.7079713, -0.5713365, 0.4151520, 6.32 },
+    { -0.5327359, 0.7148502, 0.4529699, 6.32 },
+    { 0.0131226, 0.8750100, 0.4839270, 6.32 },
+    { 0.7653435, -0.3947695, 0.5083368, 6.32 },
+    { 0.5405755, -0.6585174, 0.5235770, 6.32 },
+    { -0.7411428, -0.4115616, 0.5304002, 6.32 },
+    { -0.5434284, -0.6447888, 0.5375249, 6.32 },
+    { -0.8254237, 0.1217966, 0.5512180, 6.32 },
+    { 0.8083995, -0.1445190, 0.5706176, 6.32 },
+    { 0.3891871, -0.6838896, 0.6171129, 6.32 },
+    { -0.6743572, 0.3473850, 0.6515874, 6.32 },
+    { -0.4197263, 0.5589561, 0.7151209, 6.32 },
+    { 0.6166445, 0.3135186, 0.7221188, 6.32 },
+    { 0.4912781, -0.4755761, 0.7297076, 6.32 },
+    { -0.5517274, -0.3785541, 0.7431646, 6.32 },
+    { 0.6539314, -0.1162087, 0.7475756, 6.32 },
+    { 0.0200433, -0.6463378, 0.7627881, 6.32 },
+    { -0.5757916, -0.2696802, 0.7718398, 6.32 },
+    { 0.0619408, -0.5943952, 0.8017840, 6.32 },
+    { 0.3548300, -0.4109845, 0.8397544, 6.32 },
+    { 0.2115672, 0.4925259, 0.8441905, 6.32 },
+    { 0.4559593, -0.2445857, 0.8557330, 6.32 },
+    { -0.0924357, -0.4810289, 0.8718181, 6.32 },
+    { -0.4388156, -0.0482651, 0.8972800, 6.32 },
+    { -0.3812099, 0.1580871, 0.9108718, 6.32 },
+    { 0.1651491, 0.3271525, 0.9304284, 6.32 },
+    { 0.1945624, 0.3104503, 0.9304655, 6.32 },
+    { 0.1891423, 0.2472197, 0.9503197, 6.32 },
+    { -0.0674058, -0.1800015, 0.9813541, 6.32 },
+    { -0.0776798, 0.1063809, 0.9912865, 6.32 },
+    { -0.0667148, -0.0074906, -0.9977440, 6.33 },
+    { -0.1197251, 0.0099379, -0.9927573, 6.33 },
+    { -0.1734036, 0.0526358, -0.9834433, 6.33 },
+    { 0.1798055, -0.0324046, -0.9831683, 6.33 },
+    { 0.1701548, 0.0805728, -0.9821178, 6.33 },
+    { -0.3458057, -0.0642242, -0.9361056, 6.33 },
+    { 0.0291245, -0.3697494, -0.9286749, 6.33 },
+    { -0.4138070, -0.0106314, -0.9103025, 6.33 },
+    { -0.4273557, -0.1386196, -0.8933934, 6.33 },
+    { -0.2478103, 0.4306510, -0.8678305, 6.33 },
+    { -0.2514519, 0.4918034, -0.8336074, 6.33 },
+    { 0.4619582, -0.3217873, -0.8264669, 6.33 },
+    { -0.4411351, 0.3777475, -0.8140679, 6.33 },
+    { 0.5873014, 0.0231778, -0.8090364, 6.33 },
+    { -0.2601079, -0.5413607, -0.7995452, 6.33 },
+    { -0.1742822, -0.6092822, -0.7735638, 6.33 },
+    { 0.6308823, -0.1480931, -0.7616140, 6.33 },
+    { -0.6098293, -0.2666867, -0.7463153, 6.33 },
+    { -0.4447070, -0.4961637, -0.7456925, 6.33 },
+    { -0.6507316, -0.1504974, -0.7442439, 6.33 },
+    { -0.2833158, -0.6431467, -0.7114032, 6.33 },
+    { 0.7261202, 0.0594109, -0.6849962, 6.33 },
+    { -0.8295890, -0.0493290, -0.5561913, 6.33 },
+    { 0.8015980, -0.2528012, -0.5417860, 6.33 },
+    { -0.4202760, -0.7377582, -0.5282811, 6.33 },
+    { -0.5100211, 0.6813057, -0.5250723, 6.33 },
+    { -0.2736803, 0.8185001, -0.5051303, 6.33 },
+    { -0.4198969, 0.7545607, -0.5043062, 6.33 },
+    { -0.1972584, 0.8786139, -0.4348871, 6.33 },
+    { -0.4278043, -0.8034393, -0.4140879, 6.33 },
+    { -0.1965728, 0.8915941, -0.4079450, 6.33 },
+    { 0.6270544, -0.6664620, -0.4032756, 6.33 },
+    { -0.6008367, 0.7245364, -0.3377013, 6.33 },
+    { -0.7402534, 0.6160731, -0.2692191, 6.33 },
+    { -0.7219598, -0.6385292, -0.2665604, 6.33 },
+    { 0.5527851, 0.7908536, -0.2626388, 6.33 },
+    { 0.0987563, -0.9791705, -0.1774044, 6.33 },
+    { 0.1279481, 0.9833036, -0.1293961, 6.33 },
+    { -0.5060547, 0.8554092, -0.1103795, 6.33 },
+    { 0.8582585, -0.5044354, -0.0945374, 6.33 },
+    { 0.3575470, 0.9317679, -0.0629976, 6.33 },
+    { 0.3152226, 0.9476171, -0.0515410, 6.33 },
+    { 0.8055647, 0.5905194, -0.0485011, 6.33 },
+    { -0.5531005, -0.8329693, 0.0155570, 6.33 },
+    { 0.7210637, -0.6917360, 0.0396033, 6.33 },
+    { -0.6266150, 0.7778576, 0.0478667, 6.33 },
+    { -0.9846148, -0.1650912, 0.0572591, 6.33 },
+    { -0.6803184, 0.7269839, 0.0930657, 6.33 },
+    { -0.8875936, -0.4471493, 0.1106123, 6.33 },
+    { 0.9565512, -0.2620866, 0.1277518, 6.33 },
+    { 0.6686153, -0.7309120, 0.1368255, 6.33 },
+    { -0.2069845, -0.9686545, 0.1373528, 6.33 },
+    { -0.2477250, -0.9576200, 0.1469568, 6.33 },
+    { 0.5847622, -0.7921881, 0.1746173, 6.33 },
+    { 0.8589715, -0.4453912, 0.2525760, 6.33 },
+    { -0.1041265, 0.9553296, 0.2765917, 6.33 },
+    { -0.0457206, 0.9492558, 0.3111639, 6.33 },
+    { 0.3564960, -0.8676271, 0.3466032, 6.33 },
+    { -0.4153419, 0.8407976, 0.3472039, 6.33 },
+    { -0.8669097, -0.2822616, 0.4108479, 6.33 },
+    { 0.1496304, 0.8705322, 0.4688118, 6.33 },
+    { -0.8784716, -0.0748991, 0.4718875, 6.33 },
+    { -0.6593454, -0.5253843, 0.5378057, 6.33 },
+    { 0.0807323, 0.8293952, 0.5527982, 6.33 },
+    { -0.5249588, 0.6030010, 0.6006730, 6.33 },
+    { -0.6388510, -0.4464765, 0.6265207, 6.33 },
+    { 0.7550004, 0.0650356, 0.6524912, 6.33 },
+    { -0.7383463, 0.1513257, 0.6572254, 6.33 },
+    { 0.5373882, -0.5195467, 0.6642930, 6.33 },
+    { -0.7046238, -0.1384067, 0.6959518, 6.33 },
+    { 0.4634707, -0.5061811, 0.7273071, 6.33 },
+    { 0.4491498, 0.5007614, 0.7399341, 6.33 },
+    { 0.5568171, 0.3754536, 0.7409381, 6.33 },
+    { 0.3995122, -0.4501667, 0.7985862, 6.33 },
+    { -0.1176671, 0.5510397, 0.8261415, 6.33 },
+    { -0.2470675, -0.4698385, 0.8474724, 6.33 },
+    { 0.5150175, -0.0242876, 0.8568355, 6.33 },
+    { 0.3457777, 0.0713711, 0.9355982, 6.33 },
+    { 0.1663426, -0.2919305, 0.9418634, 6.33 },
+    { -0.0763277, 0.0667298, 0.9948473, 6.33 },
+    { -0.0619934, -0.0045680, 0.9980661, 6.33 },
+    { -0.2244682, -0.1037169, -0.9689462, 6.34 },
+    { -0.1433447, 0.2501210, -0.9575447, 6.34 },
+    { 0.3204293, -0.1021234, -0.9417515, 6.34 },
+    { 0.1322271, -0.3440596, -0.9295908, 6.34 },
+    { -0.4321494, -0.2725035, -0.8596445, 6.34 },
+    { -0.3462427, 0.4099884, -0.8438160, 6.34 },
+    { 0.4874212, -0.2257284, -0.8434852, 6.34 },
+    { -0.3574259, 0.4595756, -0.8130418, 6.34 },
+    { -0.3196804, 0.5580627, -0.7657483, 6.34 },
+    { 0.2606747, -0.6957250, -0.6693395, 6.34 },
+    { -0.1198165, 0.7386427, -0.6633634, 6.34 },
+    { -0.4053777, 0.6874869, -0.6025202, 6.34 },
+    { -0.1097965, 0.7916879, -0.6009784, 6.34 },
+    { 0.1949524, 0.7882800, -0.5836164, 6.34 },
+    { 0.1415532, 0.8098776, -0.5692636, 6.34 },
+    { 0.0674981, 0.8321089, -0.5504896, 6.34 },
+    { -0.0860439, 0.8456183, -0.5268075, 6.34 },
+    { -0.4897608, -0.7011218, -0.5182302, 6.34 },
+    { 0.7608974, 0.3932534, -0.5161269, 6.34 },
+    { -0.2443595, 0.8248117, -0.5098766, 6.34 },
+    { 0.7388885, 0.5124666, -0.4375178, 6.34 },
+    { -0.7630948, -0.4974948, -0.4125352, 6.34 },
+    { 0.3871366, -0.8318923, -0.3975932, 6.34 },
+    { -0.5295083, -0.7517036, -0.3931446, 6.34 },
+    { -0.3771709, 0.8458482, -0.3772042, 6.34 },
+    { 0.4477017, 0.8226654, -0.3504067, 6.34 },
+    { 0.0635629, 0.9367819, -0.3440922, 6.34 },
+    { -0.4350840, 0.8572112, -0.2754831, 6.34 },
+    { -0.9304920, 0.2451814, -0.2721594, 6.34 },
+    { -0.9433416, 0.2369146, -0.2323317, 6.34 },
+    { 0.5318235, -0.8192115, -0.2146075, 6.34 },
+    { 0.9625196, -0.1798401, -0.2030114, 6.34 },
+    { 0.5085074, -0.8372527, -0.2010675, 6.34 },
+    { 0.2261392, -0.9597845, -0.1663576, 6.34 },
+    { -0.2436566, 0.9593708, -0.1422642, 6.34 },
+    { 0.4013040, -0.9066956, -0.1298393, 6.34 },
+    { 0.0606758, 0.9953788, -0.0744271, 6.34 },
+    { 0.1753700, 0.9841941, -0.0246449, 6.34 },
+    { 0.0267134, -0.9996127, -0.0077962, 6.34 },
+    { 0.3001148, -0.9538738, -0.0074719, 6.34 },
+    { -0.9737358, -0.2027073, 0.1036745, 6.34 },
+    { 0.0038240, -0.9940141, 0.1091845, 6.34 },
+    { 0.4216194, -0.8818317, 0.2112106, 6.34 },
+    { -0.2708737, -0.9333694, 0.2354762, 6.34 },
+    { -0.9623816, -0.0746356, 0.2612491, 6.34 },
+    { -0.0791509, -0.9618655, 0.2618205, 6.34 },
+    { 0.5014916, -0.8228530, 0.2672435, 6.34 },
+    { 0.7029489, -0.6580381, 0.2699050, 6.34 },
+    { 0.0831639, 0.9249957, 0.3707650, 6.34 },
+    { -0.4617394, 0.7916651, 0.4000789, 6.34 },
+    { 0.0186221, -0.9137634, 0.4058196, 6.34 },
+    { 0.5541782, -0.7095071, 0.4353001, 6.34 },
+    { 0.5958113, -0.6326844, 0.4946912, 6.34 },
+    { 0.8076938, -0.2879120, 0.5145264, 6.34 },
+    { 0.7608927, 0.3704267, 0.5327536, 6.34 },
+    { -0.4133911, 0.7023710, 0.5794677, 6.34 },
+    { 0.2941809, -0.7317210, 0.6148512, 6.34 },
+    { -0.0173472, 0.7882045, 0.6151689, 6.34 },
+    { 0.7319237, -0.2196282, 0.6450203, 6.34 },
+    { -0.1717294, -0.7405731, 0.6496618, 6.34 },
+    { 0.3346868, -0.6800473, 0.6523193, 6.34 },
+    { 0.0162679, -0.7435891, 0.6684389, 6.34 },
+    { -0.1974951, -0.7101804, 0.6757510, 6.34 },
+    { -0.3551104, 0.6258904, 0.6943758, 6.34 },
+    { -0.0529421, -0.7163622, 0.6957171, 6.34 },
+    { 0.6686274, 0.2337729, 0.7058949, 6.34 },
+    { 0.6329311, 0.3062270, 0.7110719, 6.34 },
+    { -0.1663754, 0.6766816, 0.7172316, 6.34 },
+    { -0.5612811, -0.2267485, 0.7959577, 6.34 },
+    { -0.5116852, 0.1702766, 0.8421307, 6.34 },
+    { -0.0114142, 0.5090169, 0.8606808, 6.34 },
+    { 0.4997322, -0.0242261, 0.8658411, 6.34 },
+    { 0.4308818, 0.2077705, 0.8781642, 6.34 },
+    { -0.3699978, 0.2450746, 0.8961250, 6.34 },
+    { 0.4015044, 0.1482957, 0.9037713, 6.34 },
+    { 0.1650470, -0.3283563, 0.9300224, 6.34 },
+    { -0.3134137, -0.1843260, 0.9315556, 6.34 },
+    { 0.3121229, -0.1240776, 0.9419045, 6.34 },
+    { 0.1600916, 0.2677671, 0.9500902, 6.34 },
+    { -0.0826083, -0.2010372, 0.9760942, 6.34 },
+    { 0.0035168, -0.1480026, -0.9889807, 6.35 },
+    { -0.1764191, 0.0322424, -0.9837869, 6.35 },
+    { -0.1977431, -0.0120324, -0.9801800, 6.35 },
+    { -0.3112529, 0.0668807, -0.9479708, 6.35 },
+    { -0.2736678, 0.1641736, -0.9477093, 6.35 },
+    { -0.4845857, 0.2161358, -0.8476213, 6.35 },
+    { 0.0251341, 0.6045243, -0.7961901, 6.35 },
+    { -0.4689236, -0.4614009, -0.7531400, 6.35 },
+    { -0.0137915, 0.7065192, -0.7075595, 6.35 },
+    { -0.6823465, 0.3404167, -0.6469310, 6.35 },
+    { -0.6152653, -0.4587369, -0.6410999, 6.35 },
+    { -0.7110161, -0.3765034, -0.5938867, 6.35 },
+    { -0.1260671, 0.7982101, -0.5890397, 6.35 },
+    { 0.7285871, 0.4140836, -0.5456149, 6.35 },
+    { 0.5901804, -0.6250982, -0.5108222, 6.35 },
+    { -0.2423345, -0.8260428, -0.5088490, 6.35 },
+    { 0.8904020, -0.0219288, -0.4546465, 6.35 },
+    { -0.0448433, -0.8900756, -0.4536017, 6.35 },
+    { 0.5728692, 0.6966266, -0.4318938, 6.35 },
+    { -0.1471173, 0.9113110, -0.3845370, 6.35 },
+    { 0.1757352, -0.9273903, -0.3302490, 6.35 },
+    { 0.8844706, 0.3329279, -0.3269109, 6.35 },
+    { -0.0387134, 0.9495852, -0.3111096, 6.35 },
+    { 0.8791373, -0.3796483, -0.2880709, 6.35 },
+    { -0.9511112, -0.1160369, -0.2862217, 6.35 },
+    { -0.7272890, 0.6354902, -0.2592353, 6.35 },
+    { -0.9644369, -0.1273130, -0.2316309, 6.35 },
+    { -0.7248053, -0.6521301, -0.2222240, 6.35 },
+    { -0.9767671, 0.0368201, -0.2111168, 6.35 },
+    { 0.1400704, 0.9684289, -0.2062179, 6.35 },
+    { -0.3386838, -0.9261440, -0.1659838, 6.35 },
+    { -0.1120133, 0.9913892, -0.0678271, 6.35 },
+    { -0.6395928, -0.7675598, -0.0421077, 6.35 },
+    { 0.2662828, 0.9631215, -0.0386058, 6.35 },
+    { -0.0349277, -0.9991568, -0.0215827, 6.35 },
+    { -0.8485095, 0.5291785, 0.0013197, 6.35 },
+    { -0.4895541, 0.8717511, 0.0196667, 6.35 },
+    { 0.4172061, -0.9068956, 0.0589874, 6.35 },
+    { 0.9555256, 0.2822235, 0.0855614, 6.35 },
+    { 0.1578265, 0.9831002, 0.0927616, 6.35 },
+    { -0.7395501, 0.6663216, 0.0952951, 6.35 },
+    { -0.2539298, 0.9588013, 0.1273570, 6.35 },
+    { 0.3482249, -0.9214674, 0.1721545, 6.35 },
+    { 0.7660325, -0.6180551, 0.1766414, 6.35 },
+    { -0.9763575, 0.0386954, 0.2126704, 6.35 },
+    { -0.2997660, -0.9246207, 0.2349828, 6.35 },
+    { 0.1327902, 0.9625196, 0.2364802, 6.35 },
+    { -0.1483293, -0.9516435, 0.2690225, 6.35 },
+    { -0.1598869, -0.9442266, 0.2878755, 6.35 },
+    { -0.0889251, 0.9481625, 0.3050905, 6.35 },
+    { 0.8387541, -0.4483234, 0.3090271, 6.35 },
+    { -0.2282606, -0.9134374, 0.3369410, 6.35 },
+    { 0.9118239, -0.1237163, 0.3914990, 6.35 },
+    { 0.2918093, 0.8684514, 0.4007986, 6.35 },
+    { -0.8682401, 0.2466156, 0.4305111, 6.35 },
+    { 0.6807834, 0.5910306, 0.4326855, 6.35 },
+    { 0.8868044, 0.0588114, 0.4583876, 6.35 },
+    { -0.1465010, -0.8643309, 0.4811129, 6.35 },
+    { 0.8526596, -0.1770941, 0.4915376, 6.35 },
+    { 0.8060255, -0.3274159, 0.4930737, 6.35 },
+    { 0.8351734, -0.0859078, 0.5432359, 6.35 },
+    { -0.5521641, -0.5848430, 0.5941998, 6.35 },
+    { -0.5922298, -0.4528478, 0.6664779, 6.35 },
+    { -0.2547038, 0.6899258, 0.6775901, 6.35 },
+    { -0.6748153, -0.2525151, 0.6934410, 6.35 },
+    { -0.6492085, 0.2735412, 0.7097207, 6.35 },
+    { 0.6221901, 0.3049481, 0.7210313, 6.35 },
+    { -0.6806479, 0.0883499, 0.7272638, 6.35 },
+    { 0.5447940, -0.2192456, 0.8094015, 6.35 },
+    { -0.1762105, 0.4695043, 0.8651680, 6.35 },
+    { -0.0989766, 0.2959458, 0.9500630, 6.35 },
+    { -0.2642818, -0.0112943, 0.9643794, 6.35 },
+    { 0.2229680, -0.1315348, 0.9659109, 6.35 },
+    { 0.2252214, 0.0159793, 0.9741766, 6.35 },
+    { -0.3786057, -0.0385074, -0.9247567, 6.36 },
+    { -0.3250932, -0.2398071, -0.9147716, 6.36 },
+    { 0.0164582, 0.4375344, -0.8990511, 6.36 },
+    { -0.3170142, 0.3804248, -0.8687802, 6.36 },
+    { -0.5111950, 0.1669728, -0.8430894, 6.36 },
+    { -0.3467252, 0.4534766, -0.8210607, 6.36 },
+    { 0.0916861, -0.7153549, -0.6927200, 6.36 },
+    { -0.4985221, 0.5552471, -0.6657149, 6.36 },
+    { 0.5750876, 0.4970084, -0.6498129, 6.36 },
+    { 0.5635438, 0.5200157, -0.6418739, 6.36 },
+    { -0.5543302, -0.5381072, -0.6349478, 6.36 },
+    { -0.4590275, -0.6223160, -0.6340477, 6.36 },
+    { 0.2370042, -0.7400672, -0.6293882, 6.36 },
+    { -0.7020935, 0.3731984, -0.6064549, 6.36 },
+    { -0.5093254, 0.6462105, -0.5683305, 6.36 },
+    { -0.1523750, -0.8290039, -0.5380840, 6.36 },
+    { 0.5747303, -0.6229102, -0.5307240, 6.36 },
+    { -0.2053174, 0.8248143, -0.5268075, 6.36 },
+    { 0.0219675, 0.8730898, -0.4870643, 6.36 },
+    { -0.0643624, -0.8815482, -0.4676860, 6.36 },
+    { 0.5755692, -0.6990391, -0.4243399, 6.36 },
+    { 0.5609515, -0.7123741, -0.4217305, 6.36 },
+    { 0.2362585, -0.8754130, -0.4217037, 6.36 },
+    { 0.0137331, 0.9189254, -0.3941923, 6.36 },
+    { -0.2915387, 0.8737893, -0.3892267, 6.36 },
+    { 0.1833758, -0.9153849, -0.3583906, 6.36 },
+    { -0.4993158, 0.7934744, -0.3479685, 6.36 },
+    { 0.0461416, -0.9394987, -0.3394307, 6.36 },
+    { 0.1675407, 0.9332940, -0.3176357, 6.36 },
+    { 0.9622278, -0.0680246, -0.2636102, 6.36 },
+    { -0.4565734, 0.8615745, -0.2218785, 6.36 },
+    { -0.8285463, -0.5502495, -0.1036171, 6.36 },
+    { 0.1443687, -0.9841497, -0.1029903, 6.36 },
+    { -0.2205801, -0.9730154, -0.0677159, 6.36 },
+    { 0.0694734, -0.9955865, -0.0630953, 6.36 },
+    { 0.7781358, -0.6252926, -0.0592769, 6.36 },
+    { -0.0109273, -0.9814189, 0.1915661, 6.36 },
+    { -0.7833774, 0.5697752, 0.2483466, 6.36 },
+    { -0.5023483, -0.8112859, 0.2991009, 6.36 },
+    { 0.3381123, 0.8775114, 0.3400791, 6.36 },
+    { 0.3951380, -0.8354647, 0.3819223, 6.36 },
+    { 0.0721409, 0.9199811, 0.3852668, 6.36 },
+    { -0.5652028, 0.7169457, 0.4080866, 6.36 },
+    { 0.8949669, -0.1796105, 0.4083800, 6.36 },
+    { 0.3707094, 0.8325959, 0.4115320, 6.36 },
+    { -0.0749816, -0.9067701, 0.4149045, 6.36 },
+    { 0.2741827, -0.8499614, 0.4498772, 6.36 },
+    { 0.6131715, 0.6322203, 0.4736224, 6.36 },
+    { 0.7007502, -0.5080434, 0.5008403, 6.36 },
+    { 0.1492025, -0.8454538, 0.5127831, 6.36 },
+    { -0.2115719, -0.8223320, 0.5282115, 6.36 },
+    { 0.2885885, -0.7508031, 0.5941476, 6.36 },
+    { 0.0813864, -0.7757449, 0.6257764, 6.36 },
+    { 0.5993738, 0.4830503, 0.6382895, 6.36 },
+    { -0.5479079, 0.5399484, 0.6389465, 6.36 },
+    { -0.0275767, 0.7535680, 0.6567912, 6.36 },
+    { 0.0417397, -0.7518675, 0.6579917, 6.36 },
+    { 0.6382591, 0.2926503, 0.7120260, 6.36 },
+    { 0.4386064, 0.4121196, 0.7986125, 6.36 },
+    { 0.3278563, -0.4414925, 0.8352213, 6.36 },
+    { 0.4494721, 0.2904516, 0.8447560, 6.36 },
+    { 0.4967350, -0.1628696, 0.8524833, 6.36 },
+    { 0.2683312, 0.3128652, 0.9111058, 6.36 },
+    { -0.0062049, -0.2558631, 0.9666931, 6.36 },
+    { -0.0549296, 0.2851574, -0.9569054, 6.37 },
+    { -0.3286294, -0.1122400, -0.9377659, 6.37 },
+    { 0.2641619, -0.2607986, -0.9285486, 6.37 },
+    { -0.3786581, -0.1638498, -0.9109178, 6.37 },
+    { 0.3620667, 0.2046247, -0.9094154, 6.37 },
+    { 0.0787325, -0.4209558, -0.9036578, 6.37 },
+    { -0.3124492, 0.2961747, -0.9025830, 6.37 },
+    { 0.3462560, 0.2610960, -0.9010747, 6.37 },
+    { 0.4513433, -0.1458738, -0.8803465, 6.37 },
+    { 0.2122004, 0.4367750, -0.8741845, 6.37 },
+    { 0.2907115, -0.4514420, -0.8436154, 6.37 },
+    { -0.5360274, 0.3209175, -0.7808243, 6.37 },
+    { -0.6321324, -0.0222955, -0.7745396, 6.37 },
+    { 0.6112925, 0.4256972, -0.6671607, 6.37 },
+    { 0.3412137, 0.6813521, -0.6475589, 6.37 },
+    { 0.6954019, 0.3612831, -0.6212010, 6.37 },
+    { -0.4212239, 0.6700145, -0.6112700, 6.37 },
+    { -0.6797119, 0.4336298, -0.5915716, 6.37 },
+    { -0.7637460, 0.2747396, -0.5841320, 6.37 },
+    { -0.5474785, 0.6143685, -0.5681713, 6.37 },
+    { 0.3538728, 0.7507421, -0.5578175, 6.37 },
+    { 0.8190604, -0.1454545, -0.5549622, 6.37 },
+    { -0.4589283, 0.6954410, -0.5529436, 6.37 },
+    { -0.2299598, -0.8014789, -0.5520417, 6.37 },
+    { 0.7406634, -0.3908724, -0.5464764, 6.37 },
+    { -0.6526110, -0.5566523, -0.5140400, 6.37 },
+    { 0.2681839, 0.8232681, -0.5003069, 6.37 },
+    { 0.1358657, -0.8579472, -0.4954465, 6.37 },
+    { -0.2232392, 0.8612355, -0.4565498, 6.37 },
+    { 0.8745583, 0.2641211, -0.4066791, 6.37 },
+    { -0.3768826, 0.8339261, -0.4031460, 6.37 },
+    { 0.5888386, -0.7005402, -0.4031283, 6.37 },
+    { 0.2569558, -0.9093220, -0.3272724, 6.37 },
+    { 0.2431374, -0.9162414, -0.3184115, 6.37 },
+    { 0.8333934, -0.4693862, -0.2917740, 6.37 },
+    { -0.2637441, -0.9202395, -0.2891339, 6.37 },
+    { 0.1361018, -0.9578938, -0.2528157, 6.37 },
+    { 0.8945723, -0.3692185, -0.2518296, 6.37 },
+    { -0.4979889, -0.8307620, -0.2486796, 6.37 },
+    { 0.9706127, -0.1360357, -0.1985075, 6.37 },
+    { -0.8055482, 0.5622971, -0.1868532, 6.37 },
+    { 0.3562825, 0.9189456, -0.1691206, 6.37 },
+    { -0.1375834, -0.9801463, -0.1427724, 6.37 },
+    { 0.1992393, 0.9696479, -0.1417272, 6.37 },
+    { -0.1307337, -0.9860385, -0.1031344, 6.37 },
+    { -0.9018591, 0.4227648, -0.0889952, 6.37 },
+    { -0.9981648, -0.0261241, -0.0546312, 6.37 },
+    { 0.9637978, -0.2654960, -0.0246120, 6.37 },
+    { -0.9433041, -0.3317195, -0.0118103, 6.37 },
+    { 0.0011271, -0.9999390, 0.0109847, 6.37 },
+    { -0.0693068, 0.9973867, 0.0204049, 6.37 },
+    { 0.9733464, 0.2216086, 0.0590450, 6.37 },
+    { -0.9866647, 0.1481924, 0.0673188, 6.37 },
+    { -0.6541654, 0.7525655, 0.0755825, 6.37 },
+    { -0.1810695, 0.9772412, 0.1105149, 6.37 },
+    { -0.9425935, 0.3149537, 0.1110025, 6.37 },
+    { -0.9815157, -0.1192182, 0.1497132, 6.37 },
+    { -0.2294089, -0.9585351, 0.1690623, 6.37 },
+    { 0.4930897, 0.8512948, 0.1793312, 6.37 },
+    { -0.2286592, -0.9564471, 0.1814494, 6.37 },
+    { -0.3620913, 0.9137830, 0.1840938, 6.37 },
+    { 0.8544893, -0.4833327, 0.1903616, 6.37 },
+    { -0.2613354, -0.9349454, 0.2399603, 6.37 },
+    { 0.0361939, -0.9684055, 0.2467401, 6.37 },
+    { 0.1090411, -0.9599026, 0.2582575, 6.37 },
+    { -0.8451522, 0.4604013, 0.2715664, 6.37 },
+    { 0.2639143, 0.9050324, 0.3335651, 6.37 },
+    { 0.9010513, 0.2343488, 0.3649481, 6.37 },
+    { -0.0068303, 0.9245154, 0.3810834, 6.37 },
+    { 0.2496433, 0.8743521, 0.4161569, 6.37 },
+    { 0.0819715, 0.8902492, 0.4480369, 6.37 },
+    { 0.7958608, -0.3860424, 0.4664514, 6.37 },
+    { -0.0775930, -0.8375527, 0.5408187, 6.37 },
+    { 0.2983168, -0.7815539, 0.5478873, 6.37 },
+    { -0.4861374, -0.6362161, 0.5990822, 6.37 },
+    { -0.7143147, -0.3119397, 0.6264568, 6.37 },
+    { 0.0977457, 0.7617495, 0.6404557, 6.37 },
+    { -0.7453515, -0.1273104, 0.6544029, 6.37 },
+    { -0.4783802, -0.4810811, 0.7346518, 6.37 },
+    { 0.5389138, 0.3751771, 0.7541976, 6.37 },
+    { 0.4578920, -0.4443750, 0.7699777, 6.37 },
+    { 0.2182577, -0.5190444, 0.8264118, 6.37 },
+    { 0.0352595, -0.5495211, 0.8347355, 6.37 },
+    { 0.3169455, 0.4271054, 0.8468333, 6.37 },
+    { -0.5284271, 0.0451702, 0.8477762, 6.37 },
+    { 0.4695910, 0.2247305, 0.8538035, 6.37 },
+    { -0.4158700, -0.2341750, 0.8787572, 6.37 },
+    { 0.3479118, -0.2181988, 0.9117822, 6.37 },
+    { 0.3509029, 0.0889987, 0.9321729, 6.37 },
+    { 0.0973646, 0.3116763, 0.9451868, 6.37 },
+    { 0.2726227, -0.1415328, 0.9516540, 6.37 },
+    { 0.0460401, 0.2293310, 0.9722590, 6.37 },
+    { -0.0936689, 0.0495053, 0.9943718, 6.37 },
+    { 0.1023460, -0.0757964, -0.9918569, 6.38 },
+    { -0.1789619, 0.3639725, -0.9140551, 6.38 },
+    { 0.2052341, 0.3834024, -0.9004896, 6.38 },
+    { -0.4767794, 0.0601256, -0.8769643, 6.38 },
+    { 0.0223498, -0.5139538, -0.8575267, 6.38 },
+    { -0.3638205, 0.3803840, -0.8502604, 6.38 },
+    { 0.1994709, -0.5620657, -0.8026790, 6.38 },
+    { -0.2922729, 0.5326973, -0.7942356, 6.38 },
+    { 0.4953312, -0.4109648, -0.7653462, 6.38 },
+    { -0.6369300, -0.0951524, -0.7650269, 6.38 },
+    { -0.6188271, -0.2345859, -0.7496816, 6.38 },
+    { 0.0322440, 0.7079101, -0.7055662, 6.38 },
+    { -0.3259631, 0.7173070, -0.6158074, 6.38 },
+    { -0.0223646, -0.8209860, -0.5705101, 6.38 },
+    { -0.7493234, 0.3759976, -0.5451057, 6.38 },
+    { -0.8257557, 0.1745905, -0.5363261, 6.38 },
+    { -0.3211454, 0.7864017, -0.5276721, 6.38 },
+    { -0.5274458, 0.6699131, -0.5225106, 6.38 },
+    { 0.5429913, 0.7199092, -0.4323092, 6.38 },
+    { 0.6166915, 0.6764888, -0.4025599, 6.38 },
+    { 0.7170344, -0.5799612, -0.3866609, 6.38 },
+    { 0.0859736, 0.9479750, -0.3065159, 6.38 },
+    { 0.8076942, -0.5134769, -0.2897785, 6.38 },
+    { -0.9236494, 0.2755786, -0.2663235, 6.38 },
+    { -0.5964422, 0.7596135, -0.2593145, 6.38 },
+    { 0.6715417, -0.7132886, -0.2006267, 6.38 },
+    { 0.9099380, -0.3690790, -0.1891916, 6.38 },
+    { 0.1063092, 0.9914164, -0.0761046, 6.38 },
+    { 0.1045767, -0.9925510, -0.0624997, 6.38 },
+    { -0.2296070, -0.9728541, -0.0289054, 6.38 },
+    { 0.9923466, -0.1220207, -0.0189497, 6.38 },
+    { 0.7507354, -0.6606010, 0.0016091, 6.38 },
+    { -0.9564424, 0.2913721, 0.0178940, 6.38 },
+    { 0.4039007, -0.9133899, 0.0508249, 6.38 },
+    { -0.2231685, 0.9733346, 0.0530627, 6.38 },
+    { 0.6282135, 0.7733727, 0.0851020, 6.38 },
+    { 0.1712674, -0.9809433, 0.0917483, 6.38 },
+    { -0.1604673, 0.9689151, 0.1882918, 6.38 },
+    { -0.0246709, -0.9808795, 0.1930462, 6.38 },
+    { -0.5389260, 0.8115329, 0.2257725, 6.38 },
+    { 0.3949888, -0.8844247, 0.2485495, 6.38 },
+    { -0.6546616, 0.7080529, 0.2647250, 6.38 },
+    { 0.4028772, -0.8696812, 0.2852098, 6.38 },
+    { 0.6282175, -0.7133883, 0.3105156, 6.38 },
+    { -0.6695744, 0.6743830, 0.3112519, 6.38 },
+    { -0.7095665, -0.6055087, 0.3603812, 6.38 },
+    { -0.6529051, -0.6578992, 0.3753446, 6.38 },
+    { -0.9094586, -0.1564159, 0.3852521, 6.38 },
+    { -0.7137434, -0.5785704, 0.3947488, 6.38 },
+    { -0.1560239, 0.8957493, 0.4162808, 6.38 },
+    { -0.6361791, 0.6134674, 0.4679037, 6.38 },
+    { -0.0916309, -0.8766539, 0.4723153, 6.38 },
+    { 0.4057144, -0.7801180, 0.4762476, 6.38 },
+    { 0.0344769, -0.8612104, 0.5070780, 6.38 },
+    { 0.7350158, -0.4050262, 0.5437882, 6.38 },
+    { -0.4847964, -0.6396988, 0.5964545, 6.38 },
+    { -0.7122087, -0.3697655, 0.5966844, 6.38 },
+    { 0.3905367, 0.6741642, 0.6268841, 6.38 },
+    { -0.6366905, -0.4310847, 0.6393678, 6.38 },
+    { -0.3154163, 0.6977834, 0.6431259, 6.38 },
+    { 0.6888287, 0.3062369, 0.6570647, 6.38 },
+    { 0.7039702, 0.0022372, 0.7102260, 6.38 },
+    { -0.0549915, 0.6879228, 0.7236976, 6.38 },
+    { -0.0239094, -0.6861217, 0.7270938, 6.38 },
+    { -0.1884796, 0.6450723, 0.7405114, 6.38 },
+    { 0.5694895, 0.1718260, 0.8038393, 6.38 },
+    { -0.2692106, 0.5030766, 0.8212427, 6.38 },
+    { 0.5209861, -0.2003448, 0.8297201, 6.38 },
+    { -0.4739384, -0.0901300, 0.8759332, 6.38 },
+    { -0.2859071, -0.3704320, 0.8837631, 6.38 },
+    { 0.1697329, -0.4284687, 0.8874713, 6.38 },
+    { 0.2493827, -0.0469920, 0.9672642, 6.38 },
+    { 0.2228156, 0.0832909, 0.9712960, 6.38 },
+    { -0.0031361, -0.0164972, 0.9998590, 6.38 },
+    { 0.0729315, -0.1315378, -0.9886247, 6.39 },
+    { -0.1850422, 0.0138134, -0.9826335, 6.39 },
+    { 0.0435399, -0.2056191, -0.9776631, 6.39 },
+    { 0.1795890, -0.3145876, -0.9320850, 6.39 },
+    { 0.1670561, -0.3587910, -0.9183470, 6.39 },
+    { -0.2265148, -0.3484531, -0.9095446, 6.39 },
+    { -0.1627010, 0.3984125, -0.9026604, 6.39 },
+    { -0.1024807, -0.4632632, -0.8802755, 6.39 },
+    { -0.4148989, -0.2813567, -0.8652730, 6.39 },
+    { -0.2281692, 0.5123060, -0.8279380, 6.39 },
+    { 0.4680422, -0.3623802, -0.8059883, 6.39 },
+    { -0.4939543, -0.3311518, -0.8039575, 6.39 },
+    { -0.4199975, 0.4477215, -0.7893970, 6.39 },
+    { -0.5030887, -0.4199455, -0.7553460, 6.39 },
+    { -0.4111272, 0.5301175, -0.7415860, 6.39 },
+    { 0.4284633, 0.5177154, -0.7405336, 6.39 },
+    { 0.0495586, 0.6949859, -0.7173134, 6.39 },
+    { 0.2880130, 0.6570336, -0.6966745, 6.39 },
+    { -0.5982600, -0.4629789, -0.6540149, 6.39 },
+    { -0.5236626, 0.5721128, -0.6312404, 6.39 },
+    { -0.1040618, -0.7754758, -0.6227426, 6.39 },
+    { 0.4509248, -0.6660434, -0.5941827, 6.39 },
+    { -0.7906364, -0.1536066, -0.5927049, 6.39 },
+    { 0.5043237, 0.6336245, -0.5866665, 6.39 },
+    { 0.3337697, 0.7420506, -0.5813422, 6.39 },
+    { -0.6338377, 0.5328041, -0.5606868, 6.39 },
+    { 0.5347132, -0.6909227, -0.4865260, 6.39 },
+    { -0.0943989, 0.8713764, -0.4814478, 6.39 },
+    { 0.7948723, 0.3963816, -0.4594124, 6.39 },
+    { 0.5724652, 0.6868086, -0.4478588, 6.39 },
+    { -0.0548412, 0.9128774, -0.4045334, 6.39 },
+    { -0.6352986, 0.6582636, -0.4038376, 6.39 },
+    { 0.4640998, 0.8385104, -0.2855025, 6.39 },
+    { 0.0411645, -0.9696988, -0.2408106, 6.39 },
+    { -0.0686308, -0.9699097, -0.2335915, 6.39 },
+    { -0.4381722, 0.8716980, -0.2194257, 6.39 },
+    { 0.9725219, 0.0973413, -0.2114850, 6.39 },
+    { 0.9858819, -0.1056425, -0.1299100, 6.39 },
+    { 0.9860464, -0.1253608, -0.1095314, 6.39 },
+    { -0.8528448, -0.5136732, -0.0937849, 6.39 },
+    { 0.1710043, 0.9808210, -0.0935296, 6.39 },
+    { 0.8894205, -0.4496196, -0.0823004, 6.39 },
+    { 0.1348630, 0.9891831, -0.0576947, 6.39 },
+    { -0.6029278, 0.7965859, -0.0439192, 6.39 },
+    { 0.9027121, -0.4302251, -0.0041505, 6.39 },
+    { 0.9713926, -0.2363817, 0.0228075, 6.39 },
+    { 0.9851606, 0.1626875, 0.0546941, 6.39 },
+    { 0.3726157, 0.9231839, 0.0942821, 6.39 },
+    { 0.7646393, 0.6303937, 0.1339050, 6.39 },
+    { -0.1261296, -0.9702551, 0.2066311, 6.39 },
+    { 0.5604655, 0.7842721, 0.2660744, 6.39 },
+    { -0.9562635, -0.0439540, 0.2891854, 6.39 },
+    { -0.0682937, 0.9529303, 0.2953977, 6.39 },
+    { 0.2485986, -0.9104139, 0.3306741, 6.39 },
+    { 0.8032655, -0.4908447, 0.3373960, 6.39 },
+    { -0.6043283, 0.7195290, 0.3421482, 6.39 },
+    { -0.7723241, -0.5145075, 0.3725555, 6.39 },
+    { -0.0494858, 0.9197988, 0.3892575, 6.39 },
+    { -0.5793781, -0.6973368, 0.4219507, 6.39 },
+    { -0.7937302, 0.3546503, 0.4941817, 6.39 },
+    { 0.2218511, -0.8026180, 0.5537024, 6.39 },
+    { 0.4944753, -0.6614099, 0.5639425, 6.39 },
+    { 0.7556942, 0.3212668, 0.5707136, 6.39 },
+    { 0.4375211, -0.6130989, 0.6577880, 6.39 },
+    { 0.6963231, -0.1776421, 0.6953973, 6.39 },
+    { 0.6419056, -0.2239283, 0.7333575, 6.39 },
+    { -0.5479995, 0.3741061, 0.7481585, 6.39 },
+    { 0.3920511, 0.5194123, 0.7592805, 6.39 },
+    { -0.4372117, -0.4701879, 0.7666611, 6.39 },
+    { 0.6070827, 0.1372486, 0.7826963, 6.39 },
+    { 0.5341606, 0.2497030, 0.8076638, 6.39 },
+    { 0.4873157, -0.2639722, 0.8323714, 6.39 },
+    { 0.4959390, 0.1024938, 0.8622874, 6.39 },
+    { 0.4593041, -0.0797963, 0.8846877, 6.39 },
+    { -0.4327331, 0.1137336, 0.8943192, 6.39 },
+    { -0.0129723, 0.4467339, 0.8945728, 6.39 },
+    { 0.3232048, -0.2866773, 0.9018619, 6.39 },
+    { -0.4004138, 0.1284949, 0.9072805, 6.39 },
+    { 0.3145529, 0.0850449, 0.9454226, 6.39 },
+    { -0.1153556, -0.2277151, 0.9668707, 6.39 },
+    { 0.2494881, -0.0082564, 0.9683427, 6.39 },
+    { 0.0345444, -0.1711857, 0.9846330, 6.39 },
+    { -0.3820101, -0.2392591, -0.8926496, 6.40 },
+    { -0.3893641, -0.3132997, -0.8661633, 6.40 },
+    { -0.5072241, -0.0973776, -0.8562951, 6.40 },
+    { -0.4607671, 0.2358198, -0.8556183, 6.40 },
+    { -0.4257302, 0.4144137, -0.8043725, 6.40 },
+    { -0.7095040, -0.2839423, -0.6449658, 6.40 },
+    { -0.7697017, -0.0795913, -0.6334229, 6.40 },
+    { -0.3436089, 0.7067333, -0.6184343, 6.40 },
+    { 0.2101357, -0.7698201, -0.6026773, 6.40 },
+    { 0.7730950, -0.2244281, -0.5932589, 6.40 },
+    { -0.2188288, 0.8050073, -0.5514319, 6.40 },
+    { -0.0616977, -0.8359106, -0.5453870, 6.40 },
+    { 0.5034619, 0.6838678, -0.5280633, 6.40 },
+    { 0.6283096, 0.5855068, -0.5122586, 6.40 },
+    { 0.5388441, -0.6726475, -0.5071415, 6.40 },
+    { -0.4587625, -0.7356953, -0.4982864, 6.40 },
+    { 0.8721810, 0.0165120, -0.4889046, 6.40 },
+    { 0.6688160, -0.5666614, -0.4812276, 6.40 },
+    { 0.0667715, -0.8780315, -0.4739221, 6.40 },
+    { -0.2043025, 0.8676133, -0.4533295, 6.40 },
+    { 0.7404421, -0.5415985, -0.3980158, 6.40 },
+    { -0.9090011, 0.1908242, -0.3705444, 6.40 },
+    { -0.6978921, -0.6184297, -0.3612358, 6.40 },
+    { -0.1358173, 0.9241286, -0.3571275, 6.40 },
+    { 0.7379333, -0.6345837, -0.2296911, 6.40 },
+    { 0.9005488, -0.3729037, -0.2235053, 6.40 },
+    { -0.8027728, 0.5733613, -0.1637459, 6.40 },
+    { 0.9419587, 0.2979024, -0.1548158, 6.40 },
+    { -0.1120445, 0.9841659, -0.1373442, 6.40 },
+    { -0.8647520, -0.4983680, -0.0619142, 6.40 },
+    { 0.1061066, 0.9927345, -0.0567417, 6.40 },
+    { 0.6673586, -0.7424994, 0.0576807, 6.40 },
+    { -0.1013075, 0.9926864, 0.0656537, 6.40 },
+    { -0.9909069, -0.0977406, 0.0924681, 6.40 },
+    { 0.7810602, -0.6079667, 0.1425531, 6.40 },
+    { 0.1645779, -0.9743358, 0.1535703, 6.40 },
+    { 0.1485007, -0.9706927, 0.1889531, 6.40 },
+    { 0.9151195, -0.3485042, 0.2027341, 6.40 },
+    { 0.9616201, 0.1476711, 0.2312574, 6.40 },
+    { -0.7000630, -0.6607930, 0.2706742, 6.40 },
+    { -0.1322802, 0.9525848, 0.2740147, 6.40 },
+    { -0.1066554, -0.9528499, 0.2840804, 6.40 },
+    { 0.9017954, -0.2815184, 0.3278908, 6.40 },
+    { 0.3353521, -0.8761158, 0.3463527, 6.40 },
+    { 0.7997792, -0.4786580, 0.3622704, 6.40 },
+    { 0.2466337, -0.8919793, 0.3788730, 6.40 },
+    { -0.6717955, 0.6294895, 0.3904276, 6.40 },
+    { -0.8216475, 0.3874630, 0.4180525, 6.40 },
+    { -0.2307653, 0.8693428, 0.4370246, 6.40 },
+    { 0.3341445, 0.7955283, 0.5054524, 6.40 },
+    { -0.3472342, -0.7703076, 0.5348407, 6.40 },
+    { 0.6753427, -0.4480951, 0.5857670, 6.40 },
+    { -0.7953975, 0.0908409, 0.5992417, 6.40 },
+    { 0.0328763, -0.7823793, 0.6219340, 6.40 },
+    { -0.2728859, 0.7277056, 0.6292676, 6.40 },
+    { 0.5860245, -0.4872912, 0.6473967, 6.40 },
+    { 0.6605208, -0.2460009, 0.7093630, 6.40 },
+    { 0.4668513, -0.5214720, 0.7142247, 6.40 },
+    { 0.1352652, -0.6409530, 0.7555677, 6.40 },
+    { 0.6018919, -0.2489785, 0.7587726, 6.40 },
+    { 0.0594835, -0.6437063, 0.7629574, 6.40 },
+    { -0.0677274, -0.5274169, 0.8469029, 6.40 },
+    { 0.3092898, 0.4162131, 0.8550477, 6.40 },
+    { 0.4907805, -0.1151721, 0.8636376, 6.40 },
+    { 0.4730265, -0.0361375, 0.8803068, 6.40 },
+    { -0.2305771, 0.3894456, 0.8917210, 6.40 },
+    { -0.3621742, 0.0766800, 0.9289511, 6.40 },
+    { -0.3270115, -0.1720251, 0.9292313, 6.40 },
+    { -0.0933981, -0.3428345, 0.9347413, 6.40 },
+    { -0.2627959, 0.1253214, 0.9566780, 6.40 },
+    { -0.0055985, 0.2488669, 0.9685215, 6.40 },
+    { -0.1599093, -0.0313970, 0.9866323, 6.40 },
+    { 0.1286682, 0.0225652, 0.9914309, 6.40 },
+    { 0.0466239, 0.0681787, -0.9965831, 6.41 },
+    { 0.1545147, -0.0327022, -0.9874491, 6.41 },
+    { 0.1859083, -0.1053229, -0.9769059, 6.41 },
+    { -0.3044293, 0.0535899, -0.9510262, 6.41 },
+    { 0.2694491, -0.2176543, -0.9380958, 6.41 },
+    { 0.1132662, 0.3793895, -0.9182779, 6.41 },
+    { 0.3211859, 0.2364491, -0.9170231, 6.41 },
+    { -0.4135793, 0.0985224, -0.9051218, 6.41 },
+    { 0.0146320, -0.4294741, -0.9029606, 6.41 },
+    { -0.2189650, -0.3838022, -0.8970787, 6.41 },
+    { -0.4242436, 0.2130172, -0.8801370, 6.41 },
+    { 0.2901564, 0.3880718, -0.8747626, 6.41 },
+    { -0.1163485, 0.4964749, -0.8602184, 6.41 },
+    { 0.5096134, 0.1609816, -0.8452095, 6.41 },
+    { 0.5745109, 0.0943415, -0.8130418, 6.41 },
+    { 0.4855994, -0.3616411, -0.7958699, 6.41 },
+    { -0.0471449, 0.6036905, -0.7958235, 6.41 },
+    { -0.5694899, -0.2744137, -0.7748409, 6.41 },
+    { -0.3045792, 0.6431568, -0.7025530, 6.41 },
+    { -0.5236661, -0.5456695, -0.6542313, 6.41 },
+    { -0.6487829, 0.3894814, -0.6537468, 6.41 },
+    { 0.5616742, 0.5497672, -0.6182865, 6.41 },
+    { -0.1281705, -0.7796363, -0.6129760, 6.41 },
+    { -0.6723050, 0.4590884, -0.5807270, 6.41 },
+    { 0.7376097, -0.4435212, -0.5091374, 6.41 },
+    { 0.7002684, -0.5140071, -0.4953997, 6.41 },
+    { 0.6085165, -0.6406088, -0.4683248, 6.41 },
+    { 0.1918416, 0.8787902, -0.4369492, 6.41 },
+    { -0.4071218, -0.8144379, -0.4134523, 6.41 },
+    { 0.2890011, -0.8833276, -0.3690674, 6.41 },
+    { -0.4145113, -0.8357600, -0.3601189, 6.41 },
+    { 0.5816786, -0.7668415, -0.2713009, 6.41 },
+    { 0.2348997, 0.9398046, -0.2481724, 6.41 },
+    { -0.9591450, -0.2187121, -0.1794600, 6.41 },
+    { 0.9374662, -0.3262845, -0.1212250, 6.41 },
+    { -0.4744342, -0.8737702, -0.1069476, 6.41 },
+    { -0.2328265, 0.9671579, -0.1019679, 6.41 },
+    { -0.6598025, 0.7500677, -0.0453770, 6.41 },
+    { -0.5218280, 0.8529920, -0.0100112, 6.41 },
+    { 0.9296653, 0.3683394, -0.0069570, 6.41 },
+    { -0.3227669, 0.9464743, -0.0028168, 6.41 },
+    { 0.3372879, -0.9413829, 0.0059200, 6.41 },
+    { 0.1390215, 0.9900301, 0.0226578, 6.41 },
+    { -0.9763759, -0.2068977, 0.0623168, 6.41 },
+    { 0.9638505, -0.2402397, 0.1152266, 6.41 },
+    { -0.4888908, 0.8632603, 0.1255689, 6.41 },
+    { -0.3624977, 0.9122101, 0.1909665, 6.41 },
+    { -0.7447400, 0.6368730, 0.1993869, 6.41 },
+    { 0.9616248, 0.1519265, 0.2284646, 6.41 },
+    { -0.3471169, 0.8988542, 0.2675275, 6.41 },
+    { -0.3447905, -0.8916722, 0.2933262, 6.41 },
+    { 0.5594944, -0.7559752, 0.3398051, 6.41 },
+    { -0.7021108, 0.5709461, 0.4255126, 6.41 },
+    { 0.5666159, -0.6988495, 0.4365270, 6.41 },
+    { -0.1317823, -0.8821754, 0.4521061, 6.41 },
+    { 0.8729296, -0.1082715, 0.4756796, 6.41 },
+    { 0.8508573, -0.1717110, 0.4965452, 6.41 },
+    { 0.1540464, -0.8375148, 0.5242506, 6.41 },
+    { -0.7935969, 0.1667423, 0.5851503, 6.41 },
+    { 0.3956072, 0.6938886, 0.6016756, 6.41 },
+    { 0.1979219, -0.7490403, 0.6322701, 6.41 },
+    { 0.6751964, -0.3082445, 0.6701456, 6.41 },
+    { -0.1247803, 0.7082636, 0.6948327, 6.41 },
+    { 0.4250070, 0.5673527, 0.7053226, 6.41 },
+    { 0.4234225, -0.5518233, 0.7184737, 6.41 },
+    { 0.4628853, 0.4954727, 0.7350129, 6.41 },
+    { 0.1736678, 0.5785272, 0.7969603, 6.41 },
+    { -0.5777528, 0.0755108, 0.8127114, 6.41 },
+    { -0.2860732, 0.3983520, 0.8714802, 6.41 },
+    { 0.4500493, 0.1487637, 0.8805254, 6.41 },
+    { 0.4240520, -0.0210178, 0.9053939, 6.41 },
+    { 0.0922137, 0.4137413, 0.9057123, 6.41 },
+    { -0.1155749, -0.4058632, 0.9065967, 6.41 },
+    { -0.1571767, -0.3301089, 0.9307651, 6.41 },
+    { 0.0758808, 0.3395523, 0.9375214, 6.41 },
+    { 0.2276810, -0.2606472, 0.9382027, 6.41 },
+    { -0.0635067, 0.1449099, 0.9874047, 6.41 },
+    { -0.1005916, -0.0733448, -0.9922207, 6.42 },
+    { -0.3174700, -0.0034311, -0.9482621, 6.42 },
+    { 0.4152855, 0.0669328, -0.9072254, 6.42 },
+    { -0.4073316, 0.2285297, -0.8842257, 6.42 },
+    { -0.4294982, -0.2642764, -0.8635330, 6.42 },
+    { -0.4753949, 0.1699980, -0.8631920, 6.42 },
+    { -0.2901764, 0.4224856, -0.8586638, 6.42 },
+    { -0.4764837, -0.2174647, -0.8518641, 6.42 },
+    { -0.5383979, -0.0739388, -0.8394407, 6.42 },
+    { 0.1767103, 0.5685600, -0.8034382, 6.42 },
+    { -0.1483841, 0.6485704, -0.7465511, 6.42 },
+    { -0.4176398, -0.6395790, -0.6453803, 6.42 },
+    { -0.5495527, 0.5860173, -0.5954625, 6.42 },
+    { -0.5283393, 0.6134385, -0.5869844, 6.42 },
+    { -0.0216003, -0.8205491, -0.5711677, 6.42 },
+    { -0.2172648, 0.8291958, -0.5150052, 6.42 },
+    { 0.7477961, 0.4425464, -0.4949280, 6.42 },
+    { 0.9029580, -0.0401076, -0.4278531, 6.42 },
+    { -0.9045460, 0.0830889, -0.4182018, 6.42 },
+    { 0.1878891, -0.9230923, -0.3355566, 6.42 },
+    { 0.1751684, -0.9518832, -0.2514646, 6.42 },
+    { 0.9449948, -0.2102495, -0.2505593, 6.42 },
+    { -0.8416426, 0.5291904, -0.1076817, 6.42 },
+    { 0.0797852, 0.9955308, -0.0505252, 6.42 },
+    { 0.1877664, 0.9816258, 0.0339784, 6.42 },
+    { 0.7204918, -0.6915617, 0.0513231, 6.42 },
+    { 0.1439765, 0.9823268, 0.1196031, 6.42 },
+    { 0.1436603, -0.9791224, 0.1438088, 6.42 },
+    { 0.6299886, -0.7517022, 0.1950851, 6.42 },
+    { 0.1584457, -0.9673054, 0.1980285, 6.42 },
+    { -0.1181776, -0.9712364, 0.2067217, 6.42 },
+    { 0.5080476, -0.8121916, 0.2867619, 6.42 },
+    { 0.8708924, -0.3492507, 0.3457895, 6.42 },
+    { -0.8968363, -0.0960229, 0.4318151, 6.42 },
+    { 0.5970863, 0.6524441, 0.4666954, 6.42 },
+    { -0.1581518, 0.8670273, 0.4724952, 6.42 },
+    { -0.8454768, 0.0069356, 0.5339671, 6.42 },
+    { -0.1228861, 0.8293862, 0.5449931, 6.42 },
+    { -0.4613032, -0.6338915, 0.6207906, 6.42 },
+    { 0.4275613, 0.5994364, 0.6766590, 6.42 },
+    { -0.0091751, 0.7267732, 0.6868162, 6.42 },
+    { 0.6043659, 0.3797062, 0.7004035, 6.42 },
+    { -0.6646476, 0.0849026, 0.7423174, 6.42 },
+    { 0.5676175, -0.3375735, 0.7509024, 6.42 },
+    { 0.5703113, -0.3023621, 0.7637553, 6.42 },
+    { 0.5713578, -0.2644280, 0.7769351, 6.42 },
+    { -0.3854921, 0.4635039, 0.7978471, 6.42 },
+    { 0.3950309, -0.3394409, 0.8536571, 6.42 },
+    { -0.0354833, -0.3472413, 0.9371043, 6.42 },
+    { 0.3224320, 0.0472126, 0.9454145, 6.42 },
+    { -0.2368822, 0.1690649, 0.9567152, 6.42 },
+    { -0.2116432, 0.0354628, -0.9767034, 6.43 },
+    { -0.4433958, 0.1821818, -0.8776160, 6.43 },
+    { -0.0363910, 0.5105435, -0.8590815, 6.43 },
+    { -0.2244513, 0.4696750, -0.8538308, 6.43 },
+    { 0.0657369, 0.5712037, -0.8181717, 6.43 },
+    { -0.5891598, -0.1731566, -0.7892449, 6.43 },
+    { 0.5922472, -0.3084133, -0.7443954, 6.43 },
+    { 0.7067677, -0.0961455, -0.7008819, 6.43 },
+    { -0.1949493, 0.6998803, -0.6871407, 6.43 },
+    { -0.4939708, 0.5479038, -0.6751254, 6.43 },
+    { -0.0102151, -0.7625366, -0.6468645, 6.43 },
+    { -0.6708661, 0.3703762, -0.6424641, 6.43 },
+    { -0.6218184, 0.4637847, -0.6310670, 6.43 },
+    { -0.0441894, -0.7855672, -0.6171965, 6.43 },
+    { -0.4320982, 0.6599486, -0.6146210, 6.43 },
+    { -0.4706849, 0.6754016, -0.5677045, 6.43 },
+    { 0.0366920, -0.8405245, -0.5405295, 6.43 },
+    { -0.5259656, 0.6581096, -0.5387504, 6.43 },
+    { 0.8311927, -0.3404938, -0.4395255, 6.43 },
+    { -0.8994798, 0.0042904, -0.4369413, 6.43 },
+    { 0.7275262, -0.5454723, -0.4161318, 6.43 },
+    { 0.9305111, 0.1157020, -0.3475085, 6.43 },
+    { -0.1735822, -0.9439193, -0.2808659, 6.43 },
+    { -0.4354496, 0.8568982, -0.2758788, 6.43 },
+    { -0.3460495, 0.9251433, -0.1560758, 6.43 },
+    { -0.5958348, 0.7883471, -0.1532637, 6.43 },
+    { 0.9984417, 0.0337112, -0.0444718, 6.43 },
+    { -0.9248674, -0.3795436, -0.0238108, 6.43 },
+    { -0.8395721, -0.5427279, 0.0237725, 6.43 },
+    { 0.1393931, -0.9881778, 0.0638303, 6.43 },
+    { 0.9514789, -0.2612556, 0.1625836, 6.43 },
+    { 0.5222137, -0.8370300, 0.1633207, 6.43 },
+    { -0.4282677, 0.8758163, 0.2225592, 6.43 },
+    { 0.8069420, 0.5110389, 0.2961147, 6.43 },
+    { -0.2806992, 0.8887538, 0.3623874, 6.43 },
+    { -0.8993397, -0.2005731, 0.3885339, 6.43 },
+    { 0.5019689, 0.7587399, 0.4151396, 6.43 },
+    { -0.2777963, 0.8447131, 0.4574812, 6.43 },
+    { 0.8330672, 0.2790766, 0.4776142, 6.43 },
+    { 0.3586012, -0.7946126, 0.4898939, 6.43 },
+    { 0.0707566, 0.8675826, 0.4922337, 6.43 },
+    { -0.0803689, 0.8662820, 0.4930479, 6.43 },
+    { -0.1012208, 0.8366987, 0.5382283, 6.43 },
+    { 0.3594908, -0.7237138, 0.5890710, 6.43 },
+    { -0.6267858, -0.4956202, 0.6012488, 6.43 },
+    { 0.7458632, -0.2607404, 0.6129457, 6.43 },
+    { -0.0993443, -0.7720731, 0.6277212, 6.43 },
+    { 0.5596811, -0.4844129, 0.6723848, 6.43 },
+    { 0.3642608, -0.6442431, 0.6725064, 6.43 },
+    { -0.1712628, -0.7009952, 0.6922968, 6.43 },
+    { 0.6928620, -0.1306771, 0.7091303, 6.43 },
+    { -0.6195716, 0.2922646, 0.7285002, 6.43 },
+    { -0.0378222, -0.6730834, 0.7385988, 6.43 },
+    { -0.1141640, -0.6568371, 0.7453399, 6.43 },
+    { 0.1806028, -0.6179620, 0.7651833, 6.43 },
+    { -0.5862398, -0.2391256, 0.7740425, 6.43 },
+    { 0.3075487, -0.5505661, 0.7760739, 6.43 },
+    { -0.6015771, 0.1599919, 0.7826287, 6.43 },
+    { -0.3495493, -0.4512328, 0.8210994, 6.43 },
+    { 0.5224393, 0.1572443, 0.8380522, 6.43 },
+    { -0.5431283, -0.0278661, 0.8391872, 6.43 },
+    { -0.5360164, 0.0901272, 0.8393828, 6.43 },
+    { 0.1855304, -0.5000569, 0.8458851, 6.43 },
+    { 0.5056893, -0.1275835, 0.8532296, 6.43 },
+    { 0.0611153, -0.5030999, 0.8620646, 6.43 },
+    { 0.4851799, -0.1319341, 0.8644038, 6.43 },
+    { 0.3475785, -0.2064075, 0.9146503, 6.43 },
+    { -0.0586844, -0.3813138, 0.9225811, 6.43 },
+    { -0.2720108, -0.0044373, -0.9622840, 6.44 },
+    { -0.1937984, -0.2772660, -0.9410450, 6.44 },
+    { 0.0756300, -0.5138460, -0.8545422, 6.44 },
+    { -0.3840491, 0.3682899, -0.8466811, 6.44 },
+    { 0.2144630, 0.5818878, -0.7844821, 6.44 },
+    { -0.3077306, 0.5419414, -0.7820495, 6.44 },
+    { -0.3546613, 0.5288460, -0.7710624, 6.44 },
+    { -0.4718034, -0.5220712, -0.7105232, 6.44 },
+    { 0.2900838, 0.6846969, -0.6686116, 6.44 },
+    { -0.7503634, -0.1439483, -0.6451618, 6.44 },
+    { -0.6799726, -0.3551909, -0.6414645, 6.44 },
+    { -0.1126820, 0.7730759, -0.6242247, 6.44 },
+    { 0.4924301, -0.6139658, -0.6168943, 6.44 },
+    { -0.4304538, 0.6690433, -0.6058800, 6.44 },
+    { 0.3745585, 0.7254077, -0.5774856, 6.44 },
+    { -0.1021430, -0.8256326, -0.5548852, 6.44 },
+    { -0.7653299, -0.3356650, -0.5491804, 6.44 },
+    { 0.0117814, 0.8481871, -0.5295656, 6.44 },
+    { -0.4133933, 0.7517394, -0.5138033, 6.44 },
+    { -0.8699987, 0.0717562, -0.4878046, 6.44 },
+    { 0.7810509, -0.4065822, -0.4739730, 6.44 },
+    { -0.1293431, -0.8898765, -0.4374816, 6.44 },
+    { 0.7273066, 0.5300460, -0.4359773, 6.44 },
+    { -0.8876560, -0.1882528, -0.4202709, 6.44 },
+    { 0.9124260, 0.0124553, -0.4090521, 6.44 },
+    { -0.8985004, 0.2610675, -0.3529033, 6.44 },
+    { -0.8428582, 0.4265433, -0.3281019, 6.44 },
+    { -0.5663325, 0.7677561, -0.2996967, 6.44 },
+    { 0.6832996, -0.7202164, -0.1199583, 6.44 },
+    { -0.8226374, -0.5567493, -0.1153166, 6.44 },
+    { -0.9700982, -0.2312673, -0.0736540, 6.44 },
+    { -0.1478997, -0.9885823, -0.0288235, 6.44 },
+    { 0.4475253, 0.8940462, -0.0200646, 6.44 },
+    { 0.4480405, -0.8745425, 0.1855671, 6.44 },
+    { -0.9109119, -0.3519864, 0.2152789, 6.44 },
+    { -0.8662105, 0.4430867, 0.2309838, 6.44 },
+    { 0.9311416, -0.2273975, 0.2850713, 6.44 },
+    { 0.7523869, -0.5825689, 0.3074530, 6.44 },
+    { -0.6064375, 0.7203697, 0.3366023, 6.44 },
+    { 0.2214905, 0.9144001, 0.3388428, 6.44 },
+    { -0.1479380, 0.8971879, 0.4161349, 6.44 },
+    { -0.7060051, -0.4950168, 0.5064732, 6.44 },
+    { -0.4631028, -0.7133417, 0.5260032, 6.44 },
+    { 0.5729615, -0.6143982, 0.5424297, 6.44 },
+    { 0.3815836, -0.7421375, 0.5510226, 6.44 },
+    { -0.5614533, 0.5589446, 0.6102059, 6.44 },
+    { -0.7027330, 0.0653504, 0.7084459, 6.44 },
+    { 0.6199689, -0.3371652, 0.7084901, 6.44 },
+    { -0.6065828, 0.2572818, 0.7522389, 6.44 },
+    { 0.6203032, -0.0260752, 0.7839286, 6.44 },
+    { -0.5825249, 0.1766191, 0.7933917, 6.44 },
+    { 0.0005917, 0.5689806, 0.8223507, 6.44 },
+    { 0.4353325, 0.2872988, 0.8531970, 6.44 },
+    { 0.2993737, -0.4079774, 0.8625137, 6.44 },
+    { -0.1429029, 0.4822646, 0.8642914, 6.44 },
+    { 0.0616034, -0.3231661, 0.9443351, 6.44 },
+    { 0.0005709, -0.0834203, -0.9965143, 6.45 },
+    { 0.0722602, -0.0544174, -0.9959002, 6.45 },
+    { 0.1816371, -0.3493371, -0.9192234, 6.45 },
+    { 0.3933672, -0.0568252, -0.9176236, 6.45 },
+    { 0.2130434, -0.3398124, -0.9160459, 6.45 },
+    { -0.0046836, 0.4985128, -0.8668697, 6.45 },
+    { -0.4079852, -0.3094668, -0.8589403, 6.45 },
+    { -0.1399872, 0.5354728, -0.8328700, 6.45 },
+    { 0.0071756, 0.5958157, -0.8030891, 6.45 },
+    { -0.1577387, -0.6073966, -0.7785807, 6.45 },
+    { 0.5405099, -0.3600774, -0.7603902, 6.45 },
+    { -0.3308389, 0.6307781, -0.7019007, 6.45 },
+    { -0.2109469, -0.7143971, -0.6671867, 6.45 },
+    { 0.4239127, 0.6290871, -0.6515730, 6.45 },
+    { 0.0723352, -0.7901822, -0.6085883, 6.45 },
+    { -0.8078967, 0.1136329, -0.5782651, 6.45 },
+    { -0.0252541, -0.8185762, -0.5738425, 6.45 },
+    { -0.8077861, 0.1509791, -0.5698131, 6.45 },
+    { -0.7193577, 0.4790124, -0.5030623, 6.45 },
+    { -0.4904176, 0.7137511, -0.5000500, 6.45 },
+    { -0.7997940, -0.3418638, -0.4934153, 6.45 },
+    { 0.0304220, 0.8702654, -0.4916427, 6.45 },
+    { -0.1727821, 0.8713196, -0.4592913, 6.45 },
+    { -0.6005574, -0.6757012, -0.4275029, 6.45 },
+    { -0.4235957, 0.8051231, -0.4151427, 6.45 },
+    { -0.8053724, -0.4252537, -0.4129583, 6.45 },
+    { 0.4745997, -0.7919132, -0.3842246, 6.45 },
+    { 0.9424599, 0.0722832, -0.3264115, 6.45 },
+    { 0.9541183, 0.1513309, -0.2583741, 6.45 },
+    { -0.6358652, 0.7434301, -0.2073331, 6.45 },
+    { -0.2711589, 0.9463474, -0.1757824, 6.45 },
+    { 0.9342556, -0.3259899, -0.1445582, 6.45 },
+    { 0.7981679, 0.6014626, 0.0342158, 6.45 },
+    { 0.7362213, -0.6747900, 0.0513478, 6.45 },
+    { -0.8735506, 0.4835196, 0.0558409, 6.45 },
+    { -0.8303432, -0.5542055, 0.0581932, 6.45 },
+    { -0.1498269, 0.9798907, 0.1317806, 6.45 },
+    { -0.6345503, 0.7601934, 0.1394703, 6.45 },
+    { -0.0566194, 0.9812147, 0.1844231, 6.45 },
+    { -0.8203084, 0.5356113, 0.2005360, 6.45 },
+    { -0.3305989, 0.9068988, 0.2612257, 6.45 },
+    { -0.5688141, -0.7678669, 0.2946709, 6.45 },
+    { -0.8934068, -0.3086642, 0.3264211, 6.45 },
+    { -0.8889803, -0.3084381, 0.3384966, 6.45 },
+    { 0.6066340, -0.7181520, 0.3409589, 6.45 },
+    { -0.9314886, 0.1017548, 0.3492490, 6.45 },
+    { -0.1692206, -0.9041857, 0.3921895, 6.45 },
+    { 0.4767066, -0.7857673, 0.3941072, 6.45 },
+    { 0.9045076, -0.0953403, 0.4156636, 6.45 },
+    { 0.8504601, 0.0561775, 0.5230313, 6.45 },
+    { 0.2741367, 0.7939539, 0.5426659, 6.45 },
+    { -0.7976487, -0.1380706, 0.5871057, 6.45 },
+    { 0.4433171, -0.6692512, 0.5962992, 6.45 },
+    { 0.5875646, 0.5358232, 0.6063509, 6.45 },
+    { -0.7906538, 0.0242257, 0.6117840, 6.45 },
+    { 0.3517884, 0.7055257, 0.6152060, 6.45 },
+    { 0.1368331, -0.7720165, 0.6206990, 6.45 },
+    { 0.1452624, -0.7600804, 0.6333850, 6.45 },
+    { 0.0246876, 0.7704026, 0.6370795, 6.45 },
+    { 0.4960081, 0.5766117, 0.6492265, 6.45 },
+    { 0.3932078, -0.5677222, 0.7232421, 6.45 },
+    { 0.6517380, 0.1838864, 0.7358148, 6.45 },
+    { -0.2509957, -0.6067059, 0.7542606, 6.45 },
+    { -0.0121615, 0.6213938, 0.7834040, 6.45 },
+    { -0.5532060, 0.2186757, 0.8038309, 6.45 },
+    { -0.5358047, 0.2491476, 0.8067458, 6.45 },
+    { -0.3646414, -0.4606476, 0.8092221, 6.45 },
+    { -0.0853735, 0.5620704, 0.8226714, 6.45 },
+    { 0.4967519, 0.2691766, 0.8250949, 6.45 },
+    { -0.4462440, 0.3430553, 0.8265466, 6.45 },
+    { -0.3061863, -0.4338793, 0.8473480, 6.45 },
+    { 0.4932695, 0.1877697, 0.8493691, 6.45 },
+    { 0.3845236, 0.3578167, 0.8509458, 6.45 },
+    { -0.3709497, 0.3498149, 0.8602475, 6.45 },
+    { -0.2760902, 0.4099311, 0.8693277, 6.45 },
+    { 0.4628791, -0.0811218, 0.8827017, 6.45 },
+    { 0.1146226, -0.4489457, 0.8861768, 6.45 },
+    { 0.2947108, -0.3236276, 0.8991166, 6.45 },
+    { -0.2259442, -0.1397367, 0.9640658, 6.45 },
+    { -0.3103406, 0.1060494, -0.9446916, 6.46 },
+    { -0.0476072, 0.4447676, -0.8943799, 6.46 },
+    { 0.1448466, 0.4264892, -0.8928194, 6.46 },
+    { 0.4797044, -0.1472366, -0.8649885, 6.46 },
+    { -0.4514740, 0.2997462, -0.8404305, 6.46 },
+    { -0.1169300, 0.5659807, -0.8160841, 6.46 },
+    { 0.3154170, 0.5175829, -0.7953742, 6.46 },
+    { -0.1792534, 0.6122566, -0.7700715, 6.46 },
+    { -0.2548085, -0.6563550, -0.7101202, 6.46 },
+    { -0.1642835, 0.7006302, -0.6943546, 6.46 },
+    { 0.2298513, -0.7327655, -0.6404866, 6.46 },
+    { -0.7904679, 0.0192151, -0.6122019, 6.46 },
+    { 0.4684538, -0.6636770, -0.5831671, 6.46 },
+    { 0.4034509, -0.7347488, -0.5453179, 6.46 },
+    { -0.5058766, -0.6703365, -0.5428976, 6.46 },
+    { -0.8348328, -0.1176073, -0.5377943, 6.46 },
+    { -0.2770172, -0.8004880, -0.5314889, 6.46 },
+    { -0.8225495, 0.2078761, -0.5293390, 6.46 },
+    { -0.7017108, 0.5272984, -0.4791226, 6.46 },
+    { -0.2972173, 0.8416688, -0.4508386, 6.46 },
+    { 0.8835882, 0.2088992, -0.4190859, 6.46 },
+    { 0.4572597, 0.8199471, -0.3443840, 6.46 },
+    { -0.1669212, -0.9683439, -0.1855999, 6.46 },
+    { 0.9868463, 0.0806863, -0.1400857, 6.46 },
+    { 0.1169648, 0.9926833, -0.0299856, 6.46 },
+    { 0.7821892, -0.6229712, 0.0093267, 6.46 },
+    { 0.9980650, -0.0487189, 0.0386354, 6.46 },
+    { -0.6084326, 0.7741190, 0.1747844, 6.46 },
+    { -0.1940913, 0.9560565, 0.2197374, 6.46 },
+    { -0.8239070, 0.5196799, 0.2260752, 6.46 },
+    { -0.0337643, -0.9638473, 0.2643075, 6.46 },
+    { 0.3848707, 0.8811613, 0.2746441, 6.46 },
+    { 0.7178579, 0.6257771, 0.3050952, 6.46 },
+    { 0.8291619, -0.4293233, 0.3580113, 6.46 },
+    { 0.7554623, 0.5239209, 0.3934254, 6.46 },
+    { -0.8944418, 0.2078894, 0.3959240, 6.46 },
+    { 0.8916516, 0.0015497, 0.4527196, 6.46 },
+    { 0.1392360, 0.8640077, 0.4838430, 6.46 },
+    { -0.5191183, -0.6788455, 0.5193120, 6.46 },
+    { -0.7651429, 0.3768917, 0.5220239, 6.46 },
+    { -0.6098642, 0.5842261, 0.5354862, 6.46 },
+    { 0.7270758, -0.4178895, 0.5447285, 6.46 },
+    { -0.1462675, 0.7963947, 0.5868231, 6.46 },
+    { 0.7480762, 0.2677881, 0.6071833, 6.46 },
+    { 0.7291472, -0.3141650, 0.6079842, 6.46 },
+    { -0.0292649, -0.7646707, 0.6437564, 6.46 },
+    { 0.6993691, 0.2805888, 0.6573833, 6.46 },
+    { 0.4972983, -0.4536311, 0.7395358, 6.46 },
+    { 0.5045155, -0.4400659, 0.7428366, 6.46 },
+    { 0.6101229, -0.1839988, 0.7706455, 6.46 },
+    { -0.1412816, -0.6154505, 0.7754097, 6.46 },
+    { 0.2930485, 0.4570260, 0.8397915, 6.46 },
+    { 0.1306729, -0.5101093, 0.8501253, 6.46 },
+    { -0.4624555, -0.2419243, 0.8529992, 6.46 },
+    { -0.4315771, -0.2716914, 0.8601890, 6.46 },
+    { 0.2952642, 0.4027380, 0.8663839, 6.46 },
+    { -0.4310741, 0.0399516, 0.9014316, 6.46 },
+    { -0.2187567, 0.1587711, 0.9627758, 6.46 },
+    { 0.0157599, 0.0068395, 0.9998524, 6.46 },
+    { -0.0105642, 0.0508137, -0.9986523, 6.47 },
+    { 0.1387513, -0.1032872, -0.9849263, 6.47 },
+    { -0.1766424, -0.1201755, -0.9769111, 6.47 },
+    { -0.1028896, 0.3460471, -0.9325584, 6.47 },
+    { 0.3837754, -0.0847387, -0.9195302, 6.47 },
+    { 0.0275802, -0.4423783, -0.8964044, 6.47 },
+    { -0.3835086, 0.4621503, -0.7995863, 6.47 },
+    { -0.5651501, -0.2764520, -0.7772899, 6.47 },
+    { -0.1915069, -0.6129577, -0.7665559, 6.47 },
+    { 0.7391694, -0.1409038, -0.6586158, 6.47 },
+    { -0.5234645, 0.5523650, -0.6487510, 6.47 },
+    { -0.4802433, 0.5972488, -0.6423864, 6.47 },
+    { -0.5599757, -0.5562336, -0.6140289, 6.47 },
+    { 0.7795433, -0.1995479, -0.5937111, 6.47 },
+    { -0.1314711, -0.7991977, -0.5865137, 6.47 },
+    { -0.3405280, -0.7643461, -0.5475543, 6.47 },
+    { 0.7588071, -0.4188912, -0.4987403, 6.47 },
+    { 0.8222164, -0.3043721, -0.4809552, 6.47 },
+    { -0.8125730, -0.3430556, -0.4712090, 6.47 },
+    { -0.6074061, -0.6822869, -0.4068691, 6.47 },
+    { 0.6888370, 0.6158202, -0.3824514, 6.47 },
+    { -0.6297562, 0.6887752, -0.3591599, 6.47 },
+    { 0.9359363, 0.0683545, -0.3454720, 6.47 },
+    { 0.2001041, -0.9263955, -0.3189823, 6.47 },
+    { -0.4385864, -0.8417991, -0.3146685, 6.47 },
+    { 0.9401923, 0.1899809, -0.2827465, 6.47 },
+    { 0.1604625, -0.9569154, -0.2420014, 6.47 },
+    { -0.8319851, -0.5249943, -0.1793927, 6.47 },
+    { -0.8169712, -0.5615412, -0.1312616, 6.47 },
+    { 0.5219292, -0.8500187, -0.0711198, 6.47 },
+    { -0.0465786, -0.9983283, 0.0342212, 6.47 },
+    { -0.4384676, 0.8977669, 0.0419628, 6.47 },
+    { -0.5265205, 0.7940935, 0.3036308, 6.47 },
+    { 0.7426465, -0.5466922, 0.3867865, 6.47 },
+    { 0.9014896, 0.1473015, 0.4069630, 6.47 },
+    { 0.8096292, -0.3732370, 0.4529841, 6.47 },
+    { 0.3104058, 0.8356958, 0.4530572, 6.47 },
+    { -0.1122570, 0.8841637, 0.4534898, 6.47 },
+    { 0.7078982, 0.4960126, 0.5028435, 6.47 },
+    { 0.1502157, -0.8078323, 0.5699494, 6.47 },
+    { 0.5319232, -0.6151357, 0.5819499, 6.47 },
+    { 0.6737324, -0.4369490, 0.5959532, 6.47 },
+    { 0.6173509, -0.5007904, 0.6067016, 6.47 },
+    { -0.7020741, -0.2852142, 0.6524912, 6.47 },
+    { 0.0083489, 0.6556187, 0.7550460, 6.47 },
+    { 0.2703636, -0.5936373, 0.7579566, 6.47 },
+    { 0.6057492, 0.1688628, 0.7775302, 6.47 },
+    { -0.4817707, 0.3276667, 0.8127309, 6.47 },
+    { 0.4996147, -0.0053230, 0.8662314, 6.47 },
+    { -0.1494563, 0.3725827, 0.9158848, 6.47 },
+    { -0.0200211, -0.0256993, -0.9994692, 6.48 },
+    { -0.1977017, -0.0851917, -0.9765533, 6.48 },
+    { 0.1123412, -0.4430601, -0.8894252, 6.48 },
+    { -0.2773119, -0.4108160, -0.8685208, 6.48 },
+    { -0.0540532, 0.5190383, -0.8530402, 6.48 },
+    { -0.4831933, 0.2990091, -0.8228717, 6.48 },
+    { -0.6024284, -0.2308636, -0.7640563, 6.48 },
+    { 0.6139664, -0.2040262, -0.7625081, 6.48 },
+    { -0.4790833, 0.4399549, -0.7595517, 6.48 },
+    { 0.7093717, 0.1574642, -0.6870202, 6.48 },
+    { -0.5010516, -0.6051386, -0.6186716, 6.48 },
+    { -0.0931793, 0.7836106, -0.6142248, 6.48 },
+    { -0.6138715, 0.4982271, -0.6123166, 6.48 },
+    { -0.0839702, -0.7895377, -0.6079303, 6.48 },
+    { 0.2852490, -0.7680542, -0.5733461, 6.48 },
+    { -0.5274900, 0.6427780, -0.5555094, 6.48 },
+    { 0.8194433, -0.2334246, -0.5234746, 6.48 },
+    { -0.8621775, 0.0479705, -0.5043300, 6.48 },
+    { -0.8880503, 0.0363729, -0.4583053, 6.48 },
+    { -0.7176536, -0.5300422, -0.4516952, 6.48 },
+    { 0.7692878, 0.4881107, -0.4122429, 6.48 },
+    { 0.1436003, -0.9234743, -0.3557726, 6.48 },
+    { 0.4584266, -0.8522204, -0.2521219, 6.48 },
+    { 0.7186824, -0.6488764, -0.2499101, 6.48 },
+    { -0.2798403, 0.9357472, -0.2146312, 6.48 },
+    { -0.5715323, -0.8062215, -0.1528325, 6.48 },
+    { -0.3835616, -0.9126261, -0.1414004, 6.48 },
+    { 0.4451259, -0.8940541, -0.0503019, 6.48 },
+    { 0.7562979, -0.6536255, -0.0280578, 6.48 },
+    { -0.1230133, 0.9918439, 0.0333679, 6.48 },
+    { 0.3764025, 0.9091649, 0.1781582, 6.48 },
+    { -0.7216552, 0.6625903, 0.2004690, 6.48 },
+    { -0.5462476, -0.8036041, 0.2362922, 6.48 },
+    { -0.1106284, -0.9602859, 0.2561493, 6.48 },
+    { 0.2824917, -0.9144190, 0.2898903, 6.48 },
+    { -0.8623203, -0.3977100, 0.3134175, 6.48 },
+    { 0.3887924, -0.8502580, 0.3548264, 6.48 },
+    { 0.5017011, -0.7879441, 0.3569875, 6.48 },
+    { 0.5817564, -0.7302763, 0.3581285, 6.48 },
+    { 0.4561843, -0.8145492, 0.3583372, 6.48 },
+    { -0.6968545, 0.6185786, 0.3629797, 6.48 },
+    { -0.8956363, -0.0745587, 0.4384936, 6.48 },
+    { -0.2555773, 0.8436275, 0.4721999, 6.48 },
+    { 0.0971272, 0.8349257, 0.5417245, 6.48 },
+    { 0.4476157, -0.6606909, 0.6026007, 6.48 },
+    { -0.1825175, 0.7609716, 0.6225829, 6.48 },
+    { 0.6344894, -0.4055064, 0.6580180, 6.48 },
+    { -0.0034522, -0.7011981, 0.7129582, 6.48 },
+    { 0.6892723, -0.1279508, 0.7131145, 6.48 },
+    { 0.4985357, -0.4864652, 0.7175052, 6.48 },
+    { 0.5042346, 0.4345977, 0.7462388, 6.48 },
+    { -0.5764954, -0.2618644, 0.7740026, 6.48 },
+    { 0.2442239, -0.5116334, 0.8237633, 6.48 },
+    { 0.3575294, -0.4298703, 0.8290864, 6.48 },
+    { 0.4497083, 0.3057984, 0.8391959, 6.48 },
+    { -0.4250987, -0.3389425, 0.8392908, 6.48 },
+    { 0.0646592, 0.5375235, 0.8407661, 6.48 },
+    { -0.3205907, 0.3848874, 0.8654960, 6.48 },
+    { 0.3902968, 0.0590533, 0.9187933, 6.48 },
+    { 0.2428352, 0.0168955, -0.9699204, 6.49 },
+    { -0.2488927, -0.0430378, -0.9675744, 6.49 },
+    { -0.0208637, -0.3046359, -0.9522403, 6.49 },
+    { -0.0121142, -0.4146879, -0.9098830, 6.49 },
+    { -0.4131781, -0.2392421, -0.8786621, 6.49 },
+    { -0.2269634, -0.4804965, -0.8471191, 6.49 },
+    { 0.1667130, -0.5379948, -0.8262980, 6.49 },
+    { 0.1179193, 0.6017111, -0.7899612, 6.49 },
+    { -0.0265626, 0.6480700, -0.7611174, 6.49 },
+    { 0.1203103, -0.6569722, -0.7442533, 6.49 },
+    { 0.3716867, 0.5554452, -0.7438613, 6.49 },
+    { -0.2167814, -0.7125986, -0.6672398, 6.49 },
+    { -0.3794307, -0.6569736, -0.6514737, 6.49 },
+    { 0.1969615, -0.7456649, -0.6365453, 6.49 },
+    { -0.4862642, 0.6149906, -0.6207526, 6.49 },
+    { 0.6072216, 0.5023961, -0.6155323, 6.49 },
+    { 0.5360697, -0.6042677, -0.5894827, 6.49 },
+    { -0.6542928, 0.4788838, -0.5852958, 6.49 },
+    { -0.8442836, 0.1938973, -0.4995889, 6.49 },
+    { 0.1428260, 0.8818343, -0.4494095, 6.49 },
+    { 0.7457726, -0.5136660, -0.4242293, 6.49 },
+    { 0.6941424, 0.6182039, -0.3687686, 6.49 },
+    { -0.8844557, 0.3410688, -0.3184497, 6.49 },
+    { 0.9438222, 0.1684468, -0.2842980, 6.49 },
+    { 0.5571375, 0.8048338, -0.2045492, 6.49 },
+    { -0.7905789, -0.5779897, -0.2022693, 6.49 },
+    { -0.2784070, 0.9424780, -0.1849996, 6.49 },
+    { -0.2582107, 0.9527581, -0.1599348, 6.49 },
+    { 0.5351555, -0.8306508, -0.1537136, 6.49 },
+    { 0.4746448, -0.8684386, -0.1432714, 6.49 },
+    { 0.9897679, -0.1236103, -0.0712745, 6.49 },
+    { 0.1664890, -0.9844683, -0.0557102, 6.49 },
+    { 0.9357541, 0.3525659, -0.0078486, 6.49 },
+    { 0.3147431, -0.9442974, 0.0961203, 6.49 },
+    { 0.5882333, 0.8009291, 0.1117778, 6.49 },
+    { -0.8998700, -0.3985554, 0.1771654, 6.49 },
+    { 0.6661762, 0.6939443, 0.2732224, 6.49 },
+    { -0.6660363, -0.6491637, 0.3673992, 6.49 },
+    { 0.0920343, 0.8945353, 0.4374201, 6.49 },
+    { 0.8645562, -0.1689468, 0.4732859, 6.49 },
+    { -0.8773082, -0.0460545, 0.4777125, 6.49 },
+    { -0.7892898, 0.3829677, 0.4799556, 6.49 },
+    { 0.3781261, -0.7855273, 0.4898648, 6.49 },
+    { 0.5409066, -0.6588435, 0.5228243, 6.49 },
+    { 0.1461469, 0.8161968, 0.5589847, 6.49 },
+    { -0.8010139, 0.0166571, 0.5984139, 6.49 },
+    { -0.1221619, -0.7721032, 0.6236450, 6.49 },
+    { 0.2138858, -0.7188039, 0.6614937, 6.49 },
+    { 0.4637789, -0.5840598, 0.6661706, 6.49 },
+    { -0.5926946, -0.2659423, 0.7602551, 6.49 },
+    { 0.0101443, 0.6182718, 0.7858989, 6.49 },
+    { -0.3416056, 0.4856734, 0.8046285, 6.49 },
+    { -0.2605800, -0.4975611, 0.8273639, 6.49 },
+    { -0.2756015, 0.4651046, 0.8412619, 6.49 },
+    { 0.3047779, 0.3914804, 0.8682474, 6.49 },
+    { 0.0239462, -0.4932184, 0.8695759, 6.49 },
+    { -0.2045582, 0.4082404, 0.8896605, 6.49 },
+    { 0.3033384, 0.1191446, 0.9454049, 6.49 },
+    { 0.0734699, 0.2195948, 0.9728208, 6.49 },
+    { -0.0582259, 0.0855990, 0.9946268, 6.49 },
+    { 0.2708703, -0.5059659, -0.8189187, 6.50 },
+    { 0.4984712, 0.6391150, -0.5857120, 6.50 },
+    { -0.7519308, -0.3380954, -0.5659431, 6.50 },
+    { -0.8264335, -0.0477128, -0.5610091, 6.50 },
+    { 0.5302697, 0.6533301, -0.5403460, 6.50 },
+    { -0.5763019, 0.6156621, -0.5374349, 6.50 },
+    { 0.6761957, -0.5232686, -0.5186033, 6.50 },
+    { 0.5868259, -0.6678523, -0.4578304, 6.50 },
+    { -0.3750657, 0.8094120, -0.4518604, 6.50 },
+    { 0.1126923, -0.8871685, -0.4474734, 6.50 },
+    { -0.8511673, -0.2751376, -0.4470051, 6.50 },
+    { -0.8322821, 0.3815831, -0.4021205, 6.50 },
+    { -0.7311825, -0.5860225, -0.3492131, 6.50 },
+    { 0.0879936, 0.9817482, -0.1686045, 6.50 },
+    { -0.5715325, -0.8062106, -0.1528891, 6.50 },
+    { -0.3774039, -0.9167668, -0.1307857, 6.50 },
+    { 0.8175949, 0.5707865, -0.0757725, 6.50 },
+    { -0.5781187, 0.8154735, -0.0279599, 6.50 },
+    { 0.7161879, -0.6977209, -0.0161383, 6.50 },
+    { -0.9881296, 0.1443499, 0.0525645, 6.50 },
+    { 0.2745265, 0.9569647, 0.0940943, 6.50 },
+    { -0.6911352, -0.7163594, 0.0957155, 6.50 },
+    { -0.7856633, 0.5274464, 0.3233165, 6.50 },
+    { 0.0018988, -0.9426058, 0.3339024, 6.50 },
+    { 0.0133364, -0.9418863, 0.3356671, 6.50 },
+    { 0.2385727, -0.9101672, 0.3386426, 6.50 },
+    { 0.3976615, -0.8482257, 0.3498264, 6.50 },
+    { 0.1248092, -0.9263608, 0.3553567, 6.50 },
+    { 0.5391093, 0.7628337, 0.3569957, 6.50 },
+    { 0.7038174, 0.5750856, 0.4170344, 6.50 },
+    { -0.4030603, -0.7975360, 0.4488637, 6.50 },
+    { 0.8778317, 0.1403433, 0.4579468, 6.50 },
+    { -0.6167102, 0.5747479, 0.5378973, 6.50 },
+    { -0.8286958, 0.0001693, 0.5596992, 6.50 },
+    { -0.4988993, -0.6189289, 0.6066519, 6.50 },
+    { 0.3217722, -0.7147810, 0.6209274, 6.50 },
+    { 0.6941756, -0.1254023, 0.7087979, 6.50 },
+    { 0.6789804, -0.1801135, 0.7117196, 6.50 },
+    { 0.3922078, -0.5604682, 0.7294165, 6.50 },
+    { -0.5938914, 0.1152611, 0.7962461, 6.50 },
+    { 0.1099678, 0.5833392, 0.8047499, 6.50 },
+    { 0.5524819, -0.1410056, 0.8215115, 6.50 },
+    { -0.5028506, -0.2485788, 0.8278586, 6.50 },
+    { 0.1665970, 0.4790857, 0.8618134, 6.50 },
+    { -0.2869289, -0.3661972, 0.8851957, 6.50 },
+    { 0.0924048, 0.4493810, 0.8885483, 6.50 },
+    { -0.4186196, -0.1648951, 0.8930662, 6.50 },
+    { -0.0935330, 0.3164559, 0.9439848, 6.50 },
+    { -0.2108858, 0.1770639, 0.9613405, 6.50 },
+    { 0.0303127, 0.1439323, -0.9891232, 6.51 },
+    { -0.0556005, 0.3077571, -0.9498390, 6.51 },
+    { -0.2422695, -0.3343442, -0.9107796, 6.51 },
+    { -0.4109257, -0.2075248, -0.8877351, 6.51 },
+    { -0.0652950, 0.6009736, -0.7965973, 6.51 },
+    { 0.3102004, 0.5387024, -0.7833106, 6.51 },
+    { -0.0216570, 0.7056458, -0.7082337, 6.51 },
+    { 0.6056630, 0.5432475, -0.5814246, 6.51 },
+    { -0.7479120, -0.4134730, -0.5192954, 6.51 },
+    { 0.8501484, -0.1854524, -0.4928033, 6.51 },
+    { 0.0457032, -0.8742590, -0.4833036, 6.51 },
+    { -0.4863675, -0.7363082, -0.4704220, 6.51 },
+    { 0.5763156, -0.6831858, -0.4484612, 6.51 },
+    { -0.8282022, 0.3394306, -0.4459461, 6.51 },
+    { 0.0734795, -0.8987985, -0.4321596, 6.51 },
+    { 0.7173746, 0.5516056, -0.4255643, 6.51 },
+    { 0.1369478, -0.9016178, -0.4102812, 6.51 },
+    { -0.5555953, 0.7333088, -0.3918827, 6.51 },
+    { -0.8398526, 0.3845146, -0.3831398, 6.51 },
+    { -0.8639947, 0.3977129, -0.3087680, 6.51 },
+    { 0.4789115, -0.8699960, -0.1172634, 6.51 },
+    { -0.6329134, 0.7654801, -0.1160207, 6.51 },
+    { -0.5906757, -0.8007840, -0.0992329, 6.51 },
+    { -0.8948383, -0.4359836, -0.0958264, 6.51 },
+    { -0.5021384, 0.8633247, -0.0502739, 6.51 },
+    { -0.5857727, -0.8104161, -0.0098033, 6.51 },
+    { -0.1121474, 0.9929003, 0.0396469, 6.51 },
+    { -0.9188624, -0.3804174, 0.1047594, 6.51 },
+    { -0.1774532, -0.9784030, 0.1060091, 6.51 },
+    { -0.1748384, 0.9783228, 0.1109780, 6.51 },
+    { 0.4584814, -0.8780045, 0.1374878, 6.51 },
+    { 0.4426813, 0.8832599, 0.1545485, 6.51 },
+    { 0.9279348, -0.3208200, 0.1897671, 6.51 },
+    { 0.9417854, -0.2662395, 0.2053213, 6.51 },
+    { -0.7186620, 0.6454235, 0.2587535, 6.51 },
+    { 0.1832636, -0.9089918, 0.3743638, 6.51 },
+    { -0.5696200, 0.5773354, 0.5849931, 6.51 },
+    { 0.5015665, -0.5924384, 0.6304346, 6.51 },
+    { 0.4701410, 0.5866055, 0.6594402, 6.51 },
+    { 0.2274804, -0.5973005, 0.7690805, 6.51 },
+    { -0.4610753, -0.4207922, 0.7812449, 6.51 },
+    { 0.3503315, -0.4798085, 0.8043952, 6.51 },
+    { 0.3669812, 0.4605613, 0.8082129, 6.51 },
+    { 0.4498201, 0.3433441, 0.8244858, 6.51 },
+    { 0.5608529, -0.0372391, 0.8270776, 6.51 },
+    { -0.0767125, -0.5145494, 0.8540223, 6.51 },
+    { 0.2084831, -0.4459912, 0.8704175, 6.51 },
+    { -0.2370352, -0.2699655, 0.9332379, 6.51 },
+    { 0.0086928, 0.0702898, 0.9974887, 6.51 },
+    { -0.2126666, -0.2263583, -0.9505445, 6.52 },
+    { -0.4730273, 0.2715274, -0.8381635, 6.52 },
+    { -0.5389283, 0.2922540, -0.7900278, 6.52 },
+    { 0.0162030, 0.6377306, -0.7700891, 6.52 },
+    { -0.2889400, 0.6707366, -0.6831003, 6.52 },
+    { -0.1679128, 0.7178488, -0.6756467, 6.52 },
+    { 0.1817850, 0.7912844, -0.5838006, 6.52 },
+    { 0.8450012, -0.0847520, -0.5280057, 6.52 },
+    { 0.8164479, 0.2668169, -0.5120758, 6.52 },
+    { 0.6590353, 0.5532005, -0.5095504, 6.52 },
+    { -0.4745243, 0.7253783, -0.4986512, 6.52 },
+    { -0.1615447, -0.9296806, -0.3310547, 6.52 },
+    { -0.0168646, -0.9464867, -0.3223020, 6.52 },
+    { -0.0530427, 0.9508477, -0.3050822, 6.52 },
+    { -0.9158365, 0.3460970, -0.2036180, 6.52 },
+    { 0.0824425, 0.9800805, -0.1806803, 6.52 },
+    { 0.3612307, -0.9285813, -0.0851421, 6.52 },
+    { -0.8815291, -0.4023478, 0.2470277, 6.52 },
+    { -0.2375917, -0.9384913, 0.2505677, 6.52 },
+    { -0.2821142, -0.9239314, 0.2583840, 6.52 },
+    { 0.6442213, -0.6992564, 0.3098699, 6.52 },
+    { 0.2557249, -0.8961213, 0.3627277, 6.52 },
+    { -0.8015041, 0.3815612, 0.4604369, 6.52 },
+    { -0.5063577, -0.7026637, 0.4998656, 6.52 },
+    { 0.8444879, -0.0043481, 0.5355570, 6.52 },
+    { 0.1889614, 0.7873104, 0.5868867, 6.52 },
+    { -0.0478785, -0.7769733, 0.6277102, 6.52 },
+    { 0.0157560, -0.7649368, 0.6439126, 6.52 },
+    { 0.1406043, -0.6762303, 0.7231480, 6.52 },
+    { -0.0528185, 0.6872871, 0.7244630, 6.52 },
+    { -0.5498108, 0.4056265, 0.7301884, 6.52 },
+    { 0.6553064, 0.0575821, 0.7531652, 6.52 },
+    { 0.2599712, -0.5843737, 0.7687147, 6.52 },
+    { 0.5576515, 0.1140933, 0.8221968, 6.52 },
+    { 0.1474209, -0.4063130, 0.9017632, 6.52 },
+    { 0.3602195, 0.2178739, 0.9070683, 6.52 },
+    { 0.0888522, -0.3382225, 0.9368622, 6.52 },
+    { -0.1541827, 0.0591633, 0.9862694, 6.52 },
+    { 0.0158184, 0.2969172, -0.9547722, 6.53 },
+    { -0.0589486, -0.3361423, -0.9399646, 6.53 },
+    { 0.1757969, 0.4850042, -0.8566600, 6.53 },
+    { 0.2593901, -0.4633561, -0.8473594, 6.53 },
+    { -0.3440000, 0.4587615, -0.8192691, 6.53 },
+    { -0.4626739, 0.6235981, -0.6301256, 6.53 },
+    { 0.6429867, 0.4633458, -0.6098186, 6.53 },
+    { -0.7220534, -0.3715565, -0.5835963, 6.53 },
+    { 0.4582587, -0.6765803, -0.5764010, 6.53 },
+    { 0.4367529, -0.7159715, -0.5446390, 6.53 },
+    { 0.0986809, 0.8617091, -0.4977142, 6.53 },
+    { -0.7362885, 0.5321928, -0.4179116, 6.53 },
+    { -0.6788131, 0.6199330, -0.3935680, 6.53 },
+    { -0.2410260, 0.8944975, -0.3765378, 6.53 },
+    { -0.8329683, -0.4362763, -0.3403335, 6.53 },
+    { -0.4002382, 0.8818257, -0.2493848, 6.53 },
+    { -0.8685900, 0.4581413, -0.1888331, 6.53 },
+    { -0.7625903, 0.6239044, -0.1708783, 6.53 },
+    { -0.4752691, -0.8729887, -0.1095902, 6.53 },
+    { 0.2810294, -0.9593360, -0.0264004, 6.53 },
+    { -0.4564944, 0.8865129, 0.0755497, 6.53 },
+    { 0.4733678, -0.8775167, 0.0767297, 6.53 },
+    { 0.4139605, 0.8960655, 0.1603224, 6.53 },
+    { -0.6275056, 0.7606378, 0.1663333, 6.53 },
+    { -0.4494180, -0.8772470, 0.1687044, 6.53 },
+    { -0.7420302, 0.6157346, 0.2650700, 6.53 },
+    { -0.8998080, -0.2949647, 0.3214675, 6.53 },
+    { 0.1039995, -0.8892675, 0.4454071, 6.53 },
+    { 0.3175026, -0.8231141, 0.4708241, 6.53 },
+    { -0.7057334, 0.5255355, 0.4751346, 6.53 },
+    { 0.4165325, 0.7074965, 0.5709198, 6.53 },
+    { 0.3727859, -0.7258951, 0.5780198, 6.53 },
+    { 0.7887315, -0.0688427, 0.6108709, 6.53 },
+    { -0.2154729, -0.5630498, 0.7978386, 6.53 },
+    { -0.4729715, -0.3278981, 0.8177902, 6.53 },
+    { -0.2014175, 0.5326962, 0.8219889, 6.53 },
+    { -0.4855463, -0.1361910, 0.8635374, 6.53 },
+    { 0.4615780, -0.0887881, 0.8826451, 6.53 },
+    { 0.0366564, -0.1077855, 0.9934982, 6.53 },
+    { -0.2212030, -0.3572689, -0.9074294, 6.54 },
+    { 0.1305997, -0.6280906, -0.7671023, 6.54 },
+    { -0.5943472, 0.4872837, -0.6397703, 6.54 },
+    { -0.3366841, 0.7061359, -0.6229092, 6.54 },
+    { -0.3492981, 0.7077082, -0.6141172, 6.54 },
+    { -0.7761426, -0.2332422, -0.5858334, 6.54 },
+    { -0.6886155, -0.4750300, -0.5478642, 6.54 },
+    { -0.1680939, 0.8442948, -0.5088328, 6.54 },
+    { -0.7508408, 0.4212589, -0.5087034, 6.54 },
+    { -0.8422608, 0.1948119, -0.5026382, 6.54 },
+    { -0.0514991, 0.8697237, -0.4908446, 6.54 },
+    { -0.1871639, -0.8848421, -0.4266428, 6.54 },
+    { -0.9158997, -0.0631752, -0.3964047, 6.54 },
+    { 0.1674972, 0.9333598, -0.3174651, 6.54 },
+    { 0.0722535, -0.9457707, -0.3166972, 6.54 },
+    { -0.7758110, 0.6102664, -0.1602880, 6.54 },
+    { 0.1029413, 0.9898065, -0.0984186, 6.54 },
+    { -0.9944960, -0.0789672, -0.0688617, 6.54 },
+    { -0.9076962, 0.4077294, 0.0992189, 6.54 },
+    { 0.4230366, 0.8909966, 0.1648186, 6.54 },
+    { 0.4628156, -0.8680525, 0.1796846, 6.54 },
+    { 0.9372133, -0.2975792, 0.1818732, 6.54 },
+    { -0.0890362, 0.9749657, 0.2037509, 6.54 },
+    { -0.5297591, 0.8128943, 0.2419878, 6.54 },
+    { 0.9137092, 0.1938531, 0.3571506, 6.54 },
+    { -0.3440730, 0.8642130, 0.3670826, 6.54 },
+    { -0.3630856, 0.8467018, 0.3889279, 6.54 },
+    { 0.8989556, -0.0181117, 0.4376651, 6.54 },
+    { -0.8900597, -0.1117904, 0.4419238, 6.54 },
+    { 0.2887158, -0.8390862, 0.4610613, 6.54 },
+    { -0.8381797, -0.2489566, 0.4852582, 6.54 },
+    { 0.5967222, -0.5417162, 0.5920018, 6.54 },
+    { 0.7545498, -0.1989674, 0.6253531, 6.54 },
+    { -0.3038752, 0.7165081, 0.6279140, 6.54 },
+    { 0.5933881, 0.4863177, 0.6413935, 6.54 },
+    { 0.6097483, -0.4025252, 0.6827741, 6.54 },
+    { 0.6894440, -0.0036847, 0.7243296, 6.54 },
+    { -0.6884894, 0.0147379, 0.7250967, 6.54 },
+    { 0.1165870, 0.6724269, 0.7309237, 6.54 },
+    { 0.3370834, -0.5437040, 0.7686096, 6.54 },
+    { 0.6042175, 0.1754842, 0.7772558, 6.54 },
+    { 0.0224598, 0.5453635, 0.8378987, 6.54 },
+    { -0.4444706, -0.1397932, 0.8848185, 6.54 },
+    { 0.4386284, 0.1307191, 0.8891106, 6.54 },
+    { 0.3306357, -0.3043503, 0.8933370, 6.54 },
+    { 0.0560626, -0.2169607, 0.9745692, 6.54 },
+    { -0.0315658, 0.1777486, 0.9835695, 6.54 },
+    { 0.2167274, -0.1119711, -0.9697895, 6.55 },
+    { 0.1640196, -0.1925038, -0.9674915, 6.55 },
+    { 0.3329937, 0.2782490, -0.9009399, 6.55 },
+    { -0.1517291, 0.6849267, -0.7126385, 6.55 },
+    { 0.0211440, 0.7319834, -0.6809943, 6.55 },
+    { -0.5015270, 0.5403445, -0.6756467, 6.55 },
+    { -0.4844879, 0.5912353, -0.6447576, 6.55 },
+    { 0.3867940, -0.6858306, -0.6164631, 6.55 },
+    { 0.3310812, 0.7519051, -0.5701087, 6.55 },
+    { -0.6927583, -0.4686132, -0.5481675, 6.55 },
+    { 0.8524523, 0.0866265, -0.5155782, 6.55 },
+    { 0.4742439, 0.7256543, -0.4985163, 6.55 },
+    { -0.3944211, 0.8118124, -0.4305724, 6.55 },
+    { 0.5077506, -0.8331364, -0.2192554, 6.55 },
+    { 0.8190192, 0.5496926, -0.1644556, 6.55 },
+    { -0.3431090, 0.9265293, -0.1543363, 6.55 },
+    { 0.6917402, -0.7217486, -0.0239664, 6.55 },
+    { -0.4013609, 0.9146853, 0.0475423, 6.55 },
+    { -0.1559528, 0.9846470, 0.0784156, 6.55 },
+    { -0.0378924, 0.9878465, 0.1507432, 6.55 },
+    { 0.2156571, -0.9577255, 0.1904045, 6.55 },
+    { -0.9753196, 0.1104045, 0.1912135, 6.55 },
+    { -0.9454873, 0.2547366, 0.2028865, 6.55 },
+    { 0.8528254, 0.4279401, 0.2992591, 6.55 },
+    { -0.8565423, 0.4165229, 0.3047031, 6.55 },
+    { 0.5696188, -0.7467059, 0.3434598, 6.55 },
+    { 0.7560942, 0.5156428, 0.4030311, 6.55 },
+    { -0.2258539, -0.8602922, 0.4570419, 6.55 },
+    { 0.1240647, 0.8111652, 0.5715059, 6.55 },
+    { 0.0856598, 0.7369099, 0.6705417, 6.55 },
+    { 0.5760753, -0.1960559, 0.7935360, 6.55 },
+    { -0.2357632, 0.2084882, 0.9491830, 6.55 },
+    { 0.2146136, -0.0075320, 0.9766700, 6.55 },
+    { -0.3426297, 0.2487406, -0.9059432, 6.56 },
+    { 0.3125654, 0.2975177, -0.9021009, 6.56 },
+    { 0.6481737, -0.2145878, -0.7306318, 6.56 },
+    { 0.2414458, -0.7703740, -0.5901083, 6.56 },
+    { -0.3626739, 0.7700381, -0.5248895, 6.56 },
+    { 0.6858380, -0.5766952, -0.4439020, 6.56 },
+    { -0.3380800, 0.8508720, -0.4021427, 6.56 },
+    { -0.5609775, 0.7474586, -0.3558229, 6.56 },
+    { -0.4324319, 0.8328829, -0.3454110, 6.56 },
+    { 0.1790508, 0.9386542, -0.2947358, 6.56 },
+    { -0.8198919, -0.4986646, -0.2812665, 6.56 },
+    { 0.1609405, 0.9578906, -0.2377895, 6.56 },
+    { 0.1069618, 0.9911718, -0.0783426, 6.56 },
+    { 0.2888118, -0.9573204, 0.0111994, 6.56 },
+    { -0.5907885, -0.8063006, 0.0291235, 6.56 },
+    { -0.0671201, -0.9967298, 0.0449949, 6.56 },
+    { 0.6125850, -0.7708622, 0.1746741, 6.56 },
+    { -0.9764183, 0.1038183, 0.1892859, 6.56 },
+    { 0.9776216, 0.0894365, 0.1904130, 6.56 },
+    { -0.9506985, -0.2031108, 0.2343466, 6.56 },
+    { -0.9378905, -0.1447944, 0.3152713, 6.56 },
+    { -0.0479909, 0.9267988, 0.3724794, 6.56 },
+    { -0.5065201, 0.7674845, 0.3929440, 6.56 },
+    { 0.5022065, -0.7610808, 0.4105420, 6.56 },
+    { 0.6058492, -0.6363535, 0.4774945, 6.56 },
+    { 0.0560737, -0.8710578, 0.4879693, 6.56 },
+    { -0.1006454, -0.8202336, 0.5631050, 6.56 },
+    { 0.7496620, -0.3115490, 0.5839042, 6.56 },
+    { 0.6943771, -0.1596560, 0.7016769, 6.56 },
+    { -0.0820473, 0.6718162, 0.7361598, 6.56 },
+    { -0.6536255, 0.0826590, 0.7522907, 6.56 },
+    { -0.1767451, -0.6174696, 0.7664806, 6.56 },
+    { 0.0859662, -0.6080230, 0.7892514, 6.56 },
+    { 0.4289894, -0.0331090, 0.9027026, 6.56 },
+    { 0.0277031, 0.2064453, 0.9780659, 6.56 },
+    { -0.0821581, 0.1477783, 0.9856022, 6.56 },
+    { 0.0195423, -0.0065884, -0.9997873, 6.57 },
+    { -0.0081042, -0.0416812, -0.9990981, 6.57 },
+    { -0.0374083, -0.1116287, -0.9930456, 6.57 },
+    { -0.1338852, 0.5710281, -0.8099393, 6.57 },
+    { -0.1207095, 0.6008872, -0.7901669, 6.57 },
+    { -0.2795879, 0.5789043, -0.7659637, 6.57 },
+    { -0.3431716, 0.6841280, -0.6435854, 6.57 },
+    { -0.4487616, -0.6323148, -0.6314990, 6.57 },
+    { 0.2454241, -0.7535118, -0.6099074, 6.57 },
+    { 0.1665401, 0.7768127, -0.6073107, 6.57 },
+    { 0.8398100, 0.1098741, -0.5316454, 6.57 },
+    { -0.0996687, -0.9215224, -0.3753167, 6.57 },
+    { -0.8422899, 0.4073602, -0.3529950, 6.57 },
+    { 0.7494444, -0.5751044, -0.3280062, 6.57 },
+    { 0.8791371, -0.3796626, -0.2880523, 6.57 },
+    { -0.2752691, -0.9393938, -0.2043679, 6.57 },
+    { -0.9181442, 0.3511102, -0.1836649, 6.57 },
+    { 0.0235948, 0.9972065, -0.0708688, 6.57 },
+    { 0.6942722, -0.7170268, -0.0621179, 6.57 },
+    { 0.1498737, 0.9886595, -0.0094978, 6.57 },
+    { -0.2769564, 0.9605314, 0.0259729, 6.57 },
+    { 0.1675545, 0.9833771, 0.0699635, 6.57 },
+    { -0.1680305, 0.9823696, 0.0819491, 6.57 },
+    { -0.0734318, 0.9897124, 0.1227893, 6.57 },
+    { -0.5987850, -0.7868945, 0.1491763, 6.57 },
+    { -0.1293004, 0.9791077, 0.1569377, 6.57 },
+    { -0.2081604, -0.9539732, 0.2158806, 6.57 },
+    { 0.5860440, 0.7437481, 0.3215451, 6.57 },
+    { 0.1398006, -0.9263883, 0.3496578, 6.57 },
+    { -0.5827594, 0.6548404, 0.4812230, 6.57 },
+    { 0.4160844, -0.7575724, 0.5029491, 6.57 },
+    { 0.8235041, -0.2108591, 0.5266682, 6.57 },
+    { 0.4540168, 0.6983026, 0.5533915, 6.57 },
+    { 0.3637049, -0.7404762, 0.5651670, 6.57 },
+    { 0.4567237, -0.6534506, 0.6036603, 6.57 },
+    { 0.7050861, -0.0547275, 0.7070067, 6.57 },
+    { 0.1994486, -0.6130827, 0.7644278, 6.57 },
+    { 0.5079938, -0.2182859, 0.8332428, 6.57 },
+    { 0.2179705, -0.3687944, 0.9035926, 6.57 },
+    { 0.1692469, 0.2312610, 0.9580573, 6.57 },
+    { -0.2130669, -0.0934336, 0.9725598, 6.57 },
+    { 0.1748625, -0.1619268, -0.9711863, 6.58 },
+    { -0.3703707, 0.2197938, -0.9025055, 6.58 },
+    { -0.5088693, -0.1230305, -0.8520068, 6.58 },
+    { -0.0138352, 0.6630166, -0.7484769, 6.58 },
+    { -0.1363651, 0.7743855, -0.6178444, 6.58 },
+    { -0.2971701, 0.7320250, -0.6130492, 6.58 },
+    { 0.0327937, -0.8013917, -0.5972403, 6.58 },
+    { 0.7698184, 0.3138502, -0.5557677, 6.58 },
+    { 0.2921458, -0.7979286, -0.5272199, 6.58 },
+    { -0.2878418, -0.8393822, -0.4610690, 6.58 },
+    { 0.9272167, 0.3694140, 0.0616636, 6.58 },
+    { -0.0560040, 0.9456635, 0.3202874, 6.58 },
+    { -0.5907280, 0.7339094, 0.3352871, 6.58 },
+    { 0.3175744, -0.8868493, 0.3356260, 6.58 },
+    { 0.8317158, -0.0018623, 0.5551985, 6.58 },
+    { 0.8317158, -0.0018623, 0.5551985, 6.58 },
+    { 0.6159733, -0.5015563, 0.6074687, 6.58 },
+    { -0.4230376, 0.6554205, 0.6256701, 6.58 },
+    { 0.1980095, 0.7440025, 0.6381633, 6.58 },
+    { 0.0469956, 0.7588706, 0.6495435, 6.58 },
+    { 0.4477607, -0.5365370, 0.7152890, 6.58 },
+    { 0.6889538, -0.0664090, 0.7217565, 6.58 },
+    { 0.5081876, -0.4081366, 0.7583995, 6.58 },
+    { -0.5053386, -0.3385555, 0.7937336, 6.58 },
+    { 0.2465286, 0.1115389, 0.9626956, 6.58 },
+    { -0.1014816, -0.1312820, 0.9861372, 6.58 },
+    { -0.2982230, -0.1390795, -0.9443092, 6.59 },
+    { 0.4560295, -0.0204194, -0.8897304, 6.59 },
+    { 0.3151371, -0.3389890, -0.8864395, 6.59 },
+    { 0.0620718, 0.4604547, -0.8855103, 6.59 },
+    { 0.3254017, 0.6156494, -0.7176973, 6.59 },
+    { 0.3454539, 0.6457451, -0.6809368, 6.59 },
+    { -0.2106413, -0.7148551, -0.6667926, 6.59 },
+    { -0.3189394, 0.6965987, -0.6426725, 6.59 },
+    { -0.8202607, 0.1926170, -0.5385825, 6.59 },
+    { -0.2756441, 0.8433133, -0.4613491, 6.59 },
+    { 0.1155712, -0.8969930, -0.4266696, 6.59 },
+    { -0.8288743, -0.3932025, -0.3979437, 6.59 },
+    { 0.5357596, 0.7749856, -0.3351999, 6.59 },
+    { -0.2554710, -0.9321373, -0.2566216, 6.59 },
+    { 0.8379703, -0.5155228, -0.1790030, 6.59 },
+    { 0.9073432, 0.3900990, -0.1566878, 6.59 },
+    { -0.5955806, 0.7955004, -0.1116371, 6.59 },
+    { 0.0572789, -0.9959040, -0.0699601, 6.59 },
+    { -0.9594093, -0.2746842, -0.0638932, 6.59 },
+    { 0.1133424, 0.9932522, 0.0245684, 6.59 },
+    { -0.7010811, 0.7125738, 0.0269044, 6.59 },
+    { -0.0099664, 0.9995131, 0.0295684, 6.59 },
+    { -0.2656342, 0.9591974, 0.0968446, 6.59 },
+    { -0.2550601, -0.9601036, 0.1146530, 6.59 },
+    { -0.1238722, 0.9737149, 0.1911412, 6.59 },
+    { 0.0233348, 0.9787229, 0.2038553, 6.59 },
+    { -0.0742306, 0.9672047, 0.2429092, 6.59 },
+    { -0.9229728, 0.0722877, 0.3780154, 6.59 },
+    { 0.0724057, 0.9154050, 0.3959685, 6.59 },
+    { 0.1931526, -0.8851357, 0.4233519, 6.59 },
+    { 0.1245627, -0.8490435, 0.5134289, 6.59 },
+    { -0.2230684, 0.8141885, 0.5360388, 6.59 },
+    { -0.5730433, -0.5913778, 0.5673568, 6.59 },
+    { -0.0612735, -0.7231337, 0.6879849, 6.59 },
+    { 0.4625737, -0.2687296, 0.8448728, 6.59 },
+    { 0.0565022, -0.4118499, 0.9094983, 6.59 },
+    { -0.2806351, -0.0932640, 0.9552726, 6.59 },
+    { 0.1185439, -0.0018303, 0.9929471, 6.59 },
+    { -0.1283228, 0.0710377, -0.9891850, 6.60 },
+    { -0.2100151, 0.5741909, -0.7913270, 6.60 },
+    { -0.3342289, -0.5393625, -0.7729031, 6.60 },
+    { 0.1519058, -0.6262490, -0.7646809, 6.60 },
+    { -0.0577674, 0.6569274, -0.7517375, 6.60 },
+    { -0.5804107, -0.4622304, -0.6704227, 6.60 },
+    { -0.1517272, -0.7535295, -0.6396656, 6.60 },
+    { -0.3377213, 0.7432364, -0.5775327, 6.60 },
+    { 0.3250432, -0.7823587, -0.5312832, 6.60 },
+    { -0.2709822, 0.8124104, -0.5162925, 6.60 },
+    { -0.3093402, 0.8068601, -0.5032747, 6.60 },
+    { 0.9093086, -0.0750910, -0.4092910, 6.60 },
+    { -0.5239625, 0.7702414, -0.3635814, 6.60 },
+    { -0.0975133, 0.9359013, -0.3384966, 6.60 },
+    { -0.6991054, -0.6883483, -0.1934639, 6.60 },
+    { 0.0166925, 0.9704667, 0.2406568, 6.60 },
+    { 0.8912799, -0.1733892, 0.4189943, 6.60 },
+    { 0.2118350, 0.8597114, 0.4647819, 6.60 },
+    { 0.8279186, -0.2190998, 0.5162809, 6.60 },
+    { 0.2823617, -0.7857614, 0.5503188, 6.60 },
+    { 0.7070307, 0.2848811, 0.6472637, 6.60 },
+    { 0.4510408, -0.5728020, 0.6844414, 6.60 },
+    { 0.1935919, -0.4928591, 0.8482995, 6.60 },
+    { 0.3545205, 0.2487335, 0.9013583, 6.60 },
+    { 0.3190140, -0.1271957, 0.9391759, 6.60 },
+    { 0.0053309, 0.0753454, 0.9971432, 6.60 },
+    { -0.3515888, 0.6069691, -0.7127229, 6.61 },
+    { -0.7010542, -0.0338222, -0.7123055, 6.61 },
+    { 0.0398106, 0.7576295, -0.6514697, 6.61 },
+    { 0.3261964, -0.7001020, -0.6351796, 6.61 },
+    { -0.3156236, 0.7461577, -0.5861999, 6.61 },
+    { 0.7785781, 0.2322584, -0.5829856, 6.61 },
+    { 0.0350564, -0.9021109, -0.4300778, 6.61 },
+    { -0.3185245, 0.8647130, -0.3883472, 6.61 },
+    { -0.2288671, 0.8971153, -0.3778942, 6.61 },
+    { 0.2037682, -0.9034247, -0.3772298, 6.61 },
+    { -0.4048314, -0.8391151, -0.3633145, 6.61 },
+    { -0.7567493, -0.5573980, -0.3415231, 6.61 },
+    { 0.7726127, -0.6023745, -0.2005360, 6.61 },
+    { 0.3772265, -0.9179663, -0.1226296, 6.61 },
+    { -0.9504295, 0.3029172, -0.0701777, 6.61 },
+    { -0.6975991, -0.7145340, -0.0528830, 6.61 },
+    { 0.2842015, 0.9583733, 0.0273876, 6.61 },
+    { 0.3096979, -0.7156111, 0.6260894, 6.61 },
+    { 0.6312782, 0.2186254, 0.7441040, 6.61 },
+    { 0.6225409, -0.2078971, -0.7544678, 6.62 },
+    { 0.6336255, -0.2863204, -0.7187067, 6.62 },
+    { -0.1539294, 0.7556618, -0.6366168, 6.62 },
+    { 0.1753429, -0.8027336, -0.5699768, 6.62 },
+    { -0.2575678, 0.8557816, -0.4486610, 6.62 },
+    { -0.8681746, -0.2184798, -0.4455777, 6.62 },
+    { -0.5399572, 0.7172526, -0.4404485, 6.62 },
+    { 0.2284577, -0.8779786, -0.4206668, 6.62 },
+    { -0.7499503, 0.6317312, -0.1961891, 6.62 },
+    { -0.0555070, 0.9975017, -0.0436959, 6.62 },
+    { -0.9394452, -0.3366090, 0.0643199, 6.62 },
+    { 0.4062764, -0.8090363, 0.4247350, 6.62 },
+    { 0.8818036, -0.1476820, 0.4478978, 6.62 },
+    { 0.2022410, 0.8205157, 0.5346519, 6.62 },
+    { -0.7621207, 0.0091680, 0.6473701, 6.62 },
+    { 0.1238949, 0.7033309, 0.6999826, 6.62 },
+    { 0.1925518, -0.1640653, -0.9674742, 6.63 },
+    { -0.2450843, -0.0981568, -0.9645201, 6.63 },
+    { 0.0109041, 0.4306535, -0.9024515, 6.63 },
+    { 0.0992248, -0.7724317, -0.6272988, 6.63 },
+    { 0.1958944, -0.8369272, -0.5110560, 6.63 },
+    { -0.3510060, -0.7945224, -0.4955088, 6.63 },
+    { -0.6381656, 0.7536527, -0.1573289, 6.63 },
+    { 0.5715893, -0.8130240, -0.1108045, 6.63 },
+    { 0.0016212, 0.9996809, -0.0252067, 6.63 },
+    { 0.0744451, -0.9970706, 0.0175537, 6.63 },
+    { -0.0712809, 0.9972781, 0.0188538, 6.63 },
+    { -0.2649950, 0.9605846, 0.0839928, 6.63 },
+    { 0.0331747, -0.9735250, 0.2261602, 6.63 },
+    { 0.2303490, -0.9227671, 0.3089340, 6.63 },
+    { 0.0725750, -0.9155974, 0.3954925, 6.63 },
+    { 0.6044442, -0.4948126, 0.6243459, 6.63 },
+    { 0.6297468, 0.4394060, 0.6405789, 6.63 },
+    { -0.6035868, -0.4525896, 0.6563883, 6.63 },
+    { 0.5166937, -0.4735586, 0.7132810, 6.63 },
+    { 0.4368791, -0.4515537, 0.7779691, 6.63 },
+    { -0.5629051, 0.1177465, 0.8180915, 6.63 },
+    { 0.2883131, 0.0133988, -0.9574424, 6.64 },
+    { -0.0206675, 0.3132649, -0.9494409, 6.64 },
+    { -0.4463839, -0.4349359, -0.7820308, 6.64 },
+    { 0.5800809, 0.2757058, -0.7664806, 6.64 },
+    { 0.5220918, -0.5121186, -0.6820225, 6.64 },
+    { -0.0686204, 0.9948428, 0.0746935, 6.64 },
+    { 0.3428842, -0.9033991, 0.2574888, 6.64 },
+    { -0.6616234, 0.6888407, 0.2962313, 6.64 },
+    { 0.3893178, -0.8286403, 0.4022274, 6.64 },
+    { 0.1833217, -0.8314908, 0.5244198, 6.64 },
+    { 0.5687628, -0.2094330, -0.7953909, 6.65 },
+    { -0.1193007, 0.6626861, -0.7393338, 6.65 },
+    { -0.1799721, -0.6780316, -0.7126593, 6.65 },
+    { -0.1262629, -0.7054185, -0.6974542, 6.65 },
+    { -0.3626524, -0.6861844, -0.6305825, 6.65 },
+    { -0.3065177, 0.7335918, -0.6065394, 6.65 },
+    { -0.6446461, 0.5052855, -0.5736880, 6.65 },
+    { 0.5628343, 0.6485424, -0.5124551, 6.65 },
+    { -0.4609703, 0.7298055, -0.5048666, 6.65 },
+    { -0.3597603, 0.8226760, -0.4402008, 6.65 },
+    { -0.2701324, 0.8723647, -0.4074412, 6.65 },
+    { 0.0923403, 0.9946983, -0.0452618, 6.65 },
+    { -0.2040359, -0.9789441, 0.0061416, 6.65 },
+    { -0.3286663, 0.9372538, 0.1163346, 6.65 },
+    { -0.1347687, 0.9695738, 0.2043627, 6.65 },
+    { -0.8924985, -0.1125239, 0.4367891, 6.65 },
+    { -0.7268238, -0.3827049, 0.5703194, 6.65 },
+    { 0.8136953, -0.0984319, 0.5728971, 6.65 },
+    { 0.1972786, -0.7322032, 0.6518892, 6.65 },
+    { -0.4962206, -0.5098741, 0.7027045, 6.65 },
+    { -0.5816928, 0.1764181, 0.7940467, 6.65 },
+    { -0.0264707, 0.1346018, 0.9905461, 6.65 },
+    { 0.1572029, 0.8046732, -0.5725279, 6.66 },
+    { -0.0330253, -0.8604886, -0.5083982, 6.66 },
+    { -0.0293813, 0.9806044, -0.1937825, 6.66 },
+    { 0.1663860, -0.9858693, -0.0194296, 6.66 },
+    { -0.1101598, 0.9935686, 0.0261963, 6.66 },
+    { -0.9074786, 0.4181942, 0.0399521, 6.66 },
+    { 0.2559257, 0.9646367, 0.0630712, 6.66 },
+    { -0.9620941, 0.1767943, 0.2076504, 6.66 },
+    { 0.6763883, -0.6772929, 0.2894360, 6.66 },
+    { -0.3683240, -0.7442657, 0.5571410, 6.66 },
+    { 0.5300137, -0.6185415, 0.5800792, 6.66 },
+    { 0.5069255, -0.5368088, 0.6744352, 6.66 },
+    { 0.6755419, -0.1581308, 0.7201651, 6.66 },
+    { 0.4007040, -0.2298218, 0.8869150, 6.66 },
+    { -0.3963590, -0.1582853, 0.9043480, 6.66 },
+    { -0.2928544, 0.1399305, 0.9458625, 6.66 },
+    { 0.0673838, 0.2713550, 0.9601177, 6.66 },
+    { 0.2110355, -0.1002747, 0.9723215, 6.66 },
+    { -0.0603624, 0.8657651, -0.4967968, 6.67 },
+    { -0.6203769, -0.6525698, -0.4350692, 6.67 },
+    { -0.5649163, 0.7436544, -0.3575581, 6.67 },
+    { -0.9170370, 0.2995870, -0.2632314, 6.67 },
+    { -0.6863695, 0.7139093, -0.1386738, 6.67 },
+    { -0.1014899, 0.9914748, -0.0817158, 6.67 },
+    { 0.2092261, 0.9778260, 0.0089830, 6.67 },
+    { -0.9570333, 0.1861880, 0.2223091, 6.67 },
+    { 0.8774220, 0.1255599, 0.4629961, 6.67 },
+    { -0.6248387, 0.5042931, 0.5960411, 6.67 },
+    { 0.2677365, -0.6108970, 0.7450651, 6.67 },
+    { -0.7898635, 0.1474022, -0.5953052, 6.68 },
+    { -0.3136450, 0.7440408, -0.5899408, 6.68 },
+    { 0.1310357, -0.9356752, -0.3276302, 6.68 },
+    { -0.9115364, -0.3916819, -0.1252467, 6.68 },
+    { 0.9668519, -0.2412656, -0.0835962, 6.68 },
+    { -0.9446352, -0.3272239, -0.0242684, 6.68 },
+    { 0.3995799, -0.8960696, 0.1933782, 6.68 },
+    { -0.6293593, -0.7034356, 0.3302806, 6.68 },
+    { 0.6828290, -0.6227814, 0.3819528, 6.68 },
+    { 0.2861081, -0.8077969, 0.5153701, 6.68 },
+    { -0.0473114, -0.7721433, 0.6336847, 6.68 },
+    { -0.0288037, -0.6633770, 0.7477308, 6.68 },
+    { 0.2100766, -0.7698481, -0.6026622, 6.69 },
+    { -0.4893233, 0.6348652, -0.5979205, 6.69 },
+    { 0.8168325, 0.1439016, -0.5586385, 6.69 },
+    { 0.0248316, 0.9415056, -0.3360813, 6.69 },
+    { 0.1305638, -0.9889020, 0.0708934, 6.69 },
+    { 0.2473158, -0.9013014, 0.3556553, 6.69 },
+    { 0.8325968, -0.1326463, 0.5377616, 6.69 },
+    { -0.1988764, -0.7903465, 0.5794831, 6.69 },
+    { 0.7613461, 0.1788876, 0.6231784, 6.69 },
+    { -0.5166220, -0.3402022, 0.7857253, 6.69 },
+    { -0.6284795, 0.4454894, -0.6376149, 6.70 },
+    { 0.0245900, 0.7819412, -0.6228671, 6.70 },
+    { -0.4507162, 0.6545106, -0.6070180, 6.70 },
+    { -0.5391353, 0.7060532, -0.4591535, 6.70 },
+    { -0.7900260, 0.4393165, -0.4276213, 6.70 },
+    { 0.8231865, 0.3787678, -0.4229645, 6.70 },
+    { 0.3563558, -0.8999373, -0.2512435, 6.70 },
+    { 0.3234312, 0.9338137, -0.1529188, 6.70 },
+    { 0.1071407, 0.9898001, -0.0938964, 6.70 },
+    { -0.8639007, 0.5001899, 0.0590397, 6.70 },
+    { -0.3780441, -0.8673179, 0.3237936, 6.70 },
+    { 0.7340696, -0.5508963, 0.3970580, 6.70 },
+    { 0.5227320, -0.5490585, 0.6521396, 6.70 },
+    { 0.7181800, 0.1023619, 0.6882874, 6.70 },
+    { 0.5905346, 0.4041841, 0.6985013, 6.70 },
+    { 0.7040937, 0.0158700, 0.7099297, 6.70 },
+    { -0.1417063, 0.0384907, -0.9891601, 6.71 },
+    { 0.3230744, 0.6376889, -0.6992680, 6.71 },
+    { 0.7469417, -0.2434704, -0.6187086, 6.71 },
+    { -0.2831324, -0.8568010, -0.4309618, 6.71 },
+    { -0.1174309, 0.9929726, 0.0146743, 6.71 },
+    { 0.0273397, 0.9374952, 0.3469225, 6.71 },
+    { -0.0940944, 0.8634575, 0.4955677, 6.71 },
+    { 0.4104719, -0.6180439, 0.6704734, 6.71 },
+    { 0.4370087, 0.2085595, 0.8749436, 6.71 },
+    { -0.2303497, 0.4429073, -0.8664711, 6.72 },
+    { 0.2206808, 0.6849077, -0.6944072, 6.72 },
+    { 0.2501891, 0.8654281, -0.4340963, 6.72 },
+    { -0.3970517, 0.8601033, -0.3202690, 6.72 },
+    { 0.5107415, -0.8498486, -0.1300018, 6.72 },
+    { -0.1032184, 0.9914264, 0.0801226, 6.72 },
+    { 0.2405551, -0.8736028, 0.4230264, 6.72 },
+    { 0.7359033, 0.2131272, 0.6426688, 6.72 },
+    { 0.7444381, -0.1159664, 0.6575437, 6.72 },
+    { -0.2684940, 0.4821565, 0.8339281, 6.72 },
+    { 0.2136249, -0.0676820, -0.9745684, 6.73 },
+    { 0.0207024, -0.3290171, -0.9440970, 6.73 },
+    { -0.4567405, 0.4287398, -0.7794680, 6.73 },
+    { -0.5217453, 0.6996765, -0.4880928, 6.73 },
+    { 0.1072409, 0.9897903, -0.0938858, 6.73 },
+    { 0.2759184, -0.9594236, 0.0580974, 6.73 },
+    { 0.2980311, -0.9094996, 0.2898068, 6.73 },
+    { 0.8023616, 0.2817759, 0.5261352, 6.73 },
+    { 0.7900534, 0.0443092, 0.6114346, 6.73 },
+    { -0.6469033, 0.6293781, -0.4305802, 6.74 },
+    { 0.0121881, -0.9223342, -0.3862008, 6.74 },
+    { 0.5766003, -0.7522882, -0.3187392, 6.74 },
+    { 0.1090728, -0.9900748, 0.0886282, 6.74 },
+    { 0.2443433, -0.7860279, 0.5678525, 6.74 },
+    { -0.3611648, -0.4974125, 0.7887591, 6.74 },
+    { 0.4302246, 0.4335791, 0.7917803, 6.74 },
+    { 0.5416442, 0.0248205, 0.8402413, 6.74 },
+    { 0.4782858, -0.1205916, 0.8698852, 6.74 },
+    { 0.2435756, 0.3304131, -0.9118652, 6.75 },
+    { -0.4821281, -0.1073267, -0.8695019, 6.75 },
+    { 0.0561907, 0.5139021, -0.8560065, 6.75 },
+    { 0.1162291, 0.8571609, -0.5017628, 6.75 },
+    { 0.2028286, -0.9226772, -0.3279137, 6.75 },
+    { -0.0753225, 0.9796393, -0.1861006, 6.75 },
+    { 0.2518358, -0.9516191, 0.1760678, 6.75 },
+    { 0.1994396, -0.6131125, 0.7644062, 6.75 },
+    { 0.0508458, 0.1126742, -0.9923302, 6.76 },
+    { -0.3058042, 0.7035101, -0.6415274, 6.76 },
+    { -0.3758617, 0.7994424, -0.4686362, 6.76 },
+    { 0.0120405, -0.9955569, -0.0933891, 6.76 },
+    { -0.3655886, 0.9274084, -0.0791116, 6.76 },
+    { -0.6188414, 0.4522058, 0.6422969, 6.76 },
+    { -0.5212289, 0.3887951, 0.7597097, 6.76 },
+    { -0.4776877, 0.0034534, 0.8785229, 6.76 },
+    { 0.1860276, -0.0831281, 0.9790217, 6.76 },
+    { 0.1940427, 0.0142639, -0.9808894, 6.77 },
+    { 0.3608647, 0.2859153, -0.8877101, 6.77 },
+    { -0.8532567, 0.2023101, -0.4806491, 6.77 },
+    { 0.7321788, 0.5614307, -0.3856292, 6.77 },
+    { 0.7369527, -0.6504069, -0.1840424, 6.77 },
+    { -0.0456557, -0.5381558, 0.8416079, 6.77 },
+    { -0.3685200, 0.6620669, -0.6525798, 6.78 },
+    { 0.6499937, 0.3675242, 0.6651572, 6.78 },
+    { -0.1995093, 0.6960008, -0.6897673, 6.79 },
+    { -0.7552941, 0.0054763, -0.6553632, 6.79 },
+    { 0.3773789, 0.9078764, 0.1826078, 6.79 },
+    { 0.6344366, -0.1312412, -0.7617519, 6.80 },
+    { -0.1660781, -0.8962594, -0.4112629, 6.80 },
+    { 0.2157871, -0.9667002, -0.1375742, 6.80 },
+    { 0.6241450, 0.6545308, 0.4266525, 6.80 },
+    { -0.5884692, -0.2383401, 0.7725917, 6.80 },
+    { -0.6395453, 0.4303111, -0.6370354, 6.82 },
+    { 0.1255779, 0.7851055, -0.6064977, 6.82 },
+    { -0.6530867, 0.5444363, -0.5263714, 6.82 },
+    { 0.3234660, 0.9338088, -0.1528756, 6.82 },
+    { 0.3851966, -0.7827223, 0.4888450, 6.82 },
+    { -0.0334067, 0.6589835, 0.7514151, 6.82 },
+    { 0.8489371, -0.0174980, -0.5282041, 6.83 },
+    { -0.6063464, 0.7767165, 0.1704570, 6.83 },
+    { 0.4925597, 0.7852836, 0.3751194, 6.83 },
+    { 0.5411766, 0.2489225, -0.8032220, 6.84 },
+    { -0.2876602, 0.7417442, -0.6058607, 6.84 },
+    { 0.0773271, -0.9445003, -0.3192800, 6.84 },
+    { -0.6559349, -0.2894209, 0.6971262, 6.84 },
+    { 0.6864022, 0.1841034, 0.7035325, 6.84 },
+    { 0.2859594, 0.0487258, -0.9570021, 6.85 },
+    { 0.5190076, 0.4562597, -0.7228127, 6.85 },
+    { 0.1218318, 0.9925384, -0.0049635, 6.85 },
+    { 0.4304706, 0.6797993, -0.5937743, 6.86 },
+    { 0.2636359, 0.7859507, -0.5592652, 6.86 },
+    { -0.8018230, -0.5792340, 0.1468600, 6.86 },
+    { -0.6407715, -0.4442223, 0.6261616, 6.86 },
+    { -0.5112088, 0.1112007, -0.8522323, 6.88 },
+    { 0.3676614, -0.0202524, -0.9297392, 6.89 },
+    { -0.3386319, 0.7011430, -0.6274766, 6.89 },
+    { -0.4296486, 0.8666764, -0.2535235, 6.89 },
+    { 0.7909160, -0.4927656, 0.3628139, 6.89 },
+    { -0.2899142, 0.8609261, 0.4180384, 6.89 },
+    { 0.7044228, 0.1622026, -0.6909984, 6.90 },
+    { 0.7258302, 0.6531573, -0.2157684, 6.90 },
+    { 0.2759639, -0.9560498, -0.0990592, 6.90 },
+    { -0.2142224, 0.8885960, -0.4055932, 6.91 },
+    { -0.6863662, 0.7139152, -0.1386599, 6.91 },
+    { -0.0550974, 0.8056078, 0.5898817, 6.92 },
+    { 0.3664449, -0.5639353, 0.7400642, 6.92 },
+    { -0.4296688, -0.3373527, -0.8376025, 6.93 },
+    { -0.3387046, -0.9380283, 0.0733634, 6.93 },
+    { 0.4380283, 0.8924508, 0.1079941, 6.93 },
+    { -0.0229291, 0.9118633, -0.4098532, 6.95 },
+    { 0.0585074, 0.9336435, 0.3533932, 6.95 },
+    { -0.2876584, 0.7417540, -0.6058496, 6.97 },
+    { 0.1624285, 0.7943660, -0.5853202, 6.98 },
+    { 0.1070090, -0.0629001, 0.9922664, 6.98 },
+    { -0.9944919, -0.0789304, -0.0689623, 6.99 },
+    { 0.2182778, 0.4098806, 0.8856369, 6.99 },
+    { -0.6753007, 0.5146423, -0.5283107, 7.00 },
+    { -0.5440155, -0.7295316, -0.4145247, 7.00 },
+    { 0.6241450, 0.6545308, 0.4266525, 7.00 },
+    { 0.8644209, 0.1911627, 0.4650090, 7.00 },
+    { 0.4564973, 0.8202747, -0.3446152, 7.01 },
+    { -0.5432322, 0.7297107, 0.4152362, 7.02 },
+    { -0.4917987, -0.6133713, -0.6179885, 7.03 },
+    { 0.2560186, 0.9646130, 0.0630571, 7.03 },
+    { -0.6885863, 0.0144634, 0.7250102, 7.03 },
+    { -0.0522190, 0.6358319, -0.7700591, 7.04 },
+    { -0.0034236, -0.8637997, -0.5038238, 7.04 },
+    { -0.1926516, 0.8672045, -0.4591751, 7.04 },
+    { 0.0244170, -0.9778287, 0.2079781, 7.04 },
+    { -0.3965266, -0.1585559, 0.9042271, 7.04 },
+    { -0.3625991, -0.6860607, -0.6307477, 7.05 },
+    { 0.7260696, -0.6186898, -0.3000764, 7.05 },
+    { -0.1302686, 0.0527311, -0.9900755, 7.07 },
+    { -0.9785988, -0.1659568, 0.1216668, 7.08 },
+    { 0.7039299, 0.5749385, 0.4170472, 7.09 },
+    { 0.7568616, -0.4226194, -0.4985512, 7.10 },
+    { 0.9673320, 0.0089553, -0.2533546, 7.10 },
+    { 0.8644191, 0.1911893, 0.4650013, 7.10 },
+    { 0.6011650, -0.7748997, 0.1952720, 7.11 },
+    { -0.7019563, -0.5316312, 0.4739469, 7.12 },
+    { -0.3211612, 0.7864094, -0.5276511, 7.13 },
+    { -0.5495222, 0.8103823, 0.2032383, 7.13 },
+    { -0.8869467, -0.0802828, 0.4548408, 7.13 },
+    { 0.3837400, -0.8555737, 0.3474726, 7.14 },
+    { 0.0261639, -0.1134077, -0.9932040, 7.16 },
+    { -0.1095398, 0.2478862, -0.9625765, 7.16 },
+    { 0.1349686, 0.5661755, 0.8131597, 7.24 },
+    { -0.4626951, 0.6235698, -0.6301380, 7.25 },
+    { 0.9554787, 0.2823766, 0.0855802, 7.25 },
+    { -0.6246322, 0.7723563, 0.1153272, 7.25 },
+    { -0.1095414, 0.2478855, -0.9625765, 7.26 },
+    { 0.1763395, -0.7311563, 0.6590257, 7.30 },
+    { 0.2940200, 0.0057888, -0.9557818, 7.31 },
+    { 0.7158593, -0.6908336, -0.1014610, 7.31 },
+    { 0.2698240, -0.2482611, 0.9303555, 7.33 },
+    { -0.4719016, -0.5219509, -0.7105464, 7.39 },
+    { 0.7774743, 0.0818296, 0.6235685, 7.39 },
+    { 0.4250270, -0.0461508, -0.9040034, 7.40 },
+    { -0.6856370, -0.3529490, 0.6366545, 7.40 },
+    { -0.1211908, -0.6354549, 0.7625680, 7.48 },
+    { -0.7020357, -0.5315484, 0.4739221, 7.62 },
+    { -0.2672401, 0.8829577, 0.3859642, 7.68 },
+    { 0.2518212, 0.9334257, -0.2555437, 7.71 },
+    { -0.5432438, 0.7296920, 0.4152539, 7.81 },
+    { 0.2961081, 0.1022497, 0.9496657, 7.83 },
+    { 0.1072275, 0.9897949, -0.0938530, 7.96 }, };
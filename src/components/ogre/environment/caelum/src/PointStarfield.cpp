@@ -43,6 +43,8 @@ namespace Caelum
 		mObserverLatitude = 45;
 		mObserverLongitude = 0;
         mObserverPositionRebuildDelta = DEFAULT_OBSERVER_POSITION_REBUILD_DELTA;
+        mValidGeometry = false;
+        updateObserverOrientation ();
 
         String uniqueSuffix = "/" + InternalUtilities::pointerToString(this);
 
@@ -102,15 +104,8 @@ namespace Caelum
 				pos.z = randReal(-1, 1);
 			} while (pos.squaredLength () >= 1);
 
-			// Convert to rasc/decl angles.
-			LongReal rasc, decl, dist;
-			Astronomy::convertRectangularToSpherical(
-					pos.x, pos.y, pos.z,
-					rasc, decl, dist);
-
 			Star s;
-			s.RightAscension = Ogre::Degree (rasc);
-			s.Declination = Ogre::Degree (decl);
+			s.Direction = pos.normalisedCopy ();
 			// This distribution is wrong.
 			s.Magnitude = 6 * pos.squaredLength () + 1.5;
 			mStars.push_back(s);
@@ -120,14 +115,7 @@ namespace Caelum
 
 	void PointStarfield::addStar (const BrightStarCatalogueEntry &entry) {
 		Star s;
-		s.RightAscension = Ogre::Degree(360 / 24.0f * (
-				Math::Abs(entry.rasc_hour) +
-				entry.rasc_min / 60.0f +
-				entry.rasc_sec / 3600.0f));
-		s.Declination = Ogre::Degree(Math::Sign(entry.decl_deg) * (
-				Math::Abs(entry.decl_deg) +
-				entry.decl_min / 60.0f +
-				entry.decl_sec / 3600.0f));
+		s.Direction = Ogre::Vector3(entry.x, entry.y, entry.z);
 		s.Magnitude = entry.magn;
 		mStars.push_back(s);
 
@@ -135,24 +123,11 @@ namespace Caelum
 	}
 
 	void PointStarfield::addBrightStarCatalogue (int count) {
-		assert(count >= 0);
-		if (count < BrightStarCatalogueSize) {
-			// Only sort if we don't add everything.
-			// It would be lovely if the catalogue was already sorted.
-			std::vector<std::pair<Real, int>> vec;
-			vec.reserve(BrightStarCatalogueSize);
-			for (int i = 0; i < BrightStarCatalogueSize; ++i) {
-				vec.push_back(std::make_pair(BrightStarCatalogue[i].magn, i));
-			}
-			sort(vec.begin(), vec.end());
-			for (int i = 0; i < count; ++i) {
-				addStar(BrightStarCatalogue[vec[i].second]);
-			}
-		} else {
-			assert(count == BrightStarCatalogueSize);
-			for (int i = 0; i < BrightStarCatalogueSize; ++i) {
-				addStar(BrightStarCatalogue[i]);
-			}
+		assert(count >= 0 && count <= BrightStarCatalogueSize);
+		// The catalogue is sorted by magnitude, so the brightest stars come first.
+		mStars.reserve(mStars.size() + count);
+		for (int i = 0; i < count; ++i) {
+			addStar(BrightStarCatalogue[i]);
 		}
         notifyStarVectorChanged ();
 	}
@@ -172,25 +147,17 @@ namespace Caelum
         size_t starCount = mStars.size();
 
         mManualObj->clear();
-        mManualObj->estimateVertexCount(6 * starCount);
+        mManualObj->estimateVertexCount(4 * starCount);
+        mManualObj->estimateIndexCount(6 * starCount);
         mManualObj->begin(mMaterial->getName (), Ogre::RenderOperation::OT_TRIANGLE_LIST);
         for (uint i = 0; i < starCount; ++i)
         {
             const Star& star = mStars[i];
 
-			// Determine position at J2000
-			LongReal azm, alt;
-			Astronomy::convertEquatorialToHorizontal(
-					Astronomy::J2000,
-					mObserverLatitude.valueDegrees(),
-					mObserverLongitude.valueDegrees(),
-					star.RightAscension.valueDegrees(), star.Declination.valueDegrees(),
-					azm, alt);
-
-    		Ogre::Vector3 pos;
-		    pos.z = -Math::Cos (Ogre::Degree(azm)) * Math::Cos (Ogre::Degree(alt));
-		    pos.x =  Math::Sin (Ogre::Degree(azm)) * Math::Cos (Ogre::Degree(alt));
-		    pos.y = -Math::Sin (Ogre::Degree(alt));
+            // The conversion to the sky of the observer mirrors the
+            // equatorial coordinates; that part is done here, so that the
+            // rest of it is a rotation which can be applied to the node.
+            Ogre::Vector3 pos(star.Direction.x, -star.Direction.y, star.Direction.z);
 
             //mManualObj->colour (Ogre::ColourValue::White);
             mManualObj->position (pos);
@@ -199,13 +166,11 @@ namespace Caelum
             mManualObj->textureCoord (+1, +1, star.Magnitude);
             mManualObj->position (pos);
             mManualObj->textureCoord (-1, -1, star.Magnitude);
-
-            mManualObj->position (pos);
-            mManualObj->textureCoord (-1, -1, star.Magnitude);
-            mManualObj->position (pos);
-            mManualObj->textureCoord (+1, +1, star.Magnitude);
             mManualObj->position (pos);
             mManualObj->textureCoord (-1, +1, star.Magnitude);
+
+            mManualObj->triangle (4 * i, 4 * i + 1, 4 * i + 2);
+            mManualObj->triangle (4 * i + 2, 4 * i + 1, 4 * i + 3);
         }
         mManualObj->end();
 
@@ -257,12 +222,43 @@ namespace Caelum
 	    mNode->setScale (Ogre::Vector3::UNIT_SCALE * radius);
 	}
 
+	Ogre::Vector3 PointStarfield::getObserverDirection (LongReal rasc, LongReal decl) const
+	{
+		// Determine position at J2000
+		LongReal azm, alt;
+		Astronomy::convertEquatorialToHorizontal(
+				Astronomy::J2000,
+				mObserverLatitude.valueDegrees(),
+				mObserverLongitude.valueDegrees(),
+				rasc, decl,
+				azm, alt);
+
+		Ogre::Vector3 pos;
+		pos.z = -Math::Cos (Ogre::Degree(azm)) * Math::Cos (Ogre::Degree(alt));
+		pos.x =  Math::Sin (Ogre::Degree(azm)) * Math::Cos (Ogre::Degree(alt));
+		pos.y = -Math::Sin (Ogre::Degree(alt));
+		return pos;
+	}
+
+	void PointStarfield::updateObserverOrientation ()
+	{
+		// The conversion is linear in the direction of the star, so its
+		// matrix is made up of the converted axes. The y axis is mirrored
+		// in the vertices, see ensureGeometry.
+		Ogre::Matrix3 rotation;
+		rotation.SetColumn (0, getObserverDirection (0, 0));
+		rotation.SetColumn (1, -getObserverDirection (90, 0));
+		rotation.SetColumn (2, getObserverDirection (0, 90));
+		mObserverOrientation = Ogre::Quaternion (rotation);
+		mObserverOrientation.normalise ();
+	}
+
 	void PointStarfield::_update (const float time) {
 		// This is probably wrong.
 		Ogre::Quaternion orientation = Ogre::Quaternion::IDENTITY;
 		orientation = orientation * Ogre::Quaternion (Ogre::Radian (-mObserverLatitude + Ogre::Degree (90)), Ogre::Vector3::UNIT_X);
 		orientation = orientation * Ogre::Quaternion (Ogre::Radian (-time * 2 * Ogre::Math::PI), Ogre::Vector3::UNIT_Y);
-		mNode->setOrientation (orientation);
+		mNode->setOrientation (orientation * mObserverOrientation);
         ensureGeometry ();
 	}
 
@@ -274,7 +270,7 @@ namespace Caelum
                 this->getObserverPositionRebuildDelta ().valueDegrees ()))
         {
 			mObserverLatitude = value;
-			invalidateGeometry ();
+			updateObserverOrientation ();
 		}
 	}
 
@@ -286,7 +282,7 @@ namespace Caelum
                 this->getObserverPositionRebuildDelta ().valueDegrees ()))
         {
 			mObserverLongitude = value;
-			invalidateGeometry ();
+			updateObserverOrientation ();
 		}
 	}
 }
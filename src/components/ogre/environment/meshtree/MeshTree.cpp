@@ -26,11 +26,11 @@ Tree::Tree(const String& name, TParameters *pParameters, uchar u8Season,  int iS
 {
   if (iSeed == -1)
   {
-    srand(time(0));  
+    mRandom.seed(time(0));
   }
   else
   {
-    srand(iSeed);
+    mRandom.seed(iSeed);
   }
     
   mpParameters = pParameters->Clone();
@@ -83,20 +83,100 @@ Real Tree::GetRandomValue(const Real fUpperBound)
   }
   else
   {
-    if (rand()%2 == 1)
+    if (mRandom()%2 == 1)
       iSign = -1;
     
-    return  iSign*(rand()%iPrecision) * fUpperBound / iPrecision;
+    return  iSign*(int)(mRandom()%iPrecision) * fUpperBound / iPrecision;
   }
 }
 
 //---------------------------------------------------------------------------
 
+void Tree::CreateGeometry(TreeGeometry& geometry)
+{
+   geometry.vertices.resize(8 * miTotalVertices);
+   geometry.colours.resize(miTotalVertices);
+
+   // Generate vertex data recurcively
+   if (miTotalVertices > 0)
+   {
+     Real* pVertexArray = &geometry.vertices[0];
+     RGBA* pVertexColorArray = &geometry.colours[0];
+
+     mpTrunk->AddMeshVertices(&pVertexArray, &pVertexColorArray);
+     if (miTotalLeaves > 0)
+       mpTrunk->AddLeavesVertices(&pVertexArray, &pVertexColorArray, 0);
+     if (this->mpParameters->mTreeType == TParameters::Simple)
+       mpTrunk->AddCoordFrameVertices(&pVertexArray, &pVertexColorArray);
+   }
+
+   // Generate face list for the trunk and the stems
+   uint32 u32VertexIndexOffset = 0;
+   geometry.stemIndices.resize(3 * miTotalFaces);
+   if (!geometry.stemIndices.empty())
+   {
+     uint32* pFaceIndexes = &geometry.stemIndices[0];
+     mpTrunk->AddMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
+   }
+
+   // Generate face list for the leaves
+   geometry.leavesIndices.clear();
+   if (miTotalLeaves > 0)
+   {
+     geometry.leavesIndices.resize(3 * miTotalLeavesFaces);
+     uint32* pFaceIndexes = &geometry.leavesIndices[0];
+     mpTrunk->AddLeavesMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
+   }
+
+   // Generate face list for the coordinate frame display
+   geometry.coordFrameIndices.clear();
+   if (this->mpParameters->mTreeType == TParameters::Simple)
+   {
+     geometry.coordFrameIndices.resize(3 * 9 * miTotalCoordFrames);   // 9 faces per coord frames
+     uint32* pFaceIndexes = &geometry.coordFrameIndices[0];
+     mpTrunk->AddCoordFrameMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
+   }
+
+   // TODO: Improve AAB + SphereRadius !!!!!!!!!!!
+   Vector3 vb1, vb2;
+   vb1 = Vector3(-mfMaxX, 0, -mfMaxZ) ;
+   vb2 = Vector3(mfMaxX, mfMaxY, mfMaxZ) ;
+   geometry.bounds = AxisAlignedBox(vb1, vb2);
+   geometry.radius = Math::Sqrt((vb2-vb1).Vector3::dotProduct(vb2-vb1))/2.0;
+}
+
+//---------------------------------------------------------------------------
+
 Ogre::MeshPtr Tree::CreateMesh(const String &name) 
 { 
-	//HACK: implement ManualResourceLoader
-   Ogre::MeshPtr pMesh = MeshManager::getSingleton().createManual(name,"trees"); 
-   SubMesh *pStemsSub, *pLeavesSub, *pCoordFrameSub;
+   TreeGeometry geometry;
+   CreateGeometry(geometry);
+   //HACK: implement ManualResourceLoader
+   return CreateMesh(name, "trees", geometry);
+}
+
+//---------------------------------------------------------------------------
+
+static void CreateIndexSubMesh(Ogre::MeshPtr pMesh, const std::vector<uint32>& indices)
+{
+   SubMesh* pSub = pMesh->createSubMesh(); 
+   pSub->useSharedVertices = true; 
+
+   pSub->indexData->indexCount = indices.size(); 
+   pSub->indexData->indexBuffer = HardwareBufferManager::getSingleton(). 
+         createIndexBuffer(HardwareIndexBuffer::IT_32BIT, 
+         pSub->indexData->indexCount, HardwareBuffer::HBU_STATIC_WRITE_ONLY, true); 
+   if (!indices.empty())
+     pSub->indexData->indexBuffer->writeData(0, indices.size() * sizeof(uint32), &indices[0], true);
+}
+
+//---------------------------------------------------------------------------
+
+Ogre::MeshPtr Tree::CreateMesh(const String &name, const String &group, const TreeGeometry& geometry) 
+{ 
+   // All buffers keep shadow copies, so that the mesh can be read back when
+   // it's serialised or when Lods are generated for it.
+   Ogre::MeshPtr pMesh = MeshManager::getSingleton().createManual(name, group); 
 
    // Set up vertex data 
    // Use a single shared buffer 
@@ -117,117 +197,42 @@ Ogre::MeshPtr Tree::CreateMesh(const String &name)
    vertexDecl->addElement(POSITION_BINDING, currOffset, VET_FLOAT2, VES_TEXTURE_COORDINATES, 0); 
    currOffset += VertexElement::getTypeSize(VET_FLOAT2); 
 
-   // vertex color
-   vertexDecl->addElement(COLOUR_BINDING, currOffset, VET_COLOUR, VES_DIFFUSE);
-   currOffset += VertexElement::getTypeSize(VET_COLOUR); 
+   // vertex color, in a buffer of its own
+   vertexDecl->addElement(COLOUR_BINDING, 0, VET_COLOUR, VES_DIFFUSE);
 
-   vertexData->vertexCount = miTotalVertices; 
+   vertexData->vertexCount = geometry.colours.size(); 
 
    // Allocate vertex buffer 
    HardwareVertexBufferSharedPtr vbuf = 
       HardwareBufferManager::getSingleton(). 
       createVertexBuffer(vertexDecl->getVertexSize(POSITION_BINDING), vertexData->vertexCount, 
-      HardwareBuffer::HBU_STATIC_WRITE_ONLY, false); 
+      HardwareBuffer::HBU_STATIC_WRITE_ONLY, true); 
 
    // Set up the binding (one source only) 
    VertexBufferBinding* binding = vertexData->vertexBufferBinding; 
    binding->setBinding(POSITION_BINDING, vbuf); 
 
-   // Generate vertex data recurcively
-   // Lock the whole buffer 
-   Real* pVertexArray = static_cast<Real*>( vbuf->lock(HardwareBuffer::HBL_DISCARD) ); 
-
    HardwareVertexBufferSharedPtr vcolbuf =
           HardwareBufferManager::getSingleton().
           createVertexBuffer(vertexDecl->getVertexSize(COLOUR_BINDING), vertexData->vertexCount, 
-          HardwareBuffer::HBU_STATIC_WRITE_ONLY, false); 
-        // bind position and diffuses
-        binding->setBinding(COLOUR_BINDING, vcolbuf);
+          HardwareBuffer::HBU_STATIC_WRITE_ONLY, true); 
+   // bind position and diffuses
+   binding->setBinding(COLOUR_BINDING, vcolbuf);
 
-   RGBA* pVertexColorArray = static_cast<RGBA*>( vcolbuf->lock(HardwareBuffer::HBL_DISCARD) );
-   
-   mpTrunk->AddMeshVertices(&pVertexArray, &pVertexColorArray);
-   if (miTotalLeaves > 0)
-     mpTrunk->AddLeavesVertices(&pVertexArray, &pVertexColorArray, 0);
-   if (this->mpParameters->mTreeType == TParameters::Simple)
-     mpTrunk->AddCoordFrameVertices(&pVertexArray, &pVertexColorArray);
-
-   // Unlock 
-   vbuf->unlock(); 
-   vcolbuf->unlock(); 
-   
-   // Generate face list for the trunk and the stems
-   pStemsSub = pMesh->createSubMesh(); 
-   pStemsSub->useSharedVertices = true; 
-
-   pStemsSub->indexData->indexCount = 3 * miTotalFaces; 
-   pStemsSub->indexData->indexBuffer = HardwareBufferManager::getSingleton(). 
-         createIndexBuffer( HardwareIndexBuffer::IT_32BIT /*HardwareIndexBuffer::IT_16BIT */ , 
-         pStemsSub->indexData->indexCount, HardwareBuffer::HBU_STATIC_WRITE_ONLY, false); 
-
- //  int v1, v2, v3; 
-   HardwareIndexBufferSharedPtr ibuf = pStemsSub->indexData->indexBuffer; 
-   // Lock the whole buffer 
-   // unsigned short* pFaceIndexes = static_cast<unsigned short*> ( ibuf->lock(HardwareBuffer::HBL_DISCARD) );
-   unsigned long* pFaceIndexes = static_cast<unsigned long*> ( ibuf->lock(HardwareBuffer::HBL_DISCARD) ); 
-
-   unsigned long u32VertexIndexOffset = 0;
-   mpTrunk->AddMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
-   
-   // Unlock 
-   ibuf->unlock(); 
-   
-   // Generate face list for the leaves
-   if (miTotalLeaves > 0)
+   if (vertexData->vertexCount > 0)
    {
-		pLeavesSub = pMesh->createSubMesh(); 
-		pLeavesSub->useSharedVertices = true; 
-
-		pLeavesSub->indexData->indexCount = 3 * miTotalLeavesFaces; 
-		pLeavesSub->indexData->indexBuffer = HardwareBufferManager::getSingleton(). 
-				createIndexBuffer(HardwareIndexBuffer::IT_32BIT /*HardwareIndexBuffer::IT_16BIT*/, 
-				pLeavesSub->indexData->indexCount, HardwareBuffer::HBU_STATIC_WRITE_ONLY, false); 
-
-		//  int v1, v2, v3; 
-		ibuf = pLeavesSub->indexData->indexBuffer; 
-		// Lock the whole buffer 
-		// pFaceIndexes = static_cast<unsigned short*>( ibuf->lock(HardwareBuffer::HBL_DISCARD) ); 
-		pFaceIndexes = static_cast<unsigned long*>( ibuf->lock(HardwareBuffer::HBL_DISCARD) ); 
-
-		mpTrunk->AddLeavesMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
-
-		// Unlock 
-		ibuf->unlock(); 
+     vbuf->writeData(0, geometry.vertices.size() * sizeof(Real), &geometry.vertices[0], true);
+     vcolbuf->writeData(0, geometry.colours.size() * sizeof(RGBA), &geometry.colours[0], true);
    }
 
+   CreateIndexSubMesh(pMesh, geometry.stemIndices);
+   if (!geometry.leavesIndices.empty())
+     CreateIndexSubMesh(pMesh, geometry.leavesIndices);
+   if (!geometry.coordFrameIndices.empty())
+     CreateIndexSubMesh(pMesh, geometry.coordFrameIndices);
 
-   // Generate face list for the coordinate frame display
-   if (this->mpParameters->mTreeType == TParameters::Simple)
-   {
-     	pCoordFrameSub = pMesh->createSubMesh(); 
-		pCoordFrameSub->useSharedVertices = true; 
-
-		pCoordFrameSub->indexData->indexCount = 3 * 9 * miTotalCoordFrames;   // 9 faces per coord frames
-		pCoordFrameSub->indexData->indexBuffer = HardwareBufferManager::getSingleton(). 
-				createIndexBuffer(HardwareIndexBuffer::IT_32BIT /*HardwareIndexBuffer::IT_16BIT*/, 
-				pCoordFrameSub->indexData->indexCount, HardwareBuffer::HBU_STATIC_WRITE_ONLY, false); 
-
-		ibuf = pCoordFrameSub->indexData->indexBuffer; 
-		// Lock the whole buffer 
-		pFaceIndexes = static_cast<unsigned long*>( ibuf->lock(HardwareBuffer::HBL_DISCARD) ); 
-
-		mpTrunk->AddCoordFrameMeshFaces(&pFaceIndexes, &u32VertexIndexOffset);
-
-		// Unlock 
-		ibuf->unlock(); 
-   }
-
-   // TODO: Improve AAB + SphereRadius !!!!!!!!!!!
-   Vector3 vb1, vb2;
-   vb1 = Vector3(-mfMaxX, 0, -mfMaxZ) ;
-   vb2 = Vector3(mfMaxX, mfMaxY, mfMaxZ) ;
-   pMesh->_setBounds(AxisAlignedBox(vb1, vb2)); 
-   pMesh->_setBoundingSphereRadius(Math::Sqrt((vb2-vb1).Vector3::dotProduct(vb2-vb1))/2.0); 
+   pMesh->_setBounds(geometry.bounds); 
+   pMesh->_setBoundingSphereRadius(geometry.radius); 
 
    return pMesh;
 }
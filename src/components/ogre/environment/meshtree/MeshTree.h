@@ -6,6 +6,9 @@
 #include "TStem.h"
 #include "TParameters.h"
 
+#include <random>
+#include <vector>
+
 #define FLARE_RESOLUTION 10
 
 /*
@@ -30,6 +33,22 @@ namespace Ogre {
 
 //---------------------------------------------------------------------------
 
+// The geometry of a grown tree, kept in system memory. Filling this in
+// doesn't touch any Ogre resources, so it can be done in a background thread;
+// the hardware buffers are then created from it in the main thread.
+struct TreeGeometry
+{
+  std::vector<Real> vertices;     // position, normal and uv; 8 values per vertex
+  std::vector<RGBA> colours;      // one per vertex
+  std::vector<uint32> stemIndices;
+  std::vector<uint32> leavesIndices;
+  std::vector<uint32> coordFrameIndices;
+  AxisAlignedBox bounds;
+  Real radius;
+};
+
+//---------------------------------------------------------------------------
+
 class Tree
 {
   friend class TStem;
@@ -45,6 +64,9 @@ class Tree
     Real mfMaxY;             // occurring in the tree
     Real mfMaxZ;
     uchar mu8Season;
+    // Each tree has its own generator, so that trees can be grown in parallel
+    // and the same seed always results in the same tree.
+    std::minstd_rand mRandom;
 
   protected:
 
@@ -62,7 +84,9 @@ class Tree
 
     void Grow(void);
     Real GetRandomValue(const Real fUpperBound);
-    Ogre::MeshPtr CreateMesh(const String &name); 
+    void CreateGeometry(TreeGeometry& geometry);
+    Ogre::MeshPtr CreateMesh(const String &name);
+    static Ogre::MeshPtr CreateMesh(const String &name, const String &group, const TreeGeometry& geometry);
     inline TParameters* GetParameters(void){return mpParameters;};
     inline Real GetScale(void){return mfScale;};
 };
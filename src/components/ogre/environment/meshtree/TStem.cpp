@@ -948,13 +948,13 @@ void TStem::AddLeavesVertices(Real **pVertexArray, RGBA **pVertexColorArray, con
 
 void TStem::AddCoordFrameVertices(Real **pVertexArray, RGBA **pVertexColorArray)
 {
-   unsigned long i, j, u32NbSections, u32NbVertices, u32NbSubStems;
+   uint32 i, j, u32NbSections, u32NbVertices, u32NbSubStems;
    TStem *pStem;
    TSection *pSection;
    TSectionFrame *pSectionFrame;
    Vector3 currentVertex, currentNormal;
    
-   u32NbSections = (unsigned long)mVectorOfSections.size();
+   u32NbSections = (uint32)mVectorOfSections.size();
    u32NbVertices = gu8CoordFrameVerticesNumber;
 
    for(i=0; i<u32NbSections; i++)
@@ -978,7 +978,7 @@ void TStem::AddCoordFrameVertices(Real **pVertexArray, RGBA **pVertexColorArray)
       }
    }
 
-   u32NbSubStems = (unsigned long)mVectorOfSubStems.size();
+   u32NbSubStems = (uint32)mVectorOfSubStems.size();
    for (i=0; i<u32NbSubStems ; i++)
    {
      pStem = mVectorOfSubStems[i];
@@ -988,18 +988,18 @@ void TStem::AddCoordFrameVertices(Real **pVertexArray, RGBA **pVertexColorArray)
 }
 //---------------------------------------------------------------------------
 
-void TStem::AddMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffset)
+void TStem::AddMeshFaces(uint32** pFaceIndexes, uint32* pIndexOffset)
 {
-  unsigned long i, j, u32NbSections, u32NbVertices, u32NbSubStems, u32Offest;
+  uint32 i, j, u32NbSections, u32NbVertices, u32NbSubStems, u32Offest;
   TStem *pStem;
   TSection *pSection;
 
-  u32NbSections = (unsigned long)mVectorOfSections.size();
+  u32NbSections = (uint32)mVectorOfSections.size();
 
    for(i=0; i<u32NbSections - 1; i++)
    {
      pSection = mVectorOfSections[i];
-	 u32NbVertices = (unsigned long)pSection->size();
+	 u32NbVertices = (uint32)pSection->size();
 	 u32Offest = *pIndexOffset + i*u32NbVertices;
 	 
      for (j=0; j<u32NbVertices; j++)
@@ -1011,7 +1011,7 @@ void TStem::AddMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffs
 
    *pIndexOffset += u32NbVertices * u32NbSections;
 
-   u32NbSubStems = (unsigned long)mVectorOfSubStems.size();
+   u32NbSubStems = (uint32)mVectorOfSubStems.size();
    for (i=0; i<u32NbSubStems ; i++)
    {
      pStem = mVectorOfSubStems[i];
@@ -1020,18 +1020,18 @@ void TStem::AddMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffs
 }
 //---------------------------------------------------------------------------
 
-void TStem::AddLeavesMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffset)
+void TStem::AddLeavesMeshFaces(uint32** pFaceIndexes, uint32* pIndexOffset)
 {
-  unsigned long i, u32NbLeaves, u32NbVertices, u32NbSubStems, u32Offest;
+  uint32 i, u32NbLeaves, u32NbVertices, u32NbSubStems, u32Offest;
   TStem *pStem;
   TLeaf *pLeaf;
 
-  u32NbLeaves = (unsigned long)mVectorOfLeaves.size();
+  u32NbLeaves = (uint32)mVectorOfLeaves.size();
 
    for(i=0; i<u32NbLeaves; i++)
    {
      pLeaf = mVectorOfLeaves[i];
-     u32NbVertices = (unsigned long)pLeaf->size();
+     u32NbVertices = (uint32)pLeaf->size();
 	 // TODO : improve code !!!!!!!!! no need of u32Offest !!
      u32Offest = *pIndexOffset;
 	 
@@ -1043,7 +1043,7 @@ void TStem::AddLeavesMeshFaces(unsigned long** pFaceIndexes, unsigned long* pInd
 	 *pIndexOffset += u32NbVertices;
    }
 
-   u32NbSubStems = (unsigned long)mVectorOfSubStems.size();
+   u32NbSubStems = (uint32)mVectorOfSubStems.size();
    for (i=0; i<u32NbSubStems ; i++)
    {
      pStem = mVectorOfSubStems[i];
@@ -1052,12 +1052,12 @@ void TStem::AddLeavesMeshFaces(unsigned long** pFaceIndexes, unsigned long* pInd
 }
 //---------------------------------------------------------------------------
 
-void TStem::AddCoordFrameMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffset)
+void TStem::AddCoordFrameMeshFaces(uint32** pFaceIndexes, uint32* pIndexOffset)
 {
-  unsigned long i, u32NbSections, u32NbVertices, u32NbSubStems, u32Offest;
+  uint32 i, u32NbSections, u32NbVertices, u32NbSubStems, u32Offest;
   TStem *pStem;
 
-  u32NbSections = (unsigned long)mVectorOfSections.size();
+  u32NbSections = (uint32)mVectorOfSections.size();
   u32NbVertices = TREE_COORDFRAMEVERTICESNUMBER;
 
    for(i=0; i<u32NbSections; i++)
@@ -1079,7 +1079,7 @@ void TStem::AddCoordFrameMeshFaces(unsigned long** pFaceIndexes, unsigned long*
      *pIndexOffset += u32NbVertices;
    }
 
-   u32NbSubStems = (unsigned long)mVectorOfSubStems.size();
+   u32NbSubStems = (uint32)mVectorOfSubStems.size();
    for (i=0; i<u32NbSubStems ; i++)
    {
      pStem = mVectorOfSubStems[i];
@@ -1102,7 +1102,7 @@ void TStem::FillVertex(Real *&p,Real x,Real y,Real z,Real nx,Real ny,Real nz, Re
 } 
 //---------------------------------------------------------------------------
 
-void TStem::FillIndex(unsigned long *&p,unsigned long i1,unsigned long i2,unsigned long i3) 
+void TStem::FillIndex(uint32 *&p,uint32 i1,uint32 i2,uint32 i3) 
 { 
    *p++ = i1; 
    *p++ = i2; 
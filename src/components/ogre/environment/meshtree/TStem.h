@@ -80,8 +80,8 @@ namespace Ogre
     FillVertex(Real *&p, Real x, Real y, Real z, Real nx, Real ny, Real nz,
         Real u, Real v);
     void
-    FillIndex(unsigned long *&p, unsigned long i1, unsigned long i2,
-        unsigned long i3);
+    FillIndex(uint32 *&p, uint32 i1, uint32 i2,
+        uint32 i3);
 
   protected:
 
@@ -121,13 +121,13 @@ namespace Ogre
     void
     AddCoordFrameVertices(Real **pVertexArray, RGBA **pVertexColorArray);
     void
-    AddMeshFaces(unsigned long** pFaceIndexes, unsigned long* pIndexOffset);
+    AddMeshFaces(uint32** pFaceIndexes, uint32* pIndexOffset);
     void
-    AddLeavesMeshFaces(unsigned long** pFaceIndexes,
-        unsigned long* pIndexOffset);
+    AddLeavesMeshFaces(uint32** pFaceIndexes,
+        uint32* pIndexOffset);
     void
-    AddCoordFrameMeshFaces(unsigned long** pFaceIndexes,
-        unsigned long* pIndexOffset);
+    AddCoordFrameMeshFaces(uint32** pFaceIndexes,
+        uint32* pIndexOffset);
 
   };
 
@@ -28,6 +28,7 @@
 #include "../carpenter/Carpenter.h"
 #include "../carpenter/BluePrint.h"
 #include "../model/Model.h"
+#include "../model/SubModel.h"
 #include "JesusPickerObject.h"
 
 #include "services/EmberServices.h"
@@ -40,8 +41,12 @@
 #include <OgreBillboard.h>
 #include <OgreBillboardSet.h>
 #include <OgreSceneManager.h>
+#include <OgreStaticGeometry.h>
+#include <OgreEntity.h>
 #include <OgreMemoryAllocatorConfig.h>
 
+#include <algorithm>
+
 namespace Ember
 {
   namespace OgreView
@@ -143,13 +148,14 @@ namespace Ember
 
     Construction::Construction(Carpenter::BluePrint* bluePrint, Jesus* jesus,
         Ogre::SceneNode* node) :
-        mBlueprint(bluePrint), mBaseNode(node), mJesus(jesus)
+        mBlueprint(bluePrint), mBaseNode(node), mJesus(jesus), mStaticGeometry(0)
     {
 
     }
 
     Construction::~Construction()
     {
+      destroyStaticGeometry();
       for (std::vector<ModelBlock*>::iterator I = mModelBlocks.begin();
           I != mModelBlocks.end(); ++I)
         {
@@ -178,6 +184,11 @@ namespace Ember
             }
         }
 
+      //Without attach point nodes the construction can't be edited, so it can be merged right away.
+      if (!createAttachPointNodes)
+        {
+          buildStaticGeometry();
+        }
     }
 
     ModelBlock*
@@ -185,6 +196,8 @@ namespace Ember
         const Carpenter::BuildingBlock* buildingBlock,
         bool createAttachPointNodes)
     {
+      //The static geometry can't be altered, so the new block would otherwise not be shown
+      destroyStaticGeometry();
       std::string blockSpecName =
           buildingBlock->getBuildingBlockSpec()->getName();
 
@@ -205,6 +218,7 @@ namespace Ember
       bool result = mBlueprint->remove(modelBlock->getBuildingBlock());
       if (result)
         {
+          destroyStaticGeometry();
           std::vector<ModelBlock*>::iterator pos = mModelBlocks.end();
           for (std::vector<ModelBlock*>::iterator I = mModelBlocks.begin();
               I != mModelBlocks.end(); ++I)
@@ -231,6 +245,65 @@ namespace Ember
       return mModelBlocks;
     }
 
+    void
+    Construction::buildStaticGeometry()
+    {
+      destroyStaticGeometry();
+
+      Ogre::AxisAlignedBox bounds;
+      for (std::vector<ModelBlock*>::const_iterator I = mModelBlocks.begin();
+          I != mModelBlocks.end(); ++I)
+        {
+          bounds.merge((*I)->getWorldBoundingBox());
+        }
+      if (!bounds.isFinite())
+        {
+          return;
+        }
+
+      Ogre::SceneManager* sceneManager = mBaseNode->getCreator();
+      mStaticGeometry = sceneManager->createStaticGeometry(
+          std::string("__construction_") + mBlueprint->getName()
+              + "_staticgeometry__" + mBaseNode->getName());
+
+      //Use one region large enough to hold the whole construction, so that each material only gets one batch.
+      //The region dimensions are padded a bit, since entities on the very edge otherwise could be sorted into a neighbouring region.
+      const Ogre::Vector3 size = bounds.getSize();
+      const Ogre::Real extent = std::max(std::max(size.x, size.y), size.z)
+          + 1.0f;
+      mStaticGeometry->setOrigin(bounds.getMinimum() - Ogre::Vector3(0.5f));
+      mStaticGeometry->setRegionDimensions(Ogre::Vector3(extent));
+      mStaticGeometry->setCastShadows(true);
+
+      for (std::vector<ModelBlock*>::const_iterator I = mModelBlocks.begin();
+          I != mModelBlocks.end(); ++I)
+        {
+          (*I)->addToStaticGeometry(*mStaticGeometry);
+        }
+      mStaticGeometry->build();
+
+      for (std::vector<ModelBlock*>::const_iterator I = mModelBlocks.begin();
+          I != mModelBlocks.end(); ++I)
+        {
+          (*I)->setModelVisible(false);
+        }
+    }
+
+    void
+    Construction::destroyStaticGeometry()
+    {
+      if (mStaticGeometry)
+        {
+          mBaseNode->getCreator()->destroyStaticGeometry(mStaticGeometry);
+          mStaticGeometry = 0;
+          for (std::vector<ModelBlock*>::const_iterator I =
+              mModelBlocks.begin(); I != mModelBlocks.end(); ++I)
+            {
+              (*I)->setModelVisible(true);
+            }
+        }
+    }
+
     std::vector<AttachPointNode*>
     ModelBlock::getAttachPointNodes() const
     {
@@ -333,6 +406,57 @@ namespace Ember
 
     }
 
+    void
+    ModelBlock::setModelVisible(bool visible)
+    {
+      if (mModel)
+        {
+          mModel->setVisible(visible);
+        }
+    }
+
+    bool
+    ModelBlock::addToStaticGeometry(Ogre::StaticGeometry& geometry) const
+    {
+      if (!mModel)
+        {
+          return false;
+        }
+      const Ogre::Vector3& position = mModelNode->_getDerivedPosition();
+      const Ogre::Quaternion& orientation =
+          mModelNode->_getDerivedOrientation();
+      const Ogre::Vector3& scale = mModelNode->_getDerivedScale();
+
+      const Model::Model::SubModelSet& submodels = mModel->getSubmodels();
+      for (Model::Model::SubModelSet::const_iterator I = submodels.begin();
+          I != submodels.end(); ++I)
+        {
+          //Only add those entities which are shown, since parts of the model might be hidden
+          Ogre::Entity* entity = (*I)->getEntity();
+          if (entity->getVisible())
+            {
+              geometry.addEntity(entity, position, orientation, scale);
+            }
+        }
+      return true;
+    }
+
+    Ogre::AxisAlignedBox
+    ModelBlock::getWorldBoundingBox() const
+    {
+      Ogre::AxisAlignedBox bounds;
+      if (mModel)
+        {
+          const Model::Model::SubModelSet& submodels = mModel->getSubmodels();
+          for (Model::Model::SubModelSet::const_iterator I = submodels.begin();
+              I != submodels.end(); ++I)
+            {
+              bounds.merge((*I)->getEntity()->getWorldBoundingBox(true));
+            }
+        }
+      return bounds;
+    }
+
     void
     ModelBlock::createAttachPointNodes()
     {
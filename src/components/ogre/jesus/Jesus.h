@@ -31,6 +31,7 @@
 #include "../EmberOgre.h"
 #include <wfmath/vector.h>
 #include <OgreColourValue.h>
+#include <OgreAxisAlignedBox.h>
 #include <OgreController.h>
 
 namespace Carpenter
@@ -215,6 +216,26 @@ public:
 
 	const Model::Model* getModel() const { return mModel;}
 	const Ogre::SceneNode* getNode() const { return mNode;}
+
+	/**
+	 * @brief Shows or hides the model of the block.
+	 * The model is hidden while the block is rendered as part of the static geometry of the construction.
+	 * @param visible True if the model should be shown.
+	 */
+	void setModelVisible(bool visible);
+
+	/**
+	 * @brief Adds the entities of the model to the static geometry, placed where the model currently is.
+	 * @param geometry The static geometry.
+	 * @return True if there was a model to add.
+	 */
+	bool addToStaticGeometry(Ogre::StaticGeometry& geometry) const;
+
+	/**
+	 * @brief Gets the world bounds of the entities of the model.
+	 * @return The bounds, or a null box if there's no model.
+	 */
+	Ogre::AxisAlignedBox getWorldBoundingBox() const;
 protected:
 	const Carpenter::BuildingBlock* mBuildingBlock;
 	Model::Model* mModel;
@@ -254,6 +275,10 @@ public:
 	Carpenter::BluePrint* getBluePrint() const;
 
 
+	/**
+	 *    Creates model blocks for all attached blocks of the blueprint.
+	 * @param createAttachPointNodes Whether to create nodes for the attach points, for editing. If not, the blocks are merged into static geometry.
+	 */
 	void buildFromBluePrint(bool createAttachPointNodes);
 
 
@@ -268,6 +293,20 @@ public:
 
 	bool remove(ModelBlock* modelBlock);
 
+	/**
+	 * @brief Merges all model blocks into one static geometry, replacing the separate models.
+	 *
+	 * The geometry uses a single region covering the whole construction, so it ends up with one batch per material (and vertex format), instead of one per submodel of every block.
+	 * Any previously built static geometry is replaced.
+	 * Since the static geometry can't be altered it's destroyed, and the models shown again, if blocks are added or removed.
+	 */
+	void buildStaticGeometry();
+
+	/**
+	 * @brief Destroys the static geometry, if any, and shows the separate models again.
+	 */
+	void destroyStaticGeometry();
+
 protected:
  	Carpenter::BluePrint* mBlueprint;
 	Ogre::SceneNode* mBaseNode;
@@ -275,6 +314,11 @@ protected:
 
 	std::vector<ModelBlock*> mModelBlocks;
 
+	/**
+	 * @brief The static geometry into which the model blocks are merged, or null if they're rendered separately.
+	 */
+	Ogre::StaticGeometry* mStaticGeometry;
+
 };
 
 inline Jesus* Construction::getJesus() const { return mJesus; }
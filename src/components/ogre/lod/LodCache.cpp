@@ -0,0 +1,291 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "LodCache.h"
+#include "QueuedProgressiveMeshGenerator.h"
+
+#include "framework/LoggingInstance.h"
+#include "framework/ConsoleBackend.h"
+#include "framework/osdir.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+template<>
+Ember::OgreView::Lod::LodCache* Ember::Singleton<Ember::OgreView::Lod::LodCache>::ms_Singleton = 0;
+
+namespace Ember
+{
+namespace OgreView
+{
+namespace Lod
+{
+
+namespace
+{
+/**
+ * @brief The version of the cache; increase this whenever the file format or the Lod generation changes, to make sure that old entries aren't used.
+ */
+const unsigned int CACHE_VERSION = 2;
+
+const char CACHE_MAGIC[8] = { 'E', 'M', 'B', 'E', 'R', 'L', 'O', 'D' };
+
+/**
+ * @brief A 64 bit FNV-1a hash.
+ * This only needs to detect changes, so it doesn't need to be cryptographically strong; just stable between runs.
+ */
+class Hash
+{
+public:
+	Hash() :
+			mValue(14695981039346656037ULL)
+	{
+	}
+
+	void add(const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i) {
+			mValue ^= bytes[i];
+			mValue *= 1099511628211ULL;
+		}
+	}
+
+	template<typename T>
+	void add(const T& value)
+	{
+		add(&value, sizeof(T));
+	}
+
+	std::string str() const
+	{
+		std::stringstream ss;
+		ss << std::hex << std::setw(16) << std::setfill('0') << mValue;
+		return ss.str();
+	}
+
+private:
+	unsigned long long mValue;
+};
+
+template<typename T>
+void write(std::ostream& stream, const T& value)
+{
+	stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read(std::istream& stream, T& value)
+{
+	return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}
+
+LodCache::LodCache(const std::string& directory) :
+		ReportStats("lod_cache_stats", this, "Prints the hit rate of the cache of automatically generated Lods."), mDirectory(directory), mHits(0), mMisses(0), mStores(0)
+{
+	try {
+		oslink::directory osdir(mDirectory);
+		if (!osdir) {
+			oslink::directory::mkdir(mDirectory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for Lod cache." << ex);
+	}
+}
+
+LodCache::~LodCache()
+{
+}
+
+void LodCache::calculateKey(PMGenRequest& request) const
+{
+	Hash hash;
+	hash.add(CACHE_VERSION);
+
+	const LodConfig& config = request.config;
+	//The collapse costs are scaled by the radius.
+	hash.add(config.mesh->getBoundingSphereRadius());
+	hash.add(config.levels.size());
+	for (LodConfig::LodLevelList::const_iterator I = config.levels.begin(); I != config.levels.end(); ++I) {
+		hash.add(I->distance);
+		hash.add(I->reductionMethod);
+		hash.add(I->reductionValue);
+	}
+
+	hash.add(request.sharedVertexBuffer.vertexCount);
+	if (request.sharedVertexBuffer.vertexBuffer) {
+		hash.add(request.sharedVertexBuffer.vertexBuffer, request.sharedVertexBuffer.vertexCount * sizeof(Ogre::Vector3));
+	}
+	hash.add(request.submesh.size());
+	for (std::vector<PMGenRequest::SubmeshInfo>::const_iterator I = request.submesh.begin(); I != request.submesh.end(); ++I) {
+		hash.add(I->useSharedVertexBuffer);
+		hash.add(I->vertexBuffer.vertexCount);
+		if (I->vertexBuffer.vertexBuffer) {
+			hash.add(I->vertexBuffer.vertexBuffer, I->vertexBuffer.vertexCount * sizeof(Ogre::Vector3));
+		}
+		hash.add(I->indexBuffer.indexSize);
+		hash.add(I->indexBuffer.indexCount);
+		if (I->indexBuffer.indexBuffer) {
+			hash.add(I->indexBuffer.indexBuffer, I->indexBuffer.indexCount * I->indexBuffer.indexSize);
+		}
+	}
+	request.cacheKey = hash.str();
+}
+
+std::string LodCache::getPath(const PMGenRequest& request) const
+{
+	return mDirectory + request.cacheKey + ".lodcache";
+}
+
+bool LodCache::load(PMGenRequest& request)
+{
+	const std::string path = getPath(request);
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	if (!file) {
+		mMisses++;
+		return false;
+	}
+
+	//Read everything into temporary structures first, so that the request isn't altered if the file is broken.
+	char magic[sizeof(CACHE_MAGIC)];
+	unsigned int version = 0;
+	unsigned int levelCount = 0;
+	unsigned int submeshCount = 0;
+	file.read(magic, sizeof(magic));
+	bool valid = file && std::equal(magic, magic + sizeof(magic), CACHE_MAGIC) && read(file, version) && version == CACHE_VERSION;
+	valid = valid && read(file, levelCount) && levelCount == request.config.levels.size();
+
+	std::vector<LodLevel> levels(request.config.levels);
+	for (unsigned int i = 0; valid && i < levelCount; ++i) {
+		unsigned long long uniqueVertexCount = 0;
+		unsigned char skipped = 0;
+		valid = read(file, uniqueVertexCount) && read(file, skipped);
+		levels[i].outUniqueVertexCount = static_cast<size_t>(uniqueVertexCount);
+		levels[i].outSkipped = skipped != 0;
+	}
+
+	valid = valid && read(file, submeshCount) && submeshCount == request.submesh.size();
+	std::vector<std::vector<PMGenRequest::IndexBuffer>> buffers(request.submesh.size());
+	for (unsigned int i = 0; valid && i < submeshCount; ++i) {
+		unsigned int bufferCount = 0;
+		valid = read(file, bufferCount) && bufferCount <= levelCount;
+		for (unsigned int j = 0; valid && j < bufferCount; ++j) {
+			unsigned int indexSize = 0;
+			unsigned long long indexCount = 0;
+			valid = read(file, indexSize) && read(file, indexCount) && (indexSize == 2 || indexSize == 4);
+			if (valid) {
+				buffers[i].push_back(PMGenRequest::IndexBuffer());
+				PMGenRequest::IndexBuffer& buffer = buffers[i].back();
+				buffer.indexSize = indexSize;
+				buffer.indexCount = static_cast<size_t>(indexCount);
+				buffer.indexBuffer = new unsigned char[buffer.indexCount * buffer.indexSize];
+				valid = static_cast<bool>(file.read(reinterpret_cast<char*>(buffer.indexBuffer), buffer.indexCount * buffer.indexSize));
+			}
+		}
+	}
+
+	if (!valid) {
+		for (size_t i = 0; i < buffers.size(); ++i) {
+			for (size_t j = 0; j < buffers[i].size(); ++j) {
+				delete[] buffers[i][j].indexBuffer;
+			}
+		}
+		S_LOG_WARNING("Cached Lod " << path << " is invalid; it will be generated again.");
+		mMisses++;
+		return false;
+	}
+
+	request.config.levels = levels;
+	for (size_t i = 0; i < buffers.size(); ++i) {
+		request.submesh[i].genIndexBuffers = buffers[i];
+	}
+	mHits++;
+	return true;
+}
+
+void LodCache::store(const PMGenRequest& request)
+{
+	const std::string path = getPath(request);
+	//Write to a temporary file first, so that a partially written file never is read.
+	const std::string temporaryPath = path + ".tmp";
+	{
+		std::ofstream file(temporaryPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file) {
+			S_LOG_WARNING("Could not write Lod to cache at " << temporaryPath << ".");
+			return;
+		}
+		file.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+		write(file, CACHE_VERSION);
+		write(file, static_cast<unsigned int>(request.config.levels.size()));
+		for (LodConfig::LodLevelList::const_iterator I = request.config.levels.begin(); I != request.config.levels.end(); ++I) {
+			write(file, static_cast<unsigned long long>(I->outUniqueVertexCount));
+			write(file, static_cast<unsigned char>(I->outSkipped ? 1 : 0));
+		}
+		write(file, static_cast<unsigned int>(request.submesh.size()));
+		for (std::vector<PMGenRequest::SubmeshInfo>::const_iterator I = request.submesh.begin(); I != request.submesh.end(); ++I) {
+			write(file, static_cast<unsigned int>(I->genIndexBuffers.size()));
+			for (std::vector<PMGenRequest::IndexBuffer>::const_iterator J = I->genIndexBuffers.begin(); J != I->genIndexBuffers.end(); ++J) {
+				write(file, static_cast<unsigned int>(J->indexSize));
+				write(file, static_cast<unsigned long long>(J->indexCount));
+				file.write(reinterpret_cast<const char*>(J->indexBuffer), J->indexCount * J->indexSize);
+			}
+		}
+		if (!file) {
+			S_LOG_WARNING("Error when writing Lod to cache at " << temporaryPath << ".");
+			file.close();
+			std::remove(temporaryPath.c_str());
+			return;
+		}
+	}
+	std::remove(path.c_str());
+	if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+		S_LOG_WARNING("Could not move Lod cache file into place at " << path << ".");
+		std::remove(temporaryPath.c_str());
+		return;
+	}
+	mStores++;
+}
+
+void LodCache::runCommand(const std::string &command, const std::string &args)
+{
+	if (ReportStats == command) {
+		const unsigned int hits = mHits;
+		const unsigned int misses = mMisses;
+		const unsigned int lookups = hits + misses;
+		std::stringstream ss;
+		ss << "Lod cache: " << lookups << " lookups, " << hits << " hits, " << misses << " misses, " << mStores << " stored";
+		if (lookups) {
+			ss << " (" << std::fixed << std::setprecision(1) << (hits * 100.0 / lookups) << "% hit rate)";
+		}
+		ss << ".";
+		ConsoleBackend::getSingleton().pushMessage(ss.str(), "info");
+	}
+}
+
+}
+}
+}
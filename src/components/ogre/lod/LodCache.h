@@ -0,0 +1,104 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_LOD_LODCACHE_H_
+#define EMBEROGRE_LOD_LODCACHE_H_
+
+#include "framework/ConsoleObject.h"
+#include "framework/Singleton.h"
+
+#include <atomic>
+#include <string>
+
+namespace Ember
+{
+namespace OgreView
+{
+namespace Lod
+{
+
+struct PMGenRequest;
+
+/**
+ * @brief Keeps automatically generated Lod index buffers on disk, so that they don't need to be generated again in later sessions.
+ *
+ * Entries are keyed by a hash of the vertex positions and indices of the mesh, together with the Lod configuration, so any change to either will result in the Lods being generated anew.
+ * The hash also includes a format version, which should be increased whenever the file format or the Lod generation algorithm changes.
+ *
+ * Loading and storing are done by PMWorker in a background thread; the cache only touches its own files, and the statistics are atomic.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class LodCache: public Ember::Singleton<LodCache>, public ConsoleObject
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param directory The directory where the Lods are stored. It will be created if it doesn't exist.
+	 */
+	LodCache(const std::string& directory);
+
+	virtual ~LodCache();
+
+	/**
+	 * @brief Calculates the cache key of a request and stores it in the request.
+	 * @param request A request, with the buffers of the mesh copied.
+	 */
+	void calculateKey(PMGenRequest& request) const;
+
+	/**
+	 * @brief Loads cached Lods into a request, as if they had been generated.
+	 * @param request A request with a calculated key.
+	 * @return True if there were cached Lods, and they were loaded.
+	 */
+	bool load(PMGenRequest& request);
+
+	/**
+	 * @brief Writes the generated Lods of a request to the cache.
+	 * @param request A request with a calculated key, for which the Lods have been generated.
+	 */
+	void store(const PMGenRequest& request);
+
+	virtual void runCommand(const std::string &command, const std::string &args);
+
+	/**
+	 * @brief Prints the cache hit rate to the console.
+	 */
+	const ConsoleCommandWrapper ReportStats;
+
+private:
+
+	std::string mDirectory;
+
+	std::atomic<unsigned int> mHits;
+	std::atomic<unsigned int> mMisses;
+	std::atomic<unsigned int> mStores;
+
+	/**
+	 * @brief Gets the path of the cache file for a request.
+	 * @param request A request with a calculated key.
+	 */
+	std::string getPath(const PMGenRequest& request) const;
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_LOD_LODCACHE_H_ */
@@ -41,7 +41,7 @@ namespace Ember
               new ConfigListenerContainer())
       {
         mChangeRequiredConnection =
-            mGraphicalChangeAdapter.EventChangeRequired.connect(
+            mGraphicalChangeAdapter.connectSubsystem("lod",
                 sigc::mem_fun(*this, &LodLevelManager::changeLevel));
         mConfigListenerContainer->registerConfigListener("graphics", "lodbias",
             sigc::mem_fun(*this, &LodLevelManager::Config_LodBias));
@@ -75,13 +75,14 @@ namespace Ember
           }
         else
           {
+            //A higher lod bias gives more detail, so it should be lowered when more fps is required.
             if (level > 0.0f)
               {
-                return stepUpLodBias(mDefaultStep);
+                return stepDownLodBias(mDefaultStep);
               }
             else
               {
-                return stepDownLodBias(mDefaultStep);
+                return stepUpLodBias(mDefaultStep);
               }
           }
       }
@@ -48,6 +48,8 @@
 #include <OgreMesh.h>
 #include <OgreLodStrategy.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <limits>
 #include <sstream>
 
@@ -173,9 +175,7 @@ void ProgressiveMeshGenerator::addVertexData(Ogre::VertexData* vertexData, bool
 			v = *ret.first; // Point to the existing vertex.
 			v->seam = true;
 		} else {
-#ifndef NDEBUG
-			v->costSetPosition = mCollapseCostSet.end();
-#endif
+			v->heapIndex = PMCollapseCostHeap::NOT_IN_HEAP;
 			v->seam = false;
 		}
 		lookup.push_back(v);
@@ -411,7 +411,8 @@ ProgressiveMeshGenerator::PMEdge* ProgressiveMeshGenerator::getPointer(VEdges::i
 
 void ProgressiveMeshGenerator::computeCosts()
 {
-	mCollapseCostSet.clear();
+	mCollapseCostHeap.clear();
+	mCollapseCostHeap.reserve(mVertexList.size());
 	VertexList::iterator it = mVertexList.begin();
 	VertexList::iterator itEnd = mVertexList.end();
 	for (; it != itEnd; it++) {
@@ -420,7 +421,7 @@ void ProgressiveMeshGenerator::computeCosts()
 
 		} else {
 			std::stringstream str;
-			str << "In " << mMeshName << " never used vertex found with ID: " << mCollapseCostSet.size() << "."
+			str << "In " << mMeshName << " never used vertex found with ID: " << mCollapseCostHeap.size() << "."
 			    << std::endl
 			    << "Vertex position: ("
 			    << it->position.x << ", "
@@ -445,7 +446,7 @@ void ProgressiveMeshGenerator::computeVertexCollapseCost(PMVertex* vertex)
 		}
 	}
 	assert(vertex->collapseCost != UNINITIALIZED_COLLAPSE_COST);
-	vertex->costSetPosition = mCollapseCostSet.insert(vertex);
+	mCollapseCostHeap.push(vertex);
 
 }
 
@@ -614,18 +615,17 @@ void ProgressiveMeshGenerator::updateVertexCollapseCost(PMVertex* vertex)
 		}
 	}
 	if (collapseCost != vertex->collapseCost || vertex->collapseTo != collapseTo) {
-		assert(vertex->collapseTo != NULL);
-		assert(vertex->costSetPosition != mCollapseCostSet.end());
-		mCollapseCostSet.erase(vertex->costSetPosition);
+		vertex->collapseCost = collapseCost;
+		vertex->collapseTo = collapseTo;
 		if (collapseCost != UNINITIALIZED_COLLAPSE_COST) {
-			vertex->collapseCost = collapseCost;
-			vertex->collapseTo = collapseTo;
-			vertex->costSetPosition = mCollapseCostSet.insert(vertex);
+			if (mCollapseCostHeap.contains(vertex)) {
+				mCollapseCostHeap.update(vertex);
+			} else {
+				mCollapseCostHeap.push(vertex);
+			}
 		} else {
-#ifndef NDEBUG
-			vertex->collapseTo == NULL;
-			vertex->costSetPosition = mCollapseCostSet.end();
-#endif
+			// The vertex has no edges left, so it can't be collapsed.
+			mCollapseCostHeap.remove(vertex);
 		}
 	}
 }
@@ -670,9 +670,8 @@ void ProgressiveMeshGenerator::computeLods(LodConfig& lodConfigs)
 	for (unsigned short curLod = 0; curLod < lodCount; curLod++) {
 		size_t neededVertexCount = calcLodVertexCount(lodConfigs.levels[curLod]);
 		for (; neededVertexCount < vertexCount; vertexCount--) {
-			CollapseCostSet::iterator nextIndex = mCollapseCostSet.begin();
-			if (nextIndex != mCollapseCostSet.end() && (*nextIndex)->collapseCost < mCollapseCostLimit) {
-				collapse(*nextIndex);
+			if (!mCollapseCostHeap.empty() && mCollapseCostHeap.top()->collapseCost < mCollapseCostLimit) {
+				collapse(mCollapseCostHeap.top());
 			} else {
 				break;
 			}
@@ -691,22 +690,20 @@ void ProgressiveMeshGenerator::computeLods(LodConfig& lodConfigs)
 
 size_t ProgressiveMeshGenerator::findDstID(unsigned int srcID, unsigned short submeshID)
 {
-	// Tries to find a compatible edge.
-
-	// Exact match search.
-	for (size_t i = 0; i < tmpCollapsedEdges.size(); i++) {
-		if (tmpCollapsedEdges[i].srcID == srcID && tmpCollapsedEdges[i].submeshID == submeshID) {
-			return i;
-		}
-	}
-
-	// Usable match search.
+	// Tries to find a compatible edge: an exact match if there is one, otherwise the first edge in the same submesh.
+	// There are only a few collapsed edges (one per removed triangle), so a single linear pass beats any index.
+	size_t usable = std::numeric_limits<size_t>::max(); // Not found
 	for (size_t i = 0; i < tmpCollapsedEdges.size(); i++) {
 		if (tmpCollapsedEdges[i].submeshID == submeshID) {
-			return i;
+			if (tmpCollapsedEdges[i].srcID == srcID) {
+				return i;
+			}
+			if (usable == std::numeric_limits<size_t>::max()) {
+				usable = i;
+			}
 		}
 	}
-	return std::numeric_limits<size_t>::max(); // Not found
+	return usable;
 }
 
 bool ProgressiveMeshGenerator::hasSrcID(unsigned int srcID, unsigned short submeshID)
@@ -724,13 +721,9 @@ bool ProgressiveMeshGenerator::hasSrcID(unsigned int srcID, unsigned short subme
 void ProgressiveMeshGenerator::assertValidMesh()
 {
 	// Allows to find bugs in collapsing.
-	size_t s1 = mUniqueVertexSet.size();
-	size_t s2 = mCollapseCostSet.size();
-	CollapseCostSet::iterator it = mCollapseCostSet.begin();
-	CollapseCostSet::iterator itEnd = mCollapseCostSet.end();
-	while (it != itEnd) {
-		assertValidVertex(*it);
-		it++;
+	for (size_t i = 0; i < mCollapseCostHeap.size(); i++) {
+		assert(mCollapseCostHeap.at(i)->heapIndex == i);
+		assertValidVertex(mCollapseCostHeap.at(i));
 	}
 }
 #endif
@@ -743,7 +736,7 @@ void ProgressiveMeshGenerator::assertValidVertex(PMVertex* v)
 	for (; it != itEnd; it++) {
 		PMTriangle* t = *it;
 		for (int i = 0; i < 3; i++) {
-			assert(t->vertex[i]->costSetPosition != mCollapseCostSet.end());
+			assert(mCollapseCostHeap.contains(t->vertex[i]));
 			t->vertex[i]->edges.findExists(PMEdge(t->vertex[i]->collapseTo));
 			for (int n = 0; n < 3; n++) {
 				if (i != n) {
@@ -884,11 +877,10 @@ void ProgressiveMeshGenerator::collapse(PMVertex* src)
 	assertOutdatedCollapseCost(dst);
 #endif // ifndef NDEBUG
 #endif // ifndef PM_BEST_QUALITY
-	mCollapseCostSet.erase(src->costSetPosition); // Remove src from collapse costs.
+	mCollapseCostHeap.remove(src); // Remove src from collapse costs.
 	src->edges.clear(); // Free memory
 	src->triangles.clear(); // Free memory
 #ifndef NDEBUG
-	src->costSetPosition = mCollapseCostSet.end();
 	assertValidVertex(dst);
 #endif
 }
@@ -1068,7 +1060,7 @@ void ProgressiveMeshGenerator::removeEdge(PMVertex* v, const PMEdge& edge)
 
 void ProgressiveMeshGenerator::cleanupMemory()
 {
-	this->mCollapseCostSet.clear();
+	this->mCollapseCostHeap.clear();
 	this->mIndexBufferInfoList.clear();
 	this->mSharedVertexLookup.clear();
 	this->mVertexLookup.clear();
@@ -1082,17 +1074,186 @@ bool ProgressiveMeshGenerator::PMVertexEqual::operator() (const PMVertex* lhs, c
 	return lhs->position == rhs->position;
 }
 
-bool ProgressiveMeshGenerator::PMCollapseCostLess::operator() (const PMVertex* lhs, const PMVertex* rhs) const
+size_t ProgressiveMeshGenerator::PMVertexHash::operator() (const PMVertex* v) const
 {
-	return lhs->collapseCost < rhs->collapseCost;
+	// Combine instead of xor, so that positions with swapped components don't collide.
+	size_t seed = 0;
+	boost::hash_combine(seed, v->position.x);
+	boost::hash_combine(seed, v->position.y);
+	boost::hash_combine(seed, v->position.z);
+	return seed;
 }
 
-size_t ProgressiveMeshGenerator::PMVertexHash::operator() (const PMVertex* v) const
+ProgressiveMeshGenerator::PMUniqueVertexSet::PMUniqueVertexSet() :
+	mSize(0)
+{
+}
+
+void ProgressiveMeshGenerator::PMUniqueVertexSet::rehash(size_t bucketCount)
+{
+	// Use a power of two, so that the bucket can be found with a mask.
+	size_t size = 16;
+	while (size < bucketCount || size < mSize * 2) {
+		size *= 2;
+	}
+	std::vector<PMVertex*> oldBuckets(size, static_cast<PMVertex*>(0));
+	oldBuckets.swap(mBuckets);
+	for (std::vector<PMVertex*>::const_iterator it = oldBuckets.begin(); it != oldBuckets.end(); it++) {
+		if (*it) {
+			*findBucket(*it) = *it;
+		}
+	}
+}
+
+ProgressiveMeshGenerator::PMVertex** ProgressiveMeshGenerator::PMUniqueVertexSet::findBucket(PMVertex* v)
+{
+	// Linear probing; there's always at least one empty bucket, since the load is kept below one half.
+	const size_t mask = mBuckets.size() - 1;
+	size_t index = PMVertexHash()(v) & mask;
+	while (mBuckets[index] && !PMVertexEqual()(mBuckets[index], v)) {
+		index = (index + 1) & mask;
+	}
+	return &mBuckets[index];
+}
+
+std::pair<ProgressiveMeshGenerator::PMUniqueVertexSet::iterator, bool> ProgressiveMeshGenerator::PMUniqueVertexSet::insert(PMVertex* v)
+{
+	if ((mSize + 1) * 2 > mBuckets.size()) {
+		rehash(mBuckets.size() * 2);
+	}
+	PMVertex** bucket = findBucket(v);
+	if (*bucket) {
+		return std::make_pair(bucket, false);
+	}
+	*bucket = v;
+	mSize++;
+	return std::make_pair(bucket, true);
+}
+
+void ProgressiveMeshGenerator::PMUniqueVertexSet::clear()
+{
+	// Release the memory, since the set is only needed while loading.
+	std::vector<PMVertex*>().swap(mBuckets);
+	mSize = 0;
+}
+
+size_t ProgressiveMeshGenerator::PMUniqueVertexSet::size() const
+{
+	return mSize;
+}
+
+const size_t ProgressiveMeshGenerator::PMCollapseCostHeap::NOT_IN_HEAP;
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::reserve(size_t size)
+{
+	mHeap.reserve(size);
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::clear()
+{
+	for (std::vector<PMVertex*>::iterator it = mHeap.begin(); it != mHeap.end(); it++) {
+		(*it)->heapIndex = NOT_IN_HEAP;
+	}
+	mHeap.clear();
+}
+
+bool ProgressiveMeshGenerator::PMCollapseCostHeap::empty() const
+{
+	return mHeap.empty();
+}
+
+size_t ProgressiveMeshGenerator::PMCollapseCostHeap::size() const
+{
+	return mHeap.size();
+}
+
+ProgressiveMeshGenerator::PMVertex* ProgressiveMeshGenerator::PMCollapseCostHeap::top() const
+{
+	assert(!mHeap.empty());
+	return mHeap.front();
+}
+
+ProgressiveMeshGenerator::PMVertex* ProgressiveMeshGenerator::PMCollapseCostHeap::at(size_t index) const
+{
+	return mHeap[index];
+}
+
+bool ProgressiveMeshGenerator::PMCollapseCostHeap::contains(const PMVertex* v) const
+{
+	return v->heapIndex != NOT_IN_HEAP;
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::push(PMVertex* v)
+{
+	assert(!contains(v));
+	mHeap.push_back(v);
+	v->heapIndex = mHeap.size() - 1;
+	siftUp(v->heapIndex);
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::remove(PMVertex* v)
+{
+	if (!contains(v)) {
+		return;
+	}
+	size_t index = v->heapIndex;
+	v->heapIndex = NOT_IN_HEAP;
+	PMVertex* last = mHeap.back();
+	mHeap.pop_back();
+	if (last != v) {
+		// Move the last vertex into the hole, and restore the order in whichever direction is needed.
+		place(last, index);
+		siftUp(index);
+		siftDown(last->heapIndex);
+	}
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::update(PMVertex* v)
+{
+	assert(contains(v));
+	siftUp(v->heapIndex);
+	siftDown(v->heapIndex);
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::place(PMVertex* v, size_t index)
+{
+	mHeap[index] = v;
+	v->heapIndex = index;
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::siftUp(size_t index)
 {
-	boost::hash<Ogre::Real> hasher;
-	return hasher(v->position.x)
-	       ^ hasher(v->position.y)
-	       ^ hasher(v->position.z);
+	PMVertex* v = mHeap[index];
+	while (index > 0) {
+		size_t parent = (index - 1) / 2;
+		if (!(v->collapseCost < mHeap[parent]->collapseCost)) {
+			break;
+		}
+		place(mHeap[parent], index);
+		index = parent;
+	}
+	place(v, index);
+}
+
+void ProgressiveMeshGenerator::PMCollapseCostHeap::siftDown(size_t index)
+{
+	PMVertex* v = mHeap[index];
+	const size_t count = mHeap.size();
+	while (true) {
+		size_t child = index * 2 + 1;
+		if (child >= count) {
+			break;
+		}
+		if (child + 1 < count && mHeap[child + 1]->collapseCost < mHeap[child]->collapseCost) {
+			child++;
+		}
+		if (!(mHeap[child]->collapseCost < v->collapseCost)) {
+			break;
+		}
+		place(mHeap[child], index);
+		index = child;
+	}
+	place(v, index);
 }
 
 template<typename T, unsigned S>
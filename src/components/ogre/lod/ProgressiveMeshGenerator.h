@@ -30,10 +30,8 @@
 #include "OgreSmallVector.h"
 #include <OgreMesh.h>
 
-#include <boost/unordered_set.hpp>
-
+#include <utility>
 #include <vector>
-#include <set>
 
 namespace Ember
 {
@@ -90,14 +88,14 @@ protected:
 	struct PMTriangle;
 	struct PMVertexHash;
 	struct PMVertexEqual;
-	struct PMCollapseCostLess;
+	class PMUniqueVertexSet;
+	class PMCollapseCostHeap;
 	struct PMCollapsedEdge;
 	struct PMIndexBufferInfo;
 
 	typedef std::vector<PMVertex> VertexList;
 	typedef std::vector<PMTriangle> TriangleList;
-	typedef boost::unordered_set<PMVertex*, PMVertexHash, PMVertexEqual> UniqueVertexSet;
-	typedef std::multiset<PMVertex*, PMCollapseCostLess> CollapseCostSet;
+	typedef PMUniqueVertexSet UniqueVertexSet;
 	typedef std::vector<PMVertex*> VertexLookupList;
 
 	typedef VectorSet<PMEdge, 8> VEdges;
@@ -116,9 +114,44 @@ protected:
 		bool operator() (const PMVertex* lhs, const PMVertex* rhs) const;
 	};
 
-	// Comparator for CollapseCostSet.
-	struct PMCollapseCostLess {
-		bool operator() (const PMVertex* lhs, const PMVertex* rhs) const;
+	// Set of vertices with unique positions, used while loading the vertices.
+	// It uses open addressing in a single array, so unlike a node based set nothing is allocated per vertex.
+	class PMUniqueVertexSet {
+	public:
+		typedef PMVertex** iterator;
+
+		PMUniqueVertexSet();
+		void rehash(size_t bucketCount); // Prepares for bucketCount / 2 vertices.
+		std::pair<iterator, bool> insert(PMVertex* v); // Returns the existing vertex if the position already exists.
+		void clear();
+		size_t size() const;
+	private:
+		std::vector<PMVertex*> mBuckets;
+		size_t mSize;
+		PMVertex** findBucket(PMVertex* v);
+	};
+
+	// Binary min heap of vertices, ordered by collapse cost.
+	// Each vertex knows its position in the heap, so it can be removed or have its cost changed in O(log N) without any allocations.
+	class PMCollapseCostHeap {
+	public:
+		static const size_t NOT_IN_HEAP = static_cast<size_t>(-1);
+
+		void reserve(size_t size);
+		void clear();
+		bool empty() const;
+		size_t size() const;
+		PMVertex* top() const; // The vertex with the lowest collapse cost.
+		PMVertex* at(size_t index) const;
+		void push(PMVertex* v);
+		void remove(PMVertex* v); // Does nothing if the vertex isn't in the heap.
+		void update(PMVertex* v); // Restores the order after the collapse cost of the vertex has changed.
+		bool contains(const PMVertex* v) const;
+	private:
+		std::vector<PMVertex*> mHeap;
+		void place(PMVertex* v, size_t index);
+		void siftUp(size_t index);
+		void siftDown(size_t index);
 	};
 
 	// Directed edge
@@ -142,7 +175,7 @@ protected:
 
 		PMVertex* collapseTo;
 		bool seam;
-		CollapseCostSet::iterator costSetPosition; // Iterator pointing to the position in the mCollapseCostSet, which allows fast remove.
+		size_t heapIndex; // Position in mCollapseCostHeap, or PMCollapseCostHeap::NOT_IN_HEAP.
 	};
 
 	struct PMTriangle {
@@ -179,7 +212,7 @@ protected:
 	VertexList mVertexList;
 	TriangleList mTriangleList;
 	UniqueVertexSet mUniqueVertexSet;
-	CollapseCostSet mCollapseCostSet;
+	PMCollapseCostHeap mCollapseCostHeap;
 	CollapsedEdges tmpCollapsedEdges; // Tmp container used in collapse().
 	IndexBufferInfoList mIndexBufferInfoList;
 
@@ -21,6 +21,7 @@
  */
 
 #include "QueuedProgressiveMeshGenerator.h"
+#include "LodCache.h"
 
 #include <OgreSubMesh.h>
 #include <OgreHardwareBufferManager.h>
@@ -78,7 +79,17 @@ Ogre::WorkQueue::Response* PMWorker::handleRequest(const Ogre::WorkQueue::Reques
 	// Called on worker thread by Ogre::WorkQueue.
 	OGRE_LOCK_MUTEX(this->OGRE_AUTO_MUTEX_NAME);
 	mRequest = Ogre::any_cast<PMGenRequest*>(req->getData());
+	LodCache* cache = LodCache::getSingletonPtr();
+	if (cache) {
+		cache->calculateKey(*mRequest);
+		if (cache->load(*mRequest)) {
+			return OGRE_NEW Ogre::WorkQueue::Response(req, true, req->getData());
+		}
+	}
 	buildRequest(mRequest->config);
+	if (cache) {
+		cache->store(*mRequest);
+	}
 	return OGRE_NEW Ogre::WorkQueue::Response(req, true, req->getData());
 }
 
@@ -173,9 +184,7 @@ void PMWorker::addVertexBuffer(const PMGenRequest::VertexBuffer& vertexBuffer, b
 			v = *ret.first; // Point to the existing vertex.
 			v->seam = true;
 		} else {
-#ifndef NDEBUG
-			v->costSetPosition = mCollapseCostSet.end();
-#endif
+			v->heapIndex = PMCollapseCostHeap::NOT_IN_HEAP;
 			v->seam = false;
 		}
 		lookup.push_back(v);
@@ -71,6 +71,7 @@ struct PMGenRequest {
 	VertexBuffer sharedVertexBuffer;
 	LodConfig config;
 	std::string meshName;
+	std::string cacheKey; // Set by LodCache::calculateKey().
 	~PMGenRequest();
 };
 
@@ -644,6 +644,14 @@ namespace Ember
         const std::string&
         getIconPath() const;
 
+        /**
+         * @brief Gets a hash of the definition as it was read from its source.
+         * This changes whenever the definition changes, and can be used as a key for data derived from the definition, such as cached icons.
+         * @return A hash of the definition, or an empty string if the definition wasn't read from a source.
+         */
+        const std::string&
+        getContentHash() const;
+
         /**
          * @brief Creates and returns a new sub model definition for the supplied mesh name.
          * @param meshname The name of the mesh to base the new sub model on. Must be a valid mesh.
@@ -903,6 +911,11 @@ namespace Ember
          */
         std::string mIconPath;
 
+        /**
+         * @brief A hash of the definition as it was read from its source.
+         */
+        std::string mContentHash;
+
         RenderingDefinition* mRenderingDef;
 
       };
@@ -1005,6 +1018,12 @@ namespace Ember
         return mIconPath;
       }
 
+      inline const std::string&
+      ModelDefinition::getContentHash() const
+      {
+        return mContentHash;
+      }
+
       inline int
       AnimationDefinition::getIterations() const
       {
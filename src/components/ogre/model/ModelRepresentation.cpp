@@ -34,6 +34,8 @@
 #include "components/ogre/MousePicker.h"
 #include "components/ogre/EmberEntityUserObject.h"
 #include "components/ogre/MeshCollisionDetector.h"
+#include "components/ogre/OpcodeCollisionDetector.h"
+#include "components/ogre/OpcodeCollisionShapeCache.h"
 #include "components/ogre/EmberEntity.h"
 #include "components/ogre/EmberEntityFactory.h"
 #include "components/ogre/EmberOgre.h"
@@ -269,9 +271,16 @@ namespace Ember
       ModelRepresentation::connectEntities()
       {
         //we'll create an instance of ICollisionDetector and pass on the user object, which is then responsible for properly deleting it
-        //		ICollisionDetector* collisionDetector = new OpcodeCollisionDetector(getModel());
-        ICollisionDetector* collisionDetector = new MeshCollisionDetector(
-            &getModel());
+        //The OPCODE detector shares the collision shapes of static meshes between all instances. It requires the collision manager, which isn't available when running without a full client (such as in tests).
+        ICollisionDetector* collisionDetector;
+        if (OpcodeCollisionShapeCache::getSingletonPtr())
+          {
+            collisionDetector = new OpcodeCollisionDetector(&getModel());
+          }
+        else
+          {
+            collisionDetector = new MeshCollisionDetector(&getModel());
+          }
         EmberEntityUserObject* userObject = new EmberEntityUserObject(
             getEntity(), collisionDetector);
         getModel().setUserAny(
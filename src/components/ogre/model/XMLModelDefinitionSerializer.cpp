@@ -35,6 +35,8 @@
 
 #include <OgreStringConverter.h>
 #include <limits>
+#include <sstream>
+#include <iomanip>
 
 #ifdef WIN32
 	#include <tchar.h>
@@ -55,6 +57,28 @@ namespace Ember {
 namespace OgreView {
 namespace Model {
 
+namespace {
+/**
+ * @brief Calculates a 64 bit FNV-1a hash of the printed xml element, formatted as hex.
+ * This is used to detect when a definition has changed, so it doesn't need to be cryptographically strong; just stable between runs.
+ */
+std::string hashElement(const TiXmlElement& element)
+{
+	TiXmlPrinter printer;
+	printer.SetStreamPrinting();
+	element.Accept(&printer);
+	unsigned long long hash = 14695981039346656037ULL;
+	const std::string& text = printer.Str();
+	for (std::string::const_iterator I = text.begin(); I != text.end(); ++I) {
+		hash ^= static_cast<unsigned char>(*I);
+		hash *= 1099511628211ULL;
+	}
+	std::stringstream ss;
+	ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+	return ss.str();
+}
+}
+
 XMLModelDefinitionSerializer::XMLModelDefinitionSerializer()
 {}
 
@@ -90,6 +114,7 @@ void XMLModelDefinitionSerializer::parseScript(ModelDefinitionManager& modelDefM
 				ModelDefinitionPtr modelDef = modelDefManager.create(name, groupName);
 				if (!modelDef.isNull()) {
 					readModel(modelDef, smElem);
+					modelDef->mContentHash = hashElement(*smElem);
 					modelDef->setValid(true);
 				}
 			} catch (const Ogre::Exception& ex) {
@@ -33,6 +33,7 @@
 #include "OgreCollisionReporter.h"
 #include "OgreCollisionTypes.h"
 #include "OgreOpcodeDebugObject.h"
+#include "OgreDynamicAABBTree.h"
 //#include "BP_Scene.h"
 #include "Opcode/Opcode.h"
 
@@ -171,6 +172,17 @@ namespace OgreOpcode
 		typedef CollObjAABBPairs::const_iterator CollObjAABBPair_Iterator;///<
 		CollObjAABBPairs collAABB_pairs;	///<
 		Details::BP_Scene* mBroadPhase;	///<
+		Details::DynamicAABBTree mQueryTree; ///< spatial index of the attached objects, used by the Check() functions
+
+		std::vector<CollisionObject*> mQueryCandidates; ///< reused between Check() calls to avoid allocations
+
+		struct BoxQuery;
+		struct RayQuery;
+
+		/// Updates the bounds of an attached object in the query tree. Called by the object when it's updated.
+		void updateObjectBounds(CollisionObject* collObj);
+		/// Fills mQueryCandidates with the attached objects whose bounding boxes overlap the supplied box.
+		void findCandidates(const Ogre::Vector3& minv, const Ogre::Vector3& maxv);
 		typedef std::vector<CollisionObject*>::iterator rw_attached_list_iterator; ///<
 		typedef std::vector<CollisionObject*>::iterator rw_owned_list_iterator; ///<
 		typedef std::set<Details::Encounter> ProxList;
@@ -73,7 +73,10 @@ namespace OgreOpcode
 			num_colls(0),
 			mNeedsUpdating(true),
 			mForcedUpdate(true),
-			mProxy(0)
+			mProxy(0),
+			mQueryProxy(Details::DynamicAABBTree::NullNode),
+			minv(Ogre::Vector3::ZERO),
+			maxv(Ogre::Vector3::ZERO)
 		{
 			mRecentContactList.clear();
 		};
@@ -379,6 +382,7 @@ namespace OgreOpcode
 		int num_colls;              ///< number of collisions this object is involved in
 
 		Details::BP_Proxy* mProxy;
+		int mQueryProxy;			///< the proxy in the query tree of the context, when attached
 
 		std::list<CollisionInfo> mRecentContactList;
 	};
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+///  @file OgreDynamicAABBTree.h
+///  @brief A dynamic bounding volume tree used for spatial queries in a CollisionContext.
+///
+///  @author The OgreOpcode Team
+///
+///////////////////////////////////////////////////////////////////////////////
+///
+///  This file is part of OgreOpcode.
+///
+///  OgreOpcode is free software; you can redistribute it and/or
+///  modify it under the terms of the GNU Lesser General Public
+///  License as published by the Free Software Foundation; either
+///  version 2.1 of the License, or (at your option) any later version.
+///
+///  OgreOpcode is distributed in the hope that it will be useful,
+///  but WITHOUT ANY WARRANTY; without even the implied warranty of
+///  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+///  Lesser General Public License for more details.
+///
+///  You should have received a copy of the GNU Lesser General Public
+///  License along with OgreOpcode; if not, write to the Free Software
+///  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///
+///////////////////////////////////////////////////////////////////////////////
+#ifndef __OgreDynamicAABBTree_h__
+#define __OgreDynamicAABBTree_h__
+
+#include "OgreOpcodeExports.h"
+#include <OgreVector3.h>
+#include <OgreRay.h>
+
+#include <vector>
+#include <limits>
+
+namespace OgreOpcode
+{
+	namespace Details
+	{
+		/// A dynamic AABB tree.
+		/// Each proxy is stored in a leaf with a slightly enlarged ("fat") bounding box, so that
+		/// objects which move a little don't need to be reinserted. Inserted leaves are placed
+		/// where they increase the surface area of the tree the least, and the tree is kept
+		/// balanced through rotations, so queries stay logarithmic in the number of proxies
+		/// regardless of the order in which they were added.
+		///
+		/// Queries only test the fat boxes; callers must perform any exact tests themselves.
+		class _OgreOpcode_Export DynamicAABBTree
+		{
+		public:
+			static const int NullNode = -1;
+
+			/// @param margin How much each box is enlarged in each direction when stored.
+			DynamicAABBTree(Ogre::Real margin = 0.1);
+
+			/// Adds a proxy to the tree.
+			/// @return The id of the proxy.
+			int createProxy(const Ogre::Vector3& minv, const Ogre::Vector3& maxv, void* userData);
+
+			/// Removes a proxy from the tree.
+			void destroyProxy(int proxyId);
+
+			/// Updates the bounds of a proxy. The proxy is only reinserted if the new box
+			/// isn't contained in the fat box it's currently stored with.
+			/// @return True if the proxy was reinserted.
+			bool moveProxy(int proxyId, const Ogre::Vector3& minv, const Ogre::Vector3& maxv);
+
+			/// Gets the user data supplied when the proxy was created.
+			void* getUserData(int proxyId) const
+			{
+				return mNodes[proxyId].userData;
+			}
+
+			/// Gets the number of proxies in the tree.
+			int getProxyCount() const
+			{
+				return mProxyCount;
+			}
+
+			/// Gets the height of the tree; zero if it only has one leaf.
+			int getHeight() const;
+
+			/// Removes all proxies.
+			void clear();
+
+			/// Calls the callback for each proxy whose fat box overlaps the supplied box.
+			/// The callback is called as "bool callback(void* userData)", and should return false to stop the query.
+			template <typename T>
+			void query(const Ogre::Vector3& minv, const Ogre::Vector3& maxv, T& callback) const;
+
+			/// Calls the callback for each proxy whose fat box is hit by the ray within the max distance.
+			/// Nodes closer to the origin are visited first. The callback is called as
+			/// "Ogre::Real callback(void* userData, Ogre::Real maxDistance)" and should return the new
+			/// max distance; returning a lower distance (such as the distance to a hit) prunes everything
+			/// beyond it, and returning a negative value stops the query.
+			/// Distances are measured along the normalised direction of the ray.
+			template <typename T>
+			void rayCast(const Ogre::Ray& ray, Ogre::Real maxDistance, T& callback) const;
+
+			/// Tests a ray against a box.
+			/// @param origin The origin of the ray.
+			/// @param inverseDirection The inverse of each component of the normalised direction of the ray.
+			/// @param maxDistance The max distance along the ray.
+			/// @param entryDistance Set to the distance at which the ray enters the box, or zero if it starts inside it.
+			/// @return True if the ray hits the box within the max distance.
+			static bool rayIntersectsBox(const Ogre::Vector3& origin, const Ogre::Vector3& inverseDirection, const Ogre::Vector3& minv, const Ogre::Vector3& maxv, Ogre::Real maxDistance, Ogre::Real& entryDistance);
+
+		private:
+			struct Node
+			{
+				Ogre::Vector3 minv;
+				Ogre::Vector3 maxv;
+				void* userData;
+				/// The parent when in the tree, or the next free node when in the free list.
+				int parent;
+				int child1;
+				int child2;
+				/// Height of the subtree; leaves are 0, free nodes are -1.
+				int height;
+
+				bool isLeaf() const
+				{
+					return child1 == NullNode;
+				}
+			};
+
+			std::vector<Node> mNodes;
+			int mRoot;
+			int mFreeList;
+			int mProxyCount;
+			Ogre::Real mMargin;
+
+			int allocateNode();
+			void freeNode(int nodeId);
+			void insertLeaf(int leaf);
+			void removeLeaf(int leaf);
+			int balance(int nodeId);
+			void refitAncestors(int nodeId);
+
+			static Ogre::Real surfaceArea(const Ogre::Vector3& minv, const Ogre::Vector3& maxv)
+			{
+				Ogre::Vector3 d = maxv - minv;
+				return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+			}
+
+			static bool overlaps(const Node& node, const Ogre::Vector3& minv, const Ogre::Vector3& maxv)
+			{
+				return node.minv.x <= maxv.x && node.maxv.x >= minv.x &&
+					node.minv.y <= maxv.y && node.maxv.y >= minv.y &&
+					node.minv.z <= maxv.z && node.maxv.z >= minv.z;
+			}
+		};
+
+		template <typename T>
+		void DynamicAABBTree::query(const Ogre::Vector3& minv, const Ogre::Vector3& maxv, T& callback) const
+		{
+			if (mRoot == NullNode)
+			{
+				return;
+			}
+			std::vector<int> stack;
+			stack.reserve(64);
+			stack.push_back(mRoot);
+			while (!stack.empty())
+			{
+				int nodeId = stack.back();
+				stack.pop_back();
+				const Node& node = mNodes[nodeId];
+				if (overlaps(node, minv, maxv))
+				{
+					if (node.isLeaf())
+					{
+						if (!callback(node.userData))
+						{
+							return;
+						}
+					}
+					else
+					{
+						stack.push_back(node.child1);
+						stack.push_back(node.child2);
+					}
+				}
+			}
+		}
+
+		template <typename T>
+		void DynamicAABBTree::rayCast(const Ogre::Ray& ray, Ogre::Real maxDistance, T& callback) const
+		{
+			if (mRoot == NullNode)
+			{
+				return;
+			}
+			const Ogre::Vector3& origin = ray.getOrigin();
+			Ogre::Vector3 direction = ray.getDirection().normalisedCopy();
+			// Infinite components are handled by rayIntersectsBox.
+			Ogre::Vector3 inverseDirection(
+				direction.x != 0 ? 1.0f / direction.x : std::numeric_limits<Ogre::Real>::infinity(),
+				direction.y != 0 ? 1.0f / direction.y : std::numeric_limits<Ogre::Real>::infinity(),
+				direction.z != 0 ? 1.0f / direction.z : std::numeric_limits<Ogre::Real>::infinity());
+
+			Ogre::Real entry;
+			if (!rayIntersectsBox(origin, inverseDirection, mNodes[mRoot].minv, mNodes[mRoot].maxv, maxDistance, entry))
+			{
+				return;
+			}
+
+			// Each stack entry keeps the entry distance, so that nodes which have been pruned by a closer hit can be skipped.
+			std::vector<std::pair<int, Ogre::Real> > stack;
+			stack.reserve(64);
+			stack.push_back(std::make_pair(mRoot, entry));
+			while (!stack.empty())
+			{
+				int nodeId = stack.back().first;
+				Ogre::Real nodeEntry = stack.back().second;
+				stack.pop_back();
+				if (nodeEntry > maxDistance)
+				{
+					continue;
+				}
+				const Node& node = mNodes[nodeId];
+				if (node.isLeaf())
+				{
+					maxDistance = callback(node.userData, maxDistance);
+					if (maxDistance < 0)
+					{
+						return;
+					}
+					continue;
+				}
+				Ogre::Real entry1, entry2;
+				bool hit1 = rayIntersectsBox(origin, inverseDirection, mNodes[node.child1].minv, mNodes[node.child1].maxv, maxDistance, entry1);
+				bool hit2 = rayIntersectsBox(origin, inverseDirection, mNodes[node.child2].minv, mNodes[node.child2].maxv, maxDistance, entry2);
+				// Push the farther child first, so that the nearer one is visited first.
+				if (hit1 && hit2)
+				{
+					if (entry1 < entry2)
+					{
+						stack.push_back(std::make_pair(node.child2, entry2));
+						stack.push_back(std::make_pair(node.child1, entry1));
+					}
+					else
+					{
+						stack.push_back(std::make_pair(node.child1, entry1));
+						stack.push_back(std::make_pair(node.child2, entry2));
+					}
+				}
+				else if (hit1)
+				{
+					stack.push_back(std::make_pair(node.child1, entry1));
+				}
+				else if (hit2)
+				{
+					stack.push_back(std::make_pair(node.child2, entry2));
+				}
+			}
+		}
+	}
+}
+
+#endif // __OgreDynamicAABBTree_h__
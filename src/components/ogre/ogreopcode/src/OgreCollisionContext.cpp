@@ -38,17 +38,111 @@ namespace OgreOpcode
 {
 	namespace Details
 	{
-		inline bool intervalOverlap(Real a0, Real a1, Real b0, Real b1)
+		/// Ray versus box test used to refine the fat boxes returned by the query tree.
+		inline bool rayOverlap(const Ogre::Ray& line, const Vector3& inverseDirection, const Vector3& minv, const Vector3& maxv, Real dist)
 		{
-			// Only two ways for intervals to not overlap -- 
-			//  a's max less than b's min, or a's min greater than b's max.
-			// Otherwise they overlap.
-			// return !(a1<b0 || a0>b1);
-			// I just applied the De Morgan's law here in order to obtain short-circuit
-			return (a1>=b0) && (a0<=b1);
+			Real entry;
+			return DynamicAABBTree::rayIntersectsBox(line.getOrigin(), inverseDirection, minv, maxv, dist, entry);
 		}
 	} // Details
 
+	/// Collects the attached objects whose bounding boxes overlap a box.
+	/// The tree only knows about the enlarged boxes, so the exact box of each object is tested here.
+	struct CollisionContext::BoxQuery
+	{
+		Vector3 minv;
+		Vector3 maxv;
+		std::vector<CollisionObject*>& candidates;
+
+		BoxQuery(const Vector3& minv_, const Vector3& maxv_, std::vector<CollisionObject*>& candidates_) :
+		minv(minv_), maxv(maxv_), candidates(candidates_)
+		{
+		}
+
+		bool operator()(void* userData)
+		{
+			CollisionObject* co = static_cast<CollisionObject*>(userData);
+			// see if we have overlaps in all 3 dimensions
+			if ((minv.x < co->maxv.x) && (maxv.x > co->minv.x) &&
+				(minv.y < co->maxv.y) && (maxv.y > co->minv.y) &&
+				(minv.z < co->maxv.z) && (maxv.z > co->minv.z))
+			{
+				candidates.push_back(co);
+			}
+			return true;
+		}
+	};
+
+	/// Tests a ray against the shapes of the objects returned by the query tree, nearest first.
+	/// For COLLTYPE_CONTACT the ray is clipped at each hit, so that objects behind the closest
+	/// hit are never tested, and only the closest hit is kept.
+	struct CollisionContext::RayQuery
+	{
+		CollisionContext& context;
+		const Ogre::Ray& line;
+		Vector3 inverseDirection;
+		CollisionType collType;
+		Details::CollisionClass collClass;
+		CollisionPair closest;
+		bool hasClosest;
+
+		RayQuery(CollisionContext& context_, const Ogre::Ray& line_, CollisionType collType_, Details::CollisionClass collClass_) :
+		context(context_), line(line_), collType(collType_), collClass(collClass_), hasClosest(false)
+		{
+			Vector3 direction = line.getDirection().normalisedCopy();
+			inverseDirection.x = direction.x != 0 ? 1.0f / direction.x : std::numeric_limits<Real>::infinity();
+			inverseDirection.y = direction.y != 0 ? 1.0f / direction.y : std::numeric_limits<Real>::infinity();
+			inverseDirection.z = direction.z != 0 ? 1.0f / direction.z : std::numeric_limits<Real>::infinity();
+		}
+
+		Real operator()(void* userData, Real dist)
+		{
+			CollisionObject* co = static_cast<CollisionObject*>(userData);
+			if (!rayOverlap(line, inverseDirection, co->minv, co->maxv, dist))
+			{
+				return dist;
+			}
+			// see if the candidate is in the ignore types set
+			CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass, co->getCollClass());
+			if (COLLTYPE_IGNORE == ct)
+			{
+				return dist;
+			}
+
+			// check collision
+			ICollisionShape* shape = co->getShape();
+			if (shape)
+			{
+				context.checkReportHandler.mTotalObjObjTests++;
+				CollisionPair cp;
+				bool ret = shape->rayCheck(collType, co->getTransform(), line, dist, cp, context.mRayCulling);
+				context.checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
+				context.checkReportHandler.mTotalBVPrimTests += cp.numBVPrimTests;
+				if (ret)
+				{
+					cp.this_object = co;
+					cp.other_object = co;
+					if (COLLTYPE_CONTACT == collType)
+					{
+						if (!hasClosest || cp.distance < closest.distance)
+						{
+							closest = cp;
+							hasClosest = true;
+						}
+						return closest.distance;
+					}
+					context.checkReportHandler.addCollision(cp, 0xffff, co->id);
+					if (COLLTYPE_QUICK == collType)
+					{
+						// stop the query
+						return -1;
+					}
+				}
+			}
+			return dist;
+		}
+	};
+
 	// release all owned collide objects
 	CollisionContext::~CollisionContext()
 	{
@@ -101,6 +195,11 @@ namespace OgreOpcode
 			{
 				owned_list.erase(itOwned);
 			}
+			if (collObj->mQueryProxy != DynamicAABBTree::NullNode)
+			{
+				mQueryTree.destroyProxy(collObj->mQueryProxy);
+				collObj->mQueryProxy = DynamicAABBTree::NullNode;
+			}
 			collObj->setAttached(false);
 			collObj->remove_broadphase();
 			collObj->setContext(0);
@@ -115,6 +214,10 @@ namespace OgreOpcode
 		
 		attached_list.push_back(collObj);
 		collObj->setAttached(true);
+		if (collObj->mQueryProxy == DynamicAABBTree::NullNode)
+		{
+			collObj->mQueryProxy = mQueryTree.createProxy(collObj->minv, collObj->maxv, collObj);
+		}
 	}
 
 	void CollisionContext::removeObject(CollisionObject *collObj)
@@ -123,6 +226,11 @@ namespace OgreOpcode
 		{
 			collObj->setAttached(false);
 			collObj->remove_broadphase();
+			if (collObj->mQueryProxy != DynamicAABBTree::NullNode)
+			{
+				mQueryTree.destroyProxy(collObj->mQueryProxy);
+				collObj->mQueryProxy = DynamicAABBTree::NullNode;
+			}
 			rw_attached_list_iterator itAttached = find(attached_list.begin(), attached_list.end(), collObj);
 			if (itAttached != attached_list.end())
 			{
@@ -131,6 +239,21 @@ namespace OgreOpcode
 		}
 	}
 
+	void CollisionContext::updateObjectBounds(CollisionObject* collObj)
+	{
+		if (collObj->mQueryProxy != DynamicAABBTree::NullNode)
+		{
+			mQueryTree.moveProxy(collObj->mQueryProxy, collObj->minv, collObj->maxv);
+		}
+	}
+
+	void CollisionContext::findCandidates(const Vector3& minv, const Vector3& maxv)
+	{
+		mQueryCandidates.clear();
+		BoxQuery query(minv, maxv, mQueryCandidates);
+		mQueryTree.query(minv, maxv, query);
+	}
+
 	/// Call collide on each object in the context.
 	/// After this, each object's collision array holds all collisions
 	/// this object was involved with.
@@ -383,91 +506,84 @@ namespace OgreOpcode
 		// initialize collision report handler
 		checkReportHandler.beginFrame();
 
-		// This simply goes through all attached objects, and
-		// checks them for overlap, so ITS SLOW! Every object is
-		// tested exactly once
-		for (attached_list_iterator other = attached_list.begin(); other != attached_list.end(); ++other)
+		// Only the objects whose bounding boxes overlap the swept box are
+		// returned by the query tree. Every object is tested exactly once.
+		findCandidates(minv, maxv);
+		for (attached_list_iterator other = mQueryCandidates.begin(); other != mQueryCandidates.end(); ++other)
 		{
-			// see if we have overlaps in all 3 dimensions
-			if ((minv.x < (*other)->maxv.x) && (maxv.x > (*other)->minv.x) &&
-				(minv.y < (*other)->maxv.y) && (maxv.y > (*other)->minv.y) &&
-				(minv.z < (*other)->maxv.z) && (maxv.z > (*other)->minv.z))
-			{
-				// see if the candidate is in the ignore types set
-				CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass,(*other)->getCollClass());
-				if (COLLTYPE_IGNORE == ct) continue;
+			// see if the candidate is in the ignore types set
+			CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass,(*other)->getCollClass());
+			if (COLLTYPE_IGNORE == ct) continue;
 
-				checkReportHandler.mTotalObjObjTests++;
-				if((*other)->getName() != ignorename)
+			checkReportHandler.mTotalObjObjTests++;
+			if((*other)->getName() != ignorename)
+			{
+				if (COLLTYPE_QUICK == ct)
 				{
-					if (COLLTYPE_QUICK == ct)
+					// Trying to extract position information from provided matrices.
+					Vector3 p1 = Vector3((*other)->old_matrix[0][3], (*other)->old_matrix[1][3], (*other)->old_matrix[2][3]);
+					Vector3 v1 = Vector3(Vector3((*other)->new_matrix[0][3], (*other)->new_matrix[1][3], (*other)->new_matrix[2][3]) - p1);
+
+					// do the contact check between 2 moving spheres
+					sphere s0(position,radius);
+					sphere s1(p1,(*other)->getRadius());
+					float u0,u1;
+					checkReportHandler.mTotalBVBVTests++;
+					if (s0.intersect_sweep(movementVector,s1,v1,u0,u1))
 					{
-						// Trying to extract position information from provided matrices.
-						Vector3 p1 = Vector3((*other)->old_matrix[0][3], (*other)->old_matrix[1][3], (*other)->old_matrix[2][3]);
-						Vector3 v1 = Vector3(Vector3((*other)->new_matrix[0][3], (*other)->new_matrix[1][3], (*other)->new_matrix[2][3]) - p1);
-
-						// do the contact check between 2 moving spheres
-						sphere s0(position,radius);
-						sphere s1(p1,(*other)->getRadius());
-						float u0,u1;
-						checkReportHandler.mTotalBVBVTests++;
-						if (s0.intersect_sweep(movementVector,s1,v1,u0,u1))
+						if ((u0>=0.0f) && (u0<1.0f))
 						{
-							if ((u0>=0.0f) && (u0<1.0f))
-							{
-								// we have contact!
+							// we have contact!
 
-								// compute the 2 midpoints at the time of collision
-								Vector3 c0(position + movementVector*u0);
-								Vector3 c1(p1 + v1*u0);
+							// compute the 2 midpoints at the time of collision
+							Vector3 c0(position + movementVector*u0);
+							Vector3 c1(p1 + v1*u0);
 
-								// compute the collide normal
-								Vector3 d(c1-c0);
-								if (d.length() > TINY)
-								{
-									d.normalise();
-								} else
-								{
-									d = Vector3(0.0f, 1.0f, 0.0f);
-								}
-
-								// fill out a collide report and add to report handler
-								CollisionPair cr;
-								cr.this_object     = (*other);
-								cr.other_object     = (*other);
-								cr.tstamp  = 0.0;
-								CollisionInfo collInfo;
-								collInfo.contact = (d*radius) + c0;
-								collInfo.this_normal = d;
-								collInfo.other_normal = -d;
-								cr.collInfos.push_back(collInfo);
-								checkReportHandler.addCollision(cr,own_id,(*other)->id);
+							// compute the collide normal
+							Vector3 d(c1-c0);
+							if (d.length() > TINY)
+							{
+								d.normalise();
+							} else
+							{
+								d = Vector3(0.0f, 1.0f, 0.0f);
 							}
+
+							// fill out a collide report and add to report handler
+							CollisionPair cr;
+							cr.this_object     = (*other);
+							cr.other_object     = (*other);
+							cr.tstamp  = 0.0;
+							CollisionInfo collInfo;
+							collInfo.contact = (d*radius) + c0;
+							collInfo.this_normal = d;
+							collInfo.other_normal = -d;
+							cr.collInfos.push_back(collInfo);
+							checkReportHandler.addCollision(cr,own_id,(*other)->id);
 						}
 					}
-					else // CONTACT and EXACT
-					{
-						// do sphere-shape collision check
-						ICollisionShape* shape = (*other)->getShape();
+				}
+				else // CONTACT and EXACT
+				{
+					// do sphere-shape collision check
+					ICollisionShape* shape = (*other)->getShape();
 
-						if (shape)
+					if (shape)
+					{
+						CollisionPair cp;
+						cp.this_object = (*other);
+						cp.other_object = (*other);
+						bool ret = shape->sweptSphereCheck(ct, (*other)->getTransform(), position, movementVector, radius, cp);
+						checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
+						checkReportHandler.mTotalBVPrimTests += cp.numBVPrimTests;
+						if (ret)
 						{
-							CollisionPair cp;
 							cp.this_object = (*other);
 							cp.other_object = (*other);
-							bool ret = shape->sweptSphereCheck(ct, (*other)->getTransform(), position, movementVector, radius, cp);
-							checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
-							checkReportHandler.mTotalBVPrimTests += cp.numBVPrimTests;
-							if (ret)
-							{
-								cp.this_object = (*other);
-								cp.other_object = (*other);
-								checkReportHandler.addCollision(cp, own_id, (*other)->id);
-							}
+							checkReportHandler.addCollision(cp, own_id, (*other)->id);
 						}
 					}
 				}
-
 			}
 		}
 		checkReportHandler.endFrame();
@@ -489,69 +605,20 @@ namespace OgreOpcode
 	{
 		assert(collType != COLLTYPE_IGNORE);
 
-		// create a bounding box from the line
-		bbox3 bbox;
-		bbox.begin_grow();
-		bbox.grow(line.getOrigin());
-		bbox.grow(line.getPoint(dist));
-		const int ownId = 0xffff;
-
 		// initialize collision report handler
 		checkReportHandler.beginFrame();
 
-		// go through all attached collide objects
-		for (attached_list_iterator co = attached_list.begin(); co != attached_list.end(); ++co)
+		// walk the query tree along the ray, nearest objects first
+		RayQuery query(*this, line, collType, collClass);
+		mQueryTree.rayCast(line, dist, query);
+		if (query.hasClosest)
 		{
-			Vector3 coMin = (*co)->minv;
-			Vector3 coMax = (*co)->maxv;
-			// see if we have overlaps in all 3 dimensions
-			if (intervalOverlap(bbox.vmin.x,bbox.vmax.x,coMin.x,coMax.x) &&
-				intervalOverlap(bbox.vmin.y,bbox.vmax.y,coMin.y,coMax.y) &&
-				intervalOverlap(bbox.vmin.z,bbox.vmax.z,coMin.z,coMax.z) )
-			{
-				// see if the candidate is in the ignore types set
-				CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass, (*co)->getCollClass());
-				if (COLLTYPE_IGNORE == ct) 
-				{
-					continue;
-				}
-
-
-				// check collision
-				ICollisionShape* shape = (*co)->getShape();
-				if (shape)
-				{
-					checkReportHandler.mTotalObjObjTests++;
-					CollisionPair cp;
-					bool ret = shape->rayCheck(collType, (*co)->getTransform(), line, dist, cp, mRayCulling);
-					checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
-					checkReportHandler.mTotalBVBVTests += cp.numBVPrimTests;
-					if (ret)
-					{
-						cp.this_object = (*co);
-						cp.other_object = (*co);
-						checkReportHandler.addCollision(cp, ownId, (*co)->id);
-						if (COLLTYPE_QUICK == collType)
-						{
-							// break out of loop
-							break;
-						}
-					}
-				}
-			}
+			checkReportHandler.addCollision(query.closest, 0xffff, query.closest.this_object->id);
 		}
 		checkReportHandler.endFrame();
 
-		//if (COLLTYPE_CONTACT == collType) // FIXME!
-		//{
-		//	// get closest contact only
-		//	return checkReportHandler.getClosestCollision(line.getOrigin(), cpPtr);
-		//}
-		//else
-		//{
-			// get all contacts (unsorted)
-			return checkReportHandler.getAllCollisions(cpPtr);
-		//}
+		// for COLLTYPE_CONTACT only the closest contact was added
+		return checkReportHandler.getAllCollisions(cpPtr);
 	}
 
 	/// Test a sphere against the collide objects in the collide context.
@@ -580,56 +647,51 @@ namespace OgreOpcode
 		// initialize collision report handler
 		checkReportHandler.beginFrame();
 
-		// go through all attached collide objects
+		// go through the attached collide objects overlapping the sphere's bounding box
 		sphere s0;
-		for (attached_list_iterator co = attached_list.begin(); co != attached_list.end(); ++co)
+		findCandidates(bbox.vmin, bbox.vmax);
+		for (attached_list_iterator co = mQueryCandidates.begin(); co != mQueryCandidates.end(); ++co)
 		{
-			// see if we have overlaps in all 3 dimensions
-			if ((bbox.vmin.x < (*co)->maxv.x) && (bbox.vmax.x > (*co)->minv.x) &&
-				(bbox.vmin.y < (*co)->maxv.y) && (bbox.vmax.y > (*co)->minv.y) &&
-				(bbox.vmin.z < (*co)->maxv.z) && (bbox.vmax.z > (*co)->minv.z))
+			// see if the candidate is in the ignore types set
+			CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass, (*co)->getCollClass());
+			if (COLLTYPE_IGNORE == ct)
+			{
+				continue;
+			}
+
+			checkReportHandler.mTotalObjObjTests++;
+			if (COLLTYPE_QUICK == ct)
 			{
-				// see if the candidate is in the ignore types set
-				CollisionType ct = CollisionManager::getSingletonPtr()->queryCollType(collClass, (*co)->getCollClass());
-				if (COLLTYPE_IGNORE == ct)
+				// do sphere-sphere collision check
+				const Matrix4 coTrans = (*co)->getTransform();
+				//s0.set(coTrans[0][3], coTrans[1][3], coTrans[2][3], (*co)->getRadius());
+				s0.set((*co)->getShape()->getCenter(), (*co)->getRadius());
+				checkReportHandler.mTotalBVBVTests++;
+				if (ball.intersects(s0))
 				{
-					continue;
+					CollisionPair cp;
+					cp.this_object = (*co);
+					cp.other_object = (*co);
+					checkReportHandler.addCollision(cp, ownId, (*co)->id);
 				}
-
-				checkReportHandler.mTotalObjObjTests++;
-				if (COLLTYPE_QUICK == ct)
+			}
+			else
+			{
+				// do sphere-shape collision check
+				ICollisionShape* shape = (*co)->getShape();
+				if (shape)
 				{
-					// do sphere-sphere collision check
-					const Matrix4 coTrans = (*co)->getTransform();
-					//s0.set(coTrans[0][3], coTrans[1][3], coTrans[2][3], (*co)->getRadius());
-					s0.set((*co)->getShape()->getCenter(), (*co)->getRadius());
-					checkReportHandler.mTotalBVBVTests++;
-					if (ball.intersects(s0))
+					CollisionPair cp;
+					bool ret = shape->sphereCheck(collType, (*co)->getTransform(), theSphere, cp);
+					checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
+					checkReportHandler.mTotalBVPrimTests += cp.numBVPrimTests;
+					if (ret)
 					{
-						CollisionPair cp;
 						cp.this_object = (*co);
 						cp.other_object = (*co);
 						checkReportHandler.addCollision(cp, ownId, (*co)->id);
 					}
 				}
-				else
-				{
-					// do sphere-shape collision check
-					ICollisionShape* shape = (*co)->getShape();
-					if (shape)
-					{
-						CollisionPair cp;
-						bool ret = shape->sphereCheck(collType, (*co)->getTransform(), theSphere, cp);
-						checkReportHandler.mTotalBVBVTests += cp.numBVBVTests;
-						checkReportHandler.mTotalBVPrimTests += cp.numBVPrimTests;
-						if (ret)
-						{
-							cp.this_object = (*co);
-							cp.other_object = (*co);
-							checkReportHandler.addCollision(cp, ownId, (*co)->id);
-						}
-					}
-				}
 			}
 		}
 		checkReportHandler.endFrame();
@@ -104,6 +104,7 @@ namespace OgreOpcode
 		}
 		m_tdelta = t;
 
+		mContext->updateObjectBounds(this);
 	}
 
 	bool CollisionObject::contact(CollisionObject *other,     // the other object
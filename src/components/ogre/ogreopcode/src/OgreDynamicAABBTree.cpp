@@ -0,0 +1,453 @@
+///////////////////////////////////////////////////////////////////////////////
+///  @file OgreDynamicAABBTree.cpp
+///  @brief A dynamic bounding volume tree used for spatial queries in a CollisionContext.
+///
+///  @author The OgreOpcode Team
+///
+///////////////////////////////////////////////////////////////////////////////
+///
+///  This file is part of OgreOpcode.
+///
+///  OgreOpcode is free software; you can redistribute it and/or
+///  modify it under the terms of the GNU Lesser General Public
+///  License as published by the Free Software Foundation; either
+///  version 2.1 of the License, or (at your option) any later version.
+///
+///  OgreOpcode is distributed in the hope that it will be useful,
+///  but WITHOUT ANY WARRANTY; without even the implied warranty of
+///  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+///  Lesser General Public License for more details.
+///
+///  You should have received a copy of the GNU Lesser General Public
+///  License along with OgreOpcode; if not, write to the Free Software
+///  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "OgreDynamicAABBTree.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace Ogre;
+
+namespace OgreOpcode
+{
+	namespace Details
+	{
+		DynamicAABBTree::DynamicAABBTree(Real margin) :
+		mRoot(NullNode),
+		mFreeList(NullNode),
+		mProxyCount(0),
+		mMargin(margin)
+		{
+		}
+
+		int DynamicAABBTree::allocateNode()
+		{
+			if (mFreeList == NullNode)
+			{
+				Node node;
+				node.userData = 0;
+				node.parent = NullNode;
+				node.child1 = NullNode;
+				node.child2 = NullNode;
+				node.height = -1;
+				mNodes.push_back(node);
+				mFreeList = static_cast<int>(mNodes.size()) - 1;
+			}
+			int nodeId = mFreeList;
+			Node& node = mNodes[nodeId];
+			mFreeList = node.parent;
+			node.userData = 0;
+			node.parent = NullNode;
+			node.child1 = NullNode;
+			node.child2 = NullNode;
+			node.height = 0;
+			return nodeId;
+		}
+
+		void DynamicAABBTree::freeNode(int nodeId)
+		{
+			Node& node = mNodes[nodeId];
+			node.parent = mFreeList;
+			node.height = -1;
+			node.userData = 0;
+			mFreeList = nodeId;
+		}
+
+		int DynamicAABBTree::createProxy(const Vector3& minv, const Vector3& maxv, void* userData)
+		{
+			int proxyId = allocateNode();
+			Vector3 margin(mMargin, mMargin, mMargin);
+			Node& node = mNodes[proxyId];
+			node.minv = minv - margin;
+			node.maxv = maxv + margin;
+			node.userData = userData;
+			node.height = 0;
+			insertLeaf(proxyId);
+			++mProxyCount;
+			return proxyId;
+		}
+
+		void DynamicAABBTree::destroyProxy(int proxyId)
+		{
+			assert(proxyId >= 0 && proxyId < static_cast<int>(mNodes.size()));
+			assert(mNodes[proxyId].isLeaf() && mNodes[proxyId].height == 0);
+			removeLeaf(proxyId);
+			freeNode(proxyId);
+			--mProxyCount;
+		}
+
+		bool DynamicAABBTree::moveProxy(int proxyId, const Vector3& minv, const Vector3& maxv)
+		{
+			assert(proxyId >= 0 && proxyId < static_cast<int>(mNodes.size()));
+			Node& node = mNodes[proxyId];
+			if (node.minv.x <= minv.x && node.minv.y <= minv.y && node.minv.z <= minv.z &&
+				node.maxv.x >= maxv.x && node.maxv.y >= maxv.y && node.maxv.z >= maxv.z)
+			{
+				return false;
+			}
+			removeLeaf(proxyId);
+			Vector3 margin(mMargin, mMargin, mMargin);
+			// Note that removeLeaf doesn't reallocate, so the reference is still valid.
+			node.minv = minv - margin;
+			node.maxv = maxv + margin;
+			insertLeaf(proxyId);
+			return true;
+		}
+
+		int DynamicAABBTree::getHeight() const
+		{
+			if (mRoot == NullNode)
+			{
+				return 0;
+			}
+			return mNodes[mRoot].height;
+		}
+
+		void DynamicAABBTree::clear()
+		{
+			mNodes.clear();
+			mRoot = NullNode;
+			mFreeList = NullNode;
+			mProxyCount = 0;
+		}
+
+		bool DynamicAABBTree::rayIntersectsBox(const Vector3& origin, const Vector3& inverseDirection, const Vector3& minv, const Vector3& maxv, Real maxDistance, Real& entryDistance)
+		{
+			Real tmin = 0;
+			Real tmax = maxDistance;
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				if (std::numeric_limits<Real>::has_infinity && inverseDirection[axis] == std::numeric_limits<Real>::infinity())
+				{
+					// The ray is parallel to the slab; it either always or never overlaps it.
+					if (origin[axis] < minv[axis] || origin[axis] > maxv[axis])
+					{
+						return false;
+					}
+					continue;
+				}
+				Real t1 = (minv[axis] - origin[axis]) * inverseDirection[axis];
+				Real t2 = (maxv[axis] - origin[axis]) * inverseDirection[axis];
+				if (t1 > t2)
+				{
+					std::swap(t1, t2);
+				}
+				tmin = std::max(tmin, t1);
+				tmax = std::min(tmax, t2);
+				if (tmin > tmax)
+				{
+					return false;
+				}
+			}
+			entryDistance = tmin;
+			return true;
+		}
+
+		void DynamicAABBTree::insertLeaf(int leaf)
+		{
+			if (mRoot == NullNode)
+			{
+				mRoot = leaf;
+				mNodes[mRoot].parent = NullNode;
+				return;
+			}
+
+			// Find the best sibling, descending towards the child which would increase the surface area the least.
+			Vector3 leafMin = mNodes[leaf].minv;
+			Vector3 leafMax = mNodes[leaf].maxv;
+			int index = mRoot;
+			while (!mNodes[index].isLeaf())
+			{
+				const Node& node = mNodes[index];
+				int child1 = node.child1;
+				int child2 = node.child2;
+
+				Real area = surfaceArea(node.minv, node.maxv);
+				Vector3 combinedMin = node.minv;
+				Vector3 combinedMax = node.maxv;
+				combinedMin.makeFloor(leafMin);
+				combinedMax.makeCeil(leafMax);
+				Real combinedArea = surfaceArea(combinedMin, combinedMax);
+
+				// Cost of creating a new parent for this node and the new leaf.
+				Real cost = 2.0f * combinedArea;
+				// Minimum cost of pushing the leaf further down the tree.
+				Real inheritanceCost = 2.0f * (combinedArea - area);
+
+				Real costs[2];
+				int children[2] = { child1, child2 };
+				for (int i = 0; i < 2; ++i)
+				{
+					const Node& child = mNodes[children[i]];
+					Vector3 childMin = child.minv;
+					Vector3 childMax = child.maxv;
+					childMin.makeFloor(leafMin);
+					childMax.makeCeil(leafMax);
+					if (child.isLeaf())
+					{
+						costs[i] = surfaceArea(childMin, childMax) + inheritanceCost;
+					}
+					else
+					{
+						costs[i] = (surfaceArea(childMin, childMax) - surfaceArea(child.minv, child.maxv)) + inheritanceCost;
+					}
+				}
+
+				if (cost < costs[0] && cost < costs[1])
+				{
+					break;
+				}
+				index = costs[0] < costs[1] ? child1 : child2;
+			}
+
+			int sibling = index;
+
+			// Create a new parent for the sibling and the leaf.
+			int oldParent = mNodes[sibling].parent;
+			int newParent = allocateNode();
+			Node& parentNode = mNodes[newParent];
+			parentNode.parent = oldParent;
+			parentNode.minv = mNodes[sibling].minv;
+			parentNode.maxv = mNodes[sibling].maxv;
+			parentNode.minv.makeFloor(leafMin);
+			parentNode.maxv.makeCeil(leafMax);
+			parentNode.height = mNodes[sibling].height + 1;
+			parentNode.child1 = sibling;
+			parentNode.child2 = leaf;
+
+			if (oldParent != NullNode)
+			{
+				if (mNodes[oldParent].child1 == sibling)
+				{
+					mNodes[oldParent].child1 = newParent;
+				}
+				else
+				{
+					mNodes[oldParent].child2 = newParent;
+				}
+			}
+			else
+			{
+				mRoot = newParent;
+			}
+			mNodes[sibling].parent = newParent;
+			mNodes[leaf].parent = newParent;
+
+			refitAncestors(mNodes[leaf].parent);
+		}
+
+		void DynamicAABBTree::removeLeaf(int leaf)
+		{
+			if (leaf == mRoot)
+			{
+				mRoot = NullNode;
+				return;
+			}
+
+			int parent = mNodes[leaf].parent;
+			int grandParent = mNodes[parent].parent;
+			int sibling = mNodes[parent].child1 == leaf ? mNodes[parent].child2 : mNodes[parent].child1;
+
+			if (grandParent != NullNode)
+			{
+				// Replace the parent with the sibling.
+				if (mNodes[grandParent].child1 == parent)
+				{
+					mNodes[grandParent].child1 = sibling;
+				}
+				else
+				{
+					mNodes[grandParent].child2 = sibling;
+				}
+				mNodes[sibling].parent = grandParent;
+				freeNode(parent);
+				refitAncestors(grandParent);
+			}
+			else
+			{
+				mRoot = sibling;
+				mNodes[sibling].parent = NullNode;
+				freeNode(parent);
+			}
+		}
+
+		void DynamicAABBTree::refitAncestors(int nodeId)
+		{
+			int index = nodeId;
+			while (index != NullNode)
+			{
+				index = balance(index);
+
+				Node& node = mNodes[index];
+				const Node& child1 = mNodes[node.child1];
+				const Node& child2 = mNodes[node.child2];
+
+				node.height = 1 + std::max(child1.height, child2.height);
+				node.minv = child1.minv;
+				node.maxv = child1.maxv;
+				node.minv.makeFloor(child2.minv);
+				node.maxv.makeCeil(child2.maxv);
+
+				index = node.parent;
+			}
+		}
+
+		/// Performs a left or right rotation if the node is imbalanced.
+		/// Returns the new root of the subtree.
+		int DynamicAABBTree::balance(int iA)
+		{
+			Node& A = mNodes[iA];
+			if (A.isLeaf() || A.height < 2)
+			{
+				return iA;
+			}
+
+			int iB = A.child1;
+			int iC = A.child2;
+			Node& B = mNodes[iB];
+			Node& C = mNodes[iC];
+
+			int balanceFactor = C.height - B.height;
+
+			// Rotate C up
+			if (balanceFactor > 1)
+			{
+				int iF = C.child1;
+				int iG = C.child2;
+				Node& F = mNodes[iF];
+				Node& G = mNodes[iG];
+
+				// Swap A and C
+				C.child1 = iA;
+				C.parent = A.parent;
+				A.parent = iC;
+
+				// A's old parent should point to C
+				if (C.parent != NullNode)
+				{
+					if (mNodes[C.parent].child1 == iA)
+					{
+						mNodes[C.parent].child1 = iC;
+					}
+					else
+					{
+						mNodes[C.parent].child2 = iC;
+					}
+				}
+				else
+				{
+					mRoot = iC;
+				}
+
+				// Rotate
+				if (F.height > G.height)
+				{
+					C.child2 = iF;
+					A.child2 = iG;
+					G.parent = iA;
+					A.minv = B.minv; A.minv.makeFloor(G.minv);
+					A.maxv = B.maxv; A.maxv.makeCeil(G.maxv);
+					C.minv = A.minv; C.minv.makeFloor(F.minv);
+					C.maxv = A.maxv; C.maxv.makeCeil(F.maxv);
+					A.height = 1 + std::max(B.height, G.height);
+					C.height = 1 + std::max(A.height, F.height);
+				}
+				else
+				{
+					C.child2 = iG;
+					A.child2 = iF;
+					F.parent = iA;
+					A.minv = B.minv; A.minv.makeFloor(F.minv);
+					A.maxv = B.maxv; A.maxv.makeCeil(F.maxv);
+					C.minv = A.minv; C.minv.makeFloor(G.minv);
+					C.maxv = A.maxv; C.maxv.makeCeil(G.maxv);
+					A.height = 1 + std::max(B.height, F.height);
+					C.height = 1 + std::max(A.height, G.height);
+				}
+				return iC;
+			}
+
+			// Rotate B up
+			if (balanceFactor < -1)
+			{
+				int iD = B.child1;
+				int iE = B.child2;
+				Node& D = mNodes[iD];
+				Node& E = mNodes[iE];
+
+				// Swap A and B
+				B.child1 = iA;
+				B.parent = A.parent;
+				A.parent = iB;
+
+				// A's old parent should point to B
+				if (B.parent != NullNode)
+				{
+					if (mNodes[B.parent].child1 == iA)
+					{
+						mNodes[B.parent].child1 = iB;
+					}
+					else
+					{
+						mNodes[B.parent].child2 = iB;
+					}
+				}
+				else
+				{
+					mRoot = iB;
+				}
+
+				// Rotate
+				if (D.height > E.height)
+				{
+					B.child2 = iD;
+					A.child1 = iE;
+					E.parent = iA;
+					A.minv = C.minv; A.minv.makeFloor(E.minv);
+					A.maxv = C.maxv; A.maxv.makeCeil(E.maxv);
+					B.minv = A.minv; B.minv.makeFloor(D.minv);
+					B.maxv = A.maxv; B.maxv.makeCeil(D.maxv);
+					A.height = 1 + std::max(C.height, E.height);
+					B.height = 1 + std::max(A.height, D.height);
+				}
+				else
+				{
+					B.child2 = iE;
+					A.child1 = iD;
+					D.parent = iA;
+					A.minv = C.minv; A.minv.makeFloor(D.minv);
+					A.maxv = C.maxv; A.maxv.makeCeil(D.maxv);
+					B.minv = A.minv; B.minv.makeFloor(E.minv);
+					B.maxv = A.maxv; B.maxv.makeCeil(E.maxv);
+					A.height = 1 + std::max(C.height, D.height);
+					B.height = 1 + std::max(A.height, E.height);
+				}
+				return iB;
+			}
+
+			return iA;
+		}
+	}
+}
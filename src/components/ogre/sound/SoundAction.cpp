@@ -100,6 +100,8 @@ namespace OgreView
 				}
 				mInstance->setMotionProvider(this);
 				mInstance->setIsLooping(mIsLooping);
+				//Looping sounds are the movement sounds, which are less important than the sounds of actions when there aren't enough sources for all.
+				mInstance->setPriority(mIsLooping ? SoundInstance::PRIORITY_AMBIENT : SoundInstance::PRIORITY_ACTION);
 				//If the sound is set not to loop, we need to listen for when it's done playing and remove the instance once it's done (to save on sound resources).
 				if (!mIsLooping) {
 					mInstance->EventPlayComplete.connect(sigc::mem_fun(*this, &SoundAction::SoundInstance_PlayComplete));
@@ -28,11 +28,12 @@ namespace Ember
 
     void
     SoundDefinition::setup(const std::string& filename,
-        SoundGeneral::SoundSampleType type, float volume)
+        SoundGeneral::SoundSampleType type, float volume, bool isStreamed)
     {
       mFilename = filename;
       mSampleType = type;
       mVolume = volume;
+      mIsStreamed = isStreamed;
     }
 
     const std::string&
@@ -52,5 +53,11 @@ namespace Ember
     {
       return mVolume;
     }
+
+    bool
+    SoundDefinition::getIsStreamed() const
+    {
+      return mIsStreamed;
+    }
   }
 }
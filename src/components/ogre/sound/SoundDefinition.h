@@ -40,8 +40,9 @@ public:
 	* @param type The Format of the sample (OGG/WAV/PCM)
 	* @param playLocal Defines if the sound is 2D or 3D
 	* @param volume The sample volume to be played
+	* @param isStreamed Whether the sample should be streamed rather than loaded into memory at once
 	*/
-	void setup(const std::string& filename, SoundGeneral::SoundSampleType type, float volume);
+	void setup(const std::string& filename, SoundGeneral::SoundSampleType type, float volume, bool isStreamed = false);
 
 	/**
 	* Return filename
@@ -58,6 +59,11 @@ public:
 	*/
 	float getVolume() const;
 
+	/**
+	* Return whether the sample should be streamed
+	*/
+	bool getIsStreamed() const;
+
 protected:
 	
 	/**
@@ -76,6 +82,12 @@ protected:
 	*/
 	float mVolume;
 
+	/**
+	* If true, the sample is streamed rather than loaded into memory at once.
+	* This is suitable for long sounds, such as music.
+	*/
+	bool mIsStreamed;
+
 };
 
 }
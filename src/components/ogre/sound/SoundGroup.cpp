@@ -39,31 +39,86 @@ namespace OgreView
 {
 
 SoundGroupBinding::SoundGroupBinding(SoundSource& source, SoundGroup& soundGroup)
-: SoundBinding(source), mSoundGroup(soundGroup)
+: SoundBinding(source), mSoundGroup(soundGroup), mIsQueued(false)
 {
 	const SoundGroup::SampleStore& samples = mSoundGroup.getSamples();
-	std::unique_ptr<ALuint> buffers(new ALuint[samples.size()]);
-	ALuint* pbuffers = buffers.get();
-	int i = 0;
-	//get the buffers and bind the source to them
 	for (SoundGroup::SampleStore::const_iterator I = samples.begin(); I != samples.end(); ++I) 
 	{
-		BaseSoundSample::BufferStore sampleBuffers = (*I)->getBuffers();
-		pbuffers[i] = *(sampleBuffers.begin());
-		++i;
+		(*I)->addUser();
 	}
-	alSourceQueueBuffers(source.getALSource(), i, pbuffers);
-// 	alSourcei(source.getALSource(), AL_BUFFER, sample.getBuffer());
-
+	queueBuffers();
 }
 
 SoundGroupBinding::~SoundGroupBinding()
 {
+	const SoundGroup::SampleStore& samples = mSoundGroup.getSamples();
+	for (SoundGroup::SampleStore::const_iterator I = samples.begin(); I != samples.end(); ++I) 
+	{
+		(*I)->removeUser();
+	}
 }
 
 void SoundGroupBinding::update()
 {
-	//TODO: add support for streaming sounds
+	//The samples are loaded in the background, so we might have to wait a bit before we can queue them.
+	if (!mIsQueued) {
+		queueBuffers();
+	}
+}
+
+bool SoundGroupBinding::isReady() const
+{
+	return mIsQueued;
+}
+
+void SoundGroupBinding::sourceAssignmentChanged()
+{
+	mIsQueued = false;
+	queueBuffers();
+}
+
+float SoundGroupBinding::getDuration() const
+{
+	float duration = 0;
+	const SoundGroup::SampleStore& samples = mSoundGroup.getSamples();
+	for (SoundGroup::SampleStore::const_iterator I = samples.begin(); I != samples.end(); ++I) 
+	{
+		float sampleDuration = (*I)->getDuration();
+		if (sampleDuration < 0) {
+			return -1.0f;
+		}
+		duration += sampleDuration;
+	}
+	return duration;
+}
+
+void SoundGroupBinding::queueBuffers()
+{
+	if (mSource.isVirtual()) {
+		return;
+	}
+	const SoundGroup::SampleStore& samples = mSoundGroup.getSamples();
+	std::vector<ALuint> buffers;
+	//get the buffers and bind the source to them
+	for (SoundGroup::SampleStore::const_iterator I = samples.begin(); I != samples.end(); ++I) 
+	{
+		BaseSoundSample* sample = *I;
+		if (sample->getLoadingState() == BaseSoundSample::LS_LOADING) {
+			//Wait until all samples are loaded.
+			return;
+		}
+		if (sample->isLoaded()) {
+			BaseSoundSample::BufferStore sampleBuffers = sample->getBuffers();
+			if (!sampleBuffers.empty()) {
+				buffers.push_back(sampleBuffers.front());
+			}
+		}
+	}
+	if (!buffers.empty()) {
+		alSourceQueueBuffers(mSource.getALSource(), buffers.size(), &buffers[0]);
+		SoundGeneral::checkAlError("Queuing sound group buffers.");
+	}
+	mIsQueued = true;
 }
 
 
@@ -148,7 +203,7 @@ void SoundGroupBinding::update()
 	
 	void SoundGroup::addSound(const SoundDefinition& soundDef)
 	{
-		BaseSoundSample* soundSample = EmberServices::getSingleton().getSoundService().createOrRetrieveSoundSample(soundDef.getFilename());
+		BaseSoundSample* soundSample = EmberServices::getSingleton().getSoundService().createOrRetrieveSoundSample(soundDef.getFilename(), soundDef.getIsStreamed());
 		if (soundSample)
 		{
 			mSamples.push_back(soundSample);
@@ -157,6 +212,16 @@ void SoundGroupBinding::update()
 	
 	bool SoundGroup::bindToInstance(SoundInstance* instance)
 	{
+		//A group with only one sample can use the binding of the sample directly, which is required for streamed samples.
+		if (mSamples.size() == 1) {
+			instance->bind(mSamples.front()->createBinding(instance->getSource()));
+			return true;
+		}
+		for (SampleStore::const_iterator I = mSamples.begin(); I != mSamples.end(); ++I) {
+			if ((*I)->getNumberOfBuffers() == 0) {
+				S_LOG_WARNING("The streamed sample '" << (*I)->getPath() << "' can't be played as part of a sound group with multiple samples; it will be skipped.");
+			}
+		}
 		SoundGroupBinding* binding = new SoundGroupBinding(instance->getSource(), *this);
 		instance->bind(binding);
 		return true;
@@ -60,12 +60,38 @@ public:
 	 * @brief If we have any streaming sounds we should update the buffers accordingly here.
 	 */
 	virtual void update();
+
+	/**
+	 * @brief Returns true once the buffers of all samples have been queued.
+	 */
+	virtual bool isReady() const;
+
+	/**
+	 * @brief Queues the buffers again when an OpenAL source has been assigned.
+	 */
+	virtual void sourceAssignmentChanged();
+
+	/**
+	 * @brief Gets the total duration of all samples in the group.
+	 * @return The duration in seconds, or a negative value if any sample isn't loaded.
+	 */
+	virtual float getDuration() const;
 	
 protected:
 	/**
 	 * @brief The sound group which contains the definitions used by this binding.
 	 */
 	SoundGroup& mSoundGroup;
+
+	/**
+	 * @brief True once the buffers have been queued on the source.
+	 */
+	bool mIsQueued;
+
+	/**
+	 * @brief Queues the buffers of all samples on the source, if they are loaded and the source has an OpenAL source assigned.
+	 */
+	void queueBuffers();
 };
 
 /**
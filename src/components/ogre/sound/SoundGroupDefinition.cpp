@@ -42,10 +42,10 @@ SoundGroupDefinition::~SoundGroupDefinition()
 // 	for (SoundDefinitionStore::
 }
 
-void SoundGroupDefinition::insertSample(const std::string& name, SoundGeneral::SoundSampleType type, float volume)
+void SoundGroupDefinition::insertSample(const std::string& name, SoundGeneral::SoundSampleType type, float volume, bool isStreamed)
 {
 	SoundDefinition newDef;
-	newDef.setup(name, type, volume);
+	newDef.setup(name, type, volume, isStreamed);
 	mSamples.push_back(newDef);
 
 	S_LOG_INFO("\t-Sample " << name << " created.");
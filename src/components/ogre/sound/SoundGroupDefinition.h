@@ -47,10 +47,11 @@ namespace Ember
 
       /**
        * Insert a sound sample into this group definition
+       * @param isStreamed Whether the sample should be streamed.
        */
       void
       insertSample(const std::string& name, SoundGeneral::SoundSampleType type,
-          float volume);
+          float volume, bool isStreamed = false);
 
       /**
        * @brief Accessor for the sound definitions store.
@@ -96,6 +96,7 @@ namespace Ember
       const char* format = objNode->Attribute("format");
 // 	const char* playsin = objNode->Attribute("playsIn");
       const char* volume = objNode->Attribute("volume");
+      const char* stream = objNode->Attribute("stream");
 
       if (!filename)
         return;
@@ -123,7 +124,9 @@ namespace Ember
           soundVolume = atof(volume);
         }
 
-      grp->insertSample(filename, type, soundVolume);
+      bool isStreamed = stream && !stricmp(stream, "true");
+
+      grp->insertSample(filename, type, soundVolume, isStreamed);
 
     }
 
@@ -69,13 +69,17 @@ namespace Ember
               }
             GeometryPtrVector geometries;
             geometries.push_back(geometry);
+            //Update all shaders in one task, so that the material of the page only is compiled once.
+            std::vector<const TerrainShader*> shaders;
             for (ShaderStore::const_iterator J = mShaders.begin();
                 J != mShaders.end(); ++J)
               {
-                context.executeTask(
-                    new TerrainShaderUpdateTask(geometries, J->second, mAreas,
-                        mHandler.EventLayerUpdated));
+                shaders.push_back(J->second);
               }
+            context.executeTask(
+                new TerrainShaderUpdateTask(geometries, shaders, mAreas,
+                    mHandler.EventLayerUpdated,
+                    mHandler.getMaterialCompilationQueue()));
           }
         context.executeTask(
             new HeightMapUpdateTask(mHeightMapBufferProvider, mHeightMap,
@@ -89,6 +93,7 @@ namespace Ember
             if (bridge.get())
               {
                 bridge->updateTerrain(*geometry);
+                mBridges.push_back(bridge);
               }
           }
 
@@ -105,6 +110,13 @@ namespace Ember
       void
       GeometryUpdateTask::executeTaskInMainThread()
       {
+        //Let the bridges install any data rebuilt in the background thread before anyone reacts to the update.
+        for (std::vector<ITerrainPageBridgePtr>::const_iterator I =
+            mBridges.begin(); I != mBridges.end(); ++I)
+          {
+            (*I)->terrainPageUpdated();
+          }
+        mBridges.clear();
         mHandler.EventAfterTerrainUpdate(mAreas, mPages);
 
       }
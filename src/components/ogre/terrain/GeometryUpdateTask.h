@@ -56,6 +56,11 @@ private:
 	HeightMap& mHeightMap;
 	std::set<TerrainPage*> mPages;
 
+	/**
+	 * @brief The bridges which were updated in the background thread, and which should be notified in the main thread.
+	 */
+	std::vector<ITerrainPageBridgePtr> mBridges;
+
 };
 
 }
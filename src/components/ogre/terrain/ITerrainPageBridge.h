@@ -75,6 +75,14 @@ namespace Ember
         virtual void
         terrainPageReady() = 0;
 
+        /**
+         *    @brief Notifies class in the ogre side about the page having been updated, after a call to updateTerrain() for an already existing page.
+         *
+         * This is called in the main thread, so any data prepared by updateTerrain() in the background thread can be handed over here.
+         */
+        virtual void
+        terrainPageUpdated() = 0;
+
         /**
          * @brief Accessor to the terrain page this bridge is bound to.
          * @return A pointer to the terrain page, or null if no page yet has been bound.
@@ -25,11 +25,23 @@
 #endif
 
 #include "Map.h"
-#include <OgreCamera.h>
+#include "TerrainHandler.h"
+#include "TerrainPage.h"
+#include "TerrainShader.h"
+#include "TerrainLayerDefinition.h"
+
+#include "framework/LoggingInstance.h"
+
 #include <OgreTextureManager.h>
-#include <OgreRenderTexture.h>
-#include <OgreViewport.h>
 #include <OgreHardwarePixelBuffer.h>
+#include <OgreImage.h>
+#include <OgreResourceGroupManager.h>
+
+#include <wfmath/point.h>
+#include <wfmath/intersect.h>
+
+#include <algorithm>
+#include <cmath>
 
 namespace Ember
 {
@@ -39,10 +51,50 @@ namespace Ember
     namespace Terrain
     {
 
-      Map::Map(Ogre::SceneManager& sceneManager) :
-          mRenderTexture(0), mTexturePixelSize(256), mMetersPerPixel(1.0f), mCamera(
-              *this, sceneManager), mView(*this, mCamera)
-      {
+      namespace
+      {
+        /**
+         * @brief The colour used for layers whose texture can't be loaded.
+         */
+        const Ogre::ColourValue FALLBACK_LAYER_COLOUR(0.5f, 0.5f, 0.45f);
+
+        /**
+         * @brief The max size of a tile, in pixels.
+         */
+        const unsigned int MAX_TILE_SIZE = 256;
+
+        bool
+        compareLayers(const MapTileLayer& lhs, const MapTileLayer& rhs)
+        {
+          return lhs.surfaceIndex < rhs.surfaceIndex;
+        }
+
+        /**
+         * @brief Gets the range of pixels whose centers are within a range of world coordinates.
+         */
+        void
+        getPixelRange(float origin, float metersPerPixel, float low, float high,
+            int size, int& start, int& end)
+        {
+          start = std::max(0,
+              static_cast<int>(std::ceil(
+                  ((low - origin) / metersPerPixel) - 0.5f)));
+          end = std::min(size,
+              static_cast<int>(std::ceil(
+                  ((high - origin) / metersPerPixel) - 0.5f)));
+        }
+      }
+
+      Map::Map(TerrainHandler& terrainHandler) :
+          mTerrainHandler(terrainHandler), mTexturePixelSize(256), mMetersPerPixel(
+              1.0f), mPosition(0, 0), mView(*this), mLayersDirty(true)
+      {
+        mTerrainHandler.EventAfterTerrainUpdate.connect(
+            sigc::mem_fun(*this, &Map::terrainHandler_AfterTerrainUpdate));
+        mTerrainHandler.EventLayerUpdated.connect(
+            sigc::mem_fun(*this, &Map::terrainHandler_LayerUpdated));
+        mTerrainHandler.EventShaderCreated.connect(
+            sigc::mem_fun(*this, &Map::terrainHandler_ShaderCreated));
       }
 
       Map::~Map()
@@ -57,13 +109,6 @@ namespace Ember
       Map::initialize()
       {
         createTexture();
-        setupCamera();
-      }
-
-      void
-      Map::setupCamera()
-      {
-        mCamera.setRenderTarget(mRenderTexture);
         reposition(Ogre::Vector2(0, 0));
       }
 
@@ -73,26 +118,80 @@ namespace Ember
         //don't use alpha for our map texture
         mTexture = Ogre::TextureManager::getSingleton().createManual(
             "TerrainMap", "Gui", Ogre::TEX_TYPE_2D, mTexturePixelSize,
-            mTexturePixelSize, 0, Ogre::PF_R8G8B8, Ogre::TU_RENDERTARGET);
-        mRenderTexture = mTexture->getBuffer()->getRenderTarget();
-        mRenderTexture->removeAllViewports();
-
-        mRenderTexture->setAutoUpdated(false);
-        //initially deactivate it until setActive(true) is called
-// 	mRenderTexture->setActive(false);
-
+            mTexturePixelSize, 0, Ogre::PF_R8G8B8,
+            Ogre::TU_DYNAMIC_WRITE_ONLY);
+        mPixels.resize(mTexturePixelSize * mTexturePixelSize * 3);
       }
 
       void
       Map::render()
       {
-        mCamera.render();
+        if (mTexture.isNull())
+          {
+            return;
+          }
+        const WFMath::AxisBox<2> bounds = getWorldBounds();
+        requestTiles(bounds, true);
+
+        //Areas without any tiles are left white.
+        std::fill(mPixels.begin(), mPixels.end(), 255);
+
+        //Note that the map is in Ogre space, where the z axis is the inverted y axis of the world. The first row of the texture is the northernmost.
+        const int size = static_cast<int>(mTexturePixelSize);
+        const float left = mPosition.x - (getResolutionMeters() / 2);
+        const float top = -mPosition.y + (getResolutionMeters() / 2);
+        for (TileStore::const_iterator I = mTiles.begin(); I != mTiles.end();
+            ++I)
+          {
+            const MapTile& tile = I->second;
+            if (tile.pixels.empty()
+                || !WFMath::Intersect(tile.extent, bounds, false))
+              {
+                continue;
+              }
+            const float tileMetersPerPixel = (tile.extent.highCorner().x()
+                - tile.extent.lowCorner().x()) / tile.size;
+
+            int startColumn, endColumn, startRow, endRow;
+            getPixelRange(left, mMetersPerPixel, tile.extent.lowCorner().x(),
+                tile.extent.highCorner().x(), size, startColumn, endColumn);
+            getPixelRange(-top, mMetersPerPixel, -tile.extent.highCorner().y(),
+                -tile.extent.lowCorner().y(), size, startRow, endRow);
+
+            for (int row = startRow; row < endRow; ++row)
+              {
+                const float y = top - ((row + 0.5f) * mMetersPerPixel);
+                const unsigned int tileRow = std::min(
+                    static_cast<unsigned int>((tile.extent.highCorner().y() - y)
+                        / tileMetersPerPixel), tile.size - 1);
+                unsigned char* pixel = &mPixels[(row * size + startColumn) * 3];
+                const unsigned char* tileRowPixels = &tile.pixels[tileRow
+                    * tile.size * 3];
+                for (int column = startColumn; column < endColumn; ++column)
+                  {
+                    const float x = left + ((column + 0.5f) * mMetersPerPixel);
+                    const unsigned int tileColumn = std::min(
+                        static_cast<unsigned int>((x
+                            - tile.extent.lowCorner().x()) / tileMetersPerPixel),
+                        tile.size - 1);
+                    const unsigned char* tilePixel = tileRowPixels
+                        + (tileColumn * 3);
+                    *pixel++ = tilePixel[0];
+                    *pixel++ = tilePixel[1];
+                    *pixel++ = tilePixel[2];
+                  }
+              }
+          }
+
+        mTexture->getBuffer()->blitFromMemory(
+            Ogre::PixelBox(mTexturePixelSize, mTexturePixelSize, 1,
+                Ogre::PF_BYTE_RGB, &mPixels[0]));
       }
 
       void
       Map::reposition(const Ogre::Vector2& pos)
       {
-        mCamera.reposition(pos);
+        mPosition = pos;
       }
 
       void
@@ -101,16 +200,10 @@ namespace Ember
         reposition(Ogre::Vector2(x, y));
       }
 
-      void
-      Map::setDistance(float distance)
-      {
-        mCamera.setDistance(distance);
-      }
-
-      float
-      Map::getDistance() const
+      const Ogre::Vector2&
+      Map::getPosition() const
       {
-        return mCamera.getDistance();
+        return mPosition;
       }
 
       Ogre::TexturePtr
@@ -119,12 +212,6 @@ namespace Ember
         return mTexture;
       }
 
-      Ogre::RenderTexture*
-      Map::getRenderTexture() const
-      {
-        return mRenderTexture;
-      }
-
       float
       Map::getResolution() const
       {
@@ -153,10 +240,197 @@ namespace Ember
         return mView;
       }
 
-      MapView::MapView(Map& map, MapCamera& mapCamera) :
+      WFMath::AxisBox<2>
+      Map::getWorldBounds() const
+      {
+        const float halfSize = getResolutionMeters() / 2;
+        return WFMath::AxisBox<2>(
+            WFMath::Point<2>(mPosition.x - halfSize, -mPosition.y - halfSize),
+            WFMath::Point<2>(mPosition.x + halfSize, -mPosition.y + halfSize));
+      }
+
+      void
+      Map::requestTile(TerrainPage& page)
+      {
+        const Domain::TerrainIndex& index = page.getWFIndex();
+        if (mPendingTiles.count(index))
+          {
+            mStaleTiles.insert(index);
+            return;
+          }
+        mPendingTiles.insert(index);
+        const unsigned int tileSize = std::min(
+            static_cast<unsigned int>(mTerrainHandler.getPageMetersSize()),
+            MAX_TILE_SIZE);
+        mTerrainHandler.generateMapTile(page, getLayers(), tileSize,
+            sigc::mem_fun(*this, &Map::tileGenerated));
+      }
+
+      void
+      Map::requestTiles(const WFMath::AxisBox<2>& area, bool onlyMissing)
+      {
+        const float pageSize = mTerrainHandler.getPageMetersSize();
+        if (pageSize <= 0)
+          {
+            return;
+          }
+        std::set<TerrainPage*> pages;
+        //Step through the area one page at a time, making sure that the far edges are included.
+        for (float x = area.lowCorner().x();
+            x < area.highCorner().x() + pageSize; x += pageSize)
+          {
+            for (float y = area.lowCorner().y();
+                y < area.highCorner().y() + pageSize; y += pageSize)
+              {
+                TerrainPage* page = mTerrainHandler.getTerrainPageAtPosition(
+                    WFMath::Point<2>(std::min(x, area.highCorner().x()),
+                        std::min(y, area.highCorner().y())));
+                if (page)
+                  {
+                    pages.insert(page);
+                  }
+              }
+          }
+        for (std::set<TerrainPage*>::const_iterator I = pages.begin();
+            I != pages.end(); ++I)
+          {
+            const Domain::TerrainIndex& index = (*I)->getWFIndex();
+            if (!onlyMissing
+                || (!mTiles.count(index) && !mPendingTiles.count(index)))
+              {
+                requestTile(**I);
+              }
+          }
+      }
+
+      const MapTileLayerStore&
+      Map::getLayers()
+      {
+        if (mLayersDirty)
+          {
+            mLayers.clear();
+            const ShaderStore& shaders = mTerrainHandler.getAllShaders();
+            for (ShaderStore::const_iterator I = shaders.begin();
+                I != shaders.end(); ++I)
+              {
+                MapTileLayer layer;
+                layer.surfaceIndex = I->second->getTerrainIndex();
+                layer.colour = getTextureColour(
+                    I->second->getLayerDefinition().getDiffuseTextureName());
+                mLayers.push_back(layer);
+              }
+            //Layers are applied in the same order as when the terrain is rendered.
+            std::sort(mLayers.begin(), mLayers.end(), compareLayers);
+            mLayersDirty = false;
+          }
+        return mLayers;
+      }
+
+      Ogre::ColourValue
+      Map::getTextureColour(const std::string& textureName)
+      {
+        TextureColourStore::const_iterator I = mTextureColours.find(
+            textureName);
+        if (I != mTextureColours.end())
+          {
+            return I->second;
+          }
+        Ogre::ColourValue colour(FALLBACK_LAYER_COLOUR);
+        try
+          {
+            Ogre::Image image;
+            image.load(textureName,
+                Ogre::ResourceGroupManager::AUTODETECT_RESOURCE_GROUP_NAME);
+            //We only need the average, so there's no need to look at every pixel.
+            image.resize(16, 16);
+            Ogre::ColourValue sum(0, 0, 0, 0);
+            for (size_t y = 0; y < image.getHeight(); ++y)
+              {
+                for (size_t x = 0; x < image.getWidth(); ++x)
+                  {
+                    sum += image.getColourAt(x, y, 0);
+                  }
+              }
+            colour = sum / static_cast<float>(image.getWidth() * image.getHeight());
+            colour.a = 1.0f;
+          }
+        catch (const std::exception& ex)
+          {
+            S_LOG_WARNING(
+                "Could not load texture '" << textureName << "' for determining the map colour of a terrain layer." << ex);
+          }
+        mTextureColours.insert(TextureColourStore::value_type(textureName, colour));
+        return colour;
+      }
+
+      void
+      Map::tileGenerated(const MapTile& tile)
+      {
+        mPendingTiles.erase(tile.index);
+        mTiles[tile.index] = tile;
+        if (mStaleTiles.erase(tile.index))
+          {
+            TerrainPage* page = mTerrainHandler.getTerrainPageAtIndex(tile.index);
+            if (page)
+              {
+                requestTile(*page);
+              }
+          }
+        if (WFMath::Intersect(tile.extent, getWorldBounds(), false))
+          {
+            EventTilesUpdated();
+          }
+      }
+
+      void
+      Map::terrainHandler_AfterTerrainUpdate(
+          const std::vector<WFMath::AxisBox<2>>& areas,
+          const std::set<TerrainPage*>& pages)
+      {
+        for (std::set<TerrainPage*>::const_iterator I = pages.begin();
+            I != pages.end(); ++I)
+          {
+            requestTile(**I);
+          }
+      }
+
+      void
+      Map::terrainHandler_LayerUpdated(const TerrainShader* shader,
+          const AreaStore& areas)
+      {
+        if (areas.empty())
+          {
+            //The update can't be constrained to any areas, so all tiles need to be regenerated.
+            for (TileStore::const_iterator I = mTiles.begin();
+                I != mTiles.end(); ++I)
+              {
+                TerrainPage* page = mTerrainHandler.getTerrainPageAtIndex(
+                    I->first);
+                if (page)
+                  {
+                    requestTile(*page);
+                  }
+              }
+          }
+        else
+          {
+            for (AreaStore::const_iterator I = areas.begin(); I != areas.end();
+                ++I)
+              {
+                requestTiles(*I, false);
+              }
+          }
+      }
+
+      void
+      Map::terrainHandler_ShaderCreated(const TerrainShader& shader)
+      {
+        mLayersDirty = true;
+      }
+
+      MapView::MapView(Map& map) :
 //set it to invalid values so we'll force an update when it's repositioned
-          mFullBounds(1, 1, -1, -1), mMap(map), mMapCamera(mapCamera), mViewSize(
-              0.5)
+          mFullBounds(1, 1, -1, -1), mMap(map), mViewSize(0.5)
       {
       }
 
@@ -170,8 +444,8 @@ namespace Ember
             || pos.y - halfViewSizeMeters < mFullBounds.bottom
             || pos.y + halfViewSizeMeters > mFullBounds.top)
           {
-            mMapCamera.reposition(pos);
-            mMapCamera.render();
+            mMap.reposition(pos);
+            mMap.render();
 
             recalculateBounds();
 
@@ -211,7 +485,7 @@ namespace Ember
       void
       MapView::recalculateBounds()
       {
-        Ogre::Vector2 pos(mMapCamera.getPosition());
+        const Ogre::Vector2& pos(mMap.getPosition());
         mFullBounds.left = static_cast<int>(pos.x
             - (mMap.getResolutionMeters() / 2));
         mFullBounds.right = static_cast<int>(pos.x
@@ -230,196 +504,6 @@ namespace Ember
         EventBoundsChanged();
       }
 
-      MapCamera::MapCamera(Map& map, Ogre::SceneManager& manager) :
-          mMap(map), mViewport(0), mDistance(400), mLightning(manager)
-      {
-        mCamera = manager.createCamera("TerrainMapCamera");
-        mCamera->setPosition(Ogre::Vector3(0, 0, 0));
-        //look down
-        mCamera->pitch(Ogre::Degree(-90));
-        //we want really low LOD on this camera
-        mCamera->setLodBias(0.0001f);
-
-        setDistance(mDistance);
-
-// 	mCamera->setFOVy(Ogre::Degree(30));
-// 	mCamera->setProjectionType(Ogre::PT_ORTHOGRAPHIC);
-
-        mCamera->addQueryFlags(Ogre::SceneManager::WORLD_GEOMETRY_TYPE_MASK);
-
-      }
-
-      MapCamera::~MapCamera()
-      {
-        if (mCamera)
-          {
-            mCamera->getSceneManager()->destroyCamera(mCamera);
-          }
-      }
-
-      void
-      MapCamera::setRenderTarget(Ogre::RenderTarget* renderTarget)
-      {
-        mViewport = renderTarget->addViewport(mCamera);
-        mViewport->setBackgroundColour(Ogre::ColourValue::White);
-        //don't show the CEGUI
-        mViewport->setOverlaysEnabled(false);
-        mViewport->setShadowsEnabled(false);
-        mViewport->setSkiesEnabled(false);
-        mViewport->setClearEveryFrame(true);
-        mViewport->setMaterialScheme("Low"); //This will disable shadows etc.
-
-        mViewport->setVisibilityMask(
-            Ogre::SceneManager::WORLD_GEOMETRY_TYPE_MASK);
-      }
-
-      void
-      MapCamera::setDistance(float distance)
-      {
-        mDistance = distance;
-        const Ogre::Vector3& position(mCamera->getPosition());
-        mCamera->setPosition(position.x, distance, position.z);
-      }
-
-      float
-      MapCamera::getDistance() const
-      {
-        return mDistance;
-      }
-
-      void
-      MapCamera::reposition(const Ogre::Vector2& pos)
-      {
-        mCamera->setPosition(pos.x, mDistance, pos.y);
-      }
-
-      const Ogre::Vector2
-      MapCamera::getPosition() const
-      {
-        return Ogre::Vector2(mCamera->getPosition().x, mCamera->getPosition().z);
-      }
-
-      void
-      MapCamera::render()
-      {
-        mCamera->setNearClipDistance(1);
-        mCamera->setFarClipDistance(mDistance * 200);
-
-        mCamera->setProjectionType(Ogre::PT_ORTHOGRAPHIC);
-        mCamera->setOrthoWindow(mMap.getResolutionMeters(),
-            mMap.getResolutionMeters());
-        mCamera->setAspectRatio(1.0);
-          {
-            //use a RAII rendering instance so that we're sure to reset all settings of the scene manager that we change, even if something goes wrong here
-            Ogre::SceneManager* manager(mCamera->getSceneManager());
-            RenderingInstance instance(manager);
-            MapCameraLightningInstance lightningInstance(mLightning);
-
-            /*		manager->setSpecialCaseRenderQueueMode(Ogre::SceneManager::SCRQM_INCLUDE);
-             manager->addSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_WORLD_GEOMETRY_1);
-             manager->addSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_WORLD_GEOMETRY_2);
-             manager->addSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_6); //water*/
-
-            manager->setFog(Ogre::FOG_EXP2, Ogre::ColourValue(0, 0, 0, 0), 0.0f,
-                0.0f, 0.0f);
-            mViewport->update();
-// 		manager->removeSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_WORLD_GEOMETRY_1);
-// 		manager->removeSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_WORLD_GEOMETRY_2);
-// 		manager->removeSpecialCaseRenderQueue(Ogre::RENDER_QUEUE_6);
-
-          }
-      }
-
-      MapCameraLightning::MapCameraLightning(Ogre::SceneManager& sceneManager) :
-          mSceneManager(sceneManager)
-      {
-        mLight = sceneManager.createLight("MapFixedSunLight");
-        mLight->setType(Ogre::Light::LT_DIRECTIONAL);
-
-        mLight->setPosition(Ogre::Vector3(-500, 300, -350));
-        Ogre::Vector3 dir = -mLight->getPosition();
-        dir.normalise();
-        mLight->setDirection(dir);
-
-        mLight->setDiffuseColour(Ogre::ColourValue(0.8, 0.8, 0.6)); //yellow
-        //mSun->setSpecularColour(1, 1, 0.7); //yellow
-        mLight->setCastShadows(false);
-        mLight->setAttenuation(1000000, 1, 0, 0);
-
-        mLight->setVisible(false);
-      }
-
-      MapCameraLightning::~MapCameraLightning()
-      {
-        mSceneManager.destroyLight(mLight);
-      }
-
-      Ogre::Light*
-      MapCameraLightning::getLight()
-      {
-        return mLight;
-      }
-
-      Ogre::SceneManager&
-      MapCameraLightning::getSceneManager()
-      {
-        return mSceneManager;
-      }
-
-      MapCameraLightningInstance::MapCameraLightningInstance(
-          MapCameraLightning& lightning) :
-          mLightning(lightning)
-      {
-
-        Ogre::SceneManager::MovableObjectIterator iterator =
-            lightning.getSceneManager().getMovableObjectIterator(
-                Ogre::LightFactory::FACTORY_TYPE_NAME);
-
-        while (iterator.hasMoreElements())
-          {
-            Ogre::MovableObject* light = iterator.getNext();
-            if (light && light != mLightning.getLight())
-              {
-                if (light->getVisible())
-                  {
-                    mVisibleLights.push_back(light);
-                    light->setVisible(false);
-                  }
-              }
-          }
-        mLightning.getLight()->setVisible(true);
-        mAmbientColour = mLightning.getSceneManager().getAmbientLight();
-        mLightning.getSceneManager().setAmbientLight(
-            mLightning.getLight()->getDiffuseColour());
-      }
-
-      MapCameraLightningInstance::~MapCameraLightningInstance()
-      {
-        for (LightStore::const_iterator I = mVisibleLights.begin();
-            I != mVisibleLights.end(); ++I)
-          {
-            (*I)->setVisible(true);
-          }
-        mLightning.getLight()->setVisible(false);
-        mLightning.getSceneManager().setAmbientLight(mAmbientColour);
-      }
-
-      RenderingInstance::RenderingInstance(Ogre::SceneManager* manager) :
-          mManager(manager), mFogMode(manager->getFogMode()), mFogColour(
-              manager->getFogColour()), mFogDensity(manager->getFogDensity()), mFogStart(
-              manager->getFogStart()), mFogEnd(manager->getFogEnd()), mSpecialCaseRenderQueueMode(
-              manager->getSpecialCaseRenderQueueMode())
-      {
-
-      }
-
-      RenderingInstance::~RenderingInstance()
-      {
-        mManager->setFog(mFogMode, mFogColour, mFogDensity, mFogStart, mFogEnd);
-
-        mManager->setSpecialCaseRenderQueueMode(mSpecialCaseRenderQueueMode);
-      }
-
     }
 
   }
@@ -24,14 +24,19 @@
 #define EMBEROGRE_TERRAINMAP_H
 
 #include "components/ogre/EmberOgrePrerequisites.h"
+#include "Types.h"
+#include "MapTileTask.h"
 #include <vector>
+#include <map>
+#include <set>
+#include <string>
 #include <OgreColourValue.h>
 #include <OgreVector2.h>
 #include <OgreCommon.h>
 #include <OgreTexture.h>
-#include <OgreSceneManager.h>
 
 #include <sigc++/signal.h>
+#include <sigc++/trackable.h>
 
 namespace Ember
 {
@@ -42,139 +47,9 @@ namespace Ember
     {
 
       class Map;
-
-      /**
-       @brief Provides lightning for the map rendering.
-
-       We don't want to use the regular scene lightning since then we won't see anything at all during the night. This class takes care of setting up a light which will provide a good sunny day for the map rendering.
-
-       You don't use this directly when you want to render however, instead you use an instance of MapCameraLightningInstance.
-
-       @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
-       */
-      class MapCameraLightning
-      {
-      public:
-        /**
-         * @brief Ctor.
-         * The light will automatically be created in the constructor.
-         * @param sceneManager The scene manager which is used for rendering.
-         */
-        MapCameraLightning(Ogre::SceneManager& sceneManager);
-
-        /**
-         * @brief Dtor.
-         */
-        virtual
-        ~MapCameraLightning();
-
-        /**
-         * @brief Gets the light which is used for rendering. This is a yellow, bright light in the middle of the sky.
-         * @return The main light.
-         */
-        Ogre::Light*
-        getLight();
-
-        /**
-         * @brief Gets the scene manager.
-         * @return The scene manager.
-         */
-        Ogre::SceneManager&
-        getSceneManager();
-
-      protected:
-        /**
-         * @brief The light, owned by this instance.
-         */
-        Ogre::Light* mLight;
-
-        /**
-         * @brief The scene manager to which everything belongs.
-         */
-        Ogre::SceneManager& mSceneManager;
-      };
-
-      /**
-       @brief An instance of map specific lightning, using RAII to make sure that the lightning is correctly reset after rendering is complete.
-
-       Use an instance of this during your rendering to make sure that the lightning is correctly set up, and then reset afterwards.
-
-       @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
-       */
-      class MapCameraLightningInstance
-      {
-      public:
-        /**
-         * @brief Ctor.
-         * @param lightning The lightning.
-         */
-        MapCameraLightningInstance(MapCameraLightning& lightning);
-
-        /**
-         * @brief Dtor.
-         */
-        ~MapCameraLightningInstance();
-
-      protected:
-        typedef std::vector<Ogre::MovableObject*> LightStore;
-
-        /**
-         * @brief The lightning.
-         */
-        MapCameraLightning& mLightning;
-
-        /**
-         * @brief A store of visible lights which will be disabled when this instance is created, and enabled when it's destroyed.
-         */
-        LightStore mVisibleLights;
-
-        /**
-         * @brief The ambient colour of the scene before this instance is created, which will be reset when it's destroyed.
-         */
-        Ogre::ColourValue mAmbientColour;
-      };
-
-      /**
-       @brief Responsible for handling the camera used to render the terrain overhead map.
-       @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
-
-       */
-      class MapCamera
-      {
-      public:
-        MapCamera(Map& map, Ogre::SceneManager& manager);
-        virtual
-        ~MapCamera();
-
-        void
-        render();
-
-        void
-        setDistance(float distance);
-        float
-        getDistance() const;
-
-        void
-        reposition(const Ogre::Vector2& pos);
-        /**
-         * @brief Gets the current 2d position of the camera, in world space.
-         * @return The current position of the camera, in world space.
-         */
-        const Ogre::Vector2
-        getPosition() const;
-
-        void
-        setRenderTarget(Ogre::RenderTarget* renderTarget);
-
-      protected:
-        Map& mMap;
-
-        Ogre::Camera* mCamera;
-        Ogre::Viewport* mViewport;
-        float mDistance;
-
-        MapCameraLightning mLightning;
-      };
+      class TerrainHandler;
+      class TerrainPage;
+      class TerrainShader;
 
       /**
        @brief Represents a sub view of the map.
@@ -184,7 +59,7 @@ namespace Ember
       class MapView
       {
       public:
-        MapView(Map& map, MapCamera& mapCamera);
+        MapView(Map& map);
 
         /**
          * @brief Reposition the view.
@@ -216,8 +91,8 @@ namespace Ember
         getFullBounds() const;
 
         /**
-         * @brief Recalculates the bounds. Call this whenever you've altered the scaling or repositioned the camera.
-         * This will also be called internally whenever the camera needs to be repositioned through a call to MapView::reposition.
+         * @brief Recalculates the bounds. Call this whenever you've altered the scaling or repositioned the map.
+         * This will also be called internally whenever the map needs to be repositioned through a call to MapView::reposition.
          */
         void
         recalculateBounds();
@@ -249,11 +124,6 @@ namespace Ember
          */
         Map& mMap;
 
-        /**
-         * @brief The camera used to render the map.
-         */
-        MapCamera& mMapCamera;
-
         /**
          * @brief In relative terms, how much of the total map should be used to render the visible subview.
          * Expressed as [0..1], where 1 denotes the full rendered map.
@@ -263,13 +133,20 @@ namespace Ember
       };
 
       /**
-       * @brief An overhead map of the terrain, rendered into a texture.
+       * @brief An overhead map of the terrain.
+       *
+       * The map isn't rendered through the scene; instead each terrain page gets a map tile generated directly from the height data and the surfaces (see MapTileTask). This happens in the background thread of the terrain handler.
+       * The tiles are cached per page, and are regenerated whenever the terrain handler reports that the geometry or the layers of a page have changed. Rendering the map is just a matter of compositing the cached tiles into the map texture.
        * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
        */
-      class Map
+      class Map : public virtual sigc::trackable
       {
       public:
-        Map(Ogre::SceneManager& sceneManager);
+        /**
+         * @brief Ctor.
+         * @param terrainHandler The terrain handler, which provides the terrain data and generates the tiles.
+         */
+        Map(TerrainHandler& terrainHandler);
 
         virtual
         ~Map();
@@ -281,14 +158,9 @@ namespace Ember
         getTexture() const;
 
         /**
-         * @brief Gets the render texture into which the map is being rendered.
-         * This is the same texture as the one you will get from getTexture(), but this accesses the more low level rendering structure, allowing you to access the actual ViewPort.
-         * If you haven't called initialize() yet this will return a null pointer.
-         * @return A pointer to the render texture being used for rendering the map, or null if no such has been created yet.
+         * @brief Composites the cached tiles into the map texture.
+         * Any pages within the map which don't have a tile yet will have one generated, and EventTilesUpdated will be emitted once it's done.
          */
-        Ogre::RenderTexture*
-        getRenderTexture() const;
-
         void
         render();
         void
@@ -296,10 +168,12 @@ namespace Ember
         void
         reposition(float x, float y);
 
-        void
-        setDistance(float distance);
-        float
-        getDistance() const;
+        /**
+         * @brief Gets the current 2d position of the center of the map, in world space.
+         * @return The current position of the map, in world space.
+         */
+        const Ogre::Vector2&
+        getPosition() const;
 
         /**
          * @brief Gets the resolution in meters per pixel.
@@ -326,45 +200,115 @@ namespace Ember
         MapView&
         getView();
 
+        /**
+         * @brief Emitted when tiles within the map have been generated or updated.
+         * Listen to this to know when the map should be rendered again.
+         */
+        sigc::signal<void> EventTilesUpdated;
+
       protected:
 
-        void
-        setupCamera();
+        typedef std::map<Domain::TerrainIndex, MapTile> TileStore;
+        typedef std::set<Domain::TerrainIndex> TileIndexStore;
+        typedef std::map<std::string, Ogre::ColourValue> TextureColourStore;
+
         void
         createTexture();
 
+        /**
+         * @brief Gets the area covered by the map, in world space.
+         */
+        WFMath::AxisBox<2>
+        getWorldBounds() const;
+
+        /**
+         * @brief Requests a tile to be generated for a page.
+         * If a tile already is being generated for the page it will be generated again once that's done, since the page might have changed since the first request.
+         * @param page The page.
+         */
+        void
+        requestTile(TerrainPage& page);
+
+        /**
+         * @brief Requests tiles to be generated for all pages intersecting an area.
+         * @param area The area, in world space.
+         * @param onlyMissing If true, only pages without any tiles will be requested.
+         */
+        void
+        requestTiles(const WFMath::AxisBox<2>& area, bool onlyMissing);
+
+        /**
+         * @brief Gets the layers to use when generating tiles.
+         * These are created from the terrain shaders the first time they are needed, and whenever a new shader has been created.
+         */
+        const MapTileLayerStore&
+        getLayers();
+
+        /**
+         * @brief Gets the average colour of a texture, which is used as the colour of a layer.
+         * @param textureName The name of the texture.
+         * @return The average colour.
+         */
+        Ogre::ColourValue
+        getTextureColour(const std::string& textureName);
+
+        void
+        tileGenerated(const MapTile& tile);
+
+        void
+        terrainHandler_AfterTerrainUpdate(const std::vector<WFMath::AxisBox<2>>& areas, const std::set<TerrainPage*>& pages);
+
+        void
+        terrainHandler_LayerUpdated(const TerrainShader* shader, const AreaStore& areas);
+
+        void
+        terrainHandler_ShaderCreated(const TerrainShader& shader);
+
+        TerrainHandler& mTerrainHandler;
+
         Ogre::TexturePtr mTexture;
-        Ogre::RenderTexture* mRenderTexture;
 
         unsigned int mTexturePixelSize;
         float mMetersPerPixel;
 
-        MapCamera mCamera;
+        /**
+         * @brief The position of the center of the map, in Ogre space.
+         */
+        Ogre::Vector2 mPosition;
+
         MapView mView;
 
-      };
+        /**
+         * @brief The cached tiles, one for each page.
+         */
+        TileStore mTiles;
 
-      /**
-       By using an instance of this every time you want to alter the scene manager for a certain render operation, you can make sure that the scene manager is returned to its initial state after the render operation is complete, even if something goes wrong.
-       @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
-       */
-      class RenderingInstance
-      {
-      public:
-        RenderingInstance(Ogre::SceneManager* manager);
-        virtual
-        ~RenderingInstance();
+        /**
+         * @brief The pages for which tiles are currently being generated.
+         */
+        TileIndexStore mPendingTiles;
 
-      protected:
-        Ogre::SceneManager* mManager;
+        /**
+         * @brief Pages which have changed while their tiles were being generated, and thus need to be generated again.
+         */
+        TileIndexStore mStaleTiles;
 
-        Ogre::FogMode mFogMode;
-        Ogre::ColourValue mFogColour;
-        Ogre::Real mFogDensity;
-        Ogre::Real mFogStart;
-        Ogre::Real mFogEnd;
+        MapTileLayerStore mLayers;
 
-        Ogre::SceneManager::SpecialCaseRenderQueueMode mSpecialCaseRenderQueueMode;
+        /**
+         * @brief True if mLayers needs to be recreated.
+         */
+        bool mLayersDirty;
+
+        /**
+         * @brief A cache of the average colours of layer textures, since loading them is expensive.
+         */
+        TextureColourStore mTextureColours;
+
+        /**
+         * @brief The RGB pixels of the map, into which the tiles are composited before the texture is updated.
+         */
+        std::vector<unsigned char> mPixels;
 
       };
 
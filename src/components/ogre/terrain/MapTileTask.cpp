@@ -0,0 +1,152 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "MapTileTask.h"
+#include "TerrainPage.h"
+#include "TerrainPageGeometry.h"
+
+#include <Mercator/Segment.h>
+#include <Mercator/Surface.h>
+#include <wfmath/vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace
+{
+/**
+ * @brief The direction towards the light used for hill shading; from the north west, like most maps.
+ */
+const WFMath::Vector<3> LIGHT_DIRECTION = WFMath::Vector<3>(-1, 1, 1.5).normalize();
+
+/**
+ * @brief The colour of deep water.
+ */
+const Ogre::ColourValue WATER_COLOUR(0.2f, 0.35f, 0.55f);
+
+/**
+ * @brief The colour of terrain not covered by any layer.
+ */
+const Ogre::ColourValue DEFAULT_COLOUR(0.5f, 0.5f, 0.45f);
+
+unsigned char toByte(float value)
+{
+	return static_cast<unsigned char>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f);
+}
+}
+
+MapTileTask::MapTileTask(const TerrainPageGeometryPtr& geometry, const MapTileLayerStore& layers, unsigned int tileSize, sigc::slot<void, const MapTile&> asyncCallback) :
+	mGeometry(geometry), mLayers(layers), mAsyncCallback(asyncCallback)
+{
+	mTile.index = geometry->getPage().getWFIndex();
+	mTile.extent = geometry->getPage().getWorldExtent();
+	mTile.size = tileSize;
+}
+
+MapTileTask::~MapTileTask()
+{
+}
+
+void MapTileTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	mGeometry->repopulate();
+
+	//Look up segments by their world index, so that we don't need to care about how the page maps to segments.
+	typedef std::map<std::pair<int, int>, const Mercator::Segment*> SegmentLookup;
+	SegmentLookup segments;
+	int resolution = 64;
+	const SegmentVector validSegments = mGeometry->getValidSegments();
+	for (SegmentVector::const_iterator I = validSegments.begin(); I != validSegments.end(); ++I) {
+		const Mercator::Segment* segment = I->segment;
+		if (segment->isValid()) {
+			resolution = segment->getResolution();
+			segments[std::make_pair(segment->getXRef() / resolution, segment->getYRef() / resolution)] = segment;
+		}
+	}
+
+	const float flatLight = LIGHT_DIRECTION.z();
+	const float metersPerPixel = (mTile.extent.highCorner().x() - mTile.extent.lowCorner().x()) / mTile.size;
+	mTile.pixels.resize(mTile.size * mTile.size * 3);
+	unsigned char* pixel = &mTile.pixels[0];
+
+	for (unsigned int row = 0; row < mTile.size; ++row) {
+		const float y = mTile.extent.highCorner().y() - ((row + 0.5f) * metersPerPixel);
+		const int segmentY = static_cast<int>(std::floor(y / resolution));
+		for (unsigned int column = 0; column < mTile.size; ++column) {
+			const float x = mTile.extent.lowCorner().x() + ((column + 0.5f) * metersPerPixel);
+			const int segmentX = static_cast<int>(std::floor(x / resolution));
+
+			Ogre::ColourValue colour(DEFAULT_COLOUR);
+			SegmentLookup::const_iterator I = segments.find(std::make_pair(segmentX, segmentY));
+			if (I != segments.end()) {
+				const Mercator::Segment& segment = *I->second;
+				const int localX = std::min(static_cast<int>(x - segment.getXRef()), resolution - 1);
+				const int localY = std::min(static_cast<int>(y - segment.getYRef()), resolution - 1);
+
+				for (MapTileLayerStore::const_iterator J = mLayers.begin(); J != mLayers.end(); ++J) {
+					Mercator::Segment::Surfacestore::const_iterator K = segment.getSurfaces().find(J->surfaceIndex);
+					if (K != segment.getSurfaces().end() && K->second->isValid()) {
+						const float alpha = (*K->second)(localX, localY, 0) / 255.0f;
+						colour = (colour * (1.0f - alpha)) + (J->colour * alpha);
+					}
+				}
+
+				const float height = segment.get(localX, localY);
+				if (height < 0) {
+					//Water is flat, so there's no need for shading; instead darken it with depth.
+					const float depth = std::min(-height / 20.0f, 1.0f);
+					const float waterAmount = 0.6f + (0.4f * depth);
+					colour = (colour * (1.0f - waterAmount)) + (WATER_COLOUR * waterAmount);
+				} else {
+					WFMath::Vector<3> normal(segment.get(localX, localY) - segment.get(localX + 1, localY), segment.get(localX, localY) - segment.get(localX, localY + 1), 1.0f);
+					normal.normalize();
+					const float light = std::max(0.0f, std::min(Dot(normal, LIGHT_DIRECTION) / flatLight, 1.5f));
+					colour *= 0.35f + (0.65f * light);
+				}
+			}
+			*pixel++ = toByte(colour.r);
+			*pixel++ = toByte(colour.g);
+			*pixel++ = toByte(colour.b);
+		}
+	}
+
+	//Release Segment references as soon as we can
+	mGeometry.reset();
+}
+
+void MapTileTask::executeTaskInMainThread()
+{
+	mAsyncCallback(mTile);
+}
+
+}
+}
+}
@@ -0,0 +1,118 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_MAPTILETASK_H_
+#define EMBEROGRE_TERRAIN_MAPTILETASK_H_
+
+#include "Types.h"
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <OgreColourValue.h>
+#include <wfmath/axisbox.h>
+#include <sigc++/slot.h>
+
+#include <vector>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+/**
+ * @brief A layer to use when colouring a map tile.
+ */
+struct MapTileLayer
+{
+	/**
+	 * @brief The index of the surface in the Mercator segments.
+	 */
+	int surfaceIndex;
+
+	/**
+	 * @brief The colour of the layer on the map.
+	 */
+	Ogre::ColourValue colour;
+};
+
+typedef std::vector<MapTileLayer> MapTileLayerStore;
+
+/**
+ * @brief An overhead image of a single terrain page.
+ */
+struct MapTile
+{
+	/**
+	 * @brief The index of the page.
+	 */
+	Domain::TerrainIndex index;
+
+	/**
+	 * @brief The area covered by the tile, in world units.
+	 */
+	WFMath::AxisBox<2> extent;
+
+	/**
+	 * @brief The width and height of the tile, in pixels.
+	 */
+	unsigned int size;
+
+	/**
+	 * @brief RGB pixel data, row by row, starting at the north edge.
+	 */
+	std::vector<unsigned char> pixels;
+};
+
+/**
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ * @brief Generates a map tile for a page directly from the Mercator height data and surfaces.
+ *
+ * The colour of each pixel is the layer colours blended by the surface coverage, with water below sea level, shaded by the slope of the terrain (so called "hill shading"). No rendering is involved, so this can be performed in a background thread.
+ */
+class MapTileTask: public Tasks::TemplateNamedTask<MapTileTask>
+{
+public:
+	/**
+	 * @brief Ctor.
+	 * @param geometry The geometry of the page.
+	 * @param layers The layers, in the order they should be applied.
+	 * @param tileSize The width and height of the tile, in pixels.
+	 * @param asyncCallback Called in the main thread when the tile has been generated.
+	 */
+	MapTileTask(const TerrainPageGeometryPtr& geometry, const MapTileLayerStore& layers, unsigned int tileSize, sigc::slot<void, const MapTile&> asyncCallback);
+
+	virtual ~MapTileTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+private:
+	TerrainPageGeometryPtr mGeometry;
+	const MapTileLayerStore mLayers;
+	sigc::slot<void, const MapTile&> mAsyncCallback;
+	MapTile mTile;
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_MAPTILETASK_H_ */
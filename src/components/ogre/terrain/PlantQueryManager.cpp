@@ -0,0 +1,177 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "PlantQueryManager.h"
+#include "PlantQueryTask.h"
+#include "SegmentFoliageDataTask.h"
+#include "SegmentManager.h"
+#include "PlantAreaQuery.h"
+#include "PlantAreaQueryResult.h"
+#include "foliage/PlantPopulator.h"
+#include "foliage/SegmentFoliageData.h"
+
+#include "framework/tasks/TaskQueue.h"
+#include "framework/TimeFrame.h"
+
+#include <wfmath/intersect.h>
+
+#include <algorithm>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace
+{
+/**
+ * @brief The max number of segments to keep data cached for.
+ */
+const size_t MAX_CACHED_SEGMENTS = 256;
+}
+
+PlantQueryManager::PlantQueryManager(SegmentManager& segmentManager, Tasks::TaskQueue& terrainQueue, unsigned int numberOfExecutors) :
+		mSegmentManager(segmentManager), mTerrainQueue(terrainQueue), mFoliageQueue(new Tasks::TaskQueue(numberOfExecutors)), mGeneration(0), mUseCounter(0)
+{
+}
+
+PlantQueryManager::~PlantQueryManager()
+{
+}
+
+void PlantQueryManager::addQuery(int xIndex, int yIndex, Foliage::PlantPopulator& populator, const PlantAreaQuery& query, const Ogre::ColourValue& defaultShadowColour, sigc::slot<void, const PlantAreaQueryResult&> asyncCallback)
+{
+	PlantQueryRequest request;
+	request.populator = &populator;
+	request.result.reset(new PlantAreaQueryResult(query));
+	request.result->setDefaultShadowColour(defaultShadowColour);
+	request.asyncCallback = asyncCallback;
+	mPendingQueries[SegmentIndex(xIndex, yIndex)].push_back(request);
+}
+
+void PlantQueryManager::processQueries()
+{
+	PlantQueryRequestStore emptyRequests;
+	PendingQueryStore::iterator I = mPendingQueries.begin();
+	while (I != mPendingQueries.end()) {
+		const SegmentIndex& index = I->first;
+		//Wait for the data already being created, since it might be what's needed.
+		if (mSegmentsInProgress.count(index)) {
+			++I;
+			continue;
+		}
+
+		std::set<int> layerIndices;
+		for (PlantQueryRequestStore::const_iterator J = I->second.begin(); J != I->second.end(); ++J) {
+			layerIndices.insert(J->populator->getLayerIndex());
+		}
+
+		SegmentDataCache::iterator cacheI = mCache.find(index);
+		if (cacheI != mCache.end()) {
+			const std::set<int>& cachedLayers = cacheI->second.segmentData->getLayerIndices();
+			if (std::includes(cachedLayers.begin(), cachedLayers.end(), layerIndices.begin(), layerIndices.end())) {
+				cacheI->second.lastUsed = ++mUseCounter;
+				populate(cacheI->second.segmentData, I->second);
+				mPendingQueries.erase(I++);
+				continue;
+			}
+			//Make sure that the new data contains the layers already cached, so we don't have to alternate.
+			layerIndices.insert(cachedLayers.begin(), cachedLayers.end());
+		}
+
+		SegmentRefPtr segmentRef = mSegmentManager.getSegmentReference(index.first, index.second);
+		if (segmentRef.get()) {
+			mSegmentsInProgress.insert(index);
+			mTerrainQueue.enqueueTask(new SegmentFoliageDataTask(segmentRef, layerIndices, *this, index, mGeneration, I->second));
+		} else {
+			//If there's no segment there are no plants, but the callers still need to know that their queries are done.
+			emptyRequests.insert(emptyRequests.end(), I->second.begin(), I->second.end());
+		}
+		mPendingQueries.erase(I++);
+	}
+
+	//The callbacks are called last, since they might add new queries.
+	for (PlantQueryRequestStore::const_iterator J = emptyRequests.begin(); J != emptyRequests.end(); ++J) {
+		J->asyncCallback(*J->result);
+	}
+}
+
+void PlantQueryManager::pollTasks(const TimeFrame& timeFrame)
+{
+	mFoliageQueue->pollProcessedTasks(timeFrame);
+}
+
+void PlantQueryManager::invalidate(const AreaStore& areas)
+{
+	mGeneration++;
+	SegmentDataCache::iterator I = mCache.begin();
+	while (I != mCache.end()) {
+		WFMath::AxisBox<2> segmentArea = I->second.segmentData->getArea();
+		bool changed = false;
+		for (AreaStore::const_iterator J = areas.begin(); J != areas.end(); ++J) {
+			if (WFMath::Intersect(*J, segmentArea, false)) {
+				changed = true;
+				break;
+			}
+		}
+		if (changed) {
+			mCache.erase(I++);
+		} else {
+			++I;
+		}
+	}
+}
+
+void PlantQueryManager::segmentDataCreated(const std::pair<int, int>& index, unsigned int generation, std::shared_ptr<const Foliage::SegmentFoliageData> segmentData, const PlantQueryRequestStore& requests)
+{
+	mSegmentsInProgress.erase(index);
+
+	//If the terrain has changed since the data was requested it might be stale, but it's still good enough for the queries made before the change.
+	if (generation == mGeneration) {
+		if (mCache.size() >= MAX_CACHED_SEGMENTS && !mCache.count(index)) {
+			SegmentDataCache::iterator oldest = mCache.begin();
+			for (SegmentDataCache::iterator I = mCache.begin(); I != mCache.end(); ++I) {
+				if (I->second.lastUsed < oldest->second.lastUsed) {
+					oldest = I;
+				}
+			}
+			mCache.erase(oldest);
+		}
+		CacheEntry& entry = mCache[index];
+		entry.segmentData = segmentData;
+		entry.lastUsed = ++mUseCounter;
+	}
+
+	populate(segmentData, requests);
+}
+
+void PlantQueryManager::populate(std::shared_ptr<const Foliage::SegmentFoliageData> segmentData, const PlantQueryRequestStore& requests)
+{
+	mFoliageQueue->enqueueTask(new PlantQueryTask(segmentData, requests));
+}
+
+}
+}
+}
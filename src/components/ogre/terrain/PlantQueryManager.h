@@ -0,0 +1,175 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_PLANTQUERYMANAGER_H_
+#define EMBEROGRE_TERRAIN_PLANTQUERYMANAGER_H_
+
+#include "Types.h"
+#include "PlantQueryTask.h"
+
+#include <OgreColourValue.h>
+#include <sigc++/slot.h>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+
+namespace Ember
+{
+class TimeFrame;
+namespace Tasks
+{
+class TaskQueue;
+}
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+class SegmentManager;
+class PlantAreaQuery;
+
+namespace Foliage
+{
+class PlantPopulator;
+class SegmentFoliageData;
+}
+
+/**
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ * @brief Batches plant queries per segment and populates them in parallel.
+ *
+ * Queries are collected as they are added, and handled together once per frame in processQueries().
+ * For each segment with queries a snapshot of the data needed for placing plants (heights and combined layer coverage) is created on the terrain task queue, where it's safe to access the segment.
+ * The snapshot is cached until the segment is changed, and all queries in the segment, for all foliage layers, are then populated as one task on a separate queue with multiple executors.
+ */
+class PlantQueryManager
+{
+public:
+	/**
+	 * @brief Ctor.
+	 * @param segmentManager The segment manager.
+	 * @param terrainQueue The terrain task queue, on which all segment access must happen.
+	 * @param numberOfExecutors The number of threads to use for populating.
+	 */
+	PlantQueryManager(SegmentManager& segmentManager, Tasks::TaskQueue& terrainQueue, unsigned int numberOfExecutors);
+
+	/**
+	 * @brief Dtor.
+	 * Any queries being populated will have their callbacks called before this returns.
+	 */
+	~PlantQueryManager();
+
+	/**
+	 * @brief Adds a query, which will be handled at the next call to processQueries().
+	 * @param xIndex The x index of the segment in which the query is located.
+	 * @param yIndex The y index of the segment in which the query is located.
+	 * @param populator The populator to use.
+	 * @param query The query.
+	 * @param defaultShadowColour The shadow colour to use if the result has no shadow.
+	 * @param asyncCallback Called in the main thread when the query has been populated.
+	 */
+	void addQuery(int xIndex, int yIndex, Foliage::PlantPopulator& populator, const PlantAreaQuery& query, const Ogre::ColourValue& defaultShadowColour, sigc::slot<void, const PlantAreaQueryResult&> asyncCallback);
+
+	/**
+	 * @brief Handles all added queries, either populating them directly if the segment data is cached, or requesting new segment data.
+	 * Queries in segments which don't exist have no plants, and their callbacks are called right away with empty results.
+	 * Call this once every frame, from the main thread.
+	 */
+	void processQueries();
+
+	/**
+	 * @brief Handles populated queries, calling their callbacks.
+	 * @param timeFrame The time allowed.
+	 */
+	void pollTasks(const TimeFrame& timeFrame);
+
+	/**
+	 * @brief Discards cached segment data within the areas, since the segments have changed.
+	 * @param areas The changed areas.
+	 */
+	void invalidate(const AreaStore& areas);
+
+	/**
+	 * @brief Called by SegmentFoliageDataTask in the main thread when segment data has been created.
+	 * @param index The index of the segment.
+	 * @param generation The generation at the time the data was requested.
+	 * @param segmentData The segment data.
+	 * @param requests The queries waiting for the data.
+	 */
+	void segmentDataCreated(const std::pair<int, int>& index, unsigned int generation, std::shared_ptr<const Foliage::SegmentFoliageData> segmentData, const PlantQueryRequestStore& requests);
+
+private:
+
+	typedef std::pair<int, int> SegmentIndex;
+
+	struct CacheEntry
+	{
+		std::shared_ptr<const Foliage::SegmentFoliageData> segmentData;
+
+		/**
+		 * @brief The value of mUseCounter when the entry last was used; the least recently used entry is removed first.
+		 */
+		unsigned long lastUsed;
+	};
+
+	typedef std::map<SegmentIndex, PlantQueryRequestStore> PendingQueryStore;
+	typedef std::map<SegmentIndex, CacheEntry> SegmentDataCache;
+
+	SegmentManager& mSegmentManager;
+
+	Tasks::TaskQueue& mTerrainQueue;
+
+	/**
+	 * @brief The queue used for populating.
+	 */
+	std::unique_ptr<Tasks::TaskQueue> mFoliageQueue;
+
+	/**
+	 * @brief Queries not yet handled, grouped by segment.
+	 */
+	PendingQueryStore mPendingQueries;
+
+	/**
+	 * @brief Segments for which segment data currently is being created.
+	 * Queries for these are kept pending until the data is available.
+	 */
+	std::set<SegmentIndex> mSegmentsInProgress;
+
+	SegmentDataCache mCache;
+
+	/**
+	 * @brief Incremented each time the terrain changes; data requested before a change isn't cached.
+	 */
+	unsigned int mGeneration;
+
+	unsigned long mUseCounter;
+
+	/**
+	 * @brief Enqueues a task populating the queries with the segment data.
+	 */
+	void populate(std::shared_ptr<const Foliage::SegmentFoliageData> segmentData, const PlantQueryRequestStore& requests);
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_PLANTQUERYMANAGER_H_ */
@@ -19,7 +19,7 @@
 #include "PlantQueryTask.h"
 #include "PlantAreaQuery.h"
 #include "foliage/PlantPopulator.h"
-#include "components/ogre/Convert.h"
+#include "foliage/SegmentFoliageData.h"
 
 namespace Ember
 {
@@ -29,10 +29,9 @@ namespace OgreView
 namespace Terrain
 {
 
-PlantQueryTask::PlantQueryTask(const SegmentRefPtr& segmentRef, Foliage::PlantPopulator& plantPopulator, const PlantAreaQuery& query, const Ogre::ColourValue& defaultShadowColour, sigc::slot<void, const PlantAreaQueryResult&> asyncCallback) :
-	mSegmentRef(segmentRef), mPlantPopulator(plantPopulator), mAsyncCallback(asyncCallback), mQueryResult(query)
+PlantQueryTask::PlantQueryTask(std::shared_ptr<const Foliage::SegmentFoliageData> segmentData, const PlantQueryRequestStore& requests) :
+	mSegmentData(segmentData), mRequests(requests)
 {
-	mQueryResult.setDefaultShadowColour(defaultShadowColour);
 }
 
 PlantQueryTask::~PlantQueryTask()
@@ -41,15 +40,19 @@ PlantQueryTask::~PlantQueryTask()
 
 void PlantQueryTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
 {
-	mPlantPopulator.populate(mQueryResult, mSegmentRef);
-	//Release Segment references as soon as we can
-	mSegmentRef.reset();
+	for (PlantQueryRequestStore::iterator I = mRequests.begin(); I != mRequests.end(); ++I) {
+		I->populator->populate(*I->result, *mSegmentData);
+	}
+	mSegmentData.reset();
 }
 
 void PlantQueryTask::executeTaskInMainThread()
 {
-	mAsyncCallback(mQueryResult);
+	for (PlantQueryRequestStore::const_iterator I = mRequests.begin(); I != mRequests.end(); ++I) {
+		I->asyncCallback(*I->result);
+	}
 }
+
 }
 
 }
@@ -25,6 +25,9 @@
 
 #include <sigc++/slot.h>
 
+#include <memory>
+#include <vector>
+
 namespace Ember
 {
   namespace OgreView
@@ -33,22 +36,51 @@ namespace Ember
     namespace Terrain
     {
 
-      class TerrainPage;
-      class TerrainPageGeometry;
-
       namespace Foliage
       {
         class PlantPopulator;
+        class SegmentFoliageData;
       }
 
+      /**
+       * @brief A plant query waiting to be populated.
+       */
+      struct PlantQueryRequest
+      {
+        /**
+         * @brief The populator to use.
+         */
+        Foliage::PlantPopulator* populator;
+
+        /**
+         * @brief The result, which also holds the query.
+         */
+        std::shared_ptr<PlantAreaQueryResult> result;
+
+        /**
+         * @brief Called in the main thread when the result has been populated.
+         */
+        sigc::slot<void, const PlantAreaQueryResult&> asyncCallback;
+      };
+
+      typedef std::vector<PlantQueryRequest> PlantQueryRequestStore;
+
+      /**
+       * @brief Populates a batch of plant queries, all within the same segment.
+       *
+       * Since the segment data is a snapshot the task doesn't need to run on the terrain task queue, and multiple instances can be run in parallel.
+       */
       class PlantQueryTask : public Tasks::TemplateNamedTask<PlantQueryTask>
       {
       public:
-        PlantQueryTask(const SegmentRefPtr& segmentRef,
-            Foliage::PlantPopulator& plantPopulator,
-            const PlantAreaQuery& query,
-            const Ogre::ColourValue& defaultShadowColour,
-            sigc::slot<void, const PlantAreaQueryResult&> asyncCallback);
+        /**
+         * @brief Ctor.
+         * @param segmentData A snapshot of the segment in which all queries are located.
+         * @param requests The queries.
+         */
+        PlantQueryTask(
+            std::shared_ptr<const Foliage::SegmentFoliageData> segmentData,
+            const PlantQueryRequestStore& requests);
         virtual
         ~PlantQueryTask();
 
@@ -59,11 +91,8 @@ namespace Ember
         executeTaskInMainThread();
 
       private:
-        SegmentRefPtr mSegmentRef;
-        Foliage::PlantPopulator& mPlantPopulator;
-        sigc::slot<void, const PlantAreaQueryResult&> mAsyncCallback;
-
-        PlantAreaQueryResult mQueryResult;
+        std::shared_ptr<const Foliage::SegmentFoliageData> mSegmentData;
+        PlantQueryRequestStore mRequests;
       };
 
     }
@@ -0,0 +1,60 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SegmentFoliageDataTask.h"
+#include "PlantQueryManager.h"
+#include "SegmentReference.h"
+#include "Segment.h"
+#include "foliage/SegmentFoliageData.h"
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+SegmentFoliageDataTask::SegmentFoliageDataTask(const SegmentRefPtr& segmentRef, const std::set<int>& layerIndices, PlantQueryManager& manager, const std::pair<int, int>& index, unsigned int generation, const PlantQueryRequestStore& requests) :
+		mSegmentRef(segmentRef), mLayerIndices(layerIndices), mManager(manager), mIndex(index), mGeneration(generation), mRequests(requests)
+{
+}
+
+SegmentFoliageDataTask::~SegmentFoliageDataTask()
+{
+}
+
+void SegmentFoliageDataTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	mSegmentData.reset(new Foliage::SegmentFoliageData(mSegmentRef->getSegment().getMercatorSegment(), mLayerIndices));
+	//Release Segment references as soon as we can
+	mSegmentRef.reset();
+}
+
+void SegmentFoliageDataTask::executeTaskInMainThread()
+{
+	mManager.segmentDataCreated(mIndex, mGeneration, mSegmentData, mRequests);
+}
+
+}
+}
+}
@@ -0,0 +1,80 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_SEGMENTFOLIAGEDATATASK_H_
+#define EMBEROGRE_TERRAIN_SEGMENTFOLIAGEDATATASK_H_
+
+#include "Types.h"
+#include "PlantQueryTask.h"
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <memory>
+#include <set>
+#include <utility>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+class PlantQueryManager;
+
+/**
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ * @brief Creates a snapshot of the foliage data of a segment, for the plant queries in the segment.
+ *
+ * This accesses the segment, and so must be run on the terrain task queue.
+ */
+class SegmentFoliageDataTask: public Tasks::TemplateNamedTask<SegmentFoliageDataTask>
+{
+public:
+	/**
+	 * @brief Ctor.
+	 * @param segmentRef The segment.
+	 * @param layerIndices The indices of the layers to create combined coverage for.
+	 * @param manager The manager, which will receive the snapshot in the main thread.
+	 * @param index The index of the segment.
+	 * @param generation The generation of the manager when the task was created.
+	 * @param requests The queries waiting for the snapshot.
+	 */
+	SegmentFoliageDataTask(const SegmentRefPtr& segmentRef, const std::set<int>& layerIndices, PlantQueryManager& manager, const std::pair<int, int>& index, unsigned int generation, const PlantQueryRequestStore& requests);
+
+	virtual ~SegmentFoliageDataTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+private:
+	SegmentRefPtr mSegmentRef;
+	const std::set<int> mLayerIndices;
+	PlantQueryManager& mManager;
+	const std::pair<int, int> mIndex;
+	const unsigned int mGeneration;
+	PlantQueryRequestStore mRequests;
+	std::shared_ptr<const Foliage::SegmentFoliageData> mSegmentData;
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_SEGMENTFOLIAGEDATATASK_H_ */
@@ -41,13 +41,15 @@
 #include "TerrainModRemoveTask.h"
 #include "TerrainUpdateTask.h"
 #include "TerrainMaterialCompilationTask.h"
+#include "TerrainMaterialCompilationQueue.h"
 
 #include "TerrainLayerDefinitionManager.h"
 #include "TerrainLayerDefinition.h"
 
 #include "GeometryUpdateTask.h"
 #include "ShadowUpdateTask.h"
-#include "PlantQueryTask.h"
+#include "PlantQueryManager.h"
+#include "MapTileTask.h"
 #include "HeightMap.h"
 #include "HeightMapBufferProvider.h"
 #include "PlantAreaQuery.h"
@@ -71,6 +73,10 @@
 #include <wfmath/point.h>
 
 #include <sigc++/bind.h>
+#include <sigc++/adaptors/hide.h>
+
+#include <algorithm>
+#include <thread>
 
 namespace Ember
 {
@@ -140,7 +146,7 @@ public:
 		areas.push_back(mArea);
 		GeometryPtrVector geometries;
 		geometries.push_back(mGeometry);
-		context.executeTask(new TerrainShaderUpdateTask(geometries, shaders, areas, mHandler.EventLayerUpdated));
+		context.executeTask(new TerrainShaderUpdateTask(geometries, shaders, areas, mHandler.EventLayerUpdated, mHandler.getMaterialCompilationQueue()));
 		if (mBridge.get()) {
 			mBridge->updateTerrain(*mGeometry);
 		}
@@ -156,7 +162,7 @@ public:
 };
 
 TerrainHandler::TerrainHandler(int pageIndexSize, ICompilerTechniqueProvider& compilerTechniqueProvider) :
-	mPageIndexSize(pageIndexSize), mCompilerTechniqueProvider(compilerTechniqueProvider), mTerrainInfo(new TerrainInfo(pageIndexSize)), mTerrain(0), mHeightMax(std::numeric_limits<Ogre::Real>::min()), mHeightMin(std::numeric_limits<Ogre::Real>::max()), mHasTerrainInfo(false), mTaskQueue(new Tasks::TaskQueue(1)), mLightning(0), mHeightMap(0), mHeightMapBufferProvider(0), mSegmentManager(0)
+	mPageIndexSize(pageIndexSize), mCompilerTechniqueProvider(compilerTechniqueProvider), mTerrainInfo(new TerrainInfo(pageIndexSize)), mTerrain(0), mHeightMax(std::numeric_limits<Ogre::Real>::min()), mHeightMin(std::numeric_limits<Ogre::Real>::max()), mHasTerrainInfo(false), mTaskQueue(new Tasks::TaskQueue(1)), mLightning(0), mHeightMap(0), mHeightMapBufferProvider(0), mSegmentManager(0), mPlantQueryManager(0), mMaterialCompilationQueue(new TerrainMaterialCompilationQueue())
 {
 	mTerrain = new Mercator::Terrain(Mercator::Terrain::SHADED);
 
@@ -165,12 +171,21 @@ TerrainHandler::TerrainHandler(int pageIndexSize, ICompilerTechniqueProvider& co
 	mHeightMapBufferProvider = new HeightMapBufferProvider(mTerrain->getResolution() + 1);
 	mHeightMap = new HeightMap(Mercator::Terrain::defaultLevel, mTerrain->getResolution());
 
+	//Populating is independent of the terrain queue, so use a couple of threads if there are cores to spare.
+	unsigned int plantQueryThreads = std::min(4u, std::max(1u, std::thread::hardware_concurrency() / 2));
+	mPlantQueryManager = new PlantQueryManager(*mSegmentManager, *mTaskQueue, plantQueryThreads);
+	EventAfterTerrainUpdate.connect(sigc::hide(sigc::mem_fun(*mPlantQueryManager, &PlantQueryManager::invalidate)));
+	EventLayerUpdated.connect(sigc::hide<0>(sigc::mem_fun(*mPlantQueryManager, &PlantQueryManager::invalidate)));
 }
 
 TerrainHandler::~TerrainHandler()
 {
 	//Deleting the task queue will purge it, making sure that all jobs are processed first.
 	delete mTaskQueue;
+	//Any segment data created while purging has been handed to the plant query manager, which will complete those queries when it's deleted.
+	delete mPlantQueryManager;
+	//Any materials which haven't been compiled yet are discarded.
+	delete mMaterialCompilationQueue;
 
 	for (PageVector::iterator J = mPages.begin(); J != mPages.end(); ++J) {
 		delete (*J);
@@ -252,15 +267,17 @@ void TerrainHandler::getPlantsForArea(Foliage::PlantPopulator& populator, PlantA
 
 	int xIndex = static_cast<int> (floor(wfPos.x() / mTerrain->getResolution()));
 	int yIndex = static_cast<int> (floor(wfPos.y() / mTerrain->getResolution()));
-	SegmentRefPtr segmentRef = mSegmentManager->getSegmentReference(xIndex, yIndex);
-	if (segmentRef.get()) {
-		Ogre::ColourValue defaultShadowColour;
-		if (mLightning) {
-			defaultShadowColour = mLightning->getAmbientLightColour();
-		}
-		mTaskQueue->enqueueTask(new PlantQueryTask(segmentRef, populator, query, defaultShadowColour, asyncCallback));
-
+	Ogre::ColourValue defaultShadowColour;
+	if (mLightning) {
+		defaultShadowColour = mLightning->getAmbientLightColour();
 	}
+	mPlantQueryManager->addQuery(xIndex, yIndex, populator, query, defaultShadowColour, asyncCallback);
+}
+
+void TerrainHandler::generateMapTile(TerrainPage& page, const std::vector<MapTileLayer>& layers, unsigned int tileSize, sigc::slot<void, const Terrain::MapTile&> asyncCallback)
+{
+	TerrainPageGeometryPtr geometry(new TerrainPageGeometry(page, *mSegmentManager, getDefaultHeight()));
+	mTaskQueue->enqueueTask(new MapTileTask(geometry, layers, tileSize, asyncCallback));
 }
 
 ICompilerTechniqueProvider& TerrainHandler::getCompilerTechniqueProvider()
@@ -268,6 +285,11 @@ ICompilerTechniqueProvider& TerrainHandler::getCompilerTechniqueProvider()
 	return mCompilerTechniqueProvider;
 }
 
+TerrainMaterialCompilationQueue& TerrainHandler::getMaterialCompilationQueue()
+{
+	return *mMaterialCompilationQueue;
+}
+
 void TerrainHandler::removeBridge(const Domain::TerrainIndex& index)
 {
 	PageBridgeStore::iterator I = mPageBridges.find(index);
@@ -279,19 +301,38 @@ void TerrainHandler::removeBridge(const Domain::TerrainIndex& index)
 void TerrainHandler::pollTasks(const TimeFrame& timeFrame)
 {
 	mTaskQueue->pollProcessedTasks(timeFrame);
+	mPlantQueryManager->pollTasks(timeFrame);
+	mPlantQueryManager->processQueries();
 
 	//update shaders that needs updating
 	if (mShadersToUpdate.size()) {
+		//Only the pages touched by any of the updated areas need to be looked at.
 		GeometryPtrVector geometry;
 		for (PageVector::const_iterator I = mPages.begin(); I != mPages.end(); ++I) {
-			geometry.push_back(TerrainPageGeometryPtr(new TerrainPageGeometry(**I, *mSegmentManager, getDefaultHeight())));
+			const WFMath::AxisBox<2> pageExtent = (*I)->getWorldExtent();
+			bool isAffected = false;
+			for (ShaderUpdateSet::const_iterator J = mShadersToUpdate.begin(); J != mShadersToUpdate.end() && !isAffected; ++J) {
+				for (AreaStore::const_iterator K = J->second.Areas.begin(); K != J->second.Areas.end(); ++K) {
+					if (WFMath::Intersect(pageExtent, *K, true) || WFMath::Contains(pageExtent, *K, true)) {
+						isAffected = true;
+						break;
+					}
+				}
+			}
+			if (isAffected) {
+				geometry.push_back(TerrainPageGeometryPtr(new TerrainPageGeometry(**I, *mSegmentManager, getDefaultHeight())));
+			}
 		}
-		//use a reverse iterator, since we need to update top most layers first, since lower layers might depend on them for their foliage positions
-		for (ShaderUpdateSet::reverse_iterator I = mShadersToUpdate.rbegin(); I != mShadersToUpdate.rend(); ++I) {
-			mTaskQueue->enqueueTask(new TerrainShaderUpdateTask(geometry, I->first, I->second.Areas, EventLayerUpdated), 0);
+		if (!geometry.empty()) {
+			//use a reverse iterator, since we need to update top most layers first, since lower layers might depend on them for their foliage positions
+			for (ShaderUpdateSet::reverse_iterator I = mShadersToUpdate.rbegin(); I != mShadersToUpdate.rend(); ++I) {
+				mTaskQueue->enqueueTask(new TerrainShaderUpdateTask(geometry, I->first, I->second.Areas, EventLayerUpdated, *mMaterialCompilationQueue), 0);
+			}
 		}
 		mShadersToUpdate.clear();
 	}
+
+	mMaterialCompilationQueue->poll(timeFrame);
 }
 
 void TerrainHandler::updateAllPages()
@@ -307,7 +348,7 @@ void TerrainHandler::updateAllPages()
 
 	//Update all shaders on all pages
 	for (ShaderStore::const_iterator I = mShaderMap.begin(); I != mShaderMap.end(); ++I) {
-		mTaskQueue->enqueueTask(new TerrainShaderUpdateTask(geometry, I->second, areas, EventLayerUpdated), 0);
+		mTaskQueue->enqueueTask(new TerrainShaderUpdateTask(geometry, I->second, areas, EventLayerUpdated, *mMaterialCompilationQueue), 0);
 	}
 }
 
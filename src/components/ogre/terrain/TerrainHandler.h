@@ -66,6 +66,10 @@ class TerrainDefPoint;
 class PlantAreaQuery;
 class PlantAreaQueryResult;
 class SegmentManager;
+class PlantQueryManager;
+class TerrainMaterialCompilationQueue;
+struct MapTile;
+struct MapTileLayer;
 
 namespace Foliage {
 class PlantPopulator;
@@ -262,12 +266,24 @@ public:
 	 * @brief Place the plants for the supplied area in the supplied store.
 	 *
 	 * This method will perform the lookup in a background thread and return the results through an async callback.
+	 * Queries are batched per segment and handled at the next call to pollTasks().
 	 * @param populator The plant populator to use.
 	 * @param query The plant query.
 	 * @param asyncCallback A callback to be called when the query has been executed in a background thread.
 	 */
 	void getPlantsForArea(Foliage::PlantPopulator& populator, PlantAreaQuery& query, sigc::slot<void, const Terrain::PlantAreaQueryResult&> asyncCallback);
 
+	/**
+	 * @brief Generates an overhead map image of a page.
+	 *
+	 * The image is generated from the height data and surfaces in a background thread, and returned through an async callback.
+	 * @param page The page.
+	 * @param layers The layers to colour the map with, in the order they should be applied.
+	 * @param tileSize The width and height of the image, in pixels.
+	 * @param asyncCallback A callback to be called in the main thread when the image has been generated.
+	 */
+	void generateMapTile(TerrainPage& page, const std::vector<MapTileLayer>& layers, unsigned int tileSize, sigc::slot<void, const Terrain::MapTile&> asyncCallback);
+
 	/**
 	 * @brief Accessor for the shaders registered with the manager.
 	 *
@@ -298,6 +314,13 @@ public:
 	 */
 	ICompilerTechniqueProvider& getCompilerTechniqueProvider();
 
+	/**
+	 * @brief Accessor for the queue which compiles the terrain page materials.
+	 *
+	 * @return The material compilation queue.
+	 */
+	TerrainMaterialCompilationQueue& getMaterialCompilationQueue();
+
 	/**
 	 * @brief Polls the tasks queue.
 	 *
@@ -470,6 +493,16 @@ protected:
 	 */
 	SegmentManager* mSegmentManager;
 
+	/**
+	 * @brief Batches and populates plant queries.
+	 */
+	PlantQueryManager* mPlantQueryManager;
+
+	/**
+	 * @brief Compiles the terrain page materials in the main thread, prioritised by distance to the camera.
+	 */
+	TerrainMaterialCompilationQueue* mMaterialCompilationQueue;
+
 	/**
 	 * @brief Marks a shader for update, to be updated on the next batch, normally a frameEnded event.
 	 *
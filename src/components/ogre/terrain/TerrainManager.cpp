@@ -23,9 +23,11 @@
 #include "TerrainManager.h"
 
 #include "TerrainHandler.h"
+#include "TerrainMaterialCompilationQueue.h"
 #include "TerrainInfo.h"
 #include "TerrainShader.h"
 #include "TerrainPage.h"
+#include "TerrainTextureStreamer.h"
 
 #include "ISceneManagerAdapter.h"
 
@@ -72,13 +74,14 @@ namespace Terrain
 
 
 TerrainManager::TerrainManager(ISceneManagerAdapter* adapter, Scene& scene, ShaderManager& shaderManager, sigc::signal<void, const TimeFrame&, unsigned int>& cycleProcessedSignal) :
-	UpdateShadows("update_shadows", this, "Updates shadows in the terrain."), mCompilerTechniqueProvider(new Techniques::CompilerTechniqueProvider(shaderManager, scene.getSceneManager())), mHandler(new TerrainHandler(adapter->getPageSize(), *mCompilerTechniqueProvider)), mIsFoliageShown(false), mSceneManagerAdapter(adapter), mFoliageBatchSize(32), mVegetation(new Foliage::Vegetation()), mScene(scene), mIsInitialized(false)
+	UpdateShadows("update_shadows", this, "Updates shadows in the terrain."), mCompilerTechniqueProvider(new Techniques::CompilerTechniqueProvider(shaderManager, scene.getSceneManager())), mHandler(new TerrainHandler(adapter->getPageSize(), *mCompilerTechniqueProvider)), mTextureStreamer(new TerrainTextureStreamer("General")), mIsFoliageShown(false), mSceneManagerAdapter(adapter), mFoliageBatchSize(32), mVegetation(new Foliage::Vegetation()), mScene(scene), mIsInitialized(false)
 {
 	loadTerrainOptions();
 
 	Ogre::Root::getSingleton().addFrameListener(this);
 
 	registerConfigListener("graphics", "foliage", sigc::mem_fun(*this, &TerrainManager::config_Foliage));
+	registerConfigListener("terrain", "texturebudget", sigc::mem_fun(*this, &TerrainManager::config_TextureBudget));
 
 	shaderManager.EventLevelChanged.connect(sigc::bind(sigc::mem_fun(*this, &TerrainManager::shaderManager_LevelChanged), &shaderManager));
 
@@ -96,6 +99,8 @@ TerrainManager::~TerrainManager()
     getAdapter()->reset();
 
 	delete mHandler;
+	//The streamer must outlive the handler, since the handler's tasks request textures from it.
+	delete mTextureStreamer;
 
 	delete mSceneManagerAdapter;
 
@@ -111,6 +116,7 @@ void TerrainManager::loadTerrainOptions()
 	getAdapter()->loadOptions(EmberServices::getSingleton().getConfigService().getSharedConfigDirectory() + "terrain.cfg");
 
 	getAdapter()->setCamera(&getScene().getMainCamera());
+	mHandler->getMaterialCompilationQueue().setCamera(&getScene().getMainCamera());
 
 	getAdapter()->setUninitializedHeight(mHandler->getDefaultHeight());
 
@@ -170,6 +176,13 @@ void TerrainManager::config_Foliage(const std::string& section, const std::strin
 	updateFoliageVisibility();
 }
 
+void TerrainManager::config_TextureBudget(const std::string& section, const std::string& key, varconf::Variable& variable)
+{
+	if (variable.is_int() && static_cast<int>(variable) > 0) {
+		mTextureStreamer->setBudget(static_cast<size_t>(static_cast<int>(variable)) * 1024 * 1024);
+	}
+}
+
 void TerrainManager::terrainHandler_AfterTerrainUpdate(const std::vector<WFMath::AxisBox<2>>& areas, const std::set<TerrainPage*>& pages)
 {
 
@@ -272,6 +285,8 @@ void TerrainManager::shaderManager_LevelChanged(ShaderManager* shaderManager)
 
 void TerrainManager::application_CycleProcessed(const TimeFrame& timeframe, unsigned int frameActionMask)
 {
+	//Poll the streamer first, so that placeholders exist for any textures used by materials compiled this frame.
+	mTextureStreamer->poll(timeframe);
 	mHandler->pollTasks(timeframe);
 }
 
@@ -76,6 +76,7 @@ class PlantAreaQuery;
 class PlantAreaQueryResult;
 class SegmentManager;
 class TerrainHandler;
+class TerrainTextureStreamer;
 
 namespace Techniques {
 class CompilerTechniqueProvider;
@@ -223,6 +224,11 @@ protected:
 	 */
 	TerrainHandler* mHandler;
 
+	/**
+	 * @brief Streams the textures of the terrain layers in the background.
+	 */
+	TerrainTextureStreamer* mTextureStreamer;
+
 	/**
 	 * @brief True if foliage should be shown.
 	 */
@@ -255,6 +261,11 @@ protected:
 
 	void config_Foliage(const std::string& section, const std::string& key, varconf::Variable& variable);
 
+	/**
+	 * @brief Sets the memory budget, in megabytes, of the streamed terrain textures.
+	 */
+	void config_TextureBudget(const std::string& section, const std::string& key, varconf::Variable& variable);
+
 	void terrainHandler_AfterTerrainUpdate(const std::vector<WFMath::AxisBox<2>>& areas, const std::set<TerrainPage*>& pages);
 
 	void terrainHandler_ShaderCreated(const TerrainShader& shader);
@@ -0,0 +1,179 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "TerrainMaterialCompilationQueue.h"
+#include "TerrainPage.h"
+#include "TerrainPageSurfaceCompiler.h"
+#include "TerrainTextureStreamer.h"
+#include "../Convert.h"
+
+#include "framework/TimeFrame.h"
+
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+#include <OgreCamera.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace
+{
+/**
+ * @brief How far up and down from the origin the pages are assumed to extend when checking if they are visible.
+ * The heights of the pages aren't known here, so a generous extent is used.
+ */
+const Ogre::Real PAGE_HEIGHT_EXTENT = 1000;
+}
+
+TerrainMaterialCompilationQueue::TerrainMaterialCompilationQueue() :
+		mCamera(0)
+{
+}
+
+TerrainMaterialCompilationQueue::~TerrainMaterialCompilationQueue()
+{
+	for (CompilationInstanceStore::iterator I = mQueue.begin(); I != mQueue.end(); ++I) {
+		delete I->second;
+	}
+}
+
+void TerrainMaterialCompilationQueue::enqueue(TerrainPage& page, TerrainPageSurfaceCompilationInstance* compilationInstance)
+{
+	CompilationInstanceStore::iterator I = mQueue.find(&page);
+	if (I != mQueue.end()) {
+		//The queued material is outdated by the new one.
+		delete I->second;
+		I->second = compilationInstance;
+	} else {
+		mQueue.insert(CompilationInstanceStore::value_type(&page, compilationInstance));
+	}
+}
+
+void TerrainMaterialCompilationQueue::setCamera(const Ogre::Camera* camera)
+{
+	mCamera = camera;
+}
+
+size_t TerrainMaterialCompilationQueue::size() const
+{
+	return mQueue.size();
+}
+
+std::pair<bool, float> TerrainMaterialCompilationQueue::calculatePriority(const TerrainPage& page) const
+{
+	if (!mCamera) {
+		return std::make_pair(false, 0.0f);
+	}
+	Ogre::TRect<Ogre::Real> extent = Convert::toOgre(page.getWorldExtent());
+	const Ogre::Vector3& cameraPosition = mCamera->getDerivedPosition();
+	Ogre::Vector3 centre((extent.left + extent.right) * 0.5f, cameraPosition.y, (extent.top + extent.bottom) * 0.5f);
+	Ogre::AxisAlignedBox box(extent.left, -PAGE_HEIGHT_EXTENT, extent.top, extent.right, PAGE_HEIGHT_EXTENT, extent.bottom);
+	return std::make_pair(!mCamera->isVisible(box), centre.distance(cameraPosition));
+}
+
+void TerrainMaterialCompilationQueue::poll(const TimeFrame& timeFrame)
+{
+	if (mQueue.empty()) {
+		return;
+	}
+
+	bool hasCompiled = false;
+	for (CompilationInstanceStore::iterator I = mQueue.begin(); I != mQueue.end();) {
+		if (mCompiledPages.find(I->first) == mCompiledPages.end()) {
+			compile(I++);
+			hasCompiled = true;
+		} else {
+			++I;
+		}
+	}
+
+	if (!mQueue.empty()) {
+		std::vector<std::pair<std::pair<bool, float>, TerrainPage*>> priorities;
+		for (CompilationInstanceStore::const_iterator I = mQueue.begin(); I != mQueue.end(); ++I) {
+			priorities.push_back(std::make_pair(calculatePriority(*I->first), I->first));
+		}
+		std::sort(priorities.begin(), priorities.end());
+
+		for (std::vector<std::pair<std::pair<bool, float>, TerrainPage*>>::const_iterator I = priorities.begin(); I != priorities.end(); ++I) {
+			if (hasCompiled && !timeFrame.isTimeLeft()) {
+				break;
+			}
+			compile(mQueue.find(I->second));
+			hasCompiled = true;
+		}
+	}
+
+	if (hasCompiled) {
+		updateSceneManagersAfterMaterialsChange();
+	}
+}
+
+void TerrainMaterialCompilationQueue::compile(CompilationInstanceStore::iterator I)
+{
+	TerrainPage* page = I->first;
+	TerrainPageSurfaceCompilationInstance* compilationInstance = I->second;
+	mQueue.erase(I);
+	compilationInstance->compile(page->getMaterial());
+	delete compilationInstance;
+	if (TerrainTextureStreamer::getSingletonPtr()) {
+		TerrainTextureStreamer::getSingleton().materialCompiled(page->getMaterial()->getName());
+	}
+	mCompiledPages.insert(page);
+}
+
+void TerrainMaterialCompilationQueue::updateSceneManagersAfterMaterialsChange()
+{
+	//We need to do this to prevent stale hashes in Ogre, which will lead to crashes during rendering.
+	if (Ogre::Pass::getDirtyHashList().size() != 0 || Ogre::Pass::getPassGraveyard().size() != 0) {
+		Ogre::SceneManagerEnumerator::SceneManagerIterator scenesIter = Ogre::Root::getSingleton().getSceneManagerIterator();
+
+		while (scenesIter.hasMoreElements()) {
+			Ogre::SceneManager* pScene = scenesIter.getNext();
+			if (pScene) {
+				Ogre::RenderQueue* pQueue = pScene->getRenderQueue();
+				if (pQueue) {
+					Ogre::RenderQueue::QueueGroupIterator groupIter = pQueue->_getQueueGroupIterator();
+					while (groupIter.hasMoreElements()) {
+						Ogre::RenderQueueGroup* pGroup = groupIter.getNext();
+						if (pGroup)
+							pGroup->clear(false);
+					}
+				}
+			}
+		}
+
+		// Now trigger the pending pass updates
+		Ogre::Pass::processPendingPassUpdates();
+	}
+}
+
+}
+}
+}
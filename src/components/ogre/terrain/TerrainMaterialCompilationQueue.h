@@ -0,0 +1,136 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_TERRAINMATERIALCOMPILATIONQUEUE_H_
+#define EMBEROGRE_TERRAIN_TERRAINMATERIALCOMPILATIONQUEUE_H_
+
+#include <map>
+#include <set>
+#include <utility>
+
+namespace Ogre
+{
+class Camera;
+}
+
+namespace Ember
+{
+class TimeFrame;
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+class TerrainPage;
+class TerrainPageSurfaceCompilationInstance;
+
+/**
+ * @brief Compiles prepared terrain page materials in the main thread, a few at a time.
+ *
+ * Compiling a material is expensive, and a change to a single layer can cause every page to be recompiled.
+ * Instead of compiling all of them at once the prepared materials are queued per page, and compiled in order of priority each frame for as long as there's time left.
+ * Pages which are visible from the camera come first, and then the pages closest to it.
+ *
+ * If a page is queued again before its earlier material has been compiled, the earlier one is discarded since it's already outdated.
+ * Pages which haven't got any compiled material yet are always compiled right away, since they otherwise would be shown without any texture.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class TerrainMaterialCompilationQueue
+{
+public:
+
+	TerrainMaterialCompilationQueue();
+
+	/**
+	 * @brief Dtor.
+	 * Any queued materials are discarded.
+	 */
+	~TerrainMaterialCompilationQueue();
+
+	/**
+	 * @brief Queues a prepared material for compilation.
+	 *
+	 * This must be called in the main thread.
+	 * @param page The page to which the material belongs.
+	 * @param compilationInstance The prepared material. Ownership is transferred to this instance.
+	 */
+	void enqueue(TerrainPage& page, TerrainPageSurfaceCompilationInstance* compilationInstance);
+
+	/**
+	 * @brief Compiles queued materials, in order of priority, until the time is up.
+	 *
+	 * At least one material is compiled each call, so that the queue always drains.
+	 * @param timeFrame The time frame allowed for compilation.
+	 */
+	void poll(const TimeFrame& timeFrame);
+
+	/**
+	 * @brief Sets the camera used for prioritising the pages.
+	 * @param camera The camera, or null if the pages should be compiled in any order.
+	 */
+	void setCamera(const Ogre::Camera* camera);
+
+	/**
+	 * @brief Gets the number of pages waiting to have their materials compiled.
+	 * @return The number of queued pages.
+	 */
+	size_t size() const;
+
+private:
+
+	typedef std::map<TerrainPage*, TerrainPageSurfaceCompilationInstance*> CompilationInstanceStore;
+
+	/**
+	 * @brief The queued materials, one for each page.
+	 */
+	CompilationInstanceStore mQueue;
+
+	/**
+	 * @brief Pages which have had their material compiled at least once.
+	 */
+	std::set<const TerrainPage*> mCompiledPages;
+
+	const Ogre::Camera* mCamera;
+
+	/**
+	 * @brief Calculates the priority of a page.
+	 * @param page The page.
+	 * @return The priority; lower values should be compiled first. The first value is false if the page is visible, and the second is the distance to the camera.
+	 */
+	std::pair<bool, float> calculatePriority(const TerrainPage& page) const;
+
+	/**
+	 * @brief Compiles the material of a page.
+	 * @param I The queue entry of the page, which is removed.
+	 */
+	void compile(CompilationInstanceStore::iterator I);
+
+	/**
+	 * @brief This needs to be called after materials have changed to make sure that Ogre flushes it's material caches.
+	 * Failure to do so will result in assert errors during Ogre's rendering.
+	 */
+	void updateSceneManagersAfterMaterialsChange();
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_TERRAINMATERIALCOMPILATIONQUEUE_H_ */
@@ -22,9 +22,9 @@
 #include "TerrainPageSurfaceCompiler.h"
 #include "TerrainPageSurface.h"
 #include "TerrainPageGeometry.h"
+#include "TerrainTextureStreamer.h"
+#include "TerrainMaterialCompilationQueue.h"
 
-#include <OgreRoot.h>
-#include <OgreSceneManager.h>
 namespace Ember
 {
 namespace OgreView
@@ -33,12 +33,13 @@ namespace OgreView
 namespace Terrain
 {
 
-TerrainMaterialCompilationTask::TerrainMaterialCompilationTask(const GeometryPtrVector& geometry) :
-	mGeometry(geometry)
+TerrainMaterialCompilationTask::TerrainMaterialCompilationTask(const GeometryPtrVector& geometry, TerrainMaterialCompilationQueue& compilationQueue) :
+	mGeometry(geometry), mCompilationQueue(compilationQueue)
 {
 }
 
-TerrainMaterialCompilationTask::TerrainMaterialCompilationTask(TerrainPageGeometryPtr geometry)
+TerrainMaterialCompilationTask::TerrainMaterialCompilationTask(TerrainPageGeometryPtr geometry, TerrainMaterialCompilationQueue& compilationQueue) :
+	mCompilationQueue(compilationQueue)
 {
 	mGeometry.push_back(geometry);
 }
@@ -49,11 +50,18 @@ TerrainMaterialCompilationTask::~TerrainMaterialCompilationTask()
 
 void TerrainMaterialCompilationTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
 {
+	TerrainTextureStreamer* textureStreamer = TerrainTextureStreamer::getSingletonPtr();
 	for (GeometryPtrVector::const_iterator J = mGeometry.begin(); J != mGeometry.end(); ++J) {
 		(*J)->repopulate();
+		if (textureStreamer) {
+			//Start loading the layer textures now, so that they aren't loaded synchronously when the material is first rendered.
+			textureStreamer->requestLayerTextures(*(*J)->getPage().getSurface());
+		}
 		TerrainPageSurfaceCompilationInstance* compilationInstance = (*J)->getPage().getSurface()->createSurfaceCompilationInstance(*J);
 		if (compilationInstance->prepare()) {
 			mMaterialRecompilations.push_back(std::pair<TerrainPageSurfaceCompilationInstance*, TerrainPage*>(compilationInstance, &(*J)->getPage()));
+		} else {
+			delete compilationInstance;
 		}
 	}
 	//Release Segment references as soon as we can
@@ -62,40 +70,18 @@ void TerrainMaterialCompilationTask::executeTaskInBackgroundThread(Tasks::TaskEx
 
 void TerrainMaterialCompilationTask::executeTaskInMainThread()
 {
+	//Make sure that placeholders exist for all of the requested textures before they are referenced by the materials.
+	TerrainTextureStreamer* textureStreamer = TerrainTextureStreamer::getSingletonPtr();
+	if (textureStreamer) {
+		textureStreamer->processRequests();
+	}
 	for (CompilationInstanceStore::const_iterator J = mMaterialRecompilations.begin(); J != mMaterialRecompilations.end(); ++J) {
-		TerrainPageSurfaceCompilationInstance* compilationInstance = J->first;
-		TerrainPage* page = J->second;
-		compilationInstance->compile(page->getMaterial());
-		delete compilationInstance;
+		if (textureStreamer) {
+			//The material won't hold on to the textures until it's loaded, which might not happen until the page is shown.
+			textureStreamer->pinLayerTextures(J->second->getMaterial()->getName(), *J->second->getSurface());
+		}
+		mCompilationQueue.enqueue(*J->second, J->first);
 	}
-	updateSceneManagersAfterMaterialsChange();
-}
-
-void TerrainMaterialCompilationTask::updateSceneManagersAfterMaterialsChange()
-{
-	//We need to do this to prevent stale hashes in Ogre, which will lead to crashes during rendering.
-	if (Ogre::Pass::getDirtyHashList().size() != 0 || Ogre::Pass::getPassGraveyard().size() != 0) {
-		Ogre::SceneManagerEnumerator::SceneManagerIterator scenesIter = Ogre::Root::getSingleton().getSceneManagerIterator();
-
-		while (scenesIter.hasMoreElements()) {
-			Ogre::SceneManager* pScene = scenesIter.getNext();
-			if (pScene) {
-				Ogre::RenderQueue* pQueue = pScene->getRenderQueue();
-				if (pQueue) {
-					Ogre::RenderQueue::QueueGroupIterator groupIter = pQueue->_getQueueGroupIterator();
-					while (groupIter.hasMoreElements()) {
-						Ogre::RenderQueueGroup* pGroup = groupIter.getNext();
-						if (pGroup)
-							pGroup->clear(false);
-					}//end_while(groupIter.hasMoreElements())
-				}//end_if(pScene)
-			}//end_if(pScene)
-		}//end_while(scenesIter.hasMoreElements())
-
-		// Now trigger the pending pass updates
-		Ogre::Pass::processPendingPassUpdates();
-
-	}//end_if(m_Root..
 }
 
 }
@@ -33,9 +33,12 @@ namespace Ember
 
       class TerrainPageSurfaceCompilationInstance;
       class TerrainPage;
+      class TerrainMaterialCompilationQueue;
 
       /**
        * @brief Recompiles the material for a terrain page.
+       *
+       * The materials are prepared in the background thread, and then handed to the compilation queue which compiles them in the main thread.
        * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
        */
       class TerrainMaterialCompilationTask : public Tasks::TemplateNamedTask<
@@ -46,14 +49,18 @@ namespace Ember
         /**
          * @brief Ctor.
          * @param pages The pages which needs to have their material recompiled.
+         * @param compilationQueue The queue which will compile the prepared materials.
          */
-        TerrainMaterialCompilationTask(const GeometryPtrVector& geometry);
+        TerrainMaterialCompilationTask(const GeometryPtrVector& geometry,
+            TerrainMaterialCompilationQueue& compilationQueue);
 
         /**
          * @brief Ctor.
          * @param page The page which needs to have its material recompiled.
+         * @param compilationQueue The queue which will compile the prepared material.
          */
-        TerrainMaterialCompilationTask(TerrainPageGeometryPtr pageGeometry);
+        TerrainMaterialCompilationTask(TerrainPageGeometryPtr pageGeometry,
+            TerrainMaterialCompilationQueue& compilationQueue);
 
         /**
          * @brief Dtor.
@@ -80,16 +87,14 @@ namespace Ember
         GeometryPtrVector mGeometry;
 
         /**
-         * @brief The compilation instances and their corresponding pages.
+         * @brief The queue which compiles the prepared materials.
          */
-        CompilationInstanceStore mMaterialRecompilations;
+        TerrainMaterialCompilationQueue& mCompilationQueue;
 
         /**
-         * @brief This needs to be called after materials have changed to make sure that Ogre flushes it's material caches.
-         * Failure to do so will result in assert errors during Ogre's rendering.
+         * @brief The compilation instances and their corresponding pages.
          */
-        void
-        updateSceneManagersAfterMaterialsChange();
+        CompilationInstanceStore mMaterialRecompilations;
 
       };
 
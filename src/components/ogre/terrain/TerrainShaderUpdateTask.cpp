@@ -34,14 +34,14 @@ namespace OgreView
 namespace Terrain
 {
 
-TerrainShaderUpdateTask::TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const TerrainShader* shader, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal) :
-	mGeometry(geometry), mAreas(areas), mSignal(signal)
+TerrainShaderUpdateTask::TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const TerrainShader* shader, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal, TerrainMaterialCompilationQueue& compilationQueue) :
+	mGeometry(geometry), mAreas(areas), mSignal(signal), mCompilationQueue(compilationQueue)
 {
 	mShaders.push_back(shader);
 }
 
-TerrainShaderUpdateTask::TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const std::vector<const TerrainShader*>& shaders, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal) :
-	mGeometry(geometry), mShaders(shaders), mAreas(areas), mSignal(signal)
+TerrainShaderUpdateTask::TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const std::vector<const TerrainShader*>& shaders, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal, TerrainMaterialCompilationQueue& compilationQueue) :
+	mGeometry(geometry), mShaders(shaders), mAreas(areas), mSignal(signal), mCompilationQueue(compilationQueue)
 {
 }
 
@@ -71,7 +71,9 @@ void TerrainShaderUpdateTask::executeTaskInBackgroundThread(Tasks::TaskExecution
 		}
 	}
 
-	context.executeTask(new TerrainMaterialCompilationTask(updatedPages));
+	if (!updatedPages.empty()) {
+		context.executeTask(new TerrainMaterialCompilationTask(updatedPages, mCompilationQueue));
+	}
 	//Release Segment references as soon as we can
 	mGeometry.clear();
 }
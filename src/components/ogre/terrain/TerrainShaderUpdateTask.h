@@ -43,6 +43,7 @@ namespace Terrain
 class TerrainShader;
 class TerrainPage;
 class TerrainPageSurfaceCompilationInstance;
+class TerrainMaterialCompilationQueue;
 
 /**
  * @brief Updates a terrain shader, i.e. the mercator surfaces.
@@ -59,8 +60,9 @@ public:
 	 * @param shader The shader which for each page will be be applied.
 	 * @param areas Any areas which define the area to update. This will only be applied if updateAll is set to false.
 	 * @param signal A signal which will be emitted in the main thread once all surfaces have been updated.
+	 * @param compilationQueue The queue which will compile the materials of the updated pages.
 	 */
-	TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const TerrainShader* shader, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal);
+	TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const TerrainShader* shader, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal, TerrainMaterialCompilationQueue& compilationQueue);
 
 	/**
 	 * @brief Ctor.
@@ -68,8 +70,9 @@ public:
 	 * @param shaders The shaders which for each page will be be applied.
 	 * @param areas Any areas which define the area to update. This will only be applied if updateAll is set to false.
 	 * @param signal A signal which will be emitted in the main thread once all surfaces have been updated.
+	 * @param compilationQueue The queue which will compile the materials of the updated pages.
 	 */
-	TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const std::vector<const TerrainShader*>& shaders, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal);
+	TerrainShaderUpdateTask(const GeometryPtrVector& geometry, const std::vector<const TerrainShader*>& shaders, const AreaStore& areas, sigc::signal<void, const TerrainShader*, const AreaStore&>& signal, TerrainMaterialCompilationQueue& compilationQueue);
 
 	virtual ~TerrainShaderUpdateTask();
 
@@ -99,6 +102,11 @@ private:
 	 */
 	sigc::signal<void, const TerrainShader*, const AreaStore& >& mSignal;
 
+	/**
+	 * @brief The queue which compiles the materials of the updated pages.
+	 */
+	TerrainMaterialCompilationQueue& mCompilationQueue;
+
 };
 
 }
@@ -0,0 +1,132 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "TerrainTextureLoadTask.h"
+#include "TerrainTextureStreamer.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <OgreImage.h>
+#include <OgrePixelFormat.h>
+#include <OgreResourceGroupManager.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace
+{
+/**
+ * @brief The largest width or height of the low resolution version of an image.
+ */
+const size_t LOW_RESOLUTION = 64;
+}
+
+TerrainTextureLoadTask::TerrainTextureLoadTask(TerrainTextureStreamer& streamer, const std::string& textureName, const std::string& resourceGroup, Ogre::DataStreamPtr stream) :
+		mStreamer(streamer), mTextureName(textureName), mResourceGroup(resourceGroup), mStream(stream)
+{
+}
+
+TerrainTextureLoadTask::~TerrainTextureLoadTask()
+{
+}
+
+void TerrainTextureLoadTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	try {
+		if (mStream.isNull()) {
+			mStream = Ogre::ResourceGroupManager::getSingleton().openResource(mTextureName, mResourceGroup, true);
+		}
+		std::string extension;
+		std::string::size_type pos = mTextureName.find_last_of(".");
+		if (pos != std::string::npos) {
+			extension = mTextureName.substr(pos + 1);
+		}
+
+		std::shared_ptr<Ogre::Image> image(new Ogre::Image());
+		image->load(mStream, extension);
+		mImage = image;
+
+		std::shared_ptr<Ogre::Image> lowImage(new Ogre::Image());
+		if (createLowImage(*image, *lowImage)) {
+			mLowImage = lowImage;
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when loading terrain texture " << mTextureName << "." << ex);
+		mImage.reset();
+	}
+	mStream.setNull();
+}
+
+void TerrainTextureLoadTask::executeTaskInMainThread()
+{
+	if (mImage) {
+		mStreamer.imageLoaded(mTextureName, mImage, mLowImage);
+	} else {
+		mStreamer.imageLoadFailed(mTextureName);
+	}
+}
+
+bool TerrainTextureLoadTask::createLowImage(const Ogre::Image& image, Ogre::Image& lowImage)
+{
+	const size_t width = image.getWidth();
+	const size_t height = image.getHeight();
+	if (std::max(width, height) <= LOW_RESOLUTION) {
+		return false;
+	}
+	const Ogre::PixelFormat format = image.getFormat();
+
+	if (Ogre::PixelUtil::isCompressed(format)) {
+		for (size_t mipmap = 1; mipmap <= image.getNumMipmaps(); ++mipmap) {
+			Ogre::PixelBox box = image.getPixelBox(0, mipmap);
+			if (std::max(box.getWidth(), box.getHeight()) <= LOW_RESOLUTION) {
+				size_t size = Ogre::PixelUtil::getMemorySize(box.getWidth(), box.getHeight(), 1, format);
+				Ogre::uchar* data = OGRE_ALLOC_T(Ogre::uchar, size, Ogre::MEMCATEGORY_GENERAL);
+				memcpy(data, box.data, size);
+				lowImage.loadDynamicImage(data, box.getWidth(), box.getHeight(), 1, format, true);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//Keep the aspect ratio.
+	const size_t lowWidth = std::max<size_t>(1, (width * LOW_RESOLUTION) / std::max(width, height));
+	const size_t lowHeight = std::max<size_t>(1, (height * LOW_RESOLUTION) / std::max(width, height));
+	size_t size = Ogre::PixelUtil::getMemorySize(lowWidth, lowHeight, 1, format);
+	Ogre::uchar* data = OGRE_ALLOC_T(Ogre::uchar, size, Ogre::MEMCATEGORY_GENERAL);
+	Ogre::PixelBox lowBox(lowWidth, lowHeight, 1, format, data);
+	Ogre::Image::scale(image.getPixelBox(), lowBox, Ogre::Image::FILTER_BILINEAR);
+	lowImage.loadDynamicImage(data, lowWidth, lowHeight, 1, format, true);
+	return true;
+}
+
+}
+}
+}
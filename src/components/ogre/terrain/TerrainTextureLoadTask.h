@@ -0,0 +1,92 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_TERRAINTEXTURELOADTASK_H_
+#define EMBEROGRE_TERRAIN_TERRAINTEXTURELOADTASK_H_
+
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <OgreDataStream.h>
+
+#include <memory>
+#include <string>
+
+namespace Ogre
+{
+class Image;
+}
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+class TerrainTextureStreamer;
+
+/**
+ * @brief Decodes the image of a terrain texture in a background thread, and creates a low resolution version of it.
+ *
+ * The images are then handed to the TerrainTextureStreamer in the main thread.
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class TerrainTextureLoadTask: public Tasks::TemplateNamedTask<TerrainTextureLoadTask>
+{
+public:
+	/**
+	 * @brief Ctor.
+	 * @param streamer The streamer, which will receive the images in the main thread.
+	 * @param textureName The name of the texture.
+	 * @param resourceGroup The resource group of the texture.
+	 * @param stream The stream to read the image from. If null, the stream will be opened in the background thread.
+	 */
+	TerrainTextureLoadTask(TerrainTextureStreamer& streamer, const std::string& textureName, const std::string& resourceGroup, Ogre::DataStreamPtr stream);
+
+	virtual ~TerrainTextureLoadTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+	/**
+	 * @brief Creates a low resolution version of an image.
+	 *
+	 * Compressed images can't be scaled, so for those the largest mipmap which is small enough is used, if the image has one.
+	 * @param image The image.
+	 * @param lowImage The image to fill with the low resolution version.
+	 * @return True if a low resolution version could be created. False if the image either already is small or can't be scaled.
+	 */
+	static bool createLowImage(const Ogre::Image& image, Ogre::Image& lowImage);
+
+private:
+	TerrainTextureStreamer& mStreamer;
+	const std::string mTextureName;
+	const std::string mResourceGroup;
+	Ogre::DataStreamPtr mStream;
+
+	std::shared_ptr<Ogre::Image> mImage;
+	std::shared_ptr<Ogre::Image> mLowImage;
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_TERRAINTEXTURELOADTASK_H_ */
@@ -0,0 +1,344 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "TerrainTextureStreamer.h"
+#include "TerrainTextureLoadTask.h"
+#include "TerrainPageSurface.h"
+#include "TerrainPageSurfaceLayer.h"
+
+#include "framework/tasks/TaskQueue.h"
+#include "framework/TimeFrame.h"
+#include "framework/LoggingInstance.h"
+
+#include <OgreTextureManager.h>
+#include <OgreMaterialManager.h>
+#include <OgreResourceGroupManager.h>
+#include <OgreImage.h>
+#include <OgrePixelFormat.h>
+
+template<> Ember::OgreView::Terrain::TerrainTextureStreamer* Ember::Singleton<Ember::OgreView::Terrain::TerrainTextureStreamer>::ms_Singleton = 0;
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace
+{
+/**
+ * @brief The colour of the placeholder used for diffuse textures.
+ */
+const Ogre::ColourValue DIFFUSE_PLACEHOLDER_COLOUR(0.5f, 0.5f, 0.5f);
+
+/**
+ * @brief The colour of the placeholder used for normal maps; a normal pointing straight up.
+ */
+const Ogre::ColourValue NORMAL_PLACEHOLDER_COLOUR(0.5f, 0.5f, 1.0f);
+
+/**
+ * @brief The default memory budget, in bytes.
+ */
+const size_t DEFAULT_BUDGET = 256 * 1024 * 1024;
+}
+
+TerrainTextureStreamer::TerrainTextureStreamer(const std::string& resourceGroup) :
+		mResourceGroup(resourceGroup), mTaskQueue(new Tasks::TaskQueue(1)), mBudget(DEFAULT_BUDGET), mFrame(0)
+{
+}
+
+TerrainTextureStreamer::~TerrainTextureStreamer()
+{
+	//Deleting the queue will process any loaded images, so this must be done while the textures are still tracked.
+	delete mTaskQueue;
+
+	//Textures which haven't been fully loaded are removed, so that they aren't left at low resolution if they're used again.
+	for (TextureStore::iterator I = mTextures.begin(); I != mTextures.end(); ++I) {
+		if (I->second.stage != TS_FULL) {
+			Ogre::TextureManager::getSingleton().remove(I->second.texture->getHandle());
+		}
+	}
+}
+
+void TerrainTextureStreamer::request(const std::string& textureName, const Ogre::ColourValue& placeholderColour)
+{
+	if (textureName.empty()) {
+		return;
+	}
+	std::unique_lock<std::mutex> l(mRequestsMutex);
+	mRequests.push_back(std::make_pair(textureName, placeholderColour));
+}
+
+void TerrainTextureStreamer::requestLayerTextures(const TerrainPageSurface& surface)
+{
+	const TerrainPageSurface::TerrainPageSurfaceLayerStore& layers = surface.getLayers();
+	for (TerrainPageSurface::TerrainPageSurfaceLayerStore::const_iterator I = layers.begin(); I != layers.end(); ++I) {
+		request(I->second->getDiffuseTextureName(), DIFFUSE_PLACEHOLDER_COLOUR);
+		request(I->second->getNormalTextureName(), NORMAL_PLACEHOLDER_COLOUR);
+	}
+}
+
+void TerrainTextureStreamer::pinLayerTextures(const std::string& materialName, const TerrainPageSurface& surface)
+{
+	PendingMaterial& pendingMaterial = mPendingMaterials[materialName];
+	pendingMaterial.compiled = false;
+	pendingMaterial.textureNames.clear();
+	const TerrainPageSurface::TerrainPageSurfaceLayerStore& layers = surface.getLayers();
+	for (TerrainPageSurface::TerrainPageSurfaceLayerStore::const_iterator I = layers.begin(); I != layers.end(); ++I) {
+		pendingMaterial.textureNames.push_back(I->second->getDiffuseTextureName());
+		pendingMaterial.textureNames.push_back(I->second->getNormalTextureName());
+	}
+	mPinnedTextures.insert(pendingMaterial.textureNames.begin(), pendingMaterial.textureNames.end());
+}
+
+void TerrainTextureStreamer::materialCompiled(const std::string& materialName)
+{
+	MaterialTextureStore::iterator I = mPendingMaterials.find(materialName);
+	if (I != mPendingMaterials.end()) {
+		I->second.compiled = true;
+	}
+}
+
+void TerrainTextureStreamer::processRequests()
+{
+	std::vector<std::pair<std::string, Ogre::ColourValue>> requests;
+	{
+		std::unique_lock<std::mutex> l(mRequestsMutex);
+		requests.swap(mRequests);
+	}
+	for (std::vector<std::pair<std::string, Ogre::ColourValue>>::const_iterator I = requests.begin(); I != requests.end(); ++I) {
+		startStreaming(I->first, I->second);
+	}
+}
+
+void TerrainTextureStreamer::startStreaming(const std::string& textureName, const Ogre::ColourValue& placeholderColour)
+{
+	TextureStore::iterator I = mTextures.find(textureName);
+	if (I != mTextures.end()) {
+		I->second.lastUsed = mFrame;
+		return;
+	}
+
+	Ogre::TextureManager& textureManager = Ogre::TextureManager::getSingleton();
+	Ogre::TexturePtr texture = static_cast<Ogre::TexturePtr>(textureManager.getByName(textureName, mResourceGroup));
+	if (!texture.isNull() && (texture->isLoaded() || texture->isLoading())) {
+		//Already loaded by someone else.
+		return;
+	}
+	if (!Ogre::ResourceGroupManager::getSingleton().resourceExistsInAnyGroup(textureName)) {
+		//Let Ogre report the missing texture when it's used.
+		return;
+	}
+
+	Ogre::DataStreamPtr stream;
+#if !OGRE_THREAD_SUPPORT
+	//The resource system isn't thread safe, so the stream must be opened here.
+	try {
+		stream = Ogre::ResourceGroupManager::getSingleton().openResource(textureName, mResourceGroup, true);
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when opening terrain texture " << textureName << "." << ex);
+		return;
+	}
+#endif
+
+	if (texture.isNull()) {
+		//The texture isn't created as a manual resource, so that Ogre can reload it from disk by itself if it needs to.
+		texture = static_cast<Ogre::TexturePtr>(textureManager.create(textureName, mResourceGroup));
+	}
+
+	Ogre::uchar* data = OGRE_ALLOC_T(Ogre::uchar, Ogre::PixelUtil::getNumElemBytes(Ogre::PF_BYTE_RGBA), Ogre::MEMCATEGORY_GENERAL);
+	Ogre::PixelUtil::packColour(placeholderColour, Ogre::PF_BYTE_RGBA, data);
+	Ogre::Image placeholder;
+	placeholder.loadDynamicImage(data, 1, 1, 1, Ogre::PF_BYTE_RGBA, true);
+	uploadImage(texture, placeholder);
+
+	TextureEntry& entry = mTextures[textureName];
+	entry.texture = texture;
+	entry.stage = TS_PLACEHOLDER;
+	entry.lastUsed = mFrame;
+
+	mTaskQueue->enqueueTask(new TerrainTextureLoadTask(*this, textureName, mResourceGroup, stream));
+}
+
+void TerrainTextureStreamer::uploadImage(Ogre::TexturePtr texture, const Ogre::Image& image)
+{
+	//The texture must be unloaded before a new image can be loaded into it. Any material using it will still refer to the same texture.
+	texture->unload();
+	if (Ogre::PixelUtil::isCompressed(image.getFormat())) {
+		//Mipmaps can't be generated for compressed images, so only those in the image can be used.
+		texture->setNumMipmaps(image.getNumMipmaps());
+	} else {
+		texture->setNumMipmaps(Ogre::TextureManager::getSingleton().getDefaultNumMipmaps());
+	}
+	texture->loadImage(image);
+}
+
+void TerrainTextureStreamer::imageLoaded(const std::string& textureName, std::shared_ptr<Ogre::Image> image, std::shared_ptr<Ogre::Image> lowImage)
+{
+	TextureStore::iterator I = mTextures.find(textureName);
+	//The texture might have been evicted, or loaded already by an earlier request.
+	if (I == mTextures.end() || I->second.stage != TS_PLACEHOLDER) {
+		return;
+	}
+	TextureEntry& entry = I->second;
+	try {
+		if (lowImage) {
+			uploadImage(entry.texture, *lowImage);
+			entry.stage = TS_LOW;
+			entry.pendingImage = image;
+			mPendingRefinements.push_back(textureName);
+		} else {
+			//The image is small enough to be uploaded right away.
+			uploadImage(entry.texture, *image);
+			entry.stage = TS_FULL;
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when uploading terrain texture " << textureName << "." << ex);
+	}
+}
+
+void TerrainTextureStreamer::imageLoadFailed(const std::string& textureName)
+{
+	//The placeholder is kept, since Ogre would fail to load the texture anyway.
+	S_LOG_WARNING("Could not stream terrain texture " << textureName << "; the placeholder will be used.");
+}
+
+bool TerrainTextureStreamer::refine(const std::string& textureName)
+{
+	TextureStore::iterator I = mTextures.find(textureName);
+	if (I == mTextures.end() || !I->second.pendingImage) {
+		return true;
+	}
+	TextureEntry& entry = I->second;
+	const Ogre::Image& image = *entry.pendingImage;
+	size_t fullSize = Ogre::PixelUtil::getMemorySize(image.getWidth(), image.getHeight(), image.getDepth(), image.getFormat()) * image.getNumFaces();
+	size_t currentSize = entry.texture->getSize();
+	if (!evict(fullSize > currentSize ? fullSize - currentSize : 0, textureName)) {
+		return false;
+	}
+	try {
+		uploadImage(entry.texture, image);
+		entry.stage = TS_FULL;
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when uploading terrain texture " << textureName << "." << ex);
+	}
+	entry.pendingImage.reset();
+	return true;
+}
+
+void TerrainTextureStreamer::updatePinnedTextures()
+{
+	mPinnedTextures.clear();
+	Ogre::MaterialManager& materialManager = Ogre::MaterialManager::getSingleton();
+	for (MaterialTextureStore::iterator I = mPendingMaterials.begin(); I != mPendingMaterials.end();) {
+		Ogre::MaterialPtr material = static_cast<Ogre::MaterialPtr>(materialManager.getByName(I->first));
+		//Once the compiled material is loaded it holds references to its textures, which keeps them from being evicted.
+		//A material which already was loaded doesn't reference any new textures until it has been compiled.
+		if (material.isNull() || (I->second.compiled && material->isLoaded())) {
+			mPendingMaterials.erase(I++);
+		} else {
+			mPinnedTextures.insert(I->second.textureNames.begin(), I->second.textureNames.end());
+			++I;
+		}
+	}
+}
+
+bool TerrainTextureStreamer::isInUse(const std::string& textureName, const Ogre::TexturePtr& texture) const
+{
+	//Besides the resource system, the streamer itself holds a reference.
+	return texture.useCount() > Ogre::ResourceGroupManager::RESOURCE_SYSTEM_NUM_REFERENCE_COUNTS + 1 || mPinnedTextures.find(textureName) != mPinnedTextures.end();
+}
+
+bool TerrainTextureStreamer::evict(size_t neededBytes, const std::string& keepTextureName)
+{
+	size_t usage = getMemoryUsage();
+	while (usage + neededBytes > mBudget) {
+		TextureStore::iterator leastRecentlyUsed = mTextures.end();
+		for (TextureStore::iterator I = mTextures.begin(); I != mTextures.end(); ++I) {
+			if (I->first != keepTextureName && !isInUse(I->first, I->second.texture)) {
+				if (leastRecentlyUsed == mTextures.end() || I->second.lastUsed < leastRecentlyUsed->second.lastUsed) {
+					leastRecentlyUsed = I;
+				}
+			}
+		}
+		if (leastRecentlyUsed == mTextures.end()) {
+			return false;
+		}
+		S_LOG_VERBOSE("Evicting terrain texture " << leastRecentlyUsed->first << " to stay within the texture budget.");
+		usage -= std::min(usage, leastRecentlyUsed->second.texture->getSize());
+		Ogre::TextureManager::getSingleton().remove(leastRecentlyUsed->second.texture->getHandle());
+		mTextures.erase(leastRecentlyUsed);
+	}
+	return true;
+}
+
+void TerrainTextureStreamer::poll(const TimeFrame& timeFrame)
+{
+	mFrame++;
+
+	processRequests();
+	mTaskQueue->pollProcessedTasks(timeFrame);
+	updatePinnedTextures();
+
+	for (TextureStore::iterator I = mTextures.begin(); I != mTextures.end(); ++I) {
+		if (isInUse(I->first, I->second.texture)) {
+			I->second.lastUsed = mFrame;
+		}
+	}
+
+	//Uploading a full texture is expensive, so at most one is refined each frame.
+	if (!mPendingRefinements.empty() && timeFrame.isTimeLeft()) {
+		std::string textureName = mPendingRefinements.front();
+		mPendingRefinements.pop_front();
+		if (!refine(textureName)) {
+			//There's no room for it right now; try again later.
+			mPendingRefinements.push_back(textureName);
+		}
+	}
+
+	evict(0, "");
+}
+
+void TerrainTextureStreamer::setBudget(size_t bytes)
+{
+	mBudget = bytes;
+}
+
+size_t TerrainTextureStreamer::getBudget() const
+{
+	return mBudget;
+}
+
+size_t TerrainTextureStreamer::getMemoryUsage() const
+{
+	size_t usage = 0;
+	for (TextureStore::const_iterator I = mTextures.begin(); I != mTextures.end(); ++I) {
+		usage += I->second.texture->getSize();
+	}
+	return usage;
+}
+
+}
+}
+}
@@ -0,0 +1,302 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_TERRAINTEXTURESTREAMER_H_
+#define EMBEROGRE_TERRAIN_TERRAINTEXTURESTREAMER_H_
+
+#include "framework/Singleton.h"
+
+#include <OgreTexture.h>
+#include <OgreColourValue.h>
+
+#include <map>
+#include <set>
+#include <list>
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+
+namespace Ogre
+{
+class Image;
+}
+
+namespace Ember
+{
+class TimeFrame;
+namespace Tasks
+{
+class TaskQueue;
+}
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+class TerrainPageSurface;
+
+/**
+ * @brief Streams the diffuse and normal map textures of the terrain layers in the background.
+ *
+ * Without this the textures would be loaded by Ogre the first time a terrain material using them was rendered, stalling the main thread.
+ * Instead the textures are requested when the material of a page is about to be compiled. A tiny placeholder texture is then created under the name of the requested texture, so that the material never will cause it to be loaded from disk.
+ * The image is decoded in a background thread, after which a low resolution version first is uploaded into the texture, which then is refined into the full resolution image in a later frame.
+ * Since the texture object itself is kept, any material using it will be refined in place.
+ *
+ * The textures are kept within a memory budget. When the budget is exceeded the textures which haven't been used for the longest time are evicted.
+ * Textures which are still used by any material are never evicted. This includes materials which have been compiled but not yet loaded, since they don't hold any references to their textures until they're loaded. If there still isn't room for a texture it will be kept at low resolution until there is.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class TerrainTextureStreamer : public Singleton<TerrainTextureStreamer>
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param resourceGroup The resource group in which the textures are created.
+	 */
+	TerrainTextureStreamer(const std::string& resourceGroup);
+
+	virtual ~TerrainTextureStreamer();
+
+	/**
+	 * @brief Requests that a texture is streamed in.
+	 *
+	 * This is thread safe, and is meant to be called from background threads.
+	 * Nothing is done until the request is processed in the main thread.
+	 * @param textureName The name of the texture.
+	 * @param placeholderColour The colour of the placeholder which is used until the texture has been loaded.
+	 */
+	void request(const std::string& textureName, const Ogre::ColourValue& placeholderColour);
+
+	/**
+	 * @brief Requests that the textures of all layers of a surface are streamed in.
+	 *
+	 * This is thread safe, as long as the layers of the surface aren't altered at the same time.
+	 * @param surface The surface.
+	 */
+	void requestLayerTextures(const TerrainPageSurface& surface);
+
+	/**
+	 * @brief Pins the textures of all layers of a surface until a material using them has been compiled and loaded.
+	 *
+	 * This must be called in the main thread when the material is queued for compilation. Any textures pinned for the material previously are released.
+	 * @param materialName The name of the material.
+	 * @param surface The surface.
+	 */
+	void pinLayerTextures(const std::string& materialName, const TerrainPageSurface& surface);
+
+	/**
+	 * @brief Tells the streamer that a material with pinned textures has been compiled.
+	 *
+	 * The textures are then released as soon as the material has been loaded.
+	 * @param materialName The name of the material.
+	 */
+	void materialCompiled(const std::string& materialName);
+
+	/**
+	 * @brief Processes any outstanding requests, creating placeholder textures for those textures which haven't been loaded yet.
+	 *
+	 * This must be called in the main thread before a material using any requested texture is compiled.
+	 */
+	void processRequests();
+
+	/**
+	 * @brief Uploads loaded textures, and evicts textures if the budget is exceeded.
+	 *
+	 * This must be called in the main thread each frame.
+	 * @param timeFrame The time left for this frame.
+	 */
+	void poll(const TimeFrame& timeFrame);
+
+	/**
+	 * @brief Sets the memory budget.
+	 * @param bytes The budget, in bytes.
+	 */
+	void setBudget(size_t bytes);
+
+	/**
+	 * @brief Gets the memory budget.
+	 * @return The budget, in bytes.
+	 */
+	size_t getBudget() const;
+
+	/**
+	 * @brief Gets the memory currently used by the streamed textures.
+	 * @return The memory used, in bytes.
+	 */
+	size_t getMemoryUsage() const;
+
+	/**
+	 * @brief Called by the loading task in the main thread when an image has been loaded.
+	 * @param textureName The name of the texture.
+	 * @param image The full image.
+	 * @param lowImage A low resolution version of the image, or null if none could be created.
+	 */
+	void imageLoaded(const std::string& textureName, std::shared_ptr<Ogre::Image> image, std::shared_ptr<Ogre::Image> lowImage);
+
+	/**
+	 * @brief Called by the loading task in the main thread when an image couldn't be loaded.
+	 * @param textureName The name of the texture.
+	 */
+	void imageLoadFailed(const std::string& textureName);
+
+private:
+
+	/**
+	 * @brief How far a streamed texture has been loaded.
+	 */
+	enum TextureStage
+	{
+		/**
+		 * @brief The texture contains a placeholder, and the image is being loaded.
+		 */
+		TS_PLACEHOLDER,
+
+		/**
+		 * @brief The texture contains the low resolution version of the image.
+		 */
+		TS_LOW,
+
+		/**
+		 * @brief The texture contains the full image.
+		 */
+		TS_FULL
+	};
+
+	struct TextureEntry
+	{
+		Ogre::TexturePtr texture;
+		TextureStage stage;
+
+		/**
+		 * @brief The full image, kept while it's waiting to be uploaded.
+		 */
+		std::shared_ptr<Ogre::Image> pendingImage;
+
+		/**
+		 * @brief The frame in which the texture was last requested or used by a material.
+		 */
+		unsigned long lastUsed;
+	};
+
+	typedef std::map<std::string, TextureEntry> TextureStore;
+
+	/**
+	 * @brief A material which will use streamed textures once it's compiled and loaded.
+	 */
+	struct PendingMaterial
+	{
+		std::vector<std::string> textureNames;
+		bool compiled;
+	};
+
+	typedef std::map<std::string, PendingMaterial> MaterialTextureStore;
+
+	const std::string mResourceGroup;
+
+	/**
+	 * @brief The queue on which the images are loaded.
+	 */
+	Tasks::TaskQueue* mTaskQueue;
+
+	TextureStore mTextures;
+
+	/**
+	 * @brief Requests which haven't been processed yet.
+	 */
+	std::vector<std::pair<std::string, Ogre::ColourValue>> mRequests;
+
+	/**
+	 * @brief A mutex for accessing mRequests.
+	 */
+	std::mutex mRequestsMutex;
+
+	/**
+	 * @brief The names of textures whose full images are waiting to be uploaded, in order of arrival.
+	 */
+	std::list<std::string> mPendingRefinements;
+
+	/**
+	 * @brief The textures used by materials which haven't been compiled and loaded yet, by material name.
+	 */
+	MaterialTextureStore mPendingMaterials;
+
+	/**
+	 * @brief The textures used by any of the pending materials.
+	 */
+	std::set<std::string> mPinnedTextures;
+
+	size_t mBudget;
+
+	/**
+	 * @brief The number of frames polled, used to keep track of when textures were last used.
+	 */
+	unsigned long mFrame;
+
+	/**
+	 * @brief Creates the placeholder for a texture and starts to load it, unless it's already loaded.
+	 * @param textureName The name of the texture.
+	 * @param placeholderColour The colour of the placeholder.
+	 */
+	void startStreaming(const std::string& textureName, const Ogre::ColourValue& placeholderColour);
+
+	/**
+	 * @brief Uploads an image into a texture, replacing what was there.
+	 * @param texture The texture.
+	 * @param image The image.
+	 */
+	void uploadImage(Ogre::TexturePtr texture, const Ogre::Image& image);
+
+	/**
+	 * @brief Uploads the full image of a texture, if there's room for it within the budget.
+	 * @param textureName The name of the texture.
+	 * @return True if the texture no longer needs to be refined.
+	 */
+	bool refine(const std::string& textureName);
+
+	/**
+	 * @brief Evicts the least recently used textures until the memory used is below the budget.
+	 * @param neededBytes Additional memory which should be made room for.
+	 * @param keepTextureName The name of a texture which shouldn't be evicted, or an empty string.
+	 * @return True if the memory used plus the additional memory is within the budget.
+	 */
+	bool evict(size_t neededBytes, const std::string& keepTextureName);
+
+	/**
+	 * @brief Releases the textures of those pending materials which have been compiled and loaded, or removed.
+	 */
+	void updatePinnedTextures();
+
+	/**
+	 * @brief Checks if a texture is used by anything else than the resource system and the streamer, or is pinned by a pending material.
+	 * @param textureName The name of the texture.
+	 * @param texture The texture.
+	 * @return True if it's used.
+	 */
+	bool isInUse(const std::string& textureName, const Ogre::TexturePtr& texture) const;
+};
+
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_TERRAINTEXTURESTREAMER_H_ */
@@ -8,8 +8,7 @@
 #include "ClusterPopulator.h"
 #include "components/ogre/terrain/PlantAreaQueryResult.h"
 #include "components/ogre/terrain/PlantAreaQuery.h"
-#include "components/ogre/terrain/SegmentReference.h"
-#include "components/ogre/terrain/Segment.h"
+#include "SegmentFoliageData.h"
 #include "components/ogre/terrain/Buffer.h"
 #include "components/ogre/terrain/PlantInstance.h"
 #include "components/ogre/Convert.h"
@@ -17,10 +16,6 @@
 #include <wfmath/intersect.h>
 #include <wfmath/randgen.h>
 #include <cmath>
-
-#include <Mercator/Segment.h>
-#include <Mercator/Surface.h>
-#include <Mercator/Shader.h>
 namespace Ember
 {
 namespace OgreView
@@ -41,67 +36,52 @@ ClusterPopulator::~ClusterPopulator()
 {
 }
 
-void ClusterPopulator::populate(PlantAreaQueryResult& result, SegmentRefPtr segmentRef)
+void ClusterPopulator::populate(PlantAreaQueryResult& result, const SegmentFoliageData& segmentData)
 {
-	Mercator::Segment& mercatorSegment = segmentRef->getSegment().getMercatorSegment();
-	if (!mercatorSegment.isValid()) {
-		mercatorSegment.populate();
-	}
-
-	const PlantAreaQuery& query = result.getQuery();
+	const Buffer<unsigned char>* combinedCoverage = segmentData.getCombinedCoverage(mLayerIndex);
+	//Check that there actually is a valid surface on which the plants can be placed
+	if (combinedCoverage) {
+		const WFMath::AxisBox<2>& area = Convert::toWF(result.getQuery().getArea());
 
-	const WFMath::AxisBox<2>& area = Convert::toWF(query.getArea());
+		std::shared_ptr<const ClusterStore> clusters = getClustersForSegment(segmentData);
+		populateWithClusters(segmentData, result, area, *clusters, *combinedCoverage);
+	}
+}
 
-	//Make a small list of surfaces in order
-	std::list<int> indexSort;
-	for (Mercator::Segment::Surfacestore::const_iterator I = mercatorSegment.getSurfaces().begin(); I != mercatorSegment.getSurfaces().end(); ++I) {
-		if (I->first >= mLayerIndex) {
-			if (I->second->m_shader.checkIntersect(mercatorSegment)) {
-				if (!I->second->isValid()) {
-					I->second->populate();
-				}
-				indexSort.push_back(I->first);
-			}
+std::shared_ptr<const ClusterStore> ClusterPopulator::getClustersForSegment(const SegmentFoliageData& segmentData)
+{
+	std::pair<int, int> key(segmentData.getXRef(), segmentData.getYRef());
+	{
+		std::unique_lock<std::mutex> l(mSegmentClustersMutex);
+		SegmentClusterStore::const_iterator I = mSegmentClusters.find(key);
+		if (I != mSegmentClusters.end()) {
+			return I->second;
 		}
 	}
 
-	indexSort.sort();
-	//Check that there actually is a valid surface on which the plants can be placed
-	if (indexSort.size() > 0 && indexSort.front() == mLayerIndex) {
-		Buffer<unsigned char> combinedCoverage(mercatorSegment.getSize(), 1);
-		unsigned char* combinedCoverageData = combinedCoverage.getData();
-		size_t size = combinedCoverage.getSize();
-		//The first layer should be copied just as it is
-		std::list<int>::const_iterator I = indexSort.begin();
-		{
-			Mercator::Surface* surface = mercatorSegment.getSurfaces()[*I];
-			memcpy(combinedCoverageData, surface->getData(), combinedCoverage.getSize());
-		}
-		++I;
-		for (; I != indexSort.end(); ++I) {
-			Mercator::Surface* surface = mercatorSegment.getSurfaces()[*I];
-			unsigned char* surfaceData = surface->getData();
-			for (size_t i = 0; i < size; ++i) {
-				combinedCoverageData[i] -= std::min<unsigned char>(surfaceData[i], combinedCoverageData[i]);
-			}
-		}
+	//Generate outside of the lock; should two threads generate the same clusters at once they will produce identical results.
+	ClusterStore* clusters = new ClusterStore();
+	generateClustersForSegment(segmentData, *clusters);
+	std::shared_ptr<const ClusterStore> clustersPtr(clusters);
 
-		ClusterStore store;
-		getClustersForArea(segmentRef, area, store);
-		populateWithClusters(segmentRef, result, area, store, combinedCoverage);
+	std::unique_lock<std::mutex> l(mSegmentClustersMutex);
+	//Keep the memory use bounded; the clusters are cheap to generate again.
+	if (mSegmentClusters.size() >= 256) {
+		mSegmentClusters.clear();
 	}
+	mSegmentClusters[key] = clustersPtr;
+	return clustersPtr;
 }
 
-void ClusterPopulator::getClustersForArea(const SegmentRefPtr& segmentRef, const WFMath::AxisBox<2>& area, ClusterStore& store)
+void ClusterPopulator::generateClustersForSegment(const SegmentFoliageData& segmentData, ClusterStore& store) const
 {
-	//Generate clusters for the current page and all surrounding pages and check if any of these are contained or intersect our local area
+	//Generate clusters for the current page and all surrounding pages, since clusters close to the edges will extend into our page
 
-	Mercator::Segment& mercatorSegment = segmentRef->getSegment().getMercatorSegment();
-	int res = mercatorSegment.getResolution();
+	int res = segmentData.getResolution();
 	int clustersPerSegment = (res * res) / (mClusterDistance * mClusterDistance);
 	float clusterRadiusRange = mMaxClusterRadius - mMinClusterRadius;
-	float xRef = mercatorSegment.getXRef();
-	float yRef = mercatorSegment.getYRef();
+	float xRef = segmentData.getXRef();
+	float yRef = segmentData.getYRef();
 
 	WFMath::MTRand rng;
 
@@ -112,27 +92,32 @@ void ClusterPopulator::getClustersForArea(const SegmentRefPtr& segmentRef, const
 			WFMath::MTRand::uint32 seed(mPlantIndex + (static_cast<WFMath::MTRand::uint32> (currentSegmentX) << 4) + (static_cast<WFMath::MTRand::uint32> (currentSegmentY) << 8));
 			rng.seed(seed);
 			for (int k = 0; k < clustersPerSegment; ++k) {
-				WFMath::Ball<2> cluster(WFMath::Point<2>(rng.rand(res) + currentSegmentX, rng.rand(res) + currentSegmentY), rng.rand(clusterRadiusRange) + mMinClusterRadius);
-				if (WFMath::Contains(area, cluster.center(), true) || WFMath::Intersect(area, cluster, true)) {
-					store.push_back(cluster);
-				}
+				store.push_back(WFMath::Ball<2>(WFMath::Point<2>(rng.rand(res) + currentSegmentX, rng.rand(res) + currentSegmentY), rng.rand(clusterRadiusRange) + mMinClusterRadius));
 			}
 		}
 	}
 }
 
-void ClusterPopulator::populateWithClusters(const SegmentRefPtr& segmentRef, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const ClusterStore& clusters, const Buffer<unsigned char>& combinedCoverage)
+void ClusterPopulator::clearClusters()
+{
+	std::unique_lock<std::mutex> l(mSegmentClustersMutex);
+	mSegmentClusters.clear();
+}
+
+void ClusterPopulator::populateWithClusters(const SegmentFoliageData& segmentData, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const ClusterStore& clusters, const Buffer<unsigned char>& combinedCoverage)
 {
 	for (ClusterStore::const_iterator I = clusters.begin(); I != clusters.end(); ++I) {
-		populateWithCluster(segmentRef, result, area, *I, combinedCoverage);
+		//Only clusters which are contained or intersect our local area are of interest
+		if (WFMath::Contains(area, I->center(), true) || WFMath::Intersect(area, *I, true)) {
+			populateWithCluster(segmentData, result, area, *I, combinedCoverage);
+		}
 	}
 
 }
 
-void ClusterPopulator::populateWithCluster(const SegmentRefPtr& segmentRef, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const WFMath::Ball<2>& cluster, const Buffer<unsigned char>& combinedCoverage)
+void ClusterPopulator::populateWithCluster(const SegmentFoliageData& segmentData, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const WFMath::Ball<2>& cluster, const Buffer<unsigned char>& combinedCoverage)
 {
 	PlantAreaQueryResult::PlantStore& plants = result.getStore();
-	Mercator::Segment& mercatorSegment = segmentRef->getSegment().getMercatorSegment();
 
 	float volume = (cluster.radius() * cluster.radius()) * WFMath::numeric_constants<WFMath::CoordType>::pi();
 	unsigned int instancesInEachCluster = volume * mDensity;
@@ -141,9 +126,9 @@ void ClusterPopulator::populateWithCluster(const SegmentRefPtr& segmentRef, Plan
 
 	unsigned int res = combinedCoverage.getResolution();
 	const unsigned char* data = combinedCoverage.getData();
+	const int xRef = segmentData.getXRef();
+	const int yRef = segmentData.getYRef();
 
-	float height = 0;
-	WFMath::Vector<3> normal;
 	//place one cluster
 	for (unsigned int j = 0; j < instancesInEachCluster; ++j) {
 		float theta = rng.rand(WFMath::numeric_constants<WFMath::CoordType>::pi() * 2);
@@ -156,9 +141,9 @@ void ClusterPopulator::populateWithCluster(const SegmentRefPtr& segmentRef, Plan
 		mScaler->scale(rng, pos, scale);
 
 		if (WFMath::Contains(area, pos, true)) {
-			WFMath::Point<2> localPos(pos.x() - mercatorSegment.getXRef(), pos.y() - mercatorSegment.getYRef());
+			WFMath::Point<2> localPos(pos.x() - xRef, pos.y() - yRef);
 			if (data[((unsigned int)localPos.y() * res) + ((unsigned int)localPos.x())] >= mThreshold) {
-				mercatorSegment.getHeightAndNormal(localPos.x(), localPos.y(), height, normal);
+				float height = segmentData.getHeight(localPos.x(), localPos.y());
 				plants.push_back(PlantInstance(Ogre::Vector3(pos.x(), height, -pos.y()), rotation, scale));
 			}
 		}
@@ -173,6 +158,7 @@ float ClusterPopulator::getMinClusterRadius() const
 void ClusterPopulator::setMinClusterRadius(float theValue)
 {
 	mMinClusterRadius = theValue;
+	clearClusters();
 }
 
 float ClusterPopulator::getMaxClusterRadius() const
@@ -183,6 +169,7 @@ float ClusterPopulator::getMaxClusterRadius() const
 void ClusterPopulator::setMaxClusterRadius(float theValue)
 {
 	mMaxClusterRadius = theValue;
+	clearClusters();
 }
 
 float ClusterPopulator::getDensity() const
@@ -213,6 +200,7 @@ float ClusterPopulator::getClusterDistance() const
 void ClusterPopulator::setClusterDistance(float theValue)
 {
 	mClusterDistance = theValue;
+	clearClusters();
 }
 
 void ClusterPopulator::setThreshold(unsigned char theValue)
@@ -10,6 +10,10 @@
 
 #include "PlantPopulator.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
+
 namespace WFMath
 {
 	template<int> class Ball;
@@ -30,13 +34,19 @@ namespace Foliage
 
 typedef std::vector<WFMath::Ball<2>> ClusterStore;
 
+/**
+ * @brief Places plants in randomly placed clusters.
+ *
+ * The clusters only depend on the position of the segment and the settings, so the clusters for each segment are generated once and kept, to be shared by all queries in the segment.
+ * Populating is thread safe, so different queries can be populated at the same time.
+ */
 class ClusterPopulator : public PlantPopulator
 {
 public:
 	ClusterPopulator(unsigned int layerIndex, IScaler* scaler, unsigned int plantIndex);
 	virtual ~ClusterPopulator();
 
-	virtual void populate(PlantAreaQueryResult& result, SegmentRefPtr segmentRef);
+	virtual void populate(PlantAreaQueryResult& result, const SegmentFoliageData& segmentData);
 
 	void setMinClusterRadius(float theValue);
 	float getMinClusterRadius() const;
@@ -57,16 +67,38 @@ public:
 	float getTreshold() const;
 protected:
 
-	void getClustersForArea(const SegmentRefPtr& segmentRef, const WFMath::AxisBox<2>& area, ClusterStore& clusters);
+	typedef std::map<std::pair<int, int>, std::shared_ptr<const ClusterStore>> SegmentClusterStore;
+
+	/**
+	 * @brief Gets all clusters for the segment and its eight neighbours, generating them if needed.
+	 */
+	std::shared_ptr<const ClusterStore> getClustersForSegment(const SegmentFoliageData& segmentData);
 
-	void populateWithClusters(const SegmentRefPtr& segmentRef, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const ClusterStore& clusters, const Buffer<unsigned char>& combinedCoverage);
-	void populateWithCluster(const SegmentRefPtr& segmentRef, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const WFMath::Ball<2>& cluster, const Buffer<unsigned char>& combinedCoverage);
+	void generateClustersForSegment(const SegmentFoliageData& segmentData, ClusterStore& clusters) const;
+
+	/**
+	 * @brief Clears the generated clusters; this must be called whenever a setting which affects the clusters is changed.
+	 */
+	void clearClusters();
+
+	void populateWithClusters(const SegmentFoliageData& segmentData, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const ClusterStore& clusters, const Buffer<unsigned char>& combinedCoverage);
+	void populateWithCluster(const SegmentFoliageData& segmentData, PlantAreaQueryResult& result, const WFMath::AxisBox<2>& area, const WFMath::Ball<2>& cluster, const Buffer<unsigned char>& combinedCoverage);
 	float mMinClusterRadius;
 	float mMaxClusterRadius;
 	float mClusterDistance;
 	float mDensity;
 	float mFalloff;
 	unsigned char mThreshold;
+
+	/**
+	 * @brief The clusters generated for each segment, keyed by the world position of the segment.
+	 */
+	SegmentClusterStore mSegmentClusters;
+
+	/**
+	 * @brief Guards mSegmentClusters, since populating happens in multiple threads.
+	 */
+	std::mutex mSegmentClustersMutex;
 };
 
 }
@@ -30,6 +30,11 @@ PlantPopulator::~PlantPopulator()
 	delete mScaler;
 }
 
+int PlantPopulator::getLayerIndex() const
+{
+	return mLayerIndex;
+}
+
 UniformScaler::UniformScaler(float min, float max) :
 	mMin(min), mRange(max - min)
 {
@@ -31,6 +31,7 @@ namespace Ember
 
       namespace Foliage
       {
+        class SegmentFoliageData;
 
         class IScaler
         {
@@ -75,8 +76,21 @@ namespace Ember
           virtual
           ~PlantPopulator();
 
+          /**
+           * @brief Places plants in the area of the query.
+           * This is called from background threads, possibly for different queries at the same time, and so must not alter any state shared with other calls.
+           * @param result The result, containing the query.
+           * @param segmentData A snapshot of the segment in which the query area is located.
+           */
           virtual void
-          populate(PlantAreaQueryResult& result, SegmentRefPtr segmentRef) = 0;
+          populate(PlantAreaQueryResult& result,
+              const SegmentFoliageData& segmentData) = 0;
+
+          /**
+           * @brief Gets the index of the terrain layer on which the plants are placed.
+           */
+          int
+          getLayerIndex() const;
 
         protected:
 
@@ -0,0 +1,173 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SegmentFoliageData.h"
+#include "components/ogre/terrain/Buffer.h"
+
+#include <Mercator/Segment.h>
+#include <Mercator/Surface.h>
+#include <Mercator/Shader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace Foliage
+{
+
+SegmentFoliageData::SegmentFoliageData(Mercator::Segment& segment, const std::set<int>& layerIndices) :
+		mResolution(segment.getResolution()), mXRef(segment.getXRef()), mYRef(segment.getYRef()), mLayerIndices(layerIndices)
+{
+	if (!segment.isValid()) {
+		segment.populate();
+	}
+	const float* points = segment.getPoints();
+	mHeights.assign(points, points + (segment.getSize() * segment.getSize()));
+
+	for (std::set<int>::const_iterator I = layerIndices.begin(); I != layerIndices.end(); ++I) {
+		Buffer<unsigned char>* coverage = createCombinedCoverage(segment, *I);
+		if (coverage) {
+			mCoverage[*I] = std::shared_ptr<Buffer<unsigned char>>(coverage);
+		}
+	}
+}
+
+SegmentFoliageData::~SegmentFoliageData()
+{
+}
+
+Buffer<unsigned char>* SegmentFoliageData::createCombinedCoverage(Mercator::Segment& segment, int layerIndex)
+{
+	//Make a small list of surfaces in order
+	std::list<int> indexSort;
+	for (Mercator::Segment::Surfacestore::const_iterator I = segment.getSurfaces().begin(); I != segment.getSurfaces().end(); ++I) {
+		if (I->first >= layerIndex) {
+			if (I->second->m_shader.checkIntersect(segment)) {
+				if (!I->second->isValid()) {
+					I->second->populate();
+				}
+				indexSort.push_back(I->first);
+			}
+		}
+	}
+
+	indexSort.sort();
+	//Check that there actually is a valid surface on which the plants can be placed
+	if (indexSort.empty() || indexSort.front() != layerIndex) {
+		return 0;
+	}
+
+	Buffer<unsigned char>* combinedCoverage = new Buffer<unsigned char>(segment.getSize(), 1);
+	unsigned char* combinedCoverageData = combinedCoverage->getData();
+	size_t size = combinedCoverage->getSize();
+	//The first layer should be copied just as it is
+	std::list<int>::const_iterator I = indexSort.begin();
+	{
+		Mercator::Surface* surface = segment.getSurfaces()[*I];
+		memcpy(combinedCoverageData, surface->getData(), size);
+	}
+	++I;
+	for (; I != indexSort.end(); ++I) {
+		Mercator::Surface* surface = segment.getSurfaces()[*I];
+		unsigned char* surfaceData = surface->getData();
+		for (size_t i = 0; i < size; ++i) {
+			combinedCoverageData[i] -= std::min<unsigned char>(surfaceData[i], combinedCoverageData[i]);
+		}
+	}
+	return combinedCoverage;
+}
+
+int SegmentFoliageData::getResolution() const
+{
+	return mResolution;
+}
+
+int SegmentFoliageData::getXRef() const
+{
+	return mXRef;
+}
+
+int SegmentFoliageData::getYRef() const
+{
+	return mYRef;
+}
+
+WFMath::AxisBox<2> SegmentFoliageData::getArea() const
+{
+	return WFMath::AxisBox<2>(WFMath::Point<2>(mXRef, mYRef), WFMath::Point<2>(mXRef + mResolution, mYRef + mResolution));
+}
+
+const std::set<int>& SegmentFoliageData::getLayerIndices() const
+{
+	return mLayerIndices;
+}
+
+const Buffer<unsigned char>* SegmentFoliageData::getCombinedCoverage(int layerIndex) const
+{
+	CoverageStore::const_iterator I = mCoverage.find(layerIndex);
+	if (I != mCoverage.end()) {
+		return I->second.get();
+	}
+	return 0;
+}
+
+float SegmentFoliageData::getPoint(int x, int y) const
+{
+	return mHeights[(y * (mResolution + 1)) + x];
+}
+
+float SegmentFoliageData::getHeight(float x, float y) const
+{
+	//Clamp to the last tile, so that positions on the far edges can be looked up.
+	const int tileX = std::min(static_cast<int>(std::floor(x)), mResolution - 1);
+	const int tileY = std::min(static_cast<int>(std::floor(y)), mResolution - 1);
+	const float offsetX = x - tileX;
+	const float offsetY = y - tileY;
+
+	const float h1 = getPoint(tileX, tileY);
+	const float h2 = getPoint(tileX, tileY + 1);
+	const float h3 = getPoint(tileX + 1, tileY + 1);
+	const float h4 = getPoint(tileX + 1, tileY);
+
+	//The tile is split into two triangles
+	if ((offsetX - offsetY) <= 0.f) {
+		return h1 + (h3 - h2) * offsetX + (h2 - h1) * offsetY;
+	} else {
+		return h1 + (h4 - h1) * offsetX + (h3 - h4) * offsetY;
+	}
+}
+
+}
+
+}
+
+}
+}
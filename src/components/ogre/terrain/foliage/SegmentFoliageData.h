@@ -0,0 +1,142 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBER_OGREVIEW_TERRAIN_FOLIAGE_SEGMENTFOLIAGEDATA_H_
+#define EMBER_OGREVIEW_TERRAIN_FOLIAGE_SEGMENTFOLIAGEDATA_H_
+
+#include <wfmath/axisbox.h>
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace Mercator
+{
+class Segment;
+}
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+template<typename > class Buffer;
+
+namespace Foliage
+{
+
+/**
+ * @brief A snapshot of the data in a segment needed for placing plants.
+ *
+ * Placing plants needs the heights of the segment, and for each foliage layer the coverage of the layer minus the coverage of all layers above it.
+ * These are copied from the segment when the instance is created, so that plants then can be placed in any thread without touching the segment, which might be altered by terrain updates at the same time.
+ * An instance is never changed once created; when the segment changes a new one should be created instead.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class SegmentFoliageData
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * This accesses the segment, and so should only be called in a thread where the segment won't be altered at the same time.
+	 * @param segment The segment. It will be populated if needed, along with the surfaces of the layers.
+	 * @param layerIndices The indices of the layers to create combined coverage for.
+	 */
+	SegmentFoliageData(Mercator::Segment& segment, const std::set<int>& layerIndices);
+
+	~SegmentFoliageData();
+
+	/**
+	 * @brief Gets the resolution of the segment.
+	 */
+	int getResolution() const;
+
+	/**
+	 * @brief Gets the world x position of the segment.
+	 */
+	int getXRef() const;
+
+	/**
+	 * @brief Gets the world y position of the segment.
+	 */
+	int getYRef() const;
+
+	/**
+	 * @brief Gets the area covered by the segment, in world coords.
+	 */
+	WFMath::AxisBox<2> getArea() const;
+
+	/**
+	 * @brief Gets the indices of the layers for which combined coverage has been created.
+	 */
+	const std::set<int>& getLayerIndices() const;
+
+	/**
+	 * @brief Gets the combined coverage for a layer, i.e. the coverage of the layer minus the coverage of all layers above it.
+	 * @param layerIndex The index of the layer.
+	 * @return The combined coverage, or null if the layer doesn't cover the segment, or if no coverage was created for the layer.
+	 */
+	const Buffer<unsigned char>* getCombinedCoverage(int layerIndex) const;
+
+	/**
+	 * @brief Gets the height at a position in the segment, interpolated in the same way as Mercator::Segment::getHeightAndNormal().
+	 * @param x The x position, local to the segment.
+	 * @param y The y position, local to the segment.
+	 * @return The height.
+	 */
+	float getHeight(float x, float y) const;
+
+private:
+
+	typedef std::map<int, std::shared_ptr<Buffer<unsigned char>>> CoverageStore;
+
+	int mResolution;
+	int mXRef;
+	int mYRef;
+
+	/**
+	 * @brief The heights of the segment, (resolution + 1) ^ 2 values.
+	 */
+	std::vector<float> mHeights;
+
+	std::set<int> mLayerIndices;
+
+	/**
+	 * @brief The combined coverage of each layer which covers the segment.
+	 */
+	CoverageStore mCoverage;
+
+	float getPoint(int x, int y) const;
+
+	static Buffer<unsigned char>* createCombinedCoverage(Mercator::Segment& segment, int layerIndex);
+};
+
+}
+
+}
+
+}
+}
+
+#endif /* EMBER_OGREVIEW_TERRAIN_FOLIAGE_SEGMENTFOLIAGEDATA_H_ */
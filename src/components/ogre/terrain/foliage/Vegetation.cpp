@@ -58,11 +58,11 @@ void Vegetation::createPopulator(const TerrainFoliageDefinition& foliageDef, uns
 	}
 }
 
-void Vegetation::populate(const std::string& plantType, PlantAreaQueryResult& result, SegmentRefPtr segmentRef, const WFMath::AxisBox<2>& area)
+void Vegetation::populate(const std::string& plantType, PlantAreaQueryResult& result, const SegmentFoliageData& segmentData)
 {
 	PopulatorStore::const_iterator I = mPopulators.find(plantType);
 	if (I != mPopulators.end()) {
-		I->second->populate(result, segmentRef);
+		I->second->populate(result, segmentData);
 	}
 }
 
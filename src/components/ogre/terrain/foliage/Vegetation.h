@@ -26,6 +26,7 @@ namespace Foliage
 {
 
 class PlantPopulator;
+class SegmentFoliageData;
 
 class Vegetation
 {
@@ -35,7 +36,7 @@ public:
 
 	void createPopulator(const TerrainFoliageDefinition& foliageDef, unsigned int surfaceLayerIndex);
 
-	void populate(const std::string& plantType, PlantAreaQueryResult& result, SegmentRefPtr segmentRef, const WFMath::AxisBox<2>& area);
+	void populate(const std::string& plantType, PlantAreaQueryResult& result, const SegmentFoliageData& segmentData);
 
 	PlantPopulator* getPopulator(const std::string& plantType);
 
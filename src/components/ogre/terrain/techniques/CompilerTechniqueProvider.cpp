@@ -24,6 +24,7 @@
 #include "Shader.h"
 #include "ShaderNormalMapped.h"
 #include "Simple.h"
+#include "MaterialTemplateCache.h"
 
 #include "components/ogre/ShaderManager.h"
 
@@ -46,11 +47,16 @@ namespace Terrain
 namespace Techniques
 {
 CompilerTechniqueProvider::CompilerTechniqueProvider(ShaderManager& shaderManager, Ogre::SceneManager& sceneManager)
-: mShaderManager(shaderManager), mSceneManager(sceneManager)
+: mShaderManager(shaderManager), mSceneManager(sceneManager), mMaterialTemplateCache(new MaterialTemplateCache())
 {
 
 }
 
+CompilerTechniqueProvider::~CompilerTechniqueProvider()
+{
+	delete mMaterialTemplateCache;
+}
+
 TerrainPageSurfaceCompilerTechnique* CompilerTechniqueProvider::createTechnique(const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow) const
 {
 	std::string preferredTech("");
@@ -70,16 +76,16 @@ TerrainPageSurfaceCompilerTechnique* CompilerTechniqueProvider::createTechnique(
 
 	if (preferredTech == "ShaderNormalMapped" && shaderSupport && graphicsLevel >= ShaderManager::LEVEL_HIGH) {
 		//Use normal mapped shader tech with shadows
-		return new Techniques::ShaderNormalMapped(true, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager);
+		return new Techniques::ShaderNormalMapped(true, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager, mMaterialTemplateCache);
 	} else if (preferredTech == "ShaderNormalMapped" && shaderSupport && graphicsLevel >= ShaderManager::LEVEL_MEDIUM) {
 		//Use normal mapped shader tech without shadows
-		return new Techniques::ShaderNormalMapped(false, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager);
+		return new Techniques::ShaderNormalMapped(false, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager, mMaterialTemplateCache);
 	} else if (preferredTech == "Shader" && shaderSupport && graphicsLevel >= ShaderManager::LEVEL_HIGH) {
 		//Use shader tech with shadows
-		return new Techniques::Shader(true, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager);
+		return new Techniques::Shader(true, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager, mMaterialTemplateCache);
 	} else if (preferredTech == "Shader" && shaderSupport && graphicsLevel >= ShaderManager::LEVEL_MEDIUM) {
 		//Use shader tech without shadows
-		return new Techniques::Shader(false, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager);
+		return new Techniques::Shader(false, geometry, terrainPageSurfaces, terrainPageShadow, mSceneManager, mMaterialTemplateCache);
 	} else {
 		return new Techniques::Simple(geometry, terrainPageSurfaces, terrainPageShadow);
 	}
@@ -36,6 +36,8 @@ namespace Terrain
 namespace Techniques
 {
 
+class MaterialTemplateCache;
+
 /**
  * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
  * @brief A compiler technique provider which uses the base techniques found in the OgreView::Terrain::Techniques namespace.
@@ -50,6 +52,8 @@ public:
 	 */
 	CompilerTechniqueProvider(ShaderManager& shaderManager, Ogre::SceneManager& sceneManager);
 
+	virtual ~CompilerTechniqueProvider();
+
 	virtual TerrainPageSurfaceCompilerTechnique* createTechnique(const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow) const;
 
 protected:
@@ -64,6 +68,11 @@ protected:
 	 * @brief The scene manager which handles the terrain.
 	 */
 	Ogre::SceneManager& mSceneManager;
+
+	/**
+	 * @brief Keeps compiled materials, so that they can be reused for pages with the same layers.
+	 */
+	MaterialTemplateCache* mMaterialTemplateCache;
 };
 
 }
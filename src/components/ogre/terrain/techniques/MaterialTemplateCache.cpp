@@ -0,0 +1,108 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "MaterialTemplateCache.h"
+
+#include <OgreMaterialManager.h>
+
+#include <sstream>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace Techniques
+{
+
+namespace
+{
+/**
+ * @brief The maximum number of templates kept.
+ * There's usually only a handful of different layer combinations in view at once.
+ */
+const size_t MAX_TEMPLATES = 32;
+}
+
+MaterialTemplateCache::MaterialTemplateCache() :
+		mTemplateCounter(0)
+{
+}
+
+MaterialTemplateCache::~MaterialTemplateCache()
+{
+	clear();
+}
+
+Ogre::MaterialPtr MaterialTemplateCache::find(const std::string& key) const
+{
+	TemplateStore::const_iterator I = mTemplates.find(key);
+	if (I != mTemplates.end()) {
+		return I->second;
+	}
+	return Ogre::MaterialPtr();
+}
+
+void MaterialTemplateCache::add(const std::string& key, const Ogre::MaterialPtr& material)
+{
+	TemplateStore::iterator I = mTemplates.find(key);
+	if (I != mTemplates.end()) {
+		removeTemplate(I->second);
+		mTemplates.erase(I);
+		mKeys.remove(key);
+	}
+	while (mTemplates.size() >= MAX_TEMPLATES && !mKeys.empty()) {
+		TemplateStore::iterator J = mTemplates.find(mKeys.front());
+		if (J != mTemplates.end()) {
+			removeTemplate(J->second);
+			mTemplates.erase(J);
+		}
+		mKeys.pop_front();
+	}
+
+	std::stringstream ss;
+	ss << "EmberTerrain_Template_" << mTemplateCounter++;
+	mTemplates.insert(TemplateStore::value_type(key, material->clone(ss.str())));
+	mKeys.push_back(key);
+}
+
+void MaterialTemplateCache::clear()
+{
+	for (TemplateStore::const_iterator I = mTemplates.begin(); I != mTemplates.end(); ++I) {
+		removeTemplate(I->second);
+	}
+	mTemplates.clear();
+	mKeys.clear();
+}
+
+void MaterialTemplateCache::removeTemplate(const Ogre::MaterialPtr& material)
+{
+	Ogre::MaterialManager::getSingleton().remove(material->getHandle());
+}
+
+}
+}
+}
+}
@@ -0,0 +1,105 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_TERRAIN_TECHNIQUES_MATERIALTEMPLATECACHE_H_
+#define EMBEROGRE_TERRAIN_TECHNIQUES_MATERIALTEMPLATECACHE_H_
+
+#include <OgreMaterial.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Terrain
+{
+
+namespace Techniques
+{
+
+/**
+ * @brief Keeps copies of compiled terrain materials, so that they can be reused for pages with the same set of layers.
+ *
+ * Each entry is keyed by a description of the layers, textures and settings used by the material. Pages with the same key get the same techniques and passes, and only differ in their coverage textures.
+ * Instead of building the material anew, a technique can then copy the template and point it to the coverage textures of its own page.
+ *
+ * This must only be used from the main thread.
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class MaterialTemplateCache
+{
+public:
+
+	MaterialTemplateCache();
+
+	/**
+	 * @brief Dtor.
+	 * All template materials are removed.
+	 */
+	~MaterialTemplateCache();
+
+	/**
+	 * @brief Finds the template for a key.
+	 * @param key The key.
+	 * @return The template material, or a null pointer if there's none.
+	 */
+	Ogre::MaterialPtr find(const std::string& key) const;
+
+	/**
+	 * @brief Adds a template, made as a copy of a compiled material.
+	 *
+	 * If there are too many templates, the oldest one is removed.
+	 * @param key The key.
+	 * @param material The compiled material.
+	 */
+	void add(const std::string& key, const Ogre::MaterialPtr& material);
+
+	/**
+	 * @brief Removes all templates.
+	 */
+	void clear();
+
+private:
+
+	typedef std::map<std::string, Ogre::MaterialPtr> TemplateStore;
+
+	TemplateStore mTemplates;
+
+	/**
+	 * @brief The keys of the templates, oldest first.
+	 */
+	std::list<std::string> mKeys;
+
+	/**
+	 * @brief Used for giving the template materials unique names.
+	 */
+	unsigned int mTemplateCounter;
+
+	void removeTemplate(const Ogre::MaterialPtr& material);
+};
+
+}
+}
+}
+}
+
+#endif /* EMBEROGRE_TERRAIN_TECHNIQUES_MATERIALTEMPLATECACHE_H_ */
@@ -18,11 +18,15 @@
 
 #include "Shader.h"
 #include "ShaderPass.h"
+#include "MaterialTemplateCache.h"
 #include "components/ogre/terrain/TerrainPageSurfaceLayer.h"
 #include "components/ogre/terrain/TerrainPage.h"
 #include <OgrePass.h>
 #include <OgreTechnique.h>
 
+#include <sstream>
+#include <typeinfo>
+
 namespace Ember
 {
   namespace OgreView
@@ -38,9 +42,11 @@ namespace Ember
             const TerrainPageGeometryPtr& mGeometry,
             const SurfaceLayerStore& mTerrainPageSurfaces,
             const TerrainPageShadow* terrainPageShadow,
-            Ogre::SceneManager& sceneManager) :
+            Ogre::SceneManager& sceneManager,
+            MaterialTemplateCache* materialTemplateCache) :
             Base(mGeometry, mTerrainPageSurfaces, terrainPageShadow), mIncludeShadows(
-                includeShadows), mSceneManager(sceneManager)
+                includeShadows), mSceneManager(sceneManager), mMaterialTemplateCache(
+                materialTemplateCache)
         {
         }
 
@@ -109,6 +115,85 @@ namespace Ember
 
         bool
         Shader::compileMaterial(Ogre::MaterialPtr material)
+        {
+          if (!mMaterialTemplateCache)
+            {
+              return buildMaterial(material);
+            }
+
+          //Pages with the same layers get the same material, apart from the coverage textures, so we can copy a material compiled earlier.
+          const std::string templateKey = getTemplateKey();
+          Ogre::MaterialPtr templateMaterial = mMaterialTemplateCache->find(
+              templateKey);
+          if (!templateMaterial.isNull())
+            {
+              if (compileFromTemplate(templateMaterial, material))
+                {
+                  return true;
+                }
+              S_LOG_WARNING(
+                  "Could not use the template material for terrain material '" << material->getName() << "'; it will be built anew.");
+            }
+          if (buildMaterial(material))
+            {
+              mMaterialTemplateCache->add(templateKey, material);
+              return true;
+            }
+          return false;
+        }
+
+        bool
+        Shader::compileFromTemplate(Ogre::MaterialPtr templateMaterial,
+            Ogre::MaterialPtr material)
+        {
+          templateMaterial->copyDetailsTo(material);
+          for (unsigned short i = 0; i < material->getNumTechniques(); ++i)
+            {
+              Ogre::Technique* technique = material->getTechnique(i);
+              for (unsigned short j = 0; j < technique->getNumPasses(); ++j)
+                {
+                  if (j >= mPasses.size()
+                      || !mPasses[j]->adoptCoverageTextures(
+                          *technique->getPass(j)))
+                    {
+                      return false;
+                    }
+                  //The shadow split points might have changed since the template was compiled. Only the first technique uses shadows, see buildMaterial().
+                  if (i == 0 && mIncludeShadows)
+                    {
+                      try
+                        {
+                          mPasses[j]->applyShadowParameters(
+                              *technique->getPass(j));
+                        }
+                      catch (const std::exception& ex)
+                        {
+                          S_LOG_WARNING(
+                              "Error when setting fragment program parameters." << ex);
+                          return false;
+                        }
+                    }
+                }
+            }
+          material->load();
+          return material->getNumSupportedTechniques() != 0;
+        }
+
+        std::string
+        Shader::getTemplateKey() const
+        {
+          std::stringstream ss;
+          //The subclasses use different passes, so the type must be part of the key.
+          ss << typeid(*this).name() << ":" << mIncludeShadows;
+          for (PassStore::const_iterator I = mPasses.begin(); I != mPasses.end(); ++I)
+            {
+              ss << "|" << (*I)->getSignature();
+            }
+          return ss.str();
+        }
+
+        bool
+        Shader::buildMaterial(Ogre::MaterialPtr material)
         {
           material->removeAllTechniques();
           Ogre::Technique* technique = material->createTechnique();
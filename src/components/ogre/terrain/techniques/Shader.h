@@ -35,6 +35,7 @@ namespace Techniques
 {
 
 class ShaderPass;
+class MaterialTemplateCache;
 
 /**
  * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
@@ -55,8 +56,9 @@ public:
      * @param terrainPageSurfaces The surfaces to generate a rendering technique for.
      * @param terrainPageShadow An optional shadow.
      * @param sceneManager The scene manager which will hold the terrain.
+     * @param materialTemplateCache An optional cache of compiled materials, which will be used for pages with the same layers.
      */
-	Shader(bool includeShadows, const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow, Ogre::SceneManager& sceneManager);
+	Shader(bool includeShadows, const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow, Ogre::SceneManager& sceneManager, MaterialTemplateCache* materialTemplateCache = 0);
 
 	/**
 	 * @brief Dtor.
@@ -84,6 +86,32 @@ protected:
 	 */
 	PassStore mPasses;
 
+	/**
+	 * @brief An optional cache of compiled materials.
+	 */
+	MaterialTemplateCache* mMaterialTemplateCache;
+
+	/**
+	 * @brief Builds the material from the prepared passes.
+	 * @param material The material which will be used for the terrain geometry.
+	 * @return False if something went wrong.
+	 */
+	bool buildMaterial(Ogre::MaterialPtr material);
+
+	/**
+	 * @brief Copies a template material, and points it to the coverage textures of this page.
+	 * @param templateMaterial A material previously compiled for another page with the same layers.
+	 * @param material The material which will be used for the terrain geometry.
+	 * @return False if the template couldn't be used.
+	 */
+	bool compileFromTemplate(Ogre::MaterialPtr templateMaterial, Ogre::MaterialPtr material);
+
+	/**
+	 * @brief Gets a key describing the layers, textures and settings of the material, which is the same for all pages for which the same material can be used.
+	 * @return The key.
+	 */
+	std::string getTemplateKey() const;
+
 	virtual ShaderPass* addPass();
 
 	/**
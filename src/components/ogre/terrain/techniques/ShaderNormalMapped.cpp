@@ -35,8 +35,8 @@ namespace Terrain
 namespace Techniques
 {
 
-ShaderNormalMapped::ShaderNormalMapped(bool includeShadows, const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow, Ogre::SceneManager& sceneManager) :
-	Shader(includeShadows, geometry, terrainPageSurfaces, terrainPageShadow, sceneManager)
+ShaderNormalMapped::ShaderNormalMapped(bool includeShadows, const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow, Ogre::SceneManager& sceneManager, MaterialTemplateCache* materialTemplateCache) :
+	Shader(includeShadows, geometry, terrainPageSurfaces, terrainPageShadow, sceneManager, materialTemplateCache)
 {
 }
 
@@ -38,12 +38,14 @@ namespace Ember
           /**
            * @brief Ctor.
            * @param includeShadows If true, shadows will be used.
+           * @param materialTemplateCache An optional cache of compiled materials, which will be used for pages with the same layers.
            */
           ShaderNormalMapped(bool includeShadows,
               const TerrainPageGeometryPtr& geometry,
               const SurfaceLayerStore& terrainPageSurfaces,
               const TerrainPageShadow* terrainPageShadow,
-              Ogre::SceneManager& sceneManager);
+              Ogre::SceneManager& sceneManager,
+              MaterialTemplateCache* materialTemplateCache = 0);
         protected:
           virtual ShaderPass*
           addPass();
@@ -41,11 +41,19 @@ namespace Terrain
 namespace Techniques
 {
 
+namespace
+{
+/**
+ * @brief Part of the name of all coverage textures, used to tell them apart from the layer textures.
+ */
+const std::string COVERAGE_TEXTURE_MARKER("_combinedCoverage_");
+}
+
 Ogre::TexturePtr ShaderPass::getCombinedCoverageTexture(size_t passIndex, size_t batchIndex) const
 {
 	//we need an unique name for our alpha texture
 	std::stringstream combinedCoverageTextureNameSS;
-	combinedCoverageTextureNameSS << "terrain_" << mPosition.x() << "_" << mPosition.y() << "_combinedCoverage_" << passIndex << "_" << batchIndex;
+	combinedCoverageTextureNameSS << "terrain_" << mPosition.x() << "_" << mPosition.y() << COVERAGE_TEXTURE_MARKER << passIndex << "_" << batchIndex;
 	const Ogre::String combinedCoverageName(combinedCoverageTextureNameSS.str());
 	Ogre::TexturePtr combinedCoverageTexture;
 	Ogre::TextureManager* textureMgr = Ogre::Root::getSingletonPtr()->getTextureManager();
@@ -130,6 +138,58 @@ LayerStore& ShaderPass::getLayers()
 	return mLayers;
 }
 
+std::string ShaderPass::getSignature() const
+{
+	std::stringstream ss;
+	ss << mShadowLayers;
+	if (mBaseLayer) {
+		ss << ":" << mBaseLayer->getDiffuseTextureName() << "," << mBaseLayer->getNormalTextureName() << "," << mBaseLayer->getScale();
+	}
+	for (CoverageBatchStore::const_iterator I = mCoverageBatches.begin(); I != mCoverageBatches.end(); ++I) {
+		ss << "[";
+		const LayerStore& layers = (*I)->getLayers();
+		for (LayerStore::const_iterator J = layers.begin(); J != layers.end(); ++J) {
+			ss << (*J)->getDiffuseTextureName() << "," << (*J)->getNormalTextureName() << "," << (*J)->getScale() << ";";
+		}
+		ss << "]";
+	}
+	return ss.str();
+}
+
+bool ShaderPass::adoptCoverageTextures(Ogre::Pass& pass) const
+{
+	//The coverage texture units appear in the same order as the batches.
+	size_t batchIndex = 0;
+	Ogre::Pass::TextureUnitStateIterator I = pass.getTextureUnitStateIterator();
+	while (I.hasMoreElements()) {
+		Ogre::TextureUnitState* textureUnitState = I.getNext();
+		if (textureUnitState->getTextureName().find(COVERAGE_TEXTURE_MARKER) != std::string::npos) {
+			if (batchIndex >= mCoverageBatches.size()) {
+				return false;
+			}
+			Ogre::TexturePtr texture = getCombinedCoverageTexture(pass.getIndex(), batchIndex);
+			mCoverageBatches[batchIndex]->assignCombinedCoverageTexture(texture);
+			textureUnitState->setTextureName(texture->getName());
+			batchIndex++;
+		}
+	}
+	return batchIndex == mCoverageBatches.size();
+}
+
+void ShaderPass::applyShadowParameters(Ogre::Pass& pass) const
+{
+	Ogre::PSSMShadowCameraSetup* pssmSetup = static_cast<Ogre::PSSMShadowCameraSetup*>(mSceneManager.getShadowCameraSetup().get());
+	if (pssmSetup) {
+		Ogre::Vector4 splitPoints;
+		Ogre::PSSMShadowCameraSetup::SplitPointList splitPointList = pssmSetup->getSplitPoints();
+		for (int i = 0; i < 3; i++) {
+			splitPoints[i] = splitPointList[i];
+		}
+
+		pass.getFragmentProgramParameters()->setNamedConstant("pssmSplitPoints", splitPoints);
+	}
+}
+
 bool ShaderPass::finalize(Ogre::Pass& pass, bool useShadows, const std::string shaderSuffix) const
 {
 	if (useShadows) {
@@ -198,16 +258,7 @@ bool ShaderPass::finalize(Ogre::Pass& pass, bool useShadows, const std::string s
 		fpParams->setNamedConstant("scales", mScales, (mLayers.size() - 1) / 4 + 1);
 
 		if (useShadows) {
-			Ogre::PSSMShadowCameraSetup* pssmSetup = static_cast<Ogre::PSSMShadowCameraSetup*>(mSceneManager.getShadowCameraSetup().get());
-			if (pssmSetup) {
-				Ogre::Vector4 splitPoints;
-				Ogre::PSSMShadowCameraSetup::SplitPointList splitPointList = pssmSetup->getSplitPoints();
-				for (int i = 0; i < 3; i++) {
-					splitPoints[i] = splitPointList[i];
-				}
-
-				fpParams->setNamedConstant("pssmSplitPoints", splitPoints);
-			}
+			applyShadowParameters(pass);
 
 			//		fpParams->setNamedConstant("shadowMap0", 0);
 			//		fpParams->setNamedConstant("shadowMap1", 1);
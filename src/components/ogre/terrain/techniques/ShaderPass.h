@@ -76,6 +76,31 @@ namespace Ember
           LayerStore&
           getLayers();
 
+          /**
+           * @brief Gets a description of the layers, textures and settings used by the pass.
+           * Two passes with the same signature will produce the same Ogre pass, apart from the coverage textures.
+           * @return The signature.
+           */
+          std::string
+          getSignature() const;
+
+          /**
+           * @brief Makes a pass which has been copied from another page with the same signature use the coverage textures of this pass.
+           * The coverage textures will be created and filled if needed.
+           * @param pass The copied pass.
+           * @return False if the copied pass didn't match this pass.
+           */
+          bool
+          adoptCoverageTextures(Ogre::Pass& pass) const;
+
+          /**
+           * @brief Sets the shadow parameters of the fragment program of the pass to the current shadow settings of the scene.
+           * These change when the shadow camera setup is altered, so a pass copied from a template must be given the current ones.
+           * @param pass The pass, which must have a fragment program.
+           */
+          void
+          applyShadowParameters(Ogre::Pass& pass) const;
+
         protected:
           typedef std::vector<ShaderPassCoverageBatch*> CoverageBatchStore;
 
@@ -61,6 +61,12 @@ public:
 
 	virtual void finalize(Ogre::Pass& pass, Ogre::TexturePtr texture);
 
+	/**
+	 * @brief Fills the texture with the combined coverage, unless it already has been.
+	 * @param texture The coverage texture.
+	 */
+	void assignCombinedCoverageTexture(Ogre::TexturePtr texture);
+
 protected:
 
 	ShaderPass& mShaderPass;
@@ -74,7 +80,6 @@ protected:
 	 */
 	std::vector<std::string> mSyncedTextures;
 
-	void assignCombinedCoverageTexture(Ogre::TexturePtr texture);
 	void addCoverage(const TerrainPageGeometry& geometry, const TerrainPageSurfaceLayer* layer, unsigned int channel);
 
 };
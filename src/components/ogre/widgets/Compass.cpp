@@ -32,8 +32,6 @@
 #include "../Avatar.h"
 #include "../OgreInfo.h"
 #include "../terrain/Map.h"
-#include "../terrain/ISceneManagerAdapter.h"
-#include "../terrain/ITerrainObserver.h"
 
 #include "framework/LoggingInstance.h"
 
@@ -83,21 +81,18 @@ void DelayedCompassRenderer::queueRendering()
 	mRenderNextFrame = true;
 }
 
-Compass::Compass(ICompassImpl* compassImpl, Ogre::SceneManager& sceneManager, Terrain::ISceneManagerAdapter& sceneManagerAdapter) :
-		mMap(new Map(sceneManager)), mCompassImpl(compassImpl), mSceneManagerAdapter(sceneManagerAdapter), mTerrainObserver(sceneManagerAdapter.createObserver()), mDelayedRenderer(*this)
+Compass::Compass(ICompassImpl* compassImpl, Terrain::TerrainHandler& terrainHandler) :
+		mMap(new Map(terrainHandler)), mCompassImpl(compassImpl), mDelayedRenderer(*this)
 {
 	mMap->initialize();
 	if (compassImpl) {
 		compassImpl->setCompass(this);
 	}
-	updateTerrainObserver();
-	mMap->getView().EventBoundsChanged.connect(sigc::mem_fun(*this, &Compass::mapView_BoundsChanged));
-	mTerrainObserver->EventAreaShown.connect(sigc::mem_fun(*this, &Compass::terrainObserver_AreaShown));
+	mMap->EventTilesUpdated.connect(sigc::mem_fun(*this, &Compass::map_TilesUpdated));
 }
 
 Compass::~Compass()
 {
-	mSceneManagerAdapter.destroyObserver(mTerrainObserver);
 }
 
 Terrain::Map& Compass::getMap()
@@ -132,7 +127,7 @@ void Compass::refresh()
 	}
 }
 
-void Compass::terrainObserver_AreaShown()
+void Compass::map_TilesUpdated()
 {
 	queueRefresh();
 }
@@ -142,16 +137,6 @@ void Compass::queueRefresh()
 	mDelayedRenderer.queueRendering();
 }
 
-void Compass::mapView_BoundsChanged()
-{
-	updateTerrainObserver();
-}
-
-void Compass::updateTerrainObserver()
-{
-	mTerrainObserver->observeArea(mMap->getView().getFullBounds());
-}
-
 ICompassImpl::ICompassImpl() :
 		mMap(0), mCompass(0)
 {
@@ -41,8 +41,7 @@ namespace Terrain
 {
 class Map;
 class MapView;
-class ISceneManagerAdapter;
-class ITerrainObserver;
+class TerrainHandler;
 }
 
 namespace Gui {
@@ -101,7 +100,12 @@ protected:
 class Compass
 {
 public:
-    Compass(ICompassImpl* compassImpl, Ogre::SceneManager& sceneManager, Terrain::ISceneManagerAdapter& sceneManagerAdapter);
+    /**
+     * @brief Ctor.
+     * @param compassImpl The compass implementation.
+     * @param terrainHandler The terrain handler, from which the map is generated.
+     */
+    Compass(ICompassImpl* compassImpl, Terrain::TerrainHandler& terrainHandler);
 
     virtual ~Compass();
 
@@ -134,33 +138,12 @@ protected:
 	 */
 	ICompassImpl* mCompassImpl;
 
-	/**
-	 * @brief A scene manager adapter, from which we'll obtain a terrain observer.
-	 */
-	Terrain::ISceneManagerAdapter& mSceneManagerAdapter;
-
-	/**
-	 * @brief A terrain observer, which observes when parts of the terrain is shown.
-	 * @see terrainObserver_AreaShown
-	 */
-	Terrain::ITerrainObserver* mTerrainObserver;
-
 	DelayedCompassRenderer mDelayedRenderer;
 
 	/**
-	 * @brief When new parts of the terrain becomes visible, we need to rerender the map.
-	 */
-	void terrainObserver_AreaShown();
-
-	/**
-	 * @brief When the bounds of the map changes, we need to update our terrain observer.
-	 */
-	void mapView_BoundsChanged();
-
-	/**
-	 * @brief Updates the terrain observer with the bounds currently used by the map.
+	 * @brief When tiles within the map have been updated, we need to rerender the map.
 	 */
-	void updateTerrainObserver();
+	void map_TilesUpdated();
 
 };
 
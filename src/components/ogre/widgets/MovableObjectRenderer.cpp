@@ -233,7 +233,8 @@ namespace Ember
         mTexture->getRenderContext()->setActive(mActive && mImage->isVisible());
         if (mActive && mImage->isVisible())
           {
-            updateRender();
+            //the render is batched together with those of all other visible renderers
+            mTexture->getRenderContext()->requestUpdate();
           }
         return true;
       }
@@ -276,7 +277,7 @@ namespace Ember
         if (!mAxesNode)
           {
             mAxesNode =
-                mTexture->getRenderContext()->getSceneManager()->getRootSceneNode()->createChildSceneNode();
+                mTexture->getRenderContext()->getRootNode()->createChildSceneNode();
           }
         if (!mAxisEntity)
           {
@@ -0,0 +1,123 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "IconCache.h"
+#include "IconImageStore.h"
+
+#include "components/ogre/model/ModelDefinition.h"
+#include "framework/LoggingInstance.h"
+#include "framework/osdir.h"
+
+#include <OgreImage.h>
+#include <OgreDataStream.h>
+#include <OgreHardwarePixelBuffer.h>
+#include <OgrePixelFormat.h>
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Gui
+{
+
+namespace Icons
+{
+
+IconCache::IconCache(const std::string& directory, int pixelWidth) :
+		mDirectory(directory), mPixelWidth(pixelWidth)
+{
+	try {
+		oslink::directory osdir(mDirectory);
+		if (!osdir) {
+			oslink::directory::mkdir(mDirectory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for icon cache." << ex);
+	}
+}
+
+std::string IconCache::getPath(const Model::ModelDefinition& definition) const
+{
+	if (definition.getContentHash().empty()) {
+		return "";
+	}
+	std::stringstream ss;
+	ss << mDirectory << definition.getContentHash() << "_" << mPixelWidth << ".png";
+	return ss.str();
+}
+
+bool IconCache::load(const Model::ModelDefinition& definition, IconImageStoreEntry& imageStoreEntry) const
+{
+	const std::string path = getPath(definition);
+	if (path.empty()) {
+		return false;
+	}
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	try {
+		Ogre::DataStreamPtr stream(new Ogre::FileStreamDataStream(path, &file, false));
+		Ogre::Image image;
+		image.load(stream, "png");
+		if (image.getWidth() != static_cast<size_t>(mPixelWidth) || image.getHeight() != static_cast<size_t>(mPixelWidth)) {
+			S_LOG_WARNING("Cached icon " << path << " has the wrong size; it will be rendered again.");
+			return false;
+		}
+		Ogre::PixelBox pixelBox = imageStoreEntry.getImagePixelBox();
+		Ogre::PixelUtil::bulkPixelConversion(image.getPixelBox(), pixelBox);
+		imageStoreEntry.getTexture()->getBuffer()->blitFromMemory(pixelBox, imageStoreEntry.getBox());
+	} catch (const std::exception& ex) {
+		S_LOG_WARNING("Error when loading cached icon " << path << "; it will be rendered again." << ex);
+		return false;
+	}
+	return true;
+}
+
+void IconCache::store(const Model::ModelDefinition& definition, IconImageStoreEntry& imageStoreEntry) const
+{
+	const std::string path = getPath(definition);
+	if (path.empty()) {
+		return;
+	}
+	try {
+		//The entry is a sub volume of the atlas image, so it needs to be copied into a buffer of its own before it can be saved.
+		std::vector<Ogre::uchar> buffer(Ogre::PixelUtil::getMemorySize(mPixelWidth, mPixelWidth, 1, Ogre::PF_A8R8G8B8));
+		Ogre::PixelBox iconBox(mPixelWidth, mPixelWidth, 1, Ogre::PF_A8R8G8B8, &buffer[0]);
+		Ogre::PixelUtil::bulkPixelConversion(imageStoreEntry.getImagePixelBox(), iconBox);
+		Ogre::Image image;
+		image.loadDynamicImage(&buffer[0], mPixelWidth, mPixelWidth, 1, Ogre::PF_A8R8G8B8);
+		image.save(path);
+	} catch (const std::exception& ex) {
+		S_LOG_WARNING("Error when writing icon to cache at " << path << "." << ex);
+	}
+}
+
+}
+}
+}
+}
@@ -0,0 +1,94 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef EMBEROGRE_GUI_ICONS_ICONCACHE_H_
+#define EMBEROGRE_GUI_ICONS_ICONCACHE_H_
+
+#include <string>
+
+namespace Ember
+{
+namespace OgreView
+{
+
+namespace Model
+{
+class ModelDefinition;
+}
+
+namespace Gui
+{
+
+namespace Icons
+{
+
+class IconImageStoreEntry;
+
+/**
+ * @brief Keeps rendered icons on disk, so that they don't need to be rendered again in later sessions.
+ *
+ * Icons are stored as PNG images, keyed by the content hash of the model definition they were rendered from and the size of the icon. Any change to the model definition will thus result in the icon being rendered anew. Note that changes to the meshes or textures used by a model definition aren't detected; clear the cache directory if those have changed.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class IconCache
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param directory The directory where the icons are stored. It will be created if it doesn't exist.
+	 * @param pixelWidth The width and height of the icons, in pixels.
+	 */
+	IconCache(const std::string& directory, int pixelWidth);
+
+	/**
+	 * @brief Loads a cached icon straight into the icon atlas.
+	 * @param definition The model definition the icon was rendered from.
+	 * @param imageStoreEntry The atlas entry to load the icon into.
+	 * @return True if there was a cached icon, and it was loaded.
+	 */
+	bool load(const Model::ModelDefinition& definition, IconImageStoreEntry& imageStoreEntry) const;
+
+	/**
+	 * @brief Writes a rendered icon to the cache.
+	 * @param definition The model definition the icon was rendered from.
+	 * @param imageStoreEntry The atlas entry holding the rendered icon.
+	 */
+	void store(const Model::ModelDefinition& definition, IconImageStoreEntry& imageStoreEntry) const;
+
+private:
+
+	std::string mDirectory;
+
+	int mPixelWidth;
+
+	/**
+	 * @brief Gets the path of the cached icon for a model definition.
+	 * @param definition The model definition.
+	 * @return The path, or an empty string if the definition has no content hash (i.e. wasn't loaded from a file).
+	 */
+	std::string getPath(const Model::ModelDefinition& definition) const;
+};
+
+}
+}
+}
+}
+
+#endif /* EMBEROGRE_GUI_ICONS_ICONCACHE_H_ */
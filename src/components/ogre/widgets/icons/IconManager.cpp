@@ -39,6 +39,7 @@
 #include "components/ogre/mapping/EmberEntityMappingManager.h"
 #include "services/server/ServerService.h"
 #include "services/EmberServices.h"
+#include "services/config/ConfigService.h"
 #include <Eris/Entity.h>
 #include <Eris/TypeInfo.h>
 #include <Eris/Connection.h>
@@ -143,12 +144,13 @@ namespace Ember
         };
 
         IconManager::IconManager() :
-            mIconRenderer("IconManager", 64)
+            mIconCache(EmberServices::getSingleton().getConfigService().getHomeDirectory() + "/iconcache/", 64), mIconRenderer("IconManager", 64)
         {
           //if the direct renderer is activated you must also update IconImageStore so that a RenderTarget texture is used
           // 	mIconRenderer.setWorker(new DirectRendererWorker(mIconRenderer));
 
           mIconRenderer.setWorker(new DelayedIconRendererWorker(mIconRenderer));
+          mIconRenderer.setCache(&mIconCache);
         }
 
         IconManager::~IconManager()
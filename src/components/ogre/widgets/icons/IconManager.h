@@ -25,6 +25,7 @@
 
 #include "IconStore.h"
 #include "IconRenderer.h"
+#include "IconCache.h"
 
 namespace Eris 
 {
@@ -61,6 +62,7 @@ public:
 protected:
 
 	IconStore mIconStore;
+	IconCache mIconCache;
 	IconRenderer mIconRenderer;
 	
 
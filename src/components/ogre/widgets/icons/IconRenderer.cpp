@@ -27,9 +27,11 @@
 #include "IconRenderer.h"
 #include "Icon.h"
 #include "IconImageStore.h"
+#include "IconCache.h"
 
 #include "../../model/Model.h"
 #include "../../model/ModelDefinition.h"
+#include "../../model/ModelDefinitionManager.h"
 #include "../../SimpleRenderContext.h"
 #include <OgreHardwarePixelBuffer.h>
 #include <OgreRenderTexture.h>
@@ -52,15 +54,16 @@ namespace Icons
 {
 
 IconRenderer::IconRenderer(const std::string& prefix, int pixelWidth) :
-	mPixelWidth(pixelWidth), mRenderContext(new SimpleRenderContext(prefix, pixelWidth, pixelWidth)), mWorker(0)
+	mPixelWidth(pixelWidth), mRenderContext(new SimpleRenderContext(prefix, pixelWidth, pixelWidth)), mWorker(0), mCache(0), mMaxRendersPerFrame(2)
 {
-	mRenderContext->getSceneManager()->setAmbientLight(Ogre::ColourValue(0.7, 0.7, 0.7));
+	mRenderContext->setAmbientLight(Ogre::ColourValue(0.7, 0.7, 0.7));
 	mRenderContext->setBackgroundColour(Ogre::ColourValue::ZERO);
-
+	Ogre::Root::getSingleton().addFrameListener(this);
 }
 
 IconRenderer::~IconRenderer()
 {
+	Ogre::Root::getSingleton().removeFrameListener(this);
 	delete mWorker;
 }
 
@@ -69,7 +72,42 @@ void IconRenderer::setWorker(IconRenderWorker* worker)
 	mWorker = worker;
 }
 
+void IconRenderer::setCache(IconCache* cache)
+{
+	mCache = cache;
+}
+
+void IconRenderer::setMaxRendersPerFrame(unsigned int maxRendersPerFrame)
+{
+	mMaxRendersPerFrame = maxRendersPerFrame;
+}
+
 void IconRenderer::render(const std::string& modelName, Icon* icon)
+{
+	if (mCache) {
+		Ogre::ResourcePtr definitionPtr = Model::ModelDefinitionManager::getSingleton().getByName(modelName);
+		if (!definitionPtr.isNull() && mCache->load(*static_cast<Model::ModelDefinition*>(definitionPtr.get()), *icon->getImageStoreEntry())) {
+			icon->EventUpdated.emit();
+			return;
+		}
+	}
+	PendingRender pendingRender;
+	pendingRender.modelName = modelName;
+	pendingRender.icon = icon;
+	mPendingRenders.push_back(pendingRender);
+}
+
+bool IconRenderer::frameStarted(const Ogre::FrameEvent&)
+{
+	for (unsigned int i = 0; i < mMaxRendersPerFrame && !mPendingRenders.empty(); ++i) {
+		PendingRender pendingRender = mPendingRenders.front();
+		mPendingRenders.pop_front();
+		startRender(pendingRender.modelName, pendingRender.icon);
+	}
+	return true;
+}
+
+void IconRenderer::startRender(const std::string& modelName, Icon* icon)
 {
 	Model::Model* model = Model::Model::createModel(*getRenderContext()->getSceneManager(), modelName);
 	if (model) {
@@ -141,7 +179,7 @@ void IconRenderer::performRendering(Model::Model* model, Icon*)
 	}
 }
 
-void IconRenderer::blitRenderToIcon(Icon* icon)
+void IconRenderer::blitRenderToIcon(Icon* icon, const Model::Model* model)
 {
 	if (!mRenderContext->getTexture().isNull()) {
 		Ogre::HardwarePixelBufferSharedPtr srcBuffer = mRenderContext->getTexture()->getBuffer();
@@ -161,6 +199,9 @@ void IconRenderer::blitRenderToIcon(Icon* icon)
 
 		srcBuffer->blitToMemory(icon->getImageStoreEntry()->getImagePixelBox());
 		dstBuffer->blitFromMemory(icon->getImageStoreEntry()->getImagePixelBox(), dstBox);
+		if (mCache && model) {
+			mCache->store(*model->getDefinition(), *icon->getImageStoreEntry());
+		}
 		//Now that the icon is updated, emit a signal to this effect.
 		icon->EventUpdated.emit();
 	}
@@ -302,7 +343,7 @@ void DelayedIconRendererWorker::performRendering(DelayedIconRendererEntry& entry
 
 void DelayedIconRendererWorker::finalizeRendering(DelayedIconRendererEntry& entry)
 {
-	mRenderer.blitRenderToIcon(entry.getIcon());
+	mRenderer.blitRenderToIcon(entry.getIcon(), entry.getModel());
 	mRenderer.getRenderContext()->getSceneManager()->destroyMovableObject(entry.getModel());
 	entries.pop();
 }
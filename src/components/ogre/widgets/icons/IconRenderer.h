@@ -27,6 +27,7 @@
 #include <memory>
 #include "components/ogre/EmberOgrePrerequisites.h"
 #include <queue>
+#include <deque>
 #include <OgreFrameListener.h>
 
 namespace Ember
@@ -48,6 +49,7 @@ namespace Ember
       {
 
         class Icon;
+        class IconCache;
         class IconRenderer;
         class IconImageStoreEntry;
         class DelayedIconRendererWorker;
@@ -200,8 +202,10 @@ namespace Ember
          Responsible for rendering the model to the icon texture.
          The actual rendering will be handled by an instance of IconRenderWorker.
          Note that it's not guaranteed that the rendering and blitting will occur on the same frame.
+         If an IconCache is set, icons are loaded from it when possible, and rendered icons are written to it.
+         Icons which need to be rendered are queued, and only a limited number of models are created each frame, so that requesting many icons at once doesn't stall the client.
          */
-        class IconRenderer
+        class IconRenderer : public Ogre::FrameListener
         {
           friend class IconRenderWorker;
         public:
@@ -217,6 +221,7 @@ namespace Ember
 
           /**
            * Renders a model by the specified name to the icon.
+           * If the icon is found in the cache it's loaded directly, else the rendering is queued.
            * @param modelName The name of the model to render.
            * @param icon The icon it should be rendered to.
            */
@@ -255,17 +260,63 @@ namespace Ember
           performRendering(Model::Model* model, Icon* icon);
 
           /**
-           * Blits the rendered texture onto the icon texture.
-           * @param icon
+           * Blits the rendered texture onto the icon texture, and writes it to the cache if there is one.
+           * @param icon The icon.
+           * @param model The model which was rendered.
+           */
+          void
+          blitRenderToIcon(Icon* icon, const Model::Model* model);
+
+          /**
+           * @brief Sets the cache used for loading and storing icons.
+           * @param cache The cache, or null to disable caching. Ownership isn't transferred.
+           */
+          void
+          setCache(IconCache* cache);
+
+          /**
+           * @brief Sets the max number of models to create for rendering each frame.
+           * @param maxRendersPerFrame The max number of renders started each frame.
            */
           void
-          blitRenderToIcon(Icon* icon);
+          setMaxRendersPerFrame(unsigned int maxRendersPerFrame);
+
+          /**
+           * @brief Starts a limited number of the queued renders.
+           */
+          bool
+          frameStarted(const Ogre::FrameEvent& event);
 
         protected:
 
+          /**
+           * @brief A render which hasn't been started yet.
+           */
+          struct PendingRender
+          {
+            std::string modelName;
+            Icon* icon;
+          };
+
           int mPixelWidth;
           std::unique_ptr<SimpleRenderContext> mRenderContext;
           IconRenderWorker* mWorker;
+          IconCache* mCache;
+
+          /**
+           * @brief Renders waiting to be started, in the order they were requested.
+           */
+          std::deque<PendingRender> mPendingRenders;
+
+          unsigned int mMaxRendersPerFrame;
+
+          /**
+           * @brief Creates the model and hands it to the worker.
+           * @param modelName The name of the model to render.
+           * @param icon The icon to render to.
+           */
+          void
+          startRender(const std::string& modelName, Icon* icon);
 
           /**
            * @brief Call this when the model is being rendered in a backround thread, and we want to render it to the icon once it's done.
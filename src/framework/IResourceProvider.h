@@ -99,6 +99,11 @@ public:
 	Returns a resource by the name.
 	*/
 	virtual ResourceWrapper getResource(const std::string& name) = 0;
+
+	/**
+	Returns true if getResource() can safely be called from a background thread.
+	*/
+	virtual bool isThreadSafe() const { return false; }
 };
 
 inline const char* ResourceWrapper::getDataPtr() const { return mInternalWrapper->getDataPtr();}
@@ -27,7 +27,7 @@ namespace Ember
 template<> MainLoopController *Singleton<MainLoopController>::ms_Singleton = 0;
 
 MainLoopController::MainLoopController(bool& shouldQuit, bool& pollEris) :
-		mShouldQuit(shouldQuit), mPollEris(pollEris)
+		mShouldQuit(shouldQuit), mPollEris(pollEris), mFixedTimeStep(0)
 {
 }
 
@@ -62,4 +62,14 @@ bool MainLoopController::getErisPolling() const
 	return mPollEris;
 }
 
+void MainLoopController::setFixedTimeStep(float timeStep)
+{
+	mFixedTimeStep = timeStep;
+}
+
+float MainLoopController::getFixedTimeStep() const
+{
+	return mFixedTimeStep;
+}
+
 }
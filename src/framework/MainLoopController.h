@@ -22,11 +22,41 @@
 #include <sigc++/signal.h>
 #include "Singleton.h"
 
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
 namespace Ember
 {
 
 class TimeFrame;
 
+/**
+ * @brief The time spent in each phase of one main loop step.
+ *
+ * Phases which weren't carried out in the step have a zero duration.
+ */
+struct FramePhaseTimes
+{
+	/**
+	 * @brief Time spent polling Eris and updating the world view.
+	 */
+	boost::posix_time::time_duration erisPolling;
+
+	/**
+	 * @brief Time spent processing input.
+	 */
+	boost::posix_time::time_duration inputProcessing;
+
+	/**
+	 * @brief Time spent rendering, including any background loading done by the graphics component.
+	 */
+	boost::posix_time::time_duration rendering;
+
+	/**
+	 * @brief Time spent updating the sound.
+	 */
+	boost::posix_time::time_duration sound;
+};
+
 /**
  * @author Erik Ogenvik <erik@ogenvik.org>
  *
@@ -103,6 +133,19 @@ public:
 	 */
 	bool getErisPolling() const;
 
+	/**
+	 * @brief Sets a fixed time step to use for advancing the simulation each frame, instead of the wall clock time.
+	 * This is used when replaying recorded input, so that each replay advances the world identically regardless of how long the frames take to render.
+	 * @param timeStep The time step in seconds, or zero to use the wall clock time.
+	 */
+	void setFixedTimeStep(float timeStep);
+
+	/**
+	 * @brief Gets the fixed time step.
+	 * @return The fixed time step in seconds, or zero if the wall clock time should be used.
+	 */
+	float getFixedTimeStep() const;
+
 	/**
 	 * @brief Emitted before the eris polling is started.
 	 * The parameter sent is the time slice since this event last was emitted.
@@ -138,6 +181,12 @@ public:
 	 */
 	sigc::signal<void, const TimeFrame&, unsigned int> EventFrameProcessed;
 
+	/**
+	 * @brief Emitted after one frame has been processed, just before EventFrameProcessed.
+	 * The parameter sent is the time spent in each phase of the frame.
+	 */
+	sigc::signal<void, const FramePhaseTimes&> EventFramePhasesProcessed;
+
 private:
 
 	/**
@@ -150,6 +199,11 @@ private:
 	 */
 	bool& mPollEris;
 
+	/**
+	 * @brief The fixed time step, or zero if none is used.
+	 */
+	float mFixedTimeStep;
+
 };
 
 }
@@ -217,11 +217,14 @@ void Application::mainLoopStep(long minMicrosecondsPerFrame)
 	TimeFrame timeFrame = TimeFrame(boost::posix_time::microseconds(minMicrosecondsPerFrame));
 	Input& input(Input::getSingleton());
 	ptime currentTime;
+	ptime phaseStartTime;
+	FramePhaseTimes phaseTimes;
 	unsigned int frameActionMask = 0;
 	try {
 
 		if (mPollEris) {
 			currentTime = microsec_clock::local_time();
+			phaseStartTime = currentTime;
 			mMainLoopController.EventStartErisPoll.emit((currentTime - mLastTimeErisPollStart).total_microseconds() / 1000000.0f);
 			mLastTimeErisPollStart = currentTime;
 			Eris::PollDefault::poll(0);
@@ -229,28 +232,37 @@ void Application::mainLoopStep(long minMicrosecondsPerFrame)
 				mWorldView->update();
 			}
 			currentTime = microsec_clock::local_time();
+			phaseTimes.erisPolling = currentTime - phaseStartTime;
 			mMainLoopController.EventEndErisPoll.emit((currentTime - mLastTimeErisPollEnd).total_microseconds() / 1000000.0f);
 			mLastTimeErisPollEnd = currentTime;
 			frameActionMask |= MainLoopController::FA_ERIS;
 		}
 
 		currentTime = microsec_clock::local_time();
+		phaseStartTime = currentTime;
 		mMainLoopController.EventBeforeInputProcessing.emit((currentTime - mLastTimeInputProcessingStart).total_microseconds() / 1000000.0f);
 		mLastTimeInputProcessingStart = currentTime;
 		input.processInput();
 		frameActionMask |= MainLoopController::FA_INPUT;
 
 		currentTime = microsec_clock::local_time();
+		phaseTimes.inputProcessing = currentTime - phaseStartTime;
 		mMainLoopController.EventAfterInputProcessing.emit((currentTime - mLastTimeInputProcessingEnd).total_microseconds() / 1000000.0f);
 		mLastTimeInputProcessingEnd = currentTime;
 
+		phaseStartTime = microsec_clock::local_time();
 		bool updatedRendering = mOgreView->renderOneFrame(timeFrame);
 		if (updatedRendering) {
 			frameActionMask |= MainLoopController::FA_GRAPHICS;
 		}
+		currentTime = microsec_clock::local_time();
+		phaseTimes.rendering = currentTime - phaseStartTime;
+
 		mServices->getSoundService().cycle();
 		frameActionMask |= MainLoopController::FA_SOUND;
+		phaseTimes.sound = microsec_clock::local_time() - currentTime;
 
+		mMainLoopController.EventFramePhasesProcessed(phaseTimes);
 		mMainLoopController.EventFrameProcessed(timeFrame, frameActionMask);
 
 		//If we should cap the fps so that each frame should take a minimum amount of time,
@@ -40,16 +40,20 @@
 #include "Input.h"
 #include "IWindowProvider.h"
 #include "InputCommandMapper.h"
+#include "InputRecording.h"
 #include "EmberIcon.h"
 
 #include "IInputAdapter.h"
 
 #include "services/config/ConfigListenerContainer.h"
+#include "services/config/ConfigService.h"
+#include "services/EmberServices.h"
 
 #include "framework/Tokeniser.h"
 #include "framework/ConsoleBackend.h"
 #include "framework/LoggingInstance.h"
 #include "framework/MainLoopController.h"
+#include "framework/osdir.h"
 
 #ifdef _WIN32
 #include "platform/platform_windows.h"
@@ -85,7 +89,7 @@ const std::string Input::BINDCOMMAND("bind");
 const std::string Input::UNBINDCOMMAND("unbind");
 
 Input::Input() :
-		ToggleFullscreen(0), mCurrentInputMode(IM_GUI), mMouseState(0), mTimeSinceLastRightMouseClick(0), mSuppressForCurrentEvent(false), mMovementModeEnabled(false), mConfigListenerContainer(new ConfigListenerContainer()), mMouseGrabbingRequested(false), mMouseGrab(false), mMainLoopController(0), mWindowProvider(NULL), mScreenWidth(0), mScreenHeight(0), mIconSurface(0), mMainVideoSurface(0), mInvertMouse(1), mHandleOpenGL(false)
+		ToggleFullscreen(0), RecordInput(0), ReplayInput(0), mCurrentInputMode(IM_GUI), mMouseState(0), mTimeSinceLastRightMouseClick(0), mSuppressForCurrentEvent(false), mMovementModeEnabled(false), mConfigListenerContainer(new ConfigListenerContainer()), mMouseGrabbingRequested(false), mMouseGrab(false), mMainLoopController(0), mWindowProvider(NULL), mScreenWidth(0), mScreenHeight(0), mIconSurface(0), mMainVideoSurface(0), mInvertMouse(1), mHandleOpenGL(false)
 {
 	mMousePosition.xPixelPosition = 0;
 	mMousePosition.yPixelPosition = 0;
@@ -220,12 +224,16 @@ std::string Input::createWindow(unsigned int width, unsigned int height, bool fu
 	if (!ToggleFullscreen) {
 		ToggleFullscreen = new ConsoleCommandWrapper("toggle_fullscreen", this, "Switch between windowed and full screen mode.");
 	}
+	createCommands();
 
 	return ss.str();
 }
 
 void Input::shutdownInteraction()
 {
+	stopRecording();
+	stopReplay();
+
 	mWindowProvider = 0;
 
 	if (mIconSurface) {
@@ -247,6 +255,20 @@ void Input::shutdownInteraction()
 	console.deregisterCommand(BINDCOMMAND);
 	console.deregisterCommand(UNBINDCOMMAND);
 	delete ToggleFullscreen;
+	delete RecordInput;
+	RecordInput = 0;
+	delete ReplayInput;
+	ReplayInput = 0;
+}
+
+void Input::createCommands()
+{
+	if (!RecordInput) {
+		RecordInput = new ConsoleCommandWrapper("+record_input", this, "Starts recording all input to a file in the 'inputrecordings' directory in the home directory. Usage: +record_input <filename>");
+	}
+	if (!ReplayInput) {
+		ReplayInput = new ConsoleCommandWrapper("replay_input", this, "Replays input recorded with +record_input, using a fixed time step, and reports how long each frame took. Usage: replay_input <filename> [time step in seconds, 0 to use the recorded time steps]");
+	}
 }
 
 void Input::createIcon()
@@ -364,6 +386,7 @@ void Input::attach(IWindowProvider* windowProvider)
 	ConsoleBackend& console = ConsoleBackend::getSingleton();
 	console.registerCommand(BINDCOMMAND, this);
 	console.registerCommand(UNBINDCOMMAND, this);
+	createCommands();
 
 }
 
@@ -412,6 +435,34 @@ void Input::runCommand(const std::string &command, const std::string &args)
 		}
 	} else if (ToggleFullscreen && *ToggleFullscreen == command) {
 		setFullscreen((mMainVideoSurface->flags & SDL_FULLSCREEN) == 0);
+	} else if (RecordInput && *RecordInput == command) {
+		Tokeniser tokeniser;
+		tokeniser.initTokens(args);
+		std::string filename = tokeniser.nextToken();
+		if (filename == "") {
+			filename = "input.rec";
+		}
+		startRecording(getRecordingDirectory() + filename);
+	} else if (RecordInput && RecordInput->getInverseCommand() == command) {
+		stopRecording();
+	} else if (ReplayInput && *ReplayInput == command) {
+		Tokeniser tokeniser;
+		tokeniser.initTokens(args);
+		std::string filename = tokeniser.nextToken();
+		if (filename == "") {
+			filename = "input.rec";
+		}
+		float timeStep = 0;
+		std::string timeStepString = tokeniser.nextToken();
+		if (timeStepString != "") {
+			std::istringstream(timeStepString) >> timeStep;
+		} else {
+			ConfigService& configService = EmberServices::getSingleton().getConfigService();
+			if (configService.hasItem("input", "replaytimestep")) {
+				timeStep = static_cast<double>(configService.getValue("input", "replaytimestep"));
+			}
+		}
+		startReplay(getRecordingDirectory() + filename, timeStep);
 	}
 }
 
@@ -471,10 +522,21 @@ void Input::startInteraction()
 void Input::processInput()
 {
 	uint32_t ticks = SDL_GetTicks();
-	float secondsSinceLast = (ticks - mLastTick) * 1000.0f;
+	float secondsSinceLast = (ticks - mLastTick) / 1000.0f;
 	mLastTick = ticks;
-	pollMouse(secondsSinceLast);
-	pollEvents(secondsSinceLast);
+	if (mReplay) {
+		replayFrame();
+	} else {
+		if (mRecorder) {
+			mRecordedFrame->timeSinceLastFrame = secondsSinceLast;
+			mRecordedFrame->events.clear();
+		}
+		pollMouse(secondsSinceLast);
+		pollEvents(secondsSinceLast);
+		if (mRecorder) {
+			mRecorder->recordFrame(*mRecordedFrame);
+		}
+	}
 	if (mWindowProvider) {
 		mWindowProvider->processInput();
 	}
@@ -485,9 +547,18 @@ void Input::pollMouse(float secondsSinceLast)
 {
 	int mouseX, mouseY;
 	mMouseState = SDL_GetMouseState(&mouseX, &mouseY);
+	Uint8 appState = SDL_GetAppState();
+	if (mRecorder) {
+		mRecordedFrame->mouseX = mouseX;
+		mRecordedFrame->mouseY = mouseY;
+		mRecordedFrame->appState = appState;
+	}
+	processMouseState(mouseX, mouseY, appState, secondsSinceLast);
+}
 
+void Input::processMouseState(int mouseX, int mouseY, unsigned int appState, float secondsSinceLast)
+{
 	//has the mouse moved?
-	Uint8 appState = SDL_GetAppState();
 	if (appState & SDL_APPMOUSEFOCUS) {
 		//Wait with grabbing the mouse until the app has input focus.
 		if (mMouseGrabbingRequested && (appState & SDL_APPINPUTFOCUS)) {
@@ -527,7 +598,10 @@ void Input::pollMouse(float secondsSinceLast)
 			}
 
 			if (freezeMouse) {
-				SDL_WarpMouse(mMousePosition.xPixelPosition, mMousePosition.yPixelPosition);
+				//When replaying the recorded mouse positions are already relative to the frozen position, so there's no need to move the real cursor.
+				if (!mReplay) {
+					SDL_WarpMouse(mMousePosition.xPixelPosition, mMousePosition.yPixelPosition);
+				}
 			} else {
 				mMousePosition.xPixelPosition = mouseX;
 				mMousePosition.yPixelPosition = mouseY;
@@ -537,7 +611,6 @@ void Input::pollMouse(float secondsSinceLast)
 
 		}
 	}
-
 }
 
 void Input::pollEvents(float secondsSinceLast)
@@ -545,122 +618,246 @@ void Input::pollEvents(float secondsSinceLast)
 	mTimeSinceLastRightMouseClick += secondsSinceLast;
 	static SDL_Event event;
 	while (SDL_PollEvent(&event)) {
-		switch (event.type) {
-		/* Look for a keypress */
-		case SDL_KEYDOWN:
-		case SDL_KEYUP:
-			keyChanged(event.key);
-			break;
-		case SDL_QUIT:
-			if (mMainLoopController) {
-				mMainLoopController->requestQuit();
+		if (mRecorder && InputRecorder::isRecordable(event)) {
+			mRecordedFrame->events.push_back(event);
+		}
+		processEvent(event);
+	}
+}
+
+void Input::processEvent(const SDL_Event& event)
+{
+	switch (event.type) {
+	/* Look for a keypress */
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		keyChanged(event.key);
+		break;
+	case SDL_QUIT:
+		if (mMainLoopController) {
+			mMainLoopController->requestQuit();
+		}
+		break;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		if (event.button.state == SDL_RELEASED) {
+			if (event.button.button == SDL_BUTTON_RIGHT) {
+				//right mouse button released
+
+				//if there's two right mouse clicks withing 0.25 seconds from each others, it's a double click
+				/*		if (mTimeSinceLastRightMouseClick < 0.25) {
+				 toggleInputMode();
+
+				 }*/
+				mTimeSinceLastRightMouseClick = 0.0f;
+				//toggleInputMode();
+				EventMouseButtonReleased.emit(MouseButtonRight, mCurrentInputMode);
+
+			} else if (event.button.button == SDL_BUTTON_LEFT) {
+				//left mouse button released
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonUp(Input::MouseButtonLeft))
+						break;
+				}
+
+				EventMouseButtonReleased.emit(MouseButtonLeft, mCurrentInputMode);
+
+			} else if (event.button.button == SDL_BUTTON_MIDDLE) {
+				//middle mouse button released
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonUp(Input::MouseButtonMiddle))
+						break;
+				}
+
+				EventMouseButtonReleased.emit(MouseButtonMiddle, mCurrentInputMode);
 			}
-			break;
-		case SDL_MOUSEBUTTONDOWN:
-		case SDL_MOUSEBUTTONUP:
-			if (event.button.state == SDL_RELEASED) {
-				if (event.button.button == SDL_BUTTON_RIGHT) {
-					//right mouse button released
-
-					//if there's two right mouse clicks withing 0.25 seconds from each others, it's a double click
-					/*		if (mTimeSinceLastRightMouseClick < 0.25) {
-					 toggleInputMode();
-
-					 }*/
-					mTimeSinceLastRightMouseClick = 0.0f;
-					//toggleInputMode();
-					EventMouseButtonReleased.emit(MouseButtonRight, mCurrentInputMode);
-
-				} else if (event.button.button == SDL_BUTTON_LEFT) {
-					//left mouse button released
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonUp(Input::MouseButtonLeft))
-							break;
-					}
-
-					EventMouseButtonReleased.emit(MouseButtonLeft, mCurrentInputMode);
-
-				} else if (event.button.button == SDL_BUTTON_MIDDLE) {
-					//middle mouse button released
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonUp(Input::MouseButtonMiddle))
-							break;
-					}
-
-					EventMouseButtonReleased.emit(MouseButtonMiddle, mCurrentInputMode);
+		} else {
+
+			if (event.button.button == SDL_BUTTON_RIGHT) {
+				//right mouse button pressed
+
+				//if the right mouse button is pressed, switch from gui mode
+
+				if (mMovementModeEnabled) {
+					toggleInputMode();
+				}
+				EventMouseButtonPressed.emit(MouseButtonRight, mCurrentInputMode);
+
+			} else if (event.button.button == SDL_BUTTON_LEFT) {
+				//left mouse button pressed
+
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonDown(Input::MouseButtonLeft))
+						break;
+				}
+
+				EventMouseButtonPressed.emit(MouseButtonLeft, mCurrentInputMode);
+			} else if (event.button.button == SDL_BUTTON_MIDDLE) {
+				//middle mouse button pressed
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonDown(Input::MouseButtonMiddle))
+						break;
 				}
-			} else {
 
-				if (event.button.button == SDL_BUTTON_RIGHT) {
-					//right mouse button pressed
-
-					//if the right mouse button is pressed, switch from gui mode
-
-					if (mMovementModeEnabled) {
-						toggleInputMode();
-					}
-					EventMouseButtonPressed.emit(MouseButtonRight, mCurrentInputMode);
-
-				} else if (event.button.button == SDL_BUTTON_LEFT) {
-					//left mouse button pressed
-
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonDown(Input::MouseButtonLeft))
-							break;
-					}
-
-					EventMouseButtonPressed.emit(MouseButtonLeft, mCurrentInputMode);
-				} else if (event.button.button == SDL_BUTTON_MIDDLE) {
-					//middle mouse button pressed
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonDown(Input::MouseButtonMiddle))
-							break;
-					}
-
-					EventMouseButtonPressed.emit(MouseButtonMiddle, mCurrentInputMode);
-
-				} else if (event.button.button == SDL_BUTTON_WHEELUP) {
-					EventMouseButtonPressed.emit(MouseWheelUp, mCurrentInputMode);
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonDown(Input::MouseWheelUp))
-							break;
-					}
-				} else if (event.button.button == SDL_BUTTON_WHEELDOWN) {
-					EventMouseButtonPressed.emit(MouseWheelDown, mCurrentInputMode);
-					for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
-						IInputAdapter* adapter = *I;
-						++I;
-						if (!(adapter)->injectMouseButtonDown(Input::MouseWheelDown))
-							break;
-					}
+				EventMouseButtonPressed.emit(MouseButtonMiddle, mCurrentInputMode);
+
+			} else if (event.button.button == SDL_BUTTON_WHEELUP) {
+				EventMouseButtonPressed.emit(MouseWheelUp, mCurrentInputMode);
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonDown(Input::MouseWheelUp))
+						break;
+				}
+			} else if (event.button.button == SDL_BUTTON_WHEELDOWN) {
+				EventMouseButtonPressed.emit(MouseWheelDown, mCurrentInputMode);
+				for (IInputAdapterStore::const_iterator I = mAdapters.begin(); I != mAdapters.end();) {
+					IInputAdapter* adapter = *I;
+					++I;
+					if (!(adapter)->injectMouseButtonDown(Input::MouseWheelDown))
+						break;
 				}
 			}
-			break;
-		case SDL_ACTIVEEVENT:
-			if (event.active.state & SDL_APPACTIVE) {
-				EventWindowActive.emit(event.active.gain);
+		}
+		break;
+	case SDL_ACTIVEEVENT:
+		if (event.active.state & SDL_APPACTIVE) {
+			EventWindowActive.emit(event.active.gain);
 //On Windows we get a corrupted screen if we just switch to non-fullscreen here.
 #ifndef _WIN32
-				lostFocus();
+			lostFocus();
 #endif
-			}
-			break;
+		}
+		break;
+
+	case SDL_VIDEORESIZE:
+		setGeometry(event.resize.w, event.resize.h);
+		break;
+	}
+}
 
-		case SDL_VIDEORESIZE:
-			setGeometry(event.resize.w, event.resize.h);
-			break;
+void Input::replayFrame()
+{
+	boost::posix_time::ptime currentTime = boost::posix_time::microsec_clock::local_time();
+	if (!mLastReplayFrameTime.is_not_a_date_time()) {
+		mReplay->addFrameTiming((currentTime - mLastReplayFrameTime).total_microseconds() / 1000000.0f);
+	}
+	mLastReplayFrameTime = currentTime;
+
+	//Input from the system is ignored while replaying, except for requests to quit.
+	static SDL_Event event;
+	while (SDL_PollEvent(&event)) {
+		if (event.type == SDL_QUIT) {
+			stopReplay();
+			processEvent(event);
+			return;
 		}
 	}
+
+	if (!mReplay->hasMoreFrames()) {
+		stopReplay();
+		return;
+	}
+
+	RecordedInputFrame frame = mReplay->nextFrame();
+	if (mMainLoopController) {
+		mMainLoopController->setFixedTimeStep(frame.timeSinceLastFrame);
+	}
+	mTimeSinceLastRightMouseClick += frame.timeSinceLastFrame;
+	processMouseState(frame.mouseX, frame.mouseY, frame.appState, frame.timeSinceLastFrame);
+	for (std::vector<SDL_Event>::const_iterator I = frame.events.begin(); I != frame.events.end(); ++I) {
+		processEvent(*I);
+	}
+}
+
+void Input::startRecording(const std::string& path)
+{
+	if (mReplay) {
+		ConsoleBackend::getSingleton().pushMessage("Can't record input while replaying.", "error");
+		return;
+	}
+	stopRecording();
+	mRecorder.reset(new InputRecorder(path));
+	if (!mRecorder->isValid()) {
+		mRecorder.reset();
+		S_LOG_FAILURE("Could not open '" << path << "' for recording input.");
+		ConsoleBackend::getSingleton().pushMessage("Could not open '" + path + "' for recording input.", "error");
+		return;
+	}
+	mRecordedFrame.reset(new RecordedInputFrame());
+	S_LOG_INFO("Recording input to '" << path << "'.");
+	ConsoleBackend::getSingleton().pushMessage("Recording input to '" + path + "'.", "info");
+}
+
+void Input::stopRecording()
+{
+	if (mRecorder) {
+		std::stringstream ss;
+		ss << "Stopped recording input after " << mRecorder->getNumberOfFrames() << " frames.";
+		S_LOG_INFO(ss.str());
+		ConsoleBackend::getSingleton().pushMessage(ss.str(), "info");
+		mRecorder.reset();
+		mRecordedFrame.reset();
+	}
+}
+
+bool Input::startReplay(const std::string& path, float fixedTimeStep)
+{
+	stopRecording();
+	stopReplay();
+	mReplay.reset(new InputReplay(path, fixedTimeStep));
+	if (!mReplay->isValid()) {
+		mReplay.reset();
+		ConsoleBackend::getSingleton().pushMessage("Could not read input recording '" + path + "'.", "error");
+		return false;
+	}
+	mReplayPath = path;
+	mLastReplayFrameTime = boost::posix_time::ptime();
+	S_LOG_INFO("Replaying input from '" << path << "'.");
+	ConsoleBackend::getSingleton().pushMessage("Replaying input from '" + path + "'.", "info");
+	return true;
+}
+
+void Input::stopReplay()
+{
+	if (mReplay) {
+		if (mMainLoopController) {
+			mMainLoopController->setFixedTimeStep(0);
+		}
+		std::string summary = "Finished replaying input from '" + mReplayPath + "'. " + mReplay->getTimingSummary();
+		S_LOG_INFO(summary);
+		ConsoleBackend::getSingleton().pushMessage(summary, "info");
+		mReplay->writeTimings(mReplayPath + ".timing.csv");
+		mReplay.reset();
+		mReplayPath = "";
+	}
+}
+
+bool Input::isReplaying() const
+{
+	return mReplay.get() != 0;
+}
+
+std::string Input::getRecordingDirectory() const
+{
+	std::string directory = EmberServices::getSingleton().getConfigService().getHomeDirectory() + "/inputrecordings/";
+	try {
+		oslink::directory osdir(directory);
+		if (!osdir) {
+			oslink::directory::mkdir(directory.c_str());
+		}
+	} catch (const std::exception& ex) {
+		S_LOG_FAILURE("Error when creating directory for input recordings." << ex);
+	}
+	return directory;
 }
 
 void Input::pasteFromClipboard()
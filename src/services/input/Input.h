@@ -36,9 +36,12 @@
 
 #include <SDL_keysym.h>
 
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
 #include <set>
 #include <list>
 #include <unordered_map>
+#include <memory>
 
 #ifdef HAVE_STDINT_H
 #include <stdint.h>
@@ -49,6 +52,7 @@ typedef unsigned int uint32_t;
 struct SDL_KeyboardEvent;
 struct SDL_keysym;
 struct SDL_Surface;
+union SDL_Event;
 
 namespace varconf
 {
@@ -63,6 +67,9 @@ class IWindowProvider;
 class InputCommandMapper;
 class ConfigListenerContainer;
 class MainLoopController;
+class InputRecorder;
+class InputReplay;
+struct RecordedInputFrame;
 
 typedef std::set<SDLKey> KeysSet;
 typedef std::list<IInputAdapter*> IInputAdapterStore;
@@ -442,11 +449,55 @@ public:
 	 */
 	bool hasWindow() const;
 
+	/**
+	 * @brief Starts recording all input to a file.
+	 * For each frame the mouse position and the application state is recorded, together with all key, mouse button and window events. See InputRecorder for the file format.
+	 * Any existing recording is stopped first.
+	 * @param path The path of the file to record to.
+	 */
+	void startRecording(const std::string& path);
+
+	/**
+	 * @brief Stops recording input.
+	 */
+	void stopRecording();
+
+	/**
+	 * @brief Starts replaying recorded input.
+	 * While replaying, all input from the system is ignored (except requests to quit) and the recorded input is instead injected, frame by frame, through the same adapters and events as live input.
+	 * Each frame is advanced using a fixed time step, set on the MainLoopController, so that replays are repeatable. The time each frame took is collected, and when the replay is finished a summary is written to the log and the console, and the individual frame times are written next to the recording.
+	 * @param path The path of the recording.
+	 * @param fixedTimeStep The time step, in seconds, to use for each frame. If zero, the time steps of the recording will be used.
+	 * @return True if the recording could be read.
+	 */
+	bool startReplay(const std::string& path, float fixedTimeStep);
+
+	/**
+	 * @brief Stops replaying input, and reports the frame timings.
+	 */
+	void stopReplay();
+
+	/**
+	 * @brief Returns true if recorded input currently is being replayed.
+	 * @return True if replaying.
+	 */
+	bool isReplaying() const;
+
 	/**
 	 * @brief Console command for toggling full screen mode.
 	 */
 	const ConsoleCommandWrapper* ToggleFullscreen;
 
+	/**
+	 * @brief Console command for starting and stopping recording of input.
+	 */
+	const ConsoleCommandWrapper* RecordInput;
+
+	/**
+	 * @brief Console command for replaying recorded input.
+	 */
+	const ConsoleCommandWrapper* ReplayInput;
+
 private:
 
 	typedef std::unordered_map<std::string, InputCommandMapper*> InputCommandMapperStore;
@@ -458,6 +509,15 @@ private:
 	 */
 	void pollMouse(float secondsSinceLast);
 
+	/**
+	 * @brief Handles the state of the mouse for this frame, as polled from the system or read from a recording.
+	 * @param mouseX The horizontal position of the mouse, in pixels.
+	 * @param mouseY The vertical position of the mouse, in pixels.
+	 * @param appState The SDL application state.
+	 * @param secondsSinceLast In whole seconds, the time since the last polling.
+	 */
+	void processMouseState(int mouseX, int mouseY, unsigned int appState, float secondsSinceLast);
+
 	/**
 	 * @brief Polls all needed events from the system.
 	 * Call this each frame.
@@ -465,6 +525,28 @@ private:
 	 */
 	void pollEvents(float secondsSinceLast);
 
+	/**
+	 * @brief Handles one event, as polled from the system or read from a recording.
+	 * @param event The event.
+	 */
+	void processEvent(const SDL_Event& event);
+
+	/**
+	 * @brief Injects the next frame of the recording being replayed, instead of polling the system.
+	 */
+	void replayFrame();
+
+	/**
+	 * @brief Creates the console commands, if they haven't already been created.
+	 */
+	void createCommands();
+
+	/**
+	 * @brief Gets the directory in which input recordings are stored, creating it if needed.
+	 * @return The directory, with a trailing slash.
+	 */
+	std::string getRecordingDirectory() const;
+
 	void keyChanged(const SDL_KeyboardEvent &keyEvent);
 
 	void keyPressed(const SDL_KeyboardEvent &keyEvent);
@@ -624,6 +706,31 @@ private:
 	 */
 	bool mHandleOpenGL;
 
+	/**
+	 * @brief Writes recorded input to disk, if input is being recorded.
+	 */
+	std::unique_ptr<InputRecorder> mRecorder;
+
+	/**
+	 * @brief The frame currently being recorded, if input is being recorded.
+	 */
+	std::unique_ptr<RecordedInputFrame> mRecordedFrame;
+
+	/**
+	 * @brief The recording being replayed, if any.
+	 */
+	std::unique_ptr<InputReplay> mReplay;
+
+	/**
+	 * @brief The path of the recording being replayed.
+	 */
+	std::string mReplayPath;
+
+	/**
+	 * @brief The time the last replayed frame started, used for measuring how long each replayed frame takes.
+	 */
+	boost::posix_time::ptime mLastReplayFrameTime;
+
 };
 
 }
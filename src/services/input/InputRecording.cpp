@@ -0,0 +1,248 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "InputRecording.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <algorithm>
+#include <sstream>
+#include <cstring>
+
+namespace Ember
+{
+
+namespace
+{
+/**
+ * @brief The first line of a recording. Bump the version if the format changes.
+ */
+const std::string RECORDING_HEADER = "emberinput 1";
+}
+
+InputRecorder::InputRecorder(const std::string& path) :
+		mStream(path.c_str(), std::ios::out | std::ios::trunc), mNumberOfFrames(0)
+{
+	if (mStream.is_open()) {
+		mStream << RECORDING_HEADER << "\n";
+	}
+}
+
+bool InputRecorder::isValid() const
+{
+	return mStream.is_open();
+}
+
+void InputRecorder::recordFrame(const RecordedInputFrame& frame)
+{
+	mStream << "F " << frame.timeSinceLastFrame << " " << frame.mouseX << " " << frame.mouseY << " " << frame.appState << "\n";
+	for (std::vector<SDL_Event>::const_iterator I = frame.events.begin(); I != frame.events.end(); ++I) {
+		const SDL_Event& event = *I;
+		switch (event.type) {
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			mStream << "K " << static_cast<int>(event.key.type) << " " << static_cast<int>(event.key.state) << " " << static_cast<int>(event.key.keysym.sym) << " " << static_cast<int>(event.key.keysym.mod) << " " << event.key.keysym.unicode << " " << static_cast<int>(event.key.keysym.scancode) << "\n";
+			break;
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+			mStream << "B " << static_cast<int>(event.button.type) << " " << static_cast<int>(event.button.state) << " " << static_cast<int>(event.button.button) << " " << event.button.x << " " << event.button.y << "\n";
+			break;
+		case SDL_ACTIVEEVENT:
+			mStream << "A " << static_cast<int>(event.active.gain) << " " << static_cast<int>(event.active.state) << "\n";
+			break;
+		case SDL_VIDEORESIZE:
+			mStream << "R " << event.resize.w << " " << event.resize.h << "\n";
+			break;
+		}
+	}
+	mNumberOfFrames++;
+}
+
+unsigned int InputRecorder::getNumberOfFrames() const
+{
+	return mNumberOfFrames;
+}
+
+bool InputRecorder::isRecordable(const SDL_Event& event)
+{
+	switch (event.type) {
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+	case SDL_ACTIVEEVENT:
+	case SDL_VIDEORESIZE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+InputReplay::InputReplay(const std::string& path, float fixedTimeStep) :
+		mFixedTimeStep(fixedTimeStep)
+{
+	if (!load(path)) {
+		mFrames.clear();
+	}
+}
+
+bool InputReplay::load(const std::string& path)
+{
+	std::ifstream stream(path.c_str());
+	if (!stream.is_open()) {
+		S_LOG_WARNING("Could not open input recording '" << path << "'.");
+		return false;
+	}
+	std::string line;
+	if (!std::getline(stream, line) || line != RECORDING_HEADER) {
+		S_LOG_WARNING("Input recording '" << path << "' has an unknown format.");
+		return false;
+	}
+	while (std::getline(stream, line)) {
+		std::istringstream lineStream(line);
+		std::string type;
+		if (!(lineStream >> type)) {
+			continue;
+		}
+		if (type == "F") {
+			RecordedInputFrame frame;
+			if (!(lineStream >> frame.timeSinceLastFrame >> frame.mouseX >> frame.mouseY >> frame.appState)) {
+				S_LOG_WARNING("Malformed frame in input recording '" << path << "'.");
+				return false;
+			}
+			mFrames.push_back(frame);
+			continue;
+		}
+		//All other lines are events, which belong to the last frame.
+		if (mFrames.empty()) {
+			S_LOG_WARNING("Event before first frame in input recording '" << path << "'.");
+			return false;
+		}
+		SDL_Event event;
+		std::memset(&event, 0, sizeof(event));
+		bool valid = false;
+		if (type == "K") {
+			int eventType, state, sym, mod, unicode, scancode;
+			if (lineStream >> eventType >> state >> sym >> mod >> unicode >> scancode) {
+				event.key.type = eventType;
+				event.key.state = state;
+				event.key.keysym.sym = static_cast<SDLKey>(sym);
+				event.key.keysym.mod = static_cast<SDLMod>(mod);
+				event.key.keysym.unicode = unicode;
+				event.key.keysym.scancode = scancode;
+				valid = true;
+			}
+		} else if (type == "B") {
+			int eventType, state, button, x, y;
+			if (lineStream >> eventType >> state >> button >> x >> y) {
+				event.button.type = eventType;
+				event.button.state = state;
+				event.button.button = button;
+				event.button.x = x;
+				event.button.y = y;
+				valid = true;
+			}
+		} else if (type == "A") {
+			int gain, state;
+			if (lineStream >> gain >> state) {
+				event.active.type = SDL_ACTIVEEVENT;
+				event.active.gain = gain;
+				event.active.state = state;
+				valid = true;
+			}
+		} else if (type == "R") {
+			int width, height;
+			if (lineStream >> width >> height) {
+				event.resize.type = SDL_VIDEORESIZE;
+				event.resize.w = width;
+				event.resize.h = height;
+				valid = true;
+			}
+		}
+		if (valid) {
+			mFrames.back().events.push_back(event);
+		} else {
+			S_LOG_WARNING("Ignoring malformed line '" << line << "' in input recording '" << path << "'.");
+		}
+	}
+	S_LOG_VERBOSE("Read " << mFrames.size() << " frames from input recording '" << path << "'.");
+	return true;
+}
+
+bool InputReplay::isValid() const
+{
+	return !mFrames.empty();
+}
+
+bool InputReplay::hasMoreFrames() const
+{
+	return !mFrames.empty();
+}
+
+RecordedInputFrame InputReplay::nextFrame()
+{
+	RecordedInputFrame frame = mFrames.front();
+	mFrames.pop_front();
+	if (mFixedTimeStep > 0) {
+		frame.timeSinceLastFrame = mFixedTimeStep;
+	}
+	return frame;
+}
+
+void InputReplay::addFrameTiming(float seconds)
+{
+	mFrameTimings.push_back(seconds);
+}
+
+std::string InputReplay::getTimingSummary() const
+{
+	std::stringstream ss;
+	if (mFrameTimings.empty()) {
+		ss << "No frames replayed.";
+		return ss.str();
+	}
+	std::vector<float> sorted(mFrameTimings);
+	std::sort(sorted.begin(), sorted.end());
+	float total = 0;
+	for (std::vector<float>::const_iterator I = sorted.begin(); I != sorted.end(); ++I) {
+		total += *I;
+	}
+	size_t p95Index = std::min(sorted.size() - 1, (sorted.size() * 95) / 100);
+	ss << sorted.size() << " frames in " << total << " seconds. Frame time in ms: average " << (total * 1000.0f / sorted.size()) << ", min " << (sorted.front() * 1000.0f) << ", median " << (sorted[sorted.size() / 2] * 1000.0f) << ", 95th percentile " << (sorted[p95Index] * 1000.0f) << ", max " << (sorted.back() * 1000.0f) << ".";
+	return ss.str();
+}
+
+bool InputReplay::writeTimings(const std::string& path) const
+{
+	std::ofstream stream(path.c_str(), std::ios::out | std::ios::trunc);
+	if (!stream.is_open()) {
+		S_LOG_WARNING("Could not write frame timings to '" << path << "'.");
+		return false;
+	}
+	stream << "frame,milliseconds\n";
+	for (size_t i = 0; i < mFrameTimings.size(); ++i) {
+		stream << i << "," << (mFrameTimings[i] * 1000.0f) << "\n";
+	}
+	return stream.good();
+}
+
+}
@@ -0,0 +1,210 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef INPUTRECORDING_H_
+#define INPUTRECORDING_H_
+
+#ifdef _MSC_VER
+#include <SDL_events.h>
+#else
+#include <SDL/SDL_events.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+
+namespace Ember
+{
+
+/**
+ * @brief All input captured during one frame.
+ *
+ * Timestamps are relative to the previous frame rather than absolute, so that a recording can be replayed with any start time.
+ */
+struct RecordedInputFrame
+{
+	/**
+	 * @brief The time, in seconds, since the previous frame.
+	 */
+	float timeSinceLastFrame;
+
+	/**
+	 * @brief The horizontal position of the mouse, in pixels.
+	 */
+	int mouseX;
+
+	/**
+	 * @brief The vertical position of the mouse, in pixels.
+	 */
+	int mouseY;
+
+	/**
+	 * @brief The SDL application state (focus and visibility flags).
+	 */
+	unsigned int appState;
+
+	/**
+	 * @brief The events received during the frame, in order.
+	 */
+	std::vector<SDL_Event> events;
+};
+
+/**
+ * @brief Writes recorded input to a file, one frame at a time.
+ *
+ * The file is a plain text file, starting with a header line. Each frame is written as a line starting with "F", followed by one line for each event in that frame.
+ * Frames are written as they are recorded, so that a recording isn't lost if the application crashes.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class InputRecorder
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param path The path of the file to write to. Any existing file will be overwritten.
+	 */
+	InputRecorder(const std::string& path);
+
+	/**
+	 * @brief Returns true if the file could be opened for writing.
+	 * @return True if the recorder is valid.
+	 */
+	bool isValid() const;
+
+	/**
+	 * @brief Writes a frame to the file.
+	 * @param frame The frame.
+	 */
+	void recordFrame(const RecordedInputFrame& frame);
+
+	/**
+	 * @brief Gets the number of frames recorded so far.
+	 * @return The number of frames.
+	 */
+	unsigned int getNumberOfFrames() const;
+
+	/**
+	 * @brief Returns true if the event is of a kind which is recorded.
+	 * Events such as mouse motion aren't recorded as events, since the mouse position is recorded for each frame instead.
+	 * @param event The event.
+	 * @return True if the event should be recorded.
+	 */
+	static bool isRecordable(const SDL_Event& event);
+
+private:
+
+	/**
+	 * @brief The file being written to.
+	 */
+	std::ofstream mStream;
+
+	/**
+	 * @brief The number of frames written.
+	 */
+	unsigned int mNumberOfFrames;
+};
+
+/**
+ * @brief Replays recorded input, frame by frame, and keeps track of how long each replayed frame took to process.
+ *
+ * During replay the application should use a fixed time step for each frame rather than the wall clock time, so that the simulation advances identically each time the recording is replayed. The frame timings collected can then be compared between runs.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class InputReplay
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param path The path of the recording to read.
+	 * @param fixedTimeStep The time step, in seconds, to use for each frame. If zero, the time steps stored in the recording will be used.
+	 */
+	InputReplay(const std::string& path, float fixedTimeStep);
+
+	/**
+	 * @brief Returns true if there are frames to replay. Check this directly after construction to see if the recording could be read.
+	 * @return True if the replay is valid.
+	 */
+	bool isValid() const;
+
+	/**
+	 * @brief Returns true if there are more frames to replay.
+	 * @return True if there are more frames.
+	 */
+	bool hasMoreFrames() const;
+
+	/**
+	 * @brief Gets the next frame and advances the replay.
+	 * The time since the last frame will be replaced with the fixed time step, if one is used.
+	 * Only call this if hasMoreFrames() returns true.
+	 * @return The next frame.
+	 */
+	RecordedInputFrame nextFrame();
+
+	/**
+	 * @brief Records the wall clock time it took to process a replayed frame.
+	 * @param seconds The time, in seconds.
+	 */
+	void addFrameTiming(float seconds);
+
+	/**
+	 * @brief Gets a one line summary of the frame timings, suitable for the log or the console.
+	 * @return A summary of the frame timings.
+	 */
+	std::string getTimingSummary() const;
+
+	/**
+	 * @brief Writes the time each frame took, in milliseconds, to a file.
+	 * @param path The path of the file to write.
+	 * @return True if the file could be written.
+	 */
+	bool writeTimings(const std::string& path) const;
+
+private:
+
+	/**
+	 * @brief Frames left to replay.
+	 */
+	std::deque<RecordedInputFrame> mFrames;
+
+	/**
+	 * @brief The fixed time step, or zero if the recorded time steps should be used.
+	 */
+	float mFixedTimeStep;
+
+	/**
+	 * @brief The time, in seconds, each replayed frame took to process.
+	 */
+	std::vector<float> mFrameTimings;
+
+	/**
+	 * @brief Reads the recording.
+	 * @param path The path of the recording.
+	 * @return True if the recording could be read.
+	 */
+	bool load(const std::string& path);
+};
+
+}
+
+#endif /* INPUTRECORDING_H_ */
@@ -58,6 +58,47 @@ namespace Ember
     virtual void
     update() = 0;
 
+    /**
+     * @brief Returns true if the binding has bound its data to the source, so that the source can be played.
+     * Since sound data is loaded asynchronously, a binding might need to wait a little before it can bind anything.
+     * @return True if the source is ready to be played.
+     */
+    virtual bool
+    isReady() const
+    {
+      return true;
+    }
+
+    /**
+     * @brief Called by the SoundInstance when it starts or stops playing.
+     * Streaming bindings use this to tell a buffer underrun apart from the sound being stopped.
+     * @param isPlaying True if the sound is playing.
+     */
+    virtual void
+    setIsPlaying(bool isPlaying)
+    {
+    }
+
+    /**
+     * @brief Called by the SoundInstance when an OpenAL source has been assigned to, or released from, the sound source.
+     * Since sound sources are pooled, a source might be virtual for some time, and any binding must then be done again once a real OpenAL source is assigned.
+     */
+    virtual void
+    sourceAssignmentChanged()
+    {
+    }
+
+    /**
+     * @brief Gets the duration of the bound sound data.
+     * This is used for keeping track of the playback position of virtual sound instances.
+     * @return The duration in seconds, or a negative value if it isn't known.
+     */
+    virtual float
+    getDuration() const
+    {
+      return -1.0f;
+    }
+
   protected:
     /**
      * @brief The SoundSource to which this binding is attached.
@@ -28,12 +28,28 @@
 #include "SoundSample.h"
 #include "SoundSource.h"
 
+#include <cmath>
+
 namespace Ember
 {
 
+  namespace
+  {
+    /**
+     * @brief How long, in seconds, a virtual sound which doesn't loop is considered to play when the duration of its sound data isn't known.
+     * This is the case for streamed samples and for samples which haven't been loaded yet. Without a limit such instances would never complete, and thus never be cleaned up.
+     */
+    const float UNKNOWN_DURATION_TIMEOUT = 30.0f;
+  }
+
+  const int SoundInstance::PRIORITY_AMBIENT;
+  const int SoundInstance::PRIORITY_ACTION;
+  const int SoundInstance::PRIORITY_GUI;
+
   SoundInstance::SoundInstance() :
       mSource(new SoundSource()), mBinding(0), mMotionProvider(0), mPreviousState(
-          0)
+          0), mIsPlayPending(false), mIsPlaying(false), mIsPaused(false), mPlaybackPosition(
+          0), mPriority(0), mAudibility(0)
   {
   }
 
@@ -63,8 +79,47 @@ namespace Ember
   bool
   SoundInstance::play()
   {
+    mIsPlaying = true;
+    if (!mIsPaused)
+      {
+        mPlaybackPosition = 0;
+      }
+    mIsPaused = false;
+    if (mBinding)
+      {
+        mBinding->setIsPlaying(true);
+      }
+    //A virtual sound will start playing once it's been assigned an OpenAL source.
+    if (mSource->isVirtual())
+      {
+        mIsPlayPending = false;
+        return true;
+      }
+    //If the sound data still is loading we'll wait with playing until it's ready.
+    if (mBinding && !mBinding->isReady())
+      {
+        mIsPlayPending = true;
+        return true;
+      }
+    return startALPlayback();
+  }
+
+  bool
+  SoundInstance::startALPlayback()
+  {
+    mIsPlayPending = false;
     alGetError();
     alSourcePlay(mSource->getALSource());
+    if (mPlaybackPosition > 0 && mBinding)
+      {
+        //Resume at the position reached while the sound was virtual.
+        float duration = mBinding->getDuration();
+        if (duration > 0)
+          {
+            alSourcef(mSource->getALSource(), AL_SEC_OFFSET,
+                std::fmod(mPlaybackPosition, duration));
+          }
+      }
     mPreviousState = AL_PLAYING;
     return SoundGeneral::checkAlError("Playing sound instance.");
   }
@@ -72,6 +127,17 @@ namespace Ember
   bool
   SoundInstance::stop()
   {
+    mIsPlaying = false;
+    mIsPaused = false;
+    mIsPlayPending = false;
+    if (mBinding)
+      {
+        mBinding->setIsPlaying(false);
+      }
+    if (mSource->isVirtual())
+      {
+        return true;
+      }
     alGetError();
     alSourceStop(mSource->getALSource());
     return SoundGeneral::checkAlError("Stopping sound instance.");
@@ -80,21 +146,41 @@ namespace Ember
   bool
   SoundInstance::pause()
   {
+    mIsPaused = mIsPlaying;
+    mIsPlaying = false;
+    mIsPlayPending = false;
+    if (mBinding)
+      {
+        mBinding->setIsPlaying(false);
+      }
+    if (mSource->isVirtual())
+      {
+        return true;
+      }
     alGetError();
     alSourcePause(mSource->getALSource());
     return SoundGeneral::checkAlError("Pausing sound instance.");
   }
 
   void
-  SoundInstance::update()
+  SoundInstance::updateMotion()
   {
     if (mMotionProvider)
       {
         mMotionProvider->update(*mSource);
       }
+  }
+
+  void
+  SoundInstance::update()
+  {
     if (mBinding)
       {
         mBinding->update();
+        if (mIsPlayPending && mBinding->isReady())
+          {
+            startALPlayback();
+          }
       }
     if (!getIsLooping())
       {
@@ -105,44 +191,102 @@ namespace Ember
             SoundGeneral::checkAlError("Checking source state.");
             if (alNewState == AL_STOPPED)
               {
-                EventPlayComplete.emit();
                 mPreviousState = alNewState;
+                mIsPlaying = false;
+                //Note that this instance might be destroyed as a result of emitting the signal.
+                EventPlayComplete.emit();
               }
           }
       }
   }
 
+  void
+  SoundInstance::updateVirtual(float timeSlice)
+  {
+    mPlaybackPosition += timeSlice;
+    if (!getIsLooping())
+      {
+        float duration = mBinding ? mBinding->getDuration() : -1.0f;
+        if (duration <= 0)
+          {
+            duration = UNKNOWN_DURATION_TIMEOUT;
+          }
+        if (mPlaybackPosition >= duration)
+          {
+            mIsPlaying = false;
+            //Note that this instance might be destroyed as a result of emitting the signal.
+            EventPlayComplete.emit();
+          }
+      }
+  }
+
+  void
+  SoundInstance::assignALSource(ALuint alSource)
+  {
+    mSource->assignALSource(alSource);
+    if (mBinding)
+      {
+        mBinding->sourceAssignmentChanged();
+      }
+    if (mIsPlaying)
+      {
+        if (!mBinding || mBinding->isReady())
+          {
+            startALPlayback();
+          }
+        else
+          {
+            mIsPlayPending = true;
+          }
+      }
+  }
+
+  ALuint
+  SoundInstance::releaseALSource()
+  {
+    ALuint alSource = mSource->getALSource();
+    if (mIsPlaying || mIsPaused)
+      {
+        ALfloat offset = 0;
+        alGetSourcef(alSource, AL_SEC_OFFSET, &offset);
+        mPlaybackPosition = offset;
+      }
+    alSourceStop(alSource);
+    //Unqueue all buffers.
+    alSourcei(alSource, AL_BUFFER, 0);
+    SoundGeneral::checkAlError("Releasing sound source.");
+    mSource->releaseALSource();
+    if (mBinding)
+      {
+        mBinding->sourceAssignmentChanged();
+      }
+    mIsPlayPending = false;
+    mPreviousState = 0;
+    return alSource;
+  }
+
   void
   SoundInstance::setIsLooping(bool isLooping)
   {
-    alSourcei(mSource->getALSource(), AL_LOOPING,
-        isLooping ? AL_TRUE : AL_FALSE);
-    SoundGeneral::checkAlError("Setting looping status.");
+    mSource->setIsLooping(isLooping);
   }
 
   bool
   SoundInstance::getIsLooping() const
   {
-    ALint alValue;
-    alGetSourcei(mSource->getALSource(), AL_LOOPING, &alValue);
-    SoundGeneral::checkAlError("Checking looping status.");
-    return alValue == AL_TRUE;
+    return mSource->getIsLooping();
   }
 
   void
   SoundInstance::setMaxDistance(float maxDistance)
   {
-    alSourcef(mSource->getALSource(), AL_MAX_DISTANCE, maxDistance);
-    SoundGeneral::checkAlError("Setting max distance.");
+    mSource->setMaxDistance(maxDistance);
   }
 
   float
   SoundInstance::getMaxDistance() const
   {
-    ALfloat alValue;
-    alGetSourcef(mSource->getALSource(), AL_MAX_DISTANCE, &alValue);
-    SoundGeneral::checkAlError("Checking max distance.");
-    return alValue;
+    return mSource->getMaxDistance();
   }
 
 }
@@ -26,6 +26,14 @@
 #include <memory>
 #include <sigc++/signal.h>
 
+#ifdef __APPLE__
+#include <OpenAL/al.h>
+#elif defined(_MSC_VER)
+#include <al.h>
+#else
+#include <AL/al.h>
+#endif
+
 namespace Ember {
 
 class SoundSource;
@@ -52,7 +60,7 @@ public:
 This is the basic class for all sounds that are played. Whenever another component in Ember wants a sound to be played, it should ask the SoundService for a new SoundInstance instance, and use that to play the sound. Once the sound has completed the instance should be destroyed.
 The idea is that there shouldn't be that many sounds being played at any one momement, and thus not that many live instances of this class.
 
-An instane of this encapsulates a SoundSource instance which is automatically created and destroyed together with the SoundInstance. The actual binding to sound data is however handled by an instance of SoundBinding. An instance of SoundBinding can normally be obtained either directly from a BaseSoundSample, or from a SoundGroup. After you've obtained a SoundBinding you are required to bind it to this class through a call to bind().
+An instane of this encapsulates a SoundSource instance which is automatically created and destroyed together with the SoundInstance. The SoundSource is however only bound to an actual OpenAL source while the instance is among the most audible ones; the SoundService keeps a fixed pool of OpenAL sources, and all other instances are "virtual", which means that they only keep track of their playback position until they become audible again. The actual binding to sound data is however handled by an instance of SoundBinding. An instance of SoundBinding can normally be obtained either directly from a BaseSoundSample, or from a SoundGroup. After you've obtained a SoundBinding you are required to bind it to this class through a call to bind().
 
 If you want to provide motion updates for the sound instance (such as with a sound eminating from within the 3d world) you need to register an instance of ISoundMotionProvider through setMotionProvider(). Note that this isn't required, for example with ambient or gui sounds.
 
@@ -66,6 +74,7 @@ public:
 	/**
 	 * @brief Start to play the sound.
 	 * If this is called for a sound that is already playing, it will restart at the beginning.
+	 * If the sound data still is being loaded, the sound will start playing as soon as it's ready.
 	 * @return True if we could successfully start playing the sound.
 	 */
 	bool play();
@@ -85,7 +94,7 @@ public:
 	
 	/**
 	 * @brief Gets the sound source which this instance holds.
-	 * Each SoundInstance is connected to one SoundSource (and as a result to one OpenAL source).
+	 * Each SoundInstance is connected to one SoundSource, which in turn is bound to an OpenAL source while the instance isn't virtual.
 	 * @return The SoundSource which this instance holds.
 	 */
 	SoundSource& getSource();
@@ -136,6 +145,39 @@ public:
 	 * @return The max distance for the sound.
 	 */
 	float getMaxDistance() const;
+
+	/**
+	 * @brief The priority of ambient and looping sounds, such as the movement sounds of entities. This is the default.
+	 */
+	static const int PRIORITY_AMBIENT = 0;
+	/**
+	 * @brief The priority of sounds made by entities when they perform actions.
+	 */
+	static const int PRIORITY_ACTION = 10;
+	/**
+	 * @brief The priority of sounds made by the user interface, which should always be heard.
+	 */
+	static const int PRIORITY_GUI = 20;
+
+	/**
+	 * @brief Sets the priority of the sound. Defaults to PRIORITY_AMBIENT.
+	 * When there are more sounds playing than there are OpenAL sources available, sounds with a higher priority will always be preferred. Sounds with the same priority are ordered by how loud they are heard by the listener.
+	 * @param priority The priority.
+	 */
+	void setPriority(int priority);
+
+	/**
+	 * @brief Gets the priority of the sound.
+	 * @return The priority.
+	 */
+	int getPriority() const;
+
+	/**
+	 * @brief Returns true if the sound is playing (or is waiting to be played once its data is loaded).
+	 * Note that a virtual sound can be playing, even though it's not heard.
+	 * @return True if playing.
+	 */
+	bool isPlaying() const;
 	
 	
 protected:
@@ -153,14 +195,48 @@ protected:
     ~SoundInstance();
 
 	/**
-	 * @brief This is called each frame by the SoundService.
-	 * Through a call to this, which should happen each frame, both the ISoundMotionProvider and the SoundBinding instances attached to this class will be asked to update themselves.
+	 * @brief This is called each frame by the SoundService, for all instances.
+	 * Through a call to this the ISoundMotionProvider will be asked to update the source.
+	 */
+	void updateMotion();
+
+	/**
+	 * @brief This is called each frame by the SoundService, for instances which are bound to an OpenAL source.
+	 * Through a call to this the SoundBinding instance attached to this class will be asked to update itself.
 	 */
 	void update();
+
+	/**
+	 * @brief This is called each frame by the SoundService, for virtual instances which are playing.
+	 * This just advances the playback position, and checks whether the sound has completed.
+	 * If the duration of the sound data isn't known a sound which doesn't loop is considered complete after a fixed time.
+	 * @param timeSlice The time since the last update, in seconds.
+	 */
+	void updateVirtual(float timeSlice);
+
+	/**
+	 * @brief Binds an OpenAL source from the pool to this instance.
+	 * If the instance is playing, playback will resume at the current position.
+	 * @param alSource The OpenAL source.
+	 */
+	void assignALSource(ALuint alSource);
+
+	/**
+	 * @brief Releases the OpenAL source bound to this instance, making it virtual.
+	 * The source will be stopped, and any buffers unqueued.
+	 * @return The OpenAL source, which should be returned to the pool.
+	 */
+	ALuint releaseALSource();
+
+	/**
+	 * @brief Starts playback on the OpenAL source, at the current playback position.
+	 * @return True if we could successfully start playing the sound.
+	 */
+	bool startALPlayback();
 	
 	/**
 	 * @brief The sound source held by this class.
-	 * Each instance of this class holds onto a SoundSource (and thus also an OpenAL source).
+	 * Each instance of this class holds onto a SoundSource, which holds the state of the voice even when no OpenAL source is assigned.
 	 * It's created and destroyed together with the instance.
 	 */
 	std::unique_ptr<SoundSource> mSource;
@@ -186,6 +262,39 @@ protected:
 	 */
 	int mPreviousState;
 
+	/**
+	 * @brief True if play() has been called while the binding wasn't ready.
+	 * The sound will then start playing as soon as the binding is ready.
+	 */
+	bool mIsPlayPending;
+
+	/**
+	 * @brief True if the sound is playing.
+	 */
+	bool mIsPlaying;
+
+	/**
+	 * @brief True if the sound is paused, in which case playback will resume at the current position when play() is called.
+	 */
+	bool mIsPaused;
+
+	/**
+	 * @brief The playback position, in seconds.
+	 * This is only kept up to date while the instance is virtual.
+	 */
+	float mPlaybackPosition;
+
+	/**
+	 * @brief The priority of the sound.
+	 */
+	int mPriority;
+
+	/**
+	 * @brief How loud the sound was heard by the listener at the last update.
+	 * This is updated by the SoundService.
+	 */
+	float mAudibility;
+
 };
 
 inline void SoundInstance::setMotionProvider(ISoundMotionProvider* motionProvider)
@@ -193,6 +302,21 @@ inline void SoundInstance::setMotionProvider(ISoundMotionProvider* motionProvide
 	mMotionProvider = motionProvider;
 }
 
+inline void SoundInstance::setPriority(int priority)
+{
+	mPriority = priority;
+}
+
+inline int SoundInstance::getPriority() const
+{
+	return mPriority;
+}
+
+inline bool SoundInstance::isPlaying() const
+{
+	return mIsPlaying;
+}
+
 }
 
 #endif
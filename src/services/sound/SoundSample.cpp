@@ -25,19 +25,21 @@
 #include "framework/LoggingInstance.h"
 
 #include "SoundSource.h"
+#include "SoundService.h"
+#include "SoundSampleLoadTask.h"
+#include "SoundStreamDecodeTask.h"
+#include "WavStreamReader.h"
 
-#include <AL/alut.h>
+#include "framework/Exception.h"
 
 namespace Ember
 {
 
-  StaticSoundBinding::StaticSoundBinding(SoundSource& source,
-      StaticSoundSample& sample) :
-      SoundBinding(source), mSample(sample)
+  BaseSoundSample::BaseSoundSample(SoundService& service,
+      const std::string& path, SoundGeneral::SoundSampleType type) :
+      mService(service), mPath(path), mType(type), mLoadingState(
+          LS_UNLOADED), mUserCount(0), mLastUsed(0), mLoadTicket(0)
   {
-    // Bind it to the buffer.
-    alSourcei(source.getALSource(), AL_BUFFER, sample.getBuffer());
-    SoundGeneral::checkAlError("Binding sound source to static sound buffer.");
   }
 
   SoundGeneral::SoundSampleType
@@ -46,27 +48,167 @@ namespace Ember
     return mType;
   }
 
-  StaticSoundSample::StaticSoundSample(const ResourceWrapper& resource,
-      bool playsLocal, float volume) :
-      mBuffer(0), mResource(resource)
+  const std::string&
+  BaseSoundSample::getPath() const
+  {
+    return mPath;
+  }
+
+  BaseSoundSample::LoadingState
+  BaseSoundSample::getLoadingState() const
+  {
+    return mLoadingState;
+  }
+
+  bool
+  BaseSoundSample::isLoaded() const
+  {
+    return mLoadingState == LS_LOADED;
+  }
+
+  void
+  BaseSoundSample::addUser()
   {
-    mType = SoundGeneral::SAMPLE_WAV;
-    mBuffer = alutCreateBufferFromFileImage(mResource.getDataPtr(),
-        mResource.getSize());
+    ++mUserCount;
+    mService.markSampleUsed(*this);
+  }
 
-    if (!SoundGeneral::checkAlError("Generated buffer for static sample."))
+  void
+  BaseSoundSample::removeUser()
+  {
+    if (mUserCount > 0)
       {
-        alDeleteBuffers(1, &mBuffer);
+        --mUserCount;
+      }
+  }
+
+  unsigned int
+  BaseSoundSample::getUserCount() const
+  {
+    return mUserCount;
+  }
+
+  SoundService&
+  BaseSoundSample::getService() const
+  {
+    return mService;
+  }
+
+  StaticSoundBinding::StaticSoundBinding(SoundSource& source,
+      StaticSoundSample& sample) :
+      SoundBinding(source), mSample(sample), mIsBound(false)
+  {
+    mSample.addUser();
+    bindBuffer();
+  }
+
+  StaticSoundBinding::~StaticSoundBinding()
+  {
+    mSample.removeUser();
+  }
+
+  void
+  StaticSoundBinding::update()
+  {
+    // Since it's a static sound we don't need to update anything once it's bound.
+    if (!mIsBound)
+      {
+        bindBuffer();
+      }
+  }
+
+  bool
+  StaticSoundBinding::isReady() const
+  {
+    return mIsBound;
+  }
+
+  void
+  StaticSoundBinding::sourceAssignmentChanged()
+  {
+    mIsBound = false;
+    bindBuffer();
+  }
+
+  float
+  StaticSoundBinding::getDuration() const
+  {
+    return mSample.getDuration();
+  }
+
+  void
+  StaticSoundBinding::bindBuffer()
+  {
+    if (mSample.isLoaded() && !mSource.isVirtual())
+      {
+        // Bind it to the buffer.
+        alSourcei(mSource.getALSource(), AL_BUFFER, mSample.getBuffer());
+        SoundGeneral::checkAlError(
+            "Binding sound source to static sound buffer.");
+        mIsBound = true;
       }
   }
 
+  StaticSoundSample::StaticSoundSample(SoundService& service,
+      const std::string& path) :
+      BaseSoundSample(service, path, SoundGeneral::SAMPLE_WAV), mBuffer(0), mDataSize(
+          0), mDuration(-1.0f)
+  {
+  }
+
   StaticSoundSample::~StaticSoundSample()
   {
-    if (alIsBuffer(mBuffer))
+    unload();
+  }
+
+  bool
+  StaticSoundSample::applyLoadedData(SoundSampleLoadTask& task)
+  {
+    unload();
+    alGetError();
+    alGenBuffers(1, &mBuffer);
+    if (!SoundGeneral::checkAlError("Generating buffer for static sample."))
+      {
+        mBuffer = 0;
+        return false;
+      }
+    alBufferData(mBuffer, task.getDecodedFormat(), task.getDecodedData(),
+        task.getDecodedSize(), task.getDecodedFrequency());
+    if (!SoundGeneral::checkAlError("Filling buffer for static sample."))
+      {
+        unload();
+        return false;
+      }
+    mDataSize = task.getDecodedSize();
+
+    ALint bits = 0, channels = 0;
+    alGetBufferi(mBuffer, AL_BITS, &bits);
+    alGetBufferi(mBuffer, AL_CHANNELS, &channels);
+    if (bits > 0 && channels > 0 && task.getDecodedFrequency() > 0)
+      {
+        mDuration = static_cast<float>(mDataSize)
+            / ((bits / 8) * channels * task.getDecodedFrequency());
+      }
+    return true;
+  }
+
+  void
+  StaticSoundSample::unload()
+  {
+    if (mBuffer && alIsBuffer(mBuffer))
       {
         alDeleteBuffers(1, &mBuffer);
         SoundGeneral::checkAlError("Deleting static sound buffers.");
       }
+    mBuffer = 0;
+    mDataSize = 0;
+    mDuration = -1.0f;
+  }
+
+  bool
+  StaticSoundSample::needsDecoding() const
+  {
+    return true;
   }
 
   ALuint
@@ -95,223 +237,251 @@ namespace Ember
     return 1;
   }
 
-// Streamed (OGG)
-// 	StreamedSoundSample::StreamedSoundSample(const std::string& filename, bool playsLocal, float volume)
-// 	{
-// 		mPlaying = false;
-// 		mType = SAMPLE_OGG;
-// 
-// 		FILE* newFile = fopen(filename.c_str(), "rb");
-// 		if (!newFile)
-// 		{
-// 			S_LOG_FAILURE("Failed to open file(" + filename + ") to stream.");
-// 			return;
-// 		}
-// 
-// 		mFile = newFile;
-// 		mFilename = filename;
-// 
-// 		if (ov_open(newFile, &mStream, NULL, 0) < 0)
-// 		{
-// 			S_LOG_FAILURE("Failed to bind ogg stream to sound sample.");
-// 
-// 			fclose(newFile);
-// 			return;
-// 		}
-// 
-// 		vorbis_info* oggInfo = ov_info(&mStream, -1);
-// 		if (oggInfo->channels == 1)
-// 		{
-// 			mFormat = AL_FORMAT_MONO16;
-// 		}
-// 		else
-// 		{
-// 			mFormat = AL_FORMAT_STEREO16;
-// 		}
-// 
-// 		mRate = oggInfo->rate;
-// 
-// 		alGenBuffers(2, mBuffers);
-// 		if (alGetError() != AL_NO_ERROR)
-// 		{
-// 			S_LOG_FAILURE("Failed to bind ogg stream to sound sample.");
-// 
-// 			fclose(newFile);
-// 			return;
-// 		}
-// 
-// 		alGenSources(1, &mSource);
-// 		if (alGetError() != AL_NO_ERROR)
-// 		{
-// 			S_LOG_FAILURE("Failed to bind ogg stream to sound sample.");
-// 
-// 			alDeleteBuffers(2, mBuffers);
-// 			fclose(newFile);
-// 
-// 			return;
-// 		}
-// 
-// 		alSourcef(mSource, AL_PITCH, 1.0);
-// 		alSourcef(mSource, AL_GAIN, volume);
-// 		alSource3f(mSource, AL_POSITION, 0, 0, 0);
-// 		alSource3f(mSource, AL_VELOCITY, 0, 0, 0);
-// 		alSourcei(mSource, AL_LOOPING, false);
-// 
-// 		if (playsLocal == PLAY_LOCAL)
-// 			alSourcei(mSource, AL_SOURCE_RELATIVE, true);
-// 
-// 		// Ask the Sound Service to register us
-// 		// that we way we keep playing =]
-// 		EmberServices::getSingleton().getSoundService().registerStream(this);
-// 	}
-// 
-// 	StreamedSoundSample::~StreamedSoundSample()
-// 	{
-// 		EmberServices::getSingleton().getSoundService().unregisterStream(this);
-// 
-// 		alSourceStop(mSource);
-// 		checkAlError();
-// 
-// 		alDeleteSources(1, &mSource);
-// 		checkAlError();
-// 
-// 		alDeleteBuffers(2, mBuffers);
-// 		checkAlError();
-// 
-// 		ov_clear(&mStream);
-// 	}
-// 
-// 	const std::string& StreamedSoundSample::getFilename()
-// 	{
-// 		return mFilename;
-// 	}
-// 
-// 	void StreamedSoundSample::setPlaying(bool play)
-// 	{
-// 		mPlaying = play;
-// 	}
-// 
-// 	OggVorbis_File* StreamedSoundSample::getStreamPtr()
-// 	{
-// 		return &mStream;
-// 	}
-// 
-// 	ALuint* StreamedSoundSample::getBufferPtr()
-// 	{
-// 		return mBuffers;
-// 	}
-// 
-// 	bool StreamedSoundSample::isPlaying()
-// 	{
-// 		return mPlaying;
-// 	}
-// 
-// 	unsigned int StreamedSoundSample::getNumberOfBuffers()
-// 	{
-// 		return 2;
-// 	}
-// 
-// 	void StreamedSoundSample::cycle()
-// 	{
-// 		ALint processed;
-// 		bool active = true;
-// 		
-// 		alGetSourcei(mSource, AL_BUFFERS_PROCESSED, &processed);
-// 		checkAlError();
-// 		while (processed > 0)
-// 		{
-// 			ALuint buffer;
-// 
-// 			alSourceUnqueueBuffers(mSource, 1, &buffer);
-// 			checkAlError();
-// 
-// 			active = stream(buffer);
-// 			if (!active)
-// 				break;
-// 
-// 			alSourceQueueBuffers(mSource, 1, &buffer);
-// 			checkAlError();
-// 
-// 			alGetSourcei(mSource, AL_BUFFERS_PROCESSED, &processed);
-// 			checkAlError();
-// 		}
-// 	}
-// 
-// 	bool StreamedSoundSample::stream(ALuint buffer)
-// 	{
-// 		char data[OGG_BUFFER_SIZE];
-// 		unsigned int size = 0;
-// 		int section;
-// 		int result;
-// 
-// 		while (size < OGG_BUFFER_SIZE)
-// 		{
-// 			#ifndef LITTLE_ENDIAN
-// 				result = ov_read(&mStream, data + size, OGG_BUFFER_SIZE - size, 1, 2, 1, &section);
-// 			#else
-// 				result = ov_read(&mStream, data + size, OGG_BUFFER_SIZE - size, 0, 2, 1, &section);
-// 			#endif
-// 
-// 			if (result > 0)
-// 			{
-// 				size += result;
-// 			}
-// 			else
-// 			{
-// 				if (result < 0)
-// 				{
-// 					S_LOG_FAILURE("Failed to read from ogg stream.");
-// 					return false;
-// 				}
-// 				else break;
-// 			}
-// 		}
-// 
-// 		// Stream is over
-// 		if (!size)
-// 		{
-// 			mPlaying = false;
-// 			return false;
-// 		}
-// 
-// 		alBufferData(buffer, mFormat, data, size, mRate);
-// 		checkAlError();
-// 
-// 		return true;
-// 	}
-// 		
-// 	void StreamedSoundSample::play()
-// 	{
-// 		// Already Playing
-// 		if (isPlaying())
-// 		{
-// 			return;
-// 		}
-// 
-// 		if (!stream(mBuffers[0]))
-// 		{
-// 			return;
-// 		}
-// 
-// 		if (!stream(mBuffers[1]))
-// 		{
-// 			return;
-// 		}
-// 
-// 		mPlaying = true;
-// 		alSourceQueueBuffers(mSource, 2, mBuffers);
-// 		checkAlError();
-// 
-// 		alSourcePlay(mSource);
-// 		checkAlError();
-// 	}
-// 
-// 	void StreamedSoundSample::stop()
-// 	{
-// 		mPlaying = false;
-// 		alSourceStop(mSource);
-// 		checkAlError();
-// 	}
+  size_t
+  StaticSoundSample::getMemoryUsage() const
+  {
+    return mDataSize;
+  }
 
-}
+  float
+  StaticSoundSample::getDuration() const
+  {
+    return mDuration;
+  }
+
+  StreamedSoundSample::StreamedSoundSample(SoundService& service,
+      const std::string& path) :
+      BaseSoundSample(service, path, SoundGeneral::SAMPLE_WAV)
+  {
+  }
+
+  StreamedSoundSample::~StreamedSoundSample()
+  {
+  }
 
+  unsigned int
+  StreamedSoundSample::getNumberOfBuffers() const
+  {
+    return 0;
+  }
+
+  BaseSoundSample::BufferStore
+  StreamedSoundSample::getBuffers() const
+  {
+    return BaseSoundSample::BufferStore();
+  }
+
+  SoundBinding*
+  StreamedSoundSample::createBinding(SoundSource& source)
+  {
+    return new StreamedSoundBinding(source, *this);
+  }
+
+  size_t
+  StreamedSoundSample::getMemoryUsage() const
+  {
+    if (mResource.get())
+      {
+        return mResource->getSize();
+      }
+    return 0;
+  }
+
+  const ResourceWrapper*
+  StreamedSoundSample::getResource() const
+  {
+    return mResource.get();
+  }
+
+  bool
+  StreamedSoundSample::applyLoadedData(SoundSampleLoadTask& task)
+  {
+    if (!task.getResource())
+      {
+        return false;
+      }
+    mResource.reset(new ResourceWrapper(*task.getResource()));
+    return true;
+  }
+
+  void
+  StreamedSoundSample::unload()
+  {
+    mResource.reset();
+  }
+
+  bool
+  StreamedSoundSample::needsDecoding() const
+  {
+    return false;
+  }
+
+  StreamedSoundBinding::StreamedSoundBinding(SoundSource& source,
+      StreamedSoundSample& sample) :
+      SoundBinding(source), mSample(sample), mState(new SoundStreamState()), mIsStarted(
+          false), mIsPlaying(false)
+  {
+    mSample.addUser();
+
+    alGetError();
+    alGenBuffers(NUMBER_OF_BUFFERS, mBuffers);
+    if (!SoundGeneral::checkAlError("Generating buffers for streamed sample."))
+      {
+        throw Exception("Failed to generate buffers for streamed sample.");
+      }
+    mFreeBuffers.assign(mBuffers, mBuffers + NUMBER_OF_BUFFERS);
+
+    //The looping is handled by rewinding the stream, so we need to turn it off on the source, since it otherwise would loop over the queued buffers.
+    mSource.setIsStreaming(true);
+
+    mState->isLooping = mSource.getIsLooping();
+    mState->targetChunkCount = NUMBER_OF_BUFFERS;
+    mState->chunkSize = BUFFER_SIZE;
+  }
+
+  StreamedSoundBinding::~StreamedSoundBinding()
+  {
+    if (!mSource.isVirtual())
+      {
+        alSourceStop(mSource.getALSource());
+        //Unqueue all buffers.
+        alSourcei(mSource.getALSource(), AL_BUFFER, 0);
+      }
+    alDeleteBuffers(NUMBER_OF_BUFFERS, mBuffers);
+    SoundGeneral::checkAlError("Deleting streamed sound buffers.");
+    mSample.removeUser();
+  }
+
+  bool
+  StreamedSoundBinding::isReady() const
+  {
+    return mIsStarted;
+  }
+
+  void
+  StreamedSoundBinding::setIsPlaying(bool isPlaying)
+  {
+    mIsPlaying = isPlaying;
+  }
+
+  void
+  StreamedSoundBinding::sourceAssignmentChanged()
+  {
+    //The SoundInstance will already have unqueued all buffers from any previous OpenAL source.
+    mFreeBuffers.assign(mBuffers, mBuffers + NUMBER_OF_BUFFERS);
+    mIsStarted = false;
+  }
+
+  void
+  StreamedSoundBinding::update()
+  {
+    if (mSource.isVirtual())
+      {
+        return;
+      }
+    {
+      std::unique_lock<std::mutex> l(mState->mutex);
+      mState->isLooping = mSource.getIsLooping();
+    }
+    if (!mState->reader.get())
+      {
+        const ResourceWrapper* resource = mSample.getResource();
+        if (!resource)
+          {
+            //Still loading.
+            return;
+          }
+        mState->reader.reset(new WavStreamReader(*resource));
+        if (!mState->reader->isValid())
+          {
+            std::unique_lock<std::mutex> l(mState->mutex);
+            mState->isEndOfStream = true;
+            return;
+          }
+      }
+
+    if (mIsStarted)
+      {
+        ALint processed = 0;
+        alGetSourcei(mSource.getALSource(), AL_BUFFERS_PROCESSED, &processed);
+        SoundGeneral::checkAlError("Checking processed stream buffers.");
+        while (processed > 0)
+          {
+            ALuint buffer;
+            alSourceUnqueueBuffers(mSource.getALSource(), 1, &buffer);
+            if (!SoundGeneral::checkAlError("Unqueuing stream buffer."))
+              {
+                break;
+              }
+            mFreeBuffers.push_back(buffer);
+            --processed;
+          }
+      }
+
+    queueFreeBuffers();
+    requestDecoding();
+
+    if (mIsStarted && mIsPlaying)
+      {
+        //If we couldn't keep up with the decoding the source will have stopped, and needs to be restarted once it has data again.
+        ALint state;
+        alGetSourcei(mSource.getALSource(), AL_SOURCE_STATE, &state);
+        ALint queued = 0;
+        alGetSourcei(mSource.getALSource(), AL_BUFFERS_QUEUED, &queued);
+        SoundGeneral::checkAlError("Checking stream state.");
+        if (state == AL_STOPPED && queued > 0)
+          {
+            S_LOG_VERBOSE("Buffer underrun when streaming '" << mSample.getPath() << "'; restarting playback.");
+            alSourcePlay(mSource.getALSource());
+            SoundGeneral::checkAlError("Restarting stream.");
+          }
+      }
+  }
+
+  void
+  StreamedSoundBinding::queueFreeBuffers()
+  {
+    std::unique_lock<std::mutex> l(mState->mutex);
+    //Wait until all initial buffers can be filled before starting, so that playback isn't started with a too short queue.
+    if (!mIsStarted && mState->chunks.size() < NUMBER_OF_BUFFERS
+        && !mState->isEndOfStream)
+      {
+        return;
+      }
+    while (!mFreeBuffers.empty() && !mState->chunks.empty())
+      {
+        ALuint buffer = mFreeBuffers.back();
+        const std::vector<char>& chunk = mState->chunks.front();
+        alBufferData(buffer, mState->reader->getFormat(), &chunk[0],
+            chunk.size(), mState->reader->getFrequency());
+        mState->chunks.pop_front();
+        if (!SoundGeneral::checkAlError("Filling stream buffer."))
+          {
+            break;
+          }
+        alSourceQueueBuffers(mSource.getALSource(), 1, &buffer);
+        if (!SoundGeneral::checkAlError("Queuing stream buffer."))
+          {
+            break;
+          }
+        mFreeBuffers.pop_back();
+        mIsStarted = true;
+      }
+  }
+
+  void
+  StreamedSoundBinding::requestDecoding()
+  {
+    {
+      std::unique_lock<std::mutex> l(mState->mutex);
+      if (mState->isDecoding || mState->isEndOfStream
+          || mState->chunks.size() >= mState->targetChunkCount)
+        {
+          return;
+        }
+      mState->isDecoding = true;
+    }
+    mSample.getService().enqueueTask(new SoundStreamDecodeTask(mState));
+  }
+
+}
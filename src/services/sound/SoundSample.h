@@ -22,7 +22,12 @@
 #include "SoundGeneral.h"
 #include "SoundBinding.h"
 #include "framework/IResourceProvider.h"
+
+#include <sigc++/signal.h>
+
 #include <vector>
+#include <memory>
+#include <string>
 
 #ifdef __APPLE__
 #include <OpenAL/al.h>
@@ -35,18 +40,49 @@
 namespace Ember
 {
   class SoundSource;
+  class SoundService;
+  class SoundSampleLoadTask;
+  class WavStreamReader;
+  struct SoundStreamState;
 
   /**
    * Sound Sample 
    *
    * Defines general properties of sound data
+   *
+   * The actual sound data is loaded asynchronously in a background thread. Until it's loaded any binding created for the sample will wait before it binds any buffers; connect to EventLoaded if you need to know when the sample is ready.
+   * Samples which aren't in use by any binding can be unloaded by the SoundService in order to stay within the sample memory budget, and will then transparently be reloaded the next time they are used.
    */
   class BaseSoundSample
   {
+    friend class SoundService;
   public:
 
     typedef std::vector<ALuint> BufferStore;
 
+    /**
+     * @brief The loading state of a sample.
+     */
+    enum LoadingState
+    {
+      /**
+       * @brief No data is loaded, and no loading is in progress.
+       */
+      LS_UNLOADED,
+      /**
+       * @brief The data is being loaded in a background thread.
+       */
+      LS_LOADING,
+      /**
+       * @brief The data is loaded and ready to be used.
+       */
+      LS_LOADED,
+      /**
+       * @brief The data could not be loaded.
+       */
+      LS_FAILED
+    };
+
     /**
      * Dtor.
      */
@@ -61,6 +97,27 @@ namespace Ember
     SoundGeneral::SoundSampleType
     getType() const;
 
+    /**
+     * @brief Gets the path of the sound data within the resource system.
+     * @return The path of the sound data.
+     */
+    const std::string&
+    getPath() const;
+
+    /**
+     * @brief Gets the current loading state.
+     * @return The loading state.
+     */
+    LoadingState
+    getLoadingState() const;
+
+    /**
+     * @brief Returns true if the sound data is loaded.
+     * @return True if the sample is ready to be bound.
+     */
+    bool
+    isLoaded() const;
+
     /**
      * @brief Returns the number of buffers stored for this sample.
      * @return The number of buffers.
@@ -68,6 +125,16 @@ namespace Ember
     virtual unsigned int
     getNumberOfBuffers() const = 0;
 
+    /**
+     * @brief Gets the duration of the sound data.
+     * @return The duration in seconds, or a negative value if it isn't known (for example if the sample isn't loaded).
+     */
+    virtual float
+    getDuration() const
+    {
+      return -1.0f;
+    }
+
     /**
      * @brief Returns a store of the sound data buffers stored by this sample.
      * The buffers will be returned as ALuint which is the internal buffer reference within OpenAL. Any further operation on the buffer must therefore go through OpenAL (i.e. the values returned are _not_ memory pointers).
@@ -87,19 +154,118 @@ namespace Ember
     virtual SoundBinding*
     createBinding(SoundSource& source) = 0;
 
+    /**
+     * @brief Gets the amount of memory currently used by the sample data.
+     * This is used by the SoundService for keeping within the sample memory budget.
+     * @return The memory used, in bytes.
+     */
+    virtual size_t
+    getMemoryUsage() const = 0;
+
+    /**
+     * @brief Registers a new user of the sample.
+     * Any binding which uses the sample should call this when it's created, and removeUser() when it's destroyed. A sample with users will never be unloaded.
+     * If the sample has been unloaded, it will be loaded again.
+     */
+    void
+    addUser();
+
+    /**
+     * @brief Unregisters a user of the sample.
+     * @see addUser()
+     */
+    void
+    removeUser();
+
+    /**
+     * @brief Gets the number of users of the sample.
+     * @return The number of users.
+     */
+    unsigned int
+    getUserCount() const;
+
+    /**
+     * @brief Gets the service which owns the sample.
+     * @return The sound service.
+     */
+    SoundService&
+    getService() const;
+
+    /**
+     * @brief Emitted in the main thread when the sound data has been loaded.
+     */
+    sigc::signal<void> EventLoaded;
+
   protected:
 
     /**
      * @brief Ctor. This is protected to disallow direct creation of this class except by subclasses.
+     * @param service The service which owns the sample.
+     * @param path The path to the sound data within the resource system.
+     * @param type The type of the sample.
      */
-    BaseSoundSample()
-    {
-    }
+    BaseSoundSample(SoundService& service, const std::string& path,
+        SoundGeneral::SoundSampleType type);
+
+    /**
+     * @brief The service which owns the sample.
+     */
+    SoundService& mService;
+
+    /**
+     * @brief The path to the sound data within the resource system.
+     */
+    std::string mPath;
 
     /**
      * Type of the sample
      */
     SoundGeneral::SoundSampleType mType;
+
+    /**
+     * @brief The current loading state.
+     */
+    LoadingState mLoadingState;
+
+    /**
+     * @brief The number of bindings currently using the sample.
+     */
+    unsigned int mUserCount;
+
+    /**
+     * @brief A stamp from the SoundService, updated each time the sample is used.
+     * This is used for determining which samples were least recently used when unloading.
+     */
+    unsigned long mLastUsed;
+
+    /**
+     * @brief Identifies the most recent load request, so that results from stale requests can be discarded.
+     */
+    unsigned int mLoadTicket;
+
+    /**
+     * @brief Applies the result of a load task.
+     * This is called in the main thread by the SoundService.
+     * @param task The completed load task.
+     * @return True if the data could be applied.
+     */
+    virtual bool
+    applyLoadedData(SoundSampleLoadTask& task) = 0;
+
+    /**
+     * @brief Releases the sound data.
+     * This is called by the SoundService, and only when the sample has no users.
+     */
+    virtual void
+    unload() = 0;
+
+    /**
+     * @brief Returns true if the sample wants the raw data decoded in the background.
+     * Streaming samples do their own incremental decoding and return false.
+     * @return True if the load task should decode the data.
+     */
+    virtual bool
+    needsDecoding() const = 0;
   };
 
   /**
@@ -110,12 +276,11 @@ namespace Ember
   public:
     /**
      * Ctor.
-     * @param resource Resource associated with this sample
-     * @param playsLocal ??? (not used)
-     * @param volume Volume for the sample (not used)
+     * The sample will be created in an unloaded state.
+     * @param service The service which owns the sample.
+     * @param path The path to the sound data within the resource system.
      */
-    StaticSoundSample(const ResourceWrapper& resource, bool playsLocal,
-        float volume);
+    StaticSoundSample(SoundService& service, const std::string& path);
 
     /**
      * Dtor.
@@ -146,6 +311,38 @@ namespace Ember
     virtual BaseSoundSample::BufferStore
     getBuffers() const;
 
+    /**
+     * @copydoc BaseSoundSample::getMemoryUsage()
+     */
+    virtual size_t
+    getMemoryUsage() const;
+
+    /**
+     * @copydoc BaseSoundSample::getDuration()
+     */
+    virtual float
+    getDuration() const;
+
+  protected:
+
+    /**
+     * @copydoc BaseSoundSample::applyLoadedData()
+     */
+    virtual bool
+    applyLoadedData(SoundSampleLoadTask& task);
+
+    /**
+     * @copydoc BaseSoundSample::unload()
+     */
+    virtual void
+    unload();
+
+    /**
+     * @copydoc BaseSoundSample::needsDecoding()
+     */
+    virtual bool
+    needsDecoding() const;
+
   private:
     /**
      * Sample buffer
@@ -153,14 +350,19 @@ namespace Ember
     ALuint mBuffer;
 
     /**
-     * @brief The resource wrapper instance which holds the actual data.
+     * @brief The size of the decoded data held in the buffer.
+     */
+    size_t mDataSize;
+
+    /**
+     * @brief The duration of the sound data, in seconds.
      */
-    ResourceWrapper mResource;
+    float mDuration;
   };
 
   /**
    * @brief A binding to a "static" sound source, i.e. a sound source which doesn't have to be updated.
-   * A "static" sound is one that is small enough to fit into one continous buffer, and thus doesn't need to be dynamically updated as is the case with "streaming" sounds. As a result, this binding is very simple and will just bind the sound data to the source in the constructor, without having to provide any functionality in the update() method.
+   * A "static" sound is one that is small enough to fit into one continous buffer, and thus doesn't need to be dynamically updated as is the case with "streaming" sounds. As a result, this binding is very simple and will just bind the sound data to the source, either directly in the constructor or, if the sample still is loading, in the first call to update() after it's been loaded.
    * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
    */
   class StaticSoundBinding : public SoundBinding
@@ -168,139 +370,251 @@ namespace Ember
   public:
 
     /**
-     * @brief Ctor. All bindings between the buffer and the sound source will occur here.
+     * @brief Ctor. All bindings between the buffer and the sound source will occur here, if the sample is loaded.
      * @param source The sound source.
      * @param sample The static sound sample to bind to the source.
      */
     StaticSoundBinding(SoundSource& source, StaticSoundSample& sample);
 
+    /**
+     * @brief Dtor.
+     */
+    virtual
+    ~StaticSoundBinding();
+
     /**
      * @copydoc SoundBinding::update()
      */
     virtual void
-    update()
-    {
-      // Since it's a static sound we don't need to update anything.
-    }
+    update();
+
+    /**
+     * @copydoc SoundBinding::isReady()
+     */
+    virtual bool
+    isReady() const;
+
+    /**
+     * @copydoc SoundBinding::sourceAssignmentChanged()
+     */
+    virtual void
+    sourceAssignmentChanged();
+
+    /**
+     * @copydoc SoundBinding::getDuration()
+     */
+    virtual float
+    getDuration() const;
 
   protected:
 
     /**
      * @brief The static sound samle used for binding.
-     * There's really no need to keep this around here, since the binding will occur in the constructor, but hey, someday we might provide some kind of dynamic unloading/reloading...
      */
     StaticSoundSample& mSample;
+
+    /**
+     * @brief True if the buffer of the sample has been bound to the source.
+     */
+    bool mIsBound;
+
+    /**
+     * @brief Binds the buffer to the source, if the sample is loaded and the source has an OpenAL source assigned.
+     */
+    void
+    bindBuffer();
+  };
+
+  /**
+   * @brief A sound sample which is streamed, rather than decoded into one buffer.
+   *
+   * This is suitable for long sounds such as ambient music, which would otherwise take up a lot of memory once decoded.
+   * The sample itself only holds the raw resource data; each binding created from it has its own ring of OpenAL buffers which is continously refilled as the sound plays. The decoding of new data into the buffers is done in a background thread.
+   * @note Only uncompressed wav data can currently be streamed.
+   */
+  class StreamedSoundSample : public BaseSoundSample
+  {
+  public:
+
+    /**
+     * @brief Ctor.
+     * The sample will be created in an unloaded state.
+     * @param service The service which owns the sample.
+     * @param path The path to the sound data within the resource system.
+     */
+    StreamedSoundSample(SoundService& service, const std::string& path);
+
+    /**
+     * @brief Dtor.
+     */
+    virtual
+    ~StreamedSoundSample();
+
+    /**
+     * @brief Since buffers are owned by each binding, this always returns 0.
+     */
+    virtual unsigned int
+    getNumberOfBuffers() const;
+
+    /**
+     * @brief Since buffers are owned by each binding, this always returns an empty store.
+     */
+    virtual BaseSoundSample::BufferStore
+    getBuffers() const;
+
+    /**
+     * @copydoc BaseSoundSample::createBinding()
+     */
+    virtual SoundBinding*
+    createBinding(SoundSource& source);
+
+    /**
+     * @copydoc BaseSoundSample::getMemoryUsage()
+     */
+    virtual size_t
+    getMemoryUsage() const;
+
+    /**
+     * @brief Gets the raw resource data.
+     * @return The resource, or null if the sample isn't loaded.
+     */
+    const ResourceWrapper*
+    getResource() const;
+
+  protected:
+
+    /**
+     * @copydoc BaseSoundSample::applyLoadedData()
+     */
+    virtual bool
+    applyLoadedData(SoundSampleLoadTask& task);
+
+    /**
+     * @copydoc BaseSoundSample::unload()
+     */
+    virtual void
+    unload();
+
+    /**
+     * @copydoc BaseSoundSample::needsDecoding()
+     */
+    virtual bool
+    needsDecoding() const;
+
+  private:
+
+    /**
+     * @brief The raw resource data.
+     * Each binding creates its own reader for the data, so it's safe to release this even while a stream is playing.
+     */
+    std::unique_ptr<ResourceWrapper> mResource;
+  };
+
+  /**
+   * @brief A binding for a streamed sound sample.
+   *
+   * The binding owns a ring of OpenAL buffers which are queued on the source. Each frame any buffers which OpenAL has played through are unqueued, refilled with already decoded data, and queued again.
+   * The decoding happens in a background thread, through an instance of SoundStreamDecodeTask, and is always kept a few chunks ahead of the playback.
+   */
+  class StreamedSoundBinding : public SoundBinding
+  {
+  public:
+
+    /**
+     * @brief The number of OpenAL buffers used for each stream.
+     */
+    static const unsigned int NUMBER_OF_BUFFERS = 4;
+
+    /**
+     * @brief The max size of each buffer, in bytes.
+     */
+    static const size_t BUFFER_SIZE = 65536;
+
+    /**
+     * @brief Ctor.
+     * @param source The sound source.
+     * @param sample The streamed sample to bind to the source.
+     */
+    StreamedSoundBinding(SoundSource& source, StreamedSoundSample& sample);
+
+    /**
+     * @brief Dtor.
+     * Any queued buffers will be unqueued and released.
+     */
+    virtual
+    ~StreamedSoundBinding();
+
+    /**
+     * @copydoc SoundBinding::update()
+     */
+    virtual void
+    update();
+
+    /**
+     * @copydoc SoundBinding::isReady()
+     */
+    virtual bool
+    isReady() const;
+
+    /**
+     * @copydoc SoundBinding::setIsPlaying()
+     */
+    virtual void
+    setIsPlaying(bool isPlaying);
+
+    /**
+     * @copydoc SoundBinding::sourceAssignmentChanged()
+     * Any data which was queued on the previous OpenAL source is lost, and the stream will continue from where the decoding left off.
+     */
+    virtual void
+    sourceAssignmentChanged();
+
+  protected:
+
+    /**
+     * @brief The streamed sample.
+     */
+    StreamedSoundSample& mSample;
+
+    /**
+     * @brief The OpenAL buffers used for the stream.
+     */
+    ALuint mBuffers[NUMBER_OF_BUFFERS];
+
+    /**
+     * @brief Buffers which aren't currently queued on the source.
+     */
+    std::vector<ALuint> mFreeBuffers;
+
+    /**
+     * @brief State shared with the background decoding tasks.
+     */
+    std::shared_ptr<SoundStreamState> mState;
+
+    /**
+     * @brief True once the initial buffers have been queued.
+     */
+    bool mIsStarted;
+
+    /**
+     * @brief True if the sound instance is supposed to be playing.
+     * This is used to tell a buffer underrun apart from the sound being stopped.
+     */
+    bool mIsPlaying;
+
+    /**
+     * @brief Fills any free buffers with decoded data and queues them.
+     */
+    void
+    queueFreeBuffers();
+
+    /**
+     * @brief Requests more data to be decoded, if needed.
+     */
+    void
+    requestDecoding();
   };
 
-/**
- * The class StreamedSoundSample is responsible to keep track of samples that often need updates and requires more than a buffer to stream data.
- *
- * \todo not implemented
- */
-// class StreamedSoundSample : public BaseSoundSample
-// {
-// 	private:
-// 		/**
-// 		 * Filename with full path to the data.
-// 		 */
-// 		std::string		mFilename;
-// 
-// 		/**
-// 		 * A pointer to the file specified in mFilename
-// 		 */
-// 		FILE*				mFile;
-// 
-// 		/**
-// 		 * VORBIS Internal Stream 
-// 		 */
-// 		OggVorbis_File mStream;
-// 
-// 		/**
-// 		 * Front and back buffers for openAl
-// 		 */
-// 		ALuint			mBuffers[2];
-// 
-// 		/**
-// 		 * Format of the stream (checked from ogg/vorbis)
-// 		 */
-// 		ALenum			mFormat;
-// 
-// 		/**
-// 		 * Rate of the stream (checked from ogg/vorbis)
-// 		 */
-// 		ALuint			mRate;
-// 
-// 		/**
-// 		 * If this stream is playing
-// 		 */
-// 		bool				mPlaying;
-// 
-// 		/**
-// 		 * This function is responsible to fill
-// 		 * buffers from stream data
-// 		 *
-// 		 * @param buffer The destination openAl buffer
-// 		 * @return Status of the streaming
-// 		 */
-// 		bool stream(ALuint buffer);
-// 
-// 	public:
-// 		StreamedSoundSample(const std::string& filename, bool playsLocal, float volume);
-// 		~StreamedSoundSample();
-// 
-// 		/**
-// 		 * Set the file to be used in stream proccess.
-// 		 *
-// 		 * @param ptr A pointer to the file.
-// 		 * @param filename The file name with full path.
-// 		 */
-// 		void setFile(FILE* ptr, const std::string& filename);
-// 
-// 		/**
-// 		 * Set stream format
-// 		 */
-// 		void setFormat(ALenum fmt);
-// 
-// 		/**
-// 		 * Set stream rate
-// 		 */
-// 		void setRate(ALuint rate);
-// 
-// 		/**
-// 		 * Set the stream status (if playing or not)
-// 		 */
-// 		void setPlaying(bool play);
-// 
-// 		/**
-// 		 * Returns a pointer to the buffers array
-// 		 */
-// 		ALuint*				getBufferPtr();
-// 
-// 		/**
-// 		 * Returns a pointer to the stream information (vorbis internals).
-// 		 */
-// 		OggVorbis_File*	getStreamPtr();
-// 
-// 		/**
-// 		 * Return the state of the stream.
-// 		 */
-// 		bool					isPlaying();
-// 
-// 		/**
-// 		 * Return the number of buffers in this stream. In this case this is 2.
-// 		 */
-// 		unsigned int		getNumberOfBuffers();
-// 
-// 		/**
-// 		 * Return the full filename of the stream file.
-// 		 */
-// 		const std::string& getFilename();
-// 
-// 		// Common methods
-// 		void play();	
-// 		void stop();
-// 		void cycle();				
-// };
 }// namespace Ember
 
 #endif
@@ -0,0 +1,142 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SoundSampleLoadTask.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <AL/alut.h>
+
+#include <cstdlib>
+#include <mutex>
+
+namespace Ember
+{
+
+namespace
+{
+/**
+ * @brief Serialises all calls into ALUT.
+ *
+ * ALUT isn't thread safe; among other things it keeps its error state in a global. Since the sound service loads samples on more than one thread the decoding must be done by one thread at a time.
+ */
+std::mutex sAlutMutex;
+}
+
+SoundSampleLoadTask::SoundSampleLoadTask(IResourceProvider& resourceProvider, const std::string& soundPath, unsigned int ticket, bool decode, sigc::slot<void, SoundSampleLoadTask&> callback) :
+		mResourceProvider(&resourceProvider), mSoundPath(soundPath), mTicket(ticket), mDecode(decode), mCallback(callback), mDecodedData(nullptr), mDecodedSize(0), mDecodedFormat(0), mDecodedFrequency(0), mSuccessful(false)
+{
+}
+
+SoundSampleLoadTask::SoundSampleLoadTask(const ResourceWrapper& resource, unsigned int ticket, bool decode, sigc::slot<void, SoundSampleLoadTask&> callback) :
+		mResourceProvider(nullptr), mSoundPath(resource.getName()), mTicket(ticket), mDecode(decode), mCallback(callback), mResource(new ResourceWrapper(resource)), mDecodedData(nullptr), mDecodedSize(0), mDecodedFormat(0), mDecodedFrequency(0), mSuccessful(false)
+{
+}
+
+SoundSampleLoadTask::~SoundSampleLoadTask()
+{
+	//The data is allocated by ALUT using malloc.
+	free(mDecodedData);
+}
+
+void SoundSampleLoadTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	if (mResourceProvider) {
+		try {
+			mResource.reset(new ResourceWrapper(mResourceProvider->getResource(mSoundPath)));
+		} catch (const std::exception& ex) {
+			S_LOG_FAILURE("Could not load sound resource '" << mSoundPath << "'." << ex);
+			return;
+		}
+	}
+	if (!mResource.get() || !mResource->hasData()) {
+		S_LOG_FAILURE("No data found for sound resource '" << mSoundPath << "'.");
+		return;
+	}
+
+	if (mDecode) {
+		ALfloat frequency = 0;
+		ALenum error = ALUT_ERROR_NO_ERROR;
+		{
+			std::unique_lock<std::mutex> l(sAlutMutex);
+			mDecodedData = alutLoadMemoryFromFileImage(mResource->getDataPtr(), mResource->getSize(), &mDecodedFormat, &mDecodedSize, &frequency);
+			if (!mDecodedData) {
+				error = alutGetError();
+			}
+		}
+		if (!mDecodedData) {
+			S_LOG_FAILURE("Could not decode sound resource '" << mSoundPath << "': " << alutGetErrorString(error));
+			return;
+		}
+		mDecodedFrequency = static_cast<ALsizei>(frequency);
+		//There's no need to keep the raw data around once it's been decoded.
+		mResource.reset();
+	}
+	mSuccessful = true;
+}
+
+void SoundSampleLoadTask::executeTaskInMainThread()
+{
+	mCallback(*this);
+}
+
+const std::string& SoundSampleLoadTask::getSoundPath() const
+{
+	return mSoundPath;
+}
+
+unsigned int SoundSampleLoadTask::getTicket() const
+{
+	return mTicket;
+}
+
+bool SoundSampleLoadTask::isSuccessful() const
+{
+	return mSuccessful;
+}
+
+const ResourceWrapper* SoundSampleLoadTask::getResource() const
+{
+	return mResource.get();
+}
+
+const ALvoid* SoundSampleLoadTask::getDecodedData() const
+{
+	return mDecodedData;
+}
+
+ALsizei SoundSampleLoadTask::getDecodedSize() const
+{
+	return mDecodedSize;
+}
+
+ALenum SoundSampleLoadTask::getDecodedFormat() const
+{
+	return mDecodedFormat;
+}
+
+ALsizei SoundSampleLoadTask::getDecodedFrequency() const
+{
+	return mDecodedFrequency;
+}
+
+}
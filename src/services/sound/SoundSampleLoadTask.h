@@ -0,0 +1,182 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef SOUNDSAMPLELOADTASK_H_
+#define SOUNDSAMPLELOADTASK_H_
+
+#include "framework/tasks/TemplateNamedTask.h"
+#include "framework/IResourceProvider.h"
+
+#include <sigc++/slot.h>
+
+#include <memory>
+#include <string>
+
+#ifdef __APPLE__
+#include <OpenAL/al.h>
+#elif defined(_MSC_VER)
+#include <al.h>
+#else
+#include <AL/al.h>
+#endif
+
+namespace Ember
+{
+
+/**
+ * @brief Loads, and optionally decodes, sound data in a background thread.
+ *
+ * If the resource provider is thread safe the resource is fetched in the background thread; otherwise the resource must be fetched beforehand and passed to the task.
+ * When decoding is requested the data is decoded into PCM data, which then can be copied into an OpenAL buffer in the main thread.
+ *
+ * Once done the callback will be called in the main thread.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class SoundSampleLoadTask : public Tasks::TemplateNamedTask<SoundSampleLoadTask>
+{
+public:
+
+	/**
+	 * @brief Ctor. Use this when the resource provider is thread safe.
+	 * @param resourceProvider The resource provider, which will be called in the background thread.
+	 * @param soundPath The path to the sound data.
+	 * @param ticket The load ticket of the sample.
+	 * @param decode Whether the data should be decoded.
+	 * @param callback Called in the main thread when the task is done.
+	 */
+	SoundSampleLoadTask(IResourceProvider& resourceProvider, const std::string& soundPath, unsigned int ticket, bool decode, sigc::slot<void, SoundSampleLoadTask&> callback);
+
+	/**
+	 * @brief Ctor. Use this when the resource already has been fetched.
+	 * @param resource The resource with the sound data.
+	 * @param ticket The load ticket of the sample.
+	 * @param decode Whether the data should be decoded.
+	 * @param callback Called in the main thread when the task is done.
+	 */
+	SoundSampleLoadTask(const ResourceWrapper& resource, unsigned int ticket, bool decode, sigc::slot<void, SoundSampleLoadTask&> callback);
+
+	virtual ~SoundSampleLoadTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+	/**
+	 * @brief Gets the path to the sound data.
+	 */
+	const std::string& getSoundPath() const;
+
+	/**
+	 * @brief Gets the load ticket which was supplied when the task was created.
+	 */
+	unsigned int getTicket() const;
+
+	/**
+	 * @brief Returns true if the data could be loaded (and decoded, if so requested).
+	 */
+	bool isSuccessful() const;
+
+	/**
+	 * @brief Gets the loaded resource.
+	 * @return The resource, or null if it couldn't be loaded.
+	 */
+	const ResourceWrapper* getResource() const;
+
+	/**
+	 * @brief Gets the decoded PCM data.
+	 * @return The decoded data, or null if no data was decoded.
+	 */
+	const ALvoid* getDecodedData() const;
+
+	/**
+	 * @brief Gets the size of the decoded data, in bytes.
+	 */
+	ALsizei getDecodedSize() const;
+
+	/**
+	 * @brief Gets the OpenAL format of the decoded data.
+	 */
+	ALenum getDecodedFormat() const;
+
+	/**
+	 * @brief Gets the frequency of the decoded data.
+	 */
+	ALsizei getDecodedFrequency() const;
+
+private:
+
+	/**
+	 * @brief The resource provider, if the resource should be fetched in the background thread.
+	 */
+	IResourceProvider* mResourceProvider;
+
+	/**
+	 * @brief The path to the sound data.
+	 */
+	std::string mSoundPath;
+
+	/**
+	 * @brief The load ticket of the sample.
+	 */
+	unsigned int mTicket;
+
+	/**
+	 * @brief Whether the data should be decoded.
+	 */
+	bool mDecode;
+
+	/**
+	 * @brief Called in the main thread when the task is done.
+	 */
+	sigc::slot<void, SoundSampleLoadTask&> mCallback;
+
+	/**
+	 * @brief The loaded resource.
+	 */
+	std::unique_ptr<ResourceWrapper> mResource;
+
+	/**
+	 * @brief The decoded data, as allocated by ALUT.
+	 */
+	ALvoid* mDecodedData;
+
+	/**
+	 * @brief The size of the decoded data.
+	 */
+	ALsizei mDecodedSize;
+
+	/**
+	 * @brief The OpenAL format of the decoded data.
+	 */
+	ALenum mDecodedFormat;
+
+	/**
+	 * @brief The frequency of the decoded data.
+	 */
+	ALsizei mDecodedFrequency;
+
+	/**
+	 * @brief True if the task was successful.
+	 */
+	bool mSuccessful;
+};
+
+}
+
+#endif /* SOUNDSAMPLELOADTASK_H_ */
@@ -29,6 +29,10 @@
 
 #include "SoundSample.h"
 #include "SoundInstance.h"
+#include "SoundSource.h"
+#include "SoundSampleLoadTask.h"
+
+#include "framework/tasks/TaskQueue.h"
 
 #include <map>
 #include <cstring>
@@ -52,7 +56,8 @@ namespace Ember
   :
       mResourceProvider(0)
 #endif
-          , mEnabled(false)
+          , mEnabled(false), mSampleMemoryBudget(64 * 1024 * 1024), mSampleUsageCounter(
+          0), mLoadTicketCounter(0), mListenerPosition(0, 0, 0)
   {
     setName("Sound Service");
     setDescription(
@@ -111,6 +116,29 @@ namespace Ember
 #endif
 
             SoundGeneral::checkAlError();
+
+            if (EmberServices::getSingleton().getConfigService().hasItem(
+                "audio", "samplememorybudget"))
+              {
+                int budgetInMegabytes =
+                    static_cast<int>(EmberServices::getSingleton().getConfigService().getValue(
+                        "audio", "samplememorybudget"));
+                mSampleMemoryBudget = budgetInMegabytes * 1024 * 1024;
+              }
+            //Use two executors, so that streams can be refilled even when a large sample is being decoded.
+            mTaskQueue.reset(new Tasks::TaskQueue(2));
+
+            unsigned int maxSources = 32;
+            if (EmberServices::getSingleton().getConfigService().hasItem(
+                "audio", "maxsources"))
+              {
+                maxSources =
+                    static_cast<int>(EmberServices::getSingleton().getConfigService().getValue(
+                        "audio", "maxsources"));
+              }
+            createSourcePool(maxSources);
+            mLastCycleTime =
+                boost::posix_time::microsec_clock::universal_time();
           }
       }
 
@@ -122,6 +150,9 @@ namespace Ember
   void
   SoundService::stop(int code)
   {
+    //Destroying the queue will wait for all background tasks to complete, so this must be done before any samples are destroyed.
+    mTaskQueue.reset();
+
     for (SoundInstanceStore::iterator I = mInstances.begin();
         I != mInstances.end(); ++I)
       {
@@ -131,6 +162,20 @@ namespace Ember
       }
     mInstances.clear();
 
+    if (!mSourcePool.empty())
+      {
+        for (std::vector<ALuint>::const_iterator I = mSourcePool.begin();
+            I != mSourcePool.end(); ++I)
+          {
+            alSourceStop(*I);
+            alSourcei(*I, AL_BUFFER, 0);
+          }
+        alDeleteSources(mSourcePool.size(), &mSourcePool[0]);
+        SoundGeneral::checkAlError("Deleting pooled sound sources.");
+      }
+    mSourcePool.clear();
+    mFreeSources.clear();
+
     for (SoundSampleStore::iterator I = mBaseSamples.begin();
         I != mBaseSamples.end(); ++I)
       {
@@ -167,45 +212,240 @@ namespace Ember
   }
 
   void
-  SoundService::registerStream(StreamedSoundSample* copy)
+  SoundService::createSourcePool(unsigned int maxSources)
   {
-    /*		#ifdef THREAD_SAFE
-     pthread_mutex_lock(&mSamplesMutex);
-     #endif
+    //Allocate the sources one at a time, since the sound system might not be able to provide as many as we ask for.
+    for (unsigned int i = 0; i < maxSources; ++i)
+      {
+        alGetError();
+        ALuint alSource;
+        alGenSources(1, &alSource);
+        if (alGetError() != AL_NO_ERROR)
+          {
+            break;
+          }
+        mSourcePool.push_back(alSource);
+      }
+    mFreeSources = mSourcePool;
+    S_LOG_INFO(
+        "Allocated " << mSourcePool.size() << " sound sources (" << maxSources << " requested).");
+  }
 
-     mSamples.push_back(copy);
+  void
+  SoundService::recycleSource(ALuint alSource)
+  {
+    alSourceStop(alSource);
+    alSourcei(alSource, AL_BUFFER, 0);
+    SoundGeneral::checkAlError("Recycling sound source.");
+    mFreeSources.push_back(alSource);
+  }
 
-     #ifdef THREAD_SAFE
-     pthread_mutex_unlock(&mSamplesMutex);
-     #endif*/
+  size_t
+  SoundService::getNumberOfRealInstances() const
+  {
+    return mSourcePool.size() - mFreeSources.size();
   }
 
-  bool
-  SoundService::unregisterStream(const StreamedSoundSample* sample)
+  void
+  SoundService::assignSources()
   {
-// 		#ifdef THREAD_SAFE
-// 		pthread_mutex_lock(&mSamplesMutex);
-// 		#endif
-// 	
-// 		std::list<StreamedSoundSample*>::iterator it;
-// 		for (it = mSamples.begin(); it != mSamples.end(); )
-// 		{
-// 			if ((*it) == sample)
-// 			{
-// 				it = mSamples.erase(it);
-// 				return true;
-// 			}
-// 			else
-// 			{
-// 				++it;
-// 			}
-// 		}
-// 
-// 		#ifdef THREAD_SAFE
-// 		pthread_mutex_unlock(&mSamplesMutex);
-// 		#endif
+    //Any sound quieter than this is considered inaudible, and won't be given a source.
+    static const float AUDIBILITY_THRESHOLD = 0.001f;
 
-    return false;
+    std::vector<SoundInstance*> candidates;
+    candidates.reserve(mInstances.size());
+    for (SoundInstanceStore::const_iterator I = mInstances.begin();
+        I != mInstances.end(); ++I)
+      {
+        SoundInstance* instance = *I;
+        instance->updateMotion();
+        if (instance->isPlaying())
+          {
+            instance->mAudibility = instance->getSource().calculateAudibility(
+                mListenerPosition);
+            if (instance->mAudibility >= AUDIBILITY_THRESHOLD)
+              {
+                candidates.push_back(instance);
+              }
+          }
+      }
+
+    //Only the most audible instances should get a source, so we just need to find those, not sort all of them.
+    size_t numberOfReal = std::min(candidates.size(), mSourcePool.size());
+    std::nth_element(candidates.begin(), candidates.begin() + numberOfReal,
+        candidates.end(), [](const SoundInstance* lhs, const SoundInstance* rhs)
+          {
+            if (lhs->mPriority != rhs->mPriority)
+              {
+                return lhs->mPriority > rhs->mPriority;
+              }
+            return lhs->mAudibility > rhs->mAudibility;
+          });
+    std::vector<SoundInstance*> selected(candidates.begin(),
+        candidates.begin() + numberOfReal);
+    std::sort(selected.begin(), selected.end());
+
+    //First release the sources of all instances which no longer should have them, so that they can be handed out.
+    for (SoundInstanceStore::const_iterator I = mInstances.begin();
+        I != mInstances.end(); ++I)
+      {
+        SoundInstance* instance = *I;
+        if (!instance->getSource().isVirtual()
+            && !std::binary_search(selected.begin(), selected.end(), instance))
+          {
+            recycleSource(instance->releaseALSource());
+          }
+      }
+    for (std::vector<SoundInstance*>::const_iterator I = selected.begin();
+        I != selected.end() && !mFreeSources.empty(); ++I)
+      {
+        SoundInstance* instance = *I;
+        if (instance->getSource().isVirtual())
+          {
+            instance->assignALSource(mFreeSources.back());
+            mFreeSources.pop_back();
+          }
+      }
+  }
+
+  void
+  SoundService::markSampleUsed(BaseSoundSample& sample)
+  {
+    sample.mLastUsed = ++mSampleUsageCounter;
+    if (sample.getLoadingState() == BaseSoundSample::LS_UNLOADED)
+      {
+        loadSample(sample);
+      }
+  }
+
+  void
+  SoundService::enqueueTask(Tasks::ITask* task)
+  {
+    if (mTaskQueue.get())
+      {
+        mTaskQueue->enqueueTask(task);
+      }
+    else
+      {
+        S_LOG_WARNING(
+            "Tried to enqueue a sound task while the sound service isn't running.");
+        delete task;
+      }
+  }
+
+  void
+  SoundService::loadSample(BaseSoundSample& sample)
+  {
+    if (!mResourceProvider || !mTaskQueue.get())
+      {
+        return;
+      }
+    sample.mLoadingState = BaseSoundSample::LS_LOADING;
+    sample.mLoadTicket = ++mLoadTicketCounter;
+    sigc::slot<void, SoundSampleLoadTask&> callback = sigc::mem_fun(*this,
+        &SoundService::sampleLoadTask_Completed);
+
+    if (mResourceProvider->isThreadSafe())
+      {
+        mTaskQueue->enqueueTask(
+            new SoundSampleLoadTask(*mResourceProvider, sample.getPath(),
+                sample.mLoadTicket, sample.needsDecoding(), callback));
+      }
+    else
+      {
+        //The resource provider can't be used from a background thread, so we need to fetch the raw data here. The decoding will still happen in the background.
+        try
+          {
+            ResourceWrapper resWrapper = mResourceProvider->getResource(
+                sample.getPath());
+            mTaskQueue->enqueueTask(
+                new SoundSampleLoadTask(resWrapper, sample.mLoadTicket,
+                    sample.needsDecoding(), callback));
+          }
+        catch (const std::exception& ex)
+          {
+            S_LOG_FAILURE(
+                "Could not load sound resource '" << sample.getPath() << "'." << ex);
+            sample.mLoadingState = BaseSoundSample::LS_FAILED;
+          }
+      }
+  }
+
+  void
+  SoundService::sampleLoadTask_Completed(SoundSampleLoadTask& task)
+  {
+    SoundSampleStore::iterator I = mBaseSamples.find(task.getSoundPath());
+    if (I == mBaseSamples.end())
+      {
+        //The sample has been destroyed while loading.
+        return;
+      }
+    BaseSoundSample* sample = I->second;
+    if (sample->mLoadTicket != task.getTicket()
+        || sample->getLoadingState() != BaseSoundSample::LS_LOADING)
+      {
+        //A stale load request.
+        return;
+      }
+    if (task.isSuccessful() && sample->applyLoadedData(task))
+      {
+        sample->mLoadingState = BaseSoundSample::LS_LOADED;
+        S_LOG_VERBOSE(
+            "Loaded sound sample '" << sample->getPath() << "' (" << sample->getMemoryUsage() << " bytes).");
+        sample->EventLoaded.emit();
+      }
+    else
+      {
+        sample->mLoadingState = BaseSoundSample::LS_FAILED;
+      }
+  }
+
+  size_t
+  SoundService::getSampleMemoryUsage() const
+  {
+    size_t usage = 0;
+    for (SoundSampleStore::const_iterator I = mBaseSamples.begin();
+        I != mBaseSamples.end(); ++I)
+      {
+        usage += I->second->getMemoryUsage();
+      }
+    return usage;
+  }
+
+  void
+  SoundService::enforceSampleMemoryBudget()
+  {
+    size_t usage = getSampleMemoryUsage();
+    if (usage <= mSampleMemoryBudget)
+      {
+        return;
+      }
+
+    std::vector<BaseSoundSample*> candidates;
+    for (SoundSampleStore::const_iterator I = mBaseSamples.begin();
+        I != mBaseSamples.end(); ++I)
+      {
+        BaseSoundSample* sample = I->second;
+        if (sample->getUserCount() == 0 && sample->isLoaded())
+          {
+            candidates.push_back(sample);
+          }
+      }
+    std::sort(candidates.begin(), candidates.end(),
+        [](const BaseSoundSample* lhs, const BaseSoundSample* rhs)
+          { return lhs->mLastUsed < rhs->mLastUsed;});
+
+    for (std::vector<BaseSoundSample*>::const_iterator I = candidates.begin();
+        I != candidates.end() && usage > mSampleMemoryBudget; ++I)
+      {
+        BaseSoundSample* sample = *I;
+        size_t sampleUsage = sample->getMemoryUsage();
+        S_LOG_VERBOSE(
+            "Unloading sound sample '" << sample->getPath() << "' to stay within the sample memory budget.");
+        sample->unload();
+        sample->mLoadingState = BaseSoundSample::LS_UNLOADED;
+        usage -= std::min(usage, sampleUsage);
+      }
   }
 
   void
@@ -217,6 +457,7 @@ namespace Ember
         return;
       }
 
+    mListenerPosition = pos;
     alListener3f(AL_POSITION, pos.x(), pos.y(), pos.z());
     SoundGeneral::checkAlError("Setting the listener position.");
 
@@ -237,6 +478,19 @@ namespace Ember
   void
   SoundService::cycle()
   {
+    boost::posix_time::ptime now =
+        boost::posix_time::microsec_clock::universal_time();
+    float timeSlice = (now - mLastCycleTime).total_microseconds() / 1000000.0f;
+    mLastCycleTime = now;
+
+    if (mTaskQueue.get())
+      {
+        mTaskQueue->pollProcessedTasks(
+            TimeFrame(boost::posix_time::milliseconds(2)));
+      }
+
+    assignSources();
+
     for (SoundInstanceStore::iterator I = mInstances.begin();
         I != mInstances.end();)
       {
@@ -244,29 +498,43 @@ namespace Ember
         //A typical example would be a sound instance that has played to its completion and thus should be destroyed. The signal for this is emitted as a result of calling SoundInstance::update().
         SoundInstance* instance(*I);
         ++I;
-        instance->update();
+        if (!instance->getSource().isVirtual())
+          {
+            instance->update();
+          }
+        else if (instance->isPlaying())
+          {
+            instance->updateVirtual(timeSlice);
+          }
       }
+    enforceSampleMemoryBudget();
   }
 
   BaseSoundSample*
-  SoundService::createOrRetrieveSoundSample(const std::string& soundPath)
+  SoundService::createOrRetrieveSoundSample(const std::string& soundPath,
+      bool streamed)
   {
     SoundSampleStore::iterator I = mBaseSamples.find(soundPath);
     if (I != mBaseSamples.end())
       {
+        markSampleUsed(*I->second);
         return I->second;
       }
     if (mResourceProvider)
       {
-        ResourceWrapper resWrapper = mResourceProvider->getResource(soundPath);
-        if (resWrapper.hasData())
+        BaseSoundSample* sample;
+        if (streamed)
+          {
+            sample = new StreamedSoundSample(*this, soundPath);
+          }
+        else
           {
-            StaticSoundSample* sample = new StaticSoundSample(resWrapper, false,
-                1.0);
-            mBaseSamples.insert(
-                SoundSampleStore::value_type(soundPath, sample));
-            return sample;
+            sample = new StaticSoundSample(*this, soundPath);
           }
+        mBaseSamples.insert(SoundSampleStore::value_type(soundPath, sample));
+        //This will start loading the sample in the background.
+        markSampleUsed(*sample);
+        return sample;
       }
     return 0;
   }
@@ -304,7 +572,12 @@ namespace Ember
     if (I != mInstances.end())
       {
         mInstances.erase(I);
+        ALuint alSource = instance->getSource().getALSource();
         delete instance;
+        if (alSource)
+          {
+            recycleSource(alSource);
+          }
         return true;
       }
     return false;
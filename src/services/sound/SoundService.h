@@ -27,15 +27,30 @@
 #include <wfmath/quaternion.h>
 #include <wfmath/point.h>
 
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
 #include <list>
+#include <vector>
 #include <unordered_map>
-#ifdef _MSC_VER
+#include <memory>
+#ifdef __APPLE__
+#include <OpenAL/al.h>
+#elif defined(_MSC_VER)
+#include <al.h>
 #include <alc.h>
+#else
+#include <AL/al.h>
 #endif
 namespace Ember {
 
+namespace Tasks
+{
+class TaskQueue;
+class ITask;
+}
 class IResourceProvider;
 class StreamedSoundSample;
+class SoundSampleLoadTask;
 class SoundInstance;
 class SoundGroup;
 class BaseSoundSample;
@@ -44,6 +59,9 @@ class BaseSoundSample;
  * @brief A service responsible for playing and managing sounds.
  * In normal operations, the only way to play a sound is to first request a new instance of SoundInstance throug createInstance(), binding that instance to one or many sound samples and then asking the SoundInstance to start playing. Once the SoundInstance is done playing it should be returned through destroyInstance(). Since it's expected that not too many sounds should be playing at one time it's not expected to be too many live instances of SoundInstance at any time.
  * Before you can start requesting sound instances and binding them to samples you must however set up the service. The first thing that needs to be set up is a resource provider through the IResourceProvider interface. The resource provider is responsible for providing any resource when so asked, and is the main interface into the actual sound data.
+ * Sound samples are loaded and decoded in background threads, and the memory used by them is kept within a budget (set through the "audio:samplememorybudget" config setting, in megabytes) by unloading the least recently used samples which aren't currently in use.
+ *
+ * Since most sound hardware only supports a limited number of simultaneous voices, the OpenAL sources are pooled. A fixed number of sources (set through the "audio:maxsources" config setting) is allocated when the service starts, and each frame these are handed out to the playing instances with the highest priority and audibility. The remaining playing instances are "virtual"; they keep track of their playback position without using any OpenAL resources, and will resume at the correct position if they become audible again.
  * @author Romulo Fernandes Machado (nightz)
  * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
  */
@@ -85,11 +103,12 @@ public:
 	/**
 	 * @brief Attempts to retrieve, or create if not already existing, the sound sample with the supplied identifier.
 	 * Each sound sample is identified through the path to it, within the Ember resource system. This method will first look within the already allocated sound samples, and if the sought after sound sample is found there it will be returned.
-	 * If not, it will try to create a new sound sample and return it. If no sound sample could be created (for example if no resource could be found) a null ref will be returned.
+	 * If not, it will create a new sound sample and return it. The sound data will be loaded in a background thread; connect to BaseSoundSample::EventLoaded if you need to know when it's ready. If no resource provider is set a null ref will be returned.
 	 * @param soundPath The path to the sound data within the resource system.
+	 * @param streamed If true, the sample will be streamed rather than decoded into one buffer. This is suitable for long sounds such as music. Has no effect if the sample already exists.
 	 * @return A sound sample, or null if none could be created.
 	 */
-	BaseSoundSample* createOrRetrieveSoundSample(const std::string& soundPath);
+	BaseSoundSample* createOrRetrieveSoundSample(const std::string& soundPath, bool streamed = false);
 	
 	/**
 	 * @brief Destroys the specified sound sample.
@@ -102,18 +121,24 @@ public:
 	bool destroySoundSample(const std::string& soundPath);
 
 	/**
-	 * Register individual StreamedSamples to keep updated on the cycle calls
-	 * @param copy The StreamedSoundSample to be registered
+	 * @brief Marks the sample as being used.
+	 * This is called by the samples themselves whenever they get a new user. If the sample isn't loaded, loading will be started.
+	 * @param sample The sample.
 	 */
-	void registerStream(StreamedSoundSample* copy);
+	void markSampleUsed(BaseSoundSample& sample);
 
 	/**
-	 * Unregister streamed allocate sound buffers.
-	 * This will only remove it from the service list it will not deallocate the data.
-	 * @param sample A pointer to the sample to be unregistered
-	 * @return The status of the unregistration.
+	 * @brief Enqueues a task to be executed by the background threads of the sound service.
+	 * This is used for loading and streaming sound data.
+	 * @param task The task. Ownership will be transferred.
 	 */
-	bool unregisterStream(const StreamedSoundSample* sample);
+	void enqueueTask(Tasks::ITask* task);
+
+	/**
+	 * @brief Gets the amount of memory used by all loaded samples.
+	 * @return The memory used, in bytes.
+	 */
+	size_t getSampleMemoryUsage() const;
 
 	/**
 	 * @brief Update the position (in world coordinates) of the listener
@@ -126,6 +151,8 @@ public:
 	/**
 	 * @brief Call this each frame to update the sound samples.
 	 * Through a call of this all registered and active SoundInstance instances will be asked to update themselves. Such an update could involve updating streaming buffers in the case of a streaming sound, or update the position of the sound if it's positioned within the 3d world.
+	 * Any samples which have been loaded in the background will also be handled here, and samples will be unloaded if the memory budget is exceeded.
+	 * The pooled OpenAL sources will also be redistributed among the playing instances here.
 	 */
 	void cycle();
 	
@@ -133,7 +160,7 @@ public:
 	/**
 	 * @brief Creates a new SoundInstance.
 	 * Every time you want to play a sound you must create a SoundInstance and use that to play it. The only way to (normally) create such an instance is through this method. The sound service will keep track of all SoundInstance instances that are created, and will call SoundInstance::update() each frame, granted that SoundService::cycle() is called.
-	 * Ownership of the SoundInstance is held by the sound service, and as soon as you're finished with it you should immediately return it to the sound service through destroyInstance(). Under normal operations it's expected that there will only be a few SoundInstances in play at once.
+	 * Ownership of the SoundInstance is held by the sound service, and as soon as you're finished with it you should immediately return it to the sound service through destroyInstance(). Since OpenAL sources are pooled there can be more live instances than there are sources; the instance will be virtual until it's assigned a source.
 	 * @note If the sound system is disabled this will always return null, so make sure to check what you receive when calling this.
 	 * @return A new SoundInstance instance, or null if no instance could be created or the sound system is disabled. Before you can play it, through SoundInstance::play(), you must bind it to a SoundSample.
 	 */
@@ -167,6 +194,12 @@ public:
 	 */
 	bool isEnabled() const;
 
+	/**
+	 * @brief Gets the number of instances which currently have an OpenAL source assigned.
+	 * @return The number of real, as opposed to virtual, instances.
+	 */
+	size_t getNumberOfRealInstances() const;
+
 private:
 	
 	/**
@@ -175,6 +208,11 @@ private:
 	 */
 	SoundSampleStore mBaseSamples;
 
+	/**
+	 * @brief The queue used for loading and streaming sound data in background threads.
+	 */
+	std::unique_ptr<Tasks::TaskQueue> mTaskQueue;
+
 	#ifdef _MSC_VER
 	/**
 	 * @brief The main OpenAL context.
@@ -204,6 +242,75 @@ private:
 	 * @see isEnabled()
 	 */
 	bool mEnabled;
+
+	/**
+	 * @brief The max amount of memory, in bytes, that unused samples are allowed to take up before they are unloaded.
+	 */
+	size_t mSampleMemoryBudget;
+
+	/**
+	 * @brief A counter incremented each time a sample is used, providing the stamps used for finding the least recently used samples.
+	 */
+	unsigned long mSampleUsageCounter;
+
+	/**
+	 * @brief A counter used for giving each load request a unique ticket.
+	 */
+	unsigned int mLoadTicketCounter;
+
+	/**
+	 * @brief All OpenAL sources allocated by the service.
+	 */
+	std::vector<ALuint> mSourcePool;
+
+	/**
+	 * @brief The OpenAL sources which currently aren't assigned to any instance.
+	 */
+	std::vector<ALuint> mFreeSources;
+
+	/**
+	 * @brief The last known position of the listener, used for calculating the audibility of instances.
+	 */
+	WFMath::Point<3> mListenerPosition;
+
+	/**
+	 * @brief The time of the last call to cycle(), used for advancing virtual instances.
+	 */
+	boost::posix_time::ptime mLastCycleTime;
+
+	/**
+	 * @brief Allocates the pool of OpenAL sources.
+	 * @param maxSources The max number of sources to allocate. Fewer might be allocated if the sound system can't provide that many.
+	 */
+	void createSourcePool(unsigned int maxSources);
+
+	/**
+	 * @brief Hands out the pooled OpenAL sources to the playing instances which are most audible.
+	 */
+	void assignSources();
+
+	/**
+	 * @brief Returns an OpenAL source to the pool of free sources.
+	 * @param alSource The source.
+	 */
+	void recycleSource(ALuint alSource);
+
+	/**
+	 * @brief Starts loading the sample in a background thread.
+	 * @param sample The sample to load.
+	 */
+	void loadSample(BaseSoundSample& sample);
+
+	/**
+	 * @brief Called in the main thread when a sample load task has completed.
+	 * @param task The completed task.
+	 */
+	void sampleLoadTask_Completed(SoundSampleLoadTask& task);
+
+	/**
+	 * @brief Unloads the least recently used samples which aren't in use, until the memory used is within the budget.
+	 */
+	void enforceSampleMemoryBudget();
 }; //SoundService
 
 } // namespace Ember
@@ -30,58 +30,75 @@
 #include "SoundGeneral.h"
 
 #include "framework/LoggingInstance.h"
-#include "framework/Exception.h"
 
 #include <cassert>
+#include <limits>
+#include <algorithm>
 
 namespace Ember
 {
 
   SoundSource::SoundSource() :
-      mALSource(0)
+      mALSource(0), mPosition(0, 0, 0), mVelocity(0, 0, 0), mGain(1.0f), mMaxDistance(
+          std::numeric_limits<float>::max()), mIsLooping(true), mIsStreaming(
+          false)
   {
-    alGetError();
-    // Bind the buffer with the source.
-    alGenSources(1, &mALSource);
-    if (!SoundGeneral::checkAlError("Creating new sound source."))
-      {
-        alDeleteSources(1, &mALSource);
-        throw Exception("Failed to generate a new sound source.");
-      }
+  }
+
+  SoundSource::~SoundSource()
+  {
+  }
 
+  void
+  SoundSource::assignALSource(ALuint alSource)
+  {
+    mALSource = alSource;
+    alGetError();
     alSourcef(mALSource, AL_PITCH, 1.0f);
     SoundGeneral::checkAlError("Setting sound source pitch.");
-    alSourcef(mALSource, AL_GAIN, 1.0f);
+    alSourcef(mALSource, AL_GAIN, mGain);
     SoundGeneral::checkAlError("Setting sound source gain.");
-    alSource3f(mALSource, AL_POSITION, 0, 0, 0);
+    alSourcef(mALSource, AL_MAX_DISTANCE, mMaxDistance);
+    SoundGeneral::checkAlError("Setting sound source max distance.");
+    alSource3f(mALSource, AL_POSITION, mPosition.x(), mPosition.y(),
+        mPosition.z());
     SoundGeneral::checkAlError("Setting sound source position.");
-    alSource3f(mALSource, AL_VELOCITY, 0, 0, 0);
+    alSource3f(mALSource, AL_VELOCITY, mVelocity.x(), mVelocity.y(),
+        mVelocity.z());
     SoundGeneral::checkAlError("Setting sound source velocity.");
-    alSourcei(mALSource, AL_LOOPING, true);
-    SoundGeneral::checkAlError("Setting sound source looping.");
-
+    applyLooping();
   }
 
-  SoundSource::~SoundSource()
+  ALuint
+  SoundSource::releaseALSource()
   {
-    alDeleteSources(1, &mALSource);
-    SoundGeneral::checkAlError("Deleting sound source.");
+    ALuint alSource = mALSource;
+    mALSource = 0;
+    return alSource;
   }
 
   void
   SoundSource::setPosition(const WFMath::Point<3>& pos)
   {
     assert(pos.isValid());
-    alSource3f(mALSource, AL_POSITION, pos.x(), pos.y(), pos.z());
-    SoundGeneral::checkAlError("Setting sound source position.");
+    mPosition = pos;
+    if (mALSource)
+      {
+        alSource3f(mALSource, AL_POSITION, pos.x(), pos.y(), pos.z());
+        SoundGeneral::checkAlError("Setting sound source position.");
+      }
   }
 
   void
   SoundSource::setVelocity(const WFMath::Vector<3>& vel)
   {
     assert(vel.isValid());
-    alSource3f(mALSource, AL_VELOCITY, vel.x(), vel.y(), vel.z());
-    SoundGeneral::checkAlError("Setting sound source velocity.");
+    mVelocity = vel;
+    if (mALSource)
+      {
+        alSource3f(mALSource, AL_VELOCITY, vel.x(), vel.y(), vel.z());
+        SoundGeneral::checkAlError("Setting sound source velocity.");
+      }
   }
 
   void
@@ -90,4 +107,63 @@ namespace Ember
     //TODO: implement this
   }
 
+  void
+  SoundSource::setGain(float gain)
+  {
+    mGain = gain;
+    if (mALSource)
+      {
+        alSourcef(mALSource, AL_GAIN, gain);
+        SoundGeneral::checkAlError("Setting sound source gain.");
+      }
+  }
+
+  void
+  SoundSource::setIsLooping(bool isLooping)
+  {
+    mIsLooping = isLooping;
+    applyLooping();
+  }
+
+  void
+  SoundSource::setMaxDistance(float maxDistance)
+  {
+    mMaxDistance = maxDistance;
+    if (mALSource)
+      {
+        alSourcef(mALSource, AL_MAX_DISTANCE, maxDistance);
+        SoundGeneral::checkAlError("Setting max distance.");
+      }
+  }
+
+  void
+  SoundSource::setIsStreaming(bool isStreaming)
+  {
+    mIsStreaming = isStreaming;
+    applyLooping();
+  }
+
+  void
+  SoundSource::applyLooping()
+  {
+    if (mALSource)
+      {
+        alSourcei(mALSource, AL_LOOPING,
+            (mIsLooping && !mIsStreaming) ? AL_TRUE : AL_FALSE);
+        SoundGeneral::checkAlError("Setting looping status.");
+      }
+  }
+
+  float
+  SoundSource::calculateAudibility(
+      const WFMath::Point<3>& listenerPosition) const
+  {
+    //This uses the same calculation as the default AL_INVERSE_DISTANCE_CLAMPED model, with a reference distance and rolloff factor of 1.
+    const float referenceDistance = 1.0f;
+    float distance = WFMath::Distance(mPosition, listenerPosition);
+    distance = std::max(referenceDistance, std::min(distance, mMaxDistance));
+    return mGain * referenceDistance
+        / (referenceDistance + (distance - referenceDistance));
+  }
+
 }
@@ -40,7 +40,8 @@ namespace Ember {
 
 /**
  * @brief Represents a sound source in the 3d world.
- * An instance of this class mainly envelopes an OpenAL soundsource, allocating it when it's created and removing it at destruction time.
+ * An instance of this class holds the state of a "voice": its position, velocity, gain and so on. In order to be heard it must also be bound to an OpenAL source.
+ * Since there's a limited number of OpenAL sources available, these are kept in a pool by the SoundService and handed out only to the most audible sound instances. A source without any OpenAL source is "virtual"; its state is kept, and will be applied to the OpenAL source once one is assigned.
  * @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
  */
 class SoundSource
@@ -50,7 +51,7 @@ public:
 	
 	/**
 	 * @brief Dtor.
-	 * When an instance is destroyed the OpenAL sound source will be released as well.
+	 * The OpenAL source isn't owned by this instance, and won't be released.
 	 */
 	virtual ~SoundSource();
 	
@@ -59,6 +60,12 @@ public:
 	 * @param position The position, in world units.
 	 */
 	void setPosition(const WFMath::Point<3>& position);
+
+	/**
+	 * @brief Gets the position of the sound source.
+	 * @return The position, in world units.
+	 */
+	const WFMath::Point<3>& getPosition() const;
 	
 	/**
 	 * @brief Sets the orientation of the sound source.
@@ -71,28 +78,133 @@ public:
 	 * @param velocity The velocity, in world units.
 	 */
 	void setVelocity(const WFMath::Vector<3>& velocity);
+
+	/**
+	 * @brief Sets the gain of the sound source.
+	 * @param gain The gain, where 1.0 is unattenuated.
+	 */
+	void setGain(float gain);
+
+	/**
+	 * @brief Gets the gain of the sound source.
+	 * @return The gain.
+	 */
+	float getGain() const;
+
+	/**
+	 * @brief Sets whether the sound should loop.
+	 * @param isLooping True if the sound should loop.
+	 */
+	void setIsLooping(bool isLooping);
+
+	/**
+	 * @brief Gets whether the sound should loop.
+	 * @return True if the sound should loop.
+	 */
+	bool getIsLooping() const;
+
+	/**
+	 * @brief Sets the max distance of the sound source.
+	 * Beyond this distance the sound won't be attenuated any further.
+	 * @param maxDistance The max distance, in world units.
+	 */
+	void setMaxDistance(float maxDistance);
+
+	/**
+	 * @brief Gets the max distance of the sound source.
+	 * @return The max distance, in world units.
+	 */
+	float getMaxDistance() const;
+
+	/**
+	 * @brief Sets whether the source is used for streaming.
+	 * A streaming source handles looping by rewinding the stream, and must therefore never have looping enabled in OpenAL.
+	 * @param isStreaming True if the source is used for streaming.
+	 */
+	void setIsStreaming(bool isStreaming);
+
+	/**
+	 * @brief Calculates how loud the source would be heard from the listener position.
+	 * This mirrors the inverse clamped distance model used by OpenAL, and is used for deciding which sources should be bound to OpenAL sources.
+	 * @param listenerPosition The position of the listener.
+	 * @return The gain as heard by the listener.
+	 */
+	float calculateAudibility(const WFMath::Point<3>& listenerPosition) const;
 	
 	/**
 	* @brief Return openAl source within this sample
-	* @return The identifier of the source
+	* @return The identifier of the source, or 0 if the source is virtual.
 	*/
 	ALuint getALSource() const;
+
+	/**
+	 * @brief Returns true if the source isn't bound to any OpenAL source.
+	 * @return True if the source is virtual.
+	 */
+	bool isVirtual() const;
 	
 protected:
 
 	/**
 	* @brief Ctor.
-	* At construction time the sound source will be created in OpenAL and initialized to default values.
+	* The source will be virtual until an OpenAL source is assigned to it.
 	* This is protected since we only want the SoundInstance class to be able to create new instances.
 	*/
 	SoundSource();
 
+	/**
+	 * @brief Assigns an OpenAL source, and applies all state to it.
+	 * @param alSource The OpenAL source.
+	 */
+	void assignALSource(ALuint alSource);
+
+	/**
+	 * @brief Releases the OpenAL source, making this source virtual.
+	 * Note that any buffers still will be queued on the OpenAL source.
+	 * @return The OpenAL source which was released.
+	 */
+	ALuint releaseALSource();
 	
 	/**
-	 * @brief The OpenAL source which this class represents.
+	 * @brief The OpenAL source which this class represents, or 0 if virtual.
 	 */
 	ALuint mALSource;
 
+	/**
+	 * @brief The position, in world units.
+	 */
+	WFMath::Point<3> mPosition;
+
+	/**
+	 * @brief The velocity, in world units.
+	 */
+	WFMath::Vector<3> mVelocity;
+
+	/**
+	 * @brief The gain.
+	 */
+	float mGain;
+
+	/**
+	 * @brief The max distance.
+	 */
+	float mMaxDistance;
+
+	/**
+	 * @brief Whether the sound should loop.
+	 */
+	bool mIsLooping;
+
+	/**
+	 * @brief Whether the source is used for streaming.
+	 */
+	bool mIsStreaming;
+
+	/**
+	 * @brief Applies the looping state to the OpenAL source.
+	 */
+	void applyLooping();
+
 };
 
 inline ALuint SoundSource::getALSource() const
@@ -100,6 +212,31 @@ inline ALuint SoundSource::getALSource() const
 	return mALSource;
 }
 
+inline bool SoundSource::isVirtual() const
+{
+	return mALSource == 0;
+}
+
+inline const WFMath::Point<3>& SoundSource::getPosition() const
+{
+	return mPosition;
+}
+
+inline float SoundSource::getGain() const
+{
+	return mGain;
+}
+
+inline bool SoundSource::getIsLooping() const
+{
+	return mIsLooping;
+}
+
+inline float SoundSource::getMaxDistance() const
+{
+	return mMaxDistance;
+}
+
 }
 
 #endif
@@ -0,0 +1,85 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SoundStreamDecodeTask.h"
+#include "WavStreamReader.h"
+
+namespace Ember
+{
+
+SoundStreamState::SoundStreamState() :
+		targetChunkCount(0), chunkSize(0), isDecoding(false), isLooping(false), isEndOfStream(false)
+{
+}
+
+SoundStreamState::~SoundStreamState()
+{
+}
+
+SoundStreamDecodeTask::SoundStreamDecodeTask(const std::shared_ptr<SoundStreamState>& state) :
+		mState(state)
+{
+}
+
+SoundStreamDecodeTask::~SoundStreamDecodeTask()
+{
+}
+
+void SoundStreamDecodeTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	size_t chunkSize;
+	size_t chunksNeeded;
+	bool isLooping;
+	{
+		std::unique_lock<std::mutex> l(mState->mutex);
+		chunkSize = mState->chunkSize;
+		chunksNeeded = mState->targetChunkCount > mState->chunks.size() ? mState->targetChunkCount - mState->chunks.size() : 0;
+		isLooping = mState->isLooping;
+	}
+
+	bool isEndOfStream = false;
+	std::vector<char> chunk;
+	while (chunksNeeded > 0) {
+		if (!mState->reader->read(chunk, chunkSize)) {
+			if (!isLooping) {
+				isEndOfStream = true;
+				break;
+			}
+			mState->reader->rewind();
+			if (!mState->reader->read(chunk, chunkSize)) {
+				//Empty stream; nothing to loop.
+				isEndOfStream = true;
+				break;
+			}
+		}
+		std::unique_lock<std::mutex> l(mState->mutex);
+		mState->chunks.push_back(std::vector<char>());
+		mState->chunks.back().swap(chunk);
+		--chunksNeeded;
+	}
+
+	std::unique_lock<std::mutex> l(mState->mutex);
+	mState->isEndOfStream = isEndOfStream;
+	mState->isDecoding = false;
+}
+
+}
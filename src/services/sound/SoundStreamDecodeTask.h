@@ -0,0 +1,118 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef SOUNDSTREAMDECODETASK_H_
+#define SOUNDSTREAMDECODETASK_H_
+
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+namespace Ember
+{
+
+class WavStreamReader;
+
+/**
+ * @brief State shared between a StreamedSoundBinding and the background tasks decoding data for it.
+ *
+ * The reader is only ever accessed by one decoding task at a time (guarded by isDecoding), while the decoded chunks are handed over under the mutex.
+ */
+struct SoundStreamState
+{
+	SoundStreamState();
+	~SoundStreamState();
+
+	/**
+	 * @brief Guards all fields except the reader.
+	 */
+	std::mutex mutex;
+
+	/**
+	 * @brief The reader used for decoding.
+	 */
+	std::unique_ptr<WavStreamReader> reader;
+
+	/**
+	 * @brief Decoded chunks, ready to be copied into OpenAL buffers.
+	 */
+	std::deque<std::vector<char>> chunks;
+
+	/**
+	 * @brief The number of decoded chunks to keep ready.
+	 */
+	size_t targetChunkCount;
+
+	/**
+	 * @brief The max size of each chunk, in bytes.
+	 */
+	size_t chunkSize;
+
+	/**
+	 * @brief True while a decode task is working on the stream.
+	 */
+	bool isDecoding;
+
+	/**
+	 * @brief True if the reader should rewind when reaching the end, rather than ending the stream.
+	 */
+	bool isLooping;
+
+	/**
+	 * @brief True when the reader has reached the end of the data, and the stream isn't looping.
+	 */
+	bool isEndOfStream;
+};
+
+/**
+ * @brief Decodes data for a streamed sound in a background thread.
+ *
+ * The task fills up the chunk queue of the stream state until it contains the requested number of chunks, or the end of the stream is reached.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class SoundStreamDecodeTask : public Tasks::TemplateNamedTask<SoundStreamDecodeTask>
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * The isDecoding flag of the state must be set before the task is enqueued.
+	 * @param state The stream state.
+	 */
+	SoundStreamDecodeTask(const std::shared_ptr<SoundStreamState>& state);
+
+	virtual ~SoundStreamDecodeTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+private:
+
+	/**
+	 * @brief The stream state.
+	 * Since this is shared, it's safe for the binding to be destroyed while the task is running.
+	 */
+	std::shared_ptr<SoundStreamState> mState;
+};
+
+}
+
+#endif /* SOUNDSTREAMDECODETASK_H_ */
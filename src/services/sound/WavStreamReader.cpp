@@ -0,0 +1,156 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "WavStreamReader.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Ember
+{
+
+namespace
+{
+/**
+ * @brief Reads a little endian 16 bit value.
+ */
+unsigned int readUInt16(const unsigned char* data)
+{
+	return data[0] | (data[1] << 8);
+}
+
+/**
+ * @brief Reads a little endian 32 bit value.
+ */
+unsigned int readUInt32(const unsigned char* data)
+{
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<unsigned int>(data[3]) << 24);
+}
+}
+
+WavStreamReader::WavStreamReader(const ResourceWrapper& resource) :
+		mResource(resource), mFormat(0), mFrequency(0), mBlockAlign(0), mDataStart(0), mDataSize(0), mPosition(0)
+{
+	if (!parseHeader()) {
+		S_LOG_WARNING("Could not parse '" << mResource.getName() << "' as an uncompressed wav file; it can't be streamed.");
+		mDataSize = 0;
+	}
+}
+
+bool WavStreamReader::parseHeader()
+{
+	if (!mResource.hasData() || mResource.getSize() < 12) {
+		return false;
+	}
+	const unsigned char* data = reinterpret_cast<const unsigned char*>(mResource.getDataPtr());
+	size_t size = mResource.getSize();
+
+	if (std::memcmp(data, "RIFF", 4) != 0 || std::memcmp(data + 8, "WAVE", 4) != 0) {
+		return false;
+	}
+
+	bool foundFormat = false;
+	size_t offset = 12;
+	while (offset + 8 <= size) {
+		const unsigned char* chunk = data + offset;
+		size_t chunkSize = readUInt32(chunk + 4);
+		size_t chunkStart = offset + 8;
+		if (std::memcmp(chunk, "fmt ", 4) == 0) {
+			if (chunkSize < 16 || chunkStart + 16 > size) {
+				return false;
+			}
+			unsigned int audioFormat = readUInt16(data + chunkStart);
+			unsigned int channels = readUInt16(data + chunkStart + 2);
+			mFrequency = readUInt32(data + chunkStart + 4);
+			mBlockAlign = readUInt16(data + chunkStart + 12);
+			unsigned int bitsPerSample = readUInt16(data + chunkStart + 14);
+			//Only uncompressed PCM is supported.
+			if (audioFormat != 1 || mBlockAlign == 0) {
+				return false;
+			}
+			if (channels == 1) {
+				mFormat = bitsPerSample == 8 ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16;
+			} else if (channels == 2) {
+				mFormat = bitsPerSample == 8 ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16;
+			} else {
+				return false;
+			}
+			if (bitsPerSample != 8 && bitsPerSample != 16) {
+				return false;
+			}
+			foundFormat = true;
+		} else if (std::memcmp(chunk, "data", 4) == 0) {
+			if (!foundFormat) {
+				return false;
+			}
+			mDataStart = chunkStart;
+			//Guard against truncated files.
+			mDataSize = std::min(chunkSize, size - chunkStart);
+			mDataSize -= mDataSize % mBlockAlign;
+			return mDataSize > 0;
+		}
+		//Chunks are padded to even sizes.
+		offset = chunkStart + chunkSize + (chunkSize & 1);
+	}
+	return false;
+}
+
+bool WavStreamReader::isValid() const
+{
+	return mDataSize != 0;
+}
+
+ALenum WavStreamReader::getFormat() const
+{
+	return mFormat;
+}
+
+ALsizei WavStreamReader::getFrequency() const
+{
+	return mFrequency;
+}
+
+bool WavStreamReader::read(std::vector<char>& buffer, size_t maxSize)
+{
+	size_t remaining = mDataSize - mPosition;
+	size_t size = std::min(remaining, maxSize);
+	if (mBlockAlign) {
+		size -= size % mBlockAlign;
+	}
+	if (size == 0) {
+		buffer.clear();
+		return false;
+	}
+	const char* start = mResource.getDataPtr() + mDataStart + mPosition;
+	buffer.assign(start, start + size);
+	mPosition += size;
+	return true;
+}
+
+void WavStreamReader::rewind()
+{
+	mPosition = 0;
+}
+
+}
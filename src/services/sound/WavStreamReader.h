@@ -0,0 +1,137 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef WAVSTREAMREADER_H_
+#define WAVSTREAMREADER_H_
+
+#include "framework/IResourceProvider.h"
+
+#include <vector>
+#include <cstddef>
+
+#ifdef __APPLE__
+#include <OpenAL/al.h>
+#elif defined(_MSC_VER)
+#include <al.h>
+#else
+#include <AL/al.h>
+#endif
+
+namespace Ember
+{
+
+/**
+ * @brief Reads PCM data incrementally from a RIFF/WAVE file held in memory.
+ *
+ * This is used by streamed sound samples, which instead of decoding the whole file into one OpenAL buffer reads it a chunk at a time.
+ * Only uncompressed 8 and 16 bit mono or stereo data is supported, since that's what OpenAL can consume directly.
+ *
+ * An instance keeps its own read position, so several readers can share the same resource. Any single instance must however only be accessed from one thread at a time.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class WavStreamReader
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * The header of the data will be parsed directly. Use isValid() to check whether the data could be read.
+	 * @param resource The resource holding the complete wav file.
+	 */
+	WavStreamReader(const ResourceWrapper& resource);
+
+	/**
+	 * @brief Returns true if the resource contained a supported wav file.
+	 * @return True if the data can be streamed.
+	 */
+	bool isValid() const;
+
+	/**
+	 * @brief Gets the OpenAL format of the PCM data.
+	 * @return An OpenAL format, such as AL_FORMAT_STEREO16.
+	 */
+	ALenum getFormat() const;
+
+	/**
+	 * @brief Gets the frequency of the PCM data.
+	 * @return The frequency in Hz.
+	 */
+	ALsizei getFrequency() const;
+
+	/**
+	 * @brief Reads the next chunk of PCM data.
+	 * The amount of data read is always aligned to whole sample frames.
+	 * @param buffer The buffer to fill. Any existing data will be replaced.
+	 * @param maxSize The max number of bytes to read.
+	 * @return True if any data was read, false if the end of the data was reached.
+	 */
+	bool read(std::vector<char>& buffer, size_t maxSize);
+
+	/**
+	 * @brief Moves the read position back to the start of the PCM data.
+	 */
+	void rewind();
+
+private:
+
+	/**
+	 * @brief The resource holding the wav data.
+	 */
+	ResourceWrapper mResource;
+
+	/**
+	 * @brief The OpenAL format of the data.
+	 */
+	ALenum mFormat;
+
+	/**
+	 * @brief The frequency of the data, in Hz.
+	 */
+	ALsizei mFrequency;
+
+	/**
+	 * @brief The size in bytes of each sample frame (i.e. one sample for each channel).
+	 */
+	size_t mBlockAlign;
+
+	/**
+	 * @brief Offset to the start of the PCM data within the resource.
+	 */
+	size_t mDataStart;
+
+	/**
+	 * @brief The size in bytes of the PCM data.
+	 */
+	size_t mDataSize;
+
+	/**
+	 * @brief The current read position, relative to mDataStart.
+	 */
+	size_t mPosition;
+
+	/**
+	 * @brief Parses the RIFF header and locates the "fmt " and "data" chunks.
+	 * @return True if the data is supported.
+	 */
+	bool parseHeader();
+};
+
+}
+
+#endif /* WAVSTREAMREADER_H_ */
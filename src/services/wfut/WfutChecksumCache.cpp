@@ -0,0 +1,156 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "WfutChecksumCache.h"
+
+#include "framework/LoggingInstance.h"
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+namespace Ember
+{
+
+namespace
+{
+/**
+ * @brief The first line of a cache file. Bump the version if the format changes, so that old caches are ignored.
+ */
+const std::string CACHE_HEADER = "wfutchecksums 1";
+}
+
+WfutChecksumCache::WfutChecksumCache(const std::string& path) :
+		mPath(path), mIsDirty(false)
+{
+}
+
+bool WfutChecksumCache::load()
+{
+	mEntries.clear();
+	mIsDirty = false;
+
+	std::ifstream stream(mPath.c_str());
+	if (!stream.is_open()) {
+		return false;
+	}
+	std::string line;
+	if (!std::getline(stream, line) || line != CACHE_HEADER) {
+		S_LOG_WARNING("Ignoring wfut checksum cache at '" << mPath << "' since it has an unknown format.");
+		return false;
+	}
+	//Each line is "<checksum> <size> <modification time> <filename>". The filename is last since it might contain spaces.
+	while (std::getline(stream, line)) {
+		std::istringstream lineStream(line);
+		Entry entry;
+		long long modificationTime;
+		if (!(lineStream >> entry.checksum >> entry.size >> modificationTime)) {
+			continue;
+		}
+		lineStream.get();
+		std::string filename;
+		std::getline(lineStream, filename);
+		if (!filename.empty()) {
+			entry.modificationTime = static_cast<std::time_t>(modificationTime);
+			mEntries[filename] = entry;
+		}
+	}
+	S_LOG_VERBOSE("Read " << mEntries.size() << " entries from wfut checksum cache at '" << mPath << "'.");
+	return true;
+}
+
+bool WfutChecksumCache::save()
+{
+	if (!mIsDirty) {
+		return true;
+	}
+	//Write to a temporary file first, so that an interrupted write won't leave a truncated cache.
+	const std::string tempPath = mPath + ".tmp";
+	{
+		std::ofstream stream(tempPath.c_str(), std::ios::out | std::ios::trunc);
+		if (!stream.is_open()) {
+			S_LOG_WARNING("Could not write wfut checksum cache to '" << tempPath << "'.");
+			return false;
+		}
+		stream << CACHE_HEADER << "\n";
+		for (EntryStore::const_iterator I = mEntries.begin(); I != mEntries.end(); ++I) {
+			stream << I->second.checksum << " " << I->second.size << " " << static_cast<long long>(I->second.modificationTime) << " " << I->first << "\n";
+		}
+		if (!stream.good()) {
+			S_LOG_WARNING("Error when writing wfut checksum cache to '" << tempPath << "'.");
+			return false;
+		}
+	}
+	std::remove(mPath.c_str());
+	if (std::rename(tempPath.c_str(), mPath.c_str()) != 0) {
+		S_LOG_WARNING("Could not move wfut checksum cache into place at '" << mPath << "'.");
+		return false;
+	}
+	mIsDirty = false;
+	return true;
+}
+
+bool WfutChecksumCache::getChecksum(const std::string& filename, size_t size, std::time_t modificationTime, unsigned long& checksum) const
+{
+	EntryStore::const_iterator I = mEntries.find(filename);
+	if (I == mEntries.end() || I->second.size != size || I->second.modificationTime != modificationTime) {
+		return false;
+	}
+	checksum = I->second.checksum;
+	return true;
+}
+
+void WfutChecksumCache::setChecksum(const std::string& filename, size_t size, std::time_t modificationTime, unsigned long checksum)
+{
+	Entry& entry = mEntries[filename];
+	entry.size = size;
+	entry.modificationTime = modificationTime;
+	entry.checksum = checksum;
+	mIsDirty = true;
+}
+
+void WfutChecksumCache::removeChecksum(const std::string& filename)
+{
+	if (mEntries.erase(filename)) {
+		mIsDirty = true;
+	}
+}
+
+size_t WfutChecksumCache::size() const
+{
+	return mEntries.size();
+}
+
+bool WfutChecksumCache::statFile(const std::string& path, size_t& size, std::time_t& modificationTime)
+{
+	struct stat fileStat;
+	if (stat(path.c_str(), &fileStat) != 0) {
+		return false;
+	}
+	size = fileStat.st_size;
+	modificationTime = fileStat.st_mtime;
+	return true;
+}
+
+}
@@ -0,0 +1,135 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef WFUTCHECKSUMCACHE_H_
+#define WFUTCHECKSUMCACHE_H_
+
+#include <string>
+#include <unordered_map>
+#include <ctime>
+#include <cstddef>
+
+namespace Ember
+{
+
+/**
+ * @brief A persistent cache of the checksums of local media files.
+ *
+ * Calculating the checksums of all local media files at each startup is very expensive when the media channel is large.
+ * This cache stores the checksum of each file together with the size and modification time the file had when the checksum was calculated. As long as neither has changed, the cached checksum can be used instead of reading the whole file.
+ *
+ * The cache is stored as a plain text file, with one line per file.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class WfutChecksumCache
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param path The path to the file in which the cache is stored. Nothing is read until load() is called.
+	 */
+	WfutChecksumCache(const std::string& path);
+
+	/**
+	 * @brief Loads the cache from disk.
+	 * Any existing entries are discarded. A missing or unreadable cache file results in an empty cache.
+	 * @return True if the cache file could be read.
+	 */
+	bool load();
+
+	/**
+	 * @brief Saves the cache to disk, if it has been altered since it was loaded.
+	 * @return True if the cache could be saved, or didn't need to be saved.
+	 */
+	bool save();
+
+	/**
+	 * @brief Looks up the checksum of a file.
+	 * @param filename The name of the file, relative to the media root.
+	 * @param size The current size of the file.
+	 * @param modificationTime The current modification time of the file.
+	 * @param checksum If a valid entry is found, this will be set to the cached checksum.
+	 * @return True if there was an entry which matched both the size and the modification time.
+	 */
+	bool getChecksum(const std::string& filename, size_t size, std::time_t modificationTime, unsigned long& checksum) const;
+
+	/**
+	 * @brief Stores the checksum of a file.
+	 * @param filename The name of the file, relative to the media root.
+	 * @param size The size of the file when the checksum was calculated.
+	 * @param modificationTime The modification time of the file when the checksum was calculated.
+	 * @param checksum The checksum.
+	 */
+	void setChecksum(const std::string& filename, size_t size, std::time_t modificationTime, unsigned long checksum);
+
+	/**
+	 * @brief Removes any entry for the file.
+	 * @param filename The name of the file, relative to the media root.
+	 */
+	void removeChecksum(const std::string& filename);
+
+	/**
+	 * @brief Gets the number of entries in the cache.
+	 * @return The number of entries.
+	 */
+	size_t size() const;
+
+	/**
+	 * @brief Reads the size and modification time of a file.
+	 * @param path The full path to the file.
+	 * @param size If the file exists, this will be set to its size.
+	 * @param modificationTime If the file exists, this will be set to its modification time.
+	 * @return True if the file exists.
+	 */
+	static bool statFile(const std::string& path, size_t& size, std::time_t& modificationTime);
+
+private:
+
+	/**
+	 * @brief A cache entry.
+	 */
+	struct Entry
+	{
+		size_t size;
+		std::time_t modificationTime;
+		unsigned long checksum;
+	};
+
+	typedef std::unordered_map<std::string, Entry> EntryStore;
+
+	/**
+	 * @brief The path of the cache file.
+	 */
+	const std::string mPath;
+
+	/**
+	 * @brief All entries, keyed by file name.
+	 */
+	EntryStore mEntries;
+
+	/**
+	 * @brief True if the cache has been altered since it was loaded or saved.
+	 */
+	bool mIsDirty;
+};
+
+}
+
+#endif /* WFUTCHECKSUMCACHE_H_ */
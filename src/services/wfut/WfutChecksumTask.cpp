@@ -0,0 +1,105 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "WfutChecksumTask.h"
+#include "WfutChecksumCache.h"
+
+#include <zlib.h>
+
+#include <fstream>
+#include <vector>
+
+namespace Ember
+{
+
+WfutChecksumTask::WfutChecksumTask(const std::string& filename, const std::string& path, sigc::slot<void, WfutChecksumTask&> callback) :
+		mFilename(filename), mPath(path), mCallback(callback), mSuccessful(false), mChecksum(0), mSize(0), mModificationTime(0)
+{
+}
+
+WfutChecksumTask::~WfutChecksumTask()
+{
+}
+
+void WfutChecksumTask::executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+{
+	//Get the stamp before reading, so that if the file is altered while being read the cache entry will be invalid next time.
+	if (WfutChecksumCache::statFile(mPath, mSize, mModificationTime)) {
+		mSuccessful = calculateChecksum(mPath, mChecksum);
+	}
+}
+
+void WfutChecksumTask::executeTaskInMainThread()
+{
+	if (mCallback) {
+		mCallback(*this);
+	}
+}
+
+const std::string& WfutChecksumTask::getFilename() const
+{
+	return mFilename;
+}
+
+bool WfutChecksumTask::isSuccessful() const
+{
+	return mSuccessful;
+}
+
+unsigned long WfutChecksumTask::getChecksum() const
+{
+	return mChecksum;
+}
+
+size_t WfutChecksumTask::getSize() const
+{
+	return mSize;
+}
+
+std::time_t WfutChecksumTask::getModificationTime() const
+{
+	return mModificationTime;
+}
+
+bool WfutChecksumTask::calculateChecksum(const std::string& path, unsigned long& checksum)
+{
+	std::ifstream stream(path.c_str(), std::ios::in | std::ios::binary);
+	if (!stream.is_open()) {
+		return false;
+	}
+	uLong crc = crc32(0L, Z_NULL, 0);
+	std::vector<char> buffer(65536);
+	while (stream) {
+		stream.read(&buffer[0], buffer.size());
+		std::streamsize count = stream.gcount();
+		if (count > 0) {
+			crc = crc32(crc, reinterpret_cast<const Bytef*>(&buffer[0]), count);
+		}
+	}
+	if (stream.bad()) {
+		return false;
+	}
+	checksum = crc;
+	return true;
+}
+
+}
@@ -0,0 +1,105 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef WFUTCHECKSUMTASK_H_
+#define WFUTCHECKSUMTASK_H_
+
+#include "framework/tasks/TemplateNamedTask.h"
+
+#include <sigc++/slot.h>
+
+#include <string>
+#include <ctime>
+#include <cstddef>
+
+namespace Ember
+{
+
+/**
+ * @brief Calculates the CRC32 checksum of a local media file in a background thread.
+ *
+ * The checksum is the same as the one used by libwfut in the channel file lists.
+ * Once done the callback will be called in the main thread.
+ *
+ * @author Erik Ogenvik <erik@ogenvik.org>
+ */
+class WfutChecksumTask : public Tasks::TemplateNamedTask<WfutChecksumTask>
+{
+public:
+
+	/**
+	 * @brief Ctor.
+	 * @param filename The name of the file, relative to the media root.
+	 * @param path The full path to the file.
+	 * @param callback Called in the main thread when the task is done.
+	 */
+	WfutChecksumTask(const std::string& filename, const std::string& path, sigc::slot<void, WfutChecksumTask&> callback);
+
+	virtual ~WfutChecksumTask();
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context);
+
+	virtual void executeTaskInMainThread();
+
+	/**
+	 * @brief Gets the name of the file, relative to the media root.
+	 */
+	const std::string& getFilename() const;
+
+	/**
+	 * @brief Returns true if the file could be read.
+	 */
+	bool isSuccessful() const;
+
+	/**
+	 * @brief Gets the calculated checksum.
+	 */
+	unsigned long getChecksum() const;
+
+	/**
+	 * @brief Gets the size of the file, as it was when the checksum was calculated.
+	 */
+	size_t getSize() const;
+
+	/**
+	 * @brief Gets the modification time of the file, as it was when the checksum was calculated.
+	 */
+	std::time_t getModificationTime() const;
+
+	/**
+	 * @brief Calculates the CRC32 checksum of a file.
+	 * @param path The full path to the file.
+	 * @param checksum If successful, the checksum will be set to this.
+	 * @return True if the file could be read.
+	 */
+	static bool calculateChecksum(const std::string& path, unsigned long& checksum);
+
+private:
+
+	const std::string mFilename;
+	const std::string mPath;
+	sigc::slot<void, WfutChecksumTask&> mCallback;
+	bool mSuccessful;
+	unsigned long mChecksum;
+	size_t mSize;
+	std::time_t mModificationTime;
+};
+
+}
+
+#endif /* WFUTCHECKSUMTASK_H_ */
@@ -28,6 +28,8 @@
 #include "WfutService.h"
 #include "WfutSession.h"
 
+#include "services/EmberServices.h"
+#include "services/config/ConfigService.h"
 #include "framework/LoggingInstance.h"
 
 using namespace WFUT;
@@ -60,6 +62,19 @@ namespace Ember
   WfutService::start()
   {
     mSession->init();
+
+    ConfigService& configService =
+        EmberServices::getSingleton().getConfigService();
+    if (configService.hasItem("wfut", "maxdownloads"))
+      {
+        mSession->setMaxConcurrentDownloads(
+            static_cast<int>(configService.getValue("wfut", "maxdownloads")));
+      }
+    if (configService.hasItem("wfut", "hashingthreads"))
+      {
+        mSession->setNumberOfHashingThreads(
+            static_cast<int>(configService.getValue("wfut", "hashingthreads")));
+      }
     setRunning(true);
     return Service::OK;
   }
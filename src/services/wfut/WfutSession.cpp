@@ -25,8 +25,13 @@
 #endif
 
 #include "WfutSession.h"
+#include "WfutChecksumCache.h"
+#include "WfutChecksumTask.h"
 #include <fstream>
+#include <thread>
+#include <algorithm>
 #include "framework/LoggingInstance.h"
+#include "framework/tasks/TaskQueue.h"
 
 using namespace WFUT;
 
@@ -53,7 +58,13 @@ WfutSession::WfutSession(sigc::slot<void, const std::string&, const std::string&
 ) 
 : mServerListDownloadingSlot(serverListDownloadingSlot)
 , mUpdatesCalculatedSlot(updatesCalculatedSlot)
+, mActiveDownloads(0)
+, mMaxConcurrentDownloads(4)
+, mNumberOfHashingThreads(0)
 {
+	//Connect our own handlers first, so that the download bookkeeping is done before any listeners are notified.
+	mWfutClient.DownloadComplete.connect(sigc::mem_fun(*this, &WfutSession::wfutClient_DownloadComplete));
+	mWfutClient.DownloadFailed.connect(sigc::mem_fun(*this, &WfutSession::wfutClient_DownloadFailed));
 	mWfutClient.DownloadComplete.connect(downloadCompleteSlot);
 	mWfutClient.DownloadFailed.connect(downloadFailedSlot);
 }
@@ -69,6 +80,21 @@ void WfutSession::init()
 	mWfutClient.init();
 }
 
+void WfutSession::setMaxConcurrentDownloads(unsigned int maxConcurrentDownloads)
+{
+	mMaxConcurrentDownloads = maxConcurrentDownloads;
+}
+
+void WfutSession::setNumberOfHashingThreads(unsigned int numberOfThreads)
+{
+	mNumberOfHashingThreads = numberOfThreads;
+}
+
+unsigned int WfutSession::getNumberOfActiveDownloads() const
+{
+	return mActiveDownloads;
+}
+
 void WfutSession::startUpdate(const std::string &serverRoot,
 const std::string &channelName,
 const std::string &localPath,
@@ -143,31 +169,166 @@ const std::string &systemPath
 	
 	S_LOG_INFO("Updating Channel: " << channel);
 	
+	mChecksumCache.reset(new WfutChecksumCache(local_root + "wfutchecksums"));
+	mChecksumCache->load();
+
 	// Now we have loaded all our data files, lets find out what we really need
 	// to download
-	if (mWfutClient.calculateUpdates(mServer, mSystem, mLocal, mUpdates, local_root)) {
-		S_LOG_WARNING("Error determining file to update.");
-		return;
-	}
+	calculateUpdates(local_root);
+	// Save the cache directly, so that the calculated checksums aren't lost if the update is interrupted.
+	mChecksumCache->save();
 	
 	mUpdatesCalculatedSlot(mUpdates.getFiles().size());
 	
 	// Make sure the mLocal file has the correct channel name
 	mLocal.setName(mServer.getName());
 	
-	// Queue the list of files to download
-	mWfutClient.updateChannel(mUpdates, serverRoot + "/" + channel, local_root);
-	
+	// Queue the list of files to download. They will be handed to libwfut as download slots become available.
+	mUpdateUrlPrefix = serverRoot + "/" + channel;
+	mLocalRoot = local_root;
+	const FileMap& updates = mUpdates.getFiles();
+	for (FileMap::const_iterator I = updates.begin(); I != updates.end(); ++I) {
+		mPendingDownloads.push_back(I->second);
+	}
+	startPendingDownloads();
+}
+
+void WfutSession::calculateUpdates(const std::string& localRoot)
+{
+	const FileMap& serverFiles = mServer.getFiles();
+	const FileMap& systemFiles = mSystem.getFiles();
+	const FileMap& localFiles = mLocal.getFiles();
+
+	//Files which according to the local list already are up to date, but which must be checked against their checksums. The first entry is the local file, the second the server file.
+	typedef std::vector<std::pair<const FileObject*, const FileObject*>> FileObjectPairStore;
+	FileObjectPairStore filesToVerify;
+
+	for (FileMap::const_iterator I = serverFiles.begin(); I != serverFiles.end(); ++I) {
+		const FileObject& serverFile = I->second;
+		if (serverFile.deleted) {
+			continue;
+		}
+		FileMap::const_iterator localI = localFiles.find(I->first);
+		if (localI == localFiles.end()) {
+			//If there's no local copy, check if there's an up to date copy in the system location.
+			FileMap::const_iterator systemI = systemFiles.find(I->first);
+			if (systemI == systemFiles.end() || serverFile.version > systemI->second.version) {
+				mUpdates.addFile(serverFile);
+			}
+		} else if (serverFile.version > localI->second.version) {
+			mUpdates.addFile(serverFile);
+		} else {
+			filesToVerify.push_back(std::make_pair(&localI->second, &serverFile));
+		}
+	}
+
+	FileObjectPairStore cacheMisses;
+	for (FileObjectPairStore::const_iterator I = filesToVerify.begin(); I != filesToVerify.end(); ++I) {
+		const FileObject& localFile = *I->first;
+		size_t size;
+		std::time_t modificationTime;
+		if (!WfutChecksumCache::statFile(localRoot + localFile.filename, size, modificationTime)) {
+			//The file is missing.
+			mChecksumCache->removeChecksum(localFile.filename);
+			mUpdates.addFile(*I->second);
+			continue;
+		}
+		unsigned long checksum;
+		if (mChecksumCache->getChecksum(localFile.filename, size, modificationTime, checksum)) {
+			if (checksum != localFile.crc32) {
+				mUpdates.addFile(*I->second);
+			}
+		} else {
+			cacheMisses.push_back(*I);
+		}
+	}
+
+	if (!cacheMisses.empty()) {
+		unsigned int numberOfThreads = mNumberOfHashingThreads;
+		if (numberOfThreads == 0) {
+			numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+		}
+		mCalculatedChecksums.clear();
+		{
+			Tasks::TaskQueue taskQueue(std::min<unsigned int>(numberOfThreads, cacheMisses.size()));
+			for (FileObjectPairStore::const_iterator I = cacheMisses.begin(); I != cacheMisses.end(); ++I) {
+				const std::string& filename = I->first->filename;
+				taskQueue.enqueueTask(new WfutChecksumTask(filename, localRoot + filename, sigc::mem_fun(*this, &WfutSession::checksumTask_Completed)));
+			}
+			//Destroying the queue will wait for all tasks to complete, and process the results in this thread.
+		}
+		for (FileObjectPairStore::const_iterator I = cacheMisses.begin(); I != cacheMisses.end(); ++I) {
+			std::unordered_map<std::string, unsigned long>::const_iterator checksumI = mCalculatedChecksums.find(I->first->filename);
+			if (checksumI == mCalculatedChecksums.end() || checksumI->second != I->first->crc32) {
+				mUpdates.addFile(*I->second);
+			}
+		}
+		mCalculatedChecksums.clear();
+	}
+	S_LOG_INFO("Verified " << filesToVerify.size() << " local media files, of which " << (filesToVerify.size() - cacheMisses.size()) << " were found in the checksum cache.");
+}
+
+void WfutSession::checksumTask_Completed(WfutChecksumTask& task)
+{
+	if (task.isSuccessful()) {
+		mChecksumCache->setChecksum(task.getFilename(), task.getSize(), task.getModificationTime(), task.getChecksum());
+		mCalculatedChecksums[task.getFilename()] = task.getChecksum();
+	} else {
+		S_LOG_WARNING("Could not calculate checksum of local media file '" << task.getFilename() << "'.");
+		mChecksumCache->removeChecksum(task.getFilename());
+	}
+}
+
+void WfutSession::startPendingDownloads()
+{
+	while (!mPendingDownloads.empty() && (mMaxConcurrentDownloads == 0 || mActiveDownloads < mMaxConcurrentDownloads)) {
+		mWfutClient.updateFile(mPendingDownloads.front(), mUpdateUrlPrefix, mLocalRoot);
+		mPendingDownloads.pop_front();
+		++mActiveDownloads;
+	}
+}
+
+void WfutSession::wfutClient_DownloadComplete(const std::string &url, const std::string &filename)
+{
+	if (mActiveDownloads) {
+		--mActiveDownloads;
+	}
+	//libwfut verifies the checksum of downloaded files, so we can store the server checksum directly.
+	if (mChecksumCache.get()) {
+		const FileMap& updates = mUpdates.getFiles();
+		FileMap::const_iterator I = updates.find(filename);
+		size_t size;
+		std::time_t modificationTime;
+		if (I != updates.end() && WfutChecksumCache::statFile(mLocalRoot + filename, size, modificationTime)) {
+			mChecksumCache->setChecksum(filename, size, modificationTime, I->second.crc32);
+		}
+	}
+}
+
+void WfutSession::wfutClient_DownloadFailed(const std::string &url, const std::string &filename, const std::string &reason)
+{
+	if (mActiveDownloads) {
+		--mActiveDownloads;
+	}
+	if (mChecksumCache.get()) {
+		mChecksumCache->removeChecksum(filename);
+	}
 }
 
 int WfutSession::poll()
 {
+	//New downloads are started outside of the libwfut callbacks, since libwfut is iterating over its downloads when emitting them.
+	startPendingDownloads();
 	int result = mWfutClient.poll();
-	if (!result) {
+	if (!result && mPendingDownloads.empty()) {
 		// Save the completed download list
 		mWfutClient.saveLocalList(mServer, mLocalWfut);
+		if (mChecksumCache.get()) {
+			mChecksumCache->save();
+		}
+		return 0;
 	}
-	return result;
+	return result + mPendingDownloads.size();
 }
 
 
@@ -26,10 +26,23 @@
 #include <libwfut/WFUT.h>
 #include <sigc++/object.h>
 
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
 namespace Ember
 {
+  class WfutChecksumCache;
+  class WfutChecksumTask;
 
   /**
+   @brief A session for updating one media channel.
+
+   Before any file is downloaded the checksums of the local media files are verified. Since this can take a very long time for large media channels the checksums are stored in a persistent cache (a file named "wfutchecksums" in the channel directory), keyed by the size and modification time of each file. Only files which aren't found in the cache are read, and those are checksummed in parallel by a number of worker threads.
+   The files which need updating are then downloaded with a bounded number of concurrent downloads.
+
+   Since all downloads are done through libcurl the server root can just as well be a "file://" url, which is useful for testing.
+
    @author Erik Hjortsberg <erik.hjortsberg@gmail.com>
    */
   class WfutSession : public virtual sigc::trackable
@@ -54,12 +67,97 @@ namespace Ember
     void
     startUpdate(const std::string &serverRoot, const std::string &channelName,
         const std::string &localPath, const std::string &systemPath);
+
+    /**
+     * @brief Sets the max number of files which are downloaded at the same time.
+     * @param maxConcurrentDownloads The max number of concurrent downloads. If 0, all files will be downloaded at once.
+     */
+    void
+    setMaxConcurrentDownloads(unsigned int maxConcurrentDownloads);
+
+    /**
+     * @brief Sets the number of threads used for calculating checksums of local files.
+     * @param numberOfThreads The number of threads. If 0, one thread per hardware thread will be used.
+     */
+    void
+    setNumberOfHashingThreads(unsigned int numberOfThreads);
+
+    /**
+     * @brief Gets the number of files which currently are being downloaded.
+     * @return The number of active downloads.
+     */
+    unsigned int
+    getNumberOfActiveDownloads() const;
+
   private:
     WFUT::ChannelFileList mLocal, mSystem, mServer, mUpdates, mTmplist;
     WFUT::WFUTClient mWfutClient;
     std::string mLocalWfut;
     sigc::slot<void, const std::string&>& mServerListDownloadingSlot;
     sigc::slot<void, size_t>& mUpdatesCalculatedSlot;
+
+    /**
+     * @brief The checksum cache for the channel being updated.
+     */
+    std::unique_ptr<WfutChecksumCache> mChecksumCache;
+
+    /**
+     * @brief Checksums calculated by the background tasks, keyed by file name.
+     */
+    std::unordered_map<std::string, unsigned long> mCalculatedChecksums;
+
+    /**
+     * @brief Files which should be downloaded, but which haven't been handed to libwfut yet.
+     */
+    std::deque<WFUT::FileObject> mPendingDownloads;
+
+    /**
+     * @brief The url prefix used for downloads.
+     */
+    std::string mUpdateUrlPrefix;
+
+    /**
+     * @brief The local directory into which files are downloaded.
+     */
+    std::string mLocalRoot;
+
+    /**
+     * @brief The number of downloads currently handled by libwfut.
+     */
+    unsigned int mActiveDownloads;
+
+    /**
+     * @brief The max number of concurrent downloads, or 0 if unbounded.
+     */
+    unsigned int mMaxConcurrentDownloads;
+
+    /**
+     * @brief The number of threads used for calculating checksums, or 0 if it should match the hardware.
+     */
+    unsigned int mNumberOfHashingThreads;
+
+    /**
+     * @brief Finds out which of the files on the server needs to be updated, and puts them in mUpdates.
+     * This mirrors WFUT::WFUTClient::calculateUpdates(), but uses the checksum cache and calculates any missing checksums in parallel.
+     * @param localRoot The local directory of the channel.
+     */
+    void
+    calculateUpdates(const std::string& localRoot);
+
+    /**
+     * @brief Hands pending downloads to libwfut, as long as the max number of concurrent downloads isn't reached.
+     */
+    void
+    startPendingDownloads();
+
+    void
+    wfutClient_DownloadComplete(const std::string &url,
+        const std::string &filename);
+    void
+    wfutClient_DownloadFailed(const std::string &url,
+        const std::string &filename, const std::string &reason);
+    void
+    checksumTask_Completed(WfutChecksumTask& task);
   };
 
 }
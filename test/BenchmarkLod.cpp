@@ -0,0 +1,380 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**
+ * A headless benchmark of the automatic mesh Lod generation.
+ *
+ * Each mesh in the corpus is loaded without any window or GPU, using the default (system memory) hardware buffer manager, and Lods are then generated for it with the same settings as LodManager uses for automatic Lods.
+ * The time spent in each phase and on each Lod level is measured, together with the memory used by the generator, and the results are written as JSON so that they can be compared between commits.
+ *
+ * Usage: BenchmarkLod [--iterations <n>] [--output <file>] <mesh file or directory>...
+ *
+ * --iterations: The number of times Lods are generated for each mesh. Default is 3.
+ * --output: The file to write the results to. If omitted, the results are written to stdout.
+ *
+ * For directories, all files ending with ".mesh" in them are used.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "components/ogre/lod/ProgressiveMeshGenerator.h"
+#include "components/ogre/lod/LodConfig.h"
+
+#include "framework/osdir.h"
+
+#include <Ogre.h>
+#include <OgreDefaultHardwareBufferManager.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Ember::OgreView::Lod;
+
+namespace Ember
+{
+
+/**
+ * @brief Measures the wall clock time since it was created or last restarted.
+ */
+class Stopwatch
+{
+public:
+	Stopwatch() :
+		mStart(boost::posix_time::microsec_clock::local_time())
+	{
+	}
+
+	double getElapsedMilliseconds() const
+	{
+		return (boost::posix_time::microsec_clock::local_time() - mStart).total_microseconds() / 1000.0;
+	}
+
+	void restart()
+	{
+		mStart = boost::posix_time::microsec_clock::local_time();
+	}
+
+private:
+	boost::posix_time::ptime mStart;
+};
+
+/**
+ * @brief Gets the peak resident set size of the process, in kilobytes.
+ */
+long getMaxResidentKilobytes()
+{
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+	return usage.ru_maxrss;
+}
+
+/**
+ * @brief The measurements of one Lod level of one run.
+ */
+struct LevelMeasurement
+{
+	double milliseconds;
+	size_t vertexCount;
+	size_t generatorBytes;
+	long maxResidentKilobytes;
+};
+
+/**
+ * @brief The measurements of one run over a mesh.
+ */
+struct RunMeasurement
+{
+	double initializeMilliseconds;
+	double computeCostsMilliseconds;
+	std::vector<LevelMeasurement> levels;
+};
+
+/**
+ * @brief Runs the phases of the generator separately, so that each can be timed.
+ *
+ * The baking of each Lod level is intercepted, which means that the time of a level includes both the collapses needed for it and the baking.
+ */
+class BenchmarkMeshGenerator: public ProgressiveMeshGenerator
+{
+public:
+
+	void run(Ogre::MeshPtr mesh, LodConfig& lodConfig, RunMeasurement& measurement)
+	{
+		mMeasurement = &measurement;
+		mMesh = mesh;
+		mMeshName = mesh->getName();
+		mMeshBoundingSphereRadius = mesh->getBoundingSphereRadius();
+		mMesh->removeLodLevels();
+
+		Stopwatch stopwatch;
+		tuneContainerSize();
+		initialize();
+		measurement.initializeMilliseconds = stopwatch.getElapsedMilliseconds();
+
+		stopwatch.restart();
+		computeCosts();
+		measurement.computeCostsMilliseconds = stopwatch.getElapsedMilliseconds();
+
+		mLevelStopwatch.restart();
+		computeLods(lodConfig);
+		mMesh.setNull();
+		mMeasurement = 0;
+	}
+
+protected:
+
+	virtual void bakeLods()
+	{
+		ProgressiveMeshGenerator::bakeLods();
+
+		LevelMeasurement level;
+		level.milliseconds = mLevelStopwatch.getElapsedMilliseconds();
+		level.vertexCount = mVertexList.size();
+		for (VertexList::const_iterator I = mVertexList.begin(); I != mVertexList.end(); ++I) {
+			if (I->edges.empty()) {
+				level.vertexCount--;
+			}
+		}
+		level.generatorBytes = getGeneratorBytes();
+		level.maxResidentKilobytes = getMaxResidentKilobytes();
+		mMeasurement->levels.push_back(level);
+		mLevelStopwatch.restart();
+	}
+
+private:
+	RunMeasurement* mMeasurement;
+	Stopwatch mLevelStopwatch;
+
+	/**
+	 * @brief Estimates the memory used by the containers of the generator.
+	 * Only the memory allocated by the containers themselves is counted; edges and triangle lists which have outgrown their inline storage are not.
+	 */
+	size_t getGeneratorBytes() const
+	{
+		return mVertexList.capacity() * sizeof(PMVertex) + mTriangleList.capacity() * sizeof(PMTriangle) + (mVertexLookup.capacity() + mSharedVertexLookup.capacity()) * sizeof(PMVertex*)
+		        + mCollapseCostHeap.size() * sizeof(PMVertex*) + tmpCollapsedEdges.capacity() * sizeof(PMCollapsedEdge);
+	}
+};
+
+struct BenchmarkSettings
+{
+	BenchmarkSettings() :
+		iterations(3)
+	{
+	}
+
+	int iterations;
+	std::string outputPath;
+	std::vector<std::string> meshPaths;
+};
+
+/**
+ * @brief Sets up the Lod levels in the same way as LodManager::loadAutomaticLod.
+ */
+void createAutomaticLodConfig(Ogre::MeshPtr mesh, LodConfig& lodConfig)
+{
+	lodConfig.mesh = mesh;
+	mesh->setLodStrategy(&Ogre::PixelCountLodStrategy::getSingleton());
+	LodLevel lodLevel;
+	lodLevel.reductionMethod = LodLevel::VRM_COLLAPSE_COST;
+	Ogre::Real radius = mesh->getBoundingSphereRadius();
+	for (int i = 2; i < 6; i++) {
+		Ogre::Real i4 = (Ogre::Real) (i * i * i * i);
+		Ogre::Real i5 = i4 * (Ogre::Real) i;
+		lodLevel.distance = 3388608.f / i4;
+		lodLevel.reductionValue = radius / 100000.f * i5;
+		lodConfig.levels.push_back(lodLevel);
+	}
+}
+
+Ogre::MeshPtr loadMesh(const std::string& path)
+{
+	std::ifstream* file = new std::ifstream(path.c_str(), std::ios::in | std::ios::binary);
+	if (!file->is_open()) {
+		delete file;
+		std::cerr << "Could not open " << path << "." << std::endl;
+		return Ogre::MeshPtr();
+	}
+	Ogre::DataStreamPtr stream(OGRE_NEW Ogre::FileStreamDataStream(path, file, true));
+	Ogre::MeshPtr mesh = Ogre::MeshManager::getSingleton().createManual(path, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
+	try {
+		Ogre::MeshSerializer serializer;
+		serializer.importMesh(stream, mesh.get());
+	} catch (const Ogre::Exception& ex) {
+		std::cerr << "Could not load " << path << ": " << ex.getFullDescription() << std::endl;
+		Ogre::MeshManager::getSingleton().remove(mesh->getHandle());
+		return Ogre::MeshPtr();
+	}
+	return mesh;
+}
+
+void collectMeshPaths(const std::vector<std::string>& paths, std::vector<std::string>& meshPaths)
+{
+	for (std::vector<std::string>::const_iterator I = paths.begin(); I != paths.end(); ++I) {
+		oslink::directory dir(*I);
+		if (dir.isExisting()) {
+			std::vector<std::string> entries;
+			while (dir) {
+				const std::string entry = dir.next();
+				if (entry.size() > 5 && entry.compare(entry.size() - 5, 5, ".mesh") == 0) {
+					entries.push_back(*I + "/" + entry);
+				}
+			}
+			//Sort, so that the order is the same between runs.
+			std::sort(entries.begin(), entries.end());
+			meshPaths.insert(meshPaths.end(), entries.begin(), entries.end());
+		} else {
+			meshPaths.push_back(*I);
+		}
+	}
+}
+
+void writeMesh(std::ostream& stream, const std::string& path, size_t vertexCount, const std::vector<RunMeasurement>& runs)
+{
+	stream << "    {\"mesh\": \"" << path << "\", \"vertices\": " << vertexCount << ", \"runs\": [" << std::endl;
+	for (std::vector<RunMeasurement>::const_iterator I = runs.begin(); I != runs.end(); ++I) {
+		stream << "      {\"initialize_ms\": " << I->initializeMilliseconds << ", \"compute_costs_ms\": " << I->computeCostsMilliseconds << ", \"levels\": [";
+		for (std::vector<LevelMeasurement>::const_iterator J = I->levels.begin(); J != I->levels.end(); ++J) {
+			if (J != I->levels.begin()) {
+				stream << ", ";
+			}
+			stream << "{\"ms\": " << J->milliseconds << ", \"vertices\": " << J->vertexCount << ", \"generator_bytes\": " << J->generatorBytes << ", \"max_rss_kb\": " << J->maxResidentKilobytes << "}";
+		}
+		stream << "]}";
+		if (I + 1 != runs.end()) {
+			stream << ",";
+		}
+		stream << std::endl;
+	}
+	stream << "    ]}";
+}
+
+bool run(const BenchmarkSettings& settings, std::ostream& stream)
+{
+	std::vector<std::string> meshPaths;
+	collectMeshPaths(settings.meshPaths, meshPaths);
+	if (meshPaths.empty()) {
+		std::cerr << "No meshes found." << std::endl;
+		return false;
+	}
+
+	stream << "{" << std::endl;
+	stream << "  \"benchmark\": \"lod\"," << std::endl;
+	stream << "  \"settings\": {\"iterations\": " << settings.iterations << "}," << std::endl;
+	stream << "  \"meshes\": [" << std::endl;
+	bool first = true;
+	for (std::vector<std::string>::const_iterator I = meshPaths.begin(); I != meshPaths.end(); ++I) {
+		Ogre::MeshPtr mesh = loadMesh(*I);
+		if (mesh.isNull()) {
+			continue;
+		}
+		std::vector<RunMeasurement> runs(settings.iterations);
+		for (int i = 0; i < settings.iterations; ++i) {
+			LodConfig lodConfig;
+			createAutomaticLodConfig(mesh, lodConfig);
+			BenchmarkMeshGenerator generator;
+			generator.run(mesh, lodConfig, runs[i]);
+		}
+		size_t vertexCount = 0;
+		if (mesh->sharedVertexData) {
+			vertexCount += mesh->sharedVertexData->vertexCount;
+		}
+		for (unsigned short i = 0; i < mesh->getNumSubMeshes(); ++i) {
+			Ogre::SubMesh* submesh = mesh->getSubMesh(i);
+			if (!submesh->useSharedVertices) {
+				vertexCount += submesh->vertexData->vertexCount;
+			}
+		}
+		Ogre::MeshManager::getSingleton().remove(mesh->getHandle());
+
+		if (!first) {
+			stream << "," << std::endl;
+		}
+		first = false;
+		writeMesh(stream, *I, vertexCount, runs);
+	}
+	stream << std::endl << "  ]" << std::endl;
+	stream << "}" << std::endl;
+	return true;
+}
+
+bool parseSettings(int argc, char **argv, BenchmarkSettings& settings)
+{
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument(argv[i]);
+		if (argument.compare(0, 2, "--") != 0) {
+			settings.meshPaths.push_back(argument);
+			continue;
+		}
+		if (i + 1 >= argc) {
+			std::cerr << "Missing value for " << argument << "." << std::endl;
+			return false;
+		}
+		const std::string value(argv[++i]);
+		if (argument == "--iterations") {
+			settings.iterations = std::atoi(value.c_str());
+		} else if (argument == "--output") {
+			settings.outputPath = value;
+		} else {
+			std::cerr << "Unknown argument " << argument << "." << std::endl;
+			return false;
+		}
+	}
+	if (settings.iterations < 1 || settings.meshPaths.empty()) {
+		std::cerr << "Invalid settings; at least one mesh file or directory is needed, and iterations must be at least 1." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+}
+
+int main(int argc, char **argv)
+{
+	Ember::BenchmarkSettings settings;
+	if (!Ember::parseSettings(argc, argv, settings)) {
+		return 1;
+	}
+
+	Ogre::Root root;
+	//Hardware buffers are kept in system memory, since there's no render system.
+	Ogre::DefaultHardwareBufferManager bufferManager;
+
+	if (settings.outputPath.empty()) {
+		return Ember::run(settings, std::cout) ? 0 : 1;
+	}
+	std::ofstream stream(settings.outputPath.c_str());
+	if (!stream) {
+		std::cerr << "Could not open " << settings.outputPath << " for writing." << std::endl;
+		return 1;
+	}
+	return Ember::run(settings, stream) ? 0 : 1;
+}
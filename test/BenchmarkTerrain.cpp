@@ -0,0 +1,793 @@
+/*
+ Copyright (C) 2013 Erik Ogenvik
+
+ This program is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program; if not, write to the Free Software
+ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/**
+ * A headless benchmark of the terrain pipeline.
+ *
+ * The terrain is set up without any window or GPU, using a compiler technique provider which doesn't create any materials and page bridges which don't create any geometry.
+ * Each phase of the pipeline is timed separately, and the results are written as JSON so that they can be compared between commits.
+ *
+ * Usage: BenchmarkTerrain [--pages <n>] [--page-size <n>] [--iterations <n>] [--seed <n>] [--points <file>] [--output <file>]
+ *
+ * --pages: The number of pages along each side of the synthetic terrain. Must be even. Default is 4.
+ * --page-size: The size of each page in indices; must be 2^n+1. Default is 129.
+ * --iterations: The number of times each repeatable phase is run. Default is 5.
+ * --seed: The seed used for generating the synthetic terrain, areas and mods. Default is 1.
+ * --points: A file with recorded base points to use instead of synthetic ones, with one "x y height" triplet per line. Lines starting with "#" are ignored.
+ * --output: The file to write the results to. If omitted, the results are written to stdout.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "components/ogre/terrain/ICompilerTechniqueProvider.h"
+#include "components/ogre/terrain/ITerrainPageBridge.h"
+#include "components/ogre/terrain/TerrainHandler.h"
+#include "components/ogre/terrain/Types.h"
+#include "components/ogre/terrain/TerrainDefPoint.h"
+#include "components/ogre/terrain/TerrainInfo.h"
+#include "components/ogre/terrain/TerrainMod.h"
+#include "components/ogre/terrain/TerrainPage.h"
+#include "components/ogre/terrain/TerrainPageGeometry.h"
+#include "components/ogre/terrain/TerrainPageShadow.h"
+#include "components/ogre/terrain/TerrainShader.h"
+#include "components/ogre/terrain/TerrainLayerDefinition.h"
+#include "components/ogre/terrain/TerrainLayerDefinitionManager.h"
+#include "components/ogre/terrain/TerrainAreaAddTask.h"
+#include "components/ogre/terrain/TerrainAreaRemoveTask.h"
+#include "components/ogre/terrain/PlantAreaQuery.h"
+#include "components/ogre/terrain/PlantAreaQueryResult.h"
+#include "components/ogre/terrain/foliage/ClusterPopulator.h"
+#include "components/ogre/Convert.h"
+
+#include "framework/TimeFrame.h"
+#include "framework/tasks/TemplateNamedTask.h"
+#include "framework/tasks/TaskQueue.h"
+
+#include <Eris/Entity.h>
+
+#include <Atlas/Message/Element.h>
+
+#include <Mercator/Area.h>
+#include <Mercator/FillShader.h>
+#include <Mercator/ThresholdShader.h>
+#include <Mercator/GrassShader.h>
+
+#include <wfmath/atlasconv.h>
+#include <wfmath/polygon.h>
+#include <wfmath/randgen.h>
+
+#include <Ogre.h>
+#include <sigc++/signal.h>
+#include <sigc++/trackable.h>
+#include <sigc++/adaptors/hide.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Ember::OgreView;
+using namespace Ember::OgreView::Terrain;
+using namespace Ember::Domain;
+
+namespace Ember
+{
+
+/**
+ * @brief Doesn't create any techniques, so no materials are compiled.
+ */
+class NullCompilerTechniqueProvider: public ICompilerTechniqueProvider
+{
+public:
+	virtual TerrainPageSurfaceCompilerTechnique* createTechnique(const TerrainPageGeometryPtr& geometry, const SurfaceLayerStore& terrainPageSurfaces, const TerrainPageShadow* terrainPageShadow) const
+	{
+		return 0;
+	}
+};
+
+/**
+ * @brief Doesn't create any geometry, but keeps track of whether the page is ready.
+ */
+class BenchmarkTerrainBridge: public ITerrainPageBridge
+{
+public:
+	bool pageReady;
+
+	BenchmarkTerrainBridge() :
+		pageReady(false)
+	{
+	}
+
+	virtual void updateTerrain(TerrainPageGeometry& geometry)
+	{
+	}
+
+	virtual void terrainPageReady()
+	{
+		pageReady = true;
+	}
+
+	virtual void terrainPageUpdated()
+	{
+	}
+};
+
+/**
+ * @brief An entity which isn't attached to any view, used for holding terrain mods.
+ */
+class BenchmarkEntity: public Eris::Entity
+{
+public:
+	BenchmarkEntity(const std::string& id) :
+		Eris::Entity(id, 0)
+	{
+	}
+
+	Eris::TypeService* getTypeService() const
+	{
+		return 0;
+	}
+
+	void removeFromMovementPrediction()
+	{
+	}
+
+	void addToMovementPredition()
+	{
+	}
+
+	Eris::Entity* getEntity(const std::string& id)
+	{
+		return 0;
+	}
+
+	void setAttr(const std::string &p, const Atlas::Message::Element &v)
+	{
+		Eris::Entity::setAttr(p, v);
+	}
+};
+
+/**
+ * @brief A task which does nothing but flag when it's been processed in the main thread.
+ */
+class IdleMarkerTask: public Tasks::TemplateNamedTask<IdleMarkerTask>
+{
+public:
+	IdleMarkerTask(bool& processed) :
+		mProcessed(processed)
+	{
+	}
+
+	virtual void executeTaskInBackgroundThread(Tasks::TaskExecutionContext& context)
+	{
+	}
+
+	virtual void executeTaskInMainThread()
+	{
+		mProcessed = true;
+	}
+
+private:
+	bool& mProcessed;
+};
+
+/**
+ * @brief Exposes what's needed for driving the terrain handler without any entities or scene.
+ */
+class BenchmarkTerrainHandler: public Terrain::TerrainHandler
+{
+public:
+
+	BenchmarkTerrainHandler(int pageIndexSize, ICompilerTechniqueProvider& compilerTechniqueProvider) :
+		Terrain::TerrainHandler(pageIndexSize, compilerTechniqueProvider), mActivityCount(0)
+	{
+		EventWorldSizeChanged.connect(sigc::mem_fun(*this, &BenchmarkTerrainHandler::registerActivity));
+		EventBeforeTerrainUpdate.connect(sigc::hide(sigc::hide(sigc::mem_fun(*this, &BenchmarkTerrainHandler::registerActivity))));
+		EventAfterTerrainUpdate.connect(sigc::hide(sigc::hide(sigc::mem_fun(*this, &BenchmarkTerrainHandler::registerActivity))));
+		EventLayerUpdated.connect(sigc::hide(sigc::hide(sigc::mem_fun(*this, &BenchmarkTerrainHandler::registerActivity))));
+	}
+
+	const PageVector& getPages() const
+	{
+		return mPages;
+	}
+
+	/**
+	 * @brief Adds an area directly, in the same way as addArea() does for areas belonging to entities.
+	 * @param area The area. Ownership is transferred.
+	 * @param id A unique id for the area.
+	 */
+	void addMercatorArea(Mercator::Area* area, const std::string& id)
+	{
+		mTaskQueue->enqueueTask(new TerrainAreaAddTask(*mTerrain, area, sigc::mem_fun(*this, &BenchmarkTerrainHandler::markShaderForUpdate), *this, TerrainLayerDefinitionManager::getSingleton(), mAreaShaders, mAreas, id));
+	}
+
+	/**
+	 * @brief Removes all areas added through addMercatorArea().
+	 */
+	void removeAllAreas()
+	{
+		for (AreaMap::const_iterator I = mAreas.begin(); I != mAreas.end(); ++I) {
+			Mercator::Area* area = I->second;
+			const TerrainShader* shader = 0;
+			if (mAreaShaders.count(area->getLayer())) {
+				shader = mAreaShaders[area->getLayer()];
+			}
+			mTaskQueue->enqueueTask(new TerrainAreaRemoveTask(*mTerrain, area, sigc::mem_fun(*this, &BenchmarkTerrainHandler::markShaderForUpdate), shader, mAreas, I->first));
+		}
+	}
+
+	/**
+	 * @brief Polls the handler until all work has been done.
+	 *
+	 * The task queue of the handler has a single executor, so once a marker task has been processed, so have all tasks enqueued before it.
+	 * Since processed tasks can enqueue new tasks this is repeated until a full round passes without any activity.
+	 */
+	void waitUntilIdle()
+	{
+		unsigned int activityCount;
+		do {
+			activityCount = mActivityCount;
+			bool markerProcessed = false;
+			mTaskQueue->enqueueTask(new IdleMarkerTask(markerProcessed));
+			while (!markerProcessed) {
+				mTaskQueue->pollProcessedTasks(TimeFrame(boost::posix_time::milliseconds(10)));
+				//Shader updates are batched, and only enqueued by pollTasks().
+				if (!mShadersToUpdate.empty()) {
+					registerActivity();
+				}
+				pollTasks(TimeFrame(boost::posix_time::milliseconds(0)));
+			}
+		} while (activityCount != mActivityCount);
+	}
+
+private:
+	unsigned int mActivityCount;
+
+	void registerActivity()
+	{
+		mActivityCount++;
+	}
+};
+
+/**
+ * @brief Collects the timings of all phases, and writes them as JSON.
+ */
+class BenchmarkResults
+{
+public:
+
+	void addSetting(const std::string& name, long value)
+	{
+		mSettings.push_back(std::make_pair(name, value));
+	}
+
+	void addTiming(const std::string& phase, double milliseconds)
+	{
+		if (!mTimings.count(phase)) {
+			mPhaseOrder.push_back(phase);
+		}
+		mTimings[phase].push_back(milliseconds);
+	}
+
+	void addCounter(const std::string& name, long value)
+	{
+		mCounters.push_back(std::make_pair(name, value));
+	}
+
+	void write(std::ostream& stream) const
+	{
+		stream << "{" << std::endl;
+		stream << "  \"benchmark\": \"terrain\"," << std::endl;
+		stream << "  \"settings\": {";
+		writeValues(stream, mSettings);
+		stream << "}," << std::endl;
+		stream << "  \"phases\": {" << std::endl;
+		for (std::vector<std::string>::const_iterator I = mPhaseOrder.begin(); I != mPhaseOrder.end(); ++I) {
+			const std::vector<double>& timings = mTimings.find(*I)->second;
+			double total = 0;
+			for (std::vector<double>::const_iterator J = timings.begin(); J != timings.end(); ++J) {
+				total += *J;
+			}
+			stream << "    \"" << *I << "\": {\"iterations\": " << timings.size();
+			stream << ", \"min_ms\": " << *std::min_element(timings.begin(), timings.end());
+			stream << ", \"mean_ms\": " << (total / timings.size());
+			stream << ", \"max_ms\": " << *std::max_element(timings.begin(), timings.end());
+			stream << ", \"total_ms\": " << total << "}";
+			if (I + 1 != mPhaseOrder.end()) {
+				stream << ",";
+			}
+			stream << std::endl;
+		}
+		stream << "  }," << std::endl;
+		stream << "  \"counters\": {";
+		writeValues(stream, mCounters);
+		stream << "}" << std::endl;
+		stream << "}" << std::endl;
+	}
+
+private:
+	typedef std::vector<std::pair<std::string, long>> ValueStore;
+
+	ValueStore mSettings;
+	std::vector<std::string> mPhaseOrder;
+	std::map<std::string, std::vector<double>> mTimings;
+	ValueStore mCounters;
+
+	static void writeValues(std::ostream& stream, const ValueStore& values)
+	{
+		for (ValueStore::const_iterator I = values.begin(); I != values.end(); ++I) {
+			if (I != values.begin()) {
+				stream << ", ";
+			}
+			stream << "\"" << I->first << "\": " << I->second;
+		}
+	}
+};
+
+/**
+ * @brief Measures the wall clock time since it was created.
+ */
+class Stopwatch
+{
+public:
+	Stopwatch() :
+		mStart(boost::posix_time::microsec_clock::local_time())
+	{
+	}
+
+	double getElapsedMilliseconds() const
+	{
+		return (boost::posix_time::microsec_clock::local_time() - mStart).total_microseconds() / 1000.0;
+	}
+
+private:
+	boost::posix_time::ptime mStart;
+};
+
+struct BenchmarkSettings
+{
+	BenchmarkSettings() :
+		pages(4), pageIndexSize(129), iterations(5), seed(1)
+	{
+	}
+
+	int pages;
+	int pageIndexSize;
+	int iterations;
+	unsigned int seed;
+	std::string pointsPath;
+	std::string outputPath;
+};
+
+class TerrainBenchmark
+{
+public:
+
+	TerrainBenchmark(const BenchmarkSettings& settings) :
+		mSettings(settings), mHandler(settings.pageIndexSize, mCompilerTechniqueProvider), mRandom(settings.seed), mAreaCount(0), mPlantType("grass"), mGrassShader(0), mPlantCount(0), mPlantQueryCount(0)
+	{
+	}
+
+	~TerrainBenchmark()
+	{
+		//Areas and mods must all be removed before the handler is destroyed.
+		for (std::vector<Terrain::TerrainMod*>::iterator I = mMods.begin(); I != mMods.end(); ++I) {
+			delete *I;
+		}
+		for (std::vector<BenchmarkEntity*>::iterator I = mEntities.begin(); I != mEntities.end(); ++I) {
+			(*I)->shutdown();
+			delete *I;
+		}
+		mHandler.removeAllAreas();
+		mHandler.waitUntilIdle();
+	}
+
+	bool run(BenchmarkResults& results)
+	{
+		createLayers();
+
+		TerrainDefPointStore terrainDefPoints;
+		if (!mSettings.pointsPath.empty()) {
+			if (!loadPoints(mSettings.pointsPath, terrainDefPoints)) {
+				return false;
+			}
+		} else {
+			createPoints(terrainDefPoints);
+		}
+
+		{
+			Stopwatch stopwatch;
+			mHandler.updateTerrain(terrainDefPoints);
+			mHandler.waitUntilIdle();
+			results.addTiming("terrain_definition", stopwatch.getElapsedMilliseconds());
+		}
+
+		{
+			Stopwatch stopwatch;
+			createPages();
+			mHandler.waitUntilIdle();
+			results.addTiming("page_creation", stopwatch.getElapsedMilliseconds());
+		}
+		for (std::vector<BenchmarkTerrainBridge*>::const_iterator I = mBridges.begin(); I != mBridges.end(); ++I) {
+			if (!(*I)->pageReady) {
+				std::cerr << "Not all pages were created." << std::endl;
+				return false;
+			}
+		}
+
+		{
+			Stopwatch stopwatch;
+			createAreas();
+			mHandler.waitUntilIdle();
+			results.addTiming("area_add", stopwatch.getElapsedMilliseconds());
+		}
+
+		{
+			Stopwatch stopwatch;
+			createMods();
+			mHandler.waitUntilIdle();
+			results.addTiming("mod_add", stopwatch.getElapsedMilliseconds());
+		}
+
+		for (int i = 0; i < mSettings.iterations; ++i) {
+			{
+				Stopwatch stopwatch;
+				reloadAllPages();
+				mHandler.waitUntilIdle();
+				results.addTiming("geometry_update", stopwatch.getElapsedMilliseconds());
+			}
+			{
+				Stopwatch stopwatch;
+				mHandler.updateAllPages();
+				mHandler.waitUntilIdle();
+				results.addTiming("shader_update", stopwatch.getElapsedMilliseconds());
+			}
+			{
+				Stopwatch stopwatch;
+				updateShadows();
+				results.addTiming("shadow_generation", stopwatch.getElapsedMilliseconds());
+			}
+			{
+				mPlantCount = 0;
+				mPlantQueryCount = 0;
+				Stopwatch stopwatch;
+				if (!queryPlants()) {
+					return false;
+				}
+				results.addTiming("plant_query", stopwatch.getElapsedMilliseconds());
+			}
+		}
+
+		results.addCounter("base_points", terrainDefPoints.size());
+		results.addCounter("pages", mHandler.getPages().size());
+		results.addCounter("shaders", mHandler.getAllShaders().size());
+		results.addCounter("areas", mAreaCount);
+		results.addCounter("mods", mMods.size());
+		results.addCounter("plant_queries", mPlantQueryCount);
+		results.addCounter("plants", mPlantCount);
+		return true;
+	}
+
+private:
+	const BenchmarkSettings& mSettings;
+	NullCompilerTechniqueProvider mCompilerTechniqueProvider;
+	BenchmarkTerrainHandler mHandler;
+	WFMath::MTRand mRandom;
+	std::vector<BenchmarkTerrainBridge*> mBridges;
+	std::vector<BenchmarkEntity*> mEntities;
+	std::vector<Terrain::TerrainMod*> mMods;
+	size_t mAreaCount;
+
+	/**
+	 * @brief The plant type used for queries. This needs to outlive the queries, since they only keep a reference to it.
+	 */
+	const std::string mPlantType;
+	const TerrainShader* mGrassShader;
+	long mPlantCount;
+	long mPlantQueryCount;
+
+	static TerrainLayerDefinition* createDefinition(const std::string& name, const std::string& shaderName, unsigned int areaId)
+	{
+		TerrainLayerDefinition* definition = new TerrainLayerDefinition();
+		definition->setName(name);
+		definition->setShaderName(shaderName);
+		definition->setAreaId(areaId);
+		TerrainLayerDefinitionManager::getSingleton().addDefinition(definition);
+		return definition;
+	}
+
+	/**
+	 * @brief Creates the same base shaders as TerrainShaderParser::createDefaultShaders(), along with a layer used by areas.
+	 */
+	void createLayers()
+	{
+		mHandler.createShader(createDefinition("Rock", "rock", 0), new Mercator::FillShader());
+		mHandler.createShader(createDefinition("Sand", "sand", 0), new Mercator::BandShader(-2.f, 1.5f));
+		mGrassShader = mHandler.createShader(createDefinition("Grass", "grass", 0), new Mercator::GrassShader(1.f, 80.f, .5f, 1.f));
+		createDefinition("Dirt", "", 7);
+	}
+
+	void createPoints(TerrainDefPointStore& terrainDefPoints)
+	{
+		//Base points are placed 64 meters apart.
+		const int extent = (mSettings.pages * (mSettings.pageIndexSize - 1)) / 128;
+		for (int x = -extent; x <= extent; ++x) {
+			for (int y = -extent; y <= extent; ++y) {
+				terrainDefPoints.push_back(TerrainDefPoint(x, y, mRandom.rand(80.0) - 10.0));
+			}
+		}
+	}
+
+	static bool loadPoints(const std::string& path, TerrainDefPointStore& terrainDefPoints)
+	{
+		std::ifstream stream(path.c_str());
+		if (!stream) {
+			std::cerr << "Could not open points file " << path << "." << std::endl;
+			return false;
+		}
+		std::string line;
+		while (std::getline(stream, line)) {
+			if (line.empty() || line[0] == '#') {
+				continue;
+			}
+			std::istringstream lineStream(line);
+			float x, y, height;
+			if (!(lineStream >> x >> y >> height)) {
+				std::cerr << "Malformed line in points file: " << line << std::endl;
+				return false;
+			}
+			terrainDefPoints.push_back(TerrainDefPoint(x, y, height));
+		}
+		return !terrainDefPoints.empty();
+	}
+
+	void createPages()
+	{
+		//See TerrainPage for how page indices map to world extents.
+		const WFMath::AxisBox<2>& pagesExtent = mHandler.getTerrainInfo().getWorldSizeInPages();
+		for (int x = static_cast<int>(pagesExtent.lowCorner().x()); x < static_cast<int>(pagesExtent.highCorner().x()); ++x) {
+			for (int y = static_cast<int>(pagesExtent.lowCorner().y()) + 1; y <= static_cast<int>(pagesExtent.highCorner().y()); ++y) {
+				BenchmarkTerrainBridge* bridge = new BenchmarkTerrainBridge();
+				mBridges.push_back(bridge);
+				mHandler.setUpTerrainPageAtIndex(TerrainIndex(x, y), bridge);
+			}
+		}
+	}
+
+	WFMath::Point<2> getRandomPosition()
+	{
+		const WFMath::AxisBox<2>& worldExtent = mHandler.getTerrainInfo().getWorldSizeInIndices();
+		return WFMath::Point<2>(worldExtent.lowCorner().x() + mRandom.rand(worldExtent.highCorner().x() - worldExtent.lowCorner().x()), worldExtent.lowCorner().y() + mRandom.rand(worldExtent.highCorner().y() - worldExtent.lowCorner().y()));
+	}
+
+	/**
+	 * @brief Adds one area per page, all on the same layer.
+	 */
+	void createAreas()
+	{
+		mAreaCount = mHandler.getPages().size();
+		for (size_t i = 0; i < mAreaCount; ++i) {
+			const WFMath::Point<2> center = getRandomPosition();
+			const float size = 10.0f + mRandom.rand(30.0);
+			WFMath::Polygon<2> polygon;
+			polygon.addCorner(0, center + WFMath::Vector<2>(-size, -size));
+			polygon.addCorner(1, center + WFMath::Vector<2>(-size, size));
+			polygon.addCorner(2, center + WFMath::Vector<2>(size, size));
+			polygon.addCorner(3, center + WFMath::Vector<2>(size, -size));
+
+			Mercator::Area* area = new Mercator::Area(7, false);
+			area->setShape(polygon);
+			std::stringstream ss;
+			ss << "area" << i;
+			mHandler.addMercatorArea(area, ss.str());
+		}
+	}
+
+	/**
+	 * @brief Adds one mod per page, alternating between level and adjust mods.
+	 */
+	void createMods()
+	{
+		const size_t numberOfMods = mHandler.getPages().size();
+		for (size_t i = 0; i < numberOfMods; ++i) {
+			std::stringstream ss;
+			ss << "mod" << i;
+			BenchmarkEntity* entity = new BenchmarkEntity(ss.str());
+			mEntities.push_back(entity);
+			const WFMath::Point<2> position = getRandomPosition();
+			entity->setAttr("pos", WFMath::Point<3>(position.x(), position.y(), 0).toAtlas());
+
+			const float size = 5.0f + mRandom.rand(15.0);
+			Atlas::Message::ListType polygon;
+			polygon.push_back(WFMath::Point<2>(-size, -size).toAtlas());
+			polygon.push_back(WFMath::Point<2>(-size, size).toAtlas());
+			polygon.push_back(WFMath::Point<2>(size, size).toAtlas());
+			polygon.push_back(WFMath::Point<2>(size, -size).toAtlas());
+
+			Atlas::Message::MapType shape;
+			shape["points"] = polygon;
+			shape["type"] = "polygon";
+
+			Atlas::Message::MapType mod;
+			mod["shape"] = shape;
+			mod["type"] = (i % 2) ? "adjustmod" : "levelmod";
+			mod["heightoffset"] = mRandom.rand(10.0);
+			entity->setAttr("terrainmod", mod);
+
+			Terrain::TerrainMod* terrainMod = new Terrain::TerrainMod(*entity);
+			terrainMod->init();
+			mMods.push_back(terrainMod);
+			mHandler.addTerrainMod(terrainMod);
+		}
+	}
+
+	void reloadAllPages()
+	{
+		std::vector<WFMath::AxisBox<2>> areas;
+		for (PageVector::const_iterator I = mHandler.getPages().begin(); I != mHandler.getPages().end(); ++I) {
+			areas.push_back((*I)->getWorldExtent());
+		}
+		mHandler.reloadTerrain(areas);
+	}
+
+	/**
+	 * @brief Generates shadows for all pages in the main thread, since the handler currently doesn't do it at all.
+	 */
+	void updateShadows()
+	{
+		SimpleTerrainPageShadowTechnique technique;
+		const WFMath::Vector<3> lightDirection = WFMath::Vector<3>(-1, 1, 1).normalize();
+		for (PageVector::const_iterator I = mHandler.getPages().begin(); I != mHandler.getPages().end(); ++I) {
+			TerrainPageGeometry geometry(**I, mHandler.getSegmentManager(), mHandler.getDefaultHeight());
+			geometry.repopulate();
+			TerrainPageShadow shadow(**I);
+			shadow.setShadowTechnique(&technique);
+			shadow.setLightDirection(lightDirection);
+			shadow.updateShadow(geometry);
+		}
+	}
+
+	/**
+	 * @brief Queries the grass layer for each segment of each page, like the foliage does.
+	 * @return False if not all queries were answered in time.
+	 */
+	bool queryPlants()
+	{
+		Foliage::ClusterPopulator populator(mGrassShader->getTerrainIndex(), new Foliage::UniformScaler(0.5f, 1.0f), 0);
+		populator.setMinClusterRadius(2);
+		populator.setMaxClusterRadius(10);
+		populator.setClusterDistance(25);
+		populator.setDensity(1.5f);
+		populator.setFalloff(0.6f);
+		populator.setThreshold(100);
+
+		long expectedQueryCount = mPlantQueryCount;
+		for (PageVector::const_iterator I = mHandler.getPages().begin(); I != mHandler.getPages().end(); ++I) {
+			const WFMath::AxisBox<2>& pageExtent = (*I)->getWorldExtent();
+			for (float x = pageExtent.lowCorner().x(); x < pageExtent.highCorner().x(); x += 64) {
+				for (float y = pageExtent.lowCorner().y(); y < pageExtent.highCorner().y(); y += 64) {
+					const WFMath::AxisBox<2> area(WFMath::Point<2>(x, y), WFMath::Point<2>(x + 64, y + 64));
+					PlantAreaQuery query(mGrassShader->getLayerDefinition(), mPlantType, Convert::toOgre(area), Ogre::Vector2(x + 32, -(y + 32)));
+					mHandler.getPlantsForArea(populator, query, sigc::mem_fun(*this, &TerrainBenchmark::plantsReceived));
+					expectedQueryCount++;
+				}
+			}
+		}
+		//The populator is used by the queries, so we need to wait here. Queries are batched and populated outside of the terrain queue, so wait for the results themselves.
+		const boost::posix_time::ptime deadline = boost::posix_time::microsec_clock::local_time() + boost::posix_time::seconds(60);
+		while (mPlantQueryCount < expectedQueryCount && boost::posix_time::microsec_clock::local_time() < deadline) {
+			mHandler.pollTasks(TimeFrame(boost::posix_time::milliseconds(10)));
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		mHandler.waitUntilIdle();
+		if (mPlantQueryCount < expectedQueryCount) {
+			std::cerr << "Only " << mPlantQueryCount << " of " << expectedQueryCount << " plant queries were answered in time." << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	void plantsReceived(const PlantAreaQueryResult& result)
+	{
+		mPlantQueryCount++;
+		mPlantCount += result.getStore().size();
+	}
+};
+
+bool parseSettings(int argc, char **argv, BenchmarkSettings& settings)
+{
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument(argv[i]);
+		if (i + 1 >= argc) {
+			std::cerr << "Missing value for " << argument << "." << std::endl;
+			return false;
+		}
+		const std::string value(argv[++i]);
+		if (argument == "--pages") {
+			settings.pages = std::atoi(value.c_str());
+		} else if (argument == "--page-size") {
+			settings.pageIndexSize = std::atoi(value.c_str());
+		} else if (argument == "--iterations") {
+			settings.iterations = std::atoi(value.c_str());
+		} else if (argument == "--seed") {
+			settings.seed = std::strtoul(value.c_str(), 0, 10);
+		} else if (argument == "--points") {
+			settings.pointsPath = value;
+		} else if (argument == "--output") {
+			settings.outputPath = value;
+		} else {
+			std::cerr << "Unknown argument " << argument << "." << std::endl;
+			return false;
+		}
+	}
+	if (settings.pages < 2 || settings.pages % 2 || settings.pageIndexSize < 65 || settings.iterations < 1) {
+		std::cerr << "Invalid settings; pages must be even, page-size at least 65 and iterations at least 1." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+}
+
+int main(int argc, char **argv)
+{
+	Ember::BenchmarkSettings settings;
+	if (!Ember::parseSettings(argc, argv, settings)) {
+		return 1;
+	}
+
+	Ogre::Root root;
+	Ember::OgreView::Terrain::TerrainLayerDefinitionManager terrainLayerDefinitionManager;
+
+	Ember::BenchmarkResults results;
+	results.addSetting("pages", settings.pages);
+	results.addSetting("page_size", settings.pageIndexSize);
+	results.addSetting("iterations", settings.iterations);
+	results.addSetting("seed", settings.seed);
+	results.addSetting("recorded_points", settings.pointsPath.empty() ? 0 : 1);
+
+	{
+		Ember::TerrainBenchmark benchmark(settings);
+		if (!benchmark.run(results)) {
+			return 1;
+		}
+	}
+
+	if (settings.outputPath.empty()) {
+		results.write(std::cout);
+	} else {
+		std::ofstream stream(settings.outputPath.c_str());
+		if (!stream) {
+			std::cerr << "Could not open " << settings.outputPath << " for writing." << std::endl;
+			return 1;
+		}
+		results.write(stream);
+	}
+	return 0;
+}
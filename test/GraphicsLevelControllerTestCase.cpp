@@ -0,0 +1,137 @@
+#include "GraphicsLevelControllerTestCase.h"
+
+#include "components/ogre/GraphicsLevelController.h"
+#include "components/ogre/GraphicalChangeAdapter.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace Ember::OgreView;
+
+namespace Ember
+{
+
+/**
+ * @brief A simulated subsystem, where each level of detail adds a fixed cost to the frame.
+ */
+class TestSubsystem
+{
+public:
+	TestSubsystem(float cpuCost, float gpuCost, int level, int maxLevel) :
+			cpuCost(cpuCost), gpuCost(gpuCost), level(level), maxLevel(maxLevel)
+	{
+	}
+
+	bool changeLevel(float change)
+	{
+		if (change > 0 && level > 0) {
+			level--;
+			return true;
+		} else if (change < 0 && level < maxLevel) {
+			level++;
+			return true;
+		}
+		return false;
+	}
+
+	float cpuCost;
+	float gpuCost;
+	int level;
+	int maxLevel;
+};
+
+namespace
+{
+FrameTimeStatistics simulate(float cpuBase, float gpuBase, const std::vector<TestSubsystem*>& subsystems)
+{
+	FrameTimeStatistics statistics;
+	statistics.cpuTime = cpuBase;
+	statistics.gpuTime = gpuBase;
+	for (std::vector<TestSubsystem*>::const_iterator I = subsystems.begin(); I != subsystems.end(); ++I) {
+		statistics.cpuTime += (*I)->cpuCost * (*I)->level;
+		statistics.gpuTime += (*I)->gpuCost * (*I)->level;
+	}
+	statistics.frameTime = statistics.cpuTime + statistics.gpuTime;
+	statistics.frames = 100;
+	return statistics;
+}
+}
+
+void GraphicsLevelControllerTestCase::testPercentile()
+{
+	std::vector<float> samples;
+	CPPUNIT_ASSERT_EQUAL(0.0f, GraphicsLevelController::calculatePercentile(samples, 0.95f));
+
+	for (int i = 100; i > 0; --i) {
+		samples.push_back(i);
+	}
+	std::random_shuffle(samples.begin(), samples.end());
+	CPPUNIT_ASSERT_EQUAL(95.0f, GraphicsLevelController::calculatePercentile(samples, 0.95f));
+	CPPUNIT_ASSERT_EQUAL(100.0f, GraphicsLevelController::calculatePercentile(samples, 1.0f));
+	CPPUNIT_ASSERT_EQUAL(1.0f, GraphicsLevelController::calculatePercentile(samples, 0.0f));
+}
+
+void GraphicsLevelControllerTestCase::testLowerDetail()
+{
+	GraphicalChangeAdapter adapter;
+	//The frames are GPU bound, and "expensive" costs much more on the GPU than "cheap".
+	TestSubsystem cheap(0.5f, 0.5f, 4, 4);
+	TestSubsystem expensive(0.5f, 4.0f, 4, 4);
+	adapter.connectSubsystem("cheap", sigc::mem_fun(cheap, &TestSubsystem::changeLevel));
+	adapter.connectSubsystem("expensive", sigc::mem_fun(expensive, &TestSubsystem::changeLevel));
+	std::vector<TestSubsystem*> subsystems;
+	subsystems.push_back(&cheap);
+	subsystems.push_back(&expensive);
+
+	GraphicsLevelController controller(adapter);
+	controller.setTargetFrameTime(20.0f);
+
+	for (int i = 0; i < 30; ++i) {
+		controller.update(simulate(5.0f, 5.0f, subsystems));
+	}
+
+	//The target should be reached, mainly by lowering the expensive subsystem.
+	CPPUNIT_ASSERT(simulate(5.0f, 5.0f, subsystems).frameTime <= 20.0f * 1.1f);
+	CPPUNIT_ASSERT(expensive.level < cheap.level);
+
+	float cpuGain, gpuGain;
+	CPPUNIT_ASSERT(controller.getMeasuredGain("expensive", cpuGain, gpuGain));
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0f, gpuGain, 0.01f);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5f, cpuGain, 0.01f);
+
+	//Once the target has been reached the levels should stay put.
+	int cheapLevel = cheap.level;
+	int expensiveLevel = expensive.level;
+	for (int i = 0; i < 30; ++i) {
+		controller.update(simulate(5.0f, 5.0f, subsystems));
+	}
+	CPPUNIT_ASSERT_EQUAL(cheapLevel, cheap.level);
+	CPPUNIT_ASSERT_EQUAL(expensiveLevel, expensive.level);
+}
+
+void GraphicsLevelControllerTestCase::testRaiseDetail()
+{
+	GraphicalChangeAdapter adapter;
+	TestSubsystem subsystem(1.0f, 1.0f, 0, 10);
+	adapter.connectSubsystem("subsystem", sigc::mem_fun(subsystem, &TestSubsystem::changeLevel));
+	std::vector<TestSubsystem*> subsystems;
+	subsystems.push_back(&subsystem);
+
+	GraphicsLevelController controller(adapter);
+	controller.setTargetFrameTime(20.0f);
+
+	//Detail should not be raised right away.
+	controller.update(simulate(2.0f, 2.0f, subsystems));
+	CPPUNIT_ASSERT_EQUAL(0, subsystem.level);
+
+	for (int i = 0; i < 100; ++i) {
+		controller.update(simulate(2.0f, 2.0f, subsystems));
+	}
+
+	//Detail should be raised as long as there's room left, but never so much that the target is exceeded.
+	float frameTime = simulate(2.0f, 2.0f, subsystems).frameTime;
+	CPPUNIT_ASSERT(subsystem.level > 0);
+	CPPUNIT_ASSERT(frameTime < 20.0f);
+	CPPUNIT_ASSERT(frameTime + 2.0f >= 20.0f * (1.0f - 0.1f));
+}
+}
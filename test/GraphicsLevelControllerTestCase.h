@@ -0,0 +1,16 @@
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace Ember {
+	class GraphicsLevelControllerTestCase : public CppUnit::TestFixture {
+		CPPUNIT_TEST_SUITE(GraphicsLevelControllerTestCase);
+		CPPUNIT_TEST(testPercentile);
+		CPPUNIT_TEST(testLowerDetail);
+		CPPUNIT_TEST(testRaiseDetail);
+		CPPUNIT_TEST_SUITE_END();
+
+	public:
+		void testPercentile();
+		void testLowerDetail();
+		void testRaiseDetail();
+	};
+}
@@ -0,0 +1,362 @@
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/TestResult.h>
+
+#include "components/ogre/ogreopcode/include/OgreDynamicAABBTree.h"
+#include "components/ogre/ogreopcode/include/OgreCollisionManager.h"
+#include "components/ogre/ogreopcode/include/OgreCollisionContext.h"
+#include "components/ogre/ogreopcode/include/OgreCollisionObject.h"
+#include "components/ogre/ogreopcode/include/OgreBoxCollisionShape.h"
+
+#include <OgreRoot.h>
+#include <OgreSceneManager.h>
+
+#include <cstdlib>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace OgreOpcode::Details;
+
+namespace Ember
+{
+
+/**
+ * Tests the dynamic AABB tree used by OgreOpcode::CollisionContext for its ray, sphere and swept sphere checks.
+ *
+ * The results of the tree are compared with a brute force scan over all boxes, which is what the collision context used to do.
+ * The context test places 10000 objects in a collision context, which is far more than a typical world contains, and checks that ray checks through the context give the same results as a linear scan while testing only a few objects exactly.
+ */
+class OgreOpcodeTestCase: public CppUnit::TestFixture
+{
+CPPUNIT_TEST_SUITE(OgreOpcodeTestCase);
+	CPPUNIT_TEST(testBoxQuery);
+	CPPUNIT_TEST(testRayCast);
+	CPPUNIT_TEST(testMoveAndRemove);
+	CPPUNIT_TEST(testContextRayCheck);
+
+	CPPUNIT_TEST_SUITE_END()
+	;
+
+	struct Box
+	{
+		Ogre::Vector3 minv;
+		Ogre::Vector3 maxv;
+		int proxy;
+		bool inTree;
+	};
+
+	std::vector<Box> mBoxes;
+
+	static Ogre::Real random(Ogre::Real min, Ogre::Real max)
+	{
+		return min + (max - min) * (static_cast<Ogre::Real>(std::rand()) / RAND_MAX);
+	}
+
+	static Ogre::Vector3 randomPoint(Ogre::Real extent)
+	{
+		return Ogre::Vector3(random(-extent, extent), random(-extent, extent), random(-extent, extent));
+	}
+
+	static void randomBox(Box& box, Ogre::Real extent)
+	{
+		Ogre::Vector3 center = randomPoint(extent);
+		Ogre::Vector3 halfSize(random(0.5, 5), random(0.5, 5), random(0.5, 5));
+		box.minv = center - halfSize;
+		box.maxv = center + halfSize;
+	}
+
+	static bool overlaps(const Box& box, const Ogre::Vector3& minv, const Ogre::Vector3& maxv)
+	{
+		return box.minv.x <= maxv.x && box.maxv.x >= minv.x && box.minv.y <= maxv.y && box.maxv.y >= minv.y && box.minv.z <= maxv.z && box.maxv.z >= minv.z;
+	}
+
+	static Ogre::Vector3 inverse(const Ogre::Vector3& direction)
+	{
+		return Ogre::Vector3(direction.x != 0 ? 1.0f / direction.x : std::numeric_limits<Ogre::Real>::infinity(), direction.y != 0 ? 1.0f / direction.y : std::numeric_limits<Ogre::Real>::infinity(), direction.z != 0 ? 1.0f / direction.z : std::numeric_limits<Ogre::Real>::infinity());
+	}
+
+	void fillTree(DynamicAABBTree& tree, size_t count, Ogre::Real extent)
+	{
+		std::srand(42);
+		mBoxes.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			randomBox(mBoxes[i], extent);
+			mBoxes[i].proxy = tree.createProxy(mBoxes[i].minv, mBoxes[i].maxv, &mBoxes[i]);
+			mBoxes[i].inTree = true;
+		}
+	}
+
+	/**
+	 * Collects all boxes whose exact bounds overlap the query box, as the collision context does after the fat bounds have been tested.
+	 */
+	struct OverlapCollector
+	{
+		Ogre::Vector3 minv, maxv;
+		std::set<const Box*> found;
+		bool operator()(void* userData)
+		{
+			const Box* box = static_cast<const Box*>(userData);
+			if (overlaps(*box, minv, maxv)) {
+				found.insert(box);
+			}
+			return true;
+		}
+	};
+
+	/**
+	 * Finds the closest box hit by a ray, clipping the ray at each hit.
+	 */
+	struct ClosestHit
+	{
+		Ogre::Vector3 origin, inverseDirection;
+		const Box* closest;
+		Ogre::Real distance;
+		int tested;
+		Ogre::Real operator()(void* userData, Ogre::Real maxDistance)
+		{
+			const Box* box = static_cast<const Box*>(userData);
+			tested++;
+			Ogre::Real entry;
+			if (DynamicAABBTree::rayIntersectsBox(origin, inverseDirection, box->minv, box->maxv, maxDistance, entry) && entry < distance) {
+				distance = entry;
+				closest = box;
+				return entry;
+			}
+			return maxDistance;
+		}
+	};
+
+	std::set<const Box*> bruteForceOverlaps(const Ogre::Vector3& minv, const Ogre::Vector3& maxv) const
+	{
+		std::set<const Box*> found;
+		for (std::vector<Box>::const_iterator I = mBoxes.begin(); I != mBoxes.end(); ++I) {
+			if (I->inTree && overlaps(*I, minv, maxv)) {
+				found.insert(&*I);
+			}
+		}
+		return found;
+	}
+
+	Ogre::Real bruteForceClosest(const Ogre::Ray& ray, Ogre::Real maxDistance) const
+	{
+		Ogre::Vector3 direction = ray.getDirection().normalisedCopy();
+		Ogre::Vector3 inverseDirection = inverse(direction);
+		Ogre::Real closest = maxDistance + 1;
+		for (std::vector<Box>::const_iterator I = mBoxes.begin(); I != mBoxes.end(); ++I) {
+			Ogre::Real entry;
+			if (I->inTree && DynamicAABBTree::rayIntersectsBox(ray.getOrigin(), inverseDirection, I->minv, I->maxv, maxDistance, entry) && entry < closest) {
+				closest = entry;
+			}
+		}
+		return closest;
+	}
+
+	/**
+	 * Finds the closest hit by testing every object whose bounds overlap the bounds of the ray.
+	 * @return The distance to the closest hit, or -1 if nothing was hit.
+	 */
+	static Ogre::Real bruteForceRayCheck(const std::vector<OgreOpcode::CollisionObject*>& objects, const Ogre::Ray& ray, Ogre::Real maxDistance)
+	{
+		Ogre::Vector3 rayMin = ray.getOrigin();
+		Ogre::Vector3 rayMax = ray.getOrigin();
+		rayMin.makeFloor(ray.getPoint(maxDistance));
+		rayMax.makeCeil(ray.getPoint(maxDistance));
+		Ogre::Real closest = -1;
+		for (std::vector<OgreOpcode::CollisionObject*>::const_iterator I = objects.begin(); I != objects.end(); ++I) {
+			OgreOpcode::ICollisionShape* shape = (*I)->getShape();
+			Box box;
+			shape->getMinMax(box.minv, box.maxv);
+			if (overlaps(box, rayMin, rayMax)) {
+				OgreOpcode::CollisionPair pair;
+				if (shape->rayCheck(OgreOpcode::COLLTYPE_CONTACT, (*I)->getTransform(), ray, maxDistance, pair, true) && (closest < 0 || pair.distance < closest)) {
+					closest = pair.distance;
+				}
+			}
+		}
+		return closest;
+	}
+
+	Ogre::Real treeClosest(const DynamicAABBTree& tree, const Ogre::Ray& ray, Ogre::Real maxDistance, int& tested) const
+	{
+		ClosestHit hit;
+		hit.origin = ray.getOrigin();
+		hit.inverseDirection = inverse(ray.getDirection().normalisedCopy());
+		hit.closest = 0;
+		hit.distance = maxDistance + 1;
+		hit.tested = 0;
+		tree.rayCast(ray, maxDistance, hit);
+		tested = hit.tested;
+		return hit.distance;
+	}
+
+	void checkQueries(const DynamicAABBTree& tree, Ogre::Real extent, int iterations)
+	{
+		for (int i = 0; i < iterations; ++i) {
+			Box queryBox;
+			randomBox(queryBox, extent);
+			OverlapCollector collector;
+			collector.minv = queryBox.minv;
+			collector.maxv = queryBox.maxv;
+			tree.query(queryBox.minv, queryBox.maxv, collector);
+			CPPUNIT_ASSERT(collector.found == bruteForceOverlaps(queryBox.minv, queryBox.maxv));
+
+			Ogre::Ray ray(randomPoint(extent), randomPoint(1));
+			Ogre::Real maxDistance = random(1, extent * 2);
+			int tested;
+			CPPUNIT_ASSERT_DOUBLES_EQUAL(bruteForceClosest(ray, maxDistance), treeClosest(tree, ray, maxDistance, tested), 0.0001);
+		}
+	}
+
+public:
+
+	void testBoxQuery()
+	{
+		DynamicAABBTree tree;
+		fillTree(tree, 1000, 100);
+		CPPUNIT_ASSERT_EQUAL(1000, tree.getProxyCount());
+		//The tree should be balanced; a generous bound still catches a degenerate list.
+		CPPUNIT_ASSERT(tree.getHeight() < 40);
+
+		for (int i = 0; i < 200; ++i) {
+			Box queryBox;
+			randomBox(queryBox, 100);
+			OverlapCollector collector;
+			collector.minv = queryBox.minv;
+			collector.maxv = queryBox.maxv;
+			tree.query(queryBox.minv, queryBox.maxv, collector);
+			CPPUNIT_ASSERT(collector.found == bruteForceOverlaps(queryBox.minv, queryBox.maxv));
+		}
+	}
+
+	void testRayCast()
+	{
+		DynamicAABBTree tree;
+		fillTree(tree, 1000, 100);
+
+		for (int i = 0; i < 200; ++i) {
+			Ogre::Ray ray(randomPoint(100), randomPoint(1));
+			Ogre::Real maxDistance = random(1, 200);
+			int tested;
+			CPPUNIT_ASSERT_DOUBLES_EQUAL(bruteForceClosest(ray, maxDistance), treeClosest(tree, ray, maxDistance, tested), 0.0001);
+		}
+
+		//Axis aligned rays exercise the parallel slab case.
+		Ogre::Ray axisRay(Ogre::Vector3(-200, 0, 0), Ogre::Vector3::UNIT_X);
+		int tested;
+		CPPUNIT_ASSERT_DOUBLES_EQUAL(bruteForceClosest(axisRay, 400), treeClosest(tree, axisRay, 400, tested), 0.0001);
+	}
+
+	void testMoveAndRemove()
+	{
+		DynamicAABBTree tree;
+		fillTree(tree, 1000, 100);
+
+		for (size_t i = 0; i < mBoxes.size(); i += 3) {
+			//Small moves should stay within the fat bounds, large ones force a reinsertion.
+			Ogre::Vector3 offset = (i % 2) ? randomPoint(0.05) : randomPoint(20);
+			mBoxes[i].minv += offset;
+			mBoxes[i].maxv += offset;
+			tree.moveProxy(mBoxes[i].proxy, mBoxes[i].minv, mBoxes[i].maxv);
+		}
+		for (size_t i = 1; i < mBoxes.size(); i += 4) {
+			tree.destroyProxy(mBoxes[i].proxy);
+			mBoxes[i].inTree = false;
+		}
+		CPPUNIT_ASSERT_EQUAL(750, tree.getProxyCount());
+		checkQueries(tree, 100, 200);
+
+		//Removed nodes should be reused.
+		for (size_t i = 1; i < mBoxes.size(); i += 4) {
+			mBoxes[i].proxy = tree.createProxy(mBoxes[i].minv, mBoxes[i].maxv, &mBoxes[i]);
+			mBoxes[i].inTree = true;
+		}
+		CPPUNIT_ASSERT_EQUAL(1000, tree.getProxyCount());
+		checkQueries(tree, 100, 200);
+	}
+
+	/**
+	 * Runs closest hit ray checks through a CollisionContext holding 10000 objects, and compares them with a linear scan over the same objects, which is how the context used to do it.
+	 */
+	void testContextRayCheck()
+	{
+		const int objectCount = 10000;
+		const int rayCount = 1000;
+		const Ogre::Real extent = 250;
+
+		Ogre::Root root;
+		Ogre::SceneManager* sceneManager = root.createSceneManager(Ogre::ST_GENERIC);
+		{
+			OgreOpcode::CollisionManager collisionManager(sceneManager);
+			collisionManager.addCollClass("object");
+			OgreOpcode::CollisionContext* context = collisionManager.createContext("raycheck");
+
+			std::srand(42);
+			for (int i = 0; i < objectCount; ++i) {
+				std::stringstream ss;
+				ss << "object" << i;
+				Ogre::SceneNode* node = sceneManager->getRootSceneNode()->createChildSceneNode(ss.str(), randomPoint(extent));
+				OgreOpcode::BoxCollisionShape* shape = collisionManager.createBoxCollisionShape(ss.str());
+				shape->load(node, 1 + std::rand() % 5, 1 + std::rand() % 5, 1 + std::rand() % 5);
+				OgreOpcode::CollisionObject* object = context->createObject(ss.str());
+				object->setCollClass("object");
+				object->setShape(shape);
+				context->addObject(object);
+			}
+			//Calculate the bounds of all objects.
+			context->update();
+			const std::vector<OgreOpcode::CollisionObject*> objects = context->getAttachedObjects();
+			CPPUNIT_ASSERT_EQUAL(objectCount, static_cast<int>(objects.size()));
+
+			std::vector<Ogre::Ray> rays;
+			std::vector<Ogre::Real> distances;
+			for (int i = 0; i < rayCount; ++i) {
+				rays.push_back(Ogre::Ray(randomPoint(extent), randomPoint(1).normalisedCopy()));
+				distances.push_back(random(10, extent));
+			}
+
+			std::vector<Ogre::Real> bruteForceResults;
+			for (int i = 0; i < rayCount; ++i) {
+				bruteForceResults.push_back(bruteForceRayCheck(objects, rays[i], distances[i]));
+			}
+
+			std::vector<Ogre::Real> contextResults;
+			long totalTested = 0;
+			for (int i = 0; i < rayCount; ++i) {
+				OgreOpcode::CollisionPair** pairs = 0;
+				int hits = context->rayCheck(rays[i], distances[i], OgreOpcode::COLLTYPE_CONTACT, OgreOpcode::COLLTYPE_ALWAYS_CONTACT, pairs);
+				//Only the closest contact should be reported.
+				CPPUNIT_ASSERT(hits <= 1);
+				contextResults.push_back(hits ? pairs[0]->distance : -1);
+				totalTested += context->getCheckReport().mTotalObjObjTests;
+			}
+
+			for (int i = 0; i < rayCount; ++i) {
+				CPPUNIT_ASSERT_DOUBLES_EQUAL(bruteForceResults[i], contextResults[i], 0.001);
+			}
+			//The tree should limit the exact tests to the few objects closest along each ray.
+			CPPUNIT_ASSERT(totalTested < static_cast<long>(rayCount) * objectCount / 100);
+		}
+	}
+
+};
+
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Ember::OgreOpcodeTestCase);
+
+int main(int argc, char **argv)
+{
+	CppUnit::TextUi::TestRunner runner;
+	CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+	runner.addTest(registry.makeTest());
+
+	// Shows a message as each test starts
+	CppUnit::BriefTestProgressListener listener;
+	runner.eventManager().addListener(&listener);
+
+	bool wasSuccessful = runner.run("", false);
+	return !wasSuccessful;
+}
@@ -3,9 +3,11 @@
 
 #include "ConvertTestCase.h"
 #include "ModelMountTestCase.h"
+#include "GraphicsLevelControllerTestCase.h"
 
 CPPUNIT_TEST_SUITE_REGISTRATION( Ember::ConvertTestCase);
 CPPUNIT_TEST_SUITE_REGISTRATION( Ember::ModelMountTestCase );
+CPPUNIT_TEST_SUITE_REGISTRATION( Ember::GraphicsLevelControllerTestCase );
 
 int main(int argc, char **argv)
 {
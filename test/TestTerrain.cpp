@@ -11,6 +11,9 @@
 #include "components/ogre/terrain/TerrainDefPoint.h"
 #include "components/ogre/terrain/TerrainInfo.h"
 #include "components/ogre/terrain/TerrainMod.h"
+#include "components/ogre/terrain/TerrainPage.h"
+#include "components/ogre/terrain/TerrainPageGeometry.h"
+#include "components/ogre/SceneManagers/EmberPagingSceneManager/include/OgrePagingLandScapeHeightPyramid.h"
 
 #include "framework/Exception.h"
 #include "framework/TimeFrame.h"
@@ -52,9 +55,17 @@ class DummyTerrainBridge: public ITerrainPageBridge
 public:
 
 	bool pageReady;
+	int updatedCount;
+
+	/**
+	 * @brief The height data and pyramid in use, as the Ogre side keeps them.
+	 */
+	std::vector<Ogre::Real> heightData;
+	size_t pageSize;
+	Ogre::PagingLandScapeHeightPyramid heightPyramid;
 
 	DummyTerrainBridge() :
-		pageReady(false)
+		pageReady(false), updatedCount(0), pageSize(0), mPendingPageSize(0)
 	{
 	}
 
@@ -65,6 +76,11 @@ public:
 	 */
 	virtual void updateTerrain(TerrainPageGeometry& geometry)
 	{
+		std::vector<float> floatHeightData(geometry.getPage().getVerticeCount());
+		geometry.updateOgreHeightData(&floatHeightData.front());
+		mPendingHeightData.assign(floatHeightData.begin(), floatHeightData.end());
+		mPendingPageSize = geometry.getPage().getPageSize();
+		mPendingHeightPyramid.build(&mPendingHeightData.front(), mPendingPageSize);
 	}
 
 	/**
@@ -72,9 +88,51 @@ public:
 	 */
 	virtual void terrainPageReady()
 	{
+		install();
 		pageReady = true;
 	}
 
+	virtual void terrainPageUpdated()
+	{
+		install();
+		updatedCount++;
+	}
+
+	/**
+	 * @brief Casts a ray straight down through the middle of the page.
+	 * @param height Set to the height of the terrain where the ray hit it.
+	 * @return True if the terrain was hit.
+	 */
+	bool castRayDown(Ogre::Real& height) const
+	{
+		if (!heightPyramid.isBuilt()) {
+			return false;
+		}
+		const Ogre::Real top = 1000;
+		Ogre::Real t;
+		if (heightPyramid.intersect(&heightData.front(), Ogre::Vector3(pageSize / 2, top, pageSize / 2), Ogre::Vector3::NEGATIVE_UNIT_Y, 0, top * 2, t)) {
+			height = top - t;
+			return true;
+		}
+		return false;
+	}
+
+private:
+
+	/**
+	 * @brief Data prepared in the background thread, waiting to be installed in the main thread.
+	 */
+	std::vector<Ogre::Real> mPendingHeightData;
+	size_t mPendingPageSize;
+	Ogre::PagingLandScapeHeightPyramid mPendingHeightPyramid;
+
+	void install()
+	{
+		heightData.swap(mPendingHeightData);
+		pageSize = mPendingPageSize;
+		heightPyramid.swap(mPendingHeightPyramid);
+	}
+
 };
 
 class DummyEntity: public Eris::Entity
@@ -300,6 +358,8 @@ public:
 		return worldSizeChangedListener.getCompletedCount() > 0;
 	}
 
+	std::vector<DummyTerrainBridge*> bridges;
+
 	bool createPages()
 	{
 		DummyTerrainBridge* bridge1 = new DummyTerrainBridge();
@@ -311,6 +371,10 @@ public:
 		terrainHandler.setUpTerrainPageAtIndex(TerrainIndex(0, 1), bridge2);
 		terrainHandler.setUpTerrainPageAtIndex(TerrainIndex(-1, 0), bridge3);
 		terrainHandler.setUpTerrainPageAtIndex(TerrainIndex(-1, 1), bridge4);
+		bridges.push_back(bridge1);
+		bridges.push_back(bridge2);
+		bridges.push_back(bridge3);
+		bridges.push_back(bridge4);
 
 		{
 			Timer timer;
@@ -353,6 +417,7 @@ class TerrainTestCase: public CppUnit::TestFixture
 //	CPPUNIT_TEST( testCreateTerrain);
 //	CPPUNIT_TEST( testAlterTerrain);
 	CPPUNIT_TEST( testApplyMod);
+	CPPUNIT_TEST( testRayAfterAlter);
 //	CPPUNIT_TEST( testUpdateMod);
 
 CPPUNIT_TEST_SUITE_END();
@@ -416,6 +481,53 @@ public:
 		CPPUNIT_ASSERT(height == -200);
 	}
 
+	/**
+	 * Raises the terrain and checks that rays hit the new heights, i.e. that the rebuilt height pyramid is installed when the pages are updated.
+	 */
+	void testRayAfterAlter()
+	{
+
+		Ogre::Root root;
+		TerrainSetup terrainSetup;
+
+		Terrain::TerrainHandler& terrainHandler = terrainSetup.terrainHandler;
+		CPPUNIT_ASSERT(terrainSetup.createBaseTerrain(25.0f));
+		CPPUNIT_ASSERT(terrainSetup.createPages());
+		CPPUNIT_ASSERT(terrainSetup.reloadTerrain());
+
+		DummyTerrainBridge* bridge = terrainSetup.bridges.front();
+		Ogre::Real height = 0;
+		CPPUNIT_ASSERT(bridge->castRayDown(height));
+		CPPUNIT_ASSERT(height < 50);
+
+		int updatedCount = bridge->updatedCount;
+
+		TerrainDefPointStore terrainDefPoints;
+		terrainDefPoints.push_back(TerrainDefPoint(-1, -1, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(-1, 0, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(-1, 1, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(0, -1, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(0, 0, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(0, 1, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(1, -1, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(1, 0, 200));
+		terrainDefPoints.push_back(TerrainDefPoint(1, 1, 200));
+
+		terrainHandler.updateTerrain(terrainDefPoints);
+
+		{
+			Timer timer;
+			do {
+				terrainHandler.pollTasks(TimeFrame(boost::posix_time::seconds(10)));
+			} while ((!timer.hasElapsed(5000)) && bridge->updatedCount == updatedCount);
+		}
+		CPPUNIT_ASSERT(bridge->updatedCount > updatedCount);
+
+		//A stale pyramid would make the ray pass through the raised terrain.
+		CPPUNIT_ASSERT(bridge->castRayDown(height));
+		CPPUNIT_ASSERT(height > 150);
+	}
+
 	void testApplyMod()
 	{
 
@@ -0,0 +1,248 @@
+#include <cppunit/extensions/TestFactoryRegistry.h>
+#include <cppunit/ui/text/TestRunner.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/BriefTestProgressListener.h>
+#include <cppunit/TestResult.h>
+
+#include "services/wfut/WfutChecksumCache.h"
+#include "services/wfut/WfutChecksumTask.h"
+#include "services/wfut/WfutSession.h"
+
+#include <sigc++/functors/mem_fun.h>
+
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <set>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Ember
+{
+
+namespace
+{
+const int DOWNLOAD_FILE_COUNT = 6;
+const unsigned int MAX_CONCURRENT_DOWNLOADS = 2;
+}
+
+class WfutChecksumTestCase: public CppUnit::TestFixture
+{
+CPPUNIT_TEST_SUITE(WfutChecksumTestCase);
+	CPPUNIT_TEST(testChecksum);
+	CPPUNIT_TEST(testCachePersistence);
+	CPPUNIT_TEST(testCacheInvalidation);
+	CPPUNIT_TEST(testBoundedDownloads);
+
+	CPPUNIT_TEST_SUITE_END()
+	;
+
+	WfutSession* mSession;
+	std::set<std::string> mDownloadedFiles;
+	int mFailedDownloads;
+	unsigned int mMaxObservedDownloads;
+
+	static std::string downloadFileName(int index)
+	{
+		std::stringstream ss;
+		ss << "file" << index << ".txt";
+		return ss.str();
+	}
+
+	void observeActiveDownloads()
+	{
+		if (mSession) {
+			mMaxObservedDownloads = std::max(mMaxObservedDownloads, mSession->getNumberOfActiveDownloads());
+		}
+	}
+
+	void session_DownloadComplete(const std::string& url, const std::string& filename)
+	{
+		mDownloadedFiles.insert(filename);
+		observeActiveDownloads();
+	}
+
+	void session_DownloadFailed(const std::string& url, const std::string& filename, const std::string& reason)
+	{
+		mFailedDownloads++;
+		observeActiveDownloads();
+	}
+
+	void session_ServerListDownloading(const std::string& url)
+	{
+	}
+
+	void session_UpdatesCalculated(size_t numberOfUpdates)
+	{
+		CPPUNIT_ASSERT(numberOfUpdates == static_cast<size_t>(DOWNLOAD_FILE_COUNT));
+	}
+
+public:
+	void tearDown()
+	{
+		std::remove("TestWfut.data");
+		std::remove("TestWfut.cache");
+		for (int i = 0; i < DOWNLOAD_FILE_COUNT; ++i) {
+			std::remove(("TestWfutServer/channel/" + downloadFileName(i)).c_str());
+			std::remove(("TestWfutLocal/channel/" + downloadFileName(i)).c_str());
+		}
+		std::remove("TestWfutServer/channel/wfut.xml");
+		std::remove("TestWfutServer/channel");
+		std::remove("TestWfutServer");
+		std::remove("TestWfutLocal/channel/wfut.xml");
+		std::remove("TestWfutLocal/channel/wfutchecksums");
+		std::remove("TestWfutLocal/channel");
+		std::remove("TestWfutLocal");
+	}
+
+	void testChecksum()
+	{
+		{
+			std::ofstream stream("TestWfut.data", std::ios::out | std::ios::binary);
+			stream << "123456789";
+		}
+		unsigned long checksum = 0;
+		CPPUNIT_ASSERT(WfutChecksumTask::calculateChecksum("TestWfut.data", checksum));
+		//The standard CRC32 check value.
+		CPPUNIT_ASSERT(checksum == 0xCBF43926UL);
+
+		CPPUNIT_ASSERT(!WfutChecksumTask::calculateChecksum("TestWfut.nonexisting", checksum));
+	}
+
+	void testCachePersistence()
+	{
+		{
+			WfutChecksumCache cache("TestWfut.cache");
+			CPPUNIT_ASSERT(!cache.load());
+			cache.setChecksum("media/a file.png", 100, 1000, 12345);
+			cache.setChecksum("media/b.png", 200, 2000, 67890);
+			CPPUNIT_ASSERT(cache.save());
+		}
+		WfutChecksumCache cache("TestWfut.cache");
+		CPPUNIT_ASSERT(cache.load());
+		CPPUNIT_ASSERT(cache.size() == 2);
+		unsigned long checksum = 0;
+		CPPUNIT_ASSERT(cache.getChecksum("media/a file.png", 100, 1000, checksum));
+		CPPUNIT_ASSERT(checksum == 12345);
+		CPPUNIT_ASSERT(cache.getChecksum("media/b.png", 200, 2000, checksum));
+		CPPUNIT_ASSERT(checksum == 67890);
+	}
+
+	void testCacheInvalidation()
+	{
+		WfutChecksumCache cache("TestWfut.cache");
+		cache.setChecksum("media/a.png", 100, 1000, 12345);
+		unsigned long checksum = 0;
+		CPPUNIT_ASSERT(!cache.getChecksum("media/a.png", 101, 1000, checksum));
+		CPPUNIT_ASSERT(!cache.getChecksum("media/a.png", 100, 1001, checksum));
+		CPPUNIT_ASSERT(!cache.getChecksum("media/c.png", 100, 1000, checksum));
+		cache.removeChecksum("media/a.png");
+		CPPUNIT_ASSERT(!cache.getChecksum("media/a.png", 100, 1000, checksum));
+	}
+
+	/**
+	 * Downloads a channel from a "file://" server root, and checks that no more than the allowed number of files are downloaded at once.
+	 */
+	void testBoundedDownloads()
+	{
+		mkdir("TestWfutServer", 0755);
+		mkdir("TestWfutServer/channel", 0755);
+		mkdir("TestWfutLocal", 0755);
+		mkdir("TestWfutLocal/channel", 0755);
+
+		WFUT::ChannelFileList serverList;
+		serverList.setName("channel");
+		for (int i = 0; i < DOWNLOAD_FILE_COUNT; ++i) {
+			WFUT::FileObject fileObject;
+			fileObject.filename = downloadFileName(i);
+			const std::string path = "TestWfutServer/channel/" + fileObject.filename;
+			{
+				std::ofstream stream(path.c_str(), std::ios::out | std::ios::binary);
+				for (int j = 0; j <= i * 1000; ++j) {
+					stream << "content of file " << i << "\n";
+				}
+			}
+			unsigned long checksum = 0;
+			CPPUNIT_ASSERT(WfutChecksumTask::calculateChecksum(path, checksum));
+			size_t size = 0;
+			std::time_t modificationTime;
+			CPPUNIT_ASSERT(WfutChecksumCache::statFile(path, size, modificationTime));
+			fileObject.crc32 = checksum;
+			fileObject.size = size;
+			fileObject.version = 1;
+			fileObject.execute = false;
+			fileObject.deleted = false;
+			serverList.addFile(fileObject);
+		}
+
+		char cwd[4096];
+		CPPUNIT_ASSERT(getcwd(cwd, sizeof(cwd)));
+		const std::string serverRoot = std::string("file://") + cwd + "/TestWfutServer";
+
+		mSession = 0;
+		mFailedDownloads = 0;
+		mMaxObservedDownloads = 0;
+		mDownloadedFiles.clear();
+
+		sigc::slot<void, const std::string&, const std::string&> downloadCompleteSlot = sigc::mem_fun(*this, &WfutChecksumTestCase::session_DownloadComplete);
+		sigc::slot<void, const std::string&, const std::string&, const std::string&> downloadFailedSlot = sigc::mem_fun(*this, &WfutChecksumTestCase::session_DownloadFailed);
+		sigc::slot<void, const std::string&> serverListDownloadingSlot = sigc::mem_fun(*this, &WfutChecksumTestCase::session_ServerListDownloading);
+		sigc::slot<void, size_t> updatesCalculatedSlot = sigc::mem_fun(*this, &WfutChecksumTestCase::session_UpdatesCalculated);
+		{
+			WfutSession session(downloadCompleteSlot, downloadFailedSlot, serverListDownloadingSlot, updatesCalculatedSlot);
+			mSession = &session;
+			session.setMaxConcurrentDownloads(MAX_CONCURRENT_DOWNLOADS);
+			session.init();
+			WFUT::WFUTClient writer;
+			writer.init();
+			writer.saveLocalList(serverList, "TestWfutServer/channel/wfut.xml");
+			writer.shutdown();
+
+			session.startUpdate(serverRoot, "channel", "TestWfutLocal", "");
+			//Only as many downloads as allowed should have been started; the rest should be waiting.
+			CPPUNIT_ASSERT_EQUAL(MAX_CONCURRENT_DOWNLOADS, session.getNumberOfActiveDownloads());
+
+			for (int i = 0; i < 1000 && session.poll() != 0; ++i) {
+				observeActiveDownloads();
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			observeActiveDownloads();
+			CPPUNIT_ASSERT_EQUAL(0u, session.getNumberOfActiveDownloads());
+			mSession = 0;
+		}
+
+		CPPUNIT_ASSERT_EQUAL(0, mFailedDownloads);
+		CPPUNIT_ASSERT(mMaxObservedDownloads <= MAX_CONCURRENT_DOWNLOADS);
+		CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(DOWNLOAD_FILE_COUNT), mDownloadedFiles.size());
+		for (int i = 0; i < DOWNLOAD_FILE_COUNT; ++i) {
+			const std::string filename = downloadFileName(i);
+			CPPUNIT_ASSERT(mDownloadedFiles.count(filename) == 1);
+			unsigned long checksum = 0;
+			CPPUNIT_ASSERT(WfutChecksumTask::calculateChecksum("TestWfutLocal/channel/" + filename, checksum));
+			CPPUNIT_ASSERT(checksum == serverList.getFiles().find(filename)->second.crc32);
+		}
+	}
+
+};
+
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Ember::WfutChecksumTestCase);
+
+int main(int argc, char **argv)
+{
+	CppUnit::TextUi::TestRunner runner;
+	CppUnit::TestFactoryRegistry &registry = CppUnit::TestFactoryRegistry::getRegistry();
+	runner.addTest(registry.makeTest());
+
+	// Shows a message as each test starts
+	CppUnit::BriefTestProgressListener listener;
+	runner.eventManager().addListener(&listener);
+
+	bool wasSuccessful = runner.run("", false);
+	return !wasSuccessful;
+}